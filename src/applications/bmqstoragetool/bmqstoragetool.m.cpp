@@ -20,13 +20,18 @@
 
 // bmqstoragetool
 #include <m_bmqstoragetool_commandprocessorfactory.h>
+#include <m_bmqstoragetool_guidindex.h>
 #include <m_bmqstoragetool_parameters.h>
 
+// BMQ
+#include <bmqu_memoutstream.h>
+
 // BDE
 #include <balcl_commandline.h>
 #include <bdls_filesystemutil.h>
 #include <bsl_exception.h>
 #include <bsl_iostream.h>
+#include <bsl_optional.h>
 #include <bslma_managedptr.h>
 
 using namespace BloombergLP;
@@ -82,9 +87,17 @@ static bool parseArgs(CommandLineArguments& arguments,
          "from the latest snapshot",
          balcl::TypeInfo(&arguments.d_cslFromBegin),
          balcl::OccurrenceInfo::e_OPTIONAL},
+        {"csl-cache",
+         "csl cache file",
+         "path to a file caching the queue map built from the CSL file, "
+         "created if missing, so that subsequent runs only decode the CSL "
+         "records appended since",
+         balcl::TypeInfo(&arguments.d_cslCacheFile),
+         balcl::OccurrenceInfo::e_OPTIONAL},
         {"print-mode",
          "print mode",
-         "can be one of the following {human|json-pretty|json-line}",
+         "can be one of the following "
+         "{human|json-pretty|json-line|columnar}",
          balcl::TypeInfo(&arguments.d_printMode,
                          CommandLineArguments::isValidPrintMode),
          balcl::OccurrenceInfo("human")},
@@ -190,6 +203,24 @@ static bool parseArgs(CommandLineArguments& arguments,
          "limit of queues to display in CSL file summary",
          balcl::TypeInfo(&arguments.d_cslSummaryQueuesLimit),
          balcl::OccurrenceInfo(50)},
+        {"threads",
+         "threads",
+         "number of threads scanning the journal file in parallel",
+         balcl::TypeInfo(&arguments.d_threads),
+         balcl::OccurrenceInfo(1)},
+        {"build-guid-index",
+         "build guid index",
+         "build the GUID index of the journal file, used to speed up "
+         "subsequent --guid searches, and exit",
+         balcl::TypeInfo(&arguments.d_buildGuidIndex),
+         balcl::OccurrenceInfo::e_OPTIONAL},
+        {"follow",
+         "follow",
+         "once the end of the journal file is reached, keep polling it for "
+         "records appended by a running broker and process them as they "
+         "land, until the file is removed",
+         balcl::TypeInfo(&arguments.d_follow),
+         balcl::OccurrenceInfo::e_OPTIONAL},
         {"h|help",
          "help",
          "print usage)",
@@ -221,7 +252,8 @@ int main(int argc, const char* argv[])
         rc_SUCCESS                       = 0,
         rc_ARGUMENTS_PARSING_FAILED      = -1,
         rc_FILE_MANAGER_INIT_FAILED      = -2,
-        rc_COMMAND_PROCESSOR_INIT_FAILED = -3
+        rc_COMMAND_PROCESSOR_INIT_FAILED = -3,
+        rc_GUID_INDEX_BUILD_FAILED       = -4
     };
 
     // Init allocator
@@ -244,6 +276,7 @@ int main(int argc, const char* argv[])
                                              arguments.d_dataFile,
                                              arguments.d_cslFile,
                                              arguments.d_cslFromBegin,
+                                             arguments.d_cslCacheFile,
                                              allocator),
                          allocator);
         if (!arguments.d_cslFile.empty()) {
@@ -256,6 +289,44 @@ int main(int argc, const char* argv[])
         return rc_FILE_MANAGER_INIT_FAILED;  // RETURN
     }
 
+    // Build or use the GUID index of the journal file
+    const bsl::string guidIndexPath = arguments.d_journalFile +
+                                      GuidIndexUtil::k_FILE_EXTENSION;
+    if (arguments.d_buildGuidIndex) {
+        bmqu::MemOutStream errorDescription(allocator);
+        if (0 != GuidIndexUtil::build(errorDescription,
+                                      guidIndexPath,
+                                      *fileManager->journalFileIterator(),
+                                      allocator)) {
+            bsl::cerr << "Failed to build GUID index: "
+                      << errorDescription.str();
+            return rc_GUID_INDEX_BUILD_FAILED;  // RETURN
+        }
+        bsl::cout << "GUID index written to " << guidIndexPath << '\n';
+        return rc_SUCCESS;  // RETURN
+    }
+    if (!parameters.d_guid.empty() &&
+        bdls::FilesystemUtil::isRegularFile(guidIndexPath)) {
+        bsl::optional<bsls::Types::Uint64> firstOffset;
+        bmqu::MemOutStream                 errorDescription(allocator);
+        const mqbs::JournalFileIterator&   journalIt =
+            *fileManager->journalFileIterator();
+        if (0 == GuidIndexUtil::findFirstOffset(&firstOffset,
+                                                errorDescription,
+                                                guidIndexPath,
+                                                journalIt,
+                                                parameters.d_guid)) {
+            // Start the search at the first record having one of the GUIDs,
+            // or past the last record if none of them is in the journal.
+            parameters.d_range.d_offsetGt =
+                firstOffset ? firstOffset.value() - 1
+                            : journalIt.lastRecordPosition();
+        }
+        else {
+            bsl::cerr << "Ignoring GUID index: " << errorDescription.str();
+        }
+    }
+
     // Create command processor
     bslma::ManagedPtr<CommandProcessor> processor =
         CommandProcessorFactory::createCommandProcessor(&parameters,
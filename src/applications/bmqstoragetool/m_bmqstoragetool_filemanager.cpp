@@ -15,6 +15,9 @@
 
 #include "m_bmqstoragetool_filemanager.h"
 
+// bmqstoragetool
+#include <m_bmqstoragetool_queuemapcache.h>
+
 // BMQ
 #include <bmqp_crc32c.h>
 
@@ -32,6 +35,7 @@
 // BDE
 #include <bdls_filesystemutil.h>
 #include <bdls_pathutil.h>
+#include <bsl_iostream.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_stdexcept.h>
@@ -111,10 +115,11 @@ FileManagerImpl::FileManagerImpl(const bsl::string& journalFile,
                                  const bsl::string& dataFile,
                                  const bsl::string& cslFile,
                                  bool               cslFromBegin,
+                                 const bsl::string& cslCacheFile,
                                  bslma::Allocator*  allocator)
 : d_journalFile(journalFile, allocator)
 , d_dataFile(dataFile, allocator)
-, d_cslFile(cslFile, cslFromBegin, allocator)
+, d_cslFile(cslFile, cslFromBegin, cslCacheFile, allocator)
 {
     bmqu::MemOutStream ss(allocator);
     if ((!d_journalFile.path().empty() && !d_journalFile.resetIterator(ss)) ||
@@ -198,10 +203,12 @@ bool FileManagerImpl::FileHandler<ITER>::resetIterator(
 
 FileManagerImpl::CslFileHandler::CslFileHandler(const bsl::string& path,
                                                 bool              cslFromBegin,
-                                                bslma::Allocator* allocator)
+                                                const bsl::string& cachePath,
+                                                bslma::Allocator*  allocator)
 : d_path(path)
 , d_ledger_p()
 , d_cslFromBegin(cslFromBegin)
+, d_cachePath(cachePath, allocator)
 , d_allocator(allocator)
 {
 }
@@ -334,34 +341,85 @@ void FileManagerImpl::CslFileHandler::fillQueueMap(QueueMap* queueMap_p) const
     typedef bsl::vector<QueueInfo>     QueueInfos;
     typedef QueueInfos::const_iterator QueueInfosIt;
 
-    // Process last snapshot
+    typedef QueueMapCacheUtil::RecordId RecordId;
+    const RecordId snapshotId = QueueMapCacheUtil::recordId(lastSnapshotIt);
+    RecordId       lastRecordId(snapshotId);
+
+    // Iterator over the records to apply, starting from the last snapshot
+    mqbc::IncoreClusterStateLedgerIterator cslIt(d_ledger_p.get());
+    cslIt.copy(lastSnapshotIt);
+
+    bool fromCache = false;
+    if (!d_cachePath.empty()) {
+        // Restore the queue map from the cache if it was built from the
+        // last snapshot, and skip without decoding the records it covers.
+        QueueMap           cachedQueueMap(d_allocator);
+        RecordId           cachedSnapshotId;
+        RecordId           cachedLastRecordId;
+        bmqu::MemOutStream errorDescr(d_allocator);
+        if (0 == QueueMapCacheUtil::load(&cachedQueueMap,
+                                         &cachedSnapshotId,
+                                         &cachedLastRecordId,
+                                         errorDescr,
+                                         d_cachePath,
+                                         d_allocator) &&
+            cachedSnapshotId == snapshotId) {
+            while (QueueMapCacheUtil::recordId(cslIt).d_offset <
+                       cachedLastRecordId.d_offset &&
+                   cslIt.next() == 0) {
+                // NOTHING
+            }
+            if (cslIt.isValid() &&
+                QueueMapCacheUtil::recordId(cslIt) == cachedLastRecordId) {
+                const QueueInfos queuesInfo = cachedQueueMap.queueInfos();
+                for (QueueInfosIt it = queuesInfo.cbegin();
+                     it != queuesInfo.cend();
+                     ++it) {
+                    queueMap_p->insert(*it);
+                }
+                lastRecordId = cachedLastRecordId;
+                fromCache    = true;
+            }
+            else {
+                // The CSL file does not contain the last cached record:
+                // rebuild the queue map from the snapshot.
+                cslIt.copy(lastSnapshotIt);
+            }
+        }
+    }
+
     ClusterMessage clusterMessage;
-    lastSnapshotIt.loadClusterMessage(&clusterMessage);
-    BSLS_ASSERT(clusterMessage.choice().selectionId() ==
-                ClusterMessageChoice::SELECTION_ID_LEADER_ADVISORY);
-
-    // Get queue info from snapshot (leaderAdvisory) record
-    LeaderAdvisory& leaderAdvisory = clusterMessage.choice().leaderAdvisory();
-    QueueInfos&     queuesInfo     = leaderAdvisory.queues();
-    {
-        // Fill queue map
-        QueueInfosIt it = queuesInfo.cbegin();
-        for (; it != queuesInfo.cend(); ++it) {
-            queueMap_p->insert(*it);
+    if (!fromCache) {
+        // Process last snapshot
+        cslIt.loadClusterMessage(&clusterMessage);
+        BSLS_ASSERT(clusterMessage.choice().selectionId() ==
+                    ClusterMessageChoice::SELECTION_ID_LEADER_ADVISORY);
+
+        // Get queue info from snapshot (leaderAdvisory) record
+        LeaderAdvisory& leaderAdvisory =
+            clusterMessage.choice().leaderAdvisory();
+        QueueInfos& queuesInfo = leaderAdvisory.queues();
+        {
+            // Fill queue map
+            QueueInfosIt it = queuesInfo.cbegin();
+            for (; it != queuesInfo.cend(); ++it) {
+                queueMap_p->insert(*it);
+            }
         }
     }
 
-    // Iterate from last snapshot to get updates
+    // Iterate from last snapshot (or last cached record) to get updates
     while (true) {
-        const int rc = lastSnapshotIt.next();
+        const int rc = cslIt.next();
         if (rc == 1 || rc < 0) {
             // End iterator reached or error occured.
             break;  // BREAK
         }
+        lastRecordId = QueueMapCacheUtil::recordId(cslIt);
 
-        if (lastSnapshotIt.header().recordType() ==
+        if (cslIt.header().recordType() ==
             mqbc::ClusterStateRecordType::e_UPDATE) {
-            lastSnapshotIt.loadClusterMessage(&clusterMessage);
+            cslIt.loadClusterMessage(&clusterMessage);
             // Process queueAssignmentAdvisory record
             if (clusterMessage.choice().selectionId() ==
                 ClusterMessageChoice::SELECTION_ID_QUEUE_ASSIGNMENT_ADVISORY) {
@@ -389,6 +447,20 @@ void FileManagerImpl::CslFileHandler::fillQueueMap(QueueMap* queueMap_p) const
             }
         }
     }
+
+    if (!d_cachePath.empty()) {
+        // Failing to update the cache only slows down the next run.
+        bmqu::MemOutStream errorDescr(d_allocator);
+        if (0 != QueueMapCacheUtil::save(errorDescr,
+                                         d_cachePath,
+                                         *queueMap_p,
+                                         snapshotId,
+                                         lastRecordId,
+                                         d_allocator)) {
+            bsl::cerr << "Failed to update CSL queue map cache: "
+                      << errorDescr.str();
+        }
+    }
 }
 
 }  // close package namespace
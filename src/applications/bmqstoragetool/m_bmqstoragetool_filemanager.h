@@ -34,7 +34,9 @@
 //    data files interators. Also retrieves a map of queue keys and names from
 //    a CSL file.
 //  'FileHandler'/'CslFileHandler' opens and closes the required files in RAII
-//  technique.
+//  technique.  'CslFileHandler' optionally keeps the queue map in a cache
+//  file (see 'm_bmqstoragetool_queuemapcache'), so that only the CSL records
+//  appended since the previous run are decoded.
 
 // bmqstoragetool
 #include <m_bmqstoragetool_queuemap.h>
@@ -116,12 +118,15 @@ class FileManagerImpl : public FileManager {
         bslma::ManagedPtr<mqbsl::Ledger>                          d_ledger_p;
         bslma::ManagedPtr<mqbc::IncoreClusterStateLedgerIterator> d_iter_p;
         bool              d_cslFromBegin;
+        /// Path of the queue map cache file, or empty if not cached
+        const bsl::string d_cachePath;
         bslma::Allocator* d_allocator;
 
       public:
         // CREATORS
         explicit CslFileHandler(const bsl::string& path,
                                 bool               cslFromBegin,
+                                const bsl::string& cachePath,
                                 bslma::Allocator*  allocator = 0);
 
         ~CslFileHandler();
@@ -139,7 +144,10 @@ class FileManagerImpl : public FileManager {
         /// File path
         const bsl::string& path() const;
 
-        /// Fill the specified `queueMap_p` with data from CSL file.
+        /// Fill the specified `queueMap_p` with data from CSL file.  If a
+        /// cache path was provided, restore the queue map from the cache
+        /// when it was built from the last snapshot of the CSL file, only
+        /// apply the records appended since, and update the cache.
         void fillQueueMap(QueueMap* queueMap_p) const;
     };
 
@@ -160,6 +168,7 @@ class FileManagerImpl : public FileManager {
                              const bsl::string& dataFile,
                              const bsl::string& cslFile,
                              bool               cslFromBegin,
+                             const bsl::string& cslCacheFile,
                              bslma::Allocator*  allocator = 0);
 
     // MANIPULATORS
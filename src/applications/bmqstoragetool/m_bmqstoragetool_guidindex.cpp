@@ -0,0 +1,244 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqstoragetool
+#include <m_bmqstoragetool_guidindex.h>
+
+// MQB
+#include <mqbs_filestoreprotocol.h>
+#include <mqbs_filesystemutil.h>
+#include <mqbs_mappedfiledescriptor.h>
+
+// BMQ
+#include <bmqt_messageguid.h>
+
+// BDE
+#include <bdlb_bigendian.h>
+#include <bdls_filesystemutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace m_bmqstoragetool {
+
+namespace {
+
+const char k_MAGIC[8] = {'B', 'M', 'Q', 'G', 'U', 'I', 'D', 'X'};
+
+/// On-disk header of a GUID index file.
+struct IndexHeader {
+    char                  d_magic[8];
+    bdlb::BigEndianUint64 d_lastRecordOffset;
+    bdlb::BigEndianUint64 d_numEntries;
+};
+
+/// On-disk entry of a GUID index file.
+struct IndexEntry {
+    unsigned char         d_guid[bmqt::MessageGUID::e_SIZE_BINARY];
+    bdlb::BigEndianUint64 d_recordOffset;
+};
+
+/// Return true if the specified `lhs` entry is ordered before the specified
+/// `rhs` one.
+bool entryLess(const IndexEntry& lhs, const IndexEntry& rhs)
+{
+    const int cmp = bsl::memcmp(lhs.d_guid, rhs.d_guid, sizeof(lhs.d_guid));
+    if (cmp != 0) {
+        return cmp < 0;  // RETURN
+    }
+    return static_cast<bsls::Types::Uint64>(lhs.d_recordOffset) <
+           static_cast<bsls::Types::Uint64>(rhs.d_recordOffset);
+}
+
+/// Return true if the GUID of the specified `entry` is ordered before the
+/// specified binary `guid`.
+bool entryGuidLess(const IndexEntry& entry, const unsigned char* guid)
+{
+    return bsl::memcmp(entry.d_guid, guid, sizeof(entry.d_guid)) < 0;
+}
+
+}  // close unnamed namespace
+
+// --------------------
+// struct GuidIndexUtil
+// --------------------
+
+// PUBLIC CONSTANTS
+const char GuidIndexUtil::k_FILE_EXTENSION[] = ".guidx";
+
+// CLASS METHODS
+int GuidIndexUtil::build(bsl::ostream&                    errorDescription,
+                         const bsl::string&               indexPath,
+                         const mqbs::JournalFileIterator& journalIt,
+                         bslma::Allocator*                allocator)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS        = 0,
+        rc_ITERATION_FAIL = -1,
+        rc_OPEN_FAIL      = -2,
+        rc_WRITE_FAIL     = -3
+    };
+
+    // PRECONDITIONS
+    BSLS_ASSERT(journalIt.isValid());
+
+    bsl::vector<IndexEntry> entries(allocator);
+
+    mqbs::JournalFileIterator iter(journalIt);
+    int                       rc = 0;
+    while ((rc = iter.nextRecord()) == 1) {
+        if (iter.recordType() != mqbs::RecordType::e_MESSAGE) {
+            continue;  // CONTINUE
+        }
+        IndexEntry entry;
+        iter.asMessageRecord().messageGUID().toBinary(entry.d_guid);
+        entry.d_recordOffset = iter.recordOffset();
+        entries.push_back(entry);
+    }
+    if (rc < 0) {
+        errorDescription << "Journal iteration aborted (exit status " << rc
+                         << ")\n";
+        return rc_ITERATION_FAIL;  // RETURN
+    }
+
+    bsl::sort(entries.begin(), entries.end(), entryLess);
+
+    IndexHeader header;
+    bsl::memcpy(header.d_magic, k_MAGIC, sizeof(k_MAGIC));
+    header.d_lastRecordOffset = journalIt.lastRecordPosition();
+    header.d_numEntries       = entries.size();
+
+    bsl::ofstream file(indexPath.c_str(),
+                       bsl::ios::out | bsl::ios::binary | bsl::ios::trunc);
+    if (!file) {
+        errorDescription << "Failed to open file [" << indexPath
+                         << "] for writing\n";
+        return rc_OPEN_FAIL;  // RETURN
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if (!entries.empty()) {
+        file.write(reinterpret_cast<const char*>(entries.data()),
+                   entries.size() * sizeof(IndexEntry));
+    }
+    file.close();
+    if (!file) {
+        errorDescription << "Failed to write file [" << indexPath << "]\n";
+        return rc_WRITE_FAIL;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int GuidIndexUtil::findFirstOffset(
+    bsl::optional<bsls::Types::Uint64>* firstOffset,
+    bsl::ostream&                       errorDescription,
+    const bsl::string&                  indexPath,
+    const mqbs::JournalFileIterator&    journalIt,
+    const bsl::vector<bsl::string>&     guids)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS        = 0,
+        rc_OPEN_FAIL      = -1,
+        rc_INVALID_HEADER = -2,
+        rc_INVALID_SIZE   = -3,
+        rc_STALE_INDEX    = -4
+    };
+
+    // PRECONDITIONS
+    BSLS_ASSERT(firstOffset);
+
+    firstOffset->reset();
+
+    if (!bdls::FilesystemUtil::isRegularFile(indexPath)) {
+        errorDescription << "File [" << indexPath << "] does not exist\n";
+        return rc_OPEN_FAIL;  // RETURN
+    }
+
+    const bsls::Types::Int64 fileSize = bdls::FilesystemUtil::getFileSize(
+        indexPath);
+    if (fileSize < static_cast<bsls::Types::Int64>(sizeof(IndexHeader))) {
+        errorDescription << "File [" << indexPath << "] is too small\n";
+        return rc_INVALID_HEADER;  // RETURN
+    }
+
+    mqbs::MappedFileDescriptor mfd;
+    int                        rc = mqbs::FileSystemUtil::open(&mfd,
+                                         indexPath.c_str(),
+                                         fileSize,
+                                         true,  // read only
+                                         errorDescription);
+    if (0 != rc) {
+        errorDescription << "\nFailed to open file [" << indexPath
+                         << "] rc: " << rc << "\n";
+        return rc_OPEN_FAIL;  // RETURN
+    }
+
+    const IndexHeader& header = *reinterpret_cast<const IndexHeader*>(
+        mfd.mapping());
+    const bsls::Types::Uint64 numEntries = header.d_numEntries;
+
+    if (0 != bsl::memcmp(header.d_magic, k_MAGIC, sizeof(k_MAGIC))) {
+        errorDescription << "File [" << indexPath
+                         << "] is not a GUID index\n";
+        rc = rc_INVALID_HEADER;
+    }
+    else if (static_cast<bsls::Types::Uint64>(fileSize) !=
+             sizeof(IndexHeader) + numEntries * sizeof(IndexEntry)) {
+        errorDescription << "File [" << indexPath << "] is corrupted\n";
+        rc = rc_INVALID_SIZE;
+    }
+    else if (static_cast<bsls::Types::Uint64>(header.d_lastRecordOffset) !=
+             journalIt.lastRecordPosition()) {
+        errorDescription << "File [" << indexPath
+                         << "] does not match the journal file\n";
+        rc = rc_STALE_INDEX;
+    }
+    else {
+        const IndexEntry* begin = reinterpret_cast<const IndexEntry*>(
+            mfd.mapping() + sizeof(IndexHeader));
+        const IndexEntry* end = begin + numEntries;
+
+        unsigned char guid[bmqt::MessageGUID::e_SIZE_BINARY];
+        for (bsl::vector<bsl::string>::const_iterator it = guids.begin();
+             it != guids.end();
+             ++it) {
+            bmqt::MessageGUID().fromHex(it->c_str()).toBinary(guid);
+
+            const IndexEntry* entry =
+                bsl::lower_bound(begin, end, guid, entryGuidLess);
+            if (entry == end ||
+                0 != bsl::memcmp(entry->d_guid, guid, sizeof(guid))) {
+                continue;  // CONTINUE
+            }
+
+            const bsls::Types::Uint64 offset = entry->d_recordOffset;
+            if (!firstOffset->has_value() || offset < firstOffset->value()) {
+                *firstOffset = offset;
+            }
+        }
+        rc = rc_SUCCESS;
+    }
+
+    mqbs::FileSystemUtil::close(&mfd);
+    return rc;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
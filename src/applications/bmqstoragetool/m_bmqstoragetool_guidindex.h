@@ -0,0 +1,105 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_M_BMQSTORAGETOOL_GUIDINDEX
+#define INCLUDED_M_BMQSTORAGETOOL_GUIDINDEX
+
+//@PURPOSE: Provide utilities to build and query a sidecar GUID index.
+//
+//@CLASSES:
+//  m_bmqstoragetool::GuidIndexUtil: utilities for journal GUID indices.
+//
+//@DESCRIPTION: 'GuidIndexUtil' builds, for a journal file, a sidecar GUID
+// index file: a table of the GUIDs of all the message records of the journal
+// and of their record offsets, sorted by GUID.  The index of a journal file
+// is conventionally stored next to it, with the 'k_FILE_EXTENSION' extension
+// appended to the journal file path.
+//
+// Looking up GUIDs in the index memory-maps it and binary searches the
+// table, so the offset of the first matching message record is found without
+// iterating the journal.  The index records the position of the last record
+// of the journal it was built from, and is ignored if it does not match the
+// journal it is queried for (e.g. if it is stale).
+//
+/// File Format
+///-----------
+// All integers are big-endian.
+//..
+//  index  := magic:char[8] lastRecordOffset:uint64 numEntries:uint64
+//            entry{numEntries}
+//  entry  := guid:byte[16] recordOffset:uint64
+//..
+// where 'magic' is "BMQGUIDX" and entries are sorted by the bytes of the
+// binary representation of their GUID, then by offset.
+
+// MQB
+#include <mqbs_journalfileiterator.h>
+
+// BDE
+#include <bsl_optional.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace m_bmqstoragetool {
+
+// ====================
+// struct GuidIndexUtil
+// ====================
+
+struct GuidIndexUtil {
+    // PUBLIC CONSTANTS
+
+    /// Extension appended to the path of a journal file to get the path of
+    /// its GUID index.
+    static const char k_FILE_EXTENSION[];
+
+    // CLASS METHODS
+
+    /// Build the GUID index of all the message records iterated by a copy of
+    /// the specified `journalIt`, and write it to the file at the specified
+    /// `indexPath`.  Use the specified `allocator` for temporary memory
+    /// allocations.  Return 0 on success, or a non-zero value otherwise,
+    /// with a description of the error written to the specified
+    /// `errorDescription`.  The behavior is undefined unless `journalIt` is
+    /// valid and has not been advanced yet.
+    static int build(bsl::ostream&                    errorDescription,
+                     const bsl::string&               indexPath,
+                     const mqbs::JournalFileIterator& journalIt,
+                     bslma::Allocator*                allocator = 0);
+
+    /// Load into the specified `firstOffset` the smallest offset of the
+    /// message records having one of the specified hexadecimal `guids` in
+    /// the GUID index at the specified `indexPath`, or reset it if none of
+    /// the `guids` is indexed.  Return 0 on success, or a non-zero value if
+    /// the index cannot be used (e.g. it is missing, corrupted, or was not
+    /// built from the journal iterated by the specified `journalIt`), with
+    /// a description of the error written to the specified
+    /// `errorDescription`.
+    static int
+    findFirstOffset(bsl::optional<bsls::Types::Uint64>* firstOffset,
+                    bsl::ostream&                       errorDescription,
+                    const bsl::string&                  indexPath,
+                    const mqbs::JournalFileIterator&    journalIt,
+                    const bsl::vector<bsl::string>&     guids);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
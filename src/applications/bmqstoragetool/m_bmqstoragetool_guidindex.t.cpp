@@ -0,0 +1,261 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqstoragetool
+#include <m_bmqstoragetool_guidindex.h>
+
+#include <m_bmqstoragetool_journalfile.h>
+
+// MQB
+#include <mqbs_journalfileiterator.h>
+#include <mqbu_messageguidutil.h>
+
+// BMQ
+#include <bmqt_messageguid.h>
+#include <bmqu_memoutstream.h>
+#include <bmqu_tempdirectory.h>
+
+// BDE
+#include <bdls_pathutil.h>
+#include <bsl_optional.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace m_bmqstoragetool;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+typedef bsl::pair<bsl::string, bsls::Types::Uint64> GuidOffset;
+
+/// Load into the specified `result` the hexadecimal GUIDs and the offsets of
+/// all the message records iterated by a copy of the specified `journalIt`.
+void collectMessages(bsl::vector<GuidOffset>*         result,
+                     const mqbs::JournalFileIterator& journalIt)
+{
+    mqbs::JournalFileIterator iter(journalIt);
+    while (iter.nextRecord() == 1) {
+        if (iter.recordType() != mqbs::RecordType::e_MESSAGE) {
+            continue;  // CONTINUE
+        }
+        char buffer[bmqt::MessageGUID::e_SIZE_HEX];
+        iter.asMessageRecord().messageGUID().toHex(buffer);
+        result->push_back(
+            GuidOffset(bsl::string(buffer,
+                                   bmqt::MessageGUID::e_SIZE_HEX,
+                                   bmqtst::TestHelperUtil::allocator()),
+                       iter.recordOffset()));
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   The GUID index built from a journal file yields the offset of the
+//   message record of every GUID of the journal, and the smallest offset
+//   when looking up several GUIDs.
+//
+// Testing:
+//   build
+//   findFirstOffset
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    const size_t                 k_NUM_RECORDS = 50;
+    JournalFile::RecordsListType records(bmqtst::TestHelperUtil::allocator());
+    JournalFile                  journalFile(k_NUM_RECORDS,
+                            bmqtst::TestHelperUtil::allocator());
+    journalFile.addAllTypesRecords(&records);
+
+    mqbs::JournalFileIterator journalIt(&journalFile.mappedFileDescriptor(),
+                                        journalFile.fileHeader(),
+                                        false);
+
+    bmqu::TempDirectory tempDir(bmqtst::TestHelperUtil::allocator());
+    bsl::string         indexPath(tempDir.path(),
+                          bmqtst::TestHelperUtil::allocator());
+    bdls::PathUtil::appendRaw(&indexPath, "journal.guidx");
+
+    bmqu::MemOutStream errorDescription(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(GuidIndexUtil::build(errorDescription,
+                                          indexPath,
+                                          journalIt,
+                                          bmqtst::TestHelperUtil::allocator()),
+                     0);
+    BMQTST_ASSERT(errorDescription.str().empty());
+
+    bsl::vector<GuidOffset> messages(bmqtst::TestHelperUtil::allocator());
+    collectMessages(&messages, journalIt);
+    BMQTST_ASSERT(!messages.empty());
+
+    bsl::optional<bsls::Types::Uint64> firstOffset;
+    bsl::vector<bsl::string> guids(bmqtst::TestHelperUtil::allocator());
+
+    // Every message is found at its record offset
+    for (size_t i = 0; i < messages.size(); ++i) {
+        guids.clear();
+        guids.push_back(messages[i].first);
+        BMQTST_ASSERT_EQ_D(i,
+                           GuidIndexUtil::findFirstOffset(&firstOffset,
+                                                          errorDescription,
+                                                          indexPath,
+                                                          journalIt,
+                                                          guids),
+                           0);
+        BMQTST_ASSERT_D(i, firstOffset.has_value());
+        BMQTST_ASSERT_EQ_D(i, firstOffset.value(), messages[i].second);
+    }
+
+    // The smallest offset of several messages is found
+    guids.clear();
+    guids.push_back(messages.back().first);
+    guids.push_back(messages[messages.size() / 2].first);
+    BMQTST_ASSERT_EQ(GuidIndexUtil::findFirstOffset(&firstOffset,
+                                                    errorDescription,
+                                                    indexPath,
+                                                    journalIt,
+                                                    guids),
+                     0);
+    BMQTST_ASSERT(firstOffset.has_value());
+    BMQTST_ASSERT_EQ(firstOffset.value(),
+                     messages[messages.size() / 2].second);
+
+    // An unknown GUID is not found
+    bmqt::MessageGUID unknownGuid;
+    mqbu::MessageGUIDUtil::generateGUID(&unknownGuid);
+    char buffer[bmqt::MessageGUID::e_SIZE_HEX];
+    unknownGuid.toHex(buffer);
+
+    guids.clear();
+    guids.push_back(bsl::string(buffer,
+                                bmqt::MessageGUID::e_SIZE_HEX,
+                                bmqtst::TestHelperUtil::allocator()));
+    BMQTST_ASSERT_EQ(GuidIndexUtil::findFirstOffset(&firstOffset,
+                                                    errorDescription,
+                                                    indexPath,
+                                                    journalIt,
+                                                    guids),
+                     0);
+    BMQTST_ASSERT(!firstOffset.has_value());
+}
+
+static void test2_unusableIndex()
+// ------------------------------------------------------------------------
+// UNUSABLE INDEX
+//
+// Concerns:
+//   A missing index, or an index built from another journal file, is
+//   reported as unusable.
+//
+// Testing:
+//   findFirstOffset
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("UNUSABLE INDEX");
+
+    JournalFile::RecordsListType records1(bmqtst::TestHelperUtil::allocator());
+    JournalFile journalFile1(50, bmqtst::TestHelperUtil::allocator());
+    journalFile1.addAllTypesRecords(&records1);
+
+    JournalFile::RecordsListType records2(bmqtst::TestHelperUtil::allocator());
+    JournalFile journalFile2(30, bmqtst::TestHelperUtil::allocator());
+    journalFile2.addAllTypesRecords(&records2);
+
+    mqbs::JournalFileIterator journalIt1(&journalFile1.mappedFileDescriptor(),
+                                         journalFile1.fileHeader(),
+                                         false);
+    mqbs::JournalFileIterator journalIt2(&journalFile2.mappedFileDescriptor(),
+                                         journalFile2.fileHeader(),
+                                         false);
+
+    bmqu::TempDirectory tempDir(bmqtst::TestHelperUtil::allocator());
+    bsl::string         indexPath(tempDir.path(),
+                          bmqtst::TestHelperUtil::allocator());
+    bdls::PathUtil::appendRaw(&indexPath, "journal.guidx");
+
+    bsl::vector<GuidOffset> messages(bmqtst::TestHelperUtil::allocator());
+    collectMessages(&messages, journalIt1);
+    BMQTST_ASSERT(!messages.empty());
+
+    bsl::vector<bsl::string> guids(bmqtst::TestHelperUtil::allocator());
+    guids.push_back(messages.front().first);
+
+    bsl::optional<bsls::Types::Uint64> firstOffset;
+    bmqu::MemOutStream errorDescription(bmqtst::TestHelperUtil::allocator());
+
+    // Missing index
+    BMQTST_ASSERT_NE(GuidIndexUtil::findFirstOffset(&firstOffset,
+                                                    errorDescription,
+                                                    indexPath,
+                                                    journalIt1,
+                                                    guids),
+                     0);
+    BMQTST_ASSERT(!errorDescription.str().empty());
+
+    // Index of another journal
+    BMQTST_ASSERT_EQ(GuidIndexUtil::build(errorDescription,
+                                          indexPath,
+                                          journalIt1,
+                                          bmqtst::TestHelperUtil::allocator()),
+                     0);
+    errorDescription.reset();
+    BMQTST_ASSERT_NE(GuidIndexUtil::findFirstOffset(&firstOffset,
+                                                    errorDescription,
+                                                    indexPath,
+                                                    journalIt2,
+                                                    guids),
+                     0);
+    BMQTST_ASSERT(!errorDescription.str().empty());
+    BMQTST_ASSERT(!firstOffset.has_value());
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_unusableIndex(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -19,8 +19,18 @@
 #include <m_bmqstoragetool_journalfileprocessor.h>
 
 // BDE
+#include <bdlb_bigendian.h>
+#include <bdlf_bind.h>
 #include <bdls_filesystemutil.h>
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
 #include <bsls_assert.h>
 
 // MQB
@@ -37,9 +47,372 @@
 #include <bsl_algorithm.h>
 #include <bsl_memory.h>
 
+// SYSTEM
+#include <sys/stat.h>
+
 namespace BloombergLP {
 namespace m_bmqstoragetool {
 
+namespace {
+
+/// Maximum number of records scanned by a worker thread in one chunk.
+const bsls::Types::Uint64 k_MAX_CHUNK_RECORDS = 1024 * 1024;
+
+/// Minimum number of chunks per thread the journal is split into, so that
+/// the work is balanced between the threads.
+const bsls::Types::Uint64 k_CHUNKS_PER_THREAD = 4;
+
+/// Maximum number of chunks per thread scanned ahead of the merging
+/// thread, which bounds the memory used by pending chunk results.
+const bsls::Types::Uint64 k_LOOKAHEAD_CHUNKS_PER_THREAD = 2;
+
+/// Interval between two polls of the journal file in follow mode.
+const int k_FOLLOW_POLL_INTERVAL_MS = 200;
+
+/// Return true if the slot at the specified `offset` of the journal mapped by
+/// the specified `mfd`, with records of the specified `recordSize`, holds a
+/// complete record, and false otherwise.
+bool isValidRecordSlot(const mqbs::MappedFileDescriptor& mfd,
+                       bsls::Types::Uint64               offset,
+                       unsigned int                      recordSize)
+{
+    mqbs::OffsetPtr<const mqbs::RecordHeader> recHeader(mfd.block(), offset);
+    if (recHeader->type() == mqbs::RecordType::e_UNDEFINED ||
+        recHeader->primaryLeaseId() == 0 ||
+        recHeader->sequenceNumber() == 0) {
+        return false;  // RETURN
+    }
+
+    mqbs::OffsetPtr<const bdlb::BigEndianUint32> magic(
+        mfd.block(),
+        offset + recordSize - sizeof(bdlb::BigEndianUint32));
+    return *magic == mqbs::RecordHeader::k_MAGIC;
+}
+
+/// Return true if the file opened as the specified `mfd` was unlinked from
+/// the file system, and false otherwise.
+bool isUnlinked(const mqbs::MappedFileDescriptor& mfd)
+{
+    struct stat st;
+    return ::fstat(mfd.fd(), &st) == 0 && st.st_nlink == 0;
+}
+
+/// Return true if the record pointed by the specified `iter` must be
+/// processed by the search result according to the specified `params` and
+/// `filters`, and false otherwise.  Set the specified `stopSearch` to true
+/// if a filter indicated that no further record can match.
+bool isMatchingRecord(bool*                            stopSearch,
+                      const mqbs::JournalFileIterator& iter,
+                      const Parameters&                params,
+                      const Filters&                   filters)
+{
+    switch (iter.recordType()) {
+    case mqbs::RecordType::e_MESSAGE:
+        return params.d_processRecordTypes.d_message &&
+               filters.apply(iter.recordHeader(),
+                             iter.recordOffset(),
+                             iter.asMessageRecord().queueKey());  // RETURN
+    case mqbs::RecordType::e_CONFIRM:
+    case mqbs::RecordType::e_DELETION:
+        return params.d_processRecordTypes.d_message;  // RETURN
+    case mqbs::RecordType::e_QUEUE_OP:
+        return params.d_processRecordTypes.d_queueOp &&
+               filters.apply(iter.recordHeader(),
+                             iter.recordOffset(),
+                             iter.asQueueOpRecord().queueKey(),
+                             stopSearch);  // RETURN
+    case mqbs::RecordType::e_JOURNAL_OP:
+        return params.d_processRecordTypes.d_journalOp &&
+               filters.apply(iter.recordHeader(),
+                             iter.recordOffset(),
+                             mqbu::StorageKey::k_NULL_KEY,
+                             stopSearch);  // RETURN
+    default: return false;  // RETURN
+    }
+}
+
+/// Feed the record pointed by the specified `iter` to the specified
+/// `searchResult`.  Return true if the search must stop.
+bool processRecord(SearchResult* searchResult, mqbs::JournalFileIterator* iter)
+{
+    switch (iter->recordType()) {
+    case mqbs::RecordType::e_MESSAGE:
+        return searchResult->processMessageRecord(
+            iter->asMessageRecord(),
+            iter->recordIndex(),
+            iter->recordOffset());  // RETURN
+    case mqbs::RecordType::e_CONFIRM:
+        return searchResult->processConfirmRecord(
+            iter->asConfirmRecord(),
+            iter->recordIndex(),
+            iter->recordOffset());  // RETURN
+    case mqbs::RecordType::e_DELETION:
+        return searchResult->processDeletionRecord(
+            iter->asDeletionRecord(),
+            iter->recordIndex(),
+            iter->recordOffset());  // RETURN
+    case mqbs::RecordType::e_QUEUE_OP:
+        return searchResult->processQueueOpRecord(
+            iter->asQueueOpRecord(),
+            iter->recordIndex(),
+            iter->recordOffset());  // RETURN
+    case mqbs::RecordType::e_JOURNAL_OP:
+        return searchResult->processJournalOpRecord(
+            iter->asJournalOpRecord(),
+            iter->recordIndex(),
+            iter->recordOffset());  // RETURN
+    default: return false;  // RETURN
+    }
+}
+
+// =================
+// class ChunkResult
+// =================
+
+/// Result of the scan of a chunk of journal records.
+struct ChunkResult {
+    // PUBLIC DATA
+
+    /// Indices of the matching records of the chunk, in journal order.
+    bsl::vector<bsls::Types::Uint64> d_recordIndices;
+
+    /// Whether a filter indicated that no record after the last matching
+    /// one can match.
+    bool d_stopSearch;
+
+    /// Iteration status: 1 on success, or the failing iterator status.
+    int d_rc;
+
+    /// Whether the scan of the chunk is complete.
+    bool d_isReady;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ChunkResult, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+    explicit ChunkResult(bslma::Allocator* allocator = 0)
+    : d_recordIndices(allocator)
+    , d_stopSearch(false)
+    , d_rc(1)
+    , d_isReady(false)
+    {
+    }
+
+    ChunkResult(const ChunkResult& other, bslma::Allocator* allocator = 0)
+    : d_recordIndices(other.d_recordIndices, allocator)
+    , d_stopSearch(other.d_stopSearch)
+    , d_rc(other.d_rc)
+    , d_isReady(other.d_isReady)
+    {
+    }
+};
+
+// =====================
+// class ParallelScanner
+// =====================
+
+/// Mechanism scanning consecutive chunks of journal records in worker
+/// threads, and handing their results out in journal order to a merging
+/// thread.  Workers never get more than a bounded number of chunks ahead
+/// of the merging thread.
+class ParallelScanner {
+  private:
+    // DATA
+    const Parameters&                d_parameters;
+    const Filters&                   d_filters;
+    const mqbs::JournalFileIterator& d_start;
+    const bsls::Types::Uint64        d_numRecords;
+    bsls::Types::Uint64              d_chunkRecords;
+    bsls::Types::Uint64              d_lookahead;
+    bsl::vector<ChunkResult>         d_results;
+
+    /// Next chunk to be scanned by a worker.  Protected by `d_mutex`.
+    bsls::Types::Uint64 d_nextChunk;
+
+    /// Number of chunks taken by the merging thread.  Protected by
+    /// `d_mutex`.
+    bsls::Types::Uint64 d_takenChunks;
+
+    /// Whether the merging thread does not expect any more chunk.
+    /// Protected by `d_mutex`.
+    bool d_isStopped;
+
+    bslmt::Mutex     d_mutex;
+    bslmt::Condition d_condition;
+
+    bslma::Allocator* d_allocator_p;
+
+    // PRIVATE ACCESSORS
+
+    /// Scan the specified `chunk` and load the outcome into the specified
+    /// `result`.
+    void scanChunk(ChunkResult* result, bsls::Types::Uint64 chunk) const;
+
+  private:
+    // NOT IMPLEMENTED
+    ParallelScanner(const ParallelScanner&) BSLS_KEYWORD_DELETED;
+    ParallelScanner& operator=(const ParallelScanner&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create a scanner of the specified `numRecords` records starting at
+    /// the record pointed by the specified `start`, using the specified
+    /// `parameters` and `filters` to select records, for the specified
+    /// `numThreads` worker threads.  Use the specified `allocator` for
+    /// memory allocations.
+    ParallelScanner(const Parameters&                parameters,
+                    const Filters&                   filters,
+                    const mqbs::JournalFileIterator& start,
+                    bsls::Types::Uint64              numRecords,
+                    unsigned int                     numThreads,
+                    bslma::Allocator*                allocator);
+
+    // MANIPULATORS
+
+    /// Scan chunks until all are scanned or `stop` is called.
+    ///
+    /// THREAD: This method is called from the worker threads.
+    void workerMain();
+
+    /// Block until the specified `chunk` is scanned and swap its result
+    /// into the specified `result`.  The behavior is undefined unless
+    /// chunks are taken in order.
+    void takeChunk(ChunkResult* result, bsls::Types::Uint64 chunk);
+
+    /// Notify the workers that no more chunk will be taken.
+    void stop();
+
+    // ACCESSORS
+
+    /// Return the number of chunks.
+    bsls::Types::Uint64 numChunks() const;
+};
+
+ParallelScanner::ParallelScanner(const Parameters&                parameters,
+                                 const Filters&                   filters,
+                                 const mqbs::JournalFileIterator& start,
+                                 bsls::Types::Uint64              numRecords,
+                                 unsigned int                     numThreads,
+                                 bslma::Allocator*                allocator)
+: d_parameters(parameters)
+, d_filters(filters)
+, d_start(start)
+, d_numRecords(numRecords)
+, d_chunkRecords(0)
+, d_lookahead(numThreads * k_LOOKAHEAD_CHUNKS_PER_THREAD)
+, d_results(allocator)
+, d_nextChunk(0)
+, d_takenChunks(0)
+, d_isStopped(false)
+, d_mutex()
+, d_condition()
+, d_allocator_p(allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(numThreads > 0);
+
+    d_chunkRecords = bsl::min(
+        k_MAX_CHUNK_RECORDS,
+        bsl::max(numRecords / (numThreads * k_CHUNKS_PER_THREAD), 1ULL));
+    d_results.resize((numRecords + d_chunkRecords - 1) / d_chunkRecords);
+}
+
+void ParallelScanner::scanChunk(ChunkResult*        result,
+                                bsls::Types::Uint64 chunk) const
+{
+    const bsls::Types::Uint64 begin = chunk * d_chunkRecords;
+    const bsls::Types::Uint64 end   = bsl::min(begin + d_chunkRecords,
+                                             d_numRecords);
+
+    // Each worker iterates its own copy of the starting iterator; they all
+    // share the same read-only mapping of the journal.
+    mqbs::JournalFileIterator iter(d_start);
+    int                       rc = (begin > 0) ? iter.advance(begin) : 1;
+    for (bsls::Types::Uint64 i = begin; i < end && rc == 1; ++i) {
+        if (i != begin) {
+            rc = iter.nextRecord();
+            if (rc != 1) {
+                break;  // BREAK
+            }
+        }
+
+        bool stopSearch = false;
+        if (isMatchingRecord(&stopSearch, iter, d_parameters, d_filters)) {
+            result->d_recordIndices.push_back(iter.recordIndex());
+        }
+        else if (stopSearch) {
+            result->d_stopSearch = true;
+            break;  // BREAK
+        }
+    }
+
+    result->d_rc = rc;
+}
+
+void ParallelScanner::workerMain()
+{
+    while (true) {
+        bsls::Types::Uint64 chunk;
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+            while (!d_isStopped && d_nextChunk < d_results.size() &&
+                   d_nextChunk >= d_takenChunks + d_lookahead) {
+                d_condition.wait(&d_mutex);
+            }
+            if (d_isStopped || d_nextChunk >= d_results.size()) {
+                return;  // RETURN
+            }
+            chunk = d_nextChunk++;
+        }  // UNLOCK
+
+        ChunkResult result(d_allocator_p);
+        scanChunk(&result, chunk);
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        d_results[chunk].d_recordIndices.swap(result.d_recordIndices);
+        d_results[chunk].d_stopSearch = result.d_stopSearch;
+        d_results[chunk].d_rc         = result.d_rc;
+        d_results[chunk].d_isReady    = true;
+        d_condition.broadcast();
+    }
+}
+
+void ParallelScanner::takeChunk(ChunkResult* result, bsls::Types::Uint64 chunk)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(chunk == d_takenChunks);
+    BSLS_ASSERT_SAFE(chunk < d_results.size());
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+    while (!d_results[chunk].d_isReady) {
+        d_condition.wait(&d_mutex);
+    }
+
+    result->d_recordIndices.clear();
+    result->d_recordIndices.swap(d_results[chunk].d_recordIndices);
+    result->d_stopSearch = d_results[chunk].d_stopSearch;
+    result->d_rc         = d_results[chunk].d_rc;
+    result->d_isReady    = true;
+
+    ++d_takenChunks;
+    d_condition.broadcast();
+}
+
+void ParallelScanner::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+    d_isStopped = true;
+    d_condition.broadcast();
+}
+
+bsls::Types::Uint64 ParallelScanner::numChunks() const
+{
+    return d_results.size();
+}
+
+}  // close unnamed namespace
+
 /// Move the journal iterator pointed by the specified 'jit' to the first
 /// record whose value is more then the range lower bound. The specified
 /// `moreThanLowerBoundFn` functor is used for comparison. Return '1' on
@@ -101,6 +474,131 @@ int moveToLowerBound(mqbs::JournalFileIterator* jit,
     return rc;  // RETURN
 }
 
+/// Move the journal iterator pointed by the specified 'jit' to the first
+/// record whose offset is more than the specified 'offsetGt'.  Return '1' on
+/// success, '0' if there are no such records or negative value if an error
+/// was encountered.  Note that if this method returns < 0, the specified
+/// 'jit' is invalidated.  Behavior is undefined unless last call to
+/// `nextRecord` or 'advance' returned '1' and the iterator points to a valid
+/// record.
+int moveToOffsetLowerBound(mqbs::JournalFileIterator* jit,
+                           bsls::Types::Uint64        offsetGt)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(jit);
+
+    if (offsetGt >= jit->lastRecordPosition()) {
+        // There are no records with offset greater than 'offsetGt'.
+        return 0;  // RETURN
+    }
+
+    // Records are contiguous and have a fixed size, so the index of the first
+    // record past 'offsetGt' follows from the offset itself.
+    const unsigned int recordSize = jit->header().recordWords() *
+                                    bmqp::Protocol::k_WORD_SIZE;
+    const bsls::Types::Uint64 firstPosition = jit->firstRecordPosition();
+    const bsls::Types::Uint64 targetIndex =
+        offsetGt < firstPosition
+            ? 0
+            : (offsetGt - firstPosition) / recordSize + 1;
+
+    if (jit->isReverseMode()) {
+        jit->flipDirection();
+    }
+
+    const bsls::Types::Uint64 currentIndex = jit->recordIndex();
+    if (targetIndex > currentIndex) {
+        return jit->advance(targetIndex - currentIndex);  // RETURN
+    }
+    if (targetIndex < currentIndex) {
+        jit->flipDirection();
+        const int rc = jit->advance(currentIndex - targetIndex);
+        if (rc == 1) {
+            jit->flipDirection();
+        }
+        return rc;  // RETURN
+    }
+
+    return 1;
+}
+
+int followJournal(mqbs::JournalFileIterator*        jit,
+                  mqbs::MappedFileDescriptor*       view,
+                  const mqbs::MappedFileDescriptor& mfd,
+                  bsls::Types::Uint64               lastOffset)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(jit);
+    BSLS_ASSERT(view);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_NO_NEW_RECORDS    = 0,
+        rc_HAS_NEW_RECORDS   = 1,
+        rc_INVALID_HEADER    = -1,
+        rc_RESET_FAILURE     = -2,
+        rc_ITERATION_FAILURE = -3
+    };
+
+    const mqbs::FileHeader& fileHeader =
+        mqbs::FileStoreProtocolUtil::bmqHeader(mfd);
+    const bsls::Types::Uint64 fileHeaderSize = fileHeader.headerWords() *
+                                               bmqp::Protocol::k_WORD_SIZE;
+    if (fileHeaderSize == 0 ||
+        mfd.fileSize() < fileHeaderSize + sizeof(mqbs::JournalFileHeader)) {
+        return rc_INVALID_HEADER;  // RETURN
+    }
+
+    mqbs::OffsetPtr<const mqbs::JournalFileHeader> journalHeader(
+        mfd.block(),
+        fileHeaderSize);
+    const unsigned int recordSize = journalHeader->recordWords() *
+                                    bmqp::Protocol::k_WORD_SIZE;
+    const bsls::Types::Uint64 firstPosition =
+        fileHeaderSize +
+        journalHeader->headerWords() * bmqp::Protocol::k_WORD_SIZE;
+    if (recordSize == 0) {
+        return rc_INVALID_HEADER;  // RETURN
+    }
+
+    // Find the end of the records appended after 'lastOffset'.
+    const bsls::Types::Uint64 nextPosition = lastOffset
+                                                 ? lastOffset + recordSize
+                                                 : firstPosition;
+    bsls::Types::Uint64 endPosition = nextPosition;
+    while (endPosition + recordSize <= mfd.fileSize() &&
+           isValidRecordSlot(mfd, endPosition, recordSize)) {
+        endPosition += recordSize;
+    }
+    if (endPosition == nextPosition) {
+        return rc_NO_NEW_RECORDS;  // RETURN
+    }
+
+    // Bounding the view after the new records keeps the iterator reset cheap:
+    // only the records following the last sync point are scanned.
+    *view = mfd;
+    view->setFileSize(endPosition);
+    if (0 != jit->reset(view, fileHeader)) {
+        return rc_RESET_FAILURE;  // RETURN
+    }
+
+    if (lastOffset) {
+        // Position the iterator at the last processed record.
+        const bsls::Types::Uint64 lastIndex = (lastOffset - firstPosition) /
+                                                  recordSize +
+                                              1;
+        int rc = jit->nextRecord();
+        if (rc == 1 && lastIndex > 1) {
+            rc = jit->advance(lastIndex - 1);
+        }
+        if (rc != 1) {
+            return rc_ITERATION_FAILURE;  // RETURN
+        }
+    }
+
+    return rc_HAS_NEW_RECORDS;
+}
+
 // ==========================
 // class MoreThanLowerBoundFn
 // ==========================
@@ -154,13 +652,157 @@ JournalFileProcessor::JournalFileProcessor(
 , d_fileManager(fileManager)
 , d_ostream(ostream)
 , d_searchResult_p(searchResult_p)
+, d_journalView()
 , d_allocator_p(allocator)
 {
     // NOTHING
 }
 
+// PRIVATE MANIPULATORS
+
+bool JournalFileProcessor::waitForRecords(
+    mqbs::JournalFileIterator*        iter,
+    const mqbs::MappedFileDescriptor& mfd,
+    bsls::Types::Uint64               lastOffset)
+{
+    // Make the records processed so far visible before waiting
+    d_ostream.flush();
+
+    while (!isUnlinked(mfd)) {
+        const int rc = followJournal(iter, &d_journalView, mfd, lastOffset);
+        if (rc > 0) {
+            return true;  // RETURN
+        }
+        if (rc < 0) {
+            d_ostream << "Following journal aborted (exit status " << rc
+                      << ").";
+            return false;  // RETURN
+        }
+        bslmt::ThreadUtil::microSleep(1000 * k_FOLLOW_POLL_INTERVAL_MS);
+    }
+
+    return false;
+}
+
+void JournalFileProcessor::processParallel()
+{
+    Filters filters(d_parameters->d_queueKey,
+                    d_parameters->d_queueName,
+                    d_parameters->d_queueMap,
+                    d_parameters->d_range,
+                    d_allocator_p);
+
+    mqbs::JournalFileIterator* iter = d_fileManager->journalFileIterator();
+    if (!iter->hasRecordSizeRemaining()) {
+        d_searchResult_p->outputResult();
+        return;  // RETURN
+    }
+
+    int rc = iter->nextRecord();
+    if (rc <= 0) {
+        d_ostream << "Iteration aborted (exit status " << rc << ").";
+        return;  // RETURN
+    }
+
+    if (d_parameters->d_range.d_timestampGt ||
+        d_parameters->d_range.d_offsetGt || d_parameters->d_range.d_seqNumGt) {
+        if (d_parameters->d_range.d_offsetGt) {
+            rc = moveToOffsetLowerBound(iter,
+                                        *d_parameters->d_range.d_offsetGt);
+        }
+        else {
+            MoreThanLowerBoundFn moreThanLowerBoundFn(d_parameters->d_range);
+            rc = moveToLowerBound(iter, moreThanLowerBoundFn);
+        }
+        if (rc == 0) {
+            d_searchResult_p->outputResult();
+            return;  // RETURN
+        }
+        else if (rc < 0) {
+            d_ostream << "Binary search aborted (exit status " << rc << ").";
+            return;  // RETURN
+        }
+    }
+
+    // Records have a fixed size, so chunk boundaries can be computed from
+    // record indices without scanning the journal.
+    const unsigned int recordSize = iter->header().recordWords() *
+                                    bmqp::Protocol::k_WORD_SIZE;
+    const bsls::Types::Uint64 lastIndex = (iter->lastRecordPosition() -
+                                           iter->firstRecordPosition()) /
+                                          recordSize;
+    const bsls::Types::Uint64 startIndex = iter->recordIndex();
+    BSLS_ASSERT_SAFE(startIndex <= lastIndex);
+
+    // Workers copy 'start', so it must not move while they are running.
+    const mqbs::JournalFileIterator start(*iter);
+
+    ParallelScanner scanner(*d_parameters,
+                            filters,
+                            start,
+                            lastIndex - startIndex + 1,
+                            d_parameters->d_threads,
+                            d_allocator_p);
+
+    bslmt::ThreadGroup threads(d_allocator_p);
+    threads.addThreads(
+        bdlf::BindUtil::bindS(d_allocator_p,
+                              &ParallelScanner::workerMain,
+                              &scanner),
+        d_parameters->d_threads);
+
+    // Feed the matching records to the search result in journal order.
+    ChunkResult         chunkResult(d_allocator_p);
+    bool                stopSearch = false;
+    bsls::Types::Uint64 index      = startIndex;
+    for (bsls::Types::Uint64 chunk = 0;
+         !stopSearch && chunk < scanner.numChunks();
+         ++chunk) {
+        scanner.takeChunk(&chunkResult, chunk);
+
+        for (bsl::vector<bsls::Types::Uint64>::const_iterator it =
+                 chunkResult.d_recordIndices.begin();
+             !stopSearch && it != chunkResult.d_recordIndices.end();
+             ++it) {
+            const bsls::Types::Uint64 recordIndex = *it;
+            if (recordIndex != index) {
+                rc = iter->advance(recordIndex - index);
+                if (rc != 1) {
+                    break;  // BREAK
+                }
+                index = recordIndex;
+            }
+            stopSearch = processRecord(d_searchResult_p.get(), iter);
+        }
+
+        if (rc != 1 || chunkResult.d_rc != 1) {
+            rc = (rc != 1) ? rc : chunkResult.d_rc;
+            break;  // BREAK
+        }
+
+        stopSearch = stopSearch || chunkResult.d_stopSearch;
+    }
+
+    scanner.stop();
+    threads.joinAll();
+
+    if (rc != 1) {
+        d_ostream << "Iteration aborted (exit status " << rc << ").";
+        return;  // RETURN
+    }
+
+    d_searchResult_p->outputResult();
+}
+
+// MANIPULATORS
+
 void JournalFileProcessor::process()
 {
+    if (d_parameters->d_threads > 1) {
+        processParallel();
+        return;  // RETURN
+    }
+
     Filters filters(d_parameters->d_queueKey,
                     d_parameters->d_queueName,
                     d_parameters->d_queueMap,
@@ -174,7 +816,18 @@ void JournalFileProcessor::process()
 
     // Iterate through all Journal file records
     mqbs::JournalFileIterator* iter = d_fileManager->journalFileIterator();
+
+    // In follow mode, the journal mapping and the offset of the last
+    // processed record are needed to look for new records.
+    const mqbs::MappedFileDescriptor journalMfd =
+        *iter->mappedFileDescriptor();
+    bsls::Types::Uint64 lastOffset = 0;
+
     while (true) {
+        if (!stopSearch && !iter->hasRecordSizeRemaining() &&
+            d_parameters->d_follow) {
+            stopSearch = !waitForRecords(iter, journalMfd, lastOffset);
+        }
         if (stopSearch || !iter->hasRecordSizeRemaining()) {
             d_searchResult_p->outputResult();
             return;  // RETURN
@@ -186,10 +839,25 @@ void JournalFileProcessor::process()
         }
 
         if (needMoveToLowerBound) {
-            MoreThanLowerBoundFn moreThanLowerBoundFn(d_parameters->d_range);
-            rc = moveToLowerBound(iter, moreThanLowerBoundFn);
+            if (d_parameters->d_range.d_offsetGt) {
+                rc = moveToOffsetLowerBound(
+                    iter,
+                    *d_parameters->d_range.d_offsetGt);
+            }
+            else {
+                MoreThanLowerBoundFn moreThanLowerBoundFn(
+                    d_parameters->d_range);
+                rc = moveToLowerBound(iter, moreThanLowerBoundFn);
+            }
             if (rc == 0) {
-                stopSearch = true;
+                if (d_parameters->d_follow) {
+                    // No record past the lower bound yet, wait for new ones.
+                    lastOffset = iter->lastRecordPosition();
+                    stopSearch = !waitForRecords(iter, journalMfd, lastOffset);
+                }
+                else {
+                    stopSearch = true;
+                }
                 continue;  // CONTINUE
             }
             else if (rc < 0) {
@@ -199,6 +867,7 @@ void JournalFileProcessor::process()
             }
             needMoveToLowerBound = false;
         }
+        lastOffset = iter->recordOffset();
 
         // Process Message records
         if (d_parameters->d_processRecordTypes.d_message) {
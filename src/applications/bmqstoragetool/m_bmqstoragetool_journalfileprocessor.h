@@ -22,7 +22,19 @@
 //  m_bmqstoragetool::JournalFileProcessor: search engine.
 //
 //@DESCRIPTION: 'JournalFileProcessor' provides engine for iterating a journal
-//  file and searching records in it.
+//  file and searching records in it.  If more than one thread is requested
+//  in the parameters, the journal is split into chunks of records which are
+//  scanned and filtered in parallel, and the matching records are then fed
+//  to the 'SearchResult' in journal order.
+//
+//  In follow mode, once all the records of the journal are processed, the
+//  journal (which may be memory-mapped and appended to by a running broker)
+//  is polled for new records, which are processed as they land.  The records
+//  appended after the last processed one are detected by validating the
+//  following record slots, and the iterator is reset over a view of the
+//  mapping ending after them, so that only the records following the last
+//  sync point are rescanned.  Following stops once the journal file is
+//  unlinked, e.g. when it is removed by the broker after a rollover.
 
 // bmqstoragetool
 #include <m_bmqstoragetool_commandprocessor.h>
@@ -38,6 +50,7 @@
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsls_keyword.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace m_bmqstoragetool {
@@ -67,6 +80,27 @@ class MoreThanLowerBoundFn {
 int moveToLowerBound(mqbs::JournalFileIterator* jit,
                      MoreThanLowerBoundFn&      lessThanLowerBoundFn);
 
+int moveToOffsetLowerBound(mqbs::JournalFileIterator* jit,
+                           bsls::Types::Uint64        offsetGt);
+// Move the journal iterator pointed by the specified 'jit' to the first
+// record whose offset is more than the specified 'offsetGt'.  Journal
+// records have a fixed size, so the record index is computed directly
+// instead of being searched for.  Return '1' on success, '0' if there are no
+// such records or negative value if an error was encountered.
+
+int followJournal(mqbs::JournalFileIterator*        jit,
+                  mqbs::MappedFileDescriptor*       view,
+                  const mqbs::MappedFileDescriptor& mfd,
+                  bsls::Types::Uint64               lastOffset);
+// Look for valid records appended to the journal mapped by the specified
+// 'mfd' after the record at the specified 'lastOffset', or from the first
+// record if 'lastOffset' is 0.  If there are any, load into the specified
+// 'view' a descriptor of the mapping ending after the last of them, reset
+// the journal iterator pointed by the specified 'jit' over 'view' so that
+// its next record is the first new one, and return '1'.  Return '0' if there
+// are no new records, or a negative value if an error was encountered.  The
+// behavior is undefined unless 'view' outlives the use of 'jit'.
+
 // ==========================
 // class JournalFileProcessor
 // ==========================
@@ -78,9 +112,23 @@ class JournalFileProcessor : public CommandProcessor {
     const bslma::ManagedPtr<FileManager> d_fileManager;
     bsl::ostream&                        d_ostream;
     bsl::shared_ptr<SearchResult>        d_searchResult_p;
+    mqbs::MappedFileDescriptor           d_journalView;
     bslma::Allocator*                    d_allocator_p;
 
-    // MANIPULATORS
+    // PRIVATE MANIPULATORS
+
+    /// Wait until records are appended to the journal file mapped by the
+    /// specified `mfd` after the record at the specified `lastOffset` (0 if
+    /// no record was processed), and reset the specified `iter` to iterate
+    /// them.  Return true if there are new records, or false if the journal
+    /// file was unlinked or an error was encountered.
+    bool waitForRecords(mqbs::JournalFileIterator*        iter,
+                        const mqbs::MappedFileDescriptor& mfd,
+                        bsls::Types::Uint64               lastOffset);
+
+    /// Process the journal file using `d_parameters->d_threads` threads to
+    /// scan and filter the records, and print result.
+    void processParallel();
 
   public:
     // CREATORS
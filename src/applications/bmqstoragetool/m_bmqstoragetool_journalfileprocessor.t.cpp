@@ -2613,6 +2613,294 @@ static void test26_summaryWithQueueDetailsTest()
     searchProcessor->process();
 }
 
+static void test27_parallelSearchAllTypesRecords()
+// ------------------------------------------------------------------------
+// PARALLEL SEARCH ALL TYPES RECORDS
+//
+// Concerns:
+//   Search all types records by offsets range in journal file using several
+//   scanning threads, and output result in journal order.
+//
+// Testing:
+//   JournalFileProcessor::process()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PARALLEL SEARCH ALL TYPES RECORDS TEST");
+
+    // Simulate journal file
+    const size_t                 k_NUM_RECORDS = 200;
+    JournalFile::RecordsListType records(bmqtst::TestHelperUtil::allocator());
+    JournalFile                  journalFile(k_NUM_RECORDS,
+                            bmqtst::TestHelperUtil::allocator());
+    journalFile.addAllTypesRecords(&records);
+    const bsls::Types::Uint64 offsetGt =
+        mqbs::FileStoreProtocol::k_JOURNAL_RECORD_SIZE * 15 + k_HEADER_SIZE;
+    const bsls::Types::Uint64 offsetLt =
+        mqbs::FileStoreProtocol::k_JOURNAL_RECORD_SIZE * 170 + k_HEADER_SIZE;
+
+    // Configure parameters to search all records by offsets with several
+    // threads
+    Parameters params         = createTestParameters(e_MESSAGE | e_QUEUE_OP |
+                                             e_JOURNAL_OP);
+    params.d_range.d_offsetGt = offsetGt;
+    params.d_range.d_offsetLt = offsetLt;
+    params.d_threads          = 3;
+
+    // Create printer mock
+    bsl::shared_ptr<PrinterMock> printer(
+        new (*bmqtst::TestHelperUtil::allocator()) PrinterMock(),
+        bmqtst::TestHelperUtil::allocator());
+
+    // Prepare file manager
+    bslma::ManagedPtr<FileManager> fileManager(
+        new (*bmqtst::TestHelperUtil::allocator())
+            FileManagerMock(journalFile),
+        bmqtst::TestHelperUtil::allocator());
+
+    // Create command processor
+    bmqu::MemOutStream resultStream(bmqtst::TestHelperUtil::allocator());
+    bslma::ManagedPtr<CommandProcessor> searchProcessor =
+        createCommandProcessor(&params,
+                               printer,
+                               fileManager,
+                               resultStream,
+                               bmqtst::TestHelperUtil::allocator());
+
+    // Get all records content within offsets range and prepare expected
+    // output
+    bmqu::MemOutStream expectedStream(bmqtst::TestHelperUtil::allocator());
+
+    bsl::list<JournalFile::NodeType>::const_iterator recordIter =
+        records.cbegin();
+    bsl::size_t msgCnt       = 0;
+    bsl::size_t queueOpCnt   = 0;
+    bsl::size_t journalOpCnt = 0;
+    Sequence    s;
+    for (; recordIter != records.cend(); ++recordIter) {
+        RecordType::Enum rtype = recordIter->first;
+        if (rtype == RecordType::e_MESSAGE) {
+            const MessageRecord& msg = *reinterpret_cast<const MessageRecord*>(
+                recordIter->second.buffer());
+            const bsls::Types::Uint64 offset = recordOffset(msg);
+            if (offset > offsetGt && offset < offsetLt) {
+                msgCnt++;
+                EXPECT_CALL(*printer, printGuid(msg.messageGUID()))
+                    .InSequence(s);
+            }
+        }
+        else if (rtype == RecordType::e_QUEUE_OP) {
+            const QueueOpRecord& queueOp =
+                *reinterpret_cast<const QueueOpRecord*>(
+                    recordIter->second.buffer());
+            const bsls::Types::Uint64 offset = recordOffset(queueOp);
+            if (offset > offsetGt && offset < offsetLt) {
+                queueOpCnt++;
+                EXPECT_CALL(*printer,
+                            printQueueOpRecord(OffsetMatcher(offset)))
+                    .InSequence(s);
+            }
+        }
+        else if (rtype == RecordType::e_JOURNAL_OP) {
+            const JournalOpRecord& journalOp =
+                *reinterpret_cast<const JournalOpRecord*>(
+                    recordIter->second.buffer());
+            const bsls::Types::Uint64 offset = recordOffset(journalOp);
+            if (offset > offsetGt && offset < offsetLt) {
+                journalOpCnt++;
+                EXPECT_CALL(*printer,
+                            printJournalOpRecord(OffsetMatcher(offset)))
+                    .InSequence(s);
+            }
+        }
+    }
+
+    EXPECT_CALL(*printer,
+                printFooter(msgCnt,
+                            queueOpCnt,
+                            journalOpCnt,
+                            params.d_processRecordTypes))
+        .InSequence(s);
+
+    // Run search
+    searchProcessor->process();
+}
+
+static void test28_offsetLowerBoundTest()
+// ------------------------------------------------------------------------
+// MOVE TO OFFSET LOWER BOUND TEST
+//
+// Concerns:
+//   Find the first record in journal file with offset more than the
+//   specified 'offsetGt' and move the specified JournalFileIterator to it,
+//   whatever the initial position and direction of the iterator.
+//
+// Testing:
+//   m_bmqstoragetool::moveToOffsetLowerBound()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("MOVE TO OFFSET LOWER BOUND TEST");
+
+    // Simulate journal file
+    const size_t                 k_NUM_RECORDS = 50;
+    JournalFile::RecordsListType records(bmqtst::TestHelperUtil::allocator());
+    JournalFile                  journalFile(k_NUM_RECORDS,
+                            bmqtst::TestHelperUtil::allocator());
+    journalFile.addAllTypesRecords(&records);
+
+    const bsls::Types::Uint64 k_RECORD_SIZE =
+        mqbs::FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
+
+    struct Test {
+        int                 d_line;
+        bsls::Types::Uint64 d_offsetGt;
+        size_t              d_startIndex;
+        bool                d_isReverse;
+        bsls::Types::Uint64 d_expectedIndex;
+    } k_DATA[] = {
+        {L_, 0, 0, false, 0},
+        {L_, k_HEADER_SIZE, 0, false, 1},
+        {L_, k_HEADER_SIZE + k_RECORD_SIZE / 2, 0, false, 1},
+        {L_, k_HEADER_SIZE + 10 * k_RECORD_SIZE, 0, false, 11},
+        {L_, k_HEADER_SIZE + 10 * k_RECORD_SIZE, 25, false, 11},
+        {L_, k_HEADER_SIZE + 10 * k_RECORD_SIZE, 25, true, 11},
+        {L_, k_HEADER_SIZE + 40 * k_RECORD_SIZE - 1, 25, true, 40},
+        {L_, k_HEADER_SIZE + 24 * k_RECORD_SIZE, 25, false, 25},
+        {L_, k_HEADER_SIZE + 48 * k_RECORD_SIZE, 0, false, 49},
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const Test& test = k_DATA[idx];
+
+        mqbs::JournalFileIterator journalFileIt(
+            &journalFile.mappedFileDescriptor(),
+            journalFile.fileHeader(),
+            false);
+        BMQTST_ASSERT_EQ_D(test.d_line, journalFileIt.nextRecord(), 1);
+        if (test.d_startIndex > 0) {
+            BMQTST_ASSERT_EQ_D(test.d_line,
+                               journalFileIt.advance(test.d_startIndex),
+                               1);
+        }
+        if (test.d_isReverse) {
+            journalFileIt.flipDirection();
+        }
+
+        BMQTST_ASSERT_EQ_D(
+            test.d_line,
+            m_bmqstoragetool::moveToOffsetLowerBound(&journalFileIt,
+                                                     test.d_offsetGt),
+            1);
+        BMQTST_ASSERT_EQ_D(test.d_line,
+                           journalFileIt.recordIndex(),
+                           test.d_expectedIndex);
+        BMQTST_ASSERT_GT_D(test.d_line,
+                           journalFileIt.recordOffset(),
+                           test.d_offsetGt);
+        BMQTST_ASSERT_D(test.d_line, !journalFileIt.isReverseMode());
+        if (test.d_expectedIndex > 0) {
+            BMQTST_ASSERT_LE_D(test.d_line,
+                               journalFileIt.recordOffset() - k_RECORD_SIZE,
+                               test.d_offsetGt);
+        }
+    }
+
+    {
+        // Offset of the last record in the file
+        mqbs::JournalFileIterator journalFileIt(
+            &journalFile.mappedFileDescriptor(),
+            journalFile.fileHeader(),
+            false);
+        BMQTST_ASSERT_EQ(journalFileIt.nextRecord(), 1);
+
+        BMQTST_ASSERT_EQ(m_bmqstoragetool::moveToOffsetLowerBound(
+                             &journalFileIt,
+                             journalFileIt.lastRecordPosition()),
+                         0);
+    }
+}
+
+static void test29_followJournalTest()
+// ------------------------------------------------------------------------
+// FOLLOW JOURNAL TEST
+//
+// Concerns:
+//   The records appended to a journal file after the last processed one are
+//   found, and the JournalFileIterator is reset to iterate only them.
+//
+// Testing:
+//   m_bmqstoragetool::followJournal()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("FOLLOW JOURNAL TEST");
+
+    // Simulate journal file
+    const size_t                 k_NUM_RECORDS = 50;
+    JournalFile::RecordsListType records(bmqtst::TestHelperUtil::allocator());
+    JournalFile                  journalFile(k_NUM_RECORDS,
+                            bmqtst::TestHelperUtil::allocator());
+    journalFile.addAllTypesRecords(&records);
+
+    const bsls::Types::Uint64 k_RECORD_SIZE =
+        mqbs::FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
+    const mqbs::MappedFileDescriptor& mfd = journalFile.mappedFileDescriptor();
+
+    // Simulate the part of the journal written when the processing starts
+    const size_t               k_NUM_WRITTEN = 20;
+    mqbs::MappedFileDescriptor writtenMfd(mfd);
+    writtenMfd.setFileSize(k_HEADER_SIZE + k_NUM_WRITTEN * k_RECORD_SIZE);
+
+    mqbs::JournalFileIterator journalFileIt(&writtenMfd,
+                                            journalFile.fileHeader(),
+                                            false);
+    bsls::Types::Uint64       lastOffset = 0;
+    size_t                    numRecords = 0;
+    while (journalFileIt.nextRecord() == 1) {
+        lastOffset = journalFileIt.recordOffset();
+        ++numRecords;
+    }
+    BMQTST_ASSERT_EQ(numRecords, k_NUM_WRITTEN);
+
+    // No record was appended to the written part
+    mqbs::MappedFileDescriptor view;
+    BMQTST_ASSERT_EQ(m_bmqstoragetool::followJournal(&journalFileIt,
+                                                     &view,
+                                                     writtenMfd,
+                                                     lastOffset),
+                     0);
+
+    // The other records are appended
+    BMQTST_ASSERT_EQ(m_bmqstoragetool::followJournal(&journalFileIt,
+                                                     &view,
+                                                     mfd,
+                                                     lastOffset),
+                     1);
+    while (journalFileIt.nextRecord() == 1) {
+        BMQTST_ASSERT_EQ_D(numRecords,
+                           journalFileIt.recordOffset(),
+                           lastOffset + k_RECORD_SIZE);
+        BMQTST_ASSERT_EQ_D(numRecords,
+                           journalFileIt.recordIndex(),
+                           numRecords + 1);
+        lastOffset = journalFileIt.recordOffset();
+        ++numRecords;
+    }
+    BMQTST_ASSERT_EQ(numRecords, k_NUM_RECORDS);
+    BMQTST_ASSERT_EQ(m_bmqstoragetool::followJournal(&journalFileIt,
+                                                     &view,
+                                                     mfd,
+                                                     lastOffset),
+                     0);
+
+    // All the records are found when none was processed
+    BMQTST_ASSERT_EQ(
+        m_bmqstoragetool::followJournal(&journalFileIt, &view, mfd, 0),
+        1);
+    BMQTST_ASSERT_EQ(journalFileIt.nextRecord(), 1);
+    BMQTST_ASSERT_EQ(journalFileIt.recordOffset(), k_HEADER_SIZE);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2651,6 +2939,9 @@ int main(int argc, char* argv[])
     case 24: test24_searchConfirmAndDeletionRecordsByOffset(); break;
     case 25: test25_searchConfirmAndDeletionRecordsBySeqNumber(); break;
     case 26: test26_summaryWithQueueDetailsTest(); break;
+    case 27: test27_parallelSearchAllTypesRecords(); break;
+    case 28: test28_offsetLowerBoundTest(); break;
+    case 29: test29_followJournalTest(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
@@ -99,6 +99,7 @@ const char* CommandLineArguments::k_CSL_ACK_TYPE      = "ack";
 const char* CommandLineArguments::k_HUMAN_MODE        = "human";
 const char* CommandLineArguments::k_JSON_PRETTY_MODE  = "json-pretty";
 const char* CommandLineArguments::k_JSON_LINE_MODE    = "json-line";
+const char* CommandLineArguments::k_COLUMNAR_MODE     = "columnar";
 
 CommandLineArguments::CommandLineArguments(bslma::Allocator* allocator)
 : d_recordType(allocator)
@@ -114,6 +115,7 @@ CommandLineArguments::CommandLineArguments(bslma::Allocator* allocator)
 , d_dataFile(allocator)
 , d_cslFile(allocator)
 , d_cslFromBegin(false)
+, d_cslCacheFile(allocator)
 , d_printMode(allocator)
 , d_guid(allocator)
 , d_seqNum(allocator)
@@ -129,6 +131,9 @@ CommandLineArguments::CommandLineArguments(bslma::Allocator* allocator)
 , d_partiallyConfirmed(false)
 , d_minRecordsPerQueue(0)
 , d_cslSummaryQueuesLimit(0)
+, d_threads(1)
+, d_buildGuidIndex(false)
+, d_follow(false)
 {
     // NOTHING
 }
@@ -146,6 +151,10 @@ bool CommandLineArguments::validate(bsl::string*      error_p,
         validMode = false;
     }
 
+    if (!d_cslCacheFile.empty() && d_cslFile.empty()) {
+        ss << "--csl-cache requires --csl-file option.\n";
+    }
+
     if (validMode) {
         if (!d_cslFile.empty() &&
             (d_journalPath.empty() && d_journalFile.empty())) {
@@ -233,13 +242,19 @@ void CommandLineArguments::validateCslModeArgs(bsl::ostream&     stream,
     }
 
     if (!d_guid.empty() || !d_dataFile.empty() || d_dumpPayload ||
-        d_outstanding || d_confirmed || d_partiallyConfirmed) {
+        d_outstanding || d_confirmed || d_partiallyConfirmed ||
+        d_buildGuidIndex || d_follow) {
         stream
             << "--guid, --data-file, "
                "--dump-payload, --outstanding, --confirmed, "
-               "--partially-confirmed options cannot be applied to CSL file "
-               "and requere either --journal-path "
-               "or --journal-file option.\n";
+               "--partially-confirmed, --build-guid-index, --follow options "
+               "cannot be applied to CSL file and requere either "
+               "--journal-path or --journal-file option.\n";
+    }
+
+    if (d_printMode == k_COLUMNAR_MODE) {
+        stream << "--print-mode=" << k_COLUMNAR_MODE
+               << " cannot be applied to CSL file\n";
     }
 
     if (d_cslSummaryQueuesLimit <= 0)
@@ -375,6 +390,25 @@ void CommandLineArguments::validateJournalModeArgs(bsl::ostream&     stream,
                   "calculates and outputs statistics\n";
     }
 
+    if (d_printMode == k_COLUMNAR_MODE && (d_summary || d_dumpPayload)) {
+        stream << "--print-mode=" << k_COLUMNAR_MODE
+               << " can't be combined with '--summary' and '--dump-payload' "
+                  "options, as it only outputs records\n";
+    }
+
+    if (d_follow && (d_summary || d_outstanding || d_confirmed ||
+                     d_partiallyConfirmed || d_buildGuidIndex)) {
+        stream << "'--follow' can't be combined with '--summary', "
+                  "'--outstanding', '--confirmed', '--partially-confirmed' "
+                  "and '--build-guid-index' options, as they require the "
+                  "whole journal file\n";
+    }
+
+    if (d_follow && d_threads > 1) {
+        stream << "'--follow' can't be combined with '--threads' greater "
+                  "than one\n";
+    }
+
     if (d_outstanding + d_confirmed + d_partiallyConfirmed > 1) {
         stream
             << "These filter flags can't be specified together: outstanding, "
@@ -398,6 +432,9 @@ void CommandLineArguments::validateJournalModeArgs(bsl::ostream&     stream,
 
     if (d_dumpLimit <= 0)
         stream << "Dump limit must be positive value greater than zero.\n";
+
+    if (d_threads <= 0)
+        stream << "Threads must be positive value greater than zero.\n";
 }
 
 bool CommandLineArguments::validateRangeArgs(bsl::ostream&     error,
@@ -493,7 +530,7 @@ bool CommandLineArguments::isValidPrintMode(const bsl::string* printMode,
                                             bsl::ostream&      stream)
 {
     if (*printMode != k_HUMAN_MODE && *printMode != k_JSON_PRETTY_MODE &&
-        *printMode != k_JSON_LINE_MODE) {
+        *printMode != k_JSON_LINE_MODE && *printMode != k_COLUMNAR_MODE) {
         stream << "--print-mode invalid: " << *printMode << bsl::endl;
 
         return false;  // RETURN
@@ -593,6 +630,8 @@ Parameters::Parameters(const CommandLineArguments& arguments,
 , d_confirmed(arguments.d_confirmed)
 , d_partiallyConfirmed(arguments.d_partiallyConfirmed)
 , d_cslSummaryQueuesLimit(arguments.d_cslSummaryQueuesLimit)
+, d_threads(arguments.d_threads)
+, d_follow(arguments.d_follow)
 {
     // Determine processing mode: process Journal or CSL file
     if (!arguments.d_cslFile.empty() &&
@@ -607,6 +646,9 @@ Parameters::Parameters(const CommandLineArguments& arguments,
     else if (arguments.d_printMode == CommandLineArguments::k_JSON_LINE_MODE) {
         d_printMode = e_JSON_LINE;
     }
+    else if (arguments.d_printMode == CommandLineArguments::k_COLUMNAR_MODE) {
+        d_printMode = e_COLUMNAR;
+    }
     // Set record types to process
     if (d_cslMode) {
         if (arguments.d_cslRecordType.empty()) {
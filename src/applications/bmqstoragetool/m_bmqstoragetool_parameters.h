@@ -72,6 +72,7 @@ class CommandLineArguments {
     static const char* k_HUMAN_MODE;
     static const char* k_JSON_PRETTY_MODE;
     static const char* k_JSON_LINE_MODE;
+    static const char* k_COLUMNAR_MODE;
     /// List of record types to process (message, journalOp, queueOp)
     bsl::vector<bsl::string> d_recordType;
     /// List of CSL record types to process (snapshot, update, commit, ack)
@@ -99,6 +100,8 @@ class CommandLineArguments {
     /// If true force to iterate CSL file from the beginning, otherwise iterate
     /// from the latest snapshot
     bool d_cslFromBegin;
+    /// Path of the file caching the queue map built from the CSL file
+    bsl::string d_cslCacheFile;
     /// Print mode
     bsl::string d_printMode;
     /// Filter messages by message guids
@@ -129,6 +132,12 @@ class CommandLineArguments {
     bsls::Types::Int64 d_minRecordsPerQueue;
     /// Limit number of queues to display in CSL file summary
     int d_cslSummaryQueuesLimit;
+    /// Number of threads scanning the journal file
+    int d_threads;
+    /// Build the GUID index of the journal file instead of searching it
+    bool d_buildGuidIndex;
+    /// Keep polling the journal file for new records once its end is reached
+    bool d_follow;
 
     // CREATORS
     explicit CommandLineArguments(bslma::Allocator* allocator = 0);
@@ -188,7 +197,7 @@ struct Parameters {
     // PUBLIC TYPES
 
     /// Enum with available printing modes
-    enum PrintMode { e_HUMAN, e_JSON_PRETTY, e_JSON_LINE };
+    enum PrintMode { e_HUMAN, e_JSON_PRETTY, e_JSON_LINE, e_COLUMNAR };
 
     /// VST representing search range parameters
     struct Range {
@@ -298,6 +307,10 @@ struct Parameters {
     bsl::optional<bsls::Types::Uint64> d_minRecordsPerQueue;
     /// Limit number of queues to display in CSL file summary
     unsigned int d_cslSummaryQueuesLimit;
+    /// Number of threads scanning the journal file
+    unsigned int d_threads;
+    /// Keep polling the journal file for new records once its end is reached
+    bool d_follow;
 
     // CREATORS
     /// Constructor from the specified 'aruments'
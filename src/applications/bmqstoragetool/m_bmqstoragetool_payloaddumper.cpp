@@ -18,13 +18,22 @@
 
 // MQB
 #include <mqbs_filestoreprotocolprinter.h>
+#include <mqbs_filesystemutil.h>
+#include <mqbs_mappedfiledescriptor.h>
 
 // BMQ
 #include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bmqp_compression.h>
 #include <bmqp_messageproperties.h>
 #include <bmqu_memoutstream.h>
 #include <bsl_algorithm.h>
 #include <bsl_ostream.h>
+#include <bsl_vector.h>
+#include <bsls_platform.h>
+
+// SYSTEM
+#include <sys/mman.h>
 
 namespace BloombergLP {
 namespace m_bmqstoragetool {
@@ -33,6 +42,13 @@ namespace {
 
 const unsigned int k_MAX_PAYLOAD_HEX_BYTES = 64;
 
+/// Size of the buffers holding decompressed payloads.
+const int k_BLOB_BUFFER_SIZE = 4096;
+
+/// Maximum size of a decompressed payload, beyond which decompression fails
+/// rather than consuming unbounded memory on a corrupted record.
+const bsls::Types::Uint64 k_MAX_DECOMPRESSED_SIZE = 64 * 1024 * 1024;
+
 int seekToRecord(mqbs::DataFileIterator* it, bsls::Types::Uint64 recordOffset)
 {
     if ((it->recordOffset() > recordOffset && !it->isReverseMode()) ||
@@ -78,6 +94,35 @@ void loadAppData(const char**            appData,
     }
 }
 
+/// Decompress the specified `data` of the specified `length` as per the
+/// specified `compressionType` into the specified `output`, using the
+/// specified `factory` and `allocator`.  Return 0 on success, or a non-zero
+/// value otherwise with a description of the error written to the specified
+/// `errorStream`.
+int decompress(bdlbb::Blob*                         output,
+               bdlbb::BlobBufferFactory*            factory,
+               bmqt::CompressionAlgorithmType::Enum compressionType,
+               const char*                          data,
+               unsigned int                         length,
+               bsl::ostream&                        errorStream,
+               bslma::Allocator*                    allocator)
+{
+    bsl::shared_ptr<char> sp(const_cast<char*>(data),
+                             bslstl::SharedPtrNilDeleter(),
+                             0);
+    bdlbb::BlobBuffer     buf(sp, length);
+    bdlbb::Blob           input(allocator);
+    input.appendDataBuffer(buf);
+
+    return bmqp::Compression::decompress(output,
+                                         factory,
+                                         compressionType,
+                                         input,
+                                         k_MAX_DECOMPRESSED_SIZE,
+                                         &errorStream,
+                                         allocator);
+}
+
 }  // close unnamed namespace
 
 // ===================
@@ -91,12 +136,25 @@ PayloadDumper::PayloadDumper(bsl::ostream&           ostream,
 : d_ostream(ostream)
 , d_dataFile_p(dataFile_p)
 , d_dumpLimit(dumpLimit)
+, d_bufferFactory(k_BLOB_BUFFER_SIZE, allocator)
 , d_allocator_p(allocator)
 {
-    // NOTHING
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MADV_SEQUENTIAL)
+    // Payloads are mostly dumped in increasing offset order, so let the
+    // kernel read the data file ahead aggressively.
+    const mqbs::MappedFileDescriptor* mfd =
+        d_dataFile_p ? d_dataFile_p->mappedFileDescriptor() : 0;
+    if (mfd && mfd->isValid()) {
+        mqbs::FileSystemUtil::madvise(mfd->mapping(),
+                                      mfd->mappingSize(),
+                                      MADV_SEQUENTIAL);
+    }
+#endif
 }
 
-void PayloadDumper::outputPayload(bsls::Types::Uint64 messageOffsetDwords)
+void PayloadDumper::outputPayload(
+    bsls::Types::Uint64                  messageOffsetDwords,
+    bmqt::CompressionAlgorithmType::Enum compressionType)
 {
     const bsls::Types::Uint64 recordOffset = messageOffsetDwords *
                                              bmqp::Protocol::k_DWORD_SIZE;
@@ -144,12 +202,46 @@ void PayloadDumper::outputPayload(bsls::Types::Uint64 messageOffsetDwords)
 
     // Payload
     bmqu::MemOutStream payloadOsstr(d_allocator_p);
-    unsigned int minLen = d_dumpLimit > 0 ? bsl::min(appDataLen, d_dumpLimit)
-                                          : appDataLen;
+    bdlbb::Blob        decompressed(&d_bufferFactory, d_allocator_p);
+    bsl::vector<char>  decompressedPrefix(d_allocator_p);
+    unsigned int       payloadLen = appDataLen;
+    if (compressionType != bmqt::CompressionAlgorithmType::e_NONE &&
+        appDataLen > 0) {
+        bmqu::MemOutStream errorOsstr(d_allocator_p);
+        const int          rc = decompress(&decompressed,
+                                  &d_bufferFactory,
+                                  compressionType,
+                                  appData,
+                                  appDataLen,
+                                  errorOsstr,
+                                  d_allocator_p);
+        if (rc == 0) {
+            payloadOsstr << "Decompressed (" << compressionType << ") from "
+                         << appDataLen << " bytes" << '\n';
+            payloadLen = decompressed.length();
+        }
+        else {
+            payloadOsstr << "Failed to decompress (" << compressionType
+                         << "), rc: " << rc << ", error: " << errorOsstr.str()
+                         << '\n';
+            decompressed.removeAll();
+        }
+    }
+
+    unsigned int minLen = d_dumpLimit > 0 ? bsl::min(payloadLen, d_dumpLimit)
+                                          : payloadLen;
+    if (decompressed.length() > 0) {
+        decompressedPrefix.resize(minLen);
+        bdlbb::BlobUtil::copy(decompressedPrefix.data(),
+                              decompressed,
+                              0,
+                              minLen);
+        appData = decompressedPrefix.data();
+    }
     payloadOsstr << "First " << minLen << " bytes of payload:" << '\n';
     bdlb::Print::hexDump(payloadOsstr, appData, minLen);
-    if (minLen < appDataLen) {
-        payloadOsstr << "And " << (appDataLen - minLen)
+    if (minLen < payloadLen) {
+        payloadOsstr << "And " << (payloadLen - minLen)
                      << " more bytes (redacted)" << '\n';
     }
 
@@ -170,8 +262,10 @@ void PayloadDumper::outputPayload(bsls::Types::Uint64 messageOffsetDwords)
     d_ostream << "\nPayload: " << '\n' << payloadOsstr.str() << '\n';
 }
 
-int PayloadDumper::loadPayloadHex(bsl::string*        result,
-                                  bsls::Types::Uint64 messageOffsetDwords)
+int PayloadDumper::loadPayloadHex(
+    bsl::string*                         result,
+    bsls::Types::Uint64                  messageOffsetDwords,
+    bmqt::CompressionAlgorithmType::Enum compressionType)
 {
     const bsls::Types::Uint64 recordOffset = messageOffsetDwords *
                                              bmqp::Protocol::k_DWORD_SIZE;
@@ -185,6 +279,26 @@ int PayloadDumper::loadPayloadHex(bsl::string*        result,
     unsigned int propertiesAreaLen = 0;
     loadAppData(&appData, &appDataLen, &propertiesAreaLen, d_dataFile_p);
 
+    char decompressedPrefix[k_MAX_PAYLOAD_HEX_BYTES];
+    if (compressionType != bmqt::CompressionAlgorithmType::e_NONE &&
+        appDataLen > 0) {
+        bdlbb::Blob        decompressed(&d_bufferFactory, d_allocator_p);
+        bmqu::MemOutStream errorOsstr(d_allocator_p);
+        if (0 != decompress(&decompressed,
+                            &d_bufferFactory,
+                            compressionType,
+                            appData,
+                            appDataLen,
+                            errorOsstr,
+                            d_allocator_p)) {
+            return -2;  // RETURN
+        }
+        appDataLen = bsl::min(static_cast<unsigned int>(decompressed.length()),
+                              k_MAX_PAYLOAD_HEX_BYTES);
+        bdlbb::BlobUtil::copy(decompressedPrefix, decompressed, 0, appDataLen);
+        appData = decompressedPrefix;
+    }
+
     unsigned int len = bsl::min(appDataLen, k_MAX_PAYLOAD_HEX_BYTES);
     result->clear();
     result->reserve(len * 2);
@@ -22,12 +22,22 @@
 //  m_bmqstoragetool::PayloadDumper: dumps message payload to output stream.
 //
 //@DESCRIPTION: 'PayloadDumper' provides a message payload dumping.
+// Payloads stored compressed (as per the compression algorithm type of their
+// message record) are decompressed before being dumped.  As payloads are
+// mostly dumped in increasing offset order, the kernel is advised to read
+// the data file ahead sequentially.
 
 // MQB
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <mqbs_datafileiterator.h>
 
+// BMQ
+#include <bmqt_compressionalgorithmtype.h>
+
+// BDE
+#include <bdlbb_pooledblobbufferfactory.h>
+
 namespace BloombergLP {
 namespace m_bmqstoragetool {
 
@@ -44,6 +54,8 @@ class PayloadDumper {
     // Pointer to data file iterator.
     unsigned int d_dumpLimit;
     // Dump limit value.
+    bdlbb::PooledBlobBufferFactory d_bufferFactory;
+    // Factory of the buffers holding decompressed payloads.
     bslma::Allocator* d_allocator_p;
     // Pointer to allocator that is used inside the class.
 
@@ -59,14 +71,22 @@ class PayloadDumper {
 
     // MANIPULATORS
 
-    /// Output message payload from the specified offset in Data file.
-    void outputPayload(bsls::Types::Uint64 messageOffsetDwords);
+    /// Output message payload from the specified offset in Data file,
+    /// decompressing it as per the optionally specified `compressionType`.
+    void
+    outputPayload(bsls::Types::Uint64                  messageOffsetDwords,
+                  bmqt::CompressionAlgorithmType::Enum compressionType =
+                      bmqt::CompressionAlgorithmType::e_NONE);
 
     /// Load first 64 bytes of message payload from the specified offset in
-    /// Data file and return it as a hex string via the specified `result`.
-    /// Return 0 on success, non-zero on error.
-    int loadPayloadHex(bsl::string*        result,
-                       bsls::Types::Uint64 messageOffsetDwords);
+    /// Data file, decompressed as per the optionally specified
+    /// `compressionType`, and return it as a hex string via the specified
+    /// `result`.  Return 0 on success, non-zero on error.
+    int
+    loadPayloadHex(bsl::string*                         result,
+                   bsls::Types::Uint64                  messageOffsetDwords,
+                   bmqt::CompressionAlgorithmType::Enum compressionType =
+                       bmqt::CompressionAlgorithmType::e_NONE);
 };
 
 }  // close package namespace
@@ -25,14 +25,17 @@
 // MQB
 #include <mqbs_filestoreprotocol.h>
 #include <mqbs_filestoreprotocolprinter.h>
+#include <mqbu_storagekey.h>
 
 // BDE
 #include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
+#include <bsl_cstring.h>
 #include <bsl_iomanip.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
 #include <bsl_vector.h>
+#include <bsls_assert.h>
 
 namespace BloombergLP {
 namespace m_bmqstoragetool {
@@ -1250,6 +1253,486 @@ void JsonLinePrinter::printRecordDetails(
     printer.printRecordDetails(recordDetails);
 }
 
+class ColumnarPrinter : public Printer {
+  private:
+    // PRIVATE TYPES
+    enum Column {
+        e_RECORD_TYPE,
+        e_RECORD_INDEX,
+        e_RECORD_OFFSET,
+        e_TIMESTAMP,
+        e_PRIMARY_LEASE_ID,
+        e_SEQUENCE_NUMBER,
+        e_QUEUE_KEY,
+        e_APP_KEY,
+        e_GUID,
+        e_CONFIRM_STATE,
+        e_NUM_COLUMNS
+    };
+
+    enum ConfirmState {
+        e_OUTSTANDING         = 0,
+        e_PARTIALLY_CONFIRMED = 1,
+        e_CONFIRMED           = 2
+    };
+
+    struct ColumnInfo {
+        const char* d_name;
+        int         d_width;
+    };
+
+    // CLASS DATA
+    static const char       k_MAGIC[8];
+    static const ColumnInfo k_COLUMNS[e_NUM_COLUMNS];
+
+    /// Number of rows buffered before a batch is written.
+    static const bsl::size_t k_BATCH_NUM_ROWS = 64 * 1024;
+
+    // DATA
+    bsl::ostream& d_ostream;
+
+    mutable bsl::vector<bsl::vector<char> > d_columns;
+    // Buffered values of the rows of the current batch, per column
+
+    mutable bsl::size_t d_numRows;
+    // Number of rows of the current batch
+
+    // PRIVATE ACCESSORS
+
+    /// Append the specified `value` as a big-endian integer of the width of
+    /// the specified `column` to the current batch.
+    void appendUint(Column column, bsls::Types::Uint64 value) const;
+
+    /// Append the specified `numBytes` bytes at the specified `data` to the
+    /// specified `column` of the current batch.
+    void appendBytes(Column column, const void* data, int numBytes) const;
+
+    /// Append a row for the record of the specified `recordType` with the
+    /// specified `header`, `recordIndex`, `recordOffset`, `queueKey`,
+    /// `appKey`, `guid` and `confirmState` to the current batch, and write
+    /// the batch if it is full.  Null `queueKey`, `appKey` or `guid` are
+    /// written as zero bytes.
+    void appendRow(mqbs::RecordType::Enum    recordType,
+                   const mqbs::RecordHeader* header,
+                   bsls::Types::Uint64       recordIndex,
+                   bsls::Types::Uint64       recordOffset,
+                   const mqbu::StorageKey*   queueKey,
+                   const mqbu::StorageKey*   appKey,
+                   const bmqt::MessageGUID*  guid,
+                   ConfirmState              confirmState) const;
+
+    /// Write the rows of the current batch, if any, and clear it.
+    void flush() const;
+
+  public:
+    // CREATORS
+    ColumnarPrinter(bsl::ostream& os, bslma::Allocator* allocator);
+
+    ~ColumnarPrinter() BSLS_KEYWORD_OVERRIDE;
+
+    // PUBLIC METHODS
+
+    void
+    printMessage(const MessageDetails& details) const BSLS_KEYWORD_OVERRIDE;
+
+    void printConfirmRecord(const RecordDetails<mqbs::ConfirmRecord>& rec)
+        const BSLS_KEYWORD_OVERRIDE;
+
+    void printDeletionRecord(const RecordDetails<mqbs::DeletionRecord>& rec)
+        const BSLS_KEYWORD_OVERRIDE;
+
+    void printQueueOpRecord(const RecordDetails<mqbs::QueueOpRecord>& rec)
+        const BSLS_KEYWORD_OVERRIDE;
+
+    void printJournalOpRecord(const RecordDetails<mqbs::JournalOpRecord>& rec)
+        const BSLS_KEYWORD_OVERRIDE;
+
+    void printGuidNotFound(const bmqt::MessageGUID& guid) const
+        BSLS_KEYWORD_OVERRIDE;
+
+    void printGuid(const bmqt::MessageGUID& guid) const BSLS_KEYWORD_OVERRIDE;
+
+    void printFooter(bsls::Types::Uint64                   foundMessagesCount,
+                     bsls::Types::Uint64                   foundQueueOpCount,
+                     bsls::Types::Uint64                   foundJournalOpCount,
+                     const Parameters::ProcessRecordTypes& processRecordTypes)
+        const BSLS_KEYWORD_OVERRIDE;
+
+    void printExactMatchFooter(
+        bsls::Types::Uint64                   foundMessagesCount,
+        bsls::Types::Uint64                   foundConfirmCount,
+        bsls::Types::Uint64                   foundDeletionCount,
+        bsls::Types::Uint64                   foundQueueOpCount,
+        bsls::Types::Uint64                   foundJournalOpCount,
+        const Parameters::ProcessRecordTypes& processRecordTypes) const
+        BSLS_KEYWORD_OVERRIDE;
+
+    void printOutstandingRatio(int         ratio,
+                               bsl::size_t outstandingMessagesCount,
+                               bsl::size_t totalMessagesCount) const
+        BSLS_KEYWORD_OVERRIDE;
+
+    void printMessageSummary(bsl::size_t totalMessagesCount,
+                             bsl::size_t partiallyConfirmedCount,
+                             bsl::size_t confirmedCount,
+                             bsl::size_t outstandingCount) const
+        BSLS_KEYWORD_OVERRIDE;
+
+    void printQueueOpSummary(bsls::Types::Uint64     queueOpRecordsCount,
+                             const QueueOpCountsVec& queueOpCountsVec) const
+        BSLS_KEYWORD_OVERRIDE;
+
+    void printJournalOpSummary(bsls::Types::Uint64 journalOpRecordsCount) const
+        BSLS_KEYWORD_OVERRIDE;
+
+    void printRecordSummary(bsls::Types::Uint64    totalRecordsCount,
+                            const QueueDetailsMap& queueDetailsMap) const
+        BSLS_KEYWORD_OVERRIDE;
+
+    void printJournalFileMeta(const mqbs::JournalFileIterator* journalFile_p)
+        const BSLS_KEYWORD_OVERRIDE;
+
+    void printDataFileMeta(const mqbs::DataFileIterator* dataFile_p) const
+        BSLS_KEYWORD_OVERRIDE;
+
+    void
+    printGuidsNotFound(const GuidsList& guids) const BSLS_KEYWORD_OVERRIDE;
+
+    void printOffsetsNotFound(const OffsetsVec& offsets) const
+        BSLS_KEYWORD_OVERRIDE;
+
+    void printCompositesNotFound(const CompositesVec& seqNums) const
+        BSLS_KEYWORD_OVERRIDE;
+
+    bool isPayloadHexMode() const BSLS_KEYWORD_OVERRIDE;
+};
+
+// CLASS DATA
+const char ColumnarPrinter::k_MAGIC[8] =
+    {'B', 'M', 'Q', 'C', 'O', 'L', 'S', '1'};
+
+const ColumnarPrinter::ColumnInfo ColumnarPrinter::k_COLUMNS[e_NUM_COLUMNS] =
+    {{"recordType", 1},
+     {"recordIndex", 8},
+     {"recordOffset", 8},
+     {"timestamp", 8},
+     {"primaryLeaseId", 4},
+     {"sequenceNumber", 8},
+     {"queueKey", mqbu::StorageKey::e_KEY_LENGTH_BINARY},
+     {"appKey", mqbu::StorageKey::e_KEY_LENGTH_BINARY},
+     {"guid", bmqt::MessageGUID::e_SIZE_BINARY},
+     {"confirmState", 1}};
+
+// PRIVATE ACCESSORS
+void ColumnarPrinter::appendUint(Column              column,
+                                 bsls::Types::Uint64 value) const
+{
+    bsl::vector<char>& buffer = d_columns[column];
+    for (int shift = 8 * (k_COLUMNS[column].d_width - 1); shift >= 0;
+         shift -= 8) {
+        buffer.push_back(static_cast<char>((value >> shift) & 0xFF));
+    }
+}
+
+void ColumnarPrinter::appendBytes(Column      column,
+                                  const void* data,
+                                  int         numBytes) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(numBytes == k_COLUMNS[column].d_width);
+
+    bsl::vector<char>& buffer = d_columns[column];
+    if (data) {
+        const char* begin = static_cast<const char*>(data);
+        buffer.insert(buffer.end(), begin, begin + numBytes);
+    }
+    else {
+        buffer.resize(buffer.size() + numBytes, 0);
+    }
+}
+
+void ColumnarPrinter::appendRow(mqbs::RecordType::Enum    recordType,
+                                const mqbs::RecordHeader* header,
+                                bsls::Types::Uint64       recordIndex,
+                                bsls::Types::Uint64       recordOffset,
+                                const mqbu::StorageKey*   queueKey,
+                                const mqbu::StorageKey*   appKey,
+                                const bmqt::MessageGUID*  guid,
+                                ConfirmState              confirmState) const
+{
+    appendUint(e_RECORD_TYPE, recordType);
+    appendUint(e_RECORD_INDEX, recordIndex);
+    appendUint(e_RECORD_OFFSET, recordOffset);
+    appendUint(e_TIMESTAMP, header ? header->timestamp() : 0);
+    appendUint(e_PRIMARY_LEASE_ID, header ? header->primaryLeaseId() : 0);
+    appendUint(e_SEQUENCE_NUMBER, header ? header->sequenceNumber() : 0);
+    appendBytes(e_QUEUE_KEY,
+                queueKey ? queueKey->data() : 0,
+                mqbu::StorageKey::e_KEY_LENGTH_BINARY);
+    appendBytes(e_APP_KEY,
+                appKey ? appKey->data() : 0,
+                mqbu::StorageKey::e_KEY_LENGTH_BINARY);
+    if (guid) {
+        unsigned char binaryGuid[bmqt::MessageGUID::e_SIZE_BINARY];
+        guid->toBinary(binaryGuid);
+        appendBytes(e_GUID, binaryGuid, sizeof(binaryGuid));
+    }
+    else {
+        appendBytes(e_GUID, 0, bmqt::MessageGUID::e_SIZE_BINARY);
+    }
+    appendUint(e_CONFIRM_STATE, confirmState);
+
+    if (++d_numRows == k_BATCH_NUM_ROWS) {
+        flush();
+    }
+}
+
+void ColumnarPrinter::flush() const
+{
+    if (d_numRows == 0) {
+        return;  // RETURN
+    }
+
+    const char numRows[4] = {static_cast<char>((d_numRows >> 24) & 0xFF),
+                             static_cast<char>((d_numRows >> 16) & 0xFF),
+                             static_cast<char>((d_numRows >> 8) & 0xFF),
+                             static_cast<char>(d_numRows & 0xFF)};
+    d_ostream.write(numRows, sizeof(numRows));
+    for (int i = 0; i < e_NUM_COLUMNS; ++i) {
+        d_ostream.write(d_columns[i].data(), d_columns[i].size());
+        d_columns[i].clear();
+    }
+    d_numRows = 0;
+}
+
+// CREATORS
+ColumnarPrinter::ColumnarPrinter(bsl::ostream& os, bslma::Allocator* allocator)
+: d_ostream(os)
+, d_columns(e_NUM_COLUMNS, allocator)
+, d_numRows(0)
+{
+    d_ostream.write(k_MAGIC, sizeof(k_MAGIC));
+    d_ostream.put(static_cast<char>(e_NUM_COLUMNS));
+    for (int i = 0; i < e_NUM_COLUMNS; ++i) {
+        const bsl::size_t nameLength = bsl::strlen(k_COLUMNS[i].d_name);
+        d_ostream.put(static_cast<char>(nameLength));
+        d_ostream.write(k_COLUMNS[i].d_name, nameLength);
+        d_ostream.put(static_cast<char>(k_COLUMNS[i].d_width));
+
+        d_columns[i].reserve(k_BATCH_NUM_ROWS * k_COLUMNS[i].d_width);
+    }
+}
+
+ColumnarPrinter::~ColumnarPrinter()
+{
+    flush();
+    d_ostream.flush();
+}
+
+// PUBLIC METHODS
+
+void ColumnarPrinter::printMessage(const MessageDetails& details) const
+{
+    const RecordDetails<mqbs::MessageRecord>& message =
+        details.messageRecord();
+    const bsl::vector<RecordDetails<mqbs::ConfirmRecord> >& confirms =
+        details.confirmRecords();
+    const bsl::optional<RecordDetails<mqbs::DeletionRecord> >& deletion =
+        details.deleteRecord();
+
+    ConfirmState confirmState = e_OUTSTANDING;
+    if (deletion.has_value()) {
+        confirmState = e_CONFIRMED;
+    }
+    else if (!confirms.empty()) {
+        confirmState = e_PARTIALLY_CONFIRMED;
+    }
+
+    appendRow(mqbs::RecordType::e_MESSAGE,
+              &message.d_record.header(),
+              message.d_recordIndex,
+              message.d_recordOffset,
+              &message.d_record.queueKey(),
+              0,
+              &message.d_record.messageGUID(),
+              confirmState);
+
+    for (bsl::vector<RecordDetails<mqbs::ConfirmRecord> >::const_iterator it =
+             confirms.begin();
+         it != confirms.end();
+         ++it) {
+        printConfirmRecord(*it);
+    }
+
+    if (deletion.has_value()) {
+        printDeletionRecord(deletion.value());
+    }
+}
+
+void ColumnarPrinter::printConfirmRecord(
+    const RecordDetails<mqbs::ConfirmRecord>& rec) const
+{
+    appendRow(mqbs::RecordType::e_CONFIRM,
+              &rec.d_record.header(),
+              rec.d_recordIndex,
+              rec.d_recordOffset,
+              &rec.d_record.queueKey(),
+              &rec.d_record.appKey(),
+              &rec.d_record.messageGUID(),
+              e_OUTSTANDING);
+}
+
+void ColumnarPrinter::printDeletionRecord(
+    const RecordDetails<mqbs::DeletionRecord>& rec) const
+{
+    appendRow(mqbs::RecordType::e_DELETION,
+              &rec.d_record.header(),
+              rec.d_recordIndex,
+              rec.d_recordOffset,
+              &rec.d_record.queueKey(),
+              0,
+              &rec.d_record.messageGUID(),
+              e_OUTSTANDING);
+}
+
+void ColumnarPrinter::printQueueOpRecord(
+    const RecordDetails<mqbs::QueueOpRecord>& rec) const
+{
+    appendRow(mqbs::RecordType::e_QUEUE_OP,
+              &rec.d_record.header(),
+              rec.d_recordIndex,
+              rec.d_recordOffset,
+              &rec.d_record.queueKey(),
+              &rec.d_record.appKey(),
+              0,
+              e_OUTSTANDING);
+}
+
+void ColumnarPrinter::printJournalOpRecord(
+    const RecordDetails<mqbs::JournalOpRecord>& rec) const
+{
+    appendRow(mqbs::RecordType::e_JOURNAL_OP,
+              &rec.d_record.header(),
+              rec.d_recordIndex,
+              rec.d_recordOffset,
+              0,
+              0,
+              0,
+              e_OUTSTANDING);
+}
+
+void ColumnarPrinter::printGuidNotFound(
+    BSLA_MAYBE_UNUSED const bmqt::MessageGUID& guid) const
+{
+    // NOTHING
+}
+
+void ColumnarPrinter::printGuid(const bmqt::MessageGUID& guid) const
+{
+    appendRow(mqbs::RecordType::e_MESSAGE,
+              0,
+              0,
+              0,
+              0,
+              0,
+              &guid,
+              e_OUTSTANDING);
+}
+
+void ColumnarPrinter::printFooter(
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64 foundMessagesCount,
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64 foundQueueOpCount,
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64 foundJournalOpCount,
+    BSLA_MAYBE_UNUSED const Parameters::ProcessRecordTypes&
+                            processRecordTypes) const
+{
+    // NOTHING
+}
+
+void ColumnarPrinter::printExactMatchFooter(
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64 foundMessagesCount,
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64 foundConfirmCount,
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64 foundDeletionCount,
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64 foundQueueOpCount,
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64 foundJournalOpCount,
+    BSLA_MAYBE_UNUSED const Parameters::ProcessRecordTypes&
+                            processRecordTypes) const
+{
+    // NOTHING
+}
+
+void ColumnarPrinter::printOutstandingRatio(
+    BSLA_MAYBE_UNUSED int         ratio,
+    BSLA_MAYBE_UNUSED bsl::size_t outstandingMessagesCount,
+    BSLA_MAYBE_UNUSED bsl::size_t totalMessagesCount) const
+{
+    // NOTHING
+}
+
+void ColumnarPrinter::printMessageSummary(
+    BSLA_MAYBE_UNUSED bsl::size_t totalMessagesCount,
+    BSLA_MAYBE_UNUSED bsl::size_t partiallyConfirmedCount,
+    BSLA_MAYBE_UNUSED bsl::size_t confirmedCount,
+    BSLA_MAYBE_UNUSED bsl::size_t outstandingCount) const
+{
+    // NOTHING
+}
+
+void ColumnarPrinter::printQueueOpSummary(
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64 queueOpRecordsCount,
+    BSLA_MAYBE_UNUSED const QueueOpCountsVec& queueOpCountsVec) const
+{
+    // NOTHING
+}
+
+void ColumnarPrinter::printJournalOpSummary(
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64 journalOpRecordsCount) const
+{
+    // NOTHING
+}
+
+void ColumnarPrinter::printRecordSummary(
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64 totalRecordsCount,
+    BSLA_MAYBE_UNUSED const QueueDetailsMap& queueDetailsMap) const
+{
+    // NOTHING
+}
+
+void ColumnarPrinter::printJournalFileMeta(
+    BSLA_MAYBE_UNUSED const mqbs::JournalFileIterator* journalFile_p) const
+{
+    // NOTHING
+}
+
+void ColumnarPrinter::printDataFileMeta(
+    BSLA_MAYBE_UNUSED const mqbs::DataFileIterator* dataFile_p) const
+{
+    // NOTHING
+}
+
+void ColumnarPrinter::printGuidsNotFound(
+    BSLA_MAYBE_UNUSED const GuidsList& guids) const
+{
+    // NOTHING
+}
+
+void ColumnarPrinter::printOffsetsNotFound(
+    BSLA_MAYBE_UNUSED const OffsetsVec& offsets) const
+{
+    // NOTHING
+}
+
+void ColumnarPrinter::printCompositesNotFound(
+    BSLA_MAYBE_UNUSED const CompositesVec& seqNums) const
+{
+    // NOTHING
+}
+
+bool ColumnarPrinter::isPayloadHexMode() const
+{
+    return true;
+}
+
 bsl::shared_ptr<Printer> createPrinter(Parameters::PrintMode mode,
                                        std::ostream&         stream,
                                        bslma::Allocator*     allocator)
@@ -1267,6 +1750,10 @@ bsl::shared_ptr<Printer> createPrinter(Parameters::PrintMode mode,
         printer.load(new (*allocator) JsonLinePrinter(stream, allocator),
                      allocator);
     }
+    else if (mode == Parameters::e_COLUMNAR) {
+        printer.load(new (*allocator) ColumnarPrinter(stream, allocator),
+                     allocator);
+    }
     return printer;
 }
 
@@ -22,6 +22,28 @@
 //  Printer: provides methods to print storage files.
 //
 //@DESCRIPTION: Interface class to print storage files.
+//
+/// Columnar Print Mode
+///-------------------
+// The printer created for 'Parameters::e_COLUMNAR' writes the metadata of the
+// printed records in a binary columnar format intended for offline analytics:
+// a header describing the columns, followed by batches of up to 65536 rows
+// each storing the fixed-width values of every column contiguously.  All
+// integers are big-endian.
+//..
+//  stream := magic:char[8] numColumns:uint8 column{numColumns} batch*
+//  column := nameLength:uint8 name:char[nameLength] width:uint8
+//  batch  := numRows:uint32 values{numColumns}
+//  values := byte[numRows * width]
+//..
+// where 'magic' is "BMQCOLS1" and the columns are, in order: 'recordType'
+// (the 'mqbs::RecordType' value), 'recordIndex', 'recordOffset',
+// 'timestamp', 'primaryLeaseId', 'sequenceNumber', 'queueKey', 'appKey',
+// 'guid' (raw bytes, zero when not applicable) and 'confirmState' (for
+// message records: 0 if outstanding, 1 if partially confirmed, 2 if
+// confirmed).  A message row is followed by the rows of its confirm and
+// deletion records.  Summaries, footers and lists of records not found are
+// not written.
 
 // bmqstoragetool
 #include <m_bmqstoragetool_messagedetails.h>
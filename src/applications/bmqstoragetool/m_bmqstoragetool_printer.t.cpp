@@ -22,6 +22,7 @@
 // MQB
 #include <mqbs_filestoreprotocol.h>
 #include <mqbu_messageguidutil.h>
+#include <mqbu_storagekey.h>
 
 // BDE
 #include <bdljsn_jsonutil.h>
@@ -2564,6 +2565,108 @@ static void test24_jsonLineSummaryTest()
     }
 }
 
+static void test25_columnarRecordsTest()
+// ------------------------------------------------------------------------
+// COLUMNAR RECORDS TEST
+//
+// Concerns:
+//   Exercise the output of the ColumnarPrinter: the header describing the
+//   columns is followed by a batch storing the values of every column
+//   contiguously.
+//
+// Testing:
+//   ColumnarPrinter::printQueueOpRecord
+//   ColumnarPrinter::printJournalOpRecord
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COLUMNAR RECORDS TEST");
+
+    // Simulate journal file
+    JournalFile journalFile(2, bmqtst::TestHelperUtil::allocator());
+    JournalFile::RecordBufferType queueOpBuf =
+        journalFile.makeQueueOpRecord(100, 1);
+    JournalFile::RecordBufferType journalOpBuf =
+        journalFile.makeJournalOpRecord(100, 2);
+
+    RecordDetails<mqbs::QueueOpRecord> queueOpDetails(
+        *reinterpret_cast<const QueueOpRecord*>(queueOpBuf.buffer()),
+        12345,
+        56789,
+        bmqtst::TestHelperUtil::allocator());
+    RecordDetails<mqbs::JournalOpRecord> journalOpDetails(
+        *reinterpret_cast<const JournalOpRecord*>(journalOpBuf.buffer()),
+        12346,
+        56849,
+        bmqtst::TestHelperUtil::allocator());
+
+    bmqu::MemOutStream resultStream(bmqtst::TestHelperUtil::allocator());
+    {
+        // Create printer
+        bsl::shared_ptr<Printer> printer = createPrinter(
+            Parameters::PrintMode::e_COLUMNAR,
+            resultStream,
+            bmqtst::TestHelperUtil::allocator());
+
+        printer->printQueueOpRecord(queueOpDetails);
+        printer->printJournalOpRecord(journalOpDetails);
+        printer->printFooter(0, 1, 1, Parameters::ProcessRecordTypes());
+    }
+
+    const bsl::string& result = resultStream.str();
+    const char*        data   = result.data();
+    bsl::size_t        pos    = 0;
+
+    // Header
+    BMQTST_ASSERT(result.size() > 9);
+    BMQTST_ASSERT_EQ(bsl::string(data, 8), "BMQCOLS1");
+    pos = 8;
+    const int numColumns = static_cast<unsigned char>(data[pos++]);
+    BMQTST_ASSERT_EQ(numColumns, 10);
+
+    bsl::vector<bsl::string> names(bmqtst::TestHelperUtil::allocator());
+    bsl::vector<int>         widths(bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < numColumns && pos < result.size(); ++i) {
+        const bsl::size_t nameLength = static_cast<unsigned char>(
+            data[pos++]);
+        names.push_back(bsl::string(data + pos, nameLength));
+        pos += nameLength;
+        widths.push_back(static_cast<unsigned char>(data[pos++]));
+    }
+    BMQTST_ASSERT_EQ(names.size(), 10u);
+    BMQTST_ASSERT_EQ(names[0], "recordType");
+    BMQTST_ASSERT_EQ(widths[0], 1);
+    BMQTST_ASSERT_EQ(names[1], "recordIndex");
+    BMQTST_ASSERT_EQ(widths[1], 8);
+    BMQTST_ASSERT_EQ(names[6], "queueKey");
+    BMQTST_ASSERT_EQ(widths[6], mqbu::StorageKey::e_KEY_LENGTH_BINARY);
+
+    // Single batch of two rows
+    int rowWidth = 0;
+    for (size_t i = 0; i < widths.size(); ++i) {
+        rowWidth += widths[i];
+    }
+    BMQTST_ASSERT_EQ(result.size(), pos + 4 + 2 * rowWidth);
+    BMQTST_ASSERT_EQ(bsl::string(data + pos, 4), bsl::string("\0\0\0\2", 4));
+    pos += 4;
+
+    // 'recordType' column
+    BMQTST_ASSERT_EQ(data[pos], RecordType::e_QUEUE_OP);
+    BMQTST_ASSERT_EQ(data[pos + 1], RecordType::e_JOURNAL_OP);
+    pos += 2 * widths[0];
+
+    // 'recordIndex' column
+    BMQTST_ASSERT_EQ(bsl::string(data + pos, 8),
+                     bsl::string("\0\0\0\0\0\0\x30\x39", 8));
+    BMQTST_ASSERT_EQ(bsl::string(data + pos + 8, 8),
+                     bsl::string("\0\0\0\0\0\0\x30\x3A", 8));
+    pos += 2 * widths[1];
+
+    // 'queueKey' column
+    pos += 2 * (widths[2] + widths[3] + widths[4] + widths[5]);
+    BMQTST_ASSERT_EQ(bsl::string(data + pos, 5), "abcde");
+    BMQTST_ASSERT_EQ(bsl::string(data + pos + 5, 5), bsl::string(5, '\0'));
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2598,6 +2701,7 @@ int main(int argc, char* argv[])
     case 22: test22_jsonLineFooterTest(); break;
     case 23: test23_jsonLineOutstandingTest(); break;
     case 24: test24_jsonLineSummaryTest(); break;
+    case 25: test25_columnarRecordsTest(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
@@ -0,0 +1,231 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqstoragetool
+#include <m_bmqstoragetool_queuemapcache.h>
+
+// BMQ
+#include <bmqp_ctrlmsg_messages.h>
+#include <bmqp_protocolutil.h>
+
+// MQB
+#include <mqbc_clusterstateledgerprotocol.h>
+
+// BDE
+#include <bdlb_bigendian.h>
+#include <bdls_filesystemutil.h>
+#include <bdlsb_memoutstreambuf.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_vector.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace m_bmqstoragetool {
+
+namespace {
+
+const char k_MAGIC[8] = {'B', 'M', 'Q', 'Q', 'M', 'A', 'P', 'C'};
+
+/// On-disk identifier of a CSL record.
+struct CacheRecordId {
+    bdlb::BigEndianUint64 d_offset;
+    bdlb::BigEndianUint64 d_electorTerm;
+    bdlb::BigEndianUint64 d_sequenceNumber;
+};
+
+/// On-disk header of a queue map cache file.
+struct CacheHeader {
+    char          d_magic[8];
+    CacheRecordId d_snapshotId;
+    CacheRecordId d_lastRecordId;
+};
+
+/// Store the specified `recordId` into the specified `cacheRecordId`.
+void toCache(CacheRecordId*                     cacheRecordId,
+             const QueueMapCacheUtil::RecordId& recordId)
+{
+    cacheRecordId->d_offset         = recordId.d_offset;
+    cacheRecordId->d_electorTerm    = recordId.d_electorTerm;
+    cacheRecordId->d_sequenceNumber = recordId.d_sequenceNumber;
+}
+
+/// Load the specified `cacheRecordId` into the specified `recordId`.
+void fromCache(QueueMapCacheUtil::RecordId* recordId,
+               const CacheRecordId&         cacheRecordId)
+{
+    recordId->d_offset         = cacheRecordId.d_offset;
+    recordId->d_electorTerm    = cacheRecordId.d_electorTerm;
+    recordId->d_sequenceNumber = cacheRecordId.d_sequenceNumber;
+}
+
+}  // close unnamed namespace
+
+// ------------------------
+// struct QueueMapCacheUtil
+// ------------------------
+
+// CLASS METHODS
+QueueMapCacheUtil::RecordId QueueMapCacheUtil::recordId(
+    const mqbc::IncoreClusterStateLedgerIterator& cslIt)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(cslIt.isValid());
+
+    RecordId result;
+    result.d_offset         = cslIt.currRecordId().offset();
+    result.d_electorTerm    = cslIt.header().electorTerm();
+    result.d_sequenceNumber = cslIt.header().sequenceNumber();
+    return result;
+}
+
+int QueueMapCacheUtil::save(bsl::ostream&      errorDescription,
+                            const bsl::string& cachePath,
+                            const QueueMap&    queueMap,
+                            const RecordId&    snapshotId,
+                            const RecordId&    lastRecordId,
+                            bslma::Allocator*  allocator)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS     = 0,
+        rc_ENCODE_FAIL = -1,
+        rc_OPEN_FAIL   = -2,
+        rc_WRITE_FAIL  = -3
+    };
+
+    CacheHeader header;
+    bsl::memcpy(header.d_magic, k_MAGIC, sizeof(k_MAGIC));
+    toCache(&header.d_snapshotId, snapshotId);
+    toCache(&header.d_lastRecordId, lastRecordId);
+
+    bmqp_ctrlmsg::LeaderAdvisory advisory(allocator);
+    advisory.queues() = queueMap.queueInfos();
+
+    bdlsb::MemOutStreamBuf osb(allocator);
+    osb.sputn(reinterpret_cast<const char*>(&header), sizeof(header));
+    int rc = bmqp::ProtocolUtil::encodeMessage(errorDescription,
+                                               &osb,
+                                               advisory,
+                                               bmqp::EncodingType::e_BER,
+                                               allocator);
+    if (0 != rc) {
+        errorDescription << "Failed to encode the queue map, rc: " << rc
+                         << "\n";
+        return rc_ENCODE_FAIL;  // RETURN
+    }
+
+    bsl::ofstream file(cachePath.c_str(),
+                       bsl::ios::out | bsl::ios::binary | bsl::ios::trunc);
+    if (!file) {
+        errorDescription << "Failed to open file [" << cachePath
+                         << "] for writing\n";
+        return rc_OPEN_FAIL;  // RETURN
+    }
+
+    file.write(osb.data(), osb.length());
+    file.close();
+    if (!file) {
+        errorDescription << "Failed to write file [" << cachePath << "]\n";
+        return rc_WRITE_FAIL;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int QueueMapCacheUtil::load(QueueMap*          queueMap,
+                            RecordId*          snapshotId,
+                            RecordId*          lastRecordId,
+                            bsl::ostream&      errorDescription,
+                            const bsl::string& cachePath,
+                            bslma::Allocator*  allocator)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS        = 0,
+        rc_OPEN_FAIL      = -1,
+        rc_INVALID_HEADER = -2,
+        rc_READ_FAIL      = -3,
+        rc_DECODE_FAIL    = -4
+    };
+
+    // PRECONDITIONS
+    BSLS_ASSERT(queueMap);
+    BSLS_ASSERT(snapshotId);
+    BSLS_ASSERT(lastRecordId);
+
+    if (!bdls::FilesystemUtil::isRegularFile(cachePath)) {
+        errorDescription << "File [" << cachePath << "] does not exist\n";
+        return rc_OPEN_FAIL;  // RETURN
+    }
+
+    const bsls::Types::Int64 fileSize = bdls::FilesystemUtil::getFileSize(
+        cachePath);
+    if (fileSize < static_cast<bsls::Types::Int64>(sizeof(CacheHeader))) {
+        errorDescription << "File [" << cachePath << "] is too small\n";
+        return rc_INVALID_HEADER;  // RETURN
+    }
+
+    bsl::vector<char> contents(static_cast<size_t>(fileSize), allocator);
+    bsl::ifstream     file(cachePath.c_str(), bsl::ios::in | bsl::ios::binary);
+    if (!file) {
+        errorDescription << "Failed to open file [" << cachePath << "]\n";
+        return rc_OPEN_FAIL;  // RETURN
+    }
+    file.read(contents.data(), fileSize);
+    if (!file) {
+        errorDescription << "Failed to read file [" << cachePath << "]\n";
+        return rc_READ_FAIL;  // RETURN
+    }
+
+    const CacheHeader& header = *reinterpret_cast<const CacheHeader*>(
+        contents.data());
+    if (0 != bsl::memcmp(header.d_magic, k_MAGIC, sizeof(k_MAGIC))) {
+        errorDescription << "File [" << cachePath
+                         << "] is not a queue map cache\n";
+        return rc_INVALID_HEADER;  // RETURN
+    }
+
+    bmqp_ctrlmsg::LeaderAdvisory advisory(allocator);
+    const int rc = bmqp::ProtocolUtil::decodeMessage(
+        errorDescription,
+        &advisory,
+        contents.data(),
+        sizeof(CacheHeader),
+        static_cast<int>(fileSize - sizeof(CacheHeader)),
+        bmqp::EncodingType::e_BER,
+        allocator);
+    if (0 != rc) {
+        errorDescription << "File [" << cachePath
+                         << "] is corrupted, rc: " << rc << "\n";
+        return rc_DECODE_FAIL;  // RETURN
+    }
+
+    fromCache(snapshotId, header.d_snapshotId);
+    fromCache(lastRecordId, header.d_lastRecordId);
+
+    const bsl::vector<bmqp_ctrlmsg::QueueInfo>& queues = advisory.queues();
+    for (bsl::vector<bmqp_ctrlmsg::QueueInfo>::const_iterator it =
+             queues.begin();
+         it != queues.end();
+         ++it) {
+        queueMap->insert(*it);
+    }
+
+    return rc_SUCCESS;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,173 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_M_BMQSTORAGETOOL_QUEUEMAPCACHE
+#define INCLUDED_M_BMQSTORAGETOOL_QUEUEMAPCACHE
+
+//@PURPOSE: Provide utilities to save and load a decoded CSL queue map.
+//
+//@CLASSES:
+//  m_bmqstoragetool::QueueMapCacheUtil: utilities for queue map cache files.
+//
+//@DESCRIPTION: 'QueueMapCacheUtil' saves to a cache file the queue map built
+// from a cluster state ledger (CSL) file, along with the identifiers of the
+// snapshot record it was built from and of the last record applied to it, and
+// loads it back.  A later run starting from the same snapshot restores the
+// queue map from the cache and only decodes the records appended to the CSL
+// file after the last cached one, instead of decoding the snapshot and all
+// the update records that follow it.
+//
+// A record is identified by its offset in the CSL file, its elector term and
+// its sequence number, so that a cache built from another CSL file, or from a
+// CSL file that has been rolled over since, is detected as unusable by the
+// caller.
+//
+/// File Format
+///-----------
+// All integers are big-endian.
+//..
+//  cache    := magic:char[8] snapshot:recordId lastRecord:recordId
+//              advisory:byte[]
+//  recordId := offset:uint64 electorTerm:uint64 sequenceNumber:uint64
+//..
+// where 'magic' is "BMQQMAPC" and 'advisory' is the BER encoding of a
+// 'bmqp_ctrlmsg::LeaderAdvisory' holding the queues of the map, up to the end
+// of the file.
+
+// bmqstoragetool
+#include <m_bmqstoragetool_queuemap.h>
+
+// MQB
+#include <mqbc_incoreclusterstateledgeriterator.h>
+
+// BDE
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bslma_allocator.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace m_bmqstoragetool {
+
+// ========================
+// struct QueueMapCacheUtil
+// ========================
+
+struct QueueMapCacheUtil {
+    // PUBLIC TYPES
+
+    /// Identifier of a record of a CSL file.
+    struct RecordId {
+        /// Offset of the record in the CSL file
+        bsls::Types::Uint64 d_offset;
+        /// Elector term of the record
+        bsls::Types::Uint64 d_electorTerm;
+        /// Sequence number of the record
+        bsls::Types::Uint64 d_sequenceNumber;
+
+        // CREATORS
+
+        /// Create an identifier with all the attributes set to zero.
+        RecordId();
+    };
+
+    // CLASS METHODS
+
+    /// Return the identifier of the record the specified valid `cslIt` is
+    /// pointing to.
+    static RecordId
+    recordId(const mqbc::IncoreClusterStateLedgerIterator& cslIt);
+
+    /// Write the queues of the specified `queueMap`, built from the snapshot
+    /// record having the specified `snapshotId` up to the record having the
+    /// specified `lastRecordId`, to the cache file at the specified
+    /// `cachePath`.  Use the specified `allocator` for temporary memory
+    /// allocations.  Return 0 on success, or a non-zero value otherwise,
+    /// with a description of the error written to the specified
+    /// `errorDescription`.
+    static int save(bsl::ostream&      errorDescription,
+                    const bsl::string& cachePath,
+                    const QueueMap&    queueMap,
+                    const RecordId&    snapshotId,
+                    const RecordId&    lastRecordId,
+                    bslma::Allocator*  allocator = 0);
+
+    /// Insert into the specified `queueMap` the queues of the cache file at
+    /// the specified `cachePath`, and load into the specified `snapshotId`
+    /// and `lastRecordId` the identifiers of the snapshot record and of the
+    /// last record the cache was built from.  Use the specified `allocator`
+    /// for temporary memory allocations.  Return 0 on success, or a
+    /// non-zero value if the cache cannot be used (e.g. it is missing or
+    /// corrupted), with a description of the error written to the
+    /// specified `errorDescription`, in which case `queueMap` is unchanged.
+    static int load(QueueMap*          queueMap,
+                    RecordId*          snapshotId,
+                    RecordId*          lastRecordId,
+                    bsl::ostream&      errorDescription,
+                    const bsl::string& cachePath,
+                    bslma::Allocator*  allocator = 0);
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` identify the same record,
+/// and `false` otherwise.
+bool operator==(const QueueMapCacheUtil::RecordId& lhs,
+                const QueueMapCacheUtil::RecordId& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` do not identify the same
+/// record, and `false` otherwise.
+bool operator!=(const QueueMapCacheUtil::RecordId& lhs,
+                const QueueMapCacheUtil::RecordId& rhs);
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ----------------------------------
+// struct QueueMapCacheUtil::RecordId
+// ----------------------------------
+
+inline QueueMapCacheUtil::RecordId::RecordId()
+: d_offset(0)
+, d_electorTerm(0)
+, d_sequenceNumber(0)
+{
+    // NOTHING
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+
+inline bool m_bmqstoragetool::operator==(
+    const m_bmqstoragetool::QueueMapCacheUtil::RecordId& lhs,
+    const m_bmqstoragetool::QueueMapCacheUtil::RecordId& rhs)
+{
+    return lhs.d_offset == rhs.d_offset &&
+           lhs.d_electorTerm == rhs.d_electorTerm &&
+           lhs.d_sequenceNumber == rhs.d_sequenceNumber;
+}
+
+inline bool m_bmqstoragetool::operator!=(
+    const m_bmqstoragetool::QueueMapCacheUtil::RecordId& lhs,
+    const m_bmqstoragetool::QueueMapCacheUtil::RecordId& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
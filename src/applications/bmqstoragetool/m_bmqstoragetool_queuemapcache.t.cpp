@@ -0,0 +1,219 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// bmqstoragetool
+#include <m_bmqstoragetool_queuemapcache.h>
+
+// BMQ
+#include <bmqp_ctrlmsg_messages.h>
+#include <bmqu_memoutstream.h>
+#include <bmqu_tempdirectory.h>
+
+// MQB
+#include <mqbu_storagekey.h>
+
+// BDE
+#include <bdls_pathutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_fstream.h>
+#include <bsl_string.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace m_bmqstoragetool;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Insert into the specified `queueMap` a queue having the specified `uri`
+/// and the specified hexadecimal `queueKey`.
+void insertQueue(QueueMap* queueMap, const char* uri, const char* queueKey)
+{
+    bmqp_ctrlmsg::QueueInfo queueInfo(bmqtst::TestHelperUtil::allocator());
+    queueInfo.uri() = uri;
+    mqbu::StorageKey key(mqbu::StorageKey::HexRepresentation(), queueKey);
+    for (int i = 0; i < mqbu::StorageKey::e_KEY_LENGTH_BINARY; i++) {
+        queueInfo.key().push_back(key.data()[i]);
+    }
+    queueMap->insert(queueInfo);
+}
+
+/// Return a record identifier with the specified `offset`, `electorTerm`
+/// and `sequenceNumber`.
+QueueMapCacheUtil::RecordId makeRecordId(bsls::Types::Uint64 offset,
+                                         bsls::Types::Uint64 electorTerm,
+                                         bsls::Types::Uint64 sequenceNumber)
+{
+    QueueMapCacheUtil::RecordId result;
+    result.d_offset         = offset;
+    result.d_electorTerm    = electorTerm;
+    result.d_sequenceNumber = sequenceNumber;
+    return result;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   A saved queue map is loaded back with its queues and the identifiers
+//   of the records it was built from.
+//
+// Testing:
+//   save
+//   load
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    QueueMap queueMap(bmqtst::TestHelperUtil::allocator());
+    insertQueue(&queueMap, "bmq://domain/queue1", "ABCDE12345");
+    insertQueue(&queueMap, "bmq://domain/queue2", "12345ABCDE");
+
+    const QueueMapCacheUtil::RecordId snapshotId   = makeRecordId(100, 2, 7);
+    const QueueMapCacheUtil::RecordId lastRecordId = makeRecordId(900, 3, 1);
+
+    bmqu::TempDirectory tempDir(bmqtst::TestHelperUtil::allocator());
+    bsl::string         cachePath(tempDir.path(),
+                          bmqtst::TestHelperUtil::allocator());
+    bdls::PathUtil::appendRaw(&cachePath, "csl.qmapc");
+
+    bmqu::MemOutStream errorDescription(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(
+        QueueMapCacheUtil::save(errorDescription,
+                                cachePath,
+                                queueMap,
+                                snapshotId,
+                                lastRecordId,
+                                bmqtst::TestHelperUtil::allocator()),
+        0);
+    BMQTST_ASSERT(errorDescription.str().empty());
+
+    QueueMap                    loadedQueueMap(
+        bmqtst::TestHelperUtil::allocator());
+    QueueMapCacheUtil::RecordId loadedSnapshotId;
+    QueueMapCacheUtil::RecordId loadedLastRecordId;
+    BMQTST_ASSERT_EQ(
+        QueueMapCacheUtil::load(&loadedQueueMap,
+                                &loadedSnapshotId,
+                                &loadedLastRecordId,
+                                errorDescription,
+                                cachePath,
+                                bmqtst::TestHelperUtil::allocator()),
+        0);
+    BMQTST_ASSERT(errorDescription.str().empty());
+
+    BMQTST_ASSERT(loadedSnapshotId == snapshotId);
+    BMQTST_ASSERT(loadedLastRecordId == lastRecordId);
+    BMQTST_ASSERT(loadedSnapshotId != loadedLastRecordId);
+    BMQTST_ASSERT_EQ(loadedQueueMap.queueInfos().size(), 2U);
+
+    // Every loaded queue is one of the saved queues
+    const QueueMap::QueueInfos savedInfos  = queueMap.queueInfos();
+    const QueueMap::QueueInfos loadedInfos = loadedQueueMap.queueInfos();
+    for (QueueMap::QueueInfos::const_iterator it = loadedInfos.begin();
+         it != loadedInfos.end();
+         ++it) {
+        BMQTST_ASSERT(bsl::find(savedInfos.begin(), savedInfos.end(), *it) !=
+                      savedInfos.end());
+    }
+}
+
+static void test2_unusableCache()
+// ------------------------------------------------------------------------
+// UNUSABLE CACHE
+//
+// Concerns:
+//   A missing cache, or a file which is not a queue map cache, is reported
+//   as unusable and leaves the queue map unchanged.
+//
+// Testing:
+//   load
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("UNUSABLE CACHE");
+
+    bmqu::TempDirectory tempDir(bmqtst::TestHelperUtil::allocator());
+    bsl::string         cachePath(tempDir.path(),
+                          bmqtst::TestHelperUtil::allocator());
+    bdls::PathUtil::appendRaw(&cachePath, "csl.qmapc");
+
+    QueueMap                    queueMap(bmqtst::TestHelperUtil::allocator());
+    QueueMapCacheUtil::RecordId snapshotId;
+    QueueMapCacheUtil::RecordId lastRecordId;
+    bmqu::MemOutStream errorDescription(bmqtst::TestHelperUtil::allocator());
+
+    // Missing cache
+    BMQTST_ASSERT_NE(
+        QueueMapCacheUtil::load(&queueMap,
+                                &snapshotId,
+                                &lastRecordId,
+                                errorDescription,
+                                cachePath,
+                                bmqtst::TestHelperUtil::allocator()),
+        0);
+    BMQTST_ASSERT(!errorDescription.str().empty());
+
+    // Not a cache
+    {
+        bsl::ofstream file(cachePath.c_str(),
+                           bsl::ios::out | bsl::ios::binary);
+        file << "This is not a queue map cache file at all";
+    }
+    errorDescription.reset();
+    BMQTST_ASSERT_NE(
+        QueueMapCacheUtil::load(&queueMap,
+                                &snapshotId,
+                                &lastRecordId,
+                                errorDescription,
+                                cachePath,
+                                bmqtst::TestHelperUtil::allocator()),
+        0);
+    BMQTST_ASSERT(!errorDescription.str().empty());
+    BMQTST_ASSERT(queueMap.queueInfos().empty());
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_unusableCache(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
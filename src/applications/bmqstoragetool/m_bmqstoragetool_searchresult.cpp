@@ -345,8 +345,7 @@ bool SearchShortResult::processMessageRecord(
     BSLA_MAYBE_UNUSED bsls::Types::Uint64 recordIndex,
     BSLA_MAYBE_UNUSED bsls::Types::Uint64 recordOffset)
 {
-    GuidData guidData = bsl::make_pair(record.messageGUID(),
-                                       record.messageOffsetDwords());
+    GuidData guidData = bsl::make_pair(record.messageGUID(), record);
 
     if (d_printImmediately) {
         outputGuidData(guidData);
@@ -458,7 +457,9 @@ void SearchShortResult::outputGuidData(const GuidData& guidData)
 {
     d_printer->printGuid(guidData.first);
     if (d_payloadDumper)
-        d_payloadDumper->outputPayload(guidData.second);
+        d_payloadDumper->outputPayload(
+            guidData.second.messageOffsetDwords(),
+            guidData.second.compressionAlgorithmType());
 
     d_printedMessagesCount++;
 }
@@ -652,8 +653,10 @@ void SearchDetailResult::addMessageDetails(const mqbs::MessageRecord& record,
     if (d_payloadDumper && d_printer->isPayloadHexMode()) {
         bsl::string payloadHex(d_allocator_p);
         if (0 ==
-            d_payloadDumper->loadPayloadHex(&payloadHex,
-                                            record.messageOffsetDwords())) {
+            d_payloadDumper->loadPayloadHex(
+                &payloadHex,
+                record.messageOffsetDwords(),
+                record.compressionAlgorithmType())) {
             detailsIt->setPayloadHex(payloadHex);
         }
     }
@@ -670,9 +673,12 @@ void SearchDetailResult::outputMessageDetails(
     const MessageDetails& messageDetails)
 {
     d_printer->printMessage(messageDetails);
-    if (d_payloadDumper && !d_printer->isPayloadHexMode())
-        d_payloadDumper->outputPayload(
-            messageDetails.messageRecord().d_record.messageOffsetDwords());
+    if (d_payloadDumper && !d_printer->isPayloadHexMode()) {
+        const mqbs::MessageRecord& record =
+            messageDetails.messageRecord().d_record;
+        d_payloadDumper->outputPayload(record.messageOffsetDwords(),
+                                       record.compressionAlgorithmType());
+    }
     d_printedMessagesCount++;
 }
 
@@ -725,14 +731,17 @@ bool SearchExactMatchResult::processMessageRecord(
     if (d_payloadDumper && d_printer->isPayloadHexMode()) {
         bsl::string payloadHex(d_allocator_p);
         if (0 ==
-            d_payloadDumper->loadPayloadHex(&payloadHex,
-                                            record.messageOffsetDwords())) {
+            d_payloadDumper->loadPayloadHex(
+                &payloadHex,
+                record.messageOffsetDwords(),
+                record.compressionAlgorithmType())) {
             details.setPayloadHex(payloadHex);
         }
     }
     d_printer->printMessage(details);
     if (d_payloadDumper && !d_printer->isPayloadHexMode())
-        d_payloadDumper->outputPayload(record.messageOffsetDwords());
+        d_payloadDumper->outputPayload(record.messageOffsetDwords(),
+                                       record.compressionAlgorithmType());
 
     d_printedMessagesCount++;
 
@@ -154,7 +154,7 @@ class SearchShortResult : public SearchResult {
   private:
     // PRIVATE TYPES
 
-    typedef bsl::pair<bmqt::MessageGUID, bsls::Types::Uint64> GuidData;
+    typedef bsl::pair<bmqt::MessageGUID, mqbs::MessageRecord> GuidData;
     // Pair that represents guid short result.
     typedef bsl::list<GuidData> GuidDataList;
     // List iterator for guid short result.
@@ -17,6 +17,7 @@
 #include <m_bmqtool_application.h>
 #include <m_bmqtool_inpututil.h>
 #include <m_bmqtool_parameters.h>
+#include <m_bmqtool_replayer.h>
 
 // BMQ
 #include <bmqt_queueflags.h>
@@ -194,7 +195,7 @@ static bool parseArgs(Parameters* parameters, int argc, const char* argv[])
     balcl::OptionInfo specTable[] = {
         {"mode",
          "mode",
-         "mode ([<cli>, auto, storage, syschk])",
+         "mode ([<cli>, auto, storage, syschk, replay])",
          balcl::TypeInfo(&params.mode(), &ParametersMode::isValid),
          balcl::OccurrenceInfo::e_OPTIONAL},
         {"b|broker",
@@ -353,7 +354,27 @@ static bool parseArgs(Parameters* parameters, int argc, const char* argv[])
          "data",
          "authentication data/credentials string",
          balcl::TypeInfo(&params.authnData()),
-         balcl::OccurrenceInfo(params.authnData())}};
+         balcl::OccurrenceInfo(params.authnData())},
+        {"numqueues",
+         "numQueues",
+         "number of queues to open in auto mode (suffixed URIs when > 1)",
+         balcl::TypeInfo(&params.numQueues()),
+         balcl::OccurrenceInfo(params.numQueues())},
+        {"capturefile",
+         "captureFile",
+         "broker event capture file to replay (for replay mode)",
+         balcl::TypeInfo(&params.captureFile()),
+         balcl::OccurrenceInfo(params.captureFile())},
+        {"replayspeed",
+         "replaySpeed",
+         "speed factor of the replay, 1 being real time (for replay mode)",
+         balcl::TypeInfo(&params.replaySpeed()),
+         balcl::OccurrenceInfo(params.replaySpeed())},
+        {"postingthreads",
+         "numPostingThreads",
+         "number of threads posting in auto mode, each to its own queues",
+         balcl::TypeInfo(&params.numPostingThreads()),
+         balcl::OccurrenceInfo(params.numPostingThreads())}};
 
     balcl::CommandLine commandLine(specTable);
     if (commandLine.parse(argc, argv) != 0 || showHelp) {
@@ -459,6 +480,11 @@ int main(int argc, const char* argv[])
         return Application::syschk(parameters);  // RETURN
     }
 
+    if (parameters.mode() == ParametersMode::e_REPLAY) {
+        Replayer replayer(parameters, bslma::Default::allocator());
+        return replayer.run();  // RETURN
+    }
+
     bool isInteractive = parameters.mode() == ParametersMode::e_CLI ||
                          parameters.mode() == ParametersMode::e_STORAGE;
 
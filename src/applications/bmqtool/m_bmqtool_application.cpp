@@ -51,8 +51,9 @@
 #include <ball_streamobserver.h>
 #include <bdlbb_blobutil.h>
 #include <bdlf_bind.h>
-#include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
+#include <bdlt_timeunitratio.h>
+#include <bsl_algorithm.h>
 #include <bsl_fstream.h>
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
@@ -551,15 +552,28 @@ int Application::initialize()
             return e_VALIDATE_SUBSCRIPTION_ERROR;  // RETURN
         }
 
-        bmqa::OpenQueueStatus result = d_session_mp->openQueueSync(
-            &d_queueId,
-            d_parameters.queueUri(),
-            d_parameters.queueFlags(),
-            queueOptions);
-        if (!result) {
-            BALL_LOG_ERROR << "Error while opening queue: [result: " << result
-                           << "]";
-            return e_OPEN_QUEUE_ERROR;  // RETURN
+        // With more than one queue, queue 'i' is opened with the URI
+        // '<queueUri><i>' so that a single process can spread its load over
+        // several queues (and thereby over several partitions).
+        const int numQueues = d_parameters.numQueues();
+        d_queueIds.resize(numQueues);
+        for (int i = 0; i < numQueues; ++i) {
+            bmqu::MemOutStream uri(d_allocator_p);
+            uri << d_parameters.queueUri();
+            if (numQueues > 1) {
+                uri << i;
+            }
+
+            bmqa::OpenQueueStatus result = d_session_mp->openQueueSync(
+                &d_queueIds[i],
+                uri.str(),
+                d_parameters.queueFlags(),
+                queueOptions);
+            if (!result) {
+                BALL_LOG_ERROR << "Error while opening queue '" << uri.str()
+                               << "': [result: " << result << "]";
+                return e_OPEN_QUEUE_ERROR;  // RETURN
+            }
         }
 
         // Schedule a clock to collect / dump stats
@@ -799,7 +813,7 @@ void Application::onMessageEvent(const bmqa::MessageEvent& event)
     }
 }
 
-void Application::producerThread()
+void Application::producerThread(int threadIndex)
 {
     BSLS_ASSERT_SAFE(d_session_mp);
 
@@ -808,21 +822,41 @@ void Application::producerThread()
         turnstile.reset(1000.0 / d_parameters.postInterval());
     }
 
-    bsl::shared_ptr<PostingContext> postingContext =
-        d_poster.createPostingContext(d_session_mp.get(),
-                                      d_parameters,
-                                      d_queueId);
+    // One posting context per queue owned by this thread, served in a
+    // round-robin fashion: each turn posts the next batch on every queue that
+    // still has pending posts.  Queues are partitioned between the producer
+    // threads so that each posting context is only ever used by one thread.
+    const size_t numThreads = d_producerThreads.size();
+    bsl::vector<bsl::shared_ptr<PostingContext> > postingContexts(
+        d_allocator_p);
+    for (size_t i = static_cast<size_t>(threadIndex); i < d_queueIds.size();
+         i += numThreads) {
+        postingContexts.push_back(
+            d_poster.createPostingContext(d_session_mp.get(),
+                                          d_parameters,
+                                          d_queueIds[i]));
+    }
 
-    while (d_isRunning && postingContext->pendingPost()) {
-        if (d_isConnected) {
-            postingContext->postNext();
+    bool pendingPost = true;
+    while (d_isRunning && pendingPost) {
+        pendingPost = false;
+        for (size_t i = 0; i < postingContexts.size(); ++i) {
+            PostingContext& postingContext = *postingContexts[i];
+            if (!postingContext.pendingPost()) {
+                continue;  // CONTINUE
+            }
+            if (d_isConnected) {
+                postingContext.postNext();
+            }
+            pendingPost = pendingPost || postingContext.pendingPost();
         }
         if (d_parameters.postInterval() != 0) {
             turnstile.waitTurn();
         }
     }
 
-    if (!bmqt::QueueFlagsUtil::isAck(d_parameters.queueFlags())) {
+    if (--d_numActiveProducers == 0 &&
+        !bmqt::QueueFlagsUtil::isAck(d_parameters.queueFlags())) {
         d_shutdownSemaphore_p->post();
     }
 }
@@ -886,8 +920,9 @@ Application::Application(const Parameters& parameters,
 : d_allocator_p(bslma::Default::allocator(allocator))
 , d_parameters(parameters)
 , d_shutdownSemaphore_p(shutdownSemaphore)
-, d_runningThread(bslmt::ThreadUtil::invalidHandle())
-, d_queueId(d_allocator_p)
+, d_producerThreads(d_allocator_p)
+, d_numActiveProducers(0)
+, d_queueIds(d_allocator_p)
 , d_statContext_sp(createStatContext(10, d_allocator_p))
 , d_isConnected(false)
 , d_isRunning(false)
@@ -903,6 +938,18 @@ Application::Application(const Parameters& parameters,
 , d_numExpectedAcks(0)
 , d_numAcknowledged(0)
 {
+    // A producer in auto mode intends to post a batch every 'postInterval'
+    // milliseconds: let the latency storages correct for the messages it
+    // could not send on schedule (coordinated omission).
+    if (d_parameters.mode() == ParametersMode::e_AUTO &&
+        bmqt::QueueFlagsUtil::isWriter(d_parameters.queueFlags()) &&
+        d_parameters.postInterval() > 0) {
+        const bsls::Types::Int64 expectedInterval =
+            static_cast<bsls::Types::Int64>(d_parameters.postInterval()) *
+            bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MILLISECOND;
+        d_confirmLatencyStorage.setExpectedInterval(expectedInterval);
+        d_ackLatencyStorage.setExpectedInterval(expectedInterval);
+    }
 }
 
 Application::~Application()
@@ -957,13 +1004,24 @@ int Application::run()
     else {
         if (bmqt::QueueFlagsUtil::isWriter(d_parameters.queueFlags())) {
             d_numExpectedAcks = d_parameters.eventsCount() *
-                                d_parameters.eventSize();
+                                d_parameters.eventSize() *
+                                d_parameters.numQueues();
             d_numAcknowledged = 0;
 
-            // Start the thread
-            rc = bslmt::ThreadUtil::create(
-                &d_runningThread,
-                bdlf::MemFnUtil::memFn(&Application::producerThread, this));
+            // Start the threads, no more than one per queue
+            const int numThreads = bsl::min(
+                d_parameters.numPostingThreads(),
+                static_cast<int>(d_queueIds.size()));
+            d_producerThreads.resize(numThreads,
+                                     bslmt::ThreadUtil::invalidHandle());
+            d_numActiveProducers = numThreads;
+            for (int i = 0; i < numThreads && rc == 0; ++i) {
+                rc = bslmt::ThreadUtil::create(
+                    &d_producerThreads[i],
+                    bdlf::BindUtil::bind(&Application::producerThread,
+                                         this,
+                                         i));
+            }
         }
     }
 
@@ -981,10 +1039,12 @@ void Application::stop()
     d_scheduler.cancelAllEventsAndWait();
     d_scheduler.stop();
 
-    if (d_runningThread != bslmt::ThreadUtil::invalidHandle()) {
-        bslmt::ThreadUtil::join(d_runningThread);
-        d_runningThread = bslmt::ThreadUtil::invalidHandle();
+    for (size_t i = 0; i < d_producerThreads.size(); ++i) {
+        if (d_producerThreads[i] != bslmt::ThreadUtil::invalidHandle()) {
+            bslmt::ThreadUtil::join(d_producerThreads[i]);
+        }
     }
+    d_producerThreads.clear();
 
     // Disconnect from the broker
     if (d_parameters.mode() == ParametersMode::e_AUTO) {
@@ -992,8 +1052,10 @@ void Application::stop()
             bslmt::ThreadUtil::sleep(
                 bsls::TimeInterval(d_parameters.shutdownGrace()));
         }
-        if (d_queueId.isValid()) {
-            d_session_mp->closeQueueSync(&d_queueId);
+        for (size_t i = 0; i < d_queueIds.size(); ++i) {
+            if (d_queueIds[i].isValid()) {
+                d_session_mp->closeQueueSync(&d_queueIds[i]);
+            }
         }
         d_session_mp->stop();
     }
@@ -46,6 +46,7 @@
 #include <bdlbb_blob.h>
 #include <bdlmt_eventscheduler.h>
 #include <bsl_memory.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslmt_threadutil.h>
@@ -88,12 +89,17 @@ class Application : public bmqa::SessionEventHandler {
     // Semaphore holding the main thread
     // alive
 
-    bslmt::ThreadUtil::Handle d_runningThread;
-    // Handle on the running thread
+    bsl::vector<bslmt::ThreadUtil::Handle> d_producerThreads;
+    // Handles on the running threads
     // (producer mode)
 
-    bmqa::QueueId d_queueId;
-    // Queue to send/receive messages
+    bsls::AtomicInt d_numActiveProducers;
+    // Number of producer threads which
+    // have not yet finished posting
+
+    bsl::vector<bmqa::QueueId> d_queueIds;
+    // Queues to send/receive messages (auto
+    // mode opens 'numQueues' of them)
 
     bsl::shared_ptr<bmqst::StatContext> d_statContext_sp;
     // StatContext for msg/event stats
@@ -208,8 +214,9 @@ class Application : public bmqa::SessionEventHandler {
     /// success.
     int initialize();
 
-    /// Thread to process the publish.
-    void producerThread();
+    /// Thread to process the publish on the queues whose index modulo the
+    /// number of producer threads is the specified `threadIndex`.
+    void producerThread(int threadIndex);
 
   public:
     // CLASS METHODS
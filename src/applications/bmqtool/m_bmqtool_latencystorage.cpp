@@ -36,6 +36,8 @@ LatencyStorage::LatencyStorage(bsl::string_view  origin,
 , d_origin(origin, d_allocator_p)
 , d_digitsLimit(1)
 , d_totalCount(0)
+, d_expectedInterval(0)
+, d_correctedCount(0)
 , d_latencies(d_allocator_p)
 {
     BSLS_ASSERT_SAFE(1 <= latencyDigits && latencyDigits <= 9);
@@ -45,10 +47,8 @@ LatencyStorage::LatencyStorage(bsl::string_view  origin,
     }
 }
 
-void LatencyStorage::insert(bsls::Types::Int64 latency)
+void LatencyStorage::record(bsls::Types::Int64 latency)
 {
-    BSLS_ASSERT_SAFE(0 <= latency);
-
     bsls::Types::Int64 divisor = 1;
     while (divisor * d_digitsLimit < latency) {
         divisor *= 10;
@@ -60,6 +60,26 @@ void LatencyStorage::insert(bsls::Types::Int64 latency)
     ++d_totalCount;
 }
 
+void LatencyStorage::insert(bsls::Types::Int64 latency)
+{
+    BSLS_ASSERT_SAFE(0 <= latency);
+
+    record(latency);
+
+    if (d_expectedInterval == 0) {
+        return;  // RETURN
+    }
+
+    // Back-fill the samples the messages which should have been sent during
+    // this latency would have observed, had the sender not been held back.
+    for (bsls::Types::Int64 missing = latency - d_expectedInterval;
+         missing >= d_expectedInterval;
+         missing -= d_expectedInterval) {
+        record(missing);
+        ++d_correctedCount;
+    }
+}
+
 bsls::Types::Int64 LatencyStorage::computePercentile(double percentile) const
 {
     BSLS_ASSERT_SAFE(0 <= percentile && percentile <= 100.0);
@@ -126,6 +146,8 @@ int LatencyStorage::save(const bsl::string& filename) const
 
     file << "{\n";
     file << "  \"origin\": \"" << d_origin << "\",\n";
+    file << "  \"expectedInterval\": " << d_expectedInterval << ",\n";
+    file << "  \"correctedCount\": " << d_correctedCount << ",\n";
     file << "  \"min\": " << minLatency() << ",\n";
     file << "  \"max\": " << maxLatency() << ",\n";
     file << "  \"avg\": " << avgLatency() << ",\n";
@@ -167,6 +189,9 @@ void LatencyStorage::printSummary(bsl::ostream& stream) const
            << bmqu::PrintUtil::prettyTimeInterval(TIMESTAMP) << "\n";
 
     stream << "    totalCount......: " << d_totalCount << "\n";
+    if (d_expectedInterval != 0) {
+        stream << "    correctedCount..: " << d_correctedCount << "\n";
+    }
     BMQTOOL_LSTAT("min.............", minLatency());
     BMQTOOL_LSTAT("avg.............", avgLatency());
     BMQTOOL_LSTAT("max.............", maxLatency());
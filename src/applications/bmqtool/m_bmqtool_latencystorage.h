@@ -25,6 +25,19 @@
 // (in nanoseconds) with automatic rounding to a specified precision for
 // bucketing. It provides APIs to compute percentiles, save JSON reports,
 // and print human-readable summaries.
+//
+/// Coordinated omission
+///--------------------
+// A rate-driven producer that falls behind (because the broker or the network
+// stalls) sends fewer messages during the stall, so a plain histogram only
+// contains the few samples that observed the stall and understates the tail
+// latency.  When an expected interval between samples is set with
+// 'setExpectedInterval', every inserted latency larger than that interval is
+// complemented with the samples that would have been observed had the
+// messages been sent on schedule ('latency - interval',
+// 'latency - 2 * interval', ..., down to 'interval'), the same correction
+// HdrHistogram applies in 'recordValueWithExpectedInterval'.  The number of
+// such synthesized samples is reported as 'correctedCount'.
 
 // BDE
 #include <bsl_map.h>
@@ -34,6 +47,7 @@
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
@@ -50,8 +64,16 @@ class LatencyStorage {
     bsl::string        d_origin;
     bsls::Types::Int64 d_digitsLimit;
     bsls::Types::Int64 d_totalCount;
+    bsls::Types::Int64 d_expectedInterval;
+    bsls::Types::Int64 d_correctedCount;
     LatencyMap         d_latencies;
 
+    // PRIVATE MANIPULATORS
+
+    /// Round the specified `latency` to the configured precision and count
+    /// it.
+    void record(bsls::Types::Int64 latency);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(LatencyStorage, bslma::UsesBslmaAllocator)
@@ -68,10 +90,16 @@ class LatencyStorage {
 
     // MANIPULATORS
 
-    /// @brief Insert a latency sample.
+    /// @brief Insert a latency sample, correcting for coordinated
+    ///        omission if an expected interval is set.
     /// @param latency Latency value in nanoseconds
     void insert(bsls::Types::Int64 latency);
 
+    /// @brief Set the expected interval between two samples.
+    /// @param interval Interval in nanoseconds, 0 to disable the
+    ///        coordinated omission correction (the default)
+    void setExpectedInterval(bsls::Types::Int64 interval);
+
     /// @brief Save the latency report to a JSON file.
     /// @param filename Path to output file
     /// @return 0 on success, non-zero error code on failure
@@ -86,6 +114,10 @@ class LatencyStorage {
     /// @brief Return the total number of latencies stored.
     bsls::Types::Int64 totalCount() const;
 
+    /// @brief Return the number of latencies synthesized by the coordinated
+    ///        omission correction (included in `totalCount`).
+    bsls::Types::Int64 correctedCount() const;
+
     /// @brief Compute a percentile latency value.
     /// @param percentile Percentile level (0-100)
     /// @return Latency at the specified percentile, or 0 if empty
@@ -102,11 +134,23 @@ class LatencyStorage {
 };
 
 // INLINE DEFINITIONS
+inline void LatencyStorage::setExpectedInterval(bsls::Types::Int64 interval)
+{
+    BSLS_ASSERT_SAFE(0 <= interval);
+
+    d_expectedInterval = interval;
+}
+
 inline bsls::Types::Int64 LatencyStorage::totalCount() const
 {
     return d_totalCount;
 }
 
+inline bsls::Types::Int64 LatencyStorage::correctedCount() const
+{
+    return d_correctedCount;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -241,6 +241,40 @@ static void test6_saveAndLoadTest()
     BMQTST_ASSERT(content.find("\"99percentile\":") != bsl::string::npos);
 }
 
+static void test7_coordinatedOmissionTest()
+// ------------------------------------------------------------------------
+// COORDINATED OMISSION TEST
+//
+// Verify that, with an expected interval set, a latency spanning several
+// intervals is complemented with the samples of the messages which could
+// not be sent on schedule, and that short latencies are left untouched.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COORDINATED OMISSION TEST");
+
+    LatencyStorage storage("test", 3, bmqtst::TestHelperUtil::allocator());
+    storage.setExpectedInterval(100);
+
+    // Below the interval: nothing to correct
+    storage.insert(50);
+    BMQTST_ASSERT_EQ(storage.totalCount(), 1);
+    BMQTST_ASSERT_EQ(storage.correctedCount(), 0);
+
+    // 450 = 4.5 intervals: back-fill 350, 250 and 150
+    storage.insert(450);
+    BMQTST_ASSERT_EQ(storage.totalCount(), 5);
+    BMQTST_ASSERT_EQ(storage.correctedCount(), 3);
+    BMQTST_ASSERT_EQ(storage.minLatency(), 50);
+    BMQTST_ASSERT_EQ(storage.maxLatency(), 450);
+    BMQTST_ASSERT_EQ(storage.computePercentile(50), 250);
+
+    // Disabling the correction records samples as-is
+    storage.setExpectedInterval(0);
+    storage.insert(1000);
+    BMQTST_ASSERT_EQ(storage.totalCount(), 6);
+    BMQTST_ASSERT_EQ(storage.correctedCount(), 3);
+}
+
 static void test_N1_manualSaveInspection()
 // ------------------------------------------------------------------------
 // MANUAL SAVE INSPECTION TEST
@@ -325,6 +359,7 @@ int main(int argc, char* argv[])
     case 4: test4_emptyStorageTest(); break;
     case 5: test5_statisticsTest(); break;
     case 6: test6_saveAndLoadTest(); break;
+    case 7: test7_coordinatedOmissionTest(); break;
     case -1: test_N1_manualSaveInspection(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
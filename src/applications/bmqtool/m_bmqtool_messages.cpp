@@ -4374,6 +4374,14 @@ const char CommandLineParameters::DEFAULT_INITIALIZER_AUTHN_MECHANISM[] = "";
 
 const char CommandLineParameters::DEFAULT_INITIALIZER_AUTHN_DATA[] = "";
 
+const int CommandLineParameters::DEFAULT_INITIALIZER_NUM_QUEUES = 1;
+
+const char CommandLineParameters::DEFAULT_INITIALIZER_CAPTURE_FILE[] = "";
+
+const double CommandLineParameters::DEFAULT_INITIALIZER_REPLAY_SPEED = 1.0;
+
+const int CommandLineParameters::DEFAULT_INITIALIZER_NUM_POSTING_THREADS = 1;
+
 const bdlat_AttributeInfo CommandLineParameters::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_MODE,
      "mode",
@@ -4529,14 +4537,34 @@ const bdlat_AttributeInfo CommandLineParameters::ATTRIBUTE_INFO_ARRAY[] = {
      "authnData",
      sizeof("authnData") - 1,
      "",
-     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_NUM_QUEUES,
+     "numQueues",
+     sizeof("numQueues") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_CAPTURE_FILE,
+     "captureFile",
+     sizeof("captureFile") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_REPLAY_SPEED,
+     "replaySpeed",
+     sizeof("replaySpeed") - 1,
+     "",
+     bdlat_FormattingMode::e_DEFAULT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_NUM_POSTING_THREADS,
+     "numPostingThreads",
+     sizeof("numPostingThreads") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 CommandLineParameters::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 31; ++i) {
+    for (int i = 0; i < 35; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             CommandLineParameters::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -4613,6 +4641,14 @@ const bdlat_AttributeInfo* CommandLineParameters::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AUTHN_MECHANISM];
     case ATTRIBUTE_ID_AUTHN_DATA:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AUTHN_DATA];
+    case ATTRIBUTE_ID_NUM_QUEUES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_QUEUES];
+    case ATTRIBUTE_ID_CAPTURE_FILE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CAPTURE_FILE];
+    case ATTRIBUTE_ID_REPLAY_SPEED:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLAY_SPEED];
+    case ATTRIBUTE_ID_NUM_POSTING_THREADS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_POSTING_THREADS];
     default: return 0;
     }
 }
@@ -4621,6 +4657,7 @@ const bdlat_AttributeInfo* CommandLineParameters::lookupAttributeInfo(int id)
 
 CommandLineParameters::CommandLineParameters(bslma::Allocator* basicAllocator)
 : d_eventSize(DEFAULT_INITIALIZER_EVENT_SIZE)
+, d_replaySpeed(DEFAULT_INITIALIZER_REPLAY_SPEED)
 , d_subscriptions(basicAllocator)
 , d_messageProperties(basicAllocator)
 , d_mode(DEFAULT_INITIALIZER_MODE, basicAllocator)
@@ -4641,6 +4678,7 @@ CommandLineParameters::CommandLineParameters(bslma::Allocator* basicAllocator)
                              basicAllocator)
 , d_authnMechanism(DEFAULT_INITIALIZER_AUTHN_MECHANISM, basicAllocator)
 , d_authnData(DEFAULT_INITIALIZER_AUTHN_DATA, basicAllocator)
+, d_captureFile(DEFAULT_INITIALIZER_CAPTURE_FILE, basicAllocator)
 , d_msgSize(DEFAULT_INITIALIZER_MSG_SIZE)
 , d_postRate(DEFAULT_INITIALIZER_POST_RATE)
 , d_postInterval(DEFAULT_INITIALIZER_POST_INTERVAL)
@@ -4648,6 +4686,8 @@ CommandLineParameters::CommandLineParameters(bslma::Allocator* basicAllocator)
 , d_shutdownGrace(DEFAULT_INITIALIZER_SHUTDOWN_GRACE)
 , d_autoPubSubModulo(DEFAULT_INITIALIZER_AUTO_PUB_SUB_MODULO)
 , d_timeoutSec(DEFAULT_INITIALIZER_TIMEOUT_SEC)
+, d_numQueues(DEFAULT_INITIALIZER_NUM_QUEUES)
+, d_numPostingThreads(DEFAULT_INITIALIZER_NUM_POSTING_THREADS)
 , d_dumpMsg(DEFAULT_INITIALIZER_DUMP_MSG)
 , d_confirmMsg(DEFAULT_INITIALIZER_CONFIRM_MSG)
 , d_memoryDebug(DEFAULT_INITIALIZER_MEMORY_DEBUG)
@@ -4659,6 +4699,7 @@ CommandLineParameters::CommandLineParameters(
     const CommandLineParameters& original,
     bslma::Allocator*            basicAllocator)
 : d_eventSize(original.d_eventSize)
+, d_replaySpeed(original.d_replaySpeed)
 , d_subscriptions(original.d_subscriptions, basicAllocator)
 , d_messageProperties(original.d_messageProperties, basicAllocator)
 , d_mode(original.d_mode, basicAllocator)
@@ -4679,6 +4720,7 @@ CommandLineParameters::CommandLineParameters(
                              basicAllocator)
 , d_authnMechanism(original.d_authnMechanism, basicAllocator)
 , d_authnData(original.d_authnData, basicAllocator)
+, d_captureFile(original.d_captureFile, basicAllocator)
 , d_msgSize(original.d_msgSize)
 , d_postRate(original.d_postRate)
 , d_postInterval(original.d_postInterval)
@@ -4686,6 +4728,8 @@ CommandLineParameters::CommandLineParameters(
 , d_shutdownGrace(original.d_shutdownGrace)
 , d_autoPubSubModulo(original.d_autoPubSubModulo)
 , d_timeoutSec(original.d_timeoutSec)
+, d_numQueues(original.d_numQueues)
+, d_numPostingThreads(original.d_numPostingThreads)
 , d_dumpMsg(original.d_dumpMsg)
 , d_confirmMsg(original.d_confirmMsg)
 , d_memoryDebug(original.d_memoryDebug)
@@ -4698,6 +4742,7 @@ CommandLineParameters::CommandLineParameters(
 CommandLineParameters::CommandLineParameters(
     CommandLineParameters&& original) noexcept
 : d_eventSize(bsl::move(original.d_eventSize)),
+  d_replaySpeed(bsl::move(original.d_replaySpeed)),
   d_subscriptions(bsl::move(original.d_subscriptions)),
   d_messageProperties(bsl::move(original.d_messageProperties)),
   d_mode(bsl::move(original.d_mode)),
@@ -4717,6 +4762,7 @@ CommandLineParameters::CommandLineParameters(
   d_sequentialMessagePattern(bsl::move(original.d_sequentialMessagePattern)),
   d_authnMechanism(bsl::move(original.d_authnMechanism)),
   d_authnData(bsl::move(original.d_authnData)),
+  d_captureFile(bsl::move(original.d_captureFile)),
   d_msgSize(bsl::move(original.d_msgSize)),
   d_postRate(bsl::move(original.d_postRate)),
   d_postInterval(bsl::move(original.d_postInterval)),
@@ -4724,6 +4770,8 @@ CommandLineParameters::CommandLineParameters(
   d_shutdownGrace(bsl::move(original.d_shutdownGrace)),
   d_autoPubSubModulo(bsl::move(original.d_autoPubSubModulo)),
   d_timeoutSec(bsl::move(original.d_timeoutSec)),
+  d_numQueues(bsl::move(original.d_numQueues)),
+  d_numPostingThreads(bsl::move(original.d_numPostingThreads)),
   d_dumpMsg(bsl::move(original.d_dumpMsg)),
   d_confirmMsg(bsl::move(original.d_confirmMsg)),
   d_memoryDebug(bsl::move(original.d_memoryDebug)),
@@ -4734,6 +4782,7 @@ CommandLineParameters::CommandLineParameters(
 CommandLineParameters::CommandLineParameters(CommandLineParameters&& original,
                                              bslma::Allocator* basicAllocator)
 : d_eventSize(bsl::move(original.d_eventSize))
+, d_replaySpeed(bsl::move(original.d_replaySpeed))
 , d_subscriptions(bsl::move(original.d_subscriptions), basicAllocator)
 , d_messageProperties(bsl::move(original.d_messageProperties), basicAllocator)
 , d_mode(bsl::move(original.d_mode), basicAllocator)
@@ -4754,6 +4803,7 @@ CommandLineParameters::CommandLineParameters(CommandLineParameters&& original,
                              basicAllocator)
 , d_authnMechanism(bsl::move(original.d_authnMechanism), basicAllocator)
 , d_authnData(bsl::move(original.d_authnData), basicAllocator)
+, d_captureFile(bsl::move(original.d_captureFile), basicAllocator)
 , d_msgSize(bsl::move(original.d_msgSize))
 , d_postRate(bsl::move(original.d_postRate))
 , d_postInterval(bsl::move(original.d_postInterval))
@@ -4761,6 +4811,8 @@ CommandLineParameters::CommandLineParameters(CommandLineParameters&& original,
 , d_shutdownGrace(bsl::move(original.d_shutdownGrace))
 , d_autoPubSubModulo(bsl::move(original.d_autoPubSubModulo))
 , d_timeoutSec(bsl::move(original.d_timeoutSec))
+, d_numQueues(bsl::move(original.d_numQueues))
+, d_numPostingThreads(bsl::move(original.d_numPostingThreads))
 , d_dumpMsg(bsl::move(original.d_dumpMsg))
 , d_confirmMsg(bsl::move(original.d_confirmMsg))
 , d_memoryDebug(bsl::move(original.d_memoryDebug))
@@ -4810,6 +4862,10 @@ CommandLineParameters::operator=(const CommandLineParameters& rhs)
         d_timeoutSec               = rhs.d_timeoutSec;
         d_authnMechanism           = rhs.d_authnMechanism;
         d_authnData                = rhs.d_authnData;
+        d_numQueues                = rhs.d_numQueues;
+        d_captureFile              = rhs.d_captureFile;
+        d_replaySpeed              = rhs.d_replaySpeed;
+        d_numPostingThreads        = rhs.d_numPostingThreads;
     }
 
     return *this;
@@ -4852,6 +4908,10 @@ CommandLineParameters::operator=(CommandLineParameters&& rhs)
         d_timeoutSec               = bsl::move(rhs.d_timeoutSec);
         d_authnMechanism           = bsl::move(rhs.d_authnMechanism);
         d_authnData                = bsl::move(rhs.d_authnData);
+        d_numQueues                = bsl::move(rhs.d_numQueues);
+        d_captureFile              = bsl::move(rhs.d_captureFile);
+        d_replaySpeed              = bsl::move(rhs.d_replaySpeed);
+        d_numPostingThreads        = bsl::move(rhs.d_numPostingThreads);
     }
 
     return *this;
@@ -4888,10 +4948,14 @@ void CommandLineParameters::reset()
         DEFAULT_INITIALIZER_SEQUENTIAL_MESSAGE_PATTERN;
     bdlat_ValueTypeFunctions::reset(&d_messageProperties);
     bdlat_ValueTypeFunctions::reset(&d_subscriptions);
-    d_autoPubSubModulo = DEFAULT_INITIALIZER_AUTO_PUB_SUB_MODULO;
-    d_timeoutSec       = DEFAULT_INITIALIZER_TIMEOUT_SEC;
-    d_authnMechanism   = DEFAULT_INITIALIZER_AUTHN_MECHANISM;
-    d_authnData        = DEFAULT_INITIALIZER_AUTHN_DATA;
+    d_autoPubSubModulo  = DEFAULT_INITIALIZER_AUTO_PUB_SUB_MODULO;
+    d_timeoutSec        = DEFAULT_INITIALIZER_TIMEOUT_SEC;
+    d_authnMechanism    = DEFAULT_INITIALIZER_AUTHN_MECHANISM;
+    d_authnData         = DEFAULT_INITIALIZER_AUTHN_DATA;
+    d_numQueues         = DEFAULT_INITIALIZER_NUM_QUEUES;
+    d_captureFile       = DEFAULT_INITIALIZER_CAPTURE_FILE;
+    d_replaySpeed       = DEFAULT_INITIALIZER_REPLAY_SPEED;
+    d_numPostingThreads = DEFAULT_INITIALIZER_NUM_POSTING_THREADS;
 }
 
 // ACCESSORS
@@ -4935,6 +4999,10 @@ bsl::ostream& CommandLineParameters::print(bsl::ostream& stream,
     printer.printAttribute("timeoutSec", this->timeoutSec());
     printer.printAttribute("authnMechanism", this->authnMechanism());
     printer.printAttribute("authnData", this->authnData());
+    printer.printAttribute("numQueues", this->numQueues());
+    printer.printAttribute("captureFile", this->captureFile());
+    printer.printAttribute("replaySpeed", this->replaySpeed());
+    printer.printAttribute("numPostingThreads", this->numPostingThreads());
     printer.end();
     return stream;
 }
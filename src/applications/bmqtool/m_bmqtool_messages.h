@@ -5397,6 +5397,7 @@ class CommandLineParameters {
     // INSTANCE DATA
 
     bsls::Types::Int64           d_eventSize;
+    double                       d_replaySpeed;
     bsl::vector<Subscription>    d_subscriptions;
     bsl::vector<MessageProperty> d_messageProperties;
     bsl::string                  d_mode;
@@ -5416,6 +5417,7 @@ class CommandLineParameters {
     bsl::string                  d_sequentialMessagePattern;
     bsl::string                  d_authnMechanism;
     bsl::string                  d_authnData;
+    bsl::string                  d_captureFile;
     int                          d_msgSize;
     int                          d_postRate;
     int                          d_postInterval;
@@ -5423,6 +5425,8 @@ class CommandLineParameters {
     int                          d_shutdownGrace;
     int                          d_autoPubSubModulo;
     int                          d_timeoutSec;
+    int                          d_numQueues;
+    int                          d_numPostingThreads;
     bool                         d_dumpMsg;
     bool                         d_confirmMsg;
     bool                         d_memoryDebug;
@@ -5469,10 +5473,14 @@ class CommandLineParameters {
         ATTRIBUTE_ID_AUTO_PUB_SUB_MODULO        = 27,
         ATTRIBUTE_ID_TIMEOUT_SEC                = 28,
         ATTRIBUTE_ID_AUTHN_MECHANISM            = 29,
-        ATTRIBUTE_ID_AUTHN_DATA                 = 30
+        ATTRIBUTE_ID_AUTHN_DATA                 = 30,
+        ATTRIBUTE_ID_NUM_QUEUES                 = 31,
+        ATTRIBUTE_ID_CAPTURE_FILE               = 32,
+        ATTRIBUTE_ID_REPLAY_SPEED               = 33,
+        ATTRIBUTE_ID_NUM_POSTING_THREADS        = 34
     };
 
-    enum { NUM_ATTRIBUTES = 31 };
+    enum { NUM_ATTRIBUTES = 35 };
 
     enum {
         ATTRIBUTE_INDEX_MODE                       = 0,
@@ -5505,7 +5513,11 @@ class CommandLineParameters {
         ATTRIBUTE_INDEX_AUTO_PUB_SUB_MODULO        = 27,
         ATTRIBUTE_INDEX_TIMEOUT_SEC                = 28,
         ATTRIBUTE_INDEX_AUTHN_MECHANISM            = 29,
-        ATTRIBUTE_INDEX_AUTHN_DATA                 = 30
+        ATTRIBUTE_INDEX_AUTHN_DATA                 = 30,
+        ATTRIBUTE_INDEX_NUM_QUEUES                 = 31,
+        ATTRIBUTE_INDEX_CAPTURE_FILE               = 32,
+        ATTRIBUTE_INDEX_REPLAY_SPEED               = 33,
+        ATTRIBUTE_INDEX_NUM_POSTING_THREADS        = 34
     };
 
     // CONSTANTS
@@ -5570,6 +5582,14 @@ class CommandLineParameters {
 
     static const char DEFAULT_INITIALIZER_AUTHN_DATA[];
 
+    static const int DEFAULT_INITIALIZER_NUM_QUEUES;
+
+    static const char DEFAULT_INITIALIZER_CAPTURE_FILE[];
+
+    static const double DEFAULT_INITIALIZER_REPLAY_SPEED;
+
+    static const int DEFAULT_INITIALIZER_NUM_POSTING_THREADS;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -5787,6 +5807,22 @@ class CommandLineParameters {
     /// object.
     bsl::string& authnData();
 
+    /// Return a reference to the modifiable "NumQueues" attribute of this
+    /// object.
+    int& numQueues();
+
+    /// Return a reference to the modifiable "CaptureFile" attribute of this
+    /// object.
+    bsl::string& captureFile();
+
+    /// Return a reference to the modifiable "ReplaySpeed" attribute of this
+    /// object.
+    double& replaySpeed();
+
+    /// Return a reference to the modifiable "NumPostingThreads" attribute of
+    /// this object.
+    int& numPostingThreads();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -5944,6 +5980,19 @@ class CommandLineParameters {
     /// attribute of this object.
     const bsl::string& authnData() const;
 
+    /// Return the value of the "NumQueues" attribute of this object.
+    int numQueues() const;
+
+    /// Return a reference offering non-modifiable access to the "CaptureFile"
+    /// attribute of this object.
+    const bsl::string& captureFile() const;
+
+    /// Return the value of the "ReplaySpeed" attribute of this object.
+    double replaySpeed() const;
+
+    /// Return the value of the "NumPostingThreads" attribute of this object.
+    int numPostingThreads() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -10852,6 +10901,10 @@ void CommandLineParameters::hashAppendImpl(
     hashAppend(hashAlgorithm, this->timeoutSec());
     hashAppend(hashAlgorithm, this->authnMechanism());
     hashAppend(hashAlgorithm, this->authnData());
+    hashAppend(hashAlgorithm, this->numQueues());
+    hashAppend(hashAlgorithm, this->captureFile());
+    hashAppend(hashAlgorithm, this->replaySpeed());
+    hashAppend(hashAlgorithm, this->numPostingThreads());
 }
 
 inline bool
@@ -10886,7 +10939,11 @@ CommandLineParameters::isEqualTo(const CommandLineParameters& rhs) const
            this->autoPubSubModulo() == rhs.autoPubSubModulo() &&
            this->timeoutSec() == rhs.timeoutSec() &&
            this->authnMechanism() == rhs.authnMechanism() &&
-           this->authnData() == rhs.authnData();
+           this->authnData() == rhs.authnData() &&
+           this->numQueues() == rhs.numQueues() &&
+           this->captureFile() == rhs.captureFile() &&
+           this->replaySpeed() == rhs.replaySpeed() &&
+           this->numPostingThreads() == rhs.numPostingThreads();
 }
 
 // CLASS METHODS
@@ -11083,6 +11140,31 @@ int CommandLineParameters::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_numQueues,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_QUEUES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_captureFile,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CAPTURE_FILE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_replaySpeed,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLAY_SPEED]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_numPostingThreads,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_POSTING_THREADS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -11227,6 +11309,23 @@ int CommandLineParameters::manipulateAttribute(t_MANIPULATOR& manipulator,
         return manipulator(&d_authnData,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AUTHN_DATA]);
     }
+    case ATTRIBUTE_ID_NUM_QUEUES: {
+        return manipulator(&d_numQueues,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_QUEUES]);
+    }
+    case ATTRIBUTE_ID_CAPTURE_FILE: {
+        return manipulator(&d_captureFile,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CAPTURE_FILE]);
+    }
+    case ATTRIBUTE_ID_REPLAY_SPEED: {
+        return manipulator(&d_replaySpeed,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLAY_SPEED]);
+    }
+    case ATTRIBUTE_ID_NUM_POSTING_THREADS: {
+        return manipulator(
+            &d_numPostingThreads,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_POSTING_THREADS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -11402,6 +11501,26 @@ inline bsl::string& CommandLineParameters::authnData()
     return d_authnData;
 }
 
+inline int& CommandLineParameters::numQueues()
+{
+    return d_numQueues;
+}
+
+inline bsl::string& CommandLineParameters::captureFile()
+{
+    return d_captureFile;
+}
+
+inline double& CommandLineParameters::replaySpeed()
+{
+    return d_replaySpeed;
+}
+
+inline int& CommandLineParameters::numPostingThreads()
+{
+    return d_numPostingThreads;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int CommandLineParameters::accessAttributes(t_ACCESSOR& accessor) const
@@ -11588,6 +11707,30 @@ int CommandLineParameters::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_numQueues,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_QUEUES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_captureFile,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CAPTURE_FILE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_replaySpeed,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLAY_SPEED]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_numPostingThreads,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_POSTING_THREADS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -11723,6 +11866,23 @@ int CommandLineParameters::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_authnData,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AUTHN_DATA]);
     }
+    case ATTRIBUTE_ID_NUM_QUEUES: {
+        return accessor(d_numQueues,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_QUEUES]);
+    }
+    case ATTRIBUTE_ID_CAPTURE_FILE: {
+        return accessor(d_captureFile,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CAPTURE_FILE]);
+    }
+    case ATTRIBUTE_ID_REPLAY_SPEED: {
+        return accessor(d_replaySpeed,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_REPLAY_SPEED]);
+    }
+    case ATTRIBUTE_ID_NUM_POSTING_THREADS: {
+        return accessor(
+            d_numPostingThreads,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_POSTING_THREADS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -11901,6 +12061,26 @@ inline const bsl::string& CommandLineParameters::authnData() const
     return d_authnData;
 }
 
+inline int CommandLineParameters::numQueues() const
+{
+    return d_numQueues;
+}
+
+inline const bsl::string& CommandLineParameters::captureFile() const
+{
+    return d_captureFile;
+}
+
+inline double CommandLineParameters::replaySpeed() const
+{
+    return d_replaySpeed;
+}
+
+inline int CommandLineParameters::numPostingThreads() const
+{
+    return d_numPostingThreads;
+}
+
 // --------------------
 // class JournalCommand
 // --------------------
@@ -164,7 +164,8 @@ const char* ParametersMode::toAscii(ParametersMode::Value value)
         CASE(CLI)
         CASE(AUTO)
         CASE(STORAGE)
-        CASE(SYSCHK);
+        CASE(SYSCHK)
+        CASE(REPLAY)
     default: return "(* UNKNOWN *)";
     }
 
@@ -185,6 +186,7 @@ bool ParametersMode::fromAscii(ParametersMode::Value*   out,
     CHECKVALUE(AUTO);
     CHECKVALUE(STORAGE);
     CHECKVALUE(SYSCHK);
+    CHECKVALUE(REPLAY);
 
     // Invalid string
     return false;
@@ -199,7 +201,8 @@ bool ParametersMode::isValid(const bsl::string* str, bsl::ostream& stream)
         return true;  // RETURN
     }
 
-    stream << "Error: mode parameter must be one of [cli, auto, syschk]\n";
+    stream << "Error: mode parameter must be one of "
+           << "[cli, auto, storage, syschk, replay]\n";
     return false;
 }
 
@@ -288,6 +291,7 @@ Parameters::Parameters(bslma::Allocator* allocator)
 , d_autoIncrementedField(allocator)
 , d_authnMechanism(allocator)
 , d_authnData(allocator)
+, d_captureFile(allocator)
 {
     CommandLineParameters params(allocator);
     const bool            rc = from(bsl::cerr, params);
@@ -334,6 +338,10 @@ Parameters::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("messageProperties", d_messageProperties);
     printer.printAttribute("subscriptions", d_subscriptions);
     printer.printAttribute("timeout", d_timeout);
+    printer.printAttribute("numQueues", d_numQueues);
+    printer.printAttribute("captureFile", d_captureFile);
+    printer.printAttribute("replaySpeed", d_replaySpeed);
+    printer.printAttribute("numPostingThreads", d_numPostingThreads);
     printer.end();
 
     return stream;
@@ -414,6 +422,21 @@ bool Parameters::from(bsl::ostream&                stream,
     }
     bsls::TimeInterval timeout(params.timeoutSec(), 0);
 
+    if (params.numQueues() < 1) {
+        stream << "numQueues must be at least 1" << "\n";
+        return false;  // RETURN
+    }
+
+    if (params.numPostingThreads() < 1) {
+        stream << "numPostingThreads must be at least 1" << "\n";
+        return false;  // RETURN
+    }
+
+    if (params.replaySpeed() <= 0) {
+        stream << "replaySpeed must be strictly positive" << "\n";
+        return false;  // RETURN
+    }
+
     // Populate output parameters struct
     setVerbosity(paramVerbosity);
     setLogFormat(params.logFormat());
@@ -445,6 +468,10 @@ bool Parameters::from(bsl::ostream&                stream,
     setTimeout(timeout);
     setAuthnMechanism(params.authnMechanism());
     setAuthnData(params.authnData());
+    setNumQueues(params.numQueues());
+    setCaptureFile(params.captureFile());
+    setReplaySpeed(params.replaySpeed());
+    setNumPostingThreads(params.numPostingThreads());
 
     return true;
 }
@@ -460,15 +487,20 @@ bool Parameters::validate(bsl::string* error)
 
     if (d_queueFlags == 0 && d_mode != ParametersMode::e_CLI &&
         d_mode != ParametersMode::e_STORAGE &&
-        d_mode != ParametersMode::e_SYSCHK) {
-        ss << "QueueFlags must be specified if not in interactive, storage or "
-           << "syschk mode\n";
+        d_mode != ParametersMode::e_SYSCHK &&
+        d_mode != ParametersMode::e_REPLAY) {
+        ss << "QueueFlags must be specified if not in interactive, storage, "
+           << "syschk or replay mode\n";
     }
     if (d_queueUri.empty() && d_mode != ParametersMode::e_CLI &&
         d_mode != ParametersMode::e_STORAGE &&
-        d_mode != ParametersMode::e_SYSCHK) {
-        ss << "QueueURI must be specified if not in interactive, storage or "
-           << "syschk mode\n";
+        d_mode != ParametersMode::e_SYSCHK &&
+        d_mode != ParametersMode::e_REPLAY) {
+        ss << "QueueURI must be specified if not in interactive, storage, "
+           << "syschk or replay mode\n";
+    }
+    if (d_captureFile.empty() && d_mode == ParametersMode::e_REPLAY) {
+        ss << "CaptureFile must be specified in replay mode\n";
     }
     if (d_noSessionEventHandler && d_mode != ParametersMode::e_CLI &&
         d_mode != ParametersMode::e_STORAGE) {
@@ -100,6 +100,8 @@ struct ParametersMode {
         e_STORAGE  // Inspect storage
         ,
         e_SYSCHK  // Run in syschk mode
+        ,
+        e_REPLAY  // Replay a broker event capture
     };
 
     // CLASS METHODS
@@ -286,6 +288,23 @@ class Parameters {
     bsl::string d_authnData;
     // Authentication data/credentials string.
 
+    int d_numQueues;
+    // Number of queues opened in auto mode.  When greater than 1, queue `i`
+    // is opened with the URI `<queueUri><i>` and producers post to all of
+    // them in a round-robin fashion.
+
+    bsl::string d_captureFile;
+    // Path to the event capture file replayed in replay mode, as written by
+    // a broker configured with `TcpInterfaceConfig.eventCaptureFile`.
+
+    double d_replaySpeed;
+    // Speed factor applied to the inter-event delays of the capture in
+    // replay mode: 1.0 replays in real time, 2.0 twice as fast, etc.
+
+    int d_numPostingThreads;
+    // Number of producer threads in auto mode.  Queue `i` is served by
+    // thread `i % numPostingThreads`, so that threads never share a queue.
+
   public:
     // CREATORS
 
@@ -325,6 +344,10 @@ class Parameters {
     Parameters& setTimeout(const bsls::TimeInterval& value);
     Parameters& setAuthnMechanism(const bsl::string& value);
     Parameters& setAuthnData(const bsl::string& value);
+    Parameters& setNumQueues(int value);
+    Parameters& setNumPostingThreads(int value);
+    Parameters& setCaptureFile(const bsl::string& value);
+    Parameters& setReplaySpeed(double value);
 
     // Set the corresponding member to the specified 'value' and return a
     // reference offering modifiable access to this object.
@@ -387,6 +410,10 @@ class Parameters {
     const bsls::TimeInterval&           timeout() const;
     const bsl::string&                  authnMechanism() const;
     const bsl::string&                  authnData() const;
+    int                                 numQueues() const;
+    int                                 numPostingThreads() const;
+    const bsl::string&                  captureFile() const;
+    double                              replaySpeed() const;
 
     const char* autoPubSubPropertyName() const;
 };
@@ -624,6 +651,30 @@ inline Parameters& Parameters::setAuthnData(const bsl::string& value)
     return *this;
 }
 
+inline Parameters& Parameters::setNumQueues(int value)
+{
+    d_numQueues = value;
+    return *this;
+}
+
+inline Parameters& Parameters::setNumPostingThreads(int value)
+{
+    d_numPostingThreads = value;
+    return *this;
+}
+
+inline Parameters& Parameters::setCaptureFile(const bsl::string& value)
+{
+    d_captureFile = value;
+    return *this;
+}
+
+inline Parameters& Parameters::setReplaySpeed(double value)
+{
+    d_replaySpeed = value;
+    return *this;
+}
+
 // ACCESSORS
 inline ParametersMode::Value Parameters::mode() const
 {
@@ -791,6 +842,26 @@ inline const bsl::string& Parameters::authnData() const
     return d_authnData;
 }
 
+inline int Parameters::numQueues() const
+{
+    return d_numQueues;
+}
+
+inline int Parameters::numPostingThreads() const
+{
+    return d_numPostingThreads;
+}
+
+inline const bsl::string& Parameters::captureFile() const
+{
+    return d_captureFile;
+}
+
+inline double Parameters::replaySpeed() const
+{
+    return d_replaySpeed;
+}
+
 }  // close package namespace
 
 // --------------------------
@@ -0,0 +1,449 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <m_bmqtool_replayer.h>
+
+// MQB
+#include <mqbnet_eventcapture.h>
+
+// BMQ
+#include <bmqimp_negotiatedchannelfactory.h>
+#include <bmqio_channelutil.h>
+#include <bmqio_connectoptions.h>
+#include <bmqio_ntcchannelfactory.h>
+#include <bmqio_tcpendpoint.h>
+#include <bmqp_ctrlmsg_messages.h>
+#include <bmqp_event.h>
+#include <bmqp_heartbeatmonitor.h>
+#include <bmqp_protocol.h>
+#include <bmqscm_version.h>
+#include <bmqu_memoutstream.h>
+
+// BDE
+#include <ball_log.h>
+#include <ball_loggermanager.h>
+#include <ball_loggermanagerconfiguration.h>
+#include <ball_streamobserver.h>
+#include <bdlbb_blob.h>
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bdls_processutil.h>
+#include <bsl_algorithm.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_threadutil.h>
+#include <bsls_assert.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+// NTF
+#include <ntca_interfaceconfig.h>
+
+namespace BloombergLP {
+namespace m_bmqtool {
+
+namespace {
+
+BALL_LOG_SET_NAMESPACE_CATEGORY("BMQTOOL.REPLAYER");
+
+const int k_BLOB_BUFFER_SIZE = 4 * 1024;
+
+/// Delay between two attempts to write an event to a channel being above
+/// its high watermark.
+const int k_WRITE_RETRY_DELAY_US = 1000;
+
+/// Return the negotiation message identifying this process as a client.
+bmqp_ctrlmsg::NegotiationMessage makeNegotiationMessage()
+{
+    bmqp_ctrlmsg::NegotiationMessage negotiationMessage;
+    bmqp_ctrlmsg::ClientIdentity& ci = negotiationMessage.makeClientIdentity();
+
+    bsl::string features;
+    features.append(bmqp::EncodingFeature::k_FIELD_NAME)
+        .append(":")
+        .append(bmqp::EncodingFeature::k_ENCODING_BER)
+        .append(",")
+        .append(bmqp::EncodingFeature::k_ENCODING_JSON)
+        .append(";")
+        .append(bmqp::MessagePropertiesFeatures::k_FIELD_NAME)
+        .append(":")
+        .append(bmqp::MessagePropertiesFeatures::k_MESSAGE_PROPERTIES_EX)
+        .append(";")
+        .append(bmqp::CompressionFeatures::k_FIELD_NAME)
+        .append(":")
+        .append(bmqp::CompressionFeatures::k_LZ4)
+        .append(",")
+        .append(bmqp::CompressionFeatures::k_ZSTD);
+
+    ci.protocolVersion() = bmqp::Protocol::k_VERSION;
+    ci.sdkVersion()      = bmqscm::Version::versionAsInt();
+    ci.clientType()      = bmqp_ctrlmsg::ClientType::E_TCPCLIENT;
+    ci.pid()             = bdls::ProcessUtil::getProcessId();
+    ci.sessionId()       = 1;
+    ci.hostName()        = "";  // The broker resolves it from the channel
+    ci.features()        = features;
+    if (bdls::ProcessUtil::getProcessName(&ci.processName()) != 0) {
+        ci.processName() = "* unknown *";
+    }
+    ci.sdkLanguage() = bmqp_ctrlmsg::ClientLanguage::E_CPP;
+    ci.userAgent()   = bsl::string("bmqtool-replay libbmq:") +
+                     bmqscm::Version::s_versionDotString;
+
+    return negotiationMessage;
+}
+
+/// Create the ntca::InterfaceConfig to use for a replay opening the
+/// specified `numChannels` channels.  Use the specified `allocator` for
+/// any memory allocation.
+ntca::InterfaceConfig makeInterfaceConfig(int               numChannels,
+                                          bslma::Allocator* allocator)
+{
+    ntca::InterfaceConfig config(allocator);
+
+    config.setThreadName("bmqtool");
+
+    config.setMaxThreads(1);
+    config.setMaxConnections(bsl::max(numChannels, 1));
+    config.setWriteQueueLowWatermark(512 * 1024);
+    config.setWriteQueueHighWatermark(128 * 1024 * 1024);
+
+    config.setDriverMetrics(false);
+    config.setDriverMetricsPerWaiter(false);
+    config.setSocketMetrics(false);
+    config.setSocketMetricsPerHandle(false);
+
+    config.setAcceptGreedily(false);
+    config.setSendGreedily(false);
+    config.setReceiveGreedily(false);
+
+    config.setNoDelay(true);
+    config.setKeepAlive(true);
+    config.setKeepHalfOpen(false);
+
+    return config;
+}
+
+}  // close unnamed namespace
+
+// --------------
+// class Replayer
+// --------------
+
+// PRIVATE MANIPULATORS
+void Replayer::onChannelResult(
+    int                                    channelId,
+    bmqio::ChannelFactoryEvent::Enum       event,
+    const bmqio::Status&                   status,
+    const bsl::shared_ptr<bmqio::Channel>& channel)
+{
+    // executed by one of the *IO* threads
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    if (event == bmqio::ChannelFactoryEvent::e_CHANNEL_UP) {
+        d_channels[channelId] = channel;
+    }
+    else {
+        BALL_LOG_ERROR << "Failed to connect channel for captured channel "
+                       << channelId << " [event: " << event
+                       << ", status: " << status << "]";
+        d_connectFailed = true;
+    }
+
+    --d_numPendingConnections;
+    d_condition.broadcast();
+}
+
+void Replayer::readCb(bmqio::Channel*      channel,
+                      const bmqio::Status& status,
+                      int*                 numNeeded,
+                      bdlbb::Blob*         blob)
+{
+    // executed by the *IO* thread
+
+    if (!status) {
+        // Channel is being closed
+        return;  // RETURN
+    }
+
+    const bsl::shared_ptr<bdlbb::Blob> readBlob =
+        d_blobSpPool_sp->getObject();
+
+    const int rc = bmqio::ChannelUtil::handleRead(readBlob.get(),
+                                                  numNeeded,
+                                                  blob);
+    if (rc != 0) {
+        BALL_LOG_ERROR << channel->peerUri()
+                       << ": ReadCallback unrecoverable error [rc: " << rc
+                       << "]";
+        channel->close();
+        return;  // RETURN
+    }
+
+    if (readBlob->length() == 0) {
+        // Don't yet have a full blob
+        return;  // RETURN
+    }
+
+    // Only heartbeat requests need an answer for the broker to keep the
+    // channel; the responses to the replayed requests are of no interest.
+    bmqp::Event event(readBlob.get(), d_allocator_p);
+    if (event.isHeartbeatReqEvent()) {
+        bmqio::Status writeStatus;
+        channel->write(&writeStatus,
+                       bmqp::HeartbeatMonitor::heartbeatRspBlob());
+    }
+}
+
+// CREATORS
+Replayer::Replayer(const Parameters& parameters, bslma::Allocator* allocator)
+: d_allocator_p(bslma::Default::allocator(allocator))
+, d_parameters(parameters)
+, d_bufferFactory(k_BLOB_BUFFER_SIZE, d_allocator_p)
+, d_blobSpPool_sp(
+      bmqp::BlobPoolUtil::createBlobPool(&d_bufferFactory, d_allocator_p))
+, d_mutex()
+, d_condition()
+, d_channels(d_allocator_p)
+, d_numPendingConnections(0)
+, d_connectFailed(false)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+int Replayer::run()
+{
+    // Setup logging
+    ball::StreamObserver             observer(&bsl::cout);
+    ball::LoggerManagerConfiguration configuration;
+    configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_INFO);
+
+    ball::LoggerManagerScopedGuard guard(&observer, configuration);
+
+    // 1. Collect the captured channels, validating the whole capture
+    bsl::ifstream file(d_parameters.captureFile().c_str(),
+                       bsl::ios::in | bsl::ios::binary);
+    if (!file) {
+        BALL_LOG_ERROR << "Failed to open capture file '"
+                       << d_parameters.captureFile() << "'";
+        return 1;  // RETURN
+    }
+
+    bsl::vector<int>   channelIds(d_allocator_p);
+    bsls::Types::Int64 numRecords = 0;
+    {
+        mqbnet::EventCaptureReader reader(&file, d_allocator_p);
+        int                        channelId   = 0;
+        bsls::Types::Int64         timestampNs = 0;
+        bdlbb::Blob                event(&d_bufferFactory, d_allocator_p);
+        int                        rc          = 0;
+        while ((rc = reader.next(&channelId, &timestampNs, &event)) == 1) {
+            if (bsl::find(channelIds.begin(), channelIds.end(), channelId) ==
+                channelIds.end()) {
+                channelIds.push_back(channelId);
+            }
+            ++numRecords;
+            event.removeAll();
+        }
+        if (rc != 0) {
+            BALL_LOG_ERROR << "Invalid capture file '"
+                           << d_parameters.captureFile() << "' after "
+                           << numRecords << " records [rc: " << rc << "]";
+            return 1;  // RETURN
+        }
+    }
+
+    BALL_LOG_INFO << "Replaying " << numRecords << " events of "
+                  << channelIds.size() << " channels from '"
+                  << d_parameters.captureFile() << "' to "
+                  << d_parameters.broker() << " at speed "
+                  << d_parameters.replaySpeed();
+
+    // 2. Connect and negotiate one channel per captured channel
+    bmqio::TCPEndpoint endpoint(d_parameters.broker(), d_allocator_p);
+    if (!endpoint) {
+        BALL_LOG_ERROR << "Invalid broker URI '" << d_parameters.broker()
+                       << "'";
+        return 1;  // RETURN
+    }
+
+    bmqu::MemOutStream out(d_allocator_p);
+    out << endpoint.host() << ":" << endpoint.port();
+
+    bmqio::NtcChannelFactory ntcFactory(
+        makeInterfaceConfig(static_cast<int>(channelIds.size()),
+                            d_allocator_p),
+        &d_bufferFactory,
+        d_allocator_p);
+    bmqimp::NegotiatedChannelFactory factory(
+        bmqimp::NegotiatedChannelFactoryConfig(&ntcFactory,
+                                               makeNegotiationMessage(),
+                                               d_parameters.timeout(),
+                                               d_blobSpPool_sp.get(),
+                                               d_allocator_p),
+        d_allocator_p);
+
+    int rc = factory.start();
+    if (rc != 0) {
+        BALL_LOG_ERROR << "Failed to start channel factory [rc: " << rc
+                       << "]";
+        return 1;  // RETURN
+    }
+
+    bmqio::ConnectOptions options(d_allocator_p);
+    options.setEndpoint(out.str()).setNumAttempts(1).setAutoReconnect(false);
+
+    bsl::vector<bslma::ManagedPtr<bmqio::ChannelFactory::OpHandle> > handles(
+        channelIds.size(),
+        d_allocator_p);
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);  // LOCK
+        d_numPendingConnections = static_cast<int>(channelIds.size());
+    }
+
+    for (size_t i = 0; i < channelIds.size(); ++i) {
+        bmqio::Status status(d_allocator_p);
+        factory.connect(&status,
+                        &handles[i],
+                        options,
+                        bdlf::BindUtil::bind(&Replayer::onChannelResult,
+                                             this,
+                                             channelIds[i],
+                                             bdlf::PlaceHolders::_1,
+                                             bdlf::PlaceHolders::_2,
+                                             bdlf::PlaceHolders::_3));
+        if (!status) {
+            BALL_LOG_ERROR << "Failed to connect to " << out.str()
+                           << " [status: " << status << "]";
+
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);  // LOCK
+            d_numPendingConnections -= static_cast<int>(channelIds.size() -
+                                                        i);
+            d_connectFailed = true;
+            break;  // BREAK
+        }
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);  // LOCK
+        while (d_numPendingConnections != 0) {
+            d_condition.wait(&d_mutex);
+        }
+    }
+
+    bool failed = d_connectFailed;
+
+    for (ChannelMap::iterator it = d_channels.begin();
+         !failed && it != d_channels.end();
+         ++it) {
+        bmqio::Status status(d_allocator_p);
+        it->second->read(&status,
+                         bmqp::Protocol::k_PACKET_MIN_SIZE,
+                         bdlf::BindUtil::bind(&Replayer::readCb,
+                                              this,
+                                              it->second.get(),
+                                              bdlf::PlaceHolders::_1,
+                                              bdlf::PlaceHolders::_2,
+                                              bdlf::PlaceHolders::_3));
+        if (!status) {
+            BALL_LOG_ERROR << "Could not read from channel "
+                           << it->second->peerUri() << " [status: " << status
+                           << "]";
+            failed = true;
+        }
+    }
+
+    // 3. Replay the records, honoring their relative timestamps
+    bsls::Types::Int64       numEvents = 0;
+    bsls::Types::Int64       numBytes  = 0;
+    bsls::Types::Int64       maxLagNs  = 0;
+    bsls::Types::Int64       firstTs   = 0;
+    const bsls::Types::Int64 startNs   = bsls::TimeUtil::getTimer();
+
+    file.clear();
+    file.seekg(0);
+    mqbnet::EventCaptureReader reader(&file, d_allocator_p);
+    int                        channelId   = 0;
+    bsls::Types::Int64         timestampNs = 0;
+    bdlbb::Blob                event(&d_bufferFactory, d_allocator_p);
+
+    while (!failed && reader.next(&channelId, &timestampNs, &event) == 1) {
+        if (numEvents == 0) {
+            firstTs = timestampNs;
+        }
+
+        const bsls::Types::Int64 targetNs =
+            startNs + static_cast<bsls::Types::Int64>(
+                          static_cast<double>(timestampNs - firstTs) /
+                          d_parameters.replaySpeed());
+        const bsls::Types::Int64 nowNs = bsls::TimeUtil::getTimer();
+        if (targetNs > nowNs) {
+            bslmt::ThreadUtil::microSleep(
+                static_cast<int>((targetNs - nowNs) / 1000));
+        }
+        else {
+            maxLagNs = bsl::max(maxLagNs, nowNs - targetNs);
+        }
+
+        bmqio::Channel* channel = d_channels[channelId].get();
+        BSLS_ASSERT_SAFE(channel);
+
+        bmqio::Status status(d_allocator_p);
+        channel->write(&status, event);
+        while (status.category() == bmqio::StatusCategory::e_LIMIT) {
+            bslmt::ThreadUtil::microSleep(k_WRITE_RETRY_DELAY_US);
+            status.reset();
+            channel->write(&status, event);
+        }
+        if (!status) {
+            BALL_LOG_ERROR << "Failed to write event " << numEvents
+                           << " to " << channel->peerUri()
+                           << " [status: " << status << "]";
+            failed = true;
+        }
+        else {
+            ++numEvents;
+            numBytes += event.length();
+        }
+        event.removeAll();
+    }
+
+    const bsls::Types::Int64 durationNs = bsls::TimeUtil::getTimer() -
+                                          startNs;
+
+    BALL_LOG_INFO << "Replayed " << numEvents << " / " << numRecords
+                  << " events (" << numBytes << " bytes) in "
+                  << bsls::TimeInterval().addNanoseconds(durationNs)
+                  << ", max lag "
+                  << bsls::TimeInterval().addNanoseconds(maxLagNs);
+
+    // 4. Close the channels
+    for (ChannelMap::iterator it = d_channels.begin(); it != d_channels.end();
+         ++it) {
+        it->second->close();
+    }
+    d_channels.clear();
+    factory.stop();
+
+    return failed ? 2 : 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
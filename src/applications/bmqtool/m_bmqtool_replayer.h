@@ -0,0 +1,135 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_M_BMQTOOL_REPLAYER
+#define INCLUDED_M_BMQTOOL_REPLAYER
+
+//@PURPOSE: Provide a mechanism to replay a broker event capture.
+//
+//@CLASSES:
+//  m_bmqtool::Replayer: replays a capture against a broker
+//
+//@DESCRIPTION: 'm_bmqtool::Replayer' reads a capture written by a broker
+// configured with a non-empty 'TcpInterfaceConfig.eventCaptureFile' (see
+// 'mqbnet_eventcapture') and sends its events again to a broker.  One channel
+// is opened and negotiated as a client for each distinct channel captured,
+// and each event is written to the channel of its record when the elapsed
+// time since the first record, divided by the replay speed, is reached.
+// Heartbeat requests received from the broker are answered; any other event
+// received is dropped.
+//
+// Note that since a capture only contains what the clients sent after
+// negotiation, the replayed clients are identified by this process, not by
+// the original ones.  Also note that the replayed PUT messages carry their
+// original GUIDs; the capture should therefore be replayed against a broker
+// which has not seen them, typically a freshly started lab broker.
+
+// BMQTOOL
+#include <m_bmqtool_parameters.h>
+
+// BMQ
+#include <bmqio_channel.h>
+#include <bmqio_channelfactory.h>
+#include <bmqio_status.h>
+#include <bmqp_blobpoolutil.h>
+
+// BDE
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_map.h>
+#include <bsl_memory.h>
+#include <bslma_allocator.h>
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bsls_keyword.h>
+
+namespace BloombergLP {
+namespace m_bmqtool {
+
+// ==============
+// class Replayer
+// ==============
+
+/// Mechanism replaying a broker event capture.
+class Replayer {
+  private:
+    // PRIVATE TYPES
+    typedef bsl::map<int, bsl::shared_ptr<bmqio::Channel> > ChannelMap;
+
+    // DATA
+    bslma::Allocator* d_allocator_p;
+
+    const Parameters& d_parameters;
+
+    bdlbb::PooledBlobBufferFactory d_bufferFactory;
+
+    bmqp::BlobPoolUtil::BlobSpPoolSp d_blobSpPool_sp;
+
+    bslmt::Mutex d_mutex;
+    // Mutex protecting the members below, updated from the IO threads.
+
+    bslmt::Condition d_condition;
+    // Condition signaled every time a connection attempt completes.
+
+    ChannelMap d_channels;
+    // Channel to the broker, by captured channel id.
+
+    int d_numPendingConnections;
+    // Number of connection attempts not completed yet.
+
+    bool d_connectFailed;
+    // Whether any connection attempt failed.
+
+  private:
+    // NOT IMPLEMENTED
+    Replayer(const Replayer&) BSLS_KEYWORD_DELETED;
+    Replayer& operator=(const Replayer&) BSLS_KEYWORD_DELETED;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Callback invoked with the specified `event`, `status` and `channel`
+    /// when the connection attempt for the specified captured `channelId`
+    /// completes.
+    void onChannelResult(int                                    channelId,
+                         bmqio::ChannelFactoryEvent::Enum       event,
+                         const bmqio::Status&                   status,
+                         const bsl::shared_ptr<bmqio::Channel>& channel);
+
+    /// Callback invoked when data with the specified `status`, `numNeeded`
+    /// and `blob` is read from the specified `channel`.
+    void readCb(bmqio::Channel*      channel,
+                const bmqio::Status& status,
+                int*                 numNeeded,
+                bdlbb::Blob*         blob);
+
+  public:
+    // CREATORS
+
+    /// Create a `Replayer` object replaying the capture described by the
+    /// specified `parameters`, using the specified `allocator`.
+    Replayer(const Parameters& parameters, bslma::Allocator* allocator);
+
+    // MANIPULATORS
+
+    /// Replay the capture and return 0 on success, or a non-zero value if
+    /// the capture could not be read, a connection could not be established
+    /// or an event could not be written.
+    int run();
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -266,6 +266,16 @@ Event AbstractSession::nextEvent(
     return Event();
 }
 
+int AbstractSession::tryNextEvent(
+    BSLA_MAYBE_UNUSED bsl::vector<Event>* events,
+    BSLA_MAYBE_UNUSED int                 maxEvents)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(false && "Method is undefined in base protocol");
+
+    return 0;
+}
+
 int AbstractSession::post(BSLA_MAYBE_UNUSED const MessageEvent& event)
 {
     // PRECONDITIONS
@@ -300,6 +310,14 @@ int AbstractSession::confirmMessages(
     return -1;
 }
 
+int AbstractSession::flushConfirms()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(false && "Method is undefined in base protocol");
+
+    return -1;
+}
+
 /// Debugging related
 ///-----------------
 int AbstractSession::configureMessageDumping(
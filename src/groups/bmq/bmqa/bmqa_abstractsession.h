@@ -35,6 +35,7 @@
 
 // BDE
 #include <bsl_functional.h>
+#include <bsl_vector.h>
 #include <bsls_timeinterval.h>
 #include <bsls_types.h>
 
@@ -361,6 +362,15 @@ class AbstractSession {
     virtual Event
     nextEvent(const bsls::TimeInterval& timeout = bsls::TimeInterval());
 
+    /// Append to the specified `events` up to the specified `maxEvents`
+    /// events available for this session, without blocking, and return the
+    /// number of appended events, which is 0 if no event is available.  The
+    /// DISCONNECTED session event, if appended, is the last appended event.
+    /// Note that this method can only be used if the session is in
+    /// synchronous mode (ie not using the EventHandler).  The behavior is
+    /// undefined unless the session was started, and `0 < maxEvents`.
+    virtual int tryNextEvent(bsl::vector<Event>* events, int maxEvents);
+
     /// Asynchronously post the specified `event` that must contain one or
     /// more `Messages`.  The return value is one of the values defined in
     /// the `bmqt::PostResult::Enum` enum.  Return zero on success and a
@@ -400,6 +410,13 @@ class AbstractSession {
     /// broker.  Behavior is undefined unless `builder` is non-null.
     virtual int confirmMessages(ConfirmEventBuilder* builder);
 
+    /// Asynchronously send to the broker the confirmations held by the
+    /// session for batching, if any, without waiting for the batch to fill
+    /// or for its linger time to elapse.  Return 0 on success, and a
+    /// non-zero value otherwise.  Note that this method has no effect
+    /// unless confirm batching was enabled in the session options.
+    virtual int flushConfirms();
+
     /// Debugging related
     ///-----------------
 
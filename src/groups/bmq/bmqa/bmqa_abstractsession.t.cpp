@@ -16,6 +16,7 @@
 #include <bmqa_abstractsession.h>
 
 // BDE
+#include <bsl_vector.h>
 #include <bsls_platform.h>
 #include <bsls_protocoltest.h>
 
@@ -208,6 +209,12 @@ struct AbstractSessionTestImp : bsls::ProtocolTestImp<bmqa::AbstractSession> {
         return markDone();
     }
 
+    int tryNextEvent(bsl::vector<bmqa::Event>* events,
+                     int                       maxEvents) BSLS_KEYWORD_OVERRIDE
+    {
+        return markDone();
+    }
+
     int post(const bmqa::MessageEvent& event) BSLS_KEYWORD_OVERRIDE
     {
         return markDone();
@@ -230,6 +237,8 @@ struct AbstractSessionTestImp : bsls::ProtocolTestImp<bmqa::AbstractSession> {
         return markDone();
     }
 
+    int flushConfirms() BSLS_KEYWORD_OVERRIDE { return markDone(); }
+
     int configureMessageDumping(const bslstl::StringRef& command)
         BSLS_KEYWORD_OVERRIDE
     {
@@ -316,6 +325,7 @@ static void test1_breathingTest()
     PV("Verify that methods are public and virtual");
 
     bmqa::ConfirmEventBuilder*      dummyConfirmEventBuilderPtr = 0;
+    bsl::vector<bmqa::Event>*       dummyEventsPtr              = 0;
     bmqa::Message                   dummyMessage;
     bmqa::MessageConfirmationCookie dummyMessageConfirmationCookie;
     bmqa::MessageEvent              dummyMessageEvent;
@@ -401,12 +411,14 @@ static void test1_breathingTest()
                                              closeQueueCallback,
                                              dummyTimeInterval));
     BSLS_PROTOCOLTEST_ASSERT(testObj, nextEvent(dummyTimeInterval));
+    BSLS_PROTOCOLTEST_ASSERT(testObj, tryNextEvent(dummyEventsPtr, 1));
     BSLS_PROTOCOLTEST_ASSERT(testObj, post(dummyMessageEvent));
     BSLS_PROTOCOLTEST_ASSERT(testObj, confirmMessage(dummyMessage));
     BSLS_PROTOCOLTEST_ASSERT(testObj,
                              confirmMessage(dummyMessageConfirmationCookie));
     BSLS_PROTOCOLTEST_ASSERT(testObj,
                              confirmMessages(dummyConfirmEventBuilderPtr));
+    BSLS_PROTOCOLTEST_ASSERT(testObj, flushConfirms());
     BSLS_PROTOCOLTEST_ASSERT(testObj, configureMessageDumping(""));
 }
 
@@ -452,6 +464,7 @@ static void test2_instanceInvariants()
     PV("Verify that non-overridden methods fire an assert");
 
     bmqa::ConfirmEventBuilder*      dummyConfirmEventBuilderPtr = 0;
+    bsl::vector<bmqa::Event>*       dummyEventsPtr              = 0;
     bmqa::Message                   dummyMessage;
     bmqa::MessageConfirmationCookie dummyMessageConfirmationCookie;
     bmqa::MessageEvent              dummyMessageEvent;
@@ -527,12 +540,14 @@ static void test2_instanceInvariants()
                                                        closeQueueCallback,
                                                        dummyTimeInterval));
     BMQTST_ASSERT_OPT_FAIL(concreteObj.nextEvent(dummyTimeInterval));
+    BMQTST_ASSERT_OPT_FAIL(concreteObj.tryNextEvent(dummyEventsPtr, 1));
     BMQTST_ASSERT_OPT_FAIL(concreteObj.post(dummyMessageEvent));
     BMQTST_ASSERT_OPT_FAIL(concreteObj.confirmMessage(dummyMessage));
     BMQTST_ASSERT_OPT_FAIL(
         concreteObj.confirmMessage(dummyMessageConfirmationCookie));
     BMQTST_ASSERT_OPT_FAIL(
         concreteObj.confirmMessages(dummyConfirmEventBuilderPtr));
+    BMQTST_ASSERT_OPT_FAIL(concreteObj.flushConfirms());
     BMQTST_ASSERT_OPT_FAIL(concreteObj.configureMessageDumping(""));
 
     // Derived instance
@@ -594,12 +609,14 @@ static void test2_instanceInvariants()
                                                    closeQueueCallback,
                                                    dummyTimeInterval));
     BMQTST_ASSERT_OPT_FAIL(testObj.nextEvent(dummyTimeInterval));
+    BMQTST_ASSERT_OPT_FAIL(testObj.tryNextEvent(dummyEventsPtr, 1));
     BMQTST_ASSERT_OPT_FAIL(testObj.post(dummyMessageEvent));
     BMQTST_ASSERT_OPT_FAIL(testObj.confirmMessage(dummyMessage));
     BMQTST_ASSERT_OPT_FAIL(
         testObj.confirmMessage(dummyMessageConfirmationCookie));
     BMQTST_ASSERT_OPT_FAIL(
         testObj.confirmMessages(dummyConfirmEventBuilderPtr));
+    BMQTST_ASSERT_OPT_FAIL(testObj.flushConfirms());
 
     PV("Verify that overridden methods execute as intended");
 
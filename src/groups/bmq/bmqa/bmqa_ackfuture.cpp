@@ -0,0 +1,161 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqa_ackfuture.h>
+
+#include <bmqscm_version.h>
+// BMQ
+#include <bmqa_message.h>
+#include <bmqa_messageiterator.h>
+#include <bmqt_messageeventtype.h>
+#include <bmqu_time.h>
+
+// BDE
+#include <bslmt_lockguard.h>
+#include <bsls_systemclocktype.h>
+
+namespace BloombergLP {
+namespace bmqa {
+
+// ----------------------
+// struct AckFuture_State
+// ----------------------
+
+// PUBLIC CONSTANTS
+const int AckFuture_State::k_PENDING;
+
+// ---------------------
+// class AckFutureSource
+// ---------------------
+
+// PRIVATE MANIPULATORS
+void AckFutureSource::release(AckFuture_State* state)
+{
+    if (--state->d_refCount != 0) {
+        return;  // RETURN
+    }
+
+    state->~AckFuture_State();
+    d_pool.deallocate(state);
+}
+
+void AckFutureSource::resolve(AckFuture_State*         state,
+                              bmqt::AckResult::Enum    status,
+                              const bmqt::MessageGUID& guid)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(state->d_source_p == this);
+    BSLS_ASSERT_SAFE(state->d_status.load() == AckFuture_State::k_PENDING);
+
+    state->d_guid = guid;
+    state->d_status.storeRelease(status);
+
+    release(state);
+}
+
+void AckFutureSource::notify()
+{
+    // Taking the mutex guarantees that a waiter which observed a pending
+    // state is already blocked on the condition.
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+    d_condition.broadcast();
+}
+
+// PRIVATE ACCESSORS
+int AckFutureSource::wait(const AckFuture_State&    state,
+                          const bsls::TimeInterval& timeout) const
+{
+    const bool               hasTimeout = timeout != bsls::TimeInterval();
+    const bsls::TimeInterval expireAfter =
+        hasTimeout ? bmqu::Time::nowMonotonicClock() + timeout
+                   : bsls::TimeInterval();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+    while (state.d_status.loadAcquire() == AckFuture_State::k_PENDING) {
+        if (!hasTimeout) {
+            d_condition.wait(&d_mutex);
+            continue;  // CONTINUE
+        }
+
+        const int rc = d_condition.timedWait(&d_mutex, expireAfter);
+        if (rc == -1 &&
+            state.d_status.loadAcquire() == AckFuture_State::k_PENDING) {
+            return -1;  // RETURN
+        }
+    }
+
+    return 0;
+}
+
+// CREATORS
+AckFutureSource::AckFutureSource(bslma::Allocator* basicAllocator)
+: d_pool(sizeof(AckFuture_State), basicAllocator)
+, d_mutex()
+, d_condition(bsls::SystemClockType::e_MONOTONIC)
+{
+    // NOTHING
+}
+
+AckFutureSource::~AckFutureSource()
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+AckFuture AckFutureSource::create()
+{
+    return AckFuture(new (d_pool.allocate()) AckFuture_State(this));
+}
+
+int AckFutureSource::complete(const MessageEvent& event)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(event.type() == bmqt::MessageEventType::e_ACK);
+
+    int             numCompleted = 0;
+    MessageIterator it           = event.messageIterator();
+    while (it.nextMessage()) {
+        const Message&             message       = it.message();
+        const bmqt::CorrelationId& correlationId = message.correlationId();
+        if (!correlationId.isPointer()) {
+            continue;  // CONTINUE
+        }
+
+        resolve(static_cast<AckFuture_State*>(correlationId.thePointer()),
+                static_cast<bmqt::AckResult::Enum>(message.ackStatus()),
+                message.messageGUID());
+        ++numCompleted;
+    }
+
+    if (numCompleted != 0) {
+        notify();
+    }
+
+    return numCompleted;
+}
+
+void AckFutureSource::abandon(const AckFuture& future)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(future.isValid());
+
+    resolve(future.d_state_p,
+            bmqt::AckResult::e_UNKNOWN,
+            bmqt::MessageGUID());
+    notify();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
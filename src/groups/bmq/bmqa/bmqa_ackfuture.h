@@ -0,0 +1,403 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BMQA_ACKFUTURE
+#define INCLUDED_BMQA_ACKFUTURE
+
+/// @file bmqa_ackfuture.h
+///
+/// @brief Provide lightweight futures completed by `ACK` messages.
+///
+/// This component provides a mechanism, @bbref{bmqa::AckFutureSource}, which
+/// creates @bbref{bmqa::AckFuture} objects to track the acknowledgment of
+/// individual posted messages, and completes them from `ACK` message events.
+///
+/// A future's shared state is allocated from a pool owned by the source, and
+/// is reference counted without any `bsl::function` or `bsl::shared_ptr`
+/// overhead.  The future exposes a `bmqt::CorrelationId` holding a pointer to
+/// its state, which the producer sets on the message it posts.  When the
+/// corresponding `ACK` event is delivered to the application, a single call
+/// to `AckFutureSource::complete` resolves every future referenced by the
+/// event directly from the correlation ids, without any lookup in an
+/// application-side correlation id map, and wakes up waiting threads once
+/// per event rather than once per message.
+///
+/// Thread Safety                                 {#bmqa_ackfuture_thread}
+/// =============
+///
+/// `AckFutureSource` is fully thread-safe.  Distinct `AckFuture` objects
+/// referring to the same state may be used concurrently from different
+/// threads; a single `AckFuture` object must not be modified concurrently.
+///
+/// Usage Example                                  {#bmqa_ackfuture_usage}
+/// =============
+///
+/// ```
+/// // Producer thread
+/// bmqa::AckFuture future = ackFutureSource.create();
+///
+/// bmqa::MessageEventBuilder builder;
+/// session.loadMessageEventBuilder(&builder);
+/// bmqa::Message& message = builder.startMessage();
+/// message.setCorrelationId(future.correlationId());
+/// message.setDataRef(payload, payloadLength);
+/// builder.packMessage(queueId);
+///
+/// if (session.post(builder.messageEvent()) != 0) {
+///     ackFutureSource.abandon(future);
+/// }
+///
+/// // ...
+///
+/// if (future.wait(bsls::TimeInterval(5.0)) == 0 &&
+///     future.result() == bmqt::AckResult::e_SUCCESS) {
+///     // Message was accepted by the broker
+/// }
+///
+/// // Event handler thread, in 'onMessageEvent'
+/// if (event.type() == bmqt::MessageEventType::e_ACK) {
+///     ackFutureSource.complete(event);
+/// }
+/// ```
+
+// BMQ
+
+#include <bmqa_messageevent.h>
+#include <bmqt_correlationid.h>
+#include <bmqt_messageguid.h>
+#include <bmqt_resultcode.h>
+
+// BDE
+#include <bdlma_concurrentpool.h>
+#include <bslma_allocator.h>
+#include <bslmt_condition.h>
+#include <bslmt_mutex.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+
+namespace BloombergLP {
+namespace bmqa {
+
+// FORWARD DECLARATION
+class AckFutureSource;
+
+// ======================
+// struct AckFuture_State
+// ======================
+
+/// PRIVATE. Shared state of an `AckFuture`.
+struct AckFuture_State {
+    // PUBLIC CONSTANTS
+
+    /// Value of `d_status` while the `ACK` has not been received.
+    /// `bmqt::AckResult` values are all non-positive.
+    static const int k_PENDING = 1;
+
+    // PUBLIC DATA
+
+    /// Number of `AckFuture` objects referring to this state, plus one
+    /// while the state is referenced by an in-flight message.
+    bsls::AtomicInt d_refCount;
+
+    /// `k_PENDING`, or the `bmqt::AckResult::Enum` of the received `ACK`.
+    bsls::AtomicInt d_status;
+
+    /// GUID of the acknowledged message, valid once `d_status` is set.
+    bmqt::MessageGUID d_guid;
+
+    /// Source this state was allocated from.
+    AckFutureSource* d_source_p;
+
+    // CREATORS
+
+    /// Create a pending state owned by the specified `source`.
+    explicit AckFuture_State(AckFutureSource* source);
+};
+
+// ===============
+// class AckFuture
+// ===============
+
+/// Handle to the acknowledgment status of a posted message.
+class AckFuture {
+  private:
+    // DATA
+
+    /// Shared state, or null if this future is invalid.
+    AckFuture_State* d_state_p;
+
+    // FRIENDS
+    friend class AckFutureSource;
+
+  private:
+    // PRIVATE CREATORS
+
+    /// Create a future referring to the specified `state`, taking over
+    /// one reference on it.
+    explicit AckFuture(AckFuture_State* state);
+
+  public:
+    // CREATORS
+
+    /// Create an invalid future.
+    AckFuture();
+
+    /// Create a future referring to the same state as the specified
+    /// `original`.
+    AckFuture(const AckFuture& original);
+
+    /// Release the reference held on the shared state, if any.
+    ~AckFuture();
+
+    // MANIPULATORS
+
+    /// Make this future refer to the same state as the specified `rhs` and
+    /// return a reference to this object.
+    AckFuture& operator=(const AckFuture& rhs);
+
+    // ACCESSORS
+
+    /// Return `true` if this future refers to a shared state.
+    bool isValid() const;
+
+    /// Return `true` if the `ACK` of the message has been received.  The
+    /// behavior is undefined unless `isValid()`.
+    bool isReady() const;
+
+    /// Block until the `ACK` of the message has been received, or until the
+    /// optionally specified relative `timeout` expires.  A default
+    /// constructed `timeout` waits indefinitely.  Return 0 if the `ACK` was
+    /// received, and -1 on timeout.  The behavior is undefined unless
+    /// `isValid()`.
+    int wait(const bsls::TimeInterval& timeout = bsls::TimeInterval()) const;
+
+    /// Return the status of the `ACK`.  The behavior is undefined unless
+    /// `isReady()`.
+    bmqt::AckResult::Enum result() const;
+
+    /// Return the GUID of the acknowledged message.  The behavior is
+    /// undefined unless `isReady()`.  Note that the GUID is unset if the
+    /// future was abandoned.
+    const bmqt::MessageGUID& messageGUID() const;
+
+    /// Return the correlation id to set on the message whose `ACK` this
+    /// future tracks.  The behavior is undefined unless `isValid()`.
+    bmqt::CorrelationId correlationId() const;
+};
+
+// =====================
+// class AckFutureSource
+// =====================
+
+/// Mechanism creating `AckFuture` objects and completing them from `ACK`
+/// message events.
+class AckFutureSource {
+  private:
+    // DATA
+
+    /// Pool of `AckFuture_State` objects.
+    bdlma::ConcurrentPool d_pool;
+
+    /// Mutex protecting waits on `d_condition`.
+    mutable bslmt::Mutex d_mutex;
+
+    /// Condition signaled each time futures are completed.
+    mutable bslmt::Condition d_condition;
+
+    // FRIENDS
+    friend class AckFuture;
+
+  private:
+    // NOT IMPLEMENTED
+    AckFutureSource(const AckFutureSource&) BSLS_KEYWORD_DELETED;
+    AckFutureSource& operator=(const AckFutureSource&) BSLS_KEYWORD_DELETED;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Release one reference on the specified `state`, returning it to the
+    /// pool if it was the last one.
+    void release(AckFuture_State* state);
+
+    /// Set the specified `status` and `guid` on the specified `state` and
+    /// release the in-flight reference on it.
+    void resolve(AckFuture_State*         state,
+                 bmqt::AckResult::Enum    status,
+                 const bmqt::MessageGUID& guid);
+
+    /// Wake up the threads waiting on a future of this source.
+    void notify();
+
+    // PRIVATE ACCESSORS
+
+    /// Block until the specified `state` is ready, or the specified
+    /// relative `timeout` expires if it is not zero.  Return 0 if the state
+    /// is ready and -1 on timeout.
+    int wait(const AckFuture_State&    state,
+             const bsls::TimeInterval& timeout) const;
+
+  public:
+    // CREATORS
+
+    /// Create a source using the optionally specified `basicAllocator` to
+    /// supply memory.
+    explicit AckFutureSource(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object.  The behavior is undefined unless every future
+    /// created by this source has been destroyed.  Note that the states of
+    /// futures whose message was never acknowledged nor abandoned are
+    /// reclaimed along with the pool.
+    ~AckFutureSource();
+
+    // MANIPULATORS
+
+    /// Return a new pending future, whose `correlationId()` is to be set on
+    /// exactly one posted message.
+    AckFuture create();
+
+    /// Complete the futures referenced by the `ACK` messages of the
+    /// specified `event`, and return the number of futures completed.
+    /// Messages whose correlation id is not a pointer are ignored.  The
+    /// behavior is undefined unless `event` is of type `e_ACK`, and every
+    /// pointer correlation id in it was obtained from a future of this
+    /// source that has not already been completed or abandoned.
+    int complete(const MessageEvent& event);
+
+    /// Complete the specified `future` with status `e_UNKNOWN`, to be used
+    /// when the message it was set on could not be posted.  The behavior is
+    /// undefined unless `future` was created by this source and has not
+    /// already been completed or abandoned.
+    void abandon(const AckFuture& future);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ----------------------
+// struct AckFuture_State
+// ----------------------
+
+inline AckFuture_State::AckFuture_State(AckFutureSource* source)
+: d_refCount(2)  // Future + in-flight message
+, d_status(k_PENDING)
+, d_guid()
+, d_source_p(source)
+{
+    // NOTHING
+}
+
+// ---------------
+// class AckFuture
+// ---------------
+
+// PRIVATE CREATORS
+inline AckFuture::AckFuture(AckFuture_State* state)
+: d_state_p(state)
+{
+    // NOTHING
+}
+
+// CREATORS
+inline AckFuture::AckFuture()
+: d_state_p(0)
+{
+    // NOTHING
+}
+
+inline AckFuture::AckFuture(const AckFuture& original)
+: d_state_p(original.d_state_p)
+{
+    if (d_state_p) {
+        ++d_state_p->d_refCount;
+    }
+}
+
+inline AckFuture::~AckFuture()
+{
+    if (d_state_p) {
+        d_state_p->d_source_p->release(d_state_p);
+    }
+}
+
+// MANIPULATORS
+inline AckFuture& AckFuture::operator=(const AckFuture& rhs)
+{
+    AckFuture copy(rhs);
+
+    AckFuture_State* tmp = d_state_p;
+    d_state_p            = copy.d_state_p;
+    copy.d_state_p       = tmp;
+
+    return *this;
+}
+
+// ACCESSORS
+inline bool AckFuture::isValid() const
+{
+    return d_state_p != 0;
+}
+
+inline bool AckFuture::isReady() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isValid());
+
+    return d_state_p->d_status.loadAcquire() != AckFuture_State::k_PENDING;
+}
+
+inline int AckFuture::wait(const bsls::TimeInterval& timeout) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isValid());
+
+    if (isReady()) {
+        return 0;  // RETURN
+    }
+
+    return d_state_p->d_source_p->wait(*d_state_p, timeout);
+}
+
+inline bmqt::AckResult::Enum AckFuture::result() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isReady());
+
+    return static_cast<bmqt::AckResult::Enum>(
+        d_state_p->d_status.loadAcquire());
+}
+
+inline const bmqt::MessageGUID& AckFuture::messageGUID() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isReady());
+
+    return d_state_p->d_guid;
+}
+
+inline bmqt::CorrelationId AckFuture::correlationId() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isValid());
+
+    return bmqt::CorrelationId(static_cast<void*>(d_state_p));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,200 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqa_ackfuture.h>
+
+// BMQ
+#include <bmqa_event.h>
+#include <bmqa_mocksession.h>
+#include <bmqa_queueid.h>
+#include <bmqt_messageguid.h>
+#include <bmqt_resultcode.h>
+
+// BDE
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_vector.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise basic functionality before beginning testing in earnest.
+//   Probe that functionality to discover basic errors.
+//
+// Testing:
+//   Basic functionality.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    bmqa::AckFutureSource source(bmqtst::TestHelperUtil::allocator());
+
+    PV("Invalid future");
+    {
+        bmqa::AckFuture future;
+        BMQTST_ASSERT(!future.isValid());
+    }
+
+    PV("Abandoned future");
+    {
+        bmqa::AckFuture future = source.create();
+        BMQTST_ASSERT(future.isValid());
+        BMQTST_ASSERT(!future.isReady());
+
+        const bmqt::CorrelationId correlationId = future.correlationId();
+        BMQTST_ASSERT(correlationId.isPointer());
+
+        bmqa::AckFuture copy(future);
+        BMQTST_ASSERT_EQ(copy.correlationId(), correlationId);
+
+        source.abandon(future);
+        BMQTST_ASSERT(future.isReady());
+        BMQTST_ASSERT(copy.isReady());
+        BMQTST_ASSERT_EQ(future.wait(), 0);
+        BMQTST_ASSERT_EQ(future.result(), bmqt::AckResult::e_UNKNOWN);
+        BMQTST_ASSERT(future.messageGUID().isUnset());
+
+        bmqa::AckFuture assigned;
+        assigned = copy;
+        BMQTST_ASSERT(assigned.isReady());
+    }
+}
+
+static void test2_complete()
+// ------------------------------------------------------------------------
+// COMPLETE
+//
+// Concerns:
+//   1. All the futures referenced by an ACK event are completed with the
+//      status and GUID of their message.
+//   2. Messages with a non-pointer correlation id are ignored.
+//   3. A future destroyed before its ACK is received does not prevent the
+//      completion of the event.
+//
+// Testing:
+//   AckFutureSource::complete
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COMPLETE");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(4 * 1024, alloc);
+    bmqa::AckFutureSource          source(alloc);
+
+    bmqa::AckFuture     success = source.create();
+    bmqa::AckFuture     failure = source.create();
+    bmqt::CorrelationId dropped;
+    {
+        bmqa::AckFuture future = source.create();
+        dropped                = future.correlationId();
+    }
+
+    bmqt::MessageGUID guid1;
+    bmqt::MessageGUID guid2;
+    guid1.fromHex("00000000000000000000000000000001");
+    guid2.fromHex("00000000000000000000000000000002");
+
+    bsl::vector<bmqa::MockSessionUtil::AckParams> acks(alloc);
+    acks.emplace_back(bmqt::AckResult::e_SUCCESS,
+                      success.correlationId(),
+                      guid1,
+                      bmqa::QueueId(1));
+    acks.emplace_back(bmqt::AckResult::e_SUCCESS,
+                      bmqt::CorrelationId(7),
+                      bmqt::MessageGUID(),
+                      bmqa::QueueId(1));
+    acks.emplace_back(bmqt::AckResult::e_LIMIT_MESSAGES,
+                      failure.correlationId(),
+                      guid2,
+                      bmqa::QueueId(1));
+    acks.emplace_back(bmqt::AckResult::e_SUCCESS,
+                      dropped,
+                      bmqt::MessageGUID(),
+                      bmqa::QueueId(1));
+
+    bmqa::Event event =
+        bmqa::MockSessionUtil::createAckEvent(acks, &bufferFactory, alloc);
+
+    BMQTST_ASSERT_EQ(source.complete(event.messageEvent()), 3);
+
+    BMQTST_ASSERT(success.isReady());
+    BMQTST_ASSERT_EQ(success.result(), bmqt::AckResult::e_SUCCESS);
+    BMQTST_ASSERT_EQ(success.messageGUID(), guid1);
+
+    BMQTST_ASSERT(failure.isReady());
+    BMQTST_ASSERT_EQ(failure.result(), bmqt::AckResult::e_LIMIT_MESSAGES);
+    BMQTST_ASSERT_EQ(failure.messageGUID(), guid2);
+}
+
+static void test3_waitTimeout()
+// ------------------------------------------------------------------------
+// WAIT TIMEOUT
+//
+// Concerns:
+//   1. Waiting on a pending future with a timeout returns -1 once the
+//      timeout expires.
+//
+// Testing:
+//   AckFuture::wait
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("WAIT TIMEOUT");
+
+    bmqa::AckFutureSource source(bmqtst::TestHelperUtil::allocator());
+
+    bmqa::AckFuture future = source.create();
+    BMQTST_ASSERT_EQ(future.wait(bsls::TimeInterval(0, 10 * 1000 * 1000)),
+                     -1);
+    BMQTST_ASSERT(!future.isReady());
+
+    source.abandon(future);
+    BMQTST_ASSERT_EQ(future.wait(bsls::TimeInterval(0, 10 * 1000 * 1000)),
+                     0);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_waitTimeout(); break;
+    case 2: test2_complete(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_DEFAULT);
+}
@@ -440,16 +440,13 @@ int Message::loadProperties(MessageProperties* buffer) const
 
         bmqp::MessagePropertiesInfo input(it.header());
 
+        // In the presence of a learned schema, properties are located and
+        // parsed only when accessed, so that reading one property does not
+        // parse all of them.  All the properties are only parsed when
+        // iterated or streamed out.
         rc = propertiesImpl->streamIn(propertiesBlob,
                                       input,
                                       d_impl.d_schema_sp);
-
-        // Forcibly load all properties.
-        // REVISIT; this can be removed once MPs support dynamic modification
-        if (rc == 0) {
-            rc = 1000 *
-                 propertiesImpl->loadProperties(false, input.isExtended());
-        }
     }
     else if (rawEvent.isPutEvent()) {
         rc = event->putMessageIterator()->loadMessageProperties(
@@ -327,7 +327,11 @@ class Message {
     /// otherwise.  The behaviour is undefined unless this instance
     /// represents a `PUT` or `PUSH` message.  Note that for efficiency,
     /// application should fetch payload once and cache the value, instead
-    /// of invoking this method multiple times on a message.
+    /// of invoking this method multiple times on a message.  Also note that
+    /// the payload is not copied: `blob` refers to the buffers in which the
+    /// message was received, so a large payload can be processed
+    /// incrementally (e.g., through a `bdlbb::InBlobStreamBuf`) without
+    /// being materialized in contiguous memory.
     int getData(bdlbb::Blob* blob) const;
 
     /// Return the number of bytes in the payload.  The behavior is
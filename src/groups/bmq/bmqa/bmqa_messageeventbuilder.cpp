@@ -22,10 +22,14 @@
 #include <bmqimp_queue.h>
 #include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocol.h>
+#include <bmqpi_dtcontext.h>
+#include <bmqpi_dtspan.h>
+#include <bmqpi_dttracer.h>
 #include <bmqt_messageguid.h>
 #include <bmqt_queueflags.h>
 
 // BDE
+#include <bdlma_localsequentialallocator.h>
 #include <bsl_memory.h>
 #include <bslma_managedptr.h>
 #include <bslmf_assert.h>
@@ -139,6 +143,33 @@ MessageEventBuilder::packMessage(const bmqa::QueueId& queueId)
     d_impl.d_guidGenerator_sp->generateGUID(&guid);
     builder->setMessageGUID(guid);
 
+    if (d_impl.d_tracer_sp && d_impl.d_traceContext_sp &&
+        queueSpRef->isTraceContextSupported()) {
+        const bsl::shared_ptr<bmqpi::DTSpan> span =
+            d_impl.d_traceContext_sp->span();
+        if (span) {
+            // Whether the span was sampled, and hence whether its context is
+            // propagated, is decided by the tracer.
+            bdlma::LocalSequentialAllocator<
+                bmqp::Protocol::k_TRACE_CONTEXT_MAX_LENGTH>
+                                         lsa;
+            bmqp::Protocol::TraceContext traceContext(&lsa);
+            if (d_impl.d_tracer_sp->serializeSpan(&traceContext, span) == 0) {
+                builder->setTraceContext(traceContext);
+            }
+        }
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            !queueSpRef->isCompressionAlgorithmSupported(
+                builder->compressionAlgorithmType()))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        // The broker did not advertise support for the requested algorithm;
+        // fall back to ZLIB, which every broker supports.
+        builder->setCompressionAlgorithmType(
+            bmqt::CompressionAlgorithmType::e_ZLIB);
+    }
+
     if (queueSpRef->isOldStyle()) {
         // Temporary; shall remove after 2nd roll out of "new style" brokers.
         rc = builder->packMessageInOldStyle(queueSpRef->id());
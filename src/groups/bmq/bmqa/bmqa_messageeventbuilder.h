@@ -270,6 +270,10 @@ class QueueId;
 namespace bmqp {
 class MessageGUIDGenerator;
 }
+namespace bmqpi {
+class DTContext;
+class DTTracer;
+}
 
 namespace bmqa {
 
@@ -296,6 +300,12 @@ struct MessageEventBuilderImpl {
     // GUID generator object.
     bsl::shared_ptr<bmqp::MessageGUIDGenerator> d_guidGenerator_sp;
 
+    /// Tracer and context of the session, if any, used to propagate the
+    /// context of the active span along with packed messages.
+    bsl::shared_ptr<bmqpi::DTTracer> d_tracer_sp;
+
+    bsl::shared_ptr<bmqpi::DTContext> d_traceContext_sp;
+
     /// The final number of messages in the current `d_msgEvent` cached on
     /// switching this MessageEvent from WRITE to READ mode.
     /// This cached value exists because we are not able to access the
@@ -17,6 +17,9 @@
 
 // BDE
 #include <bsla_annotations.h>
+#include <bslma_testallocator.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 
 // BMQ
 #include <bmqa_mocksession.h>
@@ -160,6 +163,106 @@ static void test2_testMessageEventSizeCount()
     BMQTST_ASSERT_EQ(0, builder.messageCount());
 }
 
+static void testN1_allocationsPerMessage()
+// ------------------------------------------------------------------------
+// ALLOCATIONS PER MESSAGE
+//
+// Concerns:
+//   Measure the number of allocations and the time per message packed
+//   through a 'bmqa::MessageEventBuilder', for producers profiling the PUT
+//   hot path.
+//
+// Plan:
+//   Using a session supplied with a test allocator, build a number of
+//   events of a number of messages each, all messages having a
+//   correlationId, and report the number of allocations, bytes and time
+//   per message once the builder has been warmed up with a first event.
+//   Note that 'bmqa::MockSession' creates a new 'bmqimp::Event' on every
+//   'reset', while 'bmqa::Session' takes it from a pool, so the reported
+//   allocations include the amortized cost of creating the events.
+//
+// Testing:
+//   Allocations on the PUT hot path.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // Can't ensure no default memory is allocated because a default
+    // QueueId is instantiated and that uses the default allocator to
+    // allocate memory for an automatically generated CorrelationId.
+
+    bmqtst::TestHelper::printTestName("ALLOCATIONS PER MESSAGE");
+
+    const int k_NUM_EVENTS             = 1000;
+    const int k_NUM_MESSAGES_PER_EVENT = 100;
+
+    bslma::TestAllocator ta("session");
+    bmqa::MockSession    session(bmqt::SessionOptions(&ta), &ta);
+
+    BMQA_EXPECT_CALL(session, start()).returning(0);
+    BMQTST_ASSERT_EQ(session.start(), 0);
+
+    bmqt::Uri   uri(bmqtst::TestHelperUtil::allocator());
+    bsl::string error(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(bmqt::UriParser::parse(&uri,
+                                            &error,
+                                            "bmq://my.domain/queue"),
+                     0);
+
+    bmqa::QueueId queueId(bmqt::CorrelationId::autoValue(),
+                          bmqtst::TestHelperUtil::allocator());
+    BMQA_EXPECT_CALL(session,
+                     openQueue(&queueId, uri, bmqt::QueueFlags::e_WRITE))
+        .returning(0);
+    BMQTST_ASSERT_EQ(
+        session.openQueue(&queueId, uri, bmqt::QueueFlags::e_WRITE),
+        0);
+
+    const bsl::string payload("test payload",
+                              bmqtst::TestHelperUtil::allocator());
+
+    bmqa::MessageEventBuilder builder;
+    session.loadMessageEventBuilder(&builder);
+
+    bsls::Types::Int64 numAllocations = 0;
+    bsls::Types::Int64 numBytes       = 0;
+    bsls::Types::Int64 startTime      = 0;
+
+    // The first event warms up the builder, and is not measured.
+    for (int event = 0; event <= k_NUM_EVENTS; ++event) {
+        if (event == 1) {
+            numAllocations = ta.numAllocations();
+            numBytes       = ta.numBytesTotal();
+            startTime      = bsls::TimeUtil::getTimer();
+        }
+
+        for (int i = 0; i < k_NUM_MESSAGES_PER_EVENT; ++i) {
+            bmqa::Message& msg = builder.startMessage();
+            msg.setCorrelationId(bmqt::CorrelationId::autoValue());
+            msg.setDataRef(payload.c_str(), payload.size());
+            BMQTST_ASSERT_EQ(builder.packMessage(queueId),
+                             bmqt::EventBuilderResult::e_SUCCESS);
+        }
+
+        static_cast<void>(builder.messageEvent());
+        builder.reset();
+    }
+
+    const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() - startTime;
+    const double numMessages = static_cast<double>(k_NUM_EVENTS) *
+                               k_NUM_MESSAGES_PER_EVENT;
+
+    cout << "Messages per event    : " << k_NUM_MESSAGES_PER_EVENT << endl
+         << "Allocations / message : "
+         << static_cast<double>(ta.numAllocations() - numAllocations) /
+                numMessages
+         << endl
+         << "Bytes / message       : "
+         << static_cast<double>(ta.numBytesTotal() - numBytes) / numMessages
+         << endl
+         << "Time / message (ns)   : "
+         << static_cast<double>(elapsed) / numMessages << endl;
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -172,6 +275,7 @@ int main(int argc, char* argv[])
     case 0:
     case 1: test1_breathingTest(); break;
     case 2: test2_testMessageEventSizeCount(); break;
+    case -1: testN1_allocationsPerMessage(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
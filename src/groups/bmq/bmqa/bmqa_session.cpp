@@ -314,10 +314,18 @@ int SessionUtil::createApplication(SessionImpl* sessionImpl)
         .append(bmqp::EncodingFeature::k_ENCODING_BER)
         .append(",")
         .append(bmqp::EncodingFeature::k_ENCODING_JSON)
+        .append(",")
+        .append(bmqp::EncodingFeature::k_ENCODING_COMPACT)
         .append(";")
         .append(bmqp::MessagePropertiesFeatures::k_FIELD_NAME)
         .append(":")
-        .append(bmqp::MessagePropertiesFeatures::k_MESSAGE_PROPERTIES_EX);
+        .append(bmqp::MessagePropertiesFeatures::k_MESSAGE_PROPERTIES_EX)
+        .append(";")
+        .append(bmqp::CompressionFeatures::k_FIELD_NAME)
+        .append(":")
+        .append(bmqp::CompressionFeatures::k_LZ4)
+        .append(",")
+        .append(bmqp::CompressionFeatures::k_ZSTD);
 
     ci.protocolVersion() = bmqp::Protocol::k_VERSION;
     ci.sdkVersion()      = bmqscm::Version::versionAsInt();
@@ -775,6 +783,8 @@ void SessionImpl::loadMessageEventBuilder(MessageEventBuilder* builder)
         reinterpret_cast<MessageEventBuilderImpl&>(builderRef);
 
     builderImplRef.d_guidGenerator_sp = d_guidGenerator_sp;
+    builderImplRef.d_tracer_sp        = d_sessionOptions.tracer();
+    builderImplRef.d_traceContext_sp  = d_sessionOptions.traceContext();
 
     builderImplRef.d_messageEventFactory = MessageEventCreator(
         d_application_mp->blobSpPool(),
@@ -1582,6 +1592,44 @@ Event Session::nextEvent(const bsls::TimeInterval& timeout)
     return event;
 }
 
+int Session::tryNextEvent(bsl::vector<Event>* events, int maxEvents)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(d_impl.d_application_mp && "The session was not started");
+    BSLS_ASSERT(events);
+    BSLS_ASSERT(0 < maxEvents);
+
+    bmqimp::BrokerSession& brokerSession =
+        d_impl.d_application_mp->brokerSession();
+
+    int numEvents = 0;
+    while (numEvents < maxEvents) {
+        Event                           event;
+        bsl::shared_ptr<bmqimp::Event>& eventImplSpRef =
+            reinterpret_cast<bsl::shared_ptr<bmqimp::Event>&>(event);
+
+        if (brokerSession.tryNextEvent(&eventImplSpRef) != 0) {
+            break;  // BREAK
+        }
+
+        events->push_back(event);
+        ++numEvents;
+
+        const bmqimp::Event& eventImpl = *eventImplSpRef;
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                eventImpl.type() == bmqimp::Event::EventType::e_SESSION &&
+                eventImpl.sessionEventType() ==
+                    bmqt::SessionEventType::e_DISCONNECTED)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            // The DISCONNECTED event is re-enqueued once popped out, so that
+            // it is the last event of the session.
+            break;  // BREAK
+        }
+    }
+
+    return numEvents;
+}
+
 int Session::post(const MessageEvent& event)
 {
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
@@ -1649,6 +1697,19 @@ int Session::confirmMessages(ConfirmEventBuilder* builder)
     return rc;
 }
 
+int Session::flushConfirms()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            !d_impl.d_application_mp ||
+            d_impl.d_application_mp->brokerSession().state() !=
+                bmqimp::BrokerSession::State::e_STARTED)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return bmqt::GenericResult::e_NOT_CONNECTED;  // RETURN
+    }
+
+    return d_impl.d_application_mp->brokerSession().flushConfirms();
+}
+
 int Session::configureMessageDumping(const bslstl::StringRef& command)
 {
     if (!d_impl.d_application_mp || !d_impl.d_application_mp->isStarted()) {
@@ -1662,13 +1723,15 @@ int Session::configureMessageDumping(const bslstl::StringRef& command)
     };
 
     bmqp_ctrlmsg::DumpMessages cmd;
+    int                        sampleEvery = 1;
 
-    int rc = bmqimp::MessageDumper::parseCommand(&cmd, command);
+    int rc = bmqimp::MessageDumper::parseCommand(&cmd, &sampleEvery, command);
     if (rc != 0) {
         return 10 * rc + rc_PARSE_FAILURE;  // RETURN
     }
 
-    d_impl.d_application_mp->brokerSession().processDumpCommand(cmd);
+    d_impl.d_application_mp->brokerSession().processDumpCommand(cmd,
+                                                                sampleEvery);
 
     return rc_SUCCESS;
 }
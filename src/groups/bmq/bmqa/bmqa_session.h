@@ -215,7 +215,12 @@
 /// timeout expires.  It is safe to call the `nextEvent` method from different
 /// threads simultaneously: the @bbref{bmqa::Session} class provides proper
 /// synchronization logic to protect the internal event queue from corruption
-/// in this scenario.
+/// in this scenario.  The `tryNextEvent` method returns all the events
+/// available at once, up to a maximum number, without ever blocking; and the
+/// `nextEventSpinDuration` option of @bbref{bmqt::SessionOptions} lets
+/// `nextEvent` busy-poll the event queue for some time before blocking, which
+/// removes the latency of waking up the calling thread when events arrive
+/// within that time.
 ///
 /// Example 2                                               {#bmqa_session_ex2}
 /// ---------
@@ -566,6 +571,7 @@
 #include <ball_log.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
@@ -1083,6 +1089,16 @@ class Session : public AbstractSession {
     Event nextEvent(const bsls::TimeInterval& timeout = bsls::TimeInterval())
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Append to the specified `events` up to the specified `maxEvents`
+    /// events available for this session, without blocking, and return the
+    /// number of appended events, which is 0 if no event is available.  The
+    /// DISCONNECTED session event, if appended, is the last appended event.
+    /// Note that this method can only be used if the session is in
+    /// synchronous mode (ie not using the EventHandler).  The behavior is
+    /// undefined unless the session was started, and `0 < maxEvents`.
+    int tryNextEvent(bsl::vector<Event>* events,
+                     int                 maxEvents) BSLS_KEYWORD_OVERRIDE;
+
     /// Asynchronously post the specified `event` that must contain one or
     /// more `Messages`.  The return value is one of the values defined in
     /// the `bmqt::PostResult::Enum` enum.  Return zero on success and a
@@ -1125,6 +1141,14 @@ class Session : public AbstractSession {
     /// `builder` is non-null.
     int confirmMessages(ConfirmEventBuilder* builder) BSLS_KEYWORD_OVERRIDE;
 
+    /// Asynchronously send to the broker the confirmations held by the
+    /// session for batching, if any, without waiting for the batch to fill
+    /// or for its linger time to elapse.  The return value is one of the
+    /// values defined in the `bmqt::GenericResult::Enum` enum.  Note that
+    /// this method has no effect unless confirm batching was enabled in the
+    /// session options, see @bbref{bmqt::SessionOptions}.
+    int flushConfirms() BSLS_KEYWORD_OVERRIDE;
+
     /// Debugging related
     ///-----------------
 
@@ -1133,7 +1157,7 @@ class Session : public AbstractSession {
     /// `command` that should adhere to the following pattern:
     ///
     /// ```
-    /// IN|OUT|PUSH|ACK|PUT|CONFIRM ON|OFF|100|10s
+    /// IN|OUT|PUSH|ACK|PUT|CONFIRM ON|OFF|100|10s [SAMPLE 50]
     /// ```
     ///
     /// where each token has a specific meaning:
@@ -1147,12 +1171,15 @@ class Session : public AbstractSession {
     /// * **OFF**     : turn off message dumping
     /// * **100**     : turn on message dumping for the next 100 messages
     /// * **10s**     : turn on message dumping for the next 10 seconds
-    /// Above, the numerical values `100` and `10` are just for illustration
-    /// purposes, and application can choose an appropriate positive numeric
-    /// value for them.  Also, pattern is case-insensitive.  Return zero if
-    /// `command` is valid and message dumping has been configured, non-zero
-    /// value otherwise.  The behavior is undefined unless the session has
-    /// been started.
+    /// * **SAMPLE 50**: optionally, dump only one out of every 50 messages
+    /// Above, the numerical values `100`, `10` and `50` are just for
+    /// illustration purposes, and application can choose an appropriate
+    /// positive numeric value for them.  Sampling allows to keep message
+    /// dumping enabled on a high-throughput queue without logging, and
+    /// paying for the formatting of, every message.  Also, pattern is
+    /// case-insensitive.  Return zero if `command` is valid and message
+    /// dumping has been configured, non-zero value otherwise.  The behavior
+    /// is undefined unless the session has been started.
     int configureMessageDumping(const bslstl::StringRef& command)
         BSLS_KEYWORD_OVERRIDE;
 };
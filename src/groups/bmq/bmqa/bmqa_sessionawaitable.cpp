@@ -0,0 +1,99 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqa_sessionawaitable.h>
+
+#include <bmqscm_version.h>
+
+// BDE
+#include <bsls_assert.h>
+
+#ifdef BMQA_SESSIONAWAITABLE_HAS_COROUTINES
+
+namespace BloombergLP {
+namespace bmqa {
+
+// -----------------------
+// struct SessionAwaitUtil
+// -----------------------
+
+// CLASS METHODS
+SessionAwaitable<OpenQueueStatus>
+SessionAwaitUtil::openQueue(AbstractSession*          session,
+                            QueueId*                  queueId,
+                            const bmqt::Uri&          uri,
+                            bsls::Types::Uint64       flags,
+                            const bmqex::Executor&    executor,
+                            const bmqt::QueueOptions& options,
+                            const bsls::TimeInterval& timeout)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(session);
+    BSLS_ASSERT(queueId);
+
+    return SessionAwaitable<OpenQueueStatus>(
+        [session, queueId, uri, flags, options, timeout](
+            const AbstractSession::OpenQueueCallback& callback) {
+            session->openQueueAsync(queueId,
+                                    uri,
+                                    flags,
+                                    callback,
+                                    options,
+                                    timeout);
+        },
+        executor);
+}
+
+SessionAwaitable<ConfigureQueueStatus>
+SessionAwaitUtil::configureQueue(AbstractSession*          session,
+                                 QueueId*                  queueId,
+                                 const bmqt::QueueOptions& options,
+                                 const bmqex::Executor&    executor,
+                                 const bsls::TimeInterval& timeout)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(session);
+    BSLS_ASSERT(queueId);
+
+    return SessionAwaitable<ConfigureQueueStatus>(
+        [session, queueId, options, timeout](
+            const AbstractSession::ConfigureQueueCallback& callback) {
+            session->configureQueueAsync(queueId, options, callback, timeout);
+        },
+        executor);
+}
+
+SessionAwaitable<CloseQueueStatus>
+SessionAwaitUtil::closeQueue(AbstractSession*          session,
+                             QueueId*                  queueId,
+                             const bmqex::Executor&    executor,
+                             const bsls::TimeInterval& timeout)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(session);
+    BSLS_ASSERT(queueId);
+
+    return SessionAwaitable<CloseQueueStatus>(
+        [session, queueId, timeout](
+            const AbstractSession::CloseQueueCallback& callback) {
+            session->closeQueueAsync(queueId, callback, timeout);
+        },
+        executor);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // BMQA_SESSIONAWAITABLE_HAS_COROUTINES
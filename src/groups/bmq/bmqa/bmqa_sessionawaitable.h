@@ -0,0 +1,321 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BMQA_SESSIONAWAITABLE
+#define INCLUDED_BMQA_SESSIONAWAITABLE
+
+/// @file bmqa_sessionawaitable.h
+///
+/// @brief Provide C++20 awaitables over the asynchronous queue operations.
+///
+/// This component provides a class template,
+/// @bbref{bmqa::SessionAwaitable}, and a utility struct,
+/// @bbref{bmqa::SessionAwaitUtil}, allowing a C++20 coroutine to `co_await`
+/// the completion of the callback flavors of `openQueueAsync`,
+/// `configureQueueAsync` and `closeQueueAsync` of a
+/// @bbref{bmqa::AbstractSession}.  The operation is initiated when the
+/// coroutine suspends, and the coroutine is resumed with the resulting status
+/// object once the session invokes the completion callback.
+///
+/// By default the coroutine is resumed on the thread invoking the completion
+/// callback, i.e. the session's event handler thread.  If a
+/// @bbref{bmqex::Executor} is supplied, the coroutine is instead resumed by
+/// calling `dispatch` on that executor, so that the continuation runs on the
+/// application's own execution context (e.g., a @bbref{bmqex::Strand}) and is
+/// not executed on, and does not block, the session's internal threads.
+///
+/// If the session invokes the completion callback before the coroutine has
+/// finished suspending (e.g., when the request is rejected synchronously),
+/// the coroutine does not suspend at all and continues in place.
+///
+/// This component is only available when the compiler supports C++20
+/// coroutines, in which case the `BMQA_SESSIONAWAITABLE_HAS_COROUTINES` macro
+/// is defined.
+///
+/// Usage Example                             {#bmqa_sessionawaitable_usage}
+/// =============
+///
+/// The following snippet opens a queue and configures it from a coroutine,
+/// resuming on the application's executor after each step.  `Task` is any
+/// coroutine return type provided by the application.
+///
+/// ```
+/// Task openAndConfigure(bmqa::AbstractSession* session,
+///                       bmqa::QueueId*         queueId,
+///                       const bmqt::Uri&       uri,
+///                       bmqex::Executor        executor)
+/// {
+///     bmqa::OpenQueueStatus openStatus =
+///         co_await bmqa::SessionAwaitUtil::openQueue(
+///                                             session,
+///                                             queueId,
+///                                             uri,
+///                                             bmqt::QueueFlags::e_READ,
+///                                             executor);
+///     if (!openStatus) {
+///         co_return;                                                // RETURN
+///     }
+///
+///     bmqt::QueueOptions options;
+///     options.setMaxUnconfirmedMessages(1000);
+///
+///     bmqa::ConfigureQueueStatus configureStatus =
+///         co_await bmqa::SessionAwaitUtil::configureQueue(session,
+///                                                         queueId,
+///                                                         options,
+///                                                         executor);
+///     // ...
+/// }
+/// ```
+
+// BMQ
+
+#include <bmqa_abstractsession.h>
+#include <bmqa_closequeuestatus.h>
+#include <bmqa_configurequeuestatus.h>
+#include <bmqa_openqueuestatus.h>
+#include <bmqa_queueid.h>
+#include <bmqex_executor.h>
+#include <bmqt_queueoptions.h>
+#include <bmqt_uri.h>
+
+// BDE
+#include <bsl_functional.h>
+#include <bslma_allocator.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+#define BMQA_SESSIONAWAITABLE_HAS_COROUTINES 1
+#endif
+
+#ifdef BMQA_SESSIONAWAITABLE_HAS_COROUTINES
+
+#include <coroutine>
+
+namespace BloombergLP {
+namespace bmqa {
+
+// ======================
+// class SessionAwaitable
+// ======================
+
+/// An awaitable whose `co_await` initiates an asynchronous session operation
+/// completing with a status object of the specified `RESULT` type, and which
+/// resumes the awaiting coroutine once the operation has completed.
+template <class RESULT>
+class SessionAwaitable {
+  public:
+    // TYPES
+
+    /// Callback to invoke with the result of the operation.
+    typedef bsl::function<void(const RESULT& result)> CompletionCallback;
+
+    /// Function initiating the operation, invoked with the callback to
+    /// notify of its completion.
+    typedef bsl::function<void(const CompletionCallback& callback)>
+        Initiator;
+
+  private:
+    // PRIVATE TYPES
+    enum State {
+        /// Neither suspended nor completed.
+        e_INITIAL = 0,
+
+        /// Awaiting coroutine suspended, operation pending.
+        e_SUSPENDED = 1,
+
+        /// Operation completed before the coroutine suspended.
+        e_COMPLETED = 2
+    };
+
+  private:
+    // DATA
+
+    /// Function initiating the operation.
+    Initiator d_initiator;
+
+    /// Executor used to resume the coroutine, if any.
+    bmqex::Executor d_executor;
+
+    /// Result of the operation, set upon completion.
+    RESULT d_result;
+
+    /// Handle of the awaiting coroutine.
+    std::coroutine_handle<> d_handle;
+
+    /// Synchronizes completion with suspension, one of `State`.
+    bsls::AtomicInt d_state;
+
+  private:
+    // NOT IMPLEMENTED
+    SessionAwaitable(const SessionAwaitable&) BSLS_KEYWORD_DELETED;
+    SessionAwaitable& operator=(const SessionAwaitable&) BSLS_KEYWORD_DELETED;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Store the specified `result` and, if the awaiting coroutine is
+    /// already suspended, resume it.
+    void complete(const RESULT& result);
+
+  public:
+    // CREATORS
+
+    /// Create an awaitable which, when awaited, invokes the specified
+    /// `initiator` and resumes the awaiting coroutine, through the
+    /// specified `executor` if it has a target, once the callback provided
+    /// to `initiator` is invoked.  Optionally specify a `basicAllocator`
+    /// used to supply memory.
+    SessionAwaitable(const Initiator&       initiator,
+                     const bmqex::Executor& executor,
+                     bslma::Allocator*      basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Return `false`: the operation is always performed asynchronously.
+    bool await_ready() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Initiate the operation on behalf of the coroutine identified by the
+    /// specified `handle`.  Return `false` if the operation completed
+    /// before this method returned, in which case the coroutine resumes
+    /// immediately, and `true` otherwise.
+    bool await_suspend(std::coroutine_handle<> handle);
+
+    /// Return the result of the operation.
+    RESULT await_resume();
+};
+
+// =======================
+// struct SessionAwaitUtil
+// =======================
+
+/// Utilities to create awaitables over the queue operations of a
+/// `bmqa::AbstractSession`.  Each function returns an awaitable which, when
+/// `co_await`ed, calls the callback flavor of the corresponding
+/// asynchronous method on the specified `session` with the specified
+/// arguments, and resumes the coroutine with the resulting status, through
+/// the specified `executor` if it has a target, or else on the thread
+/// invoking the callback.  The behavior is undefined unless `session` and
+/// `queueId` remain valid until the operation completes.
+struct SessionAwaitUtil {
+    // CLASS METHODS
+
+    /// Return an awaitable for `session->openQueueAsync(...)`.
+    static SessionAwaitable<OpenQueueStatus>
+    openQueue(AbstractSession*          session,
+              QueueId*                  queueId,
+              const bmqt::Uri&          uri,
+              bsls::Types::Uint64       flags,
+              const bmqex::Executor&    executor = bmqex::Executor(),
+              const bmqt::QueueOptions& options  = bmqt::QueueOptions(),
+              const bsls::TimeInterval& timeout  = bsls::TimeInterval());
+
+    /// Return an awaitable for `session->configureQueueAsync(...)`.
+    static SessionAwaitable<ConfigureQueueStatus>
+    configureQueue(AbstractSession*          session,
+                   QueueId*                  queueId,
+                   const bmqt::QueueOptions& options,
+                   const bmqex::Executor&    executor = bmqex::Executor(),
+                   const bsls::TimeInterval& timeout  = bsls::TimeInterval());
+
+    /// Return an awaitable for `session->closeQueueAsync(...)`.
+    static SessionAwaitable<CloseQueueStatus>
+    closeQueue(AbstractSession*          session,
+               QueueId*                  queueId,
+               const bmqex::Executor&    executor = bmqex::Executor(),
+               const bsls::TimeInterval& timeout  = bsls::TimeInterval());
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ----------------------
+// class SessionAwaitable
+// ----------------------
+
+// PRIVATE MANIPULATORS
+template <class RESULT>
+inline void SessionAwaitable<RESULT>::complete(const RESULT& result)
+{
+    d_result = result;
+
+    if (d_state.testAndSwap(e_INITIAL, e_COMPLETED) == e_INITIAL) {
+        // Completed from within 'await_suspend': it will not suspend the
+        // coroutine, and '*this' must not be touched anymore.
+        return;  // RETURN
+    }
+
+    std::coroutine_handle<> handle = d_handle;
+    if (!d_executor) {
+        handle.resume();
+        return;  // RETURN
+    }
+
+    // The coroutine may destroy '*this' as soon as it resumes, so use a
+    // local copy of the executor.
+    bmqex::Executor executor(d_executor);
+    executor.dispatch([handle]() { handle.resume(); });
+}
+
+// CREATORS
+template <class RESULT>
+inline SessionAwaitable<RESULT>::SessionAwaitable(
+    const Initiator&       initiator,
+    const bmqex::Executor& executor,
+    bslma::Allocator*      basicAllocator)
+: d_initiator(bsl::allocator_arg, basicAllocator, initiator)
+, d_executor(executor)
+, d_result(basicAllocator)
+, d_handle()
+, d_state(e_INITIAL)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+template <class RESULT>
+inline bool SessionAwaitable<RESULT>::await_ready() const
+    BSLS_KEYWORD_NOEXCEPT
+{
+    return false;
+}
+
+template <class RESULT>
+inline bool
+SessionAwaitable<RESULT>::await_suspend(std::coroutine_handle<> handle)
+{
+    d_handle = handle;
+
+    d_initiator([this](const RESULT& result) { complete(result); });
+
+    return d_state.testAndSwap(e_INITIAL, e_SUSPENDED) == e_INITIAL;
+}
+
+template <class RESULT>
+inline RESULT SessionAwaitable<RESULT>::await_resume()
+{
+    return d_result;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif  // BMQA_SESSIONAWAITABLE_HAS_COROUTINES
+
+#endif
@@ -0,0 +1,432 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqa_sessionawaitable.h>
+
+// BMQ
+#include <bmqa_abstractsession.h>
+#include <bmqa_queueid.h>
+#include <bmqt_queueflags.h>
+#include <bmqt_resultcode.h>
+#include <bmqt_uri.h>
+
+// BDE
+#include <bsl_exception.h>
+#include <bsl_functional.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bsla_annotations.h>
+#include <bsls_platform.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+#if defined(BSLS_PLATFORM_CMP_CLANG)
+#pragma clang diagnostic ignored "-Wweak-vtables"
+#endif  // BSLS_PLATFORM_CMP_CLANG
+
+#ifdef BMQA_SESSIONAWAITABLE_HAS_COROUTINES
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// A fire-and-forget coroutine return type, starting eagerly and destroying
+/// its frame upon completion.
+struct Task {
+    struct promise_type {
+        Task get_return_object() { return Task(); }
+
+        std::suspend_never initial_suspend() noexcept { return {}; }
+
+        std::suspend_never final_suspend() noexcept { return {}; }
+
+        void return_void() {}
+
+        void unhandled_exception() { bsl::terminate(); }
+    };
+};
+
+/// A session recording the callbacks of the asynchronous queue operations,
+/// optionally completing them synchronously with a preset result.
+class TestSession : public bmqa::AbstractSession {
+  public:
+    // DATA
+    OpenQueueCallback      d_openCallback;
+    ConfigureQueueCallback d_configureCallback;
+    CloseQueueCallback     d_closeCallback;
+
+    bmqt::Uri           d_uri;
+    bsls::Types::Uint64 d_flags;
+
+    /// If set, `openQueueAsync` invokes the callback before returning.
+    bool d_completeInline;
+
+    // CREATORS
+    explicit TestSession(bslma::Allocator* allocator)
+    : d_openCallback(bsl::allocator_arg, allocator)
+    , d_configureCallback(bsl::allocator_arg, allocator)
+    , d_closeCallback(bsl::allocator_arg, allocator)
+    , d_uri(allocator)
+    , d_flags(0)
+    , d_completeInline(false)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+    using bmqa::AbstractSession::closeQueueAsync;
+    using bmqa::AbstractSession::configureQueueAsync;
+    using bmqa::AbstractSession::openQueueAsync;
+
+    void openQueueAsync(bmqa::QueueId*           queueId,
+                        const bmqt::Uri&         uri,
+                        bsls::Types::Uint64      flags,
+                        const OpenQueueCallback& callback,
+                        BSLA_UNUSED const bmqt::QueueOptions& options,
+                        BSLA_UNUSED const bsls::TimeInterval& timeout)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        d_uri   = uri;
+        d_flags = flags;
+
+        if (d_completeInline) {
+            bmqa::OpenQueueStatus status(*queueId,
+                                         bmqt::OpenQueueResult::e_TIMEOUT,
+                                         "inline",
+                                         bmqtst::TestHelperUtil::allocator());
+            callback(status);
+            return;  // RETURN
+        }
+
+        d_openCallback = callback;
+    }
+
+    void configureQueueAsync(BSLA_UNUSED bmqa::QueueId* queueId,
+                             BSLA_UNUSED const bmqt::QueueOptions& options,
+                             const ConfigureQueueCallback& callback,
+                             BSLA_UNUSED const bsls::TimeInterval& timeout)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        d_configureCallback = callback;
+    }
+
+    void closeQueueAsync(BSLA_UNUSED bmqa::QueueId* queueId,
+                         const CloseQueueCallback& callback,
+                         BSLA_UNUSED const bsls::TimeInterval& timeout)
+        BSLS_KEYWORD_OVERRIDE
+    {
+        d_closeCallback = callback;
+    }
+};
+
+/// An executor queuing the submitted functions until `runJobs` is called.
+class QueueExecutor {
+  private:
+    // DATA
+    bsl::vector<bsl::function<void()> >* d_jobs_p;
+
+  public:
+    // CREATORS
+    explicit QueueExecutor(bsl::vector<bsl::function<void()> >* jobs)
+    : d_jobs_p(jobs)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+    template <class FUNCTION>
+    void post(BSLS_COMPILERFEATURES_FORWARD_REF(FUNCTION) f) const
+    {
+        d_jobs_p->push_back(BSLS_COMPILERFEATURES_FORWARD(FUNCTION, f));
+    }
+
+    template <class FUNCTION>
+    void dispatch(BSLS_COMPILERFEATURES_FORWARD_REF(FUNCTION) f) const
+    {
+        d_jobs_p->push_back(BSLS_COMPILERFEATURES_FORWARD(FUNCTION, f));
+    }
+
+    // ACCESSORS
+    bool operator==(const QueueExecutor& rhs) const
+    {
+        return d_jobs_p == rhs.d_jobs_p;
+    }
+};
+
+/// Invoke all the jobs in the specified `jobs`, then clear it.
+void runJobs(bsl::vector<bsl::function<void()> >* jobs)
+{
+    bsl::vector<bsl::function<void()> > pending(
+        bmqtst::TestHelperUtil::allocator());
+    pending.swap(*jobs);
+    for (size_t i = 0; i < pending.size(); ++i) {
+        pending[i]();
+    }
+}
+
+/// Results observed by `openConfigureClose`.
+struct Results {
+    int                              d_step;
+    bmqt::OpenQueueResult::Enum      d_openResult;
+    bmqt::ConfigureQueueResult::Enum d_configureResult;
+    bmqt::CloseQueueResult::Enum     d_closeResult;
+
+    Results()
+    : d_step(0)
+    , d_openResult(bmqt::OpenQueueResult::e_UNKNOWN)
+    , d_configureResult(bmqt::ConfigureQueueResult::e_UNKNOWN)
+    , d_closeResult(bmqt::CloseQueueResult::e_UNKNOWN)
+    {
+        // NOTHING
+    }
+};
+
+/// Open, configure and close a queue on the specified `session` using the
+/// specified `queueId`, resuming through the specified `executor`, and
+/// record the outcome of each step into the specified `results`.  Stop
+/// after the open if it fails.
+Task openConfigureClose(TestSession*    session,
+                        bmqa::QueueId*  queueId,
+                        bmqex::Executor executor,
+                        Results*        results)
+{
+    bmqa::OpenQueueStatus openStatus =
+        co_await bmqa::SessionAwaitUtil::openQueue(
+            session,
+            queueId,
+            bmqt::Uri("bmq://bmq.test.mem.priority/q",
+                      bmqtst::TestHelperUtil::allocator()),
+            bmqt::QueueFlags::e_READ,
+            executor);
+    results->d_openResult = openStatus.result();
+    results->d_step       = 1;
+    if (!openStatus) {
+        co_return;  // RETURN
+    }
+
+    bmqa::ConfigureQueueStatus configureStatus =
+        co_await bmqa::SessionAwaitUtil::configureQueue(session,
+                                                        queueId,
+                                                        bmqt::QueueOptions(),
+                                                        executor);
+    results->d_configureResult = configureStatus.result();
+    results->d_step            = 2;
+
+    bmqa::CloseQueueStatus closeStatus =
+        co_await bmqa::SessionAwaitUtil::closeQueue(session,
+                                                    queueId,
+                                                    executor);
+    results->d_closeResult = closeStatus.result();
+    results->d_step        = 3;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   1. Awaiting each operation initiates it on the session.
+//   2. Without an executor, the coroutine resumes from within the
+//      completion callback with the provided result.
+//
+// Testing:
+//   SessionAwaitUtil::openQueue
+//   SessionAwaitUtil::configureQueue
+//   SessionAwaitUtil::closeQueue
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    TestSession   session(alloc);
+    bmqa::QueueId queueId(alloc);
+    Results       results;
+
+    openConfigureClose(&session, &queueId, bmqex::Executor(), &results);
+
+    BMQTST_ASSERT_EQ(results.d_step, 0);
+    BMQTST_ASSERT(session.d_openCallback);
+    BMQTST_ASSERT_EQ(session.d_uri.asString(),
+                     "bmq://bmq.test.mem.priority/q");
+    BMQTST_ASSERT_EQ(session.d_flags,
+                     static_cast<bsls::Types::Uint64>(
+                         bmqt::QueueFlags::e_READ));
+
+    session.d_openCallback(
+        bmqa::OpenQueueStatus(queueId,
+                              bmqt::OpenQueueResult::e_SUCCESS,
+                              "",
+                              alloc));
+    BMQTST_ASSERT_EQ(results.d_step, 1);
+    BMQTST_ASSERT_EQ(results.d_openResult, bmqt::OpenQueueResult::e_SUCCESS);
+    BMQTST_ASSERT(session.d_configureCallback);
+
+    session.d_configureCallback(
+        bmqa::ConfigureQueueStatus(queueId,
+                                   bmqt::ConfigureQueueResult::e_SUCCESS,
+                                   "",
+                                   alloc));
+    BMQTST_ASSERT_EQ(results.d_step, 2);
+    BMQTST_ASSERT_EQ(results.d_configureResult,
+                     bmqt::ConfigureQueueResult::e_SUCCESS);
+    BMQTST_ASSERT(session.d_closeCallback);
+
+    session.d_closeCallback(
+        bmqa::CloseQueueStatus(queueId,
+                               bmqt::CloseQueueResult::e_SUCCESS,
+                               "",
+                               alloc));
+    BMQTST_ASSERT_EQ(results.d_step, 3);
+    BMQTST_ASSERT_EQ(results.d_closeResult,
+                     bmqt::CloseQueueResult::e_SUCCESS);
+}
+
+static void test2_executorResumption()
+// ------------------------------------------------------------------------
+// EXECUTOR RESUMPTION
+//
+// Concerns:
+//   1. With an executor, the coroutine is not resumed from within the
+//      completion callback, but from a job dispatched to the executor.
+//
+// Testing:
+//   SessionAwaitable::await_suspend
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("EXECUTOR RESUMPTION");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    bsl::vector<bsl::function<void()> > jobs(alloc);
+    bmqex::Executor                     executor(QueueExecutor(&jobs), alloc);
+
+    TestSession   session(alloc);
+    bmqa::QueueId queueId(alloc);
+    Results       results;
+
+    openConfigureClose(&session, &queueId, executor, &results);
+
+    session.d_openCallback(
+        bmqa::OpenQueueStatus(queueId,
+                              bmqt::OpenQueueResult::e_SUCCESS,
+                              "",
+                              alloc));
+    BMQTST_ASSERT_EQ(results.d_step, 0);
+    BMQTST_ASSERT_EQ(jobs.size(), 1U);
+
+    runJobs(&jobs);
+    BMQTST_ASSERT_EQ(results.d_step, 1);
+
+    session.d_configureCallback(
+        bmqa::ConfigureQueueStatus(queueId,
+                                   bmqt::ConfigureQueueResult::e_TIMEOUT,
+                                   "",
+                                   alloc));
+    BMQTST_ASSERT_EQ(results.d_step, 1);
+
+    runJobs(&jobs);
+    BMQTST_ASSERT_EQ(results.d_step, 2);
+    BMQTST_ASSERT_EQ(results.d_configureResult,
+                     bmqt::ConfigureQueueResult::e_TIMEOUT);
+
+    session.d_closeCallback(
+        bmqa::CloseQueueStatus(queueId,
+                               bmqt::CloseQueueResult::e_SUCCESS,
+                               "",
+                               alloc));
+    BMQTST_ASSERT_EQ(results.d_step, 2);
+
+    runJobs(&jobs);
+    BMQTST_ASSERT_EQ(results.d_step, 3);
+    BMQTST_ASSERT(jobs.empty());
+}
+
+static void test3_inlineCompletion()
+// ------------------------------------------------------------------------
+// INLINE COMPLETION
+//
+// Concerns:
+//   1. If the session invokes the callback before returning from the
+//      asynchronous method, the coroutine does not suspend and continues
+//      in place, even if an executor is provided.
+//
+// Testing:
+//   SessionAwaitable::await_suspend
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("INLINE COMPLETION");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    bsl::vector<bsl::function<void()> > jobs(alloc);
+    bmqex::Executor                     executor(QueueExecutor(&jobs), alloc);
+
+    TestSession session(alloc);
+    session.d_completeInline = true;
+
+    bmqa::QueueId queueId(alloc);
+    Results       results;
+
+    openConfigureClose(&session, &queueId, executor, &results);
+
+    BMQTST_ASSERT_EQ(results.d_step, 1);
+    BMQTST_ASSERT_EQ(results.d_openResult, bmqt::OpenQueueResult::e_TIMEOUT);
+    BMQTST_ASSERT(jobs.empty());
+    BMQTST_ASSERT(!session.d_configureCallback);
+}
+
+#endif  // BMQA_SESSIONAWAITABLE_HAS_COROUTINES
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+#ifdef BMQA_SESSIONAWAITABLE_HAS_COROUTINES
+    case 3: test3_inlineCompletion(); break;
+    case 2: test2_executorResumption(); break;
+    case 1: test1_breathingTest(); break;
+#else
+    case 1: {
+        // Coroutines are not supported by the compiler: nothing to test.
+    } break;
+#endif  // BMQA_SESSIONAWAITABLE_HAS_COROUTINES
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_GBL_ALLOC);
+}
@@ -0,0 +1,1343 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BMQC_FLATORDEREDHASHMAP
+#define INCLUDED_BMQC_FLATORDEREDHASHMAP
+
+//@PURPOSE: Provide an open-addressing hash table with predictive iteration.
+//
+//@CLASSES:
+//  bmqc::FlatOrderedHashMap : Open-addressing ordered hash table.
+//
+//@SEE_ALSO: bmqc::OrderedHashMap
+//
+//@DESCRIPTION: 'bmqc::FlatOrderedHashMap' provides an associative container
+// with the same interface and the same iteration order guarantees as
+// 'bmqc::OrderedHashMap' (the iteration order is the order in which keys are
+// inserted in the container), but with a layout tuned for large containers
+// keyed by small, well hashed keys such as 'bmqt::MessageGUID':
+//
+//: o The hash table is an open-addressing table over a contiguous array of
+//:   8-byte slots, using linear probing and backward-shift deletion (no
+//:   tombstones).  Each slot holds 32 bits of the hash of its key, so that a
+//:   lookup only touches the element having the key in the common case.
+//:
+//: o Elements are stored in fixed-size blocks of nodes which are never moved,
+//:   and the insertion order is an intrusive doubly linked list of 32-bit
+//:   node indices.  Nodes are recycled through a free list, so that a
+//:   container at steady state does not allocate memory.
+//
+// Compared to 'bmqc::OrderedHashMap', whose nodes hold three pointers and are
+// allocated individually, and whose buckets hold two pointers, the memory
+// overhead per element is 8 bytes of links plus 8 bytes per slot at a load
+// factor between 3/8 and 3/4, and iterating, inserting or erasing elements
+// does not chase pointers across the whole heap.
+//
+// The local (bucket) iterators of 'bmqc::OrderedHashMap' have no equivalent
+// in an open-addressing table, and are not provided.  'bucket_count' returns
+// the number of slots of the table.
+//
+/// Behavior of insert() routine
+///----------------------------
+// As with 'bmqc::OrderedHashMap', the newly inserted element is always
+// constructed such that 'container.end()' before the 'insert()' operation
+// becomes the iterator of the newly inserted element, while 'rinsert()'
+// inserts the element at the beginning of the sequence and does not affect
+// the 'end()' iterator.
+//
+/// Iterator, pointer and reference invalidation
+///--------------------------------------------
+// No method of 'FlatOrderedHashMap' invalidates an iterator, a pointer or a
+// reference to an element in the container, unless it also erases that
+// element, such as any 'erase' overload, 'clear', or the destructor (that
+// erases all elements).  Iterators, pointers and references are stable
+// through a rehash, which only moves the slots of the table.
+//
+/// Exception Safety
+///----------------
+// At this time, this component provides *no* exception safety guarantee.
+//
+/// Thread Safety
+///-------------
+// Not thread safe.
+//
+/// Usage
+///-----
+//..
+//  typedef bmqc::FlatOrderedHashMap<bmqt::MessageGUID,
+//                                   Message,
+//                                   bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+//      Stream;
+//
+//  Stream stream(allocator);
+//  stream.reserve(1024 * 1024);
+//
+//  Stream::iterator last = stream.end();
+//  stream.insert(bsl::make_pair(guid, message));
+//
+//  // 'last' now refers to the element of 'guid'.
+//..
+
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_type_traits.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+#include <bslalg_scalarprimitives.h>
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+namespace bmqc {
+
+// FORWARD DECLARATION
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+class FlatOrderedHashMap;
+
+// ==============================
+// struct FlatOrderedHashMap_Link
+// ==============================
+
+/// This struct links a node of `bmqc::FlatOrderedHashMap` to its neighbours
+/// in the insertion order, or to the next node in the free list.
+///
+/// PRIVATE STRUCT. For use only by `bmqc::FlatOrderedHashMap`
+/// implementation.
+struct FlatOrderedHashMap_Link {
+    // CONSTANTS
+
+    /// Index of no node.
+    static const bsls::Types::Uint32 k_NIL = 0xFFFFFFFFu;
+
+    // DATA
+    bsls::Types::Uint32 d_next;
+
+    bsls::Types::Uint32 d_prev;
+};
+
+// ==============================
+// struct FlatOrderedHashMap_Node
+// ==============================
+
+/// This struct is a node of `bmqc::FlatOrderedHashMap`, holding an element
+/// which is constructed only when the node is in use.
+///
+/// PRIVATE STRUCT. For use only by `bmqc::FlatOrderedHashMap`
+/// implementation.
+template <class VALUE>
+struct FlatOrderedHashMap_Node : public FlatOrderedHashMap_Link {
+    // DATA
+    bsls::ObjectBuffer<VALUE> d_value;
+};
+
+// ==============================
+// class FlatOrderedHashMap_Nodes
+// ==============================
+
+/// This class stores the nodes of `bmqc::FlatOrderedHashMap` in blocks
+/// which are never moved, and recycles them through a free list.  Note that
+/// this class does not construct nor destroy the elements of the nodes.
+///
+/// PRIVATE CLASS TEMPLATE. For use only by `bmqc::FlatOrderedHashMap`
+/// implementation.
+template <class VALUE>
+class FlatOrderedHashMap_Nodes {
+  public:
+    // TYPES
+    typedef FlatOrderedHashMap_Node<VALUE> Node;
+
+  private:
+    // PRIVATE TYPES
+    enum {
+        /// Log2 of the number of nodes per block
+        k_BLOCK_SHIFT = 10,
+        k_BLOCK_SIZE  = 1 << k_BLOCK_SHIFT,
+        k_BLOCK_MASK  = k_BLOCK_SIZE - 1
+    };
+
+    // DATA
+    bsl::vector<Node*> d_blocks;
+
+    /// Number of nodes handed out from the blocks, used or free.
+    bsls::Types::Uint32 d_numNodes;
+
+    /// First node of the free list, or `k_NIL`.
+    bsls::Types::Uint32 d_freeList;
+
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    // NOT IMPLEMENTED
+    FlatOrderedHashMap_Nodes(const FlatOrderedHashMap_Nodes&)
+        BSLS_KEYWORD_DELETED;
+    FlatOrderedHashMap_Nodes&
+    operator=(const FlatOrderedHashMap_Nodes&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create an empty node storage using the specified `allocator`.
+    explicit FlatOrderedHashMap_Nodes(bslma::Allocator* allocator);
+
+    /// Destroy this object, releasing the memory of all the nodes.
+    ~FlatOrderedHashMap_Nodes();
+
+    // MANIPULATORS
+
+    /// Return the index of an unused node.
+    bsls::Types::Uint32 allocate();
+
+    /// Return the node at the specified `index` to the free list.
+    void release(bsls::Types::Uint32 index);
+
+    // ACCESSORS
+
+    /// Return the node at the specified `index`.  Note that the node is
+    /// modifiable, as nodes are owned by the blocks and not by this object.
+    Node& node(bsls::Types::Uint32 index) const;
+};
+
+// =================================
+// class FlatOrderedHashMap_Iterator
+// =================================
+
+/// This class provides a bidirectional iterator over the elements of a
+/// `bmqc::FlatOrderedHashMap`, in insertion order.
+///
+/// PRIVATE CLASS TEMPLATE. For use only by `bmqc::FlatOrderedHashMap`
+/// implementation.
+template <class VALUE>
+class FlatOrderedHashMap_Iterator {
+  private:
+    // PRIVATE TYPES
+    typedef typename bsl::remove_cv<VALUE>::type NcType;
+
+    typedef FlatOrderedHashMap_Iterator<NcType> NcIter;
+
+    typedef FlatOrderedHashMap_Nodes<NcType> Nodes;
+
+    // FRIENDS
+    template <class FHM_KEY,
+              class FHM_VALUE,
+              class FHM_HASH,
+              typename FHM_VALUE_TYPE>
+    friend class FlatOrderedHashMap;
+
+    friend class FlatOrderedHashMap_Iterator<const VALUE>;
+
+    template <class VALUE1, class VALUE2>
+    friend bool operator==(const FlatOrderedHashMap_Iterator<VALUE1>&,
+                           const FlatOrderedHashMap_Iterator<VALUE2>&);
+
+    // DATA
+    const Nodes* d_nodes_p;
+
+    bsls::Types::Uint32 d_index;
+
+  private:
+    // PRIVATE CREATORS
+
+    /// Create an iterator referring to the node at the specified `index` in
+    /// the specified `nodes`.
+    FlatOrderedHashMap_Iterator(const Nodes* nodes, bsls::Types::Uint32 index);
+
+  public:
+    // CREATORS
+
+    /// Create a singular iterator (i.e., one that cannot be incremented,
+    /// decremented, or dereferenced.
+    FlatOrderedHashMap_Iterator();
+
+    /// Create an iterator to `VALUE` from the corresponding iterator to
+    /// non-const `VALUE`.  If `VALUE` is not const-qualified, then this
+    /// constructor becomes the copy constructor.  Otherwise, the copy
+    /// constructor is implicitly generated.
+    FlatOrderedHashMap_Iterator(const NcIter& other);
+
+    // MANIPULATORS
+
+    /// Copy the value of the specified `rhs` to this iterator.  Return a
+    /// reference to this modifiable object.
+    FlatOrderedHashMap_Iterator& operator=(const NcIter& rhs);
+
+    /// Advance this iterator to the next element in the sequential list and
+    /// return its new value.  The behavior is undefined unless this
+    /// iterator is in the range `[begin() .. end())`.
+    FlatOrderedHashMap_Iterator& operator++();
+
+    /// Move this iterator to the previous element in the sequential list
+    /// and return its new value.  The behavior is undefined unless this
+    /// iterator is in the range `(begin() .. end()]`.
+    FlatOrderedHashMap_Iterator& operator--();
+
+    /// Advance this iterator to the next element in the sequential list and
+    /// return its previous value.  The behavior is undefined unless this
+    /// iterator is in the range `[begin() .. end())`.
+    FlatOrderedHashMap_Iterator operator++(int);
+
+    /// Move this iterator to the previous element in the sequential list
+    /// and return its previous value.  The behavior is undefined unless
+    /// this iterator is in the range `(begin() .. end()]`.
+    FlatOrderedHashMap_Iterator operator--(int);
+
+    // ACCESSORS
+
+    /// Return a reference to the element referred to by this iterator.  The
+    /// behavior is undefined unless this iterator is in the range
+    /// `[begin() .. end())`.
+    VALUE& operator*() const;
+
+    /// Return a pointer to the element referred to by this iterator.  The
+    /// behavior is undefined unless this iterator is in the range
+    /// `[begin() .. end())`.
+    VALUE* operator->() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified iterators `lhs` and `rhs` have the same
+/// value and `false` otherwise.  Two iterators have the same value if both
+/// refer to the same element of the same container or both are singular.
+template <class VALUE1, class VALUE2>
+bool operator==(const FlatOrderedHashMap_Iterator<VALUE1>& lhs,
+                const FlatOrderedHashMap_Iterator<VALUE2>& rhs);
+
+/// Return `true` if the specified iterators `lhs` and `rhs` do not have the
+/// same value and `false` otherwise.  Two iterators do not have the same
+/// value if they differ in either the container or the element to which
+/// they refer.
+template <class VALUE1, class VALUE2>
+bool operator!=(const FlatOrderedHashMap_Iterator<VALUE1>& lhs,
+                const FlatOrderedHashMap_Iterator<VALUE2>& rhs);
+
+// ==============================
+// struct FlatOrderedHashMap_Slot
+// ==============================
+
+/// This struct is a slot of the open-addressing table of
+/// `bmqc::FlatOrderedHashMap`.
+///
+/// PRIVATE STRUCT. For use only by `bmqc::FlatOrderedHashMap`
+/// implementation.
+struct FlatOrderedHashMap_Slot {
+    // DATA
+
+    /// 32 bits of the hash of the key of the element.
+    bsls::Types::Uint32 d_hash;
+
+    /// Index of the node of the element, or `k_NIL` if the slot is empty.
+    bsls::Types::Uint32 d_node;
+};
+
+// ========================
+// class FlatOrderedHashMap
+// ========================
+
+/// Open-addressing hash table with predictive iteration order.
+template <class KEY,
+          class VALUE,
+          class HASH       = bsl::hash<KEY>,
+          class VALUE_TYPE = bsl::pair<const KEY, VALUE> >
+class FlatOrderedHashMap {
+  private:
+    // PRIVATE TYPES
+    typedef VALUE_TYPE ValueType;
+
+    typedef FlatOrderedHashMap_Link             Link;
+    typedef FlatOrderedHashMap_Slot             Slot;
+    typedef FlatOrderedHashMap_Nodes<ValueType> Nodes;
+    typedef typename Nodes::Node                Node;
+
+    enum {
+        /// Must be a power of 2.
+        k_MIN_NUM_SLOTS = 16
+    };
+
+  public:
+    // TYPES
+    typedef KEY key_type;
+
+    typedef ValueType value_type;
+
+    typedef bslma::Allocator* allocator_type;
+
+    typedef HASH hasher;
+
+    typedef FlatOrderedHashMap_Iterator<value_type> iterator;
+
+    typedef FlatOrderedHashMap_Iterator<const value_type> const_iterator;
+
+  private:
+    // DATA
+    bslma::Allocator* d_allocator_p;
+
+    Nodes d_nodes;  // Owns all nodes
+
+    bsl::vector<Slot> d_slots;
+
+    /// `32 - log2(d_slots.size())`, to map a hash to its home slot.
+    int d_shift;
+
+    bsls::Types::Uint32 d_sentinel;  // end()
+
+    size_t d_numElements;
+
+    HASH d_hasher;
+
+  private:
+    // PRIVATE ACCESSORS
+
+    /// Return the 32 bits of the hash of the specified `key` stored in the
+    /// slots.
+    bsls::Types::Uint32 hashOf(const key_type& key) const;
+
+    /// Return the position of the home slot of the specified `hash`.
+    size_t homeOf(bsls::Types::Uint32 hash) const;
+
+    /// Return the position of the slot of the element having the specified
+    /// `key` whose hash is the specified `hash` if such an element exists,
+    /// and the position of the empty slot terminating the probe sequence of
+    /// `key` otherwise.
+    size_t findSlot(const key_type& key, bsls::Types::Uint32 hash) const;
+
+    /// Return the element of the node at the specified `index`.
+    ValueType& valueOf(bsls::Types::Uint32 index) const;
+
+    // PRIVATE MANIPULATORS
+
+    /// Create the sentinel and the table of the specified `numSlots`.  The
+    /// behavior is undefined unless `numSlots` is a power of 2.
+    void initialize(size_t numSlots);
+
+    /// Rebuild the table with the specified `numSlots`.  The behavior is
+    /// undefined unless `numSlots` is a power of 2 greater than the number
+    /// of elements.
+    void rehash(size_t numSlots);
+
+    /// Double the number of slots if inserting one element would exceed
+    /// the maximum load factor, and return true.  Return false otherwise.
+    bool rehashIfNeeded();
+
+    /// Insert the specified `value` having the specified `hash` into the
+    /// node at the specified `index`, and occupy the empty slot at the
+    /// specified `position` with it.
+    void emplace(bsls::Types::Uint32 index,
+                 size_t              position,
+                 bsls::Types::Uint32 hash,
+                 const value_type&   value);
+
+    /// Link the node at the specified `index` after the node at the
+    /// specified `prev` in the sequential list.
+    void linkAfter(bsls::Types::Uint32 index, bsls::Types::Uint32 prev);
+
+    /// Empty the slot at the specified `position`, shifting back the slots
+    /// following it in their probe sequence.
+    void eraseSlot(size_t position);
+
+    /// Remove the element of the node at the specified `index` from the
+    /// container, and return the index of the node following it.
+    bsls::Types::Uint32 eraseNode(bsls::Types::Uint32 index);
+
+    // PRIVATE CLASS METHODS
+    static const key_type& get_key(const bsl::pair<const KEY, VALUE>& value)
+    {
+        return value.first;
+    }
+
+    static const key_type& get_key(const KEY& value) { return value; }
+
+    /// Return the number of slots for the specified `numElements` not
+    /// exceeding the maximum load factor.
+    static size_t numSlotsFor(size_t numElements);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatOrderedHashMap,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty `FlatOrderedHashMap` object with a maximum load
+    /// factor of 0.75.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  Use a default constructed object of the (template
+    /// parameter) type `HASH` to organize elements in the table.
+    explicit FlatOrderedHashMap(bslma::Allocator* basicAllocator = 0);
+
+    /// Create an empty `FlatOrderedHashMap` which can hold the specified
+    /// `initialNumBuckets` elements without rehashing, with a maximum load
+    /// factor of 0.75.  Optionally specify a `basicAllocator` used to supply
+    /// memory.  The behavior is undefined unless `0 < initialNumBuckets`.
+    explicit FlatOrderedHashMap(size_t            initialNumBuckets,
+                                bslma::Allocator* basicAllocator = 0);
+
+    /// Create a `FlatOrderedHashMap` having the same value as the specified
+    /// `other`, that will use the optionally specified `basicAllocator` to
+    /// supply memory.
+    FlatOrderedHashMap(const FlatOrderedHashMap& other,
+                       bslma::Allocator*         basicAllocator = 0);
+
+    /// Destroy this object and each of its elements.
+    ~FlatOrderedHashMap();
+
+    // MANIPULATORS
+
+    /// Assign to this object the value of the specified `other` object.
+    FlatOrderedHashMap& operator=(const FlatOrderedHashMap& other);
+
+    /// Return a mutating iterator referring to the first element in the
+    /// container, if any, or one past the end of this container if there
+    /// are no elements.
+    iterator begin();
+
+    /// Return a mutating iterator referring to one past the end of this
+    /// container.
+    iterator end();
+
+    /// Remove all entries from this container.  Note that this container
+    /// will be empty after calling this method, but allocated memory is
+    /// retained for future use.
+    void clear();
+
+    /// Remove from this container the `value_type` object at the specified
+    /// `position`, and return an iterator referring to the element
+    /// immediately following the removed element, or to the past-the-end
+    /// position if the removed element was the last element in the sequence
+    /// of elements maintained by this container.  The behavior is undefined
+    /// unless `position` refers to a `value_type` object in this container.
+    iterator erase(const_iterator position);
+
+    /// Remove from this container the `value_type` object having the
+    /// specified `key`, if it exists, and return 1; otherwise (there is no
+    /// `value_type` object having `key` in this container) return 0 with no
+    /// other effect.
+    size_t erase(const key_type& key);
+
+    /// Remove from this container the sequence of elements starting at the
+    /// specified `first` position and ending before the specified `last`
+    /// position, and return an iterator providing modifiable access to the
+    /// element immediately following the last removed element, or the
+    /// position returned by the method `end` if the removed elements were
+    /// last in the sequence.  The behavior is undefined unless `first` is
+    /// an iterator in the range `[begin() .. end()]` (both endpoints
+    /// included) and `last` is an iterator in the range `[first .. end()]`
+    /// (both endpoints included).
+    const_iterator erase(const_iterator first, const_iterator last);
+
+    /// Return an iterator providing modifiable access to the `value_type`
+    /// object in this container having the specified `key`, if such an
+    /// entry exists, and the past-the-end iterator (`end`) otherwise.
+    iterator find(const key_type& key);
+
+    /// Insert the specified `value` into this container at the end of the
+    /// underlying sequential list if the key of `value` does not already
+    /// exist in this container; otherwise, this method has no effect.
+    /// Return a `pair` whose `first` member is an iterator referring to the
+    /// (possibly newly inserted) `value_type` object in this container
+    /// whose key is the same as that of `value`, and whose `second` member
+    /// is `true` if a new value was inserted, and `false` if the value was
+    /// already present.  Note that the iterator of a newly inserted element
+    /// is the `end` iterator before the insertion.
+    bsl::pair<iterator, bool> insert(const VALUE_TYPE& value);
+
+    /// Insert the specified `value` into this container at the beginning of
+    /// the underlying sequential list if the key of `value` does not already
+    /// exist in this container; otherwise, this method has no effect.
+    /// Return a `pair` whose `first` member is an iterator referring to the
+    /// (possibly newly inserted) `value_type` object in this container
+    /// whose key is the same as that of `value`, and whose `second` member
+    /// is `true` if a new value was inserted, and `false` if the value was
+    /// already present.
+    bsl::pair<iterator, bool> rinsert(const VALUE_TYPE& value);
+
+    /// Increase the number of slots of this container so that it can hold
+    /// the specified `numElements` without rehashing.  Note that this
+    /// operation has no effect if the container can already hold
+    /// `numElements`.
+    void reserve(size_t numElements);
+
+    // ACCESSORS
+
+    /// Return an iterator providing non-modifiable access to the first
+    /// `value_type` object in the sequence of `value_type` objects
+    /// maintained by this container, or the `end` iterator if this
+    /// container is empty.
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+
+    /// Return an iterator providing non-modifiable access to the
+    /// past-the-end element in the sequence of `value_type` objects
+    /// maintained by this container.
+    const_iterator end() const;
+    const_iterator cend() const;
+
+    /// Return the number of slots in the open-addressing table maintained
+    /// by this container.
+    size_t bucket_count() const;
+
+    /// Return the number of `value_type` objects contained within this
+    /// container having the specified `key`.  Note that since an ordered
+    /// hash map maintains unique keys, the returned value will be either 0
+    /// or 1.
+    size_t count(const key_type& key) const;
+
+    /// Return `true` if this container contains no elements, and `false`
+    /// otherwise.
+    bool empty() const;
+
+    /// Return an iterator providing non-modifiable access to the
+    /// `value_type` object in this container having the specified `key`, if
+    /// such an entry exists, and the past-the-end iterator (`end`)
+    /// otherwise.
+    const_iterator find(const key_type& key) const;
+
+    /// Return the number of elements in this container.
+    size_t size() const;
+
+    /// Return the current ratio between the `size` of this container and
+    /// the number of slots.
+    double load_factor() const;
+
+    /// Return the allocator associated with this object.
+    allocator_type get_allocator() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ------------------------------
+// class FlatOrderedHashMap_Nodes
+// ------------------------------
+
+// CREATORS
+template <class VALUE>
+inline FlatOrderedHashMap_Nodes<VALUE>::FlatOrderedHashMap_Nodes(
+    bslma::Allocator* allocator)
+: d_blocks(allocator)
+, d_numNodes(0)
+, d_freeList(FlatOrderedHashMap_Link::k_NIL)
+, d_allocator_p(allocator)
+{
+}
+
+template <class VALUE>
+inline FlatOrderedHashMap_Nodes<VALUE>::~FlatOrderedHashMap_Nodes()
+{
+    for (size_t i = 0; i < d_blocks.size(); ++i) {
+        d_allocator_p->deallocate(d_blocks[i]);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE>
+inline bsls::Types::Uint32 FlatOrderedHashMap_Nodes<VALUE>::allocate()
+{
+    if (d_freeList != FlatOrderedHashMap_Link::k_NIL) {
+        const bsls::Types::Uint32 index = d_freeList;
+        d_freeList                      = node(index).d_next;
+        return index;  // RETURN
+    }
+
+    if ((d_numNodes & k_BLOCK_MASK) == 0) {
+        // All blocks are full.
+        d_blocks.push_back(static_cast<Node*>(
+            d_allocator_p->allocate(sizeof(Node) * k_BLOCK_SIZE)));
+    }
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_numNodes != FlatOrderedHashMap_Link::k_NIL);
+
+    return d_numNodes++;
+}
+
+template <class VALUE>
+inline void
+FlatOrderedHashMap_Nodes<VALUE>::release(bsls::Types::Uint32 index)
+{
+    node(index).d_next = d_freeList;
+    d_freeList         = index;
+}
+
+// ACCESSORS
+template <class VALUE>
+inline typename FlatOrderedHashMap_Nodes<VALUE>::Node&
+FlatOrderedHashMap_Nodes<VALUE>::node(bsls::Types::Uint32 index) const
+{
+    BSLS_ASSERT_SAFE(index < d_numNodes);
+
+    return d_blocks[index >> k_BLOCK_SHIFT][index & k_BLOCK_MASK];
+}
+
+// ---------------------------------
+// class FlatOrderedHashMap_Iterator
+// ---------------------------------
+
+template <class VALUE>
+inline FlatOrderedHashMap_Iterator<VALUE>::FlatOrderedHashMap_Iterator(
+    const Nodes*        nodes,
+    bsls::Types::Uint32 index)
+: d_nodes_p(nodes)
+, d_index(index)
+{
+}
+
+template <class VALUE>
+inline FlatOrderedHashMap_Iterator<VALUE>::FlatOrderedHashMap_Iterator()
+: d_nodes_p(0)
+, d_index(FlatOrderedHashMap_Link::k_NIL)
+{
+}
+
+template <class VALUE>
+inline FlatOrderedHashMap_Iterator<VALUE>::FlatOrderedHashMap_Iterator(
+    const NcIter& other)
+: d_nodes_p(other.d_nodes_p)
+, d_index(other.d_index)
+{
+}
+
+// MANIPULATORS
+template <class VALUE>
+inline FlatOrderedHashMap_Iterator<VALUE>&
+FlatOrderedHashMap_Iterator<VALUE>::operator=(const NcIter& rhs)
+{
+    d_nodes_p = rhs.d_nodes_p;
+    d_index   = rhs.d_index;
+    return *this;
+}
+
+template <class VALUE>
+inline FlatOrderedHashMap_Iterator<VALUE>&
+FlatOrderedHashMap_Iterator<VALUE>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_nodes_p);
+    d_index = d_nodes_p->node(d_index).d_next;
+    return *this;
+}
+
+template <class VALUE>
+inline FlatOrderedHashMap_Iterator<VALUE>&
+FlatOrderedHashMap_Iterator<VALUE>::operator--()
+{
+    BSLS_ASSERT_SAFE(d_nodes_p);
+    d_index = d_nodes_p->node(d_index).d_prev;
+    return *this;
+}
+
+template <class VALUE>
+inline FlatOrderedHashMap_Iterator<VALUE>
+FlatOrderedHashMap_Iterator<VALUE>::operator++(int)
+{
+    FlatOrderedHashMap_Iterator<VALUE> rc(*this);
+    ++(*this);
+    return rc;
+}
+
+template <class VALUE>
+inline FlatOrderedHashMap_Iterator<VALUE>
+FlatOrderedHashMap_Iterator<VALUE>::operator--(int)
+{
+    FlatOrderedHashMap_Iterator<VALUE> rc(*this);
+    --(*this);
+    return rc;
+}
+
+// ACCESSORS
+template <class VALUE>
+inline VALUE& FlatOrderedHashMap_Iterator<VALUE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_nodes_p);
+    return d_nodes_p->node(d_index).d_value.object();
+}
+
+template <class VALUE>
+inline VALUE* FlatOrderedHashMap_Iterator<VALUE>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_nodes_p);
+    return &(d_nodes_p->node(d_index).d_value.object());
+}
+
+// FREE OPERATORS
+template <class VALUE1, class VALUE2>
+inline bool operator==(const FlatOrderedHashMap_Iterator<VALUE1>& lhs,
+                       const FlatOrderedHashMap_Iterator<VALUE2>& rhs)
+{
+    return lhs.d_nodes_p == rhs.d_nodes_p && lhs.d_index == rhs.d_index;
+}
+
+template <class VALUE1, class VALUE2>
+inline bool operator!=(const FlatOrderedHashMap_Iterator<VALUE1>& lhs,
+                       const FlatOrderedHashMap_Iterator<VALUE2>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// ------------------------
+// class FlatOrderedHashMap
+// ------------------------
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline bsls::Types::Uint32
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::hashOf(
+    const key_type& key) const
+{
+    const bsls::Types::Uint64 hash = static_cast<bsls::Types::Uint64>(
+        d_hasher(key));
+
+    return static_cast<bsls::Types::Uint32>(hash ^ (hash >> 32));
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::homeOf(
+    bsls::Types::Uint32 hash) const
+{
+    // Fibonacci hashing, so that poorly distributed hashes (e.g., of
+    // consecutive integers) do not cluster.
+    return static_cast<bsls::Types::Uint32>(hash * 2654435769u) >> d_shift;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::findSlot(
+    const key_type&     key,
+    bsls::Types::Uint32 hash) const
+{
+    const size_t mask     = d_slots.size() - 1;
+    size_t       position = homeOf(hash);
+
+    while (true) {
+        const Slot& slot = d_slots[position];
+        if (slot.d_node == Link::k_NIL) {
+            return position;  // RETURN
+        }
+        if (slot.d_hash == hash && get_key(valueOf(slot.d_node)) == key) {
+            return position;  // RETURN
+        }
+        position = (position + 1) & mask;
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::ValueType&
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::valueOf(
+    bsls::Types::Uint32 index) const
+{
+    return d_nodes.node(index).d_value.object();
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline void
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::initialize(size_t numSlots)
+{
+    BSLS_ASSERT_SAFE(numSlots >= k_MIN_NUM_SLOTS);
+    BSLS_ASSERT_SAFE((numSlots & (numSlots - 1)) == 0);
+
+    d_sentinel = d_nodes.allocate();
+
+    Node& sentinel  = d_nodes.node(d_sentinel);
+    sentinel.d_next = d_sentinel;
+    sentinel.d_prev = d_sentinel;
+
+    rehash(numSlots);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline void
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::rehash(size_t numSlots)
+{
+    BSLS_ASSERT_SAFE((numSlots & (numSlots - 1)) == 0);
+    BSLS_ASSERT_SAFE(numSlots > d_numElements);
+
+    const Slot emptySlot = {0, Link::k_NIL};
+
+    bsl::vector<Slot> slots(numSlots, emptySlot, d_allocator_p);
+    d_slots.swap(slots);
+
+    d_shift = 32;
+    for (size_t n = numSlots; n > 1; n >>= 1) {
+        --d_shift;
+    }
+
+    // Only the slots move; the nodes, and therefore the iterators, are
+    // unaffected.
+    const size_t mask = numSlots - 1;
+    for (size_t i = 0; i < slots.size(); ++i) {
+        const Slot& slot = slots[i];
+        if (slot.d_node == Link::k_NIL) {
+            continue;  // CONTINUE
+        }
+
+        size_t position = homeOf(slot.d_hash);
+        while (d_slots[position].d_node != Link::k_NIL) {
+            position = (position + 1) & mask;
+        }
+        d_slots[position] = slot;
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline bool FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::rehashIfNeeded()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY((d_numElements + 1) * 4 <=
+                                            d_slots.size() * 3)) {
+        return false;  // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    rehash(d_slots.size() * 2);
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline void FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::emplace(
+    bsls::Types::Uint32 index,
+    size_t              position,
+    bsls::Types::Uint32 hash,
+    const value_type&   value)
+{
+    BSLS_ASSERT_SAFE(d_slots[position].d_node == Link::k_NIL);
+
+    bslalg::ScalarPrimitives::copyConstruct(
+        d_nodes.node(index).d_value.address(),
+        value,
+        d_allocator_p);
+
+    d_slots[position].d_hash = hash;
+    d_slots[position].d_node = index;
+    ++d_numElements;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline void FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::linkAfter(
+    bsls::Types::Uint32 index,
+    bsls::Types::Uint32 prev)
+{
+    Node& node     = d_nodes.node(index);
+    Node& prevNode = d_nodes.node(prev);
+
+    node.d_prev                          = prev;
+    node.d_next                          = prevNode.d_next;
+    d_nodes.node(prevNode.d_next).d_prev = index;
+    prevNode.d_next                      = index;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline void
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::eraseSlot(size_t position)
+{
+    const size_t mask = d_slots.size() - 1;
+
+    size_t hole = position;
+    size_t next = (position + 1) & mask;
+
+    while (d_slots[next].d_node != Link::k_NIL) {
+        // The slot at 'next' can fill the hole unless its home is in the
+        // cyclic range '(hole .. next]'.
+        const size_t home = homeOf(d_slots[next].d_hash);
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            d_slots[hole] = d_slots[next];
+            hole          = next;
+        }
+        next = (next + 1) & mask;
+    }
+
+    d_slots[hole].d_node = Link::k_NIL;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline bsls::Types::Uint32
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::eraseNode(
+    bsls::Types::Uint32 index)
+{
+    BSLS_ASSERT_SAFE(index != d_sentinel);
+
+    Node&      node  = d_nodes.node(index);
+    ValueType& value = node.d_value.object();
+
+    // Find the slot of the node.
+    const size_t mask     = d_slots.size() - 1;
+    size_t       position = homeOf(hashOf(get_key(value)));
+    while (d_slots[position].d_node != index) {
+        BSLS_ASSERT_SAFE(d_slots[position].d_node != Link::k_NIL);
+        position = (position + 1) & mask;
+    }
+    eraseSlot(position);
+
+    const bsls::Types::Uint32 next   = node.d_next;
+    d_nodes.node(node.d_prev).d_next = next;
+    d_nodes.node(next).d_prev        = node.d_prev;
+
+    value.~ValueType();
+    d_nodes.release(index);
+    --d_numElements;
+
+    return next;
+}
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::numSlotsFor(
+    size_t numElements)
+{
+    size_t numSlots = k_MIN_NUM_SLOTS;
+    while (numElements * 4 > numSlots * 3) {
+        numSlots *= 2;
+    }
+    return numSlots;
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::FlatOrderedHashMap(
+    bslma::Allocator* basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_nodes(d_allocator_p)
+, d_slots(d_allocator_p)
+, d_shift(32)
+, d_sentinel(Link::k_NIL)
+, d_numElements(0)
+, d_hasher()
+{
+    initialize(k_MIN_NUM_SLOTS);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::FlatOrderedHashMap(
+    size_t            initialNumBuckets,
+    bslma::Allocator* basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_nodes(d_allocator_p)
+, d_slots(d_allocator_p)
+, d_shift(32)
+, d_sentinel(Link::k_NIL)
+, d_numElements(0)
+, d_hasher()
+{
+    BSLS_ASSERT_SAFE(0 < initialNumBuckets);
+
+    initialize(numSlotsFor(initialNumBuckets));
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::FlatOrderedHashMap(
+    const FlatOrderedHashMap& other,
+    bslma::Allocator*         basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_nodes(d_allocator_p)
+, d_slots(d_allocator_p)
+, d_shift(32)
+, d_sentinel(Link::k_NIL)
+, d_numElements(0)
+, d_hasher(other.d_hasher)
+{
+    initialize(numSlotsFor(other.size()));
+
+    for (const_iterator it = other.begin(); it != other.end(); ++it) {
+        insert(*it);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::~FlatOrderedHashMap()
+{
+    clear();
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>&
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::operator=(
+    const FlatOrderedHashMap& other)
+{
+    if (this == &other) {
+        return *this;  // RETURN
+    }
+
+    clear();
+    reserve(other.size());
+
+    for (const_iterator it = other.begin(); it != other.end(); ++it) {
+        insert(*it);
+    }
+
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::begin()
+{
+    return iterator(&d_nodes, d_nodes.node(d_sentinel).d_next);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::end()
+{
+    return iterator(&d_nodes, d_sentinel);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline void FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::clear()
+{
+    Node&               sentinel = d_nodes.node(d_sentinel);
+    bsls::Types::Uint32 index    = sentinel.d_next;
+
+    while (index != d_sentinel) {
+        Node&                     node = d_nodes.node(index);
+        const bsls::Types::Uint32 next = node.d_next;
+
+        node.d_value.object().~ValueType();
+        d_nodes.release(index);
+        index = next;
+    }
+
+    sentinel.d_next = d_sentinel;
+    sentinel.d_prev = d_sentinel;
+
+    const Slot emptySlot = {0, Link::k_NIL};
+    bsl::fill(d_slots.begin(), d_slots.end(), emptySlot);
+
+    d_numElements = 0;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::erase(
+    const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position.d_nodes_p == &d_nodes);
+    BSLS_ASSERT_SAFE(position.d_index != d_sentinel);
+
+    return iterator(&d_nodes, eraseNode(position.d_index));
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::erase(const key_type& key)
+{
+    const size_t position = findSlot(key, hashOf(key));
+    if (d_slots[position].d_node == Link::k_NIL) {
+        return 0;  // RETURN
+    }
+
+    eraseNode(d_slots[position].d_node);
+    return 1;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
+    FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::erase(
+        const_iterator first,
+        const_iterator last)
+{
+    BSLS_ASSERT_SAFE(first.d_nodes_p == &d_nodes);
+    BSLS_ASSERT_SAFE(last.d_nodes_p == &d_nodes);
+
+    bsls::Types::Uint32 index = first.d_index;
+    while (index != last.d_index) {
+        index = eraseNode(index);
+    }
+
+    return last;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::find(const key_type& key)
+{
+    const bsls::Types::Uint32 node = d_slots[findSlot(key, hashOf(key))]
+                                         .d_node;
+
+    return iterator(&d_nodes, node == Link::k_NIL ? d_sentinel : node);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline bsl::pair<
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator,
+    bool>
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::insert(
+    const VALUE_TYPE& value)
+{
+    const key_type&           key      = get_key(value);
+    const bsls::Types::Uint32 hash     = hashOf(key);
+    size_t                    position = findSlot(key, hash);
+
+    if (d_slots[position].d_node != Link::k_NIL) {
+        return bsl::make_pair(iterator(&d_nodes, d_slots[position].d_node),
+                              false);  // RETURN
+    }
+
+    if (rehashIfNeeded()) {
+        position = findSlot(key, hash);
+    }
+
+    // The sentinel becomes the node of the new element, so that the 'end'
+    // iterator before the insertion refers to the new element, and a new
+    // sentinel is linked after it.
+    const bsls::Types::Uint32 index    = d_sentinel;
+    const bsls::Types::Uint32 sentinel = d_nodes.allocate();
+
+    linkAfter(sentinel, index);
+    d_sentinel = sentinel;
+
+    emplace(index, position, hash, value);
+
+    return bsl::make_pair(iterator(&d_nodes, index), true);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline bsl::pair<
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator,
+    bool>
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::rinsert(
+    const VALUE_TYPE& value)
+{
+    const key_type&           key      = get_key(value);
+    const bsls::Types::Uint32 hash     = hashOf(key);
+    size_t                    position = findSlot(key, hash);
+
+    if (d_slots[position].d_node != Link::k_NIL) {
+        return bsl::make_pair(iterator(&d_nodes, d_slots[position].d_node),
+                              false);  // RETURN
+    }
+
+    if (rehashIfNeeded()) {
+        position = findSlot(key, hash);
+    }
+
+    const bsls::Types::Uint32 index = d_nodes.allocate();
+
+    linkAfter(index, d_sentinel);
+
+    emplace(index, position, hash, value);
+
+    return bsl::make_pair(iterator(&d_nodes, index), true);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline void
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::reserve(size_t numElements)
+{
+    const size_t numSlots = numSlotsFor(numElements);
+    if (numSlots > d_slots.size()) {
+        rehash(numSlots);
+    }
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
+    FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::begin() const
+{
+    return const_iterator(&d_nodes, d_nodes.node(d_sentinel).d_next);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
+    FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
+    FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::end() const
+{
+    return const_iterator(&d_nodes, d_sentinel);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
+    FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::bucket_count() const
+{
+    return d_slots.size();
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::count(
+    const key_type& key) const
+{
+    return d_slots[findSlot(key, hashOf(key))].d_node == Link::k_NIL ? 0 : 1;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline bool FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::empty() const
+{
+    return 0 == d_numElements;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::const_iterator
+    FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::find(
+        const key_type& key) const
+{
+    const bsls::Types::Uint32 node = d_slots[findSlot(key, hashOf(key))]
+                                         .d_node;
+
+    return const_iterator(&d_nodes, node == Link::k_NIL ? d_sentinel : node);
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline size_t FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::size() const
+{
+    return d_numElements;
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline double
+FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::load_factor() const
+{
+    return static_cast<double>(d_numElements) /
+           static_cast<double>(d_slots.size());
+}
+
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline
+    typename FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::allocator_type
+    FlatOrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::get_allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
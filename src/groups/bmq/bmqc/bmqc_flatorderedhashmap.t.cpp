@@ -0,0 +1,501 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqc_flatorderedhashmap.h>
+
+// BDE
+#include <bsl_list.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+#include <bslma_testallocator.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+namespace {
+
+/// Hasher mapping all the keys to a few hashes, so that the probe sequences
+/// of the keys overlap.
+class CollidingHasher {
+  public:
+    size_t operator()(size_t x) const { return x % 7; }
+};
+
+struct TestValueType {
+    // CLASS LEVEL DATA
+    static size_t s_numDeletions;
+
+    // DATA
+    size_t d_b;
+
+    // CREATORS
+    TestValueType(size_t b) { d_b = b; }
+
+    ~TestValueType() { s_numDeletions += 1; }
+};
+
+size_t TestValueType::s_numDeletions(0);
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise basic functionality before beginning testing in earnest.
+//   Probe that functionality to discover basic errors.
+//
+// Testing:
+//   Basic functionality.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    typedef bmqc::FlatOrderedHashMap<int, bsl::string> MyMapType;
+    typedef MyMapType::iterator                        IterType;
+    typedef MyMapType::const_iterator                  ConstIterType;
+
+    MyMapType        map(bmqtst::TestHelperUtil::allocator());
+    const MyMapType& cmap = map;
+
+    BMQTST_ASSERT_EQ(true, map.empty());
+    BMQTST_ASSERT_EQ(0U, map.size());
+    BMQTST_ASSERT_EQ(true, map.begin() == map.end());
+    BMQTST_ASSERT_EQ(true, cmap.begin() == cmap.end());
+    BMQTST_ASSERT_EQ(0U, map.count(1));
+    BMQTST_ASSERT_EQ(true, map.find(1) == map.end());
+    BMQTST_ASSERT_LT(0U, map.bucket_count());
+    BMQTST_ASSERT_EQ(map.get_allocator(), bmqtst::TestHelperUtil::allocator());
+
+    bsl::pair<IterType, bool> rc = map.insert(bsl::make_pair(1, "one"));
+    BMQTST_ASSERT_EQ(true, rc.second);
+    BMQTST_ASSERT_EQ(1, rc.first->first);
+    BMQTST_ASSERT_EQ("one", rc.first->second);
+    BMQTST_ASSERT_EQ(false, map.empty());
+    BMQTST_ASSERT_EQ(1U, map.size());
+    BMQTST_ASSERT_EQ(1U, map.count(1));
+
+    rc = map.insert(bsl::make_pair(1, "uno"));
+    BMQTST_ASSERT_EQ(false, rc.second);
+    BMQTST_ASSERT_EQ("one", rc.first->second);
+    BMQTST_ASSERT_EQ(1U, map.size());
+
+    map.insert(bsl::make_pair(2, "two"));
+    map.insert(bsl::make_pair(3, "three"));
+    BMQTST_ASSERT_EQ(3U, map.size());
+
+    // Iteration in insertion order, in both directions
+    int           expected = 1;
+    ConstIterType cit      = cmap.begin();
+    for (; cit != cmap.end(); ++cit, ++expected) {
+        BMQTST_ASSERT_EQ(expected, cit->first);
+    }
+    BMQTST_ASSERT_EQ(4, expected);
+
+    IterType it = map.end();
+    for (expected = 3; it != map.begin(); --expected) {
+        --it;
+        BMQTST_ASSERT_EQ(expected, (*it).first);
+    }
+    BMQTST_ASSERT_EQ(0, expected);
+
+    // Modification through an iterator
+    map.find(2)->second = "deux";
+    BMQTST_ASSERT_EQ("deux", cmap.find(2)->second);
+
+    // Erase by key
+    BMQTST_ASSERT_EQ(1U, map.erase(2));
+    BMQTST_ASSERT_EQ(0U, map.erase(2));
+    BMQTST_ASSERT_EQ(2U, map.size());
+    BMQTST_ASSERT_EQ(0U, map.count(2));
+    BMQTST_ASSERT_EQ(1, map.begin()->first);
+    BMQTST_ASSERT_EQ(3, (++map.begin())->first);
+
+    // Erase by iterator
+    it = map.erase(map.begin());
+    BMQTST_ASSERT_EQ(true, it == map.begin());
+    BMQTST_ASSERT_EQ(3, it->first);
+    it = map.erase(it);
+    BMQTST_ASSERT_EQ(true, it == map.end());
+    BMQTST_ASSERT_EQ(true, map.empty());
+}
+
+static void test2_previousEndIterator()
+// ------------------------------------------------------------------------
+// PREVIOUS END ITERATOR
+//
+// Concerns:
+//   - Upon insert()'ing a new element, the previous end iterator refers to
+//     the newly inserted element.
+//   - 'rinsert' inserts the element at the beginning of the sequence, and
+//     does not affect the end iterator.
+//
+// Testing:
+//   insert
+//   rinsert
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PREVIOUS END ITERATOR");
+
+    typedef bmqc::FlatOrderedHashMap<size_t, size_t> MyMapType;
+    typedef MyMapType::iterator                      IterType;
+    typedef MyMapType::const_iterator                ConstIterType;
+
+    MyMapType        map(bmqtst::TestHelperUtil::allocator());
+    const MyMapType& cmap = map;
+
+    IterType      endIt  = map.end();
+    ConstIterType endCit = cmap.end();
+
+    size_t                    i  = 0;
+    bsl::pair<IterType, bool> rc = map.insert(bsl::make_pair(i, i * i));
+
+    BMQTST_ASSERT_EQ(true, rc.first == endIt);
+    BMQTST_ASSERT_EQ(true, rc.first == endCit);
+    BMQTST_ASSERT_EQ(i, endIt->first);
+    BMQTST_ASSERT_EQ((i * i), endIt->second);
+
+    ++i;
+    for (; i < 10000; ++i) {
+        endIt = map.end();
+        rc    = map.insert(bsl::make_pair(i, i * i));
+        BMQTST_ASSERT_EQ_D(i, true, rc.first == endIt);
+        BMQTST_ASSERT_EQ_D(i, i, endIt->first);
+        BMQTST_ASSERT_EQ_D(i, (i * i), endIt->second);
+    }
+
+    // Erase last element
+    map.erase(i - 1);
+    BMQTST_ASSERT_EQ((i - 2), (--map.end())->first);
+    endIt = map.end();
+    ++i;
+    rc = map.insert(bsl::make_pair(i, i * i));
+    BMQTST_ASSERT_EQ(true, rc.first == endIt);
+    BMQTST_ASSERT_EQ(i, endIt->first);
+
+    // rinsert an element, which doesn't affect end().
+    ++i;
+    endIt = map.end();
+    rc    = map.rinsert(bsl::make_pair(i, i * i));
+    BMQTST_ASSERT_EQ(true, rc.second);
+    BMQTST_ASSERT_EQ(true, endIt == map.end());
+    BMQTST_ASSERT_EQ(true, rc.first == map.begin());
+    BMQTST_ASSERT_EQ(i, map.begin()->first);
+
+    rc = map.rinsert(bsl::make_pair(i, 0));
+    BMQTST_ASSERT_EQ(false, rc.second);
+    BMQTST_ASSERT_EQ((i * i), rc.first->second);
+
+    ++i;
+    rc = map.insert(bsl::make_pair(i, i * i));
+    BMQTST_ASSERT_EQ(true, endIt == rc.first);
+    BMQTST_ASSERT_EQ(i, endIt->first);
+}
+
+static void test3_collisions()
+// ------------------------------------------------------------------------
+// COLLISIONS
+//
+// Concerns:
+//   Insertions and erasures of keys whose probe sequences overlap keep the
+//   container consistent with a reference list, in particular when erasing
+//   shifts back the following slots.
+//
+// Testing:
+//   insert
+//   rinsert
+//   erase
+//   find
+//   count
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COLLISIONS");
+
+    typedef bmqc::FlatOrderedHashMap<size_t, size_t, CollidingHasher>
+                                          MyMapType;
+    typedef bsl::list<bsl::pair<size_t, size_t> > ReferenceList;
+
+    const size_t k_NUM_KEYS       = 300;
+    const size_t k_NUM_OPERATIONS = 20000;
+
+    MyMapType     map(bmqtst::TestHelperUtil::allocator());
+    ReferenceList reference(bmqtst::TestHelperUtil::allocator());
+
+    bsl::vector<ReferenceList::iterator> positions(
+        k_NUM_KEYS,
+        reference.end(),
+        bmqtst::TestHelperUtil::allocator());
+
+    size_t random = 12345;
+    for (size_t op = 0; op < k_NUM_OPERATIONS; ++op) {
+        // Linear congruential generator, for reproducibility
+        random = random * 6364136223846793005ULL + 1442695040888963407ULL;
+
+        const size_t key    = (random >> 33) % k_NUM_KEYS;
+        const size_t action = (random >> 20) % 4;
+        const bool   exists = positions[key] != reference.end();
+
+        if (action == 0) {
+            BMQTST_ASSERT_EQ_D(op, exists ? 1U : 0U, map.erase(key));
+            if (exists) {
+                reference.erase(positions[key]);
+                positions[key] = reference.end();
+            }
+        }
+        else if (action == 1) {
+            const bool inserted = map.rinsert(bsl::make_pair(key, op)).second;
+            BMQTST_ASSERT_EQ_D(op, !exists, inserted);
+            if (!exists) {
+                positions[key] = reference.insert(reference.begin(),
+                                                  bsl::make_pair(key, op));
+            }
+        }
+        else {
+            const bool inserted = map.insert(bsl::make_pair(key, op)).second;
+            BMQTST_ASSERT_EQ_D(op, !exists, inserted);
+            if (!exists) {
+                positions[key] = reference.insert(reference.end(),
+                                                  bsl::make_pair(key, op));
+            }
+        }
+
+        if (op % 500 != 0) {
+            continue;  // CONTINUE
+        }
+
+        BMQTST_ASSERT_EQ_D(op, reference.size(), map.size());
+        BMQTST_ASSERT_LE_D(op, map.load_factor(), 0.75);
+
+        MyMapType::const_iterator     it  = map.begin();
+        ReferenceList::const_iterator rit = reference.begin();
+        for (; rit != reference.end(); ++it, ++rit) {
+            BMQTST_ASSERT_EQ_D(op, rit->first, it->first);
+            BMQTST_ASSERT_EQ_D(op, rit->second, it->second);
+        }
+        BMQTST_ASSERT_EQ_D(op, true, it == map.end());
+
+        for (size_t k = 0; k < k_NUM_KEYS; ++k) {
+            const bool expected = positions[k] != reference.end();
+            BMQTST_ASSERT_EQ_D(k, expected ? 1U : 0U, map.count(k));
+            BMQTST_ASSERT_EQ_D(k, expected, map.find(k) != map.end());
+        }
+    }
+}
+
+static void test4_stability()
+// ------------------------------------------------------------------------
+// STABILITY
+//
+// Concerns:
+//   - Iterators, pointers and references to elements remain valid through
+//     rehashes and erasures of other elements.
+//   - The maximum load factor is maintained.
+//   - A container at steady state (i.e., erasing as many elements as it
+//     inserts) does not allocate memory.
+//
+// Testing:
+//   Iterator, pointer and reference stability
+//   bucket_count
+//   load_factor
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("STABILITY");
+
+    typedef bmqc::FlatOrderedHashMap<size_t, size_t> MyMapType;
+    typedef MyMapType::iterator                      IterType;
+
+    bslma::TestAllocator ta;
+    MyMapType            map(&ta);
+
+    const size_t k_NUM_TRACKED  = 100;
+    const size_t k_NUM_ELEMENTS = 100000;
+
+    bsl::vector<IterType> iterators(bmqtst::TestHelperUtil::allocator());
+    bsl::vector<size_t*>  addresses(bmqtst::TestHelperUtil::allocator());
+
+    for (size_t i = 0; i < k_NUM_TRACKED; ++i) {
+        IterType it = map.insert(bsl::make_pair(i, i * 2)).first;
+        iterators.push_back(it);
+        addresses.push_back(&it->second);
+    }
+
+    const size_t initialBucketCount = map.bucket_count();
+
+    for (size_t i = k_NUM_TRACKED; i < k_NUM_ELEMENTS; ++i) {
+        map.insert(bsl::make_pair(i, i * 2));
+        BMQTST_ASSERT_LE_D(i, map.load_factor(), 0.75);
+
+        if (i % 2 == 0 && i > k_NUM_TRACKED) {
+            // Erase some untracked elements
+            map.erase(i - 1);
+        }
+    }
+    BMQTST_ASSERT_LT(initialBucketCount, map.bucket_count());
+
+    for (size_t i = 0; i < k_NUM_TRACKED; ++i) {
+        BMQTST_ASSERT_EQ_D(i, true, iterators[i] == map.find(i));
+        BMQTST_ASSERT_EQ_D(i, i, iterators[i]->first);
+        BMQTST_ASSERT_EQ_D(i, addresses[i], &map.find(i)->second);
+    }
+
+    PV("Steady state");
+
+    const bsls::Types::Int64 numAllocations = ta.numAllocations();
+    for (size_t i = k_NUM_ELEMENTS; i < 2 * k_NUM_ELEMENTS; ++i) {
+        map.erase(map.begin());
+        map.insert(bsl::make_pair(i, i * 2));
+    }
+    BMQTST_ASSERT_EQ(numAllocations, ta.numAllocations());
+}
+
+static void test5_copyAssignClear()
+// ------------------------------------------------------------------------
+// COPY, ASSIGN, CLEAR
+//
+// Concerns:
+//   - Copies have the same value and order as the original.
+//   - 'clear', the destructor and the range 'erase' destroy the elements.
+//   - 'reserve' prevents rehashing.
+//
+// Testing:
+//   FlatOrderedHashMap(const FlatOrderedHashMap&, bslma::Allocator *)
+//   operator=
+//   erase(const_iterator, const_iterator)
+//   clear
+//   reserve
+//   ~FlatOrderedHashMap
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COPY, ASSIGN, CLEAR");
+
+    typedef bmqc::FlatOrderedHashMap<size_t, TestValueType> MyMapType;
+
+    const size_t k_NUM_ELEMENTS = 1000;
+
+    TestValueType::s_numDeletions = 0;
+    {
+        MyMapType map(bmqtst::TestHelperUtil::allocator());
+        map.reserve(k_NUM_ELEMENTS);
+
+        const size_t bucketCount = map.bucket_count();
+        for (size_t i = 0; i < k_NUM_ELEMENTS; ++i) {
+            map.rinsert(bsl::make_pair(i, TestValueType(i)));
+        }
+        BMQTST_ASSERT_EQ(bucketCount, map.bucket_count());
+
+        TestValueType::s_numDeletions = 0;
+
+        {
+            PV("Copy constructor");
+
+            MyMapType copy(map, bmqtst::TestHelperUtil::allocator());
+            BMQTST_ASSERT_EQ(map.size(), copy.size());
+
+            MyMapType::const_iterator it  = map.begin();
+            MyMapType::const_iterator cit = copy.begin();
+            for (; it != map.end(); ++it, ++cit) {
+                BMQTST_ASSERT_EQ(it->first, cit->first);
+                BMQTST_ASSERT_EQ(it->second.d_b, cit->second.d_b);
+            }
+            BMQTST_ASSERT_EQ(true, cit == copy.end());
+        }
+        BMQTST_ASSERT_EQ(k_NUM_ELEMENTS, TestValueType::s_numDeletions);
+        TestValueType::s_numDeletions = 0;
+
+        {
+            PV("Assignment operator");
+
+            MyMapType other(bmqtst::TestHelperUtil::allocator());
+            other.insert(bsl::make_pair(k_NUM_ELEMENTS, TestValueType(0)));
+            TestValueType::s_numDeletions = 0;
+
+            other = map;
+            BMQTST_ASSERT_EQ(1U, TestValueType::s_numDeletions);
+            BMQTST_ASSERT_EQ(map.size(), other.size());
+            BMQTST_ASSERT_EQ(0U, other.count(k_NUM_ELEMENTS));
+            BMQTST_ASSERT_EQ(k_NUM_ELEMENTS - 1, other.begin()->first);
+
+            other = other;
+            BMQTST_ASSERT_EQ(map.size(), other.size());
+        }
+        BMQTST_ASSERT_EQ(k_NUM_ELEMENTS + 1, TestValueType::s_numDeletions);
+        TestValueType::s_numDeletions = 0;
+
+        PV("Range erase");
+
+        MyMapType::const_iterator last = map.begin();
+        for (size_t i = 0; i < 10; ++i) {
+            ++last;
+        }
+        MyMapType::const_iterator rc = map.erase(map.begin(), last);
+        BMQTST_ASSERT_EQ(true, rc == map.begin());
+        BMQTST_ASSERT_EQ(10U, TestValueType::s_numDeletions);
+        BMQTST_ASSERT_EQ(k_NUM_ELEMENTS - 10, map.size());
+        BMQTST_ASSERT_EQ(k_NUM_ELEMENTS - 11, map.begin()->first);
+
+        rc = map.erase(map.end(), map.end());
+        BMQTST_ASSERT_EQ(true, rc == map.end());
+        BMQTST_ASSERT_EQ(k_NUM_ELEMENTS - 10, map.size());
+
+        PV("Clear");
+
+        TestValueType::s_numDeletions = 0;
+        map.clear();
+        BMQTST_ASSERT_EQ(k_NUM_ELEMENTS - 10, TestValueType::s_numDeletions);
+        BMQTST_ASSERT_EQ(true, map.empty());
+        BMQTST_ASSERT_EQ(true, map.begin() == map.end());
+        BMQTST_ASSERT_EQ(0U, map.count(0));
+
+        map.insert(bsl::make_pair(0, TestValueType(0)));
+        BMQTST_ASSERT_EQ(1U, map.size());
+
+        TestValueType::s_numDeletions = 0;
+    }
+    BMQTST_ASSERT_EQ(1U, TestValueType::s_numDeletions);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 5: test5_copyAssignClear(); break;
+    case 4: test4_stability(); break;
+    case 3: test3_collisions(); break;
+    case 2: test2_previousEndIterator(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
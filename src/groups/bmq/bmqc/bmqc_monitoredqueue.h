@@ -24,7 +24,7 @@
 //  bmqc::MonitoredQueueUtil:  Monitored  queue utilities
 //
 //@SEE_ALSO: bdlcc_fixedqueue, bdlcc_singleconsumerqueue,
-//  bdlcc_singleproducerqueue
+//  bdlcc_singleproducerqueue, bmqc_monitoredqueue_ringbuffer
 //
 //@DESCRIPTION: This component defines a mechanism,
 // 'bmqc::MonitoredQueue', which is a simple wrapper around a Queue type that
@@ -206,11 +206,13 @@ class MonitoredQueue {
     /// it or the `newState` denotes a "less full" state.
     bool setState(int newState);
 
-    /// Increment `d_queueLength` and report if necessary
-    void incrementLength();
+    /// Increment `d_queueLength` by the optionally specified `count` and
+    /// report if necessary
+    void incrementLength(bsls::Types::Int64 count = 1);
 
-    /// Decrement `d_queueLength` and report if necessary
-    void decrementLength();
+    /// Decrement `d_queueLength` by the optionally specified `count` and
+    /// report if necessary
+    void decrementLength(bsls::Types::Int64 count = 1);
 
   private:
     // NOT IMPLEMENTED
@@ -281,6 +283,14 @@ class MonitoredQueue {
     /// queue is full or disabled.
     int tryPushBack(bslmf::MovableRef<ElementType> value);
 
+    /// Attempt to move up to the specified `numValues` elements starting at
+    /// the specified `values` to the back of this queue, in order, without
+    /// blocking.  Return the number of elements moved, which is less than
+    /// `numValues` if the queue is full or disabled.  The moved elements are
+    /// left in a valid but unspecified state.  Note that queue types not
+    /// natively supporting bulk operations push the elements one at a time.
+    int tryPushBackBulk(ElementType* values, int numValues);
+
     /// Remove the element from the front of this queue and load that
     /// element into the specified `value`.  If the queue is empty, block
     /// until it is not empty.  Return 0 on success, and a non-zero value
@@ -293,6 +303,13 @@ class MonitoredQueue {
     /// was empty.  On failure, `value` is not changed.
     int tryPopFront(ElementType* value);
 
+    /// Attempt to remove up to the specified `maxValues` elements from the
+    /// front of this queue without blocking, and load them, in order, into
+    /// the array starting at the specified `values`.  Return the number of
+    /// elements removed.  Note that queue types not natively supporting
+    /// bulk operations pop the elements one at a time.
+    int tryPopFrontBulk(ElementType* values, int maxValues);
+
     /// Pop an element from the front of the queue into the specified
     /// `buffer`.  Block if there are no elements in the queue, up to the
     /// specified `timeout` *absolute* time.  Return 0 if an item was
@@ -391,9 +408,10 @@ inline bool MonitoredQueue<QUEUE, QUEUE_TRAITS>::setState(int newState)
 }
 
 template <class QUEUE, class QUEUE_TRAITS>
-inline void MonitoredQueue<QUEUE, QUEUE_TRAITS>::incrementLength()
+inline void
+MonitoredQueue<QUEUE, QUEUE_TRAITS>::incrementLength(bsls::Types::Int64 count)
 {
-    const bsls::Types::Int64 newLength = ++d_queueLength;
+    const bsls::Types::Int64 newLength = d_queueLength.add(count);
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
             newLength >= d_highWatermark2 &&
@@ -418,9 +436,10 @@ inline void MonitoredQueue<QUEUE, QUEUE_TRAITS>::incrementLength()
 }
 
 template <class QUEUE, class QUEUE_TRAITS>
-inline void MonitoredQueue<QUEUE, QUEUE_TRAITS>::decrementLength()
+inline void
+MonitoredQueue<QUEUE, QUEUE_TRAITS>::decrementLength(bsls::Types::Int64 count)
 {
-    const bsls::Types::Int64 newLength = --d_queueLength;
+    const bsls::Types::Int64 newLength = d_queueLength.subtract(count);
 
     if (d_state > MonitoredQueueState::e_NORMAL &&
         newLength <= d_lowWatermark) {
@@ -558,6 +577,41 @@ inline int MonitoredQueue<QUEUE, QUEUE_TRAITS>::tryPushBack(
     return 0;
 }
 
+template <class QUEUE, class QUEUE_TRAITS>
+inline int
+MonitoredQueue<QUEUE, QUEUE_TRAITS>::tryPushBackBulk(ElementType* values,
+                                                     int          numValues)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(values || numValues == 0);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    const int numPushed = Traits::tryPushBackBulk(&d_queue,
+                                                  values,
+                                                  numValues);
+    if (numPushed < numValues) {
+        // We've filled the queue.  Alarm
+        if (!Traits::isPushBackDisabled(d_queue) &&
+            setState(MonitoredQueueState::e_QUEUE_FILLED) &&
+            d_stateChangedCb) {
+            d_stateChangedCb(MonitoredQueueState::e_QUEUE_FILLED);
+        }
+    }
+
+    if (numPushed == 0) {
+        return 0;  // RETURN
+    }
+
+    incrementLength(numPushed);
+
+    if (d_supportTimedOperations) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_timedOperationsMutex);
+        d_timedOperationsCondition.signal();
+    }
+
+    return numPushed;
+}
+
 template <class QUEUE, class QUEUE_TRAITS>
 inline int
 MonitoredQueue<QUEUE, QUEUE_TRAITS>::pushBack(const ElementType& object)
@@ -626,6 +680,25 @@ MonitoredQueue<QUEUE, QUEUE_TRAITS>::tryPopFront(ElementType* buffer)
     return 0;
 }
 
+template <class QUEUE, class QUEUE_TRAITS>
+inline int
+MonitoredQueue<QUEUE, QUEUE_TRAITS>::tryPopFrontBulk(ElementType* values,
+                                                     int          maxValues)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(values || maxValues == 0);
+    BSLS_ASSERT_SAFE(0 <= maxValues);
+
+    const int numPopped = Traits::tryPopFrontBulk(&d_queue,
+                                                  values,
+                                                  maxValues);
+    if (numPopped != 0) {
+        decrementLength(numPopped);
+    }
+
+    return numPopped;
+}
+
 template <class QUEUE, class QUEUE_TRAITS>
 inline int MonitoredQueue<QUEUE, QUEUE_TRAITS>::popFront(ElementType* value)
 {
@@ -32,6 +32,7 @@
 // BDE
 #include <bdlcc_fixedqueue.h>
 #include <bslma_allocator.h>
+#include <bslmf_movableref.h>
 
 namespace BloombergLP {
 
@@ -75,6 +76,19 @@ struct MonitoredQueueTraits<bdlcc::FixedQueue<ELEMENT> > {
     /// non-zero value otherwise.  See the documentation of
     /// `bdlcc::FixedQueue` for more details.
     static int popFront(QueueType* queue, ElementType* buffer);
+
+    /// Attempt to move up to the specified `numValues` elements starting at
+    /// the specified `values` to the back of the specified `queue`, one at
+    /// a time, without blocking.  Return the number of elements moved.
+    static int
+    tryPushBackBulk(QueueType* queue, ElementType* values, int numValues);
+
+    /// Attempt to remove up to the specified `maxValues` elements from the
+    /// front of the specified `queue`, one at a time, without blocking, and
+    /// load them into the array starting at the specified `values`.  Return
+    /// the number of elements removed.
+    static int
+    tryPopFrontBulk(QueueType* queue, ElementType* values, int maxValues);
 };
 
 // ============================================================================
@@ -123,6 +137,36 @@ inline int MonitoredQueueTraits<bdlcc::FixedQueue<ELEMENT> >::popFront(
     return 0;
 }
 
+template <typename ELEMENT>
+inline int MonitoredQueueTraits<bdlcc::FixedQueue<ELEMENT> >::tryPushBackBulk(
+    QueueType*   queue,
+    ElementType* values,
+    int          numValues)
+{
+    int count = 0;
+    while (count < numValues &&
+           queue->tryPushBack(bslmf::MovableRefUtil::move(values[count])) ==
+               0) {
+        ++count;
+    }
+
+    return count;
+}
+
+template <typename ELEMENT>
+inline int MonitoredQueueTraits<bdlcc::FixedQueue<ELEMENT> >::tryPopFrontBulk(
+    QueueType*   queue,
+    ElementType* values,
+    int          maxValues)
+{
+    int count = 0;
+    while (count < maxValues && queue->tryPopFront(&values[count]) == 0) {
+        ++count;
+    }
+
+    return count;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
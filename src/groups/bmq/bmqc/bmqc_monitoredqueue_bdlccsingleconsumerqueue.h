@@ -34,6 +34,7 @@
 #include <bsl_limits.h>
 #include <bsla_annotations.h>
 #include <bslma_allocator.h>
+#include <bslmf_movableref.h>
 
 namespace BloombergLP {
 
@@ -77,6 +78,19 @@ struct MonitoredQueueTraits<bdlcc::SingleConsumerQueue<ELEMENT> > {
     /// non-zero value otherwise.  See the documentation of
     /// `bdlcc::SingleConsumerQueue` for more details.
     static int popFront(QueueType* queue, ElementType* buffer);
+
+    /// Attempt to move up to the specified `numValues` elements starting at
+    /// the specified `values` to the back of the specified `queue`, one at
+    /// a time, without blocking.  Return the number of elements moved.
+    static int
+    tryPushBackBulk(QueueType* queue, ElementType* values, int numValues);
+
+    /// Attempt to remove up to the specified `maxValues` elements from the
+    /// front of the specified `queue`, one at a time, without blocking, and
+    /// load them into the array starting at the specified `values`.  Return
+    /// the number of elements removed.
+    static int
+    tryPopFrontBulk(QueueType* queue, ElementType* values, int maxValues);
 };
 
 // ============================================================================
@@ -128,6 +142,38 @@ MonitoredQueueTraits<bdlcc::SingleConsumerQueue<ELEMENT> >::enablePushBack(
     queue->enablePushBack();
 }
 
+template <typename ELEMENT>
+inline int
+MonitoredQueueTraits<bdlcc::SingleConsumerQueue<ELEMENT> >::tryPushBackBulk(
+    QueueType*   queue,
+    ElementType* values,
+    int          numValues)
+{
+    int count = 0;
+    while (count < numValues &&
+           queue->tryPushBack(bslmf::MovableRefUtil::move(values[count])) ==
+               0) {
+        ++count;
+    }
+
+    return count;
+}
+
+template <typename ELEMENT>
+inline int
+MonitoredQueueTraits<bdlcc::SingleConsumerQueue<ELEMENT> >::tryPopFrontBulk(
+    QueueType*   queue,
+    ElementType* values,
+    int          maxValues)
+{
+    int count = 0;
+    while (count < maxValues && queue->tryPopFront(&values[count]) == 0) {
+        ++count;
+    }
+
+    return count;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
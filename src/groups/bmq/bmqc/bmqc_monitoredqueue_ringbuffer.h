@@ -0,0 +1,818 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BMQC_MONITOREDQUEUE_RINGBUFFER
+#define INCLUDED_BMQC_MONITOREDQUEUE_RINGBUFFER
+
+//@PURPOSE: Provide a bounded lock-free ring buffer usable by MonitoredQueue.
+//
+//@CLASSES:
+//  bmqc::RingBuffer:     bounded multi-producer single-consumer ring buffer
+//  MonitoredQueueTraits: specialization for 'bmqc::RingBuffer'
+//
+//@SEE_ALSO: bmqc_monitoredqueue, bdlcc_fixedqueue
+//
+//@DESCRIPTION: This component defines a mechanism, 'bmqc::RingBuffer', which
+// is a bounded, lock-free, multi-producer single-consumer queue of elements of
+// the parameterized 'ELEMENT' type, and a partial specialization of
+// 'bmqc::MonitoredQueueTraits' that interfaces a 'bmqc::MonitoredQueue' with
+// it.  The ring buffer can therefore be used as the backend of a monitored
+// queue, which keeps the high/low watermark semantics of the other backends.
+//
+// The capacity of a 'bmqc::RingBuffer' is the capacity requested at
+// construction rounded up to the next power of two, so that positions are
+// mapped to slots with a mask.  Each slot carries a sequence number telling
+// whether it is ready to be written by a producer or read by the consumer, so
+// that producers only contend on the tail position, and the consumer never
+// contends with producers.  The head and tail positions are each padded to
+// their own cache line to avoid false sharing between the consumer and the
+// producers.
+//
+// In addition to single element operations, a 'bmqc::RingBuffer' supports
+// bulk operations ('tryPushBackBulk' and 'tryPopFrontBulk') transferring a
+// range of elements with a single reservation of the tail (respectively a
+// single publication of the head), which 'bmqc::MonitoredQueue' exposes
+// through its own 'tryPushBackBulk' and 'tryPopFrontBulk' methods.
+//
+// Blocking operations ('pushBack' and 'popFront') first busy-poll the ring
+// buffer for a bounded number of iterations, and only then park the calling
+// thread on a condition variable until the ring buffer is respectively not
+// full or not empty.  Producers and consumer only touch the mutex of the
+// condition variables when the other side is parked, which keeps the hand-off
+// lock-free under load while bounding the CPU usage of idle threads.
+//
+/// Thread Safety
+///-------------
+// All the manipulators of 'bmqc::RingBuffer' can be called concurrently by
+// any number of producer threads, except for the consumer operations
+// ('popFront', 'tryPopFront', 'tryPopFrontBulk' and 'removeAll') which must be
+// called by at most one thread at a time.  'bmqc::RingBuffer' can thus
+// equally be used as a single-producer single-consumer queue.
+//
+/// Usage
+///-----
+// This section illustrates intended use of this component.
+//
+/// Example 1: Monitored ring buffer
+/// - - - - - - - - - - - - - - - -
+// A monitored queue backed by a ring buffer is created with a requested
+// capacity, rounded up to a power of two:
+//..
+//  bmqc::MonitoredQueue<bmqc::RingBuffer<int> > queue(1000, allocator);
+//  assert(queue.capacity() == 1024);
+//  queue.setWatermarks(256, 768, 1000);
+//..
+// Producers push elements one by one or in bulk, while the consumer pops
+// them, in order, in bulk:
+//..
+//  int values[] = { 1, 2, 3 };
+//  assert(3 == queue.tryPushBackBulk(values, 3));
+//
+//  int buffer[16];
+//  assert(3 == queue.tryPopFrontBulk(buffer, 16));
+//  assert(1 == buffer[0] && 2 == buffer[1] && 3 == buffer[2]);
+//..
+
+#include <bmqc_monitoredqueue.h>
+
+// BDE
+#include <bslma_allocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_condition.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_platform.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+namespace bmqc {
+
+// ================
+// class RingBuffer
+// ================
+
+/// Bounded, lock-free, multi-producer single-consumer queue of elements of
+/// the parameterized `ELEMENT` type, having a power-of-two capacity.
+template <typename ELEMENT>
+class RingBuffer {
+  private:
+    // PRIVATE TYPES
+
+    /// A slot of the ring buffer.  The `d_sequence` of the slot at index
+    /// `i` is equal to the position `p` (with `i == p & mask`) when the slot
+    /// is ready to be written at position `p`, and to `p + 1` when it holds
+    /// the element written at position `p`.
+    struct Slot {
+        // PUBLIC DATA
+        bsls::AtomicInt64 d_sequence;
+
+        bsls::ObjectBuffer<ELEMENT> d_value;
+    };
+
+    // PRIVATE CONSTANTS
+    enum {
+        /// Size of the padding following each position, so that the head
+        /// and tail positions are on different cache lines.
+        k_PADDING_SIZE = bslmt::Platform::e_CACHE_LINE_SIZE -
+                         sizeof(bsls::AtomicInt64)
+    };
+
+    /// Number of iterations a blocking operation busy-polls the ring buffer
+    /// for before parking.
+    static const int k_SPIN_COUNT = 1000;
+
+    // DATA
+
+    /// Position of the next element to pop.  Written by the consumer only.
+    bsls::AtomicInt64 d_head;
+
+    char d_headPadding[k_PADDING_SIZE];
+
+    /// Position of the next element to push.
+    bsls::AtomicInt64 d_tail;
+
+    char d_tailPadding[k_PADDING_SIZE];
+
+    /// Number of slots in `d_slots_p`, a power of two.
+    const bsls::Types::Int64 d_capacity;
+
+    /// Mask mapping a position to the index of its slot.
+    const bsls::Types::Int64 d_mask;
+
+    /// Slots of the ring buffer.
+    Slot* d_slots_p;
+
+    /// Whether pushing is disabled.
+    bsls::AtomicBool d_isPushBackDisabled;
+
+    /// Number of consumer threads parked waiting for the ring buffer not to
+    /// be empty (0 or 1).
+    bsls::AtomicInt d_numWaitingConsumers;
+
+    /// Number of producer threads parked waiting for the ring buffer not to
+    /// be full.
+    bsls::AtomicInt d_numWaitingProducers;
+
+    /// Mutex used by parked threads.
+    bslmt::Mutex d_mutex;
+
+    /// Condition signaled when an element is pushed while the consumer is
+    /// parked.
+    bslmt::Condition d_notEmptyCondition;
+
+    /// Condition signaled when elements are popped while producers are
+    /// parked, or pushing is disabled.
+    bslmt::Condition d_notFullCondition;
+
+    /// Allocator used to supply memory.
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Return the smallest power of two greater than or equal to the
+    /// specified `capacity`.
+    static bsls::Types::Int64 roundUpCapacity(int capacity);
+
+    // PRIVATE MANIPULATORS
+
+    /// Reserve up to the specified `numElements` consecutive positions for
+    /// writing, and load the first of them into the specified `position`.
+    /// Return the number of reserved positions, which is 0 if the ring
+    /// buffer is full or push is disabled.
+    int reserve(bsls::Types::Int64* position, int numElements);
+
+    /// Mark the slot at the specified `position` as holding an element, and
+    /// wake up the consumer if it is parked.
+    void publish(bsls::Types::Int64 position);
+
+    /// Move the element at the specified `position`, which must be ready,
+    /// into the specified `value` and mark its slot as ready for writing,
+    /// without publishing the new head position.
+    void consume(bsls::Types::Int64 position, ELEMENT* value);
+
+    /// Wake up the parked producers, if any.
+    void notifyProducers();
+
+  private:
+    // NOT IMPLEMENTED
+    RingBuffer(const RingBuffer&) BSLS_KEYWORD_DELETED;
+    RingBuffer& operator=(const RingBuffer&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(RingBuffer, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a `bmqc::RingBuffer` with a capacity of at least the specified
+    /// `capacity` number of elements, rounded up to the next power of two.
+    /// Use the optionally specified `basicAllocator` to supply memory.  The
+    /// behavior is undefined unless `0 < capacity`.
+    explicit RingBuffer(int capacity, bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object and all the elements it holds.
+    ~RingBuffer();
+
+    // MANIPULATORS
+
+    /// Attempt to append the specified `value` to the back of this ring
+    /// buffer without blocking.  Return 0 on success, and a non-zero value
+    /// if the ring buffer is full or disabled.
+    int tryPushBack(const ELEMENT& value);
+
+    /// Attempt to append the specified move-insertable `value` to the back
+    /// of this ring buffer without blocking.  `value` is left in a valid but
+    /// unspecified state on success.  Return 0 on success, and a non-zero
+    /// value if the ring buffer is full or disabled.
+    int tryPushBack(bslmf::MovableRef<ELEMENT> value);
+
+    /// Append the specified `value` to the back of this ring buffer,
+    /// blocking until either space is available - if necessary - or the
+    /// ring buffer is disabled.  Return 0 on success, and a non-zero value
+    /// if the ring buffer is disabled.
+    int pushBack(const ELEMENT& value);
+
+    /// Append the specified move-insertable `value` to the back of this
+    /// ring buffer, blocking until either space is available - if
+    /// necessary - or the ring buffer is disabled.  Return 0 on success,
+    /// and a non-zero value if the ring buffer is disabled.
+    int pushBack(bslmf::MovableRef<ELEMENT> value);
+
+    /// Attempt to move up to the specified `numValues` elements starting at
+    /// the specified `values` to the back of this ring buffer, in order,
+    /// without blocking.  Return the number of elements moved, which is
+    /// less than `numValues` if the ring buffer became full, and 0 if it is
+    /// disabled.  The moved elements are left in a valid but unspecified
+    /// state.
+    int tryPushBackBulk(ELEMENT* values, int numValues);
+
+    /// Remove the element from the front of this ring buffer and load that
+    /// element into the specified `value`.  If the ring buffer is empty,
+    /// block until it is not empty.  Return 0.
+    int popFront(ELEMENT* value);
+
+    /// Attempt to remove the element from the front of this ring buffer
+    /// without blocking, and, if successful, load the specified `value`
+    /// with the removed element.  Return 0 on success, and a non-zero value
+    /// if the ring buffer was empty.  On failure, `value` is not changed.
+    int tryPopFront(ELEMENT* value);
+
+    /// Attempt to remove up to the specified `maxValues` elements from the
+    /// front of this ring buffer without blocking, and load them, in order,
+    /// into the array starting at the specified `values`.  Return the
+    /// number of elements removed.
+    int tryPopFrontBulk(ELEMENT* values, int maxValues);
+
+    /// Remove all elements from this ring buffer.
+    void removeAll();
+
+    /// Disable pushing into this ring buffer.  All subsequent calls to
+    /// `pushBack`, `tryPushBack` and `tryPushBackBulk` fail immediately, as
+    /// well as all blocked invocations of `pushBack`.
+    void disablePushBack();
+
+    /// Enable pushing into this ring buffer.
+    void enablePushBack();
+
+    // ACCESSORS
+
+    /// Return the maximum number of elements that may be stored in this
+    /// ring buffer.
+    bsls::Types::Int64 capacity() const;
+
+    /// Return `true` if this ring buffer is empty, and `false` otherwise.
+    /// Note that the returned value may be obsolete by the time it is
+    /// observed by the caller.
+    bool isEmpty() const;
+
+    /// Return `true` if pushing into this ring buffer is disabled, and
+    /// `false` otherwise.
+    bool isPushBackDisabled() const;
+
+    /// Return the number of elements in this ring buffer.  Note that the
+    /// returned value may be obsolete by the time it is observed by the
+    /// caller.
+    bsls::Types::Int64 numElements() const;
+};
+
+// =================================================
+// struct MonitoredQueueTraits< RingBuffer<ELEMENT> >
+// =================================================
+
+/// This specialization provides the types and functions necessary to
+/// interface a `bmqc::MonitoredQueue` with a `bmqc::RingBuffer`.
+template <typename ELEMENT>
+struct MonitoredQueueTraits<RingBuffer<ELEMENT> > {
+    // PUBLIC TYPES
+    typedef ELEMENT             ElementType;
+    typedef int                 InitialCapacityType;
+    typedef RingBuffer<ELEMENT> QueueType;
+
+    // CLASS METHODS
+
+    /// Return the maximum number of elements that may be stored in the
+    /// specified `queue`.
+    static bsls::Types::Int64 capacity(const QueueType& queue);
+
+    /// Return `true` if the specified `queue` is enqueue disabled, and
+    /// `false` otherwise.
+    static bool isPushBackDisabled(const QueueType& queue);
+
+    /// Disable enqueuing into the specified `queue`.
+    static void disablePushBack(QueueType* queue);
+
+    /// Enable enqueuing into the specified `queue`.
+    static void enablePushBack(QueueType* queue);
+
+    /// Remove the element from the front of the specified `queue` and load
+    /// that element into the specified `buffer`.  Return 0 on success, and
+    /// a non-zero value otherwise.
+    static int popFront(QueueType* queue, ElementType* buffer);
+
+    /// Attempt to move up to the specified `numValues` elements starting at
+    /// the specified `values` to the back of the specified `queue` without
+    /// blocking.  Return the number of elements moved.
+    static int
+    tryPushBackBulk(QueueType* queue, ElementType* values, int numValues);
+
+    /// Attempt to remove up to the specified `maxValues` elements from the
+    /// front of the specified `queue` without blocking, and load them into
+    /// the array starting at the specified `values`.  Return the number of
+    /// elements removed.
+    static int
+    tryPopFrontBulk(QueueType* queue, ElementType* values, int maxValues);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ----------------
+// class RingBuffer
+// ----------------
+
+// PRIVATE CLASS METHODS
+template <typename ELEMENT>
+inline bsls::Types::Int64 RingBuffer<ELEMENT>::roundUpCapacity(int capacity)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(0 < capacity);
+
+    bsls::Types::Int64 result = 1;
+    while (result < capacity) {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+// PRIVATE MANIPULATORS
+template <typename ELEMENT>
+inline int RingBuffer<ELEMENT>::reserve(bsls::Types::Int64* position,
+                                        int                 numElements)
+{
+    bsls::Types::Int64 tail = d_tail.loadRelaxed();
+    while (true) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_isPushBackDisabled)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return 0;  // RETURN
+        }
+
+        // The consumer releases slots in order before publishing the head,
+        // so all the positions below 'head + capacity' are ready for
+        // writing.  The sequentially consistent load pairs with the
+        // sequentially consistent store of the head by the consumer, see
+        // 'notifyProducers'.
+        const bsls::Types::Int64 available = d_capacity -
+                                             (tail - d_head.load());
+        if (available <= 0) {
+            // Full
+            return 0;  // RETURN
+        }
+
+        const int count = available < numElements
+                              ? static_cast<int>(available)
+                              : numElements;
+
+        const bsls::Types::Int64 prevTail = d_tail.testAndSwapAcqRel(
+            tail,
+            tail + count);
+        if (prevTail == tail) {
+            *position = tail;
+            return count;  // RETURN
+        }
+
+        // Another producer reserved positions first, try again
+        tail = prevTail;
+    }
+}
+
+template <typename ELEMENT>
+inline void RingBuffer<ELEMENT>::publish(bsls::Types::Int64 position)
+{
+    // The sequentially consistent store pairs with the sequentially
+    // consistent increment of 'd_numWaitingConsumers' by the consumer
+    // before it parks, so that either it sees this element, or this
+    // producer sees it is parked.
+    d_slots_p[position & d_mask].d_sequence.store(position + 1);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_numWaitingConsumers.load() !=
+                                              0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_notEmptyCondition.signal();
+    }
+}
+
+template <typename ELEMENT>
+inline void RingBuffer<ELEMENT>::consume(bsls::Types::Int64 position,
+                                         ELEMENT*           value)
+{
+    Slot& slot = d_slots_p[position & d_mask];
+
+    *value = bslmf::MovableRefUtil::move(slot.d_value.object());
+    bslma::DestructionUtil::destroy(slot.d_value.address());
+
+    slot.d_sequence.storeRelease(position + d_capacity);
+}
+
+template <typename ELEMENT>
+inline void RingBuffer<ELEMENT>::notifyProducers()
+{
+    // The head was published with a sequentially consistent store, pairing
+    // with the sequentially consistent increment of 'd_numWaitingProducers'
+    // by a producer before it parks, so that either it sees the new head,
+    // or this consumer sees it is parked.
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_numWaitingProducers.load() !=
+                                              0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_notFullCondition.broadcast();
+    }
+}
+
+// CREATORS
+template <typename ELEMENT>
+inline RingBuffer<ELEMENT>::RingBuffer(int               capacity,
+                                       bslma::Allocator* basicAllocator)
+: d_head(0)
+, d_tail(0)
+, d_capacity(roundUpCapacity(capacity))
+, d_mask(d_capacity - 1)
+, d_slots_p(0)
+, d_isPushBackDisabled(false)
+, d_numWaitingConsumers(0)
+, d_numWaitingProducers(0)
+, d_mutex()
+, d_notEmptyCondition()
+, d_notFullCondition()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_slots_p = static_cast<Slot*>(d_allocator_p->allocate(
+        static_cast<bsls::Types::size_type>(d_capacity) * sizeof(Slot)));
+    for (bsls::Types::Int64 i = 0; i < d_capacity; ++i) {
+        new (&d_slots_p[i]) Slot();
+        d_slots_p[i].d_sequence.storeRelaxed(i);
+    }
+}
+
+template <typename ELEMENT>
+inline RingBuffer<ELEMENT>::~RingBuffer()
+{
+    removeAll();
+
+    for (bsls::Types::Int64 i = 0; i < d_capacity; ++i) {
+        d_slots_p[i].~Slot();
+    }
+    d_allocator_p->deallocate(d_slots_p);
+}
+
+// MANIPULATORS
+template <typename ELEMENT>
+inline int RingBuffer<ELEMENT>::tryPushBack(const ELEMENT& value)
+{
+    bsls::Types::Int64 position;
+    if (reserve(&position, 1) == 0) {
+        return -1;  // RETURN
+    }
+
+    bslma::ConstructionUtil::construct(
+        d_slots_p[position & d_mask].d_value.address(),
+        d_allocator_p,
+        value);
+    publish(position);
+
+    return 0;
+}
+
+template <typename ELEMENT>
+inline int RingBuffer<ELEMENT>::tryPushBack(bslmf::MovableRef<ELEMENT> value)
+{
+    bsls::Types::Int64 position;
+    if (reserve(&position, 1) == 0) {
+        return -1;  // RETURN
+    }
+
+    bslma::ConstructionUtil::construct(
+        d_slots_p[position & d_mask].d_value.address(),
+        d_allocator_p,
+        bslmf::MovableRefUtil::move(value));
+    publish(position);
+
+    return 0;
+}
+
+template <typename ELEMENT>
+inline int RingBuffer<ELEMENT>::pushBack(const ELEMENT& value)
+{
+    for (int i = 0; i < k_SPIN_COUNT; ++i) {
+        if (tryPushBack(value) == 0) {
+            return 0;  // RETURN
+        }
+
+        if (d_isPushBackDisabled) {
+            return -1;  // RETURN
+        }
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    ++d_numWaitingProducers;
+    while (tryPushBack(value) != 0) {
+        if (d_isPushBackDisabled) {
+            --d_numWaitingProducers;
+            return -1;  // RETURN
+        }
+
+        d_notFullCondition.wait(&d_mutex);
+    }
+    --d_numWaitingProducers;
+
+    return 0;
+}
+
+template <typename ELEMENT>
+inline int RingBuffer<ELEMENT>::pushBack(bslmf::MovableRef<ELEMENT> value)
+{
+    ELEMENT& object = bslmf::MovableRefUtil::access(value);
+
+    for (int i = 0; i < k_SPIN_COUNT; ++i) {
+        if (tryPushBack(bslmf::MovableRefUtil::move(object)) == 0) {
+            return 0;  // RETURN
+        }
+
+        if (d_isPushBackDisabled) {
+            return -1;  // RETURN
+        }
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    ++d_numWaitingProducers;
+    while (tryPushBack(bslmf::MovableRefUtil::move(object)) != 0) {
+        if (d_isPushBackDisabled) {
+            --d_numWaitingProducers;
+            return -1;  // RETURN
+        }
+
+        d_notFullCondition.wait(&d_mutex);
+    }
+    --d_numWaitingProducers;
+
+    return 0;
+}
+
+template <typename ELEMENT>
+inline int RingBuffer<ELEMENT>::tryPushBackBulk(ELEMENT* values,
+                                                int      numValues)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(values || numValues == 0);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (numValues == 0) {
+        return 0;  // RETURN
+    }
+
+    bsls::Types::Int64 position;
+    const int          count = reserve(&position, numValues);
+    for (int i = 0; i < count; ++i) {
+        bslma::ConstructionUtil::construct(
+            d_slots_p[(position + i) & d_mask].d_value.address(),
+            d_allocator_p,
+            bslmf::MovableRefUtil::move(values[i]));
+        publish(position + i);
+    }
+
+    return count;
+}
+
+template <typename ELEMENT>
+inline int RingBuffer<ELEMENT>::popFront(ELEMENT* value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(value);
+
+    for (int i = 0; i < k_SPIN_COUNT; ++i) {
+        if (tryPopFront(value) == 0) {
+            return 0;  // RETURN
+        }
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    ++d_numWaitingConsumers;
+    while (tryPopFront(value) != 0) {
+        d_notEmptyCondition.wait(&d_mutex);
+    }
+    --d_numWaitingConsumers;
+
+    return 0;
+}
+
+template <typename ELEMENT>
+inline int RingBuffer<ELEMENT>::tryPopFront(ELEMENT* value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(value);
+
+    const bsls::Types::Int64 head = d_head.loadRelaxed();
+    if (d_slots_p[head & d_mask].d_sequence.load() != head + 1) {
+        // Empty, or the producer of the front element is not done yet
+        return -1;  // RETURN
+    }
+
+    consume(head, value);
+    d_head.store(head + 1);
+    notifyProducers();
+
+    return 0;
+}
+
+template <typename ELEMENT>
+inline int RingBuffer<ELEMENT>::tryPopFrontBulk(ELEMENT* values,
+                                                int      maxValues)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(values || maxValues == 0);
+    BSLS_ASSERT_SAFE(0 <= maxValues);
+
+    const bsls::Types::Int64 head  = d_head.loadRelaxed();
+    int                      count = 0;
+    while (count < maxValues &&
+           d_slots_p[(head + count) & d_mask].d_sequence.load() ==
+               head + count + 1) {
+        consume(head + count, &values[count]);
+        ++count;
+    }
+
+    if (count != 0) {
+        d_head.store(head + count);
+        notifyProducers();
+    }
+
+    return count;
+}
+
+template <typename ELEMENT>
+inline void RingBuffer<ELEMENT>::removeAll()
+{
+    bsls::Types::Int64 head = d_head.loadRelaxed();
+    while (d_slots_p[head & d_mask].d_sequence.load() == head + 1) {
+        Slot& slot = d_slots_p[head & d_mask];
+        bslma::DestructionUtil::destroy(slot.d_value.address());
+        slot.d_sequence.storeRelease(head + d_capacity);
+        ++head;
+    }
+
+    d_head.store(head);
+    notifyProducers();
+}
+
+template <typename ELEMENT>
+inline void RingBuffer<ELEMENT>::disablePushBack()
+{
+    d_isPushBackDisabled = true;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    d_notFullCondition.broadcast();
+}
+
+template <typename ELEMENT>
+inline void RingBuffer<ELEMENT>::enablePushBack()
+{
+    d_isPushBackDisabled = false;
+}
+
+// ACCESSORS
+template <typename ELEMENT>
+inline bsls::Types::Int64 RingBuffer<ELEMENT>::capacity() const
+{
+    return d_capacity;
+}
+
+template <typename ELEMENT>
+inline bool RingBuffer<ELEMENT>::isEmpty() const
+{
+    return numElements() == 0;
+}
+
+template <typename ELEMENT>
+inline bool RingBuffer<ELEMENT>::isPushBackDisabled() const
+{
+    return d_isPushBackDisabled;
+}
+
+template <typename ELEMENT>
+inline bsls::Types::Int64 RingBuffer<ELEMENT>::numElements() const
+{
+    // Load the head first, so that the result is never negative.
+    const bsls::Types::Int64 head = d_head.loadAcquire();
+    const bsls::Types::Int64 tail = d_tail.loadAcquire();
+
+    return tail - head;
+}
+
+// -------------------------------------------------
+// struct MonitoredQueueTraits< RingBuffer<ELEMENT> >
+// -------------------------------------------------
+
+template <typename ELEMENT>
+inline bsls::Types::Int64
+MonitoredQueueTraits<RingBuffer<ELEMENT> >::capacity(const QueueType& queue)
+{
+    return queue.capacity();
+}
+
+template <typename ELEMENT>
+inline bool MonitoredQueueTraits<RingBuffer<ELEMENT> >::isPushBackDisabled(
+    const QueueType& queue)
+{
+    return queue.isPushBackDisabled();
+}
+
+template <typename ELEMENT>
+inline void MonitoredQueueTraits<RingBuffer<ELEMENT> >::disablePushBack(
+    QueueType* queue)
+{
+    queue->disablePushBack();
+}
+
+template <typename ELEMENT>
+inline void MonitoredQueueTraits<RingBuffer<ELEMENT> >::enablePushBack(
+    QueueType* queue)
+{
+    queue->enablePushBack();
+}
+
+template <typename ELEMENT>
+inline int
+MonitoredQueueTraits<RingBuffer<ELEMENT> >::popFront(QueueType*   queue,
+                                                     ElementType* buffer)
+{
+    return queue->popFront(buffer);
+}
+
+template <typename ELEMENT>
+inline int MonitoredQueueTraits<RingBuffer<ELEMENT> >::tryPushBackBulk(
+    QueueType*   queue,
+    ElementType* values,
+    int          numValues)
+{
+    return queue->tryPushBackBulk(values, numValues);
+}
+
+template <typename ELEMENT>
+inline int MonitoredQueueTraits<RingBuffer<ELEMENT> >::tryPopFrontBulk(
+    QueueType*   queue,
+    ElementType* values,
+    int          maxValues)
+{
+    return queue->tryPopFrontBulk(values, maxValues);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,558 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqc_monitoredqueue_ringbuffer.h>
+
+#include <bmqc_monitoredqueue_bdlccfixedqueue.h>
+#include <bmqu_printutil.h>
+
+// BDE
+#include <bdlcc_fixedqueue.h>
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bdlmt_threadpool.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bsla_annotations.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+
+namespace {
+
+typedef bmqc::RingBuffer<int>                   IntRingBuffer;
+typedef bmqc::MonitoredQueue<IntRingBuffer>     MonitoredIntRingBuffer;
+typedef bsl::vector<bmqc::MonitoredQueueState::Enum> StateVector;
+
+static void onStateChanged(StateVector*                    states,
+                           bmqc::MonitoredQueueState::Enum state)
+{
+    states->push_back(state);
+}
+
+/// Push the specified `numItems` values `producerId * numItems + i` (with
+/// `i` in `[0, numItems)`), in order, to the specified `queue` using
+/// blocking pushes, and post the specified `done` semaphore.
+template <class QUEUE>
+static void multiThreadedPusher(QUEUE*            queue,
+                                int               producerId,
+                                int               numItems,
+                                bslmt::Semaphore* done)
+{
+    for (int i = 0; i < numItems; ++i) {
+        const int value = producerId * numItems + i;
+        BSLS_ASSERT_OPT(queue->pushBack(value) == 0);
+    }
+
+    done->post();
+}
+
+template <class QUEUE>
+static void performanceTestPopper(QUEUE* queue, int numItems)
+{
+    int value = 0;
+    for (int i = 0; i < numItems; ++i) {
+        queue->popFront(&value);
+    }
+}
+
+template <class QUEUE>
+static void performanceTestPusher(QUEUE*            queue,
+                                  int               numItems,
+                                  bslmt::Semaphore* done)
+{
+    for (int i = 0; i < numItems; ++i) {
+        const int value = i;
+        queue->pushBack(value);
+    }
+
+    done->post();
+}
+
+static void printProcessedItems(int numItems, bsls::Types::Int64 elapsedTime)
+{
+    const double numSeconds = static_cast<double>(elapsedTime) / 1000000000LL;
+    const bsls::Types::Int64 itemsPerSec = static_cast<bsls::Types::Int64>(
+        numItems / numSeconds);
+
+    bsl::cout << "Processed " << numItems << " items in "
+              << bmqu::PrintUtil::prettyTimeInterval(elapsedTime) << ". "
+              << bmqu::PrintUtil::prettyNumber(itemsPerSec) << "/s"
+              << bsl::endl;
+}
+
+/// Push and pop the specified `numItems` items through the specified
+/// `queue`, using the specified `numPushers` producer threads and one
+/// consumer thread, and print the throughput.
+template <class QUEUE>
+static void runPerformanceTest(QUEUE* queue, int numItems, int numPushers)
+{
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        numPushers + 1,                   // minThreads
+        numPushers + 1,                   // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        bmqtst::TestHelperUtil::allocator());
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    const int          numItemsPerPusher = numItems / numPushers;
+    bslmt::Semaphore   pushersDone;
+    bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+
+    threadPool.enqueueJob(
+        bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                              &performanceTestPopper<QUEUE>,
+                              queue,
+                              numItemsPerPusher * numPushers));
+    for (int i = 0; i < numPushers; ++i) {
+        threadPool.enqueueJob(
+            bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                                  &performanceTestPusher<QUEUE>,
+                                  queue,
+                                  numItemsPerPusher,
+                                  &pushersDone));
+    }
+
+    for (int i = 0; i < numPushers; ++i) {
+        pushersDone.wait();
+    }
+    threadPool.drain();
+
+    const bsls::Types::Int64 endTime = bsls::TimeUtil::getTimer();
+
+    printProcessedItems(numItemsPerPusher * numPushers, endTime - startTime);
+}
+
+}  // close unnamed namespace
+
+// Check that all member functions can be instantiated.
+
+namespace BloombergLP {
+namespace bmqc {
+
+template class RingBuffer<bsl::string>;
+template class MonitoredQueue<RingBuffer<int> >;
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise basic functionality before beginning testing in earnest.
+//   Probe that functionality to discover basic errors.
+//
+// Testing:
+//   Basic functionality.
+//   RingBuffer(int capacity, bslma::Allocator *basicAllocator = 0);
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    {
+        PV("Capacity is rounded up to a power of two");
+
+        BMQTST_ASSERT_EQ(IntRingBuffer(1, alloc).capacity(), 1);
+        BMQTST_ASSERT_EQ(IntRingBuffer(2, alloc).capacity(), 2);
+        BMQTST_ASSERT_EQ(IntRingBuffer(10, alloc).capacity(), 16);
+        BMQTST_ASSERT_EQ(IntRingBuffer(16, alloc).capacity(), 16);
+        BMQTST_ASSERT_EQ(IntRingBuffer(17, alloc).capacity(), 32);
+    }
+
+    {
+        PV("Push and pop, in order, across the end of the buffer");
+
+        IntRingBuffer buffer(4, alloc);
+        BMQTST_ASSERT(buffer.isEmpty());
+        BMQTST_ASSERT_EQ(buffer.numElements(), 0);
+
+        int value = -1;
+        BMQTST_ASSERT_NE(buffer.tryPopFront(&value), 0);
+        BMQTST_ASSERT_EQ(value, -1);
+
+        for (int round = 0; round < 3; ++round) {
+            for (int i = 0; i < 4; ++i) {
+                BMQTST_ASSERT_EQ_D(i, buffer.tryPushBack(round * 4 + i), 0);
+            }
+            BMQTST_ASSERT_EQ(buffer.numElements(), 4);
+
+            // Full
+            BMQTST_ASSERT_NE(buffer.tryPushBack(42), 0);
+
+            for (int i = 0; i < 4; ++i) {
+                BMQTST_ASSERT_EQ_D(i, buffer.tryPopFront(&value), 0);
+                BMQTST_ASSERT_EQ_D(i, value, round * 4 + i);
+            }
+            BMQTST_ASSERT(buffer.isEmpty());
+        }
+    }
+
+    {
+        PV("Disable and enable");
+
+        IntRingBuffer buffer(4, alloc);
+        buffer.disablePushBack();
+        BMQTST_ASSERT(buffer.isPushBackDisabled());
+        BMQTST_ASSERT_NE(buffer.tryPushBack(1), 0);
+        BMQTST_ASSERT_NE(buffer.pushBack(1), 0);
+
+        buffer.enablePushBack();
+        BMQTST_ASSERT(!buffer.isPushBackDisabled());
+        BMQTST_ASSERT_EQ(buffer.pushBack(1), 0);
+        BMQTST_ASSERT_EQ(buffer.numElements(), 1);
+    }
+
+    {
+        PV("Allocator-aware elements");
+
+        // The buffer is destroyed while still holding elements, which must
+        // be destroyed and their memory released.
+        bmqc::RingBuffer<bsl::string> buffer(4, alloc);
+        BMQTST_ASSERT_EQ(
+            buffer.tryPushBack(bsl::string("a string long enough to not fit "
+                                           "in the short string buffer",
+                                           alloc)),
+            0);
+        BMQTST_ASSERT_EQ(
+            buffer.tryPushBack(bsl::string("another string long enough to "
+                                           "not fit in the short buffer",
+                                           alloc)),
+            0);
+
+        bsl::string value(alloc);
+        BMQTST_ASSERT_EQ(buffer.popFront(&value), 0);
+        BMQTST_ASSERT_EQ(value,
+                         "a string long enough to not fit in the short "
+                         "string buffer");
+    }
+}
+
+static void test2_bulkOperations()
+// ------------------------------------------------------------------------
+// BULK OPERATIONS
+//
+// Concerns:
+//   - 'tryPushBackBulk' pushes as many elements as fit, in order.
+//   - 'tryPopFrontBulk' pops as many elements as available, in order.
+//   - Bulk operations work across the end of the buffer.
+//
+// Testing:
+//   tryPushBackBulk
+//   tryPopFrontBulk
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BULK OPERATIONS");
+
+    IntRingBuffer buffer(8, bmqtst::TestHelperUtil::allocator());
+
+    int values[10];
+    for (int i = 0; i < 10; ++i) {
+        values[i] = i;
+    }
+
+    // Move the head and tail close to the end of the buffer
+    for (int i = 0; i < 6; ++i) {
+        int value;
+        BMQTST_ASSERT_EQ(buffer.tryPushBack(i), 0);
+        BMQTST_ASSERT_EQ(buffer.tryPopFront(&value), 0);
+    }
+
+    // Push more than the capacity
+    BMQTST_ASSERT_EQ(buffer.tryPushBackBulk(values, 0), 0);
+    BMQTST_ASSERT_EQ(buffer.tryPushBackBulk(values, 10), 8);
+    BMQTST_ASSERT_EQ(buffer.numElements(), 8);
+    BMQTST_ASSERT_EQ(buffer.tryPushBackBulk(values + 8, 2), 0);
+
+    // Pop in two steps
+    int popped[10] = {0};
+    BMQTST_ASSERT_EQ(buffer.tryPopFrontBulk(popped, 3), 3);
+    BMQTST_ASSERT_EQ(buffer.numElements(), 5);
+    BMQTST_ASSERT_EQ(buffer.tryPopFrontBulk(popped + 3, 10), 5);
+    BMQTST_ASSERT(buffer.isEmpty());
+    BMQTST_ASSERT_EQ(buffer.tryPopFrontBulk(popped, 10), 0);
+
+    for (int i = 0; i < 8; ++i) {
+        BMQTST_ASSERT_EQ_D(i, popped[i], i);
+    }
+
+    // Disabled
+    buffer.disablePushBack();
+    BMQTST_ASSERT_EQ(buffer.tryPushBackBulk(values, 10), 0);
+}
+
+static void test3_MonitoredQueue_watermarks()
+// ------------------------------------------------------------------------
+// MONITORED QUEUE - WATERMARKS
+//
+// Concerns:
+//   A 'bmqc::MonitoredQueue' backed by a 'bmqc::RingBuffer' reports the
+//   same state transitions as with the other backends, including when
+//   elements are pushed and popped in bulk.
+//
+// Plan:
+//   1. Create a monitored queue of capacity 16 with watermarks 4, 8 and 12.
+//   2. Push elements in bulk and one at a time, and check the reported
+//      states when crossing the high watermarks and filling the queue.
+//   3. Pop elements in bulk down to the low watermark, and check the queue
+//      reports it is back to normal.
+//
+// Testing:
+//   MonitoredQueue<RingBuffer>::tryPushBackBulk
+//   MonitoredQueue<RingBuffer>::tryPopFrontBulk
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("MONITORED QUEUE - WATERMARKS");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    // CONSTANTS
+    const int k_QUEUE_SIZE      = 16;
+    const int k_LOW_WATERMARK   = 4;
+    const int k_HIGH_WATERMARK  = 8;
+    const int k_HIGH_WATERMARK2 = 12;
+
+    StateVector states(alloc);
+
+    // 1. Create the queue
+    MonitoredIntRingBuffer queue(k_QUEUE_SIZE, alloc);
+    queue.setWatermarks(k_LOW_WATERMARK, k_HIGH_WATERMARK, k_HIGH_WATERMARK2)
+        .setStateCallback(bdlf::BindUtil::bindS(alloc,
+                                                &onStateChanged,
+                                                &states,
+                                                bdlf::PlaceHolders::_1));
+    BMQTST_ASSERT_EQ(queue.capacity(), k_QUEUE_SIZE);
+    BMQTST_ASSERT_EQ(queue.state(), bmqc::MonitoredQueueState::e_NORMAL);
+
+    // 2. Push
+    int values[k_QUEUE_SIZE];
+    for (int i = 0; i < k_QUEUE_SIZE; ++i) {
+        values[i] = i;
+    }
+
+    BMQTST_ASSERT_EQ(queue.tryPushBackBulk(values, k_HIGH_WATERMARK - 1),
+                     k_HIGH_WATERMARK - 1);
+    BMQTST_ASSERT_EQ(queue.numElements(), k_HIGH_WATERMARK - 1);
+    BMQTST_ASSERT(states.empty());
+
+    BMQTST_ASSERT_EQ(queue.tryPushBack(k_HIGH_WATERMARK - 1), 0);
+    BMQTST_ASSERT_EQ(states.size(), 1U);
+    BMQTST_ASSERT_EQ(states.back(),
+                     bmqc::MonitoredQueueState::e_HIGH_WATERMARK_REACHED);
+
+    // Crossing the second high watermark with a single bulk push
+    BMQTST_ASSERT_EQ(queue.tryPushBackBulk(values + k_HIGH_WATERMARK, 6), 6);
+    BMQTST_ASSERT_EQ(queue.numElements(), k_HIGH_WATERMARK + 6);
+    BMQTST_ASSERT_EQ(states.size(), 2U);
+    BMQTST_ASSERT_EQ(states.back(),
+                     bmqc::MonitoredQueueState::e_HIGH_WATERMARK_2_REACHED);
+
+    // Filling the queue
+    BMQTST_ASSERT_EQ(queue.tryPushBackBulk(values, 4), 2);
+    BMQTST_ASSERT_EQ(queue.numElements(), k_QUEUE_SIZE);
+    BMQTST_ASSERT_EQ(states.size(), 3U);
+    BMQTST_ASSERT_EQ(states.back(), bmqc::MonitoredQueueState::e_QUEUE_FILLED);
+    BMQTST_ASSERT_EQ(queue.state(), bmqc::MonitoredQueueState::e_QUEUE_FILLED);
+
+    // 3. Pop
+    int popped[k_QUEUE_SIZE];
+    BMQTST_ASSERT_EQ(queue.tryPopFrontBulk(popped,
+                                           k_QUEUE_SIZE - k_LOW_WATERMARK - 1),
+                     k_QUEUE_SIZE - k_LOW_WATERMARK - 1);
+    BMQTST_ASSERT_EQ(states.size(), 3U);
+
+    BMQTST_ASSERT_EQ(queue.tryPopFrontBulk(popped, 1), 1);
+    BMQTST_ASSERT_EQ(queue.numElements(), k_LOW_WATERMARK);
+    BMQTST_ASSERT_EQ(states.size(), 4U);
+    BMQTST_ASSERT_EQ(states.back(), bmqc::MonitoredQueueState::e_NORMAL);
+
+    queue.reset();
+    BMQTST_ASSERT_EQ(queue.numElements(), 0);
+    BMQTST_ASSERT(queue.isEmpty());
+}
+
+static void test4_multipleProducers()
+// ------------------------------------------------------------------------
+// MULTIPLE PRODUCERS
+//
+// Concerns:
+//   With several producers pushing concurrently to a small ring buffer,
+//   forcing both producers and consumer to park, all elements are popped
+//   exactly once, and the elements of each producer are popped in order.
+//
+// Plan:
+//   1. Start several producers pushing a sequence of values each to a
+//      monitored ring buffer of capacity 4.
+//   2. Pop all the elements from the main thread, and verify the order of
+//      the values of each producer.
+//
+// Testing:
+//   pushBack
+//   popFront
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // The thread pool uses the default allocator for its threads.
+
+    bmqtst::TestHelper::printTestName("MULTIPLE PRODUCERS");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    // CONSTANTS
+    const int k_NUM_PRODUCERS = 4;
+    const int k_NUM_ITEMS     = 10000;
+
+    MonitoredIntRingBuffer queue(4, alloc);
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        k_NUM_PRODUCERS,                  // minThreads
+        k_NUM_PRODUCERS,                  // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        alloc);
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    // 1. Start the producers
+    bslmt::Semaphore done;
+    for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+        threadPool.enqueueJob(
+            bdlf::BindUtil::bindS(alloc,
+                                  &multiThreadedPusher<MonitoredIntRingBuffer>,
+                                  &queue,
+                                  i,
+                                  k_NUM_ITEMS,
+                                  &done));
+    }
+
+    // 2. Pop everything
+    bsl::vector<int> nextValues(k_NUM_PRODUCERS, 0, alloc);
+    for (int i = 0; i < k_NUM_PRODUCERS * k_NUM_ITEMS; ++i) {
+        int value = -1;
+        BMQTST_ASSERT_EQ(queue.popFront(&value), 0);
+
+        const int producerId = value / k_NUM_ITEMS;
+        BMQTST_ASSERT_GE(producerId, 0);
+        BMQTST_ASSERT_LT(producerId, k_NUM_PRODUCERS);
+        BMQTST_ASSERT_EQ_D(producerId,
+                           value % k_NUM_ITEMS,
+                           nextValues[producerId]);
+        ++nextValues[producerId];
+    }
+
+    for (int i = 0; i < k_NUM_PRODUCERS; ++i) {
+        done.wait();
+        BMQTST_ASSERT_EQ_D(i, nextValues[i], k_NUM_ITEMS);
+    }
+    BMQTST_ASSERT(queue.isEmpty());
+    BMQTST_ASSERT_EQ(queue.numElements(), 0);
+
+    threadPool.stop();
+}
+
+BSLA_MAYBE_UNUSED
+static void testN1_performance()
+// ------------------------------------------------------------------------
+// PERFORMANCE TEST
+//
+// Concerns:
+//  a) Compare the throughput of a MonitoredQueue backed by a
+//     bmqc::RingBuffer with one backed by a bdlcc::FixedQueue.
+//
+// Plan:
+//  1) For each backend, push items from one, then several, producer
+//     threads to a single consumer thread as quickly as possible, and
+//     report the throughput.
+//
+// Testing:
+//  Performance
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    bmqtst::TestHelper::printTestName("PERFORMANCE TEST");
+
+    // CONSTANTS
+    const int k_NUM_ITERATIONS = 10 * 1000 * 1000;  // 10 M
+    const int k_QUEUE_SIZE     = 256 * 1024;        // 256K
+    const int k_NUM_PUSHERS    = 4;
+
+    typedef bmqc::MonitoredQueue<bdlcc::FixedQueue<int> > MonitoredFixedQueue;
+
+    PRINT("==========");
+    PRINT("RingBuffer");
+    PRINT("==========");
+    {
+        MonitoredIntRingBuffer queue(k_QUEUE_SIZE,
+                                     bmqtst::TestHelperUtil::allocator());
+        runPerformanceTest(&queue, k_NUM_ITERATIONS, 1);
+        runPerformanceTest(&queue, k_NUM_ITERATIONS, k_NUM_PUSHERS);
+    }
+
+    PRINT("=================");
+    PRINT("bdlcc::FixedQueue");
+    PRINT("=================");
+    {
+        MonitoredFixedQueue queue(k_QUEUE_SIZE,
+                                  bmqtst::TestHelperUtil::allocator());
+        runPerformanceTest(&queue, k_NUM_ITERATIONS, 1);
+        runPerformanceTest(&queue, k_NUM_ITERATIONS, k_NUM_PUSHERS);
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 4: test4_multipleProducers(); break;
+    case 3: test3_MonitoredQueue_watermarks(); break;
+    case 2: test2_bulkOperations(); break;
+    case 1: test1_breathingTest(); break;
+    case -1: testN1_performance(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
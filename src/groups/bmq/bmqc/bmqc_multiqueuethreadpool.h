@@ -34,6 +34,25 @@
 // - Creating it with a 'bdlmt::EventScheduler' allows the
 //   'bmqc::MultiQueueThreadPool' to enqueue items on the appropriate queue at
 //   the requested time.
+// - Providing a batch event callback with 'setBatchEventCallback' makes each
+//   queue drain up to a configured number of events per wakeup and hand them
+//   to the callback at once, amortizing the per-event callback overhead (see
+//   'Batched processing' below).
+//
+/// Batched processing
+///------------------
+// By default, each event popped from a queue is passed individually to the
+// event callback of that queue, and an empty event is passed whenever the
+// queue is found empty.  When a batch event callback is configured, events
+// are instead accumulated into a batch of at most 'maxBatchSize' events which
+// is delivered as soon as it is full, the queue is found empty, or a monitor
+// event is popped.  Events are always delivered in the order they were
+// enqueued.  Whenever the queue is found empty, the batch callback is then
+// invoked with 0 events, which plays the role of the empty event of the
+// non-batched mode.  The callback may reset the events of the batch once they
+// are processed, to release them as early as possible; any event still set
+// when the callback returns is released by the MQTP before the next batch is
+// drained.
 //
 /// Usage
 ///-----
@@ -206,6 +225,19 @@ class MultiQueueThreadPoolConfig {
                                   bsls::AtomicInt64* lastProcessingStartTime)>
         EventFnCreatorFn;
 
+    /// Callback invoked to process the specified `numEvents` events stored
+    /// contiguously starting at the specified `events`.  A `numEvents` of
+    /// 0 means the queue is empty.
+    typedef bsl::function<void(EventSp* events, int numEvents)> BatchEventFn;
+
+    /// Create the batch event callback for the specified `queueId` and the
+    /// specified `lastProcessingStartTime` atomic pointer used to track
+    /// the processing start time of the last event for stuck detection.
+    typedef bsl::function<BatchEventFn(
+        int                queueId,
+        bsls::AtomicInt64* lastProcessingStartTime)>
+        BatchEventFnCreatorFn;
+
     // FRIENDS
     template <typename T>
     friend class MultiQueueThreadPool;
@@ -224,6 +256,14 @@ class MultiQueueThreadPoolConfig {
 
     EventFnCreatorFn d_eventCallbackCreatorFn;
 
+    /// Optional batch event callback creator.  When set, it takes
+    /// precedence over `d_eventCallbackCreatorFn`.
+    BatchEventFnCreatorFn d_batchEventCallbackCreatorFn;
+
+    /// Maximum number of events delivered per batch, or 0 if batched
+    /// processing is disabled.
+    int d_maxBatchSize;
+
     QueueCreatorFn d_queueCreatorFn;
 
     bsl::string d_name;
@@ -289,6 +329,16 @@ class MultiQueueThreadPoolConfig {
     /// Return a reference offering modifiable access to this object.
     MultiQueueThreadPoolConfig<TYPE>&
     setMonitorWarningTimeout(const bsls::TimeInterval& timeout);
+
+    /// Process the events of each queue in batches of at most the specified
+    /// `maxBatchSize` events, delivered to the callback created for that
+    /// queue by the specified `batchEventCallbackCreator`, instead of
+    /// delivering them one at a time to the event callback provided at
+    /// construction.  Return a reference offering modifiable access to this
+    /// object.  The behavior is undefined unless `0 < maxBatchSize`.
+    MultiQueueThreadPoolConfig<TYPE>& setBatchEventCallback(
+        const BatchEventFnCreatorFn& batchEventCallbackCreator,
+        int                          maxBatchSize);
 };
 
 // ==========================
@@ -308,6 +358,7 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
     typedef typename Config::Queue           Queue;
     typedef typename Config::QueueCreatorFn  QueueCreatorFn;
     typedef typename Config::EventFn         EventFn;
+    typedef typename Config::BatchEventFn    BatchEventFn;
 
   private:
     // PRIVATE TYPES
@@ -332,6 +383,13 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
 
         EventFn d_eventCallback;
 
+        /// Batch event callback, set only if batched processing is enabled
+        BatchEventFn d_batchEventCallback;
+
+        /// Events popped from the queue and not yet delivered to
+        /// `d_batchEventCallback`
+        bsl::vector<EventSp> d_batch;
+
         bsls::AtomicInt d_monitorState;
 
         /// A thread-safe reference counter for the queue processing loop.
@@ -365,6 +423,8 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
         : d_queue_p(0)
         , d_name(basicAllocator)
         , d_eventCallback(bsl::allocator_arg, basicAllocator)
+        , d_batchEventCallback(bsl::allocator_arg, basicAllocator)
+        , d_batch(basicAllocator)
         , d_monitorState(e_MONITOR_PROCESSED)
         , d_processQueueRefCount(1)
         , d_lastProcessingStartTime(0)
@@ -451,6 +511,20 @@ class MultiQueueThreadPool BSLS_KEYWORD_FINAL {
     /// until a `0` event is popped off.
     void processQueue(QueueInfo& info);
 
+    /// Thread pool worker function used when batched processing is
+    /// enabled.  Pop events from the specified `info` queue and deliver
+    /// them in batches until a `0` event is popped off.
+    void processQueueInBatches(QueueInfo& info);
+
+    /// Deliver the pending events of the specified `info` queue, if any,
+    /// to its batch event callback and clear the batch.
+    void deliverBatch(QueueInfo& info);
+
+    /// Process a monitor event popped from the specified `info` queue.
+    /// Return `false` if the queue processing loop must stop, and `true`
+    /// otherwise.
+    bool processMonitorEvent(QueueInfo& info);
+
   private:
     // NOT IMPLEMENTED
     MultiQueueThreadPool(const MultiQueueThreadPool&) BSLS_KEYWORD_DELETED;
@@ -545,6 +619,8 @@ inline MultiQueueThreadPoolConfig<TYPE>::MultiQueueThreadPoolConfig(
 , d_eventCallbackCreatorFn(bsl::allocator_arg,
                            basicAllocator,
                            eventCallbackCreator)
+, d_batchEventCallbackCreatorFn(bsl::allocator_arg, basicAllocator)
+, d_maxBatchSize(0)
 , d_queueCreatorFn(bsl::allocator_arg, basicAllocator, queueCreator)
 , d_name(basicAllocator)
 , d_monitorAlarmString(basicAllocator)
@@ -566,6 +642,10 @@ inline MultiQueueThreadPoolConfig<TYPE>::MultiQueueThreadPoolConfig(
 , d_eventCallbackCreatorFn(bsl::allocator_arg,
                            basicAllocator,
                            other.d_eventCallbackCreatorFn)
+, d_batchEventCallbackCreatorFn(bsl::allocator_arg,
+                                basicAllocator,
+                                other.d_batchEventCallbackCreatorFn)
+, d_maxBatchSize(other.d_maxBatchSize)
 , d_queueCreatorFn(bsl::allocator_arg, basicAllocator, other.d_queueCreatorFn)
 , d_name(other.d_name, basicAllocator)
 , d_monitorAlarmString(other.d_monitorAlarmString, basicAllocator)
@@ -622,6 +702,21 @@ MultiQueueThreadPoolConfig<TYPE>::setMonitorWarningTimeout(
     return *this;
 }
 
+template <typename TYPE>
+inline MultiQueueThreadPoolConfig<TYPE>&
+MultiQueueThreadPoolConfig<TYPE>::setBatchEventCallback(
+    const BatchEventFnCreatorFn& batchEventCallbackCreator,
+    int                          maxBatchSize)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < maxBatchSize);
+
+    d_batchEventCallbackCreatorFn = batchEventCallbackCreator;
+    d_maxBatchSize                = maxBatchSize;
+
+    return *this;
+}
+
 // --------------------------
 // class MultiQueueThreadPool
 // --------------------------
@@ -708,6 +803,11 @@ inline void MultiQueueThreadPool<TYPE>::checkStuckEvents()
 template <typename TYPE>
 inline void MultiQueueThreadPool<TYPE>::processQueue(QueueInfo& info)
 {
+    if (d_config.d_maxBatchSize > 0) {
+        processQueueInBatches(info);
+        return;  // RETURN
+    }
+
     while (true) {
         EventSp   event;
         const int popRet = info.d_queue_p->tryPopFront(&event);
@@ -720,33 +820,89 @@ inline void MultiQueueThreadPool<TYPE>::processQueue(QueueInfo& info)
         if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == event)) {
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
-            // Process monitor event
-            if (0 == info.d_processQueueRefCount.subtractRelaxed(1)) {
-                // 0 ref count means that:
-                // - `stop()` was called: it released the initial reference.
-                // - It is the last monitor event enqueued to the queue.
-                // No need to process this event, it is time to return.
-                // Note: it is possible that another monitor event will be
-                //       enqueued right after the check is done, but it's okay.
-                //       We will skip it with any remainder events on `stop()`.
-                info.d_finished.post();
+            if (!processMonitorEvent(info)) {
                 return;  // RETURN
             }
+            continue;  // CONTINUE
+        }
+
+        info.d_eventCallback(event);
+    }
+}
+
+template <typename TYPE>
+inline void MultiQueueThreadPool<TYPE>::processQueueInBatches(QueueInfo& info)
+{
+    const size_t maxBatchSize = static_cast<size_t>(d_config.d_maxBatchSize);
+
+    while (true) {
+        EventSp   event;
+        const int popRet = info.d_queue_p->tryPopFront(&event);
+        if (popRet != 0) {
+            // Queue is empty: deliver what has been drained so far, notify
+            // the callback and wait for the next event.
+            deliverBatch(info);
+            info.d_batchEventCallback(0, 0);
+            info.d_queue_p->popFront(&event);
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == event)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
-            const MonitorEventState prevState = static_cast<MonitorEventState>(
-                info.d_monitorState.swap(e_MONITOR_PROCESSED));
-            if (prevState == e_MONITOR_STUCK) {
-                // The queue was stuck, but is now back to normal
-                BALL_LOG_INFO << "Queue '" << info.d_name << "' is back to "
-                              << "work";
+            // Deliver the pending events first, so that the monitor event
+            // accounts for them and none of them is dropped on `stop()`.
+            deliverBatch(info);
+            if (!processMonitorEvent(info)) {
+                return;  // RETURN
             }
             continue;  // CONTINUE
         }
 
-        info.d_eventCallback(event);
+        info.d_batch.push_back(bslmf::MovableRefUtil::move(event));
+        if (info.d_batch.size() == maxBatchSize) {
+            deliverBatch(info);
+        }
     }
 }
 
+template <typename TYPE>
+inline void MultiQueueThreadPool<TYPE>::deliverBatch(QueueInfo& info)
+{
+    if (info.d_batch.empty()) {
+        return;  // RETURN
+    }
+
+    info.d_batchEventCallback(info.d_batch.data(),
+                              static_cast<int>(info.d_batch.size()));
+    info.d_batch.clear();
+}
+
+template <typename TYPE>
+inline bool MultiQueueThreadPool<TYPE>::processMonitorEvent(QueueInfo& info)
+{
+    if (0 == info.d_processQueueRefCount.subtractRelaxed(1)) {
+        // 0 ref count means that:
+        // - `stop()` was called: it released the initial reference.
+        // - It is the last monitor event enqueued to the queue.
+        // No need to process this event, it is time to return.
+        // Note: it is possible that another monitor event will be
+        //       enqueued right after the check is done, but it's okay.
+        //       We will skip it with any remainder events on `stop()`.
+        info.d_finished.post();
+        return false;  // RETURN
+    }
+
+    const MonitorEventState prevState = static_cast<MonitorEventState>(
+        info.d_monitorState.swap(e_MONITOR_PROCESSED));
+    if (prevState == e_MONITOR_STUCK) {
+        // The queue was stuck, but is now back to normal
+        BALL_LOG_INFO << "Queue '" << info.d_name << "' is back to "
+                      << "work";
+    }
+
+    return true;
+}
+
 // CREATORS
 template <typename TYPE>
 inline MultiQueueThreadPool<TYPE>::MultiQueueThreadPool(
@@ -814,9 +970,18 @@ inline int MultiQueueThreadPool<TYPE>::start()
         queue.d_name          = name;
         queue.d_queue_p       = d_config.d_queueCreatorFn(static_cast<int>(i),
                                                     d_allocator_p);
-        queue.d_eventCallback = d_config.d_eventCallbackCreatorFn(
-            static_cast<int>(i),
-            &queue.d_lastProcessingStartTime);
+        if (d_config.d_maxBatchSize > 0) {
+            queue.d_batchEventCallback =
+                d_config.d_batchEventCallbackCreatorFn(
+                    static_cast<int>(i),
+                    &queue.d_lastProcessingStartTime);
+            queue.d_batch.reserve(d_config.d_maxBatchSize);
+        }
+        else {
+            queue.d_eventCallback = d_config.d_eventCallbackCreatorFn(
+                static_cast<int>(i),
+                &queue.d_lastProcessingStartTime);
+        }
     }
 
     BSLS_ASSERT_SAFE(d_config.d_threadPool_p->enabled());
@@ -34,6 +34,7 @@
 #include <bsla_annotations.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
+#include <bslmt_semaphore.h>
 #include <bslmt_threadattributes.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
@@ -139,6 +140,90 @@ static MQTP::EventFn performanceTestEventCbCreator(
                                  bdlf::PlaceHolders::_1);
 }
 
+/// Context shared with the batch event callback of the batch test.
+struct BatchTestContext {
+    // DATA
+
+    /// Values of the processed events, in order of processing
+    bsl::vector<int> d_values;
+
+    /// Size of each non-empty batch, in order of processing
+    bsl::vector<int> d_batchSizes;
+
+    /// Number of times the callback was notified of an empty queue
+    int d_numEmptyNotifications;
+
+    /// Posted when the callback starts processing a blocking event
+    bslmt::Semaphore d_blockedSignal;
+
+    /// Waited on by the callback when processing a blocking event
+    bslmt::Semaphore d_unblockSignal;
+
+    // CREATORS
+    explicit BatchTestContext(bslma::Allocator* allocator)
+    : d_values(allocator)
+    , d_batchSizes(allocator)
+    , d_numEmptyNotifications(0)
+    , d_blockedSignal()
+    , d_unblockSignal()
+    {
+        // NOTHING
+    }
+};
+
+static void
+batchEventCb(BatchTestContext* context, MQTP::EventSp* events, int numEvents)
+{
+    if (numEvents == 0) {
+        // No events means empty queue
+        ++context->d_numEmptyNotifications;
+        return;  // RETURN
+    }
+
+    context->d_batchSizes.push_back(numEvents);
+    for (int i = 0; i < numEvents; ++i) {
+        if (events[i]->value() < 0) {
+            // Negative value means blocking event
+            context->d_blockedSignal.post();
+            context->d_unblockSignal.wait();
+            continue;  // CONTINUE
+        }
+
+        context->d_values.push_back(events[i]->value());
+    }
+}
+
+static MQTP::BatchEventFn batchEventCbCreator(
+    BatchTestContext*     context,
+    BSLA_MAYBE_UNUSED int queueId,
+    BSLA_MAYBE_UNUSED bsls::AtomicInt64* lastProcessingStartTime,
+    bslma::Allocator*                    allocator)
+{
+    return bdlf::BindUtil::bindS(allocator,
+                                 &batchEventCb,
+                                 context,
+                                 bdlf::PlaceHolders::_1,   // events
+                                 bdlf::PlaceHolders::_2);  // numEvents
+}
+
+static void
+performanceTestBatchEventCb(BSLA_MAYBE_UNUSED MQTP::EventSp* events,
+                            BSLA_MAYBE_UNUSED int            numEvents)
+{
+    // NOTHING
+}
+
+static MQTP::BatchEventFn performanceTestBatchEventCbCreator(
+    BSLA_MAYBE_UNUSED int queueId,
+    BSLA_MAYBE_UNUSED bsls::AtomicInt64* lastProcessingStartTime,
+    bslma::Allocator*                    allocator)
+{
+    return bdlf::BindUtil::bindS(allocator,
+                                 &performanceTestBatchEventCb,
+                                 bdlf::PlaceHolders::_1,   // events
+                                 bdlf::PlaceHolders::_2);  // numEvents
+}
+
 struct PerformanceTestObject {
     int d_value;
 };
@@ -170,6 +255,65 @@ static void printProcessedItems(int numItems, bsls::Types::Int64 elapsedTime)
               << bsl::endl;
 }
 
+/// Enqueue the specified `numItems` events on a single queue MQTP using
+/// threads from the specified `threadPool` and delivering the events in
+/// batches of at most the specified `maxBatchSize` events, or one at a
+/// time if `maxBatchSize` is 0, and wait until they are all processed.
+/// Return the elapsed time, in nanoseconds.
+static bsls::Types::Int64 batchPerformanceRun(bdlmt::ThreadPool* threadPool,
+                                              int                maxBatchSize,
+                                              int                numItems)
+{
+    // CONSTANTS
+    const int k_FIXED_QUEUE_SIZE = 250 * 1000;  // 250K
+
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    MQTP::Config config(
+        1,  // numQueues
+        threadPool,
+        bdlf::BindUtil::bindS(
+            allocator,
+            &performanceTestEventCbCreator,
+            bdlf::PlaceHolders::_1,  // queueId
+            bdlf::PlaceHolders::_2,  // lastProcessingStartTime
+            allocator),
+        bdlf::BindUtil::bindS(allocator,
+                              &performanceTestQueueCreator,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // allocator
+                              k_FIXED_QUEUE_SIZE),
+        allocator);
+    if (maxBatchSize > 0) {
+        config.setBatchEventCallback(
+            bdlf::BindUtil::bindS(
+                allocator,
+                &performanceTestBatchEventCbCreator,
+                bdlf::PlaceHolders::_1,  // queueId
+                bdlf::PlaceHolders::_2,  // lastProcessingStartTime
+                allocator),
+            maxBatchSize);
+    }
+
+    MQTP mfqtp(config, allocator);
+    BSLS_ASSERT_OPT(mfqtp.start() == 0);
+
+    const bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < numItems; ++i) {
+        MQTP::EventSp event;
+        event.createInplace(allocator);
+        event->value() = i;
+        mfqtp.enqueueEvent(bslmf::MovableRefUtil::move(event), 0);
+    }
+
+    mfqtp.waitUntilEmpty();
+    const bsls::Types::Int64 endTime = bsls::TimeUtil::getTimer();
+
+    mfqtp.stop();
+
+    return endTime - startTime;
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -282,6 +426,123 @@ static void test1_breathingTest()
     threadPool.stop();
 }
 
+static void test2_batchEventCallback()
+// ------------------------------------------------------------------------
+// BATCH EVENT CALLBACK
+//
+// Concerns:
+//   a) When a batch event callback is configured, events are delivered in
+//      order, in batches of at most the configured size.
+//   b) A batch is delivered as soon as it is full, or the queue is found
+//      empty, in which case the callback is notified with no events.
+//
+// Plan:
+//   1) Create a MQTP with a single queue and a maximum batch size of 4.
+//   2) Enqueue an event blocking the callback, and wait for the callback to
+//      be blocked.
+//   3) Enqueue 10 events, unblock the callback and stop the MQTP.
+//   4) Verify the order of the processed events, and the size of each
+//      delivered batch.
+//
+// Testing:
+//   MultiQueueThreadPoolConfig::setBatchEventCallback
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // Ignore default allocator check for now, for the same reason as in the
+    // breathing test.
+
+    bmqtst::TestHelper::printTestName("BATCH EVENT CALLBACK");
+
+    bslma::Allocator* allocator = bmqtst::TestHelperUtil::allocator();
+
+    // CONSTANTS
+    const int k_MAX_BATCH_SIZE   = 4;
+    const int k_NUM_EVENTS       = 10;
+    const int k_FIXED_QUEUE_SIZE = 100;
+
+    BatchTestContext context(allocator);
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        1,                                // minThreads
+        1,                                // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        allocator);
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    // 1. Create the MQTP
+    MQTP::Config config(
+        1,  // numQueues
+        &threadPool,
+        bdlf::BindUtil::bindS(
+            allocator,
+            &performanceTestEventCbCreator,
+            bdlf::PlaceHolders::_1,  // queueId
+            bdlf::PlaceHolders::_2,  // lastProcessingStartTime
+            allocator),
+        bdlf::BindUtil::bindS(allocator,
+                              &performanceTestQueueCreator,
+                              bdlf::PlaceHolders::_1,  // queueId
+                              bdlf::PlaceHolders::_2,  // allocator
+                              k_FIXED_QUEUE_SIZE),
+        allocator);
+    config.setBatchEventCallback(
+        bdlf::BindUtil::bindS(
+            allocator,
+            &batchEventCbCreator,
+            &context,
+            bdlf::PlaceHolders::_1,  // queueId
+            bdlf::PlaceHolders::_2,  // lastProcessingStartTime
+            allocator),
+        k_MAX_BATCH_SIZE);
+
+    MQTP mfqtp(config, allocator);
+    BMQTST_ASSERT_EQ(mfqtp.start(), 0);
+
+    // 2. Block the callback
+    {
+        MQTP::EventSp event;
+        event.createInplace(allocator);
+        event->value() = -1;
+        mfqtp.enqueueEvent(bslmf::MovableRefUtil::move(event), 0);
+    }
+    context.d_blockedSignal.wait();
+
+    // 3. Enqueue events while the callback is blocked
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        MQTP::EventSp event;
+        event.createInplace(allocator);
+        event->value() = i;
+        mfqtp.enqueueEvent(bslmf::MovableRefUtil::move(event), 0);
+    }
+    context.d_unblockSignal.post();
+
+    mfqtp.stop();
+    BMQTST_ASSERT_EQ(mfqtp.isStarted(), false);
+
+    // 4. Verify
+    BMQTST_ASSERT_EQ(context.d_values.size(),
+                     static_cast<size_t>(k_NUM_EVENTS));
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        BMQTST_ASSERT_EQ_D(i, context.d_values[i], i);
+    }
+
+    // The blocking event is delivered alone, the queue being empty at the
+    // time, then the 10 other events are delivered in batches of 4, 4 and 2.
+    BMQTST_ASSERT_EQ(context.d_batchSizes.size(), 4U);
+    BMQTST_ASSERT_EQ(context.d_batchSizes[0], 1);
+    BMQTST_ASSERT_EQ(context.d_batchSizes[1], k_MAX_BATCH_SIZE);
+    BMQTST_ASSERT_EQ(context.d_batchSizes[2], k_MAX_BATCH_SIZE);
+    BMQTST_ASSERT_EQ(context.d_batchSizes[3], 2);
+
+    // The queue was found empty at least after the blocking event, and after
+    // the last batch.
+    BMQTST_ASSERT_GE(context.d_numEmptyNotifications, 2);
+
+    threadPool.stop();
+}
+
 BSLA_MAYBE_UNUSED
 static void testN1_performance()
 // ------------------------------------------------------------------------
@@ -574,6 +835,91 @@ static void testN1_fixedPerformance_GoogleBenchmark(benchmark::State& state)
 }
 #endif  // BMQTST_BENCHMARK_ENABLED
 
+BSLA_MAYBE_UNUSED
+static void testN2_batchPerformance()
+// ------------------------------------------------------------------------
+// BATCH PERFORMANCE TEST
+//
+// Concerns:
+//  a) Check the throughput of the MQTP depending on the maximum number of
+//     events delivered per batch.
+//
+// Plan:
+//  1) For each batch size, create a MQTP with a single queue and enqueue
+//     events as quickly as possible on it, then report the number of
+//     events processed per second.  A batch size of 0 means that events are
+//     delivered one at a time (no batch event callback).
+//
+// Testing:
+//  Performance
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    bmqtst::TestHelper::printTestName("BATCH PERFORMANCE TEST");
+
+    // CONSTANTS
+    const int k_NUM_ITERATIONS = 5 * 1000 * 1000;  // 5 M
+    const int k_BATCH_SIZES[]  = {0, 1, 4, 16, 64, 256};
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        2,                                // minThreads
+        2,                                // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        bmqtst::TestHelperUtil::allocator());
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    for (size_t i = 0; i < sizeof(k_BATCH_SIZES) / sizeof(*k_BATCH_SIZES);
+         ++i) {
+        const int batchSize = k_BATCH_SIZES[i];
+        PRINT("Batch size: " << batchSize);
+
+        printProcessedItems(
+            k_NUM_ITERATIONS,
+            batchPerformanceRun(&threadPool, batchSize, k_NUM_ITERATIONS));
+    }
+
+    threadPool.stop();
+}
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void testN2_batchPerformance_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BATCH PERFORMANCE TEST
+//
+// Concerns:
+//  a) Check the throughput of the MQTP depending on the maximum number of
+//     events delivered per batch, provided as the benchmark argument (0
+//     meaning that events are delivered one at a time).
+//
+// Testing:
+//  Performance
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    // CONSTANTS
+    const int k_NUM_ITERATIONS = 1000 * 1000;  // 1 M
+
+    bdlmt::ThreadPool threadPool(
+        bslmt::ThreadAttributes(),        // default
+        2,                                // minThreads
+        2,                                // maxThreads
+        bsl::numeric_limits<int>::max(),  // maxIdleTime
+        bmqtst::TestHelperUtil::allocator());
+    BSLS_ASSERT_OPT(threadPool.start() == 0);
+
+    const int batchSize = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        batchPerformanceRun(&threadPool, batchSize, k_NUM_ITERATIONS);
+    }
+    state.SetItemsProcessed(state.iterations() * k_NUM_ITERATIONS);
+
+    threadPool.stop();
+}
+#endif  // BMQTST_BENCHMARK_ENABLED
+
 //=============================================================================
 //                                MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -584,6 +930,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 2: test2_batchEventCallback(); break;
     case 1: test1_breathingTest(); break;
     case -1:
 #ifdef BMQTST_BENCHMARK_ENABLED
@@ -595,6 +942,22 @@ int main(int argc, char* argv[])
         benchmark::RunSpecifiedBenchmarks();
 #else
         testN1_performance();
+#endif
+        break;
+    case -2:
+#ifdef BMQTST_BENCHMARK_ENABLED
+        BENCHMARK(testN2_batchPerformance_GoogleBenchmark)
+            ->Arg(0)
+            ->Arg(1)
+            ->Arg(4)
+            ->Arg(16)
+            ->Arg(64)
+            ->Arg(256)
+            ->Unit(benchmark::kMillisecond);
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+#else
+        testN2_batchPerformance();
 #endif
         break;
     default: {
@@ -566,6 +566,10 @@ class OrderedHashMap {
     /// sequential list.
     void pushFront(Link* link);
 
+    /// Rehash the hash table into at least the specified `numBuckets`
+    /// buckets.  Note that the iterators are not invalidated by rehashing.
+    void rehash(size_t numBuckets);
+
     /// Rehash the hash table if its load factor is greater than 1.0, and
     /// return true.  Return false otherwise.  Note that the iterators are
     /// not invalidated by rehashing.
@@ -675,6 +679,12 @@ class OrderedHashMap {
     /// entry exists, and the past-the-end iterator (`end`) otherwise.
     iterator find(const key_type& key);
 
+    /// Make this container able to hold at least the specified
+    /// `numElements` without rehashing, rehashing it at most once now if
+    /// needed, and reserve the memory of the corresponding nodes.  Note
+    /// that the iterators are not invalidated by this method.
+    void reserve(size_t numElements);
+
     /// Insert the specified `value` into this container if the key (the
     /// `first` element) of a `value_type` object constructed from `value`
     /// does not already exist in this container; otherwise, this method
@@ -1194,54 +1204,59 @@ inline void OrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::pushFront(Link* link)
 }
 
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
-bool OrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::rehashIfNeeded()
+void OrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::rehash(size_t numBuckets)
 {
-    if (1.0 < (static_cast<double>(d_numElements) /
-               static_cast<double>(d_bucketArraySize))) {
-        // Calculate next size for d_bucketArraySize.
+    // Calculate next size for d_bucketArraySize.
 
-        size_t oldBucketArraySize = d_bucketArraySize;
-        d_bucketArraySize         = ImpDetails::nextPrime(d_numElements);
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_bucketArraySize)) {
-            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-            throw bsl::runtime_error("HashTable ran out of prime numbers");
-        }
+    size_t oldBucketArraySize = d_bucketArraySize;
+    d_bucketArraySize         = ImpDetails::nextPrime(numBuckets);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_bucketArraySize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        throw bsl::runtime_error("HashTable ran out of prime numbers");
+    }
 
-        // Reserve in nodepool.
+    // Reserve in nodepool.
 
-        if (d_bucketArraySize > d_numElements) {
-            d_nodePool.reserveCapacity(
-                static_cast<int>(d_bucketArraySize - d_numElements));
-        }
+    if (d_bucketArraySize > d_numElements) {
+        d_nodePool.reserveCapacity(
+            static_cast<int>(d_bucketArraySize - d_numElements));
+    }
 
-        // Destroy & deallocate old bucket array.
+    // Destroy & deallocate old bucket array.
 
-        for (size_t i = 0; i < oldBucketArraySize; ++i) {
-            Bucket* bucket = static_cast<Bucket*>(d_bucketArray_p + i);
-            bucket->~Bucket();
-        }
-        d_allocator_p->deallocate(d_bucketArray_p);
+    for (size_t i = 0; i < oldBucketArraySize; ++i) {
+        Bucket* bucket = static_cast<Bucket*>(d_bucketArray_p + i);
+        bucket->~Bucket();
+    }
+    d_allocator_p->deallocate(d_bucketArray_p);
 
-        // Allocate new bucket array of new size.
+    // Allocate new bucket array of new size.
 
-        d_bucketArray_p = static_cast<Bucket*>(
-            d_allocator_p->allocate(sizeof(Bucket) * d_bucketArraySize));
-        bsl::fill_n(d_bucketArray_p, d_bucketArraySize, Bucket());
+    d_bucketArray_p = static_cast<Bucket*>(
+        d_allocator_p->allocate(sizeof(Bucket) * d_bucketArraySize));
+    bsl::fill_n(d_bucketArray_p, d_bucketArraySize, Bucket());
 
-        // For each key in list, rehash & insert in new bucketArray.
+    // For each key in list, rehash & insert in new bucketArray.
 
-        size_t numRehashed = 0;
-        for (Link* link = d_sentinel_p->nextInList(); link != d_sentinel_p;
-             link       = link->nextInList()) {
-            Node*   node   = static_cast<Node*>(link);
-            Bucket* bucket = getBucketForKey(get_key(node->value()));
-            appendNodeToBucket(link, bucket);
-            ++numRehashed;
-        }
+    size_t numRehashed = 0;
+    for (Link* link = d_sentinel_p->nextInList(); link != d_sentinel_p;
+         link       = link->nextInList()) {
+        Node*   node   = static_cast<Node*>(link);
+        Bucket* bucket = getBucketForKey(get_key(node->value()));
+        appendNodeToBucket(link, bucket);
+        ++numRehashed;
+    }
 
-        BSLS_ASSERT_SAFE(numRehashed == d_numElements);
-        static_cast<void>(numRehashed);  // suppress compiler warning
+    BSLS_ASSERT_SAFE(numRehashed == d_numElements);
+    static_cast<void>(numRehashed);  // suppress compiler warning
+}
 
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline bool OrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::rehashIfNeeded()
+{
+    if (1.0 < (static_cast<double>(d_numElements) /
+               static_cast<double>(d_bucketArraySize))) {
+        rehash(d_numElements);
         return true;  // RETURN
     }
 
@@ -1479,6 +1494,15 @@ OrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::find(const key_type& key)
     return iterator(d_sentinel_p);
 }
 
+template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
+inline void
+OrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::reserve(size_t numElements)
+{
+    if (numElements > d_bucketArraySize) {
+        rehash(numElements);
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class VALUE_TYPE>
 inline bsl::pair<
     typename OrderedHashMap<KEY, VALUE, HASH, VALUE_TYPE>::iterator,
@@ -949,6 +949,64 @@ static void test15_eraseRange()
     BMQTST_ASSERT_EQ(true, map.empty());
 }
 
+static void test16_reserve()
+// ------------------------------------------------------------------------
+// RESERVE
+//
+// Concerns:
+//   Check that reserving does not rehash the container when inserting up to
+//   the reserved number of elements, and preserves the existing elements
+//   and their order.
+//
+// Plan:
+//   Insert elements
+//   Reserve for more elements and verify the existing ones
+//   Insert up to the reserved number and verify the bucket count is
+//   unchanged
+//   Reserve for fewer elements and verify the bucket count is unchanged
+//
+// Testing:
+//   reserve(size_t numElements)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("RESERVE");
+
+    typedef bmqc::OrderedHashMap<size_t, size_t> MyMapType;
+    typedef MyMapType::const_iterator            ConstIterType;
+
+    const size_t k_NUM_INITIAL  = 10;
+    const size_t k_NUM_ELEMENTS = 10000;
+    MyMapType    map(bmqtst::TestHelperUtil::allocator());
+
+    for (size_t i = 0; i < k_NUM_INITIAL; ++i) {
+        map.insert(bsl::make_pair(i, i));
+    }
+
+    map.reserve(k_NUM_ELEMENTS);
+    const size_t numBuckets = map.bucket_count();
+    BMQTST_ASSERT_GE(numBuckets, k_NUM_ELEMENTS);
+    BMQTST_ASSERT_EQ(k_NUM_INITIAL, map.size());
+
+    size_t i = 0;
+    for (ConstIterType cit = map.begin(); cit != map.end(); ++cit, ++i) {
+        BMQTST_ASSERT_EQ_D(i, i, cit->first);
+        BMQTST_ASSERT_EQ_D(i, true, map.find(i) == cit);
+    }
+    BMQTST_ASSERT_EQ(k_NUM_INITIAL, i);
+
+    for (i = k_NUM_INITIAL; i < k_NUM_ELEMENTS; ++i) {
+        map.insert(bsl::make_pair(i, i));
+    }
+    BMQTST_ASSERT_EQ(k_NUM_ELEMENTS, map.size());
+    BMQTST_ASSERT_EQ(numBuckets, map.bucket_count());
+
+    map.reserve(k_NUM_INITIAL);
+    BMQTST_ASSERT_EQ(numBuckets, map.bucket_count());
+    for (i = 0; i < k_NUM_ELEMENTS; ++i) {
+        BMQTST_ASSERT_EQ_D(i, true, map.find(i) != map.end());
+    }
+}
+
 static void testN1_insertPerformance()
 // ------------------------------------------------------------------------
 // INSERT PERFORMANCE
@@ -1172,6 +1230,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 16: test16_reserve(); break;
     case 15: test15_eraseRange(); break;
     case 14: test14_localIterator(); break;
     case 13: test13_previousEndIterator(); break;
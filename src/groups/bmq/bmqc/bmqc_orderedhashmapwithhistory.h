@@ -688,6 +688,9 @@ OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::insert(
         if (!it->d_isLive) {
             // This is previously erase key that still exists in history.
             // Erase and reinsert.
+            if (d_gcIt == it) {
+                d_gcIt++;
+            }
             d_impl.erase(it);
             --d_historySize;
 
@@ -711,11 +714,14 @@ OrderedHashMapWithHistory<KEY, VALUE, HASH, VALUE_TYPE>::gc(TimeType now,
     // Try to advance to either a young item, or to the end of the batch, or to
     // the end of collection.
 
-    d_lastGCTime = now;
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_gcIt == endGc())) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        d_gcIt = beginGc();
-    }
+    // Note that 'd_gcIt' never goes back to 'beginGc()': all the elements
+    // before it have already been visited, and are either live (and marked
+    // for removal) or gone.  When it is 'endGc()', it refers to the first
+    // element inserted afterwards, if any, because the new element takes the
+    // place of the sentinel.  Restarting from 'beginGc()' would instead walk
+    // again over every visited live element before reaching the history.
+
+    d_lastGCTime                    = now;
     const size_t initialHistorySize = d_historySize;
 
     while (d_gcIt != endGc() && d_historySize) {
@@ -368,6 +368,57 @@ static void test7_gcThenInsert()
     setup(obj, 1, timeout);
 }
 
+static void test8_gcResumesAfterEnd()
+{
+    // ------------------------------------------------------------------------
+    // HISTORY
+    //
+    // Concerns:
+    //   Once 'gc' has visited every element, it resumes from the elements
+    //   inserted afterwards instead of walking again over the visited ones.
+    //
+    // Plan:
+    //   Insert 'N' items and erase the last one.
+    //   'gc' past the timeout: all items are visited.
+    //   'gc' again with nothing to collect.
+    //   Insert and erase one more item.
+    //   'gc' with a batch smaller than 'N': the new item should be collected.
+    //
+    // Testing:
+    //   insert, erase, gc
+    // ------------------------------------------------------------------------
+
+    bmqtst::TestHelper::printTestName("GC_RESUMES_AFTER_END");
+
+    int             timeout = 1;
+    ObjectUnderTest obj(timeout, bmqtst::TestHelperUtil::allocator());
+    const size_t    TOTAL      = 100;
+    const int       BATCH_SIZE = 10;
+
+    setup(obj, TOTAL, timeout);
+
+    obj.erase(obj.find(TOTAL - 1));
+    BMQTST_ASSERT_EQ(1U, obj.historySize());
+
+    bsls::Types::Int64 now = (TOTAL + 2) * timeout;
+    BMQTST_ASSERT_EQ(1, obj.gc(now));
+    BMQTST_ASSERT_EQ(0U, obj.historySize());
+
+    // Nothing to collect
+    BMQTST_ASSERT_EQ(0, obj.gc(now));
+
+    BMQTST_ASSERT_EQ(true,
+                     obj.insert(bsl::make_pair(TOTAL, TOTAL + 1), now).second);
+    obj.erase(obj.find(TOTAL));
+    BMQTST_ASSERT_EQ(1U, obj.historySize());
+
+    // The 'TOTAL - 1' live items, already visited, should not be visited again
+    now += 2 * timeout;
+    BMQTST_ASSERT_EQ(1, obj.gc(now, BATCH_SIZE));
+    BMQTST_ASSERT_EQ(0U, obj.historySize());
+    BMQTST_ASSERT_EQ(TOTAL - 1, obj.size());
+}
+
 static void testN1_insertPerformance()
 // ------------------------------------------------------------------------
 // INSERT PERFORMANCE
@@ -587,6 +638,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 8: test8_gcResumesAfterEnd(); break;
     case 7: test7_gcThenInsert(); break;
     case 6: test6_eraseThenGc(); break;
     case 5: test5_insertAfterEnd(); break;
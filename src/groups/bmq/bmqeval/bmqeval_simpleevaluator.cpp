@@ -19,12 +19,338 @@
 #include <bmqeval_simpleevaluatorscanner.h>
 
 // BDE
+#include <bdlma_sequentialallocator.h>
+#include <bsl_algorithm.h>
 #include <bsl_utility.h>
 #include <bsla_annotations.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
 
 namespace BloombergLP {
 namespace bmqeval {
 
+namespace {
+
+// CONSTANTS
+
+/// The maximum number of registers used by a program.  Only the right
+/// operand of a binary operator is evaluated into a new register, hence a
+/// program uses at most one register per operator, plus one.
+const int k_MAX_REGISTERS = SimpleEvaluator::k_MAX_OPERATORS + 1;
+
+// FUNCTIONS
+
+/// Load into the specified `result` the integer value of the specified
+/// `value`.  Return `true` on success, and `false` if `value` is not an
+/// integer.
+inline bool toInteger(bsls::Types::Int64* result, const bdld::Datum& value)
+{
+    if (value.isInteger64()) {
+        *result = value.theInteger64();
+        return true;  // RETURN
+    }
+
+    if (value.isInteger()) {
+        *result = value.theInteger();
+        return true;  // RETURN
+    }
+
+    return false;
+}
+
+/// Compare the specified `left` and `right` values using `Op`, and load the
+/// boolean result into `left`.  Return `true` on success, and `false` if the
+/// values are neither both strings nor both integers.
+template <template <typename> class Op>
+inline bool compare(bdld::Datum* left, const bdld::Datum& right)
+{
+    if (left->isString()) {
+        if (!right.isString()) {
+            return false;  // RETURN
+        }
+
+        *left = bdld::Datum::createBoolean(
+            Op<bslstl::StringRef>()(left->theString(), right.theString()));
+        return true;  // RETURN
+    }
+
+    bsls::Types::Int64 a;
+    bsls::Types::Int64 b;
+
+    if (!toInteger(&a, *left) || !toInteger(&b, right)) {
+        return false;  // RETURN
+    }
+
+    *left = bdld::Datum::createBoolean(Op<bsls::Types::Int64>()(a, b));
+    return true;
+}
+
+/// Apply `Op` to the specified `left` and `right` integer values, and load
+/// the result into `left`, using the specified `allocator`.  Return
+/// `ErrorType::e_OK` on success, or the error otherwise.
+template <template <typename> class Op>
+inline ErrorType::Enum calculate(bdld::Datum*       left,
+                                 const bdld::Datum& right,
+                                 bslma::Allocator*  allocator)
+{
+    bsls::Types::Int64 a;
+    bsls::Types::Int64 b;
+
+    if (!toInteger(&a, *left) || !toInteger(&b, right)) {
+        return ErrorType::e_TYPE;  // RETURN
+    }
+
+    if ((bsl::is_same<Op<int>, bsl::divides<int> >::value ||
+         bsl::is_same<Op<int>, bsl::modulus<int> >::value) &&
+        (b == 0 ||
+         (a == bsl::numeric_limits<bsls::Types::Int64>::min() && b == -1))) {
+        return ErrorType::e_ARITHMETIC;  // RETURN
+    }
+
+    *left = bdld::Datum::createInteger64(Op<bsls::Types::Int64>()(a, b),
+                                         allocator);
+    return ErrorType::e_OK;
+}
+
+/// Return the error to report for the specified error `value` returned by a
+/// `PropertiesReader`.
+inline ErrorType::Enum propertyError(const bdld::Datum& value)
+{
+    const int rc = value.theError().code();
+
+    // ErrorType::e_EVALUATION_LAST and ErrorType::e_EVALUATION_FIRST are
+    // negative, hence the flipped conditional.
+    if (ErrorType::e_EVALUATION_LAST <= rc &&
+        rc <= ErrorType::e_EVALUATION_FIRST) {
+        return static_cast<ErrorType::Enum>(rc);  // RETURN
+    }
+
+    return ErrorType::e_UNDEFINED;
+}
+
+// BATCH EVALUATION
+
+/// Type of the value of a cell of a `Column`.
+enum CellType {
+    e_BOOLEAN_CELL,  // boolean, in 'd_integers'
+    e_INTEGER_CELL,  // integer, in 'd_integers'
+    e_STRING_CELL,   // string, in 'd_strings'
+    e_OTHER_CELL,    // value of another type
+    e_ERROR_CELL     // property error, as an 'ErrorType', in 'd_integers'
+};
+
+/// Values of a register, or of a property, for each message of a batch.
+/// The values of the message at index `i` are at index `i` of each array.
+struct Column {
+    // DATA
+    bsls::Types::Int64* d_integers;
+    bslstl::StringRef*  d_strings;
+    unsigned char*      d_types;
+};
+
+/// State of the messages of a batch.
+struct Rows {
+    // DATA
+
+    /// The number of messages.
+    int d_numRows;
+
+    /// Non-zero for the messages the current instruction applies to, i.e.,
+    /// those which are neither suspended by a jump nor failed.
+    unsigned char* d_active;
+
+    /// The error of each message.
+    ErrorType::Enum* d_errors;
+
+    /// The index of the instruction each suspended message resumes at, or
+    /// -1 if the message is not suspended.
+    int* d_resume;
+};
+
+/// Stop the evaluation of the message at the specified `row` of the
+/// specified `rows` with the specified `error`.
+inline void fail(Rows* rows, int row, ErrorType::Enum error)
+{
+    rows->d_active[row] = 0;
+    rows->d_errors[row] = error;
+}
+
+/// Return the number of active messages of the specified `rows` for which
+/// the values of the specified `left` and `right` columns are not both
+/// integers.
+inline int
+countNonIntegers(const Column& left, const Column& right, const Rows& rows)
+{
+    const unsigned char* active = rows.d_active;
+    const unsigned char* a      = left.d_types;
+    const unsigned char* b      = right.d_types;
+
+    int count = 0;
+    for (int i = 0; i < rows.d_numRows; ++i) {
+        count += active[i] &
+                 !((a[i] == e_INTEGER_CELL) & (b[i] == e_INTEGER_CELL));
+    }
+
+    return count;
+}
+
+/// Compare the values of the specified `left` and `right` columns using
+/// `Op` for the active messages of the specified `rows`, and load the
+/// boolean results into `left`.  Fail the messages whose values are
+/// neither both strings nor both integers.
+template <template <typename> class Op>
+void compareColumns(Column* left, const Column& right, Rows* rows)
+{
+    const int      numRows = rows->d_numRows;
+    unsigned char* active  = rows->d_active;
+
+    if (countNonIntegers(*left, right, *rows) != 0) {
+        for (int i = 0; i < numRows; ++i) {
+            if (!active[i] || (left->d_types[i] == e_INTEGER_CELL &&
+                               right.d_types[i] == e_INTEGER_CELL)) {
+                continue;  // CONTINUE
+            }
+
+            if (left->d_types[i] == e_STRING_CELL &&
+                right.d_types[i] == e_STRING_CELL) {
+                left->d_integers[i] = Op<bslstl::StringRef>()(
+                    left->d_strings[i],
+                    right.d_strings[i]);
+                left->d_types[i]    = e_BOOLEAN_CELL;
+            }
+            else {
+                fail(rows, i, ErrorType::e_TYPE);
+            }
+        }
+    }
+
+    // Compare the integers without branches, so that the loop can be
+    // vectorized.
+    bsls::Types::Int64*       a  = left->d_integers;
+    const bsls::Types::Int64* b  = right.d_integers;
+    unsigned char*            ta = left->d_types;
+    const unsigned char*      tb = right.d_types;
+
+    for (int i = 0; i < numRows; ++i) {
+        const bool isSelected = active[i] & (ta[i] == e_INTEGER_CELL) &
+                                (tb[i] == e_INTEGER_CELL);
+        const bsls::Types::Int64 result = Op<bsls::Types::Int64>()(a[i],
+                                                                   b[i]);
+
+        a[i]  = isSelected ? result : a[i];
+        ta[i] = isSelected ? static_cast<unsigned char>(e_BOOLEAN_CELL)
+                           : ta[i];
+    }
+}
+
+/// Apply `Op` to the integer values of the specified `left` and `right`
+/// columns for the active messages of the specified `rows`, and load the
+/// results into `left`.  Fail the messages whose values are not both
+/// integers.  The behavior is undefined unless `Op` is one of `plus`,
+/// `minus`, and `multiplies`.
+template <template <typename> class Op>
+void calculateColumns(Column* left, const Column& right, Rows* rows)
+{
+    const int      numRows = rows->d_numRows;
+    unsigned char* active  = rows->d_active;
+
+    if (countNonIntegers(*left, right, *rows) != 0) {
+        for (int i = 0; i < numRows; ++i) {
+            if (active[i] && !(left->d_types[i] == e_INTEGER_CELL &&
+                               right.d_types[i] == e_INTEGER_CELL)) {
+                fail(rows, i, ErrorType::e_TYPE);
+            }
+        }
+    }
+
+    // Calculate on unsigned integers, so that the (ignored) results of the
+    // unselected messages do not overflow.
+    bsls::Types::Int64*       a = left->d_integers;
+    const bsls::Types::Int64* b = right.d_integers;
+
+    for (int i = 0; i < numRows; ++i) {
+        const bsls::Types::Int64 result = static_cast<bsls::Types::Int64>(
+            Op<bsls::Types::Uint64>()(static_cast<bsls::Types::Uint64>(a[i]),
+                                      static_cast<bsls::Types::Uint64>(b[i])));
+
+        a[i] = active[i] ? result : a[i];
+    }
+}
+
+/// Apply `Op` to the integer values of the specified `left` and `right`
+/// columns for the active messages of the specified `rows`, and load the
+/// results into `left`.  Fail the messages whose values are not both
+/// integers, or for which the operation is undefined.  The behavior is
+/// undefined unless `Op` is one of `divides` and `modulus`.
+template <template <typename> class Op>
+void divideColumns(Column* left, const Column& right, Rows* rows)
+{
+    for (int i = 0; i < rows->d_numRows; ++i) {
+        if (!rows->d_active[i]) {
+            continue;  // CONTINUE
+        }
+
+        if (left->d_types[i] != e_INTEGER_CELL ||
+            right.d_types[i] != e_INTEGER_CELL) {
+            fail(rows, i, ErrorType::e_TYPE);
+            continue;  // CONTINUE
+        }
+
+        const bsls::Types::Int64 a = left->d_integers[i];
+        const bsls::Types::Int64 b = right.d_integers[i];
+
+        if (b == 0 ||
+            (a == bsl::numeric_limits<bsls::Types::Int64>::min() && b == -1)) {
+            fail(rows, i, ErrorType::e_ARITHMETIC);
+            continue;  // CONTINUE
+        }
+
+        left->d_integers[i] = Op<bsls::Types::Int64>()(a, b);
+    }
+}
+
+/// Load into the specified `column` the values of the property with the
+/// specified `name` for the messages of the specified `rows` which have not
+/// failed, read from the specified `reader` using the specified
+/// `allocator`.
+void readColumn(Column*                column,
+                BatchPropertiesReader* reader,
+                const bsl::string&     name,
+                const Rows&            rows,
+                bslma::Allocator*      allocator)
+{
+    for (int i = 0; i < rows.d_numRows; ++i) {
+        if (rows.d_errors[i] != ErrorType::e_OK) {
+            column->d_types[i] = e_OTHER_CELL;
+            continue;  // CONTINUE
+        }
+
+        const bdld::Datum value = reader->get(i, name, allocator);
+
+        if (value.isError()) {
+            column->d_types[i]    = e_ERROR_CELL;
+            column->d_integers[i] = propertyError(value);
+        }
+        else if (value.isBoolean()) {
+            column->d_types[i]    = e_BOOLEAN_CELL;
+            column->d_integers[i] = value.theBoolean();
+        }
+        else if (toInteger(&column->d_integers[i], value)) {
+            column->d_types[i] = e_INTEGER_CELL;
+        }
+        else if (value.isString()) {
+            column->d_types[i]   = e_STRING_CELL;
+            column->d_strings[i] = value.theString();
+        }
+        else {
+            column->d_types[i] = e_OTHER_CELL;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
 // ----------------------
 // class PropertiesReader
 // ----------------------
@@ -35,6 +361,16 @@ PropertiesReader::~PropertiesReader()
     // NOTHING
 }
 
+// ---------------------------
+// class BatchPropertiesReader
+// ---------------------------
+
+// CREATORS
+BatchPropertiesReader::~BatchPropertiesReader()
+{
+    // NOTHING
+}
+
 // ---------------------
 // class SimpleEvaluator
 // ---------------------
@@ -59,9 +395,15 @@ int SimpleEvaluator::compile(const bsl::string&  expression,
 
     if (context.hasError()) {
         d_expression.reset();
+        d_program.reset();
     }
     else {
         d_expression = context.d_expression;
+
+        d_program.reset(new (*context.d_allocator)
+                            Program(context.d_allocator),
+                        context.d_allocator);
+        d_expression->emit(d_program.get(), 0);
     }
     d_isCompiled = true;
 
@@ -126,6 +468,39 @@ void SimpleEvaluator::parse(const bsl::string&  expression,
 }
 
 bool SimpleEvaluator::evaluate(EvaluationContext& context) const
+{
+    BSLS_ASSERT_SAFE(d_program.get());
+    BSLS_ASSERT_SAFE(context.d_propertiesReader);
+
+    context.reset();
+
+    return d_program->run(context);
+}
+
+void SimpleEvaluator::evaluateBatch(
+    bsl::vector<char>*            results,
+    BatchPropertiesReader*        reader,
+    int                           numMessages,
+    bsl::vector<ErrorType::Enum>* errors,
+    bslma::Allocator*             allocator) const
+{
+    BSLS_ASSERT_SAFE(d_program.get());
+    BSLS_ASSERT_SAFE(results);
+    BSLS_ASSERT_SAFE(reader);
+    BSLS_ASSERT_SAFE(0 <= numMessages);
+
+    bslma::Allocator* alloc = bslma::Default::allocator(allocator);
+
+    bsl::vector<ErrorType::Enum> localErrors(alloc);
+
+    d_program->runBatch(results,
+                        errors ? errors : &localErrors,
+                        reader,
+                        numMessages,
+                        alloc);
+}
+
+bool SimpleEvaluator::evaluateSyntaxTree(EvaluationContext& context) const
 {
     BSLS_ASSERT_SAFE(d_expression.get());
     BSLS_ASSERT_SAFE(context.d_propertiesReader);
@@ -146,6 +521,497 @@ bool SimpleEvaluator::evaluate(EvaluationContext& context) const
     return value.theBoolean();
 }
 
+// ------------------------------
+// class SimpleEvaluator::Program
+// ------------------------------
+
+SimpleEvaluator::Program::Program(bslma::Allocator* allocator)
+: d_instructions(allocator)
+, d_properties(allocator)
+, d_strings(allocator)
+, d_integers(allocator)
+{
+    // NOTHING
+}
+
+int SimpleEvaluator::Program::emit(Opcode opcode, int target, int operand)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(0 <= target && target < k_MAX_REGISTERS);
+    BSLS_ASSERT(0 <= operand && operand <= 0xFFFF);
+
+    Instruction instruction;
+    instruction.d_opcode   = static_cast<unsigned char>(opcode);
+    instruction.d_register = static_cast<unsigned char>(target);
+    instruction.d_operand  = static_cast<unsigned short>(operand);
+
+    d_instructions.push_back(instruction);
+
+    return numInstructions() - 1;
+}
+
+void SimpleEvaluator::Program::setJumpTarget(int index)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= index && index < numInstructions());
+
+    d_instructions[index].d_operand = static_cast<unsigned short>(
+        numInstructions());
+}
+
+int SimpleEvaluator::Program::addProperty(const bsl::string& name)
+{
+    for (bsl::size_t i = 0; i < d_properties.size(); ++i) {
+        if (d_properties[i] == name) {
+            return static_cast<int>(i);  // RETURN
+        }
+    }
+
+    BSLS_ASSERT(d_properties.size() <
+                static_cast<bsl::size_t>(k_MAX_PROPERTIES));
+
+    d_properties.push_back(name);
+
+    return static_cast<int>(d_properties.size()) - 1;
+}
+
+int SimpleEvaluator::Program::addString(const bsl::string& value)
+{
+    d_strings.push_back(value);
+
+    return static_cast<int>(d_strings.size()) - 1;
+}
+
+int SimpleEvaluator::Program::addInteger(bsls::Types::Int64 value)
+{
+    d_integers.push_back(value);
+
+    return static_cast<int>(d_integers.size()) - 1;
+}
+
+bool SimpleEvaluator::Program::run(EvaluationContext& context) const
+{
+    PropertiesReader* reader    = context.d_propertiesReader;
+    bslma::Allocator* allocator = context.d_allocator;
+
+    bdld::Datum registers[k_MAX_REGISTERS];
+
+    // Each property is read at most once, on first use.
+    bdld::Datum properties[k_MAX_PROPERTIES];
+    unsigned    readProperties = 0;
+
+    const Instruction* instructions    = d_instructions.data();
+    const int          numInstructions = this->numInstructions();
+
+    ErrorType::Enum error = ErrorType::e_OK;
+
+    for (int pc = 0; pc < numInstructions;) {
+        const Instruction& instruction = instructions[pc++];
+        bdld::Datum*       value       = &registers[instruction.d_register];
+
+        switch (instruction.d_opcode) {
+        case e_PROPERTY:
+        case e_EXISTS: {
+            const unsigned index = instruction.d_operand;
+
+            if (!(readProperties & (1u << index))) {
+                properties[index] = reader->get(d_properties[index],
+                                                allocator);
+                readProperties |= 1u << index;
+            }
+
+            if (instruction.d_opcode == e_EXISTS) {
+                *value = bdld::Datum::createBoolean(
+                    !properties[index].isError());
+            }
+            else if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                         properties[index].isError())) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+                error = propertyError(properties[index]);
+            }
+            else {
+                *value = properties[index];
+            }
+        } break;
+        case e_INTEGER: {
+            *value = bdld::Datum::createInteger64(
+                d_integers[instruction.d_operand],
+                allocator);
+        } break;
+        case e_STRING: {
+            const bsl::string& constant = d_strings[instruction.d_operand];
+            *value = bdld::Datum::createStringRef(constant.data(),
+                                                  constant.length(),
+                                                  allocator);
+        } break;
+        case e_BOOLEAN: {
+            *value = bdld::Datum::createBoolean(instruction.d_operand != 0);
+        } break;
+        case e_NOT: {
+            if (value->isBoolean()) {
+                *value = bdld::Datum::createBoolean(!value->theBoolean());
+            }
+            else {
+                error = ErrorType::e_TYPE;
+            }
+        } break;
+        case e_NEGATE: {
+            bsls::Types::Int64 integer;
+            if (toInteger(&integer, *value)) {
+                *value = bdld::Datum::createInteger64(-integer, allocator);
+            }
+            else {
+                error = ErrorType::e_TYPE;
+            }
+        } break;
+        case e_EQ: {
+            if (!compare<bsl::equal_to>(value, value[1])) {
+                error = ErrorType::e_TYPE;
+            }
+        } break;
+        case e_NE: {
+            if (!compare<bsl::not_equal_to>(value, value[1])) {
+                error = ErrorType::e_TYPE;
+            }
+        } break;
+        case e_LT: {
+            if (!compare<bsl::less>(value, value[1])) {
+                error = ErrorType::e_TYPE;
+            }
+        } break;
+        case e_LE: {
+            if (!compare<bsl::less_equal>(value, value[1])) {
+                error = ErrorType::e_TYPE;
+            }
+        } break;
+        case e_GT: {
+            if (!compare<bsl::greater>(value, value[1])) {
+                error = ErrorType::e_TYPE;
+            }
+        } break;
+        case e_GE: {
+            if (!compare<bsl::greater_equal>(value, value[1])) {
+                error = ErrorType::e_TYPE;
+            }
+        } break;
+        case e_ADD: {
+            error = calculate<bsl::plus>(value, value[1], allocator);
+        } break;
+        case e_SUBTRACT: {
+            error = calculate<bsl::minus>(value, value[1], allocator);
+        } break;
+        case e_MULTIPLY: {
+            error = calculate<bsl::multiplies>(value, value[1], allocator);
+        } break;
+        case e_DIVIDE: {
+            error = calculate<bsl::divides>(value, value[1], allocator);
+        } break;
+        case e_MODULUS: {
+            error = calculate<bsl::modulus>(value, value[1], allocator);
+        } break;
+        case e_JUMP_IF_FALSE: {
+            if (!value->isBoolean()) {
+                error = ErrorType::e_TYPE;
+            }
+            else if (!value->theBoolean()) {
+                pc = instruction.d_operand;
+            }
+        } break;
+        case e_JUMP_IF_TRUE: {
+            if (!value->isBoolean()) {
+                error = ErrorType::e_TYPE;
+            }
+            else if (value->theBoolean()) {
+                pc = instruction.d_operand;
+            }
+        } break;
+        case e_CHECK_BOOLEAN: {
+            if (!value->isBoolean()) {
+                error = ErrorType::e_TYPE;
+            }
+        } break;
+        default: {
+            BSLS_ASSERT_OPT(false && "Unknown opcode");
+        } break;
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(error != ErrorType::e_OK)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            context.setError(error);
+            return false;  // RETURN
+        }
+    }
+
+    if (!registers[0].isBoolean()) {
+        context.setError(ErrorType::e_TYPE);
+        return false;  // RETURN
+    }
+
+    return registers[0].theBoolean();
+}
+
+void SimpleEvaluator::Program::runBatch(
+    bsl::vector<char>*            results,
+    bsl::vector<ErrorType::Enum>* errors,
+    BatchPropertiesReader*        reader,
+    int                           numMessages,
+    bslma::Allocator*             allocator) const
+{
+    const int numRows         = numMessages;
+    const int numInstructions = this->numInstructions();
+
+    results->assign(numRows, 0);
+    errors->assign(numRows, ErrorType::e_OK);
+
+    if (numRows == 0) {
+        return;  // RETURN
+    }
+
+    // Binary operations read the register following their target.
+    int numRegisters = 1;
+    for (int pc = 0; pc < numInstructions; ++pc) {
+        numRegisters = bsl::max(numRegisters,
+                                d_instructions[pc].d_register + 2);
+    }
+    numRegisters = bsl::min(numRegisters, k_MAX_REGISTERS);
+
+    const int numProperties = static_cast<int>(d_properties.size());
+    const int numColumns    = numRegisters + numProperties;
+    const bsl::size_t numCells = static_cast<bsl::size_t>(numColumns) *
+                                 numRows;
+
+    // The registers, followed by the properties, in contiguous storage.
+    bsl::vector<bsls::Types::Int64> integers(numCells, 0, allocator);
+    bsl::vector<bslstl::StringRef>  strings(numCells,
+                                           bslstl::StringRef(),
+                                           allocator);
+    bsl::vector<unsigned char>      types(numCells, e_OTHER_CELL, allocator);
+
+    Column columns[k_MAX_REGISTERS + k_MAX_PROPERTIES];
+    for (int i = 0; i < numColumns; ++i) {
+        columns[i].d_integers = integers.data() + i * numRows;
+        columns[i].d_strings  = strings.data() + i * numRows;
+        columns[i].d_types    = types.data() + i * numRows;
+    }
+    Column* registers  = columns;
+    Column* properties = columns + numRegisters;
+
+    bsl::vector<unsigned char> active(numRows, 1, allocator);
+    bsl::vector<int>           resume(numRows, -1, allocator);
+
+    Rows rows;
+    rows.d_numRows = numRows;
+    rows.d_active  = active.data();
+    rows.d_errors  = errors->data();
+    rows.d_resume  = resume.data();
+
+    // The number of messages suspended until each instruction.
+    bsl::vector<int> numSuspended(numInstructions + 1, 0, allocator);
+
+    // Each property is read for the whole batch, on first use.
+    unsigned readProperties = 0;
+
+    bdlma::SequentialAllocator readAllocator(allocator);
+
+    for (int pc = 0; pc <= numInstructions; ++pc) {
+        if (numSuspended[pc] != 0) {
+            // Resume the messages which jumped to this instruction.
+            for (int i = 0; i < numRows; ++i) {
+                if (resume[i] == pc) {
+                    resume[i] = -1;
+                    active[i] = 1;
+                }
+            }
+        }
+
+        if (pc == numInstructions) {
+            break;  // BREAK
+        }
+
+        const Instruction& instruction = d_instructions[pc];
+        Column&            value       = registers[instruction.d_register];
+        const Column&      next        = registers[instruction.d_register + 1];
+
+        switch (instruction.d_opcode) {
+        case e_PROPERTY:
+        case e_EXISTS: {
+            const unsigned index    = instruction.d_operand;
+            const Column&  property = properties[index];
+
+            if (!(readProperties & (1u << index))) {
+                readColumn(&properties[index],
+                           reader,
+                           d_properties[index],
+                           rows,
+                           &readAllocator);
+                readProperties |= 1u << index;
+            }
+
+            for (int i = 0; i < numRows; ++i) {
+                if (!active[i]) {
+                    continue;  // CONTINUE
+                }
+
+                if (instruction.d_opcode == e_EXISTS) {
+                    value.d_types[i]    = e_BOOLEAN_CELL;
+                    value.d_integers[i] = property.d_types[i] !=
+                                          e_ERROR_CELL;
+                }
+                else if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                             property.d_types[i] == e_ERROR_CELL)) {
+                    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+                    fail(&rows,
+                         i,
+                         static_cast<ErrorType::Enum>(
+                             property.d_integers[i]));
+                }
+                else {
+                    value.d_types[i]    = property.d_types[i];
+                    value.d_integers[i] = property.d_integers[i];
+                    value.d_strings[i]  = property.d_strings[i];
+                }
+            }
+        } break;
+        case e_INTEGER: {
+            const bsls::Types::Int64 constant =
+                d_integers[instruction.d_operand];
+
+            for (int i = 0; i < numRows; ++i) {
+                value.d_integers[i] = active[i] ? constant
+                                                : value.d_integers[i];
+                value.d_types[i]    = active[i] ? static_cast<unsigned char>(
+                                                   e_INTEGER_CELL)
+                                                : value.d_types[i];
+            }
+        } break;
+        case e_STRING: {
+            const bslstl::StringRef constant(d_strings[instruction.d_operand]);
+
+            for (int i = 0; i < numRows; ++i) {
+                if (active[i]) {
+                    value.d_types[i]   = e_STRING_CELL;
+                    value.d_strings[i] = constant;
+                }
+            }
+        } break;
+        case e_BOOLEAN: {
+            const bsls::Types::Int64 constant = instruction.d_operand != 0;
+
+            for (int i = 0; i < numRows; ++i) {
+                value.d_integers[i] = active[i] ? constant
+                                                : value.d_integers[i];
+                value.d_types[i]    = active[i] ? static_cast<unsigned char>(
+                                                   e_BOOLEAN_CELL)
+                                                : value.d_types[i];
+            }
+        } break;
+        case e_NOT: {
+            for (int i = 0; i < numRows; ++i) {
+                if (!active[i]) {
+                    continue;  // CONTINUE
+                }
+
+                if (value.d_types[i] == e_BOOLEAN_CELL) {
+                    value.d_integers[i] = !value.d_integers[i];
+                }
+                else {
+                    fail(&rows, i, ErrorType::e_TYPE);
+                }
+            }
+        } break;
+        case e_NEGATE: {
+            for (int i = 0; i < numRows; ++i) {
+                if (!active[i]) {
+                    continue;  // CONTINUE
+                }
+
+                if (value.d_types[i] == e_INTEGER_CELL) {
+                    value.d_integers[i] = static_cast<bsls::Types::Int64>(
+                        -static_cast<bsls::Types::Uint64>(
+                            value.d_integers[i]));
+                }
+                else {
+                    fail(&rows, i, ErrorType::e_TYPE);
+                }
+            }
+        } break;
+        case e_EQ: {
+            compareColumns<bsl::equal_to>(&value, next, &rows);
+        } break;
+        case e_NE: {
+            compareColumns<bsl::not_equal_to>(&value, next, &rows);
+        } break;
+        case e_LT: {
+            compareColumns<bsl::less>(&value, next, &rows);
+        } break;
+        case e_LE: {
+            compareColumns<bsl::less_equal>(&value, next, &rows);
+        } break;
+        case e_GT: {
+            compareColumns<bsl::greater>(&value, next, &rows);
+        } break;
+        case e_GE: {
+            compareColumns<bsl::greater_equal>(&value, next, &rows);
+        } break;
+        case e_ADD: {
+            calculateColumns<bsl::plus>(&value, next, &rows);
+        } break;
+        case e_SUBTRACT: {
+            calculateColumns<bsl::minus>(&value, next, &rows);
+        } break;
+        case e_MULTIPLY: {
+            calculateColumns<bsl::multiplies>(&value, next, &rows);
+        } break;
+        case e_DIVIDE: {
+            divideColumns<bsl::divides>(&value, next, &rows);
+        } break;
+        case e_MODULUS: {
+            divideColumns<bsl::modulus>(&value, next, &rows);
+        } break;
+        case e_JUMP_IF_FALSE:
+        case e_JUMP_IF_TRUE:
+        case e_CHECK_BOOLEAN: {
+            const bsls::Types::Int64 jumpValue =
+                instruction.d_opcode == e_JUMP_IF_TRUE;
+
+            for (int i = 0; i < numRows; ++i) {
+                if (!active[i]) {
+                    continue;  // CONTINUE
+                }
+
+                if (value.d_types[i] != e_BOOLEAN_CELL) {
+                    fail(&rows, i, ErrorType::e_TYPE);
+                }
+                else if (instruction.d_opcode != e_CHECK_BOOLEAN &&
+                         value.d_integers[i] == jumpValue) {
+                    // Suspend the message until the target of the jump.
+                    active[i] = 0;
+                    resume[i] = instruction.d_operand;
+                    ++numSuspended[instruction.d_operand];
+                }
+            }
+        } break;
+        default: {
+            BSLS_ASSERT_OPT(false && "Unknown opcode");
+        } break;
+        }
+    }
+
+    const Column& result = registers[0];
+    for (int i = 0; i < numRows; ++i) {
+        if ((*errors)[i] != ErrorType::e_OK) {
+            continue;  // CONTINUE
+        }
+
+        if (result.d_types[i] != e_BOOLEAN_CELL) {
+            (*errors)[i] = ErrorType::e_TYPE;
+            continue;  // CONTINUE
+        }
+
+        (*results)[i] = static_cast<char>(result.d_integers[i] != 0);
+    }
+}
+
 // ---------------------------------
 // class SimpleEvaluator::Expression
 // ---------------------------------
@@ -155,6 +1021,12 @@ SimpleEvaluator::Expression::~Expression()
     // NOTHING
 }
 
+void SimpleEvaluator::Expression::loadConstraints(
+    BSLA_MAYBE_UNUSED bsl::vector<PropertyConstraint>* constraints) const
+{
+    // NOTHING
+}
+
 // -------------------------------
 // class SimpleEvaluator::Property
 // -------------------------------
@@ -179,22 +1051,17 @@ SimpleEvaluator::Property::evaluate(EvaluationContext& context) const
                                                         context.d_allocator);
 
     if (value.isError()) {
-        const int rc = value.theError().code();
-
-        // ErrorType::e_EVALUATION_LAST and ErrorType::e_EVALUATION_FIRST are
-        // negative, hence the flipped conditional.
-        if (ErrorType::e_EVALUATION_LAST <= rc &&
-            rc <= ErrorType::e_EVALUATION_FIRST) {
-            context.setError(static_cast<ErrorType::Enum>(rc));
-        }
-        else {
-            context.setError(ErrorType::e_UNDEFINED);
-        }
+        context.setError(propertyError(value));
     }
 
     return value;
 }
 
+void SimpleEvaluator::Property::emit(Program* program, int target) const
+{
+    program->emit(Program::e_PROPERTY, target, program->addProperty(d_name));
+}
+
 // -------------------------------------
 // class SimpleEvaluator::IntegerLiteral
 // -------------------------------------
@@ -208,6 +1075,11 @@ SimpleEvaluator::IntegerLiteral::evaluate(EvaluationContext& context) const
     return bdld::Datum::createInteger64(d_value, context.d_allocator);
 }
 
+void SimpleEvaluator::IntegerLiteral::emit(Program* program, int target) const
+{
+    program->emit(Program::e_INTEGER, target, program->addInteger(d_value));
+}
+
 // -------------------------------------
 // class SimpleEvaluator::BooleanLiteral
 // -------------------------------------
@@ -218,6 +1090,11 @@ bdld::Datum SimpleEvaluator::BooleanLiteral::evaluate(
     return bdld::Datum::createBoolean(d_value);
 }
 
+void SimpleEvaluator::BooleanLiteral::emit(Program* program, int target) const
+{
+    program->emit(Program::e_BOOLEAN, target, d_value);
+}
+
 // ---------------------------------
 // class SimpleEvaluator::UnaryMinus
 // ---------------------------------
@@ -246,6 +1123,12 @@ SimpleEvaluator::UnaryMinus::evaluate(EvaluationContext& context) const
     return bdld::Datum::createInteger64(-value, context.d_allocator);
 }
 
+void SimpleEvaluator::UnaryMinus::emit(Program* program, int target) const
+{
+    d_expression->emit(program, target);
+    program->emit(Program::e_NEGATE, target);
+}
+
 // ------------------------------------
 // class SimpleEvaluator::StringLiteral
 // ------------------------------------
@@ -273,6 +1156,11 @@ SimpleEvaluator::StringLiteral::evaluate(EvaluationContext& context) const
                                         context.d_allocator);
 }
 
+void SimpleEvaluator::StringLiteral::emit(Program* program, int target) const
+{
+    program->emit(Program::e_STRING, target, program->addString(d_value));
+}
+
 // -------------------------
 // class SimpleEvaluator::Or
 // -------------------------
@@ -306,6 +1194,15 @@ bdld::Datum SimpleEvaluator::Or::evaluate(EvaluationContext& context) const
     return right;
 }
 
+void SimpleEvaluator::Or::emit(Program* program, int target) const
+{
+    d_left->emit(program, target);
+    const int jump = program->emit(Program::e_JUMP_IF_TRUE, target);
+    d_right->emit(program, target);
+    program->emit(Program::e_CHECK_BOOLEAN, target);
+    program->setJumpTarget(jump);
+}
+
 // --------------------------
 // class SimpleEvaluator::And
 // --------------------------
@@ -339,6 +1236,22 @@ bdld::Datum SimpleEvaluator::And::evaluate(EvaluationContext& context) const
     return right;
 }
 
+void SimpleEvaluator::And::emit(Program* program, int target) const
+{
+    d_left->emit(program, target);
+    const int jump = program->emit(Program::e_JUMP_IF_FALSE, target);
+    d_right->emit(program, target);
+    program->emit(Program::e_CHECK_BOOLEAN, target);
+    program->setJumpTarget(jump);
+}
+
+void SimpleEvaluator::And::loadConstraints(
+    bsl::vector<PropertyConstraint>* constraints) const
+{
+    d_left->loadConstraints(constraints);
+    d_right->loadConstraints(constraints);
+}
+
 // --------------------------
 // class SimpleEvaluator::Not
 // --------------------------
@@ -358,6 +1271,12 @@ bdld::Datum SimpleEvaluator::Not::evaluate(EvaluationContext& context) const
     return bdld::Datum::createBoolean(!value.theBoolean());
 }
 
+void SimpleEvaluator::Not::emit(Program* program, int target) const
+{
+    d_expression->emit(program, target);
+    program->emit(Program::e_NOT, target);
+}
+
 // -----------------------------
 // class SimpleEvaluator::Exists
 // -----------------------------
@@ -383,5 +1302,10 @@ bdld::Datum SimpleEvaluator::Exists::evaluate(EvaluationContext& context) const
     return bdld::Datum::createBoolean(!value.isError());
 }
 
+void SimpleEvaluator::Exists::emit(Program* program, int target) const
+{
+    program->emit(Program::e_EXISTS, target, program->addProperty(d_name));
+}
+
 }  // close package namespace
 }  // close enterprise namespace
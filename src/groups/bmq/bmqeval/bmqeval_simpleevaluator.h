@@ -23,15 +23,42 @@
 //  logical expressions.
 //  PropertiesReader: Interface for obtaining property values given their
 //  names.
+//  PropertyConstraint: Comparison of a property with a literal necessary for
+//  an expression to be true.
+//  BatchPropertiesReader: Interface for obtaining property values of a batch
+//  of messages given their names.
 //  CompilationContext: Contains data used during parsing.
 //  EvaluationContext: Contains data used during evaluation.
 //
 //@DESCRIPTION: 'SimpleEvaluator' handles expression evaluation.
 //
+// Compiling an expression builds its syntax tree, folding the operations on
+// literals, and lowers the tree to a compact program of instructions operating
+// on a few registers.  The conditional jumps of the program implement the
+// short-circuit evaluation of '&&' and '||', and the properties are referred
+// to by their index in the expression, so that each of them is read at most
+// once per evaluation.  'evaluate' runs this program, while
+// 'evaluateSyntaxTree' walks the syntax tree instead.
+//
+// 'loadConstraints' reports the comparisons of a property with a literal which
+// are operands of the top-level '&&' of an expression, and must therefore hold
+// for the expression to evaluate to 'true'.  This allows to index many
+// expressions by the values of the properties they compare.
+//
+// 'evaluateBatch' runs the program for a batch of messages at once, e.g., to
+// filter a backlog of messages being redelivered.  The properties are read
+// into one column per property, and each instruction is applied to all the
+// messages of the batch by a loop over contiguous arrays, which the compiler
+// can vectorize for integer operations.  The short-circuit evaluation is
+// preserved by suspending the messages for which a jump is taken until the
+// target of the jump, so that the result (and error) for each message is the
+// same as the one of 'evaluate'.
+//
 /// Thread Safety
 ///-------------
 //: o SimpleEvaluator is thread safe
 //: o PropertiesReader is NOT thread safe
+//: o BatchPropertiesReader is NOT thread safe
 //: o CompilationContext is NOT thread safe
 //: o EvaluationContext is NOT thread safe
 //
@@ -62,11 +89,13 @@
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_issame.h>
 #include <bsls_types.h>
+#include <bslstl_stringref.h>
 
 #include <bmqu_memoutstream.h>
 #include <bsl_utility.h>
@@ -134,6 +163,66 @@ class PropertiesReader {
                             bslma::Allocator*  allocator) = 0;
 };
 
+// ===========================
+// class BatchPropertiesReader
+// ===========================
+
+/// Interface for reading the properties of a batch of messages.
+class BatchPropertiesReader {
+  public:
+    // CREATORS
+
+    /// Destroy this object.
+    virtual ~BatchPropertiesReader();
+
+    // MANIPULATORS
+
+    /// Return a `bdld::Datum` object with value for the specified `name`
+    /// of the message at the specified `index` in the batch.  Use the
+    /// specified `allocator` for any memory allocation.  Note that the
+    /// values, including strings, must remain valid until the evaluation of
+    /// the batch completes.
+    virtual bdld::Datum
+    get(int index, const bsl::string& name, bslma::Allocator* allocator) = 0;
+};
+
+// =========================
+// struct PropertyConstraint
+// =========================
+
+/// Comparison of a property with an integer or string literal, which must
+/// hold for an expression to evaluate to `true`.  Note that the strings refer
+/// to the compiled expression, and remain valid as long as the
+/// `SimpleEvaluator` they were loaded from.
+struct PropertyConstraint {
+    // TYPES
+    enum Op {
+        e_EQ,  // property == literal
+        e_LT,  // property <  literal
+        e_LE,  // property <= literal
+        e_GT,  // property >  literal
+        e_GE   // property >= literal
+    };
+
+    // DATA
+
+    /// The name of the property.
+    bslstl::StringRef d_property;
+
+    /// The comparison of the property with the literal.
+    Op d_op;
+
+    /// `true` if the literal is `d_string`, and `false` if it is
+    /// `d_integer`.
+    bool d_isString;
+
+    /// The integer literal.
+    bsls::Types::Int64 d_integer;
+
+    /// The string literal.
+    bslstl::StringRef d_string;
+};
+
 // =====================
 // class SimpleEvaluator
 // =====================
@@ -143,6 +232,9 @@ class SimpleEvaluator {
   private:
     // PRIVATE TYPES
 
+    // FORWARD DECLARATIONS
+    class Program;
+
     // ----------
     // Expression
     // ----------
@@ -155,6 +247,17 @@ class SimpleEvaluator {
 
         /// Evaluate an Expression.
         virtual bdld::Datum evaluate(EvaluationContext& context) const = 0;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression into the register at the specified `target`,
+        /// using the registers above `target` for intermediate results.
+        virtual void emit(Program* program, int target) const = 0;
+
+        /// Append to the specified `constraints` the comparisons of a
+        /// property with a literal necessary for this expression to
+        /// evaluate to `true`.  The default implementation appends nothing.
+        virtual void
+        loadConstraints(bsl::vector<PropertyConstraint>* constraints) const;
     };
 
     // Bison generates different code for different available standards:
@@ -202,6 +305,13 @@ class SimpleEvaluator {
         /// `false`;
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression into the register at the specified `target`.
+        void emit(Program* program, int target) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Return the name of the property.
+        const bsl::string& name() const;
     };
 
     // --------------
@@ -227,6 +337,13 @@ class SimpleEvaluator {
         /// Return the integer passed to the constructor, as an Int64 Datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression into the register at the specified `target`.
+        void emit(Program* program, int target) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Return `d_value`.
+        bsls::Types::Int64 value() const;
     };
 
     // -------------
@@ -258,6 +375,13 @@ class SimpleEvaluator {
         /// Return the string passed to the constructor, as StringRef Datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression into the register at the specified `target`.
+        void emit(Program* program, int target) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Return `d_value`.
+        const bsl::string& value() const;
     };
 
     // --------------
@@ -285,6 +409,10 @@ class SimpleEvaluator {
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
 
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression into the register at the specified `target`.
+        void emit(Program* program, int target) const BSLS_KEYWORD_OVERRIDE;
+
         /// Return `d_value`.
         bool value() const;
     };
@@ -320,6 +448,15 @@ class SimpleEvaluator {
         /// return a null datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression into the register at the specified `target`.
+        void emit(Program* program, int target) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `constraints` the comparison of this
+        /// object if it compares a property with a literal.
+        void loadConstraints(bsl::vector<PropertyConstraint>* constraints)
+            const BSLS_KEYWORD_OVERRIDE;
     };
 
     // --
@@ -355,6 +492,10 @@ class SimpleEvaluator {
         /// its type is not checked.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression into the register at the specified `target`.
+        void emit(Program* program, int target) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ---
@@ -390,6 +531,15 @@ class SimpleEvaluator {
         /// its type is not checked.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression into the register at the specified `target`.
+        void emit(Program* program, int target) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `constraints` the constraints of both
+        /// operands.
+        void loadConstraints(bsl::vector<PropertyConstraint>* constraints)
+            const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ------------------
@@ -424,6 +574,10 @@ class SimpleEvaluator {
         /// datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression into the register at the specified `target`.
+        void emit(Program* program, int target) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ----------
@@ -451,6 +605,10 @@ class SimpleEvaluator {
         /// and return a null datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression into the register at the specified `target`.
+        void emit(Program* program, int target) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ---
@@ -478,6 +636,10 @@ class SimpleEvaluator {
         /// evaluation, and return a null datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression into the register at the specified `target`.
+        void emit(Program* program, int target) const BSLS_KEYWORD_OVERRIDE;
     };
 
     // ------
@@ -513,6 +675,154 @@ class SimpleEvaluator {
         /// evaluation, and return a null datum.
         bdld::Datum
         evaluate(EvaluationContext& context) const BSLS_KEYWORD_OVERRIDE;
+
+        /// Append to the specified `program` the instructions evaluating
+        /// this expression into the register at the specified `target`.
+        void emit(Program* program, int target) const BSLS_KEYWORD_OVERRIDE;
+    };
+
+    // -------
+    // Program
+    // -------
+
+    /// Compiled form of an expression: a sequence of instructions operating
+    /// on registers holding `bdld::Datum` values, along with the constants
+    /// and the names of the properties the instructions refer to.  The value
+    /// of the expression is the value of the first register once the last
+    /// instruction is executed.
+    class Program {
+      public:
+        // PUBLIC TYPES
+        enum Opcode {
+            /// Load the value of the property at index `operand`.
+            e_PROPERTY,
+
+            /// Load whether the property at index `operand` exists.
+            e_EXISTS,
+
+            /// Load the integer constant at index `operand`.
+            e_INTEGER,
+
+            /// Load the string constant at index `operand`.
+            e_STRING,
+
+            /// Load the boolean `operand`.
+            e_BOOLEAN,
+
+            /// Negate the boolean value of the register.
+            e_NOT,
+
+            /// Negate the integer value of the register.
+            e_NEGATE,
+
+            // Compare the value of the register with the value of the next
+            // register, and load the boolean result into the register.
+            e_EQ,
+            e_NE,
+            e_LT,
+            e_LE,
+            e_GT,
+            e_GE,
+
+            // Apply the arithmetic operation to the integer values of the
+            // register and of the next register, and load the result into
+            // the register.
+            e_ADD,
+            e_SUBTRACT,
+            e_MULTIPLY,
+            e_DIVIDE,
+            e_MODULUS,
+
+            /// Check that the value of the register is a boolean, and jump
+            /// to the instruction at index `operand` if it is `false`.
+            e_JUMP_IF_FALSE,
+
+            /// Check that the value of the register is a boolean, and jump
+            /// to the instruction at index `operand` if it is `true`.
+            e_JUMP_IF_TRUE,
+
+            /// Check that the value of the register is a boolean.
+            e_CHECK_BOOLEAN
+        };
+
+        struct Instruction {
+            /// The operation, one of `Opcode`.
+            unsigned char d_opcode;
+
+            /// The register the operation applies to.
+            unsigned char d_register;
+
+            /// The constant, property index, or jump target of the
+            /// operation.
+            unsigned short d_operand;
+        };
+
+      private:
+        // DATA
+
+        // The instructions of the program.
+        bsl::vector<Instruction> d_instructions;
+
+        // The names of the properties, by index.
+        bsl::vector<bsl::string> d_properties;
+
+        // The string constants, by index.
+        bsl::vector<bsl::string> d_strings;
+
+        // The integer constants, by index.
+        bsl::vector<bsls::Types::Int64> d_integers;
+
+      public:
+        // CREATORS
+
+        /// Create an empty program, using the specified `allocator` to
+        /// supply memory.
+        explicit Program(bslma::Allocator* allocator);
+
+        // MANIPULATORS
+
+        /// Append an instruction performing the specified `opcode` on the
+        /// register at the specified `target` with the optionally specified
+        /// `operand`, and return the index of the instruction.
+        int emit(Opcode opcode, int target, int operand = 0);
+
+        /// Set the target of the jump instruction at the specified `index`
+        /// to the instruction to be appended next.
+        void setJumpTarget(int index);
+
+        /// Return the index of the property with the specified `name`,
+        /// adding it if it is not yet referred to by this program.
+        int addProperty(const bsl::string& name);
+
+        /// Add the specified string `value` to the constants of this
+        /// program, and return its index.
+        int addString(const bsl::string& value);
+
+        /// Add the specified integer `value` to the constants of this
+        /// program, and return its index.
+        int addInteger(bsls::Types::Int64 value);
+
+        // ACCESSORS
+
+        /// Run this program, reading properties from the specified
+        /// `context`.  Return the boolean value of the program, or `false`
+        /// after setting the error in `context` if an error occurs.
+        bool run(EvaluationContext& context) const;
+
+        /// Run this program for each of the specified `numMessages`
+        /// messages whose properties are read from the specified `reader`,
+        /// and load into the specified `results` the boolean value of the
+        /// program for each message, and into the specified `errors` the
+        /// error for each message, using the specified `allocator` to
+        /// supply memory.
+        void runBatch(bsl::vector<char>*            results,
+                      bsl::vector<ErrorType::Enum>* errors,
+                      BatchPropertiesReader*        reader,
+                      int                           numMessages,
+                      bslma::Allocator*             allocator) const;
+
+        /// Return the number of instructions of this program.
+        int numInstructions() const;
     };
 
   private:
@@ -525,6 +835,9 @@ class SimpleEvaluator {
     // The expression to evaluate.
     bsl::shared_ptr<Expression> d_expression;
 
+    // The program compiled from `d_expression`.
+    bsl::shared_ptr<Program> d_program;
+
     // The flag indicating that `compile` was called for this expression.
     bool d_isCompiled;
 
@@ -566,6 +879,37 @@ class SimpleEvaluator {
     /// the constructor.
     bool evaluate(EvaluationContext& context) const;
 
+    /// Evaluate the expression for each of the specified `numMessages`
+    /// messages whose properties are read from the specified `reader`, and
+    /// load into the specified `results` the value of the expression for
+    /// each message, i.e., `(*results)[i]` is non-zero if and only if
+    /// `evaluate` would return `true` for the message at index `i`.
+    /// Optionally specify `errors` to load the error for each message,
+    /// `ErrorType::e_OK` if none.  Optionally specify an `allocator` used
+    /// to supply temporary memory.  The behavior is undefined unless
+    /// `isValid()` and `0 <= numMessages`.
+    void evaluateBatch(bsl::vector<char>*            results,
+                       BatchPropertiesReader*        reader,
+                       int                           numMessages,
+                       bsl::vector<ErrorType::Enum>* errors    = 0,
+                       bslma::Allocator*             allocator = 0) const;
+
+    /// Evaluate the expression like `evaluate`, by walking its syntax tree
+    /// instead of running its compiled program.  Note that this method is
+    /// slower than `evaluate`, and is meant for testing and benchmarking.
+    bool evaluateSyntaxTree(EvaluationContext& context) const;
+
+    /// Return the number of instructions of the program compiled from the
+    /// expression.  The behavior is undefined unless `isValid()`.
+    int numInstructions() const;
+
+    /// Append to the specified `constraints` the comparisons of a property
+    /// with an integer or string literal which are operands of the
+    /// top-level `&&` of the expression, i.e., which must hold for the
+    /// expression to evaluate to `true`.  The behavior is undefined unless
+    /// `isValid()`.
+    void loadConstraints(bsl::vector<PropertyConstraint>* constraints) const;
+
     /// Return `true` if the `compile` was called for this object.
     bool isCompiled() const;
 
@@ -671,6 +1015,18 @@ class CompilationContext {
     template <typename Class, typename ArgType>
     ExpressionPtr makeUnaryExpression(ArgType expr);
 
+    /// In compilation mode, create a Not, passing `expr` to the
+    /// constructor, and return an ExpressionPtr to it, or return a
+    /// BooleanLiteral if `expr` is one. In validation mode, return a null
+    /// ExpressionPtr. In both cases, increment the operator count.
+    ExpressionPtr makeNot(ExpressionPtr expr);
+
+    /// In compilation mode, create a UnaryMinus, passing `expr` to the
+    /// constructor, and return an ExpressionPtr to it, or return an
+    /// IntegerLiteral if `expr` is one. In validation mode, return a null
+    /// ExpressionPtr. In both cases, increment the operator count.
+    ExpressionPtr makeUnaryMinus(ExpressionPtr expr);
+
     /// In compilation mode, create a Class object, passing `a` and `b` to
     /// the constructor, and return an ExpressionPtr to it. In validation
     /// mode, return a null ExpressionPtr. Class is either And or Or. In
@@ -804,6 +1160,40 @@ inline bool SimpleEvaluator::isValid() const
     return d_expression != 0;
 }
 
+inline int SimpleEvaluator::numInstructions() const
+{
+    BSLS_ASSERT_SAFE(d_program.get());
+
+    return d_program->numInstructions();
+}
+
+inline void SimpleEvaluator::loadConstraints(
+    bsl::vector<PropertyConstraint>* constraints) const
+{
+    BSLS_ASSERT_SAFE(d_expression.get());
+    BSLS_ASSERT_SAFE(constraints);
+
+    d_expression->loadConstraints(constraints);
+}
+
+// -------------------------------
+// class SimpleEvaluator::Property
+// -------------------------------
+
+inline const bsl::string& SimpleEvaluator::Property::name() const
+{
+    return d_name;
+}
+
+// ------------------------------
+// class SimpleEvaluator::Program
+// ------------------------------
+
+inline int SimpleEvaluator::Program::numInstructions() const
+{
+    return static_cast<int>(d_instructions.size());
+}
+
 // -------------------------------------
 // class SimpleEvaluator::IntegerLiteral
 // -------------------------------------
@@ -814,6 +1204,20 @@ inline SimpleEvaluator::IntegerLiteral::IntegerLiteral(
 {
 }
 
+inline bsls::Types::Int64 SimpleEvaluator::IntegerLiteral::value() const
+{
+    return d_value;
+}
+
+// ------------------------------------
+// class SimpleEvaluator::StringLiteral
+// ------------------------------------
+
+inline const bsl::string& SimpleEvaluator::StringLiteral::value() const
+{
+    return d_value;
+}
+
 // -------------------------------------
 // class SimpleEvaluator::BooleanLiteral
 // -------------------------------------
@@ -893,6 +1297,99 @@ SimpleEvaluator::Comparison<Op>::evaluate(EvaluationContext& context) const
     return bdld::Datum::createBoolean(Op<bsls::Types::Int64>()(a, b));
 }
 
+template <template <typename> class Op>
+void SimpleEvaluator::Comparison<Op>::emit(Program* program, int target) const
+{
+    Program::Opcode opcode = Program::e_GE;
+
+    if (bsl::is_same<Op<int>, bsl::equal_to<int> >::value) {
+        opcode = Program::e_EQ;
+    }
+    else if (bsl::is_same<Op<int>, bsl::not_equal_to<int> >::value) {
+        opcode = Program::e_NE;
+    }
+    else if (bsl::is_same<Op<int>, bsl::less<int> >::value) {
+        opcode = Program::e_LT;
+    }
+    else if (bsl::is_same<Op<int>, bsl::less_equal<int> >::value) {
+        opcode = Program::e_LE;
+    }
+    else if (bsl::is_same<Op<int>, bsl::greater<int> >::value) {
+        opcode = Program::e_GT;
+    }
+
+    d_left->emit(program, target);
+    d_right->emit(program, target + 1);
+    program->emit(opcode, target);
+}
+
+template <template <typename> class Op>
+void SimpleEvaluator::Comparison<Op>::loadConstraints(
+    bsl::vector<PropertyConstraint>* constraints) const
+{
+    // Normalize the comparison to 'property <op> literal'.
+    const Property*   property  = dynamic_cast<const Property*>(d_left.get());
+    const Expression* literal   = d_right.get();
+    bool              isFlipped = false;
+
+    if (!property) {
+        property  = dynamic_cast<const Property*>(d_right.get());
+        literal   = d_left.get();
+        isFlipped = true;
+    }
+
+    if (!property) {
+        return;  // RETURN
+    }
+
+    PropertyConstraint constraint;
+
+    if (bsl::is_same<Op<int>, bsl::equal_to<int> >::value) {
+        constraint.d_op = PropertyConstraint::e_EQ;
+    }
+    else if (bsl::is_same<Op<int>, bsl::less<int> >::value) {
+        constraint.d_op = isFlipped ? PropertyConstraint::e_GT
+                                    : PropertyConstraint::e_LT;
+    }
+    else if (bsl::is_same<Op<int>, bsl::less_equal<int> >::value) {
+        constraint.d_op = isFlipped ? PropertyConstraint::e_GE
+                                    : PropertyConstraint::e_LE;
+    }
+    else if (bsl::is_same<Op<int>, bsl::greater<int> >::value) {
+        constraint.d_op = isFlipped ? PropertyConstraint::e_LT
+                                    : PropertyConstraint::e_GT;
+    }
+    else if (bsl::is_same<Op<int>, bsl::greater_equal<int> >::value) {
+        constraint.d_op = isFlipped ? PropertyConstraint::e_LE
+                                    : PropertyConstraint::e_GE;
+    }
+    else {
+        return;  // RETURN
+    }
+
+    const IntegerLiteral* integerLiteral =
+        dynamic_cast<const IntegerLiteral*>(literal);
+    const StringLiteral* stringLiteral = dynamic_cast<const StringLiteral*>(
+        literal);
+
+    if (integerLiteral) {
+        constraint.d_isString = false;
+        constraint.d_integer  = integerLiteral->value();
+    }
+    else if (stringLiteral) {
+        constraint.d_isString = true;
+        constraint.d_integer  = 0;
+        constraint.d_string   = stringLiteral->value();
+    }
+    else {
+        return;  // RETURN
+    }
+
+    constraint.d_property = property->name();
+
+    constraints->push_back(constraint);
+}
+
 // ----------------------------------
 // template class SimpleEvaluator::Or
 // ----------------------------------
@@ -978,6 +1475,30 @@ bdld::Datum SimpleEvaluator::NumBinaryOperation<Op>::evaluate(
     return bdld::Datum::createInteger64(result, context.d_allocator);
 }
 
+template <template <typename> class Op>
+void SimpleEvaluator::NumBinaryOperation<Op>::emit(Program* program,
+                                                   int      target) const
+{
+    Program::Opcode opcode = Program::e_MODULUS;
+
+    if (bsl::is_same<Op<int>, bsl::plus<int> >::value) {
+        opcode = Program::e_ADD;
+    }
+    else if (bsl::is_same<Op<int>, bsl::minus<int> >::value) {
+        opcode = Program::e_SUBTRACT;
+    }
+    else if (bsl::is_same<Op<int>, bsl::multiplies<int> >::value) {
+        opcode = Program::e_MULTIPLY;
+    }
+    else if (bsl::is_same<Op<int>, bsl::divides<int> >::value) {
+        opcode = Program::e_DIVIDE;
+    }
+
+    d_left->emit(program, target);
+    d_right->emit(program, target + 1);
+    program->emit(opcode, target);
+}
+
 // ------------------------------------------
 // template class SimpleEvaluator::UnaryMinus
 // ------------------------------------------
@@ -1146,6 +1667,35 @@ CompilationContext::makeComparison(ExpressionPtr a, ExpressionPtr b)
         }
     }
 
+    // Handle comparisons of integer or string literals at compile time.
+    typedef SimpleEvaluator::IntegerLiteral IntegerLiteral;
+    typedef SimpleEvaluator::StringLiteral  StringLiteral;
+
+    const IntegerLiteral* integer_a = dynamic_cast<const IntegerLiteral*>(
+        a.get());
+    const IntegerLiteral* integer_b = dynamic_cast<const IntegerLiteral*>(
+        b.get());
+
+    if (integer_a && integer_b) {
+        return ExpressionPtr(new (*d_allocator) BooleanLiteral(
+                                 Op<bsls::Types::Int64>()(integer_a->value(),
+                                                          integer_b->value())),
+                             d_allocator);  // RETURN
+    }
+
+    const StringLiteral* string_a = dynamic_cast<const StringLiteral*>(
+        a.get());
+    const StringLiteral* string_b = dynamic_cast<const StringLiteral*>(
+        b.get());
+
+    if (string_a && string_b) {
+        return ExpressionPtr(
+            new (*d_allocator) BooleanLiteral(Op<bslstl::StringRef>()(
+                string_a->value(),
+                string_b->value())),
+            d_allocator);  // RETURN
+    }
+
     return ExpressionPtr(new (*d_allocator)
                              SimpleEvaluator::Comparison<Op>(a, b),
                          d_allocator);
@@ -1162,6 +1712,29 @@ CompilationContext::makeBooleanBinaryExpression(ExpressionPtr a,
         return ExpressionPtr();  // RETURN
     }
 
+    // Handle boolean literals on the left side at compile time.
+    //   - for 'false && expr' return 'false'
+    //   - for 'true || expr'  return 'true'
+    //   - for 'true && b' and 'false || b', where 'b' is a boolean literal,
+    //   return 'b'
+    // Note that 'expr' is otherwise kept, so that its type is checked.
+
+    typedef SimpleEvaluator::BooleanLiteral BooleanLiteral;
+
+    const BooleanLiteral* boolean_a = dynamic_cast<const BooleanLiteral*>(
+        a.get());
+
+    if (boolean_a) {
+        if (boolean_a->value() ==
+            bsl::is_same<Class, SimpleEvaluator::Or>::value) {
+            return a;  // RETURN
+        }
+
+        if (dynamic_cast<const BooleanLiteral*>(b.get())) {
+            return b;  // RETURN
+        }
+    }
+
     return ExpressionPtr(new (*d_allocator) Class(a, b), d_allocator);
 }
 
@@ -1175,6 +1748,31 @@ CompilationContext::makeNumBinaryExpression(ExpressionPtr a, ExpressionPtr b)
         return ExpressionPtr();  // RETURN
     }
 
+    // Handle operations on integer literals at compile time, unless they
+    // fail, so that the error is reported at evaluation.
+    typedef SimpleEvaluator::IntegerLiteral IntegerLiteral;
+
+    const IntegerLiteral* integer_a = dynamic_cast<const IntegerLiteral*>(
+        a.get());
+    const IntegerLiteral* integer_b = dynamic_cast<const IntegerLiteral*>(
+        b.get());
+
+    if (integer_a && integer_b) {
+        const bsls::Types::Int64 value_a = integer_a->value();
+        const bsls::Types::Int64 value_b = integer_b->value();
+
+        if (!((bsl::is_same<Op<int>, bsl::divides<int> >::value ||
+               bsl::is_same<Op<int>, bsl::modulus<int> >::value) &&
+              (value_b == 0 ||
+               (value_a == bsl::numeric_limits<bsls::Types::Int64>::min() &&
+                value_b == -1)))) {
+            return ExpressionPtr(
+                new (*d_allocator) IntegerLiteral(
+                    Op<bsls::Types::Int64>()(value_a, value_b)),
+                d_allocator);  // RETURN
+        }
+    }
+
     return ExpressionPtr(new (*d_allocator)
                              SimpleEvaluator::NumBinaryOperation<Op>(a, b),
                          d_allocator);
@@ -1193,6 +1791,60 @@ CompilationContext::makeUnaryExpression(ArgType expr)
     return ExpressionPtr(new (*d_allocator) Class(expr), d_allocator);
 }
 
+inline SimpleEvaluator::ExpressionPtr
+CompilationContext::makeNot(ExpressionPtr expr)
+{
+    ++d_numOperators;
+
+    if (d_validationOnly) {
+        return ExpressionPtr();  // RETURN
+    }
+
+    // Handle the negation of a boolean literal at compile time.
+    typedef SimpleEvaluator::BooleanLiteral BooleanLiteral;
+
+    const BooleanLiteral* boolean = dynamic_cast<const BooleanLiteral*>(
+        expr.get());
+
+    if (boolean) {
+        return ExpressionPtr(new (*d_allocator)
+                                 BooleanLiteral(!boolean->value()),
+                             d_allocator);  // RETURN
+    }
+
+    return ExpressionPtr(new (*d_allocator) SimpleEvaluator::Not(expr),
+                         d_allocator);
+}
+
+inline SimpleEvaluator::ExpressionPtr
+CompilationContext::makeUnaryMinus(ExpressionPtr expr)
+{
+    ++d_numOperators;
+
+    if (d_validationOnly) {
+        return ExpressionPtr();  // RETURN
+    }
+
+    // Handle the negation of an integer literal at compile time.  Note that
+    // negating the smallest integer yields the smallest integer.
+    typedef SimpleEvaluator::IntegerLiteral IntegerLiteral;
+
+    const IntegerLiteral* integer = dynamic_cast<const IntegerLiteral*>(
+        expr.get());
+
+    if (integer) {
+        const bsls::Types::Uint64 value = static_cast<bsls::Types::Uint64>(
+            integer->value());
+
+        return ExpressionPtr(new (*d_allocator) IntegerLiteral(
+                                 static_cast<bsls::Types::Int64>(0 - value)),
+                             d_allocator);  // RETURN
+    }
+
+    return ExpressionPtr(new (*d_allocator) SimpleEvaluator::UnaryMinus(expr),
+                         d_allocator);
+}
+
 // -----------------------
 // class EvaluationContext
 // -----------------------
@@ -85,6 +85,72 @@ bdld::Datum MockPropertiesReader::get(const bsl::string& name,
     return iter->second;
 }
 
+/// PropertiesReader counting the properties read.
+class CountingPropertiesReader : public MockPropertiesReader {
+  public:
+    // PUBLIC DATA
+    int d_numReads;
+
+    // CREATORS
+    CountingPropertiesReader(bslma::Allocator* allocator);
+
+    // MANIPULATORS
+
+    /// Return a `bdld::Datum` object with value for the specified `name`,
+    /// and increment the number of properties read.  The
+    /// `bslma::Allocator*` argument is unused.
+    bdld::Datum get(const bsl::string& name,
+                    bslma::Allocator*  allocator) BSLS_KEYWORD_OVERRIDE;
+};
+
+CountingPropertiesReader::CountingPropertiesReader(
+    bslma::Allocator* allocator)
+: MockPropertiesReader(allocator)
+, d_numReads(0)
+{
+}
+
+bdld::Datum CountingPropertiesReader::get(const bsl::string& name,
+                                          bslma::Allocator*  allocator)
+{
+    ++d_numReads;
+
+    return MockPropertiesReader::get(name, allocator);
+}
+
+/// BatchPropertiesReader reading the properties of each message from a
+/// `MockPropertiesReader`.
+class MockBatchPropertiesReader : public BatchPropertiesReader {
+  public:
+    // PUBLIC DATA
+    bsl::vector<MockPropertiesReader*> d_readers;
+
+    // CREATORS
+    MockBatchPropertiesReader(bslma::Allocator* allocator);
+
+    // MANIPULATORS
+
+    /// Return a `bdld::Datum` object with value for the specified `name`
+    /// of the message at the specified `index`, read from the reader at
+    /// `index` in `d_readers`, using the specified `allocator`.
+    bdld::Datum get(int                index,
+                    const bsl::string& name,
+                    bslma::Allocator*  allocator) BSLS_KEYWORD_OVERRIDE;
+};
+
+MockBatchPropertiesReader::MockBatchPropertiesReader(
+    bslma::Allocator* allocator)
+: d_readers(allocator)
+{
+}
+
+bdld::Datum MockBatchPropertiesReader::get(int                index,
+                                           const bsl::string& name,
+                                           bslma::Allocator*  allocator)
+{
+    return d_readers[index]->get(name, allocator);
+}
+
 #ifdef BMQTST_BENCHMARK_ENABLED
 static void testN1_SimpleEvaluator_GoogleBenchmark(benchmark::State& state)
 {
@@ -108,12 +174,90 @@ static void testN1_SimpleEvaluator_GoogleBenchmark(benchmark::State& state)
     }
     // </time>
 }
+
+static void
+testN2_SimpleEvaluatorSyntaxTree_GoogleBenchmark(benchmark::State& state)
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: SimpleEvaluator syntax tree");
+
+    bdlma::LocalSequentialAllocator<2048> localAllocator;
+    MockPropertiesReader                  reader(&localAllocator);
+    EvaluationContext evaluationContext(&reader, &localAllocator);
+
+    CompilationContext compilationContext(&localAllocator);
+    SimpleEvaluator    evaluator;
+
+    BMQTST_ASSERT(evaluator.compile("false || (i64_42==42 && s_foo==\"foo\")",
+                                    compilationContext) == 0);
+
+    BMQTST_ASSERT_EQ(evaluator.evaluateSyntaxTree(evaluationContext), true);
+
+    // <time>
+    for (auto _ : state) {
+        evaluator.evaluateSyntaxTree(evaluationContext);
+    }
+    // </time>
+}
+
+static void
+testN3_SimpleEvaluatorBatch_GoogleBenchmark(benchmark::State& state)
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: SimpleEvaluator batch");
+
+    const int k_NUM_MESSAGES = 1024;
+
+    MockPropertiesReader      reader0(bmqtst::TestHelperUtil::allocator());
+    MockPropertiesReader      reader1(bmqtst::TestHelperUtil::allocator());
+    MockBatchPropertiesReader batchReader(bmqtst::TestHelperUtil::allocator());
+
+    reader1.d_map["i64_42"] = bdld::Datum::createInteger(0);
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        batchReader.d_readers.push_back(i % 2 ? &reader1 : &reader0);
+    }
+
+    CompilationContext compilationContext(
+        bmqtst::TestHelperUtil::allocator());
+    SimpleEvaluator    evaluator;
+
+    BMQTST_ASSERT(evaluator.compile("false || (i64_42==42 && s_foo==\"foo\")",
+                                    compilationContext) == 0);
+
+    bsl::vector<char> results(bmqtst::TestHelperUtil::allocator());
+
+    // <time>
+    for (auto _ : state) {
+        evaluator.evaluateBatch(&results,
+                                &batchReader,
+                                k_NUM_MESSAGES,
+                                0,
+                                bmqtst::TestHelperUtil::allocator());
+    }
+    // </time>
+
+    state.SetItemsProcessed(state.iterations() * k_NUM_MESSAGES);
+}
 #else
 static void testN1_SimpleEvaluator()
 {
     bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: SimpleEvaluator");
     PV("GoogleBenchmark is not supported on this platform, skipping...")
 }
+
+static void testN2_SimpleEvaluatorSyntaxTree()
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: SimpleEvaluator syntax tree");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+
+static void testN3_SimpleEvaluatorBatch()
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: SimpleEvaluator batch");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
 #endif
 
 // ============================================================================
@@ -592,6 +736,8 @@ static void test3_evaluation()
             BMQTST_ASSERT(evaluator.isValid());
             BMQTST_ASSERT_EQ(evaluator.evaluate(evaluationContext),
                              parameters->expected);
+            BMQTST_ASSERT_EQ(evaluator.evaluateSyntaxTree(evaluationContext),
+                             parameters->expected);
         }
     }
 }
@@ -625,6 +771,11 @@ static void test4_evaluationErrors()
         {"i64_min / i_neg1 == 0", ErrorType::e_ARITHMETIC},
         {"i64_min % i_neg1 == 0", ErrorType::e_ARITHMETIC},
 
+        // errors in operations on literals are reported at evaluation
+        {"1 / 0 == 0 || b_true", ErrorType::e_ARITHMETIC},
+        {"(1 == \"foo\") || b_true", ErrorType::e_TYPE},
+        {"(true && 1) || b_true", ErrorType::e_TYPE},
+
     };
     const TestParameters* testParametersEnd = testParameters +
                                               sizeof(testParameters) /
@@ -649,10 +800,291 @@ static void test4_evaluationErrors()
             BMQTST_ASSERT_EQ(evaluator.evaluate(evaluationContext), false);
             BMQTST_ASSERT_EQ(evaluationContext.lastError(),
                              parameters->expectedError);
+
+            BMQTST_ASSERT_EQ(evaluator.evaluateSyntaxTree(evaluationContext),
+                             false);
+            BMQTST_ASSERT_EQ(evaluationContext.lastError(),
+                             parameters->expectedError);
+        }
+    }
+}
+
+static void test5_compiledProgram()
+// ------------------------------------------------------------------------
+// COMPILED PROGRAM
+//
+// Concerns:
+//   - Operations on literals are folded at compile time.
+//   - Each property is read at most once per evaluation.
+//   - '&&' and '||' do not evaluate their right operand when the left one
+//     determines the result.
+//
+// Testing:
+//   numInstructions
+//   evaluate
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COMPILED PROGRAM");
+
+    CountingPropertiesReader reader(bmqtst::TestHelperUtil::allocator());
+    EvaluationContext        evaluationContext(&reader,
+                                        bmqtst::TestHelperUtil::allocator());
+
+    struct TestParameters {
+        const char* expression;
+        bool        expected;
+        int         numInstructions;
+        int         numReads;
+    } testParameters[] = {
+        // folding
+        {"i_42 == 2 * 20 + 2", true, 3, 1},
+        {"i_42 == -(-42)", true, 3, 1},
+        {"i_42 % 10 == 9 / 3 - 1", true, 5, 1},
+        {"(\"bar\" < \"foo\") == b_true", true, 1, 1},
+        {"(1 < 2) && b_true", true, 4, 1},
+        {"b_true && !false", true, 4, 1},
+        {"true || b_false", true, 1, 0},
+        {"false && b_true", false, 1, 0},
+
+        // properties read once
+        {"i_1 > 0 && i_1 < 5", true, 8, 1},
+        {"exists(i_1) && i_1 == 1", true, 6, 1},
+        {"i_1 + i_1 + i_1 == 3", true, 7, 1},
+
+        // short-circuit
+        {"b_true || i_42 == 0", true, 6, 1},
+        {"b_false && i_42 == 0", false, 6, 1},
+        {"b_false || i_42 == 42", true, 6, 2},
+    };
+    const TestParameters* testParametersEnd = testParameters +
+                                              sizeof(testParameters) /
+                                                  sizeof(*testParameters);
+
+    for (const TestParameters* parameters = testParameters;
+         parameters < testParametersEnd;
+         ++parameters) {
+        PV(bsl::string("TESTING ") + parameters->expression);
+
+        CompilationContext compilationContext(
+            bmqtst::TestHelperUtil::allocator());
+        SimpleEvaluator evaluator;
+
+        if (evaluator.compile(parameters->expression, compilationContext)) {
+            PV(bsl::string("UNEXPECTED: ") +
+               compilationContext.lastErrorMessage());
+            BMQTST_ASSERT(false);
+        }
+        else {
+            BMQTST_ASSERT_EQ(evaluator.numInstructions(),
+                             parameters->numInstructions);
+
+            reader.d_numReads = 0;
+            BMQTST_ASSERT_EQ(evaluator.evaluate(evaluationContext),
+                             parameters->expected);
+            BMQTST_ASSERT_EQ(reader.d_numReads, parameters->numReads);
         }
     }
 }
 
+static void test6_constraints()
+// ------------------------------------------------------------------------
+// CONSTRAINTS
+//
+// Concerns:
+//   - The comparisons of a property with a literal which are operands of
+//     the top-level '&&' are reported, normalized to have the property on
+//     the left.
+//   - Comparisons under '||' or '!', '!=' comparisons and comparisons with
+//     non-literals are not reported.
+//
+// Testing:
+//   loadConstraints
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("CONSTRAINTS");
+
+    struct TestParameters {
+        const char* expression;
+        const char* expected;
+    } testParameters[] = {
+        {"i_1 == 1", "i_1 == 1;"},
+        {"s_foo == \"foo\"", "s_foo == \"foo\";"},
+        {"1 == i_1", "i_1 == 1;"},
+        {"i_1 < 5 && i_1 >= 0", "i_1 < 5;i_1 >= 0;"},
+        {"5 < i_1 && 5 <= i_2", "i_1 > 5;i_2 >= 5;"},
+        {"5 > i_1 && 5 >= i_2", "i_1 < 5;i_2 <= 5;"},
+        {"(i_1 == 1 && b_true) && s_foo > \"bar\"",
+         "i_1 == 1;s_foo > \"bar\";"},
+        {"i_1 == 2 * 3", "i_1 == 6;"},
+        {"i_1 == 1 || i_2 == 2", ""},
+        {"!(i_1 == 1)", ""},
+        {"i_1 != 1", ""},
+        {"i_1 == i_2", ""},
+        {"i_1 + 1 == 2", ""},
+        {"b_true", ""},
+    };
+    const TestParameters* testParametersEnd = testParameters +
+                                              sizeof(testParameters) /
+                                                  sizeof(*testParameters);
+
+    const char* k_OPS[] = {"==", "<", "<=", ">", ">="};
+
+    for (const TestParameters* parameters = testParameters;
+         parameters < testParametersEnd;
+         ++parameters) {
+        PV(bsl::string("TESTING ") + parameters->expression);
+
+        CompilationContext compilationContext(
+            bmqtst::TestHelperUtil::allocator());
+        SimpleEvaluator evaluator;
+
+        if (evaluator.compile(parameters->expression, compilationContext)) {
+            PV(bsl::string("UNEXPECTED: ") +
+               compilationContext.lastErrorMessage());
+            BMQTST_ASSERT(false);
+            continue;  // CONTINUE
+        }
+
+        bsl::vector<PropertyConstraint> constraints(
+            bmqtst::TestHelperUtil::allocator());
+        evaluator.loadConstraints(&constraints);
+
+        bmqu::MemOutStream os(bmqtst::TestHelperUtil::allocator());
+        for (size_t i = 0; i < constraints.size(); ++i) {
+            const PropertyConstraint& constraint = constraints[i];
+
+            os << constraint.d_property << " " << k_OPS[constraint.d_op]
+               << " ";
+            if (constraint.d_isString) {
+                os << "\"" << constraint.d_string << "\"";
+            }
+            else {
+                os << constraint.d_integer;
+            }
+            os << ";";
+        }
+
+        BMQTST_ASSERT_EQ(os.str(), parameters->expected);
+    }
+}
+
+static void test7_batchEvaluation()
+// ------------------------------------------------------------------------
+// BATCH EVALUATION
+//
+// Concerns:
+//   - The result and the error of 'evaluateBatch' for each message of a
+//     batch are the ones of 'evaluate' for that message, including when
+//     messages of the same batch take different branches of '&&' and '||',
+//     or fail at different instructions.
+//   - An empty batch yields no results.
+//
+// Testing:
+//   evaluateBatch
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BATCH EVALUATION");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    // Messages with different values and types for the same properties.
+    MockPropertiesReader reader0(alloc);
+    MockPropertiesReader reader1(alloc);
+    MockPropertiesReader reader2(alloc);
+    MockPropertiesReader reader3(alloc);
+    MockPropertiesReader reader4(alloc);
+
+    reader1.d_map["i_1"]    = bdld::Datum::createInteger(5);
+    reader1.d_map["s_foo"]  = bdld::Datum::createStringRef("bar", alloc);
+    reader1.d_map["b_true"] = bdld::Datum::createBoolean(false);
+    reader2.d_map.erase("i_1");
+    reader2.d_map.erase("b_true");
+    reader3.d_map["i_1"]    = bdld::Datum::createStringRef("x", alloc);
+    reader3.d_map["s_foo"]  = bdld::Datum::createInteger(1);
+    reader4.d_map["i_1"]    = bdld::Datum::createInteger64(-7, alloc);
+
+    MockPropertiesReader* readers[] =
+        {&reader0, &reader1, &reader2, &reader3, &reader4, &reader1};
+    const int k_NUM_MESSAGES = sizeof(readers) / sizeof(*readers);
+
+    MockBatchPropertiesReader batchReader(alloc);
+    batchReader.d_readers.assign(readers, readers + k_NUM_MESSAGES);
+
+    const char* expressions[] = {
+        "b_true",
+        "i_1",
+        "!b_true",
+        "i_1 == 1",
+        "i_1 != 1",
+        "1 < i_1",
+        "i_1 >= 5",
+        "s_foo == \"foo\"",
+        "s_foo < \"goo\"",
+        "i_1 == s_foo",
+        "-i_1 < 0",
+        "i_1 + i_42 * 2 >= 85",
+        "i_1 - 1 == 0",
+        "i_1 / (i_1 - 1) == 0",
+        "i_1 % 2 == 1",
+        "i_42 / i_1 == -1",
+        "b_true || i_1 == 1",
+        "b_false && i_1 == 1",
+        "b_true && s_foo == \"foo\"",
+        "exists(i_1) && i_1 == 1",
+        "!exists(b_true) || !b_true",
+        "(i_1 == 1 || i_1 == 5) && b_true",
+        "(i_1 > 0 && i_1 < 5) || (s_foo >= \"bar\" && !(i_1 == 5))",
+    };
+    const char** expressionsEnd = expressions +
+                                  sizeof(expressions) / sizeof(*expressions);
+
+    for (const char** expression = expressions; expression < expressionsEnd;
+         ++expression) {
+        PV(bsl::string("TESTING ") + *expression);
+
+        CompilationContext compilationContext(alloc);
+        SimpleEvaluator    evaluator;
+
+        if (evaluator.compile(*expression, compilationContext)) {
+            PV(bsl::string("UNEXPECTED: ") +
+               compilationContext.lastErrorMessage());
+            BMQTST_ASSERT(false);
+            continue;  // CONTINUE
+        }
+
+        bsl::vector<char>            results(alloc);
+        bsl::vector<ErrorType::Enum> errors(alloc);
+        evaluator.evaluateBatch(&results,
+                                &batchReader,
+                                k_NUM_MESSAGES,
+                                &errors,
+                                alloc);
+
+        BMQTST_ASSERT_EQ(static_cast<size_t>(k_NUM_MESSAGES), results.size());
+        BMQTST_ASSERT_EQ(static_cast<size_t>(k_NUM_MESSAGES), errors.size());
+
+        for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+            EvaluationContext evaluationContext(readers[i], alloc);
+
+            const bool expected = evaluator.evaluate(evaluationContext);
+
+            BMQTST_ASSERT_EQ_D(i, expected, results[i] != 0);
+            BMQTST_ASSERT_EQ_D(i, evaluationContext.lastError(), errors[i]);
+        }
+    }
+
+    PV("Empty batch");
+
+    CompilationContext compilationContext(alloc);
+    SimpleEvaluator    evaluator;
+    BMQTST_ASSERT_EQ(0, evaluator.compile("i_1 == 1", compilationContext));
+
+    bsl::vector<char> results(alloc);
+    results.push_back(1);
+    evaluator.evaluateBatch(&results, &batchReader, 0);
+    BMQTST_ASSERT(results.empty());
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -663,11 +1095,16 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 7: test7_batchEvaluation(); break;
+    case 6: test6_constraints(); break;
+    case 5: test5_compiledProgram(); break;
     case 4: test4_evaluationErrors(); break;
     case 3: test3_evaluation(); break;
     case 2: test2_propertyNames(); break;
     case 1: test1_compilationErrors(); break;
     case -1: BMQTST_BENCHMARK(testN1_SimpleEvaluator); break;
+    case -2: BMQTST_BENCHMARK(testN2_SimpleEvaluatorSyntaxTree); break;
+    case -3: BMQTST_BENCHMARK(testN3_SimpleEvaluatorBatch); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
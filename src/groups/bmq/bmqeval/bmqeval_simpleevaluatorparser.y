@@ -158,7 +158,7 @@ expression
     | expression OR expression
         { $$ = ctx.makeBooleanBinaryExpression<SimpleEvaluator::Or>($1, $3); }
     | NOT expression
-        { $$ = ctx.makeUnaryExpression<SimpleEvaluator::Not>($2); }
+        { $$ = ctx.makeNot($2); }
     | expression PLUS expression
         { $$ = ctx.makeNumBinaryExpression<bsl::plus>($1, $3); }
     | expression MINUS expression
@@ -170,7 +170,7 @@ expression
     | expression MODULUS expression
         { $$ = ctx.makeNumBinaryExpression<bsl::modulus>($1, $3); }
     | MINUS expression %prec NOT
-        { $$ = ctx.makeUnaryExpression<SimpleEvaluator::UnaryMinus>($2); }
+        { $$ = ctx.makeUnaryMinus($2); }
     | LPAR expression RPAR
         { $$ = $2; }
 
@@ -64,6 +64,24 @@
 //
 //  // the output is always "123"
 //..
+//
+/// Batching and fairness
+///---------------------
+// By default, a strand invokes all the functors submitted to it in a single
+// submission to its underlying executor, for as long as its job queue is not
+// empty.  A busy strand may therefore monopolize a thread of the underlying
+// execution context.  The number of functors invoked per submission, and the
+// time spent invoking them, can be bounded using 'setMaxBatchSize' and
+// 'setMaxBatchDuration'.  Once either limit is reached, the strand yields:
+// it re-submits itself to the underlying executor, behind the work already
+// submitted to it (e.g., by other strands sharing the same thread pool), and
+// resumes invoking its functors from there.  Ordering and non-concurrency
+// guarantees are unaffected.
+//..
+//  // invoke at most 32 functors, or for at most 500 microseconds, per turn
+//  strand.setMaxBatchSize(32);
+//  strand.setMaxBatchDuration(bsls::TimeInterval(0, 500 * 1000));
+//..
 
 #include <bmqex_executortraits.h>
 #include <bmqex_job.h>
@@ -85,10 +103,14 @@
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 #include <bslmt_threadutil.h>
+#include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_compilerfeatures.h>
 #include <bsls_exceptionutil.h>  // BSLS_NOTHROW_SPEC
 #include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -151,6 +173,14 @@ class Strand {
     // completed, and `false` otherwise.
     bool d_isRunning;
 
+    // Maximum number of functors invoked by a single call to `run`, or 0
+    // if unlimited.
+    size_t d_maxBatchSize;
+
+    // Maximum time, in nanoseconds, spent invoking functors by a single
+    // call to `run`, or 0 if unlimited.
+    bsls::Types::Int64 d_maxBatchDurationNs;
+
     // Functors to be executed.
     bsl::deque<Job> d_jobQueue;
 
@@ -162,7 +192,9 @@ class Strand {
     // PRIVATE MANIPULATORS
 
     /// Invoke functors from the job queue until either the queue is empty,
-    /// or the context is stopped. Then, signal the condition.
+    /// or the context is stopped. Then, signal the condition. If the batch
+    /// size or duration limit is reached first, re-submit this function to
+    /// the underlying executor instead.
     void run() BSLS_NOTHROW_SPEC;
 
   private:
@@ -216,6 +248,22 @@ class Strand {
     /// any) from this strand. Return the number of removed functors.
     size_t dropPendingJobs() BSLS_KEYWORD_NOEXCEPT;
 
+    /// Set the maximum number of functors invoked per submission to the
+    /// underlying executor to the specified `value`, 0 meaning unlimited.
+    /// Once that many functors have been invoked, the strand yields to the
+    /// underlying executor before invoking the next one.  The new value
+    /// takes effect on the next submission.
+    void setMaxBatchSize(size_t value) BSLS_KEYWORD_NOEXCEPT;
+
+    /// Set the maximum time spent invoking functors per submission to the
+    /// underlying executor to the specified `value`, a zero interval
+    /// meaning unlimited.  Once that time has elapsed, the strand yields to
+    /// the underlying executor before invoking the next functor.  The new
+    /// value takes effect on the next submission.  The behavior is
+    /// undefined unless `value` is non-negative.
+    void setMaxBatchDuration(const bsls::TimeInterval& value)
+        BSLS_KEYWORD_NOEXCEPT;
+
   public:
     // ACCESSORS
 
@@ -364,9 +412,43 @@ inline void Strand<EXECUTOR>::run() BSLS_NOTHROW_SPEC
     // set the working thread to this one
     d_workingThreadId.storeRelease(bslmt::ThreadUtil::selfIdAsUint64());
 
+    // read the batch limits, which may only change between two batches
+    const size_t             maxBatchSize       = d_maxBatchSize;
+    const bsls::Types::Int64 maxBatchDurationNs = d_maxBatchDurationNs;
+    size_t                   numInvoked         = 0;
+
+    bsls::Types::Int64 startTime = 0;
+    if (maxBatchDurationNs != 0) {
+        startTime = bsls::TimeUtil::getTimer();
+    }
+
     while (d_isStarted && !d_jobQueue.empty()) {
         // Execute all jobs in the queue.
 
+        if (numInvoked != 0 &&
+            ((maxBatchSize != 0 && numInvoked == maxBatchSize) ||
+             (maxBatchDurationNs != 0 &&
+              bsls::TimeUtil::getTimer() - startTime >= maxBatchDurationNs))) {
+            // Batch limit reached. Yield to other work submitted to the
+            // underlying executor, keeping the 'isRunning' flag set.
+            d_workingThreadId.storeRelease(
+                Strand_ThreadUtil::invalidThreadId());
+
+            try {
+                ExecutorTraits<EXECUTOR>::post(
+                    d_innerExecutor,
+                    bdlf::MemFnUtil::memFn(&Strand::run, this));
+                return;  // RETURN
+            }
+            catch (...) {
+                // Failed to yield. Keep on executing jobs from this thread.
+                d_workingThreadId.storeRelease(
+                    bslmt::ThreadUtil::selfIdAsUint64());
+                numInvoked = 0;
+                startTime  = bsls::TimeUtil::getTimer();
+            }
+        }
+
         // execute job outside the lock
         Job& job = d_jobQueue.front();
         d_mutex.unlock();  // UNLOCK
@@ -375,6 +457,7 @@ inline void Strand<EXECUTOR>::run() BSLS_NOTHROW_SPEC
 
         // remove job from the queue
         d_jobQueue.pop_front();
+        ++numInvoked;
     }
 
     // unset the working thread
@@ -396,6 +479,8 @@ inline Strand<EXECUTOR>::Strand(bslma::Allocator* basicAllocator)
 , d_workingThreadId(Strand_ThreadUtil::invalidThreadId())
 , d_isStarted(false)
 , d_isRunning(false)
+, d_maxBatchSize(0)
+, d_maxBatchDurationNs(0)
 , d_jobQueue(basicAllocator)
 {
     // NOTHING
@@ -410,6 +495,8 @@ inline Strand<EXECUTOR>::Strand(EXECUTOR          executor,
 , d_workingThreadId(Strand_ThreadUtil::invalidThreadId())
 , d_isStarted(false)
 , d_isRunning(false)
+, d_maxBatchSize(0)
+, d_maxBatchDurationNs(0)
 , d_jobQueue(basicAllocator)
 {
     // NOTHING
@@ -498,6 +585,27 @@ inline size_t Strand<EXECUTOR>::dropPendingJobs() BSLS_KEYWORD_NOEXCEPT
     }
 }
 
+template <class EXECUTOR>
+inline void
+Strand<EXECUTOR>::setMaxBatchSize(size_t value) BSLS_KEYWORD_NOEXCEPT
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);  // LOCK
+
+    d_maxBatchSize = value;
+}
+
+template <class EXECUTOR>
+inline void Strand<EXECUTOR>::setMaxBatchDuration(
+    const bsls::TimeInterval& value) BSLS_KEYWORD_NOEXCEPT
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(value >= bsls::TimeInterval());
+
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);  // LOCK
+
+    d_maxBatchDurationNs = value.totalNanoseconds();
+}
+
 // ACCESSORS
 template <class EXECUTOR>
 inline size_t Strand<EXECUTOR>::outstandingJobs() const BSLS_KEYWORD_NOEXCEPT
@@ -276,6 +276,65 @@ class ThrowingExecutor {
     }
 };
 
+// ====================
+// class ManualExecutor
+// ====================
+
+/// Provides an executor that stores submitted function objects into a
+/// vector, for the test driver to invoke them explicitly.
+class ManualExecutor {
+  public:
+    // TYPES
+    typedef bsl::vector<bsl::function<void()> > JobList;
+
+  private:
+    // PRIVATE DATA
+    JobList* d_jobs_p;
+
+  public:
+    // CREATORS
+    explicit ManualExecutor(JobList* jobs)
+    : d_jobs_p(jobs)
+    {
+        // PRECONDITIONS
+        BSLS_ASSERT(jobs);
+    }
+
+  public:
+    // MANIPULATORS
+    template <class FUNCTION>
+    void post(FUNCTION f) const
+    {
+        d_jobs_p->push_back(f);
+    }
+
+    template <class FUNCTION>
+    BSLA_MAYBE_UNUSED void dispatch(FUNCTION f) const
+    {
+        d_jobs_p->push_back(f);
+    }
+
+    /// Invoke and remove the oldest submitted function object.  The
+    /// behavior is undefined unless there is one.
+    void runOne() const
+    {
+        BSLS_ASSERT_OPT(!d_jobs_p->empty());
+
+        bsl::function<void()> job(bsl::allocator_arg,
+                                  d_jobs_p->get_allocator(),
+                                  d_jobs_p->front());
+        d_jobs_p->erase(d_jobs_p->begin());
+        job();
+    }
+
+  public:
+    // ACCESSORS
+    BSLA_MAYBE_UNUSED bool operator==(const ManualExecutor& rhs) const
+    {
+        return d_jobs_p == rhs.d_jobs_p;
+    }
+};
+
 // ==========================
 // class TestExecutionContext
 // ==========================
@@ -1191,6 +1250,94 @@ static void test11_executor_context()
     BMQTST_ASSERT_EQ(&ex2.context(), &strand2);
 }
 
+static void test12_strand_batching()
+// ------------------------------------------------------------------------
+// STRAND BATCHING
+//
+// Concerns:
+//   Ensure that the strand yields to its underlying executor once the
+//   configured batch size or batch duration is reached, without breaking
+//   the ordering of its function objects.
+//
+// Plan:
+//   1. Set a maximum batch size of 3, submit 7 function objects, and
+//      check that they are invoked, in order, in 3 submissions to the
+//      underlying executor.
+//   2. Set a tiny maximum batch duration, and check that each function
+//      object is then invoked in its own submission.
+//
+// Testing:
+//   bmqex::Strand::setMaxBatchSize
+//   bmqex::Strand::setMaxBatchDuration
+// ------------------------------------------------------------------------
+{
+    typedef bmqex::Strand<ManualExecutor> Strand;
+
+    bslma::TestAllocator alloc;
+
+    // 1. Batch size
+    {
+        ManualExecutor::JobList jobs(&alloc);
+        bsl::vector<int>        out(&alloc);
+        Strand                  strand(ManualExecutor(&jobs), &alloc);
+
+        strand.setMaxBatchSize(3);
+        for (int i = 0; i < 7; ++i) {
+            strand.executor().post(
+                bdlf::BindUtil::bind(PushBack(), &out, i));
+        }
+
+        strand.start();
+        BMQTST_ASSERT_EQ(jobs.size(), 1u);
+
+        ManualExecutor(&jobs).runOne();
+        BMQTST_ASSERT_EQ(out.size(), 3u);
+        BMQTST_ASSERT_EQ(jobs.size(), 1u);
+        BMQTST_ASSERT_EQ(strand.outstandingJobs(), 4u);
+
+        ManualExecutor(&jobs).runOne();
+        BMQTST_ASSERT_EQ(out.size(), 6u);
+        BMQTST_ASSERT_EQ(jobs.size(), 1u);
+
+        ManualExecutor(&jobs).runOne();
+        BMQTST_ASSERT_EQ(out.size(), 7u);
+        BMQTST_ASSERT(jobs.empty());
+        BMQTST_ASSERT_EQ(strand.outstandingJobs(), 0u);
+
+        for (int i = 0; i < 7; ++i) {
+            BMQTST_ASSERT_EQ(out[i], i);
+        }
+
+        // 'join' completes once the last batch is done
+        strand.join();
+    }
+
+    // 2. Batch duration
+    {
+        ManualExecutor::JobList jobs(&alloc);
+        Strand                  strand(ManualExecutor(&jobs), &alloc);
+
+        strand.setMaxBatchDuration(bsls::TimeInterval(0, 1));
+        for (int i = 0; i < 3; ++i) {
+            strand.executor().post(bdlf::BindUtil::bind(
+                &bslmt::ThreadUtil::microSleep,
+                1000,  // microseconds
+                0));   // seconds
+        }
+
+        strand.start();
+        for (int i = 3; i > 0; --i) {
+            BMQTST_ASSERT_EQ(jobs.size(), 1u);
+            BMQTST_ASSERT_EQ(strand.outstandingJobs(),
+                             static_cast<size_t>(i));
+            ManualExecutor(&jobs).runOne();
+        }
+
+        BMQTST_ASSERT(jobs.empty());
+        BMQTST_ASSERT_EQ(strand.outstandingJobs(), 0u);
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1215,6 +1362,9 @@ int main(int argc, char* argv[])
     case 10: test10_executor_runningInThisThread(); break;
     case 11: test11_executor_context(); break;
 
+    // bmqex::Strand (batching)
+    case 12: test12_strand_batching(); break;
+
     default: {
         bsl::cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND."
                   << bsl::endl;
@@ -84,6 +84,9 @@ const bsls::Types::Int64 k_CHANNEL_LOW_WATERMARK         = 512 * 1024;
 const int                k_DEFAULT_MAX_MISSED_HEARTBEATS = 10;
 const int                k_DEFAULT_HEARTBEAT_INTERVAL_MS = 1000;
 
+/// Scheme of a broker URI designating a local (Unix domain) socket.
+const char k_LOCAL_BROKER_URI_PREFIX[] = "unix://";
+
 /// Create the StatContextConfiguration to use, from the specified
 /// `options`, and using the specified `allocator` for memory allocations.
 bmqst::StatContextConfiguration
@@ -504,16 +507,31 @@ bmqt::GenericResult::Enum Application::startChannel()
                      bmqimp::BrokerSession::State::e_STARTING);
 
     // 1. Prepare and validate connection parameters
-    bmqio::TCPEndpoint endpoint(d_sessionOptions.brokerUri());
-    if (!endpoint) {
-        BALL_LOG_ERROR << id() << "Invalid brokerURI '"
-                       << d_sessionOptions.brokerUri() << "'";
-        return bmqt::GenericResult::e_INVALID_ARGUMENT;  // RETURN
-    }
-
     bdlma::LocalSequentialAllocator<32> localAllocator(&d_allocator);
     bmqu::MemOutStream                  out(&localAllocator);
-    out << endpoint.host() << ":" << endpoint.port();
+
+    const bsl::string& brokerUri = d_sessionOptions.brokerUri();
+    if (brokerUri.starts_with(k_LOCAL_BROKER_URI_PREFIX)) {
+        // Colocated broker reachable through a local (Unix domain) socket,
+        // in the 'unix://<path>' format.
+        const bsl::string_view path = bsl::string_view(brokerUri).substr(
+            sizeof(k_LOCAL_BROKER_URI_PREFIX) - 1);
+        if (path.empty()) {
+            BALL_LOG_ERROR << id() << "Invalid brokerURI '" << brokerUri
+                           << "'";
+            return bmqt::GenericResult::e_INVALID_ARGUMENT;  // RETURN
+        }
+        out << "unix:" << path;
+    }
+    else {
+        bmqio::TCPEndpoint endpoint(brokerUri);
+        if (!endpoint) {
+            BALL_LOG_ERROR << id() << "Invalid brokerURI '" << brokerUri
+                           << "'";
+            return bmqt::GenericResult::e_INVALID_ARGUMENT;  // RETURN
+        }
+        out << endpoint.host() << ":" << endpoint.port();
+    }
 
     bsls::TimeInterval attemptInterval;
     attemptInterval.setTotalMilliseconds(k_RECONNECT_INTERVAL_MS);
@@ -717,6 +735,7 @@ Application::Application(
 , d_channelsStatContext_mp(d_rootStatContext.addSubcontext(
       bmqio::StatChannelFactoryUtil::statContextConfiguration("channels",
                                                               -1,
+                                                              false,
                                                               allocator)))
 , d_sessionOptions(sessionOptions, &d_allocator)
 , d_channelsTable(&d_allocator)
@@ -38,6 +38,7 @@
 #include <bmqimp_brokersession.h>
 #include <bmqimp_eventqueue.h>
 #include <bmqimp_negotiatedchannelfactory.h>
+#include <bmqp_sizeclassblobbufferfactory.h>
 #include <bmqt_sessionoptions.h>
 
 #include <bmqio_channel.h>
@@ -55,7 +56,6 @@
 
 // BDE
 #include <ball_log.h>
-#include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlmt_eventscheduler.h>
 #include <bsl_memory.h>
 #include <bslma_allocator.h>
@@ -124,8 +124,10 @@ class Application {
 
     bmqst::BasicTableInfoProvider d_channelsTip;
 
-    /// Factory for blob buffers
-    bdlbb::PooledBlobBufferFactory d_blobBufferFactory;
+    /// Factory for blob buffers, dispensing by default buffers of the
+    /// `blobBufferSize` of the session options, and smaller buffers to the
+    /// blob pools created for small messages.
+    bmqp::SizeClassBlobBufferFactory d_blobBufferFactory;
 
     /// Shared pointer to the pool of shared pointers to blobs.
     BlobSpPoolSp d_blobSpPool_sp;
@@ -20,6 +20,7 @@
 // BMQ
 #include <bmqimp_negotiatedchannelfactory.h>
 #include <bmqimp_queue.h>
+#include <bmqimp_unconfirmedwindow.h>
 #include <bmqio_channel.h>
 #include <bmqio_status.h>
 #include <bmqp_ackeventbuilder.h>
@@ -40,11 +41,13 @@
 #include <bmqt_resultcode.h>
 #include <bmqt_uri.h>
 #include <bmqu_blob.h>
+#include <bmqu_blobobjectproxy.h>
 #include <bmqu_memoutstream.h>
 #include <bmqu_printutil.h>
 #include <bmqu_time.h>
 
 // BDE
+#include <bdlbb_blobutil.h>
 #include <bdld_datum.h>
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
@@ -97,6 +100,10 @@ void setCurrentThreadNameOnce(const bsl::string& value)
 /// succeed.  The following defines how many bytes we provision for it.
 const int k_CONTROL_DATA_WATERMARK_EXTRA = 4 * 1024 * 1024;  // 4 MB
 
+/// Expected size of the ACK and CONFIRM events built by the session, used
+/// to select the size of the blob buffers of these events.
+const int k_CONTROL_EVENT_SIZE = 256;
+
 /// Upper-bound for the initial capacity of the event queue
 const int k_EVENTQUEUE_INITIAL_CAPACITY = 10 * 1000;
 
@@ -140,6 +147,10 @@ const int k_NON_BUFFERED_REQUEST_GROUP_ID = 0;
 const char k_ENQUEUE_ERROR_TEXT[] = "Failed to process the operation, the"
                                     " session is already being destroyed";
 
+/// Interval, in seconds, between two updates of the unconfirmed window of
+/// the queues opened with the `adaptiveUnconfirmed` option.
+const int k_UNCONFIRMED_WINDOW_UPDATE_INTERVAL = 1;
+
 /// Create an `Event` object at the specified `address` using the supplied
 /// `allocator`.  This is used by the ObjectPool.
 void poolCreateEvent(void*                     address,
@@ -156,6 +167,17 @@ void callbackAdapter(const bsl::function<void()>& f,
     f();
 }
 
+/// Report to the unconfirmed window of the specified `queue` the round trip
+/// of a request sent at the specified `sendTime`, if the window is tuned by
+/// the session.
+void reportRoundTrip(Queue* queue, bsls::Types::Int64 sendTime)
+{
+    if (sendTime != 0 && queue->options().adaptiveUnconfirmed()) {
+        queue->unconfirmedWindow().onRoundTrip(
+            bmqu::Time::highResolutionTimer() - sendTime);
+    }
+}
+
 void eventCallbackAdapter(bslmt::Semaphore*                   semaphore,
                           const bmqimp::Event::EventCallback& eventCallback,
                           const bsl::shared_ptr<Event>&       eventSp)
@@ -436,6 +458,8 @@ void BrokerSession::SessionFsm::setStarted(
     d_session.d_channel_sp->properties().load(
         &d_session.d_doConfigureStream,
         NegotiatedChannelFactory::k_CHANNEL_PROPERTY_CONFIGURE_STREAM);
+
+    d_session.setupUnconfirmedWindowTimer();
 }
 
 bmqt::GenericResult::Enum
@@ -549,6 +573,15 @@ void BrokerSession::SessionFsm::setStopped(FsmEvent::Enum event,
     d_session.d_scheduler_p->cancelEvent(
         &d_session.d_messageExpirationTimeoutHandle);
 
+    // Cancel the update of the unconfirmed windows
+    d_session.d_scheduler_p->cancelEvent(
+        &d_session.d_unconfirmedWindowTimeoutHandle);
+
+    // Discard the lingering PUT messages and confirmations, if any, and
+    // cancel their timers
+    d_session.clearPutBatch();
+    d_session.clearConfirmBatch();
+
     // The session is fully stopped, we can now reset its state to release any
     // references to objects (queues, ...) it may still hold.
     d_session.resetState();
@@ -814,8 +847,11 @@ void BrokerSession::SessionFsm::handleChannelDown()
 
     d_session.d_channel_sp.reset();
 
-    // Remove all pending blobs from the blob queue
+    // Remove all pending blobs from the blob queue, and the lingering PUT
+    // messages and confirmations
     d_session.d_extensionBlobBuffer.clear();
+    d_session.clearPutBatch();
+    d_session.clearConfirmBatch();
 
     {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_session.d_extensionBufferLock);
@@ -1350,6 +1386,25 @@ BrokerSession::QueueFsm::actionReconfigureQueue(
             queue->options().suspendsOnBadHostHealth());
     }
 
+    if (queue->options().adaptiveUnconfirmed()) {
+        options.setAdaptiveUnconfirmed(true);
+
+        // The broker is expected to use the unconfirmed window tuned by the
+        // session rather than the bounds specified in the options.
+        UnconfirmedWindow&        window = queue->unconfirmedWindow();
+        const bmqt::QueueOptions& bounds = queue->options();
+        if (window.isActive() &&
+            options.maxUnconfirmedMessages() ==
+                bsl::min(bounds.maxUnconfirmedMessages(),
+                         window.maxUnconfirmedMessages()) &&
+            options.maxUnconfirmedBytes() ==
+                bsl::min(bounds.maxUnconfirmedBytes(),
+                         window.maxUnconfirmedBytes())) {
+            options.setMaxUnconfirmedMessages(bounds.maxUnconfirmedMessages())
+                .setMaxUnconfirmedBytes(bounds.maxUnconfirmedBytes());
+        }
+    }
+
     if (queue->options() == options) {
         // No need to reconfigure
         return bmqt::ConfigureQueueResult::e_SUCCESS;  // RETURN
@@ -3211,6 +3266,15 @@ void BrokerSession::fsmThreadLoop()
         }
 
         const Event::EventType::Enum eventType = event->type();
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_pushBatchEvent_sp) &&
+            (eventType != Event::EventType::e_RAW ||
+             !event->rawEvent().isPushEvent())) {
+            // Deliver the pending PUSH messages before processing any other
+            // event, to preserve their ordering with ACKs and session events.
+            flushPushBatch();
+        }
+
         switch (eventType) {
         case Event::EventType::e_RAW: {
             processRawEvent(event->rawEvent());
@@ -3227,6 +3291,12 @@ void BrokerSession::fsmThreadLoop()
             BSLS_ASSERT_SAFE(false && "Unexpected FSM event");
         } break;
         }
+
+        if (d_pushBatchEvent_sp && d_fsmEventQueue.isEmpty()) {
+            // The burst of PUSH events is over, deliver the pending batch
+            // rather than waiting for more events.
+            flushPushBatch();
+        }
     }
 
     BALL_LOG_INFO << id() << "FSM thread terminated "
@@ -3474,7 +3544,12 @@ void BrokerSession::enableMessageRetransmission(
     BSLS_ASSERT_SAFE(putIter.isValid());
     BSLS_ASSERT_SAFE(!putIter.header().messageGUID().isUnset());
 
-    bdlbb::Blob appData(d_bufferFactory_p, d_allocator_p);
+    // The application data is copied into the item of the message in the
+    // CorrelationId container, so that the temporary blob can use a local
+    // allocator.
+    bdlma::LocalSequentialAllocator<512> localAllocator(d_allocator_p);
+
+    bdlbb::Blob appData(d_bufferFactory_p, &localAllocator);
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
             putIter.loadApplicationData(&appData) != 0)) {
@@ -3516,10 +3591,13 @@ void BrokerSession::processPutEvent(const bmqp::Event& event)
     bool readyToSend = isStarted() && (d_numPendingReopenQueues == 0);
 
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(readyToSend)) {
-        // Post the event.
-        bmqt::GenericResult::Enum res = writeOrBuffer(
-            *event.blob(),
-            d_sessionOptions.channelHighWatermark());
+        // Post the event, or add its messages to the batch of lingering PUT
+        // messages if PUT batching is enabled.
+        bmqt::GenericResult::Enum res =
+            d_sessionOptions.putBatchingLingerTime() > 0
+                ? batchPutEvent(event)
+                : writeOrBuffer(*event.blob(),
+                                d_sessionOptions.channelHighWatermark());
 
         if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
                 res != bmqt::GenericResult::e_SUCCESS)) {
@@ -3566,6 +3644,96 @@ void BrokerSession::processPutEvent(const bmqp::Event& event)
     }
 }
 
+bmqt::GenericResult::Enum
+BrokerSession::batchPutEvent(const bmqp::Event& event)
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    const bdlbb::Blob& blob     = *event.blob();
+    const int          maxBytes = d_sessionOptions.putBatchingMaxBytes();
+
+    bmqu::BlobObjectProxy<bmqp::EventHeader> eventHeader(
+        &blob,
+        -bmqp::EventHeader::k_MIN_HEADER_SIZE,
+        true,    // read
+        false);  // write
+    BSLS_ASSERT_SAFE(eventHeader.isSet());
+
+    const int headerSize = eventHeader->headerWords() *
+                           bmqp::Protocol::k_WORD_SIZE;
+
+    if (d_putBatch.length() != 0 &&
+        d_putBatch.length() + blob.length() - headerSize > maxBytes) {
+        // Do not grow the batch beyond the byte budget.
+        const bmqt::GenericResult::Enum res = flushPutBatch();
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                res != bmqt::GenericResult::e_SUCCESS)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return res;  // RETURN
+        }
+    }
+
+    if (d_putBatch.length() == 0) {
+        // Start a new batch, in the same way as 'bmqp::PutEventBuilder'.
+        d_putBatch.setLength(sizeof(bmqp::EventHeader));
+        new (d_putBatch.buffer(0).data())
+            bmqp::EventHeader(bmqp::EventType::e_PUT);
+    }
+
+    // Append the messages, sharing the buffers of the posted event.
+    bdlbb::BlobUtil::append(&d_putBatch, blob, headerSize);
+
+    if (d_putBatch.length() >= maxBytes) {
+        return flushPutBatch();  // RETURN
+    }
+
+    if (!d_putBatchTimeoutHandle) {
+        d_scheduler_p->scheduleEvent(
+            &d_putBatchTimeoutHandle,
+            bmqu::Time::nowMonotonicClock() +
+                d_sessionOptions.putBatchingLingerTime(),
+            bdlf::BindUtil::bind(&BrokerSession::onPutBatchTimeout, this));
+    }
+
+    return bmqt::GenericResult::e_SUCCESS;
+}
+
+bmqt::GenericResult::Enum BrokerSession::flushPutBatch()
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    d_scheduler_p->cancelEvent(&d_putBatchTimeoutHandle);
+
+    if (d_putBatch.length() == 0) {
+        return bmqt::GenericResult::e_SUCCESS;  // RETURN
+    }
+
+    // Take the batch out first, so that 'writeOrBuffer' sees no lingering
+    // messages.
+    bdlbb::Blob batch(d_bufferFactory_p, d_allocator_p);
+    batch.swap(d_putBatch);
+
+    bmqp::EventHeader& eh = *reinterpret_cast<bmqp::EventHeader*>(
+        batch.buffer(0).data());
+    eh.setLength(batch.length());
+
+    return writeOrBuffer(batch, d_sessionOptions.channelHighWatermark());
+}
+
+void BrokerSession::clearPutBatch()
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    d_scheduler_p->cancelEvent(&d_putBatchTimeoutHandle);
+    d_putBatch.removeAll();
+}
+
 void BrokerSession::processConfirmEvent(const bmqp::Event& event)
 {
     // executed by the FSM thread
@@ -3598,10 +3766,93 @@ void BrokerSession::processConfirmEvent(const bmqp::Event& event)
         return;  // RETURN
     }
 
+    if (d_sessionOptions.confirmBatchingLingerTime() > 0) {
+        // Add the confirmations to the batch of lingering confirmations.
+        batchConfirmEvent(event);
+        return;  // RETURN
+    }
+
     // Send the CONFIRM batch
     sendConfirm(event.sharedBlob(), msgCount);
 }
 
+void BrokerSession::batchConfirmEvent(const bmqp::Event& event)
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    const int maxMessages = d_sessionOptions.confirmBatchingMaxMessages();
+
+    bmqp::ConfirmMessageIterator confirmIter;
+    event.loadConfirmMessageIterator(&confirmIter);
+
+    while (confirmIter.next() == 1) {
+        const bmqp::ConfirmMessage& message = confirmIter.message();
+
+        bmqt::EventBuilderResult::Enum rc = d_confirmBatch.appendMessage(
+            message.queueId(),
+            message.subQueueId(),
+            message.messageGUID());
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                rc == bmqt::EventBuilderResult::e_EVENT_TOO_BIG)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            // Do not grow the batch beyond the protocol limit.
+            flushConfirmBatch();
+            rc = d_confirmBatch.appendMessage(message.queueId(),
+                                              message.subQueueId(),
+                                              message.messageGUID());
+        }
+        BSLS_ASSERT_SAFE(rc == bmqt::EventBuilderResult::e_SUCCESS);
+
+        if (d_confirmBatch.messageCount() >= maxMessages) {
+            flushConfirmBatch();
+        }
+    }
+
+    if (d_confirmBatch.messageCount() != 0 && !d_confirmBatchTimeoutHandle) {
+        d_scheduler_p->scheduleEvent(
+            &d_confirmBatchTimeoutHandle,
+            bmqu::Time::nowMonotonicClock() +
+                d_sessionOptions.confirmBatchingLingerTime(),
+            bdlf::BindUtil::bind(&BrokerSession::onConfirmBatchTimeout,
+                                 this));
+    }
+}
+
+void BrokerSession::flushConfirmBatch()
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    d_scheduler_p->cancelEvent(&d_confirmBatchTimeoutHandle);
+
+    const int msgCount = d_confirmBatch.messageCount();
+    if (msgCount == 0) {
+        return;  // RETURN
+    }
+
+    // Take the batch out first, so that 'writeOrBuffer' sees no lingering
+    // confirmations.
+    const bsl::shared_ptr<bdlbb::Blob> blob_sp = d_confirmBatch.blob();
+    d_confirmBatch.reset();
+
+    sendConfirm(blob_sp, msgCount);
+}
+
+void BrokerSession::clearConfirmBatch()
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    d_scheduler_p->cancelEvent(&d_confirmBatchTimeoutHandle);
+    if (d_confirmBatch.messageCount() != 0) {
+        d_confirmBatch.reset();
+    }
+}
+
 void BrokerSession::processPushEvent(const bmqp::Event& event)
 {
     // executed by the FSM thread
@@ -3645,6 +3896,23 @@ void BrokerSession::processPushEvent(const bmqp::Event& event)
         return;  // RETURN
     }
 
+    if (!hasMessageWithMultipleSubQueueIds &&
+        d_sessionOptions.pushBatchingMaxMessages() > 0) {
+        // Merge the event into the pending batch, delivered once the burst of
+        // PUSH events is over.
+        batchPushEvent(event, eventInfos, eventMessageCount);
+
+        // Update event stats
+        d_eventsStats.onEvent(EventsStatsEventType::e_PUSH,
+                              event.blob()->length(),
+                              eventMessageCount);
+        return;  // RETURN
+    }
+
+    // Deliver the pending batch first, if any, to preserve the ordering of
+    // the messages.
+    flushPushBatch();
+
     // Flatten event if needed
     if (hasMessageWithMultipleSubQueueIds) {
         // Need to flatten the PushEvent
@@ -3725,6 +3993,102 @@ void BrokerSession::processPushEvent(const bmqp::Event& event)
                           eventMessageCount);
 }
 
+void BrokerSession::batchPushEvent(const bmqp::Event&              event,
+                                   const QueueManager::EventInfos& eventInfos,
+                                   int                             messageCount)
+{
+    // executed by the FSM thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    const int maxMessages = d_sessionOptions.pushBatchingMaxMessages();
+    const int maxBytes    = d_sessionOptions.pushBatchingMaxBytes();
+
+    if (d_pushBatchEvent_sp &&
+        (d_pushBatchMessageCount + messageCount > maxMessages ||
+         d_pushBatchBlob_sp->length() + event.blob()->length() > maxBytes)) {
+        // Do not grow the batch beyond its budget.
+        flushPushBatch();
+    }
+
+    if (!d_pushBatchEvent_sp) {
+        d_pushBatchEvent_sp = createEvent();
+        d_pushBatchBlob_sp  = d_blobSpPool_p->getObject();
+    }
+
+    int rc = bmqp::EventUtil::appendPushEvent(d_pushBatchBlob_sp.get(),
+                                              event);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The batch cannot hold this event, deliver it and start a new one.
+        flushPushBatch();
+
+        d_pushBatchEvent_sp = createEvent();
+        d_pushBatchBlob_sp  = d_blobSpPool_p->getObject();
+
+        rc = bmqp::EventUtil::appendPushEvent(d_pushBatchBlob_sp.get(),
+                                              event);
+        BSLS_ASSERT_SAFE(rc == 0);
+    }
+
+    // Insert queues and contexts of the messages in the batch
+    for (QueueManager::EventInfos::const_iterator infoCiter =
+             eventInfos.begin();
+         infoCiter != eventInfos.end();
+         ++infoCiter) {
+        const bmqp::EventUtilEventInfo::Ids& sIds = infoCiter->d_ids;
+        for (bmqp::EventUtilEventInfo::Ids::const_iterator citer =
+                 sIds.begin();
+             citer != sIds.end();
+             ++citer) {
+            d_queueManager.observePushEvent(d_pushBatchEvent_sp.get(),
+                                            *citer);
+        }
+    }
+
+    d_pushBatchMessageCount += messageCount;
+
+    if (d_pushBatchMessageCount >= maxMessages ||
+        d_pushBatchBlob_sp->length() >= maxBytes) {
+        flushPushBatch();
+    }
+}
+
+void BrokerSession::flushPushBatch()
+{
+    // executed by the FSM thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    if (!d_pushBatchEvent_sp) {
+        return;  // RETURN
+    }
+
+    bsl::shared_ptr<Event> queueEvent;
+    queueEvent.swap(d_pushBatchEvent_sp);
+
+    const bmqp::Event rawEvent(d_pushBatchBlob_sp, d_allocator_p);
+    d_pushBatchBlob_sp.reset();
+    d_pushBatchMessageCount = 0;
+
+    queueEvent->configureAsMessageEvent(rawEvent);
+
+    // Dump if enabled
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            d_messageDumper.isEventDumpEnabled<bmqp::EventType::e_PUSH>())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BALL_LOG_INFO_BLOCK
+        {
+            d_messageDumper.dumpPushEvent(BALL_LOG_OUTPUT_STREAM,
+                                          queueEvent->rawEvent());
+        }
+    }
+
+    // Add to event queue
+    d_eventQueue.pushBack(queueEvent);
+}
+
 void BrokerSession::processAckEvent(const bmqp::Event& event)
 {
     // executed by the FSM thread
@@ -4263,7 +4627,8 @@ void BrokerSession::doHandlePendingPutExpirationTimeout(
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
 
-    bmqp::AckEventBuilder          ackBuilder(d_blobSpPool_p, d_allocator_p);
+    bmqp::AckEventBuilder          ackBuilder(d_controlBlobSpPool_sp.get(),
+                                              d_allocator_p);
     bsl::vector<bmqt::MessageGUID> expiredKeys(d_allocator_p);
     bsl::shared_ptr<Event>         ackEvent = createEvent();
     bsl::shared_ptr<Queue>         queueSp;
@@ -4296,6 +4661,116 @@ void BrokerSession::doHandlePendingPutExpirationTimeout(
     }
 }
 
+void BrokerSession::doHandlePutBatchTimeout(
+    BSLA_MAYBE_UNUSED const bsl::shared_ptr<Event>& eventSp)
+{
+    // executed by the FSM thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    // The batch may have been written or discarded since the timer fired, in
+    // which case there is nothing to do.
+    if (d_putBatch.length() == 0) {
+        return;  // RETURN
+    }
+
+    const bmqt::GenericResult::Enum res = flushPutBatch();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            res != bmqt::GenericResult::e_SUCCESS)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BALL_LOG_ERROR << id()
+                       << "Unable to post batched PUT event [reason: "
+                       << "'NOT_CONNECTED']";
+    }
+}
+
+void BrokerSession::doFlushConfirmBatch(
+    BSLA_MAYBE_UNUSED const bsl::shared_ptr<Event>& eventSp)
+{
+    // executed by the FSM thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    // The batch may have been written or discarded since the request was
+    // enqueued, in which case there is nothing to do.
+    if (d_confirmBatch.messageCount() == 0) {
+        return;  // RETURN
+    }
+
+    flushConfirmBatch();
+}
+
+void BrokerSession::doUpdateUnconfirmedWindows(
+    BSLA_MAYBE_UNUSED const bsl::shared_ptr<Event>& eventSp)
+{
+    // executed by the FSM thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    // The timer is scheduled again once the session is (re)started.
+    if (d_sessionFsm.state() != SessionFsm::State::e_STARTED) {
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 now = bmqu::Time::highResolutionTimer();
+
+    // Fetch list of all queues.
+    const int allocSize = 32 * sizeof(bsl::shared_ptr<Queue>);
+    bdlma::LocalSequentialAllocator<allocSize> localAllocator(d_allocator_p);
+    bsl::vector<bsl::shared_ptr<Queue> >       allQueues(&localAllocator);
+    d_queueManager.getAllQueues(&allQueues);
+
+    for (bsl::vector<bsl::shared_ptr<Queue> >::size_type idx = 0;
+         idx != allQueues.size();
+         ++idx) {
+        const bsl::shared_ptr<Queue>& queue   = allQueues[idx];
+        const bmqt::QueueOptions&     options = queue->options();
+
+        // Leave alone the queues whose stream parameters are being changed,
+        // the window is recomputed at the next update.
+        if (!options.adaptiveUnconfirmed() ||
+            queue->state() != QueueState::e_OPENED ||
+            !bmqt::QueueFlagsUtil::isReader(queue->flags()) ||
+            queue->isSuspended() ||
+            queue->pendingConfigureId() != Queue::k_INVALID_CONFIGURE_ID) {
+            continue;  // CONTINUE
+        }
+
+        UnconfirmedWindow& window = queue->unconfirmedWindow();
+        if (!window.update(now,
+                           options.maxUnconfirmedMessages(),
+                           options.maxUnconfirmedBytes())) {
+            continue;  // CONTINUE
+        }
+
+        BALL_LOG_INFO << id() << "Updating unconfirmed window [queue: "
+                      << queue->uri() << ", maxUnconfirmedMessages: "
+                      << window.maxUnconfirmedMessages()
+                      << ", maxUnconfirmedBytes: "
+                      << window.maxUnconfirmedBytes() << ", roundTripTime: "
+                      << bmqu::PrintUtil::prettyTimeInterval(
+                             window.roundTripTime())
+                      << "]";
+
+        const bmqt::ConfigureQueueResult::Enum rc = sendReconfigureRequest(
+            queue);
+        if (rc == bmqt::ConfigureQueueResult::e_SUCCESS) {
+            // Not an explicit request from the client, so do not cause any
+            // future client-initiated configureQueue to return error (see
+            // 'actionReconfigureQueue').
+            queue->setPendingConfigureId(Queue::k_INVALID_CONFIGURE_ID);
+        }
+        else {
+            BALL_LOG_WARN << id() << "Failed to update unconfirmed window "
+                          << "[queue: " << queue->uri() << ", rc: " << rc
+                          << "]";
+        }
+    }
+
+    setupUnconfirmedWindowTimer();
+}
+
 void BrokerSession::doHandleChannelWatermark(
     bmqio::ChannelWatermarkType::Enum type,
     BSLA_MAYBE_UNUSED const bsl::shared_ptr<Event>& eventSp)
@@ -4729,7 +5204,8 @@ void BrokerSession::cancelPendingMessages(
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
 
-    bmqp::AckEventBuilder  ackBuilder(d_blobSpPool_p, d_allocator_p);
+    bmqp::AckEventBuilder  ackBuilder(d_controlBlobSpPool_sp.get(),
+                                      d_allocator_p);
     bsl::shared_ptr<Event> ackEvent = createEvent();
 
     MessageCorrelationIdContainer::KeyIdsCb callback = bdlf::BindUtil::bindS(
@@ -5336,6 +5812,19 @@ BrokerSession::createConfigureQueueContext(const bsl::shared_ptr<Queue>& queue,
     }
     context->setGroupId(grId);
 
+    // Use the unconfirmed window tuned by the session, if any, within the
+    // bounds specified in the options.
+    int maxUnconfirmedMessages = options.maxUnconfirmedMessages();
+    int maxUnconfirmedBytes    = options.maxUnconfirmedBytes();
+    if (!isDeconfigure && options.adaptiveUnconfirmed() &&
+        queue->unconfirmedWindow().isActive()) {
+        const UnconfirmedWindow& window = queue->unconfirmedWindow();
+        maxUnconfirmedMessages = bsl::min(maxUnconfirmedMessages,
+                                          window.maxUnconfirmedMessages());
+        maxUnconfirmedBytes    = bsl::min(maxUnconfirmedBytes,
+                                       window.maxUnconfirmedBytes());
+    }
+
     if (d_doConfigureStream) {
         // Make ConfigureStream request
         bmqp_ctrlmsg::ConfigureStream& configureStream =
@@ -5368,13 +5857,13 @@ BrokerSession::createConfigureQueueContext(const bsl::shared_ptr<Queue>& queue,
                 ci.maxUnconfirmedMessages() = from.maxUnconfirmedMessages();
             }
             else {
-                ci.maxUnconfirmedMessages() = options.maxUnconfirmedMessages();
+                ci.maxUnconfirmedMessages() = maxUnconfirmedMessages;
             }
             if (from.hasMaxUnconfirmedBytes()) {
                 ci.maxUnconfirmedBytes() = from.maxUnconfirmedBytes();
             }
             else {
-                ci.maxUnconfirmedBytes() = options.maxUnconfirmedBytes();
+                ci.maxUnconfirmedBytes() = maxUnconfirmedBytes;
             }
             if (from.hasConsumerPriority()) {
                 ci.consumerPriority() = from.consumerPriority();
@@ -5437,8 +5926,8 @@ BrokerSession::createConfigureQueueContext(const bsl::shared_ptr<Queue>& queue,
         sqidInfo.subId() = queue->subQueueId();
     }
 
-    streamParams.maxUnconfirmedMessages() = options.maxUnconfirmedMessages();
-    streamParams.maxUnconfirmedBytes()    = options.maxUnconfirmedBytes();
+    streamParams.maxUnconfirmedMessages() = maxUnconfirmedMessages;
+    streamParams.maxUnconfirmedBytes()    = maxUnconfirmedBytes;
     streamParams.consumerPriority()       = options.consumerPriority();
 
     // Set consumerPriority and consumerPriorityCount
@@ -5670,6 +6159,25 @@ BrokerSession::writeOrBuffer(const bdlbb::Blob& eventBlob,
     bmqio::Status             status(d_allocator_p);
     bmqt::GenericResult::Enum res = bmqt::GenericResult::e_SUCCESS;
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_putBatch.length() != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Preserve the ordering with the lingering PUT messages.
+        res = flushPutBatch();
+        if (res != bmqt::GenericResult::e_SUCCESS) {
+            return res;  // RETURN
+        }
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            d_confirmBatch.messageCount() != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Preserve the ordering with the lingering confirmations, which must
+        // reach the broker before a subsequent close or configure request.
+        flushConfirmBatch();
+    }
+
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
             !d_extensionBlobBuffer.empty())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
@@ -5724,6 +6232,10 @@ BrokerSession::BrokerSession(
 , d_scheduler_p(scheduler)
 , d_bufferFactory_p(bufferFactory)
 , d_blobSpPool_p(blobSpPool_p)
+, d_controlBlobSpPool_sp(bmqp::BlobPoolUtil::createBlobPool(
+      bufferFactory,
+      k_CONTROL_EVENT_SIZE,
+      d_allocators.get("ControlBlobSpPool")))
 , d_channel_sp()
 , d_extensionBlobBuffer(allocator)
 , d_acceptRequests(false)
@@ -5780,6 +6292,14 @@ BrokerSession::BrokerSession(
 , d_inProgressEventHandlerCount(0)
 , d_isStopping(false)
 , d_messageExpirationTimeoutHandle()
+, d_putBatch(bufferFactory, allocator)
+, d_putBatchTimeoutHandle()
+, d_pushBatchEvent_sp()
+, d_pushBatchBlob_sp()
+, d_pushBatchMessageCount(0)
+, d_confirmBatch(d_controlBlobSpPool_sp.get(), allocator)
+, d_confirmBatchTimeoutHandle()
+, d_unconfirmedWindowTimeoutHandle()
 , d_nextRequestGroupId(k_NON_BUFFERED_REQUEST_GROUP_ID)
 , d_queueRetransmissionTimeoutMap(allocator)
 , d_nextInternalSubscriptionId(bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID)
@@ -5800,6 +6320,14 @@ BrokerSession::BrokerSession(
     // remain in sync to prevent misleading values.
     resetState();
 
+    if (d_usingSessionEventHandler) {
+        d_eventQueue.setOrderedPerQueueDispatch(
+            sessionOptions.orderedPerQueueDispatch());
+    }
+    else {
+        d_eventQueue.setSpinDuration(sessionOptions.nextEventSpinDuration());
+    }
+
     // Spawn the FSM thread
     bslmt::ThreadAttributes threadAttributes;
     threadAttributes.setThreadName("bmqFSMEvtQ");
@@ -6089,6 +6617,24 @@ void BrokerSession::onOpenQueueResponse(
             BSLS_ASSERT_SAFE(isMPsEx);
             queue->setOldStyle(false);
         }
+
+        int compressionAlgorithms;
+
+        if (d_channel_sp->properties().load(
+                &compressionAlgorithms,
+                NegotiatedChannelFactory::
+                    k_CHANNEL_PROPERTY_COMPRESSION_ALGORITHMS)) {
+            queue->setCompressionAlgorithms(compressionAlgorithms);
+        }
+
+        int isTraceContext;
+
+        if (d_channel_sp->properties().load(
+                &isTraceContext,
+                NegotiatedChannelFactory::k_CHANNEL_PROPERTY_TRACE_CONTEXT)) {
+            BSLS_ASSERT_SAFE(isTraceContext);
+            queue->setTraceContextSupported(true);
+        }
     }
 
     handleQueueFsmEvent(context,
@@ -6307,6 +6853,8 @@ void BrokerSession::onConfigureQueueResponse(
         // Successfully configured the stream.  Since there are no concurrent
         // configureQueue, can simply do nothing.
 
+        reportRoundTrip(queue.get(), context->sendTime());
+
         // Validation
 
         bmqp_ctrlmsg::ConfigureStream respAdaptor;
@@ -6647,18 +7195,10 @@ void BrokerSession::stopAsync()
     enqueueFsmEvent(queueEvent);
 }
 
-bsl::shared_ptr<Event>
-BrokerSession::nextEvent(const bsls::TimeInterval& timeout)
+bool BrokerSession::handlePoppedEvent(const bsl::shared_ptr<Event>& event)
 {
     // executed by one of the *APPLICATION* threads
 
-    // PRECONDITIONS
-    BSLS_ASSERT_SAFE(!d_usingSessionEventHandler &&
-                     "nextEvent() should be used without EventHandler");
-
-    const bsls::TimeInterval beginTime = bmqu::Time::nowMonotonicClock();
-    bsl::shared_ptr<Event>   event     = d_eventQueue.timedPopFront(timeout);
-
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
             event->type() == Event::EventType::e_SESSION &&
             event->sessionEventType() ==
@@ -6682,10 +7222,29 @@ BrokerSession::nextEvent(const bsls::TimeInterval& timeout)
 
     if (event->eventCallback()) {
         // This is a serialized SESSION event with a user-specified callback.
-        // Such events are invoked inplace for serialization, and after that we
-        // will try to pop the next event for the user if timeout has not
-        // expired.
+        // Such events are invoked inplace for serialization.
         event->eventCallback()(event);
+        return false;  // RETURN
+    }
+
+    return true;
+}
+
+bsl::shared_ptr<Event>
+BrokerSession::nextEvent(const bsls::TimeInterval& timeout)
+{
+    // executed by one of the *APPLICATION* threads
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!d_usingSessionEventHandler &&
+                     "nextEvent() should be used without EventHandler");
+
+    const bsls::TimeInterval beginTime = bmqu::Time::nowMonotonicClock();
+    bsl::shared_ptr<Event>   event     = d_eventQueue.timedPopFront(timeout);
+
+    if (!handlePoppedEvent(event)) {
+        // The event was consumed by its callback, we will try to pop the next
+        // event for the user if timeout has not expired.
 
         // Continue waiting for next event for the duration of the remaining
         // timeout (if any)
@@ -6711,6 +7270,26 @@ BrokerSession::nextEvent(const bsls::TimeInterval& timeout)
     return event;
 }
 
+int BrokerSession::tryNextEvent(bsl::shared_ptr<Event>* event)
+{
+    // executed by one of the *APPLICATION* threads
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!d_usingSessionEventHandler &&
+                     "tryNextEvent() should be used without EventHandler");
+    BSLS_ASSERT_SAFE(event);
+
+    bsl::shared_ptr<Event> poppedEvent;
+    do {
+        if (d_eventQueue.tryPopFront(&poppedEvent) != 0) {
+            return -1;  // RETURN
+        }
+    } while (!handlePoppedEvent(poppedEvent));
+
+    *event = poppedEvent;
+    return 0;
+}
+
 int BrokerSession::openQueue(const bsl::shared_ptr<Queue>& queue,
                              bsls::TimeInterval            timeout)
 {
@@ -7166,6 +7745,24 @@ void BrokerSession::setupPutExpirationTimer(const bsls::TimeInterval& timeout)
                              this));
 }
 
+void BrokerSession::setupUnconfirmedWindowTimer()
+{
+    // executed by the FSM thread
+
+    BSLS_ASSERT_SAFE(d_fsmThreadChecker.inSameThread());
+
+    // Cancel the pending update, if any, so that restarting the session does
+    // not schedule a second one.
+    d_scheduler_p->cancelEvent(&d_unconfirmedWindowTimeoutHandle);
+
+    d_scheduler_p->scheduleEvent(
+        &d_unconfirmedWindowTimeoutHandle,
+        bmqu::Time::nowMonotonicClock() +
+            bsls::TimeInterval(k_UNCONFIRMED_WINDOW_UPDATE_INTERVAL, 0),
+        bdlf::BindUtil::bind(&BrokerSession::onUnconfirmedWindowTimeout,
+                             this));
+}
+
 void BrokerSession::removePendingControlMessage(
     const RequestManagerType::RequestSp& context)
 {
@@ -7338,7 +7935,8 @@ int BrokerSession::confirmMessage(const bsl::shared_ptr<bmqimp::Queue>& queue,
     }
 
     // Build event
-    bmqp::ConfirmEventBuilder      builder(d_blobSpPool_p, d_allocator_p);
+    bmqp::ConfirmEventBuilder      builder(d_controlBlobSpPool_sp.get(),
+                                           d_allocator_p);
     bmqt::EventBuilderResult::Enum rc =
         builder.appendMessage(queue->id(), queue->subQueueId(), messageId);
 
@@ -7411,6 +8009,28 @@ int BrokerSession::confirmMessages(
     return bmqt::GenericResult::e_SUCCESS;
 }
 
+int BrokerSession::flushConfirms()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_acceptRequests)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        BALL_LOG_ERROR << id() << "Unable to flush confirm messages "
+                       << "[reason: 'SESSION_STOPPED']";
+
+        return bmqt::GenericResult::e_NOT_CONNECTED;  // RETURN
+    }
+
+    // Confirmations accepted before this call are ahead of this request in
+    // the FSM queue, and are therefore part of the flushed batch.
+    bsl::shared_ptr<Event> event = createEvent();
+    event->configureAsRequestEvent(
+        bdlf::BindUtil::bind(&BrokerSession::doFlushConfirmBatch,
+                             this,
+                             bdlf::PlaceHolders::_1));  // eventImpl
+
+    return enqueueFsmEvent(event);
+}
+
 void BrokerSession::postToFsm(const bsl::function<void()>& f)
 {
     // PRECONDITIONS
@@ -7494,6 +8114,42 @@ void BrokerSession::onPendingPutExpirationTimeout()
     enqueueFsmEvent(event);
 }
 
+void BrokerSession::onPutBatchTimeout()
+{
+    // executed by the *SCHEDULER* thread
+
+    bsl::shared_ptr<Event> event = createEvent();
+    event->configureAsRequestEvent(
+        bdlf::BindUtil::bind(&BrokerSession::doHandlePutBatchTimeout,
+                             this,
+                             bdlf::PlaceHolders::_1));  // eventImpl
+    enqueueFsmEvent(event);
+}
+
+void BrokerSession::onConfirmBatchTimeout()
+{
+    // executed by the *SCHEDULER* thread
+
+    bsl::shared_ptr<Event> event = createEvent();
+    event->configureAsRequestEvent(
+        bdlf::BindUtil::bind(&BrokerSession::doFlushConfirmBatch,
+                             this,
+                             bdlf::PlaceHolders::_1));  // eventImpl
+    enqueueFsmEvent(event);
+}
+
+void BrokerSession::onUnconfirmedWindowTimeout()
+{
+    // executed by the *SCHEDULER* thread
+
+    bsl::shared_ptr<Event> event = createEvent();
+    event->configureAsRequestEvent(
+        bdlf::BindUtil::bind(&BrokerSession::doUpdateUnconfirmedWindows,
+                             this,
+                             bdlf::PlaceHolders::_1));  // eventImpl
+    enqueueFsmEvent(event);
+}
+
 void BrokerSession::handleChannelWatermark(
     bmqio::ChannelWatermarkType::Enum type)
 {
@@ -7522,9 +8178,10 @@ void BrokerSession::printStats(bsl::ostream& stream, bool includeDelta) const
 }
 
 void BrokerSession::processDumpCommand(
-    const bmqp_ctrlmsg::DumpMessages& command)
+    const bmqp_ctrlmsg::DumpMessages& command,
+    int                               sampleEvery)
 {
-    d_messageDumper.processDumpCommand(command);
+    d_messageDumper.processDumpCommand(command, sampleEvery);
 }
 
 bool BrokerSession::_synchronize()
@@ -39,6 +39,7 @@
 #include <bmqimp_sessionid.h>
 #include <bmqimp_stat.h>
 #include <bmqp_ackeventbuilder.h>
+#include <bmqp_confirmeventbuilder.h>
 #include <bmqp_ctrlmsg_messages.h>
 #include <bmqp_queueid.h>
 #include <bmqp_requestmanager.h>
@@ -746,6 +747,11 @@ class BrokerSession BSLS_CPP11_FINAL {
     /// Pool of shared pointers to blobs.  Held, not owned.
     BlobSpPool* d_blobSpPool_p;
 
+    /// Pool of shared pointers to blobs used to build the small ACK and
+    /// CONFIRM events, using the smallest fitting size class of
+    /// `d_bufferFactory_p` if it is a `bmqp::SizeClassBlobBufferFactory`.
+    bmqp::BlobPoolUtil::BlobSpPoolSp d_controlBlobSpPool_sp;
+
     bsl::shared_ptr<bmqio::Channel> d_channel_sp;
     // Channel to use for communication,
     // held not owned
@@ -892,6 +898,51 @@ class BrokerSession BSLS_CPP11_FINAL {
     // Timer Event handle for pending PUT
     // messages' expiration timeout
 
+    bdlbb::Blob d_putBatch;
+    // PUT event being built by coalescing
+    // the messages of posted PUT events,
+    // if PUT batching is enabled, or
+    // empty if there is no lingering PUT
+    // message
+
+    bdlmt::EventScheduler::EventHandle d_putBatchTimeoutHandle;
+    // Timer Event handle for the linger
+    // time of 'd_putBatch'
+
+    bsl::shared_ptr<Event> d_pushBatchEvent_sp;
+    // Message event being built by merging
+    // consecutive PUSH events received
+    // from the broker, if PUSH batching is
+    // enabled, or null if there is no
+    // pending PUSH message.  Its queues and
+    // contexts are populated as events are
+    // merged, and it is configured with
+    // 'd_pushBatchBlob_sp' when delivered
+
+    bsl::shared_ptr<bdlbb::Blob> d_pushBatchBlob_sp;
+    // PUSH event holding the messages of
+    // the merged PUSH events
+
+    int d_pushBatchMessageCount;
+    // Number of messages in
+    // 'd_pushBatchBlob_sp'
+
+    bmqp::ConfirmEventBuilder d_confirmBatch;
+    // CONFIRM event being built by
+    // coalescing the confirmations of
+    // posted CONFIRM events, if CONFIRM
+    // batching is enabled
+
+    bdlmt::EventScheduler::EventHandle d_confirmBatchTimeoutHandle;
+    // Timer Event handle for the linger
+    // time of 'd_confirmBatch'
+
+    bdlmt::EventScheduler::EventHandle d_unconfirmedWindowTimeoutHandle;
+    // Timer Event handle for the periodic
+    // update of the unconfirmed window of
+    // the queues opened with the
+    // 'adaptiveUnconfirmed' option
+
     int d_nextRequestGroupId;
     // Id of the next request group to
     // use
@@ -999,16 +1050,66 @@ class BrokerSession BSLS_CPP11_FINAL {
     /// method gets called each time a new put event is poseted by the user.
     void processPutEvent(const bmqp::Event& event);
 
+    /// Append the messages of the specified PUT `event` to the batch of
+    /// lingering PUT messages, and write the batch into the channel if it
+    /// reaches the byte budget configured in the session options.  Return
+    /// success status or error code in case of write failure.
+    bmqt::GenericResult::Enum batchPutEvent(const bmqp::Event& event);
+
+    /// Write the batch of lingering PUT messages, if any, into the channel
+    /// as a single PUT event, and cancel its linger timer.  Return success
+    /// status or error code in case of write failure.
+    bmqt::GenericResult::Enum flushPutBatch();
+
+    /// Discard the batch of lingering PUT messages, if any, and cancel its
+    /// linger timer.
+    void clearPutBatch();
+
+    /// Handle the specified `event` popped out of the event queue by one of
+    /// the APPLICATION threads: re-enqueue it if it is the DISCONNECTED
+    /// event, so that it is also seen by the other application threads,
+    /// and invoke its callback, if any.  Return `true` if `event` has to be
+    /// returned to the application, and `false` if it was consumed by its
+    /// callback.
+    bool handlePoppedEvent(const bsl::shared_ptr<Event>& event);
+
     /// Process the confirm event represented by the specified `event`.
     /// This method gets called each time a new confirm event is poseted by
     /// the user.
     void processConfirmEvent(const bmqp::Event& event);
 
+    /// Append the confirmations of the specified CONFIRM `event` to the
+    /// batch of lingering confirmations, and write the batch into the
+    /// channel each time it reaches the number of confirmations configured
+    /// in the session options.
+    void batchConfirmEvent(const bmqp::Event& event);
+
+    /// Write the batch of lingering confirmations, if any, into the channel
+    /// as a single CONFIRM event, and cancel its linger timer.
+    void flushConfirmBatch();
+
+    /// Discard the batch of lingering confirmations, if any, and cancel its
+    /// linger timer.
+    void clearConfirmBatch();
+
     /// Process the push event represented by the specified `event`.  This
     /// method gets called each time a new push event (received from the
     /// broker) is available on the channel.
     void processPushEvent(const bmqp::Event& event);
 
+    /// Merge the messages of the specified PUSH `event`, having the
+    /// specified `messageCount` messages described by the specified
+    /// `eventInfos`, into the pending batch of PUSH messages, and deliver
+    /// the batch to the event queue if it reaches the budget configured in
+    /// the session options.
+    void batchPushEvent(const bmqp::Event&              event,
+                        const QueueManager::EventInfos& eventInfos,
+                        int                             messageCount);
+
+    /// Deliver the pending batch of PUSH messages, if any, to the event
+    /// queue as a single message event.
+    void flushPushBatch();
+
     /// Process the ack event represented by the specified `event`.  This
     /// method gets called each time a new ack event (received from the
     /// broker) is available on the channel.
@@ -1375,6 +1476,24 @@ class BrokerSession BSLS_CPP11_FINAL {
     void
     doHandlePendingPutExpirationTimeout(const bsl::shared_ptr<Event>& eventSp);
 
+    /// Invoked from the FSM thread as a handler to the PUT batch linger
+    /// timeout event specified as `eventSp` and sent by the scheduler
+    /// thread.
+    void doHandlePutBatchTimeout(const bsl::shared_ptr<Event>& eventSp);
+
+    /// Invoked from the FSM thread as a handler to the specified `eventSp`
+    /// sent either by the scheduler thread when the linger time of the
+    /// batch of confirmations elapses, or by an application thread calling
+    /// `flushConfirms`.
+    void doFlushConfirmBatch(const bsl::shared_ptr<Event>& eventSp);
+
+    /// Invoked from the FSM thread as a handler to the unconfirmed window
+    /// update event specified as `eventSp` and sent by the scheduler
+    /// thread.  Reconfigure the opened reader queues having the
+    /// `adaptiveUnconfirmed` option whose unconfirmed window changed
+    /// significantly, and schedule the next update.
+    void doUpdateUnconfirmedWindows(const bsl::shared_ptr<Event>& eventSp);
+
     /// Invoked from the FSM thread as a handler to the channel watermark
     /// event specified as `eventSp` with the specified watermark `type`
     /// sent by the IO thread.
@@ -1481,6 +1600,9 @@ class BrokerSession BSLS_CPP11_FINAL {
 
     void setupPutExpirationTimer(const bsls::TimeInterval& timeout);
 
+    /// Schedule the next update of the unconfirmed windows of the queues.
+    void setupUnconfirmedWindowTimer();
+
     void
     removePendingControlMessage(const RequestManagerType::RequestSp& context);
 
@@ -1577,6 +1699,13 @@ class BrokerSession BSLS_CPP11_FINAL {
     bsl::shared_ptr<bmqimp::Event>
     nextEvent(const bsls::TimeInterval& timeout);
 
+    /// Load into the specified `event` the next event and return 0 if one
+    /// is available, or return a non-zero value and leave `event` untouched
+    /// if the event queue is empty.  This method never blocks.
+    ///
+    /// THREAD: This method is called from one of the APPLICATION threads.
+    int tryNextEvent(bsl::shared_ptr<bmqimp::Event>* event);
+
     int openQueue(const bsl::shared_ptr<Queue>& queue,
                   bsls::TimeInterval            timeout);
 
@@ -1628,6 +1757,11 @@ class BrokerSession BSLS_CPP11_FINAL {
 
     int confirmMessages(const bsl::shared_ptr<const bdlbb::Blob>& blob_sp);
 
+    /// Asynchronously write the confirmations held for batching, if any,
+    /// into the channel.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    int flushConfirms();
+
     void postToFsm(const bsl::function<void()>& f);
 
     void enqueueSessionEvent(
@@ -1648,8 +1782,21 @@ class BrokerSession BSLS_CPP11_FINAL {
     /// Invoked when pending PUT expiration timeout fires.
     void onPendingPutExpirationTimeout();
 
-    /// Process the specified dump `command`.
-    void processDumpCommand(const bmqp_ctrlmsg::DumpMessages& command);
+    /// Invoked when the linger time of the batch of PUT messages elapses.
+    void onPutBatchTimeout();
+
+    /// Invoked when the linger time of the batch of confirmations elapses.
+    void onConfirmBatchTimeout();
+
+    /// Invoked when the unconfirmed windows of the queues are due for an
+    /// update.
+    void onUnconfirmedWindowTimeout();
+
+    /// Process the specified dump `command`, dumping only one out of every
+    /// optionally specified `sampleEvery` messages (every message by
+    /// default).  The behavior is undefined unless `1 <= sampleEvery`.
+    void processDumpCommand(const bmqp_ctrlmsg::DumpMessages& command,
+                            int                               sampleEvery = 1);
 
     /// Put empty event into the FSM queue.  Return true if the event is
     /// accepted and handled in the FSM thread, false otherwise.  Used for
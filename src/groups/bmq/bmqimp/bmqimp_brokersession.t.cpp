@@ -22,12 +22,15 @@
 #include <bmqp_ackeventbuilder.h>
 #include <bmqp_blobpoolutil.h>
 #include <bmqp_confirmeventbuilder.h>
+#include <bmqp_confirmmessageiterator.h>
 #include <bmqp_conversionutil.h>
 #include <bmqp_crc32c.h>
 #include <bmqp_ctrlmsg_messages.h>
 #include <bmqp_event.h>
 #include <bmqp_messageguidgenerator.h>
 #include <bmqp_protocol.h>
+#include <bmqp_pusheventbuilder.h>
+#include <bmqp_pushmessageiterator.h>
 #include <bmqp_puteventbuilder.h>
 #include <bmqp_queueid.h>
 #include <bmqp_schemaeventbuilder.h>
@@ -46,6 +49,7 @@
 #include <bmqu_time.h>
 
 // BDE
+#include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlcc_deque.h>
 #include <bdlf_memfn.h>
@@ -3774,6 +3778,11 @@ static void test11_disconnect()
                          bmqt::SessionEventType::e_CONNECTED);
         PV_SAFE("Channel connected!");
 
+        // No more event is available
+        event.reset();
+        BMQTST_ASSERT_NE(obj.tryNextEvent(&event), 0);
+        BMQTST_ASSERT(!event);
+
         // Stop the session
         PVV_SAFE("Stopping session...");
         obj.stopAsync();
@@ -3826,6 +3835,13 @@ static void test11_disconnect()
                              bmqt::SessionEventType::e_DISCONNECTED);
         }
 
+        // 'tryNextEvent' also returns the DISCONNECTED event
+        event.reset();
+        BMQTST_ASSERT_EQ(obj.tryNextEvent(&event), 0);
+        BMQTST_ASSERT(event);
+        BMQTST_ASSERT_EQ(event->sessionEventType(),
+                         bmqt::SessionEventType::e_DISCONNECTED);
+
         BMQTST_ASSERT_EQ(startCounter, 2);
         // Ensure stateCb was called
         BMQTST_ASSERT_EQ(stopCounter, 2);
@@ -9751,6 +9767,420 @@ static void test68_queueLateAsyncCanceledHybrid3()
                            bmqimp::QueueState::e_PENDING);
 }
 
+static void test71_putBatching()
+// ------------------------------------------------------------------------
+// PUT BATCHING
+//
+// Concerns:
+//   1. When PUT batching is enabled, the messages of consecutive posted
+//      PUT events are written to the channel as a single PUT event, in
+//      order.
+//   2. The batch is written when its linger time elapses, when it reaches
+//      the byte budget, or before any other event is written.
+//
+// Plan:
+//   1. Create bmqimp::BrokerSession test wrapper object with PUT batching
+//      enabled, start the session and open a queue.
+//   2. Post two PUT events and verify nothing is written until the linger
+//      time elapses, and then a single PUT event with both messages.
+//   3. Post PUT events up to the byte budget and verify a single PUT event
+//      is written without advancing the time.
+//   4. Post one PUT event, stop the session, and verify the PUT event is
+//      written before the disconnect request.
+//
+// Testing manipulators:
+//   - post
+//   ----------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PUT BATCHING");
+
+    const char*              k_PAYLOAD     = "abcdefghijklmnopqrstuvwxyz";
+    const int                k_PAYLOAD_LEN = bsl::strlen(k_PAYLOAD);
+    const bsls::TimeInterval k_LINGER_TIME(1);
+    const bsls::TimeInterval timeout = bsls::TimeInterval(5);
+
+    bmqt::SessionOptions  sessionOptions;
+    bmqt::QueueOptions    queueOptions;
+    bdlmt::EventScheduler scheduler(bsls::SystemClockType::e_MONOTONIC,
+                                    bmqtst::TestHelperUtil::allocator());
+    TestClock             testClock(scheduler);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+    bmqp::PutEventBuilder builder(blobSpPool.get(),
+                                  bmqtst::TestHelperUtil::allocator());
+
+    // Size of a single message in a PUT event
+    builder.startMessage();
+    builder.setMessagePayload(k_PAYLOAD, k_PAYLOAD_LEN)
+        .setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+    BMQTST_ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS,
+                     builder.packMessage(0));
+
+    const int k_HEADER_SIZE  = sizeof(bmqp::EventHeader);
+    const int k_MESSAGE_SIZE = builder.eventSize() - k_HEADER_SIZE;
+    const int k_MAX_BYTES    = k_HEADER_SIZE + 3 * k_MESSAGE_SIZE;
+
+    sessionOptions.setNumProcessingThreads(1)
+        .configurePutBatching(k_LINGER_TIME, k_MAX_BYTES);
+
+    TestSession obj(sessionOptions,
+                    testClock,
+                    bmqtst::TestHelperUtil::allocator());
+
+    bsl::shared_ptr<bmqimp::Queue> pQueue =
+        obj.createQueue(k_URI, bmqt::QueueFlags::e_WRITE, queueOptions);
+
+    PVV_SAFE("Step 1. Start the session and open the queue");
+    obj.startAndConnect();
+    obj.openQueue(pQueue, timeout);
+
+    bsl::vector<bmqt::MessageGUID> guids(bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < 6; ++i) {
+        guids.push_back(bmqp::MessageGUIDGenerator::testGUID());
+    }
+
+    bmqp::PutMessageIterator putIter(&bufferFactory,
+                                     bmqtst::TestHelperUtil::allocator());
+    bmqp::Event              rawEvent(bmqtst::TestHelperUtil::allocator());
+
+    PVV_SAFE("Step 2. Post two PUT events and wait for the linger time");
+    for (int i = 0; i < 2; ++i) {
+        builder.reset();
+        builder.startMessage();
+        builder.setMessagePayload(k_PAYLOAD, k_PAYLOAD_LEN)
+            .setMessageGUID(guids[i]);
+        BMQTST_ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS,
+                         builder.packMessage(pQueue->id()));
+        BMQTST_ASSERT_EQ(bmqt::PostResult::e_SUCCESS,
+                         obj.session().post(builder.blob()));
+    }
+
+    BMQTST_ASSERT(obj.session()._synchronize());
+    BMQTST_ASSERT(obj.isChannelEmpty());
+
+    obj.advanceTime(k_LINGER_TIME);
+
+    obj.getOutboundEvent(&rawEvent);
+    BMQTST_ASSERT(rawEvent.isPutEvent());
+
+    rawEvent.loadPutMessageIterator(&putIter, true);
+    BMQTST_ASSERT(putIter.isValid());
+    BMQTST_ASSERT_EQ(1, putIter.next());
+    BMQTST_ASSERT_EQ(guids[0], putIter.header().messageGUID());
+    BMQTST_ASSERT_EQ(1, putIter.next());
+    BMQTST_ASSERT_EQ(guids[1], putIter.header().messageGUID());
+    BMQTST_ASSERT_EQ(0, putIter.next());
+
+    PVV_SAFE("Step 3. Post PUT events up to the byte budget");
+    for (int i = 2; i < 5; ++i) {
+        builder.reset();
+        builder.startMessage();
+        builder.setMessagePayload(k_PAYLOAD, k_PAYLOAD_LEN)
+            .setMessageGUID(guids[i]);
+        BMQTST_ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS,
+                         builder.packMessage(pQueue->id()));
+        BMQTST_ASSERT_EQ(bmqt::PostResult::e_SUCCESS,
+                         obj.session().post(builder.blob()));
+    }
+
+    rawEvent.clear();
+    obj.getOutboundEvent(&rawEvent);
+    BMQTST_ASSERT(rawEvent.isPutEvent());
+    BMQTST_ASSERT_EQ(k_MAX_BYTES, rawEvent.blob()->length());
+
+    rawEvent.loadPutMessageIterator(&putIter, true);
+    BMQTST_ASSERT(putIter.isValid());
+    for (int i = 2; i < 5; ++i) {
+        BMQTST_ASSERT_EQ_D(i, 1, putIter.next());
+        BMQTST_ASSERT_EQ_D(i, guids[i], putIter.header().messageGUID());
+    }
+    BMQTST_ASSERT_EQ(0, putIter.next());
+
+    PVV_SAFE("Step 4. Post a PUT event and stop the session");
+    builder.reset();
+    builder.startMessage();
+    builder.setMessagePayload(k_PAYLOAD, k_PAYLOAD_LEN)
+        .setMessageGUID(guids[5]);
+    BMQTST_ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS,
+                     builder.packMessage(pQueue->id()));
+    BMQTST_ASSERT_EQ(bmqt::PostResult::e_SUCCESS,
+                     obj.session().post(builder.blob()));
+
+    BMQTST_ASSERT(obj.session()._synchronize());
+    BMQTST_ASSERT(obj.isChannelEmpty());
+
+    obj.session().stopAsync();
+
+    // The lingering PUT message is written before the disconnect request.
+    rawEvent.clear();
+    obj.getOutboundEvent(&rawEvent);
+    BMQTST_ASSERT(rawEvent.isPutEvent());
+
+    rawEvent.loadPutMessageIterator(&putIter, true);
+    BMQTST_ASSERT(putIter.isValid());
+    BMQTST_ASSERT_EQ(1, putIter.next());
+    BMQTST_ASSERT_EQ(guids[5], putIter.header().messageGUID());
+    BMQTST_ASSERT_EQ(0, putIter.next());
+
+    bmqp_ctrlmsg::ControlMessage disconnectMessage(
+        bmqtst::TestHelperUtil::allocator());
+    obj.getOutboundControlMessage(&disconnectMessage);
+    BMQTST_ASSERT(disconnectMessage.choice().isDisconnectValue());
+
+    bmqp_ctrlmsg::ControlMessage disconnectResponseMessage(
+        bmqtst::TestHelperUtil::allocator());
+    disconnectResponseMessage.rId().makeValue(disconnectMessage.rId().value());
+    disconnectResponseMessage.choice().makeDisconnectResponse();
+
+    obj.sendControlMessage(disconnectResponseMessage);
+
+    BMQTST_ASSERT(obj.waitForChannelClose());
+    BMQTST_ASSERT(obj.waitDisconnectedEvent());
+    BMQTST_ASSERT(obj.verifySessionIsStopped());
+}
+
+static void test72_pushBatching()
+// ------------------------------------------------------------------------
+// PUSH BATCHING
+//
+// Concerns:
+//   1. When PUSH batching is enabled, the messages of consecutive PUSH
+//      events received from the broker are delivered in order, in message
+//      events holding no more messages than the configured budget.
+//   2. No message is held back once no more PUSH event is available.
+//
+// Plan:
+//   1. Create bmqimp::BrokerSession test wrapper object with PUSH batching
+//      enabled, start the session and open a reader queue.
+//   2. Receive three PUSH events of one message from the broker.
+//   3. Verify the three messages are delivered in order, in at least two
+//      message events of at most two messages.
+//
+// Testing manipulators:
+//   - processPacket
+//   ----------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("PUSH BATCHING");
+
+    const char*              k_PAYLOAD      = "abcdefghijklmnopqrstuvwxyz";
+    const int                k_PAYLOAD_LEN  = bsl::strlen(k_PAYLOAD);
+    const int                k_MAX_MESSAGES = 2;
+    const int                k_NUM_MESSAGES = 3;
+    const bsls::TimeInterval timeout        = bsls::TimeInterval(5);
+
+    bmqt::SessionOptions  sessionOptions;
+    bmqt::QueueOptions    queueOptions;
+    bdlmt::EventScheduler scheduler(bsls::SystemClockType::e_MONOTONIC,
+                                    bmqtst::TestHelperUtil::allocator());
+    TestClock             testClock(scheduler);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+
+    sessionOptions.setNumProcessingThreads(1).configurePushBatching(
+        k_MAX_MESSAGES,
+        bmqt::SessionOptions::k_PUSH_BATCHING_DEFAULT_MAX_BYTES);
+
+    TestSession obj(sessionOptions,
+                    testClock,
+                    bmqtst::TestHelperUtil::allocator());
+
+    bsl::shared_ptr<bmqimp::Queue> pQueue =
+        obj.createQueue(k_URI, bmqt::QueueFlags::e_READ, queueOptions);
+
+    PVV_SAFE("Step 1. Start the session and open the queue");
+    obj.startAndConnect();
+    obj.openQueue(pQueue, timeout);
+
+    PVV_SAFE("Step 2. Receive PUSH events");
+    bmqp::PushEventBuilder builder(&obj.blobSpPool(),
+                                   bmqtst::TestHelperUtil::allocator());
+
+    bsl::vector<bmqt::MessageGUID> guids(bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_NUM_MESSAGES; ++i) {
+        guids.push_back(bmqp::MessageGUIDGenerator::testGUID());
+
+        bdlbb::Blob payload(&bufferFactory,
+                            bmqtst::TestHelperUtil::allocator());
+        bdlbb::BlobUtil::append(&payload, k_PAYLOAD, k_PAYLOAD_LEN);
+
+        builder.reset();
+        BMQTST_ASSERT_EQ(bmqt::EventBuilderResult::e_SUCCESS,
+                         builder.packMessage(
+                             payload,
+                             pQueue->id(),
+                             guids[i],
+                             0,
+                             bmqt::CompressionAlgorithmType::e_NONE));
+
+        obj.session().processPacket(builder.blob());
+    }
+
+    PVV_SAFE("Step 3. Verify the delivered message events");
+    int numEvents   = 0;
+    int numMessages = 0;
+    while (numMessages < k_NUM_MESSAGES) {
+        bsl::shared_ptr<bmqimp::Event> event = obj.getInboundEvent();
+        BMQTST_ASSERT(event);
+        BMQTST_ASSERT_EQ(event->type(), bmqimp::Event::EventType::e_MESSAGE);
+        BMQTST_ASSERT(event->rawEvent().isPushEvent());
+
+        ++numEvents;
+
+        bmqp::PushMessageIterator* pushIter = event->pushMessageIterator();
+        int                        count    = 0;
+        while (pushIter->next() == 1) {
+            BMQTST_ASSERT_LT(numMessages, k_NUM_MESSAGES);
+            BMQTST_ASSERT_EQ_D(numMessages,
+                               guids[numMessages],
+                               pushIter->header().messageGUID());
+            ++count;
+            ++numMessages;
+        }
+        BMQTST_ASSERT_LE(count, k_MAX_MESSAGES);
+        BMQTST_ASSERT_EQ(count, event->numCorrrelationIds());
+    }
+    BMQTST_ASSERT_EQ(numMessages, k_NUM_MESSAGES);
+    BMQTST_ASSERT_GE(numEvents, 2);
+
+    obj.stopGracefully();
+}
+
+static void test73_confirmBatching()
+// ------------------------------------------------------------------------
+// CONFIRM BATCHING
+//
+// Concerns:
+//   1. When CONFIRM batching is enabled, the confirmations of consecutive
+//      'confirmMessage' calls are written to the channel as a single
+//      CONFIRM event, in order.
+//   2. The batch is written when its linger time elapses, when it holds
+//      the configured number of confirmations, or upon 'flushConfirms'.
+//
+// Plan:
+//   1. Create bmqimp::BrokerSession test wrapper object with CONFIRM
+//      batching enabled, start the session and open a reader queue.
+//   2. Confirm two messages and verify nothing is written until the linger
+//      time elapses, and then a single CONFIRM event with both messages.
+//   3. Confirm messages up to the budget and verify a single CONFIRM event
+//      is written without advancing the time.
+//   4. Confirm one message, call 'flushConfirms', and verify a CONFIRM
+//      event is written without advancing the time.
+//
+// Testing manipulators:
+//   - confirmMessage
+//   - flushConfirms
+//   ----------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("CONFIRM BATCHING");
+
+    const int                k_MAX_MESSAGES = 3;
+    const bsls::TimeInterval k_LINGER_TIME(1);
+    const bsls::TimeInterval timeout = bsls::TimeInterval(5);
+
+    bmqt::SessionOptions  sessionOptions;
+    bmqt::QueueOptions    queueOptions;
+    bdlmt::EventScheduler scheduler(bsls::SystemClockType::e_MONOTONIC,
+                                    bmqtst::TestHelperUtil::allocator());
+    TestClock             testClock(scheduler);
+
+    sessionOptions.setNumProcessingThreads(1)
+        .configureConfirmBatching(k_LINGER_TIME, k_MAX_MESSAGES);
+
+    TestSession obj(sessionOptions,
+                    testClock,
+                    bmqtst::TestHelperUtil::allocator());
+
+    bsl::shared_ptr<bmqimp::Queue> pQueue =
+        obj.createQueue(k_URI, bmqt::QueueFlags::e_READ, queueOptions);
+
+    PVV_SAFE("Step 1. Start the session and open the queue");
+    obj.startAndConnect();
+    obj.openQueue(pQueue, timeout);
+
+    bsl::vector<bmqt::MessageGUID> guids(bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < 6; ++i) {
+        guids.push_back(bmqp::MessageGUIDGenerator::testGUID());
+    }
+
+    bmqp::ConfirmMessageIterator confirmIter;
+    bmqp::Event                  rawEvent(bmqtst::TestHelperUtil::allocator());
+
+    PVV_SAFE("Step 2. Confirm two messages and wait for the linger time");
+    for (int i = 0; i < 2; ++i) {
+        BMQTST_ASSERT_EQ(bmqt::GenericResult::e_SUCCESS,
+                         obj.session().confirmMessage(pQueue, guids[i]));
+    }
+
+    BMQTST_ASSERT(obj.session()._synchronize());
+    BMQTST_ASSERT(obj.isChannelEmpty());
+
+    obj.advanceTime(k_LINGER_TIME);
+
+    obj.getOutboundEvent(&rawEvent);
+    BMQTST_ASSERT(rawEvent.isConfirmEvent());
+
+    rawEvent.loadConfirmMessageIterator(&confirmIter);
+    BMQTST_ASSERT(confirmIter.isValid());
+    for (int i = 0; i < 2; ++i) {
+        BMQTST_ASSERT_EQ_D(i, 1, confirmIter.next());
+        BMQTST_ASSERT_EQ_D(i, pQueue->id(), confirmIter.message().queueId());
+        BMQTST_ASSERT_EQ_D(i,
+                           guids[i],
+                           confirmIter.message().messageGUID());
+    }
+    BMQTST_ASSERT_EQ(0, confirmIter.next());
+
+    PVV_SAFE("Step 3. Confirm messages up to the budget");
+    for (int i = 2; i < 2 + k_MAX_MESSAGES; ++i) {
+        BMQTST_ASSERT_EQ(bmqt::GenericResult::e_SUCCESS,
+                         obj.session().confirmMessage(pQueue, guids[i]));
+    }
+
+    rawEvent.clear();
+    obj.getOutboundEvent(&rawEvent);
+    BMQTST_ASSERT(rawEvent.isConfirmEvent());
+
+    rawEvent.loadConfirmMessageIterator(&confirmIter);
+    BMQTST_ASSERT(confirmIter.isValid());
+    for (int i = 2; i < 2 + k_MAX_MESSAGES; ++i) {
+        BMQTST_ASSERT_EQ_D(i, 1, confirmIter.next());
+        BMQTST_ASSERT_EQ_D(i,
+                           guids[i],
+                           confirmIter.message().messageGUID());
+    }
+    BMQTST_ASSERT_EQ(0, confirmIter.next());
+
+    PVV_SAFE("Step 4. Confirm a message and flush the confirmations");
+    BMQTST_ASSERT_EQ(bmqt::GenericResult::e_SUCCESS,
+                     obj.session().confirmMessage(pQueue, guids[5]));
+
+    BMQTST_ASSERT(obj.session()._synchronize());
+    BMQTST_ASSERT(obj.isChannelEmpty());
+
+    BMQTST_ASSERT_EQ(bmqt::GenericResult::e_SUCCESS,
+                     obj.session().flushConfirms());
+
+    rawEvent.clear();
+    obj.getOutboundEvent(&rawEvent);
+    BMQTST_ASSERT(rawEvent.isConfirmEvent());
+
+    rawEvent.loadConfirmMessageIterator(&confirmIter);
+    BMQTST_ASSERT(confirmIter.isValid());
+    BMQTST_ASSERT_EQ(1, confirmIter.next());
+    BMQTST_ASSERT_EQ(guids[5], confirmIter.message().messageGUID());
+    BMQTST_ASSERT_EQ(0, confirmIter.next());
+
+    obj.stopGracefully();
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -9763,6 +10193,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 73: test73_confirmBatching(); break;
+    case 72: test72_pushBatching(); break;
+    case 71: test71_putBatching(); break;
     case 70: /* removed test */ break;
     case 69: /* removed test */ break;
     case 68: test68_queueLateAsyncCanceledHybrid3(); break;
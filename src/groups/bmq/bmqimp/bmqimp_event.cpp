@@ -467,6 +467,42 @@ const bsl::shared_ptr<Queue> Event::lookupQueue() const
     }
 }
 
+bool Event::loadSingleQueueId(int* queueId) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(queueId);
+
+    int  id    = Queue::k_INVALID_QUEUE_ID;
+    bool found = false;
+
+    for (QueuesMap::const_iterator cit = d_queues.begin();
+         cit != d_queues.end();
+         ++cit) {
+        if (found && cit->first.id() != id) {
+            return false;  // RETURN
+        }
+        id    = cit->first.id();
+        found = true;
+    }
+
+    for (QueuesBySubscriptionId::const_iterator cit =
+             d_queuesBySubscriptionId.begin();
+         cit != d_queuesBySubscriptionId.end();
+         ++cit) {
+        if (found && cit->first.d_queueId != id) {
+            return false;  // RETURN
+        }
+        id    = cit->first.d_queueId;
+        found = true;
+    }
+
+    if (found) {
+        *queueId = id;
+    }
+
+    return found;
+}
+
 const bsl::shared_ptr<Queue>
 Event::lookupQueue(int queueId, unsigned int subscriptionId) const
 {
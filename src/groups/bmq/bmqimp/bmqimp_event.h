@@ -414,6 +414,13 @@ class Event {
     /// to use because it is populated once.
     const QueuesMap& queues() const;
 
+    /// Load into the specified `queueId` the id of the queue, and return
+    /// `true`, if all the queues and subscriptions associated with this
+    /// event refer to the same queue.  Return `false` and leave `queueId`
+    /// untouched if this event is associated with no queue, or with several
+    /// queues.
+    bool loadSingleQueueId(int* queueId) const;
+
     // - - - - - - - - - - - - - - - -
     // SessionEvent specific operations
     // ACCESSORS
@@ -314,6 +314,7 @@ static void test2_setterGetterTest()
     //   - doneCallback
     //   - queues
     //   - lookupQueue
+    //   - loadSingleQueueId
     //
     // Testing manipulators:
     //   - setType;
@@ -388,8 +389,15 @@ static void test2_setterGetterTest()
         .setOptions(options)
         .setPendingConfigureId(k_PENDING_ID);
 
+    int queueId = -1;
+    BMQTST_ASSERT(!obj.loadSingleQueueId(&queueId));
+    BMQTST_ASSERT_EQ(queueId, -1);
+
     obj.insertQueue(queue);
 
+    BMQTST_ASSERT(obj.loadSingleQueueId(&queueId));
+    BMQTST_ASSERT_EQ(queueId, static_cast<int>(k_ID));
+
     BMQTST_ASSERT_EQ(1, static_cast<int>(obj.queues().size()));
     bmqimp::Queue* queue2 = obj.queues().begin()->second.get();
     BMQTST_ASSERT_EQ(queue2->uri(), uri);
@@ -402,6 +410,21 @@ static void test2_setterGetterTest()
     BMQTST_ASSERT_EQ(queue2->atMostOnce(), true);
     BMQTST_ASSERT_EQ(queue2->id(), static_cast<int>(k_ID));
 
+    // loadSingleQueueId with several queues
+    bsl::shared_ptr<bmqimp::Queue> otherQueue =
+        bsl::allocate_shared<bmqimp::Queue, bslma::Allocator>(
+            bmqtst::TestHelperUtil::allocator());
+    otherQueue->setId(k_ID + 1);
+
+    obj.insertQueue(1U, queue);
+    BMQTST_ASSERT(obj.loadSingleQueueId(&queueId));
+    BMQTST_ASSERT_EQ(queueId, static_cast<int>(k_ID));
+
+    obj.insertQueue(1U, otherQueue);
+    queueId = -1;
+    BMQTST_ASSERT(!obj.loadSingleQueueId(&queueId));
+    BMQTST_ASSERT_EQ(queueId, -1);
+
     PV("Clear event");
     obj.clear();
     BMQTST_ASSERT_EQ(obj.type(), bmqimp::Event::EventType::e_UNINITIALIZED);
@@ -18,6 +18,7 @@
 #include <bmqscm_version.h>
 
 // BMQ
+#include <bmqimp_queue.h>
 #include <bmqt_correlationid.h>
 #include <bmqt_resultcode.h>
 
@@ -35,6 +36,7 @@
 #include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
 #include <bdlma_localsequentialallocator.h>
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
@@ -62,8 +64,24 @@ enum {
     k_STAT_TIME = 1
 };
 
+/// Number of attempts to pop an item between two reads of the timer while
+/// busy-polling the queue, the timer being more expensive to read than the
+/// queue.
+const int k_NUM_POLLS_PER_TIMER_READ = 16;
+
 }  // close unnamed namespace
 
+// --------------------------
+// struct EventQueue::Barrier
+// --------------------------
+
+EventQueue::Barrier::Barrier(int numThreads)
+: d_numPending(numThreads)
+, d_done(1)
+{
+    // NOTHING
+}
+
 // ----------------------------
 // struct EventQueue::QueueItem
 // ----------------------------
@@ -71,6 +89,7 @@ enum {
 EventQueue::QueueItem::QueueItem()
 : d_event_sp(0)
 , d_enqueueTime(0)
+, d_barrier_sp()
 {
     // NOTHING
 }
@@ -79,6 +98,7 @@ EventQueue::QueueItem::QueueItem(const bsl::shared_ptr<Event>& event,
                                  bsls::Types::Int64            enqueueTime)
 : d_event_sp(event)
 , d_enqueueTime(enqueueTime)
+, d_barrier_sp()
 {
     // NOTHING
 }
@@ -162,6 +182,32 @@ void EventQueue::stateCallback(bmqc::MonitoredQueueState::Enum state)
     }
 }
 
+void EventQueue::threadQueueStateCallback(
+    bmqc::MonitoredQueueState::Enum state)
+{
+    // The state of the event queue as a whole is reported on the first queue
+    // reaching its high watermark, and on the last one going back to its low
+    // watermark.
+
+    switch (state) {
+    case bmqc::MonitoredQueueState::e_NORMAL: {
+        if (d_numThreadQueuesAtHighWatermark.subtract(1) == 0) {
+            stateCallback(state);
+        }
+    } break;
+    case bmqc::MonitoredQueueState::e_HIGH_WATERMARK_REACHED: {
+        if (d_numThreadQueuesAtHighWatermark.add(1) == 1) {
+            stateCallback(state);
+        }
+    } break;
+    case bmqc::MonitoredQueueState::e_HIGH_WATERMARK_2_REACHED:
+    case bmqc::MonitoredQueueState::e_QUEUE_FILLED:
+    default: {
+        stateCallback(state);
+    } break;
+    }
+}
+
 bool EventQueue::hasPriorityEvents(bsl::shared_ptr<Event>* event)
 {
     // PRECONDITIONS
@@ -220,6 +266,25 @@ void EventQueue::afterEventPopped(const QueueItem& item)
     }
 }
 
+bool EventQueue::spinPopFront(QueueItem* item, bsls::Types::Int64 durationNs)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(item);
+
+    const bsls::Types::Int64 deadline = bmqu::Time::highResolutionTimer() +
+                                        durationNs;
+
+    do {
+        for (int i = 0; i < k_NUM_POLLS_PER_TIMER_READ; ++i) {
+            if (d_queue.tryPopFront(item) == 0) {
+                return true;  // RETURN
+            }
+        }
+    } while (bmqu::Time::highResolutionTimer() < deadline);
+
+    return false;
+}
+
 void EventQueue::printLastEventTime(bsl::ostream& stream)
 {
     bsls::Types::Int64 poppedOutTime = 0;
@@ -269,6 +334,108 @@ void EventQueue::dispatchNextEvent()
                   << "[id: " << bslmt::ThreadUtil::selfIdAsUint64() << "]";
 }
 
+void EventQueue::dispatchThreadQueueEvents(int threadIndex)
+{
+    // executed by (one of) the *EVENT_THREAD_POOL* thread
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(d_eventHandler);
+    BSLS_ASSERT_SAFE(0 <= threadIndex &&
+                     threadIndex < static_cast<int>(d_threadQueues.size()));
+
+    BALL_LOG_INFO << id() << "EventHandler thread started "
+                  << "[id: " << bslmt::ThreadUtil::selfIdAsUint64()
+                  << ", threadIndex: " << threadIndex << "]";
+
+    // 'd_threadQueues' is only modified while the threads are not running.
+    MonitoredEventQueue& queue = *d_threadQueues[threadIndex];
+
+    while (true) {
+        bsl::shared_ptr<Event> event;
+
+        // Check for priority events first
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(hasPriorityEvents(&event))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            afterEventPopped(
+                QueueItem(event, bmqu::Time::highResolutionTimer()));
+            d_eventHandler(event);
+            continue;  // CONTINUE
+        }
+
+        QueueItem                   item;
+        BSLA_MAYBE_UNUSED const int rc = queue.popFront(&item);
+        BSLS_ASSERT_SAFE(rc == 0);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!item.d_event_sp)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            // Empty event is the poison pill signal; terminate the thread
+            afterEventPopped(item);
+            break;  // BREAK
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(item.d_barrier_sp)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            // The event was pushed to the queues of all the threads: the last
+            // thread reaching it processes it, while the other ones wait for
+            // it to be processed before going on with their queue.
+            Barrier& barrier = *item.d_barrier_sp;
+            if (barrier.d_numPending.subtract(1) != 0) {
+                barrier.d_done.wait();
+                continue;  // CONTINUE
+            }
+
+            afterEventPopped(item);
+            d_eventHandler(item.d_event_sp);
+            barrier.d_done.countDown();
+            continue;  // CONTINUE
+        }
+
+        afterEventPopped(item);
+        d_eventHandler(item.d_event_sp);
+    }
+
+    BALL_LOG_INFO << id() << "EventHandler thread terminated "
+                  << "[id: " << bslmt::ThreadUtil::selfIdAsUint64()
+                  << ", threadIndex: " << threadIndex << "]";
+}
+
+int EventQueue::pushBackToThreadQueues(const QueueItem& item)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!d_threadQueues.empty());
+    BSLS_ASSERT_SAFE(item.d_event_sp);
+
+    const unsigned int numThreads = static_cast<unsigned int>(
+        d_threadQueues.size());
+
+    int queueId = Queue::k_INVALID_QUEUE_ID;
+    if (item.d_event_sp->loadSingleQueueId(&queueId)) {
+        // Queue ids are allocated sequentially, and are therefore evenly
+        // spread over the threads.
+        const unsigned int threadIndex = static_cast<unsigned int>(queueId) %
+                                         numThreads;
+        return d_threadQueues[threadIndex]->tryPushBack(item);  // RETURN
+    }
+
+    QueueItem barrierItem(item);
+    barrierItem.d_barrier_sp.createInplace(d_allocator_p, numThreads);
+
+    for (unsigned int i = 0; i < numThreads; ++i) {
+        const int rc = d_threadQueues[i]->tryPushBack(barrierItem);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return rc;  // RETURN
+        }
+    }
+
+    return 0;
+}
+
+void EventQueue::clearThreadQueues()
+{
+    bsls::SpinLockGuard guard(&d_pushBackSpinlock);  // LOCK
+    d_threadQueues.clear();
+}
+
 EventQueue::EventQueue(EventPool*                  eventPool,
                        int                         initialCapacity,
                        int                         lowWatermark,
@@ -283,6 +450,11 @@ EventQueue::EventQueue(EventPool*                  eventPool,
 , d_threadPool_mp()
 , d_eventHandler(bsl::allocator_arg, allocator, eventHandler)
 , d_numProcessingThreads(numProcessingThreads)
+, d_initialCapacity(initialCapacity)
+, d_orderedPerQueueDispatch(false)
+, d_threadQueues(allocator)
+, d_spinDurationNs(0)
+, d_numThreadQueuesAtHighWatermark(0)
 , d_shouldEmitHighWatermark(0)
 , d_lastPoppedOutSpinLock(bsls::SpinLock::s_unlocked)
 , d_lastPoppedOutTime(0)
@@ -422,6 +594,24 @@ void EventQueue::initializeStats(
         .extremeValueString("");
 }
 
+void EventQueue::setOrderedPerQueueDispatch(bool value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(!d_threadPool_mp && "EventQueue already started");
+    BSLS_ASSERT_OPT((!value || d_eventHandler) &&
+                    "Ordered dispatch requires an event handler");
+
+    d_orderedPerQueueDispatch = value;
+}
+
+void EventQueue::setSpinDuration(const bsls::TimeInterval& value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 <= value && "value must be nonnegative");
+
+    d_spinDurationNs = value.totalNanoseconds();
+}
+
 int EventQueue::start()
 {
     // Make sure the queue is empty (so that we can do start, stop, start, ...
@@ -442,7 +632,9 @@ int EventQueue::start()
     }
 
     BALL_LOG_INFO << id() << "Starting EventQueue ThreadPool "
-                  << "[numThreads: " << d_numProcessingThreads << "]";
+                  << "[numThreads: " << d_numProcessingThreads
+                  << ", orderedPerQueueDispatch: " << bsl::boolalpha
+                  << d_orderedPerQueueDispatch << "]";
 
     int rc = 0;
 
@@ -451,6 +643,34 @@ int EventQueue::start()
         &bslma::ManagedPtr<bdlmt::FixedThreadPool>::reset,
         &d_threadPool_mp));
 
+    // Guard to go back to the shared queue on failure
+    bdlb::ScopeExitAny threadQueuesGuard(
+        bdlf::MemFnUtil::memFn(&EventQueue::clearThreadQueues, this));
+
+    if (d_orderedPerQueueDispatch) {
+        bsl::vector<MonitoredEventQueueSp> threadQueues(d_allocator_p);
+        threadQueues.reserve(d_numProcessingThreads);
+
+        for (int i = 0; i < d_numProcessingThreads; ++i) {
+            MonitoredEventQueueSp queue;
+            queue.createInplace(d_allocator_p,
+                                d_initialCapacity,
+                                d_allocator_p);
+            queue->setWatermarks(d_queue.lowWatermark(),
+                                 d_queue.highWatermark());
+            queue->setStateCallback(
+                bdlf::BindUtil::bind(&EventQueue::threadQueueStateCallback,
+                                     this,
+                                     bdlf::PlaceHolders::_1));  // state
+            threadQueues.push_back(queue);
+        }
+
+        d_numThreadQueuesAtHighWatermark = 0;
+
+        bsls::SpinLockGuard spinGuard(&d_pushBackSpinlock);  // LOCK
+        d_threadQueues.swap(threadQueues);
+    }
+
     bslmt::ThreadAttributes threadAttributes;
     threadAttributes.setThreadName("bmqEventQueue");
     d_threadPool_mp.load(new (*d_allocator_p)
@@ -470,8 +690,16 @@ int EventQueue::start()
 
     // Enqueue 'numProcessingThreads' jobs
     for (int i = 0; i < d_threadPool_mp->numThreads(); ++i) {
-        rc = d_threadPool_mp->tryEnqueueJob(
-            bdlf::MemFnUtil::memFn(&EventQueue::dispatchNextEvent, this));
+        if (d_orderedPerQueueDispatch) {
+            rc = d_threadPool_mp->tryEnqueueJob(
+                bdlf::BindUtil::bind(&EventQueue::dispatchThreadQueueEvents,
+                                     this,
+                                     i));  // threadIndex
+        }
+        else {
+            rc = d_threadPool_mp->tryEnqueueJob(
+                bdlf::MemFnUtil::memFn(&EventQueue::dispatchNextEvent, this));
+        }
         if (rc != 0) {
             BALL_LOG_ERROR << id()
                            << "Failed to enqueue job to EventQueue ThreadPool "
@@ -482,6 +710,7 @@ int EventQueue::start()
     }
 
     guard.release();
+    threadQueuesGuard.release();
 
     return 0;
 }
@@ -489,9 +718,29 @@ int EventQueue::start()
 void EventQueue::stop()
 {
     if (d_threadPool_mp && d_threadPool_mp->isStarted()) {
-        // Enqueue one poison pill for each thread
-        for (int i = 0; i < d_numProcessingThreads; ++i) {
-            enqueuePoisonPill();
+        if (d_threadQueues.empty()) {
+            // Enqueue one poison pill for each thread
+            for (int i = 0; i < d_numProcessingThreads; ++i) {
+                enqueuePoisonPill();
+            }
+        }
+        else {
+            // Enqueue one poison pill in the queue of each thread
+            const QueueItem item(0, bmqu::Time::highResolutionTimer());
+
+            {  // d_pushBackSpinlock   LOCKED
+                bsls::SpinLockGuard guard(&d_pushBackSpinlock);
+                for (size_t i = 0; i < d_threadQueues.size(); ++i) {
+                    d_threadQueues[i]->tryPushBack(item);
+                }
+            }  // d_pushBackSpinlock UNLOCKED
+
+            // Update stats
+            if (d_stats_mp) {
+                d_stats_mp->adjustValue(
+                    k_STAT_QUEUE,
+                    static_cast<int>(d_threadQueues.size()));
+            }
         }
 
         BALL_LOG_INFO << id() << "Stopping EventQueue ThreadPool...";
@@ -500,6 +749,7 @@ void EventQueue::stop()
     }
 
     d_threadPool_mp.reset();
+    clearThreadQueues();
 }
 
 int EventQueue::pushBack(bsl::shared_ptr<Event>& event)
@@ -518,7 +768,12 @@ int EventQueue::pushBack(bsl::shared_ptr<Event>& event)
 
     {  // d_pushBackSpinlock   LOCKED
         bsls::SpinLockGuard guard(&d_pushBackSpinlock);
-        rc = d_queue.tryPushBack(item);
+        if (d_threadQueues.empty()) {
+            rc = d_queue.tryPushBack(item);
+        }
+        else {
+            rc = pushBackToThreadQueues(item);
+        }
     }  // d_pushBackSpinlock UNLOCKED
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
@@ -572,7 +827,16 @@ EventQueue::timedPopFront(const bsls::TimeInterval& timeout,
     const bsls::TimeInterval absTimeOut = timeout + now;
     // Look in the queue
     QueueItem item;
-    const int rc = d_queue.timedPopFront(&item, absTimeOut);
+    int       rc = -1;
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_spinDurationNs > 0) &&
+        spinPopFront(&item,
+                     bsl::min(d_spinDurationNs, timeout.totalNanoseconds()))) {
+        // Got an item without blocking
+        rc = 0;
+    }
+    else {
+        rc = d_queue.timedPopFront(&item, absTimeOut);
+    }
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
@@ -615,6 +879,29 @@ EventQueue::timedPopFront(const bsls::TimeInterval& timeout,
     return event;
 }
 
+int EventQueue::tryPopFront(bsl::shared_ptr<Event>* event)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(event);
+
+    // Check for priority events first
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(hasPriorityEvents(event))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        afterEventPopped(QueueItem(*event, bmqu::Time::highResolutionTimer()));
+        return 0;  // RETURN
+    }
+
+    // Look in the queue
+    QueueItem item;
+    if (d_queue.tryPopFront(&item) != 0) {
+        return -1;  // RETURN
+    }
+
+    *event = item.d_event_sp;
+    afterEventPopped(item);
+    return 0;
+}
+
 void EventQueue::enqueuePoisonPill()
 {
     // PoisonPill has a null event
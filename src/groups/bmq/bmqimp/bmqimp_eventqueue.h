@@ -32,6 +32,33 @@
 // The queue has a built-in monitoring mechanism that will emit alarms when it
 // reaches certain user-customizable thresholds.
 //
+// Note that these alarms are only reported to the application, and are not
+// propagated to the broker as back-pressure: the amount of PUSH messages
+// buffered in this queue is already bounded by the broker, which stops
+// delivering to a consumer once it has 'maxUnconfirmedMessages' or
+// 'maxUnconfirmedBytes' outstanding.  The memory used by PUSH events is
+// therefore bounded by the sum of these limits across the open queues, and
+// an application reacting to the high watermark by lowering them (through
+// 'configureQueue') obtains that back-pressure explicitly.
+//
+/// Ordered per-queue dispatch
+///--------------------------
+// By default, the processing threads all pop events from the same queue, so
+// that events are processed in order only if there is one processing thread.
+// When 'setOrderedPerQueueDispatch(true)' is called before 'start', each
+// processing thread instead pops events from its own queue, and each event is
+// pushed to the queue of one thread selected by the id of the queue the event
+// is associated with.  Events of a given queue are therefore processed in
+// order, one at a time, while the events of different queues are processed in
+// parallel.  An event which is not associated with exactly one queue (e.g., a
+// session event, or a message event containing messages of several queues) is
+// pushed to the queues of all the threads; it is processed, by one thread,
+// once all threads have processed the events pushed before it, and the
+// threads resume processing the events pushed after it once it has been
+// processed.  In this mode, the watermarks apply to the queue of each thread:
+// the high watermark is reported as soon as one queue reaches it, and the low
+// watermark is reported once all the queues are back to it.
+//
 /// Statistics
 ///----------
 // If configured for the queue can keep keep track of the following statistics:
@@ -151,10 +178,12 @@
 #include <bsl_functional.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_latch.h>
 #include <bsls_atomic.h>
 #include <bsls_cpp11.h>
 #include <bsls_spinlock.h>
@@ -194,6 +223,22 @@ class EventQueue {
     /// Shortcut alias
     typedef bslma::ManagedPtr<bdlmt::FixedThreadPool> FixedThreadPoolMP;
 
+    /// Rendezvous of the processing threads on an event pushed to the
+    /// queues of all the threads in ordered per-queue dispatch mode.
+    struct Barrier {
+        // PUBLIC DATA
+        bsls::AtomicInt d_numPending;
+        // Number of threads which have not
+        // reached the event yet
+
+        bslmt::Latch d_done;
+        // Released once the event has been
+        // processed
+
+        // CREATORS
+        explicit Barrier(int numThreads);
+    };
+
     /// Struct holding a pointer to the enqueued event and a timestamp
     /// representing the time the event was pushed into the queue.
     struct QueueItem {
@@ -204,6 +249,11 @@ class EventQueue {
         bsls::Types::Int64 d_enqueueTime;
         // Enqueue time
 
+        bsl::shared_ptr<Barrier> d_barrier_sp;
+        // Barrier shared by the queues of
+        // all the threads, if the event was
+        // pushed to all of them
+
         // CREATORS
         QueueItem();
         QueueItem(const bsl::shared_ptr<Event>& event,
@@ -213,6 +263,8 @@ class EventQueue {
     typedef bmqc::MonitoredQueue<bdlcc::SingleProducerQueue<QueueItem> >
         MonitoredEventQueue;
 
+    typedef bsl::shared_ptr<MonitoredEventQueue> MonitoredEventQueueSp;
+
   private:
     // DATA
     bslma::Allocator* d_allocator_p;
@@ -238,6 +290,31 @@ class EventQueue {
     // number of threads to configure
     // the internal thread pool with.
 
+    int d_initialCapacity;
+    // Initial capacity of the queue, and
+    // of the queue of each thread in
+    // ordered per-queue dispatch mode.
+
+    bool d_orderedPerQueueDispatch;
+    // Whether events are dispatched to
+    // the threads by queue.
+
+    bsl::vector<MonitoredEventQueueSp> d_threadQueues;
+    // Queue of each thread, in ordered
+    // per-queue dispatch mode, while
+    // started.
+
+    bsls::Types::Int64 d_spinDurationNs;
+    // Maximum time, in nanoseconds,
+    // 'timedPopFront' busy-polls the queue
+    // for an item before blocking.
+
+    bsls::AtomicInt d_numThreadQueuesAtHighWatermark;
+    // Number of queues of 'd_threadQueues'
+    // which reached the high watermark
+    // and are not back to the low
+    // watermark yet.
+
     bsls::AtomicInt d_shouldEmitHighWatermark;
     // 1 means next
     // popFront/timedPopFront should
@@ -301,6 +378,10 @@ class EventQueue {
     /// the specified `state`.
     void stateCallback(bmqc::MonitoredQueueState::Enum state);
 
+    /// Callback invoked by the queue of a thread, in ordered per-queue
+    /// dispatch mode, when it has changed to the specified `state`.
+    void threadQueueStateCallback(bmqc::MonitoredQueueState::Enum state);
+
     /// Return true and populate the specified `event` if any prioritized
     /// one was pending; return false and leave `event` untouched if no
     /// prioritized events was scheduled.
@@ -310,6 +391,12 @@ class EventQueue {
     /// the queue, just before it being delivered to the caller.
     void afterEventPopped(const QueueItem& item);
 
+    /// Busy-poll the queue for up to the specified `durationNs`
+    /// nanoseconds.  Return `true` and load the popped out item into the
+    /// specified `item` if an item was popped out within that time, and
+    /// return `false` otherwise.
+    bool spinPopFront(QueueItem* item, bsls::Types::Int64 durationNs);
+
     /// Print to the specified `stream` a message describing timings of the
     /// latest event that was successfully popped out from the queue.
     void printLastEventTime(bsl::ostream& stream);
@@ -318,6 +405,23 @@ class EventQueue {
     /// the queue and call out the provided EventHandler.
     void dispatchNextEvent();
 
+    /// Main method of the thread at the specified `threadIndex` in the
+    /// thread pool, in ordered per-queue dispatch mode: reads messages from
+    /// the queue of that thread and call out the provided EventHandler.
+    void dispatchThreadQueueEvents(int threadIndex);
+
+    /// Push the specified `item` to the queue of the thread processing the
+    /// events of the queue of the event of `item`, or to the queues of all
+    /// the threads if that event is not associated with exactly one queue.
+    /// Return 0 on success or non-zero on failure to push.  The behavior is
+    /// undefined unless `d_pushBackSpinlock` is locked and `d_threadQueues`
+    /// is not empty.
+    int pushBackToThreadQueues(const QueueItem& item);
+
+    /// Remove the queues of the threads, if any, so that events are pushed
+    /// to the shared queue.
+    void clearThreadQueues();
+
     // PRIVATE ACCESSORS
     const SessionId& id() const;
 
@@ -354,6 +458,19 @@ class EventQueue {
                          const bmqst::StatValue::SnapshotLocation& start,
                          const bmqst::StatValue::SnapshotLocation& end);
 
+    /// Set whether the events are dispatched to the processing threads by
+    /// queue to the specified `value`.  Refer to the component level
+    /// documentation for more details.  The behavior is undefined unless
+    /// this queue is not started, and an `eventHandler` was provided at
+    /// construction.
+    void setOrderedPerQueueDispatch(bool value);
+
+    /// Set the maximum time `timedPopFront` busy-polls the queue for an
+    /// item, before blocking for the remainder of its timeout, to the
+    /// specified `value`.  A zero `value` (the default) disables spinning.
+    /// The behavior is undefined unless `0 <= value`.
+    void setSpinDuration(const bsls::TimeInterval& value);
+
     /// Start the EventQueue and return 0 on success, or a non zero code on
     /// error.  If an `eventHandler` was provided at construction, this will
     /// start the thread pool.
@@ -376,16 +493,22 @@ class EventQueue {
     /// wait for up to the specified `timeout` in respect to the specified
     /// `now` - as a relative offset from between
     /// `bmqu::Time::nowMonotonicClock()` - argument for an item to be
-    /// pushed to the queue.  If no item is found after the provided
-    /// `timeout`, the method will return a `SessionEvent` of type
-    /// `bmqt::SessionEventType::e_TIMEOUT`.  If an error occurs while
-    /// attempting to pop an item from the front of the queue, the method
-    /// will return a `SessionEvent` of type
+    /// pushed to the queue, busy-polling the queue for the first part of
+    /// that time if a spin duration was set with `setSpinDuration`.  If no
+    /// item is found after the provided `timeout`, the method will return a
+    /// `SessionEvent` of type `bmqt::SessionEventType::e_TIMEOUT`.  If an
+    /// error occurs while attempting to pop an item from the front of the
+    /// queue, the method will return a `SessionEvent` of type
     /// `bmqt::SessionEventType::e_ERROR`.
     bsl::shared_ptr<Event> timedPopFront(
         const bsls::TimeInterval& timeout,
         const bsls::TimeInterval& now = bsls::SystemTime::nowMonotonicClock());
 
+    /// Load into the specified `event` the front item of the queue and
+    /// return 0 if the queue is not empty, or return a non-zero value and
+    /// leave `event` untouched if it is empty.  This method never blocks.
+    int tryPopFront(bsl::shared_ptr<Event>* event);
+
     /// Enqueue a PoisonPill event; this event represents the termination
     /// condition for the thread reading items from the queue.
     void enqueuePoisonPill();
@@ -16,6 +16,7 @@
 #include <bmqimp_eventqueue.h>
 
 // BMQ
+#include <bmqimp_queue.h>
 #include <bmqst_statcontext.h>
 #include <bmqst_statvalue.h>
 #include <bmqt_resultcode.h>
@@ -31,6 +32,9 @@
 #include <bdlt_timeunitratio.h>
 #include <bmqimp_stat.h>
 #include <bslma_managedptr.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
 #include <bsls_atomic.h>
 #include <bsls_timeinterval.h>
 #include <bsls_timeutil.h>
@@ -41,6 +45,7 @@
 #include <bsl_limits.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
+#include <bsl_vector.h>
 
 // CONVENIENCE
 using namespace BloombergLP;
@@ -58,6 +63,62 @@ void eventHandler(const bsl::shared_ptr<bmqimp::Event>& event,
     ++eventCounter;
 }
 
+/// Events processed by `orderedEventHandler`.
+struct ProcessedEvents {
+    // PUBLIC CONSTANTS
+    enum { k_NUM_QUEUES = 8 };
+
+    // PUBLIC DATA
+    bslmt::Mutex d_mutex;
+    // Mutex protecting 'd_statusCodes'
+
+    bsl::vector<int> d_statusCodes;
+    // Status codes of the processed
+    // events, in processing order
+
+    bsls::AtomicInt d_numInProgress[k_NUM_QUEUES];
+    // Number of events of each queue being
+    // processed
+
+    bsls::AtomicInt d_numOverlaps;
+    // Number of events processed while
+    // another event of the same queue was
+    // being processed
+
+    // CREATORS
+    explicit ProcessedEvents(bslma::Allocator* allocator)
+    : d_mutex()
+    , d_statusCodes(allocator)
+    , d_numOverlaps(0)
+    {
+        for (int i = 0; i < k_NUM_QUEUES; ++i) {
+            d_numInProgress[i] = 0;
+        }
+    }
+};
+
+void orderedEventHandler(const bsl::shared_ptr<bmqimp::Event>& event,
+                         ProcessedEvents*                      processed)
+{
+    int queueId = -1;
+    if (event->loadSingleQueueId(&queueId) &&
+        ++processed->d_numInProgress[queueId] != 1) {
+        ++processed->d_numOverlaps;
+    }
+
+    // Leave a chance to the other threads to process their events.
+    bslmt::ThreadUtil::yield();
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&processed->d_mutex);  // LOCK
+        processed->d_statusCodes.push_back(event->statusCode());
+    }
+
+    if (queueId >= 0) {
+        --processed->d_numInProgress[queueId];
+    }
+}
+
 /// Create an `Event` object at the specified `address` using the supplied
 /// allocator `allocator`; This is used by the Object Pool.
 void poolCreateEvent(void*                     address,
@@ -698,6 +759,225 @@ static void test6_workingStatsTest()
                      k_INITIAL_CAPACITY * k_MILL_SEC + k_QUEUE_WAIT);
 }
 
+static void test7_orderedPerQueueDispatch()
+// ------------------------------------------------------------------------
+// ORDERED PER QUEUE DISPATCH
+//
+// Concerns:
+//   1. In ordered per-queue dispatch mode, the events of each queue are
+//      processed in order, one at a time.
+//   2. An event not associated with a queue is processed after all the
+//      events pushed before it, and before all the events pushed after it.
+//
+// Plan:
+//   1. Create bmqimp::EventQueue with several processing threads in
+//      ordered per-queue dispatch mode.
+//   2. Push events of several queues, numbered by their status code, with
+//      a session event in the middle, and stop the queue.
+//   3. Check the processing order of the events.
+//
+// Testing manipulators:
+//   - setOrderedPerQueueDispatch
+//   - pushBack
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("ORDERED PER QUEUE DISPATCH");
+
+    const int k_NUM_THREADS = 4;
+    const int k_NUM_EVENTS  = 400;
+    const int k_BARRIER     = k_NUM_EVENTS / 2;
+
+    ProcessedEvents processed(bmqtst::TestHelperUtil::allocator());
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqimp::EventQueue::EventPool eventPool(
+        bdlf::BindUtil::bind(&poolCreateEvent,
+                             bdlf::PlaceHolders::_1,  // address
+                             &bufferFactory,
+                             bdlf::PlaceHolders::_2),  // allocator
+        -1,
+        bmqtst::TestHelperUtil::allocator());
+
+    bmqimp::EventQueue obj(&eventPool,
+                           100,     // initialCapacity
+                           3,       // lowWatermark
+                           100000,  // highWatermark
+                           bdlf::BindUtil::bind(&orderedEventHandler,
+                                                bdlf::PlaceHolders::_1,
+                                                &processed),
+                           k_NUM_THREADS,  // numProcessingThreads
+                           bmqimp::SessionId(),
+                           bmqtst::TestHelperUtil::allocator());
+
+    bsl::vector<bsl::shared_ptr<bmqimp::Queue> > queues(
+        bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < ProcessedEvents::k_NUM_QUEUES; ++i) {
+        bsl::shared_ptr<bmqimp::Queue> queue;
+        queue.createInplace(bmqtst::TestHelperUtil::allocator(),
+                            bmqtst::TestHelperUtil::allocator());
+        queue->setId(i);
+        queues.push_back(queue);
+    }
+
+    obj.setOrderedPerQueueDispatch(true);
+    BMQTST_ASSERT_EQ(obj.start(), 0);
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        bsl::shared_ptr<bmqimp::Event> event = eventPool.getObject();
+
+        if (i == k_BARRIER) {
+            // Session event, associated with no queue
+            event->configureAsSessionEvent(
+                bmqt::SessionEventType::e_UNDEFINED,
+                -1);
+            BMQTST_ASSERT_EQ(obj.pushBack(event), 0);
+
+            event = eventPool.getObject();
+        }
+
+        event->configureAsSessionEvent(
+            bmqt::SessionEventType::e_QUEUE_OPEN_RESULT,
+            i);
+        event->insertQueue(queues[i % ProcessedEvents::k_NUM_QUEUES]);
+        BMQTST_ASSERT_EQ_D(i, obj.pushBack(event), 0);
+    }
+
+    obj.stop();
+
+    const bsl::vector<int>& statusCodes = processed.d_statusCodes;
+    BMQTST_ASSERT_EQ(statusCodes.size(),
+                     static_cast<size_t>(k_NUM_EVENTS + 1));
+    BMQTST_ASSERT_EQ(processed.d_numOverlaps, 0);
+
+    bsl::vector<int> lastStatusCodes(ProcessedEvents::k_NUM_QUEUES,
+                                     -1,
+                                     bmqtst::TestHelperUtil::allocator());
+    bool             barrierProcessed = false;
+    for (size_t i = 0; i < statusCodes.size(); ++i) {
+        const int statusCode = statusCodes[i];
+
+        if (statusCode == -1) {
+            // All the events pushed before the session event were processed
+            BMQTST_ASSERT_EQ(i, static_cast<size_t>(k_BARRIER));
+            barrierProcessed = true;
+            continue;  // CONTINUE
+        }
+
+        // Events pushed after the session event are processed after it
+        BMQTST_ASSERT_EQ_D(statusCode,
+                           barrierProcessed,
+                           statusCode >= k_BARRIER);
+
+        // Events of a queue are processed in order
+        int& lastStatusCode =
+            lastStatusCodes[statusCode % ProcessedEvents::k_NUM_QUEUES];
+        BMQTST_ASSERT_LT_D(statusCode, lastStatusCode, statusCode);
+        lastStatusCode = statusCode;
+    }
+    BMQTST_ASSERT(barrierProcessed);
+}
+
+static void test8_tryPopFrontAndSpin()
+// ------------------------------------------------------------------------
+// TRY POP FRONT AND SPIN
+//
+// Concerns:
+//   1. 'tryPopFront' pops the items in order without blocking, and fails
+//      when the queue is empty.
+//   2. With a spin duration, 'timedPopFront' returns the available items,
+//      and times out after the specified timeout, even if it is shorter
+//      than the spin duration.
+//
+// Plan:
+//   1. Create bmqimp::EventQueue without processing threads, push and pop
+//      events with 'tryPopFront'.
+//   2. Set a spin duration, and pop events with 'timedPopFront'.
+//
+// Testing manipulators:
+//   - tryPopFront
+//   - setSpinDuration
+//   - timedPopFront
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("TRY POP FRONT AND SPIN");
+
+    bmqimp::EventQueue::EventHandlerCallback emptyEventHandler;
+    bdlbb::PooledBlobBufferFactory           bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqimp::EventQueue::EventPool eventPool(
+        bdlf::BindUtil::bind(&poolCreateEvent,
+                             bdlf::PlaceHolders::_1,  // address
+                             &bufferFactory,
+                             bdlf::PlaceHolders::_2),  // allocator
+        -1,
+        bmqtst::TestHelperUtil::allocator());
+
+    bmqimp::EventQueue obj(&eventPool,
+                           10,   // initialCapacity
+                           3,    // lowWatermark
+                           100,  // highWatermark
+                           emptyEventHandler,
+                           0,  // numProcessingThreads
+                           bmqimp::SessionId(),
+                           bmqtst::TestHelperUtil::allocator());
+
+    BMQTST_ASSERT_EQ(obj.start(), 0);
+
+    const int k_NUM_EVENTS = 3;
+
+    PV("tryPopFront");
+    bsl::shared_ptr<bmqimp::Event> event;
+    BMQTST_ASSERT_NE(obj.tryPopFront(&event), 0);
+    BMQTST_ASSERT(!event);
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        event = eventPool.getObject();
+        event->configureAsSessionEvent(bmqt::SessionEventType::e_UNDEFINED,
+                                       i);
+        BMQTST_ASSERT_EQ_D(i, obj.pushBack(event), 0);
+    }
+
+    for (int i = 0; i < k_NUM_EVENTS; ++i) {
+        event.reset();
+        BMQTST_ASSERT_EQ_D(i, obj.tryPopFront(&event), 0);
+        BMQTST_ASSERT_D(i, event);
+        BMQTST_ASSERT_EQ_D(i, event->statusCode(), i);
+    }
+    BMQTST_ASSERT_NE(obj.tryPopFront(&event), 0);
+
+    PV("timedPopFront with spin");
+    obj.setSpinDuration(bsls::TimeInterval(0.001));
+
+    event = eventPool.getObject();
+    event->configureAsSessionEvent(bmqt::SessionEventType::e_UNDEFINED, 7);
+    BMQTST_ASSERT_EQ(obj.pushBack(event), 0);
+
+    event = obj.timedPopFront(bsls::TimeInterval(1));
+    BMQTST_ASSERT_EQ(event->sessionEventType(),
+                     bmqt::SessionEventType::e_UNDEFINED);
+    BMQTST_ASSERT_EQ(event->statusCode(), 7);
+
+    event = obj.timedPopFront(bsls::TimeInterval(0.01));
+    BMQTST_ASSERT_EQ(event->sessionEventType(),
+                     bmqt::SessionEventType::e_TIMEOUT);
+
+    // The timeout bounds the spin
+    obj.setSpinDuration(bsls::TimeInterval(60));
+
+    const bsls::TimeInterval startTime = bmqu::Time::nowMonotonicClock();
+
+    event = obj.timedPopFront(bsls::TimeInterval(0.01));
+    BMQTST_ASSERT_EQ(event->sessionEventType(),
+                     bmqt::SessionEventType::e_TIMEOUT);
+    BMQTST_ASSERT_LT(bmqu::Time::nowMonotonicClock() - startTime,
+                     bsls::TimeInterval(30));
+
+    obj.stop();
+}
+
 static void testN1_performance()
 // ------------------------------------------------------------------------
 // QUEUE - PERFORMANCE TEST
@@ -761,6 +1041,8 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 8: test8_tryPopFrontAndSpin(); break;
+    case 7: test7_orderedPerQueueDispatch(); break;
     case 6: test6_workingStatsTest(); break;
     case 5: test5_emptyStatsTest(); break;
     case 4: test4_basicEventHandlerTest(); break;
@@ -85,7 +85,10 @@ void EventsStats::initializeStats(
     // ----------------------------
     bmqst::StatContextConfiguration config(k_STAT_NAME, &localAllocator);
     config.isTable(true);
-    config.value("event").value("message");
+    // Both values are adjusted for every event, so accumulate them in
+    // per-thread cells folded at snapshot time.
+    config.value("event").valueSharded();
+    config.value("message").valueSharded();
     d_stat.d_statContext_mp = rootStatContext->addSubcontext(config);
 
     // Create the subContexts
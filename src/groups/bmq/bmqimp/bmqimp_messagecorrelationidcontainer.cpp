@@ -92,22 +92,20 @@ void MessageCorrelationIdContainer::removeQueueItem(
         itemGUID);
     BSLS_ASSERT_SAFE(chit != cqit->second.end() && "Key not found");
 
-    // Delete the queue item and if there are no more items related to the
-    // queue remove the queue entry from the outer map.
+    // Delete the queue item.  The queue entry of the outer map is kept when
+    // it has no more items, so that its nodes are reused by the next items of
+    // the queue, and is removed by 'getExpiredIds' once the queue is closed.
     cqit->second.erase(chit);
-    if (cqit->second.empty()) {
-        d_queueItems.erase(cqit);
-    }
 }
 
 MessageCorrelationIdContainer::MessageCorrelationIdContainer(
     bslma::Allocator* allocator)
 : d_lock(bsls::SpinLock::s_unlocked)
-, d_correlationIds(allocator)
-, d_queueItems(allocator)
+, d_pool(allocator)
+, d_correlationIds(&d_pool)
+, d_queueItems(&d_pool)
 , d_numPuts(0)
 , d_numControls(0)
-, d_allocator_p(allocator)
 {
     // NOTHING
 }
@@ -128,7 +126,7 @@ void MessageCorrelationIdContainer::add(
 {
     bsls::SpinLockGuard guard(&d_lock);  // LOCK
 
-    QueueAndCorrelationId toInsert(correlationId, queueId, d_allocator_p);
+    QueueAndCorrelationId toInsert(correlationId, queueId, &d_pool);
     d_correlationIds.insert(bsl::make_pair(key, toInsert));
 }
 
@@ -139,7 +137,7 @@ bmqt::MessageGUID MessageCorrelationIdContainer::add(
 {
     bsls::SpinLockGuard guard(&d_lock);  // LOCK
 
-    QueueAndCorrelationId toInsert(d_allocator_p);
+    QueueAndCorrelationId toInsert(&d_pool);
     toInsert.d_messageType    = bmqp::EventType::e_CONTROL;
     toInsert.d_requestContext = context;
     toInsert.d_queueId        = queueId;
@@ -290,9 +288,8 @@ bsls::TimeInterval MessageCorrelationIdContainer::getExpiredIds(
 
     bsls::TimeInterval minTs(0);
     // Iterate over each queue
-    for (QueueItemsMap::iterator qit = d_queueItems.begin();
-         qit != d_queueItems.end();
-         ++qit) {
+    QueueItemsMap::iterator qit = d_queueItems.begin();
+    while (qit != d_queueItems.end()) {
         // Get the queue expiration timeout
         const int                                    qId = qit->first.id();
         bsl::unordered_map<int, int>::const_iterator cit =
@@ -304,12 +301,19 @@ bsls::TimeInterval MessageCorrelationIdContainer::getExpiredIds(
         const bool isOrphan = cit == queueExpirationTimeoutMap.end();
         if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(isOrphan)) {
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            if (qit->second.empty()) {
+                // No more items for this queue, remove its entry.
+                qit = d_queueItems.erase(qit);
+                continue;  // CONTINUE
+            }
+
             for (HandleAndExpirationTimeMap::iterator hit =
                      qit->second.begin();
                  hit != qit->second.end();
                  ++hit) {
                 keys->push_back(hit->first);
             }
+            ++qit;
             continue;  // CONTINUE
         }
 
@@ -336,6 +340,7 @@ bsls::TimeInterval MessageCorrelationIdContainer::getExpiredIds(
             }
             keys->push_back(hit->first);
         }
+        ++qit;
     }
 
     return minTs;
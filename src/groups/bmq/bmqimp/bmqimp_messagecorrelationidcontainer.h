@@ -28,6 +28,17 @@
 // is returned which can be used later on to assign the 'queueId' as well as
 // retrieve and remove the 'correlationId'.
 //
+/// Memory
+///------
+// An item is added for every PUT message expecting an ACK or being tracked
+// for retransmission, so this container is on the hot path of high-rate
+// producers.  Items are stored in 'bmqc::FlatOrderedHashMap' containers,
+// which recycle their nodes, and the memory owned by the items (such as the
+// buffers list of the message data) is supplied by a pool local to the
+// container.  A container at steady state therefore does not allocate from
+// the allocator supplied at construction, nor contend on it with the other
+// threads of the application.
+//
 /// Thread Safety
 ///-------------
 // Thread safe.
@@ -39,12 +50,14 @@
 #include <bmqt_correlationid.h>
 #include <bmqt_messageguid.h>
 
-#include <bmqc_orderedhashmap.h>
+#include <bmqc_flatorderedhashmap.h>
 
 // BDE
+#include <bdlma_concurrentmultipoolallocator.h>
 #include <bsl_functional.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
+#include <bslh_hash.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_cpp11.h>
@@ -114,10 +127,14 @@ class MessageCorrelationIdContainer {
     /// Map of key to an object containing correlationId and queueId of a
     /// message.  This should be an ordered container so that any local
     /// NAKs are generated in the order in which PUTs were posted.
-    typedef bmqc::OrderedHashMap<bmqt::MessageGUID, QueueAndCorrelationId>
+    typedef bmqc::FlatOrderedHashMap<bmqt::MessageGUID,
+                                     QueueAndCorrelationId,
+                                     bslh::Hash<bmqt::MessageGUIDHashAlgo> >
         CorrelationIdsMap;
 
-    typedef bmqc::OrderedHashMap<bmqt::MessageGUID, bsls::TimeInterval>
+    typedef bmqc::FlatOrderedHashMap<bmqt::MessageGUID,
+                                     bsls::TimeInterval,
+                                     bslh::Hash<bmqt::MessageGUIDHashAlgo> >
         HandleAndExpirationTimeMap;
 
     /// Map of key (queueId) to an ordered map of handle (message GUID and
@@ -128,6 +145,11 @@ class MessageCorrelationIdContainer {
     mutable bsls::SpinLock d_lock;  // Spin lock for manipulating data
                                     // members
 
+    bdlma::ConcurrentMultipoolAllocator d_pool;
+    // Pool supplying the memory of the
+    // items.  Must be declared before the
+    // containers using it.
+
     CorrelationIdsMap d_correlationIds;
     // Map of all registered items.
 
@@ -140,9 +162,6 @@ class MessageCorrelationIdContainer {
     size_t d_numControls;
     // Number of pending control requests.
 
-    bslma::Allocator* d_allocator_p;
-    // Allocator to use.
-
   private:
     /// Remove the item pointed by the specifed `cit` from the
     /// `d_correlationIds`.  If the item is PUT message with `ACK_REQUESTED`
@@ -166,9 +185,9 @@ class MessageCorrelationIdContainer {
     /// Remove an item from the `d_queueItems` container using the specified
     /// `queueId` as a key to find the per queue items map and then remove
     /// an item using the specified `itemGUID` as a key of that second map.
-    /// If the removed item is the last one in the items map then also
-    /// remove the entry from the first map that has the `queueId` as a key.
-    /// The behavior is underfined if there is no item with `queueId` key in
+    /// Note that the entry of the first map is kept when the removed item
+    /// is the last one in the items map, so that the memory of the items
+    /// map is reused by the next items of the queue.  The behavior is underfined if there is no item with `queueId` key in
     /// the first map or with `itemGUID` in the second map.
     void removeQueueItem(const bmqp::QueueId&     queueId,
                          const bmqt::MessageGUID& itemGUID);
@@ -239,7 +258,10 @@ class MessageCorrelationIdContainer {
     /// time less or equal to the specified `expirationTime`.  The
     /// expiration time is calculated by adding the queue expiration timeout
     /// from the specified `queueExpirationTimeoutMap` and the item's sent
-    /// time.  Return a timestamp of the next nearest expired item.
+    /// time.  All the items of a queue absent from
+    /// `queueExpirationTimeoutMap` are expired, and its entry is removed
+    /// once it has no more items.  Return a timestamp of the next nearest
+    /// expired item.
     bsls::TimeInterval getExpiredIds(
         bsl::vector<bmqt::MessageGUID>*     keys,
         const bsl::unordered_map<int, int>& queueExpirationTimeoutMap,
@@ -22,11 +22,15 @@
 #include <bmqt_messageguid.h>
 
 // BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlf_bind.h>
 #include <bsl_functional.h>
 #include <bsl_unordered_map.h>
 #include <bsl_vector.h>
 #include <bslma_allocator.h>
+#include <bslma_testallocator.h>
 
 // TEST DRIVER
 #include <bmqtst_testhelper.h>
@@ -216,6 +220,79 @@ static void test3_associate()
     }
 }
 
+static void test4_steadyStateAllocations()
+// ------------------------------------------------------------------------
+// STEADY STATE ALLOCATIONS
+//
+// Concerns:
+//   Once the container has held a window of pending PUT messages, tracking
+//   and releasing the same number of messages again does not allocate
+//   memory from the allocator supplied at construction.
+//
+// Plan:
+//   1. Add, associate with message data, and remove a window of PUT
+//      messages requesting an ACK.
+//   2. Repeat with new messages and verify no memory is allocated.
+//
+// Testing:
+//   add
+//   associateMessageData
+//   remove
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("STEADY STATE ALLOCATIONS");
+
+    const int k_WINDOW = 1000;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        256,
+        bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob appData(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+    bdlbb::BlobUtil::append(&appData, "abcdefgh", 8);
+
+    bslma::TestAllocator                  ta("container");
+    bmqimp::MessageCorrelationIdContainer container(&ta);
+
+    bsl::vector<bmqt::MessageGUID> guids(bmqtst::TestHelperUtil::allocator());
+    guids.resize(k_WINDOW);
+
+    bsls::Types::Int64 numAllocations = 0;
+
+    for (int round = 0; round < 3; ++round) {
+        PVV("Round " << round);
+
+        for (int i = 0; i < k_WINDOW; ++i) {
+            guids[i] = bmqp::MessageGUIDGenerator::testGUID();
+
+            bmqp::PutHeader header;
+            header.setMessageGUID(guids[i]).setQueueId(1).setFlags(
+                bmqp::PutHeaderFlags::e_ACK_REQUESTED);
+
+            container.add(guids[i], bmqt::CorrelationId(i), bmqp::QueueId(1));
+            container.associateMessageData(header,
+                                           appData,
+                                           bsls::TimeInterval(i));
+        }
+        BMQTST_ASSERT_EQ(container.size(), static_cast<size_t>(k_WINDOW));
+        BMQTST_ASSERT_EQ(container.numberOfPuts(),
+                         static_cast<size_t>(k_WINDOW));
+
+        for (int i = 0; i < k_WINDOW; ++i) {
+            bmqt::CorrelationId corrId;
+            BMQTST_ASSERT_EQ_D(i, container.remove(guids[i], &corrId), 0);
+            BMQTST_ASSERT_EQ_D(i, corrId, bmqt::CorrelationId(i));
+        }
+        BMQTST_ASSERT_EQ(container.size(), 0U);
+
+        if (round == 0) {
+            numAllocations = ta.numAllocations();
+        }
+        else {
+            BMQTST_ASSERT_EQ_D(round, ta.numAllocations(), numAllocations);
+        }
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -226,6 +303,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 4: test4_steadyStateAllocations(); break;
     case 3: test3_associate(); break;
     case 2: test2_iterateAndInvoke(); break;
     case 1: test1_addFindRemove(); break;
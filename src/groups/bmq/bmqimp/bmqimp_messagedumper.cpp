@@ -98,6 +98,8 @@ MessageDumper::DumpContext::DumpContext()
 : d_isEnabled(false)
 , d_actionType(static_cast<int>(bmqp_ctrlmsg::DumpActionType::E_OFF))
 , d_actionValue(0)
+, d_sampleEvery(1)
+, d_numSeen(0)
 {
     // NOTHING
 }
@@ -108,6 +110,8 @@ void MessageDumper::DumpContext::reset()
     d_isEnabled   = false;
     d_actionType  = static_cast<int>(bmqp_ctrlmsg::DumpActionType::E_OFF);
     d_actionValue = 0;
+    d_sampleEvery = 1;
+    d_numSeen     = 0;
 }
 
 // -------------
@@ -117,10 +121,15 @@ void MessageDumper::DumpContext::reset()
 // PRIVATE MANIPULATORS
 void MessageDumper::processDumpMessageHelper(
     DumpContext*                      dumpContext,
-    const bmqp_ctrlmsg::DumpMessages& dumpMsg)
+    const bmqp_ctrlmsg::DumpMessages& dumpMsg,
+    int                               sampleEvery)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(dumpContext && "'dumpContext' must be specified");
+    BSLS_ASSERT_SAFE(sampleEvery >= 1);
+
+    dumpContext->d_sampleEvery = sampleEvery;
+    dumpContext->d_numSeen     = 0;
 
     switch (dumpMsg.dumpActionType()) {
     case bmqp_ctrlmsg::DumpActionType::E_ON: {
@@ -161,10 +170,20 @@ void MessageDumper::processDumpMessageHelper(
 int MessageDumper::parseCommand(
     bmqp_ctrlmsg::DumpMessages* dumpMessagesCommand,
     const bslstl::StringRef&    command)
+{
+    int sampleEvery = 1;
+    return parseCommand(dumpMessagesCommand, &sampleEvery, command);
+}
+
+int MessageDumper::parseCommand(
+    bmqp_ctrlmsg::DumpMessages* dumpMessagesCommand,
+    int*                        sampleEvery,
+    const bslstl::StringRef&    command)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(dumpMessagesCommand &&
                      "'dumpMessagesCommand' must be provided");
+    BSLS_ASSERT_SAFE(sampleEvery && "'sampleEvery' must be provided");
 
     enum RcEnum {
         // Value for the various RC error categories
@@ -172,7 +191,8 @@ int MessageDumper::parseCommand(
         rc_INVALID_MSGTYPE          = -1,
         rc_MISSING_ACTIONTYPE       = -2,
         rc_INVALID_ACTIONTYPE       = -3,
-        rc_INVALID_ACTIONTYPE_VALUE = -4
+        rc_INVALID_ACTIONTYPE_VALUE = -4,
+        rc_INVALID_SAMPLING         = -5
     };
 
     bsl::istringstream sstr(command);
@@ -240,6 +260,32 @@ int MessageDumper::parseCommand(
         dumpMessagesCommand->dumpActionValue() = dumpActionValue;
     }
 
+    // 3. Extract and validate optional third parameter (Sampling): sample 50
+    *sampleEvery = 1;
+
+    bsl::string samplingStr = "";
+    sstr >> samplingStr;
+
+    if (sstr.fail()) {
+        // No sampling specified: dump every message
+        return rc_SUCCESS;  // RETURN
+    }
+
+    bsl::string sampleEveryStr = "";
+    sstr >> sampleEveryStr;
+
+    const int sampleEveryValue = bsl::atoi(sampleEveryStr.c_str());
+    if (!bdlb::String::areEqualCaseless(samplingStr, "sample") ||
+        sampleEveryValue <= 0) {
+        BALL_LOG_WARN << "Invalid message dumping command: "
+                      << "expected 'sample' followed by a positive numeric "
+                      << "value, got '" << samplingStr << " "
+                      << sampleEveryStr << "'";
+        return rc_INVALID_SAMPLING;  // RETURN
+    }
+
+    *sampleEvery = sampleEveryValue;
+
     return rc_SUCCESS;
 }
 
@@ -266,8 +312,12 @@ MessageDumper::MessageDumper(
 
 // MANIPULATORS
 int MessageDumper::processDumpCommand(
-    const bmqp_ctrlmsg::DumpMessages& command)
+    const bmqp_ctrlmsg::DumpMessages& command,
+    int                               sampleEvery)
 {
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(sampleEvery >= 1);
+
     enum RcEnum {
         // Value for the various RC error categories
         rc_SUCCESS              = 0,
@@ -276,24 +326,24 @@ int MessageDumper::processDumpCommand(
 
     switch (command.msgTypeToDump()) {
     case bmqp_ctrlmsg::DumpMsgType::E_INCOMING: {
-        processDumpMessageHelper(&d_pushContext, command);
-        processDumpMessageHelper(&d_ackContext, command);
+        processDumpMessageHelper(&d_pushContext, command, sampleEvery);
+        processDumpMessageHelper(&d_ackContext, command, sampleEvery);
     } break;  // BREAK
     case bmqp_ctrlmsg::DumpMsgType::E_OUTGOING: {
-        processDumpMessageHelper(&d_putContext, command);
-        processDumpMessageHelper(&d_confirmContext, command);
+        processDumpMessageHelper(&d_putContext, command, sampleEvery);
+        processDumpMessageHelper(&d_confirmContext, command, sampleEvery);
     } break;  // BREAK
     case bmqp_ctrlmsg::DumpMsgType::E_PUSH: {
-        processDumpMessageHelper(&d_pushContext, command);
+        processDumpMessageHelper(&d_pushContext, command, sampleEvery);
     } break;  // BREAK
     case bmqp_ctrlmsg::DumpMsgType::E_ACK: {
-        processDumpMessageHelper(&d_ackContext, command);
+        processDumpMessageHelper(&d_ackContext, command, sampleEvery);
     } break;  // BREAK
     case bmqp_ctrlmsg::DumpMsgType::E_PUT: {
-        processDumpMessageHelper(&d_putContext, command);
+        processDumpMessageHelper(&d_putContext, command, sampleEvery);
     } break;  // BREAK
     case bmqp_ctrlmsg::DumpMsgType::E_CONFIRM: {
-        processDumpMessageHelper(&d_confirmContext, command);
+        processDumpMessageHelper(&d_confirmContext, command, sampleEvery);
     } break;  // BREAK
     default: {
         BALL_LOG_ERROR << "Received an invalid dump message: "
@@ -336,6 +386,11 @@ void MessageDumper::dumpPushEvent(bsl::ostream& out, const bmqp::Event& event)
     int msgNum = 0;
     int rc     = 0;
     while ((rc = iter.next()) == 1) {
+        ++msgNum;
+        if (!isMessageSampled(&d_pushContext)) {
+            continue;  // CONTINUE
+        }
+
         int                 qId = bmqimp::Queue::k_INVALID_QUEUE_ID;
         unsigned int        subscriptionId;
         bmqp::RdaInfo       rdaInfo;
@@ -352,7 +407,7 @@ void MessageDumper::dumpPushEvent(bsl::ostream& out, const bmqp::Event& event)
                 subscriptionId);
         BSLS_ASSERT_SAFE(queue);
 
-        out << "PUSH Message #" << ++msgNum << ": "
+        out << "PUSH Message #" << msgNum << ": "
             << "[messageGUID: " << iter.header().messageGUID()
             << ", queue: " << queue->uri()
             << ", queueId: " << bmqp::QueueId(qId, queue->subQueueId())
@@ -409,9 +464,14 @@ void MessageDumper::dumpAckEvent(bsl::ostream& out, const bmqp::Event& event)
     bmqt::CorrelationId correlationId;
     int                 msgNum = 0;
     while (iter.next() == 1) {
+        ++msgNum;
+        if (!isMessageSampled(&d_ackContext)) {
+            continue;  // CONTINUE
+        }
+
         d_messageCorrelationIdContainer_p->find(&correlationId,
                                                 iter.message().messageGUID());
-        out << "ACK Message #" << ++msgNum << ": "
+        out << "ACK Message #" << msgNum << ": "
             << "[correlationId: " << correlationId << ", status: "
             << bmqp::ProtocolUtil::ackResultFromCode(iter.message().status())
             << ", messageGUID: " << iter.message().messageGUID() << "]"
@@ -446,12 +506,17 @@ void MessageDumper::dumpPutEvent(bsl::ostream&             out,
     bmqt::CorrelationId correlationId;
     int                 msgNum = 0;
     while (iter.next() == 1) {
+        ++msgNum;
+        if (!isMessageSampled(&d_putContext)) {
+            continue;  // CONTINUE
+        }
+
         BSLA_MAYBE_UNUSED int rc = d_messageCorrelationIdContainer_p->find(
             &correlationId,
             iter.header().messageGUID());
         BSLS_ASSERT_SAFE((rc == 0) && "correlationId not found");
 
-        out << "PUT Message #" << ++msgNum << ": "
+        out << "PUT Message #" << msgNum << ": "
             << "[correlationId: " << correlationId << ", queue: "
             << d_queueManager_p
                    ->lookupQueue(bmqp::QueueId(iter.header().queueId()))
@@ -501,11 +566,16 @@ void MessageDumper::dumpConfirmEvent(bsl::ostream&      out,
 
     int msgNum = 0;
     while (iter.next() == 1) {
+        ++msgNum;
+        if (!isMessageSampled(&d_confirmContext)) {
+            continue;  // CONTINUE
+        }
+
         const bmqp::ConfirmMessage& confirmMsg = iter.message();
         const bmqp::QueueId         queueId(confirmMsg.queueId(),
                                     confirmMsg.subQueueId());
 
-        out << "CONFIRM Message #" << ++msgNum << ": "
+        out << "CONFIRM Message #" << msgNum << ": "
             << "[messageGUID: " << confirmMsg.messageGUID()
             << ", queue: " << d_queueManager_p->lookupQueue(queueId)->uri()
             << ", queueId: " << queueId << "]"
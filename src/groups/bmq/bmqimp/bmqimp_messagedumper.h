@@ -89,6 +89,16 @@ class MessageDumper BSLS_CPP11_FINAL {
         // incoming messages will be dumped,
         // etc.)
 
+        bsls::AtomicInt d_sampleEvery;
+        // Dump only one out of every
+        // 'd_sampleEvery' messages; 1 means
+        // every message is dumped
+
+        bsls::AtomicInt64 d_numSeen;
+        // Number of messages seen while
+        // sampling, used to select the
+        // messages to dump
+
         // CREATORS
 
         /// Create a `bmqimp::MessageDumper::DumpContext` object with dump
@@ -150,10 +160,19 @@ class MessageDumper BSLS_CPP11_FINAL {
     /// dump has been exhausted, otherwise do nothing and return false.
     bool decrementMessageCount(DumpContext* dumpContext);
 
+    /// Return true if the next message seen by the specified `dumpContext`
+    /// is selected by its sampling interval and should be dumped, and false
+    /// otherwise.  Note that, unless a sampling interval greater than one
+    /// was configured, every message is selected.
+    bool isMessageSampled(DumpContext* dumpContext);
+
     /// Update the dump action context parameters pointed to by the
-    /// specified `dumpContext` as per the specified `dumpMsg`.
-    void processDumpMessageHelper(DumpContext* dumpContext,
-                                  const bmqp_ctrlmsg::DumpMessages& dumpMsg);
+    /// specified `dumpContext` as per the specified `dumpMsg` and dumping
+    /// one out of every specified `sampleEvery` messages.
+    void
+    processDumpMessageHelper(DumpContext*                      dumpContext,
+                             const bmqp_ctrlmsg::DumpMessages& dumpMsg,
+                             int                               sampleEvery);
 
   public:
     // TRAITS
@@ -189,6 +208,28 @@ class MessageDumper BSLS_CPP11_FINAL {
     static int parseCommand(bmqp_ctrlmsg::DumpMessages* dumpMessagesCommand,
                             const bslstl::StringRef&    command);
 
+    /// Load into the specified `dumpMessagesCommand` the associated command
+    /// for dumping messages, and into the specified `sampleEvery` the
+    /// sampling interval, parsed from the specified `command` according to
+    /// the following pattern:
+    /// ```
+    ///  IN|OUT|PUSH|ACK|PUT|CONFIRM ON|OFF|100|10s [SAMPLE 50]
+    /// ```
+    /// where the first two tokens have the same meaning as in the
+    /// `parseCommand` overload above, and the optional `SAMPLE 50` suffix
+    /// restricts dumping to one out of every 50 messages.  Above, the
+    /// numerical value `50` is just for illustration purposes, and client
+    /// can choose an appropriate positive numeric value for it.  If the
+    /// suffix is omitted, `sampleEvery` is set to 1, meaning every message
+    /// is dumped.  Return zero if `command` is valid and both
+    /// `dumpMessagesCommand` and `sampleEvery` have been populated, and
+    /// non-zero otherwise.  Note that sampling lets message dumping stay
+    /// on for a high-throughput queue without formatting every message on
+    /// the session's thread.
+    static int parseCommand(bmqp_ctrlmsg::DumpMessages* dumpMessagesCommand,
+                            int*                        sampleEvery,
+                            const bslstl::StringRef&    command);
+
     // CREATORS
 
     /// Create a `bmqimp::MessageDumper` object using the specified
@@ -200,10 +241,13 @@ class MessageDumper BSLS_CPP11_FINAL {
                   bslma::Allocator*              allocator);
 
     // MANIPULATORS
-    int processDumpCommand(const bmqp_ctrlmsg::DumpMessages& command);
-    // Process the specified dump 'command'.  Update the state of this
-    // object and return 0 if successful, otherwise do nothing and return
-    // non-zero error code.
+    int processDumpCommand(const bmqp_ctrlmsg::DumpMessages& command,
+                           int                               sampleEvery = 1);
+    // Process the specified dump 'command', dumping only one out of every
+    // optionally specified 'sampleEvery' messages (every message by
+    // default).  Update the state of this object and return 0 if
+    // successful, otherwise do nothing and return non-zero error code.
+    // The behavior is undefined unless '1 <= sampleEvery'.
 
     void reset();
     // Reset the state of this object to its default state, thus
@@ -308,6 +352,19 @@ inline bool MessageDumper::decrementMessageCount(DumpContext* dumpContext)
     return (dumpContext->d_actionValue <= 0);
 }
 
+inline bool MessageDumper::isMessageSampled(DumpContext* dumpContext)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dumpContext);
+
+    const int sampleEvery = dumpContext->d_sampleEvery;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(sampleEvery <= 1)) {
+        return true;  // RETURN
+    }
+
+    return (dumpContext->d_numSeen++ % sampleEvery) == 0;
+}
+
 // ACCESSORS
 template <bmqp::EventType::Enum type>
 inline bool MessageDumper::isEventDumpEnabled() const
@@ -349,13 +349,16 @@ Tester::~Tester()
 int Tester::processDumpCommand(const bslstl::StringRef& command)
 {
     bmqp_ctrlmsg::DumpMessages dumpMessagesCommand;
+    int                        sampleEvery = 1;
 
     int rc = bmqimp::MessageDumper::parseCommand(&dumpMessagesCommand,
+                                                 &sampleEvery,
                                                  command);
     BSLS_ASSERT_SAFE(rc == 0);
     static_cast<void>(rc);  // suppress 'unused variable' warning
 
-    return d_messageDumper.processDumpCommand(dumpMessagesCommand);
+    return d_messageDumper.processDumpCommand(dumpMessagesCommand,
+                                              sampleEvery);
 }
 
 void Tester::reset()
@@ -1804,6 +1807,128 @@ static void test9_dumpConfirmEvent()
                      false);
 }
 
+static void test10_sampling()
+// ------------------------------------------------------------------------
+// SAMPLING
+//
+// Concerns:
+//   1. A dump command may carry an optional 'SAMPLE K' suffix, which is
+//      parsed into the sampling interval, and an invalid suffix is
+//      rejected.
+//   2. Dumping an event with a sampling interval of K outputs only one out
+//      of every K messages, and a message count applies to the messages
+//      actually dumped.
+//
+// Plan:
+//   1. Parse various valid and invalid dump commands with a sampling
+//      suffix and verify the return code and the sampling interval.
+//   2. Process a dump command of 'CONFIRM 2 SAMPLE 3' and build an event
+//      with seven CONFIRM messages.
+//   3. Dump the CONFIRM event and verify that only messages #1 and #4
+//      were dumped, and that dumping of CONFIRM events is then no longer
+//      enabled.
+//
+// Testing:
+//   parseCommand
+//   dumpConfirmEvent
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // QueueManager's 'generateQueueAndSubQueueId' method creates a
+    // temporary string using the default allocator when performing queue
+    // lookup by canonical URI
+
+    bmqtst::TestHelper::printTestName("SAMPLING");
+
+    // 1. Parse various valid and invalid dump commands with a sampling
+    //    suffix and verify the return code and the sampling interval.
+    struct Test {
+        int         d_line;
+        const char* d_command;
+        int         d_expectedRc;
+        int         d_expectedSampleEvery;
+    } k_DATA[] = {{L_, "PUSH ON", 0, 1},
+                  {L_, "PUSH ON SAMPLE 100", 0, 100},
+                  {L_, "in 10s sample 7", 0, 7},
+                  {L_, "ACK 5 SaMpLe 1", 0, 1},
+                  {L_, "PUT ON SAMPLE", -5, 1},
+                  {L_, "PUT ON SAMPLE 0", -5, 1},
+                  {L_, "PUT ON EVERY 10", -5, 1}};
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const Test& test = k_DATA[idx];
+
+        PVV(test.d_line << ": parsing dump command: [command: "
+                        << test.d_command
+                        << "], expecting return code: " << test.d_expectedRc);
+
+        bmqp_ctrlmsg::DumpMessages dumpMessagesCommand;
+        int                        sampleEvery = 0;
+
+        int rc = bmqimp::MessageDumper::parseCommand(&dumpMessagesCommand,
+                                                     &sampleEvery,
+                                                     test.d_command);
+        BMQTST_ASSERT_EQ_D(test.d_line, rc, test.d_expectedRc);
+        if (rc == 0) {
+            BMQTST_ASSERT_EQ_D(test.d_line,
+                               sampleEvery,
+                               test.d_expectedSampleEvery);
+        }
+    }
+
+    Tester tester(bmqtst::TestHelperUtil::allocator());
+
+    tester.insertQueue("bmq://bmq.test.mmap.priority/q1");
+    tester.insertQueue("bmq://bmq.test.mmap.priority/q2");
+
+    // 2. Process a dump command of 'CONFIRM 2 SAMPLE 3' and build an event
+    //    with seven CONFIRM messages.
+    tester.processDumpCommand("CONFIRM 2 SAMPLE 3");
+
+    tester.appendConfirmMessage("bmq://bmq.test.mmap.priority/q1");
+    tester.appendConfirmMessage("bmq://bmq.test.mmap.priority/q2");
+    tester.appendConfirmMessage("bmq://bmq.test.mmap.priority/q2");
+    tester.appendConfirmMessage("bmq://bmq.test.mmap.priority/q1");
+    tester.appendConfirmMessage("bmq://bmq.test.mmap.priority/q2");
+    tester.appendConfirmMessage("bmq://bmq.test.mmap.priority/q2");
+    tester.appendConfirmMessage("bmq://bmq.test.mmap.priority/q1");
+
+    // 3. Dump the CONFIRM event and verify that only messages #1 and #4
+    //    were dumped, and that dumping of CONFIRM events is then no longer
+    //    enabled.
+    bmqu::MemOutStream out(bmqtst::TestHelperUtil::allocator());
+    bmqp::Event        event(bmqtst::TestHelperUtil::allocator());
+
+    tester.confirmEvent(&event);
+    tester.dumpConfirmEvent(out, event);
+
+    PVV(L_ << ": CONFIRM event dump: " << out.str());
+
+    BMQTST_ASSERT_EQ(regexMatch(out.str(),
+                                "CONFIRM Message #1:.*"
+                                "queue: bmq://bmq.test.mmap.priority/q1",
+                                bmqtst::TestHelperUtil::allocator()),
+                     true);
+    BMQTST_ASSERT_EQ(regexMatch(out.str(),
+                                "CONFIRM Message #4:.*"
+                                "queue: bmq://bmq.test.mmap.priority/q1",
+                                bmqtst::TestHelperUtil::allocator()),
+                     true);
+    BMQTST_ASSERT_EQ(regexMatch(out.str(),
+                                "CONFIRM Message #[235]:.*",
+                                bmqtst::TestHelperUtil::allocator()),
+                     false);
+    BMQTST_ASSERT_EQ(regexMatch(out.str(),
+                                "CONFIRM Message #7:.*",
+                                bmqtst::TestHelperUtil::allocator()),
+                     false);
+
+    BMQTST_ASSERT_EQ(tester.isEventDumpEnabled(bmqp::EventType::e_CONFIRM),
+                     false);
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -1814,6 +1939,7 @@ int main(int argc, char** argv)
 
     switch (_testCase) {
     case 0:
+    case 10: test10_sampling(); break;
     case 9: test9_dumpConfirmEvent(); break;
     case 8: test8_dumpPutEvent(); break;
     case 7: test7_dumpAckEvent(); break;
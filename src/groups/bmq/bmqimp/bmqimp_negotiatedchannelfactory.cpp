@@ -19,6 +19,7 @@
 // BMQ
 #include <bmqp_event.h>
 #include <bmqp_protocol.h>
+#include <bmqp_protocolutil.h>
 #include <bmqp_schemaeventbuilder.h>
 
 #include <bmqio_channelutil.h>
@@ -101,6 +102,13 @@ const char* NegotiatedChannelFactory::k_CHANNEL_PROPERTY_MPS_EX =
 const char* NegotiatedChannelFactory::k_CHANNEL_PROPERTY_CONFIGURE_STREAM =
     "broker.response.configure_stream";
 
+const char*
+    NegotiatedChannelFactory::k_CHANNEL_PROPERTY_COMPRESSION_ALGORITHMS =
+        "broker.response.compression_algorithms";
+
+const char* NegotiatedChannelFactory::k_CHANNEL_PROPERTY_TRACE_CONTEXT =
+    "broker.response.trace_context";
+
 const char*
     NegotiatedChannelFactory::k_CHANNEL_PROPERTY_HEARTBEAT_INTERVAL_MS =
         "broker.response.heartbeat_interval_ms";
@@ -343,6 +351,18 @@ void NegotiatedChannelFactory::onBrokerNegotiationResponse(
         channel->properties().set(k_CHANNEL_PROPERTY_CONFIGURE_STREAM, 1);
     }
 
+    channel->properties().set(
+        k_CHANNEL_PROPERTY_COMPRESSION_ALGORITHMS,
+        bmqp::ProtocolUtil::compressionAlgorithms(
+            brokerResponse.brokerIdentity().features()));
+
+    if (bmqp::ProtocolUtil::hasFeature(
+            bmqp::TracingFeatures::k_FIELD_NAME,
+            bmqp::TracingFeatures::k_TRACE_CONTEXT,
+            brokerResponse.brokerIdentity().features())) {
+        channel->properties().set(k_CHANNEL_PROPERTY_TRACE_CONTEXT, 1);
+    }
+
     channel->properties().set(k_CHANNEL_PROPERTY_HEARTBEAT_INTERVAL_MS,
                               brokerResponse.heartbeatIntervalMs());
     channel->properties().set(k_CHANNEL_PROPERTY_MAX_MISSED_HEARTBEATS,
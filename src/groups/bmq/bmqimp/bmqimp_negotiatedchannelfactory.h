@@ -112,6 +112,15 @@ class NegotiatedChannelFactory : public bmqio::ChannelFactory {
     /// Temporary safety switch to control configure request.
     static const char* k_CHANNEL_PROPERTY_CONFIGURE_STREAM;
 
+    /// Name of a property set on the channel representing the mask of the
+    /// compression algorithms supported by the broker, as returned by
+    /// `bmqp::ProtocolUtil::compressionAlgorithms`.
+    static const char* k_CHANNEL_PROPERTY_COMPRESSION_ALGORITHMS;
+
+    /// Name of a property set on the channel if the broker accepts a trace
+    /// context option on PUT messages.
+    static const char* k_CHANNEL_PROPERTY_TRACE_CONTEXT;
+
     static const char* k_CHANNEL_PROPERTY_HEARTBEAT_INTERVAL_MS;
 
     static const char* k_CHANNEL_PROPERTY_MAX_MISSED_HEARTBEATS;
@@ -165,7 +165,11 @@ void QueueStatsUtil::initializeStats(
     // ------------------------------
     bmqst::StatContextConfiguration config(k_STAT_NAME, &localAllocator);
     config.isTable(true);
-    config.value("in").value("out").value("compression_ratio");
+    // 'in' and 'out' are adjusted for every message, so accumulate them in
+    // per-thread cells folded at snapshot time.
+    config.value("in").valueSharded();
+    config.value("out").valueSharded();
+    config.value("compression_ratio");
     stat->d_statContext_mp = rootStatContext->addSubcontext(config);
 
     // Create table (with Delta stats)
@@ -323,8 +327,11 @@ Queue::Queue(bslma::Allocator* allocator)
 , d_stats_mp(0)
 , d_isSuspended(false)
 , d_isOldStyle(true)
+, d_compressionAlgorithms(bmqp::CompressionFeatures::k_DEFAULT_ALGORITHMS)
+, d_isTraceContextSupported(false)
 , d_isSuspendedWithBroker(false)
 , d_schemaGenerator(allocator)
+, d_unconfirmedWindow()
 , d_config(allocator)
 , d_registeredInternalSubscriptionIds(allocator)
 {
@@ -29,10 +29,14 @@
 
 // BMQ
 #include <bmqimp_stat.h>
+#include <bmqimp_unconfirmedwindow.h>
 
 #include <bmqp_ctrlmsg_messages.h>
+#include <bmqp_protocol.h>
+#include <bmqp_protocolutil.h>
 #include <bmqp_queueid.h>
 #include <bmqp_schemagenerator.h>
+#include <bmqt_compressionalgorithmtype.h>
 #include <bmqt_correlationid.h>
 #include <bmqt_queueflags.h>
 #include <bmqt_queueoptions.h>
@@ -241,12 +245,27 @@ class Queue {
     // Temporary; shall remove after 2nd
     // roll out of "new style" brokers.
 
+    bsls::AtomicInt d_compressionAlgorithms;
+    // Mask of the compression algorithms
+    // supported by the broker, as
+    // returned by 'bmqp::ProtocolUtil::
+    // compressionAlgorithms'.
+
+    bsls::AtomicBool d_isTraceContextSupported;
+    // Whether the broker accepts a trace
+    // context option on PUT messages.
+
     bool d_isSuspendedWithBroker;
     // Whether the queue is suspended from
     // the perspective of the broker.
 
     bmqp::SchemaGenerator d_schemaGenerator;
 
+    UnconfirmedWindow d_unconfirmedWindow;
+    // Window tuned by the session when the
+    // options of the queue enable
+    // 'adaptiveUnconfirmed'.
+
     bmqp_ctrlmsg::StreamParameters d_config;
 
     bsl::unordered_map<unsigned int, SubscriptionHandle>
@@ -305,6 +324,17 @@ class Queue {
     /// Temporary; shall remove after 2nd roll out of "new style" brokers.
     Queue& setOldStyle(bool value);
 
+    /// Set the mask of the compression algorithms supported by the broker
+    /// to the specified `value`, as returned by
+    /// `bmqp::ProtocolUtil::compressionAlgorithms`, and return a reference
+    /// offering modifiable access to this object.
+    Queue& setCompressionAlgorithms(int value);
+
+    /// Set whether the broker accepts a trace context option on PUT
+    /// messages to the specified `value` and return a reference offering
+    /// modifiable access to this object.
+    Queue& setTraceContextSupported(bool value);
+
     /// Create a new subcontext for this queue, out of the specified
     /// `parentStatContext`.  The behavior is undefined unless this method
     /// is called on valid queue in opened state.  The behavior is also
@@ -371,8 +401,21 @@ class Queue {
     bool                                  isOldStyle() const;
     const bmqp_ctrlmsg::StreamParameters& config() const;
 
+    /// Return true if the broker supports messages compressed with the
+    /// specified `algorithm`, and false otherwise.
+    bool isCompressionAlgorithmSupported(
+        bmqt::CompressionAlgorithmType::Enum algorithm) const;
+
+    /// Return true if the broker accepts a trace context option on PUT
+    /// messages, and false otherwise.
+    bool isTraceContextSupported() const;
+
     bmqp::SchemaGenerator& schemaGenerator();
 
+    /// Return a reference offering modifiable access to the unconfirmed
+    /// window of this queue.
+    UnconfirmedWindow& unconfirmedWindow();
+
     /// @brief Return whether this Queue is valid, i.e., is associated to an
     ///        opened queue.
     /// @param reason_p The optionally specified stream that is used to report
@@ -531,6 +574,18 @@ inline Queue& Queue::setOldStyle(bool value)
     return *this;
 }
 
+inline Queue& Queue::setCompressionAlgorithms(int value)
+{
+    d_compressionAlgorithms = value;
+    return *this;
+}
+
+inline Queue& Queue::setTraceContextSupported(bool value)
+{
+    d_isTraceContextSupported = value;
+    return *this;
+}
+
 inline Queue& Queue::setIsSuspendedWithBroker(bool value)
 {
     d_isSuspendedWithBroker = value;
@@ -657,6 +712,19 @@ inline bool Queue::isOldStyle() const
     return d_isOldStyle;
 }
 
+inline bool Queue::isCompressionAlgorithmSupported(
+    bmqt::CompressionAlgorithmType::Enum algorithm) const
+{
+    return bmqp::ProtocolUtil::isCompressionAlgorithmSupported(
+        d_compressionAlgorithms,
+        algorithm);
+}
+
+inline bool Queue::isTraceContextSupported() const
+{
+    return d_isTraceContextSupported;
+}
+
 inline bool Queue::isSuspendedWithBroker() const
 {
     return d_isSuspendedWithBroker;
@@ -672,6 +740,11 @@ inline bmqp::SchemaGenerator& Queue::schemaGenerator()
     return d_schemaGenerator;
 }
 
+inline UnconfirmedWindow& Queue::unconfirmedWindow()
+{
+    return d_unconfirmedWindow;
+}
+
 inline bool Queue::isValid(bsl::ostream* reason_p) const
 {
     const QueueState::Enum queueState = state();
@@ -307,6 +307,9 @@ void QueueManager::observePushEvent(Event*                          queueEvent,
     BSLS_ASSERT_SAFE(queue->id() == info.d_header.queueId());
 
     queue->statUpdateOnMessage(info.d_applicationDataSize, false);
+    if (queue->options().adaptiveUnconfirmed()) {
+        queue->unconfirmedWindow().onMessage(info.d_applicationDataSize);
+    }
 
     // Use 'subscriptionHandle' instead of the internal
     // 'info.d_subscriptionId' so that
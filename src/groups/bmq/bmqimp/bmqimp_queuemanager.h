@@ -205,7 +205,15 @@ class QueueManager {
     bsls::AtomicInt d_nextQueueId;
     // Next id for a new queue.  This value
     // is always incremented and never
-    // decremented.
+    // decremented.  Ids are not recycled
+    // so that a PUSH or ACK still in
+    // flight for a closed queue is never
+    // attributed to a newly opened one,
+    // which is also why queues are looked
+    // up by id in hash maps rather than
+    // in a table indexed by id: such a
+    // table would grow with every queue
+    // ever opened by the session.
 
     QueuesBySubscriptions d_queuesBySubscriptionIds;
     // When generated for the new configure
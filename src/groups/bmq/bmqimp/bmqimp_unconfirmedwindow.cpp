@@ -0,0 +1,175 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqimp_unconfirmedwindow.h>
+
+#include <bmqscm_version.h>
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdlib.h>
+
+namespace BloombergLP {
+namespace bmqimp {
+
+namespace {
+
+/// Multiple of the bandwidth-delay product targeted by the window.
+const int k_HEADROOM = 2;
+
+/// Divisor of the bounds giving the smallest window.
+const int k_MIN_WINDOW_DIVISOR = 16;
+
+/// Divisor of the current window giving the smallest change reported.
+const int k_SIGNIFICANT_CHANGE_DIVISOR = 4;
+
+/// Weight, out of 8, of the previous value in the smoothed round trip time.
+const int k_ROUND_TRIP_TIME_WEIGHT = 7;
+
+/// Return the window for the specified `bdp` bandwidth-delay product,
+/// clamped to the specified `bound`.
+int computeWindow(double bdp, int bound)
+{
+    const double target = bdp * k_HEADROOM;
+    const int    floor  = bsl::max(1, bound / k_MIN_WINDOW_DIVISOR);
+
+    int window = bound;
+    if (target < bound) {
+        window = static_cast<int>(bsl::ceil(target));
+    }
+
+    return bsl::min(bound, bsl::max(floor, window));
+}
+
+/// Return whether changing the window from the specified `from` value to the
+/// specified `to` value is significant.
+bool isSignificant(int from, int to)
+{
+    const bsls::Types::Int64 diff = bsl::abs(
+        static_cast<bsls::Types::Int64>(to) - from);
+
+    return diff != 0 && diff * k_SIGNIFICANT_CHANGE_DIVISOR >= from;
+}
+
+}  // close unnamed namespace
+
+// -----------------------
+// class UnconfirmedWindow
+// -----------------------
+
+// CREATORS
+UnconfirmedWindow::UnconfirmedWindow()
+: d_numMessages(0)
+, d_numBytes(0)
+, d_lastUpdateTime(0)
+, d_roundTripTime(0)
+, d_maxUnconfirmedMessages(0)
+, d_maxUnconfirmedBytes(0)
+, d_isActive(false)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+void UnconfirmedWindow::reset()
+{
+    d_numMessages            = 0;
+    d_numBytes               = 0;
+    d_lastUpdateTime         = 0;
+    d_roundTripTime          = 0;
+    d_maxUnconfirmedMessages = 0;
+    d_maxUnconfirmedBytes    = 0;
+    d_isActive               = false;
+}
+
+void UnconfirmedWindow::onRoundTrip(bsls::Types::Int64 roundTripTime)
+{
+    if (roundTripTime <= 0) {
+        return;  // RETURN
+    }
+
+    if (d_roundTripTime == 0) {
+        d_roundTripTime = roundTripTime;
+    }
+    else {
+        d_roundTripTime = (d_roundTripTime * k_ROUND_TRIP_TIME_WEIGHT +
+                           roundTripTime) /
+                          (k_ROUND_TRIP_TIME_WEIGHT + 1);
+    }
+}
+
+bool UnconfirmedWindow::update(bsls::Types::Int64 now,
+                               int                maxMessagesBound,
+                               int                maxBytesBound)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(maxMessagesBound >= 0);
+    BSLS_ASSERT_SAFE(maxBytesBound >= 0);
+
+    if (d_lastUpdateTime != 0 && now <= d_lastUpdateTime) {
+        return false;  // RETURN
+    }
+
+    const bsls::Types::Int64 elapsed     = now - d_lastUpdateTime;
+    const bool               isFirst     = d_lastUpdateTime == 0;
+    const bsls::Types::Int64 numMessages = d_numMessages;
+    const bsls::Types::Int64 numBytes    = d_numBytes;
+
+    d_numMessages    = 0;
+    d_numBytes       = 0;
+    d_lastUpdateTime = now;
+
+    if (isFirst || d_roundTripTime == 0 || numMessages == 0) {
+        // Nothing measured yet, or idle queue: keep the current window.
+        return false;  // RETURN
+    }
+
+    // The bandwidth-delay product is the number of messages (bytes) received
+    // over one round trip at the measured rate.
+    const double ratio = static_cast<double>(d_roundTripTime) /
+                         static_cast<double>(elapsed);
+
+    const int messages = computeWindow(static_cast<double>(numMessages) *
+                                           ratio,
+                                       maxMessagesBound);
+    const int bytes = computeWindow(static_cast<double>(numBytes) * ratio,
+                                    maxBytesBound);
+
+    if (d_isActive) {
+        // Bounds may have been lowered since the last update.
+        d_maxUnconfirmedMessages = bsl::min(d_maxUnconfirmedMessages,
+                                            maxMessagesBound);
+        d_maxUnconfirmedBytes = bsl::min(d_maxUnconfirmedBytes, maxBytesBound);
+    }
+
+    const int currentMessages = d_isActive ? d_maxUnconfirmedMessages
+                                           : maxMessagesBound;
+    const int currentBytes = d_isActive ? d_maxUnconfirmedBytes
+                                        : maxBytesBound;
+
+    if (!isSignificant(currentMessages, messages) &&
+        !isSignificant(currentBytes, bytes)) {
+        return false;  // RETURN
+    }
+
+    d_maxUnconfirmedMessages = messages;
+    d_maxUnconfirmedBytes    = bytes;
+    d_isActive               = true;
+
+    return true;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
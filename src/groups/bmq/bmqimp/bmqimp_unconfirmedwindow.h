@@ -0,0 +1,189 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BMQIMP_UNCONFIRMEDWINDOW
+#define INCLUDED_BMQIMP_UNCONFIRMEDWINDOW
+
+//@PURPOSE: Provide a mechanism to size the unconfirmed window of a queue.
+//
+//@CLASSES:
+//  bmqimp::UnconfirmedWindow: adaptive unconfirmed window of a queue
+//
+//@DESCRIPTION: 'bmqimp::UnconfirmedWindow' computes the number of messages
+// and bytes a consumer should allow the broker to deliver without
+// confirmation, based on the rate at which messages are received and the round
+// trip time to the broker.  The window targets twice the bandwidth-delay
+// product, so that a consumer limited by its window doubles it at every
+// update until either its processing rate or the user-specified bounds become
+// the limiting factor.  The window never shrinks below a sixteenth of the
+// bounds, and an update is only reported when the window changes by at least
+// a quarter of its current value, to avoid reconfiguring the queue for small
+// fluctuations.
+//
+/// Thread Safety
+///-------------
+// NOT thread safe.
+//
+/// Usage
+///-----
+// Report every received message with 'onMessage' and every measured round trip
+// with 'onRoundTrip', then periodically call 'update' with the bounds of the
+// window, and reconfigure the queue with the new window when it returns
+// 'true'.
+//..
+//  bmqimp::UnconfirmedWindow window;
+//  window.onRoundTrip(rtt);
+//  window.onMessage(messageSize);
+//  // ...
+//  if (window.update(bmqu::Time::highResolutionTimer(),
+//                    options.maxUnconfirmedMessages(),
+//                    options.maxUnconfirmedBytes())) {
+//      // Reconfigure with 'window.maxUnconfirmedMessages()' and
+//      // 'window.maxUnconfirmedBytes()'.
+//  }
+//..
+
+// BDE
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bmqimp {
+
+// =======================
+// class UnconfirmedWindow
+// =======================
+
+/// Mechanism computing the unconfirmed window of a queue from its measured
+/// consumption rate and round trip time.
+class UnconfirmedWindow {
+  private:
+    // DATA
+
+    /// Number of messages received since the last update.
+    bsls::Types::Int64 d_numMessages;
+
+    /// Number of bytes received since the last update.
+    bsls::Types::Int64 d_numBytes;
+
+    /// Time, in nanoseconds, of the last update, or 0 if none happened yet.
+    bsls::Types::Int64 d_lastUpdateTime;
+
+    /// Smoothed round trip time, in nanoseconds, or 0 if none was measured.
+    bsls::Types::Int64 d_roundTripTime;
+
+    /// Current window, in messages.  Only meaningful if `d_isActive`.
+    int d_maxUnconfirmedMessages;
+
+    /// Current window, in bytes.  Only meaningful if `d_isActive`.
+    int d_maxUnconfirmedBytes;
+
+    /// Whether a window has been computed since construction or the last
+    /// `reset`.
+    bool d_isActive;
+
+  public:
+    // CREATORS
+
+    /// Create an inactive `UnconfirmedWindow`.
+    UnconfirmedWindow();
+
+    // MANIPULATORS
+
+    /// Forget all measurements and the current window.
+    void reset();
+
+    /// Report the reception of a message of the specified `size` bytes.
+    void onMessage(int size);
+
+    /// Report a round trip to the broker which took the specified
+    /// `roundTripTime` nanoseconds.  Non-positive values are ignored.
+    void onRoundTrip(bsls::Types::Int64 roundTripTime);
+
+    /// Recompute the window from the measurements gathered since the last
+    /// call, at the specified `now` time in nanoseconds, within the
+    /// specified `maxMessagesBound` and `maxBytesBound`.  Return `true` if
+    /// the window changed significantly compared to the current one (or to
+    /// the bounds if the window is inactive), and `false` otherwise, in
+    /// which case the current window is left unchanged.  Note that the
+    /// window is kept while no message is received.
+    bool update(bsls::Types::Int64 now,
+                int                maxMessagesBound,
+                int                maxBytesBound);
+
+    // ACCESSORS
+
+    /// Return whether a window has been computed.
+    bool isActive() const;
+
+    /// Return the current window in messages.  The behavior is undefined
+    /// unless `isActive()`.
+    int maxUnconfirmedMessages() const;
+
+    /// Return the current window in bytes.  The behavior is undefined
+    /// unless `isActive()`.
+    int maxUnconfirmedBytes() const;
+
+    /// Return the smoothed round trip time in nanoseconds, or 0 if none
+    /// was measured.
+    bsls::Types::Int64 roundTripTime() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -----------------------
+// class UnconfirmedWindow
+// -----------------------
+
+// MANIPULATORS
+inline void UnconfirmedWindow::onMessage(int size)
+{
+    ++d_numMessages;
+    d_numBytes += size;
+}
+
+// ACCESSORS
+inline bool UnconfirmedWindow::isActive() const
+{
+    return d_isActive;
+}
+
+inline int UnconfirmedWindow::maxUnconfirmedMessages() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isActive);
+
+    return d_maxUnconfirmedMessages;
+}
+
+inline int UnconfirmedWindow::maxUnconfirmedBytes() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_isActive);
+
+    return d_maxUnconfirmedBytes;
+}
+
+inline bsls::Types::Int64 UnconfirmedWindow::roundTripTime() const
+{
+    return d_roundTripTime;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,219 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqimp_unconfirmedwindow.h>
+
+// BDE
+#include <bdlt_timeunitratio.h>
+#include <bsl_algorithm.h>
+#include <bsl_ios.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+namespace {
+
+const bsls::Types::Int64 k_NS_PER_MS =
+    bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MILLISECOND;
+
+const bsls::Types::Int64 k_NS_PER_S =
+    bdlt::TimeUnitRatio::k_NANOSECONDS_PER_SECOND;
+
+/// Report the specified `numMessages` messages of the specified `size` to
+/// the specified `window`.
+void receive(bmqimp::UnconfirmedWindow* window, int numMessages, int size)
+{
+    for (int i = 0; i < numMessages; ++i) {
+        window->onMessage(size);
+    }
+}
+
+static void test1_breathingTest()
+// --------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise the basic functionality of the component.
+//
+// Plan:
+//   1) Verify the window stays inactive until a round trip time and a
+//      rate have been measured.
+//   2) Verify the window is sized from the bandwidth-delay product.
+//
+// Testing:
+//   Basic functionality
+// --------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    bmqimp::UnconfirmedWindow obj;
+    BMQTST_ASSERT(!obj.isActive());
+    BMQTST_ASSERT_EQ(obj.roundTripTime(), 0);
+
+    PV("No round trip time measured");
+    BMQTST_ASSERT(!obj.update(k_NS_PER_S, 1000, 1000000));
+    receive(&obj, 100, 100);
+    BMQTST_ASSERT(!obj.update(2 * k_NS_PER_S, 1000, 1000000));
+    BMQTST_ASSERT(!obj.isActive());
+
+    PV("Round trip time measured");
+    obj.onRoundTrip(10 * k_NS_PER_MS);
+    BMQTST_ASSERT_EQ(obj.roundTripTime(), 10 * k_NS_PER_MS);
+
+    // 1000 messages of 100 bytes per second over 10ms is a bandwidth-delay
+    // product of 10 messages and 1000 bytes, doubled for headroom.  The
+    // messages window is clamped to the minimum of 1000 / 16.
+    receive(&obj, 1000, 100);
+    BMQTST_ASSERT(obj.update(3 * k_NS_PER_S, 1000, 1000000));
+    BMQTST_ASSERT(obj.isActive());
+    BMQTST_ASSERT_EQ(obj.maxUnconfirmedMessages(), 1000 / 16);
+    BMQTST_ASSERT_EQ(obj.maxUnconfirmedBytes(), 1000000 / 16);
+
+    PV("Idle queue");
+    BMQTST_ASSERT(!obj.update(4 * k_NS_PER_S, 1000, 1000000));
+    BMQTST_ASSERT_EQ(obj.maxUnconfirmedMessages(), 1000 / 16);
+
+    PV("Reset");
+    obj.reset();
+    BMQTST_ASSERT(!obj.isActive());
+    BMQTST_ASSERT_EQ(obj.roundTripTime(), 0);
+}
+
+static void test2_growthTest()
+// --------------------------------------------------------------------
+// GROWTH TEST
+//
+// Concerns:
+//   A consumer limited by its window grows it up to the bounds.
+//
+// Plan:
+//   1) Simulate a consumer receiving a full window per round trip and
+//      verify the window doubles at every update, up to the bounds.
+//
+// Testing:
+//   update
+// --------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("GROWTH TEST");
+
+    const int                k_MAX_MESSAGES = 1024;
+    const int                k_MAX_BYTES    = 1024 * 1024;
+    const bsls::Types::Int64 k_RTT          = 100 * k_NS_PER_MS;
+
+    bmqimp::UnconfirmedWindow obj;
+    obj.onRoundTrip(k_RTT);
+
+    bsls::Types::Int64 now = k_NS_PER_S;
+    BMQTST_ASSERT(!obj.update(now, k_MAX_MESSAGES, k_MAX_BYTES));
+
+    // Receive at a rate of 'k_MAX_MESSAGES / 16' per round trip.
+    int window = k_MAX_MESSAGES / 16;
+    receive(&obj, window * 10, 10);
+    now += k_NS_PER_S;
+    BMQTST_ASSERT(obj.update(now, k_MAX_MESSAGES, k_MAX_BYTES));
+    BMQTST_ASSERT_EQ(obj.maxUnconfirmedMessages(), 2 * window);
+
+    while (window < k_MAX_MESSAGES) {
+        window = obj.maxUnconfirmedMessages();
+        receive(&obj, window * 10, 10);
+        now += k_NS_PER_S;
+
+        const bool changed = obj.update(now, k_MAX_MESSAGES, k_MAX_BYTES);
+        if (window == k_MAX_MESSAGES) {
+            BMQTST_ASSERT(!changed);
+        }
+        else {
+            BMQTST_ASSERT(changed);
+            BMQTST_ASSERT_EQ(obj.maxUnconfirmedMessages(),
+                             bsl::min(2 * window, k_MAX_MESSAGES));
+        }
+    }
+
+    PV("Small fluctuations are not reported");
+    // A bandwidth-delay product of 450 messages targets a window of 900.
+    receive(&obj, 4500, 10);
+    now += k_NS_PER_S;
+    BMQTST_ASSERT(!obj.update(now, k_MAX_MESSAGES, k_MAX_BYTES));
+    BMQTST_ASSERT_EQ(obj.maxUnconfirmedMessages(), k_MAX_MESSAGES);
+
+    PV("Lower bounds are honored");
+    // The window is clamped to the new bounds, which the broker already
+    // uses, so this is not reported as a change.
+    receive(&obj, k_MAX_MESSAGES * 10, 10);
+    now += k_NS_PER_S;
+    BMQTST_ASSERT(!obj.update(now, k_MAX_MESSAGES / 2, k_MAX_BYTES));
+    BMQTST_ASSERT_EQ(obj.maxUnconfirmedMessages(), k_MAX_MESSAGES / 2);
+}
+
+static void test3_roundTripTimeTest()
+// --------------------------------------------------------------------
+// ROUND TRIP TIME TEST
+//
+// Concerns:
+//   The round trip time is smoothed and ignores invalid samples.
+//
+// Plan:
+//   1) Report several samples and verify the smoothed value.
+//
+// Testing:
+//   onRoundTrip
+// --------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("ROUND TRIP TIME TEST");
+
+    bmqimp::UnconfirmedWindow obj;
+
+    obj.onRoundTrip(0);
+    obj.onRoundTrip(-1);
+    BMQTST_ASSERT_EQ(obj.roundTripTime(), 0);
+
+    obj.onRoundTrip(800);
+    BMQTST_ASSERT_EQ(obj.roundTripTime(), 800);
+
+    obj.onRoundTrip(1600);
+    BMQTST_ASSERT_EQ(obj.roundTripTime(), 900);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_roundTripTimeTest(); break;
+    case 2: test2_growthTest(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -46,6 +46,9 @@ BALL_LOG_SET_NAMESPACE_CATEGORY("BMQIO.CHANNELUTIL");
 /// The minimum size (in bytes) of a packet.
 static const int k_MINIMUM_PACKET_LENGTH = sizeof(bdlb::BigEndianUint32);
 
+/// Prefix of the endpoints designating a local (Unix domain) socket.
+const char k_LOCAL_ENDPOINT_PREFIX[] = "unix:";
+
 inline bool
 isValidPacketLength(int*                      packetLength,
                     const bdlbb::Blob&        inBlob,
@@ -247,6 +250,22 @@ bool ChannelUtil::isLocalHost(const bsl::string_view& host)
     return (s_localIpAddress == ipAddress.value());
 }
 
+bool ChannelUtil::isLocalEndpoint(const bsl::string_view& endpoint)
+{
+    const bsl::string_view prefix(k_LOCAL_ENDPOINT_PREFIX);
+    return endpoint.length() > prefix.length() &&
+           endpoint.substr(0, prefix.length()) == prefix;
+}
+
+bsl::string_view
+ChannelUtil::localEndpointPath(const bsl::string_view& endpoint)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(isLocalEndpoint(endpoint));
+
+    return endpoint.substr(sizeof(k_LOCAL_ENDPOINT_PREFIX) - 1);
+}
+
 bool ChannelUtil::isLocalHost(const ntsa::IpAddress& ip)
 {
     static bsl::vector<ntsa::IpAddress>* s_localAddresses_p = 0;
@@ -78,6 +78,16 @@ struct ChannelUtil {
     /// Return true if the specified `ip` corresponds to one of the local
     /// IPs of this host.
     static bool isLocalHost(const ntsa::IpAddress& ip);
+
+    /// Return true if the specified `endpoint` designates a local (Unix
+    /// domain) stream socket, that is, is of the form `unix:<path>`.
+    static bool isLocalEndpoint(const bsl::string_view& endpoint);
+
+    /// Return the path of the socket designated by the specified local
+    /// `endpoint`.  The behavior is undefined unless
+    /// `isLocalEndpoint(endpoint)` is true.
+    static bsl::string_view
+    localEndpointPath(const bsl::string_view& endpoint);
 };
 
 }  // close package namespace
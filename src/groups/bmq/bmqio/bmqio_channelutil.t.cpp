@@ -416,6 +416,20 @@ static void test3_isLocalHost()
     }
 }
 
+static void test4_localEndpoint()
+{
+    bmqtst::TestHelper::printTestName("LOCAL ENDPOINT");
+
+    BMQTST_ASSERT(bmqio::ChannelUtil::isLocalEndpoint("unix:/tmp/bmq.sock"));
+    BMQTST_ASSERT_EQ(
+        bmqio::ChannelUtil::localEndpointPath("unix:/tmp/bmq.sock"),
+        "/tmp/bmq.sock");
+
+    BMQTST_ASSERT(!bmqio::ChannelUtil::isLocalEndpoint("unix:"));
+    BMQTST_ASSERT(!bmqio::ChannelUtil::isLocalEndpoint("localhost:30114"));
+    BMQTST_ASSERT(!bmqio::ChannelUtil::isLocalEndpoint("30114"));
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -426,6 +440,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 4: test4_localEndpoint(); break;
     case 3: test3_isLocalHost(); break;
     case 2: test2_handleRead_multiplePackets(); break;
     case 1: test1_handleRead_singlePacket(); break;
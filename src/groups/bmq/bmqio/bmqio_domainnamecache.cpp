@@ -0,0 +1,143 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqio_domainnamecache.h>
+
+#include <bmqscm_version.h>
+// BDE
+#include <bslma_default.h>
+#include <bslmt_lockguard.h>
+#include <bsls_assert.h>
+#include <bsls_systemtime.h>
+
+namespace BloombergLP {
+namespace bmqio {
+
+// ----------------------------
+// struct DomainNameCache::Entry
+// ----------------------------
+
+DomainNameCache::Entry::Entry(bslma::Allocator* allocator)
+: d_domainName(allocator)
+, d_error()
+, d_expiration()
+{
+    // NOTHING
+}
+
+DomainNameCache::Entry::Entry(const Entry& other, bslma::Allocator* allocator)
+: d_domainName(other.d_domainName, allocator)
+, d_error(other.d_error)
+, d_expiration(other.d_expiration)
+{
+    // NOTHING
+}
+
+// ---------------------
+// class DomainNameCache
+// ---------------------
+
+// CREATORS
+DomainNameCache::DomainNameCache(const ResolveFn&          resolveFn,
+                                 const bsls::TimeInterval& ttl,
+                                 const bsls::TimeInterval& negativeTtl,
+                                 size_t                    maxEntries,
+                                 bslma::Allocator*         basicAllocator)
+: d_resolveFn(bsl::allocator_arg, basicAllocator, resolveFn)
+, d_ttl(ttl)
+, d_negativeTtl(negativeTtl)
+, d_maxEntries(maxEntries)
+, d_entries(basicAllocator)
+, d_mutex()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(resolveFn);
+    BSLS_ASSERT_OPT(maxEntries > 0);
+}
+
+// MANIPULATORS
+ntsa::Error DomainNameCache::getDomainName(bsl::string*           result,
+                                           const ntsa::IpAddress& ipAddress)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(result);
+
+    const bsl::string key = ipAddress.text();
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+        EntryMap::const_iterator it = d_entries.find(key);
+        if (it != d_entries.end() &&
+            bsls::SystemTime::nowMonotonicClock() < it->second.d_expiration) {
+            *result = it->second.d_domainName;
+            return it->second.d_error;  // RETURN
+        }
+    }  // UNLOCK
+
+    // Resolve outside of the lock: concurrent misses on the same address may
+    // each resolve it, which is harmless, but a slow lookup must not stall
+    // hits on other addresses.
+    Entry entry(d_allocator_p);
+    entry.d_error      = d_resolveFn(&entry.d_domainName, ipAddress);
+    const bool isSuccess = entry.d_error.code() == ntsa::Error::e_OK;
+    entry.d_expiration   = bsls::SystemTime::nowMonotonicClock() +
+                         (isSuccess ? d_ttl : d_negativeTtl);
+
+    *result = entry.d_domainName;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    if (d_entries.size() >= d_maxEntries && d_entries.count(key) == 0) {
+        // Make room, first by evicting expired entries, and if none are,
+        // by starting over.
+        const bsls::TimeInterval now = bsls::SystemTime::nowMonotonicClock();
+        for (EntryMap::iterator it = d_entries.begin();
+             it != d_entries.end();) {
+            if (it->second.d_expiration <= now) {
+                it = d_entries.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+
+        if (d_entries.size() >= d_maxEntries) {
+            d_entries.clear();
+        }
+    }
+
+    d_entries.erase(key);
+    d_entries.insert(bsl::make_pair(key, entry));
+
+    return entry.d_error;
+}
+
+void DomainNameCache::clear()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+    d_entries.clear();
+}
+
+// ACCESSORS
+size_t DomainNameCache::numEntries() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+    return d_entries.size();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
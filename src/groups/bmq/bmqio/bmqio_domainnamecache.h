@@ -0,0 +1,153 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BMQIO_DOMAINNAMECACHE
+#define INCLUDED_BMQIO_DOMAINNAMECACHE
+
+//@PURPOSE: Provide a cache of reverse DNS resolutions.
+//
+//@CLASSES:
+//  bmqio::DomainNameCache: Time-bounded cache of IP address to domain name.
+//
+//@DESCRIPTION: This component provides a mechanism, 'bmqio::DomainNameCache',
+// which memoizes the result of a resolve function mapping an IP address to
+// its domain name.  Successful resolutions are kept for a configurable
+// 'ttl', and failed resolutions for a (typically shorter) 'negativeTtl', so
+// that a burst of connections from the same hosts (for example after a
+// network partition heals) does not issue one reverse lookup per channel.
+// The cache is bounded to a maximum number of entries; when full, expired
+// entries are evicted and, if none are, the cache is emptied.
+//
+// Note that the resolution itself is performed synchronously by the caller
+// of 'getDomainName', outside of the cache's lock, so that a slow lookup of
+// one address does not block lookups of other, already cached, addresses.
+//
+/// Thread Safety
+///-------------
+// This component is thread safe.
+
+// BMQ
+#include <bmqio_resolvingchannelfactory.h>
+
+// BDE
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
+#include <bsls_keyword.h>
+#include <bsls_timeinterval.h>
+
+// NTC
+#include <ntsa_error.h>
+#include <ntsa_ipaddress.h>
+
+namespace BloombergLP {
+namespace bmqio {
+
+// =====================
+// class DomainNameCache
+// =====================
+
+/// Thread safe, time-bounded cache of IP address to domain name
+/// resolutions.
+class DomainNameCache {
+  public:
+    // TYPES
+    typedef ResolvingChannelFactoryUtil::ResolveFn ResolveFn;
+
+  private:
+    // PRIVATE TYPES
+
+    /// Result of a resolution, along with the time at which it expires.
+    struct Entry {
+        // DATA
+        bsl::string d_domainName;
+
+        ntsa::Error d_error;
+
+        bsls::TimeInterval d_expiration;
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(Entry, bslma::UsesBslmaAllocator)
+
+        // CREATORS
+        explicit Entry(bslma::Allocator* allocator);
+
+        Entry(const Entry& other, bslma::Allocator* allocator);
+    };
+
+    /// Map of IP address, in its textual representation, to its entry.
+    typedef bsl::unordered_map<bsl::string, Entry> EntryMap;
+
+    // DATA
+    ResolveFn d_resolveFn;
+
+    bsls::TimeInterval d_ttl;
+
+    bsls::TimeInterval d_negativeTtl;
+
+    size_t d_maxEntries;
+
+    EntryMap d_entries;  // Protected by 'd_mutex'
+
+    mutable bslmt::Mutex d_mutex;
+
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    // NOT IMPLEMENTED
+    DomainNameCache(const DomainNameCache&) BSLS_KEYWORD_DELETED;
+    DomainNameCache& operator=(const DomainNameCache&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DomainNameCache, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a `DomainNameCache` resolving addresses not already cached
+    /// with the specified `resolveFn`, keeping successful results for the
+    /// specified `ttl`, failed results for the specified `negativeTtl`, and
+    /// holding at most the specified `maxEntries`.  Use the optionally
+    /// specified `basicAllocator` to supply memory.
+    DomainNameCache(const ResolveFn&          resolveFn,
+                    const bsls::TimeInterval& ttl,
+                    const bsls::TimeInterval& negativeTtl,
+                    size_t                    maxEntries,
+                    bslma::Allocator*         basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Load into the specified `result` the domain name of the specified
+    /// `ipAddress`, using the cached result if it has not expired and
+    /// resolving it otherwise.  Return the error of the resolution.
+    ntsa::Error getDomainName(bsl::string*           result,
+                              const ntsa::IpAddress& ipAddress);
+
+    /// Remove all entries from this cache.
+    void clear();
+
+    // ACCESSORS
+
+    /// Return the number of entries, expired or not, held by this cache.
+    size_t numEntries() const;
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,166 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqio_domainnamecache.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bdlf_placeholder.h>
+#include <bsl_string.h>
+#include <bsls_timeinterval.h>
+
+#include <ntsa_error.h>
+#include <ntsa_ipaddress.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+using namespace bmqio;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Resolve function incrementing the specified `numCalls`, and resolving
+/// only the loopback address.
+ntsa::Error countingResolveFn(int*                   numCalls,
+                              bsl::string*           domainName,
+                              const ntsa::IpAddress& address)
+{
+    ++(*numCalls);
+
+    if (!address.equals(ntsa::IpAddress("127.0.0.1"))) {
+        return ntsa::Error(ntsa::Error::e_EOF);  // RETURN
+    }
+
+    *domainName = "localhost";
+    return ntsa::Error();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    int             numCalls = 0;
+    DomainNameCache cache(bdlf::BindUtil::bind(&countingResolveFn,
+                                               &numCalls,
+                                               bdlf::PlaceHolders::_1,
+                                               bdlf::PlaceHolders::_2),
+                          bsls::TimeInterval(60.0),
+                          bsls::TimeInterval(60.0),
+                          16,
+                          bmqtst::TestHelperUtil::allocator());
+
+    bsl::string result(bmqtst::TestHelperUtil::allocator());
+
+    PVV("Successful resolutions are cached");
+    ntsa::Error error = cache.getDomainName(&result,
+                                            ntsa::IpAddress("127.0.0.1"));
+    BMQTST_ASSERT_EQ(error.code(), ntsa::Error::e_OK);
+    BMQTST_ASSERT_EQ(result, "localhost");
+    BMQTST_ASSERT_EQ(numCalls, 1);
+
+    result.clear();
+    error = cache.getDomainName(&result, ntsa::IpAddress("127.0.0.1"));
+    BMQTST_ASSERT_EQ(error.code(), ntsa::Error::e_OK);
+    BMQTST_ASSERT_EQ(result, "localhost");
+    BMQTST_ASSERT_EQ(numCalls, 1);
+
+    PVV("Failed resolutions are cached");
+    error = cache.getDomainName(&result, ntsa::IpAddress("10.0.0.1"));
+    BMQTST_ASSERT_EQ(error.code(), ntsa::Error::e_EOF);
+    BMQTST_ASSERT_EQ(numCalls, 2);
+
+    error = cache.getDomainName(&result, ntsa::IpAddress("10.0.0.1"));
+    BMQTST_ASSERT_EQ(error.code(), ntsa::Error::e_EOF);
+    BMQTST_ASSERT_EQ(numCalls, 2);
+    BMQTST_ASSERT_EQ(cache.numEntries(), 2U);
+
+    PVV("Clear");
+    cache.clear();
+    BMQTST_ASSERT_EQ(cache.numEntries(), 0U);
+
+    error = cache.getDomainName(&result, ntsa::IpAddress("127.0.0.1"));
+    BMQTST_ASSERT_EQ(error.code(), ntsa::Error::e_OK);
+    BMQTST_ASSERT_EQ(numCalls, 3);
+}
+
+static void test2_expirationAndCapacity()
+{
+    bmqtst::TestHelper::printTestName("EXPIRATION AND CAPACITY");
+
+    int             numCalls = 0;
+    DomainNameCache cache(bdlf::BindUtil::bind(&countingResolveFn,
+                                               &numCalls,
+                                               bdlf::PlaceHolders::_1,
+                                               bdlf::PlaceHolders::_2),
+                          bsls::TimeInterval(60.0),
+                          bsls::TimeInterval(0.0),
+                          2,
+                          bmqtst::TestHelperUtil::allocator());
+
+    bsl::string result(bmqtst::TestHelperUtil::allocator());
+
+    PVV("A zero negative TTL does not cache failures");
+    cache.getDomainName(&result, ntsa::IpAddress("10.0.0.1"));
+    cache.getDomainName(&result, ntsa::IpAddress("10.0.0.1"));
+    BMQTST_ASSERT_EQ(numCalls, 2);
+
+    PVV("Expired entries are evicted first when full");
+    cache.getDomainName(&result, ntsa::IpAddress("127.0.0.1"));
+    BMQTST_ASSERT_EQ(numCalls, 3);
+    BMQTST_ASSERT_EQ(cache.numEntries(), 2U);
+
+    cache.getDomainName(&result, ntsa::IpAddress("10.0.0.2"));
+    BMQTST_ASSERT_EQ(numCalls, 4);
+    BMQTST_ASSERT_EQ(cache.numEntries(), 2U);
+
+    result.clear();
+    cache.getDomainName(&result, ntsa::IpAddress("127.0.0.1"));
+    BMQTST_ASSERT_EQ(result, "localhost");
+    BMQTST_ASSERT_EQ(numCalls, 4);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_expirationAndCapacity(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    // 'ntsa::IpAddress::text()' returns a string using the default allocator.
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_GBL_ALLOC);
+}
@@ -17,6 +17,7 @@
 
 #include <bmqscm_version.h>
 
+#include <bmqio_channelutil.h>
 #include <bmqu_blob.h>
 
 // NTF
@@ -29,6 +30,8 @@
 #include <bdlf_bind.h>
 #include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
+#include <bdls_filesystemutil.h>
+#include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_iomanip.h>
 #include <bsl_ios.h>
@@ -39,6 +42,10 @@
 #include <bsls_assert.h>
 #include <bsls_platform.h>
 
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <sys/socket.h>
+#endif
+
 namespace BloombergLP {
 namespace bmqio {
 
@@ -343,6 +350,70 @@ int parseEndpoint(bsl::string*             host,
     return 0;
 }
 
+/// Load into the specified `result` the endpoint of the local (Unix domain)
+/// socket designated by the specified `str`.  Return the error.  The
+/// behavior is undefined unless `ChannelUtil::isLocalEndpoint(str)`.
+ntsa::Error makeLocalEndpoint(ntsa::Endpoint*          result,
+                              const bslstl::StringRef& str)
+{
+    const bsl::string_view path = ChannelUtil::localEndpointPath(str);
+
+    ntsa::LocalName   localName;
+    const ntsa::Error error = localName.setValue(
+        bslstl::StringRef(path.data(), path.length()));
+    if (error) {
+        return error;  // RETURN
+    }
+
+    result->makeLocal(localName);
+    return ntsa::Error();
+}
+
+/// Load into the specified `result` the handle of a new TCP socket bound
+/// with `SO_REUSEPORT` to the specified `endpoint`, using the specified
+/// `allocator` to supply memory.  Return the error.  The ownership of the
+/// handle is transferred to the caller on success.  Note that the option
+/// must be set before the socket is bound, which is why the socket is
+/// created here rather than by the NTC interface.
+ntsa::Error openReusePortSocket(ntsa::Handle*         result,
+                                const ntsa::Endpoint& endpoint,
+                                bslma::Allocator*     allocator)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX) && defined(SO_REUSEPORT)
+    bsl::shared_ptr<ntsi::ListenerSocket> socket =
+        ntsf::System::createListenerSocket(allocator);
+
+    ntsa::Error error = socket->open(ntsa::Transport::e_TCP_IPV4_STREAM);
+    if (error) {
+        return error;  // RETURN
+    }
+
+    const int enable = 1;
+    if (0 != ::setsockopt(socket->handle(),
+                          SOL_SOCKET,
+                          SO_REUSEPORT,
+                          &enable,
+                          sizeof(enable))) {
+        socket->close();
+        return ntsa::Error::last();  // RETURN
+    }
+
+    error = socket->bind(endpoint, true);
+    if (error) {
+        socket->close();
+        return error;  // RETURN
+    }
+
+    *result = socket->release();
+    return ntsa::Error();
+#else
+    (void)result;
+    (void)endpoint;
+    (void)allocator;
+    return ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED);
+#endif
+}
+
 }  // close unnamed namespace
 
 // -------------
@@ -861,6 +932,7 @@ void NtcChannel::processClose(const bmqio::Status& status)
 
     d_state = e_STATE_CLOSED;
 
+    d_writeBatch.removeAll();
     d_streamSocket_sp.reset();
     d_interface_sp.reset();
 
@@ -894,6 +966,75 @@ void NtcChannel::drainReaders(const bmqio::Status& status)
     }
 }
 
+void NtcChannel::sendLocked(Status*            status,
+                            const bdlbb::Blob& blob,
+                            bsls::Types::Int64 watermark)
+{
+    ntca::SendOptions sendOptions;
+    if (watermark != bsl::numeric_limits<int>::max()) {
+        sendOptions.setHighWatermark(watermark);
+    }
+
+    ntsa::Error error = d_streamSocket_sp->send(blob, sendOptions);
+    if (error) {
+        if (error == ntsa::Error::e_WOULD_BLOCK) {
+            BMQIO_NTCCHANNEL_LOG_WRITE_WOULD_BLOCK(this,
+                                                   d_streamSocket_sp,
+                                                   blob);
+            NtcChannelUtil::fail(status,
+                                 bmqio::StatusCategory::e_LIMIT,
+                                 "send",
+                                 error);
+        }
+        else {
+            BMQIO_NTCCHANNEL_LOG_WRITE_FAILED(this,
+                                              d_streamSocket_sp,
+                                              blob,
+                                              error);
+            NtcChannelUtil::fail(status,
+                                 bmqio::StatusCategory::e_CONNECTION,
+                                 "send",
+                                 error);
+        }
+    }
+}
+
+void NtcChannel::flushWriteBatchLocked()
+{
+    if (d_writeBatch.length() == 0) {
+        return;
+    }
+
+    // The gathered blobs were accepted against the watermark when written,
+    // so they must not be refused now.
+    ntca::SendOptions sendOptions;
+    sendOptions.setHighWatermark(bsl::numeric_limits<bsl::size_t>::max());
+
+    ntsa::Error error = d_streamSocket_sp->send(d_writeBatch, sendOptions);
+    if (error) {
+        BMQIO_NTCCHANNEL_LOG_WRITE_FAILED(this,
+                                          d_streamSocket_sp,
+                                          d_writeBatch,
+                                          error);
+    }
+
+    d_writeBatch.removeAll();
+}
+
+void NtcChannel::processWriteBatch()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
+
+    d_writeBatchScheduled = false;
+
+    if (d_state != e_STATE_OPEN) {
+        d_writeBatch.removeAll();
+        return;
+    }
+
+    flushWriteBatchLocked();
+}
+
 // CREATORS
 NtcChannel::NtcChannel(
     const bsl::shared_ptr<ntci::Interface>&      interface,
@@ -904,6 +1045,9 @@ NtcChannel::NtcChannel(
 , d_streamSocket_sp()
 , d_readQueue(basicAllocator)
 , d_readCache(basicAllocator)
+, d_writeBatch(basicAllocator)
+, d_writeAggregationMaxBytes(0)
+, d_writeBatchScheduled(false)
 , d_channelId(0)
 , d_peerUri(basicAllocator)
 , d_state(e_STATE_DEFAULT)
@@ -951,8 +1095,14 @@ int NtcChannel::connect(bmqio::Status*               status,
         return 2;
     }
 
+    // Endpoints of the form 'unix:<path>' designate a local socket, sparing
+    // colocated peers the TCP stack.
+    const bool isLocal = ChannelUtil::isLocalEndpoint(options.endpoint());
+
     ntca::StreamSocketOptions streamSocketOptions;
-    streamSocketOptions.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
+    streamSocketOptions.setTransport(isLocal
+                                         ? ntsa::Transport::e_LOCAL_STREAM
+                                         : ntsa::Transport::e_TCP_IPV4_STREAM);
     streamSocketOptions.setKeepHalfOpen(false);
 
     bsl::shared_ptr<ntci::StreamSocket> streamSocket =
@@ -990,8 +1140,21 @@ int NtcChannel::connect(bmqio::Status*               status,
         }
     }
 
-    bsl::string endpointString;
-    {
+    bsl::string    endpointString;
+    ntsa::Endpoint localEndpoint;
+    if (isLocal) {
+        endpointString = options.endpoint();
+
+        error = makeLocalEndpoint(&localEndpoint, endpointString);
+        if (error) {
+            bmqio::NtcChannelUtil::fail(status,
+                                        bmqio::StatusCategory::e_GENERIC_ERROR,
+                                        "connect",
+                                        error);
+            return 2;
+        }
+    }
+    else {
         BSLS_ASSERT_OPT(!options.endpoint().empty());
 
         bsl::string host;
@@ -1024,9 +1187,16 @@ int NtcChannel::connect(bmqio::Status*               status,
 
     BMQIO_NTCCHANNEL_LOG_CONNECT_START(this, streamSocket, endpointString);
 
-    error = streamSocket->connect(endpointString,
-                                  connectOptions,
-                                  connectCallback);
+    if (isLocal) {
+        error = streamSocket->connect(localEndpoint,
+                                      connectOptions,
+                                      connectCallback);
+    }
+    else {
+        error = streamSocket->connect(endpointString,
+                                      connectOptions,
+                                      connectCallback);
+    }
     if (error) {
         bmqio::NtcChannelUtil::fail(status,
                                     bmqio::StatusCategory::e_CONNECTION,
@@ -1035,6 +1205,13 @@ int NtcChannel::connect(bmqio::Status*               status,
         return 3;
     }
 
+    int writeAggregationMaxBytes;
+    if (options.properties().load(
+            &writeAggregationMaxBytes,
+            NtcChannelUtil::writeAggregationProperty())) {
+        setWriteAggregationMaxBytes(writeAggregationMaxBytes);
+    }
+
     d_streamSocket_sp = streamSocket;
     d_state           = e_STATE_OPEN;
     d_peerUri         = endpointString;
@@ -1149,8 +1326,6 @@ void NtcChannel::write(Status*            status,
                        const bdlbb::Blob& blob,
                        bsls::Types::Int64 watermark)
 {
-    ntsa::Error error;
-
     if (status) {
         status->reset();
     }
@@ -1169,32 +1344,39 @@ void NtcChannel::write(Status*            status,
 
     BMQIO_NTCCHANNEL_LOG_WRITE(this, d_streamSocket_sp, blob);
 
-    ntca::SendOptions sendOptions;
-    if (watermark != bsl::numeric_limits<int>::max()) {
-        sendOptions.setHighWatermark(watermark);
+    if (d_writeAggregationMaxBytes == 0) {
+        sendLocked(status, blob, watermark);
+        return;
     }
 
-    error = d_streamSocket_sp->send(blob, sendOptions);
-    if (error) {
-        if (error == ntsa::Error::e_WOULD_BLOCK) {
-            BMQIO_NTCCHANNEL_LOG_WRITE_WOULD_BLOCK(this,
-                                                   d_streamSocket_sp,
-                                                   blob);
-            NtcChannelUtil::fail(status,
-                                 bmqio::StatusCategory::e_LIMIT,
-                                 "send",
-                                 error);
-        }
-        else {
-            BMQIO_NTCCHANNEL_LOG_WRITE_FAILED(this,
-                                              d_streamSocket_sp,
-                                              blob,
-                                              error);
-            NtcChannelUtil::fail(status,
-                                 bmqio::StatusCategory::e_CONNECTION,
-                                 "send",
-                                 error);
-        }
+    const bsls::Types::Int64 batchLength = d_writeBatch.length() +
+                                           blob.length();
+    const bsls::Types::Int64 highWatermark = bsl::min(
+        watermark,
+        static_cast<bsls::Types::Int64>(
+            d_streamSocket_sp->writeQueueHighWatermark()));
+
+    if (batchLength > d_writeAggregationMaxBytes ||
+        static_cast<bsls::Types::Int64>(
+            d_streamSocket_sp->writeQueueSize()) +
+                batchLength >
+            highWatermark) {
+        // Send the gathered blobs and then this one, so that the socket
+        // enforces the watermark on this blob and reports it, as without
+        // write aggregation.
+        flushWriteBatchLocked();
+        sendLocked(status, blob, watermark);
+        return;
+    }
+
+    // Gather the blob, sharing its buffers, and send the gathered blobs
+    // from the I/O thread once the burst of writes is over.
+    bdlbb::BlobUtil::append(&d_writeBatch, blob);
+
+    if (!d_writeBatchScheduled) {
+        d_writeBatchScheduled = true;
+        d_streamSocket_sp->execute(
+            bdlf::BindUtil::bind(&NtcChannel::processWriteBatch, self));
     }
 }
 
@@ -1263,6 +1445,9 @@ void NtcChannel::close(const Status& status)
         read->clear();
     }
 
+    // Hand the gathered blobs, if any, to the socket before closing it.
+    flushWriteBatchLocked();
+
     BMQIO_NTCCHANNEL_LOG_CLOSING(this, d_streamSocket_sp);
 
     d_state = e_STATE_CLOSING;
@@ -1306,6 +1491,14 @@ void NtcChannel::setChannelId(int channelId)
     d_channelId = channelId;
 }
 
+void NtcChannel::setWriteAggregationMaxBytes(int maxBytes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 <= maxBytes);
+
+    d_writeAggregationMaxBytes = maxBytes;
+}
+
 void NtcChannel::setWriteQueueLowWatermark(int lowWatermark)
 {
     bslmt::LockGuard<bslmt::Mutex> lock(&d_mutex);
@@ -1368,6 +1561,11 @@ const ntci::StreamSocket& NtcChannel::streamSocket() const
 // ---------------------
 
 // CLASS METHODS
+bslstl::StringRef NtcChannelUtil::writeAggregationProperty()
+{
+    return bslstl::StringRef("tcp.write.aggregation", 21);
+}
+
 void NtcChannelUtil::fail(Status*                     status,
                           bmqio::StatusCategory::Enum category,
                           const bslstl::StringRef&    operation,
@@ -1415,6 +1613,20 @@ void NtcListener::processAccept(
                                               streamSocket,
                                               event);
 
+        int writeAggregationMaxBytes;
+        if (d_options.properties().load(
+                &writeAggregationMaxBytes,
+                NtcChannelUtil::writeAggregationProperty())) {
+            channel->setWriteAggregationMaxBytes(writeAggregationMaxBytes);
+        }
+
+        int listenPort;
+        if (d_properties.load(&listenPort,
+                              NtcListenerUtil::listenPortProperty())) {
+            channel->properties().set(NtcListenerUtil::listenPortProperty(),
+                                      listenPort);
+        }
+
         channel->import(streamSocket);
 
         {
@@ -1546,9 +1758,46 @@ int NtcListener::listen(bmqio::Status*              status,
         backlog = 0;
     }
 
+    int reusePort;
+    if (!options.properties().load(
+            &reusePort,
+            NtcListenerUtil::listenReusePortProperty())) {
+        reusePort = 0;
+    }
+
+    // Endpoints of the form 'unix:<path>' designate a local socket, sparing
+    // colocated peers the TCP stack.
+    const bool isLocal = ChannelUtil::isLocalEndpoint(options.endpoint());
+    const ntsa::Transport::Value transport =
+        isLocal ? ntsa::Transport::e_LOCAL_STREAM
+                : ntsa::Transport::e_TCP_IPV4_STREAM;
+
     ntsa::Endpoint endpoint;
-    bsl::string    endpointString;
-    {
+    if (isLocal) {
+        if (reusePort) {
+            bmqio::NtcListenerUtil::fail(
+                status,
+                bmqio::StatusCategory::e_GENERIC_ERROR,
+                "bind",
+                ntsa::Error(ntsa::Error::e_NOT_IMPLEMENTED));
+            return 2;
+        }
+
+        error = makeLocalEndpoint(&endpoint, options.endpoint());
+        if (error) {
+            bmqio::NtcListenerUtil::fail(
+                status,
+                bmqio::StatusCategory::e_GENERIC_ERROR,
+                "bind",
+                error);
+            return 2;
+        }
+
+        // A socket file left over by a previous listener fails the bind.
+        bdls::FilesystemUtil::remove(
+            ChannelUtil::localEndpointPath(options.endpoint()));
+    }
+    else {
         BSLS_ASSERT_OPT(!options.endpoint().empty());
 
         bsl::string host;
@@ -1569,35 +1818,57 @@ int NtcListener::listen(bmqio::Status*              status,
 
         BSLS_ASSERT_OPT(!port.empty());
 
+        bsl::string endpointString;
         endpointString.assign(host);
         endpointString.append(1, ':');
         endpointString.append(port);
+
+        bsl::shared_ptr<ntsi::Resolver> resolver =
+            ntsf::System::createResolver(d_allocator_p);
+
+        ntsa::EndpointOptions endpointOptions;
+        endpointOptions.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
+
+        error = resolver->getEndpoint(&endpoint,
+                                      endpointString,
+                                      endpointOptions);
+        if (error) {
+            BMQIO_NTCLISTENER_LOG_RESOLVE_FAILED(this,
+                                                 options.endpoint(),
+                                                 error);
+
+            bmqio::NtcListenerUtil::fail(
+                status,
+                bmqio::StatusCategory::e_GENERIC_ERROR,
+                "resolve",
+                error);
+            return 3;
+        }
     }
 
     ntca::ListenerSocketOptions listenerSocketOptions;
-    listenerSocketOptions.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
+    listenerSocketOptions.setTransport(transport);
     listenerSocketOptions.setReuseAddress(true);
     listenerSocketOptions.setKeepHalfOpen(false);
     listenerSocketOptions.setBacklog(backlog);
 
-    bsl::shared_ptr<ntsi::Resolver> resolver = ntsf::System::createResolver(
-        d_allocator_p);
-
-    ntsa::EndpointOptions endpointOptions;
-    endpointOptions.setTransport(ntsa::Transport::e_TCP_IPV4_STREAM);
-
-    error = resolver->getEndpoint(&endpoint, endpointString, endpointOptions);
-    if (error) {
-        BMQIO_NTCLISTENER_LOG_RESOLVE_FAILED(this, options.endpoint(), error);
-
-        bmqio::NtcListenerUtil::fail(status,
-                                     bmqio::StatusCategory::e_GENERIC_ERROR,
-                                     "resolve",
-                                     error);
-        return 3;
+    ntsa::Handle reusePortHandle = ntsa::k_INVALID_HANDLE;
+    if (reusePort) {
+        // The socket is bound before being handed to the interface, so the
+        // source endpoint is not set in the options.
+        error = openReusePortSocket(&reusePortHandle, endpoint, d_allocator_p);
+        if (error) {
+            bmqio::NtcListenerUtil::fail(
+                status,
+                bmqio::StatusCategory::e_GENERIC_ERROR,
+                "bind",
+                error);
+            return 5;
+        }
+    }
+    else {
+        listenerSocketOptions.setSourceEndpoint(endpoint);
     }
-
-    listenerSocketOptions.setSourceEndpoint(endpoint);
 
     bsl::shared_ptr<ntci::ListenerSocket> listenerSocket =
         d_interface_sp->createListenerSocket(listenerSocketOptions,
@@ -1605,7 +1876,16 @@ int NtcListener::listen(bmqio::Status*              status,
 
     ntci::ListenerSocketCloseGuard listenerSocketGuard(listenerSocket);
 
-    error = listenerSocket->open();
+    if (reusePort) {
+        error = listenerSocket->open(ntsa::Transport::e_TCP_IPV4_STREAM,
+                                     reusePortHandle);
+        if (error) {
+            ntsf::System::close(reusePortHandle);
+        }
+    }
+    else {
+        error = listenerSocket->open();
+    }
     if (error) {
         bmqio::NtcListenerUtil::fail(status,
                                      bmqio::StatusCategory::e_GENERIC_ERROR,
@@ -1624,16 +1904,29 @@ int NtcListener::listen(bmqio::Status*              status,
     }
 
     endpoint = listenerSocket->sourceEndpoint();
-    if (!endpoint.isIp() && !endpoint.ip().host().isV4()) {
-        bmqio::NtcListenerUtil::fail(status,
-                                     bmqio::StatusCategory::e_GENERIC_ERROR,
-                                     "bind",
-                                     ntsa::Error(ntsa::Error::e_INVALID));
-        return 9;
+    if (isLocal) {
+        // A local socket has no port: report the one requested, if any, so
+        // that the channels accepted can be identified alike.
+        int port;
+        if (options.properties().load(
+                &port,
+                NtcListenerUtil::listenPortProperty())) {
+            d_properties.set(NtcListenerUtil::listenPortProperty(), port);
+        }
     }
+    else {
+        if (!endpoint.isIp() && !endpoint.ip().host().isV4()) {
+            bmqio::NtcListenerUtil::fail(
+                status,
+                bmqio::StatusCategory::e_GENERIC_ERROR,
+                "bind",
+                ntsa::Error(ntsa::Error::e_INVALID));
+            return 9;
+        }
 
-    d_properties.set(bmqio::NtcListenerUtil::listenPortProperty(),
-                     static_cast<int>(endpoint.ip().port()));
+        d_properties.set(bmqio::NtcListenerUtil::listenPortProperty(),
+                         static_cast<int>(endpoint.ip().port()));
+    }
 
     ntci::AcceptFunction acceptCallback = bdlf::BindUtil::bind(
         &NtcListener::processAccept,
@@ -1726,6 +2019,11 @@ bslstl::StringRef NtcListenerUtil::listenPortProperty()
     return bslstl::StringRef("tcp.listen.port", 15);
 }
 
+bslstl::StringRef NtcListenerUtil::listenReusePortProperty()
+{
+    return bslstl::StringRef("tcp.listen.reuseport", 20);
+}
+
 void NtcListenerUtil::fail(Status*                     status,
                            bmqio::StatusCategory::Enum category,
                            const bslstl::StringRef&    operation,
@@ -24,6 +24,30 @@
 //@DESCRIPTION: This component provides a mechanism, 'bmqio::NtcChannel',
 // implemented by NTC to asynchronously send and receive arbitrary blobs of
 // data.
+//
+/// Write aggregation
+///-----------------
+// By default, each blob written to a 'bmqio::NtcChannel' is handed to the
+// socket on its own, which typically results in one system call per blob.
+// When the integer property named by
+// 'NtcChannelUtil::writeAggregationProperty()' is set to a positive number of
+// bytes in the 'bmqio::ConnectOptions' or 'bmqio::ListenOptions' used to
+// create the channel, blobs written in a burst are instead gathered, up to
+// that number of bytes, and handed to the socket as a single scatter/gather
+// send executed on the I/O thread of the channel.  A write which would make
+// the gathered blobs exceed that number of bytes, or the write queue
+// watermark, sends the gathered blobs right away, so that the watermark is
+// still enforced by the socket and reported to the writer.
+//
+/// Sharded listeners
+///-----------------
+// When the integer property named by
+// 'NtcListenerUtil::listenReusePortProperty()' is set to a non-zero value in
+// the 'bmqio::ListenOptions', the listening socket is bound with
+// 'SO_REUSEPORT'.  Several listeners may then be opened on the same endpoint,
+// each of them driven by its own I/O thread of the channel factory, and the
+// kernel balances incoming connections across them.  This option is only
+// available on platforms providing 'SO_REUSEPORT'; elsewhere, 'listen' fails.
 
 #include <bmqio_channel.h>
 #include <bmqio_channelfactory.h>
@@ -202,6 +226,9 @@ class NtcChannel : public bmqio::Channel,
     bsl::shared_ptr<ntci::StreamSocket>   d_streamSocket_sp;
     bmqio::NtcReadQueue                   d_readQueue;
     bdlbb::Blob                           d_readCache;
+    bdlbb::Blob                           d_writeBatch;
+    int                                   d_writeAggregationMaxBytes;
+    bool                                  d_writeBatchScheduled;
     int                                   d_channelId;
     bsl::string                           d_peerUri;
     State                                 d_state;
@@ -286,6 +313,21 @@ class NtcChannel : public bmqio::Channel,
     /// Notify using the specified `status` and remove each existing reader.
     void drainReaders(const bmqio::Status& status);
 
+    /// Send the specified `blob` to the socket with the specified
+    /// `watermark`, populating the optionally specified `status` on
+    /// failure.  The behavior is undefined unless `d_mutex` is locked.
+    void sendLocked(Status*            status,
+                    const bdlbb::Blob& blob,
+                    bsls::Types::Int64 watermark);
+
+    /// Send the gathered blobs, if any, to the socket as a single send.  The
+    /// behavior is undefined unless `d_mutex` is locked.
+    void flushWriteBatchLocked();
+
+    /// Send the gathered blobs, if any, to the socket.  This method is
+    /// executed on the I/O thread of the channel once per burst of writes.
+    void processWriteBatch();
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(NtcChannel, bslma::UsesBslmaAllocator)
@@ -318,7 +360,9 @@ class NtcChannel : public bmqio::Channel,
     /// produced as a result of this connection is closed.  If
     /// `options.autoReconnect()` is `true` and the implementing
     /// `ChannelFactory` doesn't provide this behavior, it must fail the
-    /// connection immediately.
+    /// connection immediately.  An `options.endpoint()` of the form
+    /// `unix:<path>` connects to a local (Unix domain) socket, and any
+    /// other is of the form `[<host>:]<port>`.
     int connect(bmqio::Status* status, const bmqio::ConnectOptions& options);
 
     /// Import the specified `streamSocket` and invoke the underlying result
@@ -404,6 +448,12 @@ class NtcChannel : public bmqio::Channel,
     /// Set the channel ID to the specified `channelId`.
     void setChannelId(int channelId);
 
+    /// Set the maximum number of bytes of consecutive writes gathered into
+    /// a single send to the specified `maxBytes`, where 0 disables write
+    /// aggregation.  Refer to the component level documentation for more
+    /// details.  The behavior is undefined unless `0 <= maxBytes`.
+    void setWriteAggregationMaxBytes(int maxBytes);
+
     /// Set the write queue low watermark to the specified `lowWatermark`.
     void setWriteQueueLowWatermark(int lowWatermark) BSLS_KEYWORD_OVERRIDE;
 
@@ -445,6 +495,12 @@ class NtcChannel : public bmqio::Channel,
 struct NtcChannelUtil {
     // CLASS METHODS
 
+    /// Return a reference providing const access to the name of the
+    /// property used to define the maximum number of bytes of consecutive
+    /// writes gathered into a single send, in a ConnectOptions or a
+    /// ListenOptions.  This property must contain an `Integer`.
+    static bslstl::StringRef writeAggregationProperty();
+
     /// Load into the specified `status`, if defined, the description of
     /// the specified `error` assigned to the specified `category` that
     /// was detected when performing the specified `operation`.
@@ -536,6 +592,9 @@ class NtcListener : public bmqio::ChannelFactoryOperationHandle,
     /// callback when they are accepted. Return `e_SUCCESS` on success or
     /// a failure StatusCategory on error, populating the
     /// optionally-specified `status` with more detailed error information.
+    /// An `options.endpoint()` of the form `unix:<path>` listens on a local
+    /// (Unix domain) socket, replacing any file at `path`, and any other is
+    /// of the form `[<host>:]<port>`.
     int listen(bmqio::Status* status, const bmqio::ListenOptions& options);
 
     /// Cancel the operation.
@@ -585,10 +644,19 @@ struct NtcListenerUtil {
 
     /// Return a reference providing const access to the name of the
     /// property that will be returned on the handle returned from
-    /// `NtcChannelFactory::listen` with an integer property containing the
-    /// port to which the listening socket is bound.
+    /// `NtcChannelFactory::listen`, and on the channels it accepts, with an
+    /// integer property containing the port to which the listening socket is
+    /// bound.  For a local socket, which has no port, this is the value of
+    /// this property in the ListenOptions, if any.
     static bslstl::StringRef listenPortProperty();
 
+    /// Return a reference providing const access to the name of the
+    /// property used to request, in a ListenOptions, that the listening
+    /// socket be bound with `SO_REUSEPORT` so that several listeners can
+    /// share the same endpoint.  This property must contain an `Integer`,
+    /// any non-zero value enabling the option.
+    static bslstl::StringRef listenReusePortProperty();
+
     /// Load into the specified `status`, if defined, the description of
     /// the specified `error` assigned to the specified `category` that
     /// was detected when performing the specified `operation`.
@@ -24,12 +24,16 @@
 #include <ntsf_system.h>
 
 // BDE
+#include <bdlbb_blobutil.h>
 #include <bdlbb_pooledblobbufferfactory.h>
 #include <bdlf_bind.h>
+#include <bsl_cstdio.h>
 #include <bsla_annotations.h>
+#include <bslmt_semaphore.h>
 #include <bsls_types.h>
 
 #include <bmqtst_testhelper.h>
+#include <bsl_string.h>
 #include <bsl_vector.h>
 
 // CONVENIENCE
@@ -104,6 +108,33 @@ void executeOnClosedChannelFunc(bmqio::NtcChannel*              channel,
     channel->close();
 }
 
+/// Append the content of the specified `blob` to the specified `data`, and
+/// post on the specified `semaphore` once the read completed with the
+/// specified `status`.  Set the specified `numNeeded` to 0 to complete the
+/// read.
+void onRead(bsl::string*      data,
+            bslmt::Semaphore* semaphore,
+            const Status&     status,
+            int*              numNeeded,
+            bdlbb::Blob*      blob)
+{
+    // PRECONDITIONS
+    BMQTST_ASSERT(data);
+    BMQTST_ASSERT(semaphore);
+
+    BMQTST_ASSERT_EQ(status.category(), bmqio::StatusCategory::e_SUCCESS);
+
+    const int         length = blob->length();
+    bsl::vector<char> buffer(length, bmqtst::TestHelperUtil::allocator());
+    bdlbb::BlobUtil::copy(buffer.data(), *blob, 0, length);
+    data->append(buffer.data(), length);
+
+    bdlbb::BlobUtil::erase(blob, 0, length);
+    *numNeeded = 0;
+
+    semaphore->post();
+}
+
 // ============
 // class Tester
 // ============
@@ -157,7 +188,14 @@ class Tester {
     /// supporting objects.
     void init();
 
-    bsl::shared_ptr<bmqio::NtcChannel> connect();
+    /// Connect a channel to the listener, gathering consecutive writes up
+    /// to the optionally specified `writeAggregationMaxBytes` into a single
+    /// send, and return it.
+    bsl::shared_ptr<bmqio::NtcChannel>
+    connect(int writeAggregationMaxBytes = 0);
+
+    /// Return the channel most recently accepted by the listener.
+    bsl::shared_ptr<bmqio::Channel> acceptedChannel();
 };
 
 // ------------
@@ -288,7 +326,8 @@ void Tester::init()
     BMQTST_ASSERT(endpoint.ip().host().isV4());
 }
 
-bsl::shared_ptr<bmqio::NtcChannel> Tester::connect()
+bsl::shared_ptr<bmqio::NtcChannel>
+Tester::connect(int writeAggregationMaxBytes)
 {
     bsl::shared_ptr<bmqio::NtcChannel> channel;
 
@@ -311,6 +350,11 @@ bsl::shared_ptr<bmqio::NtcChannel> Tester::connect()
     bmqio::Status         status(d_allocator_p);
     bmqio::ConnectOptions options(d_allocator_p);
     options.setEndpoint(d_listener_sp->sourceEndpoint().text());
+    if (writeAggregationMaxBytes > 0) {
+        options.properties().set(
+            bmqio::NtcChannelUtil::writeAggregationProperty(),
+            writeAggregationMaxBytes);
+    }
     const int rc = channel->connect(&status, options);
     BMQTST_ASSERT_EQ(rc, 0);
     BMQTST_ASSERT_EQ(status.category(), bmqio::StatusCategory::e_SUCCESS);
@@ -335,6 +379,14 @@ bsl::shared_ptr<bmqio::NtcChannel> Tester::connect()
     return channel;
 }
 
+bsl::shared_ptr<bmqio::Channel> Tester::acceptedChannel()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    BMQTST_ASSERT(!d_listenChannels.empty());
+    return d_listenChannels.back();
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -384,6 +436,72 @@ static void test1_breathingTest()
     channel->close();
 }
 
+static void test2_writeAggregation()
+// ------------------------------------------------------------------------
+// WRITE AGGREGATION
+//
+// Concerns:
+//   a) With write aggregation enabled, all the blobs written in a burst
+//      are received by the peer, in order
+//   b) Blobs written beyond the aggregation budget are not lost
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("Write Aggregation");
+
+    const int k_NUM_WRITES  = 1000;
+    const int k_WRITE_SIZE  = 4;
+    const int k_MAX_BYTES   = 256;
+    const int k_TOTAL_BYTES = k_NUM_WRITES * k_WRITE_SIZE;
+
+    Tester tester(bmqtst::TestHelperUtil::allocator());
+    tester.init();
+
+    bsl::shared_ptr<bmqio::NtcChannel> channel = tester.connect(k_MAX_BYTES);
+    bsl::shared_ptr<bmqio::Channel>    peer    = tester.acceptedChannel();
+
+    bdlbb::PooledBlobBufferFactory blobFactory(
+        4096,
+        bmqtst::TestHelperUtil::allocator());
+
+    bsl::string expected(bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_NUM_WRITES; ++i) {
+        char data[k_WRITE_SIZE + 1];
+        bsl::snprintf(data, sizeof(data), "%04d", i);
+        expected.append(data, k_WRITE_SIZE);
+
+        bdlbb::Blob blob(&blobFactory, bmqtst::TestHelperUtil::allocator());
+        bdlbb::BlobUtil::append(&blob, data, k_WRITE_SIZE);
+
+        bmqio::Status status(bmqtst::TestHelperUtil::allocator());
+        channel->write(&status, blob);
+        BMQTST_ASSERT_EQ_D(i,
+                           status.category(),
+                           bmqio::StatusCategory::e_SUCCESS);
+    }
+
+    bsl::string      received(bmqtst::TestHelperUtil::allocator());
+    bslmt::Semaphore readSemaphore;
+
+    bmqio::Status status(bmqtst::TestHelperUtil::allocator());
+    peer->read(&status,
+               k_TOTAL_BYTES,
+               bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                                     onRead,
+                                     &received,
+                                     &readSemaphore,
+                                     bdlf::PlaceHolders::_1,
+                                     bdlf::PlaceHolders::_2,
+                                     bdlf::PlaceHolders::_3),
+               bsls::TimeInterval());
+    BMQTST_ASSERT_EQ(status.category(), bmqio::StatusCategory::e_SUCCESS);
+
+    readSemaphore.wait();
+
+    BMQTST_ASSERT_EQ(received, expected);
+
+    channel->close();
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -394,6 +512,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 2: {
+        test2_writeAggregation();
+    } break;
     case 1: {
         test1_breathingTest();
     } break;
@@ -469,5 +469,15 @@ bslstl::StringRef NtcChannelFactoryUtil::listenPortProperty()
     return bmqio::NtcListenerUtil::listenPortProperty();
 }
 
+bslstl::StringRef NtcChannelFactoryUtil::listenReusePortProperty()
+{
+    return bmqio::NtcListenerUtil::listenReusePortProperty();
+}
+
+bslstl::StringRef NtcChannelFactoryUtil::writeAggregationProperty()
+{
+    return bmqio::NtcChannelUtil::writeAggregationProperty();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
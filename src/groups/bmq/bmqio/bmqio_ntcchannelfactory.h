@@ -279,6 +279,18 @@ struct NtcChannelFactoryUtil {
     /// `NtcChannelFactory::listen` with an integer property containing the
     /// port to which the listening socket is bound.
     static bslstl::StringRef listenPortProperty();
+
+    /// Return a reference providing const access to the name of the
+    /// property used to request, in a ListenOptions, that the listening
+    /// socket be bound with `SO_REUSEPORT` so that several listeners can
+    /// share the same endpoint.  This property must contain an `Integer`.
+    static bslstl::StringRef listenReusePortProperty();
+
+    /// Return a reference providing const access to the name of the
+    /// property used to define the maximum number of bytes of consecutive
+    /// writes gathered into a single send, in a ConnectOptions or a
+    /// ListenOptions.  This property must contain an `Integer`.
+    static bslstl::StringRef writeAggregationProperty();
 };
 
 // -----------------------
@@ -34,6 +34,7 @@
 #include <bsla_annotations.h>
 #include <bslmt_latch.h>
 #include <bslmt_threadutil.h>
+#include <bsls_platform.h>
 #include <bsls_timeutil.h>
 #include <bsls_types.h>
 
@@ -1101,6 +1102,90 @@ NtcChannelFactory& Tester::object()
 // ============================================================================
 //                                    TESTS
 // ----------------------------------------------------------------------------
+static void test8_reusePortListen()
+// ------------------------------------------------------------------------
+// REUSE PORT LISTEN
+//
+// Concerns:
+//   a) Several listeners requesting 'SO_REUSEPORT' can listen on the same
+//      port.
+//   b) A listener not requesting it cannot listen on a port already in use.
+//
+// Testing:
+//   NtcChannelFactoryUtil::listenReusePortProperty()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("Reuse Port Listen Test");
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    struct LocalFuncs {
+        static void
+        resultCb(BSLA_MAYBE_UNUSED ChannelFactoryEvent::Enum event,
+                 BSLA_MAYBE_UNUSED const bmqio::Status& status,
+                 BSLA_MAYBE_UNUSED const bsl::shared_ptr<Channel>& channel)
+        {
+            // NOTHING
+        }
+    };
+
+    const int k_NUM_SHARDS = 4;
+
+    Tester t(bmqtst::TestHelperUtil::allocator());
+    t.init(L_);
+
+    const int port = t.findFreeEphemeralPort();
+
+    ListenOptions options(bmqtst::TestHelperUtil::allocator());
+    options.setEndpoint(bsl::string("127.0.0.1:") + bsl::to_string(port));
+    options.properties().set(NtcChannelFactoryUtil::listenReusePortProperty(),
+                             1);
+
+    bsl::vector<bsl::shared_ptr<ChannelFactory::OpHandle> > handles(
+        bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        bmqio::Status                               status;
+        bslma::ManagedPtr<ChannelFactory::OpHandle> opHandle_mp;
+
+        t.object().listen(&status,
+                          &opHandle_mp,
+                          options,
+                          LocalFuncs::resultCb);
+        BMQTST_ASSERT_EQ_D(i, status.category(), CAT_SUCCESS);
+        BMQTST_ASSERT_D(i, opHandle_mp);
+
+        int boundPort = 0;
+        BMQTST_ASSERT_D(i,
+                        opHandle_mp->properties().load(
+                            &boundPort,
+                            NtcChannelFactoryUtil::listenPortProperty()));
+        BMQTST_ASSERT_EQ_D(i, boundPort, port);
+
+        handles.push_back(bsl::shared_ptr<ChannelFactory::OpHandle>(
+            opHandle_mp,
+            bmqtst::TestHelperUtil::allocator()));
+    }
+
+    {
+        // Without the property, the port is in use
+        ListenOptions plainOptions(bmqtst::TestHelperUtil::allocator());
+        plainOptions.setEndpoint(options.endpoint());
+
+        bmqio::Status                               status;
+        bslma::ManagedPtr<ChannelFactory::OpHandle> opHandle_mp;
+
+        t.object().listen(&status,
+                          &opHandle_mp,
+                          plainOptions,
+                          LocalFuncs::resultCb);
+        BMQTST_ASSERT_NE(status.category(), CAT_SUCCESS);
+    }
+
+    for (size_t i = 0; i < handles.size(); ++i) {
+        handles[i]->cancel();
+    }
+#endif
+}
+
 static void test7_checkMultithreadListen()
 {
     bmqtst::TestHelper::printTestName("Check Multithread Listen Test");
@@ -1437,6 +1522,7 @@ int main(int argc, char* argv[])
     case 5: test5_visitChannelsTest(); break;
     case 6: test6_preCreationCbTest(); break;
     case 7: test7_checkMultithreadListen(); break;
+    case 8: test8_reusePortListen(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
@@ -707,7 +707,14 @@ void ReconnectingChannelFactoryUtil::defaultConnectIntervalFn(
     }
 
     if (*interval > maxInterval) {
-        *interval = maxInterval;
+        // Do not clamp to exactly 'maxInterval': all clients which lost their
+        // connection at the same time (e.g., on broker restart) would
+        // otherwise all end up retrying in lockstep every 'maxInterval'.
+        // Instead, pick a value from the range
+        //   '[maxInterval * 0.5; maxInterval]'
+        const double halfMax = maxInterval.totalSecondsAsDouble() / 2;
+        interval->setTotalNanoseconds(maxInterval.totalNanoseconds() / 2);
+        *interval += (static_cast<double>(bsl::rand()) / RAND_MAX) * halfMax;
     }
 }
 
@@ -377,7 +377,9 @@ struct ReconnectingChannelFactoryUtil {
     /// * If `timeSinceLastAttempt >= resetReconnectTime`, resets
     ///   `interval` back to the options attempt interval time.
     /// * Otherwise, double `interval`, capping it to `maxInterval`, adding
-    ///   some jitter randomness
+    ///   some jitter randomness.  When capped, the result is drawn from
+    ///   `[maxInterval * 0.5; maxInterval]` so that clients disconnected at
+    ///   the same time do not keep reconnecting in lockstep.
     /// Note that this method uses `bsl::rand`, and therefore `bsl::srand`
     /// should be called to initialize the random generator.
     static void
@@ -929,10 +929,10 @@ BMQTST_TEST(DefaultConnectIntervalFn)
     FN_CHECK(k_INTERVAL + 5, 2 * (k_INTERVAL + 5), k_INTERVAL + 5, 0);
 
     // Call when 'interval' is beyond 'maxInterval', should return the
-    // 'maxInterval'.
-    FN_CHECK(k_MAX, k_MAX, k_MAX, 0);
-    FN_CHECK(k_MAX, k_MAX, k_MAX + 1, 0);
-    FN_CHECK(k_MAX, k_MAX, k_MAX + 1, k_RESET - 1);
+    // 'maxInterval' with jitter, in the range '[maxInterval / 2; maxInterval]'.
+    FN_CHECK(k_MAX / 2, k_MAX, k_MAX, 0);
+    FN_CHECK(k_MAX / 2, k_MAX, k_MAX + 1, 0);
+    FN_CHECK(k_MAX / 2, k_MAX, k_MAX + 1, k_RESET - 1);
 
 #undef FN_CHECK
 }
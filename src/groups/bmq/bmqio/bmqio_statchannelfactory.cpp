@@ -224,16 +224,23 @@ void StatChannelFactory::stop()
 // -----------------------------
 
 bmqst::StatContextConfiguration
-StatChannelFactoryUtil::statContextConfiguration(const bsl::string& name,
-                                                 int               historySize,
-                                                 bslma::Allocator* allocator)
+StatChannelFactoryUtil::statContextConfiguration(
+    const bsl::string& name,
+    int                historySize,
+    bool               shardCounters,
+    bslma::Allocator*  allocator)
 {
     bmqst::StatContextConfiguration config(name, allocator);
     config.isTable(true);
-    config.value("in_bytes")
-        .value("out_bytes")
-        .value("connections")
-        .storeExpiredSubcontextValues(true);
+    config.value("in_bytes");
+    if (shardCounters) {
+        config.valueSharded();
+    }
+    config.value("out_bytes");
+    if (shardCounters) {
+        config.valueSharded();
+    }
+    config.value("connections").storeExpiredSubcontextValues(true);
 
     if (historySize != -1) {
         config.defaultHistorySize(historySize);
@@ -245,12 +252,16 @@ StatChannelFactoryUtil::statContextConfiguration(const bsl::string& name,
 bslma::ManagedPtr<bmqst::StatContext>
 StatChannelFactoryUtil::createStatContext(const bsl::string& name,
                                           int                historySize,
+                                          bool               shardCounters,
                                           bslma::Allocator*  allocator)
 {
     bslma::ManagedPtr<bmqst::StatContext> rootStatContext;
     rootStatContext.load(
         new (*allocator) bmqst::StatContext(
-            statContextConfiguration(name, historySize, allocator),
+            statContextConfiguration(name,
+                                     historySize,
+                                     shardCounters,
+                                     allocator),
             allocator),
         allocator);
 
@@ -263,17 +263,25 @@ struct StatChannelFactoryUtil {
     // CLASS METHODS
 
     /// Return the stat context configuration to use for the stats managed
-    /// by the factory.
+    /// by the factory.  If the optionally specified `shardCounters` is
+    /// `true`, the bytes in and out counters of each channel are sharded
+    /// (see `bmqst::StatContextConfiguration::valueSharded`), so that the
+    /// IO path only adds to a per-thread cell which is folded into the
+    /// channel's stats at snapshot time, at the cost of a few hundred bytes
+    /// per channel.
     static bmqst::StatContextConfiguration
     statContextConfiguration(const bsl::string& name,
-                             int                historySize = -1,
-                             bslma::Allocator*  allocator   = 0);
+                             int                historySize   = -1,
+                             bool               shardCounters = false,
+                             bslma::Allocator*  allocator     = 0);
 
     /// Create and return a root "channels" stat context with the specified
-    /// `name` and `historySize` using the specified `allocator`.
+    /// `name` and `historySize` using the specified `allocator`, sharding
+    /// the bytes counters if the specified `shardCounters` is `true`.
     static bslma::ManagedPtr<bmqst::StatContext>
     createStatContext(const bsl::string& name,
                       int                historySize,
+                      bool               shardCounters,
                       bslma::Allocator*  allocator = 0);
 
     /// Configure the specified `table` and `tip` for printing the channels
@@ -25,10 +25,18 @@
 #include <bmqst_tablerecords.h>
 
 // BDE
+#include <balst_stackaddressutil.h>
+#include <balst_stacktrace.h>
 #include <balst_stacktraceprintutil.h>
+#include <balst_stacktraceutil.h>
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
+#include <bsl_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bsla_annotations.h>
+#include <bslmt_lockguard.h>
 #include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
@@ -44,6 +52,23 @@ namespace {
 /// deallocate unallocated or previously freed memory.
 const unsigned int k_MAGIC = 0xabcdabcd;
 
+/// Index of the value recording the bytes currently allocated.
+const int k_VALUE_IN_USE = 0;
+
+/// Index of the value recording the cumulative bytes allocated.
+const int k_VALUE_ALLOCATED = 1;
+
+/// Maximum number of frames captured per sampled stack.
+const int k_MAX_SAMPLED_FRAMES = 32;
+
+/// Number of innermost frames (inside this component) to skip when
+/// capturing a sampled stack.
+const int k_SKIPPED_FRAMES = 2;
+
+/// Maximum number of distinct stacks kept by the sampler; samples of new
+/// stacks beyond that limit are only counted as dropped.
+const size_t k_MAX_SAMPLED_STACKS = 4096;
+
 // FUNCTIONS
 bool statFilter(const bmqst::StatContext*     context,
                 bmqst::StatContext::ValueType valueType,
@@ -95,6 +120,204 @@ union Header {
 
 }  // close unnamed namespace
 
+// =======================================
+// class CountingAllocator::StackSampler
+// =======================================
+
+class CountingAllocator::StackSampler {
+  public:
+    // TYPES
+    struct Sample {
+        /// Number of sampled allocations.
+        bsls::Types::Int64 d_count;
+
+        /// Number of bytes of the sampled allocations.
+        bsls::Types::Int64 d_bytes;
+
+        /// Name of the allocator of the first sampled allocation.
+        bsl::string d_allocatorName;
+
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(Sample, bslma::UsesBslmaAllocator)
+
+        // CREATORS
+        explicit Sample(bslma::Allocator* allocator)
+        : d_count(0)
+        , d_bytes(0)
+        , d_allocatorName(allocator)
+        {
+            // NOTHING
+        }
+
+        Sample(const Sample& other, bslma::Allocator* allocator)
+        : d_count(other.d_count)
+        , d_bytes(other.d_bytes)
+        , d_allocatorName(other.d_allocatorName, allocator)
+        {
+            // NOTHING
+        }
+    };
+
+    typedef bsl::vector<void*> Stack;
+
+    typedef bsl::map<Stack, Sample> SampleMap;
+
+  private:
+    // DATA
+
+    /// Sampling period, or 0 if sampling is disabled.
+    bsls::AtomicInt d_period;
+
+    /// Number of allocations seen while sampling was enabled.
+    bsls::AtomicUint64 d_numAllocations;
+
+    /// Mutex protecting `d_samples` and `d_numDropped`.
+    mutable bslmt::Mutex d_mutex;
+
+    /// Aggregated samples, by call stack.
+    SampleMap d_samples;
+
+    /// Number of samples dropped because `d_samples` was full.
+    bsls::Types::Int64 d_numDropped;
+
+    /// Allocator to use, which must not be a `CountingAllocator` of the
+    /// sampled tree.
+    bslma::Allocator* d_allocator_p;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StackSampler, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+    explicit StackSampler(bslma::Allocator* allocator)
+    : d_period(0)
+    , d_numAllocations(0)
+    , d_mutex()
+    , d_samples(allocator)
+    , d_numDropped(0)
+    , d_allocator_p(allocator)
+    {
+        // NOTHING
+    }
+
+    // MANIPULATORS
+
+    /// Set the sampling period to the specified `period` and discard all
+    /// samples.
+    void setPeriod(int period)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+        d_samples.clear();
+        d_numDropped = 0;
+        d_numAllocations.storeRelaxed(0);
+        d_period.storeRelaxed(period);
+    }
+
+    /// Return true if the current allocation should be sampled.
+    bool shouldSample()
+    {
+        const int period = d_period.loadRelaxed();
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(period <= 0)) {
+            return false;  // RETURN
+        }
+        return (d_numAllocations.addRelaxed(1) %
+                static_cast<bsls::Types::Uint64>(period)) == 0;
+    }
+
+    /// Capture the current call stack and record an allocation of the
+    /// specified `bytes` made through the allocator having the specified
+    /// `allocatorName`.
+    void record(const bslstl::StringRef& allocatorName,
+                bsls::Types::Int64       bytes)
+    {
+        void*     addresses[k_MAX_SAMPLED_FRAMES + k_SKIPPED_FRAMES];
+        const int numFrames = balst::StackAddressUtil::getStackAddresses(
+            addresses,
+            k_MAX_SAMPLED_FRAMES + k_SKIPPED_FRAMES);
+        if (numFrames <= k_SKIPPED_FRAMES) {
+            return;  // RETURN
+        }
+
+        Stack stack(addresses + k_SKIPPED_FRAMES,
+                    addresses + numFrames,
+                    d_allocator_p);
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+        SampleMap::iterator it = d_samples.find(stack);
+        if (it == d_samples.end()) {
+            if (d_samples.size() >= k_MAX_SAMPLED_STACKS) {
+                ++d_numDropped;
+                return;  // RETURN
+            }
+            it = d_samples
+                     .insert(bsl::make_pair(stack, Sample(d_allocator_p)))
+                     .first;
+            it->second.d_allocatorName.assign(allocatorName.data(),
+                                              allocatorName.length());
+        }
+        ++it->second.d_count;
+        it->second.d_bytes += bytes;
+    }
+
+    // ACCESSORS
+
+    /// Return the sampling period.
+    int period() const { return d_period.loadRelaxed(); }
+
+    /// Print to the specified `stream` at most the specified `maxStacks`
+    /// sampled stacks having the most sampled bytes.
+    void print(bsl::ostream& stream, int maxStacks) const
+    {
+        typedef bsl::pair<Stack, Sample> Entry;
+
+        bsl::vector<Entry> entries(d_allocator_p);
+        bsls::Types::Int64 numDropped;
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+            entries.assign(d_samples.begin(), d_samples.end());
+            numDropped = d_numDropped;
+        }
+
+        // Symbols are resolved outside of the lock, as it is expensive.
+        bsl::sort(entries.begin(),
+                  entries.end(),
+                  &StackSampler::compareEntries);
+
+        stream << "Stack sampling period: " << period()
+               << ", sampled stacks: " << entries.size()
+               << ", dropped samples: " << numDropped << "\n";
+
+        const size_t numPrinted = bsl::min(entries.size(),
+                                           static_cast<size_t>(maxStacks));
+        for (size_t i = 0; i < numPrinted; ++i) {
+            const Entry& entry = entries[i];
+            stream << "\n#" << i << ": " << entry.second.d_bytes
+                   << " bytes in " << entry.second.d_count
+                   << " sampled allocations [allocator: '"
+                   << entry.second.d_allocatorName << "']\n";
+
+            balst::StackTrace stackTrace(d_allocator_p);
+            if (0 == balst::StackTraceUtil::loadStackTraceFromAddressArray(
+                         &stackTrace,
+                         &entry.first[0],
+                         static_cast<int>(entry.first.size()))) {
+                balst::StackTraceUtil::printFormatted(stream, stackTrace);
+            }
+        }
+    }
+
+    // CLASS METHODS
+
+    /// Return true if the specified `lhs` has more sampled bytes than the
+    /// specified `rhs`.
+    static bool compareEntries(const bsl::pair<Stack, Sample>& lhs,
+                               const bsl::pair<Stack, Sample>& rhs)
+    {
+        return lhs.second.d_bytes > rhs.second.d_bytes;
+    }
+};
+
 // -----------------------
 // class CountingAllocator
 // -----------------------
@@ -119,6 +342,16 @@ void CountingAllocator::configureStatContextTableInfoProvider(
     tableInfoProvider->addColumn("-delta-", 0, SU::incrementsDifference, 0, 1);
     tableInfoProvider->addColumn("Deallocations", 0, SU::decrements, 0);
     tableInfoProvider->addColumn("-delta-", 0, SU::decrementsDifference, 0, 1);
+    tableInfoProvider->addColumn("Allocations/s",
+                                 k_VALUE_IN_USE,
+                                 SU::incrementsPerSecond,
+                                 0,
+                                 1);
+    tableInfoProvider->addColumn("Bytes Allocated/s",
+                                 k_VALUE_ALLOCATED,
+                                 SU::ratePerSecond,
+                                 0,
+                                 1);
 }
 
 void CountingAllocator::configureStatContextTableInfoProvider(
@@ -155,6 +388,16 @@ void CountingAllocator::configureStatContextTableInfoProvider(
                       SU::decrementsDifference,
                       cur,
                       end);
+    schema->addColumn("allocationsPerSecond",
+                      k_VALUE_IN_USE,
+                      SU::incrementsPerSecond,
+                      cur,
+                      end);
+    schema->addColumn("bytesAllocatedPerSecond",
+                      k_VALUE_ALLOCATED,
+                      SU::ratePerSecond,
+                      cur,
+                      end);
 
     // Configure records
     bmqst::TableRecords* records = &table->records();
@@ -179,6 +422,14 @@ void CountingAllocator::configureStatContextTableInfoProvider(
     basicTableInfoProvider->addColumn("numDeallocations", "Deallocations");
     basicTableInfoProvider->addColumn("numDeallocationsDelta", "-delta-")
         .zeroString("");
+    basicTableInfoProvider
+        ->addColumn("allocationsPerSecond", "Allocations/s")
+        .setPrecision(0)
+        .zeroString("");
+    basicTableInfoProvider
+        ->addColumn("bytesAllocatedPerSecond", "Bytes Allocated/s")
+        .printAsMemory()
+        .zeroString("");
 }
 
 CountingAllocator::CountingAllocator(const bslstl::StringRef& name,
@@ -186,6 +437,7 @@ CountingAllocator::CountingAllocator(const bslstl::StringRef& name,
 : d_allocator_p(bslma::Default::allocator(allocator))
 , d_statContext_mp()
 , d_limitChecker_sp()
+, d_stackSampler_sp()
 {
     CountingAllocator* parent = dynamic_cast<CountingAllocator*>(
         d_allocator_p);
@@ -196,6 +448,7 @@ CountingAllocator::CountingAllocator(const bslstl::StringRef& name,
         // parent's `d_allocator_p`.
         d_allocator_p     = parent->d_allocator_p;
         d_limitChecker_sp = parent->d_limitChecker_sp;
+        d_stackSampler_sp = parent->d_stackSampler_sp;
 
         if (parent->d_statContext_mp) {
             d_statContext_mp = parent->d_statContext_mp->addSubcontext(
@@ -204,13 +457,16 @@ CountingAllocator::CountingAllocator(const bslstl::StringRef& name,
     }
     else {
         // This is a root CountingAllocator: construct the original limit
-        // checker. All nested allocators will keep a reference to it.
+        // checker and stack sampler. All nested allocators will keep a
+        // reference to them.
         d_limitChecker_sp = bsl::allocate_shared<AllocationLimitChecker>(
             d_allocator_p);
+        d_stackSampler_sp = bsl::allocate_shared<StackSampler>(d_allocator_p);
     }
 
     // POSTCONDITIONS
     BSLS_ASSERT(d_limitChecker_sp);
+    BSLS_ASSERT(d_stackSampler_sp);
 }
 
 CountingAllocator::CountingAllocator(const bslstl::StringRef& name,
@@ -219,6 +475,7 @@ CountingAllocator::CountingAllocator(const bslstl::StringRef& name,
 : d_allocator_p(bslma::Default::allocator(allocator))
 , d_statContext_mp()
 , d_limitChecker_sp()
+, d_stackSampler_sp()
 {
     CountingAllocator* parent = dynamic_cast<CountingAllocator*>(
         d_allocator_p);
@@ -229,12 +486,15 @@ CountingAllocator::CountingAllocator(const bslstl::StringRef& name,
         // parent's `d_allocator_p`.
         d_allocator_p     = parent->d_allocator_p;
         d_limitChecker_sp = parent->d_limitChecker_sp;
+        d_stackSampler_sp = parent->d_stackSampler_sp;
     }
     else {
         // This is a root CountingAllocator: construct the original limit
-        // checker. All nested allocators will keep a reference to it.
+        // checker and stack sampler. All nested allocators will keep a
+        // reference to them.
         d_limitChecker_sp = bsl::allocate_shared<AllocationLimitChecker>(
             d_allocator_p);
+        d_stackSampler_sp = bsl::allocate_shared<StackSampler>(d_allocator_p);
     }
 
     if (parentStatContext) {
@@ -242,18 +502,21 @@ CountingAllocator::CountingAllocator(const bslstl::StringRef& name,
             d_statContext_mp = parentStatContext->addSubcontext(
                 bmqst::StatContextConfiguration(name, allocator)
                     .isTable(true)
-                    .value("Memory"));
+                    .value("Memory")
+                    .value("Allocated"));
         }
         else {
             d_statContext_mp = parentStatContext->addSubcontext(
                 bmqst::StatContextConfiguration(name, allocator)
                     .isTable(true)
-                    .value("Memory", 2));
+                    .value("Memory", 2)
+                    .value("Allocated", 2));
         }
     }
 
     // POSTCONDITIONS
     BSLS_ASSERT(d_limitChecker_sp);
+    BSLS_ASSERT(d_stackSampler_sp);
 }
 
 CountingAllocator::~CountingAllocator()
@@ -270,6 +533,14 @@ void CountingAllocator::setAllocationLimit(
     d_limitChecker_sp->setLimit(limit, callback);
 }
 
+void CountingAllocator::setStackSamplingPeriod(int period)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(period >= 0);
+
+    d_stackSampler_sp->setPeriod(period);
+}
+
 void* CountingAllocator::allocate(size_type size)
 {
     // PRECONDITIONS
@@ -293,7 +564,14 @@ void* CountingAllocator::allocate(size_type size)
     const bsls::Types::Int64 totalSize =
         bsls::AlignmentUtil::roundUpToMaximalAlignment(size) + sizeof(Header);
     BSLS_ASSERT_SAFE(totalSize >= 0);
-    d_statContext_mp->adjustValue(0, totalSize);
+    d_statContext_mp->adjustValue(k_VALUE_IN_USE, totalSize);
+    d_statContext_mp->adjustValue(k_VALUE_ALLOCATED, totalSize);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            d_stackSampler_sp->shouldSample())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_stackSampler_sp->record(d_statContext_mp->name(), totalSize);
+    }
 
     Header* header = static_cast<Header*>(d_allocator_p->allocate(totalSize));
     header->d_data.d_numAllocatedBytes = totalSize;
@@ -348,10 +626,24 @@ void CountingAllocator::deallocate(void* address)
     header->d_data.d_magic = ~k_MAGIC;
     d_allocator_p->deallocate(header);
 
-    d_statContext_mp->adjustValue(0, -totalSize);
+    d_statContext_mp->adjustValue(k_VALUE_IN_USE, -totalSize);
     d_limitChecker_sp->update(-totalSize);
 }
 
+// ACCESSORS
+
+int CountingAllocator::stackSamplingPeriod() const
+{
+    return d_stackSampler_sp->period();
+}
+
+bsl::ostream&
+CountingAllocator::printStackSamples(bsl::ostream& stream, int maxStacks) const
+{
+    d_stackSampler_sp->print(stream, maxStacks);
+    return stream;
+}
+
 void CountingAllocator::AllocationLimitChecker::update(
     bsls::Types::Int64 deltaValue)
 {
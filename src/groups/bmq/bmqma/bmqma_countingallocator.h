@@ -62,6 +62,24 @@
 //:   is not thread-safe when it comes to computing the value.
 //: o the allocation limit applies to the entire tree; it should be configured
 //:   on the root 'CountingAllocator' via 'setAllocationLimit'.
+//
+/// Allocation Rates
+///----------------
+// In addition to the number of bytes currently allocated, the associated
+// StatContext records, as its second value, the cumulative number of bytes
+// ever allocated.  The default table configured by
+// 'configureStatContextTableInfoProvider' uses it, together with the number of
+// allocations, to report allocation rates (per second) between snapshots.
+//
+/// Stack Sampling
+///--------------
+// All 'CountingAllocator' instances in a tree also share a stack sampler,
+// disabled by default.  Once a sampling period 'N' is set with
+// 'setStackSamplingPeriod', the call stack of one out of every 'N'
+// allocations made through a stat-recording allocator of the tree is
+// captured and aggregated, and the most allocating stacks can be printed with
+// 'printStackSamples'.  While disabled, the sampler costs a single relaxed
+// atomic load per allocation.
 
 #include <bmqst_statvalue.h>
 
@@ -71,6 +89,7 @@
 #include <bsl_limits.h>
 #include <bsl_map.h>
 #include <bsl_memory.h>
+#include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
@@ -180,6 +199,10 @@ class CountingAllocator BSLS_KEYWORD_FINAL : public bslma::Allocator {
         void update(bsls::Types::Int64 deltaValue);
     };
 
+    /// Captures and aggregates the call stacks of a sample of the
+    /// allocations made through an allocator tree.
+    class StackSampler;
+
     // DATA
     bslma::Allocator* d_allocator_p;
 
@@ -187,6 +210,9 @@ class CountingAllocator BSLS_KEYWORD_FINAL : public bslma::Allocator {
 
     bsl::shared_ptr<AllocationLimitChecker> d_limitChecker_sp;
 
+    /// Stack sampler shared by all the allocators of the tree.
+    bsl::shared_ptr<StackSampler> d_stackSampler_sp;
+
   private:
     // NOT IMPLEMENTED
     CountingAllocator(const CountingAllocator&) BSLS_KEYWORD_DELETED;
@@ -252,6 +278,14 @@ class CountingAllocator BSLS_KEYWORD_FINAL : public bslma::Allocator {
     void setAllocationLimit(bsls::Types::Uint64            limit,
                             const AllocationLimitCallback& callback);
 
+    /// Capture the call stack of one out of every specified `period`
+    /// allocations made through the stat-recording allocators of the tree
+    /// this allocator belongs to, or stop capturing if `period` is 0.
+    /// Changing the period discards the stacks captured so far.  The
+    /// behavior is undefined unless `0 <= period`.  Note that this method
+    /// is thread-safe.
+    void setStackSamplingPeriod(int period);
+
     //  (virtual bslma::Allocator)
 
     /// Return a newly allocated block of memory of (at least) the specified
@@ -279,6 +313,16 @@ class CountingAllocator BSLS_KEYWORD_FINAL : public bslma::Allocator {
 
     /// Return the stat context associated with this allocator, if any.
     const bmqst::StatContext* context() const;
+
+    /// Return the stack sampling period of the tree this allocator belongs
+    /// to, or 0 if stack sampling is disabled.
+    int stackSamplingPeriod() const;
+
+    /// Print to the specified `stream` at most the specified `maxStacks`
+    /// call stacks captured across the tree this allocator belongs to,
+    /// ordered by decreasing number of sampled bytes, and return `stream`.
+    bsl::ostream& printStackSamples(bsl::ostream& stream,
+                                    int           maxStacks) const;
 };
 
 // ============================================================================
@@ -59,7 +59,9 @@ static const char* k_COLS1[] = {""  // Leftmost column is empty
                                 "Allocations",
                                 "-delta-",
                                 "Deallocations",
-                                "-delta-"};
+                                "-delta-",
+                                "Allocations/s",
+                                "Bytes Allocated/s"};
 
 const static size_t k_NUM_COLS1 = sizeof(k_COLS1) / sizeof(k_COLS1[0]);
 
@@ -70,7 +72,9 @@ static const char* k_COLS2[] = {"id",
                                 "numAllocations",
                                 "numAllocationsDelta",
                                 "numDeallocations",
-                                "numDeallocationsDelta"};
+                                "numDeallocationsDelta",
+                                "allocationsPerSecond",
+                                "bytesAllocatedPerSecond"};
 
 const static size_t k_NUM_COLS2 = sizeof(k_COLS2) / sizeof(k_COLS2[0]);
 
@@ -553,6 +557,81 @@ static void test7_configureStatContextTableInfoProvider_part2()
     }
 }
 
+static void test8_stackSampling()
+// ------------------------------------------------------------------------
+// STACK SAMPLING
+//
+// Concerns:
+//   Ensure that the stack sampling period is shared across the allocator
+//   tree, that only one out of every 'period' allocations is sampled, and
+//   that disabling sampling discards the samples.
+//
+// Testing:
+//   setStackSamplingPeriod
+//   stackSamplingPeriod
+//   printStackSamples
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // Resolving the symbols of the sampled stacks may allocate using the
+    // default allocator.
+
+    bmqtst::TestHelper::printTestName("STACK SAMPLING");
+
+    bmqst::StatContext statContext(
+        bmqst::StatContextConfiguration("myAllocatorStatContext"),
+        bmqtst::TestHelperUtil::allocator());
+    bmqma::CountingAllocator topAlloc("Top",
+                                      &statContext,
+                                      bmqtst::TestHelperUtil::allocator());
+    bmqma::CountingAllocator bottomAlloc("bottom", &topAlloc);
+
+    BMQTST_ASSERT_EQ(topAlloc.stackSamplingPeriod(), 0);
+    BMQTST_ASSERT_EQ(bottomAlloc.stackSamplingPeriod(), 0);
+
+    // Sampling is disabled by default
+    void* alloc = bottomAlloc.allocate(100);
+    bottomAlloc.deallocate(alloc);
+    {
+        bsl::ostringstream out(bmqtst::TestHelperUtil::allocator());
+        topAlloc.printStackSamples(out, 10);
+        PV(out.str());
+        BMQTST_ASSERT_NE(out.str().find("sampled stacks: 0"),
+                         bsl::string::npos);
+    }
+
+    // Enabling sampling on a nested allocator enables it for the whole tree
+    bottomAlloc.setStackSamplingPeriod(2);
+    BMQTST_ASSERT_EQ(topAlloc.stackSamplingPeriod(), 2);
+    BMQTST_ASSERT_EQ(bottomAlloc.stackSamplingPeriod(), 2);
+
+    for (int i = 0; i < 4; ++i) {
+        alloc = bottomAlloc.allocate(100);
+        bottomAlloc.deallocate(alloc);
+    }
+    {
+        bsl::ostringstream out(bmqtst::TestHelperUtil::allocator());
+        topAlloc.printStackSamples(out, 10);
+        PV(out.str());
+        BMQTST_ASSERT_NE(out.str().find("sampled stacks: 1"),
+                         bsl::string::npos);
+        BMQTST_ASSERT_NE(out.str().find("in 2 sampled allocations"),
+                         bsl::string::npos);
+        BMQTST_ASSERT_NE(out.str().find("[allocator: 'bottom']"),
+                         bsl::string::npos);
+    }
+
+    // Disabling sampling discards the samples
+    topAlloc.setStackSamplingPeriod(0);
+    BMQTST_ASSERT_EQ(bottomAlloc.stackSamplingPeriod(), 0);
+    {
+        bsl::ostringstream out(bmqtst::TestHelperUtil::allocator());
+        bottomAlloc.printStackSamples(out, 10);
+        BMQTST_ASSERT_NE(out.str().find("sampled stacks: 0"),
+                         bsl::string::npos);
+    }
+}
+
 BSLA_MAYBE_UNUSED
 static void testN1_performance_allocation()
 // ------------------------------------------------------------------------
@@ -788,6 +867,7 @@ int main(int argc, char** argv)
 
     switch (_testCase) {
     case 0:
+    case 8: test8_stackSampling(); break;
     case 7: test7_configureStatContextTableInfoProvider_part2(); break;
     case 6: test6_configureStatContextTableInfoProvider_part1(); break;
     case 5: test5_allocationLimitHierarchical(); break;
@@ -15,6 +15,7 @@
 
 #include <bmqp_blobpoolutil.h>
 
+#include <bmqp_sizeclassblobbufferfactory.h>
 #include <bmqscm_version.h>
 
 // BDE
@@ -59,5 +60,23 @@ BlobPoolUtil::createBlobPool(bdlbb::BlobBufferFactory* blobBufferFactory_p,
         k_BLOB_POOL_GROWTH_STRATEGY);
 }
 
+BlobPoolUtil::BlobSpPoolSp
+BlobPoolUtil::createBlobPool(bdlbb::BlobBufferFactory* blobBufferFactory_p,
+                             int                       bufferSize,
+                             bslma::Allocator*         allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT(blobBufferFactory_p);
+
+    SizeClassBlobBufferFactory* sizeClassFactory =
+        dynamic_cast<SizeClassBlobBufferFactory*>(blobBufferFactory_p);
+    if (sizeClassFactory) {
+        return createBlobPool(sizeClassFactory->factory(bufferSize),
+                              allocator);  // RETURN
+    }
+
+    return createBlobPool(blobBufferFactory_p, allocator);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -22,8 +22,13 @@
 //@CLASSES:
 //  bmqp::BlobPoolUtil: mechanism to build bdlbb::Blob shared pointer pool.
 //
-//@DESCRIPTION:
+//@SEE_ALSO: bmqp::SizeClassBlobBufferFactory
 //
+//@DESCRIPTION: 'bmqp::BlobPoolUtil' provides utilities to create pools of
+// shared pointers to blobs.  When the blobs of a pool are known to hold
+// messages of a given size (e.g., small control messages), the pool can be
+// created with that size, so that it selects the matching size class when
+// provided with a 'bmqp::SizeClassBlobBufferFactory'.
 
 // BDE
 #include <bdlbb_blob.h>
@@ -55,6 +60,17 @@ struct BlobPoolUtil {
     static BlobSpPoolSp
     createBlobPool(bdlbb::BlobBufferFactory* blobBufferFactory_p,
                    bslma::Allocator*         allocator = 0);
+
+    /// Create a pool of shared pointers to blobs expected to hold messages
+    /// of about the specified `bufferSize` bytes, using the specified
+    /// `blobBufferFactory_p`, and return it as a shared pointer.  If
+    /// `blobBufferFactory_p` is a `bmqp::SizeClassBlobBufferFactory`, the
+    /// blobs use the factory of its size class fitting `bufferSize`.  Use
+    /// the optionally specified `allocator` for memory allocations.
+    static BlobSpPoolSp
+    createBlobPool(bdlbb::BlobBufferFactory* blobBufferFactory_p,
+                   int                       bufferSize,
+                   bslma::Allocator*         allocator = 0);
 };
 
 }  // close package namespace
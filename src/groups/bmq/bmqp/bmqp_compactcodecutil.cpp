@@ -0,0 +1,428 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqp_compactcodecutil.h>
+
+#include <bmqscm_version.h>
+// BDE
+#include <bdlb_bigendian.h>
+#include <bsl_ios.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bmqp {
+
+namespace {
+
+/// Flag set in the header of a message having an `rId`.
+const unsigned char k_FLAG_HAS_RID = 1 << 0;
+
+// ============
+// class Writer
+// ============
+
+/// Mechanism writing the fields of the compact encoding to a stream buffer,
+/// remembering whether any write failed.
+class Writer {
+  private:
+    // DATA
+    bsl::streambuf* d_out_p;
+    bool            d_isValid;
+
+  private:
+    // PRIVATE MANIPULATORS
+    void write(const void* data, int length)
+    {
+        if (d_isValid && d_out_p->sputn(static_cast<const char*>(data),
+                                        length) != length) {
+            d_isValid = false;
+        }
+    }
+
+  public:
+    // CREATORS
+    explicit Writer(bsl::streambuf* out)
+    : d_out_p(out)
+    , d_isValid(true)
+    {
+    }
+
+    // MANIPULATORS
+    void writeUint8(unsigned char value) { write(&value, 1); }
+
+    void writeInt32(int value)
+    {
+        const bdlb::BigEndianInt32 be = bdlb::BigEndianInt32::make(value);
+        write(&be, sizeof(be));
+    }
+
+    void writeUint32(unsigned int value)
+    {
+        const bdlb::BigEndianUint32 be = bdlb::BigEndianUint32::make(value);
+        write(&be, sizeof(be));
+    }
+
+    void writeInt64(bsls::Types::Int64 value)
+    {
+        const bdlb::BigEndianInt64 be = bdlb::BigEndianInt64::make(value);
+        write(&be, sizeof(be));
+    }
+
+    void writeString(const bsl::string& value)
+    {
+        writeUint32(static_cast<unsigned int>(value.length()));
+        write(value.data(), static_cast<int>(value.length()));
+    }
+
+    // ACCESSORS
+    bool isValid() const { return d_isValid; }
+};
+
+// ============
+// class Reader
+// ============
+
+/// Mechanism reading the fields of the compact encoding from a stream
+/// buffer, remembering whether any read failed.  Once a read failed, all
+/// subsequent reads fail and load zero or empty values.
+class Reader {
+  private:
+    // DATA
+    bsl::streambuf* d_in_p;
+    bool            d_isValid;
+
+  private:
+    // PRIVATE MANIPULATORS
+    void read(void* data, int length)
+    {
+        if (d_isValid &&
+            d_in_p->sgetn(static_cast<char*>(data), length) != length) {
+            d_isValid = false;
+        }
+    }
+
+  public:
+    // CREATORS
+    explicit Reader(bsl::streambuf* in)
+    : d_in_p(in)
+    , d_isValid(true)
+    {
+    }
+
+    // MANIPULATORS
+    unsigned char readUint8()
+    {
+        unsigned char value = 0;
+        read(&value, 1);
+        return d_isValid ? value : 0;
+    }
+
+    int readInt32()
+    {
+        bdlb::BigEndianInt32 be = bdlb::BigEndianInt32::make(0);
+        read(&be, sizeof(be));
+        return d_isValid ? static_cast<int>(be) : 0;
+    }
+
+    unsigned int readUint32()
+    {
+        bdlb::BigEndianUint32 be = bdlb::BigEndianUint32::make(0);
+        read(&be, sizeof(be));
+        return d_isValid ? static_cast<unsigned int>(be) : 0;
+    }
+
+    bsls::Types::Int64 readInt64()
+    {
+        bdlb::BigEndianInt64 be = bdlb::BigEndianInt64::make(0);
+        read(&be, sizeof(be));
+        return d_isValid ? static_cast<bsls::Types::Int64>(be) : 0;
+    }
+
+    /// Read a number of elements or a length, and return it.  Fail if it
+    /// exceeds the number of bytes left to read, since every element takes
+    /// at least one byte, so that a corrupted length can't trigger a huge
+    /// allocation.
+    unsigned int readLength()
+    {
+        const unsigned int length = readUint32();
+        if (d_isValid && static_cast<bsl::streamsize>(length) >
+                             d_in_p->in_avail()) {
+            d_isValid = false;
+        }
+        return d_isValid ? length : 0;
+    }
+
+    void readString(bsl::string* value)
+    {
+        const unsigned int length = readLength();
+        value->resize(length);
+        if (length != 0) {
+            read(&(*value)[0], static_cast<int>(length));
+        }
+    }
+
+    /// Mark this reader as failed.
+    void invalidate() { d_isValid = false; }
+
+    // ACCESSORS
+    bool isValid() const { return d_isValid; }
+};
+
+void encodeStatus(Writer* writer, const bmqp_ctrlmsg::Status& status)
+{
+    writer->writeInt32(static_cast<int>(status.category()));
+    writer->writeInt32(status.code());
+    writer->writeString(status.message());
+}
+
+void decodeStatus(bmqp_ctrlmsg::Status* status, Reader* reader)
+{
+    const int category = reader->readInt32();
+    if (bmqp_ctrlmsg::StatusCategory::fromInt(&status->category(),
+                                              category) != 0) {
+        reader->invalidate();
+    }
+    status->code() = reader->readInt32();
+    reader->readString(&status->message());
+}
+
+void encodeConfigureStream(Writer*                              writer,
+                           const bmqp_ctrlmsg::ConfigureStream& request)
+{
+    const bmqp_ctrlmsg::StreamParameters& parameters =
+        request.streamParameters();
+
+    writer->writeUint32(request.qId());
+    writer->writeString(parameters.appId());
+
+    const bsl::vector<bmqp_ctrlmsg::Subscription>& subscriptions =
+        parameters.subscriptions();
+    writer->writeUint32(static_cast<unsigned int>(subscriptions.size()));
+    for (size_t i = 0; i < subscriptions.size(); ++i) {
+        const bmqp_ctrlmsg::Subscription& subscription = subscriptions[i];
+
+        writer->writeUint32(subscription.sId());
+        writer->writeInt32(
+            static_cast<int>(subscription.expression().version()));
+        writer->writeString(subscription.expression().text());
+
+        const bsl::vector<bmqp_ctrlmsg::ConsumerInfo>& consumers =
+            subscription.consumers();
+        writer->writeUint32(static_cast<unsigned int>(consumers.size()));
+        for (size_t j = 0; j < consumers.size(); ++j) {
+            const bmqp_ctrlmsg::ConsumerInfo& consumer = consumers[j];
+
+            writer->writeInt64(consumer.maxUnconfirmedMessages());
+            writer->writeInt64(consumer.maxUnconfirmedBytes());
+            writer->writeInt32(consumer.consumerPriority());
+            writer->writeInt32(consumer.consumerPriorityCount());
+        }
+    }
+}
+
+void decodeConfigureStream(bmqp_ctrlmsg::ConfigureStream* request,
+                           Reader*                        reader)
+{
+    bmqp_ctrlmsg::StreamParameters& parameters = request->streamParameters();
+
+    request->qId() = reader->readUint32();
+    reader->readString(&parameters.appId());
+
+    bsl::vector<bmqp_ctrlmsg::Subscription>& subscriptions =
+        parameters.subscriptions();
+    subscriptions.resize(reader->readLength());
+    for (size_t i = 0; i < subscriptions.size() && reader->isValid(); ++i) {
+        bmqp_ctrlmsg::Subscription& subscription = subscriptions[i];
+
+        subscription.sId() = reader->readUint32();
+        const int version  = reader->readInt32();
+        if (bmqp_ctrlmsg::ExpressionVersion::fromInt(
+                &subscription.expression().version(),
+                version) != 0) {
+            reader->invalidate();
+        }
+        reader->readString(&subscription.expression().text());
+
+        bsl::vector<bmqp_ctrlmsg::ConsumerInfo>& consumers =
+            subscription.consumers();
+        consumers.resize(reader->readLength());
+        for (size_t j = 0; j < consumers.size() && reader->isValid(); ++j) {
+            bmqp_ctrlmsg::ConsumerInfo& consumer = consumers[j];
+
+            consumer.maxUnconfirmedMessages() = reader->readInt64();
+            consumer.maxUnconfirmedBytes()    = reader->readInt64();
+            consumer.consumerPriority()       = reader->readInt32();
+            consumer.consumerPriorityCount()  = reader->readInt32();
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// -----------------------
+// struct CompactCodecUtil
+// -----------------------
+
+// CLASS METHODS
+bool CompactCodecUtil::isSupported(
+    const bmqp_ctrlmsg::ControlMessage& message)
+{
+    typedef bmqp_ctrlmsg::ControlMessageChoice Choice;
+
+    const int selectionId = message.choice().selectionId();
+    return selectionId == Choice::SELECTION_ID_STATUS ||
+           selectionId == Choice::SELECTION_ID_CONFIGURE_STREAM ||
+           selectionId == Choice::SELECTION_ID_CONFIGURE_STREAM_RESPONSE;
+}
+
+int CompactCodecUtil::encode(
+    bsl::ostream&                       errorDescription,
+    bsl::streambuf*                     out,
+    const bmqp_ctrlmsg::ControlMessage& message)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS               = 0,
+        rc_UNSUPPORTED_SELECTION = -1,
+        rc_WRITE_FAILURE         = -2
+    };
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(out);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isSupported(message))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        errorDescription << "Control message selection "
+                         << message.choice().selectionId()
+                         << " has no compact encoding";
+        return rc_UNSUPPORTED_SELECTION;  // RETURN
+    }
+
+    Writer writer(out);
+
+    writer.writeUint8(k_VERSION);
+    writer.writeUint8(
+        static_cast<unsigned char>(message.choice().selectionId()));
+    writer.writeUint8(message.rId().isNull() ? 0 : k_FLAG_HAS_RID);
+    writer.writeUint8(0);  // Reserved
+    if (!message.rId().isNull()) {
+        writer.writeInt32(message.rId().value());
+    }
+
+    const bmqp_ctrlmsg::ControlMessageChoice& choice = message.choice();
+    switch (choice.selectionId()) {
+    case bmqp_ctrlmsg::ControlMessageChoice::SELECTION_ID_STATUS: {
+        encodeStatus(&writer, choice.status());
+    } break;
+    case bmqp_ctrlmsg::ControlMessageChoice::SELECTION_ID_CONFIGURE_STREAM: {
+        encodeConfigureStream(&writer, choice.configureStream());
+    } break;
+    case bmqp_ctrlmsg::ControlMessageChoice::
+        SELECTION_ID_CONFIGURE_STREAM_RESPONSE: {
+        encodeConfigureStream(&writer,
+                              choice.configureStreamResponse().request());
+    } break;
+    default: {
+        BSLS_ASSERT_OPT(false && "Unreachable by design");
+    } break;
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!writer.isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        errorDescription << "Failed to write compact control message";
+        return rc_WRITE_FAILURE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+int CompactCodecUtil::decode(bsl::ostream&                 errorDescription,
+                             bmqp_ctrlmsg::ControlMessage* message,
+                             bsl::streambuf*               in)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS               = 0,
+        rc_INVALID_HEADER        = -1,
+        rc_UNSUPPORTED_VERSION   = -2,
+        rc_UNSUPPORTED_SELECTION = -3,
+        rc_INVALID_MESSAGE       = -4
+    };
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(message);
+    BSLS_ASSERT_SAFE(in);
+
+    Reader reader(in);
+
+    const int           version     = reader.readUint8();
+    const int           selectionId = reader.readUint8();
+    const unsigned char flags       = reader.readUint8();
+    reader.readUint8();  // Reserved
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!reader.isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        errorDescription << "Truncated compact control message header";
+        return rc_INVALID_HEADER;  // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(version != k_VERSION)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        errorDescription << "Unsupported compact encoding version: "
+                         << version;
+        return rc_UNSUPPORTED_VERSION;  // RETURN
+    }
+
+    message->reset();
+    if (flags & k_FLAG_HAS_RID) {
+        message->rId().makeValue(reader.readInt32());
+    }
+
+    bmqp_ctrlmsg::ControlMessageChoice& choice = message->choice();
+    switch (selectionId) {
+    case bmqp_ctrlmsg::ControlMessageChoice::SELECTION_ID_STATUS: {
+        decodeStatus(&choice.makeStatus(), &reader);
+    } break;
+    case bmqp_ctrlmsg::ControlMessageChoice::SELECTION_ID_CONFIGURE_STREAM: {
+        decodeConfigureStream(&choice.makeConfigureStream(), &reader);
+    } break;
+    case bmqp_ctrlmsg::ControlMessageChoice::
+        SELECTION_ID_CONFIGURE_STREAM_RESPONSE: {
+        decodeConfigureStream(&choice.makeConfigureStreamResponse().request(),
+                              &reader);
+    } break;
+    default: {
+        errorDescription << "Control message selection " << selectionId
+                         << " has no compact encoding";
+        return rc_UNSUPPORTED_SELECTION;  // RETURN
+    }
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!reader.isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        errorDescription << "Invalid or truncated compact control message "
+                         << "[selectionId: " << selectionId << "]";
+        return rc_INVALID_MESSAGE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
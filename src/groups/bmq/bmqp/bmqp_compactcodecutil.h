@@ -0,0 +1,161 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BMQP_COMPACTCODECUTIL
+#define INCLUDED_BMQP_COMPACTCODECUTIL
+
+//@PURPOSE: Provide a compact binary encoding for hot control messages.
+//
+//@CLASSES:
+//  bmqp::CompactCodecUtil: compact binary codec of control messages
+//
+//@DESCRIPTION: 'bmqp::CompactCodecUtil' implements the
+// 'bmqp::EncodingType::e_COMPACT' encoding of control events: a fixed binary
+// layout, written and read field by field without going through the generic
+// 'bdlat' reflection used by the BER and JSON codecs.  Only a selected set of
+// frequently exchanged 'bmqp_ctrlmsg::ControlMessage' choices have a compact
+// encoding; 'isSupported' tells whether a given message has one, and messages
+// which don't must be encoded with another encoding.  Since the encoding type
+// is carried by the header of each event, a peer encoding in compact falls
+// back to BER on a per-message basis.
+//
+/// Wire format
+///-----------
+// All integers are in network byte order.  Strings are encoded as their
+// 32-bit length followed by their (non null-terminated) characters, and
+// arrays as their 32-bit number of elements followed by the elements.
+//..
+//  ControlMessage
+//      uint8   version (k_VERSION)
+//      uint8   selection id of the choice
+//      uint8   flags (bit 0: 'rId' is present)
+//      uint8   reserved (0)
+//      int32   rId, only if present
+//      choice, encoded according to its selection:
+//
+//  Status (selection 0)
+//      int32   category
+//      int32   code
+//      string  message
+//
+//  ConfigureStream (selection 16), ConfigureStreamResponse (selection 17,
+//  encoded as its 'request')
+//      uint32  qId
+//      string  appId
+//      array of Subscription
+//          uint32  sId
+//          int32   expression version
+//          string  expression text
+//          array of ConsumerInfo
+//              int64   maxUnconfirmedMessages
+//              int64   maxUnconfirmedBytes
+//              int32   consumerPriority
+//              int32   consumerPriorityCount
+//..
+//
+/// Thread Safety
+///-------------
+// Thread safe.
+
+// BMQ
+#include <bmqp_ctrlmsg_messages.h>
+
+// BDE
+#include <bsl_ostream.h>
+#include <bsl_streambuf.h>
+
+namespace BloombergLP {
+namespace bmqp {
+
+// =======================
+// struct CompactCodecUtil
+// =======================
+
+/// Compact binary codec of control messages.
+struct CompactCodecUtil {
+    // CONSTANTS
+
+    /// Version of the wire format written by `encode`.
+    static const int k_VERSION = 1;
+
+    // CLASS METHODS
+
+    /// Return `true` if the specified `message` has a compact encoding, and
+    /// `false` otherwise.  Note that only `bmqp_ctrlmsg::ControlMessage`
+    /// objects may have one.
+    template <class TYPE>
+    static bool isSupported(const TYPE& message);
+    static bool isSupported(const bmqp_ctrlmsg::ControlMessage& message);
+
+    /// Encode the specified `message` into the specified `out`.  Return 0
+    /// on success, or a non-zero value and fill in the specified
+    /// `errorDescription` otherwise.  The behavior is undefined unless
+    /// `isSupported(message)`.
+    template <class TYPE>
+    static int encode(bsl::ostream&   errorDescription,
+                      bsl::streambuf* out,
+                      const TYPE&     message);
+    static int encode(bsl::ostream&                       errorDescription,
+                      bsl::streambuf*                     out,
+                      const bmqp_ctrlmsg::ControlMessage& message);
+
+    /// Load into the specified `message` the message encoded at the current
+    /// position of the specified `in`.  Return 0 on success, or a non-zero
+    /// value and fill in the specified `errorDescription` otherwise.
+    template <class TYPE>
+    static int decode(bsl::ostream&   errorDescription,
+                      TYPE*           message,
+                      bsl::streambuf* in);
+    static int decode(bsl::ostream&                 errorDescription,
+                      bmqp_ctrlmsg::ControlMessage* message,
+                      bsl::streambuf*               in);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -----------------------
+// struct CompactCodecUtil
+// -----------------------
+
+template <class TYPE>
+inline bool CompactCodecUtil::isSupported(const TYPE&)
+{
+    return false;
+}
+
+template <class TYPE>
+inline int CompactCodecUtil::encode(bsl::ostream& errorDescription,
+                                    bsl::streambuf*,
+                                    const TYPE&)
+{
+    errorDescription << "Message type has no compact encoding";
+    return -1;
+}
+
+template <class TYPE>
+inline int CompactCodecUtil::decode(bsl::ostream& errorDescription,
+                                    TYPE*,
+                                    bsl::streambuf*)
+{
+    errorDescription << "Message type has no compact encoding";
+    return -1;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,335 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqp_compactcodecutil.h>
+
+// BMQ
+#include <bmqp_ctrlmsg_messages.h>
+#include <bmqu_memoutstream.h>
+
+// BDE
+#include <bdlsb_fixedmeminstreambuf.h>
+#include <bdlsb_memoutstreambuf.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Populate the specified `configureStream` with representative stream
+/// parameters having two subscriptions.
+void populateConfigureStream(bmqp_ctrlmsg::ConfigureStream* configureStream)
+{
+    configureStream->qId() = 42;
+    configureStream->streamParameters().appId() = "foo";
+
+    bsl::vector<bmqp_ctrlmsg::Subscription>& subscriptions =
+        configureStream->streamParameters().subscriptions();
+    subscriptions.resize(2);
+
+    subscriptions[0].sId() = 1;
+    subscriptions[0].expression().version() =
+        bmqp_ctrlmsg::ExpressionVersion::E_VERSION_1;
+    subscriptions[0].expression().text() = "x > 0";
+    subscriptions[0].consumers().resize(1);
+    subscriptions[0].consumers()[0].maxUnconfirmedMessages() = 1024;
+    subscriptions[0].consumers()[0].maxUnconfirmedBytes()    = 33554432;
+    subscriptions[0].consumers()[0].consumerPriority()       = 7;
+    subscriptions[0].consumers()[0].consumerPriorityCount()  = 2;
+
+    subscriptions[1].sId() = 2;
+    subscriptions[1].consumers().resize(2);
+    subscriptions[1].consumers()[1].consumerPriority() = -1;
+}
+
+/// Encode the specified `message` in compact into the specified `buffer`
+/// and return the result of the encoding.
+int encode(bsl::string* buffer, const bmqp_ctrlmsg::ControlMessage& message)
+{
+    bdlsb::MemOutStreamBuf osb(bmqtst::TestHelperUtil::allocator());
+    bmqu::MemOutStream     error(bmqtst::TestHelperUtil::allocator());
+
+    const int rc = bmqp::CompactCodecUtil::encode(error, &osb, message);
+    buffer->assign(osb.data(), osb.length());
+    return rc;
+}
+
+/// Decode into the specified `message` the specified `length` first bytes
+/// of the specified `buffer`, and return the result of the decoding.
+int decode(bmqp_ctrlmsg::ControlMessage* message,
+           const bsl::string&            buffer,
+           size_t                        length)
+{
+    bdlsb::FixedMemInStreamBuf isb(buffer.data(), length);
+    bmqu::MemOutStream         error(bmqtst::TestHelperUtil::allocator());
+
+    return bmqp::CompactCodecUtil::decode(error, message, &isb);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_isSupported()
+// ------------------------------------------------------------------------
+// IS SUPPORTED
+//
+// Concerns:
+//   Only the status and stream configuration control messages have a
+//   compact encoding, and messages of any other type have none.
+//
+// Testing:
+//   isSupported
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("IS SUPPORTED");
+
+    typedef bmqp_ctrlmsg::ControlMessageChoice Choice;
+
+    struct Test {
+        int  d_line;
+        int  d_selectionId;
+        bool d_expected;
+    } k_DATA[] = {
+        {L_, Choice::SELECTION_ID_UNDEFINED, false},
+        {L_, Choice::SELECTION_ID_STATUS, true},
+        {L_, Choice::SELECTION_ID_CONFIGURE_STREAM, true},
+        {L_, Choice::SELECTION_ID_CONFIGURE_STREAM_RESPONSE, true},
+        {L_, Choice::SELECTION_ID_OPEN_QUEUE, false},
+        {L_, Choice::SELECTION_ID_CLOSE_QUEUE, false},
+        {L_, Choice::SELECTION_ID_DISCONNECT, false}};
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const Test& test = k_DATA[idx];
+
+        bmqp_ctrlmsg::ControlMessage message(
+            bmqtst::TestHelperUtil::allocator());
+        message.choice().makeSelection(test.d_selectionId);
+
+        BMQTST_ASSERT_EQ_D(test.d_line,
+                           bmqp::CompactCodecUtil::isSupported(message),
+                           test.d_expected);
+
+        if (!test.d_expected) {
+            bsl::string buffer(bmqtst::TestHelperUtil::allocator());
+            BMQTST_ASSERT_NE_D(test.d_line, encode(&buffer, message), 0);
+        }
+    }
+
+    // Messages which are not control messages have no compact encoding
+    bmqp_ctrlmsg::ClientIdentity identity(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(bmqp::CompactCodecUtil::isSupported(identity), false);
+}
+
+static void test2_roundTrip()
+// ------------------------------------------------------------------------
+// ROUND TRIP
+//
+// Concerns:
+//   Decoding the compact encoding of a supported message, with or without
+//   a request id, yields back the original message.
+//
+// Testing:
+//   encode
+//   decode
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("ROUND TRIP");
+
+    bsl::vector<bmqp_ctrlmsg::ControlMessage> messages(
+        bmqtst::TestHelperUtil::allocator());
+
+    {
+        bmqp_ctrlmsg::ControlMessage message(
+            bmqtst::TestHelperUtil::allocator());
+        bmqp_ctrlmsg::Status& status = message.choice().makeStatus();
+        status.category() = bmqp_ctrlmsg::StatusCategory::E_TIMEOUT;
+        status.code()     = -3;
+        status.message()  = "The request timed out";
+        messages.push_back(message);
+    }
+    {
+        bmqp_ctrlmsg::ControlMessage message(
+            bmqtst::TestHelperUtil::allocator());
+        populateConfigureStream(&message.choice().makeConfigureStream());
+        messages.push_back(message);
+    }
+    {
+        bmqp_ctrlmsg::ControlMessage message(
+            bmqtst::TestHelperUtil::allocator());
+        populateConfigureStream(
+            &message.choice().makeConfigureStreamResponse().request());
+        messages.push_back(message);
+    }
+    {
+        // Empty stream parameters
+        bmqp_ctrlmsg::ControlMessage message(
+            bmqtst::TestHelperUtil::allocator());
+        message.choice().makeConfigureStream().qId() = 0xFFFFFFFF;
+        messages.push_back(message);
+    }
+
+    for (size_t idx = 0; idx < messages.size(); ++idx) {
+        for (int withRId = 0; withRId < 2; ++withRId) {
+            PVV("Message " << idx << ", withRId: " << withRId);
+
+            bmqp_ctrlmsg::ControlMessage message(
+                messages[idx],
+                bmqtst::TestHelperUtil::allocator());
+            if (withRId) {
+                message.rId().makeValue(static_cast<int>(idx) + 17);
+            }
+
+            bsl::string buffer(bmqtst::TestHelperUtil::allocator());
+            BMQTST_ASSERT_EQ_D(idx, encode(&buffer, message), 0);
+            BMQTST_ASSERT_EQ_D(idx,
+                               static_cast<int>(buffer[0]),
+                               bmqp::CompactCodecUtil::k_VERSION);
+
+            // Decode in a non-empty message to ensure it is reset
+            bmqp_ctrlmsg::ControlMessage decoded(
+                bmqtst::TestHelperUtil::allocator());
+            decoded.rId().makeValue(99);
+            decoded.choice().makeOpenQueue();
+
+            BMQTST_ASSERT_EQ_D(idx,
+                               decode(&decoded, buffer, buffer.length()),
+                               0);
+            BMQTST_ASSERT_EQ_D(idx, decoded, message);
+        }
+    }
+}
+
+static void test3_invalidInput()
+// ------------------------------------------------------------------------
+// INVALID INPUT
+//
+// Concerns:
+//   1. Decoding a truncated message fails, whatever the truncation point.
+//   2. Decoding a message of an unknown version or selection fails.
+//   3. Decoding a message having an out of range enumerator fails.
+//
+// Testing:
+//   decode
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("INVALID INPUT");
+
+    bmqp_ctrlmsg::ControlMessage message(bmqtst::TestHelperUtil::allocator());
+    message.rId().makeValue(5);
+    populateConfigureStream(&message.choice().makeConfigureStream());
+
+    bsl::string buffer(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(encode(&buffer, message), 0);
+
+    PV("Truncated input");
+    for (size_t length = 0; length < buffer.length(); ++length) {
+        bmqp_ctrlmsg::ControlMessage decoded(
+            bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_NE_D(length, decode(&decoded, buffer, length), 0);
+    }
+
+    PV("Unknown version");
+    {
+        bsl::string corrupted(buffer, bmqtst::TestHelperUtil::allocator());
+        corrupted[0] = static_cast<char>(bmqp::CompactCodecUtil::k_VERSION +
+                                         1);
+
+        bmqp_ctrlmsg::ControlMessage decoded(
+            bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_NE(decode(&decoded, corrupted, corrupted.length()), 0);
+    }
+
+    PV("Unknown selection");
+    {
+        bsl::string corrupted(buffer, bmqtst::TestHelperUtil::allocator());
+        corrupted[1] = static_cast<char>(
+            bmqp_ctrlmsg::ControlMessageChoice::SELECTION_ID_OPEN_QUEUE);
+
+        bmqp_ctrlmsg::ControlMessage decoded(
+            bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_NE(decode(&decoded, corrupted, corrupted.length()), 0);
+    }
+
+    PV("Out of range status category");
+    {
+        bmqp_ctrlmsg::ControlMessage status(
+            bmqtst::TestHelperUtil::allocator());
+        status.choice().makeStatus();
+
+        bsl::string encoded(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(encode(&encoded, status), 0);
+
+        // Header (4 bytes, no rId), followed by the big-endian category
+        encoded[4] = static_cast<char>(0x7F);
+
+        bmqp_ctrlmsg::ControlMessage decoded(
+            bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_NE(decode(&decoded, encoded, encoded.length()), 0);
+    }
+
+    PV("Oversized string length");
+    {
+        bmqp_ctrlmsg::ControlMessage status(
+            bmqtst::TestHelperUtil::allocator());
+        status.choice().makeStatus().message() = "abc";
+
+        bsl::string encoded(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(encode(&encoded, status), 0);
+
+        // Header (4 bytes), category and code (8 bytes), followed by the
+        // big-endian length of the message
+        encoded[12] = static_cast<char>(0x7F);
+
+        bmqp_ctrlmsg::ControlMessage decoded(
+            bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_NE(decode(&decoded, encoded, encoded.length()), 0);
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_invalidInput(); break;
+    case 2: test2_roundTrip(); break;
+    case 1: test1_isSupported(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_GBL_ALLOC);
+}
@@ -24,16 +24,25 @@
 #include <bdlma_sequentialallocator.h>
 #include <bslma_allocator.h>
 
+// LZ4
+#include <lz4frame.h>
+
 // ZLIB
 #include <zlib.h>
 
+// ZSTD
+#include <zstd.h>
+
 // MemorySanitizer
 #if defined(__has_feature)
 #if __has_feature(memory_sanitizer)
 #include <sanitizer/msan_interface.h>
 #endif
 #endif
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
 #include <bsl_memory.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bmqp {
@@ -332,6 +341,252 @@ int ZLib::writeOutput(bdlbb::Blob*              output,
     return rc_SUCCESS;
 }
 
+// ==================
+// class ContextGuard
+// ==================
+
+/// This class template provides a guard freeing, on destruction, the
+/// context of a compression library it manages, using the specified `FREE`
+/// function of that library.
+template <class CONTEXT, bsl::size_t (*FREE)(CONTEXT*)>
+class ContextGuard {
+    // DATA
+    CONTEXT* d_context_p;
+
+  private:
+    // NOT IMPLEMENTED
+    ContextGuard(const ContextGuard&);             // = delete
+    ContextGuard& operator=(const ContextGuard&);  // = delete
+
+  public:
+    // CREATORS
+
+    /// Create a guard managing the specified `context`.
+    explicit ContextGuard(CONTEXT* context)
+    : d_context_p(context)
+    {
+    }
+
+    /// Free the managed context.
+    ~ContextGuard() { FREE(d_context_p); }
+};
+
+// ================
+// class BlobWriter
+// ================
+
+/// This class provides a mechanism to write a stream of bytes at the end of
+/// a blob, supplying the blob with data buffers from a factory as needed.
+/// Note that the bytes written are only guaranteed to be part of the blob
+/// after `flush` is called.
+class BlobWriter {
+    // DATA
+    bdlbb::Blob* d_output_p;
+
+    bdlbb::BlobBufferFactory* d_factory_p;
+
+    /// Buffer being written to, not yet appended to `d_output_p`.
+    bdlbb::BlobBuffer d_buffer;
+
+    /// Number of bytes written to `d_buffer`.
+    int d_position;
+
+  private:
+    // NOT IMPLEMENTED
+    BlobWriter(const BlobWriter&);             // = delete
+    BlobWriter& operator=(const BlobWriter&);  // = delete
+
+  public:
+    // CREATORS
+
+    /// Create a writer to the end of the specified `output`, using the
+    /// specified `factory` to supply data buffers.
+    BlobWriter(bdlbb::Blob* output, bdlbb::BlobBufferFactory* factory);
+
+    // MANIPULATORS
+
+    /// Return the address of the free space, of at least one byte, at
+    /// which the next bytes are to be written, and load its size into the
+    /// specified `capacity`.  Note that the bytes written to this space
+    /// must be committed with `advance`.
+    char* reserve(bsl::size_t* capacity);
+
+    /// Commit the specified `numBytes` bytes written to the space returned
+    /// by the last call to `reserve`.  The behavior is undefined unless
+    /// `numBytes` does not exceed the capacity loaded by that call.
+    void advance(bsl::size_t numBytes);
+
+    /// Write the specified `length` bytes at the specified `data`.
+    void write(const char* data, bsl::size_t length);
+
+    /// Append to the output blob the bytes written but not appended yet.
+    void flush();
+
+    // ACCESSORS
+
+    /// Return the length of the output blob, including the bytes written
+    /// but not appended yet.
+    bsls::Types::Uint64 length() const;
+};
+
+// ================
+// class BlobWriter
+// ================
+
+BlobWriter::BlobWriter(bdlbb::Blob* output, bdlbb::BlobBufferFactory* factory)
+: d_output_p(output)
+, d_factory_p(factory)
+, d_buffer()
+, d_position(0)
+{
+}
+
+char* BlobWriter::reserve(bsl::size_t* capacity)
+{
+    if (d_position == d_buffer.size()) {
+        if (d_position) {
+            // Append the previous data buffer to output.
+            d_output_p->appendDataBuffer(d_buffer);
+        }
+        d_factory_p->allocate(&d_buffer);
+        d_position = 0;
+    }
+
+    *capacity = d_buffer.size() - d_position;
+    return d_buffer.data() + d_position;
+}
+
+void BlobWriter::advance(bsl::size_t numBytes)
+{
+    BSLS_ASSERT_SAFE(numBytes <=
+                     static_cast<bsl::size_t>(d_buffer.size() - d_position));
+
+    d_position += static_cast<int>(numBytes);
+}
+
+void BlobWriter::write(const char* data, bsl::size_t length)
+{
+    while (length) {
+        bsl::size_t capacity;
+        char*       destination = reserve(&capacity);
+        capacity                = bsl::min(capacity, length);
+
+        bsl::memcpy(destination, data, capacity);
+        advance(capacity);
+
+        data += capacity;
+        length -= capacity;
+    }
+}
+
+void BlobWriter::flush()
+{
+    if (d_position) {
+        d_buffer.setSize(d_position);
+        d_output_p->appendDataBuffer(d_buffer);
+    }
+
+    d_buffer.reset();
+    d_position = 0;
+}
+
+bsls::Types::Uint64 BlobWriter::length() const
+{
+    return static_cast<bsls::Types::Uint64>(d_output_p->length()) +
+           d_position;
+}
+
+// ===========
+// struct Lz4
+// ===========
+
+/// This struct provides the utility functions for enabling compression
+/// using the frame format of the LZ4 algorithm.
+struct Lz4 {
+    // TYPES
+    typedef ContextGuard<LZ4F_cctx, &::LZ4F_freeCompressionContext>
+        CompressionContextGuard;
+
+    typedef ContextGuard<LZ4F_dctx, &::LZ4F_freeDecompressionContext>
+        DecompressionContextGuard;
+
+    // CONSTANTS
+
+    /// Maximum number of bytes of input fed to the compression context at
+    /// once.  This is also the size of the blocks of the frame, so that
+    /// the output of every step is bounded by the size of a single block.
+    static const bsl::size_t k_CHUNK_SIZE = 64 * 1024;
+
+    /// Compression level selecting the fast, default, mode of the LZ4
+    /// algorithm.  See the documentation of `LZ4F_preferences_t` in
+    /// `lz4frame.h` for more information.
+    static const int k_DEFAULT_LEVEL = 0;
+
+    // CLASS METHODS
+
+    /// If the specified `stream` is non-zero, output the specified
+    /// `baseMessage`, followed by the name of the optionally specified
+    /// `code` if it denotes an error.
+    static void setError(bsl::ostream*            stream,
+                         const bslstl::StringRef& baseMessage,
+                         bsl::size_t              code = 0);
+};
+
+// ===========
+// struct Lz4
+// ===========
+
+void Lz4::setError(bsl::ostream*            stream,
+                   const bslstl::StringRef& baseMessage,
+                   bsl::size_t              code)
+{
+    if (stream) {
+        (*stream) << baseMessage;
+        if (::LZ4F_isError(code)) {
+            (*stream) << ", Message: " << ::LZ4F_getErrorName(code);
+        }
+    }
+}
+
+// ===========
+// struct Zstd
+// ===========
+
+/// This struct provides the utility functions for enabling compression
+/// using the Zstandard algorithm.
+struct Zstd {
+    // TYPES
+    typedef ContextGuard<ZSTD_CCtx, &::ZSTD_freeCCtx> CompressionContextGuard;
+
+    typedef ContextGuard<ZSTD_DCtx, &::ZSTD_freeDCtx>
+        DecompressionContextGuard;
+
+    // CLASS METHODS
+
+    /// If the specified `stream` is non-zero, output the specified
+    /// `baseMessage`, followed by the name of the optionally specified
+    /// `code` if it denotes an error.
+    static void setError(bsl::ostream*            stream,
+                         const bslstl::StringRef& baseMessage,
+                         bsl::size_t              code = 0);
+};
+
+// ===========
+// struct Zstd
+// ===========
+
+void Zstd::setError(bsl::ostream*            stream,
+                    const bslstl::StringRef& baseMessage,
+                    bsl::size_t              code)
+{
+    if (stream) {
+        (*stream) << baseMessage;
+        if (::ZSTD_isError(code)) {
+            (*stream) << ", Message: " << ::ZSTD_getErrorName(code);
+        }
+    }
+}
+
 }  // close unnamed namespace
 
 // ==================
@@ -359,6 +614,21 @@ int Compression::compress(bdlbb::Blob*                         output,
                                               Z_DEFAULT_COMPRESSION,
                                               errorStream,
                                               allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_LZ4:
+        return Compression_Impl::compressLz4(output,
+                                             factory,
+                                             input,
+                                             Lz4::k_DEFAULT_LEVEL,
+                                             errorStream,
+                                             allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_ZSTD:
+        return Compression_Impl::compressZstd(output,
+                                              factory,
+                                              input,
+                                              ZSTD_CLEVEL_DEFAULT,
+                                              bslstl::StringRef(),
+                                              errorStream,
+                                              allocator);  // RETURN
     case bmqt::CompressionAlgorithmType::e_NONE:
         if (output->length() == 0) {
             *output = input;
@@ -389,7 +659,9 @@ int Compression::compress(bdlbb::Blob*                         output,
 
     bdlbb::Blob inputBlob(factory, allocator);
     switch (algorithm) {
-    case bmqt::CompressionAlgorithmType::e_ZLIB: {
+    case bmqt::CompressionAlgorithmType::e_ZLIB:
+    case bmqt::CompressionAlgorithmType::e_LZ4:
+    case bmqt::CompressionAlgorithmType::e_ZSTD: {
         bsl::shared_ptr<char> inputBufferSp(const_cast<char*>(input),
                                             bslstl::SharedPtrNilDeleter(),
                                             allocator);
@@ -399,12 +671,12 @@ int Compression::compress(bdlbb::Blob*                         output,
             inputBlob.appendDataBuffer(inputBlobBuffer);
         }
 
-        return Compression_Impl::compressZlib(output,
-                                              factory,
-                                              inputBlob,
-                                              Z_DEFAULT_COMPRESSION,
-                                              errorStream,
-                                              allocator);  // RETURN
+        return compress(output,
+                        factory,
+                        algorithm,
+                        inputBlob,
+                        errorStream,
+                        allocator);  // RETURN
     }
     case bmqt::CompressionAlgorithmType::e_NONE:
         // deep copy of input character array to output Blob
@@ -433,6 +705,21 @@ int Compression::decompress(bdlbb::Blob*                         output,
                                                 maxOutputSize,
                                                 errorStream,
                                                 allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_LZ4:
+        return Compression_Impl::decompressLz4(output,
+                                               factory,
+                                               input,
+                                               maxOutputSize,
+                                               errorStream,
+                                               allocator);  // RETURN
+    case bmqt::CompressionAlgorithmType::e_ZSTD:
+        return Compression_Impl::decompressZstd(output,
+                                                factory,
+                                                input,
+                                                bslstl::StringRef(),
+                                                maxOutputSize,
+                                                errorStream,
+                                                allocator);  // RETURN
     case bmqt::CompressionAlgorithmType::e_NONE:
         if (output->length() == 0) {
             *output = input;
@@ -522,5 +809,363 @@ int Compression_Impl::decompressZlib(bdlbb::Blob*              output,
                              maxOutputSize);
 }
 
+int Compression_Impl::compressLz4(bdlbb::Blob*              output,
+                                  bdlbb::BlobBufferFactory* factory,
+                                  const bdlbb::Blob&        input,
+                                  int                       level,
+                                  bsl::ostream*             errorStream,
+                                  bslma::Allocator*         allocator)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3
+    };
+
+    LZ4F_cctx*  context = 0;
+    bsl::size_t result  = ::LZ4F_createCompressionContext(&context,
+                                                         LZ4F_VERSION);
+    if (::LZ4F_isError(result)) {
+        Lz4::setError(errorStream,
+                      "Error initializing compression context",
+                      result);
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+    Lz4::CompressionContextGuard guard(context);
+
+    LZ4F_preferences_t preferences;
+    bsl::memset(&preferences, 0, sizeof(preferences));
+    preferences.frameInfo.blockSizeID = LZ4F_max64KB;
+    preferences.compressionLevel      = level;
+
+    // The LZ4 frame API requires the output of every step to fit in a
+    // single contiguous buffer, so each step writes to a scratch buffer
+    // large enough for one chunk, which is then copied to the output.
+    bsl::vector<char> scratch(
+        ::LZ4F_compressBound(Lz4::k_CHUNK_SIZE, &preferences),
+        allocator);
+    BlobWriter        writer(output, factory);
+
+    result = ::LZ4F_compressBegin(context,
+                                  scratch.data(),
+                                  scratch.size(),
+                                  &preferences);
+    if (::LZ4F_isError(result)) {
+        Lz4::setError(errorStream, "Error initializing stream", result);
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+    writer.write(scratch.data(), result);
+
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        const char* data      = input.buffer(i).data();
+        bsl::size_t remaining = bmqu::BlobUtil::bufferSize(input, i);
+
+        while (remaining) {
+            const bsl::size_t length = bsl::min(remaining, Lz4::k_CHUNK_SIZE);
+
+            result = ::LZ4F_compressUpdate(context,
+                                           scratch.data(),
+                                           scratch.size(),
+                                           data,
+                                           length,
+                                           0);
+            if (::LZ4F_isError(result)) {
+                Lz4::setError(errorStream, "Error processing stream", result);
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+            writer.write(scratch.data(), result);
+
+            data += length;
+            remaining -= length;
+        }
+    }
+
+    result = ::LZ4F_compressEnd(context, scratch.data(), scratch.size(), 0);
+    if (::LZ4F_isError(result)) {
+        Lz4::setError(errorStream, "Error finishing stream", result);
+        return rc_STREAM_END_FAILURE;  // RETURN
+    }
+    writer.write(scratch.data(), result);
+    writer.flush();
+
+    return rc_SUCCESS;
+}
+
+int Compression_Impl::decompressLz4(bdlbb::Blob*              output,
+                                    bdlbb::BlobBufferFactory* factory,
+                                    const bdlbb::Blob&        input,
+                                    bsls::Types::Uint64       maxOutputSize,
+                                    bsl::ostream*             errorStream,
+                                    bslma::Allocator*)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3,
+        rc_MAX_SIZE_EXCEEDED      = -4
+    };
+
+    LZ4F_dctx*  context = 0;
+    bsl::size_t result  = ::LZ4F_createDecompressionContext(&context,
+                                                           LZ4F_VERSION);
+    if (::LZ4F_isError(result)) {
+        Lz4::setError(errorStream,
+                      "Error initializing decompression context",
+                      result);
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+    Lz4::DecompressionContextGuard guard(context);
+
+    BlobWriter  writer(output, factory);
+    bsl::size_t capacity;
+    bsl::size_t length;
+
+    // 'result' is zero once a frame has been fully decoded and flushed.
+    result = 1;
+
+    // Process input data until all input buffers have been read.
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        const char* data      = input.buffer(i).data();
+        bsl::size_t remaining = bmqu::BlobUtil::bufferSize(input, i);
+
+        while (remaining) {
+            char* destination = writer.reserve(&capacity);
+            length            = remaining;
+
+            result = ::LZ4F_decompress(context,
+                                       destination,
+                                       &capacity,
+                                       data,
+                                       &length,
+                                       0);
+            if (::LZ4F_isError(result)) {
+                Lz4::setError(errorStream, "Error processing stream", result);
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+            writer.advance(capacity);
+
+            data += length;
+            remaining -= length;
+
+            if (maxOutputSize != 0 && writer.length() > maxOutputSize) {
+                Lz4::setError(errorStream,
+                              "Decompressed output exceeds maximum size");
+                return rc_MAX_SIZE_EXCEEDED;  // RETURN
+            }
+        }
+    }
+
+    // Continue to write output data buffered by the context until the frame
+    // is fully flushed.  As an extra sanity check to avoid spinning, we only
+    // continue iterating while bytes are being written to the output.
+    while (0 != result) {
+        char* destination = writer.reserve(&capacity);
+        length            = 0;
+
+        result = ::LZ4F_decompress(context,
+                                   destination,
+                                   &capacity,
+                                   0,
+                                   &length,
+                                   0);
+        if (::LZ4F_isError(result) || (0 != result && 0 == capacity)) {
+            // The input ends in the middle of a frame.
+            Lz4::setError(errorStream, "Error finishing stream", result);
+            return rc_STREAM_END_FAILURE;  // RETURN
+        }
+        writer.advance(capacity);
+
+        if (maxOutputSize != 0 && writer.length() > maxOutputSize) {
+            Lz4::setError(errorStream,
+                          "Decompressed output exceeds maximum size");
+            return rc_MAX_SIZE_EXCEEDED;  // RETURN
+        }
+    }
+
+    writer.flush();
+
+    return rc_SUCCESS;
+}
+
+int Compression_Impl::compressZstd(bdlbb::Blob*              output,
+                                   bdlbb::BlobBufferFactory* factory,
+                                   const bdlbb::Blob&        input,
+                                   int                       level,
+                                   const bslstl::StringRef&  dictionary,
+                                   bsl::ostream*             errorStream,
+                                   bslma::Allocator*)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3
+    };
+
+    ZSTD_CCtx* context = ::ZSTD_createCCtx();
+    if (0 == context) {
+        Zstd::setError(errorStream, "Error initializing compression context");
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+    Zstd::CompressionContextGuard guard(context);
+
+    bsl::size_t result = ::ZSTD_CCtx_setParameter(context,
+                                                  ZSTD_c_compressionLevel,
+                                                  level);
+    if (!::ZSTD_isError(result) && !dictionary.isEmpty()) {
+        result = ::ZSTD_CCtx_loadDictionary(context,
+                                            dictionary.data(),
+                                            dictionary.length());
+    }
+    if (::ZSTD_isError(result)) {
+        Zstd::setError(errorStream, "Error initializing stream", result);
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+
+    BlobWriter  writer(output, factory);
+    bsl::size_t capacity;
+
+    // Process input data until all input buffers have been read.
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        ZSTD_inBuffer inBuffer = {input.buffer(i).data(),
+                                  static_cast<bsl::size_t>(
+                                      bmqu::BlobUtil::bufferSize(input, i)),
+                                  0};
+
+        while (inBuffer.pos < inBuffer.size) {
+            ZSTD_outBuffer outBuffer = {writer.reserve(&capacity), 0, 0};
+            outBuffer.size           = capacity;
+
+            result = ::ZSTD_compressStream2(context,
+                                            &outBuffer,
+                                            &inBuffer,
+                                            ZSTD_e_continue);
+            if (::ZSTD_isError(result)) {
+                Zstd::setError(errorStream, "Error processing stream", result);
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+            writer.advance(outBuffer.pos);
+        }
+    }
+
+    // Continue to write output data until the frame is complete.
+    ZSTD_inBuffer inBuffer = {0, 0, 0};
+    do {
+        ZSTD_outBuffer outBuffer = {writer.reserve(&capacity), 0, 0};
+        outBuffer.size           = capacity;
+
+        result = ::ZSTD_compressStream2(context,
+                                        &outBuffer,
+                                        &inBuffer,
+                                        ZSTD_e_end);
+        if (::ZSTD_isError(result)) {
+            Zstd::setError(errorStream, "Error finishing stream", result);
+            return rc_STREAM_END_FAILURE;  // RETURN
+        }
+        writer.advance(outBuffer.pos);
+    } while (0 != result);
+
+    writer.flush();
+
+    return rc_SUCCESS;
+}
+
+int Compression_Impl::decompressZstd(bdlbb::Blob*              output,
+                                     bdlbb::BlobBufferFactory* factory,
+                                     const bdlbb::Blob&        input,
+                                     const bslstl::StringRef&  dictionary,
+                                     bsls::Types::Uint64       maxOutputSize,
+                                     bsl::ostream*             errorStream,
+                                     bslma::Allocator*)
+{
+    enum RcEnum {
+        rc_SUCCESS                = 0,
+        rc_STREAM_INIT_FAILURE    = -1,
+        rc_STREAM_PROCESS_FAILURE = -2,
+        rc_STREAM_END_FAILURE     = -3,
+        rc_MAX_SIZE_EXCEEDED      = -4
+    };
+
+    ZSTD_DCtx* context = ::ZSTD_createDCtx();
+    if (0 == context) {
+        Zstd::setError(errorStream,
+                       "Error initializing decompression context");
+        return rc_STREAM_INIT_FAILURE;  // RETURN
+    }
+    Zstd::DecompressionContextGuard guard(context);
+
+    if (!dictionary.isEmpty()) {
+        const bsl::size_t result = ::ZSTD_DCtx_loadDictionary(
+            context,
+            dictionary.data(),
+            dictionary.length());
+        if (::ZSTD_isError(result)) {
+            Zstd::setError(errorStream, "Error initializing stream", result);
+            return rc_STREAM_INIT_FAILURE;  // RETURN
+        }
+    }
+
+    BlobWriter  writer(output, factory);
+    bsl::size_t capacity;
+
+    // 'result' is zero once a frame has been fully decoded and flushed.
+    bsl::size_t result = 1;
+
+    // Process input data until all input buffers have been read.
+    for (int i = 0; i < input.numDataBuffers(); ++i) {
+        ZSTD_inBuffer inBuffer = {input.buffer(i).data(),
+                                  static_cast<bsl::size_t>(
+                                      bmqu::BlobUtil::bufferSize(input, i)),
+                                  0};
+
+        while (inBuffer.pos < inBuffer.size) {
+            ZSTD_outBuffer outBuffer = {writer.reserve(&capacity), 0, 0};
+            outBuffer.size           = capacity;
+
+            result = ::ZSTD_decompressStream(context, &outBuffer, &inBuffer);
+            if (::ZSTD_isError(result)) {
+                Zstd::setError(errorStream, "Error processing stream", result);
+                return rc_STREAM_PROCESS_FAILURE;  // RETURN
+            }
+            writer.advance(outBuffer.pos);
+
+            if (maxOutputSize != 0 && writer.length() > maxOutputSize) {
+                Zstd::setError(errorStream,
+                               "Decompressed output exceeds maximum size");
+                return rc_MAX_SIZE_EXCEEDED;  // RETURN
+            }
+        }
+    }
+
+    // Continue to write output data buffered by the context until the frame
+    // is fully flushed.  As an extra sanity check to avoid spinning, we only
+    // continue iterating while bytes are being written to the output.
+    ZSTD_inBuffer inBuffer = {0, 0, 0};
+    while (0 != result) {
+        ZSTD_outBuffer outBuffer = {writer.reserve(&capacity), 0, 0};
+        outBuffer.size           = capacity;
+
+        result = ::ZSTD_decompressStream(context, &outBuffer, &inBuffer);
+        if (::ZSTD_isError(result) || (0 != result && 0 == outBuffer.pos)) {
+            // The input ends in the middle of a frame.
+            Zstd::setError(errorStream, "Error finishing stream", result);
+            return rc_STREAM_END_FAILURE;  // RETURN
+        }
+        writer.advance(outBuffer.pos);
+
+        if (maxOutputSize != 0 && writer.length() > maxOutputSize) {
+            Zstd::setError(errorStream,
+                           "Decompressed output exceeds maximum size");
+            return rc_MAX_SIZE_EXCEEDED;  // RETURN
+        }
+    }
+
+    writer.flush();
+
+    return rc_SUCCESS;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
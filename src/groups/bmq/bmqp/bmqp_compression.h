@@ -28,6 +28,13 @@
 // provides implementation for compression and decompression for all supported
 // types of compression algorithms.
 //
+// The supported algorithms trade speed for compression ratio in the following
+// order: 'e_LZ4' is the fastest, 'e_ZLIB' comes next, and 'e_ZSTD' achieves
+// the best ratio.  Note that 'e_ZSTD' can additionally use a dictionary
+// shared by the two ends, which significantly improves the ratio of small
+// messages having a similar content, but only 'Compression_Impl' exposes this
+// ability: 'Compression' always compresses without a dictionary.
+//
 
 // BMQ
 
@@ -36,6 +43,7 @@
 // BDE
 #include <bdlbb_blob.h>
 #include <bsl_ostream.h>
+#include <bsl_string.h>
 #include <bslma_allocator.h>
 #include <bsls_types.h>
 
@@ -150,6 +158,75 @@ struct Compression_Impl {
                               bsls::Types::Uint64       maxOutputSize,
                               bsl::ostream*             errorStream,
                               bslma::Allocator*         allocator);
+
+    /// Compress the data within the specified `input` as per the frame
+    /// format of the LZ4 algorithm, and load the compressed data into the
+    /// specified `output`, using the specified `factory` to supply data
+    /// buffers.  Specify a compression `level`, with 0 indicating the
+    /// default, fast, compression, and values from 3 to 12 selecting the
+    /// slower LZ4-HC mode with an increasing ratio.  Also, specify an
+    /// `errorStream` to record details on any errors that may occur during
+    /// this operation.  Finally, specify `allocator` which will be used to
+    /// supply memory.  Return 0 on success, and non-zero otherwise.
+    static int compressLz4(bdlbb::Blob*              output,
+                           bdlbb::BlobBufferFactory* factory,
+                           const bdlbb::Blob&        input,
+                           int                       level,
+                           bsl::ostream*             errorStream,
+                           bslma::Allocator*         allocator);
+
+    /// Decompress the data within the specified `input` as according to the
+    /// frame format of the LZ4 algorithm, and load the uncompressed data
+    /// into the specified `output` blob, using the specified `factory` to
+    /// supply needed data buffers.  Specify a `maxOutputSize`, in bytes,
+    /// beyond which decompression fails closed with a non-zero return code;
+    /// a value of 0 means no limit is enforced.  Specify an `errorStream` to
+    /// record details on any errors that may occur during this operation.
+    /// Also, specify `allocator` which will be used to supply memory.
+    /// Return 0 on success, and non-zero otherwise.
+    static int decompressLz4(bdlbb::Blob*              output,
+                             bdlbb::BlobBufferFactory* factory,
+                             const bdlbb::Blob&        input,
+                             bsls::Types::Uint64       maxOutputSize,
+                             bsl::ostream*             errorStream,
+                             bslma::Allocator*         allocator);
+
+    /// Compress the data within the specified `input` as per the Zstandard
+    /// algorithm, and load the compressed data into the specified `output`,
+    /// using the specified `factory` to supply data buffers.  Specify a
+    /// compression `level`, from 1 indicating fast compression to 22
+    /// indicating best compression, 3 being the default level.  Specify a
+    /// `dictionary` to compress with, or an empty `dictionary` to compress
+    /// without one.  Also, specify an `errorStream` to record details on any
+    /// errors that may occur during this operation.  Finally, specify
+    /// `allocator` which will be used to supply memory.  Return 0 on
+    /// success, and non-zero otherwise.  Note that data compressed with a
+    /// `dictionary` can only be decompressed with the same `dictionary`.
+    static int compressZstd(bdlbb::Blob*              output,
+                            bdlbb::BlobBufferFactory* factory,
+                            const bdlbb::Blob&        input,
+                            int                       level,
+                            const bslstl::StringRef&  dictionary,
+                            bsl::ostream*             errorStream,
+                            bslma::Allocator*         allocator);
+
+    /// Decompress the data within the specified `input` as according to the
+    /// Zstandard algorithm, using the specified `dictionary` if it is not
+    /// empty, and load the uncompressed data into the specified `output`
+    /// blob, using the specified `factory` to supply needed data buffers.
+    /// Specify a `maxOutputSize`, in bytes, beyond which decompression fails
+    /// closed with a non-zero return code; a value of 0 means no limit is
+    /// enforced.  Specify an `errorStream` to record details on any errors
+    /// that may occur during this operation.  Also, specify `allocator`
+    /// which will be used to supply memory.  Return 0 on success, and
+    /// non-zero otherwise.
+    static int decompressZstd(bdlbb::Blob*              output,
+                              bdlbb::BlobBufferFactory* factory,
+                              const bdlbb::Blob&        input,
+                              const bslstl::StringRef&  dictionary,
+                              bsls::Types::Uint64       maxOutputSize,
+                              bsl::ostream*             errorStream,
+                              bslma::Allocator*         allocator);
 };
 
 }  // close package namespace
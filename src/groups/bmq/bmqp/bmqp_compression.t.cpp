@@ -868,6 +868,252 @@ static void test4_decompressionSizeLimit()
     }
 }
 
+static void test5_lz4AndZstd()
+// ------------------------------------------------------------------------
+// LZ4 AND ZSTD ALGORITHMS
+//
+// Concerns:
+//   1. Data compressed with 'e_LZ4' or 'e_ZSTD' decompresses to the
+//      original data, regardless of how the input and the output are split
+//      into buffers.
+//   2. Decompression fails if the input ends in the middle of a frame, or
+//      if the output would exceed the maximum size.
+//
+// Plan:
+//   1. For each algorithm, compress and decompress empty, small and large
+//      inputs spread over buffers of various sizes, and compare the
+//      decompressed data with the original data.
+//   2. Decompress a truncated input, and a valid input with a maximum
+//      output size lower than its decompressed size, and verify that both
+//      fail.
+//
+// Testing:
+//   bmqp::Compression::compress with e_LZ4 and e_ZSTD
+//   bmqp::Compression::decompress with e_LZ4 and e_ZSTD
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("LZ4 AND ZSTD ALGORITHMS TEST");
+
+    const bmqt::CompressionAlgorithmType::Enum k_ALGORITHMS[] = {
+        bmqt::CompressionAlgorithmType::e_LZ4,
+        bmqt::CompressionAlgorithmType::e_ZSTD};
+
+    const int k_NUM_ALGORITHMS = sizeof(k_ALGORITHMS) / sizeof(*k_ALGORITHMS);
+
+    const int k_BUFFER_SIZES[]   = {1, 7, 1024, 70000};
+    const int k_NUM_BUFFER_SIZES = sizeof(k_BUFFER_SIZES) /
+                                   sizeof(*k_BUFFER_SIZES);
+
+    // A compressible text, and a random (incompressible) string.
+    bsl::string text(bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < 6000; ++i) {
+        text.append("Hello World ");
+        text.push_back(static_cast<char>('a' + i % 26));
+    }
+
+    bsl::string randomString(bmqtst::TestHelperUtil::allocator());
+    generateRandomString(&randomString, 100000);
+
+    const bsl::string k_INPUTS[] = {
+        bsl::string("", bmqtst::TestHelperUtil::allocator()),
+        bsl::string("a", bmqtst::TestHelperUtil::allocator()),
+        bsl::string("Hello World", bmqtst::TestHelperUtil::allocator()),
+        text,
+        randomString};
+
+    const int k_NUM_INPUTS = sizeof(k_INPUTS) / sizeof(*k_INPUTS);
+
+    for (int algoIdx = 0; algoIdx < k_NUM_ALGORITHMS; ++algoIdx) {
+        const bmqt::CompressionAlgorithmType::Enum algorithm =
+            k_ALGORITHMS[algoIdx];
+
+        PV("Algorithm: " << algorithm);
+
+        for (int inputIdx = 0; inputIdx < k_NUM_INPUTS; ++inputIdx) {
+            const bsl::string& data = k_INPUTS[inputIdx];
+
+            for (int sizeIdx = 0; sizeIdx < k_NUM_BUFFER_SIZES; ++sizeIdx) {
+                const int k_BUFFER_SIZE = k_BUFFER_SIZES[sizeIdx];
+
+                PVV("Input length: " << data.length()
+                                     << ", buffer size: " << k_BUFFER_SIZE);
+
+                bmqu::MemOutStream error(bmqtst::TestHelperUtil::allocator());
+                bdlbb::PooledBlobBufferFactory bufferFactory(
+                    k_BUFFER_SIZE,
+                    bmqtst::TestHelperUtil::allocator());
+                bdlbb::Blob input(&bufferFactory,
+                                  bmqtst::TestHelperUtil::allocator());
+                bdlbb::Blob compressed(&bufferFactory,
+                                       bmqtst::TestHelperUtil::allocator());
+                bdlbb::Blob decompressed(&bufferFactory,
+                                         bmqtst::TestHelperUtil::allocator());
+
+                bdlbb::BlobUtil::append(&input,
+                                        data.data(),
+                                        static_cast<int>(data.length()));
+
+                int rc = bmqp::Compression::compress(
+                    &compressed,
+                    &bufferFactory,
+                    algorithm,
+                    input,
+                    &error,
+                    bmqtst::TestHelperUtil::allocator());
+                BMQTST_ASSERT_EQ_D(error.str(), rc, 0);
+
+                rc = bmqp::Compression::decompress(
+                    &decompressed,
+                    &bufferFactory,
+                    algorithm,
+                    compressed,
+                    0,  // no output cap
+                    &error,
+                    bmqtst::TestHelperUtil::allocator());
+                BMQTST_ASSERT_EQ_D(error.str(), rc, 0);
+                BMQTST_ASSERT_EQ(
+                    bdlbb::BlobUtil::compare(decompressed, input),
+                    0);
+
+                if (data.length() < 1000) {
+                    continue;  // CONTINUE
+                }
+
+                // Truncated input
+                bdlbb::Blob truncated(compressed,
+                                      bmqtst::TestHelperUtil::allocator());
+                truncated.setLength(truncated.length() - 5);
+
+                decompressed.removeAll();
+                rc = bmqp::Compression::decompress(
+                    &decompressed,
+                    &bufferFactory,
+                    algorithm,
+                    truncated,
+                    0,  // no output cap
+                    &error,
+                    bmqtst::TestHelperUtil::allocator());
+                BMQTST_ASSERT_NE(rc, 0);
+
+                // Output exceeding the cap
+                const bsls::Types::Uint64 k_CAP = data.length() / 2;
+
+                decompressed.removeAll();
+                rc = bmqp::Compression::decompress(
+                    &decompressed,
+                    &bufferFactory,
+                    algorithm,
+                    compressed,
+                    k_CAP,
+                    &error,
+                    bmqtst::TestHelperUtil::allocator());
+                BMQTST_ASSERT_NE(rc, 0);
+                BMQTST_ASSERT_LE(
+                    static_cast<bsls::Types::Uint64>(decompressed.length()),
+                    k_CAP + k_BUFFER_SIZE);
+            }
+        }
+    }
+}
+
+static void test6_zstdDictionary()
+// ------------------------------------------------------------------------
+// ZSTD DICTIONARY
+//
+// Concerns:
+//   Data compressed by 'compressZstd' using a dictionary is smaller than
+//   without it if the dictionary is representative of the data, and can
+//   only be decompressed with the same dictionary.
+//
+// Plan:
+//   1. Compress a small message with and without a dictionary sharing most
+//      of its content, and verify that the former is smaller.
+//   2. Decompress the data compressed with the dictionary with the same
+//      dictionary, and verify that it matches the original message.
+//   3. Decompress the same data without the dictionary, and verify that it
+//      fails.
+//
+// Testing:
+//   bmqp::Compression_Impl::compressZstd
+//   bmqp::Compression_Impl::decompressZstd
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("ZSTD DICTIONARY TEST");
+
+    bsl::string dictionary(bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < 1000; ++i) {
+        bmqu::MemOutStream word(bmqtst::TestHelperUtil::allocator());
+        word << "{\"symbol\": \"SYM" << i << "\", \"price\": " << i * 7
+             << "}";
+        dictionary.append(word.str().data(), word.str().length());
+    }
+    const bslstl::StringRef k_DICTIONARY(dictionary);
+    const char              k_MESSAGE[] =
+        "{\"symbol\": \"SYM12\", \"price\": 84}"
+        "{\"symbol\": \"SYM999\", \"price\": 6993}";
+
+    bmqu::MemOutStream             error(bmqtst::TestHelperUtil::allocator());
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob input(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob compressed(&bufferFactory,
+                           bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob compressedWithDictionary(&bufferFactory,
+                                         bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob decompressed(&bufferFactory,
+                             bmqtst::TestHelperUtil::allocator());
+
+    bdlbb::BlobUtil::append(&input, k_MESSAGE, sizeof(k_MESSAGE) - 1);
+
+    int rc = bmqp::Compression_Impl::compressZstd(
+        &compressed,
+        &bufferFactory,
+        input,
+        3,
+        bslstl::StringRef(),
+        &error,
+        bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ_D(error.str(), rc, 0);
+
+    rc = bmqp::Compression_Impl::compressZstd(
+        &compressedWithDictionary,
+        &bufferFactory,
+        input,
+        3,
+        k_DICTIONARY,
+        &error,
+        bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ_D(error.str(), rc, 0);
+    BMQTST_ASSERT_LT(compressedWithDictionary.length(), compressed.length());
+
+    PV("Compressed size without dictionary: "
+       << compressed.length()
+       << ", with dictionary: " << compressedWithDictionary.length());
+
+    rc = bmqp::Compression_Impl::decompressZstd(
+        &decompressed,
+        &bufferFactory,
+        compressedWithDictionary,
+        k_DICTIONARY,
+        0,  // no output cap
+        &error,
+        bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ_D(error.str(), rc, 0);
+    BMQTST_ASSERT_EQ(bdlbb::BlobUtil::compare(decompressed, input), 0);
+
+    decompressed.removeAll();
+    rc = bmqp::Compression_Impl::decompressZstd(
+        &decompressed,
+        &bufferFactory,
+        compressedWithDictionary,
+        bslstl::StringRef(),
+        0,  // no output cap
+        &error,
+        bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_NE(rc, 0);
+}
+
 // ============================================================================
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
@@ -1230,6 +1476,8 @@ int main(int argc, char* argv[])
     case 2: test2_compression_cluster_message(); break;
     case 3: test3_compression_decompression_none(); break;
     case 4: test4_decompressionSizeLimit(); break;
+    case 5: test5_lz4AndZstd(); break;
+    case 6: test6_zstdDictionary(); break;
     case -1:
         BMQTST_BENCHMARK_WITH_ARGS(
             testN1_performanceCompressionDecompressionDefault,
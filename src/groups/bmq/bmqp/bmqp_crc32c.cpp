@@ -20,8 +20,24 @@
 // BDE
 #include <ball_log.h>
 #include <bdlde_crc32c.h>
+#include <bsl_cstring.h>
 #include <bsla_maybeunused.h>
+#include <bslmt_once.h>
+#include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64) &&                                     \
+    (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#include <nmmintrin.h>
+#define BMQP_CRC32C_INTERLEAVED_X86_64 1
+#define BMQP_CRC32C_TARGET __attribute__((target("sse4.2")))
+#elif defined(BSLS_PLATFORM_CPU_ARM) && defined(BSLS_PLATFORM_CPU_64_BIT) && \
+    defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define BMQP_CRC32C_INTERLEAVED_ARM64 1
+#define BMQP_CRC32C_TARGET
+#endif
 
 namespace BloombergLP {
 namespace bmqp {
@@ -30,6 +46,379 @@ namespace {
 
 BSLA_MAYBE_UNUSED const char k_LOG_CATEGORY[] = "BMQP.CRC32C";
 
+/// CRC32-C (Castagnoli) polynomial, in reversed bit order.
+const unsigned int k_POLYNOMIAL = 0x82F63B78;
+
+/// Length, in bytes, of each of the three streams of the interleaved
+/// implementation for large inputs.
+const bsl::size_t k_LONG_STREAM_LENGTH = 8192;
+
+/// Length, in bytes, of each of the three streams of the interleaved
+/// implementation for inputs smaller than three long streams.
+const bsl::size_t k_SHORT_STREAM_LENGTH = 256;
+
+/// Type of a table used to shift a CRC32-C value by a fixed number of zero
+/// bytes, one byte of the CRC32-C value at a time.
+typedef unsigned int ShiftTable[4][256];
+
+/// `x^(2^n)` modulo the polynomial, for each `n` in `[0, 32)`.
+unsigned int s_x2nTable[32];
+
+/// Tables to shift a CRC32-C value by `k_LONG_STREAM_LENGTH` and
+/// `k_SHORT_STREAM_LENGTH` zero bytes respectively.
+ShiftTable s_longShiftTable;
+ShiftTable s_shortShiftTable;
+
+/// Whether the interleaved implementation is supported by the platform.
+bool s_isInterleavedSupported = false;
+
+/// Return the product of the specified `a` and `b` modulo the polynomial,
+/// both being in reversed bit order.
+unsigned int multiplyModP(unsigned int a, unsigned int b)
+{
+    unsigned int mask    = 1u << 31;
+    unsigned int product = 0;
+    for (;;) {
+        if (a & mask) {
+            product ^= b;
+            if ((a & (mask - 1)) == 0) {
+                break;  // BREAK
+            }
+        }
+        mask >>= 1;
+        b = (b & 1) ? (b >> 1) ^ k_POLYNOMIAL : b >> 1;
+    }
+    return product;
+}
+
+/// Return `x^(8 * numBytes)` modulo the polynomial, i.e. the operator
+/// shifting a CRC32-C value by the specified `numBytes` zero bytes.  The
+/// behavior is undefined unless `initialize` has been called.
+unsigned int shiftOperator(bsls::Types::Uint64 numBytes)
+{
+    unsigned int result = 1u << 31;  // x^0
+    unsigned int n      = 3;         // 8 == 2^3
+    for (; numBytes; numBytes >>= 1, ++n) {
+        if (numBytes & 1) {
+            result = multiplyModP(s_x2nTable[n & 31], result);
+        }
+    }
+    return result;
+}
+
+/// Populate the specified `table` to shift a CRC32-C value by the specified
+/// `numBytes` zero bytes.
+void initializeShiftTable(ShiftTable* table, bsl::size_t numBytes)
+{
+    const unsigned int op = shiftOperator(numBytes);
+    for (unsigned int n = 0; n < 256; ++n) {
+        (*table)[0][n] = multiplyModP(op, n);
+        (*table)[1][n] = multiplyModP(op, n << 8);
+        (*table)[2][n] = multiplyModP(op, n << 16);
+        (*table)[3][n] = multiplyModP(op, n << 24);
+    }
+}
+
+/// Initialize the tables and the platform support of this component, once.
+void initialize()
+{
+    BSLMT_ONCE_DO
+    {
+        unsigned int p = 1u << 30;  // x^1
+        s_x2nTable[0]  = p;
+        for (int n = 1; n < 32; ++n) {
+            s_x2nTable[n] = p = multiplyModP(p, p);
+        }
+
+        initializeShiftTable(&s_longShiftTable, k_LONG_STREAM_LENGTH);
+        initializeShiftTable(&s_shortShiftTable, k_SHORT_STREAM_LENGTH);
+
+#if defined(BMQP_CRC32C_INTERLEAVED_X86_64)
+        s_isInterleavedSupported = __builtin_cpu_supports("sse4.2");
+#elif defined(BMQP_CRC32C_INTERLEAVED_ARM64)
+        s_isInterleavedSupported = true;
+#endif
+    }
+}
+
+/// Return the specified `crc` shifted by the number of zero bytes the
+/// specified `table` was populated for.
+inline unsigned int shift(const ShiftTable& table, unsigned int crc)
+{
+    return table[0][crc & 0xFF] ^ table[1][(crc >> 8) & 0xFF] ^
+           table[2][(crc >> 16) & 0xFF] ^ table[3][crc >> 24];
+}
+
+// ==================
+// class BufferCursor
+// ==================
+
+/// Mechanism to iterate over the bytes of a contiguous buffer or of the data
+/// buffers of a blob, one contiguous section at a time.
+class BufferCursor {
+  private:
+    // DATA
+    const bdlbb::Blob* d_blob_p;
+
+    int d_bufferIndex;
+
+    const char* d_data_p;
+
+    /// Number of bytes left in the current section.
+    bsl::size_t d_length;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Move to the next non-empty data buffer of the blob, if the current
+    /// section is exhausted and there is one.
+    void skipEmptyBuffers();
+
+  public:
+    // CREATORS
+
+    /// Create a cursor over the specified `length` bytes at the specified
+    /// `data`.
+    BufferCursor(const char* data, bsl::size_t length);
+
+    /// Create a cursor over the data buffers of the specified `blob`.  The
+    /// behavior is undefined unless `blob` has at least one data buffer.
+    explicit BufferCursor(const bdlbb::Blob& blob);
+
+    // MANIPULATORS
+
+    /// Advance this cursor by the specified `numBytes`.  The behavior is
+    /// undefined unless there are at least `numBytes` bytes left.
+    void advance(bsl::size_t numBytes);
+
+    // ACCESSORS
+
+    /// Return the address of the current section.
+    const char* data() const;
+
+    /// Return the number of bytes left in the current section.  Note that
+    /// this is zero only once all the bytes have been iterated over.
+    bsl::size_t length() const;
+};
+
+// ------------------
+// class BufferCursor
+// ------------------
+
+// PRIVATE MANIPULATORS
+inline void BufferCursor::skipEmptyBuffers()
+{
+    while (d_length == 0 && d_blob_p &&
+           d_bufferIndex + 1 < d_blob_p->numDataBuffers()) {
+        ++d_bufferIndex;
+        d_data_p = d_blob_p->buffer(d_bufferIndex).data();
+        d_length = d_bufferIndex + 1 == d_blob_p->numDataBuffers()
+                       ? d_blob_p->lastDataBufferLength()
+                       : d_blob_p->buffer(d_bufferIndex).size();
+    }
+}
+
+// CREATORS
+inline BufferCursor::BufferCursor(const char* data, bsl::size_t length)
+: d_blob_p(0)
+, d_bufferIndex(0)
+, d_data_p(data)
+, d_length(length)
+{
+}
+
+inline BufferCursor::BufferCursor(const bdlbb::Blob& blob)
+: d_blob_p(&blob)
+, d_bufferIndex(0)
+, d_data_p(blob.buffer(0).data())
+, d_length(blob.numDataBuffers() == 1 ? blob.lastDataBufferLength()
+                                      : blob.buffer(0).size())
+{
+    skipEmptyBuffers();
+}
+
+// MANIPULATORS
+inline void BufferCursor::advance(bsl::size_t numBytes)
+{
+    while (numBytes) {
+        BSLS_ASSERT_SAFE(d_length);
+
+        const bsl::size_t n = numBytes < d_length ? numBytes : d_length;
+        d_data_p += n;
+        d_length -= n;
+        numBytes -= n;
+        skipEmptyBuffers();
+    }
+}
+
+// ACCESSORS
+inline const char* BufferCursor::data() const
+{
+    return d_data_p;
+}
+
+inline bsl::size_t BufferCursor::length() const
+{
+    return d_length;
+}
+
+#if defined(BMQP_CRC32C_TARGET)
+
+/// Return the specified `crc` updated with the 8 bytes at the specified
+/// `data`.  Note that `crc` is neither pre- nor post-conditioned.
+BMQP_CRC32C_TARGET
+inline unsigned int updateWord(unsigned int crc, const char* data)
+{
+    bsls::Types::Uint64 word;
+    bsl::memcpy(&word, data, sizeof(word));
+#if defined(BMQP_CRC32C_INTERLEAVED_X86_64)
+    return static_cast<unsigned int>(_mm_crc32_u64(crc, word));
+#else
+    return __crc32cd(crc, word);
+#endif
+}
+
+/// Return the specified `crc` updated with the byte at the specified
+/// `data`.  Note that `crc` is neither pre- nor post-conditioned.
+BMQP_CRC32C_TARGET
+inline unsigned int updateByte(unsigned int crc, const char* data)
+{
+#if defined(BMQP_CRC32C_INTERLEAVED_X86_64)
+    return _mm_crc32_u8(crc, static_cast<unsigned char>(*data));
+#else
+    return __crc32cb(crc, static_cast<unsigned char>(*data));
+#endif
+}
+
+/// Return the specified `crc` updated with the specified `length` bytes at
+/// the specified `cursor`, one word at a time, and advance `cursor` past
+/// them.  Note that `crc` is neither pre- nor post-conditioned.
+BMQP_CRC32C_TARGET
+unsigned int
+updateSerial(BufferCursor* cursor, bsl::size_t length, unsigned int crc)
+{
+    while (length) {
+        const bsl::size_t n    = length < cursor->length() ? length
+                                                           : cursor->length();
+        const char*       data = cursor->data();
+        const char*       end  = data + n;
+
+        for (; data + sizeof(bsls::Types::Uint64) <= end;
+             data += sizeof(bsls::Types::Uint64)) {
+            crc = updateWord(crc, data);
+        }
+        for (; data < end; ++data) {
+            crc = updateByte(crc, data);
+        }
+
+        cursor->advance(n);
+        length -= n;
+    }
+    return crc;
+}
+
+/// Return the specified `crc` updated with the `3 * streamLength` bytes at
+/// the specified `cursor`, where the specified `streamLength` is the number
+/// of bytes the specified `table` shifts by, and advance `cursor` past
+/// them.  The three consecutive streams of `streamLength` bytes are
+/// processed concurrently, so that the latency of the CRC instruction is
+/// hidden, and their CRCs are then combined.  Note that `crc` is neither
+/// pre- nor post-conditioned.
+BMQP_CRC32C_TARGET
+unsigned int updateStreams(BufferCursor*     cursor,
+                           bsl::size_t       streamLength,
+                           const ShiftTable& table,
+                           unsigned int      crc)
+{
+    BufferCursor cursor1(*cursor);
+    cursor1.advance(streamLength);
+    BufferCursor cursor2(cursor1);
+    cursor2.advance(streamLength);
+
+    unsigned int crc1 = 0;
+    unsigned int crc2 = 0;
+
+    bsl::size_t left = streamLength;
+    while (left) {
+        // Process the longest section contiguous in all three streams.
+        bsl::size_t n = left;
+        n             = cursor->length() < n ? cursor->length() : n;
+        n             = cursor1.length() < n ? cursor1.length() : n;
+        n             = cursor2.length() < n ? cursor2.length() : n;
+
+        const char* data0 = cursor->data();
+        const char* data1 = cursor1.data();
+        const char* data2 = cursor2.data();
+
+        const bsl::size_t numWords = n / sizeof(bsls::Types::Uint64);
+        if (numWords) {
+            for (bsl::size_t i = 0; i < numWords; ++i) {
+                crc  = updateWord(crc, data0);
+                crc1 = updateWord(crc1, data1);
+                crc2 = updateWord(crc2, data2);
+                data0 += sizeof(bsls::Types::Uint64);
+                data1 += sizeof(bsls::Types::Uint64);
+                data2 += sizeof(bsls::Types::Uint64);
+            }
+            n = numWords * sizeof(bsls::Types::Uint64);
+        }
+        else {
+            // A stream is about to cross the boundary of a blob buffer.
+            for (bsl::size_t i = 0; i < n; ++i) {
+                crc  = updateByte(crc, data0 + i);
+                crc1 = updateByte(crc1, data1 + i);
+                crc2 = updateByte(crc2, data2 + i);
+            }
+        }
+
+        cursor->advance(n);
+        cursor1.advance(n);
+        cursor2.advance(n);
+        left -= n;
+    }
+
+    *cursor = cursor2;
+    return shift(table, shift(table, crc) ^ crc1) ^ crc2;
+}
+
+/// Return the CRC32-C value of the specified `length` bytes at the
+/// specified `cursor`, using the specified `crc` as the starting point,
+/// with the interleaved implementation.
+BMQP_CRC32C_TARGET
+unsigned int calculateInterleavedImp(BufferCursor* cursor,
+                                     bsl::size_t   length,
+                                     unsigned int  crc)
+{
+    crc = ~crc;
+    for (; length >= 3 * k_LONG_STREAM_LENGTH;
+         length -= 3 * k_LONG_STREAM_LENGTH) {
+        crc = updateStreams(cursor,
+                            k_LONG_STREAM_LENGTH,
+                            s_longShiftTable,
+                            crc);
+    }
+    for (; length >= 3 * k_SHORT_STREAM_LENGTH;
+         length -= 3 * k_SHORT_STREAM_LENGTH) {
+        crc = updateStreams(cursor,
+                            k_SHORT_STREAM_LENGTH,
+                            s_shortShiftTable,
+                            crc);
+    }
+    return ~updateSerial(cursor, length, crc);
+}
+
+#else
+
+unsigned int calculateInterleavedImp(BSLA_MAYBE_UNUSED BufferCursor* cursor,
+                                     BSLA_MAYBE_UNUSED bsl::size_t   length,
+                                     unsigned int                    crc)
+{
+    BSLS_ASSERT_INVOKE_NORETURN("Interleaved CRC32-C is not supported");
+    return crc;
+}
+
+#endif
+
 }  // close unnamed namespace
 
 // -------------
@@ -41,10 +430,57 @@ const unsigned int Crc32c::k_NULL_CRC32C = bdlde::Crc32c::k_NULL_CRC32C;
 unsigned int
 Crc32c::calculate(const void* data, unsigned int length, unsigned int crc)
 {
-    return bdlde::Crc32c::calculate(data, length, crc);
+    initialize();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!s_isInterleavedSupported)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return Crc32c_Impl::calculateSerial(data, length, crc);  // RETURN
+    }
+
+    return Crc32c_Impl::calculateInterleaved(data, length, crc);
 }
 
 unsigned int Crc32c::calculate(const bdlbb::Blob& blob, unsigned int crc)
+{
+    initialize();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!s_isInterleavedSupported)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return Crc32c_Impl::calculateSerial(blob, crc);  // RETURN
+    }
+
+    return Crc32c_Impl::calculateInterleaved(blob, crc);
+}
+
+unsigned int Crc32c::combine(unsigned int        crc1,
+                             unsigned int        crc2,
+                             bsls::Types::Uint64 length2)
+{
+    initialize();
+
+    return multiplyModP(shiftOperator(length2), crc1) ^ crc2;
+}
+
+// ------------------
+// struct Crc32c_Impl
+// ------------------
+
+bool Crc32c_Impl::isInterleavedSupported()
+{
+    initialize();
+
+    return s_isInterleavedSupported;
+}
+
+unsigned int Crc32c_Impl::calculateSerial(const void*  data,
+                                          unsigned int length,
+                                          unsigned int crc)
+{
+    return bdlde::Crc32c::calculate(data, length, crc);
+}
+
+unsigned int Crc32c_Impl::calculateSerial(const bdlbb::Blob& blob,
+                                          unsigned int       crc)
 {
     const int numBuffers = blob.numDataBuffers();
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numBuffers == 0)) {
@@ -55,16 +491,41 @@ unsigned int Crc32c::calculate(const bdlbb::Blob& blob, unsigned int crc)
     for (int i = 0; i < (numBuffers - 1); ++i) {
         const bdlbb::BlobBuffer& buffer = blob.buffer(i);
 
-        crc = calculate(buffer.data(), buffer.size(), crc);
+        crc = calculateSerial(buffer.data(), buffer.size(), crc);
     }
 
     // Handle last data buffer
-    crc = calculate(blob.buffer(numBuffers - 1).data(),
-                    blob.lastDataBufferLength(),
-                    crc);
+    crc = calculateSerial(blob.buffer(numBuffers - 1).data(),
+                          blob.lastDataBufferLength(),
+                          crc);
 
     return crc;
 }
 
+unsigned int Crc32c_Impl::calculateInterleaved(const void*  data,
+                                               unsigned int length,
+                                               unsigned int crc)
+{
+    BSLS_ASSERT_SAFE(isInterleavedSupported());
+    BSLS_ASSERT_SAFE(data || length == 0);
+
+    BufferCursor cursor(static_cast<const char*>(data), length);
+    return calculateInterleavedImp(&cursor, length, crc);
+}
+
+unsigned int Crc32c_Impl::calculateInterleaved(const bdlbb::Blob& blob,
+                                               unsigned int       crc)
+{
+    BSLS_ASSERT_SAFE(isInterleavedSupported());
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(blob.numDataBuffers() == 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return crc;  // RETURN
+    }
+
+    BufferCursor cursor(blob);
+    return calculateInterleavedImp(&cursor, blob.length(), crc);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
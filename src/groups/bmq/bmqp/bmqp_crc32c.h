@@ -20,7 +20,7 @@
 //
 //@CLASSES:
 //  bmqp::Crc32c     : calculates CRC32-C checksum
-//  bmqp::Crc32c_Impl: calculates CRC32-C checksum with alternative impl.
+//  bmqp::Crc32c_Impl: calculates CRC32-C checksum with alternative impls.
 //
 //@SEE_ALSO: bdlde::crc32
 //
@@ -51,6 +51,20 @@
 //: o sparc: runtime check is detected by the 'is_sparc_crc32c_avail' system
 //:   call
 //
+/// Interleaved Implementation
+///--------------------------
+// On x86-64 (when compiled with GCC or Clang, and SSE4.2 is detected at
+// runtime) and on ARM64 (when compiled with the CRC extension enabled, e.g.
+// '-march=armv8-a+crc'), 'bmqp::Crc32c' uses an implementation which splits
+// its input in three consecutive streams, computes their CRCs concurrently
+// using the 'crc32q' (resp. '__crc32cd') instruction, so that the latency of
+// the instruction is hidden, and combines them using precomputed tables.  The
+// streams of a blob are allowed to cross the boundaries of its data buffers,
+// so that a blob made of many small buffers is processed as efficiently as a
+// single contiguous buffer of the same length.  On other platforms, the BDE
+// implementation is used, one data buffer at a time.  'bmqp::Crc32c_Impl'
+// exposes both implementations for testing and benchmarking purposes.
+//
 /// Performance
 ///-----------
 // Below are performance comparisons of the hardware-accelerated and software
@@ -212,6 +226,7 @@
 #include <bdlbb_blob.h>
 #include <bsla_annotations.h>
 #include <bsla_deprecated.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace bmqp {
@@ -254,6 +269,66 @@ struct Crc32c {
     /// at least once.
     static unsigned int calculate(const bdlbb::Blob& blob,
                                   unsigned int       crc = k_NULL_CRC32C);
+
+    /// Return the CRC32-C value of the concatenation of a first input
+    /// having the specified `crc1` CRC32-C value and a second input of the
+    /// specified `length2` number of bytes having the specified `crc2`
+    /// CRC32-C value, where `crc2` was calculated with `k_NULL_CRC32C` as
+    /// the starting point.  Note that this allows calculating the CRC32-C
+    /// values of parts of an input independently.
+    static unsigned int combine(unsigned int        crc1,
+                                unsigned int        crc2,
+                                bsls::Types::Uint64 length2);
+};
+
+// ==================
+// struct Crc32c_Impl
+// ==================
+
+/// This class provides the alternative implementations used by `Crc32c`,
+/// and should not be used other than to test and benchmark.
+struct Crc32c_Impl {
+    // CLASS METHODS
+
+    /// Return `true` if the interleaved implementation is supported on the
+    /// running platform, and `false` otherwise.
+    static bool isInterleavedSupported();
+
+    /// Return the CRC32-C value calculated for the specified `data` over
+    /// the specified `length` number of bytes, using the optionally
+    /// specified `crc` value as the starting point for the calculation,
+    /// with the BDE implementation.
+    static unsigned int
+    calculateSerial(const void*  data,
+                    unsigned int length,
+                    unsigned int crc = Crc32c::k_NULL_CRC32C);
+
+    /// Return the CRC32-C value calculated over the buffers in the
+    /// specified `blob`, using the optionally specified `crc` value as the
+    /// starting point for the calculation, with the BDE implementation, one
+    /// data buffer at a time.
+    static unsigned int
+    calculateSerial(const bdlbb::Blob& blob,
+                    unsigned int       crc = Crc32c::k_NULL_CRC32C);
+
+    /// Return the CRC32-C value calculated for the specified `data` over
+    /// the specified `length` number of bytes, using the optionally
+    /// specified `crc` value as the starting point for the calculation,
+    /// with the interleaved implementation.  The behavior is undefined
+    /// unless `isInterleavedSupported()` returns `true`.
+    static unsigned int
+    calculateInterleaved(const void*  data,
+                         unsigned int length,
+                         unsigned int crc = Crc32c::k_NULL_CRC32C);
+
+    /// Return the CRC32-C value calculated over the buffers in the
+    /// specified `blob`, using the optionally specified `crc` value as the
+    /// starting point for the calculation, with the interleaved
+    /// implementation.  The behavior is undefined unless
+    /// `isInterleavedSupported()` returns `true`.
+    static unsigned int
+    calculateInterleaved(const bdlbb::Blob& blob,
+                         unsigned int       crc = Crc32c::k_NULL_CRC32C);
 };
 
 }  // close package namespace
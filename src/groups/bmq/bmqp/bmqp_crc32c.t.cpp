@@ -154,6 +154,18 @@ static void populateBufferLengthsSorted_GoogleBenchmark_Small(
     }
 }
 
+/// Apply to Google Benchmark internals the lengths of the blobs to
+/// benchmark, from 64 B to 1 Mi, for both the default and the serial
+/// implementations.
+static void
+populateBlobLengths_GoogleBenchmark(benchmark::internal::Benchmark* b)
+{
+    for (long int length = 64; length <= 1048576; length *= 4) {
+        b->Args({length, 0});  // default
+        b->Args({length, 1});  // serial
+    }
+}
+
 /// Populate the specified `bufferLengths` with various lengths in
 /// increasing soorted order. Apply these arguments to Google Benchmark
 /// internals Note that upper bound is 64Mi
@@ -191,6 +203,30 @@ static void populateBufferLengthsSorted_GoogleBenchmark_Large(
 }
 #endif
 
+/// Append to the specified `blob` the specified `length` bytes at the
+/// specified `data`, split in data buffers of the specified `bufferLength`
+/// bytes, except for the last one.  If `bufferLength` is zero, split them in
+/// data buffers of random lengths instead.  Note that the data buffers
+/// refer to `data`, which must outlive `blob`.
+static void populateBlob(bdlbb::Blob* blob,
+                         char*        data,
+                         int          length,
+                         int          bufferLength)
+{
+    for (int offset = 0; offset < length;) {
+        int size = bufferLength ? bufferLength : 1 + bsl::rand() % 1024;
+        size     = bsl::min(size, length - offset);
+
+        bsl::shared_ptr<char> dataSP;
+        dataSP.reset(data + offset,
+                     bslstl::SharedPtrNilDeleter(),
+                     bmqtst::TestHelperUtil::allocator());
+        blob->appendDataBuffer(bdlbb::BlobBuffer(dataSP, size));
+
+        offset += size;
+    }
+}
+
 /// Print the specified `headers` to the specified `out` in the following
 /// format:
 ///
@@ -1024,6 +1060,162 @@ static void test8_calculateOnBlobWithPreviousCrc()
     }
 }
 
+static void test9_calculateInterleaved()
+// ------------------------------------------------------------------------
+// CALCULATE CRC32-C INTERLEAVED
+//
+// Concerns:
+//   Verify that the interleaved implementation, when supported, calculates
+//   the same CRC32-C as the serial implementation, on contiguous buffers
+//   and on blobs whose data buffers split the three streams of the
+//   interleaved implementation at arbitrary offsets.
+//
+// Plan:
+//   - For buffers of lengths around the thresholds of the interleaved
+//     implementation and of random lengths, at random (mis)alignments and
+//     with a random previous CRC, compare the CRC32-C calculated by the
+//     default, interleaved and serial flavors, on the buffer and on blobs
+//     of data buffers of various lengths.
+//
+// Testing:
+//   bmqp::Crc32c_Impl::calculateInterleaved(const void   *data,
+//                                           unsigned int  length,
+//                                           unsigned int  crc);
+//   bmqp::Crc32c_Impl::calculateInterleaved(const bdlbb::Blob& blob,
+//                                           unsigned int       crc);
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("CALCULATE CRC32-C INTERLEAVED");
+
+    if (!bmqp::Crc32c_Impl::isInterleavedSupported()) {
+        PV("Interleaved implementation not supported, skipping");
+        return;  // RETURN
+    }
+
+    const int k_SHORT    = 3 * 256;   // three short streams
+    const int k_LONG     = 3 * 8192;  // three long streams
+    const int k_MAX_SIZE = 3 * k_LONG + 3 * k_SHORT + 100;
+    const int k_NUM_ITER = 200;
+
+    char* buffer = static_cast<char*>(
+        bmqtst::TestHelperUtil::allocator()->allocate(k_MAX_SIZE + 8));
+    bsl::generate_n(buffer, k_MAX_SIZE + 8, bsl::rand);
+
+    bsl::vector<int> lengths(bmqtst::TestHelperUtil::allocator());
+    const int        k_THRESHOLDS[] = {k_SHORT, k_LONG, k_LONG + k_SHORT};
+    for (size_t i = 0; i < sizeof(k_THRESHOLDS) / sizeof(*k_THRESHOLDS);
+         ++i) {
+        lengths.push_back(k_THRESHOLDS[i] - 1);
+        lengths.push_back(k_THRESHOLDS[i]);
+        lengths.push_back(k_THRESHOLDS[i] + 1);
+        lengths.push_back(k_THRESHOLDS[i] + 7);
+    }
+    for (int i = 0; i < k_NUM_ITER; ++i) {
+        lengths.push_back(bsl::rand() % k_MAX_SIZE);
+    }
+
+    // Lengths of the data buffers of the blobs, zero meaning random
+    const int k_BUFFER_LENGTHS[]   = {1, 3, 64, 1000, 4096, 0};
+    const int k_NUM_BUFFER_LENGTHS = sizeof(k_BUFFER_LENGTHS) /
+                                     sizeof(*k_BUFFER_LENGTHS);
+
+    for (unsigned int i = 0; i < lengths.size(); ++i) {
+        const int          length  = lengths[i];
+        char*              data    = buffer + bsl::rand() % 8;
+        const unsigned int prevCrc = bsl::rand();
+
+        PVV(i << ": length " << length);
+
+        const unsigned int expected =
+            bmqp::Crc32c_Impl::calculateSerial(data, length, prevCrc);
+
+        BMQTST_ASSERT_EQ_D(
+            length,
+            bmqp::Crc32c_Impl::calculateInterleaved(data, length, prevCrc),
+            expected);
+        BMQTST_ASSERT_EQ_D(length,
+                           bmqp::Crc32c::calculate(data, length, prevCrc),
+                           expected);
+
+        bdlbb::Blob blob(bmqtst::TestHelperUtil::allocator());
+        populateBlob(&blob,
+                     data,
+                     length,
+                     k_BUFFER_LENGTHS[i % k_NUM_BUFFER_LENGTHS]);
+
+        BMQTST_ASSERT_EQ_D(length,
+                           bmqp::Crc32c_Impl::calculateSerial(blob, prevCrc),
+                           expected);
+        BMQTST_ASSERT_EQ_D(
+            length,
+            bmqp::Crc32c_Impl::calculateInterleaved(blob, prevCrc),
+            expected);
+        BMQTST_ASSERT_EQ_D(length,
+                           bmqp::Crc32c::calculate(blob, prevCrc),
+                           expected);
+    }
+
+    bmqtst::TestHelperUtil::allocator()->deallocate(buffer);
+}
+
+static void test10_combine()
+// ------------------------------------------------------------------------
+// COMBINE
+//
+// Concerns:
+//   Verify that combining the CRC32-C values of two consecutive parts of a
+//   buffer yields the CRC32-C value of the whole buffer.
+//
+// Plan:
+//   - Split buffers of random lengths at random offsets, calculate the
+//     CRC32-C value of each part independently, combine them and compare
+//     the result to the CRC32-C value of the whole buffer.
+//
+// Testing:
+//   bmqp::Crc32c::combine(unsigned int        crc1,
+//                         unsigned int        crc2,
+//                         bsls::Types::Uint64 length2);
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COMBINE");
+
+    const int k_MAX_SIZE = 100000;
+    const int k_NUM_ITER = 200;
+
+    char* buffer = static_cast<char*>(
+        bmqtst::TestHelperUtil::allocator()->allocate(k_MAX_SIZE));
+    bsl::generate_n(buffer, k_MAX_SIZE, bsl::rand);
+
+    // Combining with an empty input is the identity
+    const unsigned int crc = bmqp::Crc32c::calculate(buffer, k_MAX_SIZE);
+    BMQTST_ASSERT_EQ(
+        bmqp::Crc32c::combine(crc, bmqp::Crc32c::k_NULL_CRC32C, 0),
+        crc);
+    BMQTST_ASSERT_EQ(bmqp::Crc32c::combine(bmqp::Crc32c::k_NULL_CRC32C,
+                                           crc,
+                                           k_MAX_SIZE),
+                     crc);
+
+    for (int i = 0; i < k_NUM_ITER; ++i) {
+        const unsigned int length  = 1 + bsl::rand() % k_MAX_SIZE;
+        const unsigned int length1 = bsl::rand() % length;
+        const unsigned int length2 = length - length1;
+        const unsigned int prevCrc = bsl::rand();
+
+        const unsigned int crc1 = bmqp::Crc32c::calculate(buffer,
+                                                          length1,
+                                                          prevCrc);
+        const unsigned int crc2 = bmqp::Crc32c::calculate(buffer + length1,
+                                                          length2);
+
+        BMQTST_ASSERT_EQ_D(i,
+                           bmqp::Crc32c::combine(crc1, crc2, length2),
+                           bmqp::Crc32c::calculate(buffer, length, prevCrc));
+    }
+
+    bmqtst::TestHelperUtil::allocator()->deallocate(buffer);
+}
+
 // ============================================================================
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
@@ -1682,6 +1874,94 @@ static void testN6_bdldPerformanceDefault()
     bmqtst::TestHelperUtil::allocator()->deallocate(buffer);
 }
 
+BSLA_MAYBE_UNUSED
+static void testN7_calculateOnBlob()
+// ------------------------------------------------------------------------
+// PERFORMANCE: CALCULATE CRC32-C ON BLOB
+//
+// Concerns:
+//   Test the performance of bmqp::Crc32c::calculate(const bdlbb::Blob& blob)
+//   on blobs from 64 B to 1 Mi, made of data buffers of a typical size, and
+//   compare it to the serial implementation which calculates the CRC32-C
+//   value of one data buffer at a time.
+//
+// Plan:
+//   - Time a large number of CRC32-C calculations for blobs of varying
+//     lengths in a single thread and take the average for each
+//     implementation.
+//
+// Testing:
+//   Performance of calculating CRC32-C on a blob using the default
+//   implementation.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName(
+        "PERFORMANCE: CALCULATE CRC32-C ON BLOB");
+
+    const int k_MAX_SIZE      = 1048576;             // 1 Mi
+    const int k_BUFFER_LENGTH = 4096;                // 4 Ki
+    const int k_TOTAL_BYTES   = 1024 * 1024 * 1024;  // 1 Gi
+
+    char* buffer = static_cast<char*>(
+        bmqtst::TestHelperUtil::allocator()->allocate(k_MAX_SIZE));
+    bsl::generate_n(buffer, k_MAX_SIZE, bsl::rand);
+
+    bsl::vector<TableRecord> tableRecords(bmqtst::TestHelperUtil::allocator());
+    for (int length = 64; length <= k_MAX_SIZE; length *= 4) {
+        const int k_NUM_ITERS = k_TOTAL_BYTES / length;
+
+        bdlbb::Blob blob(bmqtst::TestHelperUtil::allocator());
+        populateBlob(&blob, buffer, length, k_BUFFER_LENGTH);
+
+        //===================================================================//
+        //                        [1] Crc32c (default)
+        unsigned int crc32c = bmqp::Crc32c::calculate(blob);
+
+        // <time>
+        bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+        for (int l = 0; l < k_NUM_ITERS; ++l) {
+            crc32c = bmqp::Crc32c::calculate(blob);
+        }
+        bsls::Types::Int64 t1 = bsls::TimeUtil::getTimer() - startTime;
+        // </time>
+
+        //===================================================================//
+        //                        [2] Crc32c_Impl (serial)
+        unsigned int crc32cSerial = bmqp::Crc32c_Impl::calculateSerial(blob);
+
+        // <time>
+        startTime = bsls::TimeUtil::getTimer();
+        for (int l = 0; l < k_NUM_ITERS; ++l) {
+            crc32cSerial = bmqp::Crc32c_Impl::calculateSerial(blob);
+        }
+        bsls::Types::Int64 t2 = bsls::TimeUtil::getTimer() - startTime;
+        // </time>
+
+        BMQTST_ASSERT_EQ(crc32c, crc32cSerial);
+
+        //===================================================================//
+        //                            Report
+        TableRecord record;
+        record.d_size    = length;
+        record.d_timeOne = t1 / k_NUM_ITERS;
+        record.d_timeTwo = t2 / k_NUM_ITERS;
+        record.d_ratio   = static_cast<double>(t2) / static_cast<double>(t1);
+
+        tableRecords.push_back(record);
+    }
+
+    // Print performance comparison table
+    bsl::vector<bsl::string> headerCols;
+    headerCols.emplace_back("Size(B)");
+    headerCols.emplace_back("Def time(ns)");
+    headerCols.emplace_back("Serial time(ns)");
+    headerCols.emplace_back("Ratio(Serial / Def)");
+
+    printTable(bsl::cout, headerCols, tableRecords);
+
+    bmqtst::TestHelperUtil::allocator()->deallocate(buffer);
+}
+
 #ifdef BMQTST_BENCHMARK_ENABLED
 
 static void
@@ -1943,6 +2223,52 @@ testN6_bdldPerformanceDefault_GoogleBenchmark(benchmark::State& state)
     bmqtst::TestHelperUtil::allocator()->deallocate(buffer);
 }
 
+
+static void testN7_calculateOnBlob_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// PERFORMANCE: CALCULATE CRC32-C ON BLOB
+//
+// Concerns:
+//   Test the performance of bmqp::Crc32c::calculate(const bdlbb::Blob& blob)
+//   on blobs of varying lengths made of data buffers of a typical size,
+//   and that of the serial implementation.
+//
+// Plan:
+//   - Time CRC32-C calculations for blobs of lengths from 64 B to 1 Mi in a
+//     single thread, using the default implementation if 'state.range(1)'
+//     is 0, and the serial implementation otherwise.
+//
+// Testing:
+//   Performance of calculating CRC32-C on a blob using the default
+//   implementation.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK PERFORMANCE: "
+                                      "CALCULATE CRC32-C ON BLOB");
+
+    const int  length   = state.range(0);
+    const bool isSerial = state.range(1) != 0;
+    char*      buffer   = static_cast<char*>(
+        bmqtst::TestHelperUtil::allocator()->allocate(length));
+    bsl::generate_n(buffer, length, bsl::rand);
+
+    bdlbb::Blob blob(bmqtst::TestHelperUtil::allocator());
+    populateBlob(&blob, buffer, length, 4096);
+
+    state.SetLabel(isSerial ? "serial" : "default");
+
+    // <time>
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            isSerial ? bmqp::Crc32c_Impl::calculateSerial(blob)
+                     : bmqp::Crc32c::calculate(blob));
+    }
+    // </time>
+    state.SetBytesProcessed(state.iterations() * length);
+
+    bmqtst::TestHelperUtil::allocator()->deallocate(buffer);
+}
+
 #endif  // BMQTST_BENCHMARK_ENABLED
 
 // ============================================================================
@@ -1963,6 +2289,8 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 10: test10_combine(); break;
+    case 9: test9_calculateInterleaved(); break;
     case 8: test8_calculateOnBlobWithPreviousCrc(); break;
     case 7: test7_calculateOnBlob(); break;
     case 6: break;
@@ -2001,6 +2329,10 @@ int main(int argc, char* argv[])
             testN6_bdldPerformanceDefault,
             Apply(populateBufferLengthsSorted_GoogleBenchmark_Large));
         break;
+    case -7:
+        BMQTST_BENCHMARK_WITH_ARGS(testN7_calculateOnBlob,
+                                   Apply(populateBlobLengths_GoogleBenchmark));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
@@ -25,8 +25,10 @@
 #include <bmqt_resultcode.h>
 
 #include <bmqc_array.h>
+#include <bmqu_blobobjectproxy.h>
 
 // BDE
+#include <bdlbb_blobutil.h>
 #include <bdlma_localsequentialallocator.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
@@ -42,7 +44,7 @@ namespace bmqp {
 namespace {
 
 BSLMF_ASSERT(OptionType::k_HIGHEST_SUPPORTED_TYPE ==
-             OptionType::e_SUB_QUEUE_INFOS);
+             OptionType::e_TRACE_CONTEXT);
 // If we add new options (i.e. options other than SubQueueId), we simply
 // need to implement the processing of that particular option inside
 // 'importOptions' below.
@@ -342,6 +344,11 @@ Flattener::EventBuilderResult Flattener::importOptions()
             //       not need to handle it here.
             result = k_SUCCESS;
         } break;
+        case OptionType::e_TRACE_CONTEXT: {
+            // NOTE: The trace context describes the span of the originating
+            //       PUT and is not propagated to the flattened event.
+            result = k_SUCCESS;
+        } break;
         // Add operations for your own 'OptionType's here.
         case OptionType::e_UNDEFINED:
         default: {
@@ -540,5 +547,55 @@ int EventUtil::flattenPushEvent(bsl::vector<EventUtilEventInfo>* eventInfos,
     return flattener.flattenPushEvent();
 }
 
+int EventUtil::appendPushEvent(bdlbb::Blob* batch, const Event& event)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(batch);
+    BSLS_ASSERT_SAFE(event.isValid() && event.isPushEvent());
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS        = 0,
+        rc_EVENT_TOO_BIG  = -1,
+        rc_INVALID_HEADER = -2
+    };
+
+    const bdlbb::Blob& blob = *event.blob();
+
+    bmqu::BlobObjectProxy<EventHeader> header(&blob,
+                                              -EventHeader::k_MIN_HEADER_SIZE,
+                                              true,    // read
+                                              false);  // write
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!header.isSet())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc_INVALID_HEADER;  // RETURN
+    }
+
+    const int headerSize = header->headerWords() * Protocol::k_WORD_SIZE;
+    const int dataSize   = blob.length() - headerSize;
+
+    if (batch->length() == 0) {
+        // Initialize the batch with a copy of the header of 'event', so that
+        // updating its length does not modify the buffer shared with 'event'.
+        // The header is contiguous in the first buffer, as guaranteed by the
+        // builders.
+        batch->setLength(headerSize);
+        BSLS_ASSERT_SAFE(batch->buffer(0).size() >= headerSize);
+        bdlbb::BlobUtil::copy(batch->buffer(0).data(), blob, 0, headerSize);
+    }
+    else if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                 EventHeader::k_MAX_SIZE_SOFT - batch->length() < dataSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc_EVENT_TOO_BIG;  // RETURN
+    }
+
+    bdlbb::BlobUtil::append(batch, blob, headerSize, dataSize);
+
+    EventHeader& eh = *reinterpret_cast<EventHeader*>(batch->buffer(0).data());
+    eh.setLength(batch->length());
+
+    return rc_SUCCESS;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
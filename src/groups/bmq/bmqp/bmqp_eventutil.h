@@ -29,6 +29,7 @@
 // Thread safe.
 
 // BMQ
+#include <bmqc_array.h>
 #include <bmqp_blobpoolutil.h>
 #include <bmqp_protocol.h>
 #include <bmqp_queueid.h>
@@ -80,7 +81,11 @@ struct EventUtilQueueInfo {
 struct EventUtilEventInfo {
   public:
     // TYPES
-    typedef bsl::vector<EventUtilQueueInfo> Ids;
+
+    /// Queues of the messages of the event.  When not flattening, an event
+    /// is created for each PUSH message, with exactly one queue: use inline
+    /// storage for it, so that this does not allocate for each message.
+    typedef bmqc::Array<EventUtilQueueInfo, 1> Ids;
 
     // PUBLIC DATA
     const bsl::shared_ptr<bdlbb::Blob> d_blob_sp;
@@ -139,6 +144,16 @@ struct EventUtil {
                                 BlobSpPool*                      blobSpPool_p,
                                 bmqp::SchemaLearner&             schemaLearner,
                                 bslma::Allocator*                allocator);
+
+    /// Append the messages of the specified PUSH `event` to the specified
+    /// `batch`, sharing the buffers of `event`, and update the length in
+    /// the EventHeader of `batch`.  If `batch` is empty, it is initialized
+    /// with a copy of the EventHeader of `event`.  Return 0 on success, or
+    /// a non-zero error code, leaving `batch` unchanged, if the resulting
+    /// event would exceed `EventHeader::k_MAX_SIZE_SOFT`.  The behavior is
+    /// undefined unless `event` is a valid PUSH event, and `batch` is
+    /// either empty or a PUSH event built by this method.
+    static int appendPushEvent(bdlbb::Blob* batch, const Event& event);
 };
 
 // ============================================================================
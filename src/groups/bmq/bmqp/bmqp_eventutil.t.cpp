@@ -854,6 +854,101 @@ static void test3_flattenWithMessageProperties()
     }
 }
 
+static void test4_appendPushEvent()
+// ------------------------------------------------------------------------
+// APPEND PUSH EVENT
+//
+// Concerns:
+//   Appending PUSH events to a batch yields a valid PUSH event with the
+//   messages of all appended events, in order, and does not modify the
+//   appended events.
+//
+// Plan:
+//   1) Build two PUSH events of respectively 2 and 3 messages.
+//   2) Append both events to an empty batch.
+//   3) Verify the batch is a valid PUSH event with the 5 messages in order,
+//      and that the first event still has its original length.
+//
+// Testing:
+//   appendPushEvent(...)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("APPEND PUSH EVENT");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+
+    // 1) Build two PUSH events
+    bsl::vector<Data> data1(bmqtst::TestHelperUtil::allocator());
+    bsl::vector<Data> data2(bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < 2; ++i) {
+        appendDatum(&data1,
+                    0,
+                    generateRandomInteger(1, 120),
+                    &bufferFactory,
+                    bmqtst::TestHelperUtil::allocator());
+    }
+    for (int i = 0; i < 3; ++i) {
+        appendDatum(&data2,
+                    0,
+                    generateRandomInteger(1, 1500),
+                    &bufferFactory,
+                    bmqtst::TestHelperUtil::allocator());
+    }
+
+    bmqp::PushEventBuilder builder1(blobSpPool.get(),
+                                    bmqtst::TestHelperUtil::allocator());
+    bmqp::PushEventBuilder builder2(blobSpPool.get(),
+                                    bmqtst::TestHelperUtil::allocator());
+    appendMessages(&builder1, data1);
+    appendMessages(&builder2, data2);
+
+    bmqp::Event event1(builder1.blob(), bmqtst::TestHelperUtil::allocator());
+    bmqp::Event event2(builder2.blob(), bmqtst::TestHelperUtil::allocator());
+    const int   event1Length = event1.blob()->length();
+
+    // 2) Append both events to an empty batch
+    bdlbb::Blob batch(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(bmqp::EventUtil::appendPushEvent(&batch, event1), 0);
+    BMQTST_ASSERT_EQ(batch.length(), event1Length);
+    BMQTST_ASSERT_EQ(bmqp::EventUtil::appendPushEvent(&batch, event2), 0);
+
+    // 3) Verify the batch
+    bmqp::Event batchEvent(&batch, bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT(batchEvent.isValid());
+    BMQTST_ASSERT(batchEvent.isPushEvent());
+    BMQTST_ASSERT_EQ(event1.blob()->length(), event1Length);
+    BMQTST_ASSERT(bmqp::Event(builder1.blob(),
+                              bmqtst::TestHelperUtil::allocator())
+                      .isValid());
+
+    bsl::vector<Data> allData(data1, bmqtst::TestHelperUtil::allocator());
+    allData.insert(allData.end(), data2.begin(), data2.end());
+
+    bmqp::PushMessageIterator msgIterator(&bufferFactory,
+                                          bmqtst::TestHelperUtil::allocator());
+    batchEvent.loadPushMessageIterator(&msgIterator, true);
+
+    for (bsl::vector<Data>::size_type i = 0; i < allData.size(); ++i) {
+        BMQTST_ASSERT_EQ_D(i, msgIterator.next(), 1);
+        BMQTST_ASSERT_EQ_D(i, msgIterator.header().queueId(), allData[i].d_qid);
+
+        bdlbb::Blob payload(&bufferFactory,
+                            bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ_D(i, msgIterator.loadMessagePayload(&payload), 0);
+        BMQTST_ASSERT_EQ_D(
+            i,
+            bdlbb::BlobUtil::compare(payload, allData[i].d_payload),
+            0);
+    }
+    BMQTST_ASSERT_EQ(msgIterator.next(), 0);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -868,6 +963,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 4: test4_appendPushEvent(); break;
     case 3: test3_flattenWithMessageProperties(); break;
     case 2: test2_flattenExplodesEvent(); break;
     case 1: test1_breathingTest(); break;
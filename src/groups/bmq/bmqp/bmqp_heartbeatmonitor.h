@@ -29,6 +29,7 @@
 // BDE
 #include <bdlbb_blob.h>
 #include <bsls_atomic.h>
+#include <bsls_performancehint.h>
 
 namespace BloombergLP {
 namespace bmqp {
@@ -109,7 +110,13 @@ inline bool HeartbeatMonitor::checkData(bmqio::Channel*    channel,
 {
     BSLS_ASSERT_SAFE(channel);
 
-    d_packetReceived.storeRelaxed(1);
+    // Only write the flag if it was reset by the scheduler thread: on a busy
+    // channel, this avoids dirtying, on every packet, a cache line shared
+    // with the scheduler thread.
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_packetReceived.loadRelaxed() ==
+                                              0)) {
+        d_packetReceived.storeRelaxed(1);
+    }
 
     // Process heartbeat: if we receive a heartbeat request, simply reply
     // with a heartbeat response.
@@ -180,19 +180,14 @@ MessageGUIDGenerator::MessageGUIDGenerator(int sessionId, bool doIpResolving)
                   << ", clientID: " << d_clientIdHex << "]";
 }
 
-void MessageGUIDGenerator::generateGUID(bmqt::MessageGUID* guid)
+// PRIVATE ACCESSORS
+void MessageGUIDGenerator::populateGUID(bmqt::MessageGUID* guid,
+                                        unsigned int       counter,
+                                        bsls::Types::Int64 timerTickDiff) const
 {
-    // PRECONDITIONS
-    BSLS_ASSERT_SAFE(guid);
-
     // NOTE: 'BE' suffix in variable name implies that variable's value is
     //       big-endian (network byte order)
 
-    // Get a snapshot of timer tick and counter values
-    const bsls::Types::Int64 timerTickDiff = bsls::TimeUtil::getTimer() -
-                                             d_timerBaseOffset;
-    const unsigned int counter = d_counter++;
-
     // Below, we use our knowledge of internal memory layout of
     // bmqt::MessageGUID to populate its data member.  Alternatives are:
     //: o having setters in bmqt::MessageGUID, which is not ideal given that it
@@ -227,6 +222,56 @@ void MessageGUIDGenerator::generateGUID(bmqt::MessageGUID* guid)
     bsl::memcpy(buffer, d_clientId, k_CLIENT_ID_LEN_BINARY);
 }
 
+// MANIPULATORS
+void MessageGUIDGenerator::generateGUID(bmqt::MessageGUID* guid)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(guid);
+
+    // Get a snapshot of timer tick and counter values
+    const bsls::Types::Int64 timerTickDiff = bsls::TimeUtil::getTimer() -
+                                             d_timerBaseOffset;
+    const unsigned int counter = d_counter++;
+
+    populateGUID(guid, counter, timerTickDiff);
+}
+
+void MessageGUIDGenerator::generateGUIDs(bmqt::MessageGUID* guids, int count)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(guids || count == 0);
+    BSLS_ASSERT_SAFE(0 <= count && count <= (1 << k_COUNTER_BITS));
+
+    if (count == 0) {
+        return;  // RETURN
+    }
+
+    // Get a snapshot of timer tick, and reserve 'count' consecutive counter
+    // values.  Since the counter is what distinguishes GUIDs generated
+    // within the same timer tick, the batch is unique as long as it does not
+    // wrap around the counter field.
+    const bsls::Types::Int64 timerTickDiff = bsls::TimeUtil::getTimer() -
+                                             d_timerBaseOffset;
+    const unsigned int firstCounter = d_counter.add(count) - count;
+
+    populateGUID(&guids[0], firstCounter, timerTickDiff);
+
+    // The TimerTick and ClientId parts are shared by the whole batch: copy
+    // the first GUID and only rewrite the VersionAndCounter part.
+    for (int i = 1; i < count; ++i) {
+        guids[i] = guids[0];
+
+        const unsigned int versionAndCounter =
+            (k_GUID_VERSION << k_GUID_VERSION_START_IDX) |
+            (((firstCounter + i) << k_COUNTER_START_IDX) & k_COUNTER_MASK);
+        const bdlb::BigEndianUint32 versionAndCounterBE =
+            bdlb::BigEndianUint32::make(versionAndCounter);
+        bsl::memcpy(reinterpret_cast<char*>(&guids[i]),
+                    reinterpret_cast<const char*>(&versionAndCounterBE),
+                    k_GUID_VERSION_AND_COUNTER_BYTES);
+    }
+}
+
 int MessageGUIDGenerator::extractFields(int*                     version,
                                         unsigned int*            counter,
                                         bsls::Types::Int64*      timerTick,
@@ -18,6 +18,7 @@
 // BMQ
 #include <bmqt_messageguid.h>
 
+#include <bmqc_flatorderedhashmap.h>
 #include <bmqc_orderedhashmap.h>
 #include <bmqu_memoutstream.h>
 #include <bmqu_printutil.h>
@@ -36,6 +37,7 @@
 #include <bsl_unordered_set.h>
 #include <bsl_vector.h>
 #include <bslmt_barrier.h>
+#include <bslma_testallocator.h>
 #include <bslmt_threadgroup.h>
 #include <bsls_platform.h>
 #include <bsls_timeutil.h>
@@ -311,6 +313,85 @@ static int calcCollisions(const bsl::vector<bmqt::MessageGUID>& guids)
     return res;
 }
 
+
+/// Ordered map of GUIDs, as used by the data streams of the broker.
+typedef bmqc::OrderedHashMap<bmqt::MessageGUID,
+                             size_t,
+                             bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+    GUIDOrderedMap;
+
+/// Open-addressing ordered map of GUIDs.
+typedef bmqc::FlatOrderedHashMap<bmqt::MessageGUID,
+                                 size_t,
+                                 bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+    GUIDFlatOrderedMap;
+
+/// Insert into the specified `map` the specified `numMessages` GUIDs from
+/// the specified `generator`, simulating outstanding messages.
+template <class MAP>
+void fillOutstanding(MAP*                        map,
+                     bmqp::MessageGUIDGenerator* generator,
+                     size_t                      numMessages)
+{
+    bmqt::MessageGUID guid;
+    for (size_t i = 0; i < numMessages; ++i) {
+        generator->generateGUID(&guid);
+        map->insert(bsl::make_pair(guid, i));
+    }
+}
+
+/// Perform on the specified `map` of outstanding messages the specified
+/// `numCycles` cycles of posting a new message with a GUID from the
+/// specified `generator`, and confirming the oldest message by its GUID.
+template <class MAP>
+void cycleOutstanding(MAP*                        map,
+                      bmqp::MessageGUIDGenerator* generator,
+                      size_t                      numCycles)
+{
+    bmqt::MessageGUID guid;
+    for (size_t i = 0; i < numCycles; ++i) {
+        generator->generateGUID(&guid);
+        map->insert(bsl::make_pair(guid, i));
+
+        const bmqt::MessageGUID oldest = map->begin()->first;
+        map->erase(oldest);
+    }
+}
+
+/// Print the memory used per message and the time of a post and confirm
+/// cycle of the specified `map` type named with the specified `name`, at 1M
+/// and 10M outstanding messages.
+template <class MAP>
+void benchmarkOutstanding(const char* name)
+{
+    const size_t k_NUM_OUTSTANDING[] = {1000000, 10000000};  // 1M, 10M
+    const size_t k_NUM_CYCLES        = 1000000;              // 1M
+
+    for (size_t i = 0; i < sizeof(k_NUM_OUTSTANDING) / sizeof(size_t); ++i) {
+        const size_t numOutstanding = k_NUM_OUTSTANDING[i];
+
+        bslma::TestAllocator       allocator;
+        bmqp::MessageGUIDGenerator generator(0);
+
+        MAP map(&allocator);
+        fillOutstanding(&map, &generator, numOutstanding);
+
+        const bsls::Types::Int64 bytesPerMessage = allocator.numBytesInUse() /
+                                                   numOutstanding;
+
+        const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+        cycleOutstanding(&map, &generator, k_NUM_CYCLES);
+        const bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+
+        cout << name << " with "
+             << bmqu::PrintUtil::prettyNumber(
+                    static_cast<bsls::Types::Int64>(numOutstanding))
+             << " outstanding messages uses " << bytesPerMessage
+             << " bytes per message, and posts and confirms 1 message in "
+             << (end - begin) / k_NUM_CYCLES << " nano seconds." << endl;
+    }
+}
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -953,6 +1034,125 @@ static void test7_customHashUniqueness()
     }
 }
 
+static void test8_bulkGeneration()
+// ------------------------------------------------------------------------
+// BULK GENERATION
+//
+// Concerns:
+//   Verify that 'generateGUIDs' generates unique, well-formed GUIDs, which
+//   are also unique with the ones generated by 'generateGUID', and that the
+//   custom hash algorithm does not collide on GUIDs differing only by their
+//   counter field.
+//
+// Plan:
+//   - Generate a batch of GUIDs, interleaved with single GUIDs, and verify
+//     all of them are distinct, have consecutive counters within a batch,
+//     and share the timer tick and clientId of the batch.
+//   - Verify the custom hashes of a large batch are all distinct.
+//
+// Testing:
+//   generateGUIDs
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // 'bmqp::MessageGUIDGenerator::ctor' prints a BALL_LOG_INFO which
+    // allocates using the default allocator.
+
+    bmqtst::TestHelper::printTestName("BULK GENERATION");
+
+    bmqp::MessageGUIDGenerator generator(0);
+
+    {
+        PVV("Empty batch");
+        bmqt::MessageGUID guid;
+        generator.generateGUIDs(&guid, 0);
+        BMQTST_ASSERT(guid.isUnset());
+    }
+
+    {
+        PVV("Uniqueness and layout");
+        const int k_BATCH_SIZE  = 1000;
+        const int k_NUM_BATCHES = 10;
+
+        bsl::vector<bmqt::MessageGUID> batch(
+            k_BATCH_SIZE,
+            bmqtst::TestHelperUtil::allocator());
+        bsl::set<bmqt::MessageGUID, bmqt::MessageGUIDLess> guids(
+            bmqtst::TestHelperUtil::allocator());
+
+        for (int b = 0; b < k_NUM_BATCHES; ++b) {
+            bmqt::MessageGUID single;
+            generator.generateGUID(&single);
+            BMQTST_ASSERT(guids.insert(single).second);
+
+            generator.generateGUIDs(batch.data(), k_BATCH_SIZE);
+
+            int                firstVersion = 0;
+            unsigned int       firstCounter = 0;
+            bsls::Types::Int64 firstTick    = 0;
+            bsl::string firstClientId(bmqtst::TestHelperUtil::allocator());
+            BMQTST_ASSERT_EQ(
+                0,
+                bmqp::MessageGUIDGenerator::extractFields(&firstVersion,
+                                                          &firstCounter,
+                                                          &firstTick,
+                                                          &firstClientId,
+                                                          batch[0]));
+            BMQTST_ASSERT_EQ(1, firstVersion);
+            BMQTST_ASSERT_EQ(firstClientId,
+                             bsl::string(generator.clientIdHex(),
+                                         bmqtst::TestHelperUtil::allocator()));
+
+            for (int i = 0; i < k_BATCH_SIZE; ++i) {
+                BMQTST_ASSERT_EQ_D(i, batch[i].isUnset(), false);
+                BMQTST_ASSERT_D(i, guids.insert(batch[i]).second);
+
+                int                version = 0;
+                unsigned int       counter = 0;
+                bsls::Types::Int64 tick    = 0;
+                bsl::string clientId(bmqtst::TestHelperUtil::allocator());
+                BMQTST_ASSERT_EQ_D(
+                    i,
+                    0,
+                    bmqp::MessageGUIDGenerator::extractFields(&version,
+                                                              &counter,
+                                                              &tick,
+                                                              &clientId,
+                                                              batch[i]));
+                BMQTST_ASSERT_EQ_D(i, 1, version);
+                BMQTST_ASSERT_EQ_D(i,
+                                   (firstCounter + i) & 0x3FFFFF,
+                                   counter);
+                BMQTST_ASSERT_EQ_D(i, firstTick, tick);
+                BMQTST_ASSERT_EQ_D(i, firstClientId, clientId);
+            }
+        }
+
+        BMQTST_ASSERT_EQ(guids.size(),
+                         static_cast<size_t>(k_NUM_BATCHES *
+                                             (k_BATCH_SIZE + 1)));
+    }
+
+    {
+        PVV("Custom hash of a batch");
+        const int k_BATCH_SIZE = 100000;
+
+        bsl::vector<bmqt::MessageGUID> batch(
+            k_BATCH_SIZE,
+            bmqtst::TestHelperUtil::allocator());
+        generator.generateGUIDs(batch.data(), k_BATCH_SIZE);
+
+        bslh::Hash<bmqt::MessageGUIDHashAlgo> hasher;
+        bsl::unordered_set<size_t> hashes(bmqtst::TestHelperUtil::allocator());
+        hashes.reserve(k_BATCH_SIZE);
+        for (int i = 0; i < k_BATCH_SIZE; ++i) {
+            hashes.insert(hasher(batch[i]));
+        }
+
+        BMQTST_ASSERT_EQ(hashes.size(), static_cast<size_t>(k_BATCH_SIZE));
+    }
+}
+
 // ============================================================================
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
@@ -1112,6 +1312,61 @@ static void testN2_bmqtPerformance()
          << endl;
 }
 
+BSLA_MAYBE_UNUSED
+static void testN12_bulkGenerationPerformance()
+// ------------------------------------------------------------------------
+// BULK GENERATION PERFORMANCE
+//
+// Concerns:
+//   Compare the performance of bmqp::MessageGUIDGenerator::generateGUIDs()
+//   with that of repeated calls to generateGUID().
+//
+// Plan:
+//   - Time the generation of a huge number of bmqt::MessageGUIDs, one at a
+//     time and then in batches of various sizes, single threaded.
+//
+// Testing:
+//   Performance of the bulk bmqt::MessageGUID generation.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // 'bmqp::MessageGUIDGenerator::ctor' prints a BALL_LOG_INFO which
+    // allocates using the default allocator.
+
+    bmqtst::TestHelper::printTestName("BULK GENERATION PERFORMANCE");
+
+    const int k_NUM_GUIDS     = 10000000;  // 10 million
+    const int k_BATCH_SIZES[] = {1, 8, 32, 128, 1024};
+
+    bmqp::MessageGUIDGenerator     generator(0);
+    bsl::vector<bmqt::MessageGUID> guids(k_BATCH_SIZES[4],
+                                         bmqtst::TestHelperUtil::allocator());
+
+    bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+    for (int i = 0; i < k_NUM_GUIDS; ++i) {
+        generator.generateGUID(&guids[i % k_BATCH_SIZES[4]]);
+    }
+    bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+
+    cout << "generateGUID.............: "
+         << (end - start) / k_NUM_GUIDS << " ns per GUID\n";
+
+    for (size_t b = 0; b < sizeof(k_BATCH_SIZES) / sizeof(int); ++b) {
+        const int batchSize = k_BATCH_SIZES[b];
+
+        start = bsls::TimeUtil::getTimer();
+        for (int i = 0; i < k_NUM_GUIDS / batchSize; ++i) {
+            generator.generateGUIDs(guids.data(), batchSize);
+        }
+        end = bsls::TimeUtil::getTimer();
+
+        cout << "generateGUIDs (batch " << batchSize << "): "
+             << (end - start) / (k_NUM_GUIDS / batchSize * batchSize)
+             << " ns per GUID\n";
+    }
+    cout << endl;
+}
+
 BSLA_MAYBE_UNUSED
 static void testN2_bdlbPerformance()
 // ------------------------------------------------------------------------
@@ -1722,6 +1977,48 @@ static void testN10_hashCollisionsComparison()
     table.print(bsl::cout);
 }
 
+BSLA_MAYBE_UNUSED static void testN11_orderedMapOutstandingBenchmark()
+// ------------------------------------------------------------------------
+// ORDERED MAP OUTSTANDING MESSAGES BENCHMARK
+//
+// Concerns:
+//   Benchmark the memory used and the time to post and confirm a message
+//   in an orderedMap(KEY=bmqt::MessageGUID) holding 1M and 10M outstanding
+//   messages.
+//
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // 'bmqp::MessageGUIDGenerator::ctor' prints a BALL_LOG_INFO which
+    // allocates using the default allocator.
+
+    bmqtst::TestHelper::printTestName("ORDERED MAP OUTSTANDING MESSAGES "
+                                      "BENCHMARK");
+
+    benchmarkOutstanding<GUIDOrderedMap>("bmqc::OrderedHashMap");
+}
+
+BSLA_MAYBE_UNUSED static void testN11_flatOrderedMapOutstandingBenchmark()
+// ------------------------------------------------------------------------
+// FLAT ORDERED MAP OUTSTANDING MESSAGES BENCHMARK
+//
+// Concerns:
+//   Benchmark the memory used and the time to post and confirm a message
+//   in a flatOrderedMap(KEY=bmqt::MessageGUID) holding 1M and 10M
+//   outstanding messages.
+//
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // 'bmqp::MessageGUIDGenerator::ctor' prints a BALL_LOG_INFO which
+    // allocates using the default allocator.
+
+    bmqtst::TestHelper::printTestName("FLAT ORDERED MAP OUTSTANDING MESSAGES "
+                                      "BENCHMARK");
+
+    benchmarkOutstanding<GUIDFlatOrderedMap>("bmqc::FlatOrderedHashMap");
+}
+
 // Begin Benchmarking Tests
 
 #ifdef BMQTST_BENCHMARK_ENABLED
@@ -1767,6 +2064,39 @@ static void testN2_bmqtPerformance_GoogleBenchmark(benchmark::State& state)
     }
 }
 
+static void
+testN12_bulkGenerationPerformance_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// BULK GENERATION PERFORMANCE
+//
+// Concerns:
+//   Test the performance of bmqp::MessageGUIDGenerator::generateGUIDs()
+//   for a batch size of 'state.range(0)'.
+//
+// Plan:
+//   - Time the generation of batches of bmqt::MessageGUIDs in a tight
+//     loop, single threaded.
+//
+// Testing:
+//   Performance of the bulk bmqt::MessageGUID generation.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK BULK GENERATION "
+                                      "PERFORMANCE");
+
+    bmqp::MessageGUIDGenerator     generator(0);
+    bsl::vector<bmqt::MessageGUID> guids(state.range(0),
+                                         bmqtst::TestHelperUtil::allocator());
+
+    for (auto _ : state) {
+        generator.generateGUIDs(guids.data(),
+                                static_cast<int>(state.range(0)));
+        benchmark::DoNotOptimize(guids.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
 static void testN2_bdlbPerformance_GoogleBenchmark(benchmark::State& state)
 {
     // ---------------------
@@ -2029,6 +2359,63 @@ static void testN8_orderedMapWithCustomHashBenchmark_GoogleBenchmark(
         }
     }
 }
+static void testN11_orderedMapOutstandingBenchmark_GoogleBenchmark(
+    benchmark::State& state)
+// ------------------------------------------------------------------------
+// ORDERED MAP OUTSTANDING MESSAGES BENCHMARK
+//
+// Concerns:
+//   Benchmark posting and confirming a message in an
+//   orderedMap(KEY=bmqt::MessageGUID) holding 'state.range(0)' outstanding
+//   messages.
+//
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // 'bmqp::MessageGUIDGenerator::ctor' prints a BALL_LOG_INFO which
+    // allocates using the default allocator.
+
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK ORDERED MAP "
+                                      "OUTSTANDING MESSAGES BENCHMARK");
+
+    bmqp::MessageGUIDGenerator generator(0);
+
+    GUIDOrderedMap map(bmqtst::TestHelperUtil::allocator());
+    fillOutstanding(&map, &generator, state.range(0));
+
+    for (auto _ : state) {
+        cycleOutstanding(&map, &generator, 1);
+    }
+}
+
+static void testN11_flatOrderedMapOutstandingBenchmark_GoogleBenchmark(
+    benchmark::State& state)
+// ------------------------------------------------------------------------
+// FLAT ORDERED MAP OUTSTANDING MESSAGES BENCHMARK
+//
+// Concerns:
+//   Benchmark posting and confirming a message in a
+//   flatOrderedMap(KEY=bmqt::MessageGUID) holding 'state.range(0)'
+//   outstanding messages.
+//
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // 'bmqp::MessageGUIDGenerator::ctor' prints a BALL_LOG_INFO which
+    // allocates using the default allocator.
+
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK FLAT ORDERED MAP "
+                                      "OUTSTANDING MESSAGES BENCHMARK");
+
+    bmqp::MessageGUIDGenerator generator(0);
+
+    GUIDFlatOrderedMap map(bmqtst::TestHelperUtil::allocator());
+    fillOutstanding(&map, &generator, state.range(0));
+
+    for (auto _ : state) {
+        cycleOutstanding(&map, &generator, 1);
+    }
+}
 #endif  // BMQTST_BENCHMARK_ENABLED
 
 // ============================================================================
@@ -2044,6 +2431,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 8: test8_bulkGeneration(); break;
     case 7: test7_customHashUniqueness(); break;
     case 6: test6_defaultHashUniqueness(); break;
     case 5: test5_print(); break;
@@ -2103,6 +2491,16 @@ int main(int argc, char* argv[])
         break;
     case -9: testN9_hashBenchmarkComparison(); break;
     case -10: testN10_hashCollisionsComparison(); break;
+    case -11:
+        BMQTST_BENCHMARK_WITH_ARGS(testN11_orderedMapOutstandingBenchmark,
+                                   Arg(1000000)->Arg(10000000));
+        BMQTST_BENCHMARK_WITH_ARGS(testN11_flatOrderedMapOutstandingBenchmark,
+                                   Arg(1000000)->Arg(10000000));
+        break;
+    case -12:
+        BMQTST_BENCHMARK_WITH_ARGS(testN12_bulkGenerationPerformance,
+                                   RangeMultiplier(4)->Range(1, 1024));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
@@ -948,6 +948,12 @@ MessageProperties::streamOut(bdlbb::BlobBufferFactory*          bufferFactory,
         return d_blob.object();  // RETURN
     }
 
+    if (d_schema) {
+        // Properties are read lazily; make sure all the headers are read.
+        BSLA_MAYBE_UNUSED const int rc = loadProperties(false, true);
+        BSLS_ASSERT_SAFE(rc == 0);
+    }
+
     // Make sure all Properties are read.
     for (PropertyMapConstIter cit = d_properties.begin();
          cit != d_properties.end();
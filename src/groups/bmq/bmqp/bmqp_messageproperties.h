@@ -422,7 +422,12 @@ class MessageProperties {
     /// specified `schema` is not empty, return without parsing properties
     /// headers.  Otherwise, populate this instance with properties names,
     /// lengths, types, and offsets.
-    /// Return zero on success, and a non-zero value otherwise.
+    /// Return zero on success, and a non-zero value otherwise.  Note that
+    /// in the presence of `schema`, each property is located through
+    /// `schema` and parsed only when first accessed, and all the properties
+    /// are only parsed when this object is iterated or streamed out; an
+    /// error in a property header is then reported by the property being
+    /// absent.
     int streamIn(const bdlbb::Blob&           blob,
                  const MessagePropertiesInfo& info,
                  const SchemaPtr&             schema);
@@ -826,15 +831,24 @@ MessageProperties::findProperty(bsl::string_view name) const
         // We have to call twice (unless this is the last property) to
         // calculate 'theProperty' length from two offsets.
 
-        bsl::string temp;  // Can be '0'; using it to double-check
+#ifdef BSLS_ASSERT_SAFE_IS_ACTIVE
+        // Only read the name to double-check the schema, so that the lookup
+        // does not allocate it otherwise.
+        bsl::string  temp;
+        bsl::string* temp_p = &temp;
+#else
+        bsl::string* temp_p = 0;
+#endif
         rc = streamInPropertyHeader(&theProperty,
-                                    &temp,
+                                    temp_p,
                                     0,
                                     &totalLength,
                                     true,
                                     offset,
                                     index);
-        BSLS_ASSERT_SAFE(name == temp);
+#ifdef BSLS_ASSERT_SAFE_IS_ACTIVE
+        BSLS_ASSERT_SAFE(rc || name == temp);
+#endif
         if (rc) {
             // REVISIT: there are no means to report the error other than
             //          returning 'end()'
@@ -1450,6 +1450,86 @@ static void test13_streamInMalformedHeaderTest()
     BMQTST_ASSERT_EQ(0, dst.numProperties());
 }
 
+static void test14_lazySchemaReadTest()
+// ------------------------------------------------------------------------
+// LAZY SCHEMA READ TEST
+//
+// Concerns:
+//   1. Streaming in with a schema parses the properties only when
+//      accessed, and reports the properties of the wire representation.
+//   2. Accessing a property not present in the schema returns an error
+//      without altering the object.
+//   3. 'streamOut' after streaming in with a schema, and after adding a
+//      property, encodes all the properties, including the ones never
+//      accessed.
+//
+// Plan:
+//   1. Build the wire representation of properties and learn a schema
+//      from it.
+//   2. Stream it in with the schema, access some of the properties and
+//      check the remaining ones are still reported.
+//   3. Add a property, stream out, stream the result in again without a
+//      schema and verify all the properties.
+//
+// Testing:
+//   int streamIn(const bdlbb::Blob&,
+//                const MessagePropertiesInfo&,
+//                const SchemaPtr&);
+//   const bdlbb::Blob& streamOut(bdlbb::BlobBufferFactory*,
+//                                const MessagePropertiesInfo&);
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("LAZY SCHEMA READ TEST");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        128,
+        bmqtst::TestHelperUtil::allocator());
+    const bmqp::MessagePropertiesInfo logic(true, 1, false);
+
+    // Build a valid wire representation.
+    bmqp::MessageProperties src(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, src.setPropertyAsInt32("id", 42));
+    BMQTST_ASSERT_EQ(0, src.setPropertyAsString("tableName", "mytable"));
+    BMQTST_ASSERT_EQ(0, src.setPropertyAsBool("isUrgent", true));
+
+    bdlbb::Blob wireRep(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+    wireRep = src.streamOut(&bufferFactory, logic);
+
+    // Learn the schema from a fully read instance.
+    bmqp::MessageProperties learner(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, learner.streamIn(wireRep, logic.isExtended()));
+
+    bmqp::MessageProperties::SchemaPtr schema = learner.makeSchema(
+        bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT(schema);
+
+    bmqp::MessageProperties obj(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, obj.streamIn(wireRep, logic, schema));
+    BMQTST_ASSERT_EQ(3, obj.numProperties());
+
+    // Access a subset of the properties.
+    BMQTST_ASSERT_EQ(42, obj.getPropertyAsInt32("id"));
+    BMQTST_ASSERT_EQ(true, obj.hasProperty("tableName"));
+    BMQTST_ASSERT_EQ(false, obj.hasProperty("missing"));
+    BMQTST_ASSERT_EQ(3, obj.numProperties());
+
+    // Add a property and stream out, without accessing 'isUrgent'.
+    BMQTST_ASSERT_EQ(0, obj.setPropertyAsInt64("timestamp", 123456789LL));
+    BMQTST_ASSERT_EQ(4, obj.numProperties());
+
+    bdlbb::Blob newWireRep(&bufferFactory,
+                           bmqtst::TestHelperUtil::allocator());
+    newWireRep = obj.streamOut(&bufferFactory, logic);
+
+    bmqp::MessageProperties dst(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, dst.streamIn(newWireRep, logic.isExtended()));
+    BMQTST_ASSERT_EQ(4, dst.numProperties());
+    BMQTST_ASSERT_EQ(42, dst.getPropertyAsInt32("id"));
+    BMQTST_ASSERT_EQ("mytable", dst.getPropertyAsString("tableName"));
+    BMQTST_ASSERT_EQ(true, dst.getPropertyAsBool("isUrgent"));
+    BMQTST_ASSERT_EQ(123456789LL, dst.getPropertyAsInt64("timestamp"));
+}
+
 #ifdef BMQTST_BENCHMARK_ENABLED
 
 struct MessagePropertiesBenchmark_getPropertyRef {
@@ -1627,6 +1707,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 14: test14_lazySchemaReadTest(); break;
     case 13: test13_streamInMalformedHeaderTest(); break;
     case 12: test12_emptyPropertyValueStreamOutTest(); break;
     case 11: test11_binaryPropertyRvalueTest(); break;
@@ -409,5 +409,58 @@ int OptionsView::loadMsgGroupIdOption(Protocol::MsgGroupId* msgGroupId) const
     return rc_SUCCESS;
 }
 
+int OptionsView::loadTraceContextOption(
+    Protocol::TraceContext* traceContext) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(traceContext);
+    BSLS_ASSERT_SAFE(traceContext->empty());
+    BSLS_ASSERT_SAFE(isValid());
+    BSLS_ASSERT_SAFE(find(OptionType::e_TRACE_CONTEXT) != end());
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS           = 0,
+        rc_INVALID_BLOB      = -1,
+        rc_INSUFFICIENT_DATA = -2,
+        rc_INVALID_LENGTH    = -3
+    };
+
+    bmqu::BlobPosition startPos;
+    int                sizeBytes;
+    int                rc = loadOptionPositionAndSize(&startPos,
+                                       &sizeBytes,
+                                       OptionType::e_TRACE_CONTEXT,
+                                       true);  // hasPadding
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc_INSUFFICIENT_DATA;  // RETURN
+    }
+
+    // An untraced message does not carry the option, so an empty trace
+    // context is invalid, as is one exceeding
+    // Protocol::k_TRACE_CONTEXT_MAX_LENGTH.
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            sizeBytes == 0 ||
+            sizeBytes > Protocol::k_TRACE_CONTEXT_MAX_LENGTH)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return rc_INVALID_LENGTH;  // RETURN
+    }
+
+    traceContext->resize(sizeBytes);
+    rc = bmqu::BlobUtil::readNBytes(reinterpret_cast<char*>(
+                                        traceContext->data()),
+                                    *d_blob_p,
+                                    startPos,
+                                    sizeBytes);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(rc != 0)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        traceContext->clear();
+        return rc_INVALID_BLOB;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
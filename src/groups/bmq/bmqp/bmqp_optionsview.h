@@ -308,6 +308,15 @@ class OptionsView {
     /// empty `Protocol::MsgGroupId`.
     int loadMsgGroupIdOption(Protocol::MsgGroupId* msgGroupId) const;
 
+    /// Load into the specified `traceContext` the opaque trace context
+    /// associated with the options pointed to by this view.  Return zero on
+    /// success, and a non-zero value otherwise.  Behavior is undefined
+    /// unless `isValid()` returns `true`,
+    /// `find(bmqp::OptionType::Enum::e_TRACE_CONTEXT)` returns a valid
+    /// iterator and `traceContext` is a pointer to a valid empty
+    /// `Protocol::TraceContext`.
+    int loadTraceContextOption(Protocol::TraceContext* traceContext) const;
+
     /// Return an iterator pointing to the beginning of the available
     /// `bmqp::OptionType::Enum` for this container
     const_iterator begin() const;
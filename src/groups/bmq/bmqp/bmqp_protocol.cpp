@@ -35,7 +35,7 @@ namespace {
 // Compile-time assertions for the range of encodings supported currently
 BSLMF_ASSERT(EncodingType::e_BER ==
              EncodingType::k_LOWEST_SUPPORTED_ENCODING_TYPE);
-BSLMF_ASSERT(EncodingType::e_JSON ==
+BSLMF_ASSERT(EncodingType::e_COMPACT ==
              EncodingType::k_HIGHEST_SUPPORTED_ENCODING_TYPE);
 
 // Compile-time assertions for alignment of various headers in the protocol
@@ -241,6 +241,7 @@ const char* EncodingType::toAscii(EncodingType::Enum value)
         CASE(UNKNOWN)
         CASE(BER)
         CASE(JSON)
+        CASE(COMPACT)
     default: return "(* UNKNOWN *)";
     }
 
@@ -251,9 +252,10 @@ const char* EncodingType::toAscii(EncodingType::Enum value)
 // struct EncodingFeature
 // ----------------------
 
-const char EncodingFeature::k_FIELD_NAME[]    = "PROTOCOL_ENCODING";
-const char EncodingFeature::k_ENCODING_BER[]  = "BER";
-const char EncodingFeature::k_ENCODING_JSON[] = "JSON";
+const char EncodingFeature::k_FIELD_NAME[]       = "PROTOCOL_ENCODING";
+const char EncodingFeature::k_ENCODING_BER[]     = "BER";
+const char EncodingFeature::k_ENCODING_JSON[]    = "JSON";
+const char EncodingFeature::k_ENCODING_COMPACT[] = "COMPACT";
 
 // -------------------------------
 // struct HighAvailabilityFeatures
@@ -278,6 +280,22 @@ const char MessagePropertiesFeatures::k_MESSAGE_PROPERTIES_EX[] =
 const char SubscriptionsFeatures::k_FIELD_NAME[]       = "SUBSCRIPTIONS";
 const char SubscriptionsFeatures::k_CONFIGURE_STREAM[] = "CONFIGURE_STREAM";
 
+// --------------------------
+// struct CompressionFeatures
+// --------------------------
+
+const char CompressionFeatures::k_FIELD_NAME[] = "COMPRESSION";
+const char CompressionFeatures::k_LZ4[]        = "LZ4";
+const char CompressionFeatures::k_ZSTD[]       = "ZSTD";
+const int  CompressionFeatures::k_DEFAULT_ALGORITHMS;
+
+// ----------------------
+// struct TracingFeatures
+// ----------------------
+
+const char TracingFeatures::k_FIELD_NAME[]    = "TRACING";
+const char TracingFeatures::k_TRACE_CONTEXT[] = "TRACE_CONTEXT";
+
 // -----------------
 // struct OptionType
 // -----------------
@@ -307,6 +325,7 @@ const char* OptionType::toAscii(OptionType::Enum value)
         CASE(SUB_QUEUE_IDS_OLD)
         CASE(MSG_GROUP_ID)
         CASE(SUB_QUEUE_INFOS)
+        CASE(TRACE_CONTEXT)
     default: return "(* UNKNOWN *)";
     }
 
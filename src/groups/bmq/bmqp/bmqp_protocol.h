@@ -154,6 +154,7 @@
 #include <bsl_limits.h>
 #include <bsl_string.h>  // for bslstl::StringRef
 #include <bsl_type_traits.h>
+#include <bsl_vector.h>
 #include <bsla_annotations.h>
 #include <bslmf_assert.h>
 #include <bslmf_nestedtraitdeclaration.h>
@@ -366,6 +367,10 @@ struct Protocol {
     /// Holds the client-provided Group Id.
     typedef bsl::string MsgGroupId;
 
+    /// Holds the opaque, tracer-specific serialized form of a distributed
+    /// trace span context, as produced by `bmqpi::DTTracer::serializeSpan`.
+    typedef bsl::vector<unsigned char> TraceContext;
+
     // CONSTANTS
     static const int k_VERSION = 1;
     // Version of the protocol
@@ -404,6 +409,9 @@ struct Protocol {
     static const int k_MSG_GROUP_ID_MAX_LENGTH = 31;
     // Constant representing the maximum valid Group Id size.
 
+    static const int k_TRACE_CONTEXT_MAX_LENGTH = 256;
+    // Constant representing the maximum valid Trace Context size.
+
     static const int k_MAX_OPTIONS_SIZE;
     // Constant representing the maximum size of options area
     // for any type of event (PUT, PUSH, etc).  Note that
@@ -552,7 +560,12 @@ struct EncodingType {
         /// For backward compatibility, 'BER' needs to be assigned a value of
         /// zero.
         e_BER  = 0,
-        e_JSON = 1
+        e_JSON = 1,
+        /// Fixed binary layout for a selected set of control messages, see
+        /// `bmqp_compactcodecutil`.  Messages without a compact encoding are
+        /// sent in BER, so this encoding is only used with peers supporting
+        /// both.
+        e_COMPACT = 2
     };
 
     // CONSTANTS
@@ -565,7 +578,7 @@ struct EncodingType {
     /// NOTE: This value must always be equal to the highest type in the
     /// enum because it is being used as an upper bound to verify that an
     /// Event's `encoding type` field is a supported type.
-    static const int k_HIGHEST_SUPPORTED_ENCODING_TYPE = e_JSON;
+    static const int k_HIGHEST_SUPPORTED_ENCODING_TYPE = e_COMPACT;
 
     // CLASS METHODS
 
@@ -629,6 +642,9 @@ struct EncodingFeature {
 
     /// JSON encoding feature
     static const char k_ENCODING_JSON[];
+
+    /// Compact binary encoding feature
+    static const char k_ENCODING_COMPACT[];
 };
 
 /// This struct defines feature names related to High-Availability
@@ -662,6 +678,36 @@ struct SubscriptionsFeatures {
     static const char k_CONFIGURE_STREAM[];
 };
 
+/// This struct defines feature names related to the compression algorithms
+/// that a peer is able to decompress, in addition to `e_NONE` and `e_ZLIB`
+/// which are supported by all peers.
+struct CompressionFeatures {
+    /// Field name of the compression features
+    static const char k_FIELD_NAME[];
+
+    // CONSTANTS
+    static const char k_LZ4[];
+
+    static const char k_ZSTD[];
+
+    /// Mask of the compression algorithms supported by all peers, with the
+    /// bit `1 << algorithm` set for each supported `algorithm`.
+    static const int k_DEFAULT_ALGORITHMS =
+        (1 << bmqt::CompressionAlgorithmType::e_NONE) |
+        (1 << bmqt::CompressionAlgorithmType::e_ZLIB);
+};
+
+/// This struct defines feature names related to distributed tracing.
+struct TracingFeatures {
+    /// Field name of the tracing features
+    static const char k_FIELD_NAME[];
+
+    // CONSTANTS
+
+    /// Support for the `OptionType::e_TRACE_CONTEXT` option in PUT messages
+    static const char k_TRACE_CONTEXT[];
+};
+
 // =================
 // struct OptionType
 // =================
@@ -677,7 +723,8 @@ struct OptionType {
         e_UNDEFINED         = 0,
         e_SUB_QUEUE_IDS_OLD = 1,
         e_MSG_GROUP_ID      = 2,
-        e_SUB_QUEUE_INFOS   = 3
+        e_SUB_QUEUE_INFOS   = 3,
+        e_TRACE_CONTEXT     = 4
     };
 
     // CONSTANTS
@@ -690,7 +737,7 @@ struct OptionType {
     /// NOTE: This value must always be equal to the highest type in the
     /// enum because it is being used as an upper bound to verify an
     /// OptionHeader's `type` field is a supported type.
-    static const int k_HIGHEST_SUPPORTED_TYPE = e_SUB_QUEUE_INFOS;
+    static const int k_HIGHEST_SUPPORTED_TYPE = e_TRACE_CONTEXT;
 
     // CLASS METHODS
 
@@ -1578,6 +1625,22 @@ struct PutHeader {
     /// to this object.
     PutHeader& setHeaderWords(int value);
 
+    /// Set the flags, the number of words of the entire message, of its
+    /// options area and of this header, and the compression algorithm type
+    /// to the specified `flags`, `messageWords`, `optionsWords`,
+    /// `headerWords` and `compressionAlgorithmType` respectively, and
+    /// return a reference offering modifiable access to this object.  This
+    /// is equivalent to calling the corresponding setters in sequence, but
+    /// writes each of the two words holding these fields with a single
+    /// store instead of one read-modify-write per field, and is meant for
+    /// the event builders.
+    PutHeader& setFlagsAndWords(
+        int                                  flags,
+        int                                  messageWords,
+        int                                  optionsWords,
+        int                                  headerWords,
+        bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType);
+
     /// Set the queue id to the specified `value` and return a reference
     /// offering modifiable access to this object.
     PutHeader& setQueueId(int value);
@@ -2178,6 +2241,22 @@ struct PushHeader {
     /// to this object.
     PushHeader& setHeaderWords(int value);
 
+    /// Set the flags, the number of words of the entire message, of its
+    /// options area and of this header, and the compression algorithm type
+    /// to the specified `flags`, `messageWords`, `optionsWords`,
+    /// `headerWords` and `compressionAlgorithmType` respectively, and
+    /// return a reference offering modifiable access to this object.  This
+    /// is equivalent to calling the corresponding setters in sequence, but
+    /// writes each of the two words holding these fields with a single
+    /// store instead of one read-modify-write per field, and is meant for
+    /// the event builders.
+    PushHeader& setFlagsAndWords(
+        int                                  flags,
+        int                                  messageWords,
+        int                                  optionsWords,
+        int                                  headerWords,
+        bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType);
+
     /// Set the queue id to the specified `value` and return a reference
     /// offering modifiable access to this object.
     PushHeader& setQueueId(int value);
@@ -4295,6 +4374,41 @@ inline PutHeader& PutHeader::setHeaderWords(int value)
     return *this;
 }
 
+inline PutHeader& PutHeader::setFlagsAndWords(
+    int                                  flags,
+    int                                  messageWords,
+    int                                  optionsWords,
+    int                                  headerWords,
+    bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType)
+{
+    // PRECONDITIONS: protect against overflow
+    BSLS_ASSERT_SAFE(flags >= 0 && flags <= (1 << k_FLAGS_NUM_BITS) - 1);
+    BSLS_ASSERT_SAFE(messageWords >= 0 &&
+                     messageWords <= (1 << k_MSG_WORDS_NUM_BITS) - 1);
+    BSLS_ASSERT_SAFE(optionsWords >= 0 &&
+                     optionsWords <= (1 << k_OPTIONS_WORDS_NUM_BITS) - 1);
+    BSLS_ASSERT_SAFE(headerWords >= 0 &&
+                     headerWords <= (1 << k_HEADER_WORDS_NUM_BITS) - 1);
+    BSLS_ASSERT_SAFE(
+        compressionAlgorithmType >=
+            bmqt::CompressionAlgorithmType::k_LOWEST_SUPPORTED_TYPE &&
+        compressionAlgorithmType <=
+            bmqt::CompressionAlgorithmType::k_HIGHEST_SUPPORTED_TYPE);
+
+    // All fields are validated above, so that no mask is needed: only
+    // compile-time shifts are applied to the values.
+    d_flagsAndMessageWords = bdlb::BigEndianUint32::make(
+        (static_cast<unsigned int>(flags) << k_FLAGS_START_IDX) |
+        (static_cast<unsigned int>(messageWords) << k_MSG_WORDS_START_IDX));
+    d_optionsAndHeaderWordsAndCAT = bdlb::BigEndianUint32::make(
+        (static_cast<unsigned int>(optionsWords)
+         << k_OPTIONS_WORDS_START_IDX) |
+        (static_cast<unsigned int>(compressionAlgorithmType)
+         << k_CAT_START_IDX) |
+        (static_cast<unsigned int>(headerWords) << k_HEADER_WORDS_START_IDX));
+    return *this;
+}
+
 inline PutHeader& PutHeader::setQueueId(int value)
 {
     d_queueId = value;
@@ -4615,6 +4729,41 @@ inline PushHeader& PushHeader::setHeaderWords(int value)
     return *this;
 }
 
+inline PushHeader& PushHeader::setFlagsAndWords(
+    int                                  flags,
+    int                                  messageWords,
+    int                                  optionsWords,
+    int                                  headerWords,
+    bmqt::CompressionAlgorithmType::Enum compressionAlgorithmType)
+{
+    // PRECONDITIONS: protect against overflow
+    BSLS_ASSERT_SAFE(flags >= 0 && flags <= (1 << k_FLAGS_NUM_BITS) - 1);
+    BSLS_ASSERT_SAFE(messageWords >= 0 &&
+                     messageWords <= (1 << k_MSG_WORDS_NUM_BITS) - 1);
+    BSLS_ASSERT_SAFE(optionsWords >= 0 &&
+                     optionsWords <= (1 << k_OPTIONS_WORDS_NUM_BITS) - 1);
+    BSLS_ASSERT_SAFE(headerWords >= 0 &&
+                     headerWords <= (1 << k_HEADER_WORDS_NUM_BITS) - 1);
+    BSLS_ASSERT_SAFE(
+        compressionAlgorithmType >=
+            bmqt::CompressionAlgorithmType::k_LOWEST_SUPPORTED_TYPE &&
+        compressionAlgorithmType <=
+            bmqt::CompressionAlgorithmType::k_HIGHEST_SUPPORTED_TYPE);
+
+    // All fields are validated above, so that no mask is needed: only
+    // compile-time shifts are applied to the values.
+    d_flagsAndMessageWords = bdlb::BigEndianUint32::make(
+        (static_cast<unsigned int>(flags) << k_FLAGS_START_IDX) |
+        (static_cast<unsigned int>(messageWords) << k_MSG_WORDS_START_IDX));
+    d_optionsAndHeaderWordsAndCAT = bdlb::BigEndianUint32::make(
+        (static_cast<unsigned int>(optionsWords)
+         << k_OPTIONS_WORDS_START_IDX) |
+        (static_cast<unsigned int>(compressionAlgorithmType)
+         << k_CAT_START_IDX) |
+        (static_cast<unsigned int>(headerWords) << k_HEADER_WORDS_START_IDX));
+    return *this;
+}
+
 inline PushHeader& PushHeader::setQueueId(int value)
 {
     d_queueId = value;
@@ -27,7 +27,13 @@
 // TEST DRIVER
 #include <bmqtst_testhelper.h>
 
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
+
 // BDE
+#include <bsl_cstring.h>
 #include <bsl_ios.h>
 #include <bsl_limits.h>
 #include <bsl_string.h>
@@ -1408,13 +1414,14 @@ static void test4_enumPrint()
         BSLMF_ASSERT(bmqp::EncodingType::e_BER ==
                      bmqp::EncodingType::k_LOWEST_SUPPORTED_ENCODING_TYPE);
 
-        BSLMF_ASSERT(bmqp::EncodingType::e_JSON ==
+        BSLMF_ASSERT(bmqp::EncodingType::e_COMPACT ==
                      bmqp::EncodingType::k_HIGHEST_SUPPORTED_ENCODING_TYPE);
 
         PrintTestData k_DATA[] = {
             {L_, bmqp::EncodingType::e_UNKNOWN, "UNKNOWN"},
             {L_, bmqp::EncodingType::e_BER, "BER"},
-            {L_, bmqp::EncodingType::e_JSON, "JSON"}};
+            {L_, bmqp::EncodingType::e_JSON, "JSON"},
+            {L_, bmqp::EncodingType::e_COMPACT, "COMPACT"}};
 
         printEnumHelper<bmqp::EncodingType>(k_DATA);
     }
@@ -1425,13 +1432,14 @@ static void test4_enumPrint()
                      bmqp::OptionType::e_SUB_QUEUE_IDS_OLD);
 
         BSLMF_ASSERT(bmqp::OptionType::k_HIGHEST_SUPPORTED_TYPE ==
-                     bmqp::OptionType::e_SUB_QUEUE_INFOS);
+                     bmqp::OptionType::e_TRACE_CONTEXT);
 
         PrintTestData k_DATA[] = {
             {L_, bmqp::OptionType::e_UNDEFINED, "UNDEFINED"},
             {L_, bmqp::OptionType::e_SUB_QUEUE_IDS_OLD, "SUB_QUEUE_IDS_OLD"},
             {L_, bmqp::OptionType::e_MSG_GROUP_ID, "MSG_GROUP_ID"},
-            {L_, bmqp::OptionType::e_SUB_QUEUE_INFOS, "SUB_QUEUE_INFOS"}};
+            {L_, bmqp::OptionType::e_SUB_QUEUE_INFOS, "SUB_QUEUE_INFOS"},
+            {L_, bmqp::OptionType::e_TRACE_CONTEXT, "TRACE_CONTEXT"}};
 
         printEnumHelper<bmqp::OptionType>(k_DATA);
     }
@@ -1755,6 +1763,164 @@ static void test7_eventHeaderUtil()
         }
     }
 }
+
+template <class HEADER>
+static void setFlagsAndWordsHelper(int line)
+{
+    struct Test {
+        int                                  d_line;
+        int                                  d_flags;
+        int                                  d_messageWords;
+        int                                  d_optionsWords;
+        int                                  d_headerWords;
+        bmqt::CompressionAlgorithmType::Enum d_cat;
+    } k_DATA[] = {
+        {L_, 0, 0, 0, 0, bmqt::CompressionAlgorithmType::e_NONE},
+        {L_, 1, 9, 0, 9, bmqt::CompressionAlgorithmType::e_NONE},
+        {L_, 3, 1234, 17, 8, bmqt::CompressionAlgorithmType::e_ZLIB},
+        {L_, 15, (1 << 28) - 1, 0, 31, bmqt::CompressionAlgorithmType::e_NONE},
+        {L_, 8, 64, (1 << 24) - 1, 9, bmqt::CompressionAlgorithmType::e_ZLIB},
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx != k_NUM_DATA; ++idx) {
+        const Test& test = k_DATA[idx];
+
+        PVV(line << ": " << test.d_line);
+
+        HEADER expected;
+        expected.setFlags(test.d_flags)
+            .setMessageWords(test.d_messageWords)
+            .setOptionsWords(test.d_optionsWords)
+            .setHeaderWords(test.d_headerWords)
+            .setCompressionAlgorithmType(test.d_cat);
+
+        HEADER obj;
+        obj.setFlagsAndWords(test.d_flags,
+                             test.d_messageWords,
+                             test.d_optionsWords,
+                             test.d_headerWords,
+                             test.d_cat);
+
+        BMQTST_ASSERT_EQ_D(test.d_line, test.d_flags, obj.flags());
+        BMQTST_ASSERT_EQ_D(test.d_line,
+                           test.d_messageWords,
+                           obj.messageWords());
+        BMQTST_ASSERT_EQ_D(test.d_line,
+                           test.d_optionsWords,
+                           obj.optionsWords());
+        BMQTST_ASSERT_EQ_D(test.d_line, test.d_headerWords, obj.headerWords());
+        BMQTST_ASSERT_EQ_D(test.d_line,
+                           test.d_cat,
+                           obj.compressionAlgorithmType());
+        BMQTST_ASSERT_EQ_D(test.d_line,
+                           0,
+                           bsl::memcmp(&expected, &obj, sizeof(HEADER)));
+    }
+}
+
+static void test8_setFlagsAndWords()
+// --------------------------------------------------------------------
+// SET FLAGS AND WORDS
+//
+// Concerns:
+//   'setFlagsAndWords' of 'PutHeader' and 'PushHeader' encodes the same
+//   bytes as the corresponding individual setters called in sequence.
+//
+// Plan:
+//   For a set of values, including the maximum value of every field, set
+//   the fields of a header with the individual setters and of another
+//   header with 'setFlagsAndWords', and verify both the accessors and the
+//   binary representations of the two headers.
+//
+// Testing:
+//   PutHeader::setFlagsAndWords
+//   PushHeader::setFlagsAndWords
+// --------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("SET FLAGS AND WORDS");
+
+    setFlagsAndWordsHelper<bmqp::PutHeader>(L_);
+    setFlagsAndWordsHelper<bmqp::PushHeader>(L_);
+}
+
+// ============================================================================
+//                              PERFORMANCE TESTS
+// ----------------------------------------------------------------------------
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void testN1_headerSetters_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// HEADER SETTERS BENCHMARK
+//
+// Concerns:
+//   Measure the cost of encoding the first two words of a 'PutHeader' with
+//   the individual setters, as the event builders used to do.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: HEADER SETTERS");
+
+    bmqp::PutHeader headers[64];
+    int             i = 0;
+
+    // <time>
+    for (auto _ : state) {
+        bmqp::PutHeader& header = headers[i++ & 63];
+        header.setHeaderWords(9)
+            .setOptionsWords(i & 7)
+            .setMessageWords(9 + (i & 1023))
+            .setFlags(i & 15)
+            .setCompressionAlgorithmType(
+                bmqt::CompressionAlgorithmType::e_NONE);
+        benchmark::DoNotOptimize(header);
+    }
+    // </time>
+}
+
+static void
+testN1_headerFlagsAndWords_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// HEADER SET FLAGS AND WORDS BENCHMARK
+//
+// Concerns:
+//   Measure the cost of encoding the first two words of a 'PutHeader' with
+//   'setFlagsAndWords', as the event builders do.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: HEADER SET FLAGS AND WORDS");
+
+    bmqp::PutHeader headers[64];
+    int             i = 0;
+
+    // <time>
+    for (auto _ : state) {
+        bmqp::PutHeader& header = headers[i++ & 63];
+        header.setFlagsAndWords(i & 15,
+                                9 + (i & 1023),
+                                i & 7,
+                                9,
+                                bmqt::CompressionAlgorithmType::e_NONE);
+        benchmark::DoNotOptimize(header);
+    }
+    // </time>
+}
+#else
+static void testN1_headerSetters()
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: HEADER SETTERS");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+
+static void testN1_headerFlagsAndWords()
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: HEADER SET FLAGS AND WORDS");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+#endif  // BMQTST_BENCHMARK_ENABLED
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1765,6 +1931,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 8: test8_setFlagsAndWords(); break;
     case 7: test7_eventHeaderUtil(); break;
     case 6: test6_enumFromString(); break;
     case 5: test5_enumIsomorphism(); break;
@@ -1772,11 +1939,22 @@ int main(int argc, char* argv[])
     case 3: test3_flagUtils(); break;
     case 2: test2_bitManipulation(); break;
     case 1: test1_breathingTest(); break;
+    case -1:
+        BMQTST_BENCHMARK(testN1_headerSetters);
+        BMQTST_BENCHMARK(testN1_headerFlagsAndWords);
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
     } break;
     }
 
+#ifdef BMQTST_BENCHMARK_ENABLED
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
     TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
 }
@@ -265,6 +265,32 @@ bool ProtocolUtil::hasFeature(const char*        fieldName,
                 features.cend());
 }
 
+int ProtocolUtil::compressionAlgorithms(const bsl::string& featureSet)
+{
+    int mask = CompressionFeatures::k_DEFAULT_ALGORITHMS;
+
+    bsl::vector<bsl::string> features;
+    if (!loadFieldValues(&features,
+                         CompressionFeatures::k_FIELD_NAME,
+                         featureSet)) {
+        return mask;  // RETURN
+    }
+
+    if (bsl::find(features.cbegin(),
+                  features.cend(),
+                  CompressionFeatures::k_LZ4) != features.cend()) {
+        mask |= 1 << bmqt::CompressionAlgorithmType::e_LZ4;
+    }
+
+    if (bsl::find(features.cbegin(),
+                  features.cend(),
+                  CompressionFeatures::k_ZSTD) != features.cend()) {
+        mask |= 1 << bmqt::CompressionAlgorithmType::e_ZSTD;
+    }
+
+    return mask;
+}
+
 int ProtocolUtil::convertToOld(bdlbb::Blob*                         dst,
                                const bdlbb::Blob*                   src,
                                bmqt::CompressionAlgorithmType::Enum cat,
@@ -40,6 +40,7 @@
 // Thread safe.
 
 // BMQ
+#include <bmqp_compactcodecutil.h>
 #include <bmqp_protocol.h>
 #include <bmqt_resultcode.h>
 #include <bmqu_blob.h>
@@ -219,6 +220,20 @@ struct ProtocolUtil {
                            const char*        feature,
                            const bsl::string& featureSet);
 
+    /// Return the mask of the compression algorithms supported by a peer
+    /// advertising the specified `featureSet`, with the bit
+    /// `1 << algorithm` set for each supported `algorithm`.  Note that the
+    /// returned mask always includes `CompressionFeatures::
+    /// k_DEFAULT_ALGORITHMS`.
+    static int compressionAlgorithms(const bsl::string& featureSet);
+
+    /// Return true if the specified `algorithm` is part of the specified
+    /// `mask` of compression algorithms, as returned by
+    /// `compressionAlgorithms`, and false otherwise.
+    static bool isCompressionAlgorithmSupported(
+        int                                  mask,
+        bmqt::CompressionAlgorithmType::Enum algorithm);
+
     /// Invoke the specified `action` and if it returns e_EVENT_TOO_BIG then
     /// invoke the specified `overflowCb` and call `action` again.  Return
     /// result code returned from `action`
@@ -381,6 +396,11 @@ int ProtocolUtil::encodeMessage(bsl::ostream&      errorDescription,
 
         return rc;  // RETURN
     }
+    case EncodingType::e_COMPACT: {
+        return CompactCodecUtil::encode(errorDescription,
+                                        out,
+                                        message);  // RETURN
+    }
     case EncodingType::e_UNKNOWN:
     default: {
         errorDescription << "Unsupported encoding type: " << encodingType;
@@ -455,6 +475,11 @@ int ProtocolUtil::decodeMessage(bsl::ostream&      errorDescription,
 
         return rc;  // RETURN
     }
+    case EncodingType::e_COMPACT: {
+        return CompactCodecUtil::decode(errorDescription,
+                                        message,
+                                        stream);  // RETURN
+    }
     case EncodingType::e_UNKNOWN:
     default: {
         errorDescription << "Unsupported encoding type: " << encodingType;
@@ -497,6 +522,13 @@ int ProtocolUtil::decodeMessage(bsl::ostream&      errorDescription,
                          allocator);
 }
 
+inline bool ProtocolUtil::isCompressionAlgorithmSupported(
+    int                                  mask,
+    bmqt::CompressionAlgorithmType::Enum algorithm)
+{
+    return algorithm >= 0 && (mask & (1 << algorithm)) != 0;
+}
+
 inline bmqt::EventBuilderResult::Enum ProtocolUtil::buildEvent(
     const bsl::function<bmqt::EventBuilderResult::Enum(void)>& action,
     const bsl::function<void(void)>&                           overflowCb)
@@ -689,6 +689,89 @@ static void test10_parseMessageProperties()
     BMQTST_ASSERT_EQ(0, bdlbb::BlobUtil::compare(payloadOut, payload));
 }
 
+static void test11_compressionAlgorithms()
+// ------------------------------------------------------------------------
+// COMPRESSION ALGORITHMS
+//
+// Concerns:
+//   1. The mask returned by 'compressionAlgorithms' always includes the
+//      algorithms supported by all peers, and only includes the other
+//      algorithms if the feature set advertises them.
+//   2. 'isCompressionAlgorithmSupported' reports the algorithms of a mask.
+//
+// Plan:
+//   Compute the mask of various feature sets, and verify the algorithms
+//   reported as supported for each of them.
+//
+// Testing:
+//   compressionAlgorithms
+//   isCompressionAlgorithmSupported
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COMPRESSION ALGORITHMS");
+    // Disable check that no memory was allocated from the default allocator
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    struct Test {
+        int         d_line;
+        const char* d_featureSet;
+        bool        d_lz4;
+        bool        d_zstd;
+    } k_DATA[] = {
+        {L_, "", false, false},
+        {L_,
+         "PROTOCOL_ENCODING:BER,JSON;MPS:MESSAGE_PROPERTIES_EX",
+         false,
+         false},
+        {L_, "COMPRESSION:", false, false},
+        {L_, "COMPRESSION:LZ4", true, false},
+        {L_, "COMPRESSION:ZSTD", false, true},
+        {L_, "MPS:MESSAGE_PROPERTIES_EX;COMPRESSION:LZ4,ZSTD", true, true},
+        {L_, "COMPRESSION:LZ4,BROTLI;HA:GRACEFUL_SHUTDOWN", true, false},
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const Test& test = k_DATA[idx];
+
+        PVV(test.d_line << ": '" << test.d_featureSet << "'");
+
+        const int mask = bmqp::ProtocolUtil::compressionAlgorithms(
+            bsl::string(test.d_featureSet,
+                        bmqtst::TestHelperUtil::allocator()));
+
+        BMQTST_ASSERT_EQ_D(
+            test.d_line,
+            mask & bmqp::CompressionFeatures::k_DEFAULT_ALGORITHMS,
+            bmqp::CompressionFeatures::k_DEFAULT_ALGORITHMS);
+        BMQTST_ASSERT_D(test.d_line,
+                        bmqp::ProtocolUtil::isCompressionAlgorithmSupported(
+                            mask,
+                            bmqt::CompressionAlgorithmType::e_NONE));
+        BMQTST_ASSERT_D(test.d_line,
+                        bmqp::ProtocolUtil::isCompressionAlgorithmSupported(
+                            mask,
+                            bmqt::CompressionAlgorithmType::e_ZLIB));
+        BMQTST_ASSERT_EQ_D(
+            test.d_line,
+            bmqp::ProtocolUtil::isCompressionAlgorithmSupported(
+                mask,
+                bmqt::CompressionAlgorithmType::e_LZ4),
+            test.d_lz4);
+        BMQTST_ASSERT_EQ_D(
+            test.d_line,
+            bmqp::ProtocolUtil::isCompressionAlgorithmSupported(
+                mask,
+                bmqt::CompressionAlgorithmType::e_ZSTD),
+            test.d_zstd);
+        BMQTST_ASSERT_D(test.d_line,
+                        !bmqp::ProtocolUtil::isCompressionAlgorithmSupported(
+                            mask,
+                            bmqt::CompressionAlgorithmType::e_UNKNOWN));
+    }
+}
+
 // ============================================================================
 //                                MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -699,6 +782,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 11: test11_compressionAlgorithms(); break;
     case 10: test10_parseMessageProperties(); break;
     case 9: test9_encodeDecodeMessage(); break;
     case 8: test8_loadFieldValues(); break;
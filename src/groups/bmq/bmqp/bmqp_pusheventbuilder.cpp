@@ -29,6 +29,7 @@
 #include <bsla_annotations.h>
 #include <bslma_allocator.h>
 #include <bslmf_assert.h>
+#include <bslmf_movableref.h>
 #include <bsls_performancehint.h>
 
 namespace BloombergLP {
@@ -116,24 +117,49 @@ bmqt::EventBuilderResult::Enum PushEventBuilder::packMessageImp(
     const int optionsWords = optionsSize / Protocol::k_WORD_SIZE;
 
     (*d_currPushHeader)
-        .setHeaderWords(headerWords)
-        .setOptionsWords(optionsWords)
+        .setFlagsAndWords(flags,
+                          headerWords + optionsWords + numWords,
+                          optionsWords,
+                          headerWords,
+                          compressionAlgorithmType)
         .setQueueId(queueId)
-        .setMessageWords(headerWords + optionsWords + numWords)
-        .setMessageGUID(msgId)
-        .setCompressionAlgorithmType(compressionAlgorithmType)
-        .setFlags(flags);
+        .setMessageGUID(msgId);
 
     messagePropertiesInfo.applyTo(d_currPushHeader.object());
 
     d_currPushHeader.reset();  // i.e., flush writing to blob..
 
+    // The payload buffers are appended by reference, which trims the buffer
+    // holding the headers to its data length.  Keep the unused capacity of
+    // that buffer, so that the headers of the next message are written into
+    // it rather than into a newly allocated buffer.
+    bdlbb::BlobBuffer spareBuffer;
+    if (0 < payloadLen &&
+        d_blob_sp->numBuffers() == d_blob_sp->numDataBuffers()) {
+        const bdlbb::BlobBuffer& lastBuffer = d_blob_sp->buffer(
+            d_blob_sp->numDataBuffers() - 1);
+        const int lastBufferDataLength = d_blob_sp->lastDataBufferLength();
+        const int spareLength = lastBuffer.size() - lastBufferDataLength;
+
+        if (spareLength >= static_cast<int>(sizeof(PushHeader))) {
+            spareBuffer.reset(
+                bsl::shared_ptr<char>(lastBuffer.buffer(),
+                                      lastBuffer.data() +
+                                          lastBufferDataLength),
+                spareLength);
+        }
+    }
+
     // Add the payload
     bdlbb::BlobUtil::append(d_blob_sp.get(), payload);
 
     // Add padding
     ProtocolUtil::appendPadding(d_blob_sp.get(), payloadLen);
 
+    if (spareBuffer.size() != 0) {
+        d_blob_sp->appendBuffer(bslmf::MovableRefUtil::move(spareBuffer));
+    }
+
     d_options.reset();
     ++d_msgCount;
 
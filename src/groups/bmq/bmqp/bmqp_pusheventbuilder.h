@@ -32,6 +32,17 @@
 // Each message added to the PushEvent is padded, so that multiple messages can
 // be added in the same event, without impacting the alignment of the headers.
 //
+/// Payload
+///-------
+// The payload of a message is not copied into the event: its buffers are
+// appended by reference, so that a payload aliasing the memory of a file (as
+// done by 'mqbs::FileStore') reaches the channel without being copied.  The
+// headers and options of consecutive messages are written contiguously into
+// the unused capacity of the buffer holding the headers of the previous
+// message, so that a buffer is only allocated from the factory once that
+// capacity is exhausted rather than for every message.  Note that the
+// payload must therefore not be modified until the event has been sent.
+//
 /// Thread Safety
 ///-------------
 // NOT thread safe
@@ -1155,6 +1155,107 @@ static void test8_buildEventTooBig()
     BMQTST_ASSERT_EQ(count, peb.messageCount());
 }
 
+static void test9_buildEventWithAliasedPayload()
+// ------------------------------------------------------------------------
+// BUILD EVENT WITH ALIASED PAYLOAD
+//
+// Concerns:
+//   - The payload of a message is appended to the event by reference.
+//   - The headers of consecutive messages share the buffer allocated for
+//     the headers of the first message, instead of each message
+//     allocating a new buffer from the factory.
+//
+// Plan:
+//   - Pack multiple messages whose payload aliases an external buffer.
+//   - Verify that the payloads in the event still point to the external
+//     buffer, that all the headers were written in the same buffer, and
+//     that the event can be iterated.
+//
+// Testing:
+//   packMessage
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BUILD EVENT WITH ALIASED PAYLOAD");
+
+    const int k_NUM_MSGS    = 8;
+    const int k_PAYLOAD_LEN = 100;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+    bmqp::PushEventBuilder peb(blobSpPool.get(),
+                               bmqtst::TestHelperUtil::allocator());
+
+    char external[k_PAYLOAD_LEN];
+    bsl::memset(external, 'x', k_PAYLOAD_LEN);
+
+    bdlbb::Blob payload(bmqtst::TestHelperUtil::allocator());
+    payload.appendDataBuffer(bdlbb::BlobBuffer(
+        bsl::shared_ptr<char>(external,
+                              bslstl::SharedPtrNilDeleter(),
+                              bmqtst::TestHelperUtil::allocator()),
+        k_PAYLOAD_LEN));
+
+    for (int i = 0; i < k_NUM_MSGS; ++i) {
+        bmqt::EventBuilderResult::Enum rc = peb.packMessage(
+            payload,
+            i,
+            bmqt::MessageGUID(),
+            0,
+            bmqt::CompressionAlgorithmType::e_NONE);
+        BMQTST_ASSERT_EQ_D(i, rc, bmqt::EventBuilderResult::e_SUCCESS);
+    }
+
+    const bdlbb::Blob&           event         = *peb.blob();
+    const bsl::shared_ptr<char>& headersBuffer = event.buffer(0).buffer();
+    int                          numPayloads   = 0;
+    int                          numHeaders    = 0;
+
+    for (int i = 0; i < event.numDataBuffers(); ++i) {
+        const bdlbb::BlobBuffer& buffer = event.buffer(i);
+        if (buffer.data() == external) {
+            ++numPayloads;
+        }
+        else if (!buffer.buffer().owner_before(headersBuffer) &&
+                 !headersBuffer.owner_before(buffer.buffer())) {
+            // Aliases the buffer holding the headers of the first message
+            ++numHeaders;
+        }
+    }
+
+    BMQTST_ASSERT_EQ(k_NUM_MSGS, numPayloads);
+    BMQTST_ASSERT_EQ(k_NUM_MSGS, numHeaders);
+
+    // Iterate and check
+    bmqp::Event rawEvent(&event, bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(true, rawEvent.isPushEvent());
+
+    bmqp::PushMessageIterator pushIter(&bufferFactory,
+                                       bmqtst::TestHelperUtil::allocator());
+    rawEvent.loadPushMessageIterator(&pushIter, true);
+    BMQTST_ASSERT_EQ(true, pushIter.isValid());
+
+    int msgIndex = 0;
+    while (pushIter.next() == 1) {
+        BMQTST_ASSERT_EQ_D(msgIndex, msgIndex, pushIter.header().queueId());
+
+        bdlbb::Blob payloadBlob(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ_D(msgIndex,
+                           0,
+                           pushIter.loadMessagePayload(&payloadBlob));
+        BMQTST_ASSERT_EQ_D(msgIndex,
+                           0,
+                           bdlbb::BlobUtil::compare(payloadBlob, payload));
+        ++msgIndex;
+    }
+
+    BMQTST_ASSERT_EQ(k_NUM_MSGS, msgIndex);
+}
+
 static void testN1_decodeFromFile()
 // --------------------------------------------------------------------
 // DECODE FROM FILE
@@ -1307,6 +1408,7 @@ int main(int argc, char* argv[])
     //                  encoding RDA counters.
     switch (_testCase) {
     case 0:
+    case 9: test9_buildEventWithAliasedPayload(); break;
     case 8: test8_buildEventTooBig(); break;
     case 7: test7_buildEventOptionTooBig(); break;
     case 6: test6_buildEventWithImplicitPayload(); break;
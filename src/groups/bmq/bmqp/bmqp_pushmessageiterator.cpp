@@ -75,7 +75,7 @@ void PushMessageIterator::copyFrom(const PushMessageIterator& src)
     d_applicationData            = src.d_applicationData;
     d_header                     = src.d_header;
 
-    d_optionsView.reset();
+    d_optionsView.clear();
 }
 
 void PushMessageIterator::initCachedOptionsView() const
@@ -84,14 +84,14 @@ void PushMessageIterator::initCachedOptionsView() const
     BSLS_ASSERT_SAFE(isValid());
     BSLS_ASSERT_SAFE(hasOptions());
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_optionsView.isNull())) {
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_optionsView.isValid())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
         // Load options iterator
-        BSLA_MAYBE_UNUSED int rc = loadOptionsView(&d_optionsView.makeValue());
+        BSLA_MAYBE_UNUSED int rc = loadOptionsView(&d_optionsView);
         BSLS_ASSERT_SAFE(rc == 0);
     }
 
-    BSLS_ASSERT_SAFE(!d_optionsView.isNull());
+    BSLS_ASSERT_SAFE(d_optionsView.isValid());
 }
 
 // ACCESSORS
@@ -442,11 +442,25 @@ void PushMessageIterator::extractQueueInfo(int*          queueId,
         return;  // RETURN
     }
 
+    if (d_optionsSize == sizeof(OptionHeader)) {
+        // Common case of a non-fanout queue: the only option is a *packed*
+        // SubQueueInfos option, carrying the RDA counter of the default
+        // subscription in its header.  Read it directly rather than building
+        // an options view.
+        bmqu::BlobObjectProxy<OptionHeader> oh(d_blobIter.blob(),
+                                               d_optionsPosition);
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                oh.isSet() && oh->packed() &&
+                oh->type() == OptionType::e_SUB_QUEUE_INFOS)) {
+            *rdaInfo = RdaInfo(static_cast<unsigned int>(oh->words()));
+            return;  // RETURN
+        }
+    }
+
     // Load options view
     initCachedOptionsView();
 
-    BSLS_ASSERT_SAFE(!d_optionsView.isNull());
-    OptionsView& optionsView = d_optionsView.value();
+    OptionsView& optionsView = d_optionsView;
     BSLS_ASSERT_SAFE(optionsView.isValid());
 
     if (optionsView.find(OptionType::e_SUB_QUEUE_INFOS) == optionsView.end() &&
@@ -483,8 +497,7 @@ void PushMessageIterator::extractMsgGroupId(
     // Load options view
     initCachedOptionsView();
 
-    BSLS_ASSERT_SAFE(!d_optionsView.isNull());
-    OptionsView& optionsView = d_optionsView.value();
+    OptionsView& optionsView = d_optionsView;
     BSLS_ASSERT_SAFE(optionsView.isValid());
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
@@ -542,7 +555,7 @@ int PushMessageIterator::next()
     d_applicationDataPosition    = bmqu::BlobPosition();
     d_optionsSize                = 0;
     d_optionsPosition            = bmqu::BlobPosition();
-    d_optionsView.reset();
+    d_optionsView.clear();
     d_applicationData.removeAll();
 
     if (d_advanceLength != 0 && !d_blobIter.advance(d_advanceLength)) {
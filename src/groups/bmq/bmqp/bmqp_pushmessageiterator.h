@@ -62,7 +62,6 @@
 #include <bmqu_blobiterator.h>
 
 // BDE
-#include <bdlb_nullablevalue.h>
 #include <bdlbb_blob.h>
 #include <bsl_ostream.h>
 #include <bslma_allocator.h>
@@ -82,10 +81,6 @@ class MessageProperties;
 /// An iterator providing read-only sequential access to messages contained
 /// into a `PushEvent`.
 class PushMessageIterator {
-  private:
-    // PRIVATE TYPES
-    typedef bdlb::NullableValue<OptionsView> NullableOptionsView;
-
   private:
     // DATA
     bmqu::BlobIterator d_blobIter;
@@ -135,8 +130,13 @@ class PushMessageIterator {
     // iterator is considered in invalid
     // state if this value is == -1.
 
-    mutable NullableOptionsView d_optionsView;
-    // The OptionsView for this iterator.
+    mutable OptionsView d_optionsView;
+    // View over the options of the current
+    // message, loaded on first use and
+    // recycled from one message to the next
+    // so that iterating does not construct
+    // a view per message.  Invalid if not
+    // loaded for the current message.
 
     bool d_decompressFlag;
     // Flag indicating if message should be
@@ -438,6 +438,7 @@ inline PushMessageIterator::PushMessageIterator(const PushMessageIterator& src,
              bmqu::BlobPosition(),
              0,
              true)  // no def ctor - set in copyFrom
+, d_optionsView(allocator)
 , d_applicationData(src.d_bufferFactory_p, allocator)
 , d_bufferFactory_p(src.d_bufferFactory_p)
 , d_allocator_p(allocator)
@@ -469,7 +470,7 @@ inline void PushMessageIterator::clear()
     d_optionsPosition            = bmqu::BlobPosition();
     d_advanceLength              = -1;
     d_applicationData.removeAll();
-    d_optionsView.reset();
+    d_optionsView.clear();
 }
 
 // ACCESSORS
@@ -506,9 +507,7 @@ inline bool PushMessageIterator::hasMsgGroupId() const
 
     initCachedOptionsView();
 
-    BSLS_ASSERT_SAFE(!d_optionsView.isNull());
-
-    OptionsView& optionsView = d_optionsView.value();
+    OptionsView& optionsView = d_optionsView;
     BSLS_ASSERT_SAFE(optionsView.isValid());
 
     return optionsView.find(OptionType::e_MSG_GROUP_ID) != optionsView.end();
@@ -1493,6 +1493,129 @@ static void test7_extractOptions()
     }
 }
 
+static void test8_extractOptionsAfterReuse()
+// ------------------------------------------------------------------------
+// EXTRACT OPTIONS AFTER REUSE
+//
+// Concerns:
+//   1. Extracting the queue info of a message whose only option is a
+//      *packed* SubQueueInfos option yields the default subscription id
+//      and the RDA counter carried by the option header.
+//   2. The options view cached by the iterator is correctly invalidated
+//      when advancing to the next message, when resetting the iterator and
+//      when copying it, so that extracting the queue info of a message
+//      never reports options of another message.
+//
+// Plan:
+//   1) Create an event alternating messages having a packed SubQueueInfos
+//      option, no option and a non-packed SubQueueInfos option.
+//   2) Iterate over the event twice with the same iterator, resetting it
+//      in between, and extract the queue info of each message twice.
+//   3) Verify the extracted queue info of each message, as well as the
+//      ones extracted from a copy of the iterator.
+//
+// Testing:
+//   - extractQueueInfo(...)
+//   - reset(...)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("EXTRACT OPTIONS AFTER REUSE");
+
+    const int k_NUM_MSGS = 9;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob eventBlob(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+    bsl::vector<Data1> data(bmqtst::TestHelperUtil::allocator());
+    bmqp::EventHeader  eventHeader;
+
+    for (int i = 0; i < k_NUM_MSGS; ++i) {
+        appendDatum1(&data,
+                     i,
+                     i % 3 != 1,  // hasSubQueueInfo
+                     false,       // useOldSubQueueIds
+                     generateRandomInteger(1, 120),
+                     &bufferFactory,
+                     bmqtst::TestHelperUtil::allocator());
+
+        if (i % 3 == 0) {
+            // Use the default subQueueId so that the option is packed
+            bmqp::SubQueueInfo& info = data.back().d_subQueueInfos[0];
+            info = bmqp::SubQueueInfo(bmqp::QueueId::k_DEFAULT_SUBQUEUE_ID,
+                                      info.rdaInfo());
+        }
+        else if (i % 3 == 2 &&
+                 data.back().d_subQueueInfos[0].id() ==
+                     bmqp::QueueId::k_DEFAULT_SUBQUEUE_ID) {
+            // Make sure the option is not packed
+            data.back().d_subQueueInfos[0] = bmqp::SubQueueInfo(
+                1,
+                data.back().d_subQueueInfos[0].rdaInfo());
+        }
+    }
+
+    appendMessages1(&eventHeader,
+                    &eventBlob,
+                    data,
+                    &bufferFactory,
+                    bmqtst::TestHelperUtil::allocator());
+
+    bmqp::PushMessageIterator iter(&bufferFactory,
+                                   bmqtst::TestHelperUtil::allocator());
+
+    for (int pass = 0; pass < 2; ++pass) {
+        BMQTST_ASSERT_EQ_D(pass, iter.reset(&eventBlob, eventHeader, true), 0);
+        BMQTST_ASSERT_EQ_D(pass, iter.isValid(), true);
+
+        size_t index = 0;
+        while (iter.next() == 1 && index < data.size()) {
+            const Data1& D = data[index];
+
+            bmqp::PushMessageIterator copy(
+                iter,
+                bmqtst::TestHelperUtil::allocator());
+
+            for (int attempt = 0; attempt < 3; ++attempt) {
+                int           queueId(-1);
+                bmqp::RdaInfo rdaInfo;
+                unsigned int  subscriptionId;
+
+                if (attempt < 2) {
+                    iter.extractQueueInfo(&queueId, &subscriptionId, &rdaInfo);
+                }
+                else {
+                    copy.extractQueueInfo(&queueId, &subscriptionId, &rdaInfo);
+                }
+
+                BMQTST_ASSERT_EQ_D(index, queueId, D.d_qid);
+                BMQTST_ASSERT_EQ_D(index, iter.hasMsgGroupId(), false);
+
+                if (D.d_subQueueInfos.empty()) {
+                    BMQTST_ASSERT_EQ_D(
+                        index,
+                        subscriptionId,
+                        bmqp::Protocol::k_DEFAULT_SUBSCRIPTION_ID);
+                    BMQTST_ASSERT_EQ_D(index, rdaInfo.isUnlimited(), true);
+                }
+                else {
+                    BMQTST_ASSERT_EQ_D(index,
+                                       subscriptionId,
+                                       D.d_subQueueInfos[0].id());
+                    BMQTST_ASSERT_EQ_D(
+                        index,
+                        rdaInfo.counter(),
+                        D.d_subQueueInfos[0].rdaInfo().counter());
+                }
+            }
+
+            ++index;
+        }
+
+        BMQTST_ASSERT_EQ_D(pass, index, data.size());
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1523,6 +1646,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 8: test8_extractOptionsAfterReuse(); break;
     case 7: test7_extractOptions(); break;
     case 6: test6_iteratePushEventHavingZeroLengthMessages(); break;
     case 5: test5_iteratePushEventHavingMultipleMessages(); break;
@@ -74,6 +74,7 @@ void PutEventBuilder::resetFields()
     d_flags       = 0;
     d_messageGUID = bmqt::MessageGUID();
     d_crc32c      = 0;
+    d_traceContext.clear();
 }
 
 bmqt::EventBuilderResult::Enum
@@ -137,6 +138,25 @@ PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
             reinterpret_cast<const char*>(d_msgGroupId.value().data()),
             msgGroupId);
     }
+    if (!d_traceContext.empty()) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                d_traceContext.size() >
+                static_cast<size_t>(Protocol::k_TRACE_CONTEXT_MAX_LENGTH))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return Result::e_OPTION_TOO_BIG;  // RETURN
+        }
+        const OptionMeta traceContext = OptionMeta::forOptionWithPadding(
+            OptionType::e_TRACE_CONTEXT,
+            static_cast<int>(d_traceContext.size()));
+        Result::Enum res = optionBox.canAdd(sizeNoOptions, traceContext);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(res != Result::e_SUCCESS)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return res;  // RETURN
+        }
+        optionBox.add(d_blob_sp.get(),
+                      reinterpret_cast<const char*>(d_traceContext.data()),
+                      traceContext);
+    }
 
     const int headerWords = sizeof(bmqp::PutHeader) / Protocol::k_WORD_SIZE;
     const int optionsSize = optionBox.size();
@@ -144,12 +164,12 @@ PutEventBuilder::packMessageInternal(const bdlbb::Blob& appData, int queueId)
     const int optionsWords = optionsSize / Protocol::k_WORD_SIZE;
 
     (*putHeader)
-        .setHeaderWords(headerWords)
-        .setOptionsWords(optionsWords)
+        .setFlagsAndWords(d_flags,
+                          headerWords + optionsWords + numWords,
+                          optionsWords,
+                          headerWords,
+                          d_compressionAlgorithmType)
         .setQueueId(queueId)
-        .setMessageWords(headerWords + optionsWords + numWords)
-        .setFlags(d_flags)
-        .setCompressionAlgorithmType(d_compressionAlgorithmType)
         .setCrc32c(d_crc32c);
 
     d_messagePropertiesInfo.applyTo(putHeader.object());
@@ -190,6 +210,7 @@ PutEventBuilder::PutEventBuilder(BlobSpPool*       blobSpPool_p,
 , d_compressionAlgorithmType(bmqt::CompressionAlgorithmType::e_NONE)
 , d_lastPackedMessageCompressionRatio(-1)
 , d_messagePropertiesInfo()
+, d_traceContext(allocator)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(blobSpPool_p);
@@ -218,6 +239,7 @@ int PutEventBuilder::reset()
     d_crc32c                            = 0;
     d_lastPackedMessageCompressionRatio = -1;
     d_messagePropertiesInfo             = MessagePropertiesInfo();
+    d_traceContext.clear();
 
     // NOTE: Since PutEventBuilder owns the blob and we just reset it, we have
     //       guarantee that buffer(0) will contain the entire header (unless
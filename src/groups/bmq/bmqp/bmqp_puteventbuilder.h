@@ -178,6 +178,10 @@ class PutEventBuilder {
 
     MessagePropertiesInfo d_messagePropertiesInfo;
 
+    /// Opaque trace context of the current message, or empty if the message
+    /// is not traced.
+    bmqp::Protocol::TraceContext d_traceContext;
+
   private:
     // NOT IMPLEMENTED
     PutEventBuilder(const PutEventBuilder&) BSLS_CPP11_DELETED;
@@ -231,6 +235,13 @@ class PutEventBuilder {
     /// return a reference offering modifiable access to this object.
     PutEventBuilder& setMsgGroupId(const bmqp::Protocol::MsgGroupId& value);
 
+    /// Set the opaque trace context of the current message to the specified
+    /// `value` and return a reference offering modifiable access to this
+    /// object.  An empty `value` means the message is not traced.  Note
+    /// that the trace context is reset after every call to packMessage().
+    PutEventBuilder&
+    setTraceContext(const bmqp::Protocol::TraceContext& value);
+
     /// Set the message guid of the current message to the specified `value`
     /// and return a reference offering modifiable access to this object.
     PutEventBuilder& setMessageGUID(const bmqt::MessageGUID& value);
@@ -275,6 +286,10 @@ class PutEventBuilder {
     /// reference offering modifiable access to this object.
     PutEventBuilder& clearMsgGroupId();
 
+    /// Clear out the trace context, if any, of the current message and
+    /// return a reference offering modifiable access to this object.
+    PutEventBuilder& clearTraceContext();
+
     /// Add the current message to the underlying event blob with the
     /// specified `queueId` as the destination queue.  Return zero on
     /// success, and a meaningful non-zero error code otherwise.  In case of
@@ -310,6 +325,10 @@ class PutEventBuilder {
     /// after every call to packMessage().
     const NullableMsgGroupId& msgGroupId() const;
 
+    /// Return the trace context that was last set.  Note that the trace
+    /// context is reset after every call to packMessage().
+    const bmqp::Protocol::TraceContext& traceContext() const;
+
     /// Return the message guid that was last set.  Note that an unset guid
     /// is a valid return value.  Also note that guid is reset after every
     /// call to packMessage().
@@ -390,6 +409,17 @@ PutEventBuilder::setMsgGroupId(const bmqp::Protocol::MsgGroupId& value)
     return *this;
 }
 
+inline PutEventBuilder&
+PutEventBuilder::setTraceContext(const bmqp::Protocol::TraceContext& value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_msgStarted == true);
+
+    d_traceContext = value;
+
+    return *this;
+}
+
 inline PutEventBuilder&
 PutEventBuilder::setMessageGUID(const bmqt::MessageGUID& value)
 {
@@ -474,6 +504,12 @@ inline PutEventBuilder& PutEventBuilder::clearMsgGroupId()
     return *this;
 }
 
+inline PutEventBuilder& PutEventBuilder::clearTraceContext()
+{
+    d_traceContext.clear();
+    return *this;
+}
+
 inline void PutEventBuilder::startMessage()
 {
     d_msgStarted = true;
@@ -489,6 +525,7 @@ inline void PutEventBuilder::startMessage()
     d_msgGroupId.reset();
     d_crc32c                = 0;
     d_messagePropertiesInfo = MessagePropertiesInfo();
+    d_traceContext.clear();
 }
 
 // ACCESSORS
@@ -503,6 +540,12 @@ PutEventBuilder::msgGroupId() const
     return d_msgGroupId;
 }
 
+inline const bmqp::Protocol::TraceContext&
+PutEventBuilder::traceContext() const
+{
+    return d_traceContext;
+}
+
 inline const bmqt::MessageGUID& PutEventBuilder::messageGUID() const
 {
     return d_messageGUID;
@@ -21,6 +21,7 @@
 #include <bmqp_event.h>
 #include <bmqp_messageguidgenerator.h>
 #include <bmqp_messageproperties.h>
+#include <bmqp_optionsview.h>
 #include <bmqp_protocolutil.h>
 #include <bmqp_putmessageiterator.h>
 #include <bmqp_puttester.h>
@@ -55,6 +56,11 @@
 #include <bsl_memory.h>
 #include <bsl_vector.h>
 
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
+
 // CONVENIENCE
 using namespace BloombergLP;
 using namespace bsl;
@@ -2485,6 +2491,166 @@ static void test8_compressionRatioAccessor()
     BMQTST_ASSERT_GT(ratio, 1.0);
 }
 
+static void test9_traceContext()
+// ------------------------------------------------------------------------
+// TRACE CONTEXT
+//
+// Concerns:
+//   1. A trace context set on the current message is packed as a
+//      'e_TRACE_CONTEXT' option and can be loaded back from the options
+//      view of the message.
+//   2. The trace context is reset after 'packMessage'.
+//   3. A trace context exceeding 'k_TRACE_CONTEXT_MAX_LENGTH' is rejected.
+//
+// Plan:
+//   1. Pack a message with a trace context, then one without, and
+//      verify the options of both messages using 'PutMessageIterator'.
+//   2. Attempt to pack a message with an oversized trace context.
+//
+// Testing:
+//   setTraceContext()
+//   traceContext()
+//   bmqp::OptionsView::loadTraceContextOption()
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("TRACE CONTEXT");
+
+    const char* k_PAYLOAD = "abcdefghijklmnopqrstuvwxyz";
+    const int   k_QID     = 9876;
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+    bmqp::PutEventBuilder obj(blobSpPool.get(),
+                              bmqtst::TestHelperUtil::allocator());
+
+    bmqp::Protocol::TraceContext traceContext(
+        bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < 13; ++i) {
+        traceContext.push_back(static_cast<unsigned char>(i + 1));
+    }
+
+    // 1. Traced message followed by an untraced one
+    obj.startMessage();
+    obj.setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+    obj.setMessagePayload(k_PAYLOAD, bsl::strlen(k_PAYLOAD));
+    obj.setTraceContext(traceContext);
+    BMQTST_ASSERT(obj.traceContext() == traceContext);
+
+    BMQTST_ASSERT_EQ(obj.packMessage(k_QID),
+                     bmqt::EventBuilderResult::e_SUCCESS);
+    BMQTST_ASSERT(obj.traceContext().empty());
+
+    obj.startMessage();
+    obj.setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+    obj.setMessagePayload(k_PAYLOAD, bsl::strlen(k_PAYLOAD));
+    BMQTST_ASSERT_EQ(obj.packMessage(k_QID),
+                     bmqt::EventBuilderResult::e_SUCCESS);
+
+    bmqp::Event rawEvent(obj.blob().get(),
+                         bmqtst::TestHelperUtil::allocator());
+    BSLS_ASSERT(rawEvent.isPutEvent());
+
+    bmqp::PutMessageIterator putIter(&bufferFactory,
+                                     bmqtst::TestHelperUtil::allocator());
+    rawEvent.loadPutMessageIterator(&putIter, true);
+    BMQTST_ASSERT_EQ(true, putIter.isValid());
+
+    BMQTST_ASSERT_EQ(1, putIter.next());
+    BMQTST_ASSERT_EQ(true, putIter.hasOptions());
+    {
+        bmqp::OptionsView optionsView(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(0, putIter.loadOptionsView(&optionsView));
+        BMQTST_ASSERT(optionsView.find(bmqp::OptionType::e_TRACE_CONTEXT) !=
+                      optionsView.end());
+
+        bmqp::Protocol::TraceContext loaded(
+            bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(0, optionsView.loadTraceContextOption(&loaded));
+        BMQTST_ASSERT(loaded == traceContext);
+    }
+
+    BMQTST_ASSERT_EQ(1, putIter.next());
+    BMQTST_ASSERT_EQ(false, putIter.hasOptions());
+    BMQTST_ASSERT_EQ(0, putIter.next());
+
+    // 2. Oversized trace context
+    traceContext.resize(bmqp::Protocol::k_TRACE_CONTEXT_MAX_LENGTH + 1);
+
+    const int eventSize = obj.eventSize();
+    obj.startMessage();
+    obj.setMessageGUID(bmqp::MessageGUIDGenerator::testGUID());
+    obj.setMessagePayload(k_PAYLOAD, bsl::strlen(k_PAYLOAD));
+    obj.setTraceContext(traceContext);
+    BMQTST_ASSERT_EQ(obj.packMessage(k_QID),
+                     bmqt::EventBuilderResult::e_OPTION_TOO_BIG);
+    BMQTST_ASSERT_EQ(obj.eventSize(), eventSize);
+    BMQTST_ASSERT_EQ(obj.messageCount(), 2);
+}
+
+// ============================================================================
+//                              PERFORMANCE TESTS
+// ----------------------------------------------------------------------------
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void testN2_packMessage_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// PACK MESSAGE BENCHMARK
+//
+// Concerns:
+//   Measure the cost of appending a message of 'state.range(0)' bytes to
+//   a PUT event, including the CRC32-C computation, which is the per
+//   message work a producer does on its hot path.  A new event is started
+//   whenever the current one is full.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: PACK MESSAGE");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        4096,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+    bmqp::PutEventBuilder peb(blobSpPool.get(),
+                              bmqtst::TestHelperUtil::allocator());
+
+    const int         payloadSize = static_cast<int>(state.range(0));
+    const bsl::string payload(payloadSize,
+                              'x',
+                              bmqtst::TestHelperUtil::allocator());
+    const bmqt::MessageGUID guid = bmqp::MessageGUIDGenerator::testGUID();
+
+    // <time>
+    for (auto _ : state) {
+        peb.startMessage();
+        peb.setMessagePayload(payload.data(), payloadSize);
+        peb.setMessageGUID(guid);
+        if (peb.packMessage(1) != bmqt::EventBuilderResult::e_SUCCESS) {
+            peb.reset();
+            peb.startMessage();
+            peb.setMessagePayload(payload.data(), payloadSize);
+            peb.setMessageGUID(guid);
+            peb.packMessage(1);
+        }
+    }
+    // </time>
+
+    state.SetBytesProcessed(state.iterations() * payloadSize);
+}
+#else
+static void testN2_packMessage()
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: PACK MESSAGE");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+#endif  // BMQTST_BENCHMARK_ENABLED
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -2511,6 +2677,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 9: test9_traceContext(); break;
     case 8: test8_compressionRatioAccessor(); break;
     case 7: test7_multiplePackMessage(); break;
     case 6: test6_emptyBuilder(); break;
@@ -2520,11 +2687,22 @@ int main(int argc, char* argv[])
     case 2: test2_manipulators_one(); break;
     case 1: test1_breathingTest(); break;
     case -1: testN1_decodeFromFile(); break;
+    case -2:
+        BMQTST_BENCHMARK_WITH_ARGS(testN2_packMessage,
+                                   RangeMultiplier(8)->Range(64, 262144));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
     } break;
     }
 
+#ifdef BMQTST_BENCHMARK_ENABLED
+    if (_testCase < -1) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
     TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
 }
@@ -88,7 +88,7 @@ void PutMessageIterator::copyFrom(const PutMessageIterator& src)
     d_isDecompressingOldMPs      = src.d_isDecompressingOldMPs;
     d_header                     = src.d_header;
 
-    d_optionsView.reset();
+    d_optionsView.clear();
 }
 
 // ACCESSORS
@@ -98,15 +98,15 @@ void PutMessageIterator::initCachedOptionsView() const
     BSLS_ASSERT_SAFE(isValid());
     BSLS_ASSERT_SAFE(hasOptions());
 
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_optionsView.isNull())) {
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_optionsView.isValid())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
         // Load options iterator
-        BSLA_MAYBE_UNUSED int rc = loadOptionsView(&d_optionsView.makeValue());
+        BSLA_MAYBE_UNUSED int rc = loadOptionsView(&d_optionsView);
         BSLS_ASSERT_SAFE(rc == 0);
     }
 
     // POSTCONDITIONS
-    BSLS_ASSERT_SAFE(!d_optionsView.isNull());
+    BSLS_ASSERT_SAFE(d_optionsView.isValid());
 }
 
 int PutMessageIterator::compressedApplicationDataSize() const
@@ -454,8 +454,7 @@ bool PutMessageIterator::extractMsgGroupId(
     // Load options view
     initCachedOptionsView();
 
-    BSLS_ASSERT_SAFE(!d_optionsView.isNull());
-    OptionsView& optionsView = d_optionsView.value();
+    OptionsView& optionsView = d_optionsView;
     BSLS_ASSERT_SAFE(optionsView.isValid());
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
@@ -515,7 +514,7 @@ int PutMessageIterator::next()
     d_applicationDataPosition    = bmqu::BlobPosition();
     d_optionsSize                = 0;
     d_optionsPosition            = bmqu::BlobPosition();
-    d_optionsView.reset();
+    d_optionsView.clear();
     d_applicationData.removeAll();
 
     if (d_advanceLength != 0 && !d_blobIter.advance(d_advanceLength)) {
@@ -60,7 +60,6 @@
 #include <bmqu_blobiterator.h>
 
 // BDE
-#include <bdlb_nullablevalue.h>
 #include <bdlbb_blob.h>
 #include <bdlma_localsequentialallocator.h>
 #include <bsl_iterator.h>
@@ -82,11 +81,6 @@ class MessageProperties;
 /// An iterator providing read-only sequential access to messages contained
 /// into a `PutEvent`.
 class PutMessageIterator {
-  private:
-    // PRIVATE TYPES
-
-    typedef bdlb::NullableValue<OptionsView> NullableOptionsView;
-
   private:
     // DATA
     bmqu::BlobIterator d_blobIter;
@@ -147,8 +141,13 @@ class PutMessageIterator {
     // iterator is considered in invalid
     // state if this value is == -1.
 
-    mutable NullableOptionsView d_optionsView;
-    // The OptionsView for this iterator.
+    mutable OptionsView d_optionsView;
+    // View over the options of the current
+    // message, loaded on first use and
+    // recycled from one message to the next
+    // so that iterating does not construct
+    // a view per message.  Invalid if not
+    // loaded for the current message.
 
     bool d_decompressFlag;
     // Flag indicating if message should be
@@ -461,6 +460,7 @@ inline PutMessageIterator::PutMessageIterator(const PutMessageIterator& src,
              bmqu::BlobPosition(),
              0,
              true)  // no def ctor - set in copyFrom
+, d_optionsView(allocator)
 , d_applicationData(src.d_bufferFactory_p, allocator)
 , d_bufferFactory_p(src.d_bufferFactory_p)
 , d_allocator_p(allocator)
@@ -492,7 +492,7 @@ inline void PutMessageIterator::clear()
     d_optionsPosition            = bmqu::BlobPosition();
     d_advanceLength              = -1;
     d_applicationData.removeAll();
-    d_optionsView.reset();
+    d_optionsView.clear();
 }
 
 // ACCESSORS
@@ -530,8 +530,7 @@ inline bool PutMessageIterator::hasMsgGroupId() const
     // Load options view
     initCachedOptionsView();
 
-    BSLS_ASSERT_SAFE(!d_optionsView.isNull());
-    OptionsView& optionsView = d_optionsView.value();
+    OptionsView& optionsView = d_optionsView;
     BSLS_ASSERT_SAFE(optionsView.isValid());
 
     return optionsView.find(OptionType::e_MSG_GROUP_ID) != optionsView.end();
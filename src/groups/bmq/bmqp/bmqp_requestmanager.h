@@ -636,6 +636,10 @@ class RequestManagerRequest {
     /// Return the description of the node the request was sent to.
     const bsl::string& nodeDescription() const;
 
+    /// Return the time, as returned by `bmqu::Time::highResolutionTimer`,
+    /// when the request was last sent, or 0 if it has not been sent.
+    bsls::Types::Int64 sendTime() const;
+
     /// Return the associated group id (`NO_GROUP_ID` by default).
     int groupId() const;
 
@@ -1143,6 +1147,12 @@ RequestManagerRequest<REQUEST, RESPONSE>::nodeDescription() const
     return d_nodeDescription;
 }
 
+template <class REQUEST, class RESPONSE>
+bsls::Types::Int64 RequestManagerRequest<REQUEST, RESPONSE>::sendTime() const
+{
+    return d_sendTime;
+}
+
 template <class REQUEST, class RESPONSE>
 int RequestManagerRequest<REQUEST, RESPONSE>::groupId() const
 {
@@ -46,11 +46,24 @@ EncodingType::Enum SchemaEventBuilderUtil::bestEncodingSupported(
         return EncodingType::e_BER;  // RETURN
     }
 
-    // If remote supports BER, return BER
-    if (bsl::find(encodingsSupported.cbegin(),
+    const bool supportsBer =
+        bsl::find(encodingsSupported.cbegin(),
                   encodingsSupported.cend(),
                   bsl::string(EncodingFeature::k_ENCODING_BER)) !=
-        encodingsSupported.cend()) {
+        encodingsSupported.cend();
+
+    // If remote supports both the compact encoding and BER (used for the
+    // messages having no compact encoding), return COMPACT
+    if (supportsBer &&
+        bsl::find(encodingsSupported.cbegin(),
+                  encodingsSupported.cend(),
+                  bsl::string(EncodingFeature::k_ENCODING_COMPACT)) !=
+            encodingsSupported.cend()) {
+        return EncodingType::e_COMPACT;  // RETURN
+    }
+
+    // Else if remote supports BER, return BER
+    if (supportsBer) {
         return EncodingType::e_BER;  // RETURN
     }
 
@@ -25,7 +25,9 @@
 // 'bmqp_ctrlmsg' message into a properly formatted bmqp::Event blob.  Messages
 // are encoded using one of the encodings in 'bmqp::EncodingType::Enum. Schema
 // Event messages are used to send infrequent messages between a BlazingMQ
-// client and the broker, or between brokers.
+// client and the broker, or between brokers.  When the builder's encoding is
+// 'e_COMPACT', messages having no compact encoding (see
+// 'bmqp_compactcodecutil') are encoded in BER instead.
 //
 /// Padding
 ///-------
@@ -65,6 +67,7 @@
 
 // BMQ
 #include <bmqp_blobpoolutil.h>
+#include <bmqp_compactcodecutil.h>
 #include <bmqp_protocol.h>
 #include <bmqp_protocolutil.h>
 #include <bmqu_memoutstream.h>
@@ -245,17 +248,26 @@ int SchemaEventBuilder::setMessage(const TYPE& message, EventType::Enum type)
     EventHeader* eventHeader = new (d_blob_sp->buffer(0).data())
         EventHeader(type);
 
+    // Messages which have no compact encoding are encoded in BER, which is
+    // supported by any peer supporting the compact encoding.
+    EncodingType::Enum encodingType = d_encodingType;
+    if (encodingType == EncodingType::e_COMPACT &&
+        (type != EventType::e_CONTROL ||
+         !CompactCodecUtil::isSupported(message))) {
+        encodingType = EncodingType::e_BER;
+    }
+
     // Specify the encoding type in the EventHeader for control or
     // authentication messages
     if (type == EventType::e_CONTROL || type == EventType::e_AUTHENTICATION) {
-        EventHeaderUtil::setEncodingType(eventHeader, d_encodingType);
+        EventHeaderUtil::setEncodingType(eventHeader, encodingType);
     }
 
     // Append appropriate encoding of 'message' to the blob
     int rc = ProtocolUtil::encodeMessage(d_errorStream,
                                          d_blob_sp.get(),
                                          message,
-                                         d_encodingType,
+                                         encodingType,
                                          d_allocator_p);
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_errorStream.isEmpty())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
@@ -70,7 +70,8 @@ static void test1_breathingTest()
                       L_,
                       bmqp::EncodingType::e_BER,
                   },
-                  {L_, bmqp::EncodingType::e_JSON}};
+                  {L_, bmqp::EncodingType::e_JSON},
+                  {L_, bmqp::EncodingType::e_COMPACT}};
 
     const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
 
@@ -258,6 +259,114 @@ static void test2_bestEncodingSupported()
             bmqp::EncodingType::e_BER,
             bmqp::SchemaEventBuilderUtil::bestEncodingSupported(features));
     }
+
+    PV("Remote feature set supports the compact encoding");
+    {
+        bsl::string features(bmqtst::TestHelperUtil::allocator());
+        features.append(bmqp::EncodingFeature::k_FIELD_NAME)
+            .append(":")
+            .append(bmqp::EncodingFeature::k_ENCODING_BER)
+            .append(",")
+            .append(bmqp::EncodingFeature::k_ENCODING_JSON)
+            .append(",")
+            .append(bmqp::EncodingFeature::k_ENCODING_COMPACT);
+
+        BMQTST_ASSERT_EQ(
+            bmqp::EncodingType::e_COMPACT,
+            bmqp::SchemaEventBuilderUtil::bestEncodingSupported(features));
+
+        // The compact encoding requires BER, used for the messages having no
+        // compact encoding
+        bsl::string compactOnly(bmqtst::TestHelperUtil::allocator());
+        compactOnly.append(bmqp::EncodingFeature::k_FIELD_NAME)
+            .append(":")
+            .append(bmqp::EncodingFeature::k_ENCODING_JSON)
+            .append(",")
+            .append(bmqp::EncodingFeature::k_ENCODING_COMPACT);
+
+        BMQTST_ASSERT_EQ(
+            bmqp::EncodingType::e_JSON,
+            bmqp::SchemaEventBuilderUtil::bestEncodingSupported(compactOnly));
+    }
+}
+
+static void test3_compactEncodingFallback()
+// --------------------------------------------------------------------
+// COMPACT ENCODING FALLBACK
+//
+// Concerns:
+//   A builder using the compact encoding encodes the messages having a
+//   compact encoding in compact, and falls back to BER for the other
+//   ones, setting the encoding type of the event accordingly.
+//
+// Testing:
+//   setMessage
+// --------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COMPACT ENCODING FALLBACK");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+
+    bmqp::SchemaEventBuilder obj(blobSpPool.get(),
+                                 bmqp::EncodingType::e_COMPACT,
+                                 bmqtst::TestHelperUtil::allocator());
+
+    struct Test {
+        int                      d_line;
+        int                      d_selectionId;
+        bmqp::EncodingType::Enum d_expectedEncodingType;
+    } k_DATA[] = {
+        {L_,
+         bmqp_ctrlmsg::ControlMessageChoice::SELECTION_ID_STATUS,
+         bmqp::EncodingType::e_COMPACT},
+        {L_,
+         bmqp_ctrlmsg::ControlMessageChoice::SELECTION_ID_CONFIGURE_STREAM,
+         bmqp::EncodingType::e_COMPACT},
+        {L_,
+         bmqp_ctrlmsg::ControlMessageChoice::SELECTION_ID_OPEN_QUEUE,
+         bmqp::EncodingType::e_BER},
+        {L_,
+         bmqp_ctrlmsg::ControlMessageChoice::SELECTION_ID_DISCONNECT,
+         bmqp::EncodingType::e_BER}};
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const Test& test = k_DATA[idx];
+        PVV(test.d_line << ": Testing selection " << test.d_selectionId);
+
+        bmqp_ctrlmsg::ControlMessage message(
+            bmqtst::TestHelperUtil::allocator());
+        message.rId().makeValue(static_cast<int>(idx));
+        message.choice().makeSelection(test.d_selectionId);
+
+        obj.reset();
+        int rc = obj.setMessage(message, bmqp::EventType::e_CONTROL);
+        BMQTST_ASSERT_EQ_D(test.d_line, rc, 0);
+
+        const bmqp::EventHeader& header =
+            *reinterpret_cast<const bmqp::EventHeader*>(
+                obj.blob()->buffer(0).data());
+        BMQTST_ASSERT_EQ_D(test.d_line,
+                           bmqp::EventHeaderUtil::encodingType(header),
+                           test.d_expectedEncodingType);
+
+        bmqp::Event event(obj.blob().get(),
+                          bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ_D(test.d_line, event.isValid(), true);
+
+        bmqp_ctrlmsg::ControlMessage decoded(
+            bmqtst::TestHelperUtil::allocator());
+        rc = event.loadControlEvent(&decoded);
+        BMQTST_ASSERT_EQ_D(test.d_line, rc, 0);
+        BMQTST_ASSERT_EQ_D(test.d_line, decoded, message);
+    }
 }
 
 static void testN1_decodeFromFile()
@@ -588,6 +697,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 3: test3_compactEncodingFallback(); break;
     case 2: test2_bestEncodingSupported(); break;
     case 1: test1_breathingTest(); break;
     case -1: testN1_decodeFromFile(); break;
@@ -0,0 +1,130 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqp_sizeclassblobbufferfactory.h>
+
+#include <bmqscm_version.h>
+
+#include <bmqu_memoutstream.h>
+
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_string.h>
+#include <bslma_default.h>
+
+namespace BloombergLP {
+namespace bmqp {
+
+// --------------------------------
+// class SizeClassBlobBufferFactory
+// --------------------------------
+
+// CONSTANTS
+const int SizeClassBlobBufferFactory::k_MIN_BUFFER_SIZE;
+const int SizeClassBlobBufferFactory::k_MAX_BUFFER_SIZE;
+
+// PRIVATE MANIPULATORS
+void SizeClassBlobBufferFactory::initialize(
+    int                         defaultBufferSize,
+    bsls::BlockGrowth::Strategy growthStrategy,
+    bslma::Allocator*           allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 < defaultBufferSize);
+
+    // Size classes are the powers of four in the range, and the default size.
+    bsl::vector<int> sizes(allocator);
+    for (int size = k_MIN_BUFFER_SIZE; size <= k_MAX_BUFFER_SIZE; size *= 4) {
+        sizes.push_back(size);
+    }
+
+    bsl::vector<int>::iterator it = bsl::lower_bound(sizes.begin(),
+                                                     sizes.end(),
+                                                     defaultBufferSize);
+    if (it == sizes.end() || *it != defaultBufferSize) {
+        sizes.insert(it, defaultBufferSize);
+    }
+
+    d_factories.reserve(sizes.size());
+    for (bsl::size_t i = 0; i < sizes.size(); ++i) {
+        bmqu::MemOutStream name(allocator);
+        name << "BufferSize" << sizes[i];
+
+        FactorySp factory(
+            new (*allocator) bdlbb::PooledBlobBufferFactory(
+                sizes[i],
+                growthStrategy,
+                d_allocators.get(bsl::string(name.str(), allocator))),
+            allocator);
+        d_factories.push_back(factory);
+
+        if (sizes[i] == defaultBufferSize) {
+            d_defaultFactory_p = d_factories.back().get();
+        }
+    }
+
+    BSLS_ASSERT_SAFE(d_defaultFactory_p);
+}
+
+// CREATORS
+SizeClassBlobBufferFactory::SizeClassBlobBufferFactory(
+    int               defaultBufferSize,
+    bslma::Allocator* allocator)
+: d_allocators(bslma::Default::allocator(allocator))
+, d_factories(bslma::Default::allocator(allocator))
+, d_defaultFactory_p(0)
+{
+    initialize(defaultBufferSize,
+               bsls::BlockGrowth::BSLS_GEOMETRIC,
+               bslma::Default::allocator(allocator));
+}
+
+SizeClassBlobBufferFactory::SizeClassBlobBufferFactory(
+    int                         defaultBufferSize,
+    bsls::BlockGrowth::Strategy growthStrategy,
+    bslma::Allocator*           allocator)
+: d_allocators(bslma::Default::allocator(allocator))
+, d_factories(bslma::Default::allocator(allocator))
+, d_defaultFactory_p(0)
+{
+    initialize(defaultBufferSize,
+               growthStrategy,
+               bslma::Default::allocator(allocator));
+}
+
+SizeClassBlobBufferFactory::~SizeClassBlobBufferFactory()
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+void SizeClassBlobBufferFactory::allocate(bdlbb::BlobBuffer* buffer)
+{
+    d_defaultFactory_p->allocate(buffer);
+}
+
+bdlbb::BlobBufferFactory* SizeClassBlobBufferFactory::factory(int bufferSize)
+{
+    for (bsl::size_t i = 0; i < d_factories.size(); ++i) {
+        if (bufferSize <= d_factories[i]->bufferSize()) {
+            return d_factories[i].get();  // RETURN
+        }
+    }
+
+    return d_factories.back().get();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,198 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BMQP_SIZECLASSBLOBBUFFERFACTORY
+#define INCLUDED_BMQP_SIZECLASSBLOBBUFFERFACTORY
+
+//@PURPOSE: Provide a blob buffer factory dispensing several buffer sizes.
+//
+//@CLASSES:
+//  bmqp::SizeClassBlobBufferFactory: pooled factory of size-classed buffers
+//
+//@SEE_ALSO: bmqp::BlobPoolUtil
+//
+//@DESCRIPTION: 'bmqp::SizeClassBlobBufferFactory' is a
+// 'bdlbb::BlobBufferFactory' maintaining one pool of blob buffers per size
+// class.  The size classes are the powers of four from 'k_MIN_BUFFER_SIZE' to
+// 'k_MAX_BUFFER_SIZE', along with the default buffer size specified at
+// construction.  The 'allocate' method of the factory dispenses buffers of the
+// default size, while 'factory' returns the factory of the smallest size class
+// fitting a given size, so that blobs known to hold small messages (e.g.,
+// control messages) do not hold buffers sized for large payloads.  Note that
+// 'bmqp::BlobPoolUtil::createBlobPool' selects the size class of the blobs it
+// creates when provided with a 'bmqp::SizeClassBlobBufferFactory'.
+//
+// The memory of each size class is allocated from a separate
+// 'bmqma::CountingAllocator' (when the allocator provided at construction is
+// a 'bmqma::CountingAllocator'), so that the memory used by each size class
+// is reported in the allocator statistics.
+//
+/// Thread Safety
+///-------------
+// Thread safe.  Each size class is a 'bdlbb::PooledBlobBufferFactory', whose
+// allocation and deallocation do not lock once the pool is warmed up.
+//
+/// Usage
+///-----
+//..
+//  bmqp::SizeClassBlobBufferFactory factory(4 * 1024, allocator);
+//
+//  // Blobs of 'blob1' are 4 KiB buffers, the default size class.
+//  bdlbb::Blob blob1(&factory, allocator);
+//
+//  // Blobs of 'blob2' are 256 bytes buffers.
+//  bdlbb::Blob blob2(factory.factory(200), allocator);
+//..
+
+// BMQ
+#include <bmqma_countingallocatorstore.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bsls_assert.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_keyword.h>
+
+namespace BloombergLP {
+namespace bmqp {
+
+// ================================
+// class SizeClassBlobBufferFactory
+// ================================
+
+/// Blob buffer factory maintaining one pool of buffers per size class.
+class SizeClassBlobBufferFactory : public bdlbb::BlobBufferFactory {
+  public:
+    // CONSTANTS
+
+    /// Size of the buffers of the smallest size class.
+    static const int k_MIN_BUFFER_SIZE = 256;
+
+    /// Size of the buffers of the largest power-of-four size class.
+    static const int k_MAX_BUFFER_SIZE = 1024 * 1024;
+
+  private:
+    // PRIVATE TYPES
+    typedef bsl::shared_ptr<bdlbb::PooledBlobBufferFactory> FactorySp;
+
+    // DATA
+
+    /// Allocators of the size classes.
+    bmqma::CountingAllocatorStore d_allocators;
+
+    /// Factories of the size classes, in increasing order of buffer size.
+    bsl::vector<FactorySp> d_factories;
+
+    /// Factory of the default size class.
+    bdlbb::PooledBlobBufferFactory* d_defaultFactory_p;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Create the size classes of this factory, the default one having the
+    /// specified `defaultBufferSize`, using the specified `growthStrategy`
+    /// for their pools and the specified `allocator`.
+    void initialize(int                         defaultBufferSize,
+                    bsls::BlockGrowth::Strategy growthStrategy,
+                    bslma::Allocator*           allocator);
+
+  private:
+    // NOT IMPLEMENTED
+    SizeClassBlobBufferFactory(const SizeClassBlobBufferFactory&)
+        BSLS_KEYWORD_DELETED;
+    SizeClassBlobBufferFactory&
+    operator=(const SizeClassBlobBufferFactory&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // CREATORS
+
+    /// Create a factory dispensing by default buffers of the specified
+    /// `defaultBufferSize`, using the optionally specified `allocator`.
+    /// The behavior is undefined unless `0 < defaultBufferSize`.
+    explicit SizeClassBlobBufferFactory(int               defaultBufferSize,
+                                        bslma::Allocator* allocator = 0);
+
+    /// Create a factory dispensing by default buffers of the specified
+    /// `defaultBufferSize`, using the specified `growthStrategy` for the
+    /// pools of buffers and the optionally specified `allocator`.  The
+    /// behavior is undefined unless `0 < defaultBufferSize`.
+    SizeClassBlobBufferFactory(int                         defaultBufferSize,
+                               bsls::BlockGrowth::Strategy growthStrategy,
+                               bslma::Allocator*           allocator = 0);
+
+    /// Destroy this object.  The behavior is undefined unless all the
+    /// buffers dispensed by this factory have been released.
+    ~SizeClassBlobBufferFactory() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Allocate into the specified `buffer` a buffer of the default size
+    /// class.
+    void allocate(bdlbb::BlobBuffer* buffer) BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the factory of the smallest size class whose buffers are at
+    /// least as large as the specified `bufferSize`, or the factory of the
+    /// largest size class if no size class is large enough.
+    bdlbb::BlobBufferFactory* factory(int bufferSize);
+
+    // ACCESSORS
+
+    /// Return the size of the buffers of the default size class.
+    int defaultBufferSize() const;
+
+    /// Return the number of size classes of this factory.
+    int numSizeClasses() const;
+
+    /// Return the size of the buffers of the size class at the specified
+    /// `index`.  The behavior is undefined unless
+    /// `0 <= index < numSizeClasses()`.
+    int bufferSize(int index) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// --------------------------------
+// class SizeClassBlobBufferFactory
+// --------------------------------
+
+// ACCESSORS
+inline int SizeClassBlobBufferFactory::defaultBufferSize() const
+{
+    return d_defaultFactory_p->bufferSize();
+}
+
+inline int SizeClassBlobBufferFactory::numSizeClasses() const
+{
+    return static_cast<int>(d_factories.size());
+}
+
+inline int SizeClassBlobBufferFactory::bufferSize(int index) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= index && index < numSizeClasses());
+
+    return d_factories[index]->bufferSize();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,241 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqp_sizeclassblobbufferfactory.h>
+
+// BMQ
+#include <bmqp_blobpoolutil.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_memory.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   - The size classes are in increasing order, span the powers of four
+//     from 'k_MIN_BUFFER_SIZE' to 'k_MAX_BUFFER_SIZE' and include the
+//     default buffer size.
+//   - 'allocate' dispenses buffers of the default size.
+//
+// Testing:
+//   SizeClassBlobBufferFactory
+//   allocate
+//   defaultBufferSize
+//   numSizeClasses
+//   bufferSize
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    typedef bmqp::SizeClassBlobBufferFactory Obj;
+
+    const struct TestData {
+        int d_line;
+        int d_defaultBufferSize;
+        int d_expectedNumSizeClasses;
+    } k_DATA[] = {
+        {L_, 100, 7 + 1},
+        {L_, Obj::k_MIN_BUFFER_SIZE, 7},
+        {L_, 4 * 1024, 7},
+        {L_, 5 * 1024, 7 + 1},
+        {L_, Obj::k_MAX_BUFFER_SIZE, 7},
+        {L_, 2 * Obj::k_MAX_BUFFER_SIZE, 7 + 1},
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const TestData& test = k_DATA[idx];
+
+        PVV(test.d_line << ": default buffer size "
+                        << test.d_defaultBufferSize);
+
+        Obj obj(test.d_defaultBufferSize, bmqtst::TestHelperUtil::allocator());
+
+        BMQTST_ASSERT_EQ_D(test.d_line,
+                           test.d_defaultBufferSize,
+                           obj.defaultBufferSize());
+        BMQTST_ASSERT_EQ_D(test.d_line,
+                           test.d_expectedNumSizeClasses,
+                           obj.numSizeClasses());
+
+        bool hasDefault = false;
+        for (int i = 0; i < obj.numSizeClasses(); ++i) {
+            if (i != 0) {
+                BMQTST_ASSERT_LT_D(test.d_line,
+                                   obj.bufferSize(i - 1),
+                                   obj.bufferSize(i));
+            }
+            hasDefault |= obj.bufferSize(i) == test.d_defaultBufferSize;
+        }
+        BMQTST_ASSERT_D(test.d_line, hasDefault);
+
+        bdlbb::BlobBuffer buffer;
+        obj.allocate(&buffer);
+        BMQTST_ASSERT_EQ_D(test.d_line,
+                           test.d_defaultBufferSize,
+                           buffer.size());
+    }
+}
+
+static void test2_factory()
+// ------------------------------------------------------------------------
+// FACTORY
+//
+// Concerns:
+//   'factory' returns the factory of the smallest size class fitting the
+//   requested size, or of the largest size class.
+//
+// Testing:
+//   factory
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("FACTORY");
+
+    typedef bmqp::SizeClassBlobBufferFactory Obj;
+
+    Obj obj(5 * 1024, bmqtst::TestHelperUtil::allocator());
+
+    const struct TestData {
+        int d_line;
+        int d_size;
+        int d_expectedBufferSize;
+    } k_DATA[] = {
+        {L_, 0, Obj::k_MIN_BUFFER_SIZE},
+        {L_, 1, Obj::k_MIN_BUFFER_SIZE},
+        {L_, Obj::k_MIN_BUFFER_SIZE, Obj::k_MIN_BUFFER_SIZE},
+        {L_, Obj::k_MIN_BUFFER_SIZE + 1, 1024},
+        {L_, 4 * 1024, 4 * 1024},
+        {L_, 4 * 1024 + 1, 5 * 1024},
+        {L_, 5 * 1024 + 1, 16 * 1024},
+        {L_, Obj::k_MAX_BUFFER_SIZE, Obj::k_MAX_BUFFER_SIZE},
+        {L_, Obj::k_MAX_BUFFER_SIZE + 1, Obj::k_MAX_BUFFER_SIZE},
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const TestData& test = k_DATA[idx];
+
+        bdlbb::BlobBuffer buffer;
+        obj.factory(test.d_size)->allocate(&buffer);
+
+        BMQTST_ASSERT_EQ_D(test.d_line,
+                           test.d_expectedBufferSize,
+                           buffer.size());
+    }
+}
+
+static void test3_blobPoolUtil()
+// ------------------------------------------------------------------------
+// BLOB POOL UTIL
+//
+// Concerns:
+//   'bmqp::BlobPoolUtil::createBlobPool' selects the size class of the
+//   blobs when provided with a 'bmqp::SizeClassBlobBufferFactory', and
+//   uses the provided factory otherwise.
+//
+// Testing:
+//   bmqp::BlobPoolUtil::createBlobPool
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BLOB POOL UTIL");
+
+    bmqp::SizeClassBlobBufferFactory sizeClassFactory(
+        4 * 1024,
+        bmqtst::TestHelperUtil::allocator());
+    bdlbb::PooledBlobBufferFactory pooledFactory(
+        4 * 1024,
+        bmqtst::TestHelperUtil::allocator());
+
+    {
+        PV("Size class factory");
+
+        bmqp::BlobPoolUtil::BlobSpPoolSp pool =
+            bmqp::BlobPoolUtil::createBlobPool(
+                &sizeClassFactory,
+                100,
+                bmqtst::TestHelperUtil::allocator());
+
+        bsl::shared_ptr<bdlbb::Blob> blob = pool->getObject();
+        blob->setLength(1);
+        BMQTST_ASSERT_EQ(bmqp::SizeClassBlobBufferFactory::k_MIN_BUFFER_SIZE,
+                         blob->buffer(0).size());
+    }
+
+    {
+        PV("Default size class");
+
+        bmqp::BlobPoolUtil::BlobSpPoolSp pool =
+            bmqp::BlobPoolUtil::createBlobPool(
+                &sizeClassFactory,
+                bmqtst::TestHelperUtil::allocator());
+
+        bsl::shared_ptr<bdlbb::Blob> blob = pool->getObject();
+        blob->setLength(1);
+        BMQTST_ASSERT_EQ(4 * 1024, blob->buffer(0).size());
+    }
+
+    {
+        PV("Other factory");
+
+        bmqp::BlobPoolUtil::BlobSpPoolSp pool =
+            bmqp::BlobPoolUtil::createBlobPool(
+                &pooledFactory,
+                100,
+                bmqtst::TestHelperUtil::allocator());
+
+        bsl::shared_ptr<bdlbb::Blob> blob = pool->getObject();
+        blob->setLength(1);
+        BMQTST_ASSERT_EQ(4 * 1024, blob->buffer(0).size());
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_blobPoolUtil(); break;
+    case 2: test2_factory(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -16,6 +16,10 @@
 #include <bmqpi_dttracer.h>
 
 #include <bmqscm_version.h>
+
+// BDE
+#include <bsla_annotations.h>
+
 namespace BloombergLP {
 namespace bmqpi {
 
@@ -28,5 +32,12 @@ DTTracer::~DTTracer()
     // NOTHING
 }
 
+int DTTracer::serializeSpan(
+    BSLA_MAYBE_UNUSED bsl::vector<unsigned char>* buffer,
+    BSLA_MAYBE_UNUSED const bsl::shared_ptr<DTSpan>& span) const
+{
+    return -1;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -31,6 +31,7 @@
 // BDE
 #include <bsl_memory.h>
 #include <bsl_string_view.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace bmqpi {
@@ -55,6 +56,16 @@ class DTTracer {
         const bsl::shared_ptr<DTSpan>& parent,
         const bsl::string_view&        operation,
         const DTSpan::Baggage&         baggage = DTSpan::Baggage()) const = 0;
+
+    /// Load into the specified `buffer` an opaque, tracer-specific
+    /// encoding of the context of the specified `span`, suitable for
+    /// propagation alongside a message to the broker.  Return 0 on success
+    /// and a non-zero value if the context of `span` should not be
+    /// propagated (e.g., because `span` was not sampled), in which case
+    /// `buffer` is left empty.  The behavior of the default implementation
+    /// is to return a non-zero value, i.e. not to propagate any context.
+    virtual int serializeSpan(bsl::vector<unsigned char>*    buffer,
+                              const bsl::shared_ptr<DTSpan>& span) const;
 };
 
 }  // close package namespace
@@ -20,6 +20,7 @@
 
 // BDE
 #include <bsl_string_view.h>
+#include <bsl_vector.h>
 #include <bsls_protocoltest.h>
 
 // TEST DRIVER
@@ -36,6 +37,13 @@ struct DTTracerTestImp : public bsls::ProtocolTestImp<bmqpi::DTTracer> {
         const bsl::shared_ptr<bmqpi::DTSpan>& parent,
         const bsl::string_view&               operation,
         const bmqpi::DTSpan::Baggage& baggage) const BSLS_KEYWORD_OVERRIDE;
+
+    int serializeSpan(bsl::vector<unsigned char>*,
+                      const bsl::shared_ptr<bmqpi::DTSpan>&) const
+        BSLS_KEYWORD_OVERRIDE
+    {
+        return markDone();
+    }
 };
 
 // Define one of DTTracerTestImp methods out-of-line, to instruct the
@@ -103,6 +111,7 @@ static void test1_breathingTest()
     PV("Verify that all methods are public and virtual");
     bmqpi::DTSpan::Baggage empty;
     BSLS_PROTOCOLTEST_ASSERT(tracer, createChildSpan(NULL, "", empty));
+    BSLS_PROTOCOLTEST_ASSERT(tracer, serializeSpan(NULL, NULL));
 }
 
 // ============================================================================
@@ -23,6 +23,16 @@
 /// @bbref{bmqpi::HostHealthMonitor} is a pure interface for a monitor of the
 /// health of the host. BlazingMQ sessions can use such objects to
 /// conditionally suspend queue activity while the host is marked unhealthy.
+///
+/// Host health is deliberately binary: a queue configured to suspend on bad
+/// health is either fully active or suspended, and the SDK never alters the
+/// consumer flow control options (e.g., `maxUnconfirmedMessages`) it was
+/// given by the application.  Applications wanting to shed load gradually
+/// can do so by reconfiguring their queues with smaller
+/// `maxUnconfirmedMessages` or `maxUnconfirmedBytes`, for instance in
+/// response to `bmqt::SessionEventType::e_SLOWCONSUMER_HIGHWATERMARK`
+/// events, and restore them on
+/// `bmqt::SessionEventType::e_SLOWCONSUMER_NORMAL`.
 
 // BMQ
 
@@ -192,7 +192,9 @@ void StatContext::datumDeleter(void* /*datum_vp*/, void* datumLock_vp)
 }
 
 // PRIVATE MANIPULATORS
-void StatContext::initValues(ValueVecPtr& vec, bsls::Types::Int64 initTime)
+void StatContext::initValues(ValueVecPtr&       vec,
+                             bsls::Types::Int64 initTime,
+                             bool               isDirect)
 {
     if (!d_valueDefs_p) {
         return;
@@ -204,7 +206,9 @@ void StatContext::initValues(ValueVecPtr& vec, bsls::Types::Int64 initTime)
     for (size_t vIdx = 0; vIdx < d_valueDefs_p->size(); ++vIdx) {
         (*newVec)[vIdx].init((*d_valueDefs_p)[vIdx].d_sizes,
                              (*d_valueDefs_p)[vIdx].d_type,
-                             initTime);
+                             initTime,
+                             (*d_valueDefs_p)[vIdx].d_hasHistogram,
+                             isDirect && (*d_valueDefs_p)[vIdx].d_isSharded);
     }
 
     vec.load(newVec, d_valueVecPool_p.get());
@@ -262,11 +266,19 @@ void StatContext::moveNewSubcontexts()
 {
     // Thread: snapshot
 
-    StatContextVector localNewSubcontexts(d_allocator_p);
+    if (!d_hasNewSubcontexts.loadAcquire()) {
+        // Most contexts have no new subcontext, don't contend on the lock
+        // nor touch the vectors.
+        return;  // RETURN
+    }
+
+    BSLS_ASSERT_SAFE(d_movedSubcontexts.empty());
     {
         bslmt::LockGuard<bslmt::Mutex> guard(&d_newSubcontextsLock);
-        localNewSubcontexts.swap(d_newSubcontexts);
+        d_movedSubcontexts.swap(d_newSubcontexts);
+        d_hasNewSubcontexts.storeRelaxed(false);
     }
+    StatContextVector& localNewSubcontexts = d_movedSubcontexts;
 
     bsl::vector<bmqstm::StatContextUpdate>* updates = 0;
     if (d_update_p) {
@@ -295,6 +307,8 @@ void StatContext::moveNewSubcontexts()
             context->initializeUpdate(context->d_update_p);
         }
     }
+
+    localNewSubcontexts.clear();
 }
 
 StatContext::ValueVec* StatContext::getTotalValuesVec()
@@ -525,6 +539,8 @@ StatContext::StatContext(const Config&     config,
 , d_subcontextsById(basicAllocator)
 , d_deletedSubcontexts(basicAllocator)
 , d_newSubcontexts(basicAllocator)
+, d_movedSubcontexts(basicAllocator)
+, d_hasNewSubcontexts(false)
 , d_newSubcontextsLock()
 , d_managedDatumLock(bsls::SpinLock::s_unlocked)
 , d_managedDatum(basicAllocator)
@@ -555,7 +571,7 @@ StatContext::StatContext(const Config&     config,
             }
         }
 
-        initValues(d_directValues_p, bsls::TimeUtil::getTimer());
+        initValues(d_directValues_p, bsls::TimeUtil::getTimer(), true);
     }
 
     if (config.d_update_p) {
@@ -606,7 +622,7 @@ bslma::ManagedPtr<StatContext> StatContext::addSubcontext(const Config& config)
         newContext->d_valueVecPool_p = d_valueVecPool_p;
 
         newContext->d_valueDefs_p = d_valueDefs_p;
-        newContext->initValues(newContext->d_directValues_p);
+        newContext->initValues(newContext->d_directValues_p, 0, true);
     }
     else {
         newConfig.d_statValueAllocator_p = d_statValueAllocator_p;
@@ -633,6 +649,7 @@ bslma::ManagedPtr<StatContext> StatContext::addSubcontext(const Config& config)
 
     bslmt::LockGuard<bslmt::Mutex> guard(&d_newSubcontextsLock);  // LOCK
     d_newSubcontexts.push_back(newContext);
+    d_hasNewSubcontexts.storeRelease(true);
 
     return ret;
 }
@@ -500,6 +500,7 @@
 #include <bslmf_allocatorargt.h>
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bslmt_mutex.h>
+#include <bsls_atomic.h>
 #include <bsls_spinlock.h>
 
 namespace BloombergLP {
@@ -557,6 +558,8 @@ class StatContext {
         bsl::string      d_name;
         bsl::vector<int> d_sizes;
         StatValue::Type  d_type;
+        bool             d_hasHistogram;
+        bool             d_isSharded;
 
         // TRAITS
         BSLMF_NESTED_TRAIT_DECLARATION(ValueDefinition,
@@ -567,6 +570,8 @@ class StatContext {
         : d_name(basicAllocator)
         , d_sizes(basicAllocator)
         , d_type(StatValue::e_CONTINUOUS)
+        , d_hasHistogram(false)
+        , d_isSharded(false)
         {
         }
 
@@ -575,6 +580,8 @@ class StatContext {
         : d_name(other.d_name, basicAllocator)
         , d_sizes(other.d_sizes, basicAllocator)
         , d_type(other.d_type)
+        , d_hasHistogram(other.d_hasHistogram)
+        , d_isSharded(other.d_isSharded)
         {
         }
     };
@@ -644,6 +651,14 @@ class StatContext {
 
     StatContextVector d_newSubcontexts;
 
+    // Subcontexts being moved into 'd_subcontexts', swapped with
+    // 'd_newSubcontexts' so that both keep their capacity across snapshots
+    StatContextVector d_movedSubcontexts;
+
+    // Whether 'd_newSubcontexts' is not empty, so that snapshots don't lock
+    // 'd_newSubcontextsLock' when no subcontext was added
+    bsls::AtomicBool d_hasNewSubcontexts;
+
     bslmt::Mutex d_newSubcontextsLock;
 
     mutable bsls::SpinLock d_managedDatumLock;
@@ -673,8 +688,12 @@ class StatContext {
 
     // PRIVATE MANIPULATORS
 
-    /// Initialize the specified `vec` using `d_valueDefs_p`
-    void initValues(ValueVecPtr& vec, bsls::Types::Int64 initTime = 0);
+    /// Initialize the specified `vec` using `d_valueDefs_p`.  Optionally
+    /// specify `isDirect` if `vec` holds the values updated directly by
+    /// the users of this context, which are the only ones to be sharded.
+    void initValues(ValueVecPtr&       vec,
+                    bsls::Types::Int64 initTime = 0,
+                    bool               isDirect = false);
 
     /// Delete everything in `d_deletedSubcontexts`
     void clearDeletedSubcontexts(bsl::vector<ValueVec*>* expiredValuesVec);
@@ -1007,6 +1026,22 @@ class StatContextConfiguration {
     /// size.
     StatContextConfiguration& valueLevel(int size);
 
+    /// Record the distribution of the values reported to the last added
+    /// value in a histogram, so that percentiles can be computed over its
+    /// first level snapshots (see `StatUtil::rangePercentile`).  Return
+    /// this object.  The behavior is undefined unless the last value was
+    /// added as a discrete value.
+    StatContextConfiguration& valueHistogram();
+
+    /// Accumulate the adjustments made to the last added value in per-thread
+    /// cells, folded into the value when the context is snapshotted, so
+    /// that threads concurrently adjusting it don't contend on the same
+    /// cache line.  The min and max of that value then only account for
+    /// its value at snapshot time, which is suited for counters.  Return
+    /// this object.  The behavior is undefined unless the last value was
+    /// added as a continuous value.
+    StatContextConfiguration& valueSharded();
+
     /// Set a callback to be invoked right before the `StatContext` is
     /// snapshotted.  Return this object.
     StatContextConfiguration& preSnapshotCallback(
@@ -1375,6 +1410,22 @@ inline StatContextConfiguration& StatContextConfiguration::valueLevel(int size)
     return *this;
 }
 
+inline StatContextConfiguration& StatContextConfiguration::valueHistogram()
+{
+    BSLS_ASSERT(!d_valueDefs.empty() &&
+                d_valueDefs.back().d_type == StatValue::e_DISCRETE);
+    d_valueDefs.back().d_hasHistogram = true;
+    return *this;
+}
+
+inline StatContextConfiguration& StatContextConfiguration::valueSharded()
+{
+    BSLS_ASSERT(!d_valueDefs.empty() &&
+                d_valueDefs.back().d_type == StatValue::e_CONTINUOUS);
+    d_valueDefs.back().d_isSharded = true;
+    return *this;
+}
+
 inline StatContextConfiguration& StatContextConfiguration::preSnapshotCallback(
     const StatContext::SnapshotCallback& preSnapshotCallback)
 {
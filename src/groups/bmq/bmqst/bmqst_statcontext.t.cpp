@@ -26,6 +26,7 @@
 
 // BDE
 #include <bdlb_bitutil.h>
+#include <bdlf_bind.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bsl_sstream.h>
@@ -33,6 +34,7 @@
 #include <bslma_default.h>
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
+#include <bslmt_threadgroup.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -56,6 +58,7 @@ using namespace bmqst;
 // [ 4] Usage example with value level
 // [ 4] Test updates
 // [ 5] Usage examples with updates
+// [ 9] Sharded values
 //-----------------------------------------------------------------------------
 
 //=============================================================================
@@ -1090,6 +1093,71 @@ static void testUserData(bslma::Allocator* allocator)
     ASSERT(NULL == ptr);
 }
 
+/// Adjust the value at the specified `index` of the specified `context`
+/// `1000` times by `2` and `500` times by `-1`.
+static void adjustShardedValue(StatContext* context, int index)
+{
+    for (int i = 0; i < 1000; ++i) {
+        context->adjustValue(index, 2);
+        if (i % 2) {
+            context->adjustValue(index, -1);
+        }
+    }
+}
+
+static void testShardedValue(bslma::Allocator* allocator)
+{
+    // ------------------------------------------------------------------------
+    // SHARDED VALUES
+    //
+    // Concerns:
+    //   Adjustments made concurrently to a sharded value are all accounted
+    //   for when snapshotting, and setting the value accounts for the
+    //   pending adjustments.
+    // ------------------------------------------------------------------------
+
+    enum { e_SHARDED = 0, e_PLAIN = 1 };
+    const int k_NUM_THREADS = 4;
+
+    StatContext context(StatContextConfiguration("test")
+                            .value("sharded")
+                            .valueSharded()
+                            .value("plain"),
+                        allocator);
+
+    ASSERT(direct(context, e_SHARDED).isSharded());
+    ASSERT(!direct(context, e_PLAIN).isSharded());
+
+    bslmt::ThreadGroup threads(allocator);
+    threads.addThreads(
+        bdlf::BindUtil::bind(&adjustShardedValue, &context, e_SHARDED),
+        k_NUM_THREADS);
+    threads.addThreads(
+        bdlf::BindUtil::bind(&adjustShardedValue, &context, e_PLAIN),
+        k_NUM_THREADS);
+    threads.joinAll();
+
+    context.snapshot();
+
+    // Extremes of a sharded value are only those seen when folding.
+    ASSERT(checkSnapshot(direct(context, e_SHARDED),
+                         0,
+                         0,
+                         "6000 0 6000 4000 2000"));
+    ASSERT_EQUALS(6000, direct(context, e_PLAIN).snapshot(0).value());
+    ASSERT_EQUALS(4000, direct(context, e_PLAIN).snapshot(0).increments());
+    ASSERT_EQUALS(2000, direct(context, e_PLAIN).snapshot(0).decrements());
+
+    context.adjustValue(e_SHARDED, 5);
+    context.setValue(e_SHARDED, 10);
+    context.snapshot();
+
+    ASSERT(checkSnapshot(direct(context, e_SHARDED),
+                         0,
+                         0,
+                         "10 10 6005 4001 2001"));
+}
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -1125,6 +1193,18 @@ int main(int argc, char** argv)
 
     switch (test) {
     case 0:  // Zero is always the leading case.
+    case 9: {
+        // --------------------------------------------------------------------
+        // SHARDED VALUES
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "SHARDED VALUES" << endl
+                 << "==============" << endl;
+        testShardedValue(&ta);
+    } break;
+
     case 8: {
         // --------------------------------------------------------------------
         // TEST USER DATA ABI COMPATIBILITY
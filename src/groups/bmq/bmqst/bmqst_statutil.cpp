@@ -17,6 +17,7 @@
 
 #include <bmqscm_version.h>
 #include <bsl_algorithm.h>
+#include <bsl_cmath.h>
 #include <bsl_limits.h>
 
 namespace BloombergLP {
@@ -422,5 +423,93 @@ double StatUtil::averagePerEventReal(
     }
 }
 
+bsls::Types::Int64
+StatUtil::rangePercentile(const StatValue&                   value,
+                          const StatValue::SnapshotLocation& firstSnapshot,
+                          const StatValue::SnapshotLocation& secondSnapshot,
+                          double                             percentile)
+{
+    BSLS_ASSERT(value.type() == StatValue::e_DISCRETE);
+    BSLS_ASSERT(value.hasHistogram());
+    BSLS_ASSERT(firstSnapshot.level() == 0 && secondSnapshot.level() == 0);
+    BSLS_ASSERT(0.0 <= percentile && percentile <= 100.0);
+
+    // Each snapshot holds the distribution of the values reported since the
+    // previous one, so merge the snapshots more recent than the oldest one
+    // of the range.
+    const int start = bsl::min(firstSnapshot.index(), secondSnapshot.index());
+    const int end   = bsl::max(firstSnapshot.index(), secondSnapshot.index());
+
+    bsls::Types::Int64 counts[StatValue_Histogram::k_NUM_BUCKETS] = {0};
+    bsls::Types::Int64 total = 0;
+    bsls::Types::Int64 min   = bsl::numeric_limits<bsls::Types::Int64>::max();
+    bsls::Types::Int64 max   = bsl::numeric_limits<bsls::Types::Int64>::min();
+    for (int i = start; i < end; ++i) {
+        const StatValue::SnapshotLocation   loc(0, i);
+        const StatValue::HistogramSnapshot& buckets =
+            value.histogramSnapshot(loc);
+        if (buckets.empty()) {
+            continue;  // CONTINUE
+        }
+
+        for (StatValue::HistogramSnapshot::const_iterator it =
+                 buckets.begin();
+             it != buckets.end();
+             ++it) {
+            counts[it->first] += it->second;
+            total += it->second;
+        }
+        min = bsl::min(min, value.snapshot(loc).min());
+        max = bsl::max(max, value.snapshot(loc).max());
+    }
+
+    if (total == 0) {
+        return bsl::numeric_limits<bsls::Types::Int64>::max();  // RETURN
+    }
+
+    // Rank (1-based) of the value corresponding to 'percentile'.
+    const bsls::Types::Int64 rank = bsl::max(
+        static_cast<bsls::Types::Int64>(1),
+        static_cast<bsls::Types::Int64>(
+            bsl::ceil(percentile / 100.0 * static_cast<double>(total))));
+
+    bsls::Types::Int64 seen  = 0;
+    int                index = 0;
+    for (; index < StatValue_Histogram::k_NUM_BUCKETS - 1; ++index) {
+        seen += counts[index];
+        if (seen >= rank) {
+            break;  // BREAK
+        }
+    }
+
+    // The exact extremes are known, so don't report a value out of them.
+    return bsl::min(max,
+                    bsl::max(min, StatValue_Histogram::bucketValue(index)));
+}
+
+bsls::Types::Int64
+StatUtil::rangeP50(const StatValue&                   value,
+                   const StatValue::SnapshotLocation& firstSnapshot,
+                   const StatValue::SnapshotLocation& secondSnapshot)
+{
+    return rangePercentile(value, firstSnapshot, secondSnapshot, 50.0);
+}
+
+bsls::Types::Int64
+StatUtil::rangeP99(const StatValue&                   value,
+                   const StatValue::SnapshotLocation& firstSnapshot,
+                   const StatValue::SnapshotLocation& secondSnapshot)
+{
+    return rangePercentile(value, firstSnapshot, secondSnapshot, 99.0);
+}
+
+bsls::Types::Int64
+StatUtil::rangeP999(const StatValue&                   value,
+                    const StatValue::SnapshotLocation& firstSnapshot,
+                    const StatValue::SnapshotLocation& secondSnapshot)
+{
+    return rangePercentile(value, firstSnapshot, secondSnapshot, 99.9);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
@@ -256,6 +256,35 @@ struct StatUtil {
     averagePerEventReal(const StatValue&                   value,
                         const StatValue::SnapshotLocation& firstSnapshot,
                         const StatValue::SnapshotLocation& secondSnapshot);
+
+    /// Return an approximation of the specified `percentile` (in the range
+    /// `[0, 100]`) of the values reported to the specified `value` between
+    /// the specified `firstSnapshot` and the specified `secondSnapshot`,
+    /// i.e. of the same events as `eventsDifference`.  If nothing was
+    /// reported, the maximum Int64 is returned.  The behavior is undefined
+    /// unless `value.hasHistogram()` and both snapshots are at level 0.
+    static bsls::Types::Int64
+    rangePercentile(const StatValue&                   value,
+                    const StatValue::SnapshotLocation& firstSnapshot,
+                    const StatValue::SnapshotLocation& secondSnapshot,
+                    double                             percentile);
+
+    /// Return an approximation of respectively the 50th, 99th and 99.9th
+    /// percentile of the values reported to the specified `value` between
+    /// the specified `firstSnapshot` and the specified `secondSnapshot`, as
+    /// returned by `rangePercentile`.
+    static bsls::Types::Int64
+    rangeP50(const StatValue&                   value,
+             const StatValue::SnapshotLocation& firstSnapshot,
+             const StatValue::SnapshotLocation& secondSnapshot);
+    static bsls::Types::Int64
+    rangeP99(const StatValue&                   value,
+             const StatValue::SnapshotLocation& firstSnapshot,
+             const StatValue::SnapshotLocation& secondSnapshot);
+    static bsls::Types::Int64
+    rangeP999(const StatValue&                   value,
+              const StatValue::SnapshotLocation& firstSnapshot,
+              const StatValue::SnapshotLocation& secondSnapshot);
 };
 
 }  // close package namespace
@@ -21,6 +21,7 @@
 
 #include <bmqstm_values.h>
 #include <bsl_ostream.h>
+#include <bslma_default.h>
 
 namespace BloombergLP {
 namespace bmqst {
@@ -32,11 +33,122 @@ bsls::Types::Int64 MIN_INT = bsl::numeric_limits<bsls::Types::Int64>::min();
 
 }  // close anonymous namespace
 
+// -------------------------
+// class StatValue_Histogram
+// -------------------------
+
+// CREATORS
+StatValue_Histogram::StatValue_Histogram()
+{
+    // NOTHING: 'd_counts' are zero-initialized
+}
+
+// MANIPULATORS
+void StatValue_Histogram::add(const Buckets& buckets)
+{
+    for (Buckets::const_iterator it = buckets.begin(); it != buckets.end();
+         ++it) {
+        d_counts[it->first].addRelaxed(it->second);
+    }
+}
+
+void StatValue_Histogram::takeCounts(Buckets* buckets)
+{
+    buckets->clear();
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        // Only pay for the atomic read-modify-write on non-empty buckets.
+        if (d_counts[i].loadRelaxed() != 0) {
+            buckets->push_back(bsl::make_pair(i, d_counts[i].swap(0)));
+        }
+    }
+}
+
+void StatValue_Histogram::reset()
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_counts[i].storeRelaxed(0);
+    }
+}
+
+void StatValue_Histogram::copyCounts(const StatValue_Histogram& other)
+{
+    for (int i = 0; i < k_NUM_BUCKETS; ++i) {
+        d_counts[i].storeRelaxed(other.d_counts[i].loadRelaxed());
+    }
+}
+
+// ----------------------
+// class StatValue_Shards
+// ----------------------
+
+// CREATORS
+StatValue_Shards::StatValue_Shards()
+{
+    // NOTHING: 'd_cells' are zero-initialized
+}
+
+// MANIPULATORS
+StatValue_Shards::Totals StatValue_Shards::take()
+{
+    Totals totals = {0, 0, 0};
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        Cell& cell = d_cells[i];
+
+        // Only pay for the atomic read-modify-write on adjusted cells.
+        if (cell.d_increments.loadRelaxed() == 0 &&
+            cell.d_decrements.loadRelaxed() == 0) {
+            continue;  // CONTINUE
+        }
+
+        totals.d_delta += cell.d_delta.swap(0);
+        totals.d_increments += cell.d_increments.swap(0);
+        totals.d_decrements += cell.d_decrements.swap(0);
+    }
+
+    return totals;
+}
+
+void StatValue_Shards::reset()
+{
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        d_cells[i].d_delta.storeRelaxed(0);
+        d_cells[i].d_increments.storeRelaxed(0);
+        d_cells[i].d_decrements.storeRelaxed(0);
+    }
+}
+
+// ACCESSORS
+StatValue_Shards::Totals StatValue_Shards::pending() const
+{
+    Totals totals = {0, 0, 0};
+    for (int i = 0; i < k_NUM_SHARDS; ++i) {
+        totals.d_delta += d_cells[i].d_delta.loadRelaxed();
+        totals.d_increments += d_cells[i].d_increments.loadRelaxed();
+        totals.d_decrements += d_cells[i].d_decrements.loadRelaxed();
+    }
+
+    return totals;
+}
+
 // ---------------
 // class StatValue
 // ---------------
 
 // PRIVATE MANIPULATORS
+void StatValue::foldShards()
+{
+    BSLS_ASSERT(d_shards_mp);
+
+    const StatValue_Shards::Totals totals = d_shards_mp->take();
+    if (totals.d_increments == 0 && totals.d_decrements == 0) {
+        return;  // RETURN
+    }
+
+    updateMinMax(d_currentStats.d_value += totals.d_delta);
+    d_currentStats.d_incrementsOrEvents += totals.d_increments;
+    d_currentStats.d_decrementsOrSum += totals.d_decrements;
+}
+
 void StatValue::aggregateLevel(int level, bsls::Types::Int64 snapshotTime)
 {
     if (level + 1 >= static_cast<int>(d_levelStartIndices.size()) - 1) {
@@ -85,6 +197,10 @@ StatValue::StatValue(bslma::Allocator* basicAllocator)
 , d_curSnapshotIndices(basicAllocator)
 , d_min(0)
 , d_max(0)
+, d_histogram_mp()
+, d_histogramHistory(basicAllocator)
+, d_shards_mp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
 }
 
@@ -99,10 +215,34 @@ StatValue::StatValue(const bsl::vector<int>& sizes,
 , d_curSnapshotIndices(basicAllocator)
 , d_min(0)
 , d_max(0)
+, d_histogram_mp()
+, d_histogramHistory(basicAllocator)
+, d_shards_mp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     init(sizes, type, initTime);
 }
 
+StatValue::StatValue(const bsl::vector<int>& sizes,
+                     Type                    type,
+                     bsls::Types::Int64      initTime,
+                     bool                    hasHistogram,
+                     bslma::Allocator*       basicAllocator)
+: d_type(type)
+, d_currentStats()
+, d_history(basicAllocator)
+, d_levelStartIndices(basicAllocator)
+, d_curSnapshotIndices(basicAllocator)
+, d_min(0)
+, d_max(0)
+, d_histogram_mp()
+, d_histogramHistory(basicAllocator)
+, d_shards_mp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    init(sizes, type, initTime, hasHistogram);
+}
+
 StatValue::StatValue(const StatValue& other, bslma::Allocator* basicAllocator)
 : d_type(other.d_type)
 , d_currentStats(other.d_currentStats)
@@ -111,7 +251,27 @@ StatValue::StatValue(const StatValue& other, bslma::Allocator* basicAllocator)
 , d_curSnapshotIndices(other.d_curSnapshotIndices, basicAllocator)
 , d_min(other.d_min)
 , d_max(other.d_max)
+, d_histogram_mp()
+, d_histogramHistory(other.d_histogramHistory, basicAllocator)
+, d_shards_mp()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
+    if (other.d_histogram_mp) {
+        d_histogram_mp.load(new (*d_allocator_p) StatValue_Histogram(),
+                            d_allocator_p);
+        d_histogram_mp->copyCounts(*other.d_histogram_mp);
+    }
+
+    if (other.d_shards_mp) {
+        d_shards_mp.load(new (*d_allocator_p) StatValue_Shards(),
+                         d_allocator_p);
+
+        // Account for the adjustments 'other' did not fold yet.
+        const StatValue_Shards::Totals totals = other.d_shards_mp->pending();
+        d_currentStats.d_value += totals.d_delta;
+        d_currentStats.d_incrementsOrEvents += totals.d_increments;
+        d_currentStats.d_decrementsOrSum += totals.d_decrements;
+    }
 }
 
 // MANIPULATORS
@@ -123,6 +283,35 @@ StatValue& StatValue::operator=(const StatValue& rhs)
     d_curSnapshotIndices = rhs.d_curSnapshotIndices;
     d_min                = rhs.d_min;
     d_max                = rhs.d_max;
+    d_histogramHistory   = rhs.d_histogramHistory;
+
+    if (!rhs.d_histogram_mp) {
+        d_histogram_mp.reset();
+    }
+    else {
+        if (!d_histogram_mp) {
+            d_histogram_mp.load(new (*d_allocator_p) StatValue_Histogram(),
+                                d_allocator_p);
+        }
+        d_histogram_mp->copyCounts(*rhs.d_histogram_mp);
+    }
+
+    if (!rhs.d_shards_mp) {
+        d_shards_mp.reset();
+    }
+    else {
+        if (!d_shards_mp) {
+            d_shards_mp.load(new (*d_allocator_p) StatValue_Shards(),
+                             d_allocator_p);
+        }
+        d_shards_mp->reset();
+
+        // Account for the adjustments 'rhs' did not fold yet.
+        const StatValue_Shards::Totals totals = rhs.d_shards_mp->pending();
+        d_currentStats.d_value += totals.d_delta;
+        d_currentStats.d_incrementsOrEvents += totals.d_increments;
+        d_currentStats.d_decrementsOrSum += totals.d_decrements;
+    }
 
     return *this;
 }
@@ -134,10 +323,16 @@ void StatValue::addSnapshot(const StatValue& other)
     const Snapshot& otherSnapshot =
         other.d_history[other.d_curSnapshotIndices[0]];
 
+    // This is not thread-safe, so there is no need for atomic
+    // read-modify-writes: aggregating thousands of values each snapshot
+    // would otherwise pay for as many bus locks.
     if (d_type == e_CONTINUOUS) {
-        d_currentStats.d_value += otherSnapshot.d_value;
-        d_currentStats.d_min += otherSnapshot.d_min;
-        d_currentStats.d_max += otherSnapshot.d_max;
+        d_currentStats.d_value.storeRelaxed(
+            d_currentStats.d_value.loadRelaxed() + otherSnapshot.d_value);
+        d_currentStats.d_min.storeRelaxed(d_currentStats.d_min.loadRelaxed() +
+                                          otherSnapshot.d_min);
+        d_currentStats.d_max.storeRelaxed(d_currentStats.d_max.loadRelaxed() +
+                                          otherSnapshot.d_max);
     }
     else {
         if (d_currentStats.d_min == MAX_INT) {
@@ -161,8 +356,17 @@ void StatValue::addSnapshot(const StatValue& other)
         }
     }
 
-    d_currentStats.d_incrementsOrEvents += otherSnapshot.d_incrementsOrEvents;
-    d_currentStats.d_decrementsOrSum += otherSnapshot.d_decrementsOrSum;
+    d_currentStats.d_incrementsOrEvents.storeRelaxed(
+        d_currentStats.d_incrementsOrEvents.loadRelaxed() +
+        otherSnapshot.d_incrementsOrEvents);
+    d_currentStats.d_decrementsOrSum.storeRelaxed(
+        d_currentStats.d_decrementsOrSum.loadRelaxed() +
+        otherSnapshot.d_decrementsOrSum);
+
+    if (d_histogram_mp && other.d_histogram_mp) {
+        d_histogram_mp->add(
+            other.d_histogramHistory[other.d_curSnapshotIndices[0]]);
+    }
 }
 
 void StatValue::setFromUpdate(const bmqstm::StatValueUpdate& update)
@@ -210,6 +414,10 @@ void StatValue::setFromUpdate(const bmqstm::StatValueUpdate& update)
 
 void StatValue::takeSnapshot(bsls::Types::Int64 snapshotTime)
 {
+    if (d_shards_mp) {
+        foldShards();
+    }
+
     bsls::Types::Int64 value = d_currentStats.d_value;
     bsls::Types::Int64 incrementsOrEvents;
     bsls::Types::Int64 decrementsOrSum;
@@ -218,13 +426,20 @@ void StatValue::takeSnapshot(bsls::Types::Int64 snapshotTime)
 
     incrementsOrEvents = d_currentStats.d_incrementsOrEvents;
     decrementsOrSum    = d_currentStats.d_decrementsOrSum;
-    if (d_type == e_CONTINUOUS) {
-        min = d_currentStats.d_min.swap(value);
-        max = d_currentStats.d_max.swap(value);
+
+    // Most values are not updated between two snapshots: only pay for the
+    // atomic read-modify-writes resetting the extremes if they changed.
+    const bsls::Types::Int64 resetMin = (d_type == e_CONTINUOUS ? value
+                                                                : MAX_INT);
+    const bsls::Types::Int64 resetMax = (d_type == e_CONTINUOUS ? value
+                                                                : MIN_INT);
+    min = d_currentStats.d_min.loadRelaxed();
+    if (min != resetMin) {
+        min = d_currentStats.d_min.swap(resetMin);
     }
-    else {
-        min = d_currentStats.d_min.swap(MAX_INT);
-        max = d_currentStats.d_max.swap(MIN_INT);
+    max = d_currentStats.d_max.loadRelaxed();
+    if (max != resetMax) {
+        max = d_currentStats.d_max.swap(resetMax);
     }
 
     // Update values since creation
@@ -242,6 +457,18 @@ void StatValue::takeSnapshot(bsls::Types::Int64 snapshotTime)
     snapshot.d_decrementsOrSum    = decrementsOrSum;
     snapshot.d_snapshotTime       = snapshotTime;
 
+    if (d_histogram_mp) {
+        if (min == MAX_INT) {
+            // No value was reported since the last snapshot.  Note that
+            // 'clear' keeps the capacity of the slot.
+            d_histogramHistory[d_curSnapshotIndices[0]].clear();
+        }
+        else {
+            d_histogram_mp->takeCounts(
+                &d_histogramHistory[d_curSnapshotIndices[0]]);
+        }
+    }
+
     if (d_curSnapshotIndices[0] == 0) {
         // We've performed enough snapshots to advance to the next aggregation
         // level
@@ -266,12 +493,28 @@ void StatValue::clear(bsls::Types::Int64 snapshotTime)
         d_min = 0;
         d_max = 0;
     }
+
+    if (d_histogram_mp) {
+        d_histogram_mp->reset();
+        for (size_t i = 0; i < d_histogramHistory.size(); ++i) {
+            d_histogramHistory[i].clear();
+        }
+    }
+
+    if (d_shards_mp) {
+        d_shards_mp->reset();
+    }
 }
 
 void StatValue::init(const bsl::vector<int>& sizes,
                      Type                    type,
-                     bsls::Types::Int64      snapshotTime)
+                     bsls::Types::Int64      snapshotTime,
+                     bool                    hasHistogram,
+                     bool                    isSharded)
 {
+    BSLS_ASSERT(!hasHistogram || type == e_DISCRETE);
+    BSLS_ASSERT(!isSharded || type == e_CONTINUOUS);
+
     d_type = type;
     d_levelStartIndices.resize(sizes.size() + 1);
     d_curSnapshotIndices.assign(sizes.size(), 0);
@@ -292,6 +535,34 @@ void StatValue::init(const bsl::vector<int>& sizes,
     for (size_t i = 0; i < d_history.size(); ++i) {
         d_history[i].reset(d_type == e_DISCRETE, snapshotTime);
     }
+
+    d_histogramHistory.clear();
+    if (hasHistogram) {
+        if (!d_histogram_mp) {
+            d_histogram_mp.load(new (*d_allocator_p) StatValue_Histogram(),
+                                d_allocator_p);
+        }
+        else {
+            d_histogram_mp->reset();
+        }
+        d_histogramHistory.resize(d_levelStartIndices[1]);
+    }
+    else {
+        d_histogram_mp.reset();
+    }
+
+    if (isSharded) {
+        if (!d_shards_mp) {
+            d_shards_mp.load(new (*d_allocator_p) StatValue_Shards(),
+                             d_allocator_p);
+        }
+        else {
+            d_shards_mp->reset();
+        }
+    }
+    else {
+        d_shards_mp.reset();
+    }
 }
 
 void StatValue::syncSnapshotSchedule(const StatValue& other)
@@ -319,6 +590,8 @@ StatValue::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("CurSnapshotIndices", d_curSnapshotIndices);
     printer.printAttribute("Min", d_min);
     printer.printAttribute("Max", d_max);
+    printer.printAttribute("HasHistogram", hasHistogram());
+    printer.printAttribute("IsSharded", isSharded());
     printer.end();
 
     return stream;
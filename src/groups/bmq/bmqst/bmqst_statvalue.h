@@ -20,6 +20,8 @@
 //
 //@CLASSES:
 // bmqst::StatValue     : value (or variable) able to collect statistics.
+// bmqst::StatValue_Histogram : log-linear histogram of reported values.
+// bmqst::StatValue_Shards : per-thread accumulation of value adjustments.
 // bmqst::StatValueUtil : non-primitive operations on a 'StatValue'.
 //
 //@SEE_ALSO:
@@ -34,19 +36,54 @@
 // the 'bmqst::StatContext' component.  Refer to the usage examples in the
 // documentation of that component.
 //
+/// Histogram
+///---------
+// A discrete 'StatValue' can optionally be initialized to also record the
+// distribution of the values reported to it, in a 'StatValue_Histogram'.  The
+// histogram is log-linear: every power of two is split into a fixed number of
+// equally sized buckets, bounding the relative error of any percentile
+// derived from it, with a fixed memory footprint regardless of the range of
+// the reported values.  Recording a value is a single relaxed atomic
+// increment.  Each snapshot of the first level stores (sparsely) the counts
+// recorded since the previous snapshot, so that percentiles can be computed
+// over any range of first level snapshots (see
+// 'bmqst::StatUtil::rangePercentile'), and histograms of several values are
+// merged by 'addSnapshot'.  Histograms are not carried by aggregated levels,
+// nor by 'bmqstm::StatValueUpdate'.
+//
+/// Sharded Adjustments
+///-------------------
+// A continuous 'StatValue' can optionally be initialized to be "sharded":
+// 'adjustValue' then accumulates the delta and the increment or decrement in
+// one of a few cache line sized cells of a 'StatValue_Shards', selected from
+// the calling thread, instead of updating the shared current value.  Threads
+// concurrently adjusting the same value therefore (mostly) do not contend on
+// the same cache line.  The cells are folded into the current value when a
+// snapshot is taken, or before the value is set.  The min and max of a
+// sharded value are only updated when folding, so they don't account for
+// extremes reached between two snapshots: this is meant for counters (e.g.
+// the number of messages or bytes posted to a queue), whose extremes are
+// reached when the snapshot is taken.
+//
 /// Thread Safety
 ///-------------
-// 'adjustValue' and 'setValue' are thread-safe.  All other functions are not.
+// 'adjustValue', 'setValue' and 'reportValue' are thread-safe.  All other
+// functions are not.
 
+#include <bdlb_bitutil.h>
 #include <bslim_printer.h>
+#include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_platform.h>
+#include <bslmt_threadutil.h>
 #include <bsls_atomic.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_cstdint.h>
 #include <bsl_limits.h>
 #include <bsl_ostream.h>
+#include <bsl_utility.h>
 #include <bsl_vector.h>
 #include <bsls_types.h>
 
@@ -115,6 +152,155 @@ class StatValue_Value {
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
 };
 
+// =========================
+// class StatValue_Histogram
+// =========================
+
+/// Lock-free log-linear histogram of the values reported to a discrete
+/// `StatValue`.  Non-positive values are counted in the first bucket, values
+/// below `k_NUM_SUB_BUCKETS` each get their own bucket, and every power of two
+/// above is split into `k_NUM_SUB_BUCKETS` equally sized buckets.
+class StatValue_Histogram {
+  public:
+    // PUBLIC TYPES
+
+    /// Sparse histogram: the index and count of each non-empty bucket, in
+    /// increasing order of bucket index.
+    typedef bsl::vector<bsl::pair<int, bsls::Types::Int64> > Buckets;
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_SUB_BUCKET_BITS = 2,
+
+        k_NUM_SUB_BUCKETS = 1 << k_SUB_BUCKET_BITS,
+
+        /// Enough to hold any positive `bsls::Types::Int64`.
+        k_NUM_BUCKETS = (64 - k_SUB_BUCKET_BITS) * k_NUM_SUB_BUCKETS
+    };
+
+  private:
+    // DATA
+    bsls::AtomicInt64 d_counts[k_NUM_BUCKETS];
+
+    // NOT IMPLEMENTED
+    StatValue_Histogram(const StatValue_Histogram&);
+    StatValue_Histogram& operator=(const StatValue_Histogram&);
+
+  public:
+    // CLASS METHODS
+
+    /// Return the index of the bucket the specified `value` belongs to.
+    static int bucketIndex(bsls::Types::Int64 value);
+
+    /// Return the value representing the bucket having the specified
+    /// `index`, i.e. the middle of the range of values it holds.
+    static bsls::Types::Int64 bucketValue(int index);
+
+    // CREATORS
+
+    /// Create an empty histogram.
+    StatValue_Histogram();
+
+    // MANIPULATORS
+
+    /// Record the specified `value`.
+    void record(bsls::Types::Int64 value);
+
+    /// Add the counts of the specified `buckets` to this histogram.
+    void add(const Buckets& buckets);
+
+    /// Load into the specified `buckets` the counts recorded since the last
+    /// call to this method (or to `reset`), and reset them.
+    void takeCounts(Buckets* buckets);
+
+    /// Reset all counts of this histogram.
+    void reset();
+
+    /// Set the counts of this histogram to those of the specified `other`.
+    void copyCounts(const StatValue_Histogram& other);
+};
+
+// ======================
+// class StatValue_Shards
+// ======================
+
+/// Per-thread accumulation cells of the adjustments made to a continuous
+/// `StatValue`.  Each cell occupies its own cache line, and a thread always
+/// adjusts the same cell.
+class StatValue_Shards {
+  public:
+    // PUBLIC TYPES
+
+    /// Adjustments accumulated since the last call to `take`.
+    struct Totals {
+        // PUBLIC DATA
+        bsls::Types::Int64 d_delta;
+
+        bsls::Types::Int64 d_increments;
+
+        bsls::Types::Int64 d_decrements;
+    };
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_SHARD_BITS = 3,
+
+        k_NUM_SHARDS = 1 << k_SHARD_BITS
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct Cell {
+        // PUBLIC DATA
+        bsls::AtomicInt64 d_delta;
+
+        bsls::AtomicInt64 d_increments;
+
+        bsls::AtomicInt64 d_decrements;
+
+        char d_padding[bslmt::Platform::e_CACHE_LINE_SIZE -
+                       3 * sizeof(bsls::AtomicInt64)];
+    };
+
+    // DATA
+    Cell d_cells[k_NUM_SHARDS];
+
+    // NOT IMPLEMENTED
+    StatValue_Shards(const StatValue_Shards&);
+    StatValue_Shards& operator=(const StatValue_Shards&);
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the index of the cell adjusted by the calling thread.
+    static int cellIndex();
+
+  public:
+    // CREATORS
+
+    /// Create shards with no accumulated adjustment.
+    StatValue_Shards();
+
+    // MANIPULATORS
+
+    /// Accumulate the specified `delta` in the cell of the calling thread.
+    void adjust(bsls::Types::Int64 delta);
+
+    /// Return the adjustments accumulated in all the cells since the last
+    /// call to this method (or to `reset`), and reset them.  This method
+    /// can be called concurrently with `adjust`: every adjustment is
+    /// returned by exactly one call.
+    Totals take();
+
+    /// Discard the adjustments accumulated in all the cells.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return the adjustments accumulated in all the cells since the last
+    /// call to `take` (or to `reset`), without resetting them.
+    Totals pending() const;
+};
+
 // ================================
 // class StatValue_SnapshotLocation
 // ================================
@@ -184,6 +370,7 @@ class StatValue {
     // PUBLIC TYPES
     typedef StatValue_Value<bsls::Types::Int64> Snapshot;
     typedef StatValue_SnapshotLocation          SnapshotLocation;
+    typedef StatValue_Histogram::Buckets        HistogramSnapshot;
 
     enum Type {
         /// A continuous value logically represents a curve that is moved
@@ -229,9 +416,29 @@ class StatValue {
 
     bsls::Types::Int64 d_max;  // max value since creation
 
+    bslma::ManagedPtr<StatValue_Histogram> d_histogram_mp;
+    // distribution of the values reported
+    // since the last snapshot, if enabled
+
+    bsl::vector<HistogramSnapshot> d_histogramHistory;
+    // distribution of the values reported
+    // in each first level snapshot,
+    // indexed as 'd_history'
+
+    bslma::ManagedPtr<StatValue_Shards> d_shards_mp;
+    // adjustments not yet folded into
+    // 'd_currentStats', if sharded
+
+    bslma::Allocator* d_allocator_p;  // allocator for the histogram and
+                                      // the shards
+
     // PRIVATE MANIPULATORS
     void updateMinMax(bsls::Types::Int64 value);
 
+    /// Fold the adjustments accumulated in `d_shards_mp` into the current
+    /// stats.  The behavior is undefined unless this value is sharded.
+    void foldShards();
+
     /// Aggregate the specified aggregation `level` if there is an
     /// aggregation level above it using the specified `snapshotTime`
     void aggregateLevel(int level, bsls::Types::Int64 snapshotTime);
@@ -246,25 +453,34 @@ class StatValue {
               Type                    type,
               bsls::Types::Int64      initTime,
               bslma::Allocator*       basicAllocator = 0);
+    StatValue(const bsl::vector<int>& sizes,
+              Type                    type,
+              bsls::Types::Int64      initTime,
+              bool                    hasHistogram,
+              bslma::Allocator*       basicAllocator = 0);
     StatValue(const StatValue& other, bslma::Allocator* basicAllocator = 0);
 
     // MANIPULATORS
     StatValue& operator=(const StatValue& rhs);
 
-    /// Adjust the value of this StatValue by the specified `delta`.  The
-    /// behavior is undefined unless this is a continuous StatValue.
+    /// Adjust the value of this StatValue by the specified `delta`,
+    /// accumulating it in the cell of the calling thread if this StatValue
+    /// is sharded.  The behavior is undefined unless this is a continuous
+    /// StatValue.
     void adjustValue(bsls::Types::Int64 delta);
 
     /// Set the value of this StatValue to the specified `value`.  The
     /// behavior is undefined unless this is a continuous StatValue.
     void setValue(bsls::Types::Int64 value);
 
-    /// Report the specified `value` to this StatValue.  The behavior is
-    /// undefined unless this is a discrete StatValue.
+    /// Report the specified `value` to this StatValue, recording it in the
+    /// histogram if enabled.  The behavior is undefined unless this is a
+    /// discrete StatValue.
     void reportValue(bsls::Types::Int64 value);
 
     /// Add the snapshot of the specified `other` StatValue to the current
-    /// value of this `StatValue`.
+    /// value of this `StatValue`, merging the histogram of that snapshot
+    /// into ours if both have a histogram.
     void addSnapshot(const StatValue& other);
 
     /// Set the values of this `StatValue` from the field values within the
@@ -283,11 +499,18 @@ class StatValue {
 
     /// (Re)initialize this StatValue to be of the specified `type` with
     /// the specified history `sizes` using the specified `initTime` to
-    /// initialize each snapshot's `snapshotTime`.  The current state is
-    /// lost.
+    /// initialize each snapshot's `snapshotTime`.  Optionally specify
+    /// `hasHistogram` to also record the distribution of the reported
+    /// values, and `isSharded` to accumulate adjustments per thread (see
+    /// "Sharded Adjustments" in the component documentation).  The current
+    /// state is lost.  The behavior is undefined if `hasHistogram` is
+    /// `true` unless `type` is `e_DISCRETE`, and if `isSharded` is `true`
+    /// unless `type` is `e_CONTINUOUS`.
     void init(const bsl::vector<int>& sizes,
               Type                    type,
-              bsls::Types::Int64      initTime);
+              bsls::Types::Int64      initTime,
+              bool                    hasHistogram = false,
+              bool                    isSharded    = false);
 
     /// Sync this StatValue's snapshot schedule with that of the specified
     /// `other` StatValue.  This means that all level 1 and above snapshots
@@ -317,6 +540,21 @@ class StatValue {
     /// `location.index() < historySize(location.level())`
     const Snapshot& snapshot(const SnapshotLocation& location) const;
 
+    /// Return `true` if this StatValue records the distribution of the
+    /// reported values, and `false` otherwise.
+    bool hasHistogram() const;
+
+    /// Return the distribution of the values reported in the first level
+    /// snapshot referred to by the specified `location` (and not before).
+    /// The behavior is undefined unless `hasHistogram()`,
+    /// `location.level() == 0` and `location.index() < historySize(0)`.
+    const HistogramSnapshot&
+    histogramSnapshot(const SnapshotLocation& location) const;
+
+    /// Return `true` if this StatValue accumulates adjustments per thread,
+    /// and `false` otherwise.
+    bool isSharded() const;
+
     /// Return the minimum value of this StatValue since creation.
     bsls::Types::Int64 min() const;
 
@@ -513,6 +751,73 @@ bsl::ostream& StatValue_Value<T, NON_ATOMIC>::print(bsl::ostream& stream,
     return stream;
 }
 
+// -------------------------
+// class StatValue_Histogram
+// -------------------------
+
+// CLASS METHODS
+inline int StatValue_Histogram::bucketIndex(bsls::Types::Int64 value)
+{
+    if (value < k_NUM_SUB_BUCKETS) {
+        return value < 0 ? 0 : static_cast<int>(value);  // RETURN
+    }
+
+    // Keep the 'k_SUB_BUCKET_BITS' bits following the most significant one.
+    const int shift = 63 -
+                      bdlb::BitUtil::numLeadingUnsetBits(
+                          static_cast<bsl::uint64_t>(value)) -
+                      k_SUB_BUCKET_BITS;
+    return shift * k_NUM_SUB_BUCKETS + static_cast<int>(value >> shift);
+}
+
+inline bsls::Types::Int64 StatValue_Histogram::bucketValue(int index)
+{
+    if (index < k_NUM_SUB_BUCKETS) {
+        return index;  // RETURN
+    }
+
+    const int                shift = index / k_NUM_SUB_BUCKETS - 1;
+    const bsls::Types::Int64 lower = static_cast<bsls::Types::Int64>(
+                                         index % k_NUM_SUB_BUCKETS +
+                                         k_NUM_SUB_BUCKETS)
+                                     << shift;
+    return lower + ((static_cast<bsls::Types::Int64>(1) << shift) >> 1);
+}
+
+// MANIPULATORS
+inline void StatValue_Histogram::record(bsls::Types::Int64 value)
+{
+    d_counts[bucketIndex(value)].addRelaxed(1);
+}
+
+// ----------------------
+// class StatValue_Shards
+// ----------------------
+
+// PRIVATE CLASS METHODS
+inline int StatValue_Shards::cellIndex()
+{
+    // Thread handles are typically aligned addresses, so mix all their bits
+    // (Fibonacci hashing).
+    const bsl::uint64_t id = bslmt::ThreadUtil::selfIdAsUint64();
+    return static_cast<int>((id * 0x9E3779B97F4A7C15ULL) >>
+                            (64 - k_SHARD_BITS));
+}
+
+// MANIPULATORS
+inline void StatValue_Shards::adjust(bsls::Types::Int64 delta)
+{
+    Cell& cell = d_cells[cellIndex()];
+
+    cell.d_delta.addRelaxed(delta);
+    if (delta > 0) {
+        cell.d_increments.addRelaxed(1);
+    }
+    else if (delta < 0) {
+        cell.d_decrements.addRelaxed(1);
+    }
+}
+
 // --------------------------------
 // class StatValue_SnapshotLocation
 // --------------------------------
@@ -606,6 +911,11 @@ inline void StatValue::adjustValue(bsls::Types::Int64 delta)
 {
     BSLS_ASSERT(d_type == e_CONTINUOUS);
 
+    if (d_shards_mp) {
+        d_shards_mp->adjust(delta);
+        return;  // RETURN
+    }
+
     bsls::Types::Int64 newValue = (d_currentStats.d_value += delta);
 
     updateMinMax(newValue);
@@ -622,6 +932,11 @@ inline void StatValue::setValue(bsls::Types::Int64 value)
 {
     BSLS_ASSERT(d_type == e_CONTINUOUS);
 
+    if (d_shards_mp) {
+        // Account for the pending adjustments before they are overwritten.
+        foldShards();
+    }
+
     bsls::Types::Int64 oldValue = d_currentStats.d_value.swap(value);
     updateMinMax(value);
 
@@ -641,11 +956,21 @@ inline void StatValue::reportValue(bsls::Types::Int64 value)
     d_currentStats.d_incrementsOrEvents++;
 
     updateMinMax(value);
+
+    if (d_histogram_mp) {
+        d_histogram_mp->record(value);
+    }
 }
 
 inline void StatValue::clearCurrentStats()
 {
     d_currentStats.reset(d_type == e_DISCRETE, 0);
+    if (d_histogram_mp) {
+        d_histogram_mp->reset();
+    }
+    if (d_shards_mp) {
+        d_shards_mp->reset();
+    }
 }
 
 // ACCESSORS
@@ -684,6 +1009,31 @@ StatValue::snapshot(const SnapshotLocation& location) const
     return d_history[historyIndex + d_levelStartIndices[location.level()]];
 }
 
+inline bool StatValue::hasHistogram() const
+{
+    return 0 != d_histogram_mp.get();
+}
+
+inline const StatValue::HistogramSnapshot&
+StatValue::histogramSnapshot(const SnapshotLocation& location) const
+{
+    BSLS_ASSERT(hasHistogram());
+    BSLS_ASSERT(location.level() == 0);
+    BSLS_ASSERT(location.index() < historySize(0));
+
+    int historyIndex = d_curSnapshotIndices[0] - location.index();
+    if (historyIndex < 0) {
+        historyIndex += historySize(0);
+    }
+
+    return d_histogramHistory[historyIndex];
+}
+
+inline bool StatValue::isSharded() const
+{
+    return 0 != d_shards_mp.get();
+}
+
 inline bsls::Types::Int64 StatValue::min() const
 {
     return d_min;
@@ -53,6 +53,8 @@ CompressionAlgorithmType::toAscii(CompressionAlgorithmType::Enum value)
         BMQT_CASE(UNKNOWN)
         BMQT_CASE(NONE)
         BMQT_CASE(ZLIB)
+        BMQT_CASE(LZ4)
+        BMQT_CASE(ZSTD)
     default: return "(* UNKNOWN *)";
     }
 
@@ -72,6 +74,8 @@ bool CompressionAlgorithmType::fromAscii(CompressionAlgorithmType::Enum* out,
 
     BMQT_CHECKVALUE(NONE);
     BMQT_CHECKVALUE(ZLIB);
+    BMQT_CHECKVALUE(LZ4);
+    BMQT_CHECKVALUE(ZSTD);
 
     // Invalid string
     return false;
@@ -87,7 +91,8 @@ bool CompressionAlgorithmType::isValid(const bsl::string* str,
         return true;  // RETURN
     }
 
-    stream << "Error: compressionAlgorithmType must be one of [NONE, ZLIB]\n";
+    stream << "Error: compressionAlgorithmType must be one of [NONE, ZLIB, "
+              "LZ4, ZSTD]\n";
     return false;
 }
 
@@ -25,6 +25,14 @@
 ///
 ///   - *NONE*: No compression algorithm was specified
 ///   - *ZLIB*: The compression algorithm is ZLIB
+///   - *LZ4*: The compression algorithm is LZ4, favoring speed over ratio
+///   - *ZSTD*: The compression algorithm is Zstandard, favoring ratio over
+///     speed
+///
+/// Note that peers negotiate the algorithms they support, other than *NONE*
+/// and *ZLIB*, when establishing a session (see `bmqp::CompressionFeatures`),
+/// and that messages are never sent to a peer compressed with an algorithm
+/// it did not advertise.
 
 // BDE
 #include <bsl_iosfwd.h>
@@ -40,7 +48,13 @@ namespace bmqt {
 /// This struct defines various types of compression algorithms.
 struct CompressionAlgorithmType {
     // TYPES
-    enum Enum { e_UNKNOWN = -1, e_NONE = 0, e_ZLIB = 1 };
+    enum Enum {
+        e_UNKNOWN = -1,
+        e_NONE    = 0,
+        e_ZLIB    = 1,
+        e_LZ4     = 2,
+        e_ZSTD    = 3
+    };
 
     // CONSTANTS
 
@@ -52,7 +66,7 @@ struct CompressionAlgorithmType {
     /// NOTE: This value must always be equal to the highest type in the
     /// enum because it is being used as an upper bound to verify that a
     /// header's `CompressionAlgorithmType` field is a supported type.
-    static const int k_HIGHEST_SUPPORTED_TYPE = e_ZLIB;
+    static const int k_HIGHEST_SUPPORTED_TYPE = e_ZSTD;
 
     // CLASS METHODS
 
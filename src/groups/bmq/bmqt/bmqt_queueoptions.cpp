@@ -54,6 +54,7 @@ namespace bmqt {
 // ------------------
 
 const bool QueueOptions::k_DEFAULT_SUSPENDS_ON_BAD_HOST_HEALTH = false;
+const bool QueueOptions::k_DEFAULT_ADAPTIVE_UNCONFIRMED        = false;
 
 const int QueueOptions::k_CONSUMER_PRIORITY_MIN =
     bsl::numeric_limits<int>::min() / 2;
@@ -70,6 +71,7 @@ const int QueueOptions::k_DEFAULT_CONSUMER_PRIORITY = 0;
 QueueOptions::QueueOptions(bslma::Allocator* allocator)
 : d_info()
 , d_suspendsOnBadHostHealth()
+, d_adaptiveUnconfirmed()
 , d_subscriptions(allocator)
 , d_hadSubscriptions(false)
 , d_allocator_p(allocator)
@@ -81,6 +83,7 @@ QueueOptions::QueueOptions(const QueueOptions& other,
                            bslma::Allocator*   allocator)
 : d_info(other.d_info)
 , d_suspendsOnBadHostHealth(other.d_suspendsOnBadHostHealth)
+, d_adaptiveUnconfirmed(other.d_adaptiveUnconfirmed)
 , d_subscriptions(other.d_subscriptions, allocator)
 , d_hadSubscriptions(other.d_hadSubscriptions)
 , d_allocator_p(allocator)
@@ -102,6 +105,9 @@ QueueOptions::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("consumerPriority", consumerPriority());
     printer.printAttribute("suspendsOnBadHostHealth",
                            suspendsOnBadHostHealth());
+    if (adaptiveUnconfirmed()) {
+        printer.printAttribute("adaptiveUnconfirmed", adaptiveUnconfirmed());
+    }
 
     if (!d_subscriptions.empty()) {
         printer.printIndentation();
@@ -145,6 +151,9 @@ QueueOptions& QueueOptions::merge(const QueueOptions& other)
     if (other.hasSuspendsOnBadHostHealth()) {
         setSuspendsOnBadHostHealth(other.suspendsOnBadHostHealth());
     }
+    if (other.hasAdaptiveUnconfirmed()) {
+        setAdaptiveUnconfirmed(other.adaptiveUnconfirmed());
+    }
 
     return *this;
 }
@@ -39,6 +39,12 @@
 ///   - *suspendsOnBadHostHealth*:
 ///     Sets whether the queue should suspend operation when the host machine
 ///     is unhealthy.
+///
+///   - *adaptiveUnconfirmed*:
+///     Sets whether the SDK tunes the unconfirmed window of the queue based
+///     on the measured consumption rate and round trip time to the broker.
+///     When enabled, *maxUnconfirmedMessages* and *maxUnconfirmedBytes* act
+///     as upper bounds of the window rather than fixed values.
 
 // BMQ
 
@@ -77,6 +83,7 @@ class QueueOptions {
     static const int  k_DEFAULT_MAX_UNCONFIRMED_BYTES;
     static const int  k_DEFAULT_CONSUMER_PRIORITY;
     static const bool k_DEFAULT_SUSPENDS_ON_BAD_HOST_HEALTH;
+    static const bool k_DEFAULT_ADAPTIVE_UNCONFIRMED;
 
   private:
     // PRIVATE TYPES
@@ -89,6 +96,9 @@ class QueueOptions {
     /// Whether the queue suspends operation while the host is unhealthy.
     bsl::optional<bool> d_suspendsOnBadHostHealth;
 
+    /// Whether the unconfirmed window of the queue is tuned by the SDK.
+    bsl::optional<bool> d_adaptiveUnconfirmed;
+
     Subscriptions d_subscriptions;
 
     /// `true` if `d_subscriptions` had a value, `false` otherwise.  Emulates
@@ -147,6 +157,11 @@ class QueueOptions {
     /// Set whether the queue suspends operation while host is unhealthy.
     QueueOptions& setSuspendsOnBadHostHealth(bool value);
 
+    /// Set whether the unconfirmed window of the queue is tuned by the SDK,
+    /// within the bounds of `maxUnconfirmedMessages` and
+    /// `maxUnconfirmedBytes`, to the specified `value`.
+    QueueOptions& setAdaptiveUnconfirmed(bool value);
+
     /// "Merges" another `QueueOptions` into this one, by invoking
     ///     setF(other.F())
     /// for all fields `F` for which `other.hasF()` is true.  Returns the
@@ -189,6 +204,9 @@ class QueueOptions {
     /// Get whether the queue suspends operation while host is unhealthy.
     bool suspendsOnBadHostHealth() const;
 
+    /// Get whether the unconfirmed window of the queue is tuned by the SDK.
+    bool adaptiveUnconfirmed() const;
+
     /// Returns whether `maxUnconfirmedMessages` has been set for this
     /// object, or whether it implicitly holds
     /// `k_DEFAULT_MAX_UNCONFIRMED_MESSAGES`.
@@ -207,6 +225,10 @@ class QueueOptions {
     /// `k_DEFAULT_SUSPENDS_ON_BAD_HOST_HEALTH`.
     bool hasSuspendsOnBadHostHealth() const;
 
+    /// Returns whether `adaptiveUnconfirmed` has been set for this object,
+    /// or whether it implicitly holds `k_DEFAULT_ADAPTIVE_UNCONFIRMED`.
+    bool hasAdaptiveUnconfirmed() const;
+
     /// Return false if subscription does not exist.
     ///
     /// EXPERIMENTAL.  Do not use until this feature is announced.
@@ -262,6 +284,7 @@ inline QueueOptions& QueueOptions::operator=(const QueueOptions& rhs)
     if (this != &rhs) {
         d_info                    = rhs.d_info;
         d_suspendsOnBadHostHealth = rhs.d_suspendsOnBadHostHealth;
+        d_adaptiveUnconfirmed     = rhs.d_adaptiveUnconfirmed;
         d_hadSubscriptions        = rhs.d_hadSubscriptions;
         d_subscriptions           = Subscriptions(rhs.d_subscriptions,
                                         this->d_allocator_p);
@@ -294,6 +317,12 @@ inline QueueOptions& QueueOptions::setSuspendsOnBadHostHealth(bool value)
     return *this;
 }
 
+inline QueueOptions& QueueOptions::setAdaptiveUnconfirmed(bool value)
+{
+    d_adaptiveUnconfirmed.emplace(value);
+    return *this;
+}
+
 // ACCESSORS
 inline int QueueOptions::maxUnconfirmedMessages() const
 {
@@ -316,6 +345,11 @@ inline bool QueueOptions::suspendsOnBadHostHealth() const
         k_DEFAULT_SUSPENDS_ON_BAD_HOST_HEALTH);
 }
 
+inline bool QueueOptions::adaptiveUnconfirmed() const
+{
+    return d_adaptiveUnconfirmed.value_or(k_DEFAULT_ADAPTIVE_UNCONFIRMED);
+}
+
 inline bool QueueOptions::hasMaxUnconfirmedMessages() const
 {
     return d_info.hasMaxUnconfirmedMessages();
@@ -336,6 +370,11 @@ inline bool QueueOptions::hasSuspendsOnBadHostHealth() const
     return d_suspendsOnBadHostHealth.has_value();
 }
 
+inline bool QueueOptions::hasAdaptiveUnconfirmed() const
+{
+    return d_adaptiveUnconfirmed.has_value();
+}
+
 }  // close package namespace
 
 // ------------------
@@ -348,7 +387,8 @@ inline bool bmqt::operator==(const bmqt::QueueOptions& lhs,
     return lhs.maxUnconfirmedMessages() == rhs.maxUnconfirmedMessages() &&
            lhs.maxUnconfirmedBytes() == rhs.maxUnconfirmedBytes() &&
            lhs.consumerPriority() == rhs.consumerPriority() &&
-           lhs.suspendsOnBadHostHealth() == rhs.suspendsOnBadHostHealth();
+           lhs.suspendsOnBadHostHealth() == rhs.suspendsOnBadHostHealth() &&
+           lhs.adaptiveUnconfirmed() == rhs.adaptiveUnconfirmed();
 }
 
 inline bool bmqt::operator!=(const bmqt::QueueOptions& lhs,
@@ -357,7 +397,8 @@ inline bool bmqt::operator!=(const bmqt::QueueOptions& lhs,
     return lhs.maxUnconfirmedMessages() != rhs.maxUnconfirmedMessages() ||
            lhs.maxUnconfirmedBytes() != rhs.maxUnconfirmedBytes() ||
            lhs.consumerPriority() != rhs.consumerPriority() ||
-           lhs.suspendsOnBadHostHealth() != rhs.suspendsOnBadHostHealth();
+           lhs.suspendsOnBadHostHealth() != rhs.suspendsOnBadHostHealth() ||
+           lhs.adaptiveUnconfirmed() != rhs.adaptiveUnconfirmed();
 }
 
 inline bsl::ostream& bmqt::operator<<(bsl::ostream&             stream,
@@ -145,6 +145,9 @@ static void test2_defaultsTest()
     BMQTST_ASSERT_EQ(
         options.suspendsOnBadHostHealth(),
         bmqt::QueueOptions::k_DEFAULT_SUSPENDS_ON_BAD_HOST_HEALTH);
+    BMQTST_ASSERT(!options.hasAdaptiveUnconfirmed());
+    BMQTST_ASSERT_EQ(options.adaptiveUnconfirmed(),
+                     bmqt::QueueOptions::k_DEFAULT_ADAPTIVE_UNCONFIRMED);
 
     PVV("Step 2. Explicitly override a field with the default value");
     options.setMaxUnconfirmedMessages(654321);
@@ -185,6 +188,7 @@ static void test3_mergeTest()
 
     bmqt::QueueOptions diff(bmqtst::TestHelperUtil::allocator());
     diff.setMaxUnconfirmedBytes(7890).setConsumerPriority(42);
+    diff.setAdaptiveUnconfirmed(true);
     BMQTST_ASSERT(!diff.hasMaxUnconfirmedMessages());
     BMQTST_ASSERT(diff.hasMaxUnconfirmedBytes());
     BMQTST_ASSERT(diff.hasConsumerPriority());
@@ -197,6 +201,8 @@ static void test3_mergeTest()
     BMQTST_ASSERT_EQ(options.maxUnconfirmedBytes(), 7890);
     BMQTST_ASSERT(options.hasConsumerPriority());
     BMQTST_ASSERT_EQ(options.consumerPriority(), 42);
+    BMQTST_ASSERT(options.hasAdaptiveUnconfirmed());
+    BMQTST_ASSERT_EQ(options.adaptiveUnconfirmed(), true);
     BMQTST_ASSERT(!options.hasSuspendsOnBadHostHealth());
     BMQTST_ASSERT_EQ(
         options.suspendsOnBadHostHealth(),
@@ -33,6 +33,7 @@ SessionOptions::SessionOptions(bslma::Allocator* allocator)
 : d_brokerUri(k_BROKER_DEFAULT_URI, allocator)
 , d_processNameOverride(allocator)
 , d_numProcessingThreads(1)
+, d_orderedPerQueueDispatch(false)
 , d_blobBufferSize(4 * 1024)
 , d_channelHighWatermark(128 * 1024 * 1024)
 , d_statsDumpInterval(5 * 60.0)
@@ -50,6 +51,13 @@ SessionOptions::SessionOptions(bslma::Allocator* allocator)
 , d_dtTracer_sp()
 , d_userAgentPrefix(allocator)
 , d_channelWriteTimeout(k_CHANNEL_WRITE_DEFAULT_TIMEOUT_SEC)
+, d_putBatchingLingerTime(0)
+, d_putBatchingMaxBytes(k_PUT_BATCHING_DEFAULT_MAX_BYTES)
+, d_nextEventSpinDuration(0)
+, d_pushBatchingMaxMessages(0)
+, d_pushBatchingMaxBytes(k_PUSH_BATCHING_DEFAULT_MAX_BYTES)
+, d_confirmBatchingLingerTime(0)
+, d_confirmBatchingMaxMessages(k_CONFIRM_BATCHING_DEFAULT_MAX_MESSAGES)
 {
     // NOTHING
 }
@@ -59,6 +67,7 @@ SessionOptions::SessionOptions(const SessionOptions& other,
 : d_brokerUri(other.brokerUri(), allocator)
 , d_processNameOverride(other.processNameOverride(), allocator)
 , d_numProcessingThreads(other.numProcessingThreads())
+, d_orderedPerQueueDispatch(other.orderedPerQueueDispatch())
 , d_blobBufferSize(other.blobBufferSize())
 , d_channelHighWatermark(other.channelHighWatermark())
 , d_statsDumpInterval(other.statsDumpInterval())
@@ -76,6 +85,13 @@ SessionOptions::SessionOptions(const SessionOptions& other,
 , d_dtTracer_sp(other.tracer())
 , d_userAgentPrefix(other.userAgentPrefix(), allocator)
 , d_channelWriteTimeout(other.d_channelWriteTimeout)
+, d_putBatchingLingerTime(other.putBatchingLingerTime())
+, d_putBatchingMaxBytes(other.putBatchingMaxBytes())
+, d_nextEventSpinDuration(other.nextEventSpinDuration())
+, d_pushBatchingMaxMessages(other.pushBatchingMaxMessages())
+, d_pushBatchingMaxBytes(other.pushBatchingMaxBytes())
+, d_confirmBatchingLingerTime(other.confirmBatchingLingerTime())
+, d_confirmBatchingMaxMessages(other.confirmBatchingMaxMessages())
 {
     // NOTHING
 }
@@ -93,6 +109,8 @@ bsl::ostream& SessionOptions::print(bsl::ostream& stream,
     printer.printAttribute("brokerUri", d_brokerUri);
     printer.printAttribute("processNameOverride", d_processNameOverride);
     printer.printAttribute("numProcessingThreads", d_numProcessingThreads);
+    printer.printAttribute("orderedPerQueueDispatch",
+                           d_orderedPerQueueDispatch);
     printer.printAttribute("blobBufferSize", d_blobBufferSize);
     printer.printAttribute("channelHighWatermark", d_channelHighWatermark);
     printer.printAttribute("statsDumpInterval",
@@ -116,6 +134,18 @@ bsl::ostream& SessionOptions::print(bsl::ostream& stream,
                            d_hostHealthMonitor_sp != NULL);
     printer.printAttribute("hasDistributedTracing", d_dtTracer_sp != NULL);
     printer.printAttribute("userAgentPrefix", d_userAgentPrefix);
+    printer.printAttribute("putBatchingLingerTime",
+                           d_putBatchingLingerTime.totalSecondsAsDouble());
+    printer.printAttribute("putBatchingMaxBytes", d_putBatchingMaxBytes);
+    printer.printAttribute("nextEventSpinDuration",
+                           d_nextEventSpinDuration.totalSecondsAsDouble());
+    printer.printAttribute("pushBatchingMaxMessages",
+                           d_pushBatchingMaxMessages);
+    printer.printAttribute("pushBatchingMaxBytes", d_pushBatchingMaxBytes);
+    printer.printAttribute("confirmBatchingLingerTime",
+                           d_confirmBatchingLingerTime.totalSecondsAsDouble());
+    printer.printAttribute("confirmBatchingMaxMessages",
+                           d_confirmBatchingMaxMessages);
     printer.end();
 
     return stream;
@@ -45,6 +45,11 @@
 ///         immediately failover and reconnect to another entry from the
 ///         address list.
 ///
+///     A broker running on the same host can also be reached through a local
+///     (Unix domain) socket, avoiding the TCP/IP stack, by using the
+///     `unix://<path>` format, where `<path>` is the path of the socket the
+///     broker listens on.
+///
 ///     If the environment variable `BMQ_BROKER_URI` is set, then instances of
 ///     @bbref{bmqa::Session} will ignore the `brokerUri` field from the
 ///     provided @bbref{bmqt::SessionOptions} and use the value from this
@@ -60,6 +65,17 @@
 ///     this setting has an effect only if providing a
 ///     @bbref{bmqa::SessionEventHandler} to the session.
 ///
+///   - *orderedPerQueueDispatch*:
+///     Whether events are dispatched to the processing threads by queue, so
+///     that the events of each queue are processed in order, by one thread at
+///     a time, while different queues are processed in parallel.  Events not
+///     related to exactly one queue (e.g., session events) are processed
+///     after all the events received before them, and before any event
+///     received after them.  Default is false, in which case ordering is only
+///     guaranteed when using one processing thread.  Note that this setting
+///     has an effect only if providing a @bbref{bmqa::SessionEventHandler} to
+///     the session.
+///
 ///   - *blobBufferSize*:
 ///      Size (in bytes) of the blob buffers to use. Default value is 4k.
 ///
@@ -127,6 +143,51 @@
 ///     characters long.  This is provided for libraries that are wrapping this
 ///     SDK.  Applications directly using the SDK are encouraged *NOT* to set
 ///     this value.
+///
+///   - *putBatchingLingerTime*,
+///     *putBatchingMaxBytes*:
+///     Parameters to opt into the coalescing of the PUT messages of
+///     consecutive `post` calls into a single event written to the broker.
+///     When `putBatchingLingerTime` is not zero, a posted event may be held
+///     for up to that time, or until the batch reaches `putBatchingMaxBytes`
+///     bytes, before being sent.  This trades a bounded latency for fewer
+///     events and system calls, and typically benefits applications posting
+///     many small messages individually.  Default is 0 (disabled), with a
+///     byte budget of 64KB.
+///
+///   - *nextEventSpinDuration*:
+///     Maximum time `nextEvent` busy-polls the EventQueue for an event before
+///     blocking.  When an event arrives within that time, it is returned
+///     without the latency of waking up a blocked thread, at the cost of
+///     keeping a core busy while waiting.  This typically benefits latency
+///     sensitive applications dedicating a thread to `nextEvent`.  Default is
+///     0 (never spin).  Note that this setting has no effect if providing a
+///     @bbref{bmqa::SessionEventHandler} to the session.
+///
+///   - *pushBatchingMaxMessages*,
+///     *pushBatchingMaxBytes*:
+///     Parameters to opt into the merging of consecutive PUSH events received
+///     from the broker into a single message event delivered to the
+///     application.  When `pushBatchingMaxMessages` is not zero, PUSH events
+///     received in a burst are merged until the batch holds that many
+///     messages or `pushBatchingMaxBytes` bytes, so that the message event
+///     handler is invoked once per burst instead of once per event.  Events
+///     are never held back waiting for more data: a batch is delivered as
+///     soon as no more events are immediately available.  Default is 0
+///     (disabled), with a byte budget of 64KB.
+///
+///   - *confirmBatchingLingerTime*,
+///     *confirmBatchingMaxMessages*:
+///     Parameters to opt into the coalescing of the confirmations of
+///     consecutive `confirmMessage` and `confirmMessages` calls into a single
+///     CONFIRM event written to the broker.  When `confirmBatchingLingerTime`
+///     is not zero, a confirmation may be held for up to that time, or until
+///     the batch holds `confirmBatchingMaxMessages` confirmations, before
+///     being sent.  `bmqa::Session::flushConfirms` sends the held
+///     confirmations right away.  This typically benefits consumers
+///     confirming many messages individually, which otherwise send one
+///     CONFIRM event per message.  Default is 0 (disabled), with a budget of
+///     1024 confirmations.
 
 // BMQ
 #include <bmqt_authncredential.h>
@@ -195,6 +256,15 @@ class SessionOptions {
 
     static const unsigned int k_CHANNEL_WRITE_DEFAULT_TIMEOUT_SEC = 5;
 
+    /// The default maximum size, in bytes, of a batch of PUT messages.
+    static const int k_PUT_BATCHING_DEFAULT_MAX_BYTES = 64 * 1024;
+
+    /// The default maximum size, in bytes, of a batch of PUSH messages.
+    static const int k_PUSH_BATCHING_DEFAULT_MAX_BYTES = 64 * 1024;
+
+    /// The default maximum number of messages in a batch of confirmations.
+    static const int k_CONFIRM_BATCHING_DEFAULT_MAX_MESSAGES = 1024;
+
   private:
     // DATA
 
@@ -209,6 +279,9 @@ class SessionOptions {
     /// Number of processing threads. Default is 1 thread.
     int d_numProcessingThreads;
 
+    /// Whether events are dispatched to the processing threads by queue.
+    bool d_orderedPerQueueDispatch;
+
     /// Size of the blobs buffer.
     int d_blobBufferSize;
 
@@ -258,6 +331,34 @@ class SessionOptions {
     /// buffered data.
     bsls::TimeInterval d_channelWriteTimeout;
 
+    /// Maximum time a posted PUT event may be held to be coalesced with the
+    /// next ones (0 to disable batching).
+    bsls::TimeInterval d_putBatchingLingerTime;
+
+    /// Size (in bytes) of a batch of PUT messages above which the batch is
+    /// sent without waiting for the linger time to elapse.
+    int d_putBatchingMaxBytes;
+
+    /// Maximum time `nextEvent` busy-polls for an event before blocking (0
+    /// to never spin).
+    bsls::TimeInterval d_nextEventSpinDuration;
+
+    /// Number of messages above which consecutive PUSH events are no longer
+    /// merged into the same message event (0 to disable batching).
+    int d_pushBatchingMaxMessages;
+
+    /// Size (in bytes) above which consecutive PUSH events are no longer
+    /// merged into the same message event.
+    int d_pushBatchingMaxBytes;
+
+    /// Maximum time a confirmation may be held to be coalesced with the next
+    /// ones (0 to disable batching).
+    bsls::TimeInterval d_confirmBatchingLingerTime;
+
+    /// Number of confirmations in a batch above which the batch is sent
+    /// without waiting for the linger time to elapse.
+    int d_confirmBatchingMaxMessages;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(SessionOptions, bslma::UsesBslmaAllocator)
@@ -284,6 +385,12 @@ class SessionOptions {
     /// Set the number of processing threads to the specified `value`.
     SessionOptions& setNumProcessingThreads(int value);
 
+    /// Set whether events are dispatched to the processing threads by
+    /// queue, preserving the order of the events of each queue, to the
+    /// specified `value`.  Refer to the component level documentation for
+    /// more details.
+    SessionOptions& setOrderedPerQueueDispatch(bool value);
+
     /// Set the specified `value` for the size of blobs buffers.
     SessionOptions& setBlobBufferSize(int value);
 
@@ -357,6 +464,38 @@ class SessionOptions {
     /// Zero means no blocking.
     SessionOptions& setChannelWriteTimeout(const bsls::TimeInterval& value);
 
+    /// Configure the batching of PUT messages posted by consecutive `post`
+    /// calls to hold them for up to the specified `lingerTime`, or until
+    /// the batch reaches the specified `maxBytes`.  A zero `lingerTime`
+    /// disables batching.  Refer to the component level documentation for
+    /// more details.  The behavior is undefined unless `0 <= lingerTime`
+    /// and `0 < maxBytes`.
+    SessionOptions& configurePutBatching(const bsls::TimeInterval& lingerTime,
+                                         int                       maxBytes);
+
+    /// Set the maximum time `nextEvent` busy-polls for an event before
+    /// blocking to the specified `value`.  A zero `value` disables
+    /// spinning.  The behavior is undefined unless `0 <= value`.
+    SessionOptions& setNextEventSpinDuration(const bsls::TimeInterval& value);
+
+    /// Configure the merging of consecutive PUSH events received from the
+    /// broker into a single message event holding up to the specified
+    /// `maxMessages` messages and the specified `maxBytes` bytes.  A zero
+    /// `maxMessages` disables batching.  Refer to the component level
+    /// documentation for more details.  The behavior is undefined unless
+    /// `0 <= maxMessages` and `0 < maxBytes`.
+    SessionOptions& configurePushBatching(int maxMessages, int maxBytes);
+
+    /// Configure the batching of the confirmations of consecutive
+    /// `confirmMessage` and `confirmMessages` calls to hold them for up to
+    /// the specified `lingerTime`, or until the batch holds the specified
+    /// `maxMessages` confirmations.  A zero `lingerTime` disables batching.
+    /// Refer to the component level documentation for more details.  The
+    /// behavior is undefined unless `0 <= lingerTime` and `0 < maxMessages`.
+    SessionOptions&
+    configureConfirmBatching(const bsls::TimeInterval& lingerTime,
+                             int                       maxMessages);
+
     // ACCESSORS
 
     /// Get the broker URI.
@@ -368,6 +507,10 @@ class SessionOptions {
     /// Get the number of processing threads.
     int numProcessingThreads() const;
 
+    /// Get whether events are dispatched to the processing threads by
+    /// queue.
+    bool orderedPerQueueDispatch() const;
+
     /// Get the size of the blobs buffer.
     int blobBufferSize() const;
 
@@ -416,6 +559,29 @@ class SessionOptions {
     /// Get the timeout to block `post` when at high watermark.
     const bsls::TimeInterval& channelWriteTimeout() const;
 
+    /// Get the maximum time a posted PUT event may be held for batching.
+    const bsls::TimeInterval& putBatchingLingerTime() const;
+
+    /// Get the size of a batch of PUT messages above which it is sent.
+    int putBatchingMaxBytes() const;
+
+    /// Get the maximum time `nextEvent` busy-polls for an event before
+    /// blocking.
+    const bsls::TimeInterval& nextEventSpinDuration() const;
+
+    /// Get the number of messages above which PUSH events are not merged.
+    int pushBatchingMaxMessages() const;
+
+    /// Get the size of a batch of PUSH messages above which events are not
+    /// merged.
+    int pushBatchingMaxBytes() const;
+
+    /// Get the maximum time a confirmation may be held for batching.
+    const bsls::TimeInterval& confirmBatchingLingerTime() const;
+
+    /// Get the number of confirmations in a batch above which it is sent.
+    int confirmBatchingMaxMessages() const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -474,6 +640,12 @@ inline SessionOptions& SessionOptions::setNumProcessingThreads(int value)
     return *this;
 }
 
+inline SessionOptions& SessionOptions::setOrderedPerQueueDispatch(bool value)
+{
+    d_orderedPerQueueDispatch = value;
+    return *this;
+}
+
 inline SessionOptions& SessionOptions::setBlobBufferSize(int value)
 {
     d_blobBufferSize = value;
@@ -607,6 +779,57 @@ SessionOptions::setChannelWriteTimeout(const bsls::TimeInterval& value)
     return *this;
 }
 
+inline SessionOptions&
+SessionOptions::configurePutBatching(const bsls::TimeInterval& lingerTime,
+                                     int                       maxBytes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 <= lingerTime && "lingerTime must be nonnegative");
+    BSLS_ASSERT_OPT(0 < maxBytes && "maxBytes must be positive");
+
+    d_putBatchingLingerTime = lingerTime;
+    d_putBatchingMaxBytes   = maxBytes;
+
+    return *this;
+}
+
+inline SessionOptions&
+SessionOptions::setNextEventSpinDuration(const bsls::TimeInterval& value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 <= value && "value must be nonnegative");
+
+    d_nextEventSpinDuration = value;
+    return *this;
+}
+
+inline SessionOptions& SessionOptions::configurePushBatching(int maxMessages,
+                                                             int maxBytes)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 <= maxMessages && "maxMessages must be nonnegative");
+    BSLS_ASSERT_OPT(0 < maxBytes && "maxBytes must be positive");
+
+    d_pushBatchingMaxMessages = maxMessages;
+    d_pushBatchingMaxBytes    = maxBytes;
+
+    return *this;
+}
+
+inline SessionOptions&
+SessionOptions::configureConfirmBatching(const bsls::TimeInterval& lingerTime,
+                                         int                       maxMessages)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(0 <= lingerTime && "lingerTime must be nonnegative");
+    BSLS_ASSERT_OPT(0 < maxMessages && "maxMessages must be positive");
+
+    d_confirmBatchingLingerTime  = lingerTime;
+    d_confirmBatchingMaxMessages = maxMessages;
+
+    return *this;
+}
+
 // ACCESSORS
 inline const bsl::string& SessionOptions::brokerUri() const
 {
@@ -623,6 +846,11 @@ inline int SessionOptions::numProcessingThreads() const
     return d_numProcessingThreads;
 }
 
+inline bool SessionOptions::orderedPerQueueDispatch() const
+{
+    return d_orderedPerQueueDispatch;
+}
+
 inline int SessionOptions::blobBufferSize() const
 {
     return d_blobBufferSize;
@@ -711,6 +939,42 @@ inline const bsls::TimeInterval& SessionOptions::channelWriteTimeout() const
     return d_channelWriteTimeout;
 }
 
+inline const bsls::TimeInterval& SessionOptions::putBatchingLingerTime() const
+{
+    return d_putBatchingLingerTime;
+}
+
+inline int SessionOptions::putBatchingMaxBytes() const
+{
+    return d_putBatchingMaxBytes;
+}
+
+inline const bsls::TimeInterval& SessionOptions::nextEventSpinDuration() const
+{
+    return d_nextEventSpinDuration;
+}
+
+inline int SessionOptions::pushBatchingMaxMessages() const
+{
+    return d_pushBatchingMaxMessages;
+}
+
+inline int SessionOptions::pushBatchingMaxBytes() const
+{
+    return d_pushBatchingMaxBytes;
+}
+
+inline const bsls::TimeInterval&
+SessionOptions::confirmBatchingLingerTime() const
+{
+    return d_confirmBatchingLingerTime;
+}
+
+inline int SessionOptions::confirmBatchingMaxMessages() const
+{
+    return d_confirmBatchingMaxMessages;
+}
+
 }  // close package namespace
 
 // --------------------
@@ -722,6 +986,7 @@ inline bool bmqt::operator==(const bmqt::SessionOptions& lhs,
 {
     return lhs.brokerUri() == rhs.brokerUri() &&
            lhs.numProcessingThreads() == rhs.numProcessingThreads() &&
+           lhs.orderedPerQueueDispatch() == rhs.orderedPerQueueDispatch() &&
            lhs.blobBufferSize() == rhs.blobBufferSize() &&
            lhs.channelHighWatermark() == rhs.channelHighWatermark() &&
            lhs.statsDumpInterval() == rhs.statsDumpInterval() &&
@@ -734,7 +999,16 @@ inline bool bmqt::operator==(const bmqt::SessionOptions& lhs,
            lhs.hostHealthMonitor() == rhs.hostHealthMonitor() &&
            lhs.traceContext() == rhs.traceContext() &&
            lhs.tracer() == rhs.tracer() &&
-           lhs.userAgentPrefix() == rhs.userAgentPrefix();
+           lhs.userAgentPrefix() == rhs.userAgentPrefix() &&
+           lhs.putBatchingLingerTime() == rhs.putBatchingLingerTime() &&
+           lhs.putBatchingMaxBytes() == rhs.putBatchingMaxBytes() &&
+           lhs.nextEventSpinDuration() == rhs.nextEventSpinDuration() &&
+           lhs.pushBatchingMaxMessages() == rhs.pushBatchingMaxMessages() &&
+           lhs.pushBatchingMaxBytes() == rhs.pushBatchingMaxBytes() &&
+           lhs.confirmBatchingLingerTime() ==
+               rhs.confirmBatchingLingerTime() &&
+           lhs.confirmBatchingMaxMessages() ==
+               rhs.confirmBatchingMaxMessages();
 }
 
 inline bool bmqt::operator!=(const bmqt::SessionOptions& lhs,
@@ -742,6 +1016,7 @@ inline bool bmqt::operator!=(const bmqt::SessionOptions& lhs,
 {
     return lhs.brokerUri() != rhs.brokerUri() ||
            lhs.numProcessingThreads() != rhs.numProcessingThreads() ||
+           lhs.orderedPerQueueDispatch() != rhs.orderedPerQueueDispatch() ||
            lhs.blobBufferSize() != rhs.blobBufferSize() ||
            lhs.channelHighWatermark() != rhs.channelHighWatermark() ||
            lhs.statsDumpInterval() != rhs.statsDumpInterval() ||
@@ -754,7 +1029,16 @@ inline bool bmqt::operator!=(const bmqt::SessionOptions& lhs,
            lhs.hostHealthMonitor() != rhs.hostHealthMonitor() ||
            lhs.traceContext() != rhs.traceContext() ||
            lhs.tracer() != rhs.tracer() ||
-           lhs.userAgentPrefix() != rhs.userAgentPrefix();
+           lhs.userAgentPrefix() != rhs.userAgentPrefix() ||
+           lhs.putBatchingLingerTime() != rhs.putBatchingLingerTime() ||
+           lhs.putBatchingMaxBytes() != rhs.putBatchingMaxBytes() ||
+           lhs.nextEventSpinDuration() != rhs.nextEventSpinDuration() ||
+           lhs.pushBatchingMaxMessages() != rhs.pushBatchingMaxMessages() ||
+           lhs.pushBatchingMaxBytes() != rhs.pushBatchingMaxBytes() ||
+           lhs.confirmBatchingLingerTime() !=
+               rhs.confirmBatchingLingerTime() ||
+           lhs.confirmBatchingMaxMessages() !=
+               rhs.confirmBatchingMaxMessages();
 }
 
 inline bsl::ostream& bmqt::operator<<(bsl::ostream&               stream,
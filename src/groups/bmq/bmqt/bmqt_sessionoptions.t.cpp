@@ -58,14 +58,17 @@ static void test2_printTest()
 {
     const char* const sampleSessionOptionsLayout =
         "[ brokerUri = \"tcp://localhost:30114\" processNameOverride = \"\" "
-        "numProcessingThreads = 1 "
+        "numProcessingThreads = 1 orderedPerQueueDispatch = false "
         "blobBufferSize = 4096 channelHighWatermark = 134217728 "
         "statsDumpInterval = 300 connectTimeout = 60 disconnectTimeout = 30 "
         "openQueueTimeout = 300 configureQueueTimeout = 300 "
         "closeQueueTimeout = 300 eventQueueLowWatermark = 50 "
         "eventQueueHighWatermark = 2000 hasAuthnCredentialCb = false "
         "hasHostHealthMonitor = false hasDistributedTracing = false "
-        "userAgentPrefix = \"\" ]";
+        "userAgentPrefix = \"\" putBatchingLingerTime = 0 "
+        "putBatchingMaxBytes = 65536 nextEventSpinDuration = 0 "
+        "pushBatchingMaxMessages = 0 pushBatchingMaxBytes = 65536 "
+        "confirmBatchingLingerTime = 0 confirmBatchingMaxMessages = 1024 ]";
     bmqtst::TestHelper::printTestName("PRINT");
     PV("Testing print");
     bmqu::MemOutStream stream(bmqtst::TestHelperUtil::allocator());
@@ -100,6 +103,11 @@ static void test3_setterGetterAndCopyTest()
     obj.setNumProcessingThreads(numProcessingThreads);
     BMQTST_ASSERT_EQ(obj.numProcessingThreads(), numProcessingThreads);
 
+    PVV("Checking setter and getter for orderedPerQueueDispatch");
+    BMQTST_ASSERT(!obj.orderedPerQueueDispatch());
+    obj.setOrderedPerQueueDispatch(true);
+    BMQTST_ASSERT(obj.orderedPerQueueDispatch());
+
     PVV("Checking setter and getter for blobBufferSize");
     const int blobBufferSize = 8 * 1024;
     BMQTST_ASSERT_NE(obj.blobBufferSize(), blobBufferSize);
@@ -170,10 +178,52 @@ static void test3_setterGetterAndCopyTest()
     obj.setUserAgentPrefix(userAgentPrefix);
     BMQTST_ASSERT_EQ(obj.userAgentPrefix(), userAgentPrefix);
 
+    PVV("Checking setter and getter for putBatchingLingerTime, "
+        "putBatchingMaxBytes");
+    const bsls::TimeInterval putBatchingLingerTime(0, 500000);
+    const int                putBatchingMaxBytes = 16 * 1024;
+    BMQTST_ASSERT_NE(obj.putBatchingLingerTime(), putBatchingLingerTime);
+    BMQTST_ASSERT_NE(obj.putBatchingMaxBytes(), putBatchingMaxBytes);
+    obj.configurePutBatching(putBatchingLingerTime, putBatchingMaxBytes);
+    BMQTST_ASSERT_EQ(obj.putBatchingLingerTime(), putBatchingLingerTime);
+    BMQTST_ASSERT_EQ(obj.putBatchingMaxBytes(), putBatchingMaxBytes);
+
+    PVV("Checking setter and getter for nextEventSpinDuration");
+    const bsls::TimeInterval nextEventSpinDuration(0, 50000);
+    BMQTST_ASSERT_NE(obj.nextEventSpinDuration(), nextEventSpinDuration);
+    obj.setNextEventSpinDuration(nextEventSpinDuration);
+    BMQTST_ASSERT_EQ(obj.nextEventSpinDuration(), nextEventSpinDuration);
+
+    PVV("Checking setter and getter for pushBatchingMaxMessages, "
+        "pushBatchingMaxBytes");
+    const int pushBatchingMaxMessages = 256;
+    const int pushBatchingMaxBytes    = 32 * 1024;
+    BMQTST_ASSERT_NE(obj.pushBatchingMaxMessages(), pushBatchingMaxMessages);
+    BMQTST_ASSERT_NE(obj.pushBatchingMaxBytes(), pushBatchingMaxBytes);
+    obj.configurePushBatching(pushBatchingMaxMessages, pushBatchingMaxBytes);
+    BMQTST_ASSERT_EQ(obj.pushBatchingMaxMessages(), pushBatchingMaxMessages);
+    BMQTST_ASSERT_EQ(obj.pushBatchingMaxBytes(), pushBatchingMaxBytes);
+
+    PVV("Checking setter and getter for confirmBatchingLingerTime, "
+        "confirmBatchingMaxMessages");
+    const bsls::TimeInterval confirmBatchingLingerTime(0, 1000000);
+    const int                confirmBatchingMaxMessages = 128;
+    BMQTST_ASSERT_NE(obj.confirmBatchingLingerTime(),
+                     confirmBatchingLingerTime);
+    BMQTST_ASSERT_NE(obj.confirmBatchingMaxMessages(),
+                     confirmBatchingMaxMessages);
+    obj.configureConfirmBatching(confirmBatchingLingerTime,
+                                 confirmBatchingMaxMessages);
+    BMQTST_ASSERT_EQ(obj.confirmBatchingLingerTime(),
+                     confirmBatchingLingerTime);
+    BMQTST_ASSERT_EQ(obj.confirmBatchingMaxMessages(),
+                     confirmBatchingMaxMessages);
+
     PVV("Copy constructor test");
     bmqt::SessionOptions objCopy(obj, bmqtst::TestHelperUtil::allocator());
     BMQTST_ASSERT_EQ(objCopy.brokerUri(), brokerUri);
     BMQTST_ASSERT_EQ(objCopy.numProcessingThreads(), numProcessingThreads);
+    BMQTST_ASSERT(objCopy.orderedPerQueueDispatch());
     BMQTST_ASSERT_EQ(objCopy.blobBufferSize(), blobBufferSize);
     BMQTST_ASSERT_EQ(objCopy.channelHighWatermark(), channelHighWatermark);
     BMQTST_ASSERT_EQ(objCopy.statsDumpInterval(), statsDumpInterval);
@@ -185,6 +235,17 @@ static void test3_setterGetterAndCopyTest()
     BMQTST_ASSERT_EQ(objCopy.eventQueueHighWatermark(),
                      eventQueueHighWatermark);
     BMQTST_ASSERT_EQ(objCopy.userAgentPrefix(), userAgentPrefix);
+    BMQTST_ASSERT_EQ(objCopy.putBatchingLingerTime(), putBatchingLingerTime);
+    BMQTST_ASSERT_EQ(objCopy.putBatchingMaxBytes(), putBatchingMaxBytes);
+    BMQTST_ASSERT_EQ(objCopy.nextEventSpinDuration(), nextEventSpinDuration);
+    BMQTST_ASSERT_EQ(objCopy.pushBatchingMaxMessages(),
+                     pushBatchingMaxMessages);
+    BMQTST_ASSERT_EQ(objCopy.pushBatchingMaxBytes(), pushBatchingMaxBytes);
+    BMQTST_ASSERT_EQ(objCopy.confirmBatchingLingerTime(),
+                     confirmBatchingLingerTime);
+    BMQTST_ASSERT_EQ(objCopy.confirmBatchingMaxMessages(),
+                     confirmBatchingMaxMessages);
+    BMQTST_ASSERT(objCopy == obj);
 }
 // ============================================================================
 //                                 MAIN PROGRAM
@@ -0,0 +1,176 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <bmqtsk_asyncobserver.h>
+
+#include <bmqscm_version.h>
+
+// BDE
+#include <bdlf_memfn.h>
+#include <bslmt_threadattributes.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace bmqtsk {
+
+namespace {
+
+/// Maximum number of records popped at once by the publication thread.
+const int k_BATCH_SIZE = 64;
+
+}  // close unnamed namespace
+
+// -------------------
+// class AsyncObserver
+// -------------------
+
+// PRIVATE MANIPULATORS
+void AsyncObserver::publicationThreadMain()
+{
+    Entry batch[k_BATCH_SIZE];
+
+    while (true) {
+        int numEntries = d_queue.tryPopFrontBulk(batch, k_BATCH_SIZE);
+        if (numEntries == 0) {
+            d_queue.popFront(&batch[0]);
+            numEntries = 1;
+        }
+
+        for (int i = 0; i < numEntries; ++i) {
+            if (!batch[i].d_record) {
+                // Stop request: every record enqueued before it has been
+                // published.
+                return;  // RETURN
+            }
+
+            publishEntry(batch[i]);
+            batch[i].d_record.reset();
+        }
+    }
+}
+
+void AsyncObserver::publishEntry(const Entry& entry)
+{
+    d_observer_p->publish(entry.d_record, entry.d_context);
+}
+
+// CREATORS
+AsyncObserver::AsyncObserver(ball::Observer*   observer,
+                             int               maxQueueLength,
+                             bslma::Allocator* allocator)
+: d_allocator_p(allocator)
+, d_observer_p(observer)
+, d_queue(maxQueueLength, allocator)
+, d_thread(bslmt::ThreadUtil::invalidHandle())
+, d_severityThreshold(ball::Severity::e_TRACE)
+, d_numDropped(0)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(observer);
+    BSLS_ASSERT_SAFE(0 < maxQueueLength);
+}
+
+AsyncObserver::~AsyncObserver()
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_OPT(d_thread == bslmt::ThreadUtil::invalidHandle() &&
+                    "stop() must be called before destroying this object");
+}
+
+// MANIPULATORS
+int AsyncObserver::start()
+{
+    if (d_thread != bslmt::ThreadUtil::invalidHandle()) {
+        return 0;  // RETURN
+    }
+
+    d_queue.enablePushBack();
+
+    bslmt::ThreadAttributes attributes;
+    attributes.setThreadName("bmqAsyncLog");
+
+    return bslmt::ThreadUtil::createWithAllocator(
+        &d_thread,
+        attributes,
+        bdlf::MemFnUtil::memFn(&AsyncObserver::publicationThreadMain, this),
+        d_allocator_p);
+}
+
+void AsyncObserver::stop()
+{
+    if (d_thread == bslmt::ThreadUtil::invalidHandle()) {
+        return;  // RETURN
+    }
+
+    // Enqueue the stop request behind the pending records, and wait for the
+    // publication thread to drain them.
+    d_queue.pushBack(Entry());
+    bslmt::ThreadUtil::join(d_thread);
+    d_thread = bslmt::ThreadUtil::invalidHandle();
+
+    // From now on, records are published synchronously.  Flush the ones
+    // enqueued while the stop request was being processed.
+    d_queue.disablePushBack();
+
+    Entry entry;
+    while (d_queue.tryPopFront(&entry) == 0) {
+        if (entry.d_record) {
+            publishEntry(entry);
+        }
+    }
+}
+
+void AsyncObserver::publish(const bsl::shared_ptr<const ball::Record>& record,
+                            const ball::Context& context)
+{
+    if (record->fixedFields().severity() > severityThreshold()) {
+        return;  // RETURN
+    }
+
+    Entry entry;
+    entry.d_record  = record;
+    entry.d_context = context;
+
+    if (d_queue.tryPushBack(entry) == 0) {
+        return;  // RETURN
+    }
+
+    if (d_queue.isPushBackDisabled()) {
+        // Publication thread stopped.
+        publishEntry(entry);
+        return;  // RETURN
+    }
+
+    ++d_numDropped;
+}
+
+void AsyncObserver::publish(const ball::Record&  record,
+                            const ball::Context& context)
+{
+    if (record.fixedFields().severity() > severityThreshold()) {
+        return;  // RETURN
+    }
+
+    publish(bsl::allocate_shared<ball::Record>(d_allocator_p, record),
+            context);
+}
+
+void AsyncObserver::releaseRecords()
+{
+    d_observer_p->releaseRecords();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
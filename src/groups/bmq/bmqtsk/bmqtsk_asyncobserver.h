@@ -0,0 +1,253 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_BMQTSK_ASYNCOBSERVER
+#define INCLUDED_BMQTSK_ASYNCOBSERVER
+
+//@PURPOSE: Provide a BALL observer publishing to another one asynchronously.
+//
+//@CLASSES:
+//  bmqtsk::AsyncObserver: BALL observer decoupling publication from logging
+//
+//@SEE_ALSO: ball_asyncfileobserver, bmqc_monitoredqueue_ringbuffer
+//
+//@DESCRIPTION: 'bmqtsk::AsyncObserver' is a concrete implementation of the
+// 'ball::Observer' protocol which forwards the records published to it to a
+// target observer from a dedicated publication thread.  Logging threads only
+// enqueue a shared reference to the record into a bounded lock-free
+// 'bmqc::RingBuffer', so that the formatting and the I/O performed by the
+// target observer (e.g., writing to stdout or to the system log) never block
+// them.  If the ring buffer is full, the record is dropped and a counter of
+// dropped records is incremented, instead of blocking the logging thread.
+//
+// Records whose severity is above the configured severity threshold are
+// discarded before being enqueued, so that records which would be ignored by
+// the target observer do not take up room in the ring buffer.
+//
+// Note that 'ball::AsyncFileObserver' already provides asynchronous
+// publication for file logging; this component is meant to wrap the other,
+// synchronous, observers.
+//
+/// Thread-safety
+///-------------
+// This object is *thread* *enabled*, meaning that two threads can safely call
+// any methods on the *same* *instance* without external synchronization,
+// except for 'start' and 'stop' which must not be called concurrently.
+//
+/// Usage Example
+///-------------
+// The following example illustrates how to make a 'ConsoleObserver'
+// asynchronous.
+//..
+//  bmqtsk::ConsoleObserver consoleObserver(allocator);
+//  bmqtsk::AsyncObserver   asyncObserver(&consoleObserver, 8192, allocator);
+//
+//  asyncObserver.setSeverityThreshold(consoleObserver.severityThreshold());
+//  int rc = asyncObserver.start();
+//  BSLS_ASSERT(rc == 0);
+//
+//  multiplexObserver.registerObserver(&asyncObserver);
+//
+//  // ...
+//
+//  multiplexObserver.deregisterObserver(&asyncObserver);
+//  asyncObserver.stop();
+//..
+
+// BMQ
+
+#include <bmqc_monitoredqueue_ringbuffer.h>
+
+// BDE
+#include <ball_context.h>
+#include <ball_observer.h>
+#include <ball_record.h>
+#include <ball_severity.h>
+#include <bsl_memory.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_threadutil.h>
+#include <bsls_atomic.h>
+#include <bsls_cpp11.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+namespace bmqtsk {
+
+// ===================
+// class AsyncObserver
+// ===================
+
+/// BALL observer forwarding records to a target observer from a dedicated
+/// thread.
+class AsyncObserver : public ball::Observer {
+  private:
+    // PRIVATE TYPES
+
+    /// Record enqueued for publication.
+    struct Entry {
+        // PUBLIC DATA
+        bsl::shared_ptr<const ball::Record> d_record;
+        // Record to publish, or null to stop the
+        // publication thread.
+
+        ball::Context d_context;
+        // Publishing context of the record.
+    };
+
+    typedef bmqc::RingBuffer<Entry> EntryQueue;
+
+  private:
+    // DATA
+    bslma::Allocator* d_allocator_p;
+    // Allocator to use.
+
+    ball::Observer* d_observer_p;
+    // Target observer, held not owned.
+
+    EntryQueue d_queue;
+    // Records waiting for publication.
+
+    bslmt::ThreadUtil::Handle d_thread;
+    // Publication thread, if started.
+
+    bsls::AtomicInt d_severityThreshold;
+    // Severity threshold beyond which records
+    // are discarded.
+
+    bsls::AtomicInt64 d_numDropped;
+    // Number of records dropped because the queue
+    // was full.
+
+  private:
+    // NOT IMPLEMENTED
+    AsyncObserver(const AsyncObserver&) BSLS_CPP11_DELETED;
+
+    /// Copy constructor and assignment operator are not implemented.
+    AsyncObserver& operator=(const AsyncObserver&) BSLS_CPP11_DELETED;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Body of the publication thread.
+    void publicationThreadMain();
+
+    /// Publish the record of the specified `entry` to the target observer.
+    void publishEntry(const Entry& entry);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AsyncObserver, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a new object forwarding records to the specified `observer`,
+    /// buffering up to (at least) the specified `maxQueueLength` records,
+    /// and using the specified `allocator`.  The behavior is undefined
+    /// unless `observer` outlives this object and `0 < maxQueueLength`.
+    AsyncObserver(ball::Observer*   observer,
+                  int               maxQueueLength,
+                  bslma::Allocator* allocator);
+
+    /// Destroy this object.  The behavior is undefined unless the
+    /// publication thread is stopped.
+    ~AsyncObserver() BSLS_KEYWORD_OVERRIDE;
+
+    // MANIPULATORS
+
+    /// Start the publication thread.  Return 0 on success, and a non-zero
+    /// value otherwise.  Records published before `start` are queued.
+    int start();
+
+    /// Publish all the queued records, then stop the publication thread.
+    /// Records published after `stop` are forwarded synchronously to the
+    /// target observer.  This method has no effect if the publication
+    /// thread is not running.
+    void stop();
+
+    /// Set the severity threshold to the specified `value`: any record whose
+    /// severity is greater than `value` is discarded.  Return a reference
+    /// to this object offering modification access.
+    AsyncObserver& setSeverityThreshold(ball::Severity::Level value);
+
+    // MANIPULATORS
+    //   (virtual: ball::Observer)
+
+    /// Enqueue the specified log `record` having the specified publishing
+    /// `context` for publication to the target observer if its severity is
+    /// less than or equal to the severity threshold, or drop it if the
+    /// queue is full.
+    void publish(const bsl::shared_ptr<const ball::Record>& record,
+                 const ball::Context& context) BSLS_KEYWORD_OVERRIDE;
+
+    /// Note: this member is overridden to get rid of the "hides the virtual
+    ///       function" warning.  Copy the specified `record` and enqueue it
+    ///       along the specified `context` as above.
+    void publish(const ball::Record&  record,
+                 const ball::Context& context) BSLS_KEYWORD_OVERRIDE;
+
+    /// Forward to the target observer.
+    void releaseRecords() BSLS_KEYWORD_OVERRIDE;
+
+    // ACCESSORS
+
+    /// Return the currently set severity threshold of this object.
+    ball::Severity::Level severityThreshold() const;
+
+    /// Return the number of records dropped because the queue was full.
+    bsls::Types::Int64 numDropped() const;
+
+    /// Return the number of records waiting for publication.
+    bsls::Types::Int64 queueLength() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -------------------
+// class AsyncObserver
+// -------------------
+
+inline AsyncObserver&
+AsyncObserver::setSeverityThreshold(ball::Severity::Level value)
+{
+    d_severityThreshold.storeRelaxed(value);
+    return *this;
+}
+
+inline ball::Severity::Level AsyncObserver::severityThreshold() const
+{
+    return static_cast<ball::Severity::Level>(
+        d_severityThreshold.loadRelaxed());
+}
+
+inline bsls::Types::Int64 AsyncObserver::numDropped() const
+{
+    return d_numDropped.loadRelaxed();
+}
+
+inline bsls::Types::Int64 AsyncObserver::queueLength() const
+{
+    return d_queue.numElements();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -305,6 +305,16 @@ int LogController::processInfoCommand(BSLA_MAYBE_UNUSED bsl::istream& cmd,
        << "    LogFile.................: " << logFile << "\n"
        << "    LogRecordQueueLength....: "
        << d_fileObserver.recordQueueLength() << "\n"
+       << "  ConsoleObserver:\n"
+       << "    LogRecordQueueLength....: "
+       << d_asyncConsoleObserver.queueLength() << "\n"
+       << "    DroppedLogRecords.......: "
+       << d_asyncConsoleObserver.numDropped() << "\n"
+       << "  SyslogObserver:\n"
+       << "    LogRecordQueueLength....: "
+       << d_asyncSyslogObserver.queueLength() << "\n"
+       << "    DroppedLogRecords.......: "
+       << d_asyncSyslogObserver.numDropped() << "\n"
        << "  Categories:\n";
 
     // Iterate over each category to print it's current verbosity
@@ -356,6 +366,7 @@ int LogController::processConsoleCommand(bsl::istream& cmd, bsl::ostream& os)
     }
 
     d_consoleObserver.setSeverityThreshold(level);
+    d_asyncConsoleObserver.setSeverityThreshold(level);
     os << "Console severity threshold set to '" << level << "'";
 
     // In order for a trace to be printed by the console observer, two
@@ -443,6 +454,12 @@ LogController::LogController(bdlmt::EventScheduler* scheduler,
 , d_alarmLog(allocator)
 , d_consoleObserver(allocator)
 , d_syslogObserver(allocator)
+, d_asyncConsoleObserver(&d_consoleObserver,
+                         8192,  // maxQueueLength
+                         allocator)
+, d_asyncSyslogObserver(&d_syslogObserver,
+                        8192,  // maxQueueLength
+                        allocator)
 , d_logCleaner(scheduler, allocator)
 , d_lastLogLinkPath(allocator)
 , d_registeredObservers(allocator)
@@ -474,7 +491,9 @@ int LogController::initialize(bsl::ostream&              errorDescription,
         rc_FILEOBSERVER_REGISTRATION_FAILED    = -5,
         rc_ALARMLOG_REGISTRATION_FAILED        = -6,
         rc_CONSOLEOBSERVER_REGISTRATION_FAILED = -7,
-        rc_SYSLOGOBSERVER_REGISTRATION_FAILED  = -8
+        rc_SYSLOGOBSERVER_REGISTRATION_FAILED  = -8,
+        rc_CONSOLEOBSERVER_STARTTHREAD_FAILED  = -9,
+        rc_SYSLOGOBSERVER_STARTTHREAD_FAILED   = -10
     };
 
     if (ball::LoggerManager::isInitialized()) {
@@ -559,8 +578,18 @@ int LogController::initialize(bsl::ostream&              errorDescription,
     // ConsoleObserver
     d_consoleObserver.setSeverityThreshold(config.consoleSeverityThreshold())
         .setLogFormat(config.consoleFormat());
+    d_asyncConsoleObserver.setSeverityThreshold(
+        config.consoleSeverityThreshold());
+
+    rc = d_asyncConsoleObserver.start();
+    if (rc != 0) {
+        errorDescription << "Failed to start ConsoleObserver publication "
+                         << "thread [rc: " << rc << "]";
+        ball::LoggerManager::shutDownSingleton();
+        return rc_CONSOLEOBSERVER_STARTTHREAD_FAILED;  // RETURN
+    }
 
-    rc = tryRegisterObserver(&d_consoleObserver);
+    rc = tryRegisterObserver(&d_asyncConsoleObserver);
     if (rc != 0) {
         errorDescription << "Failed registering ConsoleObserver "
                          << "[rc: " << rc << "]";
@@ -574,8 +603,17 @@ int LogController::initialize(bsl::ostream&              errorDescription,
         d_syslogObserver.setSeverityThreshold(config.syslogVerbosity())
             .setLogFormat(config.syslogFormat());
         d_syslogObserver.enableLogging(config.syslogAppName());
+        d_asyncSyslogObserver.setSeverityThreshold(config.syslogVerbosity());
+
+        rc = d_asyncSyslogObserver.start();
+        if (rc != 0) {
+            errorDescription << "Failed to start SyslogObserver publication "
+                             << "thread [rc: " << rc << "]";
+            ball::LoggerManager::shutDownSingleton();
+            return rc_SYSLOGOBSERVER_STARTTHREAD_FAILED;  // RETURN
+        }
 
-        rc = tryRegisterObserver(&d_syslogObserver);
+        rc = tryRegisterObserver(&d_asyncSyslogObserver);
         if (rc != 0) {
             errorDescription << "Failed registering SyslogObserver "
                              << "[rc: " << rc << "]";
@@ -665,9 +703,12 @@ void LogController::shutdown()
     d_logCleaner.stop();
 
     // Unregister all observers
-    d_multiplexObserver.deregisterObserver(&d_consoleObserver);
+    d_multiplexObserver.deregisterObserver(&d_asyncSyslogObserver);
+    d_multiplexObserver.deregisterObserver(&d_asyncConsoleObserver);
     d_multiplexObserver.deregisterObserver(&d_alarmLog);
     d_multiplexObserver.deregisterObserver(&d_fileObserver);
+    d_asyncSyslogObserver.stop();
+    d_asyncConsoleObserver.stop();
     d_fileObserver.stopPublicationThread();
 
     // Shutdown logger manager
@@ -27,10 +27,12 @@
 // value-semantic type object used to provide configuration parameters to an
 // 'bmqtsk::LogController'.  'LogController' uses a 'ball::AsyncFileObserver'
 // to asynchronously write logs to a file, and 'bmqtsk::ConsoleObserver' to
-// write logs to stdout.  It offers M-Trap like command processing mechanism to
-// dynamically interact with the logging facility (change the verbosity level,
-// the console output severity threshold, or change severity level on a
-// specific category).
+// write logs to stdout.  The console and syslog observers are wrapped in a
+// 'bmqtsk::AsyncObserver' so that their formatting and I/O happen on a
+// dedicated thread, and never block the logging threads.  It offers M-Trap
+// like command processing mechanism to dynamically interact with the logging
+// facility (change the verbosity level, the console output severity
+// threshold, or change severity level on a specific category).
 //
 // Typical usage of this component is to create it as early as possible, in
 // main, and keep it until the end of the application.
@@ -119,6 +121,7 @@
 //
 
 #include <bmqtsk_alarmlogobserver.h>
+#include <bmqtsk_asyncobserver.h>
 #include <bmqtsk_consoleobserver.h>
 #include <bmqtsk_logcleaner.h>
 #include <bmqtsk_syslogobserver.h>
@@ -363,6 +366,14 @@ class LogController {
     SyslogObserver d_syslogObserver;
     // Observer for printing to system log.
 
+    AsyncObserver d_asyncConsoleObserver;
+    // Observer publishing to the console observer
+    // from a dedicated thread.
+
+    AsyncObserver d_asyncSyslogObserver;
+    // Observer publishing to the syslog observer
+    // from a dedicated thread.
+
     LogCleaner d_logCleaner;
     // Mechanism to clean up old logs.
 
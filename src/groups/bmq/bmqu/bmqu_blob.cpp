@@ -299,30 +299,31 @@ int BlobUtil::appendToBlob(bdlbb::Blob*       dest,
         if ((destEnd == srcStart) &&
             (srcBuf.buffer().rep() == destBuf.buffer().rep())) {
             // We can just extend dest's last data buffer, and then append the
-            // rest
-            const int srcBufLen = bufferSize(src, start.buffer()) -
-                                  start.byte();
-
-            int       secSize = 0;
-            const int ret     = sectionSize(&secSize, src, localSection);
-            if (ret != 0) {
-                return (ret * 10) - 2;  // RETURN
-            }
+            // rest.  The extension stops at the end of the start buffer, or
+            // at the end of the section if it lies within that buffer, so
+            // there is no need to walk the section to compute its size.
+            const int startBuffer = start.buffer();
+            const int startByte   = start.byte();
+
+            const bool isWithinStartBuffer = localSection.end().buffer() ==
+                                             startBuffer;
 
-            const int extendLen = bsl::min(srcBufLen, secSize);
+            const int extendLen = isWithinStartBuffer
+                                      ? localSection.end().byte() - startByte
+                                      : bufferSize(src, startBuffer) -
+                                            startByte;
 
             bdlbb::BlobBuffer newBuf(destBuf);
             newBuf.setSize(newBuf.size() + extendLen);
             dest->removeBuffer(dest->numDataBuffers() - 1);
             dest->appendDataBuffer(newBuf);
 
-            const int rc = findOffset(&localSection.start(),
-                                      src,
-                                      localSection.start(),
-                                      extendLen);
-            if (rc != 0) {
-                return -2;  // RETURN
+            if (isWithinStartBuffer) {
+                return 0;  // RETURN
             }
+
+            localSection.start().setBuffer(startBuffer + 1);
+            localSection.start().setByte(0);
         }
     }
 
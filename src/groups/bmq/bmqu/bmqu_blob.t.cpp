@@ -1358,6 +1358,46 @@ static void test16_appendToBlob()
                             bmqtst::TestHelperUtil::allocator()));
         }
     }
+
+    {
+        PVV("appendToBlob extending the last buffer");
+
+        bdlbb::Blob src(bmqtst::TestHelperUtil::allocator());
+        bmqtst::BlobTestUtil::fromString(&src,
+                                         "abcdef|gh",
+                                         bmqtst::TestHelperUtil::allocator());
+
+        bdlbb::Blob blob(bmqtst::TestHelperUtil::allocator());
+        bsl::string resultBlob(bmqtst::TestHelperUtil::allocator());
+
+        // Append the beginning of the first buffer of 'src'
+        BMQTST_ASSERT_EQ(
+            bmqu::BlobUtil::appendToBlob(&blob, src, BlobPosition(0, 0), 2),
+            0);
+        resultBlob.clear();
+        bmqtst::BlobTestUtil::toString(&resultBlob, blob, true);
+        BMQTST_ASSERT_EQ(resultBlob, "ab");
+
+        // Section within the first buffer of 'src': the last buffer of
+        // 'blob' is extended
+        BMQTST_ASSERT_EQ(
+            bmqu::BlobUtil::appendToBlob(&blob, src, BlobPosition(0, 2), 2),
+            0);
+        resultBlob.clear();
+        bmqtst::BlobTestUtil::toString(&resultBlob, blob, true);
+        BMQTST_ASSERT_EQ(resultBlob, "abcd");
+
+        // Section spanning both buffers of 'src': the last buffer of 'blob'
+        // is extended up to the end of the first buffer of 'src', and the
+        // rest is appended
+        BMQTST_ASSERT_EQ(
+            bmqu::BlobUtil::appendToBlob(&blob, src, BlobPosition(0, 4), 3),
+            0);
+        resultBlob.clear();
+        bmqtst::BlobTestUtil::toString(&resultBlob, blob, true);
+        BMQTST_ASSERT_EQ(resultBlob, "abcdef|g");
+        BMQTST_ASSERT_EQ(blob.length(), 7);
+    }
 }
 
 static void test17_getAlignedSection()
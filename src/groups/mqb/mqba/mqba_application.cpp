@@ -50,6 +50,7 @@
 #include <bmqst_statcontext.h>
 #include <bmqu_memoutstream.h>
 #include <bmqu_operationlogger.h>
+#include <bmqu_printutil.h>
 #include <bmqu_time.h>
 
 // BDE
@@ -66,8 +67,11 @@
 #include <bsl_cstdlib.h>
 #include <bsl_ctime.h>
 #include <bsl_functional.h>
+#include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslmt_latch.h>
 #include <bslmt_lockguard.h>
@@ -76,6 +80,7 @@
 #include <bsls_assert.h>
 #include <bsls_systemclocktype.h>
 #include <bsls_timeinterval.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace mqba {
@@ -94,6 +99,64 @@ void createBlob(bdlbb::BlobBufferFactory* bufferFactory,
     new (arena) bdlbb::Blob(bufferFactory, allocator);
 }
 
+/// Mechanism recording the duration of the successive phases of the broker
+/// startup.
+class StartupTimeline {
+  private:
+    // PRIVATE TYPES
+    typedef bsl::pair<const char*, bsls::Types::Int64> Phase;
+
+    // DATA
+
+    /// Name and duration, in nanoseconds, of each completed phase.
+    bsl::vector<Phase> d_phases;
+
+    /// High resolution time at which the timeline was created.
+    bsls::Types::Int64 d_startTime;
+
+    /// High resolution time at which the last phase completed.
+    bsls::Types::Int64 d_lastTime;
+
+  public:
+    // CREATORS
+
+    /// Create a timeline starting now, using the specified `allocator`.
+    explicit StartupTimeline(bslma::Allocator* allocator)
+    : d_phases(allocator)
+    , d_startTime(bmqu::Time::highResolutionTimer())
+    , d_lastTime(d_startTime)
+    {
+        d_phases.reserve(16);
+    }
+
+    // MANIPULATORS
+
+    /// Record the completion, now, of the phase having the specified
+    /// `name`, which must be a string literal.
+    void mark(const char* name)
+    {
+        const bsls::Types::Int64 now = bmqu::Time::highResolutionTimer();
+        d_phases.push_back(bsl::make_pair(name, now - d_lastTime));
+        d_lastTime = now;
+    }
+
+    // ACCESSORS
+
+    /// Print the total duration and the duration of each phase to the
+    /// specified `os`.
+    void print(bsl::ostream& os) const
+    {
+        os << "Startup timeline [total: "
+           << bmqu::PrintUtil::prettyTimeInterval(d_lastTime - d_startTime)
+           << "]";
+        for (size_t i = 0; i < d_phases.size(); ++i) {
+            os << "\n  " << bsl::left << bsl::setw(26) << d_phases[i].first
+               << ": "
+               << bmqu::PrintUtil::prettyTimeInterval(d_phases[i].second);
+        }
+    }
+};
+
 }  // close unnamed namespace
 
 // -----------
@@ -259,7 +322,8 @@ int Application::start(bsl::ostream& errorDescription)
         rc_AUTHORIZATIONCONTROLLER           = -13,
     };
 
-    int rc = rc_SUCCESS;
+    int             rc = rc_SUCCESS;
+    StartupTimeline timeline(d_allocator_p);
 
     // Start the PluginManager
     {
@@ -272,6 +336,7 @@ int Application::start(bsl::ostream& errorDescription)
             return (rc * 100) + rc_PLUGINMANAGER;  // RETURN
         }
     }
+    timeline.mark("PluginManager");
 
     mqbi::ClusterResources resources(d_scheduler_p,
                                      &d_bufferFactory,
@@ -297,6 +362,7 @@ int Application::start(bsl::ostream& errorDescription)
     if (rc != 0) {
         return (rc * 100) + rc_STATCONTROLLER;  // RETURN
     }
+    timeline.mark("StatController");
 
     // Start the AuthenticationController
     d_authenticationController_mp.load(
@@ -308,6 +374,7 @@ int Application::start(bsl::ostream& errorDescription)
     if (rc != 0) {
         return (rc * 100) + rc_AUTHENTICATIONCONTROLLER;  // RETURN
     }
+    timeline.mark("AuthenticationController");
 
     // Start the AuthorizationController
     const mqbcfg::AppConfig& brokerConfig = mqbcfg::BrokerConfig::get();
@@ -320,6 +387,7 @@ int Application::start(bsl::ostream& errorDescription)
     if (rc != 0) {
         return (rc * 100) + rc_AUTHORIZATIONCONTROLLER;  // RETURN
     }
+    timeline.mark("AuthorizationController");
 
     // Start the config provider
     d_configProvider_mp.load(new (*d_allocator_p) ConfigProvider(
@@ -329,6 +397,7 @@ int Application::start(bsl::ostream& errorDescription)
     if (rc != 0) {
         return (rc * 100) + rc_CONFIGPROVIDER;  // RETURN
     }
+    timeline.mark("ConfigProvider");
 
     // Start dispatcher
     d_dispatcher_mp.load(new (*d_allocator_p) Dispatcher(
@@ -337,10 +406,12 @@ int Application::start(bsl::ostream& errorDescription)
                              d_scheduler_p,
                              d_allocators.get("Dispatcher")),
                          d_allocator_p);
+    d_dispatcher_mp->setCpuAccounting(brokerConfig.dispatcherCpuAccounting());
     rc = d_dispatcher_mp->start(errorDescription);
     if (0 != rc) {
         return (rc * 100) + rc_DISPATCHER;  // RETURN
     }
+    timeline.mark("Dispatcher");
 
     // Start the transport manager
     bslma::ManagedPtr<mqbnet::Authenticator> authenticatorMp(
@@ -389,6 +460,7 @@ int Application::start(bsl::ostream& errorDescription)
     if (rc != 0) {
         return (rc * 100) + rc_TRANSPORTMANAGER;  // RETURN
     }
+    timeline.mark("TransportManager");
 
     // TBD: Review lifecycle and ordering: ideally, objects should be created
     //      and started one after another.  Currently, because of
@@ -428,6 +500,7 @@ int Application::start(bsl::ostream& errorDescription)
     if (rc != 0) {
         return (rc * 100) + rc_BROKER_CLUSTER_CONFIG_LOADFAILURE;  // RETURN
     }
+    timeline.mark("ClusterConfig");
 
     // Start the DomainManager
     d_domainManager_mp.load(new (*d_allocator_p) DomainManager(
@@ -447,18 +520,21 @@ int Application::start(bsl::ostream& errorDescription)
     if (rc != 0) {
         return (rc * 100) + rc_DOMAINMANAGER;  // RETURN
     }
+    timeline.mark("DomainManager");
 
     // Start the clusterCatalog
     rc = d_clusterCatalog_mp->start(errorDescription);
     if (rc != 0) {
         return (rc * 100) + rc_CLUSTERCATALOG;  // RETURN
     }
+    timeline.mark("ClusterCatalog");
 
     // Everything started, start listening
     rc = d_transportManager_mp->startListening(errorDescription);
     if (rc != 0) {
         return (rc * 100) + rc_TRANSPORTMANAGER_LISTEN;  // RETURN
     }
+    timeline.mark("Listen");
 
     rc = d_adminExecutionPool.start();
     if (rc != 0) {
@@ -469,6 +545,12 @@ int Application::start(bsl::ostream& errorDescription)
     if (rc != 0) {
         return (rc * 100) + rc_ADMIN_POOL_START_FAILURE;  // RETURN
     }
+    timeline.mark("AdminPools");
+
+    BALL_LOG_INFO_BLOCK
+    {
+        timeline.print(BALL_LOG_OUTPUT_STREAM);
+    }
 
     BALL_LOG_INFO << "BMQbrkr started successfully";
 
@@ -676,22 +758,8 @@ bool Application::initiateShutdown()
     // but enqueued in a Queue dispatcher thread (different from the Cluster
     // dispatcher thread which has processed StopResponse)
 
-    {
-        bslmt::Latch latch(1);
-        d_dispatcher_mp->executeOnAllQueues(
-            mqbi::Dispatcher::VoidFunction(),
-            mqbi::DispatcherClientType::e_QUEUE,
-            bdlf::BindUtil::bind(&bslmt::Latch::arrive, &latch));
-        latch.wait();
-    }
-    {
-        bslmt::Latch latch(1);
-        d_dispatcher_mp->executeOnAllQueues(
-            mqbi::Dispatcher::VoidFunction(),
-            mqbi::DispatcherClientType::e_CLUSTER,
-            bdlf::BindUtil::bind(&bslmt::Latch::arrive, &latch));
-        latch.wait();
-    }
+    d_dispatcher_mp->synchronizeAll(mqbi::DispatcherClientType::e_QUEUE);
+    d_dispatcher_mp->synchronizeAll(mqbi::DispatcherClientType::e_CLUSTER);
 
     bslmt::Latch latchUpstreams(1);
     // The 'StopRequestManagerType::sendRequest' always calls 'd_responseCb'.
@@ -40,6 +40,13 @@ namespace mqba {
 // ===================
 
 /// authorizer for a BlazingMQ session with client or broker
+///
+/// Each call to `authorize` is forwarded synchronously to the configured
+/// `mqbplug::Authorizer` plugin, and decisions are not cached.  A cache
+/// would have to be invalidated whenever the `mqbplug::AuthenticationResult`
+/// of a session is replaced upon reauthentication, and is only worth adding
+/// once authorization is performed on a per-request path (e.g. queue open)
+/// rather than per connection.
 class Authorizer : public mqbi::Authorizer {
   private:
     // DATA
@@ -160,6 +160,7 @@
 #include <mqbi_queue.h>
 #include <mqbnet_tcpsessionfactory.h>
 #include <mqbstat_brokerstats.h>
+#include <mqbu_flowcontroller.h>
 #include <mqbu_messageguidutil.h>
 
 // BMQ
@@ -377,6 +378,7 @@ ClientSessionState::ClientSessionState(
     bslma::Allocator*                          allocator)
 : d_allocator_p(allocator)
 , d_channelBufferQueue(allocator)
+, d_channelBufferQueueBytes(0)
 , d_unackedMessageInfos(d_allocator_p)
 , d_dispatcherClientData()
 , d_statContext_sp(clientStatContext)
@@ -494,7 +496,7 @@ void ClientSession::sendPacketDispatched(
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
         // If the channelBuffer is not empty, we can't send, we have to enqueue
         // to guarantee ordering of messages.
-        d_state.d_channelBufferQueue.push_back(blob);
+        enqueueToChannelBuffer(blob);
         return;  // RETURN
     }
 
@@ -507,7 +509,7 @@ void ClientSession::sendPacketDispatched(
         // If 'flush' wasn't able to send all the data, some might now be
         // buffered in the 'channelBufferQueue', so check for it again.
         if (!d_state.d_channelBufferQueue.empty()) {
-            d_state.d_channelBufferQueue.push_back(blob);
+            enqueueToChannelBuffer(blob);
             return;  // RETURN
         }
     }
@@ -531,7 +533,7 @@ void ClientSession::sendPacketDispatched(
                           << bmqu::PrintUtil::prettyNumber(blob->length())
                           << " bytes] to client due to channel watermark limit"
                           << "; enqueuing to the ChannelBufferQueue.";
-            d_state.d_channelBufferQueue.push_back(blob);
+            enqueueToChannelBuffer(blob);
         }
         else {
             BALL_LOG_INFO << "#CLIENT_SEND_FAILURE " << description()
@@ -542,6 +544,18 @@ void ClientSession::sendPacketDispatched(
     }
 }
 
+void ClientSession::enqueueToChannelBuffer(
+    const bsl::shared_ptr<bdlbb::Blob>& blob)
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    d_state.d_channelBufferQueue.push_back(blob);
+    d_state.d_channelBufferQueueBytes += blob->length();
+}
+
 void ClientSession::flushChannelBufferQueue()
 {
     // executed by the *CLIENT* dispatcher thread
@@ -555,7 +569,10 @@ void ClientSession::flushChannelBufferQueue()
     }
 
     BALL_LOG_INFO << description() << ": Flushing ChannelBufferQueue ("
-                  << d_state.d_channelBufferQueue.size() << " items)";
+                  << d_state.d_channelBufferQueue.size() << " items, "
+                  << bmqu::PrintUtil::prettyBytes(
+                         d_state.d_channelBufferQueueBytes)
+                  << ")";
 
     // Try to send as many data as possible
     while (!d_state.d_channelBufferQueue.empty()) {
@@ -571,9 +588,14 @@ void ClientSession::flushChannelBufferQueue()
                 << "#CLIENT_SEND_FAILURE " << description()
                 << ": Failed to send data to client due to channel "
                 << "watermark limit while flushing ChannelBufferQueue"
-                   "; will continue later";
+                << "; will continue later ("
+                << d_state.d_channelBufferQueue.size() << " items, "
+                << bmqu::PrintUtil::prettyBytes(
+                       d_state.d_channelBufferQueueBytes)
+                << " remaining)";
             break;  // BREAK
         }
+        d_state.d_channelBufferQueueBytes -= blob_sp->length();
         d_state.d_channelBufferQueue.pop_front();
     }
 }
@@ -660,6 +682,13 @@ void ClientSession::sendAck(bmqt::AckResult::Enum    status,
                        << "' (id: " << queueId << ")]";
     }
 
+    // ACKs are coalesced: the builder is only sent once it reaches the nagle
+    // size, or when the dispatcher flushes this client at the end of the
+    // batch of events it is processing (see 'flush').  A burst of ACKs from
+    // the queue dispatcher therefore already results in few, large, ACK
+    // events, without an additional timer which would delay them when the
+    // load is low.  Cumulative ACK ranges are not possible: GUIDs are not
+    // sequential and each ACK carries the producer's own correlationId.
     if (d_state.d_ackBuilder.eventSize() >= k_NAGLE_PACKET_SIZE) {
         flush();
     }
@@ -1824,6 +1853,35 @@ void ClientSession::onPushEvent(const mqbevt::PushEvent& event)
         }
     }
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+            !bmqp::ProtocolUtil::isCompressionAlgorithmSupported(
+                d_compressionAlgorithms,
+                cat))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The client does not support the compression algorithm of this
+        // message (it was posted by a newer client): deliver it decompressed.
+        int messagePropertiesSize = 0;
+
+        BSLS_ASSERT_SAFE(buffer.length() == 0);
+        convertingRc = bmqp::ProtocolUtil::parse(
+            0,  // decompress the properties along with the data
+            &messagePropertiesSize,
+            &buffer,
+            *blob,
+            blob->length(),
+            true,  // decompress
+            bmqu::BlobPosition(),
+            pushProperties.isPresent(),
+            pushProperties.isExtended(),
+            cat,
+            d_state.d_bufferFactory_p,
+            d_state.d_allocator_p);
+
+        cat  = bmqt::CompressionAlgorithmType::e_NONE;
+        blob = &buffer;
+    }
+
     if (convertingRc == 0) {
         int flags = 0;
 
@@ -2386,6 +2444,38 @@ bool ClientSession::validatePutMessage(QueueState**   queueState,
         ackDescription = "putEvent::unsetGUID";
     }
 
+    if (ackStatus == bmqt::AckResult::e_SUCCESS && isFirstHop) {
+        // Enforce the 'maxPutRate' of the domain on the PUT messages posted
+        // by this producer.  Proxies and cluster nodes aggregate the PUT
+        // messages of many producers, so they are not limited: the limit is
+        // only enforced by the broker a producer is directly connected to.
+        mqbu::FlowController& limiter = (*queueState)->d_putRateLimiter;
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                limiter.config().policy() ==
+                mqbu::FlowController::Policy::e_LIMIT)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            limiter.update(bmqu::Time::highResolutionTimer() /
+                               bdlt::TimeUnitRatio::k_NS_PER_MS,
+                           0);
+            if (limiter.isFull()) {
+                if (d_state.d_throttledFailedPutMessages.requestPermission()) {
+                    BALL_LOG_WARN << "#CLIENT_PUT_RATE_LIMITED "
+                                  << description()
+                                  << ": PUT message for queue Id (" << queueId
+                                  << ") over the maxPutRate of the domain ("
+                                  << limiter.config().ratePerMs() << "/s)";
+                }
+
+                ackStatus      = bmqt::AckResult::e_LIMIT_MESSAGES;
+                ackDescription = "putEvent::rateLimited";
+            }
+            else {
+                limiter.add(QueueState::k_PUT_RATE_LIMITER_UNITS);
+            }
+        }
+    }
+
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(ackStatus !=
                                               bmqt::AckResult::e_SUCCESS)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
@@ -2438,6 +2528,8 @@ ClientSession::ClientSession(
       bmqp::MessagePropertiesFeatures::k_FIELD_NAME,
       bmqp::MessagePropertiesFeatures::k_MESSAGE_PROPERTIES_EX,
       d_clientIdentity_p->features()))
+, d_compressionAlgorithms(bmqp::ProtocolUtil::compressionAlgorithms(
+      d_clientIdentity_p->features()))
 , d_description(sessionDescription, allocator)
 , d_channel_sp(channel)
 , d_state(clientStatContext,
@@ -2938,6 +3030,19 @@ void ClientSession::flush()
     }
 }
 
+void ClientSession::onDispatcherCpuTime(bsls::Types::Int64 cpuTimeNs)
+{
+    // executed by the *CLIENT* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    if (d_state.d_statContext_sp) {
+        mqbstat::QueueStatsClient::onCpuTime(d_state.d_statContext_sp.get(),
+                                             cpuTimeNs);
+    }
+}
+
 void ClientSession::processClusterMessage(
     const bmqp_ctrlmsg::ControlMessage& message)
 {
@@ -170,6 +170,9 @@ struct ClientSessionState {
     /// a queue and not a deque, but queue doesn't have a `clear` method.
     bsl::deque<bsl::shared_ptr<bdlbb::Blob> > d_channelBufferQueue;
 
+    /// Total size, in bytes, of the blobs in `d_channelBufferQueue`.
+    bsls::Types::Int64 d_channelBufferQueueBytes;
+
     /// Map containing the GUID->UnackedMessageInfo entries.
     UnackedMessageInfoMap d_unackedMessageInfos;
 
@@ -334,6 +337,12 @@ class ClientSession : public mqbnet::Session,
     /// Note: remove when support for legacy message properties is dropped.
     const bool d_supportsMessagePropertiesEX;
 
+    /// Mask of the compression algorithms that the client supports, as
+    /// returned by `bmqp::ProtocolUtil::compressionAlgorithms`.  This mask is
+    /// evaluated once and cached in this variable to speed up the PUSH
+    /// processing path.
+    const int d_compressionAlgorithms;
+
     /// Short identifier for this session.
     bsl::string d_description;
 
@@ -390,6 +399,9 @@ class ClientSession : public mqbnet::Session,
     void sendPacketDispatched(const bsl::shared_ptr<bdlbb::Blob>& blob,
                               bool flushBuilders);
 
+    /// Append the specified `blob` to the internal `channelBufferQueue`.
+    void enqueueToChannelBuffer(const bsl::shared_ptr<bdlbb::Blob>& blob);
+
     /// Flush as much as possible of the content of the internal
     /// `channelBufferQueue`.
     void flushChannelBufferQueue();
@@ -650,6 +662,12 @@ class ClientSession : public mqbnet::Session,
     /// used to provide batch and nagling mechanism.
     void flush() BSLS_KEYWORD_OVERRIDE;
 
+    /// Called by the dispatcher to report the specified `cpuTimeNs`
+    /// nanoseconds of thread CPU time it spent processing events of this
+    /// session.
+    void onDispatcherCpuTime(bsls::Types::Int64 cpuTimeNs)
+        BSLS_KEYWORD_OVERRIDE;
+
     // MANIPULATORS
     //  (virtual: mqbnet::Session)
 
@@ -32,17 +32,20 @@
 // BDE
 #include <bdlma_localsequentialallocator.h>
 #include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
 #include <bsl_algorithm.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
 #include <bsl_fstream.h>
 #include <bsl_iostream.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 #include <bsla_annotations.h>
 #include <bslma_allocator.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_mutexassert.h>
 #include <bsls_assert.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace mqba {
@@ -90,6 +93,43 @@ void ConfigProvider::cacheAdd(bsl::string_view key, const bsl::string& config)
         bsl::make_pair(bsl::string(key, d_allocator_p), cacheEntry));
 }
 
+int ConfigProvider::readDomainConfig(bsl::string*     config,
+                                     bsl::ostream&    errorDescription,
+                                     bsl::string_view domainName)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS       = 0,
+        rc_FILENOTEXIST  = -1,
+        rc_FILENOTOPENED = -2
+    };
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(config);
+
+    bsl::string filePath = mqbcfg::BrokerConfig::get().etcDir() + "/domains/" +
+                           domainName + ".json";
+
+    if (!bdls::FilesystemUtil::exists(filePath)) {
+        errorDescription << "Domain file '" << filePath << "' doesn't exist";
+        return rc_FILENOTEXIST;  // RETURN
+    }
+
+    bsl::ifstream fileStream(filePath.c_str(), bsl::ios::in);
+    if (!fileStream) {
+        errorDescription << "Unable to open domain file '" << filePath << "'";
+        return rc_FILENOTOPENED;  // RETURN
+    }
+
+    fileStream.seekg(0, bsl::ios::end);
+    config->resize(fileStream.tellg());
+    fileStream.seekg(0, bsl::ios::beg);
+    fileStream.read(config->data(), config->size());
+    fileStream.close();
+
+    return rc_SUCCESS;
+}
+
 ConfigProvider::ConfigProvider(bslma::Allocator* allocator)
 : d_cache(allocator)
 , d_allocator_p(allocator)
@@ -106,6 +146,8 @@ int ConfigProvider::start(BSLA_MAYBE_UNUSED bsl::ostream& errorDescription)
 {
     BALL_LOG_INFO << "Starting ConfigProvider";
 
+    prefetchDomainConfigs();
+
     return 0;
 }
 
@@ -114,14 +156,57 @@ void ConfigProvider::stop()
     // NOTHING
 }
 
+int ConfigProvider::prefetchDomainConfigs()
+{
+    const bsls::Types::Int64 startTime = bmqu::Time::highResolutionTimer();
+
+    const bsl::string directory = mqbcfg::BrokerConfig::get().etcDir() +
+                                  "/domains";
+    bsl::vector<bsl::string> paths(d_allocator_p);
+    bdls::FilesystemUtil::findMatchingPaths(&paths,
+                                            (directory + "/*.json").c_str());
+
+    int numLoaded = 0;
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    for (bsl::vector<bsl::string>::const_iterator it = paths.begin();
+         it != paths.end();
+         ++it) {
+        bsl::string domainName(d_allocator_p);
+        if (bdls::PathUtil::getBasename(&domainName, *it) != 0 ||
+            !bmqu::StringUtil::endsWith(domainName, ".json")) {
+            continue;  // CONTINUE
+        }
+        domainName.resize(domainName.length() - (sizeof(".json") - 1));
+
+        bsl::string                           config(d_allocator_p);
+        bdlma::LocalSequentialAllocator<1024> localAllocator(d_allocator_p);
+        bmqu::MemOutStream                    errorOs(&localAllocator);
+        if (readDomainConfig(&config, errorOs, domainName) != 0) {
+            BALL_LOG_WARN << "Failed to prefetch config for domain '"
+                          << domainName << "': " << errorOs.str();
+            continue;  // CONTINUE
+        }
+
+        cacheAdd(domainName, config);
+        ++numLoaded;
+    }
+
+    guard.release()->unlock();  // UNLOCK
+
+    BALL_LOG_INFO << "Prefetched config of " << numLoaded
+                  << " domain(s) from '" << directory << "' in "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         bmqu::Time::highResolutionTimer() - startTime);
+
+    return numLoaded;
+}
+
 void ConfigProvider::getDomainConfig(bsl::string_view         domainName,
                                      const GetDomainConfigCb& callback)
 {
-    enum {
-        e_SUCCESS       = 0,
-        e_FILENOTEXIST  = -1,
-        e_FILENOTOPENED = -2,
-    };
+    enum { e_SUCCESS = 0 };
 
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
 
@@ -141,49 +226,25 @@ void ConfigProvider::getDomainConfig(bsl::string_view         domainName,
 
     // We don't have the config in the small cache ..
 
-    bsl::string filePath = mqbcfg::BrokerConfig::get().etcDir() + "/domains/" +
-                           domainName + ".json";
-
-    if (!bdls::FilesystemUtil::exists(filePath)) {
+    bdlma::LocalSequentialAllocator<1024> localAllocator(d_allocator_p);
+    bmqu::MemOutStream                    errorOs(&localAllocator);
+    const int rc = readDomainConfig(&config, errorOs, domainName);
+    if (rc != e_SUCCESS) {
         guard.release()->unlock();  // UNLOCK
 
-        bdlma::LocalSequentialAllocator<1024> localAllocator(d_allocator_p);
-        bmqu::MemOutStream                    os(&localAllocator);
-        os << "Domain file '" << filePath << "' doesn't exist";
-
         BALL_LOG_INFO << "Failed to retrieve config for domain '" << domainName
-                      << "' from file '" << filePath << "': " << os.str();
-        callback(e_FILENOTEXIST, os.str());
+                      << "': " << errorOs.str();
+        callback(rc, errorOs.str());
         return;  // RETURN
     }
 
-    bsl::ifstream fileStream(filePath.c_str(), bsl::ios::in);
-    if (!fileStream) {
-        guard.release()->unlock();  // UNLOCK
-
-        bdlma::LocalSequentialAllocator<1024> localAllocator(d_allocator_p);
-        bmqu::MemOutStream                    os(&localAllocator);
-        os << "Unable to open domain file '" << filePath << "'";
-
-        BALL_LOG_INFO << "Failed to retrieve config for domain '" << domainName
-                      << "' from file '" << filePath << "': " << os.str();
-        callback(e_FILENOTOPENED, os.str());
-        return;  // RETURN
-    }
-
-    fileStream.seekg(0, bsl::ios::end);
-    config.resize(fileStream.tellg());
-    fileStream.seekg(0, bsl::ios::beg);
-    fileStream.read(config.data(), config.size());
-    fileStream.close();
-
     // Insert the newly-found configuration into the cache.
     cacheAdd(domainName, config);
 
     guard.release()->unlock();  // UNLOCK
 
     BALL_LOG_INFO << "Retrieved config for domain '" << domainName
-                  << "' from file '" << filePath << "': '" << config << "'";
+                  << "' from file: '" << config << "'";
 
     callback(e_SUCCESS, config);
 }
@@ -136,6 +136,14 @@ class ConfigProvider {
     /// overwrite any existing entry with the specified `key` in the cache.
     void cacheAdd(bsl::string_view key, const bsl::string& config);
 
+    /// Read the configuration of the specified `domainName` from its file
+    /// in the `domains` directory of the broker's `etc` directory, and load
+    /// it into the specified `config`.  Return 0 on success, or a non-zero
+    /// value and populate the specified `errorDescription` otherwise.
+    int readDomainConfig(bsl::string*     config,
+                         bsl::ostream&    errorDescription,
+                         bsl::string_view domainName);
+
   private:
     // NOT IMPLEMENTED
     ConfigProvider(const ConfigProvider&) BSLS_CPP11_DELETED;
@@ -166,6 +174,14 @@ class ConfigProvider {
     /// Stop this component.
     void stop();
 
+    /// Load into the cache the configuration of every domain having a file
+    /// in the `domains` directory of the broker's `etc` directory, so that
+    /// the first opens of queues after a restart do not wait on a read of
+    /// their domain's file.  Return the number of configurations loaded.
+    /// Note that this is called by `start`, and that prefetched entries
+    /// expire like any other entry of the cache.
+    int prefetchDomainConfigs();
+
     /// Asynchronously get the configuration for the specified `domainName`
     /// and invoke the specified `callback` with the result.
     void getDomainConfig(bsl::string_view         domainName,
@@ -33,6 +33,7 @@
 #include <bdlf_bind.h>
 #include <bdlf_placeholder.h>
 #include <bdlmt_eventscheduler.h>
+#include <bdlt_timeunitratio.h>
 #include <bsl_cstddef.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
@@ -40,15 +41,78 @@
 #include <bsl_string.h>
 #include <bsla_annotations.h>
 #include <bslma_managedptr.h>
+#include <bslmt_latch.h>
 #include <bslmt_semaphore.h>
 #include <bslmt_threadattributes.h>
 #include <bslmt_threadutil.h>
+#include <bsls_platform.h>
 #include <bsls_systemclocktype.h>
 #include <bsls_timeinterval.h>
 
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <time.h>
+#endif
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace BloombergLP {
 namespace mqba {
 
+namespace {
+
+/// Return the CPU time (in nanoseconds) consumed so far by the calling
+/// thread, or 0 if it is not available on this platform.
+bsls::Types::Int64 threadCpuTime()
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    timespec now;
+    if (0 == ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now)) {
+        return static_cast<bsls::Types::Int64>(now.tv_sec) *
+                   bdlt::TimeUnitRatio::k_NS_PER_S +
+               now.tv_nsec;  // RETURN
+    }
+#endif
+    return 0;
+}
+
+/// Bind the calling thread, which is the processor with the specified
+/// `processorId` of the dispatcher of the specified `type`, to the specified
+/// `cpu`.
+void pinProcessorThread(mqbi::DispatcherClientType::Enum type,
+                        int                              processorId,
+                        int                              cpu)
+{
+    BALL_LOG_SET_CATEGORY("MQBA.DISPATCHER");
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu, &cpuSet);
+
+    const int rc = ::pthread_setaffinity_np(::pthread_self(),
+                                            sizeof(cpuSet),
+                                            &cpuSet);
+    if (rc == 0) {
+        BALL_LOG_INFO << "Pinned processor " << processorId << " of '" << type
+                      << "' dispatcher to CPU " << cpu;
+        return;  // RETURN
+    }
+
+    BALL_LOG_WARN << "Failed to pin processor " << processorId << " of '"
+                  << type << "' dispatcher to CPU " << cpu << " [rc: " << rc
+                  << "]";
+#else
+    BALL_LOG_WARN << "Not pinning processor " << processorId << " of '"
+                  << type << "' dispatcher to CPU " << cpu
+                  << ": thread affinity is not supported on this platform";
+#endif
+}
+
+}  // close unnamed namespace
+
 // -------------------------
 // class Dispatcher_Executor
 // -------------------------
@@ -153,6 +217,7 @@ Dispatcher::DispatcherContext::DispatcherContext(
 , d_eventSources(config.numProcessors(), allocator)
 , d_clientStatContext_mp()
 , d_statContexts(config.numProcessors(), allocator)
+, d_workStealing(config.workStealing())
 {
     typedef bsl::vector<bsl::shared_ptr<mqbi::DispatcherEventSource> >
         EventSources;
@@ -234,6 +299,17 @@ int Dispatcher::startContext(bsl::ostream&                    errorDescription,
         .setMonitorWarningTimeout(
             bsls::TimeInterval(d_config.warningTimeoutMs() / 1000.0));
 
+    if (config.maxBatchSize() > 1) {
+        processorPoolConfig.setBatchEventCallback(
+            bdlf::BindUtil::bind(
+                &Dispatcher::batchEventCallbackCreator,
+                this,
+                type,
+                bdlf::PlaceHolders::_1,   // queueId
+                bdlf::PlaceHolders::_2),  // lastProcessingStartTime
+            config.maxBatchSize());
+    }
+
     context->d_processorPool_mp.load(
         new (*d_allocator_p) ProcessorPool(processorPoolConfig, d_allocator_p),
         d_allocator_p);
@@ -249,6 +325,26 @@ int Dispatcher::startContext(bsl::ostream&                    errorDescription,
         return rc_PROCESSOR_POOL_START_FAILED;  // RETURN
     }
 
+    if (config.firstCpu() >= 0) {
+        // Each processor exclusively owns one thread of the pool, so pinning
+        // from within the processor pins that thread for good.
+        for (int i = 0; i < config.numProcessors(); ++i) {
+            bsl::shared_ptr<mqbevt::DispatcherEvent> event_sp =
+                d_defaultEventSource_sp->getEvent<mqbevt::DispatcherEvent>();
+            event_sp->callback().set(
+                bdlf::BindUtil::bind(&pinProcessorThread,
+                                     type,
+                                     i,
+                                     config.firstCpu() + i));
+
+            // C++03 compatibility:
+            bsl::shared_ptr<mqbi::DispatcherEvent> base_sp(
+                bslmf::MovableRefUtil::move(event_sp));
+
+            dispatchEvent(bslmf::MovableRefUtil::move(base_sp), type, i);
+        }
+    }
+
     return rc_SUCCESS;
 }
 
@@ -295,6 +391,7 @@ Dispatcher::Dispatcher(const mqbcfg::DispatcherConfig& config,
                        bslma::Allocator*               allocator)
 : d_allocator_p(allocator)
 , d_isStarted(false)
+, d_cpuAccounting(false)
 , d_config(config)
 , d_scheduler_p(scheduler)
 , d_contexts(allocator)
@@ -377,6 +474,14 @@ void Dispatcher::disableFlushClients()
     d_flushClientsGate.close();
 }
 
+void Dispatcher::setCpuAccounting(bool value)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(!d_isStarted);
+
+    d_cpuAccounting = value;
+}
+
 void Dispatcher::stop()
 {
     if (!d_isStarted) {
@@ -432,7 +537,20 @@ Dispatcher::registerClient(mqbi::DispatcherClient*           client,
 
         int processor = static_cast<int>(handle);
         if (handle == mqbi::Dispatcher::k_INVALID_PROCESSOR_HANDLE) {
+            const bool isNewClient =
+                client->dispatcherClientData().processorHandle() ==
+                mqbi::Dispatcher::k_INVALID_PROCESSOR_HANDLE;
+
             processor = context.d_loadBalancer.getProcessorForClient(client);
+            if (isNewClient && context.d_workStealing) {
+                const int thief = stealProcessor(&context, processor);
+                if (thief != processor) {
+                    context.d_loadBalancer.removeClient(client);
+                    context.d_loadBalancer.setProcessorForClient(client,
+                                                                 thief);
+                    processor = thief;
+                }
+            }
         }
         else {
             context.d_loadBalancer.setProcessorForClient(client, processor);
@@ -653,6 +771,39 @@ void Dispatcher::synchronize(mqbi::DispatcherClientType::Enum  type,
     semaphore.wait();
 }
 
+void Dispatcher::synchronizeAll(mqbi::DispatcherClientType::Enum type,
+                                bool                             skipIdle)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(type != mqbi::DispatcherClientType::e_UNDEFINED);
+
+    DispatcherContext& context       = *(d_contexts[type]);
+    ProcessorPool*     processorPool = context.d_processorPool_mp.get();
+    BSLS_ASSERT_SAFE(processorPool);
+
+    const int    numProcessors = processorPool->numQueues();
+    bslmt::Latch latch(numProcessors);
+    for (int i = 0; i < numProcessors; ++i) {
+        BSLS_ASSERT_SAFE(processorPool->queueThreadId(i) !=
+                         bslmt::ThreadUtil::selfId());  // Deadlock detection
+
+        if (skipIdle &&
+            0 == context.d_loadBalancer.clientsCountForProcessor(i)) {
+            latch.arrive();
+            continue;  // CONTINUE
+        }
+
+        bsl::shared_ptr<mqbevt::DispatcherEvent> event_sp =
+            d_defaultEventSource_sp->getEvent<mqbevt::DispatcherEvent>();
+        (*event_sp).setEnqueueTime(bmqu::Time::highResolutionTimer());
+        (*event_sp).setCallback(
+            bdlf::BindUtil::bind(&bslmt::Latch::arrive, &latch));
+        dispatchEvent(bslmf::MovableRefUtil::move(event_sp), type, i);
+    }
+
+    latch.wait();
+}
+
 bmqex::Executor
 Dispatcher::executor(const mqbi::DispatcherClient* client) const
 {
@@ -676,6 +827,37 @@ bsl::shared_ptr<mqbi::DispatcherEventSource> Dispatcher::createEventSource()
     return res;
 }
 
+int Dispatcher::stealProcessor(DispatcherContext* context, int processor)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(context);
+    BSLS_ASSERT_SAFE(context->d_processorPool_mp);
+
+    const ProcessorPool& pool = *context->d_processorPool_mp;
+
+    const bsls::Types::Int64 victimBacklog = pool.numElements(processor);
+    if (victimBacklog == 0) {
+        // The selected processor is idle, nothing to steal from.
+        return processor;  // RETURN
+    }
+
+    for (int i = 0; i < pool.numQueues(); ++i) {
+        if (i != processor && pool.numElements(i) == 0) {
+            BALL_LOG_DEBUG << "'" << pool.queueName(i)
+                           << "' takes over a new client from processor "
+                           << processor << " [backlog: " << victimBacklog
+                           << "]";
+
+            mqbstat::DispatcherStats::onSteal(
+                context->d_statContexts[i].get(),
+                victimBacklog);
+            return i;  // RETURN
+        }
+    }
+
+    return processor;
+}
+
 Dispatcher::ProcessorPool::EventFn
 Dispatcher::eventCallbackCreator(mqbi::DispatcherClientType::Enum type,
                                  int                              queueId,
@@ -688,7 +870,25 @@ Dispatcher::eventCallbackCreator(mqbi::DispatcherClientType::Enum type,
         d_contexts[type],
         bdlt::TimeUnitRatio::k_NS_PER_MS *
             static_cast<bsls::Types::Int64>(d_config.warningTimeoutMs()),
-        lastProcessingStartTime);
+        lastProcessingStartTime,
+        d_cpuAccounting);
+}
+
+Dispatcher::ProcessorPool::BatchEventFn
+Dispatcher::batchEventCallbackCreator(
+    mqbi::DispatcherClientType::Enum type,
+    int                              queueId,
+    bsls::AtomicInt64*               lastProcessingStartTime)
+{
+    return EventCallback(
+        type,
+        queueId,
+        &d_flushClientsGate,
+        d_contexts[type],
+        bdlt::TimeUnitRatio::k_NS_PER_MS *
+            static_cast<bsls::Types::Int64>(d_config.warningTimeoutMs()),
+        lastProcessingStartTime,
+        d_cpuAccounting);
 }
 
 // -------------------------------
@@ -701,7 +901,8 @@ mqba::Dispatcher::EventCallback::EventCallback(
     bmqu::GateKeeper*                            flushClientsGate_p,
     const mqba::Dispatcher::DispatcherContextSp& context_sp,
     bsls::Types::Int64                           warningTimeoutNs,
-    bsls::AtomicInt64*                           lastProcessingStartTime)
+    bsls::AtomicInt64*                           lastProcessingStartTime,
+    bool                                         cpuAccounting)
 : d_queueName(context_sp->d_processorPool_mp->queueName(queueId))
 , d_stats_sp(context_sp->d_statContexts[queueId])
 , d_flushClientsGate_p(flushClientsGate_p)
@@ -711,82 +912,131 @@ mqba::Dispatcher::EventCallback::EventCallback(
 , d_type(type)
 , d_queueId(queueId)
 , d_lastProcessingStartTime_p(lastProcessingStartTime)
+, d_cpuAccounting(cpuAccounting)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_flushClientsGate_p);
     BSLS_ASSERT_SAFE(d_lastProcessingStartTime_p);
 }
 
-void mqba::Dispatcher::EventCallback::operator()(
-    const mqbi::Dispatcher::DispatcherEventSp& event)
+bsls::Types::Int64 mqba::Dispatcher::EventCallback::processEvent(
+    const mqbi::Dispatcher::DispatcherEventSp& event,
+    bsls::Types::Int64                         processingStartTime)
 {
-    if (event) {
-        BALL_LOG_TRACE << "Dispatching Event to queue " << d_queueId << " of "
-                       << d_type << " dispatcher: " << *event;
-
-        const bsls::Types::Int64 processingStartTime =
-            bmqu::Time::highResolutionTimer();
-        d_lastProcessingStartTime_p->store(processingStartTime);
-
-        const bsls::Types::Int64 queuedTime = processingStartTime -
-                                              event->enqueueTime();
-
-        if (event->type() == mqbi::DispatcherEventType::e_DISPATCHER) {
-            const mqbevt::DispatcherEvent* realEvent =
-                event->the<mqbevt::DispatcherEvent>();
-
-            // We must flush now (and irrespective of a callback actually being
-            // set on the event) to ensure the flushList is empty before
-            // executing the callback: this dispatcher event may correspond to
-            // the destruction of the Client, and guaranteeing this client is
-            // not (and will not be added) to the flushList is actually the
-            // whole purpose of the 'e_DISPATCHER' event type.
-            flushClients();
-
-            if (!realEvent->callback().empty()) {
-                // A callback may not have been set if all we wanted was to
-                // execute the 'finalizeCallback' of the event.
-                realEvent->callback()();
-            }
-        }
-        else {
-            event->destination()->onDispatcherEvent(*event.get());
-            if (!event->destination()
-                     ->dispatcherClientData()
-                     .addedToFlushList()) {
-                d_flushList_p->emplace_back(event->destination());
-                event->destination()
-                    ->dispatcherClientData()
-                    .setAddedToFlushList(true);
-            }
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(event);
+
+    BALL_LOG_TRACE << "Dispatching Event to queue " << d_queueId << " of "
+                   << d_type << " dispatcher: " << *event;
+
+    d_lastProcessingStartTime_p->store(processingStartTime);
+
+    const bsls::Types::Int64 queuedTime = processingStartTime -
+                                          event->enqueueTime();
+
+    if (event->type() == mqbi::DispatcherEventType::e_DISPATCHER) {
+        const mqbevt::DispatcherEvent* realEvent =
+            event->the<mqbevt::DispatcherEvent>();
+
+        // We must flush now (and irrespective of a callback actually being
+        // set on the event) to ensure the flushList is empty before
+        // executing the callback: this dispatcher event may correspond to
+        // the destruction of the Client, and guaranteeing this client is
+        // not (and will not be added) to the flushList is actually the
+        // whole purpose of the 'e_DISPATCHER' event type.
+        flushClients();
+
+        if (!realEvent->callback().empty()) {
+            // A callback may not have been set if all we wanted was to
+            // execute the 'finalizeCallback' of the event.
+            realEvent->callback()();
         }
+    }
+    else {
+        mqbi::DispatcherClient* client = event->destination();
 
-        const bsls::Types::Int64 processingTime =
-            bmqu::Time::highResolutionTimer() - processingStartTime;
+        const bsls::Types::Int64 cpuStartTime = d_cpuAccounting
+                                                    ? threadCpuTime()
+                                                    : 0;
 
-        // Update stats
-        mqbstat::DispatcherStats::onDequeue(d_stats_sp.get(), queuedTime);
-        mqbstat::DispatcherStats::onProcess(d_stats_sp.get(),
-                                            event->type(),
-                                            processingTime);
-
-        d_lastProcessingStartTime_p->store(0);
-
-        if (processingTime > d_warningTimeoutNs) {
-            BALL_LOG_WARN << "Queue '" << d_queueName
-                          << "' has processed an event in "
-                          << bmqu::PrintUtil::prettyTimeInterval(
-                                 processingTime)
-                          << ". Current queue size: "
-                          << d_processorPool_p->numElements(d_queueId);
+        client->onDispatcherEvent(*event.get());
+
+        mqbi::DispatcherClientData& clientData =
+            client->dispatcherClientData();
+        if (d_cpuAccounting) {
+            // The CPU time is reported to the client when flushing it, so
+            // that it is reported at most once per batch of events.
+            clientData.setPendingCpuTime(clientData.pendingCpuTime() +
+                                         threadCpuTime() - cpuStartTime);
+        }
+        if (!clientData.addedToFlushList()) {
+            d_flushList_p->emplace_back(client);
+            clientData.setAddedToFlushList(true);
         }
     }
+
+    const bsls::Types::Int64 processingEndTime =
+        bmqu::Time::highResolutionTimer();
+    const bsls::Types::Int64 processingTime = processingEndTime -
+                                              processingStartTime;
+
+    // Update stats
+    mqbstat::DispatcherStats::onDequeue(d_stats_sp.get(), queuedTime);
+    mqbstat::DispatcherStats::onProcess(d_stats_sp.get(),
+                                        event->type(),
+                                        processingTime);
+
+    d_lastProcessingStartTime_p->store(0);
+
+    if (processingTime > d_warningTimeoutNs) {
+        BALL_LOG_WARN << "Queue '" << d_queueName
+                      << "' has processed an event in "
+                      << bmqu::PrintUtil::prettyTimeInterval(processingTime)
+                      << " after waiting "
+                      << bmqu::PrintUtil::prettyTimeInterval(queuedTime)
+                      << " in the queue. Current queue size: "
+                      << d_processorPool_p->numElements(d_queueId);
+    }
+
+    return processingEndTime;
+}
+
+void mqba::Dispatcher::EventCallback::operator()(
+    const mqbi::Dispatcher::DispatcherEventSp& event)
+{
+    if (event) {
+        processEvent(event, bmqu::Time::highResolutionTimer());
+    }
     else {
         // Empty `event` means queue is empty
         flushClients();
     }
 }
 
+void mqba::Dispatcher::EventCallback::operator()(
+    mqbi::Dispatcher::DispatcherEventSp* events,
+    int                                  numEvents)
+{
+    if (numEvents == 0) {
+        // No events means queue is empty
+        flushClients();
+        return;  // RETURN
+    }
+
+    // The end of the processing of an event is the start of the processing
+    // of the next one, which saves reading the timer twice per event.
+    bsls::Types::Int64 now = bmqu::Time::highResolutionTimer();
+    for (int i = 0; i < numEvents; ++i) {
+        now = processEvent(events[i], now);
+
+        // Release the event right away, as in the non-batched mode, so that
+        // its 'finalizeCallback' is not delayed by the rest of the batch.
+        events[i].reset();
+    }
+
+    flushClients();
+}
+
 void mqba::Dispatcher::EventCallback::flushClients()
 {
     // executed by the *DISPATCHER* thread
@@ -798,8 +1048,16 @@ void mqba::Dispatcher::EventCallback::flushClients()
     }
 
     for (size_t i = 0; i < d_flushList_p->size(); ++i) {
-        (*d_flushList_p)[i]->flush();
-        (*d_flushList_p)[i]->dispatcherClientData().setAddedToFlushList(false);
+        mqbi::DispatcherClient*     client = (*d_flushList_p)[i];
+        mqbi::DispatcherClientData& clientData =
+            client->dispatcherClientData();
+
+        if (clientData.pendingCpuTime() > 0) {
+            client->onDispatcherCpuTime(clientData.pendingCpuTime());
+            clientData.setPendingCpuTime(0);
+        }
+        client->flush();
+        clientData.setAddedToFlushList(false);
     }
     d_flushList_p->clear();
 }
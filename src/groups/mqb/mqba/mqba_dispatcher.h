@@ -43,6 +43,43 @@
 /// executor's associated processor thread results in the submitted functor to
 /// be executed in-place.  A call to `dispatch` from outside of the executor's
 /// associated processor thread is equivalent to a call to `post`.
+///
+/// Work stealing                                   {#mqba_dispatcher_stealing}
+/// =============
+///
+/// When `workStealing` is enabled in the
+/// @bbref{mqbcfg::DispatcherProcessorConfig} of a client type, a newly
+/// registered client which the load balancer would assign to a processor
+/// having pending events is instead assigned to an idle processor of the same
+/// type, if any.  Because a client is always executed by a single processor
+/// for as long as it is registered, the ordering of the events of each client
+/// is preserved.  Each steal is reported to the stat context of the processor
+/// taking over the client, along with the backlog of the peer it was taken
+/// from.
+///
+/// Batched processing                              {#mqba_dispatcher_batching}
+/// ==================
+///
+/// When `maxBatchSize` is greater than 1 in the
+/// @bbref{mqbcfg::DispatcherProcessorConfig} of a client type, each processor
+/// of that type drains up to `maxBatchSize` events per wakeup from its queue
+/// (see @bbref{bmqc::MultiQueueThreadPool}) and processes them in a row.  The
+/// clients added to the flush list by the events of a batch are flushed once
+/// at the end of the batch, bounding the flush latency under sustained load;
+/// with a `maxBatchSize` of 1, they are flushed only when the queue is found
+/// empty.
+///
+/// Thread pinning                                   {#mqba_dispatcher_pinning}
+/// ==============
+///
+/// When `firstCpu` is non-negative in the
+/// @bbref{mqbcfg::DispatcherProcessorConfig} of a client type, the thread of
+/// processor `i` of that type is bound to CPU `firstCpu + i` when the
+/// dispatcher starts (Linux only; elsewhere a warning is logged).  Giving
+/// each client type a contiguous range of CPUs of a single NUMA node keeps
+/// its processors, and the memory they first touch (such as the partitions
+/// served by the queue processors), on that node.  The default of -1 leaves
+/// the threads unpinned.
 
 // MQB
 #include <mqbcfg_messages.h>
@@ -201,6 +238,10 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
         /// processor.
         bsl::vector<bsl::shared_ptr<bmqst::StatContext> > d_statContexts;
 
+        /// Whether idle processors of this context take over newly
+        /// registered clients from their backlogged peers.
+        const bool d_workStealing;
+
         // TRAITS
         BSLMF_NESTED_TRAIT_DECLARATION(DispatcherContext,
                                        bslma::UsesBslmaAllocator)
@@ -251,11 +292,23 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
         /// used by the stuck-event monitor (held, not owned).
         bsls::AtomicInt64* d_lastProcessingStartTime_p;
 
+        /// Whether to measure the thread CPU time spent processing the
+        /// events of each client, and report it to the client.
+        const bool d_cpuAccounting;
+
         // PRIVATE MANIPULATORS
 
         /// Flush all clients in the flush list and clear it.
         void flushClients();
 
+        /// Dispatch the specified non-null `event` to its destination
+        /// client and update stats, using the specified
+        /// `processingStartTime` as the time at which its processing
+        /// started.  Return the time at which its processing ended.
+        bsls::Types::Int64
+        processEvent(const mqbi::Dispatcher::DispatcherEventSp& event,
+                     bsls::Types::Int64 processingStartTime);
+
       public:
         // CREATORS
 
@@ -265,14 +318,17 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
         /// flushing, the specified `context_sp` to obtain the flush list
         /// and stat context, and the specified
         /// `lastProcessingStartTime` to track event processing for the
-        /// stuck-event monitor.
+        /// stuck-event monitor.  Measure the thread CPU time spent
+        /// processing the events of each client if the specified
+        /// `cpuAccounting` is true.
         explicit EventCallback(
             mqbi::DispatcherClientType::Enum             type,
             int                                          queueId,
             bmqu::GateKeeper*                            flushClientsGate_p,
             const mqba::Dispatcher::DispatcherContextSp& context_sp,
             bsls::Types::Int64                           warningTimeoutNs,
-            bsls::AtomicInt64* lastProcessingStartTime);
+            bsls::AtomicInt64* lastProcessingStartTime,
+            bool               cpuAccounting);
 
         // MANIPULATORS
 
@@ -280,6 +336,13 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
         /// it to the destination client and update stats; otherwise flush
         /// all clients in the flush list.
         void operator()(const mqbi::Dispatcher::DispatcherEventSp& event);
+
+        /// Process the specified `numEvents` events starting at the
+        /// specified `events`, in order, releasing each of them once
+        /// processed, then flush all clients in the flush list.  A
+        /// `numEvents` of 0 means the queue is empty.
+        void operator()(mqbi::Dispatcher::DispatcherEventSp* events,
+                        int                                  numEvents);
     };
 
   private:
@@ -296,6 +359,10 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
     /// True if this component is started.
     bool d_isStarted;
 
+    /// True if the thread CPU time spent processing the events of each
+    /// client should be measured and reported to the client.
+    bool d_cpuAccounting;
+
     /// Configuration for the dispatcher.
     mqbcfg::DispatcherConfig d_config;
 
@@ -347,6 +414,14 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
                  int                                          processorId,
                  bslma::Allocator*                            allocator);
 
+    /// Return the processor which should be in charge of a newly
+    /// registered client of the specified `context`, given the specified
+    /// `processor` selected by the load balancer.  If work stealing is
+    /// enabled for `context`, and `processor` has a backlog of pending
+    /// events while another processor of the context is idle, return the
+    /// idle processor and update its stats; otherwise return `processor`.
+    int stealProcessor(DispatcherContext* context, int processor);
+
     /// Create an event callback for the processor having the specified
     /// `queueId` in charge of dispatcher clients of the specified `type`,
     /// using the specified `lastProcessingStartTime` to track event
@@ -356,6 +431,15 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
                          int                              queueId,
                          bsls::AtomicInt64* lastProcessingStartTime);
 
+    /// Create a batch event callback for the processor having the specified
+    /// `queueId` in charge of dispatcher clients of the specified `type`,
+    /// using the specified `lastProcessingStartTime` to track event
+    /// processing for the stuck-event monitor.
+    ProcessorPool::BatchEventFn
+    batchEventCallbackCreator(mqbi::DispatcherClientType::Enum type,
+                              int                              queueId,
+                              bsls::AtomicInt64* lastProcessingStartTime);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(Dispatcher, bslma::UsesBslmaAllocator)
@@ -383,6 +467,14 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
     /// @brief Stop calling `flush` on idle dispatcher clients.
     void disableFlushClients();
 
+    /// Set whether the thread CPU time spent processing the events of each
+    /// client is measured and reported to the client through
+    /// `mqbi::DispatcherClient::onDispatcherCpuTime`, to the specified
+    /// `value`.  The behavior is undefined unless this dispatcher is not
+    /// started.  Note that reading the thread CPU clock costs a system call
+    /// on most platforms, so this is disabled by default.
+    void setCpuAccounting(bool value);
+
     /// Stop the `Dispatcher`.
     void stop();
 
@@ -484,6 +576,16 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
                      mqbi::Dispatcher::ProcessorHandle handle)
         BSLS_KEYWORD_OVERRIDE;
 
+    /// Enqueue an event to every processor in charge of clients of the
+    /// specified `type` and block until all of them have dequeued it,
+    /// skipping the processors having no registered client if the
+    /// optionally specified `skipIdle` is `true`.  Completion is counted
+    /// down on a single latch, so that the processors are waited for
+    /// concurrently.  The behavior is undefined if `synchronizeAll` is
+    /// being invoked from one of these processors.
+    void synchronizeAll(mqbi::DispatcherClientType::Enum type,
+                        bool skipIdle = false) BSLS_KEYWORD_OVERRIDE;
+
     // ACCESSORS
 
     /// Return number of processors dedicated for dispatching clients of the
@@ -36,9 +36,15 @@
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
+#include <bsls_platform.h>
 #include <bsls_systemclocktype.h>
 #include <bsls_timeutil.h>
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 // TEST DRIVER
 #include <bmqtst_testhelper.h>
 
@@ -694,6 +700,290 @@ static void test5_executeOnAllQueues()
     eventScheduler.stop();
 }
 
+static void test6_workStealing()
+// ------------------------------------------------------------------------
+// WORK STEALING
+//
+// Concerns:
+//   - When work stealing is disabled, a new client is assigned to the
+//     processor selected by the load balancer, even if it is backlogged.
+//   - When work stealing is enabled, a new client which would be assigned
+//     to a backlogged processor is assigned to an idle one instead.
+//
+// Plan:
+//   - Create a dispatcher with two queue processors.
+//   - Register two clients, one on each processor.
+//   - Block the first processor and enqueue one more event to it.
+//   - Register a third client, and verify the processor it is assigned to.
+//
+// Testing:
+//   mqba::Dispatcher::registerClient
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("WORK STEALING");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    // Create and start scheduler
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         alloc);
+    eventScheduler.start();
+
+    for (int workStealing = 0; workStealing < 2; ++workStealing) {
+        PVV("workStealing: " << workStealing);
+
+        mqbcfg::DispatcherConfig config = makeConfig();
+        config.queues().numProcessors() = 2;
+        config.queues().workStealing()  = (workStealing == 1);
+
+        // Create Dispatcher
+        bsl::shared_ptr<bmqst::StatContext> statContext =
+            mqbstat::DispatcherStatsUtil::initializeStatContext(0, alloc);
+        mqba::Dispatcher dispatcher(config,
+                                    statContext.get(),
+                                    &eventScheduler,
+                                    alloc);
+
+        bsl::stringstream startErr(alloc);
+        const int         rc = dispatcher.start(startErr);
+        BMQTST_ASSERT_EQ(rc, 0);
+
+        TestDispatcherClient client1(&dispatcher);
+        TestDispatcherClient client2(&dispatcher);
+        TestDispatcherClient client3(&dispatcher);
+
+        BMQTST_ASSERT_EQ(
+            dispatcher.registerClient(&client1,
+                                      mqbi::DispatcherClientType::e_QUEUE),
+            0);
+        BMQTST_ASSERT_EQ(
+            dispatcher.registerClient(&client2,
+                                      mqbi::DispatcherClientType::e_QUEUE),
+            1);
+
+        typedef void (bslmt::Semaphore::*PostFn)();
+
+        // Block the processor of 'client1' and give it a backlog
+        bslmt::Semaphore startedSignal;
+        bslmt::Semaphore continueSignal;
+        dispatcher.execute(bdlf::BindUtil::bindS(alloc,
+                                                 Synchronize(),
+                                                 &startedSignal,
+                                                 &continueSignal),
+                           &client1,
+                           mqbi::DispatcherEventType::e_DISPATCHER);
+        startedSignal.wait();
+        dispatcher.execute(
+            bdlf::BindUtil::bindS(
+                alloc,
+                static_cast<PostFn>(&bslmt::Semaphore::post),
+                &startedSignal),
+            &client1,
+            mqbi::DispatcherEventType::e_DISPATCHER);
+        BMQTST_ASSERT_GT(dispatcher.numProcessorEvents(&client1), 0);
+
+        // Both processors have one client: the load balancer selects the
+        // first (backlogged) one, unless the second (idle) one steals it.
+        const mqbi::Dispatcher::ProcessorHandle handle =
+            dispatcher.registerClient(&client3,
+                                      mqbi::DispatcherClientType::e_QUEUE);
+        BMQTST_ASSERT_EQ(handle, workStealing ? 1 : 0);
+        BMQTST_ASSERT_EQ(client3.dispatcherClientData().processorHandle(),
+                         handle);
+
+        continueSignal.post();
+        startedSignal.wait();
+
+        dispatcher.unregisterClient(&client3);
+        dispatcher.unregisterClient(&client2);
+        dispatcher.unregisterClient(&client1);
+        dispatcher.stop();
+    }
+
+    eventScheduler.stop();
+}
+
+static void test7_threadPinning()
+// ------------------------------------------------------------------------
+// THREAD PINNING
+//
+// Concerns:
+//   - When 'firstCpu' is set, each processor thread of the client type is
+//     bound to its CPU before it processes any client event.
+//
+// Plan:
+//   - Create a dispatcher with one queue processor, pinned to the first CPU
+//     this process may run on.
+//   - Execute an event on that processor and load the affinity of the
+//     processor thread.
+//
+// Testing:
+//   mqba::Dispatcher::start
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("THREAD PINNING");
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    BMQTST_ASSERT_EQ(
+        ::pthread_getaffinity_np(::pthread_self(), sizeof(allowed), &allowed),
+        0);
+    int cpu = 0;
+    while (cpu < CPU_SETSIZE && !CPU_ISSET(cpu, &allowed)) {
+        ++cpu;
+    }
+    BMQTST_ASSERT_LT(cpu, CPU_SETSIZE);
+
+    // Create and start scheduler
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         alloc);
+    eventScheduler.start();
+
+    mqbcfg::DispatcherConfig config = makeConfig();
+    config.queues().numProcessors() = 1;
+    config.queues().firstCpu()      = cpu;
+
+    // Create Dispatcher
+    bsl::shared_ptr<bmqst::StatContext> statContext =
+        mqbstat::DispatcherStatsUtil::initializeStatContext(0, alloc);
+    mqba::Dispatcher dispatcher(config,
+                                statContext.get(),
+                                &eventScheduler,
+                                alloc);
+
+    bsl::stringstream startErr(alloc);
+    const int         rc = dispatcher.start(startErr);
+    BMQTST_ASSERT_EQ(rc, 0);
+
+    TestDispatcherClient client(&dispatcher);
+    dispatcher.registerClient(&client, mqbi::DispatcherClientType::e_QUEUE);
+
+    struct Local {
+        static void loadAffinity(cpu_set_t* affinity, bslmt::Semaphore* done)
+        {
+            CPU_ZERO(affinity);
+            ::pthread_getaffinity_np(::pthread_self(),
+                                     sizeof(*affinity),
+                                     affinity);
+            done->post();
+        }
+    };
+
+    cpu_set_t        affinity;
+    bslmt::Semaphore done;
+    dispatcher.execute(
+        bdlf::BindUtil::bindS(alloc, &Local::loadAffinity, &affinity, &done),
+        &client,
+        mqbi::DispatcherEventType::e_DISPATCHER);
+    done.wait();
+
+    BMQTST_ASSERT_EQ(CPU_COUNT(&affinity), 1);
+    BMQTST_ASSERT(CPU_ISSET(cpu, &affinity));
+
+    dispatcher.unregisterClient(&client);
+    dispatcher.stop();
+
+    eventScheduler.stop();
+#endif
+}
+
+static void test8_synchronizeAll()
+// ------------------------------------------------------------------------
+// SYNCHRONIZE ALL
+//
+// Concerns:
+//   - 'synchronizeAll' returns only once every processor of the client
+//     type has processed the events enqueued to it before the call.
+//   - With 'skipIdle', processors having no registered client are not
+//     waited for.
+//
+// Plan:
+//   - Create a dispatcher with two queue processors, and register one
+//     client on each of them.
+//   - Enqueue an event to each client and verify both have been executed
+//     when 'synchronizeAll' returns.
+//   - Block the second processor, unregister its client, and verify that
+//     'synchronizeAll' with 'skipIdle' returns while it is still blocked.
+//
+// Testing:
+//   mqba::Dispatcher::synchronizeAll
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("SYNCHRONIZE ALL");
+
+    bslma::Allocator* alloc = bmqtst::TestHelperUtil::allocator();
+
+    // Create and start scheduler
+    bdlmt::EventScheduler eventScheduler(bsls::SystemClockType::e_MONOTONIC,
+                                         alloc);
+    eventScheduler.start();
+
+    mqbcfg::DispatcherConfig config = makeConfig();
+    config.queues().numProcessors() = 2;
+
+    // Create Dispatcher
+    bsl::shared_ptr<bmqst::StatContext> statContext =
+        mqbstat::DispatcherStatsUtil::initializeStatContext(0, alloc);
+    mqba::Dispatcher dispatcher(config,
+                                statContext.get(),
+                                &eventScheduler,
+                                alloc);
+
+    bsl::stringstream startErr(alloc);
+    const int         rc = dispatcher.start(startErr);
+    BMQTST_ASSERT_EQ(rc, 0);
+
+    TestDispatcherClient client1(&dispatcher);
+    TestDispatcherClient client2(&dispatcher);
+    dispatcher.registerClient(&client1, mqbi::DispatcherClientType::e_QUEUE);
+    dispatcher.registerClient(&client2, mqbi::DispatcherClientType::e_QUEUE);
+    BMQTST_ASSERT_NE(client1.dispatcherClientData().processorHandle(),
+                     client2.dispatcherClientData().processorHandle());
+
+    struct Local {
+        static void increment(bsls::AtomicInt* counter) { ++(*counter); }
+    };
+
+    bsls::AtomicInt counter(0);
+    dispatcher.execute(
+        bdlf::BindUtil::bindS(alloc, &Local::increment, &counter),
+        &client1,
+        mqbi::DispatcherEventType::e_DISPATCHER);
+    dispatcher.execute(
+        bdlf::BindUtil::bindS(alloc, &Local::increment, &counter),
+        &client2,
+        mqbi::DispatcherEventType::e_DISPATCHER);
+
+    dispatcher.synchronizeAll(mqbi::DispatcherClientType::e_QUEUE);
+    BMQTST_ASSERT_EQ(counter, 2);
+
+    // Block the processor of 'client2', which then has no client left
+    bslmt::Semaphore startedSignal;
+    bslmt::Semaphore continueSignal;
+    dispatcher.execute(bdlf::BindUtil::bindS(alloc,
+                                             Synchronize(),
+                                             &startedSignal,
+                                             &continueSignal),
+                       &client2,
+                       mqbi::DispatcherEventType::e_DISPATCHER);
+    startedSignal.wait();
+    dispatcher.unregisterClient(&client2);
+
+    dispatcher.synchronizeAll(mqbi::DispatcherClientType::e_QUEUE,
+                              true);  // skipIdle
+
+    continueSignal.post();
+    dispatcher.synchronizeAll(mqbi::DispatcherClientType::e_QUEUE);
+
+    dispatcher.unregisterClient(&client1);
+    dispatcher.stop();
+
+    eventScheduler.stop();
+}
+
 static void testN1_inDispatcherThread()
 {
     const size_t k_ITERS_NUM = 10000000;
@@ -779,6 +1069,9 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 8: test8_synchronizeAll(); break;
+    case 7: test7_threadPinning(); break;
+    case 6: test6_workStealing(); break;
     case 5: test5_executeOnAllQueues(); break;
     case 4: test4_eventSource(); break;
     case 3: test3_executorsSupport(); break;
@@ -24,6 +24,15 @@
 //@DESCRIPTION: 'mqba::DispatcherEventSource' provides an implementation of
 // the 'mqbi::DispatcherEventSource' interface using object pools to
 // efficiently manage dispatcher event allocation.
+//
+// Each event type has its own 'bdlcc::SharedObjectPool', which allocates the
+// event together with its shared pointer representation, and recycles both
+// (after resetting the event) once the last reference is released.  In the
+// steady state, obtaining and releasing an event therefore does not allocate
+// memory, and the events handed out by this source need no further pooling.
+// The memory held by the pools is reported under the allocator supplied at
+// construction, which is a counting allocator when the source is created by
+// the broker.
 
 // MQB
 #include <mqbevt_ackevent.h>
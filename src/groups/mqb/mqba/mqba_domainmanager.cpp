@@ -50,7 +50,8 @@
 #include <bsla_annotations.h>
 #include <bslma_allocator.h>
 #include <bslmt_latch.h>
-#include <bslmt_lockguard.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_writelockguard.h>
 #include <bsls_assert.h>
 #include <bsls_systemtime.h>
 #include <bsls_timeinterval.h>
@@ -347,12 +348,12 @@ DomainManager::upsertDomain(UpsertDomainValue*             out,
                             bsl::shared_ptr<mqbi::Cluster> cluster)
 {
     // Enter 'single-threaded' configuration part
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // mutex LOCKED
+    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);  // LOCK
 
     // Make sure the domain is not already configured
     // - - - - - - - - - - - - - - - - - - - - - - -
     // Check that the domain was not already added (while waiting on the
-    // response, or the mutex, ...)
+    // response, or the lock, ...)
     DomainSpMap::const_iterator it = d_domains.find(domain);
 
     DomainSp domainSp;
@@ -536,7 +537,7 @@ void DomainManager::stop()
 
     d_isStarted = false;
 
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // mutex LOCKED
+    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);  // LOCK
 
     BALL_LOG_INFO << "Stopping " << d_domains.size() << " domains";
 
@@ -592,7 +593,7 @@ int DomainManager::locateDomain(DomainSp*          domain,
         rc_DOMAIN_NOT_FOUND = -1
     };
 
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // mutex LOCKED
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);  // LOCK
 
     DomainSpMap::const_iterator it = d_domains.find(domainName);
     if (it == d_domains.end()) {
@@ -835,7 +836,7 @@ int DomainManager::removeDomain(const bsl::string& domainName)
         rc_DOMAIN_NOT_FOUND = -1
     };
 
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // mutex LOCKED
+    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);  // LOCK
 
     DomainSpMap::const_iterator it = d_domains.find(domainName);
 
@@ -884,8 +885,9 @@ void DomainManager::createDomain(
 
 mqbi::Domain* DomainManager::getDomain(const bsl::string& name) const
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // mutex LOCKED
-    DomainSpMap::const_iterator    it = d_domains.find(name);
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);  // LOCK
+
+    DomainSpMap::const_iterator it = d_domains.find(name);
     return it == d_domains.end() ? 0 : it->second.get();
 }
 
@@ -52,7 +52,7 @@
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
-#include <bslmt_mutex.h>
+#include <bslmt_readerwritermutex.h>
 #include <bsls_atomic.h>
 #include <bsls_cpp11.h>
 
@@ -178,10 +178,13 @@ class DomainManager BSLS_CPP11_FINAL : public mqbi::DomainFactory {
     /// Dispatcher to use, held not owned.
     mqbi::Dispatcher* d_dispatcher_p;
 
-    /// Mutex for thread-safety of this component.
-    mutable bslmt::Mutex d_mutex;
+    /// Lock protecting `d_domains`.  Lookups, which happen for every queue
+    /// open request, only acquire it for reading so that they do not
+    /// contend with each other; insertions and removals acquire it for
+    /// writing.
+    mutable bslmt::ReaderWriterMutex d_lock;
 
-    /// Map of domains.
+    /// Map of domains.  Protected by `d_lock`.
     DomainSpMap d_domains;
 
     /// Is the domain manager started.
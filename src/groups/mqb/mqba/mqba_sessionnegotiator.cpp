@@ -115,6 +115,8 @@ void loadBrokerIdentity(bmqp_ctrlmsg::ClientIdentity* identity,
         .append(bmqp::EncodingFeature::k_ENCODING_BER)
         .append(",")
         .append(bmqp::EncodingFeature::k_ENCODING_JSON)
+        .append(",")
+        .append(bmqp::EncodingFeature::k_ENCODING_COMPACT)
         .append(";")
         .append(bmqp::HighAvailabilityFeatures::k_FIELD_NAME)
         .append(":")
@@ -146,6 +148,24 @@ void loadBrokerIdentity(bmqp_ctrlmsg::ClientIdentity* identity,
         }
     }
 
+    if (mqbcfg::BrokerConfig::get().advertiseCompressionAlgorithms()) {
+        // Advertise support for the compression algorithms other than ZLIB
+        features.append(";")
+            .append(bmqp::CompressionFeatures::k_FIELD_NAME)
+            .append(":")
+            .append(bmqp::CompressionFeatures::k_LZ4)
+            .append(",")
+            .append(bmqp::CompressionFeatures::k_ZSTD);
+    }
+
+    if (mqbcfg::BrokerConfig::get().advertiseTraceContext()) {
+        // Advertise support for the trace context option on PUT messages
+        features.append(";")
+            .append(bmqp::TracingFeatures::k_FIELD_NAME)
+            .append(":")
+            .append(bmqp::TracingFeatures::k_TRACE_CONTEXT);
+    }
+
     // Hardcode broker SDK version to distinguish from versioned clients.
     const int brokerSdkVersion = 999999;
 
@@ -34,6 +34,8 @@
 #include <ball_log.h>
 #include <bdlb_nullablevalue.h>
 #include <bdlb_string.h>
+#include <bsl_algorithm.h>
+#include <bsl_optional.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_string_view.h>
@@ -41,6 +43,9 @@
 #include <bsl_unordered_set.h>
 #include <bsl_vector.h>
 #include <bslmf_movableref.h>
+#include <bslmt_lockguard.h>
+#include <bsls_keyword.h>
+#include <bsls_systemtime.h>
 
 namespace BloombergLP {
 namespace mqbauthn {
@@ -57,6 +62,46 @@ inline bsl::string normalizeMechanism(bsl::string_view  mech,
     return out;
 }
 
+/// Maximum number of results kept in the result cache.  Expired entries are
+/// purged when it is reached, and the cache is cleared if that is not enough.
+const size_t k_MAX_CACHED_RESULTS = 100000;
+
+// ================================
+// class CachedAuthenticationResult
+// ================================
+
+/// Authentication result served from the result cache: the principal of the
+/// original result, with its lifetime reduced by the time spent in the cache.
+class CachedAuthenticationResult : public mqbplug::AuthenticationResult {
+  private:
+    // DATA
+    bsl::string                        d_principal;
+    bsl::optional<bsls::Types::Uint64> d_lifetimeMs;
+
+  public:
+    // CREATORS
+    CachedAuthenticationResult(
+        bsl::string_view                          principal,
+        const bsl::optional<bsls::Types::Uint64>& lifetimeMs,
+        bslma::Allocator*                         allocator)
+    : d_principal(principal, allocator)
+    , d_lifetimeMs(lifetimeMs)
+    {
+    }
+
+    // ACCESSORS
+    bsl::string_view principal() const BSLS_KEYWORD_OVERRIDE
+    {
+        return d_principal;
+    }
+
+    const bsl::optional<bsls::Types::Uint64>&
+    lifetimeMs() const BSLS_KEYWORD_OVERRIDE
+    {
+        return d_lifetimeMs;
+    }
+};
+
 }  // close unnamed namespace
 
 // ------------------------------
@@ -456,6 +501,115 @@ int AuthenticationController::initializeCredentialProvider(
     return rc_SUCCESS;
 }
 
+bool AuthenticationController::lookupCachedResult(
+    bsl::shared_ptr<mqbplug::AuthenticationResult>* result,
+    const bsl::string&                              key,
+    bslma::Allocator*                               allocator)
+{
+    // executed by an *AUTHENTICATION* thread
+
+    const bsls::TimeInterval now = bsls::SystemTime::nowMonotonicClock();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_resultCacheMutex);  // LOCK
+
+    ResultCache::iterator it = d_resultCache.find(key);
+    if (it == d_resultCache.end()) {
+        return false;  // RETURN
+    }
+
+    if (it->second.d_expirationTime <= now) {
+        d_resultCache.erase(it);
+        return false;  // RETURN
+    }
+
+    const CachedResult&                cached     = it->second;
+    bsl::optional<bsls::Types::Uint64> lifetimeMs =
+        cached.d_result_sp->lifetimeMs();
+    if (lifetimeMs.has_value()) {
+        const bsls::Types::Uint64 elapsedMs = static_cast<bsls::Types::Uint64>(
+            (now - cached.d_insertionTime).totalMilliseconds());
+        lifetimeMs = lifetimeMs.value() > elapsedMs
+                         ? lifetimeMs.value() - elapsedMs
+                         : 0;
+    }
+
+    *result = bsl::allocate_shared<CachedAuthenticationResult>(
+        allocator,
+        cached.d_result_sp->principal(),
+        lifetimeMs,
+        allocator);
+
+    return true;
+}
+
+void AuthenticationController::cacheResult(
+    const bsl::string&                                    key,
+    const bsl::shared_ptr<mqbplug::AuthenticationResult>& result)
+{
+    // executed by an *AUTHENTICATION* thread
+
+    if (!result) {
+        return;  // RETURN
+    }
+
+    CachedResult cached;
+    cached.d_result_sp      = result;
+    cached.d_insertionTime  = bsls::SystemTime::nowMonotonicClock();
+    cached.d_expirationTime = cached.d_insertionTime + d_cacheTimeout;
+    if (result->lifetimeMs().has_value()) {
+        bsls::TimeInterval lifetime;
+        lifetime.setTotalMilliseconds(
+            static_cast<bsls::Types::Int64>(result->lifetimeMs().value()));
+        cached.d_expirationTime = bsl::min(cached.d_expirationTime,
+                                           cached.d_insertionTime + lifetime);
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_resultCacheMutex);  // LOCK
+
+    if (d_resultCache.size() >= k_MAX_CACHED_RESULTS) {
+        for (ResultCache::iterator it = d_resultCache.begin();
+             it != d_resultCache.end();) {
+            if (it->second.d_expirationTime <= cached.d_insertionTime) {
+                it = d_resultCache.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+
+        if (d_resultCache.size() >= k_MAX_CACHED_RESULTS) {
+            BALL_LOG_WARN << "AuthenticationController: result cache is "
+                          << "full (" << d_resultCache.size()
+                          << " entries), clearing it";
+            d_resultCache.clear();
+        }
+    }
+
+    d_resultCache[key] = cached;
+}
+
+// PRIVATE ACCESSORS
+bsl::string
+AuthenticationController::cacheKey(const bsl::string&                 mechanism,
+                                   const mqbplug::AuthenticationData& input) const
+{
+    // The client address is a 'host:port' URI: only the host is part of the
+    // key, so that a client reconnecting from another port hits the cache.
+    bsl::string_view host = input.clientIpAddress();
+    const size_t     pos  = host.rfind(':');
+    if (pos != bsl::string_view::npos) {
+        host = host.substr(0, pos);
+    }
+
+    bsl::string key(mechanism, d_allocator_p);
+    key.append(1, '\0');
+    key.append(host.begin(), host.end());
+    key.append(1, '\0');
+    key.append(input.authnPayload().begin(), input.authnPayload().end());
+
+    return key;
+}
+
 // CREATORS
 AuthenticationController::AuthenticationController(
     mqbplug::PluginManager* pluginManager,
@@ -466,6 +620,9 @@ AuthenticationController::AuthenticationController(
 , d_pluginManager_p(pluginManager)
 , d_credentialProvider_mp()
 , d_credentialCb()
+, d_cacheTimeout()
+, d_resultCache(allocator)
+, d_resultCacheMutex()
 , d_isStarted(false)
 , d_allocator_p(allocator)
 {
@@ -494,6 +651,19 @@ int AuthenticationController::start(bsl::ostream& errorDescription)
         return rc_INVALID_CONFIG;  // RETURN
     }
 
+    const int cacheTimeoutMs =
+        mqbcfg::BrokerConfig::get().authentication().cacheTimeoutMs();
+    if (cacheTimeoutMs < 0) {
+        errorDescription << "Invalid authentication cacheTimeoutMs: "
+                         << cacheTimeoutMs;
+        return rc_INVALID_CONFIG;  // RETURN
+    }
+    d_cacheTimeout.setTotalMilliseconds(cacheTimeoutMs);
+    if (cacheTimeoutMs > 0) {
+        BALL_LOG_INFO << "Authentication results are cached for "
+                      << cacheTimeoutMs << " ms";
+    }
+
     rc = initializeAuthenticators(errorDescription);
     if (rc != 0) {
         return rc * 10 + rc_INIT_AUTHENTICATORS;
@@ -533,6 +703,9 @@ void AuthenticationController::stop()
     }
 
     d_authenticators.clear();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_resultCacheMutex);  // LOCK
+    d_resultCache.clear();
 }
 
 int AuthenticationController::authenticate(
@@ -558,6 +731,18 @@ int AuthenticationController::authenticate(
     AuthenticatorMap::const_iterator cit = d_authenticators.find(normMech);
     if (cit != d_authenticators.cend()) {
         const AuthenticatorMp& authenticator = cit->second;
+
+        bsl::string key(d_allocator_p);
+        if (d_cacheTimeout != bsls::TimeInterval()) {
+            key = cacheKey(normMech, input);
+            if (lookupCachedResult(result, key, allocator)) {
+                BALL_LOG_DEBUG << "AuthenticationController: "
+                               << "reusing cached result for mechanism '"
+                               << normMech << "'";
+                return rc_SUCCESS;  // RETURN
+            }
+        }
+
         BALL_LOG_DEBUG << "AuthenticationController: "
                        << "authenticating with mechanism '" << normMech << "'"
                        << " (authenticator: '" << authenticator->name()
@@ -572,6 +757,10 @@ int AuthenticationController::authenticate(
                              << "). Detailed error: " << errorStream.str();
             return (rc * 10 + rc_AUTHENTICATION_FAILED);
         }
+
+        if (!key.empty()) {
+            cacheResult(key, *result);
+        }
     }
     else {
         errorDescription << "Authentication mechanism '" << normMech
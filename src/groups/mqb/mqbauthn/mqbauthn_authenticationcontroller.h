@@ -26,6 +26,18 @@
 /// holding plugin instances, tracking an optional anonymous credential, and
 /// offering start/stop and authenticate operations used by higher-level
 /// components.
+///
+/// Result Cache                {#mqbauthn_authenticationcontroller_cache}
+/// ============
+///
+/// When `cacheTimeoutMs` is configured, successful authentication results are
+/// kept, keyed by the mechanism, the authentication material and the client
+/// host, so that a client reconnecting with the same credential (e.g., after
+/// a broker restart or failover) is authenticated without calling the plugin
+/// again.  An entry expires after `cacheTimeoutMs` or at the end of the
+/// lifetime of its result, whichever comes first, and a result served from
+/// the cache reports the remaining lifetime.  Failed authentications are
+/// never cached.
 
 // MQB
 #include <mqbcfg_messages.h>
@@ -41,6 +53,8 @@
 #include <bsl_unordered_map.h>
 #include <bsl_unordered_set.h>
 #include <bslma_allocator.h>
+#include <bslmt_mutex.h>
+#include <bsls_timeinterval.h>
 
 namespace BloombergLP {
 
@@ -65,6 +79,20 @@ class AuthenticationController {
     typedef bslma::ManagedPtr<mqbplug::Authenticator>        AuthenticatorMp;
     typedef bsl::unordered_map<bsl::string, AuthenticatorMp> AuthenticatorMap;
 
+    /// A successful authentication result kept in the result cache.
+    struct CachedResult {
+        /// The result returned by the authenticator.
+        bsl::shared_ptr<mqbplug::AuthenticationResult> d_result_sp;
+
+        /// Monotonic time at which the result was obtained.
+        bsls::TimeInterval d_insertionTime;
+
+        /// Monotonic time after which the result must not be reused.
+        bsls::TimeInterval d_expirationTime;
+    };
+
+    typedef bsl::unordered_map<bsl::string, CachedResult> ResultCache;
+
     // DATA
 
     /// Registered authenticator plugins.
@@ -93,6 +121,16 @@ class AuthenticationController {
     /// is configured.
     mqbplug::CredentialProvider::CredentialCb d_credentialCb;
 
+    /// How long a successful result is reused.  0 if the cache is disabled.
+    bsls::TimeInterval d_cacheTimeout;
+
+    /// Successful authentication results, keyed by `cacheKey`.
+    ResultCache d_resultCache;
+
+    /// Mutex protecting `d_resultCache`, accessed by the *AUTHENTICATION*
+    /// threads.
+    bslmt::Mutex d_resultCacheMutex;
+
     /// True if this component is started.
     bool d_isStarted;
 
@@ -148,6 +186,27 @@ class AuthenticationController {
     /// configured.  Return 0 on success, non-zero on error.
     int ensureDefaultAuthenticator(bsl::ostream& errorDescription);
 
+    /// Load into the specified `result` the cached result for the specified
+    /// `key`, with its lifetime reduced by the time spent in the cache, and
+    /// using the specified `allocator`.  Return true if a result was found
+    /// and has not expired, and false otherwise.
+    bool
+    lookupCachedResult(bsl::shared_ptr<mqbplug::AuthenticationResult>* result,
+                       const bsl::string&                              key,
+                       bslma::Allocator* allocator);
+
+    /// Keep the specified `result` in the cache under the specified `key`.
+    void
+    cacheResult(const bsl::string&                                    key,
+                const bsl::shared_ptr<mqbplug::AuthenticationResult>& result);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the key of the result cache for the specified normalized
+    /// `mechanism` and the specified `input`.
+    bsl::string cacheKey(const bsl::string&                 mechanism,
+                         const mqbplug::AuthenticationData& input) const;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(AuthenticationController,
@@ -171,12 +230,17 @@ class AuthenticationController {
 
     /// Authenticate using the specified AuthenticationData `input` and
     /// `mechanism`.  On success, populate the specified `result` with the
-    /// authentication result.
+    /// authentication result, which may be served from the result cache if
+    /// enabled.
     /// Return 0 on success, or a non-zero return code on error and fill in the
     /// specified `errorDescription` stream with the description of the error.
     /// Note that the `mechanism` is case insensitive.
     /// Any memory allocated for the specified `result` uses the specified
-    /// `allocator`.
+    /// `allocator`.  Note that this method is called concurrently by the
+    /// threads of the authentication thread pool of `mqba::Authenticator`
+    /// and invokes the plugin synchronously, without holding any lock of
+    /// this object, so that a slow plugin delays only the connections it is
+    /// authenticating.
     int authenticate(bsl::ostream& errorDescription,
                      bsl::shared_ptr<mqbplug::AuthenticationResult>* result,
                      bsl::string_view                                mechanism,
@@ -707,13 +707,7 @@ void Cluster::continueShutdownDispatched(
 
     // Make sure all partitions done sending last sync points.
     // Synchronize with all Queue Dispatcher threads
-    bslmt::Latch latch(1);
-    dispatcher()->executeOnAllQueues(
-        mqbi::Dispatcher::VoidFunction(),  // empty
-        mqbi::DispatcherClientType::e_QUEUE,
-        bdlf::BindUtil::bindS(d_allocator_p, &bslmt::Latch::arrive, &latch));
-
-    latch.wait();
+    dispatcher()->synchronizeAll(mqbi::DispatcherClientType::e_QUEUE);
 
     // Notify peers before going down.  This should be the last message sent
     // out.
@@ -2136,6 +2130,12 @@ Cluster::Cluster(const bslstl::StringRef&           name,
 
         nodeSessionMap.insert(bsl::make_pair(*nodeIter, nodeSessionSp));
 
+        // Cap the rate at which partition sync is served to the peer
+        (*nodeIter)->channel().setPartitionSyncMaxBytesPerSecond(
+            clusterConfig.partitionConfig()
+                .syncConfig()
+                .partitionSyncMaxBytesPerSecond());
+
         if (netCluster_p->selfNodeId() == (*nodeIter)->nodeId()) {
             d_clusterData.membership().setSelfNodeSession(nodeSessionSp.get());
         }
@@ -36,6 +36,7 @@
 #include <baljsn_decoder.h>
 #include <baljsn_decoderoptions.h>
 #include <bdlb_string.h>
+#include <bdlf_bind.h>
 #include <bdlma_localsequentialallocator.h>
 #include <bdlmt_eventscheduler.h>
 #include <bdls_pathutil.h>
@@ -46,6 +47,8 @@
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bslmt_mutexassert.h>
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadgroup.h>
 #include <bsls_systemclocktype.h>
 
 namespace BloombergLP {
@@ -73,7 +76,8 @@ int ClusterCatalog::createNetCluster(
     bsl::ostream&                           errorDescription,
     bslma::ManagedPtr<mqbnet::Cluster>*     out,
     const bsl::string&                      name,
-    const bsl::vector<mqbcfg::ClusterNode>& nodes)
+    const bsl::vector<mqbcfg::ClusterNode>& nodes,
+    int                                     numConnectionsPerNode)
 {
     // PRECONDITIONS
     BSLMT_MUTEXASSERT_IS_LOCKED_SAFE(&d_mutex);  // mutex was LOCKED
@@ -96,7 +100,8 @@ int ClusterCatalog::createNetCluster(
                                                name,
                                                nodes,
                                                connectionMode,
-                                               userData);
+                                               userData,
+                                               numConnectionsPerNode);
 }
 
 struct Named {
@@ -167,7 +172,8 @@ int ClusterCatalog::createCluster(bsl::ostream& errorDescription,
         rc = createNetCluster(errorDescription,
                               &netCluster,
                               name,
-                              clusterDefinition.nodes());
+                              clusterDefinition.nodes(),
+                              1);
         if (rc != 0) {
             return (rc * 10) + rc_NETCLUSTER_CREATION_FAILED;  // RETURN
         }
@@ -266,7 +272,8 @@ int ClusterCatalog::createCluster(bsl::ostream& errorDescription,
         rc = createNetCluster(errorDescription,
                               &netCluster,
                               name,
-                              clusterProxyDefinition.nodes());
+                              clusterProxyDefinition.nodes(),
+                              clusterProxyDefinition.numUpstreamConnections());
         if (rc != 0) {
             return (rc * 10) + rc_NETCLUSTER_CREATION_FAILED;  // RETURN
         }
@@ -330,6 +337,15 @@ int ClusterCatalog::startCluster(bsl::ostream&  errorDescription,
     return rc;
 }
 
+void ClusterCatalog::startClusterThread(int*           rc,
+                                       bsl::string*   errorDescription,
+                                       mqbi::Cluster* cluster)
+{
+    bmqu::MemOutStream os(d_allocator_p);
+    *rc = startCluster(os, cluster);
+    errorDescription->assign(os.str().data(), os.str().length());
+}
+
 ClusterCatalog::ClusterCatalog(mqbi::Dispatcher*             dispatcher,
                                mqbnet::TransportManager*     transportManager,
                                const StatContextsMap&        statContexts,
@@ -493,26 +509,79 @@ int ClusterCatalog::start(bsl::ostream& errorDescription)
     // Create a map composed of all clusters, whether member or remote.
     bsl::unordered_set<bsl::string> allClusters(d_myClusters);
 
-    // Create any cluster this broker is member of
-    bsl::unordered_set<bsl::string>::const_iterator it;
-    for (it = allClusters.begin(); it != allClusters.end(); ++it) {
-        bsl::shared_ptr<mqbi::Cluster> cluster;
-        // CreateCluster expects unique cluster names, but that's fine, we are
-        // iterating over a set, so names are guaranteed to be unique.
-        {
-            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+    // Create any cluster this broker is member of.  All clusters are created
+    // first, so that they can then be started concurrently: starting a
+    // cluster opens and recovers the partitions of its storage, which may be
+    // a long, I/O bound, operation.
+    bsl::vector<bsl::shared_ptr<mqbi::Cluster> > clusters(d_allocator_p);
+    clusters.reserve(allClusters.size());
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // d_mutex LOCK
+
+        bsl::unordered_set<bsl::string>::const_iterator it;
+        for (it = allClusters.begin(); it != allClusters.end(); ++it) {
+            bsl::shared_ptr<mqbi::Cluster> cluster;
+            // CreateCluster expects unique cluster names, but that's fine, we
+            // are iterating over a set, so names are guaranteed to be unique.
             rc = createCluster(errorDescription, &cluster, *it);
             if (rc != 0) {
                 return (rc * 10) + rc_CLUSTER_CREATION_FAILED;  // RETURN
             }
-        }  // close mutex guard scope
+            clusters.push_back(cluster);
+        }
+    }  // close mutex guard scope
+
+    // Start the newly created clusters, outside the mutex scope
+    const bsls::Types::Int64 startTime = bmqu::Time::highResolutionTimer();
 
-        // Start the newly created cluster, outside the mutex scope
-        rc = startCluster(errorDescription, cluster.get());
+    if (clusters.size() == 1) {
+        rc = startCluster(errorDescription, clusters.front().get());
         if (rc != 0) {
             return (rc * 10) + rc_CLUSTER_START_FAILED;  // RETURN
         }
     }
+    else if (!clusters.empty()) {
+        bsl::vector<int>         rcs(clusters.size(), 0, d_allocator_p);
+        bsl::vector<bsl::string> errors(clusters.size(),
+                                        bsl::string(d_allocator_p),
+                                        d_allocator_p);
+        bslmt::ThreadGroup       threadGroup(d_allocator_p);
+
+        for (size_t i = 0; i < clusters.size(); ++i) {
+            bslmt::ThreadAttributes attributes;
+            attributes.setThreadName("bmqClusterStart");
+
+            rc = threadGroup.addThread(
+                bdlf::BindUtil::bind(&ClusterCatalog::startClusterThread,
+                                     this,
+                                     &rcs[i],
+                                     &errors[i],
+                                     clusters[i].get()),
+                attributes);
+            if (rc != 0) {
+                // Failed to create a thread, start the cluster from this
+                // thread instead.
+                BALL_LOG_WARN << "Failed to create thread to start cluster '"
+                              << clusters[i]->name() << "' [rc: " << rc
+                              << "], starting it synchronously";
+                startClusterThread(&rcs[i], &errors[i], clusters[i].get());
+            }
+        }
+
+        threadGroup.joinAll();
+
+        for (size_t i = 0; i < clusters.size(); ++i) {
+            if (rcs[i] != 0) {
+                errorDescription << errors[i];
+                return (rcs[i] * 10) + rc_CLUSTER_START_FAILED;  // RETURN
+            }
+        }
+        rc = rc_SUCCESS;
+    }
+
+    BALL_LOG_INFO << "Started " << clusters.size() << " cluster(s) in "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         bmqu::Time::highResolutionTimer() - startTime);
 
     d_isStarted = true;
 
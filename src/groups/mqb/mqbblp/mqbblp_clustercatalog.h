@@ -252,14 +252,17 @@ class ClusterCatalog {
     // PRIVATE MANIPULATORS
 
     /// Create a new net cluster object for the cluster with the specified
-    /// `name` and `nodes`, and store the result in the specified `out`.
-    /// Return 0 on success or a non-zero value and populate the specified
-    /// `errorDescription` with a description of the error otherwise.  Note
-    /// that the `d_mutex` must be locked prior to calling this method.
+    /// `name` and `nodes`, each node being reached through the specified
+    /// `numConnectionsPerNode` parallel connections, and store the result
+    /// in the specified `out`.  Return 0 on success or a non-zero value and
+    /// populate the specified `errorDescription` with a description of the
+    /// error otherwise.  Note that the `d_mutex` must be locked prior to
+    /// calling this method.
     int createNetCluster(bsl::ostream&                       errorDescription,
                          bslma::ManagedPtr<mqbnet::Cluster>* out,
                          const bsl::string&                  name,
-                         const bsl::vector<mqbcfg::ClusterNode>& nodes);
+                         const bsl::vector<mqbcfg::ClusterNode>& nodes,
+                         int numConnectionsPerNode);
 
     /// Create a new cluster object for the cluster with the specified
     /// `name` and store the result in the specified `out`.  Return 0 on
@@ -278,6 +281,14 @@ class ClusterCatalog {
     /// within the object's mutex locked (see implementation for details).
     int startCluster(bsl::ostream& errorDescription, mqbi::Cluster* cluster);
 
+    /// Start the specified `cluster`, loading the result into the specified
+    /// `rc` and the description of the error, if any, into the specified
+    /// `errorDescription`.  This method is meant to be executed from a
+    /// dedicated thread, in order to start multiple clusters concurrently.
+    void startClusterThread(int*           rc,
+                            bsl::string*   errorDescription,
+                            mqbi::Cluster* cluster);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(ClusterCatalog, bslma::UsesBslmaAllocator)
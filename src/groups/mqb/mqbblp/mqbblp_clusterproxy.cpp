@@ -38,6 +38,7 @@
 #include <bmqt_messageguid.h>
 
 #include <bmqtsk_alarmlog.h>
+#include <bmqu_atomicstate.h>
 #include <bmqu_blob.h>
 #include <bmqu_outstreamformatsaver.h>
 #include <bmqu_printutil.h>
@@ -74,6 +75,30 @@ const double k_ACTIVE_NODE_INITIAL_WAIT = 10.0;
 // the same data center to come up - refer to the 'Active node
 // selection' documentation note in the header for more details.
 
+/// Return the key identifying the upstream connection onto which the
+/// specified `request` should be sent: the upstream queue id for requests
+/// related to a queue, so that they follow the same connection as the data
+/// of that queue, and 0 otherwise.
+int upstreamKey(const bmqp_ctrlmsg::ControlMessage& request)
+{
+    const bmqp_ctrlmsg::ControlMessageChoice& choice = request.choice();
+
+    if (choice.isOpenQueueValue()) {
+        return choice.openQueue().handleParameters().qId();  // RETURN
+    }
+    if (choice.isCloseQueueValue()) {
+        return choice.closeQueue().handleParameters().qId();  // RETURN
+    }
+    if (choice.isConfigureQueueStreamValue()) {
+        return choice.configureQueueStream().qId();  // RETURN
+    }
+    if (choice.isConfigureStreamValue()) {
+        return choice.configureStream().qId();  // RETURN
+    }
+
+    return 0;
+}
+
 }  // close unnamed namespace
 
 // ------------------
@@ -421,6 +446,13 @@ void ClusterProxy::onPushEvent(const mqbevt::PushEvent& event)
             continue;  // CONTINUE
         }
 
+        // Note that the application data and options blobs refer to the
+        // buffers of the upstream event rather than copying them, and the
+        // 'PushEventBuilder' of each downstream session appends the payload
+        // by reference too.  Only the PUSH header and the SubQueueInfos
+        // option are re-encoded, because the queueId and subscription ids
+        // differ for each downstream, so the upstream buffers can't be
+        // patched in place and shared.
         bsl::shared_ptr<bdlbb::Blob> appDataSp =
             d_clusterData.blobSpPool().getObject();
         rc = iter.loadApplicationData(appDataSp.get());
@@ -509,9 +541,10 @@ void ClusterProxy::onRelayRejectEvent(const mqbevt::RejectEvent& event)
     bmqt::GenericResult::Enum  rc;
 
     if (d_activeNode_p) {
-        rc = d_activeNode_p->channel().writeReject(rejectMsg.queueId(),
-                                                   rejectMsg.subQueueId(),
-                                                   rejectMsg.messageGUID());
+        rc = d_activeNode_p->channel(rejectMsg.queueId())
+                 .writeReject(rejectMsg.queueId(),
+                              rejectMsg.subQueueId(),
+                              rejectMsg.messageGUID());
     }
     else {
         rc = bmqt::GenericResult::e_NOT_CONNECTED;
@@ -701,12 +734,18 @@ ClusterProxy::sendRequest(const RequestManagerType::RequestSp& request,
 
     request->setGroupId(d_activeNode_p->nodeId());
 
+    // Send the request on the upstream connection carrying the data of the
+    // queue it relates to, if any.
+    mqbnet::Channel& channel = d_activeNode_p->channel(
+        upstreamKey(request->request()));
+
     return d_clusterData.requestManager().sendRequest(
         request,
-        bdlf::BindUtil::bind(&mqbnet::ClusterNode::write,
-                             d_activeNode_p,
+        bdlf::BindUtil::bind(&mqbnet::Channel::writeBlob,
+                             &channel,
                              bdlf::PlaceHolders::_1,
-                             bmqp::EventType::e_CONTROL),
+                             bmqp::EventType::e_CONTROL,
+                             bsl::shared_ptr<bmqu::AtomicState>()),
         d_activeNode_p->nodeDescription(),
         timeout);
 }
@@ -1184,10 +1223,10 @@ ClusterProxy::sendConfirmInline(BSLA_MAYBE_UNUSED int       partitionId,
 
     BSLS_ASSERT_SAFE(d_activeNode_p);
 
-    bmqt::GenericResult::Enum rc = d_activeNode_p->channel().writeConfirm(
-        message.queueId(),
-        message.subQueueId(),
-        message.messageGUID());
+    bmqt::GenericResult::Enum rc = d_activeNode_p->channel(message.queueId())
+                                       .writeConfirm(message.queueId(),
+                                                     message.subQueueId(),
+                                                     message.messageGUID());
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
             rc != bmqt::GenericResult::e_SUCCESS)) {
@@ -1233,7 +1272,8 @@ mqbi::InlineResult::Enum ClusterProxy::sendPutInline(
     }
 
     bmqt::GenericResult::Enum rc =
-        d_activeNode_p->channel().writePut(putHeader, appData, state);
+        d_activeNode_p->channel(putHeader.queueId())
+            .writePut(putHeader, appData, state);
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
             rc != bmqt::GenericResult::e_SUCCESS)) {
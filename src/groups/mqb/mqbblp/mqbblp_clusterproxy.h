@@ -497,6 +497,12 @@ class ClusterProxy : public mqbc::ClusterStateObserver,
     /// 'putHeader', 'appData', 'options', 'state', 'genCount' without
     /// switching thread context.
     /// 'onRelayPutEvent' replacement.
+    /// Note that PUTs from all client sessions relayed to the active node
+    /// are packed by the same `bmqp::PutEventBuilder` of that node's
+    /// `mqbnet::Channel`, which is flushed once it reaches the Nagle packet
+    /// size or once the channel's buffer is drained; PUTs are therefore
+    /// already aggregated across producers, in the order they are relayed,
+    /// with ACKs routed back by queue id and correlation id.
     mqbi::InlineResult::Enum
     sendPutInline(int                                       partitionId,
                   const bmqp::PutHeader&                    putHeader,
@@ -85,6 +85,7 @@
 #include <bslma_managedptr.h>
 #include <bslmf_allocatorargt.h>
 #include <bslmf_assert.h>
+#include <bsls_atomic.h>
 #include <bsls_timeinterval.h>
 
 namespace BloombergLP {
@@ -162,9 +163,13 @@ void handleHolderDummy(
     BSLS_ASSERT_SAFE(handle->queue()->inDispatcherThread());
 }
 
-void countUnconfirmed(bsls::Types::Int64* result, mqbi::Queue* queue)
+/// Add the number of unconfirmed messages of the specified `queue` to the
+/// specified `result`.  Note that `result` is atomic because the queues of a
+/// cluster are counted concurrently, from their respective dispatcher
+/// threads.
+void countUnconfirmed(bsls::AtomicInt64* result, mqbi::Queue* queue)
 {
-    *result += queue->countUnconfirmed();
+    result->addRelaxed(queue->countUnconfirmed());
 }
 
 template <typename T>
@@ -538,6 +543,46 @@ bool ClusterQueueHelper::assignQueue(const QueueContextSp& queueContext)
     return result;
 }
 
+void ClusterQueueHelper::assignUnassignedQueues()
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_cluster_p->inDispatcherThread());
+    BSLS_ASSERT_SAFE(!d_cluster_p->isRemote());
+    BSLS_ASSERT_SAFE(d_clusterData_p->electorInfo().isSelfActiveLeader());
+
+    bsl::vector<bmqt::Uri> uris(d_allocator_p);
+    for (QueueContextMapConstIter cit = d_queues.cbegin();
+         cit != d_queues.cend();
+         ++cit) {
+        const QueueContextSp& queueContext = cit->second;
+        const QueueLiveState& liveQInfo    = queueContext->d_liveQInfo;
+
+        if ((!liveQInfo.d_queue_sp && liveQInfo.d_inFlight == 0) ||
+            isQueueAssigned(*queueContext)) {
+            continue;  // CONTINUE
+        }
+
+        uris.push_back(cit->first);
+    }
+
+    if (uris.empty()) {
+        return;  // RETURN
+    }
+
+    mqbi::ClusterStateManager::FailedAssignments failures(d_allocator_p);
+    d_clusterStateManager_p->assignQueues(uris, &failures);
+
+    for (size_t i = 0; i < failures.size(); ++i) {
+        QueueContextMapIter it = d_queues.find(failures[i].first);
+        BSLS_ASSERT_SAFE(it != d_queues.end());
+
+        finishAllOpening(it->second, failures[i].second);
+        d_queues.erase(it);
+    }
+}
+
 void ClusterQueueHelper::requestQueueAssignment(const bmqt::Uri& uri)
 {
     // executed by the cluster *DISPATCHER* thread
@@ -3828,6 +3873,15 @@ void ClusterQueueHelper::restoreStateCluster(int partitionId)
         d_clusterState_p->iterateDoubleAssignments(partitionId,
                                                    doubleAssignmentVisitor);
     }
+
+    if (allPartitions && d_clusterData_p->electorInfo().isSelfActiveLeader()) {
+        // Assign all unassigned queues up front so that their assignments
+        // are grouped in as few advisories as possible, instead of applying
+        // one advisory per queue from the loop below (which then finds them
+        // already assigning).
+        assignUnassignedQueues();
+    }
+
     ConditionalAdvance<QueueContextMapConstIter> conditional;
     for (QueueContextMapConstIter cit = d_queues.cbegin();
          cit != d_queues.cend();
@@ -5727,7 +5781,10 @@ void ClusterQueueHelper::checkUnconfirmedV2Dispatched(
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_cluster_p->inDispatcherThread());
 
-    bsls::Types::Int64 result = 0;
+    // Enqueue the count of each queue without waiting for it, so that the
+    // queues assigned to different dispatcher processors are counted in
+    // parallel rather than one queue after another.
+    bsls::AtomicInt64 unconfirmed(0);
     for (QueueContextMapIter it = d_queues.begin(); it != d_queues.end();
          ++it) {
         QueueContextSp& queueContextSp = it->second;
@@ -5740,20 +5797,20 @@ void ClusterQueueHelper::checkUnconfirmedV2Dispatched(
 
         queue->dispatcher()->execute(bdlf::BindUtil::bindS(d_allocator_p,
                                                            &countUnconfirmed,
-                                                           &result,
+                                                           &unconfirmed,
                                                            queue),
                                      queue);
-        queue->dispatcher()->synchronize(queue);
     }
 
-    // Synchronize with all Queue Dispatcher threads
-    bslmt::Latch latch(1);
-    d_cluster_p->dispatcher()->executeOnAllQueues(
-        mqbi::Dispatcher::VoidFunction(),  // empty
+    // Synchronize with all Queue Dispatcher threads.  Since each processor
+    // executes its events in order, all the counts enqueued above have been
+    // executed once every processor has executed this event.  Processors
+    // without any client have not been enqueued any count, and are skipped.
+    d_cluster_p->dispatcher()->synchronizeAll(
         mqbi::DispatcherClientType::e_QUEUE,
-        bdlf::BindUtil::bindS(d_allocator_p, &bslmt::Latch::arrive, &latch));
+        true);  // skipIdle
 
-    latch.wait();
+    const bsls::Types::Int64 result = unconfirmed.load();
 
     if (result == 0) {
         BALL_LOG_INFO << d_cluster_p->description()
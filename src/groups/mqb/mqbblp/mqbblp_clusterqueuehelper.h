@@ -540,6 +540,14 @@ class ClusterQueueHelper BSLS_KEYWORD_FINAL
     bool assignQueueIfNeeded(const QueueContextSp& queueContext_sp);
     bool assignQueue(const QueueContextSp& queueContext_sp);
 
+    /// Assign all the queues in `d_queues` which are not yet assigned and
+    /// have either an instance or some in-flight open-queue requests,
+    /// grouping their assignments into as few queue assignment advisories
+    /// as possible.  Fail the pending contexts of, and erase, any queue
+    /// whose assignment failed permanently.  Behavior is undefined unless
+    /// self is the active leader of a cluster member.
+    void assignUnassignedQueues();
+
     /// Send a queueAssignment request to the leader, requesting assignment
     /// of the queue with the specified `uri`.  This method is called only
     /// on a non leader node of a cluster member, for a cluster having a
@@ -817,6 +825,15 @@ class ClusterQueueHelper BSLS_KEYWORD_FINAL
 
     void restoreStateCluster(int partitionId);
 
+    /// Send a ReopenQueue request to the specified `activeNode` for each
+    /// non-empty subStream of the queue in the specified `queueContext`
+    /// which was not already reopened in the specified `cycle`, and return
+    /// the status of the last send.  Note that there is one request (and,
+    /// upon success, one ConfigureStream request) per subStream, rather than
+    /// one per queue or per cycle: each subStream tracks its own generation
+    /// count, retries and response independently, which lets a bad subStream
+    /// fail without failing the others.  The cost of a reopen cycle is thus
+    /// linear in the number of open subStreams.
     bmqt::GenericResult::Enum
     restoreStateHelper(QueueContext*        queueContext,
                        mqbnet::ClusterNode* activeNode,
@@ -47,7 +47,7 @@
 #include <bsl_cstddef.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
-#include <bsl_map.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_semaphore.h>
@@ -627,7 +627,14 @@ int Domain::processCommand(mqbcmd::DomainResult*        result,
 
         return 0;  // RETURN
     }
-    else if (command.isInfoValue()) {
+    else if (command.isInfoValue() || command.isInfoPageValue()) {
+        // An 'infoPage' command restricts the listed queues, and their
+        // storages, to a filtered slice of the domain's queues, so that the
+        // size of the result stays bounded on domains having a large number
+        // of queues.
+        const mqbcmd::DomainInfoPage* page = command.isInfoPageValue()
+                                                 ? &command.infoPage()
+                                                 : 0;
         mqbcmd::DomainInfo& domainInfo = result->makeDomainInfo();
 
         domainInfo.name()        = d_name;
@@ -658,16 +665,34 @@ int Domain::processCommand(mqbcmd::DomainResult*        result,
         mqbcmd::CapacityMeter& capacityMeter = domainInfo.capacityMeter();
         mqbu::CapacityMeterUtil::loadState(&capacityMeter, d_capacityMeter);
 
-        typedef bsl::map<bsl::string, bsl::shared_ptr<mqbi::Queue> >
-                                                OrderedQueueMap;
-        typedef OrderedQueueMap::const_iterator OrderedQueueMapCIter;
-
-        // sort by queue name
-        OrderedQueueMap      map(d_queues.cbegin(), d_queues.cend());
-        OrderedQueueMapCIter cit;
-        domainInfo.queueUris().reserve(d_queues.size());
-        for (cit = map.cbegin(); cit != map.cend(); ++cit) {
-            domainInfo.queueUris().push_back(cit->second->uri().asString());
+        // Collect the uris of the queues matching the filter, if any, and
+        // sort them (all queues belong to this domain, so that this is
+        // equivalent to sorting by queue name).
+        bsl::vector<bsl::string>& queueUris = domainInfo.queueUris();
+        queueUris.reserve(d_queues.size());
+        for (QueueMapCIter cit = d_queues.cbegin(); cit != d_queues.cend();
+             ++cit) {
+            const bsl::string& uri = cit->second->uri().asString();
+            if (page && !page->queueFilter().isNull() &&
+                uri.find(page->queueFilter().value()) == bsl::string::npos) {
+                continue;  // CONTINUE
+            }
+            queueUris.push_back(uri);
+        }
+        bsl::sort(queueUris.begin(), queueUris.end());
+
+        if (page) {
+            // Keep only the requested page: 'count' uris starting at
+            // 'offset', or all of them if 'count' is 0.
+            const size_t begin = bsl::min(static_cast<size_t>(page->offset()),
+                                          queueUris.size());
+            size_t       end   = queueUris.size();
+            if (page->count() > 0) {
+                end = bsl::min(end,
+                               begin + static_cast<size_t>(page->count()));
+            }
+            queueUris.erase(queueUris.begin() + end, queueUris.end());
+            queueUris.erase(queueUris.begin(), queueUris.begin() + begin);
         }
 
         mqbcmd::ClusterCommand clusterCommand;
@@ -686,8 +711,25 @@ int Domain::processCommand(mqbcmd::DomainResult*        result,
 
         // The clusterResult is guaranteed to be a storage result since we set
         // the clusterCommand above.
-        domainInfo.storageContent() =
+        const mqbcmd::StorageContent& storageContent =
             clusterResult.storageResult().storageContent();
+        if (!page) {
+            domainInfo.storageContent() = storageContent;
+            return rc;  // RETURN
+        }
+
+        // Only report the storages of the queues in the page.
+        bsl::vector<mqbcmd::StorageQueueInfo>& storages =
+            domainInfo.storageContent().storages();
+        for (size_t i = 0; i < storageContent.storages().size(); ++i) {
+            const mqbcmd::StorageQueueInfo& storage =
+                storageContent.storages()[i];
+            if (bsl::binary_search(queueUris.begin(),
+                                   queueUris.end(),
+                                   storage.queueUri())) {
+                storages.push_back(storage);
+            }
+        }
         return rc;  // RETURN
     }
     else if (command.isQueueValue()) {
@@ -32,7 +32,9 @@
 
 // BMQ
 #include <bmqp_ctrlmsg_messages.h>
+#include <bmqp_messageproperties.h>
 #include <bmqp_protocolutil.h>
+#include <bmqt_propertytype.h>
 #include <bmqt_queueflags.h>
 #include <bmqt_resultcode.h>
 #include <bmqt_uri.h>
@@ -50,6 +52,7 @@
 #include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_string.h>
+#include <bsl_utility.h>
 #include <bsl_vector.h>
 #include <bsla_annotations.h>
 #include <bslma_allocator.h>
@@ -64,6 +67,50 @@ namespace {
 /// The number of messages to expire on idle.
 const int k_EXPIRE_MESSAGES_BATCH_SIZE = 1000;
 
+/// Load into the specified `key` the value of the property having the
+/// specified `name` among the message properties, described by the specified
+/// `propertiesInfo`, of the specified `appData`.  Use the specified
+/// `allocator` for memory allocations.  Return true on success, and false if
+/// the message has no such property or if its value is not a string or an
+/// integer.
+bool loadCompactionKey(bsl::string*                       key,
+                       const bsl::string&                 name,
+                       const bdlbb::Blob&                 appData,
+                       const bmqp::MessagePropertiesInfo& propertiesInfo,
+                       bslma::Allocator*                  allocator)
+{
+    if (!propertiesInfo.isPresent()) {
+        return false;  // RETURN
+    }
+
+    bmqp::MessageProperties properties(allocator);
+    if (0 != properties.streamIn(appData, propertiesInfo.isExtended())) {
+        return false;  // RETURN
+    }
+
+    bmqt::PropertyType::Enum type;
+    if (!properties.hasProperty(name, &type)) {
+        return false;  // RETURN
+    }
+
+    switch (type) {
+    case bmqt::PropertyType::e_STRING: {
+        *key = properties.getPropertyAsString(name);
+    } break;
+    case bmqt::PropertyType::e_INT32: {
+        *key = bsl::to_string(properties.getPropertyAsInt32(name));
+    } break;
+    case bmqt::PropertyType::e_INT64: {
+        *key = bsl::to_string(properties.getPropertyAsInt64(name));
+    } break;
+    default: {
+        return false;  // RETURN
+    }
+    }
+
+    return true;
+}
+
 }
 
 // ----------------
@@ -78,6 +125,8 @@ LocalQueue::LocalQueue(QueueState* state, bslma::Allocator* allocator)
 , d_throttledFailedPutMessages(5000, 1)  // 1 log per 5s interval
 , d_throttledDuplicateMessages()
 , d_haveStrongConsistency(false)
+, d_compactionKey(allocator)
+, d_compactionIndex(allocator)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_state_p->id() == bmqp::QueueId::k_PRIMARY_QUEUE_ID);
@@ -91,6 +140,103 @@ LocalQueue::LocalQueue(QueueState* state, bslma::Allocator* allocator)
     d_state_p->setDescription(d_state_p->uri().asString());
 }
 
+// PRIVATE MANIPULATORS
+void LocalQueue::compact(const bmqt::MessageGUID&           msgGUID,
+                         const bdlbb::Blob&                 appData,
+                         const bmqp::MessagePropertiesInfo& propertiesInfo)
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_state_p->queue()->inDispatcherThread());
+    BSLS_ASSERT_SAFE(!d_compactionKey.empty());
+
+    bsl::string key(d_allocator_p);
+    if (!loadCompactionKey(&key,
+                           d_compactionKey,
+                           appData,
+                           propertiesInfo,
+                           d_allocator_p)) {
+        return;  // RETURN
+    }
+
+    bsl::pair<CompactionIndex::iterator, bool> inserted =
+        d_compactionIndex.insert(bsl::make_pair(key, msgGUID));
+    if (inserted.second) {
+        return;  // RETURN
+    }
+
+    const bmqt::MessageGUID superseded = inserted.first->second;
+    inserted.first->second             = msgGUID;
+
+    mqbi::Storage* storage = d_state_p->storage();
+    if (!storage->hasMessage(superseded) || !storage->hasReceipt(superseded)) {
+        // Either the superseded message is already confirmed by all Apps, or
+        // it is still waiting for a quorum of receipts, in which case
+        // removing it would NACK it.  Let it be delivered.
+        return;  // RETURN
+    }
+
+    const mqbi::StorageResult::Enum rc = storage->gcMessage(superseded);
+    if (rc != mqbi::StorageResult::e_SUCCESS) {
+        BALL_LOG_WARN << "#QUEUE_COMPACTION_FAILURE "
+                      << "Error '" << rc << "' while removing message '"
+                      << superseded << "' superseded by message '" << msgGUID
+                      << "' for key '" << key << "' in queue '"
+                      << d_state_p->description() << "'";
+    }
+}
+
+void LocalQueue::rebuildCompactionIndex()
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_state_p->queue()->inDispatcherThread());
+    BSLS_ASSERT_SAFE(!d_compactionKey.empty());
+
+    // Collect the superseded messages first, so that the storage is not
+    // modified while being iterated.
+    bsl::vector<bmqt::MessageGUID> superseded(d_allocator_p);
+    bsl::string                    key(d_allocator_p);
+
+    bslma::ManagedPtr<mqbi::StorageIterator> it =
+        d_state_p->storage()->getIterator(mqbu::StorageKey::k_NULL_KEY);
+    for (; !it->atEnd(); it->advance()) {
+        if (!loadCompactionKey(&key,
+                               d_compactionKey,
+                               *it->appData(),
+                               it->attributes().messagePropertiesInfo(),
+                               d_allocator_p)) {
+            continue;  // CONTINUE
+        }
+
+        // Messages are iterated in arrival order, so a later message always
+        // supersedes an earlier one.
+        bsl::pair<CompactionIndex::iterator, bool> inserted =
+            d_compactionIndex.insert(bsl::make_pair(key, it->guid()));
+        if (!inserted.second) {
+            if (d_state_p->storage()->hasReceipt(inserted.first->second)) {
+                superseded.push_back(inserted.first->second);
+            }
+            inserted.first->second = it->guid();
+        }
+    }
+    it.reset();
+
+    for (unsigned int i = 0; i < superseded.size(); ++i) {
+        d_state_p->storage()->gcMessage(superseded[i]);
+    }
+
+    BALL_LOG_INFO << "Rebuilt the compaction index of queue '"
+                  << d_state_p->description() << "' [key: '"
+                  << d_compactionKey
+                  << "', entities: " << d_compactionIndex.size()
+                  << ", superseded messages removed: " << superseded.size()
+                  << "]";
+}
+
+// MANIPULATORS
 int LocalQueue::configure(bsl::ostream& errorDescription, bool isReconfigure)
 {
     // executed by the *DISPATCHER* thread
@@ -174,6 +320,16 @@ int LocalQueue::configure(bsl::ostream& errorDescription, bool isReconfigure)
 
     d_haveStrongConsistency = domainCfg->consistency().isStrongValue();
 
+    if (d_compactionKey != domainCfg->compactionKey()) {
+        d_compactionKey = domainCfg->compactionKey();
+        d_compactionIndex.clear();
+        if (!d_compactionKey.empty()) {
+            // The storage may already contain messages, either recovered or
+            // posted while this node was not the primary.
+            rebuildCompactionIndex();
+        }
+    }
+
     d_state_p->stats()
         ->onEvent<mqbstat::QueueStatsDomain::EventType::e_CHANGE_ROLE>(
             mqbstat::QueueStatsDomain::Role::e_PRIMARY);
@@ -191,7 +347,8 @@ int LocalQueue::configure(bsl::ostream& errorDescription, bool isReconfigure)
             d_state_p->stats()->updateDomainAppIds(
                 domainCfg->mode().fanout().publishAppIdMetrics()
                     ? domainCfg->mode().fanout().appIDs()
-                    : bsl::vector<bsl::string>(d_allocator_p));
+                    : bsl::vector<bsl::string>(d_allocator_p),
+                domainCfg->mode().fanout().maxAppIdMetrics());
         }
     }
 
@@ -329,6 +486,12 @@ void LocalQueue::onDispatcherEvent(const mqbi::DispatcherEvent& event)
         const mqbevt::PutEvent* const realEvent =
             event.the<mqbevt::PutEvent>();
 
+        // Time the PUT spent waiting in the dispatcher queue, first stage of
+        // the PUT -> ACK breakdown (see also 'e_REPLICATION_TIME').
+        d_state_p->stats()
+            ->onEvent<mqbstat::QueueStatsDomain::EventType::e_DISPATCH_TIME>(
+                bmqu::Time::highResolutionTimer() - event.enqueueTime());
+
         postMessage(realEvent->putHeader(),
                     realEvent->blob(),
                     realEvent->options(),
@@ -391,8 +554,10 @@ void LocalQueue::flush()
         }
 
         // See notes in 'FileStore::flushStorage' for motivation behind
-        // this flush:
-        d_state_p->storage()->flushStorage();
+        // this flush.  This is the end of a batch of events processed by
+        // the partition, so let the replication group commit window, if
+        // any, decide whether to flush:
+        d_state_p->storage()->flushStorageIfNeeded();
     }
 
     deliverIfNeeded();
@@ -522,6 +687,10 @@ void LocalQueue::postMessage(const bmqp::PutHeader&              putHeader,
             ->onEvent<mqbstat::QueueStatsDomain::EventType::e_PUT>(
                 appData->length());
 
+        if (!d_compactionKey.empty() && refCount) {
+            compact(putHeader.messageGUID(), *appData, translation);
+        }
+
         d_queueEngine_mp->afterPostMessage();
     }
     else {
@@ -38,6 +38,8 @@
 #include <bdlmt_throttle.h>
 #include <bsl_memory.h>
 #include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
@@ -77,6 +79,14 @@ class LocalQueue BSLS_CPP11_FINAL {
     // CLASS-SCOPE CATEGORY
     BALL_LOG_SET_CLASS_CATEGORY("MQBBLP.LOCALQUEUE");
 
+  private:
+    // PRIVATE TYPES
+
+    /// Map of the value of the compaction key to the GUID of the latest
+    /// message having that value.
+    typedef bsl::unordered_map<bsl::string, bmqt::MessageGUID>
+        CompactionIndex;
+
   private:
     // DATA
     bslma::Allocator*                    d_allocator_p;
@@ -87,6 +97,30 @@ class LocalQueue BSLS_CPP11_FINAL {
     /// Throttler for duplicates.
     bool d_haveStrongConsistency;
 
+    /// Name of the message property identifying the entity a message is an
+    /// update of, if the domain is compacted.  Empty otherwise.
+    bsl::string d_compactionKey;
+
+    /// Latest message for each entity of a compacted queue.
+    CompactionIndex d_compactionIndex;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Record the message having the specified `msgGUID`, `appData` and
+    /// `propertiesInfo` as the latest message of its entity, and remove from
+    /// the storage the message it supersedes, if any.  Do nothing if the
+    /// message does not carry the compaction key.  The behavior is undefined
+    /// unless this queue is compacted.
+    void compact(const bmqt::MessageGUID&           msgGUID,
+                 const bdlbb::Blob&                 appData,
+                 const bmqp::MessagePropertiesInfo& propertiesInfo);
+
+    /// Rebuild the index of the latest message of each entity from the
+    /// messages in the storage, removing the superseded ones.  The behavior
+    /// is undefined unless this queue is compacted.
+    void rebuildCompactionIndex();
+
   private:
     // NOT IMPLEMENTED
     LocalQueue(const LocalQueue& other) BSLS_CPP11_DELETED;
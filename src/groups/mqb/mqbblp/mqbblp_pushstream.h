@@ -54,7 +54,7 @@
 #include <mqbi_storage.h>
 
 // BMQ
-#include <bmqc_orderedhashmap.h>
+#include <bmqc_flatorderedhashmap.h>
 #include <bmqt_messageguid.h>
 
 // BDE
@@ -163,9 +163,9 @@ class PushStream {
         const Element* last() const;
     };
 
-    typedef bmqc::OrderedHashMap<bmqt::MessageGUID,
-                                 Message,
-                                 bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+    typedef bmqc::FlatOrderedHashMap<bmqt::MessageGUID,
+                                     Message,
+                                     bslh::Hash<bmqt::MessageGUIDHashAlgo> >
         Stream;
 
     typedef Stream::iterator                      iterator;
@@ -48,15 +48,28 @@
 #include <bdlb_string.h>
 #include <bdlf_bind.h>
 #include <bdlma_localsequentialallocator.h>
+#include <bdlt_timeunitratio.h>
 #include <bsl_functional.h>  // for bsl::ref()
 #include <bsl_ios.h>
 #include <bsl_iostream.h>
 #include <bsla_annotations.h>
 #include <bsls_assert.h>
+#include <bsls_timeutil.h>
 
 namespace BloombergLP {
 namespace mqbblp {
 
+namespace {
+
+/// Maximum age, in nanoseconds, of the snapshot of the internals of a queue
+/// returned to an admin command.  Admin commands polling the internals more
+/// often than this are served the same snapshot, without loading the
+/// internals again on the dispatcher thread of the queue.
+const bsls::Types::Int64 k_INTERNALS_SNAPSHOT_MAX_AGE_NS =
+    bdlt::TimeUnitRatio::k_NANOSECONDS_PER_SECOND;
+
+}  // close unnamed namespace
+
 // -----------
 // class Queue
 // -----------
@@ -519,6 +532,57 @@ void Queue::loadInternals(mqbcmd::QueueInternals* out)
     }
 }
 
+void Queue::publishInternalsDispatched(bsls::Types::Uint64 version)
+{
+    // executed by the *QUEUE* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    {
+        bsls::SpinLockGuard guard(&d_internalsLock);  // LOCK
+        if (d_internalsVersion != version) {
+            // Already published by a request enqueued earlier.
+
+            return;  // RETURN
+        }
+    }  // UNLOCK
+
+    bsl::shared_ptr<mqbcmd::QueueInternals> internals =
+        bsl::allocate_shared<mqbcmd::QueueInternals>(d_allocator_p);
+    loadInternals(internals.get());
+
+    bsls::SpinLockGuard guard(&d_internalsLock);  // LOCK
+    d_internals_sp = internals;
+    d_internalsTime = bsls::TimeUtil::getTimer();
+    ++d_internalsVersion;
+}
+
+bsl::shared_ptr<const mqbcmd::QueueInternals> Queue::internalsSnapshot()
+{
+    // executed by *ANY* thread
+
+    bsls::Types::Uint64 version;
+    {
+        bsls::SpinLockGuard guard(&d_internalsLock);  // LOCK
+        if (d_internals_sp && bsls::TimeUtil::getTimer() - d_internalsTime <
+                                  k_INTERNALS_SNAPSHOT_MAX_AGE_NS) {
+            return d_internals_sp;  // RETURN
+        }
+        version = d_internalsVersion;
+    }  // UNLOCK
+
+    dispatcher()->execute(
+        bdlf::BindUtil::bind(&Queue::publishInternalsDispatched,
+                             this,
+                             version),
+        this);
+    dispatcher()->synchronize(this);
+
+    bsls::SpinLockGuard guard(&d_internalsLock);  // LOCK
+    return d_internals_sp;
+}
+
 Queue::Queue(const bmqt::Uri&                          uri,
              unsigned int                              id,
              const mqbu::StorageKey&                   key,
@@ -534,6 +598,10 @@ Queue::Queue(const bmqt::Uri&                          uri,
 , d_state(this, uri, id, key, partitionId, domain, resources, allocator)
 , d_localQueue_mp(0)
 , d_remoteQueue_mp(0)
+, d_internals_sp()
+, d_internalsVersion(0)
+, d_internalsTime(0)
+, d_internalsLock(bsls::SpinLock::s_unlocked)
 {
     BALL_LOG_INFO << d_state.uri() << ": constructor (" << this << ")";
 
@@ -916,11 +984,10 @@ int Queue::processCommand(mqbcmd::QueueResult*        result,
                                   "must be processed on a storage level.");
     }
     else if (command.isInternalsValue()) {
-        mqbcmd::QueueInternals& queueInternals = result->makeQueueInternals();
-        dispatcher()->execute(
-            bdlf::BindUtil::bind(&Queue::loadInternals, this, &queueInternals),
-            this);
-        dispatcher()->synchronize(this);
+        // Served from a snapshot, so that admin commands polling the
+        // internals do not each add work to the dispatcher thread.
+
+        result->makeQueueInternals(*internalsSnapshot());
         return 0;  // RETURN
     }
     else if (command.isMessagesValue()) {
@@ -979,6 +1046,20 @@ void Queue::flush()
     }
 }
 
+void Queue::onDispatcherCpuTime(bsls::Types::Int64 cpuTimeNs)
+{
+    // executed by the *QUEUE* dispatcher thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(inDispatcherThread());
+
+    if (d_state.stats()) {
+        d_state.stats()
+            ->onEvent<mqbstat::QueueStatsDomain::EventType::e_CPU_TIME>(
+                cpuTimeNs);
+    }
+}
+
 bsls::Types::Int64 Queue::countUnconfirmed() const
 {
     // executed by the *QUEUE* dispatcher thread
@@ -54,6 +54,7 @@
 #include <bslma_managedptr.h>
 #include <bsls_assert.h>
 #include <bsls_cpp11.h>
+#include <bsls_spinlock.h>
 #include <bsls_types.h>
 
 namespace BloombergLP {
@@ -113,6 +114,22 @@ class Queue BSLS_CPP11_FINAL : public mqbi::Queue {
     bslma::ManagedPtr<LocalQueue>  d_localQueue_mp;
     bslma::ManagedPtr<RemoteQueue> d_remoteQueue_mp;
 
+    /// Last published snapshot of the internals of this queue, read by the
+    /// admin commands without involving the dispatcher thread.  Note that
+    /// the object is never modified once published, only replaced.
+    bsl::shared_ptr<const mqbcmd::QueueInternals> d_internals_sp;
+
+    /// Number of snapshots of the internals published so far.
+    bsls::Types::Uint64 d_internalsVersion;
+
+    /// Time, as returned by `bsls::TimeUtil::getTimer`, at which
+    /// `d_internals_sp` was published.
+    bsls::Types::Int64 d_internalsTime;
+
+    /// Lock protecting `d_internals_sp`, `d_internalsVersion` and
+    /// `d_internalsTime`, only held to copy or replace them.
+    mutable bsls::SpinLock d_internalsLock;
+
   private:
     // NOT IMPLEMENTED
     Queue(const Queue& other) BSLS_CPP11_DELETED;
@@ -164,6 +181,17 @@ class Queue BSLS_CPP11_FINAL : public mqbi::Queue {
     /// queue.
     void loadInternals(mqbcmd::QueueInternals* out);
 
+    /// Publish a new snapshot of the internals of this queue, unless one
+    /// more recent than the specified `version` was published since.
+    void publishInternalsDispatched(bsls::Types::Uint64 version);
+
+    /// Return the last published snapshot of the internals of this queue,
+    /// first publishing a new one from the dispatcher thread if there is
+    /// none or if it is older than `k_INTERNALS_SNAPSHOT_MAX_AGE_NS`.  Note
+    /// that concurrent callers finding the snapshot stale share a single
+    /// publication.
+    bsl::shared_ptr<const mqbcmd::QueueInternals> internalsSnapshot();
+
   public:
     // CREATORS
     Queue(const bmqt::Uri&                          uri,
@@ -442,6 +470,12 @@ class Queue BSLS_CPP11_FINAL : public mqbi::Queue {
     /// used to provide batch and nagling mechanism.
     void flush() BSLS_KEYWORD_OVERRIDE;
 
+    /// Called by the dispatcher to report the specified `cpuTimeNs`
+    /// nanoseconds of thread CPU time it spent processing events of this
+    /// queue.
+    void onDispatcherCpuTime(bsls::Types::Int64 cpuTimeNs)
+        BSLS_KEYWORD_OVERRIDE;
+
     // ACCESSORS
     //   (mqbi::DispatcherClient)
 
@@ -92,17 +92,11 @@ const char* QueueConsumptionMonitor::State::toAscii(
 // ---------------------------------------------
 
 QueueConsumptionMonitor::SubStreamInfo::SubStreamInfo()
-: d_idleEventHandle()
-, d_state(State::e_ALIVE)
+: d_state(State::e_ALIVE)
 {
     // NOTHING
 }
 
-QueueConsumptionMonitor::SubStreamInfo::~SubStreamInfo()
-{
-    BSLS_ASSERT_SAFE(!d_idleEventHandle);
-}
-
 // -----------------------------
 // class QueueConsumptionMonitor
 // -----------------------------
@@ -115,6 +109,8 @@ QueueConsumptionMonitor::QueueConsumptionMonitor(
     bslma::Allocator*        allocator)
 : d_queueState_p(queueState)
 , d_alarmEventHandle()
+, d_idleEventHandle()
+, d_numIdleSubStreams(0)
 , d_maxIdleTimeSec(0)
 , d_subStreamInfos(allocator)
 , d_scheduledAlarmTime()
@@ -131,6 +127,7 @@ QueueConsumptionMonitor::QueueConsumptionMonitor(
 QueueConsumptionMonitor::~QueueConsumptionMonitor()
 {
     BSLS_ASSERT_SAFE(!d_alarmEventHandle);
+    BSLS_ASSERT_SAFE(!d_idleEventHandle);
 }
 
 // MANIPULATORS
@@ -201,7 +198,13 @@ void QueueConsumptionMonitor::unregisterSubStream(const bsl::string& appId)
     BSLS_ASSERT_SAFE(iter != d_subStreamInfos.end());
     SubStreamInfo& info = iter->second;
 
-    cancelIdleEvents(&info);
+    if (info.d_state == State::e_IDLE) {
+        --d_numIdleSubStreams;
+        if (d_numIdleSubStreams == 0 && d_idleEventHandle) {
+            d_queueState_p->scheduler()->cancelEventAndWait(
+                &d_idleEventHandle);
+        }
+    }
 
     // The logic allows 'idleEventDispatched' to run after 'appId' removal
     // (and re-insertion).
@@ -223,6 +226,7 @@ void QueueConsumptionMonitor::reset()
     cancelIdleEvents(false);
 
     d_subStreamInfos.clear();
+    d_numIdleSubStreams = 0;
 }
 
 void QueueConsumptionMonitor::onMessagePosted()
@@ -266,7 +270,7 @@ void QueueConsumptionMonitor::onMessageSent(const bsl::string& appId)
                 // There are un-delivered messages with alarm time in the past.
                 // Since the idle event was scheduled, it will continue to
                 // track state.
-                BSLS_ASSERT_SAFE(info.d_idleEventHandle);
+                BSLS_ASSERT_SAFE(d_idleEventHandle);
 
                 return;  // RETURN
             }
@@ -291,15 +295,16 @@ void QueueConsumptionMonitor::onTransitionToAlive(SubStreamInfo* subStreamInfo,
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_queueState_p->queue()->inDispatcherThread());
     BSLS_ASSERT_SAFE(subStreamInfo->d_state == State::e_IDLE);
-
-    if (subStreamInfo->d_idleEventHandle) {
-        // Cancel the idle event if it was scheduled.
-        d_queueState_p->scheduler()->cancelEventAndWait(
-            &subStreamInfo->d_idleEventHandle);
-    }
+    BSLS_ASSERT_SAFE(d_numIdleSubStreams > 0);
 
     subStreamInfo->d_state = State::e_ALIVE;
 
+    if (--d_numIdleSubStreams == 0 && d_idleEventHandle) {
+        // Cancel the idle event if it was scheduled and no substream is left
+        // to track.
+        d_queueState_p->scheduler()->cancelEventAndWait(&d_idleEventHandle);
+    }
+
     bdlma::LocalSequentialAllocator<1024> localAllocator(d_allocator_p);
 
     BALL_LOG_INFO_BLOCK
@@ -315,6 +320,22 @@ void QueueConsumptionMonitor::onTransitionToAlive(SubStreamInfo* subStreamInfo,
     }
 }
 
+void QueueConsumptionMonitor::onTransitionToIdle(SubStreamInfo* subStreamInfo)
+{
+    // executed by the *QUEUE DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_queueState_p->queue()->inDispatcherThread());
+    BSLS_ASSERT_SAFE(subStreamInfo->d_state == State::e_ALIVE);
+
+    subStreamInfo->d_state = State::e_IDLE;
+    ++d_numIdleSubStreams;
+
+    if (!d_idleEventHandle) {
+        scheduleIdleEvent();
+    }
+}
+
 void QueueConsumptionMonitor::scheduleAlarmEvent(
     const bsls::TimeInterval& alarmTime)
 {
@@ -357,25 +378,23 @@ void QueueConsumptionMonitor::scheduleOrRescheduleAlarmEventIfNeeded(
     }
 }
 
-void QueueConsumptionMonitor::scheduleIdleEvent(SubStreamInfo* subStreamInfo,
-                                                const bsl::string& appId)
+void QueueConsumptionMonitor::scheduleIdleEvent()
 {
     // executed by the *QUEUE DISPATCHER* thread
 
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_queueState_p->queue()->inDispatcherThread());
-    BSLS_ASSERT_SAFE(!subStreamInfo->d_idleEventHandle);
-    BSLS_ASSERT_SAFE(subStreamInfo->d_state == State::e_IDLE);
+    BSLS_ASSERT_SAFE(!d_idleEventHandle);
+    BSLS_ASSERT_SAFE(d_numIdleSubStreams > 0);
 
     bsls::TimeInterval idleTime = d_queueState_p->scheduler()->now();
     idleTime.addSeconds(bsl::min(d_maxIdleTimeSec, k_IDLE_TIMER_PERIOD_SEC));
     d_queueState_p->scheduler()->scheduleEvent(
-        &subStreamInfo->d_idleEventHandle,
+        &d_idleEventHandle,
         idleTime,
         bdlf::BindUtil::bind(
             &QueueConsumptionMonitor::executeIdleInQueueDispatcher,
-            this,
-            appId));
+            this));
 }
 
 void QueueConsumptionMonitor::executeAlarmInQueueDispatcher()
@@ -392,8 +411,7 @@ void QueueConsumptionMonitor::executeAlarmInQueueDispatcher()
         d_queueState_p->queue());
 }
 
-void QueueConsumptionMonitor::executeIdleInQueueDispatcher(
-    const bsl::string& appId)
+void QueueConsumptionMonitor::executeIdleInQueueDispatcher()
 {
     // executed by the *SCHEDULER* thread
 
@@ -403,8 +421,7 @@ void QueueConsumptionMonitor::executeIdleInQueueDispatcher(
     // Forward event to the queue dispatcher thread
     d_queueState_p->queue()->dispatcher()->execute(
         bdlf::BindUtil::bind(&QueueConsumptionMonitor::idleEventDispatched,
-                             this,
-                             appId),
+                             this),
         d_queueState_p->queue());
 }
 
@@ -413,28 +430,20 @@ void QueueConsumptionMonitor::cancelIdleEvents(bool resetStates)
     // Should always be called from the queue thread, but will be invoked from
     // the cluster thread once upon queue creation.
 
-    for (SubStreamInfoMapIter iter = d_subStreamInfos.begin(),
-                              last = d_subStreamInfos.end();
-         iter != last;
-         ++iter) {
-        SubStreamInfo& info = iter->second;
-        cancelIdleEvents(&info);
-
-        if (resetStates) {
-            // Reset the substream state to default.
-            info.d_state = State::e_ALIVE;
-        }
+    if (d_idleEventHandle) {
+        // Cancel the event if it was scheduled.
+        d_queueState_p->scheduler()->cancelEventAndWait(&d_idleEventHandle);
     }
-}
 
-void QueueConsumptionMonitor::cancelIdleEvents(SubStreamInfo* info)
-{
-    BSLS_ASSERT_SAFE(info);
-
-    if (info->d_idleEventHandle) {
-        // Cancel the event if it was scheduled.
-        d_queueState_p->scheduler()->cancelEventAndWait(
-            &info->d_idleEventHandle);
+    if (resetStates) {
+        // Reset the substreams states to default.
+        for (SubStreamInfoMapIter iter = d_subStreamInfos.begin(),
+                                  last = d_subStreamInfos.end();
+             iter != last;
+             ++iter) {
+            iter->second.d_state = State::e_ALIVE;
+        }
+        d_numIdleSubStreams = 0;
     }
 }
 
@@ -469,7 +478,7 @@ void QueueConsumptionMonitor::alarmEventDispatched()
         if (info.d_state == State::e_IDLE) {
             // skip substream in idle state,
             // idle event is scheduled for tracking it
-            BSLS_ASSERT_SAFE(info.d_idleEventHandle);
+            BSLS_ASSERT_SAFE(d_idleEventHandle);
             continue;  // CONTINUE
         }
 
@@ -488,10 +497,9 @@ void QueueConsumptionMonitor::alarmEventDispatched()
             // Alarm time is in the past, log the alarm and mark substream as
             // idle.
             d_loggingCb(appId, oldestMsgIt);
-            info.d_state = State::e_IDLE;
-            // schedule polling event to check if queue becomes empty due
-            // to GC or purge events.
-            scheduleIdleEvent(&info, appId);
+            // schedule polling event (if not yet scheduled) to check if queue
+            // becomes empty due to GC or purge events.
+            onTransitionToIdle(&info);
             continue;  // CONTINUE
         }
 
@@ -507,58 +515,63 @@ void QueueConsumptionMonitor::alarmEventDispatched()
     }
 }
 
-void QueueConsumptionMonitor::idleEventDispatched(const bsl::string& appId)
+void QueueConsumptionMonitor::idleEventDispatched()
 {
     // executed by the *QUEUE DISPATCHER* thread
 
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(d_queueState_p->queue()->inDispatcherThread());
 
-    SubStreamInfoMapIter iter = d_subStreamInfos.find(appId);
-
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(iter ==
-                                              d_subStreamInfos.end())) {
-        return;  // RETURN
-    }
-
-    SubStreamInfo& info = iter->second;
-
-    if (info.d_idleEventHandle) {
-        info.d_idleEventHandle.release();
+    if (d_idleEventHandle) {
+        d_idleEventHandle.release();
     }
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(isMonitoringDisabled() ||
-                                              info.d_state != State::e_IDLE)) {
+                                              d_numIdleSubStreams == 0)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
         return;  // RETURN
     }
 
-    BSLS_ASSERT_SAFE(info.d_state == State::e_IDLE);
-
-    // Call callback to check un-delivered messages with alarm time in the
-    // past.
+    // Iterate all substreams in idle state and check un-delivered messages
+    // with alarm time in the past.
     bsls::TimeInterval now = d_queueState_p->scheduler()->now();
-    bsls::TimeInterval alarmTime;
-    bslma::ManagedPtr<mqbi::StorageIterator> oldestMsgIt =
-        d_haveUndeliveredCb(&alarmTime, appId, now);
+    for (SubStreamInfoMapIter iter = d_subStreamInfos.begin(),
+                              last = d_subStreamInfos.end();
+         iter != last && d_numIdleSubStreams > 0;
+         ++iter) {
+        SubStreamInfo&     info  = iter->second;
+        const bsl::string& appId = iter->first;
+
+        if (info.d_state != State::e_IDLE) {
+            continue;  // CONTINUE
+        }
 
-    if (oldestMsgIt) {
-        // There are un-delivered messages with alarm time in the past,
-        // schedule the idle event.
-        if (alarmTime <= now) {
-            scheduleIdleEvent(&info, appId);
+        bsls::TimeInterval                       alarmTime;
+        bslma::ManagedPtr<mqbi::StorageIterator> oldestMsgIt =
+            d_haveUndeliveredCb(&alarmTime, appId, now);
+
+        if (oldestMsgIt) {
+            // There are un-delivered messages with alarm time in the past,
+            // the substream remains in idle state.
+            if (alarmTime <= now) {
+                continue;  // CONTINUE
+            }
 
-            return;  // RETURN
+            // Since there is the oldest un-delivered message with alarm time
+            // in the future, schedule or reschedule the alarm event if needed.
+            scheduleOrRescheduleAlarmEventIfNeeded(alarmTime);
         }
 
-        // Since there is the oldest un-delivered message with alarm time in
-        // the future, schedule or reschedule the alarm event if needed.
-        scheduleOrRescheduleAlarmEventIfNeeded(alarmTime);
+        // There are no un-delivered messages or alarm time of the oldest
+        // message is in the future, so we can transition the substream to
+        // alive state.
+        onTransitionToAlive(&info, appId);
     }
 
-    // There are no un-delivered messages or alarm time of the oldest message
-    // is in the future, so we can transition the substream to alive state.
-    onTransitionToAlive(&info, appId);
+    // Keep tracking the substreams remaining in idle state.
+    if (d_numIdleSubStreams > 0) {
+        scheduleIdleEvent();
+    }
 }
 
 // ACCESSORS
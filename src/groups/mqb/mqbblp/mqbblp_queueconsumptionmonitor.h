@@ -44,6 +44,10 @@
 /// record is written to the log. When queue becomes empty for corresponding
 /// substream (e.g. by queue purging or messages garbage collected due to TTL),
 /// it is put back to 'alive' state and an INFO record is written to the log.
+/// All the substreams in 'idle' state are tracked by a single idle event,
+/// which is only scheduled while at least one substream is 'idle', so that
+/// the cost of monitoring does not depend on the number of substreams until
+/// they become 'idle'.
 ///
 /// The `maxIdleTime` represents the minimum time before an alarm will be
 /// emitted would the queue be stale (the oldest message is not delivered
@@ -188,13 +192,8 @@ class QueueConsumptionMonitor {
 
         SubStreamInfo();
 
-        ~SubStreamInfo();
-
         // PUBLIC DATA
 
-        /// EventHandle for the idle event, used by event scheduler.
-        bdlmt::EventSchedulerEventHandle d_idleEventHandle;
-
         /// The current state.
         State::Enum d_state;
     };
@@ -214,6 +213,13 @@ class QueueConsumptionMonitor {
     /// EventHandle for triggering alarm, used by event scheduler.
     bdlmt::EventSchedulerEventHandle d_alarmEventHandle;
 
+    /// EventHandle for the idle event, used by event scheduler, shared by all
+    /// the substreams in idle state.
+    bdlmt::EventSchedulerEventHandle d_idleEventHandle;
+
+    /// Number of substreams in idle state.
+    int d_numIdleSubStreams;
+
     /// Maximum time, in seconds, before the queue is declared idle.
     bsls::Types::Int64 d_maxIdleTimeSec;
 
@@ -249,10 +255,15 @@ class QueueConsumptionMonitor {
     SubStreamInfo& subStreamInfo(const bsl::string& appId);
 
     /// Update the specified `subStreamInfo`, associated to the specified
-    /// `appId`, and write log, upon transition to alive state.
+    /// `appId`, and write log, upon transition to alive state.  Cancel the
+    /// idle event if no substream remains in idle state.
     void onTransitionToAlive(SubStreamInfo*     subStreamInfo,
                              const bsl::string& appId);
 
+    /// Update the specified `subStreamInfo` upon transition to idle state,
+    /// and schedule the idle event if it was not scheduled.
+    void onTransitionToIdle(SubStreamInfo* subStreamInfo);
+
     /// Schedule the alarm event for the specified `alarmTime`.
     void scheduleAlarmEvent(const bsls::TimeInterval& alarmTime);
 
@@ -262,9 +273,8 @@ class QueueConsumptionMonitor {
     void scheduleOrRescheduleAlarmEventIfNeeded(
         const bsls::TimeInterval& alarmTime);
 
-    /// Schedule the idle event for the specified `subStreamInfo` and `appId`.
-    void scheduleIdleEvent(SubStreamInfo*     subStreamInfo,
-                           const bsl::string& appId);
+    /// Schedule the idle event tracking all the substreams in idle state.
+    void scheduleIdleEvent();
 
     /// Handler called by EventScheduler in scheduler dispatcher thread
     /// to forward alarm event to the queue dispatcher thread.
@@ -272,12 +282,11 @@ class QueueConsumptionMonitor {
 
     /// Handler called by EventScheduler in scheduler dispatcher thread
     /// to forward idle event to the queue dispatcher thread.
-    void executeIdleInQueueDispatcher(const bsl::string& appId);
+    void executeIdleInQueueDispatcher();
 
-    /// Cancel all idle events (for all substreams) if they were scheduled.
-    /// If the specified `resetStates` is true, reset substreams states.
+    /// Cancel the idle event if it was scheduled.  If the specified
+    /// `resetStates` is true, reset substreams states.
     void cancelIdleEvents(bool resetStates);
-    void cancelIdleEvents(SubStreamInfo* info);
 
   protected:
     /// Alarm event dispatcher, executed in queue dispatcher thread.
@@ -287,9 +296,10 @@ class QueueConsumptionMonitor {
     virtual void alarmEventDispatched();
 
     /// Idle event dispatcher, executed in queue dispatcher thread.
-    /// If there are no un-delivered messages the specified `appId`, it calls
-    /// onTransitionToAlive(). Otherwise, it reschedules idle event.
-    virtual void idleEventDispatched(const bsl::string& appId);
+    /// For each substream in idle state having no un-delivered messages with
+    /// alarm time in the past, it calls onTransitionToAlive().  If any
+    /// substream remains in idle state, it reschedules idle event.
+    virtual void idleEventDispatched();
 
   public:
     // TRAITS
@@ -362,6 +372,9 @@ class QueueConsumptionMonitor {
     /// Return `true` if the alarm event is scheduled, and `false` otherwise.
     bool isAlarmScheduled() const;
 
+    /// Return `true` if the idle event is scheduled, and `false` otherwise.
+    bool isIdleEventScheduled() const;
+
     /// Return `true` if monitoring is disabled (d_maxIdleTimeSec is zero),
     /// and `false` otherwise.
     bool isMonitoringDisabled() const;
@@ -430,6 +443,11 @@ inline bool QueueConsumptionMonitor::isAlarmScheduled() const
     return d_alarmEventHandle != 0;
 }
 
+inline bool QueueConsumptionMonitor::isIdleEventScheduled() const
+{
+    return d_idleEventHandle != 0;
+}
+
 inline bool QueueConsumptionMonitor::isMonitoringDisabled() const
 {
     return d_maxIdleTimeSec == 0;
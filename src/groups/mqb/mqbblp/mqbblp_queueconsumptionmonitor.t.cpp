@@ -79,7 +79,7 @@ class QueueConsumptionMonitorTest : public QueueConsumptionMonitor {
 
     void alarmEventDispatched() BSLS_KEYWORD_OVERRIDE;
 
-    void idleEventDispatched(const bsl::string& appId) BSLS_KEYWORD_OVERRIDE;
+    void idleEventDispatched() BSLS_KEYWORD_OVERRIDE;
 };
 
 QueueConsumptionMonitorTest::QueueConsumptionMonitorTest(
@@ -104,9 +104,9 @@ void QueueConsumptionMonitorTest::alarmEventDispatched()
     QueueConsumptionMonitor::alarmEventDispatched();
 }
 
-void QueueConsumptionMonitorTest::idleEventDispatched(const bsl::string& appId)
+void QueueConsumptionMonitorTest::idleEventDispatched()
 {
-    QueueConsumptionMonitor::idleEventDispatched(appId);
+    QueueConsumptionMonitor::idleEventDispatched();
 }
 
 struct MockStorageIterator : public mqbi::StorageIterator {
@@ -519,7 +519,7 @@ BMQTST_TEST_F(Test, putAliveIdleEmptyAlive)
     // Simulate message removing due to TTL or queue purge
     d_haveUndelivered.erase(d_id);
 
-    d_monitor.idleEventDispatched(d_id);
+    d_monitor.idleEventDispatched();
 
     BMQTST_ASSERT_EQ(d_monitor.state(d_id),
                      QueueConsumptionMonitor::State::e_ALIVE);
@@ -715,6 +715,66 @@ BMQTST_TEST_F(Test, putAliveIdleSendAliveTwoSubstreams)
                      QueueConsumptionMonitor::State::e_ALIVE);
 }
 
+BMQTST_TEST_F(Test, idleSubstreamsShareIdleEvent)
+// ------------------------------------------------------------------------
+// Concerns: All the substreams in 'idle' state are tracked by a single idle
+//   event, which is cancelled once no substream is 'idle' anymore.
+//
+// Plan: Put messages for two substreams, make time pass until both flip to
+// 'idle', check the idle event is scheduled, empty the queue of the first
+// substream and dispatch the idle event, check only the first one flips
+// back to 'alive' and the idle event is still scheduled, consume the
+// message of the second one and check the idle event is cancelled.
+// ------------------------------------------------------------------------
+{
+    mqbu::StorageKey key1, key2;
+    key1.fromHex("ABCDEF1234");
+    key2.fromHex("1234ABCDEF");
+    bsl::string id1("app1");
+    bsl::string id2("app2");
+
+    d_monitor.setMaxIdleTime(1);
+
+    bmqu::MemOutStream errorDescription(d_allocator_p);
+    d_storage.addVirtualStorage(errorDescription, id1, key1);
+    d_storage.addVirtualStorage(errorDescription, id2, key2);
+
+    d_monitor.registerSubStream(id1);
+    d_monitor.registerSubStream(id2);
+
+    BMQTST_ASSERT(!d_monitor.isIdleEventScheduled());
+
+    putMessage(id1);
+    putMessage(id2);
+
+    d_monitor.alarmEventDispatched();
+
+    BMQTST_ASSERT_EQ(d_monitor.state(id1),
+                     QueueConsumptionMonitor::State::e_IDLE);
+    BMQTST_ASSERT_EQ(d_monitor.state(id2),
+                     QueueConsumptionMonitor::State::e_IDLE);
+    BMQTST_ASSERT(d_monitor.isIdleEventScheduled());
+
+    // Simulate message removing due to TTL or queue purge
+    d_haveUndelivered.erase(id1);
+
+    d_monitor.idleEventDispatched();
+
+    BMQTST_ASSERT_EQ(d_monitor.state(id1),
+                     QueueConsumptionMonitor::State::e_ALIVE);
+    BMQTST_ASSERT_EQ(d_monitor.state(id2),
+                     QueueConsumptionMonitor::State::e_IDLE);
+    BMQTST_ASSERT(d_monitor.isIdleEventScheduled());
+
+    // Consume message from second substream
+    d_haveUndelivered.erase(id2);
+    d_monitor.onMessageSent(id2);
+
+    BMQTST_ASSERT_EQ(d_monitor.state(id2),
+                     QueueConsumptionMonitor::State::e_ALIVE);
+    BMQTST_ASSERT(!d_monitor.isIdleEventScheduled());
+}
+
 BMQTST_TEST_F(Test, usage)
 // -------------------------------------------------------------------------
 // Concerns: Make sure the usage example is correct.
@@ -757,7 +817,7 @@ BMQTST_TEST_F(Test, usage)
     monitor.onMessageSent(d_id);
 
     // Simulate idle event dispatching
-    monitor.idleEventDispatched(d_id);
+    monitor.idleEventDispatched();
 
     // remain IDLE
     BMQTST_ASSERT_EQ(d_monitor.state(d_id),
@@ -34,6 +34,7 @@
 #include <mqbi_queue.h>
 #include <mqbs_storageutil.h>
 #include <mqbstat_queuestats.h>
+#include <mqbu_resourceusagemonitor.h>
 
 #include <bmqtsk_alarmlog.h>
 #include <bmqu_temputil.h>
@@ -44,9 +45,13 @@
 #include <ball_logthrottle.h>
 #include <bdlbb_blob.h>
 #include <bdlbb_blobutil.h>
+#include <bdld_datum.h>
+#include <bdlma_localsequentialallocator.h>
 #include <bdls_filesystemutil.h>
+#include <bsl_algorithm.h>
 #include <bsl_fstream.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bsla_annotations.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
@@ -110,6 +115,21 @@ getMessageQueueTime(const mqbi::StorageMessageAttributes& attributes)
     return timeDelta;
 }
 
+// Return delivered message's queue-time from the specified 'attributes' at
+// the specified 'now' high resolution timer value.
+bsls::Types::Int64
+getMessageQueueTime(const mqbi::StorageMessageAttributes& attributes,
+                    bsls::Types::Int64                    now)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 !=
+                                            attributes.arrivalTimepoint())) {
+        return now - attributes.arrivalTimepoint();  // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    return getMessageQueueTime(attributes);
+}
+
 /// Result of a consumer selection, populated by visitors below.
 class FoundConsumer {
   public:
@@ -756,6 +776,8 @@ QueueEngineUtil_AppsDeliveryContext::QueueEngineUtil_AppsDeliveryContext(
 , d_currentMessage_p(0)
 , d_queue_p(queue)
 , d_timeDelta()
+, d_priorityProperty(allocator)
+, d_priorityLane()
 , d_revCounter(0)
 {
     BSLS_ASSERT_SAFE(queue);
@@ -766,6 +788,7 @@ bool QueueEngineUtil_AppsDeliveryContext::reset(
 {
     d_consumers.clear();
     d_timeDelta.reset();
+    d_priorityLane.reset();
 
     bool result = false;
 
@@ -809,6 +832,15 @@ bool QueueEngineUtil_AppsDeliveryContext::processApp(
             // The queue iterator can advance leaving the 'app' behind.
             app.setResumePoint(d_currentMessage_p->guid());
         }
+        else if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                     !d_priorityProperty.empty() && app.isAuthorized())) {
+            // The 'app' is behind.  Let a message with priority overtake the
+            // ones in the way (in 'deliverMessages').
+            const int lane = priorityLane(*app.routing()->d_queue_p);
+            if (lane > 0) {
+                app.putForPriority(d_currentMessage_p->guid(), lane);
+            }
+        }
         ++d_numStops;
         // else the existing resumePoint is earlier (if authorized)
         return false;  // RETURN
@@ -905,6 +937,42 @@ bool QueueEngineUtil_AppsDeliveryContext::haveProgress() const
     return (d_numStops < d_numApps || d_numApps == 0);
 }
 
+void QueueEngineUtil_AppsDeliveryContext::setPriorityProperty(
+    const bsl::string& name)
+{
+    d_priorityProperty = name;
+}
+
+int QueueEngineUtil_AppsDeliveryContext::priorityLane(
+    Routers::QueueRoutingContext& queue)
+{
+    if (d_priorityLane.has_value()) {
+        return d_priorityLane.value();  // RETURN
+    }
+
+    bdlma::LocalSequentialAllocator<64> localAllocator;
+
+    queue.d_preader->next(d_currentMessage_p);
+    const bdld::Datum value = queue.d_preader->get(d_priorityProperty,
+                                                   &localAllocator);
+    queue.d_preader->next(0);
+
+    bsls::Types::Int64 lane = 0;
+    if (value.isInteger()) {
+        lane = value.theInteger();
+    }
+    else if (value.isInteger64()) {
+        lane = value.theInteger64();
+    }
+    // else no (or not an integer) priority: the lowest lane
+
+    d_priorityLane = static_cast<int>(bsl::min<bsls::Types::Int64>(
+        bsl::max<bsls::Types::Int64>(lane, 0),
+        QueueEngineUtil_AppState::k_NUM_PRIORITY_LANES - 1));
+
+    return d_priorityLane.value();
+}
+
 bsls::Types::Int64 QueueEngineUtil_AppsDeliveryContext::timeDelta()
 {
     if (!d_timeDelta.has_value()) {
@@ -949,12 +1017,20 @@ QueueEngineUtil_AppState::QueueEngineUtil_AppState(
 , d_upstreamSubQueueId(upstreamSubQueueId)
 , d_isScheduled(false)
 , d_appOrdinal(mqbi::Storage::k_INVALID_ORDINAL)
+, d_priorityLanes(allocator)
+, d_prioritizedGuids(allocator)
+, d_priorityBudget(k_PRIORITY_BURST)
 {
     // Above, we retrieve domain config from 'queue' only if self node is a
     // cluster member, and pass a dummy config if self is proxy, because proxy
     // nodes don't load the domain config.
     BSLS_ASSERT_SAFE(d_scheduler_p);
 
+    d_priorityLanes.reserve(k_NUM_PRIORITY_LANES - 1);
+    for (int i = 1; i < k_NUM_PRIORITY_LANES; ++i) {
+        d_priorityLanes.emplace_back(allocator);
+    }
+
     d_appSubscription.d_evaluationContext_p =
         &d_routing_sp->d_queue_p->d_evaluationContext;
 
@@ -998,21 +1074,39 @@ size_t QueueEngineUtil_AppState::catchUp(
 
     d_resumePoint = bmqt::MessageGUID();
 
+    // Read the clocks once for the whole pass rather than for each message:
+    // a pass only takes a fraction of the granularity of the throttling
+    // delays and of the queue time metrics.
+
+    const bsls::TimeInterval now   = bmqu::Time::nowMonotonicClock();
+    const bsls::Types::Int64 timer = bmqu::Time::highResolutionTimer();
+
     size_t                       numMessages = 0;
     const mqbi::StorageIterator* current     = 0;
     while ((current = start->next())) {
         Routers::Result result = Routers::e_SUCCESS;
 
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                !d_prioritizedGuids.empty() &&
+                d_prioritizedGuids.erase(current->guid()))) {
+            // Already delivered from a priority lane.
+            continue;  // CONTINUE
+        }
+
         if (QueueEngineUtil::isBroadcastMode(d_queue_p)) {
             broadcastOneMessage(current);
         }
         else {
-            result = tryDeliverOneMessage(delay, current);
+            result = tryDeliverOneMessage(delay, current, now);
 
             if (result == Routers::e_SUCCESS) {
-                reportStats(current);
+                reportStats(current, timer);
 
                 ++numMessages;
+
+                // A message delivered in order renews the budget of the
+                // priority lanes.
+                d_priorityBudget = k_PRIORITY_BURST;
             }
             else if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
                          result == Routers::e_NO_CAPACITY ||
@@ -1031,15 +1125,29 @@ size_t QueueEngineUtil_AppState::catchUp(
                 BSLS_ASSERT_SAFE(result == Routers::e_INVALID);
                 // The {GUID, App} is not valid anymore
             }
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(priorityLanesSize())) {
+                // The message is not ahead of the resume point anymore.
+                for (size_t i = 0; i < d_priorityLanes.size(); ++i) {
+                    d_priorityLanes[i].erase(current->guid());
+                }
+            }
         }
     }
 
+    if (d_resumePoint.isUnset()) {
+        // Caught up: no message is ahead of the resume point.  Forget the
+        // messages which got confirmed, gc'ed or purged before being reached.
+        clearPriorityLanes();
+    }
+
     return numMessages;
 }
 
 Routers::Result QueueEngineUtil_AppState::tryDeliverOneMessage(
     bsls::TimeInterval*          delay,
-    const mqbi::StorageIterator* message)
+    const mqbi::StorageIterator* message,
+    const bsls::TimeInterval&    now)
 {
     BSLS_ASSERT_SAFE(message);
 
@@ -1071,7 +1179,6 @@ Routers::Result QueueEngineUtil_AppState::tryDeliverOneMessage(
     //         'delay' and return false.
 
     bsls::TimeInterval messageDelay;
-    bsls::TimeInterval now = bmqu::Time::nowMonotonicClock();
     FoundConsumer      found;
 
     Routers::Result result = Routers::e_SUCCESS;
@@ -1131,6 +1238,23 @@ QueueEngineUtil_AppState::processDeliveryLists(bsls::TimeInterval*    delay,
     BSLS_ASSERT_SAFE(delay);
 
     size_t numMessages = processDeliveryList(delay, reader, d_redeliveryList);
+
+    // Messages with priority go first, highest lane first, as long as they
+    // do not starve the messages without priority (see 'catchUp').
+    for (size_t i = d_priorityLanes.size();
+         i > 0 && d_priorityBudget > 0 && *delay == bsls::TimeInterval();
+         --i) {
+        const size_t numPrioritized = processDeliveryList(
+            delay,
+            reader,
+            d_priorityLanes[i - 1],
+            static_cast<size_t>(d_priorityBudget),
+            &d_prioritizedGuids);
+
+        d_priorityBudget -= static_cast<int>(numPrioritized);
+        numMessages += numPrioritized;
+    }
+
     if (*delay == bsls::TimeInterval()) {
         // The only excuse for stopping the iteration is poisonous message
         numMessages += processDeliveryList(delay, reader, d_putAsideList);
@@ -1148,7 +1272,9 @@ QueueEngineUtil_AppState::processDeliveryLists(bsls::TimeInterval*    delay,
 size_t
 QueueEngineUtil_AppState::processDeliveryList(bsls::TimeInterval*    delay,
                                               mqbi::StorageIterator* reader,
-                                              RedeliveryList&        list)
+                                              RedeliveryList&        list,
+                                              size_t            maxMessages,
+                                              PrioritizedGuids* delivered)
 {
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(list.empty())) {
         return 0;  // RETURN
@@ -1159,6 +1285,10 @@ QueueEngineUtil_AppState::processDeliveryList(bsls::TimeInterval*    delay,
     bmqt::MessageGUID        firstGuid   = *it;
     size_t                   numMessages = 0;
 
+    // See 'catchUp'.
+    const bsls::TimeInterval now   = bmqu::Time::nowMonotonicClock();
+    const bsls::Types::Int64 timer = bmqu::Time::highResolutionTimer();
+
     while (!list.isEnd(it)) {
         Routers::Result result = Routers::e_INVALID;
 
@@ -1183,7 +1313,7 @@ QueueEngineUtil_AppState::processDeliveryList(bsls::TimeInterval*    delay,
                 << reader->appMessageView(ordinal()).d_state << ")";
         }
         else {
-            result = tryDeliverOneMessage(delay, reader);
+            result = tryDeliverOneMessage(delay, reader, now);
         }
         // TEMPORARILY handling unknown 'Group's in RelayQE by reevaluating.
         // Instead, should communicate them upstream either in CloseQueue or in
@@ -1196,11 +1326,19 @@ QueueEngineUtil_AppState::processDeliveryList(bsls::TimeInterval*    delay,
             break;  // BREAK
         }
         else if (result == Routers::e_SUCCESS) {
+            if (delivered) {
+                delivered->insert(*it);
+            }
+
             // Remove from the redeliveryList
             it = list.erase(it);
 
             ++numMessages;
-            reportStats(reader);
+            reportStats(reader, timer);
+
+            if (numMessages == maxMessages) {
+                break;  // BREAK
+            }
         }
         else if (result == Routers::e_INVALID) {
             // Couldn't send it, but will never be able to do so; just consider
@@ -1313,6 +1451,9 @@ void QueueEngineUtil_AppState::undoRouting()
 
     d_redeliveryList.touch();
     d_putAsideList.touch();
+    for (size_t i = 0; i < d_priorityLanes.size(); ++i) {
+        d_priorityLanes[i].touch();
+    }
 }
 
 void QueueEngineUtil_AppState::rebuildConsumers(
@@ -1350,7 +1491,18 @@ bool QueueEngineUtil_AppState::transferUnconfirmedMessages(
     const bmqp_ctrlmsg::SubQueueIdInfo& subQueue)
 {
     // Redistribute messages: append all pending messages to
-    // the redelivery list.
+    // the redelivery list.  Size the list for all of them first, instead of
+    // growing it repeatedly while the messages are added.
+
+    const bsl::vector<const mqbu::ResourceUsageMonitor*> monitors =
+        handle->unconfirmedMonitors(appId());
+    bsls::Types::Int64 numUnconfirmed = 0;
+    for (size_t i = 0; i < monitors.size(); ++i) {
+        numUnconfirmed += monitors[i]->messages();
+    }
+    if (numUnconfirmed > 0) {
+        d_redeliveryList.reserve(static_cast<size_t>(numUnconfirmed));
+    }
 
     int numMsgs = handle->transferUnconfirmedMessageGUID(
         bdlf::BindUtil::bind(&RedeliveryList::add,
@@ -1403,6 +1555,14 @@ Routers::Result QueueEngineUtil_AppState::selectConsumer(
 int QueueEngineUtil_AppState::setSubscription(
     const mqbconfm::Expression& value)
 {
+    if (d_subcriptionExpression == value &&
+        (d_subcriptionExpression.text().empty() ||
+         d_appSubscription.d_evaluator.isValid())) {
+        // Domain reconfiguration re-applies every subscription; keep the
+        // compiled expression when it has not changed.
+        return 0;  // RETURN
+    }
+
     d_subcriptionExpression = value;
 
     if (mqbconfm::ExpressionVersion::E_VERSION_1 == value.version()) {
@@ -1469,6 +1629,16 @@ void QueueEngineUtil_AppState::clear()
     d_resumePoint = bmqt::MessageGUID();
     d_redeliveryList.clear();
     d_putAsideList.clear();
+    clearPriorityLanes();
+}
+
+void QueueEngineUtil_AppState::clearPriorityLanes()
+{
+    for (size_t i = 0; i < d_priorityLanes.size(); ++i) {
+        d_priorityLanes[i].clear();
+    }
+    d_prioritizedGuids.clear();
+    d_priorityBudget = k_PRIORITY_BURST;
 }
 
 void QueueEngineUtil_AppState::loadInternals(mqbcmd::AppState* out) const
@@ -1480,11 +1650,13 @@ void QueueEngineUtil_AppState::loadInternals(mqbcmd::AppState* out) const
 }
 
 void QueueEngineUtil_AppState::reportStats(
-    const mqbi::StorageIterator* message) const
+    const mqbi::StorageIterator* message,
+    bsls::Types::Int64           now) const
 {
     if (bmqp::QueueId::k_PRIMARY_QUEUE_ID == d_queue_p->id()) {
         const bsls::Types::Int64 timeDelta = getMessageQueueTime(
-            message->attributes());
+            message->attributes(),
+            now);
 
         // First report 'queue time' metric for the entire queue
         d_queue_p->stats()
@@ -280,6 +280,11 @@ class RedeliveryList {
     /// Add the specified `guid` to the list.
     void add(const bmqt::MessageGUID& guid);
 
+    /// Make the list able to hold the specified `numAdditional` items on
+    /// top of its current ones without growing more than once, so that a
+    /// large number of items can be added in linear time.
+    void reserve(size_t numAdditional);
+
     /// Empty the list.
     void clear();
 
@@ -337,6 +342,22 @@ struct QueueEngineUtil_AppState {
         virtual const mqbi::StorageIterator* next() = 0;
     };
 
+    /// Set of GUIDs of messages delivered ahead of the resume point.
+    typedef bsl::unordered_set<bmqt::MessageGUID,
+                               bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+        PrioritizedGuids;
+
+    // PUBLIC CONSTANTS
+
+    /// Number of priority lanes of the messages, lane 0 being the one of the
+    /// messages without priority which are delivered in order.
+    static const int k_NUM_PRIORITY_LANES = 4;
+
+    /// Maximum number of messages delivered from the priority lanes before
+    /// `catchUp` delivers at least one message in order, so that messages
+    /// without priority are not starved.
+    static const int k_PRIORITY_BURST = 16;
+
   private:
     // PRIVATE DATA
 
@@ -381,6 +402,18 @@ struct QueueEngineUtil_AppState {
     /// When at capacity, resume point.
     bmqt::MessageGUID d_resumePoint;
 
+    /// Messages past the resume point with a priority and not delivered yet,
+    /// one list per priority lane, lane 1 first.
+    bsl::vector<RedeliveryList> d_priorityLanes;
+
+    /// Messages past the resume point which were delivered from the priority
+    /// lanes, and which `catchUp` skips.
+    PrioritizedGuids d_prioritizedGuids;
+
+    /// Number of messages which can still be delivered from the priority
+    /// lanes before `catchUp` has to deliver a message in order.
+    int d_priorityBudget;
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(QueueEngineUtil_AppState,
@@ -424,26 +457,42 @@ struct QueueEngineUtil_AppState {
     /// specified `delay` and return `e_DELAY`.  If no delay is required, try
     /// to send the `message` to a highest priority consumer with matching
     /// subscription.  Return corresponding result: `e_SUCCESS`,
-    /// `e_NO_SUBSCRIPTION`, `e_NO_CAPACITY`. or `e_NO_CAPACITY_ALL`.
+    /// `e_NO_SUBSCRIPTION`, `e_NO_CAPACITY`. or `e_NO_CAPACITY_ALL`.  Use
+    /// the specified `now` monotonic clock time as the time of delivery.
     /// NOTE: the messages sent by this routine are out of order.
     Routers::Result tryDeliverOneMessage(bsls::TimeInterval*          delay,
-                                         const mqbi::StorageIterator* message);
-
-    /// Broadcast to all available consumers, the message having specified
-    /// `appData`, `options`, `guid` and `attributes`.  Behavior is
-    /// undefined unless `appData` is non-null.
+                                         const mqbi::StorageIterator* message,
+                                         const bsls::TimeInterval&    now);
+
+    /// Broadcast to all available consumers the message pointed to by the
+    /// specified `storageIter`.  Note that the application data of the
+    /// message is not copied: every consumer is passed the same shared blob,
+    /// which the session of each consumer appends by reference to its PUSH
+    /// event, after writing only the headers specific to that consumer.
+    /// Behavior is undefined unless the application data of the message is
+    /// non-null.
     void broadcastOneMessage(const mqbi::StorageIterator* storageIter);
 
+    /// Attempt to deliver the messages of the Redelivery List, then of the
+    /// priority lanes (highest first, within the `k_PRIORITY_BURST` budget),
+    /// and then of the PutAside List, using the specified `reader`.  Load
+    /// the lowest handle delay into the specified `delay`.  Return number of
+    /// delivered messages.
     size_t processDeliveryLists(bsls::TimeInterval*    delay,
                                 mqbi::StorageIterator* reader);
 
     /// Process delivery of messages in the redelivery list.  The specified
     /// `getMessageCb` provides message details for redelivery.  Load the
     /// lowest handle delay into the specified `delay`. Return number of
-    /// re-delivered messages.
+    /// re-delivered messages.  Stop after delivering the optionally
+    /// specified `maxMessages`, unless it is 0.  If the optionally specified
+    /// `delivered` is not null, insert into it the GUIDs of the delivered
+    /// messages.
     size_t processDeliveryList(bsls::TimeInterval*    delay,
                                mqbi::StorageIterator* reader,
-                               RedeliveryList&        list);
+                               RedeliveryList&        list,
+                               size_t                 maxMessages = 0,
+                               PrioritizedGuids*      delivered   = 0);
 
     /// Load into the specified `out` object' internal information about
     /// this consumers group and associated queue handles.
@@ -495,7 +544,9 @@ struct QueueEngineUtil_AppState {
                                    const mqbi::StorageIterator* currentMessage,
                                    unsigned int                 ordinal);
 
-    /// Set the application subscription
+    /// Set the application subscription to the specified `value`.  Return
+    /// 0 on success, and a `bmqeval::ErrorType` otherwise.  Note that the
+    /// expression is not recompiled if it is the same as the current one.
     int setSubscription(const mqbconfm::Expression& value);
 
     /// Evaluate the application subscription
@@ -524,6 +575,12 @@ struct QueueEngineUtil_AppState {
     /// `deliverMessages`).
     void setResumePoint(const bmqt::MessageGUID& guid);
 
+    /// Save the specified `guid` of a message past the resume point in the
+    /// specified priority `lane`, so that its delivery is attempted before
+    /// the one of the messages of lower lanes.  The behavior is undefined
+    /// unless `0 < lane < k_NUM_PRIORITY_LANES` and the resume point is set.
+    void putForPriority(const bmqt::MessageGUID& guid, int lane);
+
     /// Return a reference offering modifiable access to the current routing
     /// state controlling evaluation of subscriptions.
     bsl::shared_ptr<Routers::AppContext>& routing();
@@ -551,6 +608,9 @@ struct QueueEngineUtil_AppState {
 
     size_t putAsideListSize() const;
 
+    /// Return the number of messages in the priority lanes.
+    size_t priorityLanesSize() const;
+
     size_t redeliveryListSize() const;
 
     Routers::Consumer* findQueueHandleContext(mqbi::QueueHandle* handle);
@@ -582,10 +642,15 @@ struct QueueEngineUtil_AppState {
     /// routing state controlling evaluation of subscriptions.
     const bsl::shared_ptr<Routers::AppContext>& routing() const;
 
-    /// Report queue stats upon delivery of the specified `message`.
-    void reportStats(const mqbi::StorageIterator* message) const;
+    /// Report queue stats upon delivery of the specified `message` at the
+    /// specified `now` high resolution timer value.
+    void reportStats(const mqbi::StorageIterator* message,
+                     bsls::Types::Int64           now) const;
 
   private:
+    /// Empty the priority lanes and forget the messages delivered from them.
+    void clearPriorityLanes();
+
     /// Load into the specified `out` a storage iterator pointing to the oldest
     /// message from the specified `list`.  Return `true` if the iterator is
     /// loaded successfully, `false` otherwise.
@@ -612,12 +677,26 @@ struct QueueEngineUtil_AppsDeliveryContext {
     mqbi::Queue*                      d_queue_p;
     bsl::optional<bsls::Types::Int64> d_timeDelta;
 
+    /// Name of the message property selecting the priority lane of a
+    /// message, or empty if priorities are disabled.
+    bsl::string d_priorityProperty;
+
+    /// Priority lane of the current message, read on demand.
+    bsl::optional<int> d_priorityLane;
+
     /// Count delivery attempts (as a means to invalidate `lastPush`)
     int d_revCounter;
 
     // Avoid reading the attributes if not necessary.  Get timeDelta on demand.
     // See comment in `QueueEngineUtil_AppsDeliveryContext::processApp`.
 
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Return the priority lane of the current message, reading it with the
+    /// specified `queue` routing context.
+    int priorityLane(Routers::QueueRoutingContext& queue);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(QueueEngineUtil_AppsDeliveryContext,
@@ -633,6 +712,11 @@ struct QueueEngineUtil_AppsDeliveryContext {
     /// the the `e_NO_CAPACITY_ALL` case.
     bool reset(mqbi::StorageIterator* currentMessage);
 
+    /// Set the name of the message property selecting the priority lane of
+    /// the messages to the specified `name`.  An empty `name` disables
+    /// priorities.
+    void setPriorityProperty(const bsl::string& name);
+
     /// Return `true` if the specified `app` is not a broadcast app and has an
     /// available handle to deliver the current message with the specified
     /// `ordinal`.
@@ -719,6 +803,11 @@ inline void RedeliveryList::add(const bmqt::MessageGUID& guid)
     d_map.insert(bsl::make_pair(guid, Item()));
 }
 
+inline void RedeliveryList::reserve(size_t numAdditional)
+{
+    d_map.reserve(d_map.size() + numAdditional);
+}
+
 inline void RedeliveryList::clear()
 {
     d_map.clear();
@@ -815,6 +904,17 @@ inline size_t QueueEngineUtil_AppState::putAsideListSize() const
     return d_putAsideList.size();
 }
 
+inline void
+QueueEngineUtil_AppState::putForPriority(const bmqt::MessageGUID& guid,
+                                         int                      lane)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < lane && lane < k_NUM_PRIORITY_LANES);
+    BSLS_ASSERT_SAFE(!d_resumePoint.isUnset());
+
+    d_priorityLanes[lane - 1].add(guid);
+}
+
 inline size_t QueueEngineUtil_AppState::redeliveryListSize() const
 {
     return d_redeliveryList.size();
@@ -901,6 +1001,15 @@ inline bool QueueEngineUtil_AppState::isAtEndOfStorage() const
     return d_putAsideList.size() == 0 && d_resumePoint.isUnset();
 }
 
+inline size_t QueueEngineUtil_AppState::priorityLanesSize() const
+{
+    size_t result = 0;
+    for (size_t i = 0; i < d_priorityLanes.size(); ++i) {
+        result += d_priorityLanes[i].size();
+    }
+    return result;
+}
+
 inline unsigned int QueueEngineUtil_AppState::ordinal() const
 {
     return d_appOrdinal;
@@ -45,6 +45,7 @@
 #include <bdlb_print.h>
 #include <bdlf_bind.h>
 #include <bdlt_timeunitratio.h>
+#include <bsl_algorithm.h>
 #include <bsl_cmath.h>
 #include <bsl_functional.h>
 #include <bsl_ios.h>
@@ -66,6 +67,15 @@ namespace {
 const double k_WATERMARK_RATIO = 0.8;
 // Percentage of the 'capacity' to use for the 'lowWatermark'
 
+const bsls::Types::Int64 k_MIN_RESUME_MESSAGES = 4;
+// Minimum number of messages to confirm, when the messages 'capacity' allows
+// it, before delivery to a subscription which reached its maxUnconfirmed
+// messages resumes.
+
+const double k_MIN_WATERMARK_RATIO = 0.5;
+// Lowest percentage of the messages 'capacity' to which the 'lowWatermark' is
+// lowered to honor 'k_MIN_RESUME_MESSAGES'
+
 const int k_MAX_INSTANT_MESSAGES = 10;
 // Maximum messages logged with throttling in a short period of time.
 
@@ -797,9 +807,25 @@ void QueueHandle::registerSubscription(unsigned int downstreamSubId,
     const bsls::Types::Int64 highWatermarkBytes = lowWatermarkBytes;
 
     const bsls::Types::Int64 capacityBytes        = ci.maxUnconfirmedBytes();
-    const bsls::Types::Int64 lowWatermarkMessages = bsl::ceil(
+    bsls::Types::Int64 lowWatermarkMessages = bsl::ceil(
         ci.maxUnconfirmedMessages() * k_WATERMARK_RATIO);
 
+    // With a small maxUnconfirmed messages, the ratio alone leaves a margin
+    // of one or two messages between the 'lowWatermark' and the 'capacity',
+    // so that delivery resumes, and walks the storage again, after nearly
+    // every confirm only to deliver as many messages.  Widen the margin to
+    // resume with a batch of at least 'k_MIN_RESUME_MESSAGES', without going
+    // below 'k_MIN_WATERMARK_RATIO' of the capacity, so that consumers under
+    // a proxy are not starved for long.  Note that a maxUnconfirmed of 1 is
+    // unaffected.
+    if (ci.maxUnconfirmedMessages() - lowWatermarkMessages <
+        k_MIN_RESUME_MESSAGES) {
+        lowWatermarkMessages = bsl::max(
+            ci.maxUnconfirmedMessages() - k_MIN_RESUME_MESSAGES,
+            static_cast<bsls::Types::Int64>(bsl::ceil(
+                ci.maxUnconfirmedMessages() * k_MIN_WATERMARK_RATIO)));
+    }
+
     // We only care about whether we are at or above the `capacity`
     // messages or at or below the `lowWatermark` redeliveries.
     const bsls::Types::Int64 highWatermarkMessages = lowWatermarkMessages;
@@ -1073,6 +1099,12 @@ void QueueHandle::postMessage(const bmqp::PutHeader&              putHeader,
 
     // cannot check 'd_subscriptions' unless in the QUEUE dispatcher thread
 
+    // Note that each PUT is dispatched as its own event: the event comes from
+    // the client's pool, and 'appData' and 'options' reference the buffers of
+    // the incoming PUT event rather than copies of them, so the per-message
+    // cost is a pooled object and a few reference counts.  The queue then
+    // processes each PUT independently (storage, replication, ACK), which
+    // batching several of them in one event would not save.
     bsl::shared_ptr<mqbevt::PutEvent> event_sp =
         d_clientContext_sp->client()->getEvent<mqbevt::PutEvent>();
     (*event_sp)
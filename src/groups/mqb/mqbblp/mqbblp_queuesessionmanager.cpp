@@ -35,6 +35,8 @@
 #include <bdld_datum.h>
 #include <bdld_datummapbuilder.h>
 #include <bdlf_bind.h>
+#include <bsl_algorithm.h>
+#include <bsl_limits.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_utility.h>
@@ -295,6 +297,21 @@ void QueueSessionManager::onQueueOpenCbDispatched(
         if (ins.second) {
             // First time we use this queue
             qs.d_handle_p = queueHandle;
+
+            const bsl::shared_ptr<const mqbconfm::Domain> domainConfig =
+                queueHandle->queue()->domain()->config();
+            const int maxPutRate = domainConfig ? domainConfig->maxPutRate()
+                                                : 0;
+            if (maxPutRate > 0) {
+                // Allow a burst of up to one second worth of PUT messages
+                const int maxRate = bsl::numeric_limits<int>::max() /
+                                    QueueState::k_PUT_RATE_LIMITER_UNITS;
+                const int rate    = bsl::min(maxPutRate, maxRate);
+                qs.d_putRateLimiter.configure(mqbu::FlowController::Config(
+                    mqbu::FlowController::Policy::e_LIMIT,
+                    rate,
+                    rate * QueueState::k_PUT_RATE_LIMITER_UNITS));
+            }
         }
         else {
             // We've used this queue before.  Search for the subId in the
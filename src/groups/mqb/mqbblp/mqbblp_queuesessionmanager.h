@@ -27,6 +27,7 @@
 #include <mqbi_domain.h>
 #include <mqbi_queue.h>
 #include <mqbstat_queuestats.h>
+#include <mqbu_flowcontroller.h>
 
 // BMQ
 #include <bmqp_ctrlmsg_messages.h>
@@ -109,6 +110,13 @@ class QueueSessionManager {
         /// Map of {appId, subQueueId} -> SubQueueInfo
         typedef bmqp::QueueInfo<SubQueueInfo> StreamsMap;
 
+        // CONSTANTS
+
+        /// Number of units added to `d_putRateLimiter` for each PUT message,
+        /// so that its drain rate per millisecond is the number of PUT
+        /// messages allowed per second.
+        static const int k_PUT_RATE_LIMITER_UNITS = 1000;
+
         // PUBLIC DATA
 
         /// `QueueHandle` of the queue
@@ -128,6 +136,12 @@ class QueueSessionManager {
         /// queue opened in this session
         StreamsMap d_subQueueInfosMap;
 
+        /// Leaky bucket limiting the rate of PUT messages posted by this
+        /// session to the queue, according to the `maxPutRate` of the domain
+        /// at the time the queue was opened.  Not limiting if that rate is
+        /// zero.
+        mqbu::FlowController d_putRateLimiter;
+
         // TRAITS
 
         BSLMF_NESTED_TRAIT_DECLARATION(QueueState, bslma::UsesBslmaAllocator)
@@ -357,6 +371,7 @@ inline QueueSessionManager::QueueState::QueueState(bslma::Allocator* allocator)
 : d_handle_p(0)
 , d_hasReceivedFinalCloseQueue(false)
 , d_subQueueInfosMap(allocator)
+, d_putRateLimiter()
 {
     // NOTHING
 }
@@ -366,6 +381,7 @@ inline QueueSessionManager::QueueState::QueueState(const QueueState& original,
 : d_handle_p(original.d_handle_p)
 , d_hasReceivedFinalCloseQueue(original.d_hasReceivedFinalCloseQueue)
 , d_subQueueInfosMap(original.d_subQueueInfosMap, allocator)
+, d_putRateLimiter(original.d_putRateLimiter)
 {
     // NOTHING
 }
@@ -539,7 +539,10 @@ class RelayQueueEngine BSLS_KEYWORD_FINAL : public mqbi::QueueEngine {
     // `msgGUID` into the corresponding App redelivery list.  Otherwise, insert
     // the `msgGUID` into the PushStream; insert PushStream Elements
     // (`mqbi::AppMessage`, `upstreamSubQueueId`) pairs for each recognized App
-    /// in the specified `subscriptions`.
+    /// in the specified `subscriptions`.  Note that upstream sends a single
+    /// PUSH, carrying the `appData` once, for all the Apps and subscriptions
+    /// of this node (all local consumers being aggregated into one upstream
+    /// handle); the message is then fanned out locally to every consumer.
 
     void push(mqbi::StorageMessageAttributes*     attributes,
               const bmqt::MessageGUID&            msgGUID,
@@ -79,6 +79,20 @@ static const bsls::Types::Int64 k_DEFAULT_PUT_EXPIRATION_TIMEOUT_NS =
     k_DEFAULT_PUT_EXPIRATION_TIMEOUT_MINUTES *
     bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MINUTE;
 
+/// The maximum number of bytes of un-ACKed PUTs a queue keeps for
+/// retransmission.  PUTs exceeding this budget are NACK'ed instead of being
+/// buffered.
+static const bsls::Types::Int64 k_MAX_PENDING_PUT_BYTES = 512 * 1024 * 1024;
+
+/// Return the number of bytes held by a pending PUT having the specified
+/// `appData` and `options`, either of which may be null.
+bsls::Types::Int64 heldBytes(const bsl::shared_ptr<bdlbb::Blob>& appData,
+                             const bsl::shared_ptr<bdlbb::Blob>& options)
+{
+    return (appData ? appData->length() : 0) +
+           (options ? options->length() : 0);
+}
+
 }  // close unnamed namespace
 
 // -----------------
@@ -472,6 +486,7 @@ RemoteQueue::RemoteQueue(QueueState*       state,
 , d_optionsView(allocator)
 , d_pendingPutsTimeoutNs(deduplicationTimeMs *
                          bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MILLISECOND)
+, d_pendingBytes(0)
 , d_pendingMessagesTimerEventHandle()
 , d_ackWindowSize(ackWindowSize)
 , d_unackedPutCounter(0)
@@ -525,6 +540,7 @@ RemoteQueue::RemoteQueue(QueueState*       state,
 RemoteQueue::~RemoteQueue()
 {
     BSLS_ASSERT_SAFE(d_pendingMessages.empty());
+    BSLS_ASSERT_SAFE(d_pendingBytes == 0);
     BSLS_ASSERT_SAFE(!d_pendingMessagesTimerEventHandle);
 }
 
@@ -543,7 +559,8 @@ int RemoteQueue::configure(bsl::ostream& errorDescription, bool isReconfigure)
             d_state_p->stats()->updateDomainAppIds(
                 domainCfg->mode().fanout().publishAppIdMetrics()
                     ? domainCfg->mode().fanout().appIDs()
-                    : bsl::vector<bsl::string>(d_allocator_p));
+                    : bsl::vector<bsl::string>(d_allocator_p),
+                domainCfg->mode().fanout().maxAppIdMetrics());
         }
     }
 
@@ -904,7 +921,8 @@ void RemoteQueue::postMessage(const bmqp::PutHeader&              putHeaderIn,
         return;  // RETURN
     }
 
-    bool isInvalid = false;
+    bool                  isInvalid = false;
+    bmqt::AckResult::Enum nackResult = bmqt::AckResult::e_REFUSED;
 
     if (ctx.d_state == SubStreamContext::e_CLOSED) {
         isInvalid = true;
@@ -949,13 +967,39 @@ void RemoteQueue::postMessage(const bmqp::PutHeader&              putHeaderIn,
                           << "] for guid " << putHeader.messageGUID();
         }
     }
+    else if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                 !d_state_p->isAtMostOnce() &&
+                 d_pendingBytes + heldBytes(appData, options) >
+                     k_MAX_PENDING_PUT_BYTES)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Too much data is already waiting for an ACK (most likely because
+        // the upstream is unavailable).  Do not buffer more.
+
+        isInvalid  = true;
+        nackResult = bmqt::AckResult::e_LIMIT_BYTES;
+
+        if (d_throttledFailedPutMessages.requestPermission()) {
+            BALL_LOG_WARN << "[THROTTLED] Remote queue " << d_state_p->uri()
+                          << " (id: " << d_state_p->id()
+                          << ") rejecting a PUT from client ["
+                          << source->clientContext()->description()
+                          << "] for guid " << putHeader.messageGUID()
+                          << ": "
+                          << bmqu::PrintUtil::prettyBytes(d_pendingBytes)
+                          << " of pending PUTs exceed the retransmission "
+                          << "budget of "
+                          << bmqu::PrintUtil::prettyBytes(
+                                 k_MAX_PENDING_PUT_BYTES);
+        }
+    }
 
     if (isInvalid) {
         if (!d_state_p->isAtMostOnce()) {
             bmqp::AckMessage ackMessage;
 
-            ackMessage.setStatus(bmqp::ProtocolUtil::ackResultToCode(
-                bmqt::AckResult::e_REFUSED));
+            ackMessage.setStatus(
+                bmqp::ProtocolUtil::ackResultToCode(nackResult));
             ackMessage.setMessageGUID(putHeader.messageGUID());
 
             d_state_p->stats()
@@ -1081,6 +1125,7 @@ void RemoteQueue::postMessage(const bmqp::PutHeader&              putHeaderIn,
         d_pendingMessages.insert(bsl::make_pair(
             putHeader.messageGUID(),
             PutMessage(source, putHeader, appData, options, now, state)));
+        d_pendingBytes += heldBytes(appData, options);
     }
 
     if (d_queueEngine_mp) {
@@ -1292,6 +1337,8 @@ void RemoteQueue::onAckMessageDispatched(const mqbevt::AckEvent& event)
             BSLS_ASSERT_SAFE(!it->second.d_appData && !it->second.d_options);
             it->second.d_appData = event.blob();
             it->second.d_options = event.options();
+            d_pendingBytes += heldBytes(it->second.d_appData,
+                                        it->second.d_options);
         }
         return;  // RETURN
     }
@@ -1374,6 +1421,7 @@ RemoteQueue::erasePendingMessage(Puts::iterator& it)
     if (it->second.d_state_sp) {
         it->second.d_state_sp->cancel();
     }
+    d_pendingBytes -= heldBytes(it->second.d_appData, it->second.d_options);
     return d_pendingMessages.erase(it);
 }
 
@@ -1518,6 +1566,8 @@ void RemoteQueue::retransmitPendingMessagesDispatched(
                         // This is broadcast (not time-controlled); no more
                         // retransmission unless NOT_READY NACK is received in
                         // which case NACK will supply the data.
+                        d_pendingBytes -= heldBytes(it->second.d_appData,
+                                                    it->second.d_options);
                         it->second.d_appData.clear();
                         it->second.d_options.clear();
                     }
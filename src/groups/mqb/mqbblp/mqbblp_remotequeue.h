@@ -218,6 +218,12 @@ class RemoteQueue {
     /// be Less or equal to the deduplication timeout.
     bsls::Types::Int64 d_pendingPutsTimeoutNs;
 
+    /// Total number of bytes (data and options) of the PUTs kept in
+    /// `d_pendingMessages` for retransmission.  New PUTs are NACK'ed with
+    /// `e_LIMIT_BYTES` while this is over the retransmission budget so that a
+    /// long upstream outage cannot grow the proxy memory without bounds.
+    bsls::Types::Int64 d_pendingBytes;
+
     /// Broadcast PUT can be retransmitted if it is guaranteed that the PUT did
     /// not make it to the primary.  That condition is indicated by
     /// `e_NOT_READY` NACK. To preserve order when retransmitting, broadcast
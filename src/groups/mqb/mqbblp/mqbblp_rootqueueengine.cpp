@@ -375,6 +375,12 @@ RootQueueEngine::RootQueueEngine(QueueState*             queueState,
       bdlf::BindUtil::bindS(allocator,
                             &RootQueueEngine::onFlowControlTimer,
                             this))
+, d_deliveryDelay(0)
+, d_deliveryDelayEventHandle()
+, d_deliveryDelayTimerCb(
+      bdlf::BindUtil::bindS(allocator,
+                            &RootQueueEngine::onDeliveryDelayTimer,
+                            this))
 , d_allocator_p(allocator)
 {
     // PRECONDITIONS
@@ -419,6 +425,13 @@ int RootQueueEngine::configure(bsl::ostream& errorDescription,
         domainCfg->subscriptions();
     d_hasAppSubscriptions = !subscriptions.empty();
 
+    // Broadcast messages are not stored, they cannot be held back.
+    d_deliveryDelay = QueueEngineUtil::isBroadcastMode(d_queueState_p->queue())
+                          ? 0
+                          : domainCfg->deliveryDelay();
+
+    d_appsDeliveryContext.setPriorityProperty(domainCfg->priorityProperty());
+
     if (d_isFanout) {
         const bsl::vector<bsl::string>& cfgAppIds =
             domainCfg->mode().fanout().appIDs();
@@ -430,6 +443,22 @@ int RootQueueEngine::configure(bsl::ostream& errorDescription,
                 return rc_APP_INITIALIZATION_ERROR;  // RETURN
             }
         }
+        // Reset the subscription of the Apps which no longer have one.  The
+        // others are left untouched so that an unchanged expression is not
+        // recompiled.
+        for (size_t i = 0; i < cfgAppIds.size(); ++i) {
+            bool hasSubscription = false;
+            for (unsigned int j = 0; j < subscriptions.size(); ++j) {
+                if (subscriptions[j].appId() == cfgAppIds[i]) {
+                    hasSubscription = true;
+                    break;  // BREAK
+                }
+            }
+            if (!hasSubscription) {
+                mqbconfm::Expression empty(d_allocator_p);
+                d_apps.find(cfgAppIds[i])->second->setSubscription(empty);
+            }
+        }
         for (unsigned int i = 0; i < subscriptions.size(); ++i) {
             Apps::iterator itApp = d_apps.find(subscriptions[i].appId());
             if (itApp != d_apps.end()) {
@@ -519,9 +548,6 @@ int RootQueueEngine::initializeAppId(const bsl::string& appId,
     Apps::iterator iter = d_apps.find(appId);
 
     if (iter != d_apps.end()) {
-        mqbconfm::Expression empty(d_allocator_p);
-        iter->second->setSubscription(empty);
-
         // Don't reconfigure an AppId that is already registered.
         return 0;  // RETURN
     }
@@ -583,6 +609,7 @@ int RootQueueEngine::initializeAppId(const bsl::string& appId,
 void RootQueueEngine::close()
 {
     d_scheduler_p->cancelEventAndWait(&d_flowControlEventHandle);
+    d_scheduler_p->cancelEventAndWait(&d_deliveryDelayEventHandle);
 
     d_consumptionMonitor.reset();
 }
@@ -1470,7 +1497,43 @@ void RootQueueEngine::afterNewMessage()
         mqbu::StorageKey::k_NULL_KEY);
     unsigned int batch = 0;
 
+    // Messages are iterated in the order of their arrival, so the delivery
+    // stops at the first message which is not due yet.  The arrival
+    // timestamp is recorded in the journal, hence the delay is preserved
+    // across restarts and primary changes.
+    bsls::Types::Uint64 dueTimestamp = 0;
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_deliveryDelay > 0)) {
+        dueTimestamp = bdlt::EpochUtil::convertToTimeT64(
+                           bdlt::CurrentTime::utc()) -
+                       d_deliveryDelay;
+    }
+
     while (d_appsDeliveryContext.reset(storageIt)) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                dueTimestamp != 0 &&
+                storageIt->attributes().arrivalTimestamp() > dueTimestamp)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            if (!d_deliveryDelayEventHandle) {
+                const bsls::TimeInterval timeout(
+                    static_cast<bsls::Types::Int64>(
+                        storageIt->attributes().arrivalTimestamp() -
+                        dueTimestamp),
+                    0);
+
+                d_scheduler_p->scheduleEvent(
+                    &d_deliveryDelayEventHandle,
+                    now + timeout,
+                    bdlf::BindUtil::bindS(d_allocator_p,
+                                          executeInQueueDispatcher,
+                                          queue,
+                                          d_deliveryDelayTimerCb));
+            }
+
+            d_appsDeliveryContext.reset(0);
+            break;  // BREAK
+        }
+
         // Assume, all Apps need to deliver (some may be at capacity)
         for (Apps::iterator iter = d_apps.begin(); iter != d_apps.end();
              ++iter) {
@@ -1708,6 +1771,12 @@ int RootQueueEngine::onRejectMessage(
                              << ", subQueueId: " << app.upstreamSubQueueId()
                              << "] with the counter: [" << rda << "]";
 
+        // Note that the delivery attempts counter is the one byte 'RdaInfo'
+        // held in the in-memory state of the message for that app (not in the
+        // storage attributes), so that rejecting all the unconfirmed messages
+        // of a crashing consumer only updates that state.  Only the final
+        // rejection of a message touches the storage, and its dump and alarm
+        // are throttled and offloaded to the misc thread pool.
         if (!rda.isUnlimited()) {
             BSLS_ASSERT_SAFE(counter);
             rda.setPotentiallyPoisonous(true);
@@ -2132,6 +2201,19 @@ void RootQueueEngine::onFlowControlTimer()
     afterNewMessage();
 }
 
+void RootQueueEngine::onDeliveryDelayTimer()
+{
+    // executed by the *QUEUE DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_queueState_p->queue()->inDispatcherThread());
+
+    BSLS_ASSERT_SAFE(d_deliveryDelayEventHandle);
+
+    d_deliveryDelayEventHandle.release();
+    afterNewMessage();
+}
+
 void RootQueueEngine::afterAppIdRegistered(
     const mqbi::Storage::AppInfos& addedAppIds)
 {
@@ -132,6 +132,17 @@ class RootQueueEngine BSLS_KEYWORD_FINAL : public mqbi::QueueEngine {
 
     const bsl::function<void()> d_flowControlTimerCb;
 
+    /// Minimum time, in seconds, between the arrival of a message and its
+    /// delivery, as per the `deliveryDelay` of the domain.  Zero if messages
+    /// are delivered as soon as they arrive.
+    int d_deliveryDelay;
+
+    /// Event to resume the delivery once the message the delivery has
+    /// stopped at, because of `d_deliveryDelay`, is due.
+    bdlmt::EventSchedulerEventHandle d_deliveryDelayEventHandle;
+
+    const bsl::function<void()> d_deliveryDelayTimerCb;
+
     /// Allocator to use.
     bslma::Allocator* d_allocator_p;
 
@@ -207,6 +218,11 @@ class RootQueueEngine BSLS_KEYWORD_FINAL : public mqbi::QueueEngine {
     void updateFlowControl(bsls::Types::Int64 nowMs);
     void onFlowControlTimer();
 
+    /// Resume the delivery of the messages held back by `d_deliveryDelay`.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    void onDeliveryDelayTimer();
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(RootQueueEngine, bslma::UsesBslmaAllocator)
@@ -41,6 +41,7 @@
 #include <bsla_annotations.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
+#include <bslma_testallocator.h>
 #include <bslmf_assert.h>
 #include <bslmt_semaphore.h>
 #include <bsls_timeinterval.h>
@@ -56,6 +57,11 @@
 #include <bsl_limits.h>
 #include <bsl_map.h>
 
+#ifdef BMQTST_BENCHMARK_ENABLED
+// BENCHMARK
+#include <benchmark/benchmark.h>
+#endif  // BMQTST_BENCHMARK_ENABLED
+
 // CONVENIENCE
 using namespace BloombergLP;
 using namespace bsl;
@@ -5184,6 +5190,107 @@ static void test49_closeWithScheduledAlarm()
     //   BSLS_ASSERT_SAFE(!d_alarmEventHandle)
 }
 
+// ============================================================================
+//                              PERFORMANCE TESTS
+// ----------------------------------------------------------------------------
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void testN4_priorityDelivery_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// PRIORITY DELIVERY BENCHMARK
+//
+// Concerns:
+//   Measure the cost of routing messages through the 'RootQueueEngine' of
+//   a priority queue to 'state.range(0)' consumers of the same priority,
+//   posting and confirming messages in batches of 'state.range(1)', so
+//   that routing changes can be compared before being deployed.
+//
+// Plan:
+//   For each iteration, post a batch of messages, deliver them and have
+//   every consumer confirm what it received.  Report, in addition to the
+//   throughput, the number of allocations per message and the delivery
+//   skew, i.e. the difference between the largest and the smallest number
+//   of messages delivered to a consumer relative to the mean.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: PRIORITY DELIVERY");
+
+    const int numConsumers = static_cast<int>(state.range(0));
+    const int batchSize    = static_cast<int>(state.range(1));
+
+    bslma::TestAllocator      ta("benchmark",
+                                 bmqtst::TestHelperUtil::allocator());
+    mqbblp::QueueEngineTester tester(priorityDomainConfig(),
+                                     false,  // start scheduler
+                                     &ta);
+
+    mqbblp::QueueEngineTesterGuard<mqbblp::RootQueueEngine> guard(&tester);
+
+    bsl::vector<bsl::string>           clients(&ta);
+    bsl::vector<mqbmock::QueueHandle*> handles(&ta);
+    for (int i = 0; i < numConsumers; ++i) {
+        bmqu::MemOutStream clientKey(&ta);
+        clientKey << "C" << (i + 1);
+        clients.push_back(clientKey.str());
+
+        handles.push_back(tester.getHandle(clients.back() + " readCount=1"));
+        tester.configureHandle(clients.back() +
+                               " consumerPriority=1 consumerPriorityCount=1");
+    }
+
+    bsl::vector<bsls::Types::Int64> numDelivered(&ta);
+    numDelivered.resize(numConsumers, 0);
+
+    bsls::Types::Int64       msgId          = 0;
+    const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+    // <time>
+    for (auto _ : state) {
+        bmqu::MemOutStream batch(&ta);
+        for (int i = 0; i < batchSize; ++i) {
+            batch << (i == 0 ? "" : ",") << ++msgId;
+        }
+        tester.post(batch.str());
+        tester.afterNewMessage(batchSize);
+
+        for (int i = 0; i < numConsumers; ++i) {
+            const int count = handles[i]->_numMessages();
+            if (count != 0) {
+                numDelivered[i] += count;
+                tester.confirm(clients[i], handles[i]->_messages());
+            }
+        }
+    }
+    // </time>
+
+    state.SetItemsProcessed(state.iterations() * batchSize);
+
+    const bsls::Types::Int64 maxDelivered = *bsl::max_element(
+        numDelivered.begin(),
+        numDelivered.end());
+    const bsls::Types::Int64 minDelivered = *bsl::min_element(
+        numDelivered.begin(),
+        numDelivered.end());
+    const double meanDelivered = static_cast<double>(msgId) / numConsumers;
+
+    state.counters["allocs_per_msg"] = static_cast<double>(
+                                           ta.numAllocations() -
+                                           numAllocations) /
+                                       static_cast<double>(msgId);
+    state.counters["skew"] = meanDelivered == 0
+                                 ? 0
+                                 : static_cast<double>(maxDelivered -
+                                                       minDelivered) /
+                                       meanDelivered;
+}
+#else
+static void testN4_priorityDelivery()
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: PRIORITY DELIVERY");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+#endif  // BMQTST_BENCHMARK_ENABLED
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -5261,11 +5368,24 @@ int main(int argc, char* argv[])
         case -1: testN1_broadcastExhaustiveSubscriptions(); break;
         case -2: testN2_broadcastExhaustiveCanDeliver(); break;
         case -3: testN3_broadcastExhaustiveConsumerPriority(); break;
+        case -4:
+            BMQTST_BENCHMARK_WITH_ARGS(
+                testN4_priorityDelivery,
+                ArgsProduct({{1, 4, 16}, {1, 64}})
+                    ->ArgNames({"consumers", "batch"}));
+            break;
         default: {
             cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
             bmqtst::TestHelperUtil::testStatus() = -1;
         } break;
         }
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+        if (_testCase < 0) {
+            benchmark::Initialize(&argc, argv);
+            benchmark::RunSpecifiedBenchmarks();
+        }
+#endif
     }
 
     // Default allocator check is disabled for all UTs:
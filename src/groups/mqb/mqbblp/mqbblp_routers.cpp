@@ -32,9 +32,11 @@
 #include <bmqu_printutil.h>
 
 // BDE
+#include <bdlma_localsequentialallocator.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
 #include <bsl_string.h>
+#include <bsl_vector.h>
 #include <bsls_performancehint.h>
 
 namespace BloombergLP {
@@ -53,6 +55,7 @@ class ScopeExit {
     : d_queue_p(queue)
     {
         d_queue_p->d_preader->next(currentMessage);
+        d_queue_p->d_index_sp->next();
     }
 
     ~ScopeExit() { d_queue_p->d_preader->next(0); }
@@ -212,12 +215,39 @@ bool Routers::Expression::evaluate()
 
         BSLS_ASSERT_SAFE(d_evaluationContext_p);
 
+        if (d_indexSlot >= 0 && !d_index_sp->isCandidate(d_indexSlot)) {
+            // One of the top-level constraints of the expression does not
+            // hold.
+            return false;  // RETURN
+        }
+
         return d_evaluator.evaluate(*d_evaluationContext_p);  // RETURN
     }
 
     return true;
 }
 
+void Routers::Expression::index(
+    const bsl::shared_ptr<SubscriptionIndex>& subscriptionIndex)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_indexSlot < 0);
+    BSLS_ASSERT_SAFE(subscriptionIndex);
+
+    if (!d_evaluator.isValid()) {
+        return;  // RETURN
+    }
+
+    bdlma::LocalSequentialAllocator<1024>    localAllocator;
+    bsl::vector<bmqeval::PropertyConstraint> constraints(&localAllocator);
+    d_evaluator.loadConstraints(&constraints);
+
+    d_indexSlot = subscriptionIndex->add(constraints);
+    if (d_indexSlot >= 0) {
+        d_index_sp = subscriptionIndex;
+    }
+}
+
 bool Routers::PriorityGroup::evaluate()
 {
     const Expressions::SharedItem& it         = d_itId->value().d_itExpression;
@@ -313,7 +343,10 @@ void Routers::AppContext::load(
                     int rc = expression.d_evaluator.compile(
                         expr.text(),
                         d_compilationContext);
-                    if (rc != 0 && errorStream != 0) {
+                    if (rc == 0) {
+                        expression.index(d_queue_p->d_index_sp);
+                    }
+                    else if (errorStream != 0) {
                         bmqeval::ErrorType::Enum errorType =
                             static_cast<bmqeval::ErrorType::Enum>(rc);
                         if (loggedErrors) {
@@ -748,6 +781,20 @@ bool Routers::RoundRobin::iterateSubscriptions(Visitor&       visitor,
             if (visitor.visit(handle,
                               subscription->consumer(),
                               subscription->d_downstreamSubscriptionId)) {
+                // Move the subscriptions skipped before this one (because
+                // they have no capacity or were not selected by the
+                // 'visitor') to the end, so that the next messages do not
+                // scan them again before reaching those which can take them.
+                // With many consumers, most of which have reached their
+                // maximum unconfirmed, this keeps the selection close to
+                // O(1) per message.
+                if (itSubscription != subscriptions.begin()) {
+                    subscriptions.splice(subscriptions.end(),
+                                         subscriptions,
+                                         subscriptions.begin(),
+                                         itSubscription);
+                }
+
                 // Before returning, move the subscription to the end if needed
                 // for the round-robin.
                 if (subscription->advance()) {
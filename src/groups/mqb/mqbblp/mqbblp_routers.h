@@ -154,6 +154,7 @@
 /// NOT Thread-Safe.
 
 // MQB
+#include <mqbblp_subscriptionindex.h>
 #include <mqbi_queue.h>
 #include <mqbi_storage.h>
 
@@ -399,10 +400,33 @@ class Routers {
 
         bmqeval::EvaluationContext* d_evaluationContext_p;
 
+        /// The index this expression is registered in, if any.
+        bsl::shared_ptr<SubscriptionIndex> d_index_sp;
+
+        /// The slot of this expression in `d_index_sp`, or a negative value
+        /// if this expression is not indexed.
+        int d_indexSlot;
+
         Expression();
 
+        /// Create a copy of the specified `other` expression.  Note that
+        /// the copy is not registered in the index of `other`.
         Expression(const Expression& other);
 
+        /// Destroy this object, removing it from its index, if any.
+        ~Expression();
+
+        /// Assign the evaluator of the specified `rhs` to this object,
+        /// removing this object from its index, if any.
+        Expression& operator=(const Expression& rhs);
+
+        /// Register the compiled evaluator in the specified
+        /// `subscriptionIndex` if it has constraints the index supports, so
+        /// that `evaluate` skips the evaluation for messages the index rules
+        /// out.
+        void
+        index(const bsl::shared_ptr<SubscriptionIndex>& subscriptionIndex);
+
         bool evaluate();
     };
 
@@ -564,9 +588,14 @@ class Routers {
 
         // DATA
 
-        /// Use own context;
+        /// Queue-level learner, which multiplexes the schema ids of all
+        /// the producers of the queue into queue-wide ids.
         bmqp::SchemaLearner& d_schemaLearner;
 
+        /// Own context in `d_schemaLearner`.  Since messages carry
+        /// queue-wide schema ids, each schema is learned once in this
+        /// context and then reused to read the properties of every message
+        /// having the same schema, whichever handle posted it.
         bmqp::SchemaLearner::Context d_schemaLearnerContext;
 
         bmqp::MessageProperties      d_properties;
@@ -624,6 +653,10 @@ class Routers {
 
         bmqeval::EvaluationContext d_evaluationContext;
 
+        /// Index of `d_expressions` by the values of the properties they
+        /// compare, reading the properties using `d_preader`.
+        bsl::shared_ptr<SubscriptionIndex> d_index_sp;
+
         bslma::Allocator* d_allocator_p;
 
         QueueRoutingContext(bmqp::SchemaLearner& schemaLearner,
@@ -690,9 +723,10 @@ class Routers {
         /// Iterate all highest priority `Subscription`s within the
         /// specified `group` and call the specified `visitor` for each
         /// `Subscription` which has `canDeliver` consumer.  If the
-        /// `visitor` returns `true`, stop iterating, move the subscription
-        /// to the end of round-robind selection list if it has been
-        /// selected `d_consumerPriorityCount` times, and return `true`.
+        /// `visitor` returns `true`, stop iterating, move the subscriptions
+        /// skipped before the selected one to the end of round-robin
+        /// selection list, followed by the selected subscription if it has
+        /// been selected `d_consumerPriorityCount` times, and return `true`.
         bool iterateSubscriptions(Visitor& visitor, PriorityGroup& group);
 
         void print(bsl::ostream& os, int level, int spacesPerLevel) const;
@@ -893,6 +927,8 @@ inline Routers::QueueRoutingContext::QueueRoutingContext(
 , d_preader(new(*allocator) MessagePropertiesReader(schemaLearner, allocator),
             allocator)
 , d_evaluationContext(0, allocator)
+, d_index_sp(new(*allocator) SubscriptionIndex(d_preader.get(), allocator),
+             allocator)
 , d_allocator_p(allocator)
 {
     d_evaluationContext.setPropertiesReader(d_preader.get());
@@ -936,15 +972,41 @@ Routers::QueueRoutingContext::onUsable(unsigned int* upstreamSubQueueId,
 inline Routers::Expression::Expression()
 : d_evaluator()
 , d_evaluationContext_p(0)
+, d_index_sp()
+, d_indexSlot(-1)
 {
 }
 
 inline Routers::Expression::Expression(const Expression& other)
 : d_evaluator(other.d_evaluator)
 , d_evaluationContext_p(other.d_evaluationContext_p)
+, d_index_sp()
+, d_indexSlot(-1)
 {
     // NOTHING
 }
+
+inline Routers::Expression::~Expression()
+{
+    if (d_indexSlot >= 0) {
+        d_index_sp->remove(d_indexSlot);
+    }
+}
+
+inline Routers::Expression&
+Routers::Expression::operator=(const Expression& rhs)
+{
+    if (this != &rhs) {
+        if (d_indexSlot >= 0) {
+            d_index_sp->remove(d_indexSlot);
+            d_index_sp.reset();
+            d_indexSlot = -1;
+        }
+        d_evaluator           = rhs.d_evaluator;
+        d_evaluationContext_p = rhs.d_evaluationContext_p;
+    }
+    return *this;
+}
 // -----------------------------
 // struct Routers::Subscription
 // -----------------------------
@@ -0,0 +1,322 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbblp_subscriptionindex.h>
+
+#include <mqbscm_version.h>
+
+// BDE
+#include <bdld_datum.h>
+#include <bdlma_localsequentialallocator.h>
+#include <bsl_algorithm.h>
+#include <bsl_functional.h>
+#include <bsl_limits.h>
+
+namespace BloombergLP {
+namespace mqbblp {
+
+namespace {
+
+typedef bsl::numeric_limits<bsls::Types::Int64> Int64Limits;
+
+/// Return the hash of the specified string `value`.
+bsls::Types::Uint64 hashString(const bslstl::StringRef& value)
+{
+    return bsl::hash<bslstl::StringRef>()(value);
+}
+
+}  // close unnamed namespace
+
+// -----------------------------------
+// struct SubscriptionIndex::Property
+// -----------------------------------
+
+SubscriptionIndex::Property::Property(const bslstl::StringRef& name,
+                                      bslma::Allocator*        allocator)
+: d_name(name, allocator)
+, d_generation(0)
+, d_type(e_NONE)
+, d_value(0)
+, d_integers(allocator)
+, d_strings(allocator)
+{
+    // NOTHING
+}
+
+SubscriptionIndex::Property::Property(const Property&   other,
+                                      bslma::Allocator* allocator)
+: d_name(other.d_name, allocator)
+, d_generation(other.d_generation)
+, d_type(other.d_type)
+, d_value(other.d_value)
+, d_integers(other.d_integers, allocator)
+, d_strings(other.d_strings, allocator)
+{
+    // NOTHING
+}
+
+// -----------------------
+// class SubscriptionIndex
+// -----------------------
+
+// PRIVATE MANIPULATORS
+int SubscriptionIndex::findOrAddProperty(const bslstl::StringRef& name)
+{
+    const bsl::string key(name, d_allocator_p);
+
+    PropertyMap::const_iterator it = d_propertyMap.find(key);
+    if (it != d_propertyMap.end()) {
+        return it->second;  // RETURN
+    }
+
+    const int index = static_cast<int>(d_properties.size());
+
+    d_properties.emplace_back(name);
+    d_propertyMap.emplace(key, index);
+
+    return index;
+}
+
+void SubscriptionIndex::load(Property* property)
+{
+    property->d_generation = d_generation;
+    property->d_type       = Property::e_NONE;
+
+    bdlma::LocalSequentialAllocator<64> localAllocator(d_allocator_p);
+    const bdld::Datum value = d_reader_p->get(property->d_name,
+                                              &localAllocator);
+
+    const ValueMap* values = 0;
+
+    if (value.isInteger64()) {
+        property->d_type  = Property::e_INTEGER;
+        property->d_value = static_cast<bsls::Types::Uint64>(
+            value.theInteger64());
+        values            = &property->d_integers;
+    }
+    else if (value.isInteger()) {
+        property->d_type  = Property::e_INTEGER;
+        property->d_value = static_cast<bsls::Types::Uint64>(
+            static_cast<bsls::Types::Int64>(value.theInteger()));
+        values            = &property->d_integers;
+    }
+    else if (value.isString()) {
+        property->d_type  = Property::e_STRING;
+        property->d_value = hashString(value.theString());
+        values            = &property->d_strings;
+    }
+    else {
+        // Missing property, or a type no indexed constraint can match.
+        return;  // RETURN
+    }
+
+    ValueMap::const_iterator it = values->find(property->d_value);
+    if (it == values->end()) {
+        return;  // RETURN
+    }
+
+    const Slots& candidates = it->second;
+    for (Slots::const_iterator cit = candidates.begin();
+         cit != candidates.end();
+         ++cit) {
+        d_entries[*cit].d_generation = d_generation;
+    }
+}
+
+SubscriptionIndex::Slots& SubscriptionIndex::slots(Property*    property,
+                                                   const Entry& entry)
+{
+    BSLS_ASSERT_SAFE(entry.d_kind == Entry::e_INTEGER ||
+                     entry.d_kind == Entry::e_STRING);
+
+    ValueMap& values = entry.d_kind == Entry::e_INTEGER ? property->d_integers
+                                                        : property->d_strings;
+
+    return values[entry.d_value];
+}
+
+// CREATORS
+SubscriptionIndex::SubscriptionIndex(bmqeval::PropertiesReader* reader,
+                                     bslma::Allocator*          allocator)
+: d_reader_p(reader)
+, d_properties(allocator)
+, d_propertyMap(allocator)
+, d_entries(allocator)
+, d_freeSlots(allocator)
+, d_generation(1)
+, d_numIndexed(0)
+, d_allocator_p(allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(reader);
+}
+
+// MANIPULATORS
+int SubscriptionIndex::add(
+    const bsl::vector<bmqeval::PropertyConstraint>& constraints)
+{
+    typedef bsl::vector<bmqeval::PropertyConstraint>::const_iterator
+        ConstIterator;
+
+    Entry entry;
+    entry.d_kind       = Entry::e_UNUSED;
+    entry.d_property   = -1;
+    entry.d_value      = 0;
+    entry.d_min        = Int64Limits::min();
+    entry.d_max        = Int64Limits::max();
+    entry.d_generation = 0;
+
+    // Prefer an equality, which is the most selective constraint.
+    ConstIterator it = constraints.begin();
+    for (; it != constraints.end(); ++it) {
+        if (it->d_op == bmqeval::PropertyConstraint::e_EQ) {
+            break;  // BREAK
+        }
+    }
+
+    if (it != constraints.end()) {
+        if (it->d_isString) {
+            entry.d_kind  = Entry::e_STRING;
+            entry.d_value = hashString(it->d_string);
+        }
+        else {
+            entry.d_kind  = Entry::e_INTEGER;
+            entry.d_value = static_cast<bsls::Types::Uint64>(it->d_integer);
+        }
+        entry.d_property = findOrAddProperty(it->d_property);
+    }
+    else {
+        // Intersect the integer ranges of the first range constrained
+        // property.
+        for (it = constraints.begin(); it != constraints.end(); ++it) {
+            if (it->d_isString) {
+                continue;  // CONTINUE
+            }
+            if (entry.d_kind == Entry::e_UNUSED) {
+                entry.d_kind     = Entry::e_RANGE;
+                entry.d_property = findOrAddProperty(it->d_property);
+            }
+            else if (it->d_property != d_properties[entry.d_property].d_name) {
+                continue;  // CONTINUE
+            }
+
+            const bsls::Types::Int64 value = it->d_integer;
+
+            switch (it->d_op) {
+            case bmqeval::PropertyConstraint::e_LT: {
+                if (value == Int64Limits::min()) {
+                    // Empty interval.
+                    entry.d_min = Int64Limits::max();
+                    entry.d_max = Int64Limits::min();
+                }
+                else {
+                    entry.d_max = bsl::min(entry.d_max, value - 1);
+                }
+            } break;
+            case bmqeval::PropertyConstraint::e_LE: {
+                entry.d_max = bsl::min(entry.d_max, value);
+            } break;
+            case bmqeval::PropertyConstraint::e_GT: {
+                if (value == Int64Limits::max()) {
+                    // Empty interval.
+                    entry.d_min = Int64Limits::max();
+                    entry.d_max = Int64Limits::min();
+                }
+                else {
+                    entry.d_min = bsl::max(entry.d_min, value + 1);
+                }
+            } break;
+            case bmqeval::PropertyConstraint::e_GE: {
+                entry.d_min = bsl::max(entry.d_min, value);
+            } break;
+            case bmqeval::PropertyConstraint::e_EQ:
+            default: {
+                BSLS_ASSERT_SAFE(false && "Unexpected constraint");
+            } break;
+            }
+        }
+    }
+
+    if (entry.d_kind == Entry::e_UNUSED) {
+        return -1;  // RETURN
+    }
+
+    int slot;
+    if (d_freeSlots.empty()) {
+        slot = static_cast<int>(d_entries.size());
+        d_entries.push_back(entry);
+    }
+    else {
+        slot = d_freeSlots.back();
+        d_freeSlots.pop_back();
+        d_entries[slot] = entry;
+    }
+
+    if (entry.d_kind != Entry::e_RANGE) {
+        Property& property = d_properties[entry.d_property];
+
+        slots(&property, entry).push_back(slot);
+
+        // Reload the value of the current message, if any, to mark the new
+        // expression.
+        property.d_generation = 0;
+    }
+
+    ++d_numIndexed;
+
+    return slot;
+}
+
+void SubscriptionIndex::remove(int slot)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= slot && slot < static_cast<int>(d_entries.size()));
+    BSLS_ASSERT_SAFE(d_entries[slot].d_kind != Entry::e_UNUSED);
+
+    Entry& entry = d_entries[slot];
+
+    if (entry.d_kind != Entry::e_RANGE) {
+        Slots& candidates = slots(&d_properties[entry.d_property], entry);
+
+        Slots::iterator it = bsl::find(candidates.begin(),
+                                       candidates.end(),
+                                       slot);
+        BSLS_ASSERT_SAFE(it != candidates.end());
+
+        *it = candidates.back();
+        candidates.pop_back();
+    }
+
+    entry.d_kind = Entry::e_UNUSED;
+    d_freeSlots.push_back(slot);
+    --d_numIndexed;
+}
+
+void SubscriptionIndex::next()
+{
+    if (++d_generation == 0) {
+        // The generation wrapped around; forget all the stamps.
+        for (bsl::size_t i = 0; i < d_properties.size(); ++i) {
+            d_properties[i].d_generation = 0;
+        }
+        for (bsl::size_t i = 0; i < d_entries.size(); ++i) {
+            d_entries[i].d_generation = 0;
+        }
+        d_generation = 1;
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,310 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MQBBLP_SUBSCRIPTIONINDEX
+#define INCLUDED_MQBBLP_SUBSCRIPTIONINDEX
+
+/// @file mqbblp_subscriptionindex.h
+///
+/// @brief Provide an index of subscription expressions by property values.
+///
+/// A queue with many subscriptions evaluates each of their expressions for
+/// each message, while typically only a few of them match.
+/// @bbref{mqbblp::SubscriptionIndex} allows to skip most of the evaluations by
+/// indexing the expressions by one of their top-level constraints, as
+/// reported by @bbref{bmqeval::SimpleEvaluator::loadConstraints}.
+///
+/// An expression is indexed by its first equality constraint if any (e.g.,
+/// `customerId == 42` or `region == "EMEA"`), or else by the interval of
+/// values allowed by the integer range constraints on its first range
+/// constrained property (e.g., `10 <= price && price < 100`).  Expressions
+/// without such constraint are not indexed, and are always evaluated.
+///
+/// For each message, each indexed property is read at most once: the first
+/// query of an expression indexed by equality on a property looks up the
+/// value of that property in a hash table, and marks all the expressions
+/// expecting that value as candidates.  Subsequent queries for expressions
+/// indexed on the same property are then a comparison of integers.  Note that
+/// string values are indexed by their hash, so that a candidate is not
+/// necessarily matching; the index only guarantees that an expression which
+/// is not a candidate evaluates to `false`, and candidates still have to be
+/// evaluated.
+///
+/// Thread Safety
+/// -------------
+///
+/// NOT thread safe.
+///
+/// Usage
+/// -----
+///
+/// ```
+/// mqbblp::SubscriptionIndex index(&reader, allocator);
+///
+/// bsl::vector<bmqeval::PropertyConstraint> constraints(allocator);
+/// evaluator.loadConstraints(&constraints);
+///
+/// const int slot = index.add(constraints);
+///
+/// // For each message:
+/// index.next();
+/// if (slot < 0 || index.isCandidate(slot)) {
+///     result = evaluator.evaluate(context);
+/// }
+/// ```
+
+// BMQ
+#include <bmqeval_simpleevaluator.h>
+
+// BDE
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+namespace mqbblp {
+
+// =======================
+// class SubscriptionIndex
+// =======================
+
+/// Index of subscription expressions by the values of their properties.
+class SubscriptionIndex {
+  private:
+    // PRIVATE TYPES
+
+    /// Slots of the expressions expecting the same value of a property.
+    typedef bsl::vector<int> Slots;
+
+    /// Map from the integer value (or the hash of the string value) of a
+    /// property to the slots of the expressions expecting that value.
+    typedef bsl::unordered_map<bsls::Types::Uint64, Slots> ValueMap;
+
+    /// Indexed property.
+    struct Property {
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(Property, bslma::UsesBslmaAllocator)
+
+        // TYPES
+        enum Type {
+            e_NONE,     // property is missing, or neither integer nor string
+            e_INTEGER,  // property is an integer
+            e_STRING    // property is a string
+        };
+
+        // DATA
+
+        /// The name of the property.
+        bsl::string d_name;
+
+        /// The generation of the message the value was read from.
+        unsigned int d_generation;
+
+        /// The type of the value of the property.
+        Type d_type;
+
+        /// The integer value, or the hash of the string value.
+        bsls::Types::Uint64 d_value;
+
+        /// The expressions indexed by equality with an integer.
+        ValueMap d_integers;
+
+        /// The expressions indexed by equality with a string.
+        ValueMap d_strings;
+
+        // CREATORS
+        Property(const bslstl::StringRef& name, bslma::Allocator* allocator);
+
+        Property(const Property& other, bslma::Allocator* allocator);
+    };
+
+    /// Indexed expression.
+    struct Entry {
+        // TYPES
+        enum Kind {
+            e_UNUSED,   // slot is free
+            e_INTEGER,  // equality with an integer
+            e_STRING,   // equality with a string
+            e_RANGE     // integer in the '[d_min, d_max]' interval
+        };
+
+        // DATA
+
+        /// The kind of the constraint.
+        Kind d_kind;
+
+        /// The index of the property in `d_properties`.
+        int d_property;
+
+        /// The expected value, or the hash of the expected string.
+        bsls::Types::Uint64 d_value;
+
+        /// The lower bound of the allowed interval.
+        bsls::Types::Int64 d_min;
+
+        /// The upper bound of the allowed interval.
+        bsls::Types::Int64 d_max;
+
+        /// The generation of the last message this expression was a
+        /// candidate for.
+        unsigned int d_generation;
+    };
+
+    /// Map from the name of a property to its index in `d_properties`.
+    typedef bsl::unordered_map<bsl::string, int> PropertyMap;
+
+    // DATA
+
+    /// The reader of the properties of the current message.
+    bmqeval::PropertiesReader* d_reader_p;
+
+    /// The indexed properties.
+    bsl::vector<Property> d_properties;
+
+    /// The index of each property in `d_properties`.
+    PropertyMap d_propertyMap;
+
+    /// The indexed expressions.
+    bsl::vector<Entry> d_entries;
+
+    /// The unused slots of `d_entries`.
+    bsl::vector<int> d_freeSlots;
+
+    /// The generation of the current message.
+    unsigned int d_generation;
+
+    /// The number of indexed expressions.
+    int d_numIndexed;
+
+    /// Allocator to use.
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Return the index in `d_properties` of the property with the
+    /// specified `name`, adding the property if needed.
+    int findOrAddProperty(const bslstl::StringRef& name);
+
+    /// Read the value of the specified `property` of the current message,
+    /// and mark the expressions indexed by equality with that value.
+    void load(Property* property);
+
+    /// Return the expressions of the specified `property` expecting the
+    /// value of the specified `entry`.
+    Slots& slots(Property* property, const Entry& entry);
+
+  private:
+    // NOT IMPLEMENTED
+    SubscriptionIndex(const SubscriptionIndex&) BSLS_KEYWORD_DELETED;
+    SubscriptionIndex&
+    operator=(const SubscriptionIndex&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SubscriptionIndex,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty index reading the properties of messages using the
+    /// specified `reader`, and use the specified `allocator` to supply
+    /// memory.
+    SubscriptionIndex(bmqeval::PropertiesReader* reader,
+                      bslma::Allocator*          allocator);
+
+    // MANIPULATORS
+
+    /// Index an expression by one of the specified `constraints` necessary
+    /// for it to be `true`.  Return the slot of the expression in this
+    /// index, or a negative value if none of the `constraints` can be
+    /// indexed.
+    int add(const bsl::vector<bmqeval::PropertyConstraint>& constraints);
+
+    /// Remove from this index the expression at the specified `slot`.  The
+    /// behavior is undefined unless `slot` was returned by `add` and was
+    /// not removed since.
+    void remove(int slot);
+
+    /// Prepare this index for the next message.  The reader specified at
+    /// construction must be prepared for that message before calling
+    /// `isCandidate`.
+    void next();
+
+    /// Return `false` if the expression at the specified `slot` evaluates
+    /// to `false` for the current message, and `true` if it may evaluate to
+    /// `true`.  The behavior is undefined unless `slot` was returned by
+    /// `add` and was not removed since.
+    bool isCandidate(int slot);
+
+    // ACCESSORS
+
+    /// Return the number of indexed expressions.
+    int numIndexed() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -----------------------
+// class SubscriptionIndex
+// -----------------------
+
+// MANIPULATORS
+inline bool SubscriptionIndex::isCandidate(int slot)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= slot && slot < static_cast<int>(d_entries.size()));
+    BSLS_ASSERT_SAFE(d_entries[slot].d_kind != Entry::e_UNUSED);
+
+    Entry&    entry    = d_entries[slot];
+    Property& property = d_properties[entry.d_property];
+
+    if (property.d_generation != d_generation) {
+        load(&property);
+    }
+
+    if (entry.d_kind == Entry::e_RANGE) {
+        if (property.d_type != Property::e_INTEGER) {
+            return false;  // RETURN
+        }
+
+        const bsls::Types::Int64 value = static_cast<bsls::Types::Int64>(
+            property.d_value);
+
+        return entry.d_min <= value && value <= entry.d_max;  // RETURN
+    }
+
+    return entry.d_generation == d_generation;
+}
+
+// ACCESSORS
+inline int SubscriptionIndex::numIndexed() const
+{
+    return d_numIndexed;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
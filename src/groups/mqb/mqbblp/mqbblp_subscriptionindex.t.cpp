@@ -0,0 +1,363 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbblp_subscriptionindex.h>
+
+// BMQ
+#include <bmqeval_simpleevaluator.h>
+
+// BDE
+#include <bdld_datum.h>
+#include <bsl_memory.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+namespace {
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+
+/// Properties reader counting the reads.
+class MockPropertiesReader : public bmqeval::PropertiesReader {
+  public:
+    // PUBLIC DATA
+    bsl::unordered_map<bsl::string, bdld::Datum> d_map;
+
+    int d_numReads;
+
+    // CREATORS
+    explicit MockPropertiesReader(bslma::Allocator* allocator)
+    : d_map(allocator)
+    , d_numReads(0)
+    {
+    }
+
+    // MANIPULATORS
+    bdld::Datum get(const bsl::string& name,
+                    bslma::Allocator*) BSLS_KEYWORD_OVERRIDE
+    {
+        ++d_numReads;
+
+        bsl::unordered_map<bsl::string, bdld::Datum>::const_iterator it =
+            d_map.find(name);
+        if (it == d_map.end()) {
+            return bdld::Datum::createError(-1);  // RETURN
+        }
+        return it->second;
+    }
+};
+
+/// Expression compiled and indexed in a `mqbblp::SubscriptionIndex`.
+struct IndexedExpression {
+    // DATA
+    bsl::shared_ptr<bmqeval::SimpleEvaluator> d_evaluator_sp;
+
+    int d_slot;
+};
+
+/// Compile the specified `expression`, add it to the specified `index`, and
+/// load into the specified `result` the compiled expression and its slot.
+void addExpression(IndexedExpression*         result,
+                   mqbblp::SubscriptionIndex* index,
+                   const char*                expression)
+{
+    bmqeval::CompilationContext compilationContext(
+        bmqtst::TestHelperUtil::allocator());
+
+    result->d_evaluator_sp.reset(new (*bmqtst::TestHelperUtil::allocator())
+                                     bmqeval::SimpleEvaluator(),
+                                 bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(
+        0,
+        result->d_evaluator_sp->compile(expression, compilationContext));
+
+    bsl::vector<bmqeval::PropertyConstraint> constraints(
+        bmqtst::TestHelperUtil::allocator());
+    result->d_evaluator_sp->loadConstraints(&constraints);
+
+    result->d_slot = index->add(constraints);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   - Expressions are indexed by equality with an integer or a string, or
+//     by an integer range, and other expressions are not indexed.
+//   - An expression which is not a candidate evaluates to 'false'.
+//
+// Testing:
+//   SubscriptionIndex
+//   add
+//   next
+//   isCandidate
+//   numIndexed
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    MockPropertiesReader      reader(bmqtst::TestHelperUtil::allocator());
+    mqbblp::SubscriptionIndex index(&reader,
+                                    bmqtst::TestHelperUtil::allocator());
+
+    const char* k_EXPRESSIONS[] = {
+        "id == 1",
+        "id == 2 && region == \"EMEA\"",
+        "region == \"EMEA\"",
+        "\"APAC\" == region || id == 2",
+        "price >= 10 && price < 100",
+        "100 <= price && id > 0",
+        "price > 5 && price < 6",
+        "!(id == 1)",
+        "id != 1",
+    };
+    const bool k_IS_INDEXED[] =
+        {true, true, true, false, true, true, true, false, false};
+
+    const size_t k_NUM_EXPRESSIONS = sizeof(k_EXPRESSIONS) /
+                                     sizeof(*k_EXPRESSIONS);
+
+    bsl::vector<IndexedExpression> expressions(
+        k_NUM_EXPRESSIONS,
+        bmqtst::TestHelperUtil::allocator());
+    for (size_t i = 0; i < k_NUM_EXPRESSIONS; ++i) {
+        addExpression(&expressions[i], &index, k_EXPRESSIONS[i]);
+        BMQTST_ASSERT_EQ_D(i, k_IS_INDEXED[i], expressions[i].d_slot >= 0);
+    }
+    BMQTST_ASSERT_EQ(6, index.numIndexed());
+
+    const struct TestData {
+        int         d_line;
+        int         d_id;
+        const char* d_region;
+        int         d_price;
+        const char* d_expected;  // '1' for candidates
+    } k_DATA[] = {
+        {L_, 1, "EMEA", 50, "101100"},
+        {L_, 2, "EMEA", 100, "011010"},
+        {L_, 3, "APAC", 5, "000000"},
+        {L_, 2, "APAC", 1000, "010010"},
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    bmqeval::EvaluationContext context(&reader,
+                                       bmqtst::TestHelperUtil::allocator());
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const TestData& test = k_DATA[idx];
+
+        reader.d_map["id"]     = bdld::Datum::createInteger(test.d_id);
+        reader.d_map["region"] = bdld::Datum::createStringRef(
+            test.d_region,
+            bmqtst::TestHelperUtil::allocator());
+        reader.d_map["price"]  = bdld::Datum::createInteger(test.d_price);
+
+        index.next();
+
+        bsl::string candidates(bmqtst::TestHelperUtil::allocator());
+        for (size_t i = 0; i < k_NUM_EXPRESSIONS; ++i) {
+            const IndexedExpression& expression = expressions[i];
+
+            if (expression.d_slot < 0) {
+                continue;  // CONTINUE
+            }
+
+            const bool isCandidate = index.isCandidate(expression.d_slot);
+            candidates.push_back(isCandidate ? '1' : '0');
+
+            if (!isCandidate) {
+                BMQTST_ASSERT_D(test.d_line << ": " << k_EXPRESSIONS[i],
+                                !expression.d_evaluator_sp->evaluate(context));
+            }
+        }
+
+        BMQTST_ASSERT_EQ_D(test.d_line, test.d_expected, candidates);
+    }
+}
+
+static void test2_ranges()
+// ------------------------------------------------------------------------
+// RANGES
+//
+// Concerns:
+//   - The range constraints on the first range constrained property are
+//     intersected.
+//   - Comparisons with the limits of 64-bit integers yield empty
+//     intervals.
+//   - Non-integer values are not candidates.
+//
+// Testing:
+//   add
+//   isCandidate
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("RANGES");
+
+    MockPropertiesReader      reader(bmqtst::TestHelperUtil::allocator());
+    mqbblp::SubscriptionIndex index(&reader,
+                                    bmqtst::TestHelperUtil::allocator());
+
+    IndexedExpression interval;
+    IndexedExpression other;
+    IndexedExpression empty;
+    addExpression(&interval, &index, "x > 1 && x <= 5 && y < 0 && 3 <= x");
+    addExpression(&other, &index, "y < 0 && x > 1");
+    addExpression(&empty, &index, "x > 9223372036854775807");
+
+    const struct TestData {
+        int  d_line;
+        int  d_x;
+        int  d_y;
+        bool d_interval;
+        bool d_other;
+    } k_DATA[] = {
+        {L_, 2, 0, false, false},
+        {L_, 3, 0, true, false},
+        {L_, 5, -1, true, true},
+        {L_, 6, -1, false, true},
+    };
+
+    const size_t k_NUM_DATA = sizeof(k_DATA) / sizeof(*k_DATA);
+
+    for (size_t idx = 0; idx < k_NUM_DATA; ++idx) {
+        const TestData& test = k_DATA[idx];
+
+        reader.d_map["x"] = bdld::Datum::createInteger(test.d_x);
+        reader.d_map["y"] = bdld::Datum::createInteger(test.d_y);
+
+        index.next();
+
+        BMQTST_ASSERT_EQ_D(test.d_line,
+                           test.d_interval,
+                           index.isCandidate(interval.d_slot));
+        BMQTST_ASSERT_EQ_D(test.d_line,
+                           test.d_other,
+                           index.isCandidate(other.d_slot));
+        BMQTST_ASSERT_D(test.d_line, !index.isCandidate(empty.d_slot));
+    }
+
+    reader.d_map["x"] = bdld::Datum::createStringRef(
+        "3",
+        bmqtst::TestHelperUtil::allocator());
+    reader.d_map["y"] = bdld::Datum::createBoolean(true);
+
+    index.next();
+
+    BMQTST_ASSERT(!index.isCandidate(interval.d_slot));
+    BMQTST_ASSERT(!index.isCandidate(other.d_slot));
+}
+
+static void test3_removeAndReads()
+// ------------------------------------------------------------------------
+// REMOVE AND READS
+//
+// Concerns:
+//   - Each indexed property is read at most once per message.
+//   - Removed expressions are no longer candidates, and their slots are
+//     reused.
+//
+// Testing:
+//   remove
+//   next
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("REMOVE AND READS");
+
+    MockPropertiesReader      reader(bmqtst::TestHelperUtil::allocator());
+    mqbblp::SubscriptionIndex index(&reader,
+                                    bmqtst::TestHelperUtil::allocator());
+
+    const int k_NUM_EXPRESSIONS = 100;
+
+    bsl::vector<IndexedExpression> expressions(
+        k_NUM_EXPRESSIONS,
+        bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i < k_NUM_EXPRESSIONS; ++i) {
+        bsl::string expression("id == ", bmqtst::TestHelperUtil::allocator());
+        expression += bsl::to_string(i);
+
+        addExpression(&expressions[i], &index, expression.c_str());
+        BMQTST_ASSERT_EQ(i, expressions[i].d_slot);
+    }
+
+    reader.d_map["id"] = bdld::Datum::createInteger(42);
+    reader.d_numReads  = 0;
+
+    index.next();
+
+    for (int i = 0; i < k_NUM_EXPRESSIONS; ++i) {
+        BMQTST_ASSERT_EQ_D(i, i == 42, index.isCandidate(i));
+    }
+    BMQTST_ASSERT_EQ(1, reader.d_numReads);
+
+    PV("Remove");
+
+    index.remove(42);
+    BMQTST_ASSERT_EQ(k_NUM_EXPRESSIONS - 1, index.numIndexed());
+
+    IndexedExpression added;
+    addExpression(&added, &index, "id == 7");
+    BMQTST_ASSERT_EQ(42, added.d_slot);
+    BMQTST_ASSERT_EQ(k_NUM_EXPRESSIONS, index.numIndexed());
+
+    reader.d_map["id"] = bdld::Datum::createInteger(7);
+    reader.d_numReads  = 0;
+
+    index.next();
+
+    for (int i = 0; i < k_NUM_EXPRESSIONS; ++i) {
+        BMQTST_ASSERT_EQ_D(i, i == 7 || i == 42, index.isCandidate(i));
+    }
+    BMQTST_ASSERT_EQ(1, reader.d_numReads);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_removeAndReads(); break;
+    case 2: test2_ranges(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
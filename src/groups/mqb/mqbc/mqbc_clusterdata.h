@@ -307,6 +307,7 @@ class ClusterData {
     const ClusterDataIdentity&            identity() const;
     const mqbi::Cluster&                  cluster() const;
     const StatContextMp&                  clusterNodesStatContext() const;
+    const mqbstat::ClusterStats&          stats() const;
 };
 
 // ============================================================================
@@ -497,6 +498,11 @@ ClusterData::clusterNodesStatContext() const
     return d_clusterNodesStatContext_mp;
 }
 
+inline const mqbstat::ClusterStats& ClusterData::stats() const
+{
+    return d_stats;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -1764,6 +1764,22 @@ bool ClusterStateManager::assignQueue(const bmqt::Uri&      uri,
                                           status);
 }
 
+void ClusterStateManager::assignQueues(const bsl::vector<bmqt::Uri>& uris,
+                                       FailedAssignments*            failures)
+{
+    // executed by the cluster *DISPATCHER* thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_cluster_p->inDispatcherThread());
+
+    mqbc::ClusterUtil::assignQueues(d_state_p,
+                                    d_clusterData_p,
+                                    d_clusterStateLedger_mp.get(),
+                                    d_cluster_p,
+                                    uris,
+                                    d_allocator_p,
+                                    failures);
+}
+
 void ClusterStateManager::registerQueueInfo(
     const bmqp_ctrlmsg::QueueInfo& advisory,
     bool                           forceUpdate)
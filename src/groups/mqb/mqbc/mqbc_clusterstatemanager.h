@@ -462,6 +462,19 @@ class ClusterStateManager BSLS_KEYWORD_FINAL
     bool assignQueue(const bmqt::Uri&      uri,
                      bmqp_ctrlmsg::Status* status) BSLS_KEYWORD_OVERRIDE;
 
+    /// Perform the assignment of all the queues represented by the
+    /// specified `uris`, as per `assignQueue`, but apply the resulting
+    /// queue assignments to CSL using as few queue assignment advisories as
+    /// possible.  Load into the specified `failures` the uri and status of
+    /// every queue whose assignment failed permanently and must be
+    /// rejected; all other queues are assigned or can be retried.  This
+    /// method is called only on the leader node.
+    ///
+    /// THREAD: This method is invoked in the associated cluster's
+    ///         dispatcher thread.
+    void assignQueues(const bsl::vector<bmqt::Uri>& uris,
+                      FailedAssignments* failures) BSLS_KEYWORD_OVERRIDE;
+
     /// Register a queue info for the queue with the specified `advisory`.
     /// If the specified `forceUpdate` flag is true, update queue info even if
     /// it is valid but different from the specified `advisory`.
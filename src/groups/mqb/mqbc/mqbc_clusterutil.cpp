@@ -54,6 +54,7 @@
 #include <bdlde_md5.h>
 #include <bdlf_bind.h>
 #include <bdlma_localsequentialallocator.h>
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_limits.h>
 #include <bsl_unordered_set.h>
@@ -75,6 +76,10 @@ const char k_SELF_NODE_IS_STOPPING[]   = "self node is stopping";
 const char k_DOMAIN_CREATION_FAILURE[] = "failed to create domain";
 const char k_CSL_FAILURE[]             = "CSL failure";
 
+/// Maximum number of queues carried by a single queue assignment advisory
+/// when assigning queues in bulk.
+const size_t k_MAX_QUEUES_PER_ASSIGNMENT_ADVISORY = 64;
+
 // TYPES
 typedef ClusterUtil::AppInfos      AppInfos;
 typedef ClusterUtil::AppInfosCIter AppInfosCIter;
@@ -277,10 +282,7 @@ void getNextPrimarys(NumNewPartitionsMap* numNewPartitions,
         break;  // BREAK
     }
     case mqbcfg::MasterAssignmentAlgorithm::E_LEAST_ASSIGNED:
-        // Whichever AVAILABLE node has least number of partitions assigned to
-        // it is chosen as the new primary.  There is no "preferred list" of
-        // primary nodes for a given partition.  However, this mode is not
-        // supported right now.
+        // Assigned per partition by 'assignLeastLoadedPrimarys' instead.
     default: {
         BMQTSK_ALARMLOG_ALARM("CLUSTER")
             << clusterData.identity().description()
@@ -299,6 +301,128 @@ void getNextPrimarys(NumNewPartitionsMap* numNewPartitions,
     }
 }
 
+/// Assign a primary to each of the specified `partitionsToChange`, appending
+/// the results to the specified `partitions` which already holds the
+/// partitions keeping their primary, using the specified `clusterData`.
+/// Each partition is weighted by its load, as reported to the cluster stats,
+/// and assigned to the AVAILABLE node with the least total weight of
+/// partitions assigned, heaviest partitions first.  The behavior is
+/// undefined unless this node is the leader.
+///
+/// THREAD: This method is invoked in the associated cluster's dispatcher
+///         thread.
+void assignLeastLoadedPrimarys(
+    bsl::vector<bmqp_ctrlmsg::PartitionPrimaryInfo>*    partitions,
+    const bsl::vector<mqbc::ClusterStatePartitionInfo>& partitionsToChange,
+    const ClusterData&                                  clusterData)
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(clusterData.cluster().inDispatcherThread());
+    BSLS_ASSERT_SAFE(mqbnet::ElectorState::e_LEADER ==
+                     clusterData.electorInfo().electorState());
+
+    BALL_LOG_SET_CATEGORY(k_LOG_CATEGORY);
+
+    const int numPartitions =
+        clusterData.clusterConfig().partitionConfig().numPartitions();
+
+    // The weight of a partition is 1 plus its outstanding bytes and write
+    // rate, each relative to its average over all partitions, so that all
+    // partitions weigh the same until some load is reported.
+    double totalBytes = 0;
+    double totalRate  = 0;
+    for (int pid = 0; pid < numPartitions; ++pid) {
+        const bsl::shared_ptr<mqbstat::PartitionStats> partitionStats =
+            clusterData.stats().getPartitionStats(pid);
+        totalBytes += partitionStats->outstandingDataBytes();
+        totalRate += partitionStats->dataWriteRate();
+    }
+
+    bsl::vector<double> weights(numPartitions, 1.0);
+    for (int pid = 0; pid < numPartitions; ++pid) {
+        const bsl::shared_ptr<mqbstat::PartitionStats> partitionStats =
+            clusterData.stats().getPartitionStats(pid);
+        if (totalBytes > 0) {
+            weights[pid] += partitionStats->outstandingDataBytes() *
+                            numPartitions / totalBytes;
+        }
+        if (totalRate > 0) {
+            weights[pid] += partitionStats->dataWriteRate() * numPartitions /
+                            totalRate;
+        }
+    }
+
+    // Candidate primaries are the AVAILABLE nodes, loaded with the weight of
+    // the partitions they keep.  If there are none, fall back to self.
+    typedef bsl::unordered_map<mqbnet::ClusterNode*, double> NodeLoads;
+
+    NodeLoads nodeLoads;
+    for (ClusterNodeSessionMapConstIter cit =
+             clusterData.membership().clusterNodeSessionMap().begin();
+         cit != clusterData.membership().clusterNodeSessionMap().end();
+         ++cit) {
+        if (bmqp_ctrlmsg::NodeStatus::E_AVAILABLE ==
+            cit->second->nodeStatus()) {
+            nodeLoads[cit->first] = 0;
+        }
+    }
+    if (nodeLoads.empty()) {
+        nodeLoads[clusterData.membership().selfNode()] = 0;
+    }
+    for (size_t i = 0; i < partitions->size(); ++i) {
+        const bmqp_ctrlmsg::PartitionPrimaryInfo& info = (*partitions)[i];
+        NodeLoads::iterator it = nodeLoads.find(
+            clusterData.membership().netCluster()->lookupNode(
+                info.primaryNodeId()));
+        if (it != nodeLoads.end()) {
+            it->second += weights[info.partitionId()];
+        }
+    }
+
+    bsl::vector<bsl::pair<double, int> > toAssign;
+    toAssign.reserve(partitionsToChange.size());
+    for (size_t i = 0; i < partitionsToChange.size(); ++i) {
+        toAssign.push_back(
+            bsl::make_pair(-weights[partitionsToChange[i].partitionId()],
+                           static_cast<int>(i)));
+    }
+    bsl::sort(toAssign.begin(), toAssign.end());
+
+    for (size_t i = 0; i < toAssign.size(); ++i) {
+        const mqbc::ClusterStatePartitionInfo& pinfo =
+            partitionsToChange[toAssign[i].second];
+
+        NodeLoads::iterator primaryIt = nodeLoads.begin();
+        for (NodeLoads::iterator it = nodeLoads.begin(); it != nodeLoads.end();
+             ++it) {
+            if (it->second < primaryIt->second ||
+                (it->second == primaryIt->second &&
+                 it->first->nodeId() < primaryIt->first->nodeId())) {
+                primaryIt = it;
+            }
+        }
+        primaryIt->second -= toAssign[i].first;
+
+        mqbnet::ClusterNode* primary = primaryIt->first;
+
+        BALL_LOG_INFO << clusterData.identity().description()
+                      << ": Partition [" << pinfo.partitionId()
+                      << "]: Leader (self) has assigned "
+                      << primary->nodeDescription()
+                      << " as primary [weight: " << -toAssign[i].first
+                      << "].";
+
+        bmqp_ctrlmsg::PartitionPrimaryInfo info;
+        info.partitionId()    = pinfo.partitionId();
+        info.primaryNodeId()  = primary->nodeId();
+        info.primaryLeaseId() = pinfo.primaryLeaseId() + 1;
+
+        partitions->push_back(info);
+    }
+}
+
 /// If the specified `status` is SUCCESS, load the specified `domain` into
 /// the specified `domainState`.
 void createDomainCb(const bmqp_ctrlmsg::Status& status,
@@ -493,6 +617,15 @@ void ClusterUtil::assignPartitions(
         }
     }
 
+    if (assignmentAlgo ==
+        mqbcfg::MasterAssignmentAlgorithm::E_LEAST_ASSIGNED) {
+        assignLeastLoadedPrimarys(partitions, partitionsToChange, clusterData);
+
+        BSLS_ASSERT_SAFE(partitions->size() ==
+                         clusterState->partitions().size());
+        return;  // RETURN
+    }
+
     NumNewPartitionsMap numNewPartitions;
     getNextPrimarys(&numNewPartitions,
                     partitionsToChange.size(),
@@ -532,14 +665,15 @@ void ClusterUtil::assignPartitions(
     BSLS_ASSERT_SAFE(partitions->size() == clusterState->partitions().size());
 }
 
-int ClusterUtil::getNextPartitionId(const ClusterState& clusterState,
-                                    const bmqt::Uri&    uri)
+int ClusterUtil::getNextPartitionId(const ClusterState&          clusterState,
+                                    const bmqt::Uri&             uri,
+                                    const mqbstat::ClusterStats* stats)
 {
-    // Try to assign to the partition which has a primary and the least number
-    // of queues assigned.  If no partitions have a primary, then assign to the
-    // partition with the least number of queues.  It's ok to choose a  primary
-    // which is not active at the moment.  In case of a latemon domain try to
-    // take the partition id from the queue name.
+    // Try to assign to the partition which has a primary and the least load.
+    // If no partitions have a primary, then assign to the partition with the
+    // least load.  It's ok to choose a  primary which is not active at the
+    // moment.  In case of a latemon domain try to take the partition id from
+    // the queue name.
 
     const bslstl::StringRef& domainName = uri.domain();
     const bslstl::StringRef& queueName  = uri.path();
@@ -563,28 +697,64 @@ int ClusterUtil::getNextPartitionId(const ClusterState& clusterState,
         }
     }
 
-    int minQueuesMapped = bsl::numeric_limits<int>::max();
-    int res             = -1;
+    const ClusterState::PartitionsInfo& partitions = clusterState.partitions();
 
-    for (size_t i = 0; i < clusterState.partitions().size(); ++i) {
-        const mqbc::ClusterStatePartitionInfo& partitionInfo =
-            clusterState.partitions()[i];
-        if (partitionInfo.primaryNode() &&
-            partitionInfo.numQueuesMapped() < minQueuesMapped) {
-            minQueuesMapped = partitionInfo.numQueuesMapped();
-            res             = i;
-        }
-    }
-
-    if (res == -1) {
-        // Didn't find a partition with a primary; drop this requirement and
-        // simply look for the least used partition.
-        res = 0;
-        for (size_t i = 1; i < clusterState.partitions().size(); ++i) {
-            if (clusterState.partitions()[i].numQueuesMapped() <
-                clusterState.partitions()[res].numQueuesMapped()) {
-                res = i;
+    bool hasPrimary = false;
+    for (size_t i = 0; i < partitions.size() && !hasPrimary; ++i) {
+        hasPrimary = partitions[i].primaryNode() != 0;
+    }
+
+    // The load of a partition is the sum of its number of queues mapped,
+    // outstanding bytes and write rate, each relative to its average over
+    // the candidate partitions, so that they weigh the same whatever their
+    // scale.  If no partitions have a primary, drop this requirement and
+    // simply look for the least loaded partition.
+    double numCandidates = 0;
+    double totalQueues   = 0;
+    double totalBytes    = 0;
+    double totalRate     = 0;
+    for (size_t i = 0; i < partitions.size(); ++i) {
+        if (hasPrimary && !partitions[i].primaryNode()) {
+            continue;  // CONTINUE
+        }
+        ++numCandidates;
+        totalQueues += partitions[i].numQueuesMapped();
+        if (stats) {
+            const bsl::shared_ptr<mqbstat::PartitionStats> partitionStats =
+                stats->getPartitionStats(static_cast<int>(i));
+            totalBytes += partitionStats->outstandingDataBytes();
+            totalRate += partitionStats->dataWriteRate();
+        }
+    }
+
+    double minLoad = bsl::numeric_limits<double>::max();
+    int    res     = -1;
+    for (size_t i = 0; i < partitions.size(); ++i) {
+        if (hasPrimary && !partitions[i].primaryNode()) {
+            continue;  // CONTINUE
+        }
+
+        double load = 0;
+        if (totalQueues > 0) {
+            load += partitions[i].numQueuesMapped() * numCandidates /
+                    totalQueues;
+        }
+        if (stats && (totalBytes > 0 || totalRate > 0)) {
+            const bsl::shared_ptr<mqbstat::PartitionStats> partitionStats =
+                stats->getPartitionStats(static_cast<int>(i));
+            if (totalBytes > 0) {
+                load += partitionStats->outstandingDataBytes() *
+                        numCandidates / totalBytes;
             }
+            if (totalRate > 0) {
+                load += partitionStats->dataWriteRate() * numCandidates /
+                        totalRate;
+            }
+        }
+
+        if (load < minLoad) {
+            minLoad = load;
+            res     = static_cast<int>(i);
         }
     }
 
@@ -793,13 +963,17 @@ void ClusterUtil::populateQueueAssignmentAdvisory(
     BSLS_ASSERT_SAFE(uri.isCanonical());
     BSLS_ASSERT_SAFE(clusterData->electorInfo().isSelfActiveLeader());
 
-    clusterData->electorInfo().nextLeaderMessageSequence(
-        &advisory->sequenceNumber());
-    advisory->queues().resize(1);
+    if (advisory->queues().empty()) {
+        clusterData->electorInfo().nextLeaderMessageSequence(
+            &advisory->sequenceNumber());
+    }
+    advisory->queues().resize(advisory->queues().size() + 1);
 
     bmqp_ctrlmsg::QueueInfo& queueInfo = advisory->queues().back();
-    queueInfo.uri()                    = uri.asString();
-    queueInfo.partitionId() = getNextPartitionId(*clusterState, uri);
+    queueInfo.uri()         = uri.asString();
+    queueInfo.partitionId() = getNextPartitionId(*clusterState,
+                                                 uri,
+                                                 &clusterData->stats());
     mqbs::StorageUtil::generateStorageKey(key,
                                           &clusterState->queueKeys(),
                                           uri.asString());
@@ -809,7 +983,8 @@ void ClusterUtil::populateQueueAssignmentAdvisory(
     populateAppInfos(&queueInfo.appIds(), config);
 
     BALL_LOG_INFO << clusterData->identity().description()
-                  << ": Populated QueueAssignmentAdvisory: " << *advisory;
+                  << ": Populated QueueAssignmentAdvisory "
+                  << advisory->sequenceNumber() << " with: " << queueInfo;
 }
 
 void ClusterUtil::populateQueueUnAssignmentAdvisory(
@@ -850,23 +1025,24 @@ void ClusterUtil::populateQueueUnAssignmentAdvisory(
                   << ": Populated QueueUnAssignmentAdvisory: " << *advisory;
 }
 
-bool ClusterUtil::assignQueue(ClusterState*         clusterState,
-                              ClusterData*          clusterData,
-                              ClusterStateLedger*   ledger,
-                              const mqbi::Cluster*  cluster,
-                              const bmqt::Uri&      uri,
-                              bslma::Allocator*     allocator,
-                              bmqp_ctrlmsg::Status* status)
+bool ClusterUtil::prepareQueueAssignment(
+    bmqp_ctrlmsg::QueueAssignmentAdvisory* advisory,
+    ClusterState*                          clusterState,
+    ClusterData*                           clusterData,
+    const mqbi::Cluster*                   cluster,
+    const bmqt::Uri&                       uri,
+    bslma::Allocator*                      allocator,
+    bmqp_ctrlmsg::Status*                  status)
 {
     // executed by the cluster *DISPATCHER* thread
 
     // PRECONDITIONS
+    BSLS_ASSERT_SAFE(advisory);
     BSLS_ASSERT_SAFE(cluster->inDispatcherThread());
     BSLS_ASSERT_SAFE(!cluster->isRemote());
     BSLS_ASSERT_SAFE(clusterState);
     BSLS_ASSERT_SAFE(clusterData);
     BSLS_ASSERT_SAFE(clusterData->electorInfo().isSelfActiveLeader());
-    BSLS_ASSERT_SAFE(ledger && ledger->isOpen());
     BSLS_ASSERT_SAFE(uri.isCanonical());
     BSLS_ASSERT_SAFE(allocator);
     BSLS_ASSERT_SAFE(status);
@@ -1040,33 +1216,48 @@ bool ClusterUtil::assignQueue(ClusterState*         clusterState,
                   << uri << "].";
 
     // Populate 'queueAssignmentAdvisory'
-    bdlma::LocalSequentialAllocator<1024>  localAllocator(allocator);
-    bmqp_ctrlmsg::ControlMessage           controlMsg(&localAllocator);
-    bmqp_ctrlmsg::QueueAssignmentAdvisory& queueAdvisory =
-        controlMsg.choice()
-            .makeClusterMessage()
-            .choice()
-            .makeQueueAssignmentAdvisory();
-
     mqbu::StorageKey key;
-    populateQueueAssignmentAdvisory(&queueAdvisory,
+    populateQueueAssignmentAdvisory(advisory,
                                     &key,
                                     clusterState,
                                     clusterData,
                                     uri,
                                     domainCfg->mode());
 
+    // The generated key stays in 'ClusterState::queueKeys' until the advisory
+    // is applied, so that all queues in the same advisory get unique keys.
+
+    return true;
+}
+
+bool ClusterUtil::applyQueueAssignmentAdvisory(
+    const bmqp_ctrlmsg::QueueAssignmentAdvisory& advisory,
+    ClusterState*                                clusterState,
+    ClusterData*                                 clusterData,
+    ClusterStateLedger*                          ledger,
+    bmqp_ctrlmsg::Status*                        status)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(clusterState);
+    BSLS_ASSERT_SAFE(clusterData);
+    BSLS_ASSERT_SAFE(ledger && ledger->isOpen());
+    BSLS_ASSERT_SAFE(status);
+
     // 'ClusterQueueHelper::onQueueAssigned' (the 'onQueueAssigned' observer
-    // callback) will insert the key to 'ClusterState::queueKeys'.
+    // callback) will insert the keys to 'ClusterState::queueKeys'.
 
-    clusterState->queueKeys().erase(key);
+    for (size_t i = 0; i < advisory.queues().size(); ++i) {
+        clusterState->queueKeys().erase(
+            mqbu::StorageKey(mqbu::StorageKey::BinaryRepresentation(),
+                             advisory.queues()[i].key().data()));
+    }
 
     // Apply 'queueAssignmentAdvisory' to CSL
     BALL_LOG_INFO << clusterData->identity().description()
                   << ": 'QueueAssignmentAdvisory' will be applied to "
-                  << " cluster state ledger: " << queueAdvisory;
+                  << " cluster state ledger: " << advisory;
 
-    const int rc = ledger->apply(queueAdvisory);
+    const int rc = ledger->apply(advisory);
 
     if (rc == 0) {
         return true;  // RETURN
@@ -1074,7 +1265,7 @@ bool ClusterUtil::assignQueue(ClusterState*         clusterState,
     else {
         BALL_LOG_ERROR << clusterData->identity().description()
                        << ": Failed to apply queue assignment advisory: "
-                       << queueAdvisory << ", rc: " << rc;
+                       << advisory << ", rc: " << rc;
 
         status->category() = bmqp_ctrlmsg::StatusCategory::E_REFUSED;
         status->code()     = mqbi::ClusterErrorCode::e_CSL_FAILURE;
@@ -1085,6 +1276,126 @@ bool ClusterUtil::assignQueue(ClusterState*         clusterState,
     }
 }
 
+bool ClusterUtil::assignQueue(ClusterState*         clusterState,
+                              ClusterData*          clusterData,
+                              ClusterStateLedger*   ledger,
+                              const mqbi::Cluster*  cluster,
+                              const bmqt::Uri&      uri,
+                              bslma::Allocator*     allocator,
+                              bmqp_ctrlmsg::Status* status)
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cluster->inDispatcherThread());
+    BSLS_ASSERT_SAFE(!cluster->isRemote());
+    BSLS_ASSERT_SAFE(clusterState);
+    BSLS_ASSERT_SAFE(clusterData);
+    BSLS_ASSERT_SAFE(clusterData->electorInfo().isSelfActiveLeader());
+    BSLS_ASSERT_SAFE(ledger && ledger->isOpen());
+    BSLS_ASSERT_SAFE(uri.isCanonical());
+    BSLS_ASSERT_SAFE(allocator);
+    BSLS_ASSERT_SAFE(status);
+
+    bdlma::LocalSequentialAllocator<1024>  localAllocator(allocator);
+    bmqp_ctrlmsg::ControlMessage           controlMsg(&localAllocator);
+    bmqp_ctrlmsg::QueueAssignmentAdvisory& queueAdvisory =
+        controlMsg.choice()
+            .makeClusterMessage()
+            .choice()
+            .makeQueueAssignmentAdvisory();
+
+    if (!prepareQueueAssignment(&queueAdvisory,
+                                clusterState,
+                                clusterData,
+                                cluster,
+                                uri,
+                                allocator,
+                                status)) {
+        // Permanent failure, cannot continue
+        return false;  // RETURN
+    }
+
+    if (queueAdvisory.queues().empty()) {
+        // Nothing to apply: the queue is already assigned or assigning, or
+        // the assignment can be retried.
+        return true;  // RETURN
+    }
+
+    return applyQueueAssignmentAdvisory(queueAdvisory,
+                                        clusterState,
+                                        clusterData,
+                                        ledger,
+                                        status);
+}
+
+void ClusterUtil::assignQueues(
+    ClusterState*                                 clusterState,
+    ClusterData*                                  clusterData,
+    ClusterStateLedger*                           ledger,
+    const mqbi::Cluster*                          cluster,
+    const bsl::vector<bmqt::Uri>&                 uris,
+    bslma::Allocator*                             allocator,
+    mqbi::ClusterStateManager::FailedAssignments* failures)
+{
+    // executed by the cluster *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(cluster->inDispatcherThread());
+    BSLS_ASSERT_SAFE(!cluster->isRemote());
+    BSLS_ASSERT_SAFE(clusterState);
+    BSLS_ASSERT_SAFE(clusterData);
+    BSLS_ASSERT_SAFE(clusterData->electorInfo().isSelfActiveLeader());
+    BSLS_ASSERT_SAFE(ledger && ledger->isOpen());
+    BSLS_ASSERT_SAFE(allocator);
+    BSLS_ASSERT_SAFE(failures);
+
+    typedef mqbi::ClusterStateManager::FailedAssignment FailedAssignment;
+
+    bmqp_ctrlmsg::ControlMessage           controlMsg(allocator);
+    bmqp_ctrlmsg::QueueAssignmentAdvisory& queueAdvisory =
+        controlMsg.choice()
+            .makeClusterMessage()
+            .choice()
+            .makeQueueAssignmentAdvisory();
+    bmqp_ctrlmsg::Status status(allocator);
+
+    for (size_t i = 0; i < uris.size(); ++i) {
+        if (!prepareQueueAssignment(&queueAdvisory,
+                                    clusterState,
+                                    clusterData,
+                                    cluster,
+                                    uris[i],
+                                    allocator,
+                                    &status)) {
+            failures->push_back(FailedAssignment(uris[i], status));
+        }
+
+        // Apply the advisory once it is full, or once all queues have been
+        // prepared.
+        const bool isLast = (i + 1 == uris.size());
+        if (queueAdvisory.queues().empty() ||
+            (!isLast && queueAdvisory.queues().size() <
+                            k_MAX_QUEUES_PER_ASSIGNMENT_ADVISORY)) {
+            continue;  // CONTINUE
+        }
+
+        if (!applyQueueAssignmentAdvisory(queueAdvisory,
+                                          clusterState,
+                                          clusterData,
+                                          ledger,
+                                          &status)) {
+            for (size_t j = 0; j < queueAdvisory.queues().size(); ++j) {
+                failures->push_back(FailedAssignment(
+                    bmqt::Uri(queueAdvisory.queues()[j].uri(), allocator),
+                    status));
+            }
+        }
+
+        queueAdvisory.queues().clear();
+    }
+}
+
 void ClusterUtil::registerQueueInfo(ClusterState*        clusterState,
                                     const mqbi::Cluster* cluster,
                                     const bmqp_ctrlmsg::QueueInfo& advisory,
@@ -33,6 +33,7 @@
 #include <mqbc_clusterstate.h>
 #include <mqbcfg_messages.h>
 #include <mqbi_clusterstatemanager.h>
+#include <mqbstat_clusterstats.h>
 
 // BMQ
 #include <bmqp_ctrlmsg_messages.h>
@@ -112,6 +113,38 @@ struct ClusterUtil {
     typedef ClusterState::UriToQueueInfoMapIter UriToQueueInfoMapIter;
     typedef ClusterState::DomainStatesIter      DomainStatesIter;
 
+    // PRIVATE FUNCTIONS
+
+    /// Prepare the assignment of the queue represented by the specified
+    /// `uri` using the specified `clusterState`, `clusterData`, `cluster`
+    /// and `allocator`, appending it to the queues of the specified
+    /// `advisory` if the queue needs to be assigned.  Return `false` and
+    /// populate the specified `status` in the case of permanent failure.
+    /// Return `true` otherwise; note that `advisory` is left unchanged if
+    /// the queue is already assigned or assigning, or if the assignment
+    /// should be retried later.  Also note that the queue key generated for
+    /// the assignment is kept in `clusterState` until `advisory` is applied
+    /// with `applyQueueAssignmentAdvisory`.
+    static bool
+    prepareQueueAssignment(bmqp_ctrlmsg::QueueAssignmentAdvisory* advisory,
+                           ClusterState*         clusterState,
+                           ClusterData*          clusterData,
+                           const mqbi::Cluster*  cluster,
+                           const bmqt::Uri&      uri,
+                           bslma::Allocator*     allocator,
+                           bmqp_ctrlmsg::Status* status);
+
+    /// Apply the specified queue assignment `advisory` to the specified
+    /// `ledger`, using the specified `clusterState` and `clusterData`.
+    /// Return `true` on success, and `false` and populate the specified
+    /// `status` otherwise.
+    static bool applyQueueAssignmentAdvisory(
+        const bmqp_ctrlmsg::QueueAssignmentAdvisory& advisory,
+        ClusterState*                                clusterState,
+        ClusterData*                                 clusterData,
+        ClusterStateLedger*                          ledger,
+        bmqp_ctrlmsg::Status*                        status);
+
   public:
     // FUNCTIONS
 
@@ -148,9 +181,13 @@ struct ClusterUtil {
 
     /// Return the partition id to use for a new queue, taking into account
     /// current load of each partition in the specified `clusterState` and
-    /// the specified `uri`.
-    static int getNextPartitionId(const ClusterState& clusterState,
-                                  const bmqt::Uri&    uri);
+    /// the specified `uri`.  If the optionally specified `stats` is not
+    /// null, the load of a partition accounts for its outstanding bytes and
+    /// write rate, as reported to `stats`, in addition to the number of
+    /// queues mapped to it.
+    static int getNextPartitionId(const ClusterState&          clusterState,
+                                  const bmqt::Uri&             uri,
+                                  const mqbstat::ClusterStats* stats = 0);
 
     /// Callback invoked when the specified 'partitionId' gets assigned to
     /// the specified 'primary' with the specified 'leaseId' and the
@@ -192,7 +229,10 @@ struct ClusterUtil {
     /// Populate the specified `advisory` with information describing a
     /// queue assignment of the specified `uri` according to the specified
     /// `config`, using the specified `clusterState`, `clusterData`.  Load into
-    /// the specified `key` the unique queue key generated.
+    /// the specified `key` the unique queue key generated.  Note that the
+    /// assignment is appended to the queues already in `advisory`, and that
+    /// a new leader sequence number is only generated when `advisory` has no
+    /// queues yet.
     static void populateQueueAssignmentAdvisory(
         bmqp_ctrlmsg::QueueAssignmentAdvisory* advisory,
         mqbu::StorageKey*                      key,
@@ -231,6 +271,28 @@ struct ClusterUtil {
                             bslma::Allocator*     allocator,
                             bmqp_ctrlmsg::Status* status = 0);
 
+    /// Perform the assignment of all the queues represented by the
+    /// specified `uris`, as per `assignQueue`, using the specified
+    /// `clusterState`, `clusterData`, `ledger`, `cluster` and `allocator`,
+    /// but group the queues to assign into as few queue assignment
+    /// advisories applied to CSL as possible, each advisory carrying a
+    /// bounded number of queues.  Load into the specified `failures` the
+    /// uri and status of every queue whose assignment failed permanently.
+    /// Note that if applying an advisory fails, all the queues it contains
+    /// are reported in `failures`.  This method is called only on the
+    /// leader node.
+    ///
+    /// THREAD: This method is invoked in the associated cluster's
+    ///         dispatcher thread.
+    static void
+    assignQueues(ClusterState*                                 clusterState,
+                 ClusterData*                                  clusterData,
+                 ClusterStateLedger*                           ledger,
+                 const mqbi::Cluster*                          cluster,
+                 const bsl::vector<bmqt::Uri>&                 uris,
+                 bslma::Allocator*                             allocator,
+                 mqbi::ClusterStateManager::FailedAssignments* failures);
+
     /// Register a queue info for the queue with the values in the specified
     /// `advisory` to the specified `clusterState` of the specified `cluster`.
     /// If the specified `forceUpdate` flag is true, update queue info even if
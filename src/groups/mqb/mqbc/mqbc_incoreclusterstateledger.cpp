@@ -497,6 +497,12 @@ int IncoreClusterStateLedger::applyRecordInternalImpl(
             d_clusterData_p->electorInfo().setLeaderMessageSequence(lsn);
         }
 
+        // Note that writing a record only copies it into the memory mapped
+        // log: the log is not synced (see 'mqbsi::Log::flush') on each
+        // record, but only when the ledger rolls over, so a burst of
+        // advisories does not pay one sync per record.  Durability comes from
+        // the replication of the record to a majority of the cluster, which
+        // gathers the ACKs before the record is committed.
         mqbsi::LedgerRecordId recordId;
         rc = d_ledger_mp->writeRecord(&recordId,
                                       record,
@@ -36,6 +36,17 @@
 /// replicated and maintained by BlazingMQ cluster nodes themselves instead of
 /// being offloaded to an external meta data server (e.g., ZooKeeper).
 ///
+/// Compaction                      {#mqbc_incoreclusterstateledger_compaction}
+/// ==========
+///
+/// The ledger rolls over to a new log once the current one reaches the
+/// configured `maxCSLFileSize`.  Upon rollover, each node writes a snapshot
+/// of the full cluster state as the first record of the new log, followed by
+/// the uncommitted advisories, and the old log is cleaned up.  Recovery
+/// (@bbref{mqbc::ClusterUtil::load}) applies records starting from the latest
+/// snapshot only, so the amount of work it does is bounded by
+/// `maxCSLFileSize` regardless of how much the cluster state has churned.
+///
 /// Thread Safety                       {#mqbc_incoreclusterstateledger_thread}
 /// =============
 ///
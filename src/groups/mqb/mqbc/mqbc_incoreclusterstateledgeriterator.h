@@ -25,6 +25,11 @@
 /// concrete implementation of the @bbref{mqbc::ClusterStateLedgerIterator}
 /// interface to iterate through an @bbref{mqbc::IncoreClusterStateLedger}.
 /// Note that any ledger iterated by this component *must* support aliasing.
+/// Record headers are accessed, and cluster messages decoded, in place in the
+/// memory mapped ledger files (see
+/// @bbref{mqbc::ClusterStateLedgerUtil::loadClusterMessage}), so that
+/// replaying the ledger at startup, or in `bmqstoragetool`, does not copy the
+/// records.
 ///
 /// @see @bbref{mqbc::ClusterStateLedgerIterator}
 /// @see @bbref{mqbc::IncoreClusterStateLedger}
@@ -3249,6 +3249,7 @@ void StorageManager::do_attemptOpenStorage(
         return;  // RETURN
     }
 
+    const bsls::Types::Int64 openStartTime = bmqu::Time::highResolutionTimer();
     const int rc = fs->open(d_queueKeyInfoMapVec.at(partitionId).get());
     if (0 != rc) {
         BMQTSK_ALARMLOG_ALARM("FILE_IO")
@@ -3259,6 +3260,15 @@ void StorageManager::do_attemptOpenStorage(
 
         mqbu::ExitUtil::terminate(mqbu::ExitCode::e_RECOVERY_FAILURE);  // EXIT
     }
+
+    const bsls::Types::Int64 openTime = bmqu::Time::highResolutionTimer() -
+                                        openStartTime;
+    BALL_LOG_INFO << d_clusterData_p->identity().description()
+                  << " Partition [" << partitionId << "]: "
+                  << "Opened FileStore with " << fs->numRecords()
+                  << " outstanding records in "
+                  << bmqu::PrintUtil::prettyTimeInterval(openTime) << " ("
+                  << openTime << " nanoseconds).";
 }
 
 void StorageManager::do_updateStorage(
@@ -505,7 +505,12 @@ class StorageManager BSLS_KEYWORD_FINAL : public mqbi::StorageManager,
                                             mqbnet::ClusterNode* primary);
 
     /// Determine which nodes to send ReplicaDataRequestPush/Drop based on the
-    /// `event`, and populate the specified `destinations`.
+    /// `event`, and populate the specified `destinations`.  A replica whose
+    /// storage is a prefix of self's is sent ReplicaDataRequestPush, and
+    /// later receives only the records after its PSN.  ReplicaDataRequestDrop,
+    /// which implies a transfer of the entire partition, is reserved for a
+    /// replica whose storage has diverged from self's: it missed a rollover,
+    /// or it has records which self does not have.
     void determineDataDestinations(DataDestinations*              destinations,
                                    PartitionStateTableEvent::Enum eventType,
                                    const PartitionFSMEventData&   eventData);
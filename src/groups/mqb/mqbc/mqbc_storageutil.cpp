@@ -64,6 +64,7 @@
 #include <bsl_unordered_map.h>
 #include <bsl_utility.h>
 #include <bsla_annotations.h>
+#include <bslh_hash.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_mutex.h>
 
@@ -1374,13 +1375,18 @@ int StorageUtil::assignPartitionDispatcherThreads(
     }
 
     // Assign a queue dispatcher thread to each partition in round-robin
-    // manner.
+    // manner, by groups of 'partitionsPerProcessor' consecutive partitions.
+    // Queues are served by the thread of their partition, so this also
+    // decides which queues share a thread.
     const int numProcessors = dispatcher->numProcessors(
         mqbi::DispatcherClientType::e_QUEUE);
     BSLS_ASSERT_SAFE(numProcessors > 0);
+    const int partitionsPerProcessor =
+        bsl::max(config.partitionsPerProcessor(), 1);
 
     for (int i = 0; i < config.numPartitions(); ++i) {
-        int                   processorId = i % numProcessors;
+        const int processorId = (i / partitionsPerProcessor) % numProcessors;
+
         mqbs::DataStoreConfig dsCfg;
         dsCfg.setScheduler(&clusterData->scheduler())
             .setBufferFactory(&clusterData->bufferFactory())
@@ -1394,6 +1400,21 @@ int StorageUtil::assignPartitionDispatcherThreads(
             .setMaxJournalFileSize(config.maxJournalFileSize())
             .setMaxQlistFileSize(config.maxQlistFileSize())
             .setMaxArchivedFileSets(config.maxArchivedFileSets())
+            .setWritebackThreshold(config.writebackThreshold())
+            .setGroupCommitMaxBytes(config.groupCommitMaxBytes())
+            .setGroupCommitMaxRecords(config.groupCommitMaxRecords())
+            .setGroupCommitMaxDelayUs(config.groupCommitMaxDelayUs())
+            .setGroupCommitAdaptive(config.groupCommitAdaptive())
+            .setRecoveryThreads(config.recoveryThreads())
+            .setRecoveryVerifyPercent(config.recoveryVerifyPercent())
+            .setScrubIntervalMs(config.scrubIntervalMs())
+            .setScrubMaxBytesPerSecond(config.scrubMaxBytesPerSecond())
+            .setRecoveryCheckpoint(config.recoveryCheckpoint())
+            .setHugePages(config.hugePages())
+            .setResidentWindowSize(config.residentWindowSize())
+            .setReadaheadSize(config.readaheadSize())
+            .setDropConsumedPages(config.dropConsumedPages())
+            .setPrecreatePercent(config.precreatePercent())
             .setRecoveredQueuesCb(recoveredQueuesCb)
             .setQueueCreationCb(queueCreationCb)
             .setQueueDeletionCb(queueDeletionCb);
@@ -1595,7 +1616,9 @@ void StorageUtil::recoveredQueuesCb(
 
     DomainMap domainMap(allocator);
 
-    typedef bsl::unordered_map<mqbu::StorageKey, mqbs::ReplicatedStorage*>
+    typedef bsl::unordered_map<mqbu::StorageKey,
+                               mqbs::ReplicatedStorage*,
+                               bslh::Hash<mqbu::StorageKeyHashAlgo> >
                                          QueueKeyStorageMap;
     typedef QueueKeyStorageMap::iterator QueueKeyStorageMapIter;
     QueueKeyStorageMap                   queueKeyStorageMap;
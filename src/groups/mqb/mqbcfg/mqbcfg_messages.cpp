@@ -2513,7 +2513,20 @@ const bdlat_EnumeratorInfo
         {StatsPrinterEncodingFormat::e_TABLE_AND_JSON,
          "TABLE_AND_JSON",
          sizeof("TABLE_AND_JSON") - 1,
-         ""}};
+         ""},
+        {StatsPrinterEncodingFormat::e_BINARY,
+         "BINARY",
+         sizeof("BINARY") - 1,
+         ""},
+        {StatsPrinterEncodingFormat::e_TABLE_AND_BINARY,
+         "TABLE_AND_BINARY",
+         sizeof("TABLE_AND_BINARY") - 1,
+         ""},
+        {StatsPrinterEncodingFormat::e_JSON_AND_BINARY,
+         "JSON_AND_BINARY",
+         sizeof("JSON_AND_BINARY") - 1,
+         ""},
+        {StatsPrinterEncodingFormat::e_ALL, "ALL", sizeof("ALL") - 1, ""}};
 
 // CLASS METHODS
 
@@ -2526,6 +2539,10 @@ int StatsPrinterEncodingFormat::fromInt(
     case StatsPrinterEncodingFormat::e_TABLE:
     case StatsPrinterEncodingFormat::e_JSON:
     case StatsPrinterEncodingFormat::e_TABLE_AND_JSON:
+    case StatsPrinterEncodingFormat::e_BINARY:
+    case StatsPrinterEncodingFormat::e_TABLE_AND_BINARY:
+    case StatsPrinterEncodingFormat::e_JSON_AND_BINARY:
+    case StatsPrinterEncodingFormat::e_ALL:
         *result = static_cast<StatsPrinterEncodingFormat::Value>(number);
         return 0;
     default: return -1;
@@ -2537,7 +2554,7 @@ int StatsPrinterEncodingFormat::fromString(
     const char*                        string,
     int                                stringLength)
 {
-    for (int i = 0; i < 4; ++i) {
+    for (int i = 0; i < 8; ++i) {
         const bdlat_EnumeratorInfo& enumeratorInfo =
             StatsPrinterEncodingFormat::ENUMERATOR_INFO_ARRAY[i];
 
@@ -2568,6 +2585,18 @@ StatsPrinterEncodingFormat::toString(StatsPrinterEncodingFormat::Value value)
     case e_TABLE_AND_JSON: {
         return "TABLE_AND_JSON";
     }
+    case e_BINARY: {
+        return "BINARY";
+    }
+    case e_TABLE_AND_BINARY: {
+        return "TABLE_AND_BINARY";
+    }
+    case e_JSON_AND_BINARY: {
+        return "JSON_AND_BINARY";
+    }
+    case e_ALL: {
+        return "ALL";
+    }
     }
 
     BSLS_ASSERT(!"invalid enumerator");
@@ -2609,6 +2638,9 @@ const int StorageSyncConfig::DEFAULT_INITIALIZER_FILE_CHUNK_SIZE = 4194304;
 const int StorageSyncConfig::DEFAULT_INITIALIZER_PARTITION_SYNC_EVENT_SIZE =
     4194304;
 
+const int StorageSyncConfig::
+    DEFAULT_INITIALIZER_PARTITION_SYNC_MAX_BYTES_PER_SECOND = 0;
+
 const bdlat_AttributeInfo StorageSyncConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_STARTUP_RECOVERY_MAX_DURATION_MS,
      "startupRecoveryMaxDurationMs",
@@ -2654,6 +2686,11 @@ const bdlat_AttributeInfo StorageSyncConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "partitionSyncEventSize",
      sizeof("partitionSyncEventSize") - 1,
      "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_PARTITION_SYNC_MAX_BYTES_PER_SECOND,
+     "partitionSyncMaxBytesPerSecond",
+     sizeof("partitionSyncMaxBytesPerSecond") - 1,
+     "",
      bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
@@ -2661,7 +2698,7 @@ const bdlat_AttributeInfo StorageSyncConfig::ATTRIBUTE_INFO_ARRAY[] = {
 const bdlat_AttributeInfo*
 StorageSyncConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 9; ++i) {
+    for (int i = 0; i < 10; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             StorageSyncConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -2702,6 +2739,9 @@ const bdlat_AttributeInfo* StorageSyncConfig::lookupAttributeInfo(int id)
     case ATTRIBUTE_ID_PARTITION_SYNC_EVENT_SIZE:
         return &ATTRIBUTE_INFO_ARRAY
             [ATTRIBUTE_INDEX_PARTITION_SYNC_EVENT_SIZE];
+    case ATTRIBUTE_ID_PARTITION_SYNC_MAX_BYTES_PER_SECOND:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_PARTITION_SYNC_MAX_BYTES_PER_SECOND];
     default: return 0;
     }
 }
@@ -2721,6 +2761,8 @@ StorageSyncConfig::StorageSyncConfig()
 , d_startupWaitDurationMs(DEFAULT_INITIALIZER_STARTUP_WAIT_DURATION_MS)
 , d_fileChunkSize(DEFAULT_INITIALIZER_FILE_CHUNK_SIZE)
 , d_partitionSyncEventSize(DEFAULT_INITIALIZER_PARTITION_SYNC_EVENT_SIZE)
+, d_partitionSyncMaxBytesPerSecond(
+      DEFAULT_INITIALIZER_PARTITION_SYNC_MAX_BYTES_PER_SECOND)
 {
 }
 
@@ -2742,6 +2784,8 @@ void StorageSyncConfig::reset()
     d_startupWaitDurationMs  = DEFAULT_INITIALIZER_STARTUP_WAIT_DURATION_MS;
     d_fileChunkSize          = DEFAULT_INITIALIZER_FILE_CHUNK_SIZE;
     d_partitionSyncEventSize = DEFAULT_INITIALIZER_PARTITION_SYNC_EVENT_SIZE;
+    d_partitionSyncMaxBytesPerSecond =
+        DEFAULT_INITIALIZER_PARTITION_SYNC_MAX_BYTES_PER_SECOND;
 }
 
 // ACCESSORS
@@ -2769,6 +2813,8 @@ bsl::ostream& StorageSyncConfig::print(bsl::ostream& stream,
     printer.printAttribute("fileChunkSize", this->fileChunkSize());
     printer.printAttribute("partitionSyncEventSize",
                            this->partitionSyncEventSize());
+    printer.printAttribute("partitionSyncMaxBytesPerSecond",
+                           this->partitionSyncMaxBytesPerSecond());
     printer.end();
     return stream;
 }
@@ -3066,6 +3112,8 @@ const char TcpInterfaceListener::DEFAULT_INITIALIZER_ADDRESS[] = "0.0.0.0";
 
 const bool TcpInterfaceListener::DEFAULT_INITIALIZER_TLS = false;
 
+const int TcpInterfaceListener::DEFAULT_INITIALIZER_ACCEPT_SHARDS = 1;
+
 const bdlat_AttributeInfo TcpInterfaceListener::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NAME,
      "name",
@@ -3086,14 +3134,19 @@ const bdlat_AttributeInfo TcpInterfaceListener::ATTRIBUTE_INFO_ARRAY[] = {
      "tls",
      sizeof("tls") - 1,
      "",
-     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_ACCEPT_SHARDS,
+     "acceptShards",
+     sizeof("acceptShards") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 TcpInterfaceListener::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 4; ++i) {
+    for (int i = 0; i < 5; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             TcpInterfaceListener::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -3114,6 +3167,8 @@ const bdlat_AttributeInfo* TcpInterfaceListener::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADDRESS];
     case ATTRIBUTE_ID_PORT: return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PORT];
     case ATTRIBUTE_ID_TLS: return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TLS];
+    case ATTRIBUTE_ID_ACCEPT_SHARDS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ACCEPT_SHARDS];
     default: return 0;
     }
 }
@@ -3124,6 +3179,7 @@ TcpInterfaceListener::TcpInterfaceListener(bslma::Allocator* basicAllocator)
 : d_name(basicAllocator)
 , d_address(DEFAULT_INITIALIZER_ADDRESS, basicAllocator)
 , d_port()
+, d_acceptShards(DEFAULT_INITIALIZER_ACCEPT_SHARDS)
 , d_tls(DEFAULT_INITIALIZER_TLS)
 {
 }
@@ -3134,6 +3190,7 @@ TcpInterfaceListener::TcpInterfaceListener(
 : d_name(original.d_name, basicAllocator)
 , d_address(original.d_address, basicAllocator)
 , d_port(original.d_port)
+, d_acceptShards(original.d_acceptShards)
 , d_tls(original.d_tls)
 {
 }
@@ -3144,6 +3201,7 @@ TcpInterfaceListener::TcpInterfaceListener(TcpInterfaceListener&& original)
     noexcept : d_name(bsl::move(original.d_name)),
                d_address(bsl::move(original.d_address)),
                d_port(bsl::move(original.d_port)),
+               d_acceptShards(bsl::move(original.d_acceptShards)),
                d_tls(bsl::move(original.d_tls))
 {
 }
@@ -3153,6 +3211,7 @@ TcpInterfaceListener::TcpInterfaceListener(TcpInterfaceListener&& original,
 : d_name(bsl::move(original.d_name), basicAllocator)
 , d_address(bsl::move(original.d_address), basicAllocator)
 , d_port(bsl::move(original.d_port))
+, d_acceptShards(bsl::move(original.d_acceptShards))
 , d_tls(bsl::move(original.d_tls))
 {
 }
@@ -3168,10 +3227,11 @@ TcpInterfaceListener&
 TcpInterfaceListener::operator=(const TcpInterfaceListener& rhs)
 {
     if (this != &rhs) {
-        d_name    = rhs.d_name;
-        d_address = rhs.d_address;
-        d_port    = rhs.d_port;
-        d_tls     = rhs.d_tls;
+        d_name         = rhs.d_name;
+        d_address      = rhs.d_address;
+        d_port         = rhs.d_port;
+        d_tls          = rhs.d_tls;
+        d_acceptShards = rhs.d_acceptShards;
     }
 
     return *this;
@@ -3183,10 +3243,11 @@ TcpInterfaceListener&
 TcpInterfaceListener::operator=(TcpInterfaceListener&& rhs)
 {
     if (this != &rhs) {
-        d_name    = bsl::move(rhs.d_name);
-        d_address = bsl::move(rhs.d_address);
-        d_port    = bsl::move(rhs.d_port);
-        d_tls     = bsl::move(rhs.d_tls);
+        d_name         = bsl::move(rhs.d_name);
+        d_address      = bsl::move(rhs.d_address);
+        d_port         = bsl::move(rhs.d_port);
+        d_tls          = bsl::move(rhs.d_tls);
+        d_acceptShards = bsl::move(rhs.d_acceptShards);
     }
 
     return *this;
@@ -3198,7 +3259,8 @@ void TcpInterfaceListener::reset()
     bdlat_ValueTypeFunctions::reset(&d_name);
     d_address = DEFAULT_INITIALIZER_ADDRESS;
     bdlat_ValueTypeFunctions::reset(&d_port);
-    d_tls = DEFAULT_INITIALIZER_TLS;
+    d_tls          = DEFAULT_INITIALIZER_TLS;
+    d_acceptShards = DEFAULT_INITIALIZER_ACCEPT_SHARDS;
 }
 
 // ACCESSORS
@@ -3213,6 +3275,7 @@ bsl::ostream& TcpInterfaceListener::print(bsl::ostream& stream,
     printer.printAttribute("address", this->address());
     printer.printAttribute("port", this->port());
     printer.printAttribute("tls", this->tls());
+    printer.printAttribute("acceptShards", this->acceptShards());
     printer.end();
     return stream;
 }
@@ -4086,6 +4149,13 @@ const char* ClusterNodeConnection::selectionName() const
 const char DispatcherProcessorConfig::CLASS_NAME[] =
     "DispatcherProcessorConfig";
 
+const bool DispatcherProcessorConfig::DEFAULT_INITIALIZER_WORK_STEALING =
+    false;
+
+const int DispatcherProcessorConfig::DEFAULT_INITIALIZER_MAX_BATCH_SIZE = 1;
+
+const int DispatcherProcessorConfig::DEFAULT_INITIALIZER_FIRST_CPU = -1;
+
 const bdlat_AttributeInfo DispatcherProcessorConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NUM_PROCESSORS,
      "numProcessors",
@@ -4096,7 +4166,22 @@ const bdlat_AttributeInfo DispatcherProcessorConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "processorConfig",
      sizeof("processorConfig") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_WORK_STEALING,
+     "workStealing",
+     sizeof("workStealing") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_MAX_BATCH_SIZE,
+     "maxBatchSize",
+     sizeof("maxBatchSize") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_FIRST_CPU,
+     "firstCpu",
+     sizeof("firstCpu") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
@@ -4104,7 +4189,7 @@ const bdlat_AttributeInfo*
 DispatcherProcessorConfig::lookupAttributeInfo(const char* name,
                                                int         nameLength)
 {
-    for (int i = 0; i < 2; ++i) {
+    for (int i = 0; i < 5; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             DispatcherProcessorConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -4125,6 +4210,12 @@ DispatcherProcessorConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_PROCESSORS];
     case ATTRIBUTE_ID_PROCESSOR_CONFIG:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_CONFIG];
+    case ATTRIBUTE_ID_WORK_STEALING:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WORK_STEALING];
+    case ATTRIBUTE_ID_MAX_BATCH_SIZE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_BATCH_SIZE];
+    case ATTRIBUTE_ID_FIRST_CPU:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIRST_CPU];
     default: return 0;
     }
 }
@@ -4134,6 +4225,9 @@ DispatcherProcessorConfig::lookupAttributeInfo(int id)
 DispatcherProcessorConfig::DispatcherProcessorConfig()
 : d_processorConfig()
 , d_numProcessors()
+, d_maxBatchSize(DEFAULT_INITIALIZER_MAX_BATCH_SIZE)
+, d_firstCpu(DEFAULT_INITIALIZER_FIRST_CPU)
+, d_workStealing(DEFAULT_INITIALIZER_WORK_STEALING)
 {
 }
 
@@ -4143,6 +4237,9 @@ void DispatcherProcessorConfig::reset()
 {
     bdlat_ValueTypeFunctions::reset(&d_numProcessors);
     bdlat_ValueTypeFunctions::reset(&d_processorConfig);
+    d_workStealing = DEFAULT_INITIALIZER_WORK_STEALING;
+    d_maxBatchSize = DEFAULT_INITIALIZER_MAX_BATCH_SIZE;
+    d_firstCpu     = DEFAULT_INITIALIZER_FIRST_CPU;
 }
 
 // ACCESSORS
@@ -4155,6 +4252,9 @@ bsl::ostream& DispatcherProcessorConfig::print(bsl::ostream& stream,
     printer.start();
     printer.printAttribute("numProcessors", this->numProcessors());
     printer.printAttribute("processorConfig", this->processorConfig());
+    printer.printAttribute("workStealing", this->workStealing());
+    printer.printAttribute("maxBatchSize", this->maxBatchSize());
+    printer.printAttribute("firstCpu", this->firstCpu());
     printer.end();
     return stream;
 }
@@ -4443,6 +4543,41 @@ LogController::print(bsl::ostream& stream, int level, int spacesPerLevel) const
 
 const char PartitionConfig::CLASS_NAME[] = "PartitionConfig";
 
+const int PartitionConfig::DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES = 0;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_RECORDS = 0;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_DELAY_US = 0;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_RECOVERY_THREADS = 0;
+
+const bool PartitionConfig::DEFAULT_INITIALIZER_RECOVERY_CHECKPOINT = false;
+
+const bool PartitionConfig::DEFAULT_INITIALIZER_HUGE_PAGES = false;
+
+const bsls::Types::Uint64
+    PartitionConfig::DEFAULT_INITIALIZER_RESIDENT_WINDOW_SIZE = 0;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_PRECREATE_PERCENT = 0;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_PARTITIONS_PER_PROCESSOR = 1;
+
+const bool PartitionConfig::DEFAULT_INITIALIZER_GROUP_COMMIT_ADAPTIVE = false;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_RECOVERY_VERIFY_PERCENT = 100;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_SCRUB_INTERVAL_MS = 0;
+
+const int PartitionConfig::DEFAULT_INITIALIZER_SCRUB_MAX_BYTES_PER_SECOND = 0;
+
+const bsls::Types::Uint64
+    PartitionConfig::DEFAULT_INITIALIZER_READAHEAD_SIZE = 0;
+
+const bool PartitionConfig::DEFAULT_INITIALIZER_DROP_CONSUMED_PAGES = false;
+
+const bsls::Types::Uint64
+    PartitionConfig::DEFAULT_INITIALIZER_WRITEBACK_THRESHOLD = 0;
+
 const bsls::Types::Uint64
     PartitionConfig::DEFAULT_INITIALIZER_MAX_C_S_L_FILE_SIZE = 67108864;
 
@@ -4512,14 +4647,94 @@ const bdlat_AttributeInfo PartitionConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "syncConfig",
      sizeof("syncConfig") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_WRITEBACK_THRESHOLD,
+     "writebackThreshold",
+     sizeof("writebackThreshold") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES,
+     "groupCommitMaxBytes",
+     sizeof("groupCommitMaxBytes") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_GROUP_COMMIT_MAX_RECORDS,
+     "groupCommitMaxRecords",
+     sizeof("groupCommitMaxRecords") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_GROUP_COMMIT_MAX_DELAY_US,
+     "groupCommitMaxDelayUs",
+     sizeof("groupCommitMaxDelayUs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_RECOVERY_THREADS,
+     "recoveryThreads",
+     sizeof("recoveryThreads") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_RECOVERY_CHECKPOINT,
+     "recoveryCheckpoint",
+     sizeof("recoveryCheckpoint") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_HUGE_PAGES,
+     "hugePages",
+     sizeof("hugePages") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_RESIDENT_WINDOW_SIZE,
+     "residentWindowSize",
+     sizeof("residentWindowSize") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}},
+    {ATTRIBUTE_ID_PRECREATE_PERCENT,
+     "precreatePercent",
+     sizeof("precreatePercent") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_PARTITIONS_PER_PROCESSOR,
+     "partitionsPerProcessor",
+     sizeof("partitionsPerProcessor") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_GROUP_COMMIT_ADAPTIVE,
+     "groupCommitAdaptive",
+     sizeof("groupCommitAdaptive") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_RECOVERY_VERIFY_PERCENT,
+     "recoveryVerifyPercent",
+     sizeof("recoveryVerifyPercent") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_SCRUB_INTERVAL_MS,
+     "scrubIntervalMs",
+     sizeof("scrubIntervalMs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_SCRUB_MAX_BYTES_PER_SECOND,
+     "scrubMaxBytesPerSecond",
+     sizeof("scrubMaxBytesPerSecond") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_READAHEAD_SIZE,
+     "readaheadSize",
+     sizeof("readaheadSize") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_DROP_CONSUMED_PAGES,
+     "dropConsumedPages",
+     sizeof("dropConsumedPages") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 PartitionConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 12; ++i) {
+    for (int i = 0; i < 28; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             PartitionConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -4559,6 +4774,39 @@ const bdlat_AttributeInfo* PartitionConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN];
     case ATTRIBUTE_ID_SYNC_CONFIG:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG];
+    case ATTRIBUTE_ID_WRITEBACK_THRESHOLD:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WRITEBACK_THRESHOLD];
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES];
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_RECORDS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_RECORDS];
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_DELAY_US:
+        return &ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_DELAY_US];
+    case ATTRIBUTE_ID_RECOVERY_THREADS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_THREADS];
+    case ATTRIBUTE_ID_RECOVERY_CHECKPOINT:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_CHECKPOINT];
+    case ATTRIBUTE_ID_HUGE_PAGES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HUGE_PAGES];
+    case ATTRIBUTE_ID_RESIDENT_WINDOW_SIZE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RESIDENT_WINDOW_SIZE];
+    case ATTRIBUTE_ID_PRECREATE_PERCENT:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRECREATE_PERCENT];
+    case ATTRIBUTE_ID_PARTITIONS_PER_PROCESSOR:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITIONS_PER_PROCESSOR];
+    case ATTRIBUTE_ID_GROUP_COMMIT_ADAPTIVE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_ADAPTIVE];
+    case ATTRIBUTE_ID_RECOVERY_VERIFY_PERCENT:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_VERIFY_PERCENT];
+    case ATTRIBUTE_ID_SCRUB_INTERVAL_MS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SCRUB_INTERVAL_MS];
+    case ATTRIBUTE_ID_SCRUB_MAX_BYTES_PER_SECOND:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SCRUB_MAX_BYTES_PER_SECOND];
+    case ATTRIBUTE_ID_READAHEAD_SIZE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_READAHEAD_SIZE];
+    case ATTRIBUTE_ID_DROP_CONSUMED_PAGES:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DROP_CONSUMED_PAGES];
     default: return 0;
     }
 }
@@ -4570,14 +4818,30 @@ PartitionConfig::PartitionConfig(bslma::Allocator* basicAllocator)
 , d_maxJournalFileSize()
 , d_maxQlistFileSize()
 , d_maxCSLFileSize(DEFAULT_INITIALIZER_MAX_C_S_L_FILE_SIZE)
+, d_writebackThreshold(DEFAULT_INITIALIZER_WRITEBACK_THRESHOLD)
+, d_residentWindowSize(DEFAULT_INITIALIZER_RESIDENT_WINDOW_SIZE)
+, d_readaheadSize(DEFAULT_INITIALIZER_READAHEAD_SIZE)
 , d_location(basicAllocator)
 , d_archiveLocation(basicAllocator)
 , d_syncConfig()
 , d_numPartitions()
 , d_maxArchivedFileSets()
+, d_groupCommitMaxBytes(DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES)
+, d_groupCommitMaxRecords(DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_RECORDS)
+, d_groupCommitMaxDelayUs(DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_DELAY_US)
+, d_recoveryThreads(DEFAULT_INITIALIZER_RECOVERY_THREADS)
+, d_precreatePercent(DEFAULT_INITIALIZER_PRECREATE_PERCENT)
+, d_partitionsPerProcessor(DEFAULT_INITIALIZER_PARTITIONS_PER_PROCESSOR)
+, d_recoveryVerifyPercent(DEFAULT_INITIALIZER_RECOVERY_VERIFY_PERCENT)
+, d_scrubIntervalMs(DEFAULT_INITIALIZER_SCRUB_INTERVAL_MS)
+, d_scrubMaxBytesPerSecond(DEFAULT_INITIALIZER_SCRUB_MAX_BYTES_PER_SECOND)
 , d_preallocate(DEFAULT_INITIALIZER_PREALLOCATE)
 , d_prefaultPages(DEFAULT_INITIALIZER_PREFAULT_PAGES)
 , d_flushAtShutdown(DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN)
+, d_recoveryCheckpoint(DEFAULT_INITIALIZER_RECOVERY_CHECKPOINT)
+, d_hugePages(DEFAULT_INITIALIZER_HUGE_PAGES)
+, d_groupCommitAdaptive(DEFAULT_INITIALIZER_GROUP_COMMIT_ADAPTIVE)
+, d_dropConsumedPages(DEFAULT_INITIALIZER_DROP_CONSUMED_PAGES)
 {
 }
 
@@ -4587,14 +4851,30 @@ PartitionConfig::PartitionConfig(const PartitionConfig& original,
 , d_maxJournalFileSize(original.d_maxJournalFileSize)
 , d_maxQlistFileSize(original.d_maxQlistFileSize)
 , d_maxCSLFileSize(original.d_maxCSLFileSize)
+, d_writebackThreshold(original.d_writebackThreshold)
+, d_residentWindowSize(original.d_residentWindowSize)
+, d_readaheadSize(original.d_readaheadSize)
 , d_location(original.d_location, basicAllocator)
 , d_archiveLocation(original.d_archiveLocation, basicAllocator)
 , d_syncConfig(original.d_syncConfig)
 , d_numPartitions(original.d_numPartitions)
 , d_maxArchivedFileSets(original.d_maxArchivedFileSets)
+, d_groupCommitMaxBytes(original.d_groupCommitMaxBytes)
+, d_groupCommitMaxRecords(original.d_groupCommitMaxRecords)
+, d_groupCommitMaxDelayUs(original.d_groupCommitMaxDelayUs)
+, d_recoveryThreads(original.d_recoveryThreads)
+, d_precreatePercent(original.d_precreatePercent)
+, d_partitionsPerProcessor(original.d_partitionsPerProcessor)
+, d_recoveryVerifyPercent(original.d_recoveryVerifyPercent)
+, d_scrubIntervalMs(original.d_scrubIntervalMs)
+, d_scrubMaxBytesPerSecond(original.d_scrubMaxBytesPerSecond)
 , d_preallocate(original.d_preallocate)
 , d_prefaultPages(original.d_prefaultPages)
 , d_flushAtShutdown(original.d_flushAtShutdown)
+, d_recoveryCheckpoint(original.d_recoveryCheckpoint)
+, d_hugePages(original.d_hugePages)
+, d_groupCommitAdaptive(original.d_groupCommitAdaptive)
+, d_dropConsumedPages(original.d_dropConsumedPages)
 {
 }
 
@@ -4605,14 +4885,30 @@ PartitionConfig::PartitionConfig(PartitionConfig&& original) noexcept
   d_maxJournalFileSize(bsl::move(original.d_maxJournalFileSize)),
   d_maxQlistFileSize(bsl::move(original.d_maxQlistFileSize)),
   d_maxCSLFileSize(bsl::move(original.d_maxCSLFileSize)),
+  d_writebackThreshold(bsl::move(original.d_writebackThreshold)),
+  d_residentWindowSize(bsl::move(original.d_residentWindowSize)),
+  d_readaheadSize(bsl::move(original.d_readaheadSize)),
   d_location(bsl::move(original.d_location)),
   d_archiveLocation(bsl::move(original.d_archiveLocation)),
   d_syncConfig(bsl::move(original.d_syncConfig)),
   d_numPartitions(bsl::move(original.d_numPartitions)),
   d_maxArchivedFileSets(bsl::move(original.d_maxArchivedFileSets)),
+  d_groupCommitMaxBytes(bsl::move(original.d_groupCommitMaxBytes)),
+  d_groupCommitMaxRecords(bsl::move(original.d_groupCommitMaxRecords)),
+  d_groupCommitMaxDelayUs(bsl::move(original.d_groupCommitMaxDelayUs)),
+  d_recoveryThreads(bsl::move(original.d_recoveryThreads)),
+  d_precreatePercent(bsl::move(original.d_precreatePercent)),
+  d_partitionsPerProcessor(bsl::move(original.d_partitionsPerProcessor)),
+  d_recoveryVerifyPercent(bsl::move(original.d_recoveryVerifyPercent)),
+  d_scrubIntervalMs(bsl::move(original.d_scrubIntervalMs)),
+  d_scrubMaxBytesPerSecond(bsl::move(original.d_scrubMaxBytesPerSecond)),
   d_preallocate(bsl::move(original.d_preallocate)),
   d_prefaultPages(bsl::move(original.d_prefaultPages)),
-  d_flushAtShutdown(bsl::move(original.d_flushAtShutdown))
+  d_flushAtShutdown(bsl::move(original.d_flushAtShutdown)),
+  d_recoveryCheckpoint(bsl::move(original.d_recoveryCheckpoint)),
+  d_hugePages(bsl::move(original.d_hugePages)),
+  d_groupCommitAdaptive(bsl::move(original.d_groupCommitAdaptive)),
+  d_dropConsumedPages(bsl::move(original.d_dropConsumedPages))
 {
 }
 
@@ -4622,14 +4918,30 @@ PartitionConfig::PartitionConfig(PartitionConfig&& original,
 , d_maxJournalFileSize(bsl::move(original.d_maxJournalFileSize))
 , d_maxQlistFileSize(bsl::move(original.d_maxQlistFileSize))
 , d_maxCSLFileSize(bsl::move(original.d_maxCSLFileSize))
+, d_writebackThreshold(bsl::move(original.d_writebackThreshold))
+, d_residentWindowSize(bsl::move(original.d_residentWindowSize))
+, d_readaheadSize(bsl::move(original.d_readaheadSize))
 , d_location(bsl::move(original.d_location), basicAllocator)
 , d_archiveLocation(bsl::move(original.d_archiveLocation), basicAllocator)
 , d_syncConfig(bsl::move(original.d_syncConfig))
 , d_numPartitions(bsl::move(original.d_numPartitions))
 , d_maxArchivedFileSets(bsl::move(original.d_maxArchivedFileSets))
+, d_groupCommitMaxBytes(bsl::move(original.d_groupCommitMaxBytes))
+, d_groupCommitMaxRecords(bsl::move(original.d_groupCommitMaxRecords))
+, d_groupCommitMaxDelayUs(bsl::move(original.d_groupCommitMaxDelayUs))
+, d_recoveryThreads(bsl::move(original.d_recoveryThreads))
+, d_precreatePercent(bsl::move(original.d_precreatePercent))
+, d_partitionsPerProcessor(bsl::move(original.d_partitionsPerProcessor))
+, d_recoveryVerifyPercent(bsl::move(original.d_recoveryVerifyPercent))
+, d_scrubIntervalMs(bsl::move(original.d_scrubIntervalMs))
+, d_scrubMaxBytesPerSecond(bsl::move(original.d_scrubMaxBytesPerSecond))
 , d_preallocate(bsl::move(original.d_preallocate))
 , d_prefaultPages(bsl::move(original.d_prefaultPages))
 , d_flushAtShutdown(bsl::move(original.d_flushAtShutdown))
+, d_recoveryCheckpoint(bsl::move(original.d_recoveryCheckpoint))
+, d_hugePages(bsl::move(original.d_hugePages))
+, d_groupCommitAdaptive(bsl::move(original.d_groupCommitAdaptive))
+, d_dropConsumedPages(bsl::move(original.d_dropConsumedPages))
 {
 }
 #endif
@@ -4643,18 +4955,34 @@ PartitionConfig::~PartitionConfig()
 PartitionConfig& PartitionConfig::operator=(const PartitionConfig& rhs)
 {
     if (this != &rhs) {
-        d_numPartitions       = rhs.d_numPartitions;
-        d_location            = rhs.d_location;
-        d_archiveLocation     = rhs.d_archiveLocation;
-        d_maxDataFileSize     = rhs.d_maxDataFileSize;
-        d_maxJournalFileSize  = rhs.d_maxJournalFileSize;
-        d_maxQlistFileSize    = rhs.d_maxQlistFileSize;
-        d_maxCSLFileSize      = rhs.d_maxCSLFileSize;
-        d_preallocate         = rhs.d_preallocate;
-        d_maxArchivedFileSets = rhs.d_maxArchivedFileSets;
-        d_prefaultPages       = rhs.d_prefaultPages;
-        d_flushAtShutdown     = rhs.d_flushAtShutdown;
-        d_syncConfig          = rhs.d_syncConfig;
+        d_numPartitions          = rhs.d_numPartitions;
+        d_location               = rhs.d_location;
+        d_archiveLocation        = rhs.d_archiveLocation;
+        d_maxDataFileSize        = rhs.d_maxDataFileSize;
+        d_maxJournalFileSize     = rhs.d_maxJournalFileSize;
+        d_maxQlistFileSize       = rhs.d_maxQlistFileSize;
+        d_maxCSLFileSize         = rhs.d_maxCSLFileSize;
+        d_preallocate            = rhs.d_preallocate;
+        d_maxArchivedFileSets    = rhs.d_maxArchivedFileSets;
+        d_prefaultPages          = rhs.d_prefaultPages;
+        d_flushAtShutdown        = rhs.d_flushAtShutdown;
+        d_syncConfig             = rhs.d_syncConfig;
+        d_writebackThreshold     = rhs.d_writebackThreshold;
+        d_groupCommitMaxBytes    = rhs.d_groupCommitMaxBytes;
+        d_groupCommitMaxRecords  = rhs.d_groupCommitMaxRecords;
+        d_groupCommitMaxDelayUs  = rhs.d_groupCommitMaxDelayUs;
+        d_recoveryThreads        = rhs.d_recoveryThreads;
+        d_recoveryCheckpoint     = rhs.d_recoveryCheckpoint;
+        d_hugePages              = rhs.d_hugePages;
+        d_residentWindowSize     = rhs.d_residentWindowSize;
+        d_precreatePercent       = rhs.d_precreatePercent;
+        d_partitionsPerProcessor = rhs.d_partitionsPerProcessor;
+        d_groupCommitAdaptive    = rhs.d_groupCommitAdaptive;
+        d_recoveryVerifyPercent  = rhs.d_recoveryVerifyPercent;
+        d_scrubIntervalMs        = rhs.d_scrubIntervalMs;
+        d_scrubMaxBytesPerSecond = rhs.d_scrubMaxBytesPerSecond;
+        d_readaheadSize          = rhs.d_readaheadSize;
+        d_dropConsumedPages      = rhs.d_dropConsumedPages;
     }
 
     return *this;
@@ -4665,18 +4993,34 @@ PartitionConfig& PartitionConfig::operator=(const PartitionConfig& rhs)
 PartitionConfig& PartitionConfig::operator=(PartitionConfig&& rhs)
 {
     if (this != &rhs) {
-        d_numPartitions       = bsl::move(rhs.d_numPartitions);
-        d_location            = bsl::move(rhs.d_location);
-        d_archiveLocation     = bsl::move(rhs.d_archiveLocation);
-        d_maxDataFileSize     = bsl::move(rhs.d_maxDataFileSize);
-        d_maxJournalFileSize  = bsl::move(rhs.d_maxJournalFileSize);
-        d_maxQlistFileSize    = bsl::move(rhs.d_maxQlistFileSize);
-        d_maxCSLFileSize      = bsl::move(rhs.d_maxCSLFileSize);
-        d_preallocate         = bsl::move(rhs.d_preallocate);
-        d_maxArchivedFileSets = bsl::move(rhs.d_maxArchivedFileSets);
-        d_prefaultPages       = bsl::move(rhs.d_prefaultPages);
-        d_flushAtShutdown     = bsl::move(rhs.d_flushAtShutdown);
-        d_syncConfig          = bsl::move(rhs.d_syncConfig);
+        d_numPartitions          = bsl::move(rhs.d_numPartitions);
+        d_location               = bsl::move(rhs.d_location);
+        d_archiveLocation        = bsl::move(rhs.d_archiveLocation);
+        d_maxDataFileSize        = bsl::move(rhs.d_maxDataFileSize);
+        d_maxJournalFileSize     = bsl::move(rhs.d_maxJournalFileSize);
+        d_maxQlistFileSize       = bsl::move(rhs.d_maxQlistFileSize);
+        d_maxCSLFileSize         = bsl::move(rhs.d_maxCSLFileSize);
+        d_preallocate            = bsl::move(rhs.d_preallocate);
+        d_maxArchivedFileSets    = bsl::move(rhs.d_maxArchivedFileSets);
+        d_prefaultPages          = bsl::move(rhs.d_prefaultPages);
+        d_flushAtShutdown        = bsl::move(rhs.d_flushAtShutdown);
+        d_syncConfig             = bsl::move(rhs.d_syncConfig);
+        d_writebackThreshold     = bsl::move(rhs.d_writebackThreshold);
+        d_groupCommitMaxBytes    = bsl::move(rhs.d_groupCommitMaxBytes);
+        d_groupCommitMaxRecords  = bsl::move(rhs.d_groupCommitMaxRecords);
+        d_groupCommitMaxDelayUs  = bsl::move(rhs.d_groupCommitMaxDelayUs);
+        d_recoveryThreads        = bsl::move(rhs.d_recoveryThreads);
+        d_recoveryCheckpoint     = bsl::move(rhs.d_recoveryCheckpoint);
+        d_hugePages              = bsl::move(rhs.d_hugePages);
+        d_residentWindowSize     = bsl::move(rhs.d_residentWindowSize);
+        d_precreatePercent       = bsl::move(rhs.d_precreatePercent);
+        d_partitionsPerProcessor = bsl::move(rhs.d_partitionsPerProcessor);
+        d_groupCommitAdaptive    = bsl::move(rhs.d_groupCommitAdaptive);
+        d_recoveryVerifyPercent  = bsl::move(rhs.d_recoveryVerifyPercent);
+        d_scrubIntervalMs        = bsl::move(rhs.d_scrubIntervalMs);
+        d_scrubMaxBytesPerSecond = bsl::move(rhs.d_scrubMaxBytesPerSecond);
+        d_readaheadSize          = bsl::move(rhs.d_readaheadSize);
+        d_dropConsumedPages      = bsl::move(rhs.d_dropConsumedPages);
     }
 
     return *this;
@@ -4697,6 +5041,22 @@ void PartitionConfig::reset()
     d_prefaultPages   = DEFAULT_INITIALIZER_PREFAULT_PAGES;
     d_flushAtShutdown = DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN;
     bdlat_ValueTypeFunctions::reset(&d_syncConfig);
+    d_writebackThreshold     = DEFAULT_INITIALIZER_WRITEBACK_THRESHOLD;
+    d_groupCommitMaxBytes    = DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES;
+    d_groupCommitMaxRecords  = DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_RECORDS;
+    d_groupCommitMaxDelayUs  = DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_DELAY_US;
+    d_recoveryThreads        = DEFAULT_INITIALIZER_RECOVERY_THREADS;
+    d_recoveryCheckpoint     = DEFAULT_INITIALIZER_RECOVERY_CHECKPOINT;
+    d_hugePages              = DEFAULT_INITIALIZER_HUGE_PAGES;
+    d_residentWindowSize     = DEFAULT_INITIALIZER_RESIDENT_WINDOW_SIZE;
+    d_precreatePercent       = DEFAULT_INITIALIZER_PRECREATE_PERCENT;
+    d_partitionsPerProcessor = DEFAULT_INITIALIZER_PARTITIONS_PER_PROCESSOR;
+    d_groupCommitAdaptive    = DEFAULT_INITIALIZER_GROUP_COMMIT_ADAPTIVE;
+    d_recoveryVerifyPercent  = DEFAULT_INITIALIZER_RECOVERY_VERIFY_PERCENT;
+    d_scrubIntervalMs        = DEFAULT_INITIALIZER_SCRUB_INTERVAL_MS;
+    d_scrubMaxBytesPerSecond = DEFAULT_INITIALIZER_SCRUB_MAX_BYTES_PER_SECOND;
+    d_readaheadSize          = DEFAULT_INITIALIZER_READAHEAD_SIZE;
+    d_dropConsumedPages      = DEFAULT_INITIALIZER_DROP_CONSUMED_PAGES;
 }
 
 // ACCESSORS
@@ -4719,6 +5079,27 @@ bsl::ostream& PartitionConfig::print(bsl::ostream& stream,
     printer.printAttribute("prefaultPages", this->prefaultPages());
     printer.printAttribute("flushAtShutdown", this->flushAtShutdown());
     printer.printAttribute("syncConfig", this->syncConfig());
+    printer.printAttribute("writebackThreshold", this->writebackThreshold());
+    printer.printAttribute("groupCommitMaxBytes", this->groupCommitMaxBytes());
+    printer.printAttribute("groupCommitMaxRecords",
+                           this->groupCommitMaxRecords());
+    printer.printAttribute("groupCommitMaxDelayUs",
+                           this->groupCommitMaxDelayUs());
+    printer.printAttribute("recoveryThreads", this->recoveryThreads());
+    printer.printAttribute("recoveryCheckpoint", this->recoveryCheckpoint());
+    printer.printAttribute("hugePages", this->hugePages());
+    printer.printAttribute("residentWindowSize", this->residentWindowSize());
+    printer.printAttribute("precreatePercent", this->precreatePercent());
+    printer.printAttribute("partitionsPerProcessor",
+                           this->partitionsPerProcessor());
+    printer.printAttribute("groupCommitAdaptive", this->groupCommitAdaptive());
+    printer.printAttribute("recoveryVerifyPercent",
+                           this->recoveryVerifyPercent());
+    printer.printAttribute("scrubIntervalMs", this->scrubIntervalMs());
+    printer.printAttribute("scrubMaxBytesPerSecond",
+                           this->scrubMaxBytesPerSecond());
+    printer.printAttribute("readaheadSize", this->readaheadSize());
+    printer.printAttribute("dropConsumedPages", this->dropConsumedPages());
     printer.end();
     return stream;
 }
@@ -5229,6 +5610,8 @@ const bsls::Types::Int64
 
 const int TcpInterfaceConfig::DEFAULT_INITIALIZER_HEARTBEAT_INTERVAL_MS = 3000;
 
+const char TcpInterfaceConfig::DEFAULT_INITIALIZER_EVENT_CAPTURE_FILE[] = "";
+
 const bdlat_AttributeInfo TcpInterfaceConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NAME,
      "name",
@@ -5279,14 +5662,19 @@ const bdlat_AttributeInfo TcpInterfaceConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "listeners",
      sizeof("listeners") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_EVENT_CAPTURE_FILE,
+     "eventCaptureFile",
+     sizeof("eventCaptureFile") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 TcpInterfaceConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 10; ++i) {
+    for (int i = 0; i < 11; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             TcpInterfaceConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -5320,6 +5708,8 @@ const bdlat_AttributeInfo* TcpInterfaceConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HEARTBEAT_INTERVAL_MS];
     case ATTRIBUTE_ID_LISTENERS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LISTENERS];
+    case ATTRIBUTE_ID_EVENT_CAPTURE_FILE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_EVENT_CAPTURE_FILE];
     default: return 0;
     }
 }
@@ -5333,6 +5723,7 @@ TcpInterfaceConfig::TcpInterfaceConfig(bslma::Allocator* basicAllocator)
 , d_nodeHighWatermark(DEFAULT_INITIALIZER_NODE_HIGH_WATERMARK)
 , d_listeners(basicAllocator)
 , d_name(basicAllocator)
+, d_eventCaptureFile(DEFAULT_INITIALIZER_EVENT_CAPTURE_FILE, basicAllocator)
 , d_port()
 , d_ioThreads()
 , d_maxConnections(DEFAULT_INITIALIZER_MAX_CONNECTIONS)
@@ -5348,6 +5739,7 @@ TcpInterfaceConfig::TcpInterfaceConfig(const TcpInterfaceConfig& original,
 , d_nodeHighWatermark(original.d_nodeHighWatermark)
 , d_listeners(original.d_listeners, basicAllocator)
 , d_name(original.d_name, basicAllocator)
+, d_eventCaptureFile(original.d_eventCaptureFile, basicAllocator)
 , d_port(original.d_port)
 , d_ioThreads(original.d_ioThreads)
 , d_maxConnections(original.d_maxConnections)
@@ -5364,6 +5756,7 @@ TcpInterfaceConfig::TcpInterfaceConfig(TcpInterfaceConfig&& original) noexcept
   d_nodeHighWatermark(bsl::move(original.d_nodeHighWatermark)),
   d_listeners(bsl::move(original.d_listeners)),
   d_name(bsl::move(original.d_name)),
+  d_eventCaptureFile(bsl::move(original.d_eventCaptureFile)),
   d_port(bsl::move(original.d_port)),
   d_ioThreads(bsl::move(original.d_ioThreads)),
   d_maxConnections(bsl::move(original.d_maxConnections)),
@@ -5379,6 +5772,7 @@ TcpInterfaceConfig::TcpInterfaceConfig(TcpInterfaceConfig&& original,
 , d_nodeHighWatermark(bsl::move(original.d_nodeHighWatermark))
 , d_listeners(bsl::move(original.d_listeners), basicAllocator)
 , d_name(bsl::move(original.d_name), basicAllocator)
+, d_eventCaptureFile(bsl::move(original.d_eventCaptureFile), basicAllocator)
 , d_port(bsl::move(original.d_port))
 , d_ioThreads(bsl::move(original.d_ioThreads))
 , d_maxConnections(bsl::move(original.d_maxConnections))
@@ -5407,6 +5801,7 @@ TcpInterfaceConfig::operator=(const TcpInterfaceConfig& rhs)
         d_nodeHighWatermark   = rhs.d_nodeHighWatermark;
         d_heartbeatIntervalMs = rhs.d_heartbeatIntervalMs;
         d_listeners           = rhs.d_listeners;
+        d_eventCaptureFile    = rhs.d_eventCaptureFile;
     }
 
     return *this;
@@ -5427,6 +5822,7 @@ TcpInterfaceConfig& TcpInterfaceConfig::operator=(TcpInterfaceConfig&& rhs)
         d_nodeHighWatermark   = bsl::move(rhs.d_nodeHighWatermark);
         d_heartbeatIntervalMs = bsl::move(rhs.d_heartbeatIntervalMs);
         d_listeners           = bsl::move(rhs.d_listeners);
+        d_eventCaptureFile    = bsl::move(rhs.d_eventCaptureFile);
     }
 
     return *this;
@@ -5445,6 +5841,7 @@ void TcpInterfaceConfig::reset()
     d_nodeHighWatermark   = DEFAULT_INITIALIZER_NODE_HIGH_WATERMARK;
     d_heartbeatIntervalMs = DEFAULT_INITIALIZER_HEARTBEAT_INTERVAL_MS;
     bdlat_ValueTypeFunctions::reset(&d_listeners);
+    d_eventCaptureFile = DEFAULT_INITIALIZER_EVENT_CAPTURE_FILE;
 }
 
 // ACCESSORS
@@ -5465,6 +5862,7 @@ bsl::ostream& TcpInterfaceConfig::print(bsl::ostream& stream,
     printer.printAttribute("nodeHighWatermark", this->nodeHighWatermark());
     printer.printAttribute("heartbeatIntervalMs", this->heartbeatIntervalMs());
     printer.printAttribute("listeners", this->listeners());
+    printer.printAttribute("eventCaptureFile", this->eventCaptureFile());
     printer.end();
     return stream;
 }
@@ -6671,6 +7069,8 @@ const int AuthenticatorConfig::DEFAULT_INITIALIZER_MIN_THREADS = 1;
 
 const int AuthenticatorConfig::DEFAULT_INITIALIZER_MAX_THREADS = 8;
 
+const int AuthenticatorConfig::DEFAULT_INITIALIZER_CACHE_TIMEOUT_MS = 0;
+
 const bdlat_AttributeInfo AuthenticatorConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_AUTHENTICATORS,
      "authenticators",
@@ -6696,14 +7096,19 @@ const bdlat_AttributeInfo AuthenticatorConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "credentialProvider",
      sizeof("credentialProvider") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_CACHE_TIMEOUT_MS,
+     "cacheTimeoutMs",
+     sizeof("cacheTimeoutMs") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 AuthenticatorConfig::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 5; ++i) {
+    for (int i = 0; i < 6; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             AuthenticatorConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -6729,6 +7134,8 @@ const bdlat_AttributeInfo* AuthenticatorConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_THREADS];
     case ATTRIBUTE_ID_CREDENTIAL_PROVIDER:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CREDENTIAL_PROVIDER];
+    case ATTRIBUTE_ID_CACHE_TIMEOUT_MS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CACHE_TIMEOUT_MS];
     default: return 0;
     }
 }
@@ -6741,6 +7148,7 @@ AuthenticatorConfig::AuthenticatorConfig(bslma::Allocator* basicAllocator)
 , d_anonymousCredential(basicAllocator)
 , d_minThreads(DEFAULT_INITIALIZER_MIN_THREADS)
 , d_maxThreads(DEFAULT_INITIALIZER_MAX_THREADS)
+, d_cacheTimeoutMs(DEFAULT_INITIALIZER_CACHE_TIMEOUT_MS)
 {
 }
 
@@ -6751,6 +7159,7 @@ AuthenticatorConfig::AuthenticatorConfig(const AuthenticatorConfig& original,
 , d_anonymousCredential(original.d_anonymousCredential, basicAllocator)
 , d_minThreads(original.d_minThreads)
 , d_maxThreads(original.d_maxThreads)
+, d_cacheTimeoutMs(original.d_cacheTimeoutMs)
 {
 }
 
@@ -6762,7 +7171,8 @@ AuthenticatorConfig::AuthenticatorConfig(
   d_credentialProvider(bsl::move(original.d_credentialProvider)),
   d_anonymousCredential(bsl::move(original.d_anonymousCredential)),
   d_minThreads(bsl::move(original.d_minThreads)),
-  d_maxThreads(bsl::move(original.d_maxThreads))
+  d_maxThreads(bsl::move(original.d_maxThreads)),
+  d_cacheTimeoutMs(bsl::move(original.d_cacheTimeoutMs))
 {
 }
 
@@ -6775,6 +7185,7 @@ AuthenticatorConfig::AuthenticatorConfig(AuthenticatorConfig&& original,
                         basicAllocator)
 , d_minThreads(bsl::move(original.d_minThreads))
 , d_maxThreads(bsl::move(original.d_maxThreads))
+, d_cacheTimeoutMs(bsl::move(original.d_cacheTimeoutMs))
 {
 }
 #endif
@@ -6794,6 +7205,7 @@ AuthenticatorConfig::operator=(const AuthenticatorConfig& rhs)
         d_minThreads          = rhs.d_minThreads;
         d_maxThreads          = rhs.d_maxThreads;
         d_credentialProvider  = rhs.d_credentialProvider;
+        d_cacheTimeoutMs      = rhs.d_cacheTimeoutMs;
     }
 
     return *this;
@@ -6809,6 +7221,7 @@ AuthenticatorConfig& AuthenticatorConfig::operator=(AuthenticatorConfig&& rhs)
         d_minThreads          = bsl::move(rhs.d_minThreads);
         d_maxThreads          = bsl::move(rhs.d_maxThreads);
         d_credentialProvider  = bsl::move(rhs.d_credentialProvider);
+        d_cacheTimeoutMs      = bsl::move(rhs.d_cacheTimeoutMs);
     }
 
     return *this;
@@ -6822,6 +7235,7 @@ void AuthenticatorConfig::reset()
     d_minThreads = DEFAULT_INITIALIZER_MIN_THREADS;
     d_maxThreads = DEFAULT_INITIALIZER_MAX_THREADS;
     bdlat_ValueTypeFunctions::reset(&d_credentialProvider);
+    d_cacheTimeoutMs = DEFAULT_INITIALIZER_CACHE_TIMEOUT_MS;
 }
 
 // ACCESSORS
@@ -6837,6 +7251,7 @@ bsl::ostream& AuthenticatorConfig::print(bsl::ostream& stream,
     printer.printAttribute("minThreads", this->minThreads());
     printer.printAttribute("maxThreads", this->maxThreads());
     printer.printAttribute("credentialProvider", this->credentialProvider());
+    printer.printAttribute("cacheTimeoutMs", this->cacheTimeoutMs());
     printer.end();
     return stream;
 }
@@ -7198,6 +7613,9 @@ bsl::ostream& ClusterDefinition::print(bsl::ostream& stream,
 
 const char ClusterProxyDefinition::CLASS_NAME[] = "ClusterProxyDefinition";
 
+const int
+    ClusterProxyDefinition::DEFAULT_INITIALIZER_NUM_UPSTREAM_CONNECTIONS = 1;
+
 const bdlat_AttributeInfo ClusterProxyDefinition::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NAME,
      "name",
@@ -7223,14 +7641,19 @@ const bdlat_AttributeInfo ClusterProxyDefinition::ATTRIBUTE_INFO_ARRAY[] = {
      "messageThrottleConfig",
      sizeof("messageThrottleConfig") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_NUM_UPSTREAM_CONNECTIONS,
+     "numUpstreamConnections",
+     sizeof("numUpstreamConnections") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 ClusterProxyDefinition::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 5; ++i) {
+    for (int i = 0; i < 6; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             ClusterProxyDefinition::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -7255,6 +7678,8 @@ const bdlat_AttributeInfo* ClusterProxyDefinition::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CLUSTER_MONITOR_CONFIG];
     case ATTRIBUTE_ID_MESSAGE_THROTTLE_CONFIG:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MESSAGE_THROTTLE_CONFIG];
+    case ATTRIBUTE_ID_NUM_UPSTREAM_CONNECTIONS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_UPSTREAM_CONNECTIONS];
     default: return 0;
     }
 }
@@ -7268,6 +7693,7 @@ ClusterProxyDefinition::ClusterProxyDefinition(
 , d_queueOperations()
 , d_messageThrottleConfig()
 , d_clusterMonitorConfig()
+, d_numUpstreamConnections(DEFAULT_INITIALIZER_NUM_UPSTREAM_CONNECTIONS)
 {
 }
 
@@ -7279,6 +7705,7 @@ ClusterProxyDefinition::ClusterProxyDefinition(
 , d_queueOperations(original.d_queueOperations)
 , d_messageThrottleConfig(original.d_messageThrottleConfig)
 , d_clusterMonitorConfig(original.d_clusterMonitorConfig)
+, d_numUpstreamConnections(original.d_numUpstreamConnections)
 {
 }
 
@@ -7290,7 +7717,8 @@ ClusterProxyDefinition::ClusterProxyDefinition(
   d_name(bsl::move(original.d_name)),
   d_queueOperations(bsl::move(original.d_queueOperations)),
   d_messageThrottleConfig(bsl::move(original.d_messageThrottleConfig)),
-  d_clusterMonitorConfig(bsl::move(original.d_clusterMonitorConfig))
+  d_clusterMonitorConfig(bsl::move(original.d_clusterMonitorConfig)),
+  d_numUpstreamConnections(bsl::move(original.d_numUpstreamConnections))
 {
 }
 
@@ -7302,6 +7730,7 @@ ClusterProxyDefinition::ClusterProxyDefinition(
 , d_queueOperations(bsl::move(original.d_queueOperations))
 , d_messageThrottleConfig(bsl::move(original.d_messageThrottleConfig))
 , d_clusterMonitorConfig(bsl::move(original.d_clusterMonitorConfig))
+, d_numUpstreamConnections(bsl::move(original.d_numUpstreamConnections))
 {
 }
 #endif
@@ -7316,11 +7745,12 @@ ClusterProxyDefinition&
 ClusterProxyDefinition::operator=(const ClusterProxyDefinition& rhs)
 {
     if (this != &rhs) {
-        d_name                  = rhs.d_name;
-        d_nodes                 = rhs.d_nodes;
-        d_queueOperations       = rhs.d_queueOperations;
-        d_clusterMonitorConfig  = rhs.d_clusterMonitorConfig;
-        d_messageThrottleConfig = rhs.d_messageThrottleConfig;
+        d_name                   = rhs.d_name;
+        d_nodes                  = rhs.d_nodes;
+        d_queueOperations        = rhs.d_queueOperations;
+        d_clusterMonitorConfig   = rhs.d_clusterMonitorConfig;
+        d_messageThrottleConfig  = rhs.d_messageThrottleConfig;
+        d_numUpstreamConnections = rhs.d_numUpstreamConnections;
     }
 
     return *this;
@@ -7332,11 +7762,12 @@ ClusterProxyDefinition&
 ClusterProxyDefinition::operator=(ClusterProxyDefinition&& rhs)
 {
     if (this != &rhs) {
-        d_name                  = bsl::move(rhs.d_name);
-        d_nodes                 = bsl::move(rhs.d_nodes);
-        d_queueOperations       = bsl::move(rhs.d_queueOperations);
-        d_clusterMonitorConfig  = bsl::move(rhs.d_clusterMonitorConfig);
-        d_messageThrottleConfig = bsl::move(rhs.d_messageThrottleConfig);
+        d_name                   = bsl::move(rhs.d_name);
+        d_nodes                  = bsl::move(rhs.d_nodes);
+        d_queueOperations        = bsl::move(rhs.d_queueOperations);
+        d_clusterMonitorConfig   = bsl::move(rhs.d_clusterMonitorConfig);
+        d_messageThrottleConfig  = bsl::move(rhs.d_messageThrottleConfig);
+        d_numUpstreamConnections = bsl::move(rhs.d_numUpstreamConnections);
     }
 
     return *this;
@@ -7350,6 +7781,7 @@ void ClusterProxyDefinition::reset()
     bdlat_ValueTypeFunctions::reset(&d_queueOperations);
     bdlat_ValueTypeFunctions::reset(&d_clusterMonitorConfig);
     bdlat_ValueTypeFunctions::reset(&d_messageThrottleConfig);
+    d_numUpstreamConnections = DEFAULT_INITIALIZER_NUM_UPSTREAM_CONNECTIONS;
 }
 
 // ACCESSORS
@@ -7367,6 +7799,8 @@ bsl::ostream& ClusterProxyDefinition::print(bsl::ostream& stream,
                            this->clusterMonitorConfig());
     printer.printAttribute("messageThrottleConfig",
                            this->messageThrottleConfig());
+    printer.printAttribute("numUpstreamConnections",
+                           this->numUpstreamConnections());
     printer.end();
     return stream;
 }
@@ -7533,6 +7967,15 @@ const bool AppConfig::DEFAULT_INITIALIZER_ADVERTISE_SUBSCRIPTIONS = false;
 
 const int AppConfig::DEFAULT_INITIALIZER_ROUTE_COMMAND_TIMEOUT_MS = 3000;
 
+const bool AppConfig::DEFAULT_INITIALIZER_ADVERTISE_COMPRESSION_ALGORITHMS =
+    false;
+
+const bool AppConfig::DEFAULT_INITIALIZER_ADVERTISE_TRACE_CONTEXT =
+    false;
+
+const bool AppConfig::DEFAULT_INITIALIZER_DISPATCHER_CPU_ACCOUNTING =
+    false;
+
 const bdlat_AttributeInfo AppConfig::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_BROKER_INSTANCE_NAME,
      "brokerInstanceName",
@@ -7638,14 +8081,29 @@ const bdlat_AttributeInfo AppConfig::ATTRIBUTE_INFO_ARRAY[] = {
      "tlsConfig",
      sizeof("tlsConfig") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_ADVERTISE_COMPRESSION_ALGORITHMS,
+     "advertiseCompressionAlgorithms",
+     sizeof("advertiseCompressionAlgorithms") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_ADVERTISE_TRACE_CONTEXT,
+     "advertiseTraceContext",
+     sizeof("advertiseTraceContext") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_DISPATCHER_CPU_ACCOUNTING,
+     "dispatcherCpuAccounting",
+     sizeof("dispatcherCpuAccounting") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo* AppConfig::lookupAttributeInfo(const char* name,
                                                           int nameLength)
 {
-    for (int i = 0; i < 21; ++i) {
+    for (int i = 0; i < 22; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             AppConfig::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -7703,6 +8161,12 @@ const bdlat_AttributeInfo* AppConfig::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_AUTHORIZATION];
     case ATTRIBUTE_ID_TLS_CONFIG:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TLS_CONFIG];
+    case ATTRIBUTE_ID_ADVERTISE_COMPRESSION_ALGORITHMS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADVERTISE_COMPRESSION_ALGORITHMS];
+    case ATTRIBUTE_ID_ADVERTISE_TRACE_CONTEXT:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADVERTISE_TRACE_CONTEXT];
+    case ATTRIBUTE_ID_DISPATCHER_CPU_ACCOUNTING:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DISPATCHER_CPU_ACCOUNTING];
     default: return 0;
     }
 }
@@ -7732,6 +8196,9 @@ AppConfig::AppConfig(bslma::Allocator* basicAllocator)
 , d_routeCommandTimeoutMs(DEFAULT_INITIALIZER_ROUTE_COMMAND_TIMEOUT_MS)
 , d_configureStream(DEFAULT_INITIALIZER_CONFIGURE_STREAM)
 , d_advertiseSubscriptions(DEFAULT_INITIALIZER_ADVERTISE_SUBSCRIPTIONS)
+, d_advertiseCompressionAlgorithms(DEFAULT_INITIALIZER_ADVERTISE_COMPRESSION_ALGORITHMS)
+, d_advertiseTraceContext(DEFAULT_INITIALIZER_ADVERTISE_TRACE_CONTEXT)
+, d_dispatcherCpuAccounting(DEFAULT_INITIALIZER_DISPATCHER_CPU_ACCOUNTING)
 {
 }
 
@@ -7758,6 +8225,9 @@ AppConfig::AppConfig(const AppConfig&  original,
 , d_routeCommandTimeoutMs(original.d_routeCommandTimeoutMs)
 , d_configureStream(original.d_configureStream)
 , d_advertiseSubscriptions(original.d_advertiseSubscriptions)
+, d_advertiseCompressionAlgorithms(original.d_advertiseCompressionAlgorithms)
+, d_advertiseTraceContext(original.d_advertiseTraceContext)
+, d_dispatcherCpuAccounting(original.d_dispatcherCpuAccounting)
 {
 }
 
@@ -7784,7 +8254,10 @@ AppConfig::AppConfig(AppConfig&& original) noexcept
   d_logsObserverMaxSize(bsl::move(original.d_logsObserverMaxSize)),
   d_routeCommandTimeoutMs(bsl::move(original.d_routeCommandTimeoutMs)),
   d_configureStream(bsl::move(original.d_configureStream)),
-  d_advertiseSubscriptions(bsl::move(original.d_advertiseSubscriptions))
+  d_advertiseSubscriptions(bsl::move(original.d_advertiseSubscriptions)),
+  d_advertiseCompressionAlgorithms(bsl::move(original.d_advertiseCompressionAlgorithms)),
+  d_advertiseTraceContext(bsl::move(original.d_advertiseTraceContext)),
+  d_dispatcherCpuAccounting(bsl::move(original.d_dispatcherCpuAccounting))
 {
 }
 
@@ -7811,7 +8284,10 @@ AppConfig::AppConfig(AppConfig&& original, bslma::Allocator* basicAllocator)
 , d_logsObserverMaxSize(bsl::move(original.d_logsObserverMaxSize))
 , d_routeCommandTimeoutMs(bsl::move(original.d_routeCommandTimeoutMs))
 , d_configureStream(bsl::move(original.d_configureStream))
-, d_advertiseSubscriptions(bsl::move(original.d_advertiseSubscriptions))
+, d_advertiseSubscriptions(bsl::move(original.d_advertiseSubscriptions)),
+  d_advertiseCompressionAlgorithms(bsl::move(original.d_advertiseCompressionAlgorithms)),
+  d_advertiseTraceContext(bsl::move(original.d_advertiseTraceContext)),
+  d_dispatcherCpuAccounting(bsl::move(original.d_dispatcherCpuAccounting))
 {
 }
 #endif
@@ -7825,27 +8301,30 @@ AppConfig::~AppConfig()
 AppConfig& AppConfig::operator=(const AppConfig& rhs)
 {
     if (this != &rhs) {
-        d_brokerInstanceName     = rhs.d_brokerInstanceName;
-        d_brokerVersion          = rhs.d_brokerVersion;
-        d_configVersion          = rhs.d_configVersion;
-        d_etcDir                 = rhs.d_etcDir;
-        d_hostName               = rhs.d_hostName;
-        d_hostTags               = rhs.d_hostTags;
-        d_hostDataCenter         = rhs.d_hostDataCenter;
-        d_logsObserverMaxSize    = rhs.d_logsObserverMaxSize;
-        d_latencyMonitorDomain   = rhs.d_latencyMonitorDomain;
-        d_dispatcherConfig       = rhs.d_dispatcherConfig;
-        d_stats                  = rhs.d_stats;
-        d_networkInterfaces      = rhs.d_networkInterfaces;
-        d_bmqconfConfig          = rhs.d_bmqconfConfig;
-        d_plugins                = rhs.d_plugins;
-        d_messagePropertiesV2    = rhs.d_messagePropertiesV2;
-        d_configureStream        = rhs.d_configureStream;
-        d_advertiseSubscriptions = rhs.d_advertiseSubscriptions;
-        d_routeCommandTimeoutMs  = rhs.d_routeCommandTimeoutMs;
-        d_authentication         = rhs.d_authentication;
-        d_authorization          = rhs.d_authorization;
-        d_tlsConfig              = rhs.d_tlsConfig;
+        d_brokerInstanceName             = rhs.d_brokerInstanceName;
+        d_brokerVersion                  = rhs.d_brokerVersion;
+        d_configVersion                  = rhs.d_configVersion;
+        d_etcDir                         = rhs.d_etcDir;
+        d_hostName                       = rhs.d_hostName;
+        d_hostTags                       = rhs.d_hostTags;
+        d_hostDataCenter                 = rhs.d_hostDataCenter;
+        d_logsObserverMaxSize            = rhs.d_logsObserverMaxSize;
+        d_latencyMonitorDomain           = rhs.d_latencyMonitorDomain;
+        d_dispatcherConfig               = rhs.d_dispatcherConfig;
+        d_stats                          = rhs.d_stats;
+        d_networkInterfaces              = rhs.d_networkInterfaces;
+        d_bmqconfConfig                  = rhs.d_bmqconfConfig;
+        d_plugins                        = rhs.d_plugins;
+        d_messagePropertiesV2            = rhs.d_messagePropertiesV2;
+        d_configureStream                = rhs.d_configureStream;
+        d_advertiseSubscriptions         = rhs.d_advertiseSubscriptions;
+        d_routeCommandTimeoutMs          = rhs.d_routeCommandTimeoutMs;
+        d_authentication                 = rhs.d_authentication;
+        d_authorization                  = rhs.d_authorization;
+        d_tlsConfig                      = rhs.d_tlsConfig;
+        d_advertiseCompressionAlgorithms = rhs.d_advertiseCompressionAlgorithms;
+        d_advertiseTraceContext = rhs.d_advertiseTraceContext;
+        d_dispatcherCpuAccounting = rhs.d_dispatcherCpuAccounting;
     }
 
     return *this;
@@ -7856,27 +8335,30 @@ AppConfig& AppConfig::operator=(const AppConfig& rhs)
 AppConfig& AppConfig::operator=(AppConfig&& rhs)
 {
     if (this != &rhs) {
-        d_brokerInstanceName     = bsl::move(rhs.d_brokerInstanceName);
-        d_brokerVersion          = bsl::move(rhs.d_brokerVersion);
-        d_configVersion          = bsl::move(rhs.d_configVersion);
-        d_etcDir                 = bsl::move(rhs.d_etcDir);
-        d_hostName               = bsl::move(rhs.d_hostName);
-        d_hostTags               = bsl::move(rhs.d_hostTags);
-        d_hostDataCenter         = bsl::move(rhs.d_hostDataCenter);
-        d_logsObserverMaxSize    = bsl::move(rhs.d_logsObserverMaxSize);
-        d_latencyMonitorDomain   = bsl::move(rhs.d_latencyMonitorDomain);
-        d_dispatcherConfig       = bsl::move(rhs.d_dispatcherConfig);
-        d_stats                  = bsl::move(rhs.d_stats);
-        d_networkInterfaces      = bsl::move(rhs.d_networkInterfaces);
-        d_bmqconfConfig          = bsl::move(rhs.d_bmqconfConfig);
-        d_plugins                = bsl::move(rhs.d_plugins);
-        d_messagePropertiesV2    = bsl::move(rhs.d_messagePropertiesV2);
-        d_configureStream        = bsl::move(rhs.d_configureStream);
-        d_advertiseSubscriptions = bsl::move(rhs.d_advertiseSubscriptions);
-        d_routeCommandTimeoutMs  = bsl::move(rhs.d_routeCommandTimeoutMs);
-        d_authentication         = bsl::move(rhs.d_authentication);
-        d_authorization          = bsl::move(rhs.d_authorization);
-        d_tlsConfig              = bsl::move(rhs.d_tlsConfig);
+        d_brokerInstanceName             = bsl::move(rhs.d_brokerInstanceName);
+        d_brokerVersion                  = bsl::move(rhs.d_brokerVersion);
+        d_configVersion                  = bsl::move(rhs.d_configVersion);
+        d_etcDir                         = bsl::move(rhs.d_etcDir);
+        d_hostName                       = bsl::move(rhs.d_hostName);
+        d_hostTags                       = bsl::move(rhs.d_hostTags);
+        d_hostDataCenter                 = bsl::move(rhs.d_hostDataCenter);
+        d_logsObserverMaxSize            = bsl::move(rhs.d_logsObserverMaxSize);
+        d_latencyMonitorDomain           = bsl::move(rhs.d_latencyMonitorDomain);
+        d_dispatcherConfig               = bsl::move(rhs.d_dispatcherConfig);
+        d_stats                          = bsl::move(rhs.d_stats);
+        d_networkInterfaces              = bsl::move(rhs.d_networkInterfaces);
+        d_bmqconfConfig                  = bsl::move(rhs.d_bmqconfConfig);
+        d_plugins                        = bsl::move(rhs.d_plugins);
+        d_messagePropertiesV2            = bsl::move(rhs.d_messagePropertiesV2);
+        d_configureStream                = bsl::move(rhs.d_configureStream);
+        d_advertiseSubscriptions         = bsl::move(rhs.d_advertiseSubscriptions);
+        d_routeCommandTimeoutMs          = bsl::move(rhs.d_routeCommandTimeoutMs);
+        d_authentication                 = bsl::move(rhs.d_authentication);
+        d_authorization                  = bsl::move(rhs.d_authorization);
+        d_tlsConfig                      = bsl::move(rhs.d_tlsConfig);
+        d_advertiseCompressionAlgorithms = bsl::move(rhs.d_advertiseCompressionAlgorithms);
+        d_advertiseTraceContext = bsl::move(rhs.d_advertiseTraceContext);
+        d_dispatcherCpuAccounting = bsl::move(rhs.d_dispatcherCpuAccounting);
     }
 
     return *this;
@@ -7906,6 +8388,9 @@ void AppConfig::reset()
     bdlat_ValueTypeFunctions::reset(&d_authentication);
     bdlat_ValueTypeFunctions::reset(&d_authorization);
     bdlat_ValueTypeFunctions::reset(&d_tlsConfig);
+    d_advertiseCompressionAlgorithms = DEFAULT_INITIALIZER_ADVERTISE_COMPRESSION_ALGORITHMS;
+    d_advertiseTraceContext = DEFAULT_INITIALIZER_ADVERTISE_TRACE_CONTEXT;
+    d_dispatcherCpuAccounting = DEFAULT_INITIALIZER_DISPATCHER_CPU_ACCOUNTING;
 }
 
 // ACCESSORS
@@ -7939,6 +8424,12 @@ AppConfig::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("authentication", this->authentication());
     printer.printAttribute("authorization", this->authorization());
     printer.printAttribute("tlsConfig", this->tlsConfig());
+    printer.printAttribute("advertiseCompressionAlgorithms",
+                           this->advertiseCompressionAlgorithms());
+    printer.printAttribute("advertiseTraceContext",
+                           this->advertiseTraceContext());
+    printer.printAttribute("dispatcherCpuAccounting",
+                           this->dispatcherCpuAccounting());
     printer.end();
     return stream;
 }
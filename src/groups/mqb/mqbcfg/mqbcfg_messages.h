@@ -4155,26 +4155,36 @@ namespace mqbcfg {
 // class StatsPrinterEncodingFormat
 // ================================
 
-/// Bitmask of stats output encoding formats: - NONE:           no stats output
-/// (0) - TABLE:          human-readable table format (1) - JSON:
-/// machine-readable JSON format (2) - TABLE_AND_JSON: both formats (TABLE |
-/// JSON = 3)
+/// Bitmask of stats output encoding formats: - NONE:             no stats
+/// output (0) - TABLE:            human-readable table format (1) - JSON:
+/// machine-readable JSON format (2) - TABLE_AND_JSON:   both formats (TABLE |
+/// JSON = 3) - BINARY:           compact delta-encoded binary format (4) -
+/// TABLE_AND_BINARY: TABLE | BINARY = 5 - JSON_AND_BINARY:  JSON | BINARY = 6
+/// - ALL:              TABLE | JSON | BINARY = 7
 struct StatsPrinterEncodingFormat {
   public:
     // TYPES
     enum Value {
-        e_NONE           = 0,
-        e_TABLE          = 1,
-        e_JSON           = 2,
-        e_TABLE_AND_JSON = 3,
-
-        NONE           = e_NONE,
-        TABLE          = e_TABLE,
-        JSON           = e_JSON,
-        TABLE_AND_JSON = e_TABLE_AND_JSON
+        e_NONE             = 0,
+        e_TABLE            = 1,
+        e_JSON             = 2,
+        e_TABLE_AND_JSON   = 3,
+        e_BINARY           = 4,
+        e_TABLE_AND_BINARY = 5,
+        e_JSON_AND_BINARY  = 6,
+        e_ALL              = 7,
+
+        NONE             = e_NONE,
+        TABLE            = e_TABLE,
+        JSON             = e_JSON,
+        TABLE_AND_JSON   = e_TABLE_AND_JSON,
+        BINARY           = e_BINARY,
+        TABLE_AND_BINARY = e_TABLE_AND_BINARY,
+        JSON_AND_BINARY  = e_JSON_AND_BINARY,
+        ALL              = e_ALL
     };
 
-    enum { k_NUM_ENUMERATORS = 4, NUM_ENUMERATORS = k_NUM_ENUMERATORS };
+    enum { k_NUM_ENUMERATORS = 8, NUM_ENUMERATORS = k_NUM_ENUMERATORS };
 
     // CONSTANTS
     static const char CLASS_NAME[];
@@ -4277,6 +4287,10 @@ namespace mqbcfg {
 /// in bytes, to send in one go to the peer when serving a storage sync request
 /// from it partitionSyncEventSize.........: maximum size, in bytes, of
 /// bmqp::EventType::PARTITION_SYNC before we send it to the peer
+/// partitionSyncMaxBytesPerSecond.: maximum rate, in bytes per second, at
+/// which bmqp::EventType::PARTITION_SYNC events are written to a peer while
+/// serving a partition sync.  Other events to that peer are not rate-limited.
+/// A value of 0 means that partition sync is not rate-limited
 class StorageSyncConfig {
     // INSTANCE DATA
 
@@ -4289,6 +4303,7 @@ class StorageSyncConfig {
     int d_startupWaitDurationMs;
     int d_fileChunkSize;
     int d_partitionSyncEventSize;
+    int d_partitionSyncMaxBytesPerSecond;
 
     // PRIVATE ACCESSORS
 
@@ -4309,10 +4324,11 @@ class StorageSyncConfig {
         ATTRIBUTE_ID_PARTITION_SYNC_DATA_REQ_TIMEOUT_MS  = 5,
         ATTRIBUTE_ID_STARTUP_WAIT_DURATION_MS            = 6,
         ATTRIBUTE_ID_FILE_CHUNK_SIZE                     = 7,
-        ATTRIBUTE_ID_PARTITION_SYNC_EVENT_SIZE           = 8
+        ATTRIBUTE_ID_PARTITION_SYNC_EVENT_SIZE           = 8,
+        ATTRIBUTE_ID_PARTITION_SYNC_MAX_BYTES_PER_SECOND = 9
     };
 
-    enum { NUM_ATTRIBUTES = 9 };
+    enum { NUM_ATTRIBUTES = 10 };
 
     enum {
         ATTRIBUTE_INDEX_STARTUP_RECOVERY_MAX_DURATION_MS    = 0,
@@ -4323,7 +4339,8 @@ class StorageSyncConfig {
         ATTRIBUTE_INDEX_PARTITION_SYNC_DATA_REQ_TIMEOUT_MS  = 5,
         ATTRIBUTE_INDEX_STARTUP_WAIT_DURATION_MS            = 6,
         ATTRIBUTE_INDEX_FILE_CHUNK_SIZE                     = 7,
-        ATTRIBUTE_INDEX_PARTITION_SYNC_EVENT_SIZE           = 8
+        ATTRIBUTE_INDEX_PARTITION_SYNC_EVENT_SIZE           = 8,
+        ATTRIBUTE_INDEX_PARTITION_SYNC_MAX_BYTES_PER_SECOND = 9
     };
 
     // CONSTANTS
@@ -4348,6 +4365,8 @@ class StorageSyncConfig {
 
     static const int DEFAULT_INITIALIZER_PARTITION_SYNC_EVENT_SIZE;
 
+    static const int DEFAULT_INITIALIZER_PARTITION_SYNC_MAX_BYTES_PER_SECOND;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -4439,6 +4458,10 @@ class StorageSyncConfig {
     /// of this object.
     int& partitionSyncEventSize();
 
+    /// Return a reference to the modifiable "PartitionSyncMaxBytesPerSecond"
+    /// attribute of this object.
+    int& partitionSyncMaxBytesPerSecond();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -4518,6 +4541,10 @@ class StorageSyncConfig {
     /// object.
     int partitionSyncEventSize() const;
 
+    /// Return the value of the "PartitionSyncMaxBytesPerSecond" attribute of
+    /// this object.
+    int partitionSyncMaxBytesPerSecond() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -5059,14 +5086,22 @@ namespace mqbcfg {
 /// listener.
 /// name.................: A name to associate this listener to.
 /// address..............: The IPv4 address this listener will accept
-/// connections on.  port.................: The port this listener will accept
-/// connections on.  tls..................: Use TLS on this interface.
+/// connections on, or 'unix:<path>' to accept connections from clients on
+/// this host on a local (Unix domain) socket at 'path', in which case 'port'
+/// only identifies the listener and 'acceptShards' must be 1.
+/// port.................: The port this listener will accept connections on.
+/// tls..................: Use TLS on this interface.
+/// acceptShards.........: Number of listening sockets opened on this port
+/// with SO_REUSEPORT, so that the kernel spreads incoming connections (and
+/// their accept and negotiation) across IO threads.  Typically set to
+/// `ioThreads`.  1 (the default) opens a single listening socket.
 class TcpInterfaceListener {
     // INSTANCE DATA
 
     bsl::string d_name;
     bsl::string d_address;
     int         d_port;
+    int         d_acceptShards;
     bool        d_tls;
 
     // PRIVATE ACCESSORS
@@ -5080,19 +5115,21 @@ class TcpInterfaceListener {
     // TYPES
 
     enum {
-        ATTRIBUTE_ID_NAME    = 0,
-        ATTRIBUTE_ID_ADDRESS = 1,
-        ATTRIBUTE_ID_PORT    = 2,
-        ATTRIBUTE_ID_TLS     = 3
+        ATTRIBUTE_ID_NAME          = 0,
+        ATTRIBUTE_ID_ADDRESS       = 1,
+        ATTRIBUTE_ID_PORT          = 2,
+        ATTRIBUTE_ID_TLS           = 3,
+        ATTRIBUTE_ID_ACCEPT_SHARDS = 4
     };
 
-    enum { NUM_ATTRIBUTES = 4 };
+    enum { NUM_ATTRIBUTES = 5 };
 
     enum {
-        ATTRIBUTE_INDEX_NAME    = 0,
-        ATTRIBUTE_INDEX_ADDRESS = 1,
-        ATTRIBUTE_INDEX_PORT    = 2,
-        ATTRIBUTE_INDEX_TLS     = 3
+        ATTRIBUTE_INDEX_NAME          = 0,
+        ATTRIBUTE_INDEX_ADDRESS       = 1,
+        ATTRIBUTE_INDEX_PORT          = 2,
+        ATTRIBUTE_INDEX_TLS           = 3,
+        ATTRIBUTE_INDEX_ACCEPT_SHARDS = 4
     };
 
     // CONSTANTS
@@ -5103,6 +5140,8 @@ class TcpInterfaceListener {
 
     static const bool DEFAULT_INITIALIZER_TLS;
 
+    static const int DEFAULT_INITIALIZER_ACCEPT_SHARDS;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -5212,6 +5251,10 @@ class TcpInterfaceListener {
     /// Return a reference to the modifiable "Tls" attribute of this object.
     bool& tls();
 
+    /// Return a reference to the modifiable "AcceptShards" attribute of this
+    /// object.
+    int& acceptShards();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -5270,6 +5313,9 @@ class TcpInterfaceListener {
     /// Return the value of the "Tls" attribute of this object.
     bool tls() const;
 
+    /// Return the value of the "AcceptShards" attribute of this object.
+    int acceptShards() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -6308,26 +6354,41 @@ class DispatcherProcessorConfig {
 
     DispatcherProcessorParameters d_processorConfig;
     int                           d_numProcessors;
+    int                           d_maxBatchSize;
+    int                           d_firstCpu;
+    bool                          d_workStealing;
 
   public:
     // TYPES
 
     enum {
         ATTRIBUTE_ID_NUM_PROCESSORS   = 0,
-        ATTRIBUTE_ID_PROCESSOR_CONFIG = 1
+        ATTRIBUTE_ID_PROCESSOR_CONFIG = 1,
+        ATTRIBUTE_ID_WORK_STEALING    = 2,
+        ATTRIBUTE_ID_MAX_BATCH_SIZE   = 3,
+        ATTRIBUTE_ID_FIRST_CPU        = 4
     };
 
-    enum { NUM_ATTRIBUTES = 2 };
+    enum { NUM_ATTRIBUTES = 5 };
 
     enum {
         ATTRIBUTE_INDEX_NUM_PROCESSORS   = 0,
-        ATTRIBUTE_INDEX_PROCESSOR_CONFIG = 1
+        ATTRIBUTE_INDEX_PROCESSOR_CONFIG = 1,
+        ATTRIBUTE_INDEX_WORK_STEALING    = 2,
+        ATTRIBUTE_INDEX_MAX_BATCH_SIZE   = 3,
+        ATTRIBUTE_INDEX_FIRST_CPU        = 4
     };
 
     // CONSTANTS
 
     static const char CLASS_NAME[];
 
+    static const bool DEFAULT_INITIALIZER_WORK_STEALING;
+
+    static const int DEFAULT_INITIALIZER_MAX_BATCH_SIZE;
+
+    static const int DEFAULT_INITIALIZER_FIRST_CPU;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -6392,6 +6453,18 @@ class DispatcherProcessorConfig {
     /// this object.
     DispatcherProcessorParameters& processorConfig();
 
+    /// Return a reference to the modifiable "WorkStealing" attribute of this
+    /// object.
+    bool& workStealing();
+
+    /// Return a reference to the modifiable "MaxBatchSize" attribute of this
+    /// object.
+    int& maxBatchSize();
+
+    /// Return a reference to the modifiable "FirstCpu" attribute of this
+    /// object.
+    int& firstCpu();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -6443,6 +6516,15 @@ class DispatcherProcessorConfig {
     /// "ProcessorConfig" attribute of this object.
     const DispatcherProcessorParameters& processorConfig() const;
 
+    /// Return the value of the "WorkStealing" attribute of this object.
+    bool workStealing() const;
+
+    /// Return the value of the "MaxBatchSize" attribute of this object.
+    int maxBatchSize() const;
+
+    /// Return the value of the "FirstCpu" attribute of this object.
+    int firstCpu() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -6452,7 +6534,10 @@ class DispatcherProcessorConfig {
                            const DispatcherProcessorConfig& rhs)
     {
         return lhs.numProcessors() == rhs.numProcessors() &&
-               lhs.processorConfig() == rhs.processorConfig();
+               lhs.processorConfig() == rhs.processorConfig() &&
+               lhs.workStealing() == rhs.workStealing() &&
+               lhs.maxBatchSize() == rhs.maxBatchSize() &&
+               lhs.firstCpu() == rhs.firstCpu();
     }
 
     /// Return `true` if the specified `lhs` and `rhs` objects do not have the
@@ -6481,6 +6566,9 @@ class DispatcherProcessorConfig {
         using bslh::hashAppend;
         hashAppend(hashAlg, object.numProcessors());
         hashAppend(hashAlg, object.processorConfig());
+        hashAppend(hashAlg, object.workStealing());
+        hashAppend(hashAlg, object.maxBatchSize());
+        hashAppend(hashAlg, object.firstCpu());
     }
 };
 
@@ -6850,7 +6938,60 @@ namespace mqbcfg {
 /// to populate (prefault) page tables for a mapping.  flushAtShutdown......:
 /// flag to indicate whether broker should flush storage files to disk at
 /// shutdown syncConfig...........: configuration for storage synchronization
-/// and recovery
+/// and recovery writebackThreshold...: number of bytes appended to a
+/// partition's file after which the broker asynchronously initiates writeback
+/// of these bytes to disk, instead of leaving dirty pages to accumulate until
+/// the kernel throttles the partition thread.  Zero disables the asynchronous
+/// writeback groupCommitMaxBytes..: maximum size, in bytes, of the replication
+/// group commit window of a partition.  Zero means the window is only bounded
+/// by the maximum size of a replication event groupCommitMaxRecords: maximum
+/// number of records in the replication group commit window of a partition.
+/// Zero means the broker's built-in limit groupCommitMaxDelayUs: maximum time,
+/// in microseconds, records of a partition are held in the replication group
+/// commit window before being sent to the replicas.  Zero disables the group
+/// commit window: records are sent at the end of each batch of events
+/// processed by the partition recoveryThreads......: number of worker threads
+/// used to verify the payloads of a partition's outstanding messages at
+/// recovery.  Zero or one means payloads are verified by the partition thread
+/// recoveryCheckpoint...: flag to indicate whether the index of a partition's
+/// outstanding records should be checkpointed at rollover and clean shutdown,
+/// so that recovery only replays the part of the journal written after the
+/// checkpoint hugePages............: flag to indicate whether the mappings of
+/// a partition's files should be backed by transparent huge pages, where
+/// supported by the OS and the file system residentWindowSize...: number of
+/// bytes behind the write position of a partition's data and journal files
+/// whose pages are kept mapped.  Pages further behind are dropped from the
+/// mapping (they remain in the page cache and are faulted back on access), and
+/// only this many bytes ahead of the write position are prefaulted when
+/// prefaultPages is set.  Zero keeps the whole files mapped
+/// precreatePercent.....: usage, in percent of the capacity of the active data
+/// or journal file of a partition, at which the next file set is created and
+/// prefaulted in the background, so that rollover does not have to create it.
+/// Zero disables the background creation partitionsPerProcessor: number of
+/// consecutive partitions assigned to the same queue dispatcher processor.
+/// Partition `i` is served by processor `(i / partitionsPerProcessor) %
+/// numProcessors`, so that one (the default) assigns partitions to processors
+/// in a round-robin fashion groupCommitAdaptive..: flag to indicate whether
+/// the replication group commit window of a partition is flushed as soon as
+/// no other record is expected to join it within groupCommitMaxDelayUs,
+/// according to the measured arrival rate of records, instead of always being
+/// held for up to groupCommitMaxDelayUs recoveryVerifyPercent: percentage of
+/// the messages of a partition whose payload CRC32-C is verified at recovery
+/// scrubIntervalMs......: interval, in milliseconds, at which a batch of the
+/// outstanding messages of a partition have their payload CRC32-C verified by
+/// a worker thread, so that the whole partition is continuously scrubbed
+/// without blocking the partition thread.  Zero disables the scrubbing
+/// scrubMaxBytesPerSecond: maximum rate, in bytes per second, at which the
+/// outstanding messages of a partition are read by the scrubber, so that it
+/// does not compete with the broker for disk bandwidth.  Zero does not limit
+/// the rate
+/// readaheadSize........: number of bytes of a partition's data file read
+/// ahead asynchronously when a message further than this behind the write
+/// position is delivered, so that a slow consumer does not fault in each page
+/// of the messages it reaches.  Zero disables the readahead
+/// dropConsumedPages....: whether the pages of a partition's data file which
+/// only hold messages that were deleted are dropped from the page cache, so
+/// that it is left to the messages still outstanding
 class PartitionConfig {
     // INSTANCE DATA
 
@@ -6858,14 +6999,30 @@ class PartitionConfig {
     bsls::Types::Uint64 d_maxJournalFileSize;
     bsls::Types::Uint64 d_maxQlistFileSize;
     bsls::Types::Uint64 d_maxCSLFileSize;
+    bsls::Types::Uint64 d_writebackThreshold;
+    bsls::Types::Uint64 d_residentWindowSize;
+    bsls::Types::Uint64 d_readaheadSize;
     bsl::string         d_location;
     bsl::string         d_archiveLocation;
     StorageSyncConfig   d_syncConfig;
     int                 d_numPartitions;
     int                 d_maxArchivedFileSets;
+    int                 d_groupCommitMaxBytes;
+    int                 d_groupCommitMaxRecords;
+    int                 d_groupCommitMaxDelayUs;
+    int                 d_recoveryThreads;
+    int                 d_precreatePercent;
+    int                 d_partitionsPerProcessor;
+    int                 d_recoveryVerifyPercent;
+    int                 d_scrubIntervalMs;
+    int                 d_scrubMaxBytesPerSecond;
     bool                d_preallocate;
     bool                d_prefaultPages;
     bool                d_flushAtShutdown;
+    bool                d_recoveryCheckpoint;
+    bool                d_hugePages;
+    bool                d_groupCommitAdaptive;
+    bool                d_dropConsumedPages;
 
     // PRIVATE ACCESSORS
 
@@ -6878,35 +7035,67 @@ class PartitionConfig {
     // TYPES
 
     enum {
-        ATTRIBUTE_ID_NUM_PARTITIONS         = 0,
-        ATTRIBUTE_ID_LOCATION               = 1,
-        ATTRIBUTE_ID_ARCHIVE_LOCATION       = 2,
-        ATTRIBUTE_ID_MAX_DATA_FILE_SIZE     = 3,
-        ATTRIBUTE_ID_MAX_JOURNAL_FILE_SIZE  = 4,
-        ATTRIBUTE_ID_MAX_QLIST_FILE_SIZE    = 5,
-        ATTRIBUTE_ID_MAX_C_S_L_FILE_SIZE    = 6,
-        ATTRIBUTE_ID_PREALLOCATE            = 7,
-        ATTRIBUTE_ID_MAX_ARCHIVED_FILE_SETS = 8,
-        ATTRIBUTE_ID_PREFAULT_PAGES         = 9,
-        ATTRIBUTE_ID_FLUSH_AT_SHUTDOWN      = 10,
-        ATTRIBUTE_ID_SYNC_CONFIG            = 11
+        ATTRIBUTE_ID_NUM_PARTITIONS             = 0,
+        ATTRIBUTE_ID_LOCATION                   = 1,
+        ATTRIBUTE_ID_ARCHIVE_LOCATION           = 2,
+        ATTRIBUTE_ID_MAX_DATA_FILE_SIZE         = 3,
+        ATTRIBUTE_ID_MAX_JOURNAL_FILE_SIZE      = 4,
+        ATTRIBUTE_ID_MAX_QLIST_FILE_SIZE        = 5,
+        ATTRIBUTE_ID_MAX_C_S_L_FILE_SIZE        = 6,
+        ATTRIBUTE_ID_PREALLOCATE                = 7,
+        ATTRIBUTE_ID_MAX_ARCHIVED_FILE_SETS     = 8,
+        ATTRIBUTE_ID_PREFAULT_PAGES             = 9,
+        ATTRIBUTE_ID_FLUSH_AT_SHUTDOWN          = 10,
+        ATTRIBUTE_ID_SYNC_CONFIG                = 11,
+        ATTRIBUTE_ID_WRITEBACK_THRESHOLD        = 12,
+        ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES     = 13,
+        ATTRIBUTE_ID_GROUP_COMMIT_MAX_RECORDS   = 14,
+        ATTRIBUTE_ID_GROUP_COMMIT_MAX_DELAY_US  = 15,
+        ATTRIBUTE_ID_RECOVERY_THREADS           = 16,
+        ATTRIBUTE_ID_RECOVERY_CHECKPOINT        = 17,
+        ATTRIBUTE_ID_HUGE_PAGES                 = 18,
+        ATTRIBUTE_ID_RESIDENT_WINDOW_SIZE       = 19,
+        ATTRIBUTE_ID_PRECREATE_PERCENT          = 20,
+        ATTRIBUTE_ID_PARTITIONS_PER_PROCESSOR   = 21,
+        ATTRIBUTE_ID_GROUP_COMMIT_ADAPTIVE      = 22,
+        ATTRIBUTE_ID_RECOVERY_VERIFY_PERCENT    = 23,
+        ATTRIBUTE_ID_SCRUB_INTERVAL_MS          = 24,
+        ATTRIBUTE_ID_SCRUB_MAX_BYTES_PER_SECOND = 25,
+        ATTRIBUTE_ID_READAHEAD_SIZE             = 26,
+        ATTRIBUTE_ID_DROP_CONSUMED_PAGES        = 27
     };
 
-    enum { NUM_ATTRIBUTES = 12 };
+    enum { NUM_ATTRIBUTES = 28 };
 
     enum {
-        ATTRIBUTE_INDEX_NUM_PARTITIONS         = 0,
-        ATTRIBUTE_INDEX_LOCATION               = 1,
-        ATTRIBUTE_INDEX_ARCHIVE_LOCATION       = 2,
-        ATTRIBUTE_INDEX_MAX_DATA_FILE_SIZE     = 3,
-        ATTRIBUTE_INDEX_MAX_JOURNAL_FILE_SIZE  = 4,
-        ATTRIBUTE_INDEX_MAX_QLIST_FILE_SIZE    = 5,
-        ATTRIBUTE_INDEX_MAX_C_S_L_FILE_SIZE    = 6,
-        ATTRIBUTE_INDEX_PREALLOCATE            = 7,
-        ATTRIBUTE_INDEX_MAX_ARCHIVED_FILE_SETS = 8,
-        ATTRIBUTE_INDEX_PREFAULT_PAGES         = 9,
-        ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN      = 10,
-        ATTRIBUTE_INDEX_SYNC_CONFIG            = 11
+        ATTRIBUTE_INDEX_NUM_PARTITIONS             = 0,
+        ATTRIBUTE_INDEX_LOCATION                   = 1,
+        ATTRIBUTE_INDEX_ARCHIVE_LOCATION           = 2,
+        ATTRIBUTE_INDEX_MAX_DATA_FILE_SIZE         = 3,
+        ATTRIBUTE_INDEX_MAX_JOURNAL_FILE_SIZE      = 4,
+        ATTRIBUTE_INDEX_MAX_QLIST_FILE_SIZE        = 5,
+        ATTRIBUTE_INDEX_MAX_C_S_L_FILE_SIZE        = 6,
+        ATTRIBUTE_INDEX_PREALLOCATE                = 7,
+        ATTRIBUTE_INDEX_MAX_ARCHIVED_FILE_SETS     = 8,
+        ATTRIBUTE_INDEX_PREFAULT_PAGES             = 9,
+        ATTRIBUTE_INDEX_FLUSH_AT_SHUTDOWN          = 10,
+        ATTRIBUTE_INDEX_SYNC_CONFIG                = 11,
+        ATTRIBUTE_INDEX_WRITEBACK_THRESHOLD        = 12,
+        ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES     = 13,
+        ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_RECORDS   = 14,
+        ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_DELAY_US  = 15,
+        ATTRIBUTE_INDEX_RECOVERY_THREADS           = 16,
+        ATTRIBUTE_INDEX_RECOVERY_CHECKPOINT        = 17,
+        ATTRIBUTE_INDEX_HUGE_PAGES                 = 18,
+        ATTRIBUTE_INDEX_RESIDENT_WINDOW_SIZE       = 19,
+        ATTRIBUTE_INDEX_PRECREATE_PERCENT          = 20,
+        ATTRIBUTE_INDEX_PARTITIONS_PER_PROCESSOR   = 21,
+        ATTRIBUTE_INDEX_GROUP_COMMIT_ADAPTIVE      = 22,
+        ATTRIBUTE_INDEX_RECOVERY_VERIFY_PERCENT    = 23,
+        ATTRIBUTE_INDEX_SCRUB_INTERVAL_MS          = 24,
+        ATTRIBUTE_INDEX_SCRUB_MAX_BYTES_PER_SECOND = 25,
+        ATTRIBUTE_INDEX_READAHEAD_SIZE             = 26,
+        ATTRIBUTE_INDEX_DROP_CONSUMED_PAGES        = 27
     };
 
     // CONSTANTS
@@ -6921,6 +7110,38 @@ class PartitionConfig {
 
     static const bool DEFAULT_INITIALIZER_FLUSH_AT_SHUTDOWN;
 
+    static const bsls::Types::Uint64 DEFAULT_INITIALIZER_WRITEBACK_THRESHOLD;
+
+    static const int DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_BYTES;
+
+    static const int DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_RECORDS;
+
+    static const int DEFAULT_INITIALIZER_GROUP_COMMIT_MAX_DELAY_US;
+
+    static const int DEFAULT_INITIALIZER_RECOVERY_THREADS;
+
+    static const bool DEFAULT_INITIALIZER_RECOVERY_CHECKPOINT;
+
+    static const bool DEFAULT_INITIALIZER_HUGE_PAGES;
+
+    static const bsls::Types::Uint64 DEFAULT_INITIALIZER_RESIDENT_WINDOW_SIZE;
+
+    static const int DEFAULT_INITIALIZER_PRECREATE_PERCENT;
+
+    static const int DEFAULT_INITIALIZER_PARTITIONS_PER_PROCESSOR;
+
+    static const bool DEFAULT_INITIALIZER_GROUP_COMMIT_ADAPTIVE;
+
+    static const int DEFAULT_INITIALIZER_RECOVERY_VERIFY_PERCENT;
+
+    static const int DEFAULT_INITIALIZER_SCRUB_INTERVAL_MS;
+
+    static const int DEFAULT_INITIALIZER_SCRUB_MAX_BYTES_PER_SECOND;
+
+    static const bsls::Types::Uint64 DEFAULT_INITIALIZER_READAHEAD_SIZE;
+
+    static const bool DEFAULT_INITIALIZER_DROP_CONSUMED_PAGES;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -7065,6 +7286,70 @@ class PartitionConfig {
     /// object.
     StorageSyncConfig& syncConfig();
 
+    /// Return a reference to the modifiable "WritebackThreshold" attribute of
+    /// this object.
+    bsls::Types::Uint64& writebackThreshold();
+
+    /// Return a reference to the modifiable "GroupCommitMaxBytes" attribute of
+    /// this object.
+    int& groupCommitMaxBytes();
+
+    /// Return a reference to the modifiable "GroupCommitMaxRecords" attribute
+    /// of this object.
+    int& groupCommitMaxRecords();
+
+    /// Return a reference to the modifiable "GroupCommitMaxDelayUs" attribute
+    /// of this object.
+    int& groupCommitMaxDelayUs();
+
+    /// Return a reference to the modifiable "RecoveryThreads" attribute of
+    /// this object.
+    int& recoveryThreads();
+
+    /// Return a reference to the modifiable "RecoveryCheckpoint" attribute of
+    /// this object.
+    bool& recoveryCheckpoint();
+
+    /// Return a reference to the modifiable "HugePages" attribute of this
+    /// object.
+    bool& hugePages();
+
+    /// Return a reference to the modifiable "ResidentWindowSize" attribute of
+    /// this object.
+    bsls::Types::Uint64& residentWindowSize();
+
+    /// Return a reference to the modifiable "PrecreatePercent" attribute of
+    /// this object.
+    int& precreatePercent();
+
+    /// Return a reference to the modifiable "PartitionsPerProcessor"
+    /// attribute of this object.
+    int& partitionsPerProcessor();
+
+    /// Return a reference to the modifiable "GroupCommitAdaptive" attribute
+    /// of this object.
+    bool& groupCommitAdaptive();
+
+    /// Return a reference to the modifiable "RecoveryVerifyPercent" attribute
+    /// of this object.
+    int& recoveryVerifyPercent();
+
+    /// Return a reference to the modifiable "ScrubIntervalMs" attribute of
+    /// this object.
+    int& scrubIntervalMs();
+
+    /// Return a reference to the modifiable "ScrubMaxBytesPerSecond" attribute
+    /// of this object.
+    int& scrubMaxBytesPerSecond();
+
+    /// Return a reference to the modifiable "ReadaheadSize" attribute of this
+    /// object.
+    bsls::Types::Uint64& readaheadSize();
+
+    /// Return a reference to the modifiable "DropConsumedPages" attribute of
+    /// this object.
+    bool& dropConsumedPages();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -7148,6 +7433,60 @@ class PartitionConfig {
     /// attribute of this object.
     const StorageSyncConfig& syncConfig() const;
 
+    /// Return the value of the "WritebackThreshold" attribute of this object.
+    bsls::Types::Uint64 writebackThreshold() const;
+
+    /// Return the value of the "GroupCommitMaxBytes" attribute of this object.
+    int groupCommitMaxBytes() const;
+
+    /// Return the value of the "GroupCommitMaxRecords" attribute of this
+    /// object.
+    int groupCommitMaxRecords() const;
+
+    /// Return the value of the "GroupCommitMaxDelayUs" attribute of this
+    /// object.
+    int groupCommitMaxDelayUs() const;
+
+    /// Return the value of the "RecoveryThreads" attribute of this object.
+    int recoveryThreads() const;
+
+    /// Return the value of the "RecoveryCheckpoint" attribute of this object.
+    bool recoveryCheckpoint() const;
+
+    /// Return the value of the "HugePages" attribute of this object.
+    bool hugePages() const;
+
+    /// Return the value of the "ResidentWindowSize" attribute of this object.
+    bsls::Types::Uint64 residentWindowSize() const;
+
+    /// Return the value of the "PrecreatePercent" attribute of this object.
+    int precreatePercent() const;
+
+    /// Return the value of the "PartitionsPerProcessor" attribute of this
+    /// object.
+    int partitionsPerProcessor() const;
+
+    /// Return the value of the "GroupCommitAdaptive" attribute of this
+    /// object.
+    bool groupCommitAdaptive() const;
+
+    /// Return the value of the "RecoveryVerifyPercent" attribute of this
+    /// object.
+    int recoveryVerifyPercent() const;
+
+    /// Return the value of the "ScrubIntervalMs" attribute of this object.
+    int scrubIntervalMs() const;
+
+    /// Return the value of the "ScrubMaxBytesPerSecond" attribute of this
+    /// object.
+    int scrubMaxBytesPerSecond() const;
+
+    /// Return the value of the "ReadaheadSize" attribute of this object.
+    bsls::Types::Uint64 readaheadSize() const;
+
+    /// Return the value of the "DropConsumedPages" attribute of this object.
+    bool dropConsumedPages() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -7984,7 +8323,11 @@ namespace mqbcfg {
 /// milliseconds) to check if the channel received data, and emit heartbeat.  0
 /// to globally disable.  listeners: A list of listener interfaces to receive
 /// TCP connections from.  When non-empty this option overrides the listener
-/// specified by port.
+/// specified by port.  eventCaptureFile.....: If non-empty, path of a file
+/// to which every event received on the channels of this interface is
+/// appended, with its timestamp and channel id, so that the traffic can be
+/// replayed later (e.g., with 'bmqtool --mode=replay').  Capturing has a
+/// significant cost and is meant for troubleshooting only.
 class TcpInterfaceConfig {
     // INSTANCE DATA
 
@@ -7994,6 +8337,7 @@ class TcpInterfaceConfig {
     bsls::Types::Int64                d_nodeHighWatermark;
     bsl::vector<TcpInterfaceListener> d_listeners;
     bsl::string                       d_name;
+    bsl::string                       d_eventCaptureFile;
     int                               d_port;
     int                               d_ioThreads;
     int                               d_maxConnections;
@@ -8019,10 +8363,11 @@ class TcpInterfaceConfig {
         ATTRIBUTE_ID_NODE_LOW_WATERMARK    = 6,
         ATTRIBUTE_ID_NODE_HIGH_WATERMARK   = 7,
         ATTRIBUTE_ID_HEARTBEAT_INTERVAL_MS = 8,
-        ATTRIBUTE_ID_LISTENERS             = 9
+        ATTRIBUTE_ID_LISTENERS             = 9,
+        ATTRIBUTE_ID_EVENT_CAPTURE_FILE    = 10
     };
 
-    enum { NUM_ATTRIBUTES = 10 };
+    enum { NUM_ATTRIBUTES = 11 };
 
     enum {
         ATTRIBUTE_INDEX_NAME                  = 0,
@@ -8034,7 +8379,8 @@ class TcpInterfaceConfig {
         ATTRIBUTE_INDEX_NODE_LOW_WATERMARK    = 6,
         ATTRIBUTE_INDEX_NODE_HIGH_WATERMARK   = 7,
         ATTRIBUTE_INDEX_HEARTBEAT_INTERVAL_MS = 8,
-        ATTRIBUTE_INDEX_LISTENERS             = 9
+        ATTRIBUTE_INDEX_LISTENERS             = 9,
+        ATTRIBUTE_INDEX_EVENT_CAPTURE_FILE    = 10
     };
 
     // CONSTANTS
@@ -8049,6 +8395,8 @@ class TcpInterfaceConfig {
 
     static const int DEFAULT_INITIALIZER_HEARTBEAT_INTERVAL_MS;
 
+    static const char DEFAULT_INITIALIZER_EVENT_CAPTURE_FILE[];
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -8183,6 +8531,10 @@ class TcpInterfaceConfig {
     /// object.
     bsl::vector<TcpInterfaceListener>& listeners();
 
+    /// Return a reference to the modifiable "EventCaptureFile" attribute of
+    /// this object.
+    bsl::string& eventCaptureFile();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -8259,6 +8611,10 @@ class TcpInterfaceConfig {
     /// attribute of this object.
     const bsl::vector<TcpInterfaceListener>& listeners() const;
 
+    /// Return a reference offering non-modifiable access to the
+    /// "EventCaptureFile" attribute of this object.
+    const bsl::string& eventCaptureFile() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -10325,7 +10681,11 @@ namespace mqbcfg {
 /// provider.  When specified, the broker uses credentials provided by the
 /// credential provider to authenticate with other brokers.  If not specified,
 /// the broker will attempt to directly negotiate sessions with other brokers
-/// without explicitly authenticating.
+/// without explicitly authenticating.  cacheTimeoutMs.......: How long (in
+/// milliseconds) a successful authentication result is reused for an
+/// identical credential, without calling the authenticator plugin again.  This
+/// is capped by the lifetime of the result, if any.  0 (the default) disables
+/// the cache.
 class AuthenticatorConfig {
     // INSTANCE DATA
 
@@ -10334,6 +10694,7 @@ class AuthenticatorConfig {
     bdlb::NullableValue<AnonymousCredential>      d_anonymousCredential;
     int                                           d_minThreads;
     int                                           d_maxThreads;
+    int                                           d_cacheTimeoutMs;
 
     // PRIVATE ACCESSORS
 
@@ -10350,17 +10711,19 @@ class AuthenticatorConfig {
         ATTRIBUTE_ID_ANONYMOUS_CREDENTIAL = 1,
         ATTRIBUTE_ID_MIN_THREADS          = 2,
         ATTRIBUTE_ID_MAX_THREADS          = 3,
-        ATTRIBUTE_ID_CREDENTIAL_PROVIDER  = 4
+        ATTRIBUTE_ID_CREDENTIAL_PROVIDER  = 4,
+        ATTRIBUTE_ID_CACHE_TIMEOUT_MS     = 5
     };
 
-    enum { NUM_ATTRIBUTES = 5 };
+    enum { NUM_ATTRIBUTES = 6 };
 
     enum {
         ATTRIBUTE_INDEX_AUTHENTICATORS       = 0,
         ATTRIBUTE_INDEX_ANONYMOUS_CREDENTIAL = 1,
         ATTRIBUTE_INDEX_MIN_THREADS          = 2,
         ATTRIBUTE_INDEX_MAX_THREADS          = 3,
-        ATTRIBUTE_INDEX_CREDENTIAL_PROVIDER  = 4
+        ATTRIBUTE_INDEX_CREDENTIAL_PROVIDER  = 4,
+        ATTRIBUTE_INDEX_CACHE_TIMEOUT_MS     = 5
     };
 
     // CONSTANTS
@@ -10371,6 +10734,8 @@ class AuthenticatorConfig {
 
     static const int DEFAULT_INITIALIZER_MAX_THREADS;
 
+    static const int DEFAULT_INITIALIZER_CACHE_TIMEOUT_MS;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -10487,6 +10852,10 @@ class AuthenticatorConfig {
     /// this object.
     bdlb::NullableValue<CredentialProviderConfig>& credentialProvider();
 
+    /// Return a reference to the modifiable "CacheTimeoutMs" attribute of
+    /// this object.
+    int& cacheTimeoutMs();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -10551,6 +10920,9 @@ class AuthenticatorConfig {
     const bdlb::NullableValue<CredentialProviderConfig>&
     credentialProvider() const;
 
+    /// Return the value of the "CacheTimeoutMs" attribute of this object.
+    int cacheTimeoutMs() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -11160,7 +11532,9 @@ namespace mqbcfg {
 /// nodes in the cluster queueOperations.......: configuration for queue
 /// operations with the cluster clusterMonitorConfig..: configuration for
 /// cluster state monitor messageThrottleConfig.: configuration for message
-/// throttling intervals and thresholds.
+/// throttling intervals and thresholds. numUpstreamConnections: number of
+/// parallel connections to establish to each node of the cluster, the queues
+/// being distributed across them.
 class ClusterProxyDefinition {
     // INSTANCE DATA
 
@@ -11169,6 +11543,7 @@ class ClusterProxyDefinition {
     QueueOperationsConfig    d_queueOperations;
     MessageThrottleConfig    d_messageThrottleConfig;
     ClusterMonitorConfig     d_clusterMonitorConfig;
+    int                      d_numUpstreamConnections;
 
     // PRIVATE ACCESSORS
 
@@ -11181,27 +11556,31 @@ class ClusterProxyDefinition {
     // TYPES
 
     enum {
-        ATTRIBUTE_ID_NAME                    = 0,
-        ATTRIBUTE_ID_NODES                   = 1,
-        ATTRIBUTE_ID_QUEUE_OPERATIONS        = 2,
-        ATTRIBUTE_ID_CLUSTER_MONITOR_CONFIG  = 3,
-        ATTRIBUTE_ID_MESSAGE_THROTTLE_CONFIG = 4
+        ATTRIBUTE_ID_NAME                     = 0,
+        ATTRIBUTE_ID_NODES                    = 1,
+        ATTRIBUTE_ID_QUEUE_OPERATIONS         = 2,
+        ATTRIBUTE_ID_CLUSTER_MONITOR_CONFIG   = 3,
+        ATTRIBUTE_ID_MESSAGE_THROTTLE_CONFIG  = 4,
+        ATTRIBUTE_ID_NUM_UPSTREAM_CONNECTIONS = 5
     };
 
-    enum { NUM_ATTRIBUTES = 5 };
+    enum { NUM_ATTRIBUTES = 6 };
 
     enum {
-        ATTRIBUTE_INDEX_NAME                    = 0,
-        ATTRIBUTE_INDEX_NODES                   = 1,
-        ATTRIBUTE_INDEX_QUEUE_OPERATIONS        = 2,
-        ATTRIBUTE_INDEX_CLUSTER_MONITOR_CONFIG  = 3,
-        ATTRIBUTE_INDEX_MESSAGE_THROTTLE_CONFIG = 4
+        ATTRIBUTE_INDEX_NAME                     = 0,
+        ATTRIBUTE_INDEX_NODES                    = 1,
+        ATTRIBUTE_INDEX_QUEUE_OPERATIONS         = 2,
+        ATTRIBUTE_INDEX_CLUSTER_MONITOR_CONFIG   = 3,
+        ATTRIBUTE_INDEX_MESSAGE_THROTTLE_CONFIG  = 4,
+        ATTRIBUTE_INDEX_NUM_UPSTREAM_CONNECTIONS = 5
     };
 
     // CONSTANTS
 
     static const char CLASS_NAME[];
 
+    static const int DEFAULT_INITIALIZER_NUM_UPSTREAM_CONNECTIONS;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -11316,6 +11695,10 @@ class ClusterProxyDefinition {
     /// of this object.
     MessageThrottleConfig& messageThrottleConfig();
 
+    /// Return a reference to the modifiable "NumUpstreamConnections"
+    /// attribute of this object.
+    int& numUpstreamConnections();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -11380,6 +11763,10 @@ class ClusterProxyDefinition {
     /// "MessageThrottleConfig" attribute of this object.
     const MessageThrottleConfig& messageThrottleConfig() const;
 
+    /// Return the value of the "NumUpstreamConnections" attribute of this
+    /// object.
+    int numUpstreamConnections() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -11726,6 +12113,9 @@ class AppConfig {
     int                            d_routeCommandTimeoutMs;
     bool                           d_configureStream;
     bool                           d_advertiseSubscriptions;
+    bool                           d_advertiseCompressionAlgorithms;
+    bool                           d_advertiseTraceContext;
+    bool                           d_dispatcherCpuAccounting;
 
     // PRIVATE ACCESSORS
 
@@ -11738,53 +12128,59 @@ class AppConfig {
     // TYPES
 
     enum {
-        ATTRIBUTE_ID_BROKER_INSTANCE_NAME     = 0,
-        ATTRIBUTE_ID_BROKER_VERSION           = 1,
-        ATTRIBUTE_ID_CONFIG_VERSION           = 2,
-        ATTRIBUTE_ID_ETC_DIR                  = 3,
-        ATTRIBUTE_ID_HOST_NAME                = 4,
-        ATTRIBUTE_ID_HOST_TAGS                = 5,
-        ATTRIBUTE_ID_HOST_DATA_CENTER         = 6,
-        ATTRIBUTE_ID_LOGS_OBSERVER_MAX_SIZE   = 7,
-        ATTRIBUTE_ID_LATENCY_MONITOR_DOMAIN   = 8,
-        ATTRIBUTE_ID_DISPATCHER_CONFIG        = 9,
-        ATTRIBUTE_ID_STATS                    = 10,
-        ATTRIBUTE_ID_NETWORK_INTERFACES       = 11,
-        ATTRIBUTE_ID_BMQCONF_CONFIG           = 12,
-        ATTRIBUTE_ID_PLUGINS                  = 13,
-        ATTRIBUTE_ID_MESSAGE_PROPERTIES_V2    = 14,
-        ATTRIBUTE_ID_CONFIGURE_STREAM         = 15,
-        ATTRIBUTE_ID_ADVERTISE_SUBSCRIPTIONS  = 16,
-        ATTRIBUTE_ID_ROUTE_COMMAND_TIMEOUT_MS = 17,
-        ATTRIBUTE_ID_AUTHENTICATION           = 18,
-        ATTRIBUTE_ID_AUTHORIZATION            = 19,
-        ATTRIBUTE_ID_TLS_CONFIG               = 20
+        ATTRIBUTE_ID_BROKER_INSTANCE_NAME             = 0,
+        ATTRIBUTE_ID_BROKER_VERSION                   = 1,
+        ATTRIBUTE_ID_CONFIG_VERSION                   = 2,
+        ATTRIBUTE_ID_ETC_DIR                          = 3,
+        ATTRIBUTE_ID_HOST_NAME                        = 4,
+        ATTRIBUTE_ID_HOST_TAGS                        = 5,
+        ATTRIBUTE_ID_HOST_DATA_CENTER                 = 6,
+        ATTRIBUTE_ID_LOGS_OBSERVER_MAX_SIZE           = 7,
+        ATTRIBUTE_ID_LATENCY_MONITOR_DOMAIN           = 8,
+        ATTRIBUTE_ID_DISPATCHER_CONFIG                = 9,
+        ATTRIBUTE_ID_STATS                            = 10,
+        ATTRIBUTE_ID_NETWORK_INTERFACES               = 11,
+        ATTRIBUTE_ID_BMQCONF_CONFIG                   = 12,
+        ATTRIBUTE_ID_PLUGINS                          = 13,
+        ATTRIBUTE_ID_MESSAGE_PROPERTIES_V2            = 14,
+        ATTRIBUTE_ID_CONFIGURE_STREAM                 = 15,
+        ATTRIBUTE_ID_ADVERTISE_SUBSCRIPTIONS          = 16,
+        ATTRIBUTE_ID_ROUTE_COMMAND_TIMEOUT_MS         = 17,
+        ATTRIBUTE_ID_AUTHENTICATION                   = 18,
+        ATTRIBUTE_ID_AUTHORIZATION                    = 19,
+        ATTRIBUTE_ID_TLS_CONFIG                       = 20,
+        ATTRIBUTE_ID_ADVERTISE_COMPRESSION_ALGORITHMS = 21,
+        ATTRIBUTE_ID_ADVERTISE_TRACE_CONTEXT          = 22,
+        ATTRIBUTE_ID_DISPATCHER_CPU_ACCOUNTING        = 23
     };
 
-    enum { NUM_ATTRIBUTES = 21 };
+    enum { NUM_ATTRIBUTES = 24 };
 
     enum {
-        ATTRIBUTE_INDEX_BROKER_INSTANCE_NAME     = 0,
-        ATTRIBUTE_INDEX_BROKER_VERSION           = 1,
-        ATTRIBUTE_INDEX_CONFIG_VERSION           = 2,
-        ATTRIBUTE_INDEX_ETC_DIR                  = 3,
-        ATTRIBUTE_INDEX_HOST_NAME                = 4,
-        ATTRIBUTE_INDEX_HOST_TAGS                = 5,
-        ATTRIBUTE_INDEX_HOST_DATA_CENTER         = 6,
-        ATTRIBUTE_INDEX_LOGS_OBSERVER_MAX_SIZE   = 7,
-        ATTRIBUTE_INDEX_LATENCY_MONITOR_DOMAIN   = 8,
-        ATTRIBUTE_INDEX_DISPATCHER_CONFIG        = 9,
-        ATTRIBUTE_INDEX_STATS                    = 10,
-        ATTRIBUTE_INDEX_NETWORK_INTERFACES       = 11,
-        ATTRIBUTE_INDEX_BMQCONF_CONFIG           = 12,
-        ATTRIBUTE_INDEX_PLUGINS                  = 13,
-        ATTRIBUTE_INDEX_MESSAGE_PROPERTIES_V2    = 14,
-        ATTRIBUTE_INDEX_CONFIGURE_STREAM         = 15,
-        ATTRIBUTE_INDEX_ADVERTISE_SUBSCRIPTIONS  = 16,
-        ATTRIBUTE_INDEX_ROUTE_COMMAND_TIMEOUT_MS = 17,
-        ATTRIBUTE_INDEX_AUTHENTICATION           = 18,
-        ATTRIBUTE_INDEX_AUTHORIZATION            = 19,
-        ATTRIBUTE_INDEX_TLS_CONFIG               = 20
+        ATTRIBUTE_INDEX_BROKER_INSTANCE_NAME             = 0,
+        ATTRIBUTE_INDEX_BROKER_VERSION                   = 1,
+        ATTRIBUTE_INDEX_CONFIG_VERSION                   = 2,
+        ATTRIBUTE_INDEX_ETC_DIR                          = 3,
+        ATTRIBUTE_INDEX_HOST_NAME                        = 4,
+        ATTRIBUTE_INDEX_HOST_TAGS                        = 5,
+        ATTRIBUTE_INDEX_HOST_DATA_CENTER                 = 6,
+        ATTRIBUTE_INDEX_LOGS_OBSERVER_MAX_SIZE           = 7,
+        ATTRIBUTE_INDEX_LATENCY_MONITOR_DOMAIN           = 8,
+        ATTRIBUTE_INDEX_DISPATCHER_CONFIG                = 9,
+        ATTRIBUTE_INDEX_STATS                            = 10,
+        ATTRIBUTE_INDEX_NETWORK_INTERFACES               = 11,
+        ATTRIBUTE_INDEX_BMQCONF_CONFIG                   = 12,
+        ATTRIBUTE_INDEX_PLUGINS                          = 13,
+        ATTRIBUTE_INDEX_MESSAGE_PROPERTIES_V2            = 14,
+        ATTRIBUTE_INDEX_CONFIGURE_STREAM                 = 15,
+        ATTRIBUTE_INDEX_ADVERTISE_SUBSCRIPTIONS          = 16,
+        ATTRIBUTE_INDEX_ROUTE_COMMAND_TIMEOUT_MS         = 17,
+        ATTRIBUTE_INDEX_AUTHENTICATION                   = 18,
+        ATTRIBUTE_INDEX_AUTHORIZATION                    = 19,
+        ATTRIBUTE_INDEX_TLS_CONFIG                       = 20,
+        ATTRIBUTE_INDEX_ADVERTISE_COMPRESSION_ALGORITHMS = 21,
+        ATTRIBUTE_INDEX_ADVERTISE_TRACE_CONTEXT          = 22,
+        ATTRIBUTE_INDEX_DISPATCHER_CPU_ACCOUNTING        = 23
     };
 
     // CONSTANTS
@@ -11799,6 +12195,12 @@ class AppConfig {
 
     static const int DEFAULT_INITIALIZER_ROUTE_COMMAND_TIMEOUT_MS;
 
+    static const bool DEFAULT_INITIALIZER_ADVERTISE_COMPRESSION_ALGORITHMS;
+
+    static const bool DEFAULT_INITIALIZER_ADVERTISE_TRACE_CONTEXT;
+
+    static const bool DEFAULT_INITIALIZER_DISPATCHER_CPU_ACCOUNTING;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -11974,6 +12376,18 @@ class AppConfig {
     /// object.
     bdlb::NullableValue<TlsConfig>& tlsConfig();
 
+    /// Return a reference to the modifiable "AdvertiseCompressionAlgorithms"
+    /// attribute of this object.
+    bool& advertiseCompressionAlgorithms();
+
+    /// Return a reference to the modifiable "AdvertiseTraceContext"
+    /// attribute of this object.
+    bool& advertiseTraceContext();
+
+    /// Return a reference to the modifiable "DispatcherCpuAccounting"
+    /// attribute of this object.
+    bool& dispatcherCpuAccounting();
+
     // ACCESSORS
 
     /// Format this object to the specified output `stream` at the
@@ -12098,6 +12512,18 @@ class AppConfig {
     /// attribute of this object.
     const bdlb::NullableValue<TlsConfig>& tlsConfig() const;
 
+    /// Return the value of the "AdvertiseCompressionAlgorithms" attribute of
+    /// this object.
+    bool advertiseCompressionAlgorithms() const;
+
+    /// Return the value of the "AdvertiseTraceContext" attribute of
+    /// this object.
+    bool advertiseTraceContext() const;
+
+    /// Return the value of the "DispatcherCpuAccounting" attribute of
+    /// this object.
+    bool dispatcherCpuAccounting() const;
+
     // HIDDEN FRIENDS
 
     /// Return `true` if the specified `lhs` and `rhs` attribute objects have
@@ -16137,6 +16563,7 @@ void StorageSyncConfig::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->startupWaitDurationMs());
     hashAppend(hashAlgorithm, this->fileChunkSize());
     hashAppend(hashAlgorithm, this->partitionSyncEventSize());
+    hashAppend(hashAlgorithm, this->partitionSyncMaxBytesPerSecond());
 }
 
 inline bool StorageSyncConfig::isEqualTo(const StorageSyncConfig& rhs) const
@@ -16152,7 +16579,9 @@ inline bool StorageSyncConfig::isEqualTo(const StorageSyncConfig& rhs) const
                rhs.partitionSyncDataReqTimeoutMs() &&
            this->startupWaitDurationMs() == rhs.startupWaitDurationMs() &&
            this->fileChunkSize() == rhs.fileChunkSize() &&
-           this->partitionSyncEventSize() == rhs.partitionSyncEventSize();
+           this->partitionSyncEventSize() == rhs.partitionSyncEventSize() &&
+           this->partitionSyncMaxBytesPerSecond() ==
+               rhs.partitionSyncMaxBytesPerSecond();
 }
 
 // CLASS METHODS
@@ -16226,6 +16655,14 @@ int StorageSyncConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_partitionSyncMaxBytesPerSecond,
+        ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_PARTITION_SYNC_MAX_BYTES_PER_SECOND]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -16283,6 +16720,12 @@ int StorageSyncConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             &d_partitionSyncEventSize,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_SYNC_EVENT_SIZE]);
     }
+    case ATTRIBUTE_ID_PARTITION_SYNC_MAX_BYTES_PER_SECOND: {
+        return manipulator(
+            &d_partitionSyncMaxBytesPerSecond,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_PARTITION_SYNC_MAX_BYTES_PER_SECOND]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -16348,6 +16791,11 @@ inline int& StorageSyncConfig::partitionSyncEventSize()
     return d_partitionSyncEventSize;
 }
 
+inline int& StorageSyncConfig::partitionSyncMaxBytesPerSecond()
+{
+    return d_partitionSyncMaxBytesPerSecond;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int StorageSyncConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -16416,6 +16864,14 @@ int StorageSyncConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_partitionSyncMaxBytesPerSecond,
+        ATTRIBUTE_INFO_ARRAY
+            [ATTRIBUTE_INDEX_PARTITION_SYNC_MAX_BYTES_PER_SECOND]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -16472,6 +16928,12 @@ int StorageSyncConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
             d_partitionSyncEventSize,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITION_SYNC_EVENT_SIZE]);
     }
+    case ATTRIBUTE_ID_PARTITION_SYNC_MAX_BYTES_PER_SECOND: {
+        return accessor(
+            d_partitionSyncMaxBytesPerSecond,
+            ATTRIBUTE_INFO_ARRAY
+                [ATTRIBUTE_INDEX_PARTITION_SYNC_MAX_BYTES_PER_SECOND]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -16537,6 +16999,11 @@ inline int StorageSyncConfig::partitionSyncEventSize() const
     return d_partitionSyncEventSize;
 }
 
+inline int StorageSyncConfig::partitionSyncMaxBytesPerSecond() const
+{
+    return d_partitionSyncMaxBytesPerSecond;
+}
+
 // ------------------
 // class SyslogConfig
 // ------------------
@@ -16869,13 +17336,15 @@ void TcpInterfaceListener::hashAppendImpl(
     hashAppend(hashAlgorithm, this->address());
     hashAppend(hashAlgorithm, this->port());
     hashAppend(hashAlgorithm, this->tls());
+    hashAppend(hashAlgorithm, this->acceptShards());
 }
 
 inline bool
 TcpInterfaceListener::isEqualTo(const TcpInterfaceListener& rhs) const
 {
     return this->name() == rhs.name() && this->address() == rhs.address() &&
-           this->port() == rhs.port() && this->tls() == rhs.tls();
+           this->port() == rhs.port() && this->tls() == rhs.tls() &&
+           this->acceptShards() == rhs.acceptShards();
 }
 
 // CLASS METHODS
@@ -16906,6 +17375,12 @@ int TcpInterfaceListener::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_acceptShards,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ACCEPT_SHARDS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -16931,6 +17406,11 @@ int TcpInterfaceListener::manipulateAttribute(t_MANIPULATOR& manipulator,
     case ATTRIBUTE_ID_TLS: {
         return manipulator(&d_tls, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TLS]);
     }
+    case ATTRIBUTE_ID_ACCEPT_SHARDS: {
+        return manipulator(
+            &d_acceptShards,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ACCEPT_SHARDS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -16971,6 +17451,11 @@ inline bool& TcpInterfaceListener::tls()
     return d_tls;
 }
 
+inline int& TcpInterfaceListener::acceptShards()
+{
+    return d_acceptShards;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int TcpInterfaceListener::accessAttributes(t_ACCESSOR& accessor) const
@@ -16997,6 +17482,12 @@ int TcpInterfaceListener::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_acceptShards,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ACCEPT_SHARDS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -17019,6 +17510,10 @@ int TcpInterfaceListener::accessAttribute(t_ACCESSOR& accessor, int id) const
     case ATTRIBUTE_ID_TLS: {
         return accessor(d_tls, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TLS]);
     }
+    case ATTRIBUTE_ID_ACCEPT_SHARDS: {
+        return accessor(d_acceptShards,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ACCEPT_SHARDS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -17059,6 +17554,11 @@ inline bool TcpInterfaceListener::tls() const
     return d_tls;
 }
 
+inline int TcpInterfaceListener::acceptShards() const
+{
+    return d_acceptShards;
+}
+
 // ---------------
 // class TlsConfig
 // ---------------
@@ -17666,6 +18166,24 @@ int DispatcherProcessorConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_workStealing,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WORK_STEALING]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_maxBatchSize,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_BATCH_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_firstCpu,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIRST_CPU]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -17686,6 +18204,20 @@ int DispatcherProcessorConfig::manipulateAttribute(t_MANIPULATOR& manipulator,
             &d_processorConfig,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_CONFIG]);
     }
+    case ATTRIBUTE_ID_WORK_STEALING: {
+        return manipulator(
+            &d_workStealing,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WORK_STEALING]);
+    }
+    case ATTRIBUTE_ID_MAX_BATCH_SIZE: {
+        return manipulator(
+            &d_maxBatchSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_BATCH_SIZE]);
+    }
+    case ATTRIBUTE_ID_FIRST_CPU: {
+        return manipulator(&d_firstCpu,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIRST_CPU]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -17717,6 +18249,21 @@ DispatcherProcessorConfig::processorConfig()
     return d_processorConfig;
 }
 
+inline bool& DispatcherProcessorConfig::workStealing()
+{
+    return d_workStealing;
+}
+
+inline int& DispatcherProcessorConfig::maxBatchSize()
+{
+    return d_maxBatchSize;
+}
+
+inline int& DispatcherProcessorConfig::firstCpu()
+{
+    return d_firstCpu;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int DispatcherProcessorConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -17735,6 +18282,23 @@ int DispatcherProcessorConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_workStealing,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WORK_STEALING]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_maxBatchSize,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_BATCH_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_firstCpu, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIRST_CPU]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -17754,6 +18318,18 @@ int DispatcherProcessorConfig::accessAttribute(t_ACCESSOR& accessor,
             d_processorConfig,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PROCESSOR_CONFIG]);
     }
+    case ATTRIBUTE_ID_WORK_STEALING: {
+        return accessor(d_workStealing,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WORK_STEALING]);
+    }
+    case ATTRIBUTE_ID_MAX_BATCH_SIZE: {
+        return accessor(d_maxBatchSize,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_BATCH_SIZE]);
+    }
+    case ATTRIBUTE_ID_FIRST_CPU: {
+        return accessor(d_firstCpu,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_FIRST_CPU]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -17785,6 +18361,21 @@ DispatcherProcessorConfig::processorConfig() const
     return d_processorConfig;
 }
 
+inline bool DispatcherProcessorConfig::workStealing() const
+{
+    return d_workStealing;
+}
+
+inline int DispatcherProcessorConfig::maxBatchSize() const
+{
+    return d_maxBatchSize;
+}
+
+inline int DispatcherProcessorConfig::firstCpu() const
+{
+    return d_firstCpu;
+}
+
 // -------------------
 // class LogController
 // -------------------
@@ -18257,6 +18848,22 @@ void PartitionConfig::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->prefaultPages());
     hashAppend(hashAlgorithm, this->flushAtShutdown());
     hashAppend(hashAlgorithm, this->syncConfig());
+    hashAppend(hashAlgorithm, this->writebackThreshold());
+    hashAppend(hashAlgorithm, this->groupCommitMaxBytes());
+    hashAppend(hashAlgorithm, this->groupCommitMaxRecords());
+    hashAppend(hashAlgorithm, this->groupCommitMaxDelayUs());
+    hashAppend(hashAlgorithm, this->recoveryThreads());
+    hashAppend(hashAlgorithm, this->recoveryCheckpoint());
+    hashAppend(hashAlgorithm, this->hugePages());
+    hashAppend(hashAlgorithm, this->residentWindowSize());
+    hashAppend(hashAlgorithm, this->precreatePercent());
+    hashAppend(hashAlgorithm, this->partitionsPerProcessor());
+    hashAppend(hashAlgorithm, this->groupCommitAdaptive());
+    hashAppend(hashAlgorithm, this->recoveryVerifyPercent());
+    hashAppend(hashAlgorithm, this->scrubIntervalMs());
+    hashAppend(hashAlgorithm, this->scrubMaxBytesPerSecond());
+    hashAppend(hashAlgorithm, this->readaheadSize());
+    hashAppend(hashAlgorithm, this->dropConsumedPages());
 }
 
 inline bool PartitionConfig::isEqualTo(const PartitionConfig& rhs) const
@@ -18272,7 +18879,23 @@ inline bool PartitionConfig::isEqualTo(const PartitionConfig& rhs) const
            this->maxArchivedFileSets() == rhs.maxArchivedFileSets() &&
            this->prefaultPages() == rhs.prefaultPages() &&
            this->flushAtShutdown() == rhs.flushAtShutdown() &&
-           this->syncConfig() == rhs.syncConfig();
+           this->syncConfig() == rhs.syncConfig() &&
+           this->writebackThreshold() == rhs.writebackThreshold() &&
+           this->groupCommitMaxBytes() == rhs.groupCommitMaxBytes() &&
+           this->groupCommitMaxRecords() == rhs.groupCommitMaxRecords() &&
+           this->groupCommitMaxDelayUs() == rhs.groupCommitMaxDelayUs() &&
+           this->recoveryThreads() == rhs.recoveryThreads() &&
+           this->recoveryCheckpoint() == rhs.recoveryCheckpoint() &&
+           this->hugePages() == rhs.hugePages() &&
+           this->residentWindowSize() == rhs.residentWindowSize() &&
+           this->precreatePercent() == rhs.precreatePercent() &&
+           this->partitionsPerProcessor() == rhs.partitionsPerProcessor() &&
+           this->groupCommitAdaptive() == rhs.groupCommitAdaptive() &&
+           this->recoveryVerifyPercent() == rhs.recoveryVerifyPercent() &&
+           this->scrubIntervalMs() == rhs.scrubIntervalMs() &&
+           this->scrubMaxBytesPerSecond() == rhs.scrubMaxBytesPerSecond() &&
+           this->readaheadSize() == rhs.readaheadSize() &&
+           this->dropConsumedPages() == rhs.dropConsumedPages();
 }
 
 // CLASS METHODS
@@ -18359,26 +18982,133 @@ int PartitionConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
-    return 0;
-}
-
-template <typename t_MANIPULATOR>
-int PartitionConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
-{
-    enum { NOT_FOUND = -1 };
+    ret = manipulator(
+        &d_writebackThreshold,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WRITEBACK_THRESHOLD]);
+    if (ret) {
+        return ret;
+    }
 
-    switch (id) {
-    case ATTRIBUTE_ID_NUM_PARTITIONS: {
-        return manipulator(
-            &d_numPartitions,
-            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_PARTITIONS]);
+    ret = manipulator(
+        &d_groupCommitMaxBytes,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    if (ret) {
+        return ret;
     }
-    case ATTRIBUTE_ID_LOCATION: {
-        return manipulator(&d_location,
-                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LOCATION]);
+
+    ret = manipulator(
+        &d_groupCommitMaxRecords,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_RECORDS]);
+    if (ret) {
+        return ret;
     }
-    case ATTRIBUTE_ID_ARCHIVE_LOCATION: {
-        return manipulator(
+
+    ret = manipulator(
+        &d_groupCommitMaxDelayUs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_DELAY_US]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_recoveryThreads,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_THREADS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_recoveryCheckpoint,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_CHECKPOINT]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_hugePages,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HUGE_PAGES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_residentWindowSize,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RESIDENT_WINDOW_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_precreatePercent,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRECREATE_PERCENT]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_partitionsPerProcessor,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITIONS_PER_PROCESSOR]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_groupCommitAdaptive,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_ADAPTIVE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_recoveryVerifyPercent,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_VERIFY_PERCENT]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_scrubIntervalMs,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SCRUB_INTERVAL_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_scrubMaxBytesPerSecond,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SCRUB_MAX_BYTES_PER_SECOND]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_readaheadSize,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_READAHEAD_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_dropConsumedPages,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DROP_CONSUMED_PAGES]);
+    if (ret) {
+        return ret;
+    }
+
+    return 0;
+}
+
+template <typename t_MANIPULATOR>
+int PartitionConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
+{
+    enum { NOT_FOUND = -1 };
+
+    switch (id) {
+    case ATTRIBUTE_ID_NUM_PARTITIONS: {
+        return manipulator(
+            &d_numPartitions,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_PARTITIONS]);
+    }
+    case ATTRIBUTE_ID_LOCATION: {
+        return manipulator(&d_location,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LOCATION]);
+    }
+    case ATTRIBUTE_ID_ARCHIVE_LOCATION: {
+        return manipulator(
             &d_archiveLocation,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ARCHIVE_LOCATION]);
     }
@@ -18425,6 +19155,85 @@ int PartitionConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_syncConfig,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG]);
     }
+    case ATTRIBUTE_ID_WRITEBACK_THRESHOLD: {
+        return manipulator(
+            &d_writebackThreshold,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WRITEBACK_THRESHOLD]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES: {
+        return manipulator(
+            &d_groupCommitMaxBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_RECORDS: {
+        return manipulator(
+            &d_groupCommitMaxRecords,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_RECORDS]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_DELAY_US: {
+        return manipulator(
+            &d_groupCommitMaxDelayUs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_DELAY_US]);
+    }
+    case ATTRIBUTE_ID_RECOVERY_THREADS: {
+        return manipulator(
+            &d_recoveryThreads,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_THREADS]);
+    }
+    case ATTRIBUTE_ID_RECOVERY_CHECKPOINT: {
+        return manipulator(
+            &d_recoveryCheckpoint,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_CHECKPOINT]);
+    }
+    case ATTRIBUTE_ID_HUGE_PAGES: {
+        return manipulator(&d_hugePages,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HUGE_PAGES]);
+    }
+    case ATTRIBUTE_ID_RESIDENT_WINDOW_SIZE: {
+        return manipulator(
+            &d_residentWindowSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RESIDENT_WINDOW_SIZE]);
+    }
+    case ATTRIBUTE_ID_PRECREATE_PERCENT: {
+        return manipulator(
+            &d_precreatePercent,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRECREATE_PERCENT]);
+    }
+    case ATTRIBUTE_ID_PARTITIONS_PER_PROCESSOR: {
+        return manipulator(
+            &d_partitionsPerProcessor,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITIONS_PER_PROCESSOR]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_ADAPTIVE: {
+        return manipulator(
+            &d_groupCommitAdaptive,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_ADAPTIVE]);
+    }
+    case ATTRIBUTE_ID_RECOVERY_VERIFY_PERCENT: {
+        return manipulator(
+            &d_recoveryVerifyPercent,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_VERIFY_PERCENT]);
+    }
+    case ATTRIBUTE_ID_SCRUB_INTERVAL_MS: {
+        return manipulator(
+            &d_scrubIntervalMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SCRUB_INTERVAL_MS]);
+    }
+    case ATTRIBUTE_ID_SCRUB_MAX_BYTES_PER_SECOND: {
+        return manipulator(
+            &d_scrubMaxBytesPerSecond,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SCRUB_MAX_BYTES_PER_SECOND]);
+    }
+    case ATTRIBUTE_ID_READAHEAD_SIZE: {
+        return manipulator(
+            &d_readaheadSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_READAHEAD_SIZE]);
+    }
+    case ATTRIBUTE_ID_DROP_CONSUMED_PAGES: {
+        return manipulator(
+            &d_dropConsumedPages,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DROP_CONSUMED_PAGES]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -18505,6 +19314,86 @@ inline StorageSyncConfig& PartitionConfig::syncConfig()
     return d_syncConfig;
 }
 
+inline bsls::Types::Uint64& PartitionConfig::writebackThreshold()
+{
+    return d_writebackThreshold;
+}
+
+inline int& PartitionConfig::groupCommitMaxBytes()
+{
+    return d_groupCommitMaxBytes;
+}
+
+inline int& PartitionConfig::groupCommitMaxRecords()
+{
+    return d_groupCommitMaxRecords;
+}
+
+inline int& PartitionConfig::groupCommitMaxDelayUs()
+{
+    return d_groupCommitMaxDelayUs;
+}
+
+inline int& PartitionConfig::recoveryThreads()
+{
+    return d_recoveryThreads;
+}
+
+inline bool& PartitionConfig::recoveryCheckpoint()
+{
+    return d_recoveryCheckpoint;
+}
+
+inline bool& PartitionConfig::hugePages()
+{
+    return d_hugePages;
+}
+
+inline bsls::Types::Uint64& PartitionConfig::residentWindowSize()
+{
+    return d_residentWindowSize;
+}
+
+inline int& PartitionConfig::precreatePercent()
+{
+    return d_precreatePercent;
+}
+
+inline int& PartitionConfig::partitionsPerProcessor()
+{
+    return d_partitionsPerProcessor;
+}
+
+inline bool& PartitionConfig::groupCommitAdaptive()
+{
+    return d_groupCommitAdaptive;
+}
+
+inline int& PartitionConfig::recoveryVerifyPercent()
+{
+    return d_recoveryVerifyPercent;
+}
+
+inline int& PartitionConfig::scrubIntervalMs()
+{
+    return d_scrubIntervalMs;
+}
+
+inline int& PartitionConfig::scrubMaxBytesPerSecond()
+{
+    return d_scrubMaxBytesPerSecond;
+}
+
+inline bsls::Types::Uint64& PartitionConfig::readaheadSize()
+{
+    return d_readaheadSize;
+}
+
+inline bool& PartitionConfig::dropConsumedPages()
+{
+    return d_dropConsumedPages;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int PartitionConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -18584,6 +19473,109 @@ int PartitionConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_writebackThreshold,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WRITEBACK_THRESHOLD]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_groupCommitMaxBytes,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_groupCommitMaxRecords,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_RECORDS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_groupCommitMaxDelayUs,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_DELAY_US]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_recoveryThreads,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_THREADS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_recoveryCheckpoint,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_CHECKPOINT]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_hugePages,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HUGE_PAGES]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_residentWindowSize,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RESIDENT_WINDOW_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_precreatePercent,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRECREATE_PERCENT]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_partitionsPerProcessor,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITIONS_PER_PROCESSOR]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_groupCommitAdaptive,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_ADAPTIVE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_recoveryVerifyPercent,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_VERIFY_PERCENT]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_scrubIntervalMs,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SCRUB_INTERVAL_MS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_scrubMaxBytesPerSecond,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SCRUB_MAX_BYTES_PER_SECOND]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_readaheadSize,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_READAHEAD_SIZE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_dropConsumedPages,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DROP_CONSUMED_PAGES]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -18648,6 +19640,84 @@ int PartitionConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_syncConfig,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SYNC_CONFIG]);
     }
+    case ATTRIBUTE_ID_WRITEBACK_THRESHOLD: {
+        return accessor(
+            d_writebackThreshold,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_WRITEBACK_THRESHOLD]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_BYTES: {
+        return accessor(
+            d_groupCommitMaxBytes,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_BYTES]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_RECORDS: {
+        return accessor(
+            d_groupCommitMaxRecords,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_RECORDS]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_MAX_DELAY_US: {
+        return accessor(
+            d_groupCommitMaxDelayUs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_MAX_DELAY_US]);
+    }
+    case ATTRIBUTE_ID_RECOVERY_THREADS: {
+        return accessor(
+            d_recoveryThreads,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_THREADS]);
+    }
+    case ATTRIBUTE_ID_RECOVERY_CHECKPOINT: {
+        return accessor(
+            d_recoveryCheckpoint,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_CHECKPOINT]);
+    }
+    case ATTRIBUTE_ID_HUGE_PAGES: {
+        return accessor(d_hugePages,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_HUGE_PAGES]);
+    }
+    case ATTRIBUTE_ID_RESIDENT_WINDOW_SIZE: {
+        return accessor(
+            d_residentWindowSize,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RESIDENT_WINDOW_SIZE]);
+    }
+    case ATTRIBUTE_ID_PRECREATE_PERCENT: {
+        return accessor(
+            d_precreatePercent,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRECREATE_PERCENT]);
+    }
+    case ATTRIBUTE_ID_PARTITIONS_PER_PROCESSOR: {
+        return accessor(
+            d_partitionsPerProcessor,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PARTITIONS_PER_PROCESSOR]);
+    }
+    case ATTRIBUTE_ID_GROUP_COMMIT_ADAPTIVE: {
+        return accessor(
+            d_groupCommitAdaptive,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_GROUP_COMMIT_ADAPTIVE]);
+    }
+    case ATTRIBUTE_ID_RECOVERY_VERIFY_PERCENT: {
+        return accessor(
+            d_recoveryVerifyPercent,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_RECOVERY_VERIFY_PERCENT]);
+    }
+    case ATTRIBUTE_ID_SCRUB_INTERVAL_MS: {
+        return accessor(
+            d_scrubIntervalMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SCRUB_INTERVAL_MS]);
+    }
+    case ATTRIBUTE_ID_SCRUB_MAX_BYTES_PER_SECOND: {
+        return accessor(
+            d_scrubMaxBytesPerSecond,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SCRUB_MAX_BYTES_PER_SECOND]);
+    }
+    case ATTRIBUTE_ID_READAHEAD_SIZE: {
+        return accessor(d_readaheadSize,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_READAHEAD_SIZE]);
+    }
+    case ATTRIBUTE_ID_DROP_CONSUMED_PAGES: {
+        return accessor(
+            d_dropConsumedPages,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DROP_CONSUMED_PAGES]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -18728,6 +19798,86 @@ inline const StorageSyncConfig& PartitionConfig::syncConfig() const
     return d_syncConfig;
 }
 
+inline bsls::Types::Uint64 PartitionConfig::writebackThreshold() const
+{
+    return d_writebackThreshold;
+}
+
+inline int PartitionConfig::groupCommitMaxBytes() const
+{
+    return d_groupCommitMaxBytes;
+}
+
+inline int PartitionConfig::groupCommitMaxRecords() const
+{
+    return d_groupCommitMaxRecords;
+}
+
+inline int PartitionConfig::groupCommitMaxDelayUs() const
+{
+    return d_groupCommitMaxDelayUs;
+}
+
+inline int PartitionConfig::recoveryThreads() const
+{
+    return d_recoveryThreads;
+}
+
+inline bool PartitionConfig::recoveryCheckpoint() const
+{
+    return d_recoveryCheckpoint;
+}
+
+inline bool PartitionConfig::hugePages() const
+{
+    return d_hugePages;
+}
+
+inline bsls::Types::Uint64 PartitionConfig::residentWindowSize() const
+{
+    return d_residentWindowSize;
+}
+
+inline int PartitionConfig::precreatePercent() const
+{
+    return d_precreatePercent;
+}
+
+inline int PartitionConfig::partitionsPerProcessor() const
+{
+    return d_partitionsPerProcessor;
+}
+
+inline bool PartitionConfig::groupCommitAdaptive() const
+{
+    return d_groupCommitAdaptive;
+}
+
+inline int PartitionConfig::recoveryVerifyPercent() const
+{
+    return d_recoveryVerifyPercent;
+}
+
+inline int PartitionConfig::scrubIntervalMs() const
+{
+    return d_scrubIntervalMs;
+}
+
+inline int PartitionConfig::scrubMaxBytesPerSecond() const
+{
+    return d_scrubMaxBytesPerSecond;
+}
+
+inline bsls::Types::Uint64 PartitionConfig::readaheadSize() const
+{
+    return d_readaheadSize;
+}
+
+inline bool PartitionConfig::dropConsumedPages() const
+{
+    return d_dropConsumedPages;
+}
+
 // ---------------------------
 // class PluginSettingKeyValue
 // ---------------------------
@@ -19321,6 +20471,7 @@ void TcpInterfaceConfig::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->nodeHighWatermark());
     hashAppend(hashAlgorithm, this->heartbeatIntervalMs());
     hashAppend(hashAlgorithm, this->listeners());
+    hashAppend(hashAlgorithm, this->eventCaptureFile());
 }
 
 inline bool TcpInterfaceConfig::isEqualTo(const TcpInterfaceConfig& rhs) const
@@ -19333,7 +20484,8 @@ inline bool TcpInterfaceConfig::isEqualTo(const TcpInterfaceConfig& rhs) const
            this->nodeLowWatermark() == rhs.nodeLowWatermark() &&
            this->nodeHighWatermark() == rhs.nodeHighWatermark() &&
            this->heartbeatIntervalMs() == rhs.heartbeatIntervalMs() &&
-           this->listeners() == rhs.listeners();
+           this->listeners() == rhs.listeners() &&
+           this->eventCaptureFile() == rhs.eventCaptureFile();
 }
 
 // CLASS METHODS
@@ -19404,6 +20556,13 @@ int TcpInterfaceConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_eventCaptureFile,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_EVENT_CAPTURE_FILE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -19459,6 +20618,11 @@ int TcpInterfaceConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_listeners,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LISTENERS]);
     }
+    case ATTRIBUTE_ID_EVENT_CAPTURE_FILE: {
+        return manipulator(
+            &d_eventCaptureFile,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_EVENT_CAPTURE_FILE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -19529,6 +20693,11 @@ inline bsl::vector<TcpInterfaceListener>& TcpInterfaceConfig::listeners()
     return d_listeners;
 }
 
+inline bsl::string& TcpInterfaceConfig::eventCaptureFile()
+{
+    return d_eventCaptureFile;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int TcpInterfaceConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -19594,6 +20763,12 @@ int TcpInterfaceConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_eventCaptureFile,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_EVENT_CAPTURE_FILE]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -19644,6 +20819,11 @@ int TcpInterfaceConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_listeners,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_LISTENERS]);
     }
+    case ATTRIBUTE_ID_EVENT_CAPTURE_FILE: {
+        return accessor(
+            d_eventCaptureFile,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_EVENT_CAPTURE_FILE]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -19715,6 +20895,11 @@ TcpInterfaceConfig::listeners() const
     return d_listeners;
 }
 
+inline const bsl::string& TcpInterfaceConfig::eventCaptureFile() const
+{
+    return d_eventCaptureFile;
+}
+
 // -------------------------------
 // class AuthenticatorPluginConfig
 // -------------------------------
@@ -21284,6 +22469,7 @@ void AuthenticatorConfig::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->minThreads());
     hashAppend(hashAlgorithm, this->maxThreads());
     hashAppend(hashAlgorithm, this->credentialProvider());
+    hashAppend(hashAlgorithm, this->cacheTimeoutMs());
 }
 
 inline bool
@@ -21293,7 +22479,8 @@ AuthenticatorConfig::isEqualTo(const AuthenticatorConfig& rhs) const
            this->anonymousCredential() == rhs.anonymousCredential() &&
            this->minThreads() == rhs.minThreads() &&
            this->maxThreads() == rhs.maxThreads() &&
-           this->credentialProvider() == rhs.credentialProvider();
+           this->credentialProvider() == rhs.credentialProvider() &&
+           this->cacheTimeoutMs() == rhs.cacheTimeoutMs();
 }
 
 // CLASS METHODS
@@ -21335,6 +22522,12 @@ int AuthenticatorConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_cacheTimeoutMs,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CACHE_TIMEOUT_MS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -21368,6 +22561,11 @@ int AuthenticatorConfig::manipulateAttribute(t_MANIPULATOR& manipulator,
             &d_credentialProvider,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CREDENTIAL_PROVIDER]);
     }
+    case ATTRIBUTE_ID_CACHE_TIMEOUT_MS: {
+        return manipulator(
+            &d_cacheTimeoutMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CACHE_TIMEOUT_MS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -21416,6 +22614,11 @@ AuthenticatorConfig::credentialProvider()
     return d_credentialProvider;
 }
 
+inline int& AuthenticatorConfig::cacheTimeoutMs()
+{
+    return d_cacheTimeoutMs;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int AuthenticatorConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -21452,6 +22655,12 @@ int AuthenticatorConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_cacheTimeoutMs,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CACHE_TIMEOUT_MS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -21483,6 +22692,11 @@ int AuthenticatorConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
             d_credentialProvider,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CREDENTIAL_PROVIDER]);
     }
+    case ATTRIBUTE_ID_CACHE_TIMEOUT_MS: {
+        return accessor(
+            d_cacheTimeoutMs,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CACHE_TIMEOUT_MS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -21531,6 +22745,11 @@ AuthenticatorConfig::credentialProvider() const
     return d_credentialProvider;
 }
 
+inline int AuthenticatorConfig::cacheTimeoutMs() const
+{
+    return d_cacheTimeoutMs;
+}
+
 // ----------------------
 // class AuthorizerConfig
 // ----------------------
@@ -22039,6 +23258,7 @@ void ClusterProxyDefinition::hashAppendImpl(
     hashAppend(hashAlgorithm, this->queueOperations());
     hashAppend(hashAlgorithm, this->clusterMonitorConfig());
     hashAppend(hashAlgorithm, this->messageThrottleConfig());
+    hashAppend(hashAlgorithm, this->numUpstreamConnections());
 }
 
 inline bool
@@ -22047,7 +23267,8 @@ ClusterProxyDefinition::isEqualTo(const ClusterProxyDefinition& rhs) const
     return this->name() == rhs.name() && this->nodes() == rhs.nodes() &&
            this->queueOperations() == rhs.queueOperations() &&
            this->clusterMonitorConfig() == rhs.clusterMonitorConfig() &&
-           this->messageThrottleConfig() == rhs.messageThrottleConfig();
+           this->messageThrottleConfig() == rhs.messageThrottleConfig() &&
+           this->numUpstreamConnections() == rhs.numUpstreamConnections();
 }
 
 // CLASS METHODS
@@ -22087,6 +23308,13 @@ int ClusterProxyDefinition::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_numUpstreamConnections,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_UPSTREAM_CONNECTIONS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -22120,6 +23348,11 @@ int ClusterProxyDefinition::manipulateAttribute(t_MANIPULATOR& manipulator,
             &d_messageThrottleConfig,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MESSAGE_THROTTLE_CONFIG]);
     }
+    case ATTRIBUTE_ID_NUM_UPSTREAM_CONNECTIONS: {
+        return manipulator(
+            &d_numUpstreamConnections,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_UPSTREAM_CONNECTIONS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -22165,6 +23398,11 @@ inline MessageThrottleConfig& ClusterProxyDefinition::messageThrottleConfig()
     return d_messageThrottleConfig;
 }
 
+inline int& ClusterProxyDefinition::numUpstreamConnections()
+{
+    return d_numUpstreamConnections;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int ClusterProxyDefinition::accessAttributes(t_ACCESSOR& accessor) const
@@ -22201,6 +23439,13 @@ int ClusterProxyDefinition::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_numUpstreamConnections,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_UPSTREAM_CONNECTIONS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -22231,6 +23476,11 @@ int ClusterProxyDefinition::accessAttribute(t_ACCESSOR& accessor, int id) const
             d_messageThrottleConfig,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MESSAGE_THROTTLE_CONFIG]);
     }
+    case ATTRIBUTE_ID_NUM_UPSTREAM_CONNECTIONS: {
+        return accessor(
+            d_numUpstreamConnections,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_NUM_UPSTREAM_CONNECTIONS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -22279,6 +23529,11 @@ ClusterProxyDefinition::messageThrottleConfig() const
     return d_messageThrottleConfig;
 }
 
+inline int ClusterProxyDefinition::numUpstreamConnections() const
+{
+    return d_numUpstreamConnections;
+}
+
 // -----------------
 // class StatsConfig
 // -----------------
@@ -22484,6 +23739,9 @@ void AppConfig::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->authentication());
     hashAppend(hashAlgorithm, this->authorization());
     hashAppend(hashAlgorithm, this->tlsConfig());
+    hashAppend(hashAlgorithm, this->advertiseCompressionAlgorithms());
+    hashAppend(hashAlgorithm, this->advertiseTraceContext());
+    hashAppend(hashAlgorithm, this->dispatcherCpuAccounting());
 }
 
 inline bool AppConfig::isEqualTo(const AppConfig& rhs) const
@@ -22508,7 +23766,10 @@ inline bool AppConfig::isEqualTo(const AppConfig& rhs) const
            this->routeCommandTimeoutMs() == rhs.routeCommandTimeoutMs() &&
            this->authentication() == rhs.authentication() &&
            this->authorization() == rhs.authorization() &&
-           this->tlsConfig() == rhs.tlsConfig();
+           this->tlsConfig() == rhs.tlsConfig() &&
+           this->advertiseCompressionAlgorithms() == rhs.advertiseCompressionAlgorithms() &&
+           this->advertiseTraceContext() == rhs.advertiseTraceContext() &&
+           this->dispatcherCpuAccounting() == rhs.dispatcherCpuAccounting();
 }
 
 // CLASS METHODS
@@ -22650,6 +23911,27 @@ int AppConfig::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_advertiseCompressionAlgorithms,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADVERTISE_COMPRESSION_ALGORITHMS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_advertiseTraceContext,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADVERTISE_TRACE_CONTEXT]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(
+        &d_dispatcherCpuAccounting,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DISPATCHER_CPU_ACCOUNTING]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -22758,6 +24040,21 @@ int AppConfig::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
         return manipulator(&d_tlsConfig,
                            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TLS_CONFIG]);
     }
+    case ATTRIBUTE_ID_ADVERTISE_COMPRESSION_ALGORITHMS: {
+        return manipulator(
+            &d_advertiseCompressionAlgorithms,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADVERTISE_COMPRESSION_ALGORITHMS]);
+    }
+    case ATTRIBUTE_ID_ADVERTISE_TRACE_CONTEXT: {
+        return manipulator(
+            &d_advertiseTraceContext,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADVERTISE_TRACE_CONTEXT]);
+    }
+    case ATTRIBUTE_ID_DISPATCHER_CPU_ACCOUNTING: {
+        return manipulator(
+            &d_dispatcherCpuAccounting,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DISPATCHER_CPU_ACCOUNTING]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -22883,6 +24180,21 @@ inline bdlb::NullableValue<TlsConfig>& AppConfig::tlsConfig()
     return d_tlsConfig;
 }
 
+inline bool& AppConfig::advertiseCompressionAlgorithms()
+{
+    return d_advertiseCompressionAlgorithms;
+}
+
+inline bool& AppConfig::advertiseTraceContext()
+{
+    return d_advertiseTraceContext;
+}
+
+inline bool& AppConfig::dispatcherCpuAccounting()
+{
+    return d_dispatcherCpuAccounting;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int AppConfig::accessAttributes(t_ACCESSOR& accessor) const
@@ -23017,6 +24329,27 @@ int AppConfig::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(
+        d_advertiseCompressionAlgorithms,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADVERTISE_COMPRESSION_ALGORITHMS]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_advertiseTraceContext,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADVERTISE_TRACE_CONTEXT]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(
+        d_dispatcherCpuAccounting,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DISPATCHER_CPU_ACCOUNTING]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -23119,6 +24452,21 @@ int AppConfig::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_tlsConfig,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_TLS_CONFIG]);
     }
+    case ATTRIBUTE_ID_ADVERTISE_COMPRESSION_ALGORITHMS: {
+        return accessor(
+            d_advertiseCompressionAlgorithms,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADVERTISE_COMPRESSION_ALGORITHMS]);
+    }
+    case ATTRIBUTE_ID_ADVERTISE_TRACE_CONTEXT: {
+        return accessor(
+            d_advertiseTraceContext,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_ADVERTISE_TRACE_CONTEXT]);
+    }
+    case ATTRIBUTE_ID_DISPATCHER_CPU_ACCOUNTING: {
+        return accessor(
+            d_dispatcherCpuAccounting,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DISPATCHER_CPU_ACCOUNTING]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -23244,6 +24592,21 @@ inline const bdlb::NullableValue<TlsConfig>& AppConfig::tlsConfig() const
     return d_tlsConfig;
 }
 
+inline bool AppConfig::advertiseCompressionAlgorithms() const
+{
+    return d_advertiseCompressionAlgorithms;
+}
+
+inline bool AppConfig::advertiseTraceContext() const
+{
+    return d_advertiseTraceContext;
+}
+
+inline bool AppConfig::dispatcherCpuAccounting() const
+{
+    return d_dispatcherCpuAccounting;
+}
+
 // ------------------------
 // class ClustersDefinition
 // ------------------------
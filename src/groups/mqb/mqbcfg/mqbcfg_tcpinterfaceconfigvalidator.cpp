@@ -71,6 +71,15 @@ bool TcpInterfaceConfigValidator::isValidPort(
     return 0 <= listener.port() && listener.port() <= 65535;
 }
 
+bool TcpInterfaceConfigValidator::isValidAcceptShards(
+    const mqbcfg::TcpInterfaceListener& listener)
+{
+    // Sharded sockets bound to port 0 would each get a distinct ephemeral
+    // port.
+    return listener.acceptShards() == 1 ||
+           (listener.acceptShards() > 1 && listener.port() != 0);
+}
+
 TcpInterfaceConfigValidator::ErrorCode TcpInterfaceConfigValidator::operator()(
     const mqbcfg::TcpInterfaceConfig& config) const
 {
@@ -102,6 +111,15 @@ TcpInterfaceConfigValidator::ErrorCode TcpInterfaceConfigValidator::operator()(
         return k_PORT_RANGE;
     }
 
+    // Accept shards are positive, and only used on a fixed port
+    if (!bsl::all_of(first,
+                     last,
+                     TcpInterfaceConfigValidator::isValidAcceptShards)) {
+        BALL_LOG_ERROR << "TCP interface validation failed: Invalid number "
+                          "of accept shards specified";
+        return k_ACCEPT_SHARDS_RANGE;
+    }
+
     return k_OK;
 }
 
@@ -112,6 +112,41 @@ TEST(TcpInterfaceConfigValidatorTest, outOfRangePortsAreInvalid)
     }
 }
 
+TEST(TcpInterfaceConfigValidatorTest, invalidAcceptShardsAreInvalid)
+{
+    mqbcfg::TcpInterfaceConfigValidator validator;
+
+    {
+        mqbcfg::TcpInterfaceConfig    config;
+        mqbcfg::TcpInterfaceListener& listener =
+            config.listeners().emplace_back();
+        listener.port()         = 30114;
+        listener.acceptShards() = 0;
+        EXPECT_EQ(mqbcfg::TcpInterfaceConfigValidator::k_ACCEPT_SHARDS_RANGE,
+                  validator(config));
+    }
+
+    {
+        mqbcfg::TcpInterfaceConfig    config;
+        mqbcfg::TcpInterfaceListener& listener =
+            config.listeners().emplace_back();
+        listener.port()         = 0;
+        listener.acceptShards() = 4;
+        EXPECT_EQ(mqbcfg::TcpInterfaceConfigValidator::k_ACCEPT_SHARDS_RANGE,
+                  validator(config));
+    }
+
+    {
+        mqbcfg::TcpInterfaceConfig    config;
+        mqbcfg::TcpInterfaceListener& listener =
+            config.listeners().emplace_back();
+        listener.port()         = 30114;
+        listener.acceptShards() = 4;
+        EXPECT_EQ(mqbcfg::TcpInterfaceConfigValidator::k_OK,
+                  validator(config));
+    }
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
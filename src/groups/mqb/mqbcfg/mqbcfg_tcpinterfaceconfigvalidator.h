@@ -44,6 +44,9 @@ class TcpInterfaceConfigValidator {
 
     static bool isValidPort(const mqbcfg::TcpInterfaceListener& listener);
 
+    static bool
+    isValidAcceptShards(const mqbcfg::TcpInterfaceListener& listener);
+
   public:
     // TYPES
 
@@ -56,7 +59,10 @@ class TcpInterfaceConfigValidator {
         /// Indicates there were multiple interfaces using the same ports.
         k_DUPLICATE_PORT = -2,
         /// Indicates a port number was passed outside of the valid port range.
-        k_PORT_RANGE = -3
+        k_PORT_RANGE = -3,
+        /// Indicates a number of accept shards was not positive, or was
+        /// greater than one on an ephemeral port.
+        k_ACCEPT_SHARDS_RANGE = -4
     };
 
     // ACCESSORS
@@ -67,6 +73,8 @@ class TcpInterfaceConfigValidator {
     /// 1. The names of each network interface is unique
     /// 2. The ports of each network interface is unqiue
     /// 3. Ports passed are possible port values
+    /// 4. The number of accept shards of each network interface is positive,
+    ///    and is one if the port is ephemeral
     ///
     /// @returns An error code indicating success (`k_OK`) or a non-zero code
     /// indicating the cause of failure.
@@ -48,6 +48,13 @@ struct CommandDefinition {
     {"DOMAINS DOMAIN <name> INFOS",
      "Show information about domain 'name' and its queues",
      "Show information about domain 'name' and its queues"},
+    {"DOMAINS DOMAIN <name> INFOS [FILTER <substring>] <offset> <count>",
+     "Show information about domain 'name' and a page of its queues",
+     "Show information about domain 'name' and about 'count' of its queues "
+     "starting at 'offset', in queue URI order.  If 'FILTER' is specified, "
+     "only the queues whose URI contains 'substring' are considered, and "
+     "'offset' and 'count' may be omitted.  If 'count' is 'UNLIMITED', "
+     "show all the queues starting at 'offset'."},
     {"DOMAINS DOMAIN <name> QUEUE <queue_name> PURGE <appId>",
      "Purge the 'appId' in the 'queue_name' belonging to domain 'name'.",
      "Purge the 'appId' in the 'queue_name' belonging to domain 'name'. "
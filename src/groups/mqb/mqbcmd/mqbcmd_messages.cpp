@@ -1216,6 +1216,150 @@ Context::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     return stream;
 }
 
+// --------------------
+// class DomainInfoPage
+// --------------------
+
+// CONSTANTS
+
+const char DomainInfoPage::CLASS_NAME[] = "DomainInfoPage";
+
+const bdlat_AttributeInfo DomainInfoPage::ATTRIBUTE_INFO_ARRAY[] = {
+    {ATTRIBUTE_ID_QUEUE_FILTER,
+     "queueFilter",
+     sizeof("queueFilter") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT},
+    {ATTRIBUTE_ID_OFFSET,
+     "offset",
+     sizeof("offset") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC},
+    {ATTRIBUTE_ID_COUNT,
+     "count",
+     sizeof("count") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC}};
+
+// CLASS METHODS
+
+const bdlat_AttributeInfo*
+DomainInfoPage::lookupAttributeInfo(const char* name, int nameLength)
+{
+    for (int i = 0; i < 3; ++i) {
+        const bdlat_AttributeInfo& attributeInfo =
+            DomainInfoPage::ATTRIBUTE_INFO_ARRAY[i];
+
+        if (nameLength == attributeInfo.d_nameLength &&
+            0 == bsl::memcmp(attributeInfo.d_name_p, name, nameLength)) {
+            return &attributeInfo;
+        }
+    }
+
+    return 0;
+}
+
+const bdlat_AttributeInfo* DomainInfoPage::lookupAttributeInfo(int id)
+{
+    switch (id) {
+    case ATTRIBUTE_ID_QUEUE_FILTER:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_FILTER];
+    case ATTRIBUTE_ID_OFFSET:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_OFFSET];
+    case ATTRIBUTE_ID_COUNT:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COUNT];
+    default: return 0;
+    }
+}
+
+// CREATORS
+
+DomainInfoPage::DomainInfoPage(bslma::Allocator* basicAllocator)
+: d_queueFilter(basicAllocator)
+, d_offset()
+, d_count()
+{
+}
+
+DomainInfoPage::DomainInfoPage(const DomainInfoPage& original,
+                               bslma::Allocator*     basicAllocator)
+: d_queueFilter(original.d_queueFilter, basicAllocator)
+, d_offset(original.d_offset)
+, d_count(original.d_count)
+{
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+DomainInfoPage::DomainInfoPage(DomainInfoPage&& original) noexcept
+: d_queueFilter(bsl::move(original.d_queueFilter)),
+  d_offset(bsl::move(original.d_offset)),
+  d_count(bsl::move(original.d_count))
+{
+}
+
+DomainInfoPage::DomainInfoPage(DomainInfoPage&&  original,
+                               bslma::Allocator* basicAllocator)
+: d_queueFilter(bsl::move(original.d_queueFilter), basicAllocator)
+, d_offset(bsl::move(original.d_offset))
+, d_count(bsl::move(original.d_count))
+{
+}
+#endif
+
+DomainInfoPage::~DomainInfoPage()
+{
+}
+
+// MANIPULATORS
+
+DomainInfoPage& DomainInfoPage::operator=(const DomainInfoPage& rhs)
+{
+    if (this != &rhs) {
+        d_queueFilter = rhs.d_queueFilter;
+        d_offset      = rhs.d_offset;
+        d_count       = rhs.d_count;
+    }
+
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+DomainInfoPage& DomainInfoPage::operator=(DomainInfoPage&& rhs)
+{
+    if (this != &rhs) {
+        d_queueFilter = bsl::move(rhs.d_queueFilter);
+        d_offset      = bsl::move(rhs.d_offset);
+        d_count       = bsl::move(rhs.d_count);
+    }
+
+    return *this;
+}
+#endif
+
+void DomainInfoPage::reset()
+{
+    bdlat_ValueTypeFunctions::reset(&d_queueFilter);
+    bdlat_ValueTypeFunctions::reset(&d_offset);
+    bdlat_ValueTypeFunctions::reset(&d_count);
+}
+
+// ACCESSORS
+
+bsl::ostream& DomainInfoPage::print(bsl::ostream& stream,
+                                    int           level,
+                                    int           spacesPerLevel) const
+{
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("queueFilter", this->queueFilter());
+    printer.printAttribute("offset", this->offset());
+    printer.printAttribute("count", this->count());
+    printer.end();
+    return stream;
+}
+
 // -----------------------
 // class DomainReconfigure
 // -----------------------
@@ -13417,6 +13561,11 @@ const bdlat_SelectionInfo DomainCommand::SELECTION_INFO_ARRAY[] = {
      "queue",
      sizeof("queue") - 1,
      "",
+     bdlat_FormattingMode::e_DEFAULT},
+    {SELECTION_ID_INFO_PAGE,
+     "infoPage",
+     sizeof("infoPage") - 1,
+     "",
      bdlat_FormattingMode::e_DEFAULT}};
 
 // CLASS METHODS
@@ -13424,7 +13573,7 @@ const bdlat_SelectionInfo DomainCommand::SELECTION_INFO_ARRAY[] = {
 const bdlat_SelectionInfo* DomainCommand::lookupSelectionInfo(const char* name,
                                                               int nameLength)
 {
-    for (int i = 0; i < 3; ++i) {
+    for (int i = 0; i < 4; ++i) {
         const bdlat_SelectionInfo& selectionInfo =
             DomainCommand::SELECTION_INFO_ARRAY[i];
 
@@ -13445,6 +13594,8 @@ const bdlat_SelectionInfo* DomainCommand::lookupSelectionInfo(int id)
     case SELECTION_ID_INFO: return &SELECTION_INFO_ARRAY[SELECTION_INDEX_INFO];
     case SELECTION_ID_QUEUE:
         return &SELECTION_INFO_ARRAY[SELECTION_INDEX_QUEUE];
+    case SELECTION_ID_INFO_PAGE:
+        return &SELECTION_INFO_ARRAY[SELECTION_INDEX_INFO_PAGE];
     default: return 0;
     }
 }
@@ -13467,6 +13618,10 @@ DomainCommand::DomainCommand(const DomainCommand& original,
         new (d_queue.buffer())
             DomainQueue(original.d_queue.object(), d_allocator_p);
     } break;
+    case SELECTION_ID_INFO_PAGE: {
+        new (d_infoPage.buffer())
+            DomainInfoPage(original.d_infoPage.object(), d_allocator_p);
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -13488,6 +13643,11 @@ DomainCommand::DomainCommand(DomainCommand&& original) noexcept
         new (d_queue.buffer())
             DomainQueue(bsl::move(original.d_queue.object()), d_allocator_p);
     } break;
+    case SELECTION_ID_INFO_PAGE: {
+        new (d_infoPage.buffer())
+            DomainInfoPage(bsl::move(original.d_infoPage.object()),
+                           d_allocator_p);
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -13508,6 +13668,11 @@ DomainCommand::DomainCommand(DomainCommand&&   original,
         new (d_queue.buffer())
             DomainQueue(bsl::move(original.d_queue.object()), d_allocator_p);
     } break;
+    case SELECTION_ID_INFO_PAGE: {
+        new (d_infoPage.buffer())
+            DomainInfoPage(bsl::move(original.d_infoPage.object()),
+                           d_allocator_p);
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 }
@@ -13528,6 +13693,9 @@ DomainCommand& DomainCommand::operator=(const DomainCommand& rhs)
         case SELECTION_ID_QUEUE: {
             makeQueue(rhs.d_queue.object());
         } break;
+        case SELECTION_ID_INFO_PAGE: {
+            makeInfoPage(rhs.d_infoPage.object());
+        } break;
         default:
             BSLS_ASSERT(SELECTION_ID_UNDEFINED == rhs.d_selectionId);
             reset();
@@ -13552,6 +13720,9 @@ DomainCommand& DomainCommand::operator=(DomainCommand&& rhs)
         case SELECTION_ID_QUEUE: {
             makeQueue(bsl::move(rhs.d_queue.object()));
         } break;
+        case SELECTION_ID_INFO_PAGE: {
+            makeInfoPage(bsl::move(rhs.d_infoPage.object()));
+        } break;
         default:
             BSLS_ASSERT(SELECTION_ID_UNDEFINED == rhs.d_selectionId);
             reset();
@@ -13574,6 +13745,9 @@ void DomainCommand::reset()
     case SELECTION_ID_QUEUE: {
         d_queue.object().~DomainQueue();
     } break;
+    case SELECTION_ID_INFO_PAGE: {
+        d_infoPage.object().~DomainInfoPage();
+    } break;
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
     }
 
@@ -13592,6 +13766,9 @@ int DomainCommand::makeSelection(int selectionId)
     case SELECTION_ID_QUEUE: {
         makeQueue();
     } break;
+    case SELECTION_ID_INFO_PAGE: {
+        makeInfoPage();
+    } break;
     case SELECTION_ID_UNDEFINED: {
         reset();
     } break;
@@ -13746,6 +13923,52 @@ DomainQueue& DomainCommand::makeQueue(DomainQueue&& value)
 }
 #endif
 
+DomainInfoPage& DomainCommand::makeInfoPage()
+{
+    if (SELECTION_ID_INFO_PAGE == d_selectionId) {
+        bdlat_ValueTypeFunctions::reset(&d_infoPage.object());
+    }
+    else {
+        reset();
+        new (d_infoPage.buffer()) DomainInfoPage(d_allocator_p);
+        d_selectionId = SELECTION_ID_INFO_PAGE;
+    }
+
+    return d_infoPage.object();
+}
+
+DomainInfoPage& DomainCommand::makeInfoPage(const DomainInfoPage& value)
+{
+    if (SELECTION_ID_INFO_PAGE == d_selectionId) {
+        d_infoPage.object() = value;
+    }
+    else {
+        reset();
+        new (d_infoPage.buffer()) DomainInfoPage(value, d_allocator_p);
+        d_selectionId = SELECTION_ID_INFO_PAGE;
+    }
+
+    return d_infoPage.object();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+DomainInfoPage& DomainCommand::makeInfoPage(DomainInfoPage&& value)
+{
+    if (SELECTION_ID_INFO_PAGE == d_selectionId) {
+        d_infoPage.object() = bsl::move(value);
+    }
+    else {
+        reset();
+        new (d_infoPage.buffer())
+            DomainInfoPage(bsl::move(value), d_allocator_p);
+        d_selectionId = SELECTION_ID_INFO_PAGE;
+    }
+
+    return d_infoPage.object();
+}
+#endif
+
 // ACCESSORS
 
 bsl::ostream&
@@ -13763,6 +13986,9 @@ DomainCommand::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     case SELECTION_ID_QUEUE: {
         printer.printAttribute("queue", d_queue.object());
     } break;
+    case SELECTION_ID_INFO_PAGE: {
+        printer.printAttribute("infoPage", d_infoPage.object());
+    } break;
     default: stream << "SELECTION UNDEFINED\n";
     }
     printer.end();
@@ -13778,6 +14004,8 @@ const char* DomainCommand::selectionName() const
         return SELECTION_INFO_ARRAY[SELECTION_INDEX_INFO].name();
     case SELECTION_ID_QUEUE:
         return SELECTION_INFO_ARRAY[SELECTION_INDEX_QUEUE].name();
+    case SELECTION_ID_INFO_PAGE:
+        return SELECTION_INFO_ARRAY[SELECTION_INDEX_INFO_PAGE].name();
     default:
         BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId);
         return "(* UNDEFINED *)";
@@ -90,6 +90,9 @@ namespace mqbcmd {
 class Context;
 }
 namespace mqbcmd {
+class DomainInfoPage;
+}
+namespace mqbcmd {
 class DomainReconfigure;
 }
 namespace mqbcmd {
@@ -2342,6 +2345,246 @@ struct bdlat_UsesDefaultValueFlag<mqbcmd::Context> : bsl::true_type {};
 
 namespace mqbcmd {
 
+// ====================
+// class DomainInfoPage
+// ====================
+
+class DomainInfoPage {
+    // INSTANCE DATA
+    bdlb::NullableValue<bsl::string> d_queueFilter;
+    int                              d_offset;
+    int                              d_count;
+
+    // PRIVATE ACCESSORS
+    template <typename t_HASH_ALGORITHM>
+    void hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const;
+
+  public:
+    // TYPES
+    enum {
+        ATTRIBUTE_ID_QUEUE_FILTER = 0,
+        ATTRIBUTE_ID_OFFSET       = 1,
+        ATTRIBUTE_ID_COUNT        = 2
+    };
+
+    enum { NUM_ATTRIBUTES = 3 };
+
+    enum {
+        ATTRIBUTE_INDEX_QUEUE_FILTER = 0,
+        ATTRIBUTE_INDEX_OFFSET       = 1,
+        ATTRIBUTE_INDEX_COUNT        = 2
+    };
+
+    // CONSTANTS
+    static const char CLASS_NAME[];
+
+    static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
+
+  public:
+    // CLASS METHODS
+    static const bdlat_AttributeInfo* lookupAttributeInfo(int id);
+    // Return attribute information for the attribute indicated by the
+    // specified 'id' if the attribute exists, and 0 otherwise.
+
+    static const bdlat_AttributeInfo* lookupAttributeInfo(const char* name,
+                                                          int nameLength);
+    // Return attribute information for the attribute indicated by the
+    // specified 'name' of the specified 'nameLength' if the attribute
+    // exists, and 0 otherwise.
+
+    // CREATORS
+    explicit DomainInfoPage(bslma::Allocator* basicAllocator = 0);
+    // Create an object of type 'DomainInfoPage' having the default value.
+    // Use the optionally specified 'basicAllocator' to supply memory.  If
+    // 'basicAllocator' is 0, the currently installed default allocator is
+    // used.
+
+    DomainInfoPage(const DomainInfoPage& original,
+                   bslma::Allocator*     basicAllocator = 0);
+    // Create an object of type 'DomainInfoPage' having the value of the
+    // specified 'original' object.  Use the optionally specified
+    // 'basicAllocator' to supply memory.  If 'basicAllocator' is 0, the
+    // currently installed default allocator is used.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    DomainInfoPage(DomainInfoPage&& original) noexcept;
+    // Create an object of type 'DomainInfoPage' having the value of the
+    // specified 'original' object.  After performing this action, the
+    // 'original' object will be left in a valid, but unspecified state.
+
+    DomainInfoPage(DomainInfoPage&&  original,
+                   bslma::Allocator* basicAllocator);
+    // Create an object of type 'DomainInfoPage' having the value of the
+    // specified 'original' object.  After performing this action, the
+    // 'original' object will be left in a valid, but unspecified state.
+    // Use the optionally specified 'basicAllocator' to supply memory.  If
+    // 'basicAllocator' is 0, the currently installed default allocator is
+    // used.
+#endif
+
+    ~DomainInfoPage();
+    // Destroy this object.
+
+    // MANIPULATORS
+    DomainInfoPage& operator=(const DomainInfoPage& rhs);
+    // Assign to this object the value of the specified 'rhs' object.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    DomainInfoPage& operator=(DomainInfoPage&& rhs);
+    // Assign to this object the value of the specified 'rhs' object.
+    // After performing this action, the 'rhs' object will be left in a
+    // valid, but unspecified state.
+#endif
+
+    void reset();
+    // Reset this object to the default value (i.e., its value upon
+    // default construction).
+
+    template <typename t_MANIPULATOR>
+    int manipulateAttributes(t_MANIPULATOR& manipulator);
+    // Invoke the specified 'manipulator' sequentially on the address of
+    // each (modifiable) attribute of this object, supplying 'manipulator'
+    // with the corresponding attribute information structure until such
+    // invocation returns a non-zero value.  Return the value from the
+    // last invocation of 'manipulator' (i.e., the invocation that
+    // terminated the sequence).
+
+    template <typename t_MANIPULATOR>
+    int manipulateAttribute(t_MANIPULATOR& manipulator, int id);
+    // Invoke the specified 'manipulator' on the address of
+    // the (modifiable) attribute indicated by the specified 'id',
+    // supplying 'manipulator' with the corresponding attribute
+    // information structure.  Return the value returned from the
+    // invocation of 'manipulator' if 'id' identifies an attribute of this
+    // class, and -1 otherwise.
+
+    template <typename t_MANIPULATOR>
+    int manipulateAttribute(t_MANIPULATOR& manipulator,
+                            const char*    name,
+                            int            nameLength);
+    // Invoke the specified 'manipulator' on the address of
+    // the (modifiable) attribute indicated by the specified 'name' of the
+    // specified 'nameLength', supplying 'manipulator' with the
+    // corresponding attribute information structure.  Return the value
+    // returned from the invocation of 'manipulator' if 'name' identifies
+    // an attribute of this class, and -1 otherwise.
+
+    bdlb::NullableValue<bsl::string>& queueFilter();
+    // Return a reference to the modifiable "QueueFilter" attribute of this
+    // object.
+
+    int& offset();
+    // Return a reference to the modifiable "Offset" attribute of this
+    // object.
+
+    int& count();
+    // Return a reference to the modifiable "Count" attribute of this
+    // object.
+
+    // ACCESSORS
+    bsl::ostream&
+    print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
+    // Format this object to the specified output 'stream' at the
+    // optionally specified indentation 'level' and return a reference to
+    // the modifiable 'stream'.  If 'level' is specified, optionally
+    // specify 'spacesPerLevel', the number of spaces per indentation level
+    // for this and all of its nested objects.  Each line is indented by
+    // the absolute value of 'level * spacesPerLevel'.  If 'level' is
+    // negative, suppress indentation of the first line.  If
+    // 'spacesPerLevel' is negative, suppress line breaks and format the
+    // entire output on one line.  If 'stream' is initially invalid, this
+    // operation has no effect.  Note that a trailing newline is provided
+    // in multiline mode only.
+
+    template <typename t_ACCESSOR>
+    int accessAttributes(t_ACCESSOR& accessor) const;
+    // Invoke the specified 'accessor' sequentially on each
+    // (non-modifiable) attribute of this object, supplying 'accessor'
+    // with the corresponding attribute information structure until such
+    // invocation returns a non-zero value.  Return the value from the
+    // last invocation of 'accessor' (i.e., the invocation that terminated
+    // the sequence).
+
+    template <typename t_ACCESSOR>
+    int accessAttribute(t_ACCESSOR& accessor, int id) const;
+    // Invoke the specified 'accessor' on the (non-modifiable) attribute
+    // of this object indicated by the specified 'id', supplying 'accessor'
+    // with the corresponding attribute information structure.  Return the
+    // value returned from the invocation of 'accessor' if 'id' identifies
+    // an attribute of this class, and -1 otherwise.
+
+    template <typename t_ACCESSOR>
+    int accessAttribute(t_ACCESSOR& accessor,
+                        const char* name,
+                        int         nameLength) const;
+    // Invoke the specified 'accessor' on the (non-modifiable) attribute
+    // of this object indicated by the specified 'name' of the specified
+    // 'nameLength', supplying 'accessor' with the corresponding attribute
+    // information structure.  Return the value returned from the
+    // invocation of 'accessor' if 'name' identifies an attribute of this
+    // class, and -1 otherwise.
+
+    const bdlb::NullableValue<bsl::string>& queueFilter() const;
+    // Return a reference offering non-modifiable access to the "QueueFilter"
+    // attribute of this object.
+
+    int offset() const;
+    // Return the value of the "Offset" attribute of this object.
+
+    int count() const;
+    // Return the value of the "Count" attribute of this object.
+
+    // HIDDEN FRIENDS
+    friend bool operator==(const DomainInfoPage& lhs,
+                           const DomainInfoPage& rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' attribute objects
+    // have the same value, and 'false' otherwise.  Two attribute objects
+    // have the same value if each respective attribute has the same value.
+    {
+        return lhs.queueFilter() == rhs.queueFilter() &&
+               lhs.offset() == rhs.offset() && lhs.count() == rhs.count();
+    }
+
+    friend bool operator!=(const DomainInfoPage& lhs,
+                           const DomainInfoPage& rhs)
+    // Returns '!(lhs == rhs)'
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bsl::ostream& operator<<(bsl::ostream&         stream,
+                                    const DomainInfoPage& rhs)
+    // Format the specified 'rhs' to the specified output 'stream' and
+    // return a reference to the modifiable 'stream'.
+    {
+        return rhs.print(stream, 0, -1);
+    }
+
+    template <typename t_HASH_ALGORITHM>
+    friend void hashAppend(t_HASH_ALGORITHM&     hashAlg,
+                           const DomainInfoPage& object)
+    // Pass the specified 'object' to the specified 'hashAlg'.  This
+    // function integrates with the 'bslh' modular hashing system and
+    // effectively provides a 'bsl::hash' specialization for
+    // 'DomainInfoPage'.
+    {
+        object.hashAppendImpl(hashAlg);
+    }
+};
+
+}  // close package namespace
+
+// TRAITS
+
+BDLAT_DECL_SEQUENCE_WITH_ALLOCATOR_BITWISEMOVEABLE_TRAITS(
+    mqbcmd::DomainInfoPage);
+template <>
+struct bdlat_UsesDefaultValueFlag<mqbcmd::DomainInfoPage> : bsl::true_type {};
+
+namespace mqbcmd {
+
 // =======================
 // class DomainReconfigure
 // =======================
@@ -18480,9 +18723,10 @@ namespace mqbcmd {
 class DomainCommand {
     // INSTANCE DATA
     union {
-        bsls::ObjectBuffer<Void>        d_purge;
-        bsls::ObjectBuffer<Void>        d_info;
-        bsls::ObjectBuffer<DomainQueue> d_queue;
+        bsls::ObjectBuffer<Void>           d_purge;
+        bsls::ObjectBuffer<Void>           d_info;
+        bsls::ObjectBuffer<DomainQueue>    d_queue;
+        bsls::ObjectBuffer<DomainInfoPage> d_infoPage;
     };
 
     int               d_selectionId;
@@ -18501,15 +18745,17 @@ class DomainCommand {
         SELECTION_ID_UNDEFINED = -1,
         SELECTION_ID_PURGE     = 0,
         SELECTION_ID_INFO      = 1,
-        SELECTION_ID_QUEUE     = 2
+        SELECTION_ID_QUEUE     = 2,
+        SELECTION_ID_INFO_PAGE = 3
     };
 
-    enum { NUM_SELECTIONS = 3 };
+    enum { NUM_SELECTIONS = 4 };
 
     enum {
-        SELECTION_INDEX_PURGE = 0,
-        SELECTION_INDEX_INFO  = 1,
-        SELECTION_INDEX_QUEUE = 2
+        SELECTION_INDEX_PURGE     = 0,
+        SELECTION_INDEX_INFO      = 1,
+        SELECTION_INDEX_QUEUE     = 2,
+        SELECTION_INDEX_INFO_PAGE = 3
     };
 
     // CONSTANTS
@@ -18618,6 +18864,16 @@ class DomainCommand {
     // specify the 'value' of the "Queue".  If 'value' is not specified,
     // the default "Queue" value is used.
 
+    DomainInfoPage& makeInfoPage();
+    DomainInfoPage& makeInfoPage(const DomainInfoPage& value);
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES) &&               \
+    defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
+    DomainInfoPage& makeInfoPage(DomainInfoPage&& value);
+#endif
+    // Set the value of this object to be a "InfoPage" value.  Optionally
+    // specify the 'value' of the "InfoPage".  If 'value' is not specified,
+    // the default "InfoPage" value is used.
+
     template <typename t_MANIPULATOR>
     int manipulateSelection(t_MANIPULATOR& manipulator);
     // Invoke the specified 'manipulator' on the address of the modifiable
@@ -18641,6 +18897,11 @@ class DomainCommand {
     // object if "Queue" is the current selection.  The behavior is
     // undefined unless "Queue" is the selection of this object.
 
+    DomainInfoPage& infoPage();
+    // Return a reference to the modifiable "InfoPage" selection of this
+    // object if "InfoPage" is the current selection.  The behavior is
+    // undefined unless "InfoPage" is the selection of this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -18682,6 +18943,11 @@ class DomainCommand {
     // object if "Queue" is the current selection.  The behavior is
     // undefined unless "Queue" is the selection of this object.
 
+    const DomainInfoPage& infoPage() const;
+    // Return a reference to the non-modifiable "InfoPage" selection of
+    // this object if "InfoPage" is the current selection.  The behavior is
+    // undefined unless "InfoPage" is the selection of this object.
+
     bool isPurgeValue() const;
     // Return 'true' if the value of this object is a "Purge" value, and
     // return 'false' otherwise.
@@ -18694,6 +18960,10 @@ class DomainCommand {
     // Return 'true' if the value of this object is a "Queue" value, and
     // return 'false' otherwise.
 
+    bool isInfoPageValue() const;
+    // Return 'true' if the value of this object is a "InfoPage" value, and
+    // return 'false' otherwise.
+
     bool isUndefinedValue() const;
     // Return 'true' if the value of this object is undefined, and 'false'
     // otherwise.
@@ -33012,6 +33282,177 @@ inline const bsl::string& Context::queueHandleParametersJson() const
     return d_queueHandleParametersJson;
 }
 
+// --------------------
+// class DomainInfoPage
+// --------------------
+
+// PRIVATE ACCESSORS
+template <typename t_HASH_ALGORITHM>
+void DomainInfoPage::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
+{
+    using bslh::hashAppend;
+    hashAppend(hashAlgorithm, this->queueFilter());
+    hashAppend(hashAlgorithm, this->offset());
+    hashAppend(hashAlgorithm, this->count());
+}
+
+// CLASS METHODS
+// MANIPULATORS
+template <typename t_MANIPULATOR>
+int DomainInfoPage::manipulateAttributes(t_MANIPULATOR& manipulator)
+{
+    int ret;
+
+    ret = manipulator(&d_queueFilter,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_FILTER]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_offset, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_OFFSET]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_count, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COUNT]);
+    if (ret) {
+        return ret;
+    }
+
+    return 0;
+}
+
+template <typename t_MANIPULATOR>
+int DomainInfoPage::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
+{
+    enum { NOT_FOUND = -1 };
+
+    switch (id) {
+    case ATTRIBUTE_ID_QUEUE_FILTER: {
+        return manipulator(&d_queueFilter,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_FILTER]);
+    }
+    case ATTRIBUTE_ID_OFFSET: {
+        return manipulator(&d_offset,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_OFFSET]);
+    }
+    case ATTRIBUTE_ID_COUNT: {
+        return manipulator(&d_count,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COUNT]);
+    }
+    default: return NOT_FOUND;
+    }
+}
+
+template <typename t_MANIPULATOR>
+int DomainInfoPage::manipulateAttribute(t_MANIPULATOR& manipulator,
+                                        const char*    name,
+                                        int            nameLength)
+{
+    enum { NOT_FOUND = -1 };
+
+    const bdlat_AttributeInfo* attributeInfo = lookupAttributeInfo(name,
+                                                                   nameLength);
+    if (0 == attributeInfo) {
+        return NOT_FOUND;
+    }
+
+    return manipulateAttribute(manipulator, attributeInfo->d_id);
+}
+
+inline bdlb::NullableValue<bsl::string>& DomainInfoPage::queueFilter()
+{
+    return d_queueFilter;
+}
+
+inline int& DomainInfoPage::offset()
+{
+    return d_offset;
+}
+
+inline int& DomainInfoPage::count()
+{
+    return d_count;
+}
+
+// ACCESSORS
+template <typename t_ACCESSOR>
+int DomainInfoPage::accessAttributes(t_ACCESSOR& accessor) const
+{
+    int ret;
+
+    ret = accessor(d_queueFilter,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_FILTER]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_offset, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_OFFSET]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_count, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COUNT]);
+    if (ret) {
+        return ret;
+    }
+
+    return 0;
+}
+
+template <typename t_ACCESSOR>
+int DomainInfoPage::accessAttribute(t_ACCESSOR& accessor, int id) const
+{
+    enum { NOT_FOUND = -1 };
+
+    switch (id) {
+    case ATTRIBUTE_ID_QUEUE_FILTER: {
+        return accessor(d_queueFilter,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_QUEUE_FILTER]);
+    }
+    case ATTRIBUTE_ID_OFFSET: {
+        return accessor(d_offset,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_OFFSET]);
+    }
+    case ATTRIBUTE_ID_COUNT: {
+        return accessor(d_count, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COUNT]);
+    }
+    default: return NOT_FOUND;
+    }
+}
+
+template <typename t_ACCESSOR>
+int DomainInfoPage::accessAttribute(t_ACCESSOR& accessor,
+                                    const char* name,
+                                    int         nameLength) const
+{
+    enum { NOT_FOUND = -1 };
+
+    const bdlat_AttributeInfo* attributeInfo = lookupAttributeInfo(name,
+                                                                   nameLength);
+    if (0 == attributeInfo) {
+        return NOT_FOUND;
+    }
+
+    return accessAttribute(accessor, attributeInfo->d_id);
+}
+
+inline const bdlb::NullableValue<bsl::string>&
+DomainInfoPage::queueFilter() const
+{
+    return d_queueFilter;
+}
+
+inline int DomainInfoPage::offset() const
+{
+    return d_offset;
+}
+
+inline int DomainInfoPage::count() const
+{
+    return d_count;
+}
+
 // -----------------------
 // class DomainReconfigure
 // -----------------------
@@ -44581,6 +45022,9 @@ void DomainCommand::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     case Class::SELECTION_ID_QUEUE:
         hashAppend(hashAlgorithm, this->queue());
         break;
+    case Class::SELECTION_ID_INFO_PAGE:
+        hashAppend(hashAlgorithm, this->infoPage());
+        break;
     default: BSLS_ASSERT(this->selectionId() == Class::SELECTION_ID_UNDEFINED);
     }
 }
@@ -44593,6 +45037,8 @@ inline bool DomainCommand::isEqualTo(const DomainCommand& rhs) const
         case Class::SELECTION_ID_PURGE: return this->purge() == rhs.purge();
         case Class::SELECTION_ID_INFO: return this->info() == rhs.info();
         case Class::SELECTION_ID_QUEUE: return this->queue() == rhs.queue();
+        case Class::SELECTION_ID_INFO_PAGE:
+            return this->infoPage() == rhs.infoPage();
         default:
             BSLS_ASSERT(Class::SELECTION_ID_UNDEFINED == rhs.selectionId());
             return true;
@@ -44629,6 +45075,9 @@ int DomainCommand::manipulateSelection(t_MANIPULATOR& manipulator)
     case DomainCommand::SELECTION_ID_QUEUE:
         return manipulator(&d_queue.object(),
                            SELECTION_INFO_ARRAY[SELECTION_INDEX_QUEUE]);
+    case DomainCommand::SELECTION_ID_INFO_PAGE:
+        return manipulator(&d_infoPage.object(),
+                           SELECTION_INFO_ARRAY[SELECTION_INDEX_INFO_PAGE]);
     default:
         BSLS_ASSERT(DomainCommand::SELECTION_ID_UNDEFINED == d_selectionId);
         return -1;
@@ -44653,6 +45102,12 @@ inline DomainQueue& DomainCommand::queue()
     return d_queue.object();
 }
 
+inline DomainInfoPage& DomainCommand::infoPage()
+{
+    BSLS_ASSERT(SELECTION_ID_INFO_PAGE == d_selectionId);
+    return d_infoPage.object();
+}
+
 // ACCESSORS
 inline int DomainCommand::selectionId() const
 {
@@ -44672,6 +45127,9 @@ int DomainCommand::accessSelection(t_ACCESSOR& accessor) const
     case SELECTION_ID_QUEUE:
         return accessor(d_queue.object(),
                         SELECTION_INFO_ARRAY[SELECTION_INDEX_QUEUE]);
+    case SELECTION_ID_INFO_PAGE:
+        return accessor(d_infoPage.object(),
+                        SELECTION_INFO_ARRAY[SELECTION_INDEX_INFO_PAGE]);
     default: BSLS_ASSERT(SELECTION_ID_UNDEFINED == d_selectionId); return -1;
     }
 }
@@ -44694,6 +45152,12 @@ inline const DomainQueue& DomainCommand::queue() const
     return d_queue.object();
 }
 
+inline const DomainInfoPage& DomainCommand::infoPage() const
+{
+    BSLS_ASSERT(SELECTION_ID_INFO_PAGE == d_selectionId);
+    return d_infoPage.object();
+}
+
 inline bool DomainCommand::isPurgeValue() const
 {
     return SELECTION_ID_PURGE == d_selectionId;
@@ -44709,6 +45173,11 @@ inline bool DomainCommand::isQueueValue() const
     return SELECTION_ID_QUEUE == d_selectionId;
 }
 
+inline bool DomainCommand::isInfoPageValue() const
+{
+    return SELECTION_ID_INFO_PAGE == d_selectionId;
+}
+
 inline bool DomainCommand::isUndefinedValue() const
 {
     return SELECTION_ID_UNDEFINED == d_selectionId;
@@ -192,6 +192,7 @@ DEF_FUNC(Command, Command);
 DEF_FUNC(Help, HelpCommand);
 DEF_FUNC(DomainsCommand, DomainsCommand);
 DEF_FUNC(DomainCommand, Domain);
+DEF_FUNC(DomainInfos, DomainCommand);
 DEF_FUNC(DomainQueue, DomainQueue);
 DEF_FUNC(DomainQueuePurge, QueueCommand);
 DEF_FUNC(DomainQueueList, ListMessages);
@@ -406,8 +407,7 @@ int parseDomainCommand(Domain* domain, bsl::string* error, WordGenerator next)
         return expectEnd(error, next);  // RETURN
     }
     else if (equalCaseless(subCommand, "INFOS")) {
-        domain->command().makeInfo();
-        return expectEnd(error, next);  // RETURN
+        return parseDomainInfos(&domain->command(), error, next);  // RETURN
     }
     else if (equalCaseless(subCommand, "QUEUE")) {
         return parseDomainQueue(&domain->command().makeQueue(), error, next);
@@ -418,6 +418,60 @@ int parseDomainCommand(Domain* domain, bsl::string* error, WordGenerator next)
     return -1;
 }
 
+/// DOMAINS DOMAIN <name> INFOS [FILTER <substring>] [<offset> <count>]
+int parseDomainInfos(DomainCommand* command,
+                     bsl::string*   error,
+                     WordGenerator  next)
+{
+    bslstl::StringRef word = next();
+
+    if (word.empty()) {
+        // No paging nor filtering: the whole domain information
+        command->makeInfo();
+        return 0;  // RETURN
+    }
+
+    DomainInfoPage& page = command->makeInfoPage();
+
+    if (equalCaseless(word, "FILTER")) {
+        const bslstl::StringRef filter = next();
+        if (filter.empty()) {
+            *error = "DOMAINS DOMAIN <name> INFOS FILTER must be followed by "
+                     "a queue name substring.";
+            return -1;  // RETURN
+        }
+
+        page.queueFilter() = filter;
+
+        word = next();
+        if (word.empty()) {
+            // Filtered, but not paged
+            return 0;  // RETURN
+        }
+    }
+
+    const bslstl::StringRef countString = next();
+
+    if (parseInt(&page.offset(), word) || page.offset() < 0) {
+        *error = "Invalid <offset> for DOMAINS DOMAIN <name> INFOS "
+                 "[FILTER <substring>] <offset> <count>: " +
+                 word;
+        return -1;  // RETURN
+    }
+
+    if (equalCaseless(countString, "unlimited")) {
+        page.count() = 0;
+    }
+    else if (parseInt(&page.count(), countString) || page.count() < 0) {
+        *error = "Invalid <count> for DOMAINS DOMAIN <name> INFOS "
+                 "[FILTER <substring>] <offset> <count>: " +
+                 countString;
+        return -1;  // RETURN
+    }
+
+    return expectEnd(error, next);
+}
+
 /// DOMAINS DOMAIN <name> QUEUE ...
 int parseDomainQueue(DomainQueue*  queue,
                      bsl::string*  error,
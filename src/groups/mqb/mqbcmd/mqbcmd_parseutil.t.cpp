@@ -140,6 +140,33 @@ const Test k_TESTS[] = {
      "DOMAINS DOMAIN foo INFOS",
      "{\"domains\": {\"domain\": {\"name\": \"foo\", \"command\": {\"info\""
      ": {}}}}}"},
+    {__LINE__,
+     "page of the domain-specific information",
+     "DOMAINS DOMAIN foo INFOS 100 50",
+     "{\"domains\": {\"domain\": {\"name\": \"foo\", \"command\": {\"info"
+     "Page\": {\"offset\": 100, \"count\": 50}}}}}"},
+    {__LINE__,
+     "filtered page of the domain-specific information",
+     "DOMAINS DOMAIN foo INFOS FILTER bar 0 unlimited",
+     "{\"domains\": {\"domain\": {\"name\": \"foo\", \"command\": {\"info"
+     "Page\": {\"queueFilter\": \"bar\", \"offset\": 0, \"count\": 0}}}}}"},
+    {__LINE__,
+     "in DOMAINS DOMAIN ... INFOS FILTER ... <offset> <count> are optional",
+     "DOMAINS DOMAIN foo INFOS FILTER bar",
+     "{\"domains\": {\"domain\": {\"name\": \"foo\", \"command\": {\"info"
+     "Page\": {\"queueFilter\": \"bar\", \"offset\": 0, \"count\": 0}}}}}"},
+    {__LINE__,
+     "DOMAINS DOMAIN <name> INFOS FILTER requires a substring",
+     "DOMAINS DOMAIN foo INFOS FILTER",
+     0},
+    {__LINE__,
+     "in DOMAINS DOMAIN ... INFOS <offset> must be non-negative",
+     "DOMAINS DOMAIN foo INFOS -1 10",
+     0},
+    {__LINE__,
+     "in DOMAINS DOMAIN ... INFOS <offset> <count> both required",
+     "DOMAINS DOMAIN foo INFOS 10",
+     0},
     {__LINE__,
      "DOMAINS DOMAIN <name> QUEUE command requires queue name",
      "DOMAINS DOMAIN foo QUEUE",
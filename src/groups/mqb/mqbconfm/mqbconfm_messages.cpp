@@ -515,6 +515,8 @@ const char QueueModeFanout::CLASS_NAME[] = "QueueModeFanout";
 
 const bool QueueModeFanout::DEFAULT_INITIALIZER_PUBLISH_APP_ID_METRICS = true;
 
+const int QueueModeFanout::DEFAULT_INITIALIZER_MAX_APP_ID_METRICS = 0;
+
 const bdlat_AttributeInfo QueueModeFanout::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_APP_I_DS,
      "appIDs",
@@ -525,14 +527,19 @@ const bdlat_AttributeInfo QueueModeFanout::ATTRIBUTE_INFO_ARRAY[] = {
      "publishAppIdMetrics",
      sizeof("publishAppIdMetrics") - 1,
      "",
-     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_MAX_APP_ID_METRICS,
+     "maxAppIdMetrics",
+     sizeof("maxAppIdMetrics") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo*
 QueueModeFanout::lookupAttributeInfo(const char* name, int nameLength)
 {
-    for (int i = 0; i < 2; ++i) {
+    for (int i = 0; i < 3; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             QueueModeFanout::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -552,6 +559,8 @@ const bdlat_AttributeInfo* QueueModeFanout::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_APP_I_DS];
     case ATTRIBUTE_ID_PUBLISH_APP_ID_METRICS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUBLISH_APP_ID_METRICS];
+    case ATTRIBUTE_ID_MAX_APP_ID_METRICS:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_APP_ID_METRICS];
     default: return 0;
     }
 }
@@ -560,6 +569,7 @@ const bdlat_AttributeInfo* QueueModeFanout::lookupAttributeInfo(int id)
 
 QueueModeFanout::QueueModeFanout(bslma::Allocator* basicAllocator)
 : d_appIDs(basicAllocator)
+, d_maxAppIdMetrics(DEFAULT_INITIALIZER_MAX_APP_ID_METRICS)
 , d_publishAppIdMetrics(DEFAULT_INITIALIZER_PUBLISH_APP_ID_METRICS)
 {
 }
@@ -567,6 +577,7 @@ QueueModeFanout::QueueModeFanout(bslma::Allocator* basicAllocator)
 QueueModeFanout::QueueModeFanout(const QueueModeFanout& original,
                                  bslma::Allocator*      basicAllocator)
 : d_appIDs(original.d_appIDs, basicAllocator)
+, d_maxAppIdMetrics(original.d_maxAppIdMetrics)
 , d_publishAppIdMetrics(original.d_publishAppIdMetrics)
 {
 }
@@ -575,6 +586,7 @@ QueueModeFanout::QueueModeFanout(const QueueModeFanout& original,
     defined(BSLS_COMPILERFEATURES_SUPPORT_NOEXCEPT)
 QueueModeFanout::QueueModeFanout(QueueModeFanout&& original) noexcept
 : d_appIDs(bsl::move(original.d_appIDs)),
+  d_maxAppIdMetrics(bsl::move(original.d_maxAppIdMetrics)),
   d_publishAppIdMetrics(bsl::move(original.d_publishAppIdMetrics))
 {
 }
@@ -582,6 +594,7 @@ QueueModeFanout::QueueModeFanout(QueueModeFanout&& original) noexcept
 QueueModeFanout::QueueModeFanout(QueueModeFanout&& original,
                                  bslma::Allocator* basicAllocator)
 : d_appIDs(bsl::move(original.d_appIDs), basicAllocator)
+, d_maxAppIdMetrics(bsl::move(original.d_maxAppIdMetrics))
 , d_publishAppIdMetrics(bsl::move(original.d_publishAppIdMetrics))
 {
 }
@@ -598,6 +611,7 @@ QueueModeFanout& QueueModeFanout::operator=(const QueueModeFanout& rhs)
     if (this != &rhs) {
         d_appIDs              = rhs.d_appIDs;
         d_publishAppIdMetrics = rhs.d_publishAppIdMetrics;
+        d_maxAppIdMetrics     = rhs.d_maxAppIdMetrics;
     }
 
     return *this;
@@ -610,6 +624,7 @@ QueueModeFanout& QueueModeFanout::operator=(QueueModeFanout&& rhs)
     if (this != &rhs) {
         d_appIDs              = bsl::move(rhs.d_appIDs);
         d_publishAppIdMetrics = bsl::move(rhs.d_publishAppIdMetrics);
+        d_maxAppIdMetrics     = bsl::move(rhs.d_maxAppIdMetrics);
     }
 
     return *this;
@@ -620,6 +635,7 @@ void QueueModeFanout::reset()
 {
     bdlat_ValueTypeFunctions::reset(&d_appIDs);
     d_publishAppIdMetrics = DEFAULT_INITIALIZER_PUBLISH_APP_ID_METRICS;
+    d_maxAppIdMetrics     = DEFAULT_INITIALIZER_MAX_APP_ID_METRICS;
 }
 
 // ACCESSORS
@@ -632,6 +648,7 @@ bsl::ostream& QueueModeFanout::print(bsl::ostream& stream,
     printer.start();
     printer.printAttribute("appIDs", this->appIDs());
     printer.printAttribute("publishAppIdMetrics", this->publishAppIdMetrics());
+    printer.printAttribute("maxAppIdMetrics", this->maxAppIdMetrics());
     printer.end();
     return stream;
 }
@@ -2034,6 +2051,14 @@ const int Domain::DEFAULT_INITIALIZER_MAX_DELIVERY_ATTEMPTS = 0;
 
 const int Domain::DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS = 300000;
 
+const int Domain::DEFAULT_INITIALIZER_MAX_PUT_RATE = 0;
+
+const int Domain::DEFAULT_INITIALIZER_DELIVERY_DELAY = 0;
+
+const char Domain::DEFAULT_INITIALIZER_COMPACTION_KEY[] = "";
+
+const char Domain::DEFAULT_INITIALIZER_PRIORITY_PROPERTY[] = "";
+
 const bdlat_AttributeInfo Domain::ATTRIBUTE_INFO_ARRAY[] = {
     {ATTRIBUTE_ID_NAME,
      "name",
@@ -2099,14 +2124,34 @@ const bdlat_AttributeInfo Domain::ATTRIBUTE_INFO_ARRAY[] = {
      "subscriptions",
      sizeof("subscriptions") - 1,
      "",
-     bdlat_FormattingMode::e_DEFAULT}};
+     bdlat_FormattingMode::e_DEFAULT},
+    {ATTRIBUTE_ID_MAX_PUT_RATE,
+     "maxPutRate",
+     sizeof("maxPutRate") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE}},
+    {ATTRIBUTE_ID_DELIVERY_DELAY,
+     "deliveryDelay",
+     sizeof("deliveryDelay") - 1,
+     "",
+     bdlat_FormattingMode::e_DEC | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_COMPACTION_KEY,
+     "compactionKey",
+     sizeof("compactionKey") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE},
+    {ATTRIBUTE_ID_PRIORITY_PROPERTY,
+     "priorityProperty",
+     sizeof("priorityProperty") - 1,
+     "",
+     bdlat_FormattingMode::e_TEXT | bdlat_FormattingMode::e_DEFAULT_VALUE}};
 
 // CLASS METHODS
 
 const bdlat_AttributeInfo* Domain::lookupAttributeInfo(const char* name,
                                                        int         nameLength)
 {
-    for (int i = 0; i < 13; ++i) {
+    for (int i = 0; i < 17; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
             Domain::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -2146,6 +2191,14 @@ const bdlat_AttributeInfo* Domain::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_CONSISTENCY];
     case ATTRIBUTE_ID_SUBSCRIPTIONS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS];
+    case ATTRIBUTE_ID_MAX_PUT_RATE:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_PUT_RATE];
+    case ATTRIBUTE_ID_DELIVERY_DELAY:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DELIVERY_DELAY];
+    case ATTRIBUTE_ID_COMPACTION_KEY:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPACTION_KEY];
+    case ATTRIBUTE_ID_PRIORITY_PROPERTY:
+        return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRIORITY_PROPERTY];
     default: return 0;
     }
 }
@@ -2156,6 +2209,8 @@ Domain::Domain(bslma::Allocator* basicAllocator)
 : d_messageTtl()
 , d_subscriptions(basicAllocator)
 , d_name(basicAllocator)
+, d_compactionKey(DEFAULT_INITIALIZER_COMPACTION_KEY, basicAllocator)
+, d_priorityProperty(DEFAULT_INITIALIZER_PRIORITY_PROPERTY, basicAllocator)
 , d_msgGroupIdConfig()
 , d_storage()
 , d_mode(basicAllocator)
@@ -2166,6 +2221,8 @@ Domain::Domain(bslma::Allocator* basicAllocator)
 , d_maxIdleTime(DEFAULT_INITIALIZER_MAX_IDLE_TIME)
 , d_maxDeliveryAttempts(DEFAULT_INITIALIZER_MAX_DELIVERY_ATTEMPTS)
 , d_deduplicationTimeMs(DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS)
+, d_maxPutRate(DEFAULT_INITIALIZER_MAX_PUT_RATE)
+, d_deliveryDelay(DEFAULT_INITIALIZER_DELIVERY_DELAY)
 {
 }
 
@@ -2173,6 +2230,8 @@ Domain::Domain(const Domain& original, bslma::Allocator* basicAllocator)
 : d_messageTtl(original.d_messageTtl)
 , d_subscriptions(original.d_subscriptions, basicAllocator)
 , d_name(original.d_name, basicAllocator)
+, d_compactionKey(original.d_compactionKey, basicAllocator)
+, d_priorityProperty(original.d_priorityProperty, basicAllocator)
 , d_msgGroupIdConfig(original.d_msgGroupIdConfig)
 , d_storage(original.d_storage)
 , d_mode(original.d_mode, basicAllocator)
@@ -2183,6 +2242,8 @@ Domain::Domain(const Domain& original, bslma::Allocator* basicAllocator)
 , d_maxIdleTime(original.d_maxIdleTime)
 , d_maxDeliveryAttempts(original.d_maxDeliveryAttempts)
 , d_deduplicationTimeMs(original.d_deduplicationTimeMs)
+, d_maxPutRate(original.d_maxPutRate)
+, d_deliveryDelay(original.d_deliveryDelay)
 {
 }
 
@@ -2192,6 +2253,8 @@ Domain::Domain(Domain&& original) noexcept
 : d_messageTtl(bsl::move(original.d_messageTtl)),
   d_subscriptions(bsl::move(original.d_subscriptions)),
   d_name(bsl::move(original.d_name)),
+  d_compactionKey(bsl::move(original.d_compactionKey)),
+  d_priorityProperty(bsl::move(original.d_priorityProperty)),
   d_msgGroupIdConfig(bsl::move(original.d_msgGroupIdConfig)),
   d_storage(bsl::move(original.d_storage)),
   d_mode(bsl::move(original.d_mode)),
@@ -2201,7 +2264,9 @@ Domain::Domain(Domain&& original) noexcept
   d_maxQueues(bsl::move(original.d_maxQueues)),
   d_maxIdleTime(bsl::move(original.d_maxIdleTime)),
   d_maxDeliveryAttempts(bsl::move(original.d_maxDeliveryAttempts)),
-  d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs))
+  d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs)),
+  d_maxPutRate(bsl::move(original.d_maxPutRate)),
+  d_deliveryDelay(bsl::move(original.d_deliveryDelay))
 {
 }
 
@@ -2209,6 +2274,8 @@ Domain::Domain(Domain&& original, bslma::Allocator* basicAllocator)
 : d_messageTtl(bsl::move(original.d_messageTtl))
 , d_subscriptions(bsl::move(original.d_subscriptions), basicAllocator)
 , d_name(bsl::move(original.d_name), basicAllocator)
+, d_compactionKey(bsl::move(original.d_compactionKey), basicAllocator)
+, d_priorityProperty(bsl::move(original.d_priorityProperty), basicAllocator)
 , d_msgGroupIdConfig(bsl::move(original.d_msgGroupIdConfig))
 , d_storage(bsl::move(original.d_storage))
 , d_mode(bsl::move(original.d_mode), basicAllocator)
@@ -2219,6 +2286,8 @@ Domain::Domain(Domain&& original, bslma::Allocator* basicAllocator)
 , d_maxIdleTime(bsl::move(original.d_maxIdleTime))
 , d_maxDeliveryAttempts(bsl::move(original.d_maxDeliveryAttempts))
 , d_deduplicationTimeMs(bsl::move(original.d_deduplicationTimeMs))
+, d_maxPutRate(bsl::move(original.d_maxPutRate))
+, d_deliveryDelay(bsl::move(original.d_deliveryDelay))
 {
 }
 #endif
@@ -2245,6 +2314,10 @@ Domain& Domain::operator=(const Domain& rhs)
         d_deduplicationTimeMs = rhs.d_deduplicationTimeMs;
         d_consistency         = rhs.d_consistency;
         d_subscriptions       = rhs.d_subscriptions;
+        d_maxPutRate          = rhs.d_maxPutRate;
+        d_deliveryDelay       = rhs.d_deliveryDelay;
+        d_compactionKey       = rhs.d_compactionKey;
+        d_priorityProperty    = rhs.d_priorityProperty;
     }
 
     return *this;
@@ -2268,6 +2341,10 @@ Domain& Domain::operator=(Domain&& rhs)
         d_deduplicationTimeMs = bsl::move(rhs.d_deduplicationTimeMs);
         d_consistency         = bsl::move(rhs.d_consistency);
         d_subscriptions       = bsl::move(rhs.d_subscriptions);
+        d_maxPutRate          = bsl::move(rhs.d_maxPutRate);
+        d_deliveryDelay       = bsl::move(rhs.d_deliveryDelay);
+        d_compactionKey       = bsl::move(rhs.d_compactionKey);
+        d_priorityProperty    = bsl::move(rhs.d_priorityProperty);
     }
 
     return *this;
@@ -2289,6 +2366,10 @@ void Domain::reset()
     d_deduplicationTimeMs = DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS;
     bdlat_ValueTypeFunctions::reset(&d_consistency);
     bdlat_ValueTypeFunctions::reset(&d_subscriptions);
+    d_maxPutRate       = DEFAULT_INITIALIZER_MAX_PUT_RATE;
+    d_deliveryDelay    = DEFAULT_INITIALIZER_DELIVERY_DELAY;
+    d_compactionKey    = DEFAULT_INITIALIZER_COMPACTION_KEY;
+    d_priorityProperty = DEFAULT_INITIALIZER_PRIORITY_PROPERTY;
 }
 
 // ACCESSORS
@@ -2311,6 +2392,10 @@ Domain::print(bsl::ostream& stream, int level, int spacesPerLevel) const
     printer.printAttribute("deduplicationTimeMs", this->deduplicationTimeMs());
     printer.printAttribute("consistency", this->consistency());
     printer.printAttribute("subscriptions", this->subscriptions());
+    printer.printAttribute("maxPutRate", this->maxPutRate());
+    printer.printAttribute("deliveryDelay", this->deliveryDelay());
+    printer.printAttribute("compactionKey", this->compactionKey());
+    printer.printAttribute("priorityProperty", this->priorityProperty());
     printer.end();
     return stream;
 }
@@ -713,7 +713,8 @@ class MsgGroupIdConfig {
     // intentions is _not_ to give customers full control over those numbers.
     // Their role is to protect BlazingMQ from abuse i.e.  cases of infinite
     // Group Ids being stored.  Another assumption is that 'maxGroups >> number
-    // of consumers'.
+    // of consumers'.  Note that the broker does not currently route messages
+    // by Group Id: this configuration is accepted but has no effect.
     // rebalance..: groups will be dynamically rebalanced in way such that all
     // consumers have equal share of Group Ids assigned to them maxGroups..:
     // Maximum number of groups.  If the number of groups gets larger than
@@ -1389,23 +1390,29 @@ class QueueModeFanout {
     // Configuration for a fanout queue.
     // appIDs.............: List of appIDs authorized to consume from the
     // queue.  publishAppIdMetrics: Whether to publish appId metrics.
+    // maxAppIdMetrics....: maximum number of appIds, those with the largest
+    // backlog, for which metrics are published individually, the metrics of
+    // the other appIds being aggregated.  0 (the default) means unlimited
 
     // INSTANCE DATA
     bsl::vector<bsl::string> d_appIDs;
+    int                      d_maxAppIdMetrics;
     bool                     d_publishAppIdMetrics;
 
   public:
     // TYPES
     enum {
         ATTRIBUTE_ID_APP_I_DS               = 0,
-        ATTRIBUTE_ID_PUBLISH_APP_ID_METRICS = 1
+        ATTRIBUTE_ID_PUBLISH_APP_ID_METRICS = 1,
+        ATTRIBUTE_ID_MAX_APP_ID_METRICS     = 2
     };
 
-    enum { NUM_ATTRIBUTES = 2 };
+    enum { NUM_ATTRIBUTES = 3 };
 
     enum {
         ATTRIBUTE_INDEX_APP_I_DS               = 0,
-        ATTRIBUTE_INDEX_PUBLISH_APP_ID_METRICS = 1
+        ATTRIBUTE_INDEX_PUBLISH_APP_ID_METRICS = 1,
+        ATTRIBUTE_INDEX_MAX_APP_ID_METRICS     = 2
     };
 
     // CONSTANTS
@@ -1413,6 +1420,8 @@ class QueueModeFanout {
 
     static const bool DEFAULT_INITIALIZER_PUBLISH_APP_ID_METRICS;
 
+    static const int DEFAULT_INITIALIZER_MAX_APP_ID_METRICS;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -1514,6 +1523,10 @@ class QueueModeFanout {
     // Return a reference to the modifiable "PublishAppIdMetrics" attribute
     // of this object.
 
+    int& maxAppIdMetrics();
+    // Return a reference to the modifiable "MaxAppIdMetrics" attribute of
+    // this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -1565,6 +1578,9 @@ class QueueModeFanout {
     // Return the value of the "PublishAppIdMetrics" attribute of this
     // object.
 
+    int maxAppIdMetrics() const;
+    // Return the value of the "MaxAppIdMetrics" attribute of this object.
+
     // HIDDEN FRIENDS
     friend bool operator==(const QueueModeFanout& lhs,
                            const QueueModeFanout& rhs)
@@ -1573,7 +1589,8 @@ class QueueModeFanout {
     // have the same value if each respective attribute has the same value.
     {
         return lhs.appIDs() == rhs.appIDs() &&
-               lhs.publishAppIdMetrics() == rhs.publishAppIdMetrics();
+               lhs.publishAppIdMetrics() == rhs.publishAppIdMetrics() &&
+               lhs.maxAppIdMetrics() == rhs.maxAppIdMetrics();
     }
 
     friend bool operator!=(const QueueModeFanout& lhs,
@@ -1602,6 +1619,7 @@ class QueueModeFanout {
         using bslh::hashAppend;
         hashAppend(hashAlg, object.appIDs());
         hashAppend(hashAlg, object.publishAppIdMetrics());
+        hashAppend(hashAlg, object.maxAppIdMetrics());
     }
 };
 
@@ -3190,11 +3208,27 @@ class Domain {
     // timeout, in milliseconds, to keep GUID of PUT message for the purpose of
     // detecting duplicate PUTs.  consistency.........: optional consistency
     // mode.  subscriptions.......: optional application subscriptions
+    // maxPutRate..........: maximum number of PUT messages per second each
+    // producer may post to a queue of this domain, PUT messages in excess
+    // being rejected.  0 (the default) means unlimited
+    // deliveryDelay.......: (seconds) minimum time after its arrival before
+    // which a message is delivered to consumers.  0 (the default) means
+    // immediate delivery compactionKey.......: name of the message property
+    // identifying the entity a message is an update of.  When not empty, a
+    // message superseded by a newer message having the same value of this
+    // property is removed from the queue, so that consumers only receive the
+    // latest value per entity.  Empty (the default) disables compaction
+    // priorityProperty....: name of the integer message property selecting
+    // the priority level, from 0 (the default) to 3, of a message.  When
+    // not empty, messages of higher levels are delivered first to consumers
+    // lagging behind.  Empty (the default) disables priorities
 
     // INSTANCE DATA
     bsls::Types::Int64                    d_messageTtl;
     bsl::vector<Subscription>             d_subscriptions;
     bsl::string                           d_name;
+    bsl::string                           d_compactionKey;
+    bsl::string                           d_priorityProperty;
     bdlb::NullableValue<MsgGroupIdConfig> d_msgGroupIdConfig;
     StorageDefinition                     d_storage;
     QueueMode                             d_mode;
@@ -3205,6 +3239,8 @@ class Domain {
     int                                   d_maxIdleTime;
     int                                   d_maxDeliveryAttempts;
     int                                   d_deduplicationTimeMs;
+    int                                   d_maxPutRate;
+    int                                   d_deliveryDelay;
 
     // PRIVATE ACCESSORS
     template <typename t_HASH_ALGORITHM>
@@ -3227,10 +3263,14 @@ class Domain {
         ATTRIBUTE_ID_MAX_DELIVERY_ATTEMPTS = 9,
         ATTRIBUTE_ID_DEDUPLICATION_TIME_MS = 10,
         ATTRIBUTE_ID_CONSISTENCY           = 11,
-        ATTRIBUTE_ID_SUBSCRIPTIONS         = 12
+        ATTRIBUTE_ID_SUBSCRIPTIONS         = 12,
+        ATTRIBUTE_ID_MAX_PUT_RATE          = 13,
+        ATTRIBUTE_ID_DELIVERY_DELAY        = 14,
+        ATTRIBUTE_ID_COMPACTION_KEY        = 15,
+        ATTRIBUTE_ID_PRIORITY_PROPERTY     = 16
     };
 
-    enum { NUM_ATTRIBUTES = 13 };
+    enum { NUM_ATTRIBUTES = 17 };
 
     enum {
         ATTRIBUTE_INDEX_NAME                  = 0,
@@ -3245,7 +3285,11 @@ class Domain {
         ATTRIBUTE_INDEX_MAX_DELIVERY_ATTEMPTS = 9,
         ATTRIBUTE_INDEX_DEDUPLICATION_TIME_MS = 10,
         ATTRIBUTE_INDEX_CONSISTENCY           = 11,
-        ATTRIBUTE_INDEX_SUBSCRIPTIONS         = 12
+        ATTRIBUTE_INDEX_SUBSCRIPTIONS         = 12,
+        ATTRIBUTE_INDEX_MAX_PUT_RATE          = 13,
+        ATTRIBUTE_INDEX_DELIVERY_DELAY        = 14,
+        ATTRIBUTE_INDEX_COMPACTION_KEY        = 15,
+        ATTRIBUTE_INDEX_PRIORITY_PROPERTY     = 16
     };
 
     // CONSTANTS
@@ -3263,6 +3307,14 @@ class Domain {
 
     static const int DEFAULT_INITIALIZER_DEDUPLICATION_TIME_MS;
 
+    static const int DEFAULT_INITIALIZER_MAX_PUT_RATE;
+
+    static const int DEFAULT_INITIALIZER_DELIVERY_DELAY;
+
+    static const char DEFAULT_INITIALIZER_COMPACTION_KEY[];
+
+    static const char DEFAULT_INITIALIZER_PRIORITY_PROPERTY[];
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -3406,6 +3458,22 @@ class Domain {
     // Return a reference to the modifiable "Subscriptions" attribute of
     // this object.
 
+    int& maxPutRate();
+    // Return a reference to the modifiable "MaxPutRate" attribute of this
+    // object.
+
+    int& deliveryDelay();
+    // Return a reference to the modifiable "DeliveryDelay" attribute of this
+    // object.
+
+    bsl::string& compactionKey();
+    // Return a reference to the modifiable "CompactionKey" attribute of this
+    // object.
+
+    bsl::string& priorityProperty();
+    // Return a reference to the modifiable "PriorityProperty" attribute of
+    // this object.
+
     // ACCESSORS
     bsl::ostream&
     print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
@@ -3496,6 +3564,18 @@ class Domain {
     // Return a reference offering non-modifiable access to the
     // "Subscriptions" attribute of this object.
 
+    int maxPutRate() const;
+    // Return the value of the "MaxPutRate" attribute of this object.
+
+    int deliveryDelay() const;
+    // Return the value of the "DeliveryDelay" attribute of this object.
+
+    const bsl::string& compactionKey() const;
+    // Return the value of the "CompactionKey" attribute of this object.
+
+    const bsl::string& priorityProperty() const;
+    // Return the value of the "PriorityProperty" attribute of this object.
+
     // HIDDEN FRIENDS
     friend bool operator==(const Domain& lhs, const Domain& rhs)
     // Return 'true' if the specified 'lhs' and 'rhs' attribute objects
@@ -4835,6 +4915,13 @@ int QueueModeFanout::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(
+        &d_maxAppIdMetrics,
+        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_APP_ID_METRICS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -4853,6 +4940,11 @@ int QueueModeFanout::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             &d_publishAppIdMetrics,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUBLISH_APP_ID_METRICS]);
     }
+    case ATTRIBUTE_ID_MAX_APP_ID_METRICS: {
+        return manipulator(
+            &d_maxAppIdMetrics,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_APP_ID_METRICS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -4883,6 +4975,11 @@ inline bool& QueueModeFanout::publishAppIdMetrics()
     return d_publishAppIdMetrics;
 }
 
+inline int& QueueModeFanout::maxAppIdMetrics()
+{
+    return d_maxAppIdMetrics;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int QueueModeFanout::accessAttributes(t_ACCESSOR& accessor) const
@@ -4901,6 +4998,12 @@ int QueueModeFanout::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_maxAppIdMetrics,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_APP_ID_METRICS]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -4919,6 +5022,11 @@ int QueueModeFanout::accessAttribute(t_ACCESSOR& accessor, int id) const
             d_publishAppIdMetrics,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PUBLISH_APP_ID_METRICS]);
     }
+    case ATTRIBUTE_ID_MAX_APP_ID_METRICS: {
+        return accessor(
+            d_maxAppIdMetrics,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_APP_ID_METRICS]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -4949,6 +5057,11 @@ inline bool QueueModeFanout::publishAppIdMetrics() const
     return d_publishAppIdMetrics;
 }
 
+inline int QueueModeFanout::maxAppIdMetrics() const
+{
+    return d_maxAppIdMetrics;
+}
+
 // -----------------------
 // class QueueModePriority
 // -----------------------
@@ -5897,6 +6010,10 @@ void Domain::hashAppendImpl(t_HASH_ALGORITHM& hashAlgorithm) const
     hashAppend(hashAlgorithm, this->deduplicationTimeMs());
     hashAppend(hashAlgorithm, this->consistency());
     hashAppend(hashAlgorithm, this->subscriptions());
+    hashAppend(hashAlgorithm, this->maxPutRate());
+    hashAppend(hashAlgorithm, this->deliveryDelay());
+    hashAppend(hashAlgorithm, this->compactionKey());
+    hashAppend(hashAlgorithm, this->priorityProperty());
 }
 
 inline bool Domain::isEqualTo(const Domain& rhs) const
@@ -5912,7 +6029,11 @@ inline bool Domain::isEqualTo(const Domain& rhs) const
            this->maxDeliveryAttempts() == rhs.maxDeliveryAttempts() &&
            this->deduplicationTimeMs() == rhs.deduplicationTimeMs() &&
            this->consistency() == rhs.consistency() &&
-           this->subscriptions() == rhs.subscriptions();
+           this->subscriptions() == rhs.subscriptions() &&
+           this->maxPutRate() == rhs.maxPutRate() &&
+           this->deliveryDelay() == rhs.deliveryDelay() &&
+           this->compactionKey() == rhs.compactionKey() &&
+           this->priorityProperty() == rhs.priorityProperty();
 }
 
 // CLASS METHODS
@@ -6001,6 +6122,30 @@ int Domain::manipulateAttributes(t_MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_maxPutRate,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_PUT_RATE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_deliveryDelay,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DELIVERY_DELAY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_compactionKey,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPACTION_KEY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = manipulator(&d_priorityProperty,
+                      ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRIORITY_PROPERTY]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -6069,6 +6214,25 @@ int Domain::manipulateAttribute(t_MANIPULATOR& manipulator, int id)
             &d_subscriptions,
             ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS]);
     }
+    case ATTRIBUTE_ID_MAX_PUT_RATE: {
+        return manipulator(&d_maxPutRate,
+                           ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_PUT_RATE]);
+    }
+    case ATTRIBUTE_ID_DELIVERY_DELAY: {
+        return manipulator(
+            &d_deliveryDelay,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DELIVERY_DELAY]);
+    }
+    case ATTRIBUTE_ID_COMPACTION_KEY: {
+        return manipulator(
+            &d_compactionKey,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPACTION_KEY]);
+    }
+    case ATTRIBUTE_ID_PRIORITY_PROPERTY: {
+        return manipulator(
+            &d_priorityProperty,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRIORITY_PROPERTY]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -6154,6 +6318,26 @@ inline bsl::vector<Subscription>& Domain::subscriptions()
     return d_subscriptions;
 }
 
+inline int& Domain::maxPutRate()
+{
+    return d_maxPutRate;
+}
+
+inline int& Domain::deliveryDelay()
+{
+    return d_deliveryDelay;
+}
+
+inline bsl::string& Domain::compactionKey()
+{
+    return d_compactionKey;
+}
+
+inline bsl::string& Domain::priorityProperty()
+{
+    return d_priorityProperty;
+}
+
 // ACCESSORS
 template <typename t_ACCESSOR>
 int Domain::accessAttributes(t_ACCESSOR& accessor) const
@@ -6237,6 +6421,30 @@ int Domain::accessAttributes(t_ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_maxPutRate,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_PUT_RATE]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_deliveryDelay,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DELIVERY_DELAY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_compactionKey,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPACTION_KEY]);
+    if (ret) {
+        return ret;
+    }
+
+    ret = accessor(d_priorityProperty,
+                   ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRIORITY_PROPERTY]);
+    if (ret) {
+        return ret;
+    }
+
     return 0;
 }
 
@@ -6299,6 +6507,23 @@ int Domain::accessAttribute(t_ACCESSOR& accessor, int id) const
         return accessor(d_subscriptions,
                         ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SUBSCRIPTIONS]);
     }
+    case ATTRIBUTE_ID_MAX_PUT_RATE: {
+        return accessor(d_maxPutRate,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_PUT_RATE]);
+    }
+    case ATTRIBUTE_ID_DELIVERY_DELAY: {
+        return accessor(d_deliveryDelay,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_DELIVERY_DELAY]);
+    }
+    case ATTRIBUTE_ID_COMPACTION_KEY: {
+        return accessor(d_compactionKey,
+                        ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_COMPACTION_KEY]);
+    }
+    case ATTRIBUTE_ID_PRIORITY_PROPERTY: {
+        return accessor(
+            d_priorityProperty,
+            ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_PRIORITY_PROPERTY]);
+    }
     default: return NOT_FOUND;
     }
 }
@@ -6385,6 +6610,26 @@ inline const bsl::vector<Subscription>& Domain::subscriptions() const
     return d_subscriptions;
 }
 
+inline int Domain::maxPutRate() const
+{
+    return d_maxPutRate;
+}
+
+inline int Domain::deliveryDelay() const
+{
+    return d_deliveryDelay;
+}
+
+inline const bsl::string& Domain::compactionKey() const
+{
+    return d_compactionKey;
+}
+
+inline const bsl::string& Domain::priorityProperty() const
+{
+    return d_priorityProperty;
+}
+
 // ----------------------
 // class DomainDefinition
 // ----------------------
@@ -94,6 +94,11 @@ class ClusterStateManager {
     typedef bmqc::OrderedHashMap<bsl::string, mqbu::StorageKey> AppInfos;
     typedef AppInfos::const_iterator                            AppInfosCIter;
 
+    /// Pair of (uri, status) describing a queue assignment which failed
+    /// permanently.
+    typedef bsl::pair<bmqt::Uri, bmqp_ctrlmsg::Status> FailedAssignment;
+    typedef bsl::vector<FailedAssignment>              FailedAssignments;
+
   public:
     // CREATORS
 
@@ -177,6 +182,19 @@ class ClusterStateManager {
     virtual bool assignQueue(const bmqt::Uri&      uri,
                              bmqp_ctrlmsg::Status* status) = 0;
 
+    /// Perform the assignment of all the queues represented by the
+    /// specified `uris`, as per `assignQueue`, but apply the resulting
+    /// queue assignments to CSL using as few queue assignment advisories as
+    /// possible.  Load into the specified `failures` the uri and status of
+    /// every queue whose assignment failed permanently and must be
+    /// rejected; all other queues are assigned or can be retried.  This
+    /// method is called only on the leader node.
+    ///
+    /// THREAD: This method is invoked in the associated cluster's
+    ///         dispatcher thread.
+    virtual void assignQueues(const bsl::vector<bmqt::Uri>& uris,
+                              FailedAssignments*            failures) = 0;
+
     /// Register a queue info for the queue with the specified `advisory`.
     /// If the specified `forceUpdate` flag is true, update queue info even if
     /// it is valid but different from the specified `advisory`.
@@ -21,6 +21,7 @@
 #include <bdlb_print.h>
 #include <bdlb_string.h>
 #include <bsl_ostream.h>
+#include <bsla_annotations.h>
 #include <bslim_printer.h>
 
 namespace BloombergLP {
@@ -216,5 +217,11 @@ DispatcherClient::~DispatcherClient()
     // NOTHING
 }
 
+void DispatcherClient::onDispatcherCpuTime(
+    BSLA_MAYBE_UNUSED bsls::Types::Int64 cpuTimeNs)
+{
+    // NOTHING
+}
+
 }  // close package namespace
 }  // close enterprise namespace
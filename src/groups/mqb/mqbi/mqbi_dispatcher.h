@@ -117,6 +117,7 @@
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bslmt_threadutil.h>
 #include <bsls_assert.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 
@@ -444,6 +445,17 @@ class Dispatcher {
     virtual void synchronize(DispatcherClientType::Enum type,
                              ProcessorHandle            handle)   = 0;
 
+    /// Enqueue an event to every processor in charge of clients of the
+    /// specified `type` and block until all of them have dequeued it.  If
+    /// the optionally specified `skipIdle` is `true`, skip the processors
+    /// having no registered client.  The events are enqueued to all the
+    /// processors before waiting, so that the call completes once the
+    /// slowest processor is done rather than after the sum of their
+    /// latencies.  The behavior is undefined if `synchronizeAll` is being
+    /// invoked from one of these processors.
+    virtual void synchronizeAll(DispatcherClientType::Enum type,
+                                bool skipIdle = false) = 0;
+
     // ACCESSORS
 
     /// Return the number of processors dedicated for dispatching clients of
@@ -584,6 +596,12 @@ class DispatcherClientData {
     /// clients.
     bool d_addedToFlushList;
 
+    /// Thread CPU time (in nanoseconds) spent by the dispatcher processing
+    /// events of the client and not yet reported to it -- this is a
+    /// Dispatcher internal member that should only be manipulated by the
+    /// dispatcher, and not the clients.
+    bsls::Types::Int64 d_pendingCpuTime;
+
   public:
     // CREATORS
 
@@ -595,6 +613,7 @@ class DispatcherClientData {
     DispatcherClientData&
     setProcessorHandle(Dispatcher::ProcessorHandle value);
     DispatcherClientData& setAddedToFlushList(bool value);
+    DispatcherClientData& setPendingCpuTime(bsls::Types::Int64 value);
 
     /// Set the corresponding member to the specified `value` and return a
     /// reference offering modifiable access to this object.
@@ -608,6 +627,7 @@ class DispatcherClientData {
     DispatcherClientType::Enum  clientType() const;
     Dispatcher::ProcessorHandle processorHandle() const;
     bool                        addedToFlushList() const;
+    bsls::Types::Int64          pendingCpuTime() const;
 
     /// Return the value of the corresponding member.
     const Dispatcher* dispatcher() const;
@@ -696,6 +716,12 @@ class DispatcherClient {
     /// used to provide batch and nagling mechanism.
     virtual void flush() = 0;
 
+    /// Called by the dispatcher, when CPU accounting is enabled, to report
+    /// the specified `cpuTimeNs` nanoseconds of thread CPU time it spent
+    /// processing events of this client since the last report.  The
+    /// default implementation does nothing.
+    virtual void onDispatcherCpuTime(bsls::Types::Int64 cpuTimeNs);
+
     // ACCESSORS
 
     /// Return a pointer to the dispatcher this client is associated with.
@@ -786,6 +812,7 @@ inline DispatcherClientData::DispatcherClientData()
 , d_processorHandle(Dispatcher::k_INVALID_PROCESSOR_HANDLE)
 , d_dispatcher_p(0)
 , d_addedToFlushList(false)
+, d_pendingCpuTime(0)
 {
     // NOTHING
 }
@@ -821,6 +848,13 @@ DispatcherClientData::setAddedToFlushList(bool value)
     return *this;
 }
 
+inline DispatcherClientData&
+DispatcherClientData::setPendingCpuTime(bsls::Types::Int64 value)
+{
+    d_pendingCpuTime = value;
+    return *this;
+}
+
 inline DispatcherClientData&
 DispatcherClientData::setDispatcher(Dispatcher* value)
 {
@@ -849,6 +883,11 @@ inline bool DispatcherClientData::addedToFlushList() const
     return d_addedToFlushList;
 }
 
+inline bsls::Types::Int64 DispatcherClientData::pendingCpuTime() const
+{
+    return d_pendingCpuTime;
+}
+
 inline const Dispatcher* DispatcherClientData::dispatcher() const
 {
     return d_dispatcher_p;
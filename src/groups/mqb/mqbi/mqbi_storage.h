@@ -171,25 +171,28 @@ class StorageMessageAttributes {
     // only in a process.  Also note that
     // zero represents an unset value.
 
-    unsigned int d_refCount;
-
-    /// Unpadded
-    unsigned int d_appDataLen;
+    mqbi::QueueHandle* d_queueHandle;
 
     bmqp::MessagePropertiesInfo d_messagePropertiesInfo;
 
-    bool d_hasReceipt;
+    unsigned int d_refCount;
 
-    mqbi::QueueHandle* d_queueHandle;
+    /// Unpadded
+    unsigned int d_appDataLen;
 
     unsigned int d_crc32c;
     // CRC32-C associated with this
     // message.
 
-    bmqt::CompressionAlgorithmType::Enum d_compressionAlgorithmType;
+    unsigned char d_compressionAlgorithmType;
     // compression algorithm used to
     // compress this message i.e. the
-    // application data.
+    // application data, stored on a
+    // single byte so that it shares the
+    // trailing word with
+    // 'd_hasReceipt'.
+
+    bool d_hasReceipt;
 
   public:
     // CLASS METHODS
@@ -555,6 +558,17 @@ class Storage {
     virtual StorageResult::Enum remove(const bmqt::MessageGUID& msgGUID,
                                        int* msgSize = 0) = 0;
 
+    /// Garbage-collect from the storage the message having the specified
+    /// `msgGUID`, regardless of the Apps which have not confirmed it yet,
+    /// after informing the queue engine that the message is being removed.
+    /// Record the event in the storage.
+    /// Return one of the return codes from:
+    /// * e_SUCCESS          : success
+    /// * e_GUID_NOT_FOUND   : `msgGUID` was not found
+    /// * e_WRITE_FAILURE    : failed to record this event in storage
+    virtual StorageResult::Enum
+    gcMessage(const bmqt::MessageGUID& msgGUID) = 0;
+
     /// Remove all messages from this storage for the App identified by the
     /// specified `appKey` if `appKey` is not null.  Otherwise, remove messages
     /// for all Apps.  Record the event in the storage.
@@ -568,6 +582,13 @@ class Storage {
     /// undefined unless this cluster node is the primary for this partition.
     virtual void flushStorage() = 0;
 
+    /// Flush any buffered replication messages to the peers, unless the
+    /// replication group commit window of this partition is still open, in
+    /// which case they are flushed no later than when the window closes.
+    /// Behaviour is undefined unless this cluster node is the primary for
+    /// this partition.
+    virtual void flushStorageIfNeeded() = 0;
+
     /// Return the resource capacity meter associated to this storage.
     virtual mqbu::CapacityMeter* capacityMeter() = 0;
 
@@ -797,13 +818,14 @@ DataStreamMessage::app(unsigned int appOrdinal) const
 inline StorageMessageAttributes::StorageMessageAttributes()
 : d_arrivalTimestamp(0)
 , d_arrivalTimepoint(0)
+, d_queueHandle(0)
+, d_messagePropertiesInfo()
 , d_refCount(0)
 , d_appDataLen(0)
-, d_messagePropertiesInfo()
-, d_hasReceipt(true)
-, d_queueHandle(0)
 , d_crc32c(0)
-, d_compressionAlgorithmType(bmqt::CompressionAlgorithmType::e_NONE)
+, d_compressionAlgorithmType(
+      static_cast<unsigned char>(bmqt::CompressionAlgorithmType::e_NONE))
+, d_hasReceipt(true)
 {
 }
 
@@ -819,13 +841,14 @@ inline StorageMessageAttributes::StorageMessageAttributes(
     bsls::Types::Int64                   arrivalTimepoint)
 : d_arrivalTimestamp(arrivalTimestamp)
 , d_arrivalTimepoint(arrivalTimepoint)
+, d_queueHandle(queueHandle)
+, d_messagePropertiesInfo(messagePropertiesInfo)
 , d_refCount(refCount)
 , d_appDataLen(appDataLen)
-, d_messagePropertiesInfo(messagePropertiesInfo)
-, d_hasReceipt(hasReceipt)
-, d_queueHandle(queueHandle)
 , d_crc32c(crc32c)
-, d_compressionAlgorithmType(compressionAlgorithmType)
+, d_compressionAlgorithmType(
+      static_cast<unsigned char>(compressionAlgorithmType))
+, d_hasReceipt(hasReceipt)
 {
     // NOTHING
 }
@@ -870,7 +893,7 @@ inline StorageMessageAttributes&
 StorageMessageAttributes::setCompressionAlgorithmType(
     bmqt::CompressionAlgorithmType::Enum value)
 {
-    d_compressionAlgorithmType = value;
+    d_compressionAlgorithmType = static_cast<unsigned char>(value);
     return *this;
 }
 
@@ -893,13 +916,14 @@ inline void StorageMessageAttributes::reset()
 {
     d_arrivalTimestamp         = 0;
     d_arrivalTimepoint         = 0;
+    d_queueHandle              = 0;
+    d_messagePropertiesInfo    = bmqp::MessagePropertiesInfo();
     d_refCount                 = 0;
     d_appDataLen               = 0;
-    d_messagePropertiesInfo    = bmqp::MessagePropertiesInfo();
-    d_queueHandle              = 0;
-    d_hasReceipt               = true;
     d_crc32c                   = 0;
-    d_compressionAlgorithmType = bmqt::CompressionAlgorithmType::e_NONE;
+    d_compressionAlgorithmType = static_cast<unsigned char>(
+        bmqt::CompressionAlgorithmType::e_NONE);
+    d_hasReceipt               = true;
 }
 
 // ACCESSORS
@@ -947,7 +971,8 @@ inline unsigned int StorageMessageAttributes::crc32c() const
 inline bmqt::CompressionAlgorithmType::Enum
 StorageMessageAttributes::compressionAlgorithmType() const
 {
-    return d_compressionAlgorithmType;
+    return static_cast<bmqt::CompressionAlgorithmType::Enum>(
+        d_compressionAlgorithmType);
 }
 
 // FREE OPERATORS
@@ -167,6 +167,13 @@ void Dispatcher::synchronize(
     // NOTHING
 }
 
+void Dispatcher::synchronizeAll(
+    BSLA_MAYBE_UNUSED mqbi::DispatcherClientType::Enum type,
+    BSLA_MAYBE_UNUSED bool                             skipIdle)
+{
+    // NOTHING
+}
+
 bsl::shared_ptr<mqbi::DispatcherEventSource> Dispatcher::createEventSource()
 {
     bsl::shared_ptr<mqbi::DispatcherEventSource> res =
@@ -215,6 +215,9 @@ class Dispatcher BSLS_KEYWORD_FINAL : public mqbi::Dispatcher {
                      mqbi::Dispatcher::ProcessorHandle handle)
         BSLS_KEYWORD_OVERRIDE;
 
+    void synchronizeAll(mqbi::DispatcherClientType::Enum type,
+                        bool skipIdle = false) BSLS_KEYWORD_OVERRIDE;
+
     // ACCESSORS
     //   (virtual: mqbi::Dispatcher)
 
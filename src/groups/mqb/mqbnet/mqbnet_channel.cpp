@@ -18,12 +18,15 @@
 #include <mqbscm_version.h>
 // BDE
 #include <bdlf_bind.h>
+#include <bdlt_timeunitratio.h>
+#include <bsl_algorithm.h>
 #include <bsl_memory.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_threadattributes.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
 #include <bsls_systemtime.h>
+#include <bsls_timeutil.h>
 
 #include <bmqu_printutil.h>
 
@@ -79,12 +82,15 @@ Channel::Channel(bdlbb::BlobBufferFactory* blobBufferFactory,
              bsls::BlockGrowth::BSLS_CONSTANT,
              d_allocators.get("ItemPool"))
 , d_buffer(1024, allocator)
+, d_priorityBuffer(allocator)
 , d_isStopped(false)
 , d_state(e_RESET)
 , d_description(name + " - ", d_allocator_p)
 , d_name(name, d_allocator_p)
 , d_stats()
 , d_isStopping(false)
+, d_partitionSyncMaxBytesPerSecond(0)
+, d_partitionSyncNextWriteTime(0)
 {
     bslmt::ThreadAttributes attr;
     bsl::string             threadName("bmqNet-");
@@ -350,6 +356,7 @@ void Channel::reset()
     BSLS_ASSERT_SAFE(d_internalThreadChecker.inSameThread());
 
     d_buffer.reset();
+    d_priorityBuffer.removeAll();
 
     bsls::Types::Int64 count = numItems();
     if (count) {
@@ -377,6 +384,14 @@ void Channel::wakeUp()
     d_buffer.pushBack(bslmf::MovableRefUtil::move(item));
 }
 
+void Channel::setPartitionSyncMaxBytesPerSecond(int value)
+{
+    // Thread: any
+    BSLS_ASSERT_SAFE(value >= 0);
+
+    d_partitionSyncMaxBytesPerSecond = value;
+}
+
 void Channel::onWatermark(bmqio::ChannelWatermarkType::Enum type)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
@@ -761,6 +776,49 @@ Channel::writeImmediate(bool*                                     isConsumed,
     return rc;
 }
 
+bool Channel::throttlePartitionSync(
+    const bsl::shared_ptr<bmqio::Channel>& channel,
+    const Item&                            item)
+{
+    // executed by the internal thread
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_internalThreadChecker.inSameThread());
+
+    if (item.d_type != bmqp::EventType::e_PARTITION_SYNC) {
+        return false;  // RETURN
+    }
+
+    const bsls::Types::Int64 maxBytesPerSecond =
+        d_partitionSyncMaxBytesPerSecond.loadRelaxed();
+    if (maxBytesPerSecond == 0) {
+        return false;  // RETURN
+    }
+
+    const bsls::Types::Int64 now = bsls::TimeUtil::getTimer();
+    if (now >= d_partitionSyncNextWriteTime) {
+        // Idle time does not accumulate as credit, so a burst is bounded by
+        // the size of a single item.
+        d_partitionSyncNextWriteTime =
+            now + static_cast<bsls::Types::Int64>(item.d_numBytes) *
+                      bdlt::TimeUnitRatio::k_NANOSECONDS_PER_SECOND /
+                      maxBytesPerSecond;
+        return false;  // RETURN
+    }
+
+    // Do not hold back whatever the builders have accumulated before the
+    // partition sync item.
+    flushAll(channel);
+
+    const bsls::Types::Int64 sleepUsec =
+        (d_partitionSyncNextWriteTime - now) /
+        bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MICROSECOND;
+    bslmt::ThreadUtil::microSleep(static_cast<int>(
+        bsl::min<bsls::Types::Int64>(sleepUsec + 1,
+                                     k_PARTITION_SYNC_MAX_SLEEP_USEC)));
+
+    return true;
+}
+
 void Channel::threadFn()
 {
     // executed by the internal thread
@@ -768,6 +826,7 @@ void Channel::threadFn()
     BSLS_ASSERT_SAFE(d_internalThreadChecker.inSameThread());
 
     bslma::ManagedPtr<Item>         item;
+    bslma::ManagedPtr<Item>         heldItem;
     bsl::shared_ptr<bmqio::Channel> channel;
     bsl::string                     description;
     int                             mode = e_BLOCK;
@@ -820,6 +879,7 @@ void Channel::threadFn()
             if (d_state == e_RESET) {
                 // This is the only place to get out of the 'e_RESET' state.
                 item.reset();
+                heldItem.reset();
                 reset();
 
                 mode        = e_BLOCK;
@@ -860,6 +920,17 @@ void Channel::threadFn()
             }
         }
         else if (!item) {  // UNLOCK
+            if (d_priorityBuffer.tryPopFront(&item) == 0) {
+                // Write it ahead of 'heldItem' and of 'd_buffer'.
+                BSLS_ASSERT_SAFE(item);
+                continue;  // CONTINUE
+            }
+            if (heldItem) {
+                // Resume with the item held back by the rate limit, before
+                // any other item from 'd_buffer'.
+                item = bslmf::MovableRefUtil::move(heldItem);
+                continue;  // CONTINUE
+            }
             switch (mode) {
             case e_BLOCK: {
                 if (d_buffer.popFront(&item) == 0) {
@@ -898,6 +969,12 @@ void Channel::threadFn()
             // Enqueued by 'wakeUp', ignore this item
             item.reset();
         }
+        else if (throttlePartitionSync(channel, *item)) {
+            // Hold the 'item' back and check the state again before retrying,
+            // so that neither a reset or a stop nor a priority item is
+            // delayed by the rate limit.
+            heldItem = bslmf::MovableRefUtil::move(item);
+        }
         else {
             // e_READY and have channel and an item
             BSLS_ASSERT_SAFE(item);
@@ -63,6 +63,20 @@
 //                      returns. The transition 'e_RESET' -> 'e_READY' is
 //                      signaled by conditional variable.
 //  - 'onWatermark'     sets the state to 'e_READY' on LWM and 'e_HWM' on HWM.
+// Writing of 'e_PARTITION_SYNC' items can be limited to a number of bytes per
+// second by 'setPartitionSyncMaxBytesPerSecond'.  A held back item stays at
+// the head of the queue, so items enqueued after it are held back too; this
+// preserves the order in which the peer receives partition sync data relative
+// to the control messages which follow it.
+// 'e_REPLICATION_RECEIPT' and 'e_ELECTOR' items are buffered separately, in
+// order, and are written ahead of anything buffered before them (including a
+// held back 'e_PARTITION_SYNC' item), so that a backlog of storage, partition
+// sync or PUSH data does not delay the Receipts acknowledging replication of
+// other partitions, nor the elector heartbeats (which would otherwise be
+// reported as missed and trigger an election).  This is safe because a
+// Receipt is cumulative, and because elector messages only need to be ordered
+// among themselves: the leader's term fences any cluster state message which
+// they overtake.  All other items keep their relative order.
 
 // MQB
 #include <mqbi_dispatcher.h>
@@ -362,6 +376,11 @@ class Channel {
     // CONSTANTS
     static const int k_NAGLE_PACKET_SIZE = 1024 * 1024;  // 1MB;
 
+    /// Maximum duration, in microseconds, of a single sleep of the internal
+    /// thread while a partition sync item is held back by the rate limit.
+    /// Kept short so that state changes (reset, stop) are observed promptly.
+    static const int k_PARTITION_SYNC_MAX_SLEEP_USEC = 10 * 1000;  // 10ms
+
     // DATA
     /// Allocator store to spawn new allocators for sub-components
     bmqma::CountingAllocatorStore d_allocators;
@@ -386,6 +405,9 @@ class Channel {
 
     ItemQueue d_buffer;
 
+    /// Items bypassing 'd_buffer' (see 'isPriority').
+    bdlcc::SingleConsumerQueue<bslma::ManagedPtr<Item> > d_priorityBuffer;
+
     bslmt::ThreadUtil::Handle d_threadHandle;
 
     bslmt::Condition d_stateCondition;
@@ -422,6 +444,15 @@ class Channel {
     /// close the channel.
     bsls::AtomicBool d_isStopping;
 
+    /// Maximum rate, in bytes per second, at which 'e_PARTITION_SYNC' items
+    /// are written to the channel, or 0 if not limited.
+    bsls::AtomicInt d_partitionSyncMaxBytesPerSecond;
+
+    /// Earliest time, as returned by 'bsls::TimeUtil::getTimer', at which
+    /// the next 'e_PARTITION_SYNC' item can be written.  Accessed by the
+    /// internal thread only.
+    bsls::Types::Int64 d_partitionSyncNextWriteTime;
+
   private:
     // NOT IMPLEMENTED
     Channel(const Channel&) BSLS_CPP11_DELETED;
@@ -488,6 +519,14 @@ class Channel {
     bmqt::EventBuilderResult::Enum pack(ControlArgs&       builder,
                                         const ControlArgs& args);
 
+    /// Return `true` if the specified `item` is an `e_PARTITION_SYNC` item
+    /// which cannot be written yet without exceeding the partition sync
+    /// rate limit, in which case flush all builders to the specified
+    /// `channel` and sleep for a bounded amount of time.  Otherwise, charge
+    /// the `item` against the rate limit, if any, and return `false`.
+    bool throttlePartitionSync(const bsl::shared_ptr<bmqio::Channel>& channel,
+                               const Item&                            item);
+
     /// Dedicated thread does all writing.
     void threadFn();
 
@@ -499,6 +538,10 @@ class Channel {
     // PRIVATE CLASS METHODS
     static void deleteItem(void* item, void* cookie);
 
+    /// Return `true` if items of the specified `type` are written ahead of
+    /// the items buffered in `d_buffer`, and `false` otherwise.
+    static bool isPriority(bmqp::EventType::Enum type);
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(Channel, bslma::UsesBslmaAllocator)
@@ -529,6 +572,12 @@ class Channel {
     /// Stop the channel thread once all draining is done.
     void stop();
 
+    /// Limit the rate at which `e_PARTITION_SYNC` items are written to the
+    /// channel to the specified `value` bytes per second, or remove the
+    /// limit if `value` is 0.  Items of other types are never held back,
+    /// but items enqueued after a held back item are written after it.
+    void setPartitionSyncMaxBytesPerSecond(int value);
+
     /// Write PUT message using the specified `ph`, `data`, and `state`.
     /// Return e_SUCCESS even if the channel is in HWM.
     bmqt::GenericResult::Enum
@@ -1072,6 +1121,12 @@ Channel::flushBuilder(Builder&                               builder,
     return st.category();
 }
 
+inline bool Channel::isPriority(bmqp::EventType::Enum type)
+{
+    return type == bmqp::EventType::e_REPLICATION_RECEIPT ||
+           type == bmqp::EventType::e_ELECTOR;
+}
+
 inline bmqt::GenericResult::Enum
 Channel::enqueue(bslma::ManagedPtr<Item>& item)
 {
@@ -1083,7 +1138,15 @@ Channel::enqueue(bslma::ManagedPtr<Item>& item)
 
     d_stats.addItem(item->d_type, item->d_numBytes);
 
-    d_buffer.pushBack(bslmf::MovableRefUtil::move(item));
+    if (isPriority(item->d_type)) {
+        d_priorityBuffer.pushBack(bslmf::MovableRefUtil::move(item));
+
+        // Unblock the internal thread in case it waits on 'd_buffer'.
+        wakeUp();
+    }
+    else {
+        d_buffer.pushBack(bslmf::MovableRefUtil::move(item));
+    }
 
     return bmqt::GenericResult::e_SUCCESS;
 }
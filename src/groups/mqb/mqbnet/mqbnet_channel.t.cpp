@@ -1248,6 +1248,170 @@ static void test5_reconnect()
     BMQTST_ASSERT_EQ(testChannel->numWriteCalls(), 2U);
 }
 
+static void test6_partitionSyncRateLimit()
+// ------------------------------------------------------------------------
+//
+// Limit the partition sync rate so that each blob takes 100ms of budget.
+// Call writeBlob three times with e_PARTITION_SYNC type.  Verify that all
+// blobs are written in order and that writing them takes at least the time
+// implied by the limit.
+//
+// ------------------------------------------------------------------------
+{
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        k_BUFFER_SIZE,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+    mqbnet::Channel channel(&bufferFactory,
+                            "test",
+                            bmqtst::TestHelperUtil::allocator());
+
+    bsl::shared_ptr<bmqio::TestChannelEx> testChannel(
+        new (*bmqtst::TestHelperUtil::allocator())
+            bmqio::TestChannelEx(channel,
+                                 &bufferFactory,
+                                 blobSpPool.get(),
+                                 bmqtst::TestHelperUtil::allocator()),
+        bmqtst::TestHelperUtil::allocator());
+
+    channel.setChannel(bsl::weak_ptr<bmqio::TestChannelEx>(testChannel));
+    channel.setPartitionSyncMaxBytesPerSecond(k_BUFFER_SIZE * 10);
+
+    const size_t                 k_NUM_BLOBS = 3;
+    bsl::shared_ptr<bdlbb::Blob> payloads[k_NUM_BLOBS];
+
+    const bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+    for (size_t i = 0; i < k_NUM_BLOBS; ++i) {
+        bdlbb::BlobBuffer blobBuffer;
+
+        payloads[i] = blobSpPool->getObject();
+        bufferFactory.allocate(&blobBuffer);
+        setContent(&blobBuffer);
+        payloads[i]->appendDataBuffer(blobBuffer);
+
+        BMQTST_ASSERT_EQ(channel.writeBlob(payloads[i],
+                                           bmqp::EventType::e_PARTITION_SYNC),
+                         bmqt::GenericResult::e_SUCCESS);
+    }
+
+    BMQTST_ASSERT(testChannel->waitForChannel(bsls::TimeInterval(3)));
+
+    const bsls::TimeInterval elapsed = bsls::SystemTime::nowMonotonicClock() -
+                                       start;
+
+    // The first blob is written right away, each following one waits for
+    // 100ms worth of budget.
+    BMQTST_ASSERT_GE(elapsed.totalMilliseconds(), 190);
+
+    for (size_t i = 0; i < k_NUM_BLOBS; ++i) {
+        bmqio::TestChannel::WriteCall writeCall;
+        BMQTST_ASSERT(testChannel->getWriteCall(&writeCall, i));
+
+        BMQTST_ASSERT_EQ(bdlbb::BlobUtil::compare(*payloads[i],
+                                                  writeCall.d_blob),
+                         0);
+    }
+}
+
+static void test7_priorityItemsBypassBuffer()
+// ------------------------------------------------------------------------
+//
+// Limit the partition sync rate so that each blob takes 100ms of budget.
+// Call writeBlob three times with e_PARTITION_SYNC type, then once with
+// e_REPLICATION_RECEIPT type and once with e_ELECTOR type.  Verify that the
+// receipt and elector blobs are written, in order, before the partition
+// sync blobs held back by the limit, and that the partition sync blobs are
+// written in order.
+//
+// ------------------------------------------------------------------------
+{
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        k_BUFFER_SIZE,
+        bmqtst::TestHelperUtil::allocator());
+    bmqp::BlobPoolUtil::BlobSpPoolSp blobSpPool(
+        bmqp::BlobPoolUtil::createBlobPool(
+            &bufferFactory,
+            bmqtst::TestHelperUtil::allocator()));
+    mqbnet::Channel channel(&bufferFactory,
+                            "test",
+                            bmqtst::TestHelperUtil::allocator());
+
+    bsl::shared_ptr<bmqio::TestChannelEx> testChannel(
+        new (*bmqtst::TestHelperUtil::allocator())
+            bmqio::TestChannelEx(channel,
+                                 &bufferFactory,
+                                 blobSpPool.get(),
+                                 bmqtst::TestHelperUtil::allocator()),
+        bmqtst::TestHelperUtil::allocator());
+
+    channel.setChannel(bsl::weak_ptr<bmqio::TestChannelEx>(testChannel));
+    channel.setPartitionSyncMaxBytesPerSecond(k_BUFFER_SIZE * 10);
+
+    const size_t                 k_NUM_BLOBS = 3;
+    bsl::shared_ptr<bdlbb::Blob> payloads[k_NUM_BLOBS];
+
+    for (size_t i = 0; i < k_NUM_BLOBS; ++i) {
+        bdlbb::BlobBuffer blobBuffer;
+
+        payloads[i] = blobSpPool->getObject();
+        bufferFactory.allocate(&blobBuffer);
+        setContent(&blobBuffer);
+        payloads[i]->appendDataBuffer(blobBuffer);
+
+        BMQTST_ASSERT_EQ(channel.writeBlob(payloads[i],
+                                           bmqp::EventType::e_PARTITION_SYNC),
+                         bmqt::GenericResult::e_SUCCESS);
+    }
+
+    const size_t                 k_NUM_PRIORITY = 2;
+    bsl::shared_ptr<bdlbb::Blob> priorities[k_NUM_PRIORITY];
+    const bmqp::EventType::Enum  types[k_NUM_PRIORITY] = {
+        bmqp::EventType::e_REPLICATION_RECEIPT,
+        bmqp::EventType::e_ELECTOR};
+
+    for (size_t i = 0; i < k_NUM_PRIORITY; ++i) {
+        priorities[i] = blobSpPool->getObject();
+        bdlbb::BlobUtil::append(priorities[i].get(),
+                                k_CONTENT,
+                                static_cast<int>(i + 1));
+
+        BMQTST_ASSERT_EQ(channel.writeBlob(priorities[i], types[i]),
+                         bmqt::GenericResult::e_SUCCESS);
+    }
+
+    BMQTST_ASSERT(testChannel->waitForChannel(bsls::TimeInterval(3)));
+
+    // The first partition sync blob may or may not be written before the
+    // priority blobs, but the others are held back by the limit.
+    size_t priorityIndex = 0;
+    size_t payloadIndex  = 0;
+    for (size_t i = 0; i < k_NUM_BLOBS + k_NUM_PRIORITY; ++i) {
+        bmqio::TestChannel::WriteCall writeCall;
+        BMQTST_ASSERT(testChannel->getWriteCall(&writeCall, i));
+
+        if (priorityIndex < k_NUM_PRIORITY &&
+            bdlbb::BlobUtil::compare(*priorities[priorityIndex],
+                                     writeCall.d_blob) == 0) {
+            BMQTST_ASSERT_LE(payloadIndex, 1u);
+            ++priorityIndex;
+            continue;  // CONTINUE
+        }
+
+        BMQTST_ASSERT_LT(payloadIndex, k_NUM_BLOBS);
+        BMQTST_ASSERT_EQ(bdlbb::BlobUtil::compare(*payloads[payloadIndex],
+                                                  writeCall.d_blob),
+                         0);
+        ++payloadIndex;
+    }
+
+    BMQTST_ASSERT_EQ(priorityIndex, k_NUM_PRIORITY);
+    BMQTST_ASSERT_EQ(payloadIndex, k_NUM_BLOBS);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1264,6 +1428,8 @@ int main(int argc, char* argv[])
     case 3: test3_highWatermarkInWriteCb(); break;
     case 4: test4_controlBlob(); break;
     case 5: test5_reconnect(); break;
+    case 6: test6_partitionSyncRateLimit(); break;
+    case 7: test7_priorityItemsBypassBuffer(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
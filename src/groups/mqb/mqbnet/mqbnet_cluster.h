@@ -125,6 +125,13 @@ class ClusterNode {
     /// Return associated channel.
     virtual Channel& channel() = 0;
 
+    /// Return the channel onto which the traffic identified by the
+    /// specified `key` (e.g., a queue id) should be written.  The same
+    /// `key` always maps to the same channel, so that the ordering of the
+    /// traffic it identifies is preserved.  Note that this is the same as
+    /// `channel()` unless the node is reached through several connections.
+    virtual Channel& channel(int key) = 0;
+
     /// Set the channel associated to this node to the specified `value` and
     /// return a pointer to this object.  Store the specified `identity`.
     /// The specified `readCb` serves as read data callback when
@@ -215,7 +222,9 @@ class Cluster {
     virtual Cluster* unregisterObserver(ClusterObserver* observer) = 0;
 
     /// Write the specified `blob` of the specified `type` to all connected
-    /// nodes of this cluster (with the exception of the current node).
+    /// nodes of this cluster (with the exception of the current node).  The
+    /// same `blob` is handed to the channel of every node; it is neither
+    /// copied nor re-encoded per destination.
     virtual void writeAll(const bsl::shared_ptr<bdlbb::Blob>& blob,
                           bmqp::EventType::Enum               type) = 0;
 
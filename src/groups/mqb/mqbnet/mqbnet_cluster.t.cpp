@@ -88,6 +88,11 @@ struct ClusterNodeTestImp : bsls::ProtocolTestImp<mqbnet::ClusterNode> {
 
     mqbnet::Channel& channel() BSLS_KEYWORD_OVERRIDE { return markDoneRef(); }
 
+    mqbnet::Channel& channel(int key) BSLS_KEYWORD_OVERRIDE
+    {
+        return markDoneRef();
+    }
+
     const bmqp_ctrlmsg::ClientIdentity& identity() const BSLS_KEYWORD_OVERRIDE
     {
         return markDoneRef();
@@ -322,6 +327,7 @@ static void test2_ClusterNode()
                                  write(dummyBlob_sp,
                                        bmqp::EventType::e_CONTROL));
         BSLS_PROTOCOLTEST_ASSERT(testObj, channel());
+        BSLS_PROTOCOLTEST_ASSERT(testObj, channel(0));
         BSLS_PROTOCOLTEST_ASSERT(testObj, identity());
         BSLS_PROTOCOLTEST_ASSERT(testObj, nodeId());
         BSLS_PROTOCOLTEST_ASSERT(testObj, hostName());
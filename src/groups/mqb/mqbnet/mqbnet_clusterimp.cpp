@@ -43,22 +43,47 @@ namespace mqbnet {
 
 ClusterNodeImp::ClusterNodeImp(ClusterImp*                cluster,
                                const mqbcfg::ClusterNode& config,
+                               int                        numConnections,
                                bdlbb::BlobBufferFactory*  blobBufferFactory,
                                bslma::Allocator*          allocator)
 : d_allocators(allocator)
 , d_cluster_p(cluster)
 , d_config(config, allocator)
 , d_description(allocator)
-, d_channel(blobBufferFactory, config.name(), d_allocators.get(config.name()))
+, d_lanes(allocator)
 , d_identity(allocator)
-, d_isReading(false)
+, d_isUp(false)
+, d_lanesMutex()
 {
     BSLS_ASSERT_SAFE(d_cluster_p &&
                      "A ClusterNode should always be part of a Cluster");
+    BSLS_ASSERT_SAFE(numConnections >= 1);
 
     bmqu::MemOutStream osstr;
     osstr << "[" << hostName() << ", " << nodeId() << "]";
     d_description.assign(osstr.str().data(), osstr.str().length());
+
+    d_lanes.resize(numConnections);
+    for (int i = 0; i < numConnections; ++i) {
+        // The first connection keeps the name of the node, so that the
+        // channel is named the same whether or not the node is reached
+        // through several connections.
+        bmqu::MemOutStream nameOs(allocator);
+        nameOs << config.name();
+        if (i != 0) {
+            nameOs << "-" << i;
+        }
+        const bsl::string name(nameOs.str().data(),
+                               nameOs.str().length(),
+                               allocator);
+
+        bslma::Allocator* channelAlloc = d_allocators.get(name);
+        d_lanes[i].d_channel_sp.createInplace(channelAlloc,
+                                              blobBufferFactory,
+                                              name,
+                                              channelAlloc);
+        d_lanes[i].d_isReading = false;
+    }
 }
 
 ClusterNodeImp::~ClusterNodeImp()
@@ -71,12 +96,38 @@ ClusterNodeImp::setChannel(const bsl::weak_ptr<bmqio::Channel>& value,
                            const bmqp_ctrlmsg::ClientIdentity&  identity,
                            const bmqio::Channel::ReadCallback&  readCb)
 {
-    // Save the value
-    d_readCb    = readCb;
-    d_isReading = false;
-    d_identity  = identity;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_lanesMutex);  // LOCK
+
+        // Use the first connection without a channel.  If they all have one,
+        // this is the case when 'setChannel' is called before 'resetChannel'
+        // as the result of a new connection on a different TCP thread, and
+        // the first connection is used.
+        Lanes::iterator laneIt = d_lanes.begin();
+        for (Lanes::iterator it = d_lanes.begin(); it != d_lanes.end();
+             ++it) {
+            if (!it->d_channel_sp->channel()) {
+                laneIt = it;
+                break;  // BREAK
+            }
+        }
+
+        // Save the value
+        laneIt->d_readCb    = readCb;
+        laneIt->d_isReading = false;
+        d_identity          = identity;
+
+        laneIt->d_channel_sp->setChannel(value);
 
-    d_channel.setChannel(value);
+        if (!isAvailable()) {
+            BALL_LOG_INFO << nodeDescription() << ": waiting for all "
+                          << d_lanes.size() << " connections to be "
+                          << "established before notifying node up";
+            return this;  // RETURN
+        }
+
+        d_isUp = true;
+    }
 
     // Notify the cluster of changes to this node
     d_cluster_p->notifyObserversOfNodeStateChange(this, true);
@@ -86,51 +137,111 @@ ClusterNodeImp::setChannel(const bsl::weak_ptr<bmqio::Channel>& value,
 
 bool ClusterNodeImp::enableRead()
 {
-    const bsl::shared_ptr<bmqio::Channel> channelSp = d_channel.channel();
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!channelSp)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return false;  // RETURN
-    }
-
-    BSLS_ASSERT_SAFE(d_readCb);
+    bslma::Allocator* alloc = d_allocators.get("Read");
 
-    if (d_isReading.swap(true)) {
-        return true;  // RETURN
-    }
+    bsl::vector<bsl::shared_ptr<bmqio::Channel> > channels(alloc);
+    bsl::vector<bmqio::Channel::ReadCallback>     readCbs(alloc);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_lanesMutex);  // LOCK
 
-    bmqio::Status readStatus;
-    channelSp->read(&readStatus, bmqp::Protocol::k_PACKET_MIN_SIZE, d_readCb);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_isUp)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            return false;  // RETURN
+        }
 
-    if (!readStatus) {
-        BALL_LOG_ERROR << "#TCP_READ_ERROR " << nodeDescription()
-                       << ": Failed reading from the channel "
-                       << "[status: " << readStatus << ", "
-                       << "channel: '" << channelSp->peerUri() << "']";
+        for (Lanes::iterator it = d_lanes.begin(); it != d_lanes.end();
+             ++it) {
+            if (it->d_isReading) {
+                continue;  // CONTINUE
+            }
 
-        channelSp->close();
+            const bsl::shared_ptr<bmqio::Channel> channelSp =
+                it->d_channel_sp->channel();
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!channelSp)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+                return false;  // RETURN
+            }
 
-        d_isReading = false;
+            BSLS_ASSERT_SAFE(it->d_readCb);
 
-        return false;  // RETURN
+            it->d_isReading = true;
+            channels.push_back(channelSp);
+            readCbs.push_back(it->d_readCb);
+        }
     }
 
-    BALL_LOG_INFO << nodeDescription() << ": reading from the channel '"
-                  << channelSp->peerUri() << "'";
+    // Read outside of the mutex, since a failure closes the channel, which
+    // may synchronously reset it.
+    bool result = true;
+    for (size_t i = 0; i < channels.size(); ++i) {
+        bmqio::Status readStatus;
+        channels[i]->read(&readStatus,
+                          bmqp::Protocol::k_PACKET_MIN_SIZE,
+                          readCbs[i]);
+
+        if (!readStatus) {
+            BALL_LOG_ERROR << "#TCP_READ_ERROR " << nodeDescription()
+                           << ": Failed reading from the channel "
+                           << "[status: " << readStatus << ", "
+                           << "channel: '" << channels[i]->peerUri() << "']";
+
+            channels[i]->close();
+
+            result = false;
+            continue;  // CONTINUE
+        }
+
+        BALL_LOG_INFO << nodeDescription() << ": reading from the channel '"
+                      << channels[i]->peerUri() << "'";
+    }
 
-    return true;
+    return result;
 }
 
 ClusterNode* ClusterNodeImp::resetChannel(
     const bsl::shared_ptr<bmqio::Channel>& closedChannel)
 {
-    if (!d_channel.resetChannel(closedChannel)) {
-        // The channel was not reset (stale close), skip cleanup.
-        return this;  // RETURN
-    }
+    bslma::Allocator* alloc = d_allocators.get("Reset");
+
+    bsl::vector<bsl::shared_ptr<bmqio::Channel> > otherChannels(alloc);
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_lanesMutex);  // LOCK
+
+        Lanes::iterator laneIt = d_lanes.begin();
+        for (Lanes::iterator it = d_lanes.begin(); it != d_lanes.end();
+             ++it) {
+            if (it->d_channel_sp->channel() == closedChannel) {
+                laneIt = it;
+                break;  // BREAK
+            }
+        }
 
-    d_isReading = false;
-    d_identity.reset();
-    d_readCb = bmqio::Channel::ReadCallback();
+        if (!laneIt->d_channel_sp->resetChannel(closedChannel)) {
+            // The channel was not reset (stale close), skip cleanup.
+            return this;  // RETURN
+        }
+
+        laneIt->d_isReading = false;
+        laneIt->d_readCb    = bmqio::Channel::ReadCallback();
+
+        if (!d_isUp) {
+            // Either not all connections were established yet, or this is
+            // one of the other connections closed below.
+            return this;  // RETURN
+        }
+
+        d_isUp = false;
+        d_identity.reset();
+
+        for (Lanes::iterator it = d_lanes.begin(); it != d_lanes.end();
+             ++it) {
+            const bsl::shared_ptr<bmqio::Channel> channelSp =
+                it->d_channel_sp->channel();
+            if (channelSp) {
+                otherChannels.push_back(channelSp);
+            }
+        }
+    }
 
     // Notify the cluster of changes to this node
     d_cluster_p->notifyObserversOfNodeStateChange(this, false);
@@ -138,6 +249,16 @@ ClusterNode* ClusterNodeImp::resetChannel(
     // If we want to apply application logic to pending items before clearing
     // the buffer, it can be done in the observer call.
 
+    // The traffic of the node is spread across all its connections, so the
+    // other ones are closed (and re-established) as well, to not preserve a
+    // partial set of connections.
+    for (size_t i = 0; i < otherChannels.size(); ++i) {
+        BALL_LOG_INFO << nodeDescription() << ": closing the channel '"
+                      << otherChannels[i]->peerUri()
+                      << "' since another connection to the node is down";
+        otherChannels[i]->close();
+    }
+
     return this;
 }
 
@@ -145,7 +266,7 @@ bmqt::GenericResult::Enum
 ClusterNodeImp::write(const bsl::shared_ptr<bdlbb::Blob>& blob,
                       bmqp::EventType::Enum               type)
 {
-    return d_channel.writeBlob(blob, type);
+    return channel().writeBlob(blob, type);
 }
 
 // ----------------
@@ -180,6 +301,7 @@ void ClusterImp::notifyObserversOfNodeStateChange(ClusterNode* node,
 ClusterImp::ClusterImp(const bsl::string&                      name,
                        const bsl::vector<mqbcfg::ClusterNode>& nodesConfig,
                        int                                     selfNodeId,
+                       int                       numConnectionsPerNode,
                        bdlbb::BlobBufferFactory* blobBufferFactory,
                        bslma::Allocator*         allocator)
 : d_name(name, allocator)
@@ -197,7 +319,10 @@ ClusterImp::ClusterImp(const bsl::string&                      name,
     bsl::vector<mqbcfg::ClusterNode>::const_iterator nodeIt;
     for (nodeIt = d_nodesConfig.begin(); nodeIt != d_nodesConfig.end();
          ++nodeIt) {
-        d_nodes.emplace_back(this, *nodeIt, blobBufferFactory);
+        d_nodes.emplace_back(this,
+                             *nodeIt,
+                             numConnectionsPerNode,
+                             blobBufferFactory);
         d_nodesList.emplace_back(&d_nodes.back());
         if (nodeIt->id() == selfNodeId) {
             d_selfNode = d_nodesList.back();
@@ -269,13 +394,17 @@ void ClusterImp::closeChannels()
     for (bsl::list<ClusterNodeImp>::iterator it = d_nodes.begin();
          it != d_nodes.end();
          ++it) {
-        it->channel().requestToStop();
+        for (int i = 0; i < it->numConnections(); ++i) {
+            it->channel(i).requestToStop();
+        }
     }
     // then, join all channels threads
     for (bsl::list<ClusterNodeImp>::iterator it = d_nodes.begin();
          it != d_nodes.end();
          ++it) {
-        it->channel().stop();
+        for (int i = 0; i < it->numConnections(); ++i) {
+            it->channel(i).stop();
+        }
     }
 }
 
@@ -27,6 +27,12 @@
 // 'mqbnet::ClusterNodeImp' is a mechanism, implementing the
 // 'mqbnet::ClusterNode' protocol to represent and interact with a node.
 //
+// A node may be reached through several parallel connections (e.g., by a
+// proxy configured with more than one upstream connection), each having its
+// own 'mqbnet::Channel'.  The traffic is spread across them by key (see
+// 'channel(int key)'), and the node is considered up only while all of them
+// are established.
+//
 // NOTE: The 'mqbnet::Cluster' and 'mqbnet::ClusterNode' interfaces are mainly
 //       so that those components can be mocked for testing.
 
@@ -74,6 +80,27 @@ class ClusterNodeImp : public ClusterNode {
     // CLASS-SCOPE CATEGORY
     BALL_LOG_SET_CLASS_CATEGORY("MQBNET.CLUSTERNODEIMP");
 
+  private:
+    // PRIVATE TYPES
+
+    /// Connection to the node, and its associated state.
+    struct Lane {
+        // PUBLIC DATA
+
+        /// Channel of this connection.
+        bsl::shared_ptr<Channel> d_channel_sp;
+
+        /// Read callback of this connection, serving as read data callback
+        /// when `enableRead` is called.
+        bmqio::Channel::ReadCallback d_readCb;
+
+        /// Indicates if post-negotiation read has started on this
+        /// connection.
+        bool d_isReading;
+    };
+
+    typedef bsl::vector<Lane> Lanes;
+
   private:
     // DATA
     /// Allocator store to spawn new allocators for sub-components
@@ -88,16 +115,20 @@ class ClusterNodeImp : public ClusterNode {
     bsl::string d_description;
     // Brief description of this node
 
-    Channel d_channel;
-    // Channel associated to this node
+    /// Connections to this node.  There is more than one only when the node
+    /// is reached through several parallel connections, in which case the
+    /// node is up only once all of them are established, and goes down as
+    /// soon as any of them goes down.
+    Lanes d_lanes;
 
     bmqp_ctrlmsg::ClientIdentity d_identity;
 
-    bmqio::Channel::ReadCallback d_readCb;
+    /// Indicates if all the connections are established and the observers
+    /// have been notified that the node is up.
+    bool d_isUp;
 
-    bsls::AtomicBool d_isReading;
-    // Indicates if post-negotiation read has
-    // started.
+    /// Mutex protecting the assignment of the connections to `d_lanes`.
+    bslmt::Mutex d_lanesMutex;
 
   private:
     // NOT IMPLEMENTED
@@ -113,9 +144,11 @@ class ClusterNodeImp : public ClusterNode {
     // CREATORS
 
     /// Create a new object, associated to the specified `cluster` with the
-    /// specified `config` and using the specified `allocator`.
+    /// specified `config`, reached through the specified `numConnections`
+    /// parallel connections, and using the specified `allocator`.
     ClusterNodeImp(ClusterImp*                cluster,
                    const mqbcfg::ClusterNode& config,
+                   int                        numConnections,
                    bdlbb::BlobBufferFactory*  blobBufferFactory,
                    bslma::Allocator*          allocator);
 
@@ -124,23 +157,32 @@ class ClusterNodeImp : public ClusterNode {
 
     // MANIPULATORS
 
-    /// Return associated channel.
+    /// Return associated channel, i.e., the channel of the first connection.
     Channel& channel() BSLS_KEYWORD_OVERRIDE;
 
-    /// Set the channel associated to this node to the specified `value` and
-    /// return a pointer to this object.  Store the specified `identity`.
-    /// The specified `readCb` serves as read data callback when
-    /// `enableRead` is called.
+    /// Return the channel of the connection onto which the traffic
+    /// identified by the specified `key` should be written.
+    Channel& channel(int key) BSLS_KEYWORD_OVERRIDE;
+
+    /// Associate the specified `value` to the first connection of this node
+    /// not having a channel, or to the first connection if they all have
+    /// one, and return a pointer to this object.  Store the specified
+    /// `identity`.  The specified `readCb` serves as read data callback of
+    /// that connection when `enableRead` is called.  Notify the observers
+    /// that this node is up if all its connections now have a channel.
     ClusterNode* setChannel(const bsl::weak_ptr<bmqio::Channel>& value,
                             const bmqp_ctrlmsg::ClientIdentity&  identity,
                             const bmqio::Channel::ReadCallback&  readCb)
         BSLS_KEYWORD_OVERRIDE;
 
-    /// Start reading from the channel.  Return true if `read` is successful
-    /// or if it is already reading.
+    /// Start reading from the channels of all the connections.  Return true
+    /// if `read` is successful or if it is already reading, and false if
+    /// `read` failed or if not all the connections have a channel.
     bool enableRead() BSLS_KEYWORD_OVERRIDE;
 
-    /// Reset the channel associated to this node.
+    /// Reset the connection associated to the specified `closedChannel`.
+    /// If this node was up, notify the observers that it is down and close
+    /// the channels of all its other connections.
     ClusterNode*
     resetChannel(const bsl::shared_ptr<bmqio::Channel>& closedChannel)
         BSLS_KEYWORD_OVERRIDE;
@@ -175,9 +217,12 @@ class ClusterNodeImp : public ClusterNode {
     /// Return a pointer to the cluster this node belongs to.
     const Cluster* cluster() const BSLS_KEYWORD_OVERRIDE;
 
-    /// Return true if this node is available, i.e., it has an attached
-    /// channel.
+    /// Return true if this node is available, i.e., all its connections
+    /// have an attached channel.
     bool isAvailable() const BSLS_KEYWORD_OVERRIDE;
+
+    /// Return the number of parallel connections to this node.
+    int numConnections() const;
 };
 
 // =============
@@ -271,10 +316,13 @@ class ClusterImp : public Cluster {
     // CREATORS
 
     /// Create a new object with the specified `name`, `nodesConfig` and
-    /// `selfNodeId`, using the specified `allocator`.
+    /// `selfNodeId`, each node being reached through the specified
+    /// `numConnectionsPerNode` parallel connections, using the specified
+    /// `allocator`.
     ClusterImp(const bsl::string&                      name,
                const bsl::vector<mqbcfg::ClusterNode>& nodesConfig,
                int                                     selfNodeId,
+               int                                     numConnectionsPerNode,
                bdlbb::BlobBufferFactory*               blobBufferFactory,
                bslma::Allocator*                       allocator);
 
@@ -351,7 +399,13 @@ class ClusterImp : public Cluster {
 
 inline Channel& ClusterNodeImp::channel()
 {
-    return d_channel;
+    return *d_lanes.front().d_channel_sp;
+}
+
+inline Channel& ClusterNodeImp::channel(int key)
+{
+    return *d_lanes[static_cast<unsigned int>(key) % d_lanes.size()]
+                .d_channel_sp;
 }
 
 inline const bmqp_ctrlmsg::ClientIdentity& ClusterNodeImp::identity() const
@@ -386,7 +440,19 @@ inline const Cluster* ClusterNodeImp::cluster() const
 
 inline bool ClusterNodeImp::isAvailable() const
 {
-    return d_channel.isAvailable();
+    for (Lanes::const_iterator it = d_lanes.begin(); it != d_lanes.end();
+         ++it) {
+        if (!it->d_channel_sp->isAvailable()) {
+            return false;  // RETURN
+        }
+    }
+
+    return true;
+}
+
+inline int ClusterNodeImp::numConnections() const
+{
+    return static_cast<int>(d_lanes.size());
 }
 
 // ----------------
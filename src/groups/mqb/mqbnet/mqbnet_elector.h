@@ -45,6 +45,32 @@
 ///---------
 //
 //
+/// Failover
+///--------
+// The elector already runs the *Raft* pre-vote extension: before proposing an
+// election, a follower sends a scouting request with its tentative term, and
+// only becomes a candidate once a quorum of nodes answer that they would vote
+// for it.  A node which still perceives a healthy leader always declines to
+// support a scouting node ("sticky leader"), so a partitioned or slow node
+// cannot depose a leader which a quorum still hears from.  Safety does not
+// depend on wall clocks: at most one leader per term is guaranteed by the
+// quorum alone, and stale leaders are fenced by the term (and, for
+// partitions, by the primary lease id), not by time-based leader leases.
+//
+// The time to fail over from a lost leader is therefore driven only by
+// configuration ('mqbcfg::ElectorConfig'):
+//: o If the leader's channel goes down, followers learn it immediately
+//:   (NODE_UNAVAILABLE); otherwise they learn it after 'heartbeatMissCount'
+//:   missed heartbeats, checked every 'heartbeatCheckPeriodMs'.
+//: o Followers then wait a random delay in '[0, maxRandomWaitTimeoutMs]'
+//:   before scouting, which keeps concurrent candidates (and split votes)
+//:   unlikely.
+//: o Scouting and election each complete as soon as a quorum responds, and
+//:   are bounded by 'scoutingResultTimeoutMs' and 'electionResultTimeoutMs'.
+// Deployments needing faster failover should lower these values rather than
+// rely on bounded clock drift; the shorter the random wait, the higher the
+// chance of a split vote that must be retried.
+//
 /// NOTE
 ///----
 // The pseudo-random number generator should be seeded prior to usage of this
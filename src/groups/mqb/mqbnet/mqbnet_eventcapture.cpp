@@ -0,0 +1,231 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbnet_eventcapture.h>
+
+#include <mqbscm_version.h>
+// BMQ
+#include <bmqp_protocol.h>
+
+// BDE
+#include <bdlb_bigendian.h>
+#include <bdlbb_blobutil.h>
+#include <bsl_cstring.h>
+#include <bslmf_assert.h>
+#include <bslmt_lockguard.h>
+#include <bsls_assert.h>
+
+namespace BloombergLP {
+namespace mqbnet {
+
+namespace {
+
+/// Header preceding the event of each record of a capture.
+struct RecordHeader {
+    bdlb::BigEndianInt64 d_timestampNs;
+    bdlb::BigEndianInt32 d_channelId;
+    bdlb::BigEndianInt32 d_length;
+};
+
+BSLMF_ASSERT(sizeof(RecordHeader) == EventCaptureUtil::k_RECORD_HEADER_SIZE);
+
+}  // close unnamed namespace
+
+// -----------------------
+// struct EventCaptureUtil
+// -----------------------
+
+const char EventCaptureUtil::k_MAGIC[] = "BMQCAP01";
+
+int EventCaptureUtil::writeHeader(bsl::ostream& stream)
+{
+    stream.write(k_MAGIC, k_MAGIC_SIZE);
+
+    return stream ? 0 : -1;
+}
+
+int EventCaptureUtil::writeRecord(bsl::ostream&      stream,
+                                  int                channelId,
+                                  bsls::Types::Int64 timestampNs,
+                                  const bdlbb::Blob& event)
+{
+    RecordHeader header;
+    header.d_timestampNs = timestampNs;
+    header.d_channelId   = channelId;
+    header.d_length      = event.length();
+
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (int i = 0; i < event.numDataBuffers(); ++i) {
+        const int size = i == event.numDataBuffers() - 1
+                             ? event.lastDataBufferLength()
+                             : event.buffer(i).size();
+        stream.write(event.buffer(i).data(), size);
+    }
+
+    return stream ? 0 : -1;
+}
+
+// ------------------------
+// class EventCaptureWriter
+// ------------------------
+
+// CREATORS
+EventCaptureWriter::EventCaptureWriter()
+: d_mutex()
+, d_file()
+, d_numRecords(0)
+{
+    // NOTHING
+}
+
+EventCaptureWriter::~EventCaptureWriter()
+{
+    close();
+}
+
+// MANIPULATORS
+int EventCaptureWriter::open(const bsl::string& path)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS      = 0,
+        rc_OPEN_FAILED  = -1,
+        rc_WRITE_FAILED = -2
+    };
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    d_file.open(path.c_str(),
+                bsl::ios_base::out | bsl::ios_base::binary |
+                    bsl::ios_base::trunc);
+    if (!d_file.is_open()) {
+        return rc_OPEN_FAILED;  // RETURN
+    }
+
+    d_numRecords = 0;
+
+    if (EventCaptureUtil::writeHeader(d_file) != 0) {
+        d_file.close();
+        return rc_WRITE_FAILED;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+void EventCaptureWriter::close()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    if (d_file.is_open()) {
+        d_file.close();
+    }
+}
+
+int EventCaptureWriter::write(int                channelId,
+                              bsls::Types::Int64 timestampNs,
+                              const bdlbb::Blob& event)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCK
+
+    if (!d_file.is_open()) {
+        return -1;  // RETURN
+    }
+
+    const int rc = EventCaptureUtil::writeRecord(d_file,
+                                                 channelId,
+                                                 timestampNs,
+                                                 event);
+    if (rc == 0) {
+        ++d_numRecords;
+    }
+
+    return rc;
+}
+
+// ------------------------
+// class EventCaptureReader
+// ------------------------
+
+// CREATORS
+EventCaptureReader::EventCaptureReader(bsl::istream*     stream,
+                                       bslma::Allocator* allocator)
+: d_stream_p(stream)
+, d_headerRead(false)
+, d_buffer(allocator)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(stream);
+}
+
+// MANIPULATORS
+int EventCaptureReader::next(int*                channelId,
+                             bsls::Types::Int64* timestampNs,
+                             bdlbb::Blob*        event)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(channelId);
+    BSLS_ASSERT_SAFE(timestampNs);
+    BSLS_ASSERT_SAFE(event);
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_RECORD         = 1,
+        rc_END            = 0,
+        rc_INVALID_MAGIC  = -1,
+        rc_TRUNCATED      = -2,
+        rc_INVALID_LENGTH = -3
+    };
+
+    if (!d_headerRead) {
+        char magic[EventCaptureUtil::k_MAGIC_SIZE];
+        d_stream_p->read(magic, sizeof(magic));
+        if (d_stream_p->gcount() != sizeof(magic) ||
+            bsl::memcmp(magic, EventCaptureUtil::k_MAGIC, sizeof(magic)) !=
+                0) {
+            return rc_INVALID_MAGIC;  // RETURN
+        }
+        d_headerRead = true;
+    }
+
+    RecordHeader header;
+    d_stream_p->read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (d_stream_p->gcount() == 0 && d_stream_p->eof()) {
+        return rc_END;  // RETURN
+    }
+    if (d_stream_p->gcount() != sizeof(header)) {
+        return rc_TRUNCATED;  // RETURN
+    }
+
+    const int length = header.d_length;
+    if (length < 0 || length > bmqp::EventHeader::k_MAX_SIZE_HARD) {
+        return rc_INVALID_LENGTH;  // RETURN
+    }
+
+    d_buffer.resize(length);
+    d_stream_p->read(d_buffer.data(), length);
+    if (d_stream_p->gcount() != length) {
+        return rc_TRUNCATED;  // RETURN
+    }
+
+    *channelId   = header.d_channelId;
+    *timestampNs = header.d_timestampNs;
+    bdlbb::BlobUtil::append(event, d_buffer.data(), length);
+
+    return rc_RECORD;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
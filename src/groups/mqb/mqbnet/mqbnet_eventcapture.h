@@ -0,0 +1,226 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MQBNET_EVENTCAPTURE
+#define INCLUDED_MQBNET_EVENTCAPTURE
+
+/// @file mqbnet_eventcapture.h
+///
+/// @brief Provide a replayable capture format for raw `bmqp::Event`s.
+///
+/// @bbref{mqbnet::EventCaptureWriter} records the events received on the
+/// channels of a session factory, and @bbref{mqbnet::EventCaptureReader}
+/// iterates over such a capture, so that a tool can re-drive a broker with
+/// the same traffic at its original (or a scaled) pace.
+///
+/// Capture Format                            {#mqbnet_eventcapture_format}
+/// ==============
+///
+/// A capture starts with the 8 bytes `EventCaptureUtil::k_MAGIC`, followed
+/// by one record per event, with all integers in network byte order:
+///
+/// ```
+/// +---------------+---------------+---------------+---------------+
+/// |                  timestamp (ns since epoch)                   |
+/// +               +               +               +               +
+/// |                                                               |
+/// +---------------+---------------+---------------+---------------+
+/// |                          channel id                           |
+/// +---------------+---------------+---------------+---------------+
+/// |                            length                             |
+/// +---------------+---------------+---------------+---------------+
+/// |                 'length' bytes of bmqp::Event                 |
+/// +---------------+---------------+---------------+---------------+
+/// ```
+///
+/// The channel id identifies the connection the event was received on, so
+/// that each channel of the capture can be replayed on its own connection.
+///
+/// Thread Safety                             {#mqbnet_eventcapture_thread}
+/// =============
+///
+/// @bbref{mqbnet::EventCaptureWriter} is thread safe: `write` may be called
+/// concurrently from the IO threads.  @bbref{mqbnet::EventCaptureReader} is
+/// not thread safe.
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bsl_fstream.h>
+#include <bsl_istream.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbnet {
+
+// =======================
+// struct EventCaptureUtil
+// =======================
+
+/// Utilities to encode the capture format.
+struct EventCaptureUtil {
+    // PUBLIC CONSTANTS
+
+    /// Magic bytes at the beginning of every capture.
+    static const char k_MAGIC[];
+
+    /// Size of `k_MAGIC`.
+    static const int k_MAGIC_SIZE = 8;
+
+    /// Size of the header preceding the event of each record.
+    static const int k_RECORD_HEADER_SIZE = 16;
+
+    // CLASS METHODS
+
+    /// Write the capture header to the specified `stream`.  Return 0 on
+    /// success, and a non-zero value if the stream is in a failed state.
+    static int writeHeader(bsl::ostream& stream);
+
+    /// Write to the specified `stream` a record with the specified
+    /// `channelId`, `timestampNs` and `event`.  Return 0 on success, and a
+    /// non-zero value if the stream is in a failed state.
+    static int writeRecord(bsl::ostream&      stream,
+                           int                channelId,
+                           bsls::Types::Int64 timestampNs,
+                           const bdlbb::Blob& event);
+};
+
+// ========================
+// class EventCaptureWriter
+// ========================
+
+/// Thread safe writer of a capture file.
+class EventCaptureWriter {
+  private:
+    // DATA
+
+    /// Mutex serializing the records written from the IO threads.
+    bslmt::Mutex d_mutex;
+
+    /// File the capture is written to.
+    bsl::ofstream d_file;
+
+    /// Number of records written since `open`.
+    bsls::Types::Int64 d_numRecords;
+
+  private:
+    // NOT IMPLEMENTED
+    EventCaptureWriter(const EventCaptureWriter&);
+    EventCaptureWriter& operator=(const EventCaptureWriter&);
+
+  public:
+    // CREATORS
+
+    /// Create a writer which is not yet open.
+    EventCaptureWriter();
+
+    /// Close the capture, if open, and destroy this object.
+    ~EventCaptureWriter();
+
+    // MANIPULATORS
+
+    /// Create (or truncate) the capture file at the specified `path` and
+    /// write the capture header to it.  Return 0 on success, and a non-zero
+    /// value otherwise.
+    int open(const bsl::string& path);
+
+    /// Flush and close the capture file.
+    void close();
+
+    /// Append to the capture a record of the specified `event` received at
+    /// the specified `timestampNs` on the channel identified by the
+    /// specified `channelId`.  Return 0 on success, and a non-zero value
+    /// otherwise.
+    int write(int                channelId,
+              bsls::Types::Int64 timestampNs,
+              const bdlbb::Blob& event);
+
+    // ACCESSORS
+
+    /// Return the number of records written since `open`.  Note that this
+    /// must not be called concurrently with `write`.
+    bsls::Types::Int64 numRecords() const;
+};
+
+// ========================
+// class EventCaptureReader
+// ========================
+
+/// Iterator over the records of a capture.
+class EventCaptureReader {
+  private:
+    // DATA
+
+    /// Stream the capture is read from, held not owned.
+    bsl::istream* d_stream_p;
+
+    /// Whether the capture header has been validated.
+    bool d_headerRead;
+
+    /// Buffer the event of the current record is read into.
+    bsl::vector<char> d_buffer;
+
+  private:
+    // NOT IMPLEMENTED
+    EventCaptureReader(const EventCaptureReader&);
+    EventCaptureReader& operator=(const EventCaptureReader&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(EventCaptureReader,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a reader of the capture in the specified `stream`.  Use the
+    /// optionally specified `allocator` for memory allocations.
+    explicit EventCaptureReader(bsl::istream*     stream,
+                                bslma::Allocator* allocator = 0);
+
+    // MANIPULATORS
+
+    /// Read the next record of the capture, loading its channel id into the
+    /// specified `channelId`, its timestamp into the specified
+    /// `timestampNs`, and appending its event to the specified `event`.
+    /// Return 1 if a record was read, 0 at the end of the capture, and a
+    /// negative value if the capture is invalid or truncated.
+    int next(int*                channelId,
+             bsls::Types::Int64* timestampNs,
+             bdlbb::Blob*        event);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// ------------------------
+// class EventCaptureWriter
+// ------------------------
+
+inline bsls::Types::Int64 EventCaptureWriter::numRecords() const
+{
+    return d_numRecords;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,190 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbnet_eventcapture.h>
+
+// BDE
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Records written with 'EventCaptureUtil' are read back unchanged, in
+//   order, by 'EventCaptureReader', including events spanning several blob
+//   buffers.
+//
+// Testing:
+//   EventCaptureUtil::writeHeader
+//   EventCaptureUtil::writeRecord
+//   EventCaptureReader::next
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    // Small buffers so that the second event spans several of them
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        4,
+        bmqtst::TestHelperUtil::allocator());
+
+    const bsl::string first("first event",
+                            bmqtst::TestHelperUtil::allocator());
+    const bsl::string second("a second, longer, event",
+                             bmqtst::TestHelperUtil::allocator());
+
+    bdlbb::Blob firstBlob(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+    bdlbb::BlobUtil::append(&firstBlob,
+                            first.data(),
+                            static_cast<int>(first.length()));
+    bdlbb::Blob secondBlob(&bufferFactory,
+                           bmqtst::TestHelperUtil::allocator());
+    bdlbb::BlobUtil::append(&secondBlob,
+                            second.data(),
+                            static_cast<int>(second.length()));
+
+    bsl::stringstream stream(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(0, mqbnet::EventCaptureUtil::writeHeader(stream));
+    BMQTST_ASSERT_EQ(
+        0,
+        mqbnet::EventCaptureUtil::writeRecord(stream, 3, 1000, firstBlob));
+    BMQTST_ASSERT_EQ(
+        0,
+        mqbnet::EventCaptureUtil::writeRecord(stream, 7, 2500, secondBlob));
+
+    BMQTST_ASSERT_EQ(static_cast<int>(stream.str().length()),
+                     mqbnet::EventCaptureUtil::k_MAGIC_SIZE +
+                         2 * mqbnet::EventCaptureUtil::k_RECORD_HEADER_SIZE +
+                         firstBlob.length() + secondBlob.length());
+
+    mqbnet::EventCaptureReader reader(&stream,
+                                      bmqtst::TestHelperUtil::allocator());
+
+    int                channelId   = 0;
+    bsls::Types::Int64 timestampNs = 0;
+    {
+        bdlbb::Blob event(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(1, reader.next(&channelId, &timestampNs, &event));
+        BMQTST_ASSERT_EQ(3, channelId);
+        BMQTST_ASSERT_EQ(1000, timestampNs);
+        BMQTST_ASSERT_EQ(0, bdlbb::BlobUtil::compare(event, firstBlob));
+    }
+    {
+        bdlbb::Blob event(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(1, reader.next(&channelId, &timestampNs, &event));
+        BMQTST_ASSERT_EQ(7, channelId);
+        BMQTST_ASSERT_EQ(2500, timestampNs);
+        BMQTST_ASSERT_EQ(0, bdlbb::BlobUtil::compare(event, secondBlob));
+    }
+    {
+        bdlbb::Blob event(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(0, reader.next(&channelId, &timestampNs, &event));
+    }
+}
+
+static void test2_invalidCapture()
+// ------------------------------------------------------------------------
+// INVALID CAPTURE
+//
+// Concerns:
+//   'EventCaptureReader::next' reports an error, rather than a record,
+//   for a capture with an invalid header or a truncated record.
+//
+// Testing:
+//   EventCaptureReader::next
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("INVALID CAPTURE");
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        1024,
+        bmqtst::TestHelperUtil::allocator());
+    bdlbb::Blob event(&bufferFactory, bmqtst::TestHelperUtil::allocator());
+
+    int                channelId   = 0;
+    bsls::Types::Int64 timestampNs = 0;
+
+    {
+        PV("Invalid magic");
+
+        bsl::stringstream stream("NOTACAPTURE",
+                                 bmqtst::TestHelperUtil::allocator());
+        mqbnet::EventCaptureReader reader(&stream,
+                                          bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_LT(reader.next(&channelId, &timestampNs, &event), 0);
+    }
+
+    {
+        PV("Truncated record");
+
+        bdlbb::Blob record(&bufferFactory,
+                           bmqtst::TestHelperUtil::allocator());
+        bdlbb::BlobUtil::append(&record, "payload", 7);
+
+        bsl::stringstream full(bmqtst::TestHelperUtil::allocator());
+        mqbnet::EventCaptureUtil::writeHeader(full);
+        mqbnet::EventCaptureUtil::writeRecord(full, 1, 1, record);
+
+        // Drop the last byte of the event
+        const bsl::string capture(full.str(),
+                                  bmqtst::TestHelperUtil::allocator());
+        const bsl::string truncatedCapture(
+            capture,
+            0,
+            capture.length() - 1,
+            bmqtst::TestHelperUtil::allocator());
+        bsl::stringstream stream(truncatedCapture,
+                                 bmqtst::TestHelperUtil::allocator());
+        mqbnet::EventCaptureReader reader(&stream,
+                                          bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_LT(reader.next(&channelId, &timestampNs, &event), 0);
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_invalidCapture(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -217,6 +217,7 @@ InitialConnectionContext::InitialConnectionContext(
 , d_authenticationCtxSp()
 , d_negotiationCtxSp()
 , d_initialConnectionCompleteCb(initialConnectionCompleteCb)
+, d_deferredError(allocator)
 , d_authenticationEncodingType(bmqp::EncodingType::e_BER)
 , d_state(InitialConnectionState::e_INITIAL)
 , d_isIncoming(isIncoming)
@@ -445,6 +446,28 @@ int InitialConnectionContext::handleAnonAuthentication(
     return rc;
 }
 
+void InitialConnectionContext::handleReadError(
+    const bsl::string& errorDescription)
+{
+    // executed by one of the *IO* threads
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // LOCKED
+
+        if (d_state == InitialConnectionState::e_AUTHENTICATING) {
+            // The authenticator still refers to this context, so it must not
+            // complete before the authentication outcome is delivered; keep
+            // the error and report it from there.
+            if (d_deferredError.empty()) {
+                d_deferredError = errorDescription;
+            }
+            return;  // RETURN
+        }
+    }
+
+    handleEvent(errorDescription, InitialConnectionEvent::e_ERROR);
+}
+
 // MANIPULATORS
 void InitialConnectionContext::setResultState(void* value)
 {
@@ -480,7 +503,7 @@ void InitialConnectionContext::readCallback(const bmqio::Status& status,
 
     if (!status) {
         errStream << "Read error: " << status;
-        handleEvent(errStream.str(), InitialConnectionEvent::e_ERROR);
+        handleReadError(errStream.str());
         return;  // RETURN
     }
 
@@ -488,7 +511,7 @@ void InitialConnectionContext::readCallback(const bmqio::Status& status,
     bool        isFullBlob = true;
     int rc = readBlob(errStream, &outPacket, &isFullBlob, numNeeded, blob);
     if (rc != 0) {
-        handleEvent(errStream.str(), InitialConnectionEvent::e_ERROR);
+        handleReadError(errStream.str());
         return;  // RETURN
     }
 
@@ -498,7 +521,7 @@ void InitialConnectionContext::readCallback(const bmqio::Status& status,
 
     rc = processBlob(errStream, outPacket);
     if (rc != 0) {
-        handleEvent(errStream.str(), InitialConnectionEvent::e_ERROR);
+        handleReadError(errStream.str());
         return;  // RETURN
     }
 }
@@ -541,6 +564,14 @@ void InitialConnectionContext::handleEvent(
                    << "state = " << d_state << ", event = " << event
                    << " [peer: " << d_channelSp.get() << "]";
 
+    if (hasFinalState()) {
+        // A read pipelined behind the authentication request may complete
+        // after the initial connection has already been completed.
+        BALL_LOG_DEBUG << "Ignoring event " << event << " in final state "
+                       << d_state << " [peer: " << d_channelSp.get() << "]";
+        return;  // RETURN
+    }
+
     InitialConnectionState::Enum oldState = d_state;
 
     switch (event) {
@@ -592,6 +623,22 @@ void InitialConnectionContext::handleEvent(
             rc = d_authenticator_p->handleAuthentication(errStream,
                                                          this,
                                                          authenticationMsg);
+            if (rc == rc_SUCCESS) {
+                // Keep reading while the authentication is in progress so
+                // that a negotiation message pipelined by the client right
+                // behind its authentication request is picked up without
+                // waiting for the authentication round trip.
+                rc = scheduleRead(errStream);
+            }
+        }
+        else if (oldState == InitialConnectionState::e_AUTHENTICATING) {
+            // Only one authentication request is expected; report the error
+            // once the pending authentication completes.
+            if (d_deferredError.empty()) {
+                d_deferredError = "Unexpected authentication request while "
+                                  "authenticating";
+            }
+            rc = rc_SUCCESS;
         }
         else {
             errStream << "Unexpected event received: " << oldState << " -> "
@@ -621,6 +668,22 @@ void InitialConnectionContext::handleEvent(
 
             rc = handleAnonAuthentication(errStream);
         }
+        else if (oldState == InitialConnectionState::e_AUTHENTICATING) {
+            // Negotiation message pipelined behind the authentication request:
+            // keep it until the authentication completes.
+            if (negotiationMsg.isClientIdentityValue() &&
+                !negotiationContext()) {
+                createNegotiationContext();
+                negotiationContext()->setNegotiationMessage(negotiationMsg);
+            }
+            else if (d_deferredError.empty()) {
+                bmqu::MemOutStream os(d_allocator_p);
+                os << "Unexpected negotiation message while authenticating"
+                   << " [ negotiationMsg: " << negotiationMsg << " ]";
+                d_deferredError = os.str();
+            }
+            rc = rc_SUCCESS;
+        }
         else if (oldState == InitialConnectionState::e_AUTHENTICATED &&
                  negotiationMsg.isClientIdentityValue()) {
             setState(InitialConnectionState::e_NEGOTIATED, event);
@@ -650,10 +713,21 @@ void InitialConnectionContext::handleEvent(
     }
     case InitialConnectionEvent::e_AUTHN_SUCCESS: {
         if (oldState == InitialConnectionState::e_AUTHENTICATING) {
-            setState(InitialConnectionState::e_AUTHENTICATED, event);
-
-            // Now read Negotiation message
-            rc = scheduleRead(errStream);
+            if (!d_deferredError.empty()) {
+                errStream << d_deferredError;
+            }
+            else if (negotiationContext()) {
+                // The negotiation message was pipelined and has already been
+                // received.
+                setState(InitialConnectionState::e_NEGOTIATED, event);
+                rc = rc_SUCCESS;
+            }
+            else {
+                // The read scheduled upon the authentication request is still
+                // pending and will deliver the negotiation message.
+                setState(InitialConnectionState::e_AUTHENTICATED, event);
+                rc = rc_SUCCESS;
+            }
         }
         else if (oldState == InitialConnectionState::e_ANON_AUTHENTICATING) {
             setState(InitialConnectionState::e_NEGOTIATED, event);
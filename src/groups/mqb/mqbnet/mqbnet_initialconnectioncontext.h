@@ -35,6 +35,11 @@
 /// - Invoke the completion callback exactly once with either a fully
 ///   constructed Session or an error.
 ///
+/// Incoming connections are pipelined: the read loop stays active while an
+/// authentication request is being processed, so a negotiation message sent
+/// by the client right behind its authentication request is received during
+/// the authentication and the session is created as soon as it succeeds.
+///
 /// A single instance is created per inbound or outbound connection attempt
 /// and is discarded once the session is fully negotiated or the attempt
 /// fails.
@@ -291,6 +296,11 @@ class InitialConnectionContext {
     /// connection.
     InitialConnectionCompleteCb d_initialConnectionCompleteCb;
 
+    /// Description of an error detected on the channel while authenticating,
+    /// reported once the authentication outcome is known.  Empty if no such
+    /// error occurred.
+    bsl::string d_deferredError;
+
     /// Encoding for authentication messages.  Defaults to BER until the first
     /// inbound authentication message is decoded, then set to that message's
     /// encoding and reused for outbound replies.  Temporary field; copied into
@@ -377,6 +387,12 @@ class InitialConnectionContext {
                      bmqp_ctrlmsg::NegotiationMessage>* message,
         const bdlbb::Blob&                              blob);
 
+    /// Report the specified `errorDescription` of an error detected while
+    /// reading from the channel.  If an authentication is in progress, defer
+    /// the error until its outcome is delivered; otherwise fail the initial
+    /// connection right away.
+    void handleReadError(const bsl::string& errorDescription);
+
     /// Create and initialize a `NegotiationContext`.
     void createNegotiationContext();
 
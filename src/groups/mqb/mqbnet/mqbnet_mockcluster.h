@@ -43,6 +43,7 @@
 #include <bsl_memory.h>
 #include <bsl_string.h>
 #include <bsl_unordered_set.h>
+#include <bsla_annotations.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
@@ -112,6 +113,9 @@ class MockClusterNode : public ClusterNode {
     /// Return associated channel.
     Channel& channel() BSLS_KEYWORD_OVERRIDE;
 
+    /// Return associated channel, regardless of the specified `key`.
+    Channel& channel(int key) BSLS_KEYWORD_OVERRIDE;
+
     /// Set the channel associated to this node to the specified `value` and
     /// return a pointer to this object.  Store the specified `identity`.
     /// The specified `readCb` serves as read data callback when
@@ -338,6 +342,11 @@ inline Channel& MockClusterNode::channel()
     return d_channel;
 }
 
+inline Channel& MockClusterNode::channel(BSLA_MAYBE_UNUSED int key)
+{
+    return d_channel;
+}
+
 inline const bmqp_ctrlmsg::ClientIdentity& MockClusterNode::identity() const
 {
     return d_identity;
@@ -33,6 +33,7 @@
 #include <mqbnet_authenticationcontext.h>
 #include <mqbnet_authenticator.h>
 #include <mqbnet_cluster.h>
+#include <mqbnet_eventcapture.h>
 #include <mqbnet_initialconnectioncontext.h>
 #include <mqbnet_negotiationcontext.h>
 #include <mqbnet_session.h>
@@ -46,6 +47,7 @@
 #include <bmqio_channelfactorypipeline.h>
 #include <bmqio_channelutil.h>
 #include <bmqio_connectoptions.h>
+#include <bmqio_domainnamecache.h>
 #include <bmqio_ntcchannel.h>
 #include <bmqio_ntcchannelfactory.h>
 #include <bmqio_reconnectingchannelfactory.h>
@@ -72,6 +74,7 @@
 #include <bdlb_string.h>
 #include <bdlbb_blobutil.h>
 #include <bdlf_bind.h>
+#include <bdlf_memfn.h>
 #include <bdlf_placeholder.h>
 #include <bdlma_localsequentialallocator.h>
 #include <bdlt_timeunitratio.h>
@@ -84,12 +87,14 @@
 #include <bsl_vector.h>
 #include <bsla_annotations.h>
 #include <bslalg_swaputil.h>
+#include <bslma_default.h>
 #include <bslmf_movableref.h>
 #include <bslmt_lockguard.h>
 #include <bslmt_once.h>
 #include <bslmt_threadattributes.h>
 #include <bslmt_threadutil.h>
 #include <bsls_keyword.h>
+#include <bsls_objectbuffer.h>
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
 #include <bsls_systemclocktype.h>
@@ -140,6 +145,32 @@ const int k_CLIENT_CLOSE_WAIT = 20;
 
 const int k_BLOB_POOL_GROWTH_STRATEGY = 1024;
 
+const double k_DNS_CACHE_TTL = 5 * 60.0;
+// Time (in seconds) a successful reverse DNS resolution of a peer's address
+// is reused for.
+
+const double k_DNS_CACHE_NEGATIVE_TTL = 30.0;
+// Time (in seconds) a failed reverse DNS resolution of a peer's address is
+// reused for.
+
+const size_t k_DNS_CACHE_MAX_ENTRIES = 16 * 1024;
+// Maximum number of peer addresses kept in the reverse DNS cache.
+
+const int k_HEARTBEAT_WHEEL_SIZE = 8;
+// Number of slots of the heartbeat wheel: the heartbeat-enabled channels are
+// spread across that many slots, and one slot is checked every
+// 'heartbeatInterval / k_HEARTBEAT_WHEEL_SIZE'.
+
+int calculateHeartbeatWheelSize(const mqbcfg::TcpInterfaceConfig& config)
+{
+    // Return the number of slots of the heartbeat wheel, making sure the
+    // wheel does not tick more often than every millisecond.
+
+    return bsl::max(1,
+                    bsl::min(k_HEARTBEAT_WHEEL_SIZE,
+                             config.heartbeatIntervalMs()));
+}
+
 int calculateInitialMissedHbCounter(const mqbcfg::TcpInterfaceConfig& config)
 {
     // Calculate the value with which 'ChannelInfo.d_missedHeartbeatCounter'
@@ -192,6 +223,22 @@ void ntcChannelPreCreation(
             TCPSessionFactory::k_CHANNEL_PROPERTY_LOCAL_PORT,
             static_cast<int>(sourceEndpoint.ip().port()));
     }
+    else if (sourceEndpoint.isLocal()) {
+        // The peer of a local socket is on this host, and the port is the one
+        // of the listener which accepted the channel.
+        channel->properties().set(
+            TCPSessionFactory::k_CHANNEL_PROPERTY_PEER_IP,
+            static_cast<int>(ntsa::Ipv4Address::loopback().value()));
+
+        int port;
+        if (channel->properties().load(
+                &port,
+                bmqio::NtcChannelFactoryUtil::listenPortProperty())) {
+            channel->properties().set(
+                TCPSessionFactory::k_CHANNEL_PROPERTY_LOCAL_PORT,
+                port);
+        }
+    }
 
     channel->properties().set(TCPSessionFactory::k_CHANNEL_PROPERTY_CHANNEL_ID,
                               channel->channelId());
@@ -229,6 +276,28 @@ ntcCreateInterfaceConfig(const mqbcfg::TcpInterfaceConfig& tcpConfig)
 /// thin wrapper around the default DNS resolution from
 /// `bmqio::ResolvingChannelFactoryUtil` that just adds final resolution
 /// logging with time instrumentation.
+/// Return the process-wide cache of reverse DNS resolutions, shared by all
+/// `TCPSessionFactory` objects so that a reconnection storm from the same
+/// set of hosts only resolves each of them once.  The cache is
+/// intentionally never destroyed, to not depend on static destruction
+/// order.
+bmqio::DomainNameCache& domainNameCache()
+{
+    static bsls::ObjectBuffer<bmqio::DomainNameCache> s_cache;
+
+    BSLMT_ONCE_DO
+    {
+        new (s_cache.buffer()) bmqio::DomainNameCache(
+            &bmqio::ResolveUtil::getDomainName,
+            bsls::TimeInterval(k_DNS_CACHE_TTL),
+            bsls::TimeInterval(k_DNS_CACHE_NEGATIVE_TTL),
+            k_DNS_CACHE_MAX_ENTRIES,
+            bslma::Default::globalAllocator());
+    }
+
+    return s_cache.object();
+}
+
 void monitoredDNSResolution(bsl::string*          resolvedUri,
                             const bmqio::Channel& baseChannel)
 {
@@ -237,7 +306,8 @@ void monitoredDNSResolution(bsl::string*          resolvedUri,
     bmqio::ResolvingChannelFactoryUtil::defaultResolutionFn(
         resolvedUri,
         baseChannel,
-        &bmqio::ResolveUtil::getDomainName,
+        bdlf::MemFnUtil::memFn(&bmqio::DomainNameCache::getDomainName,
+                               &domainNameCache()),
         true);
 
     const bsls::Types::Int64 end = bmqu::Time::highResolutionTimer();
@@ -574,6 +644,19 @@ void TCPSessionFactory::read(ChannelInfo*       channelInfo,
             reauthnOnAuthenticationEvent(event, channelInfo);
         }
         else {
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                    d_eventCapture_mp.get() != 0)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+                // A failure to capture must not affect the traffic, so
+                // ignore the result: the number of captured events is logged
+                // on 'stop'.
+                d_eventCapture_mp->write(
+                    channelInfo->d_channelId,
+                    bsls::SystemTime::nowRealtimeClock().totalNanoseconds(),
+                    *readBlob);
+            }
+
             channelInfo->d_eventProcessor_p->processEvent(
                 event,
                 channelInfo->d_session_sp->clusterNode());
@@ -969,8 +1052,15 @@ void TCPSessionFactory::onHeartbeatSchedulerEvent()
 {
     // executed by the *SCHEDULER* thread
 
-    for (ChannelMap::const_iterator it = d_heartbeatChannels.begin();
-         it != d_heartbeatChannels.end();) {
+    // Only check the channels of the current slot of the wheel: each channel
+    // is still checked once per heartbeat interval, but the checks (and the
+    // heartbeat requests they may emit) are evenly spread across the interval
+    // instead of all happening at once.
+    ChannelMap& slot = d_heartbeatWheel[d_heartbeatWheelPosition];
+    d_heartbeatWheelPosition = (d_heartbeatWheelPosition + 1) %
+                               static_cast<int>(d_heartbeatWheel.size());
+
+    for (ChannelMap::const_iterator it = slot.begin(); it != slot.end();) {
         ChannelInfo* info = it->second.get();
         if (!info->d_monitor_mp->checkHeartbeat(info->d_channel_sp.get())) {
             const Session* session = info->d_session_sp.get();
@@ -987,7 +1077,7 @@ void TCPSessionFactory::onHeartbeatSchedulerEvent()
 
             info->d_channel_sp->close();
             // Avoid interference with new connection on the channel
-            it = d_heartbeatChannels.erase(it);
+            it = slot.erase(it);
         }
         else {
             ++it;
@@ -1005,16 +1095,29 @@ void TCPSessionFactory::enableHeartbeat(
                   << "', channel: '" << channelInfo_sp->d_channel_sp.get()
                   << "' ]";
 
-    d_heartbeatChannels[channelInfo_sp->d_channel_sp.get()] = channelInfo_sp;
+    // Assign the channels to the slots in a round-robin fashion to keep the
+    // slots balanced.
+    d_heartbeatWheel[d_nextHeartbeatSlot][channelInfo_sp->d_channel_sp.get()] =
+        channelInfo_sp;
+    d_nextHeartbeatSlot = (d_nextHeartbeatSlot + 1) %
+                          static_cast<int>(d_heartbeatWheel.size());
 }
 
 void TCPSessionFactory::disableHeartbeat(const bmqio::Channel* channel_p)
 {
     // executed by the *SCHEDULER* thread
 
-    ChannelMap::const_iterator cit = d_heartbeatChannels.find(channel_p);
+    ChannelMap::const_iterator cit  = d_heartbeatWheel[0].end();
+    ChannelMap*                slot = 0;
+    for (bsl::size_t i = 0; i < d_heartbeatWheel.size(); ++i) {
+        cit = d_heartbeatWheel[i].find(channel_p);
+        if (cit != d_heartbeatWheel[i].end()) {
+            slot = &d_heartbeatWheel[i];
+            break;  // BREAK
+        }
+    }
 
-    if (cit == d_heartbeatChannels.end()) {
+    if (!slot) {
         // The `channel_p` have been removed as DEAD
         return;  // RETURN
     }
@@ -1028,7 +1131,7 @@ void TCPSessionFactory::disableHeartbeat(const bmqio::Channel* channel_p)
                   << "', channel: '" << channelInfo_sp->d_channel_sp.get()
                   << "' ]";
 
-    d_heartbeatChannels.erase(cit);
+    slot->erase(cit);
 }
 
 void TCPSessionFactory::logOpenSessionTime(
@@ -1063,7 +1166,9 @@ void TCPSessionFactory::logOpenSessionTime(
 
 void TCPSessionFactory::stopHeartbeats()
 {
-    d_heartbeatChannels.clear();
+    for (bsl::size_t i = 0; i < d_heartbeatWheel.size(); ++i) {
+        d_heartbeatWheel[i].clear();
+    }
 }
 
 int TCPSessionFactory::validateTcpInterfaces() const
@@ -1164,12 +1269,15 @@ TCPSessionFactory::TCPSessionFactory(
 , d_channels(allocator)
 , d_ports(allocator)
 , d_heartbeatSchedulerActive(false)
-, d_heartbeatChannels(allocator)
+, d_heartbeatWheel(calculateHeartbeatWheelSize(config), allocator)
+, d_heartbeatWheelPosition(0)
+, d_nextHeartbeatSlot(0)
 , d_initialMissedHeartbeatCounter(calculateInitialMissedHbCounter(config))
 , d_listeningHandles(allocator)
 , d_isListening(false)
 , d_listenContexts(allocator)
 , d_timestampMap(allocator)
+, d_eventCapture_mp()
 , d_allocator_p(allocator)
 {
     // PRECONDITIONS
@@ -1247,6 +1355,24 @@ int TCPSessionFactory::start(bsl::ostream& errorDescription)
         return rc;  // RETURN
     }
 
+    if (!d_config_mp->eventCaptureFile().empty()) {
+        d_eventCapture_mp =
+            bslma::ManagedPtrUtil::allocateManaged<EventCaptureWriter>(
+                d_allocator_p);
+        rc = d_eventCapture_mp->open(d_config_mp->eventCaptureFile());
+        if (rc != 0) {
+            errorDescription << d_name << ": failed to open the event "
+                             << "capture file '"
+                             << d_config_mp->eventCaptureFile()
+                             << "' [rc: " << rc << "]";
+            d_eventCapture_mp.reset();
+            return rc;  // RETURN
+        }
+
+        BALL_LOG_WARN << d_name << ": capturing all received events to '"
+                      << d_config_mp->eventCaptureFile() << "'";
+    }
+
     ntca::InterfaceConfig interfaceConfig = ntcCreateInterfaceConfig(
         *d_config_mp);
 
@@ -1317,8 +1443,14 @@ int TCPSessionFactory::start(bsl::ostream& errorDescription)
                    bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MILLISECOND)
             << ")";
 
+        // The recurring event ticks the heartbeat wheel, which takes a full
+        // heartbeat interval to go around.
         bsls::TimeInterval interval;
-        interval.addMilliseconds(d_config_mp->heartbeatIntervalMs());
+        interval.addMicroseconds(
+            static_cast<bsls::Types::Int64>(
+                d_config_mp->heartbeatIntervalMs()) *
+            bdlt::TimeUnitRatio::k_US_PER_MS /
+            static_cast<int>(d_heartbeatWheel.size()));
 
         d_scheduler_p->scheduleRecurringEvent(
             &d_heartbeatSchedulerHandle,
@@ -1481,7 +1613,7 @@ void TCPSessionFactory::stop()
             bmqu::WeakMemFnUtil::weakMemFn(&TCPSessionFactory::stopHeartbeats,
                                            d_self.acquireWeak()));
 
-        // No need to wait for 'stopHeartbeats' because 'd_heartbeatChannels'
+        // No need to wait for 'stopHeartbeats' because 'd_heartbeatWheel'
         // keep counted reference to sessions ('ChannelInfo::d_session_sp') and
         // the code below waits for sessions destruction.
     }
@@ -1512,6 +1644,14 @@ void TCPSessionFactory::stop()
     // DESTROY
     d_channelFactoryPipeline_mp.reset();
 
+    if (d_eventCapture_mp) {
+        d_eventCapture_mp->close();
+        BALL_LOG_INFO << d_name << ": captured "
+                      << d_eventCapture_mp->numRecords() << " events to '"
+                      << d_config_mp->eventCaptureFile() << "'";
+        d_eventCapture_mp.reset();
+    }
+
     BALL_LOG_INFO << d_name << ": stopped";
 }
 
@@ -1538,37 +1678,60 @@ int TCPSessionFactory::listen(const mqbcfg::TcpInterfaceListener& listener,
 
     bdlma::LocalSequentialAllocator<64> localAlloc(d_allocator_p);
     bmqu::MemOutStream                  endpoint(&localAlloc);
-    endpoint << listener.address() << ":" << listener.port();
-    bmqio::ListenOptions listenOptions;
+    bmqio::ListenOptions                listenOptions;
+    if (bmqio::ChannelUtil::isLocalEndpoint(listener.address())) {
+        // A local socket has no port: the port of the listener still
+        // identifies it and the channels it accepts.
+        endpoint << listener.address();
+        listenOptions.properties().set(
+            bmqio::NtcChannelFactoryUtil::listenPortProperty(),
+            listener.port());
+    }
+    else {
+        endpoint << listener.address() << ":" << listener.port();
+    }
     listenOptions.setEndpoint(endpoint.str());
 
-    bslma::ManagedPtr<bmqio::ChannelFactory::OpHandle> listeningHandle_mp;
-    bmqio::Status                                      status;
-    d_channelFactoryPipeline_mp->listen(
-        &status,
-        &listeningHandle_mp,
-        listenOptions,
-        bdlf::BindUtil::bind(&TCPSessionFactory::channelStateCallback,
-                             this,
-                             bdlf::PlaceHolders::_1,  // event
-                             bdlf::PlaceHolders::_2,  // status
-                             bdlf::PlaceHolders::_3,  // channel
-                             context));
-    if (!status) {
-        BALL_LOG_ERROR << "#TCP_LISTEN_FAILED " << d_name
-                       << ": failed listening to '" << endpoint.str()
-                       << "' [status: " << status << "]";
-        d_isListening = false;
-        return status.category();  // RETURN
+    // Each shard is a distinct listening socket bound to the same port, which
+    // the channel factory assigns to one of its IO threads; the kernel then
+    // balances incoming connections across them.
+    const int numShards = bsl::max(listener.acceptShards(), 1);
+    if (numShards > 1) {
+        listenOptions.properties().set(
+            bmqio::NtcChannelFactoryUtil::listenReusePortProperty(),
+            1);
     }
 
-    BSLS_ASSERT_SAFE(listeningHandle_mp);
+    for (int shard = 0; shard < numShards; ++shard) {
+        bslma::ManagedPtr<bmqio::ChannelFactory::OpHandle> listeningHandle_mp;
+        bmqio::Status                                      status;
+        d_channelFactoryPipeline_mp->listen(
+            &status,
+            &listeningHandle_mp,
+            listenOptions,
+            bdlf::BindUtil::bind(&TCPSessionFactory::channelStateCallback,
+                                 this,
+                                 bdlf::PlaceHolders::_1,  // event
+                                 bdlf::PlaceHolders::_2,  // status
+                                 bdlf::PlaceHolders::_3,  // channel
+                                 context));
+        if (!status) {
+            BALL_LOG_ERROR << "#TCP_LISTEN_FAILED " << d_name
+                           << ": failed listening to '" << endpoint.str()
+                           << "' [shard: " << shard << "/" << numShards
+                           << ", status: " << status << "]";
+            d_isListening = false;
+            return status.category();  // RETURN
+        }
+
+        BSLS_ASSERT_SAFE(listeningHandle_mp);
 
-    OpHandleSp listeningHandle_sp(listeningHandle_mp, d_allocator_p);
-    d_listeningHandles.emplace(port, listeningHandle_sp);
+        OpHandleSp listeningHandle_sp(listeningHandle_mp, d_allocator_p);
+        d_listeningHandles.emplace(port, listeningHandle_sp);
+    }
 
     BALL_LOG_INFO << d_name << ": successfully listening to '"
-                  << endpoint.str() << "'";
+                  << endpoint.str() << "' [shards: " << numShards << "]";
 
     return 0;
 }
@@ -1680,7 +1843,11 @@ TCPSessionFactory::ChannelInfo::ChannelInfo(
       allocator,
       maxMissedHeartbeats,
       initialMissedHeartbeatCounter))
+, d_channelId(0)
 {
+    channel_sp->properties().load(&d_channelId,
+                                  k_CHANNEL_PROPERTY_CHANNEL_ID);
+
     if (!d_eventProcessor_p) {
         // No eventProcessor was provided default to the negotiated session
         d_eventProcessor_p = monitoredSession.get();
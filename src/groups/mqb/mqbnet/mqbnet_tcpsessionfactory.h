@@ -57,8 +57,8 @@
 // for the 'HeartbeatRsp' to be received.
 //
 // It is implemented by keeping track of events received on the channel; and a
-// recurring scheduler event (default to every 3s, called the 'heartbeat
-// interval') checks received activity on all enabled channel, emitting
+// heartbeat wheel, turning once every 'heartbeat interval' (default to 3s),
+// checks received activity on all enabled channel, emitting
 // 'heartbeatReq' if no data was received, and resetting the channel if no
 // data is received after at least 'maxMissedHeartbeat' heartbeat intervals, as
 // explained below:
@@ -75,6 +75,12 @@
 // [5] if the last packet received was at time [Pt2].  In short, with a default
 // 'heartbeatInterval' value of 3s, and a 'maxMissedHeartbeat' value of 4,
 // stale connection will be dropped after a time of ']12;16]' seconds.
+//
+// The enabled channels are spread in round-robin across the slots of the
+// wheel, and a recurring scheduler event checks one slot at a time, so that
+// the checks, and the heartbeat requests they emit, are evenly distributed
+// over the interval instead of bursting on the scheduler thread when a broker
+// has a large number of channels.
 
 // MQB
 
@@ -93,6 +99,7 @@
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 #include <bslma_allocator.h>
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
@@ -141,6 +148,7 @@ namespace mqbnet {
 // FORWARD DECLARATION
 class AuthenticationContext;
 class Cluster;
+class EventCaptureWriter;
 class InitialConnectionContext;
 class NegotiationUserData;
 class Session;
@@ -223,6 +231,9 @@ class TCPSessionFactory {
 
         bslma::ManagedPtr<bmqp::HeartbeatMonitor> d_monitor_mp;
 
+        /// The id of the channel, as recorded in the event capture.
+        int d_channelId;
+
         // CREATORS
 
         /// @param channel_sp The channel
@@ -323,7 +334,8 @@ class TCPSessionFactory {
     typedef bsl::unordered_map<bmqio::Channel*, bsls::Types::Int64>
         TimestampMap;
 
-    typedef bsl::unordered_map<int, OpHandleSp> ListeningHandleMap;
+    /// Map of port to the handles listening on it: one per accept shard.
+    typedef bsl::unordered_multimap<int, OpHandleSp> ListeningHandleMap;
 
   private:
     // PRIVATE DATA
@@ -417,9 +429,17 @@ class TCPSessionFactory {
     /// channels.
     bdlmt::EventSchedulerRecurringEventHandle d_heartbeatSchedulerHandle;
 
-    /// Map of all channels which are heartbeat enabled; only manipulated from
-    /// the event scheduler thread.
-    ChannelMap d_heartbeatChannels;
+    /// Wheel of all channels which are heartbeat enabled, spread across its
+    /// slots; only manipulated from the event scheduler thread.
+    bsl::vector<ChannelMap> d_heartbeatWheel;
+
+    /// Index of the slot of `d_heartbeatWheel` to check upon the next
+    /// heartbeat event.
+    int d_heartbeatWheelPosition;
+
+    /// Index of the slot of `d_heartbeatWheel` to assign to the next
+    /// heartbeat-enabled channel.
+    int d_nextHeartbeatSlot;
 
     /// Value for initializing `ChannelInfo.d_missedHeartbeatCounter`.  See
     /// comments in `calculateInitialMissedHbCounter`.
@@ -445,6 +465,11 @@ class TCPSessionFactory {
     /// Map of HiRes timestamp of the session beginning per channel.
     TimestampMap d_timestampMap;
 
+    /// Capture of the events received on the channels of this factory, if
+    /// enabled by the `eventCaptureFile` config, null otherwise.  Set in
+    /// `start` and reset in `stop`, while no channel is active.
+    bslma::ManagedPtr<EventCaptureWriter> d_eventCapture_mp;
+
     /// Allocator to use
     bslma::Allocator* d_allocator_p;
 
@@ -633,7 +658,11 @@ class TCPSessionFactory {
 
     /// Create a new listener interface specified by  `listener` for incoming
     /// connections and invoke the specified `resultCallback` when a connection
-    /// has been negotiated. Return 0 on success, or non-zero on error.
+    /// has been negotiated. Return 0 on success, or non-zero on error.  If
+    /// the `acceptShards` of `listener` is greater than one, open that many
+    /// listening sockets sharing the port with `SO_REUSEPORT` so that the
+    /// accept and the initial connection handling of incoming connections are
+    /// spread across the IO threads of the channel factory.
     int listen(const mqbcfg::TcpInterfaceListener& listener,
                const ResultCallback&               resultCallback);
 
@@ -471,18 +471,31 @@ int TransportManager::createCluster(
     const bsl::string&                          name,
     const bsl::vector<mqbcfg::ClusterNode>&     nodes,
     ConnectionMode                              connectionMode,
-    const bsl::shared_ptr<NegotiationUserData>& userData)
+    const bsl::shared_ptr<NegotiationUserData>& userData,
+    int                                         numConnectionsPerNode)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(out);
 
     enum RcEnum {
         // Value for the various RC error categories
-        rc_SUCCESS           = 0,
-        rc_INVALID_NODE_TYPE = -1,
-        rc_FAILED_CONNECT    = -2
+        rc_SUCCESS                 = 0,
+        rc_INVALID_NODE_TYPE       = -1,
+        rc_FAILED_CONNECT          = -2,
+        rc_INVALID_NUM_CONNECTIONS = -3
     };
 
+    // Several connections per node are only supported when connecting out
+    // to all nodes, since incoming connections are matched to a single
+    // 'ConnectionState' per node.
+    if (numConnectionsPerNode < 1 ||
+        (numConnectionsPerNode != 1 && connectionMode != e_CONNECT_ALL)) {
+        errorDescription << "Invalid number of connections per node "
+                         << numConnectionsPerNode << " for cluster '" << name
+                         << "' using mode " << connectionMode;
+        return rc_INVALID_NUM_CONNECTIONS;  // RETURN
+    }
+
     // The mutex is protecting the d_connectionsState map, but locking it
     // outside the loop to lock only once
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // d_mutex LOCK
@@ -495,7 +508,8 @@ int TransportManager::createCluster(
         BALL_LOG_OUTPUT_STREAM << "Creating new cluster '" << name
                                << "' (selfNodeId: " << myNodeId
                                << "), using mode " << connectionMode
-                               << " and config: ";
+                               << ", " << numConnectionsPerNode
+                               << " connection(s) per node and config: ";
         bmqu::Printer<bsl::vector<mqbcfg::ClusterNode> > printer(&nodes);
         BALL_LOG_OUTPUT_STREAM << printer;
     }
@@ -503,7 +517,12 @@ int TransportManager::createCluster(
     bslma::Allocator*          alloc = d_allocators.get(name);
     bslma::ManagedPtr<Cluster> cluster(
         new (*alloc)
-            ClusterImp(name, nodes, myNodeId, d_blobBufferFactory_p, alloc),
+            ClusterImp(name,
+                       nodes,
+                       myNodeId,
+                       numConnectionsPerNode,
+                       d_blobBufferFactory_p,
+                       alloc),
         alloc);
 
     // At the moment, only TCP is supported, validate that
@@ -534,30 +553,38 @@ int TransportManager::createCluster(
         BSLS_ASSERT_OPT(node);  // We just created the cluster with the same
                                 // config, the node must exist
 
-        bsl::shared_ptr<ConnectionState> connectionState;
-        connectionState.createInplace(d_allocators.get("ConnectionStates"));
-
-        connectionState->d_endpoint    = tcpConfig.endpoint();
-        connectionState->d_node_p      = node;
-        connectionState->d_userData_sp = userData;
-
-        d_connectionsState[connectionState.get()] = connectionState;
+        // Create one connection state per connection to the node; each of
+        // them independently (re)connects and associates its channel to the
+        // node.
+        for (int i = 0; i < numConnectionsPerNode; ++i) {
+            bsl::shared_ptr<ConnectionState> connectionState;
+            connectionState.createInplace(
+                d_allocators.get("ConnectionStates"));
+
+            connectionState->d_endpoint    = tcpConfig.endpoint();
+            connectionState->d_node_p      = node;
+            connectionState->d_userData_sp = userData;
+
+            d_connectionsState[connectionState.get()] = connectionState;
+
+            // Skip connection to node depending on the mode
+            if (connectionMode == e_MIXED && myNodeId > nodeIt->id()) {
+                BALL_LOG_INFO_BLOCK
+                {
+                    BALL_LOG_OUTPUT_STREAM
+                        << "Skipping connection to '" << nodeIt->name()
+                        << "' (reason: its node id " << nodeIt->id()
+                        << " is lesser than current machine node id "
+                        << myNodeId << ")";
+                }
+                continue;  // CONTINUE
+            }
 
-        // Skip connection to node depending on the mode
-        if (connectionMode == e_MIXED && myNodeId > nodeIt->id()) {
-            BALL_LOG_INFO_BLOCK
-            {
-                BALL_LOG_OUTPUT_STREAM
-                    << "Skipping connection to '" << nodeIt->name()
-                    << "' (reason: its node id " << nodeIt->id()
-                    << " is lesser than current machine node id " << myNodeId
-                    << ")";
+            const int rc = connectLocked(connectionState.get());
+            if (rc == 0) {
+                continue;  // CONTINUE
             }
-            continue;  // CONTINUE
-        }
 
-        int rc = connectLocked(connectionState.get());
-        if (rc != 0) {
             errorDescription << "Error establishing connection with '"
                              << tcpConfig.endpoint() << "': [rc: " << rc
                              << ", cluster: '" << name << "']";
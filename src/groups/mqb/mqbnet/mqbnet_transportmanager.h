@@ -350,15 +350,19 @@ class TransportManager {
     /// The specified `userData` will be passed in to the
     /// `negotiate` method of the negotiator (through the
     /// InitialConnectionContext) for any connections being established
-    /// as a result of this cluster creation.  Return 0 on success, or a
-    /// non-zero value and populate the specified `errorDescription` with a
-    /// description of the error in case of failure.
+    /// as a result of this cluster creation.  Each node is reached through
+    /// the specified `numConnectionsPerNode` parallel connections, which
+    /// must be 1 unless `connectionMode` is `e_CONNECT_ALL`.  Return 0 on
+    /// success, or a non-zero value and populate the specified
+    /// `errorDescription` with a description of the error in case of
+    /// failure.
     int createCluster(bsl::ostream&                           errorDescription,
                       bslma::ManagedPtr<mqbnet::Cluster>*     out,
                       const bsl::string&                      name,
                       const bsl::vector<mqbcfg::ClusterNode>& nodes,
                       ConnectionMode                          connectionMode,
-                      const bsl::shared_ptr<NegotiationUserData>& userData);
+                      const bsl::shared_ptr<NegotiationUserData>& userData,
+                      int numConnectionsPerNode = 1);
 
     /// Return the raw pointer `cookie handle` to the internal state
     /// associated to the specified `nodeId` in the specified `clusterName`,
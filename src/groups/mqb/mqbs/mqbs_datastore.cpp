@@ -122,6 +122,21 @@ DataStoreConfig::DataStoreConfig()
 , d_maxJournalFileSize(0)
 , d_maxQlistFileSize(0)
 , d_maxArchivedFileSets(0)
+, d_writebackThreshold(0)
+, d_groupCommitMaxBytes(0)
+, d_groupCommitMaxRecords(0)
+, d_groupCommitMaxDelayUs(0)
+, d_groupCommitAdaptive(false)
+, d_recoveryThreads(0)
+, d_recoveryVerifyPercent(100)
+, d_scrubIntervalMs(0)
+, d_scrubMaxBytesPerSecond(0)
+, d_recoveryCheckpoint(false)
+, d_hugePages(false)
+, d_residentWindowSize(0)
+, d_readaheadSize(0)
+, d_dropConsumedPages(false)
+, d_precreatePercent(0)
 {
     // NOTHING
 }
@@ -153,6 +168,21 @@ bsl::ostream& DataStoreConfig::print(bsl::ostream& stream,
     printer.printAttribute("hasRecoveredQueuesCb",
                            (recoveredQueuesCb() ? "yes" : "no"));
     printer.printAttribute("maxArchiveFileSets", maxArchivedFileSets());
+    printer.printAttribute("writebackThreshold", writebackThreshold());
+    printer.printAttribute("groupCommitMaxBytes", groupCommitMaxBytes());
+    printer.printAttribute("groupCommitMaxRecords", groupCommitMaxRecords());
+    printer.printAttribute("groupCommitMaxDelayUs", groupCommitMaxDelayUs());
+    printer.printAttribute("groupCommitAdaptive", groupCommitAdaptive());
+    printer.printAttribute("recoveryThreads", recoveryThreads());
+    printer.printAttribute("recoveryVerifyPercent", recoveryVerifyPercent());
+    printer.printAttribute("scrubIntervalMs", scrubIntervalMs());
+    printer.printAttribute("scrubMaxBytesPerSecond", scrubMaxBytesPerSecond());
+    printer.printAttribute("recoveryCheckpoint", recoveryCheckpoint());
+    printer.printAttribute("hugePages", (hasHugePages() ? "true" : "false"));
+    printer.printAttribute("residentWindowSize", residentWindowSize());
+    printer.printAttribute("readaheadSize", readaheadSize());
+    printer.printAttribute("dropConsumedPages", dropConsumedPages());
+    printer.printAttribute("precreatePercent", precreatePercent());
     printer.end();
     return stream;
 }
@@ -39,6 +39,7 @@
 #include <mqbu_storagekey.h>
 
 // BMQ
+#include <bmqc_flatorderedhashmap.h>
 #include <bmqc_orderedhashmap.h>
 #include <bmqt_messageguid.h>
 #include <bmqt_uri.h>
@@ -277,7 +278,10 @@ struct DataStoreRecordKeyLess {
 class DataStoreConfigQueueInfo {
   public:
     // TYPES
-    typedef bmqc::OrderedHashMap<mqbu::StorageKey, bsl::string> AppInfos;
+    typedef bmqc::OrderedHashMap<mqbu::StorageKey,
+                                 bsl::string,
+                                 bslh::Hash<mqbu::StorageKeyHashAlgo> >
+        AppInfos;
 
     /// Collection of intervals [`first`, `second`) where `first` is the start
     /// and `second` is the end of Purge range for some App that does not exist
@@ -288,7 +292,10 @@ class DataStoreConfigQueueInfo {
     typedef PurgeOps::const_iterator                              PurgeOp;
 
     /// A collection of all "ghost" App with corresponding last PurgeOp.
-    typedef bsl::unordered_map<mqbu::StorageKey, PurgeOp> Ghosts;
+    typedef bsl::unordered_map<mqbu::StorageKey,
+                               PurgeOp,
+                               bslh::Hash<mqbu::StorageKeyHashAlgo> >
+        Ghosts;
 
   private:
     // DATA
@@ -374,9 +381,13 @@ class DataStoreConfig {
     typedef QueueKeyInfoMap::const_iterator      QueueKeyInfoMapConstIter;
     typedef bsl::pair<QueueKeyInfoMapIter, bool> QueueKeyInfoMapInsertRc;
 
-    typedef bmqc::OrderedHashMap<DataStoreRecordKey,
-                                 DataStoreRecord,
-                                 DataStoreRecordKeyHashAlgo>
+    /// Outstanding records, in insertion order.  The records are stored in
+    /// contiguous blocks of nodes rather than in a node allocated per
+    /// record, which matters for partitions with millions of outstanding
+    /// messages.
+    typedef bmqc::FlatOrderedHashMap<DataStoreRecordKey,
+                                     DataStoreRecord,
+                                     DataStoreRecordKeyHashAlgo>
         Records;
 
     typedef Records::iterator RecordIterator;
@@ -446,6 +457,71 @@ class DataStoreConfig {
 
     int d_maxArchivedFileSets;
 
+    /// Number of bytes written to a file after which asynchronous writeback
+    /// of those bytes is initiated, or 0 to leave writeback entirely to the
+    /// kernel.
+    bsls::Types::Uint64 d_writebackThreshold;
+
+    /// Maximum size, in bytes, of the replication group commit window, or 0
+    /// for no limit other than the maximum size of a replication event.
+    int d_groupCommitMaxBytes;
+
+    /// Maximum number of records in the replication group commit window, or
+    /// 0 for the default limit.
+    int d_groupCommitMaxRecords;
+
+    /// Maximum time, in microseconds, records are held in the replication
+    /// group commit window, or 0 to disable the group commit window.
+    int d_groupCommitMaxDelayUs;
+
+    /// Whether the replication group commit window is flushed as soon as no
+    /// other record is expected to join it before its maximum delay, given
+    /// the measured arrival rate of records.
+    bool d_groupCommitAdaptive;
+
+    /// Number of worker threads used to verify the payloads of outstanding
+    /// messages during recovery, or 0 to verify them in the calling thread.
+    int d_recoveryThreads;
+
+    /// Percentage of the messages whose payload CRC32-C is verified during
+    /// recovery.
+    int d_recoveryVerifyPercent;
+
+    /// Interval, in milliseconds, at which a batch of outstanding messages
+    /// is scrubbed in the background, or 0 to disable the scrubbing.
+    int d_scrubIntervalMs;
+
+    /// Maximum rate, in bytes per second, at which outstanding messages are
+    /// read by the scrubber, or 0 not to limit it.
+    int d_scrubMaxBytesPerSecond;
+
+    /// Whether a checkpoint of the index of outstanding records is written
+    /// at rollover and clean shutdown, and used to speed up recovery.
+    bool d_recoveryCheckpoint;
+
+    /// Whether the mappings of the files are advised to be backed by
+    /// transparent huge pages.
+    bool d_hugePages;
+
+    /// Number of bytes behind the write position of the data and journal
+    /// files whose pages are kept mapped, or 0 to keep the whole files
+    /// mapped.
+    bsls::Types::Uint64 d_residentWindowSize;
+
+    /// Number of bytes of the data file read ahead when delivering a message
+    /// further than this behind its write position, or 0 to disable the
+    /// readahead.
+    bsls::Types::Uint64 d_readaheadSize;
+
+    /// Whether the pages of the data file before the oldest outstanding
+    /// message are dropped from the page cache.
+    bool d_dropConsumedPages;
+
+    /// Usage, in percent of the capacity of the active data or journal
+    /// file, at which the next file set is created in the background, or 0
+    /// to create it at rollover.
+    int d_precreatePercent;
+
   public:
     // CREATORS
     DataStoreConfig();
@@ -471,6 +547,60 @@ class DataStoreConfig {
     /// reference offering modifiable access to this object.
     DataStoreConfig& setMaxArchivedFileSets(int value);
 
+    /// Set the corresponding member to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    DataStoreConfig& setWritebackThreshold(bsls::Types::Uint64 value);
+    DataStoreConfig& setGroupCommitMaxBytes(int value);
+    DataStoreConfig& setGroupCommitMaxRecords(int value);
+
+    /// Set the corresponding member to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    DataStoreConfig& setGroupCommitMaxDelayUs(int value);
+
+    /// Set the corresponding member to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    DataStoreConfig& setGroupCommitAdaptive(bool value);
+
+    /// Set the corresponding member to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    DataStoreConfig& setRecoveryThreads(int value);
+
+    /// Set the corresponding member to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    DataStoreConfig& setRecoveryVerifyPercent(int value);
+
+    /// Set the corresponding member to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    DataStoreConfig& setScrubIntervalMs(int value);
+
+    /// Set the corresponding member to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    DataStoreConfig& setScrubMaxBytesPerSecond(int value);
+
+    /// Set the corresponding member to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    DataStoreConfig& setRecoveryCheckpoint(bool value);
+
+    /// Set the corresponding member to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    DataStoreConfig& setHugePages(bool value);
+
+    /// Set the corresponding member to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    DataStoreConfig& setResidentWindowSize(bsls::Types::Uint64 value);
+
+    /// Set the corresponding member to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    DataStoreConfig& setReadaheadSize(bsls::Types::Uint64 value);
+
+    /// Set the corresponding member to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    DataStoreConfig& setDropConsumedPages(bool value);
+
+    /// Set the corresponding member to the specified `value` and return a
+    /// reference offering modifiable access to this object.
+    DataStoreConfig& setPrecreatePercent(int value);
+
     // ACCESSORS
     bdlbb::BlobBufferFactory* bufferFactory() const;
     bdlmt::EventScheduler*    scheduler() const;
@@ -491,6 +621,47 @@ class DataStoreConfig {
     /// Return the value of the corresponding member.
     int maxArchivedFileSets() const;
 
+    /// Return the value of the corresponding member.
+    bsls::Types::Uint64 writebackThreshold() const;
+    int                 groupCommitMaxBytes() const;
+    int                 groupCommitMaxRecords() const;
+
+    /// Return the value of the corresponding member.
+    int groupCommitMaxDelayUs() const;
+
+    /// Return the value of the corresponding member.
+    bool groupCommitAdaptive() const;
+
+    /// Return the value of the corresponding member.
+    int recoveryThreads() const;
+
+    /// Return the value of the corresponding member.
+    int recoveryVerifyPercent() const;
+
+    /// Return the value of the corresponding member.
+    int scrubIntervalMs() const;
+
+    /// Return the value of the corresponding member.
+    int scrubMaxBytesPerSecond() const;
+
+    /// Return the value of the corresponding member.
+    bool recoveryCheckpoint() const;
+
+    /// Return the value of the corresponding member.
+    bool hasHugePages() const;
+
+    /// Return the value of the corresponding member.
+    bsls::Types::Uint64 residentWindowSize() const;
+
+    /// Return the value of the corresponding member.
+    bsls::Types::Uint64 readaheadSize() const;
+
+    /// Return the value of the corresponding member.
+    bool dropConsumedPages() const;
+
+    /// Return the value of the corresponding member.
+    int precreatePercent() const;
+
     /// Format this object to the specified output `stream` at the (absolute
     /// value of) the optionally specified indentation `level` and return a
     /// reference to `stream`.  If `level` is specified, optionally specify
@@ -720,6 +891,13 @@ class DataStore : public mqbi::DispatcherClient {
     /// undefined unless this cluster node is the primary for this partition.
     virtual void flushStorage() = 0;
 
+    /// Flush any buffered replication messages to the peers, unless the
+    /// replication group commit window of this partition is still open, in
+    /// which case they are flushed no later than when the window closes.
+    /// Behaviour is undefined unless this cluster node is the primary for
+    /// this partition.
+    virtual void flushStorageIfNeeded() = 0;
+
     // ACCESSORS
 
     /// Return true if this instance is open, false otherwise.
@@ -1069,6 +1247,99 @@ inline DataStoreConfig& DataStoreConfig::setMaxArchivedFileSets(int value)
     return *this;
 }
 
+inline DataStoreConfig&
+DataStoreConfig::setWritebackThreshold(bsls::Types::Uint64 value)
+{
+    d_writebackThreshold = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setGroupCommitMaxBytes(int value)
+{
+    d_groupCommitMaxBytes = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setGroupCommitMaxRecords(int value)
+{
+    d_groupCommitMaxRecords = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setGroupCommitMaxDelayUs(int value)
+{
+    d_groupCommitMaxDelayUs = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setGroupCommitAdaptive(bool value)
+{
+    d_groupCommitAdaptive = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setRecoveryThreads(int value)
+{
+    d_recoveryThreads = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setRecoveryVerifyPercent(int value)
+{
+    d_recoveryVerifyPercent = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setScrubIntervalMs(int value)
+{
+    d_scrubIntervalMs = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setScrubMaxBytesPerSecond(int value)
+{
+    d_scrubMaxBytesPerSecond = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setRecoveryCheckpoint(bool value)
+{
+    d_recoveryCheckpoint = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setHugePages(bool value)
+{
+    d_hugePages = value;
+    return *this;
+}
+
+inline DataStoreConfig&
+DataStoreConfig::setResidentWindowSize(bsls::Types::Uint64 value)
+{
+    d_residentWindowSize = value;
+    return *this;
+}
+
+inline DataStoreConfig&
+DataStoreConfig::setReadaheadSize(bsls::Types::Uint64 value)
+{
+    d_readaheadSize = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setDropConsumedPages(bool value)
+{
+    d_dropConsumedPages = value;
+    return *this;
+}
+
+inline DataStoreConfig& DataStoreConfig::setPrecreatePercent(int value)
+{
+    d_precreatePercent = value;
+    return *this;
+}
+
 // ACCESSORS
 inline bdlbb::BlobBufferFactory* DataStoreConfig::bufferFactory() const
 {
@@ -1153,6 +1424,81 @@ inline int DataStoreConfig::maxArchivedFileSets() const
     return d_maxArchivedFileSets;
 }
 
+inline bsls::Types::Uint64 DataStoreConfig::writebackThreshold() const
+{
+    return d_writebackThreshold;
+}
+
+inline int DataStoreConfig::groupCommitMaxBytes() const
+{
+    return d_groupCommitMaxBytes;
+}
+
+inline int DataStoreConfig::groupCommitMaxRecords() const
+{
+    return d_groupCommitMaxRecords;
+}
+
+inline int DataStoreConfig::groupCommitMaxDelayUs() const
+{
+    return d_groupCommitMaxDelayUs;
+}
+
+inline bool DataStoreConfig::groupCommitAdaptive() const
+{
+    return d_groupCommitAdaptive;
+}
+
+inline int DataStoreConfig::recoveryThreads() const
+{
+    return d_recoveryThreads;
+}
+
+inline int DataStoreConfig::recoveryVerifyPercent() const
+{
+    return d_recoveryVerifyPercent;
+}
+
+inline int DataStoreConfig::scrubIntervalMs() const
+{
+    return d_scrubIntervalMs;
+}
+
+inline int DataStoreConfig::scrubMaxBytesPerSecond() const
+{
+    return d_scrubMaxBytesPerSecond;
+}
+
+inline bool DataStoreConfig::recoveryCheckpoint() const
+{
+    return d_recoveryCheckpoint;
+}
+
+inline bool DataStoreConfig::hasHugePages() const
+{
+    return d_hugePages;
+}
+
+inline bsls::Types::Uint64 DataStoreConfig::residentWindowSize() const
+{
+    return d_residentWindowSize;
+}
+
+inline bsls::Types::Uint64 DataStoreConfig::readaheadSize() const
+{
+    return d_readaheadSize;
+}
+
+inline bool DataStoreConfig::dropConsumedPages() const
+{
+    return d_dropConsumedPages;
+}
+
+inline int DataStoreConfig::precreatePercent() const
+{
+    return d_precreatePercent;
+}
+
 // ---------------------------
 // class DataStoreRecordHandle
 // ---------------------------
@@ -15,6 +15,9 @@
 
 #include <mqbs_datastore.h>
 
+// BMQ
+#include <bmqc_flatorderedhashmap.h>
+
 // TEST DRIVER
 #include <bmqtst_testhelper.h>
 
@@ -457,6 +460,70 @@ static void testN4_orderedMapWithCustomHashBenchmark()
          << " insertions per second.\n";
 }
 
+/// Insert the specified `numElems` broker-like keys in an empty records map
+/// using the specified `HASH`, look all of them up, and print the time taken
+/// by each phase, using the specified `hashName` to describe `HASH`.
+template <class HASH>
+static void benchmarkRecords(bsls::Types::Int64 numElems, const char* hashName)
+{
+    typedef bmqc::FlatOrderedHashMap<mqbs::DataStoreRecordKey,
+                                     mqbs::DataStoreRecord,
+                                     HASH>
+        Records;
+
+    Records records(bmqtst::TestHelperUtil::allocator());
+    records.reserve(static_cast<size_t>(numElems));
+
+    bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+    for (bsls::Types::Int64 i = 0; i < numElems; ++i) {
+        records.insert(bsl::make_pair(makeBrokerLikeKey(i),
+                                      mqbs::DataStoreRecord()));
+    }
+    bsls::Types::Int64 end = bsls::TimeUtil::getTimer();
+
+    cout << "Inserted " << numElems << " records using " << hashName
+         << " hash algorithm in "
+         << bmqu::PrintUtil::prettyTimeInterval(end - begin) << " ("
+         << (end - begin) / numElems << " nano seconds per insertion).\n";
+
+    bsls::Types::Int64 numFound = 0;
+    begin                       = bsls::TimeUtil::getTimer();
+    for (bsls::Types::Int64 i = 0; i < numElems; ++i) {
+        if (records.find(makeBrokerLikeKey(i)) != records.end()) {
+            ++numFound;
+        }
+    }
+    end = bsls::TimeUtil::getTimer();
+
+    BMQTST_ASSERT_EQ(numFound, numElems);
+
+    cout << "Looked up " << numElems << " records using " << hashName
+         << " hash algorithm in "
+         << bmqu::PrintUtil::prettyTimeInterval(end - begin) << " ("
+         << (end - begin) / numElems << " nano seconds per lookup).\n";
+}
+
+BSLA_MAYBE_UNUSED
+static void testN5_recordsHashBenchmark()
+// ------------------------------------------------------------------------
+// RECORDS HASH BENCHMARK
+//
+// Concerns:
+//   Benchmark insert() and find() in 'mqbs::DataStoreConfig::Records' with
+//   the custom hash function, compared to the default hash function, for
+//   keys laid out like the ones of a 'mqbs::FileStore'.
+//
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("RECORDS HASH BENCHMARK");
+
+    const bsls::Types::Int64 k_NUM_ELEMS = 10000000;  // 10M
+
+    benchmarkRecords<bsl::hash<mqbs::DataStoreRecordKey> >(k_NUM_ELEMS,
+                                                           "default");
+    benchmarkRecords<mqbs::DataStoreRecordKeyHashAlgo>(k_NUM_ELEMS, "custom");
+}
+
 #ifdef BMQTST_BENCHMARK_ENABLED
 static void
 testN1_defaultHashBenchmark_GoogleBenchmark(benchmark::State& state)
@@ -574,6 +641,36 @@ static void testN4_orderedMapWithCustomHashBenchmark_GoogleBenchmark(
         }
     }
 }
+
+static void
+testN5_recordsHashBenchmark_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// RECORDS HASH BENCHMARK
+//
+// Concerns:
+//   Benchmark insert() and find() in 'mqbs::DataStoreConfig::Records'
+//   for keys laid out like the ones of a 'mqbs::FileStore'.
+//
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK RECORDS HASH BENCHMARK");
+
+    mqbs::DataStoreConfig::Records records(
+        bmqtst::TestHelperUtil::allocator());
+    records.reserve(state.range(0));
+
+    for (auto _ : state) {
+        records.clear();
+        for (int i = 0; i < state.range(0); ++i) {
+            records.insert(bsl::make_pair(makeBrokerLikeKey(i),
+                                          mqbs::DataStoreRecord()));
+        }
+        for (int i = 0; i < state.range(0); ++i) {
+            benchmark::DoNotOptimize(records.find(makeBrokerLikeKey(i)));
+        }
+    }
+}
 #endif  // BMQTST_BENCHMARK_ENABLED
 
 // ============================================================================
@@ -613,6 +710,12 @@ int main(int argc, char* argv[])
                                        ->Range(10, 10000000)
                                        ->Unit(benchmark::kMillisecond));
         break;
+    case -5:
+        BMQTST_BENCHMARK_WITH_ARGS(testN5_recordsHashBenchmark,
+                                   RangeMultiplier(10)
+                                       ->Range(10, 10000000)
+                                       ->Unit(benchmark::kMillisecond));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
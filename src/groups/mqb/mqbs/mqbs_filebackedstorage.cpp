@@ -74,6 +74,13 @@ void FileBackedStorage::purgeCommon(const mqbu::StorageKey& appKey,
     if (appKey.isNull()) {
         d_virtualStorageCatalog.removeAll();
         // Remove all records from the physical storage as well.
+        //
+        // Note that this is done eagerly, record by record, rather than by
+        // recording a purge watermark and reclaiming the records lazily: the
+        // outstanding bytes of the active file set drive its rollover, and
+        // the journal record of a purged message must not survive into the
+        // next file set.  Replicas apply the purge record the same way, so
+        // that all nodes agree on the remaining records.
 
         for (RecordHandleMapConstIter it = d_handles.begin();
              it != d_handles.end();
@@ -296,6 +303,12 @@ FileBackedStorage::put(mqbi::StorageMessageAttributes*     attributes,
     // Store the specified message in the 'physical' as well as *all*
     // virtual storages.
 
+    // Note that the duplicate check below probes the same bucket of
+    // 'd_handles' as the 'insert' of 'msgGUID' done by every successful PUT,
+    // so a negative answer costs no more than the uniqueness check 'insert'
+    // has to do anyway.  A separate approximate filter in front of it could
+    // not be trusted either, because live (unconfirmed) messages stay in
+    // 'd_handles' for an unbounded time.
     if (d_handles.isInHistory(msgGUID)) {
         return mqbi::StorageResult::e_DUPLICATE;
     }
@@ -624,6 +637,61 @@ FileBackedStorage::remove(const bmqt::MessageGUID& msgGUID, int* msgSize)
     return mqbi::StorageResult::e_SUCCESS;
 }
 
+mqbi::StorageResult::Enum
+FileBackedStorage::gcMessage(const bmqt::MessageGUID& msgGUID)
+{
+    // executed by the *QUEUE DISPATCHER* thread
+
+    RecordHandleMap::iterator it = d_handles.find(msgGUID);
+    if (it == d_handles.end()) {
+        return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
+    }
+
+    const RecordHandlesArray& handles = it->second->d_array;
+    BSLS_ASSERT_SAFE(!handles.empty());
+
+    int msgLen = static_cast<int>(d_store_p->getMessageLenRaw(handles[0]));
+    int rc     = d_store_p->writeDeletionRecord(
+        msgGUID,
+        d_queueKey,
+        DeletionRecordFlag::e_NONE,
+        bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()));
+
+    if (0 != rc) {
+        // Do NOT remove the record without replicating Deletion.
+        return mqbi::StorageResult::e_WRITE_FAILURE;  // RETURN
+    }
+
+    if (queue()) {
+        queue()->queueEngine()->beforeMessageRemoved(msgGUID);
+    }
+    d_virtualStorageCatalog.stats()
+        ->onEvent<mqbstat::QueueStatsDomain::EventType::e_DEL_MESSAGE>(
+            msgLen);
+
+    // Remove message from all virtual storages, updating the counters of the
+    // Apps which have not confirmed it.
+    d_virtualStorageCatalog.gc(msgGUID);
+
+    // Delete all items pointed by all handles for this GUID.
+    for (unsigned int i = 0; i < handles.size(); ++i) {
+        d_store_p->removeRecordRaw(handles[i]);
+    }
+
+    d_capacityMeter.remove(1, msgLen);
+    d_handles.erase(it);
+
+    d_virtualStorageCatalog.stats()
+        ->onEvent<mqbstat::QueueStatsDomain::EventType::e_UPDATE_HISTORY>(
+            d_handles.historySize());
+
+    if (d_handles.empty()) {
+        d_isEmpty.storeRelaxed(1);
+    }
+
+    return mqbi::StorageResult::e_SUCCESS;
+}
+
 mqbi::StorageResult::Enum
 FileBackedStorage::removeAll(const mqbu::StorageKey& appKey)
 {
@@ -772,6 +840,11 @@ void FileBackedStorage::flushStorage()
     d_store_p->flushStorage();
 }
 
+void FileBackedStorage::flushStorageIfNeeded()
+{
+    d_store_p->flushStorageIfNeeded();
+}
+
 int FileBackedStorage::gcExpiredMessages(const bdlt::Datetime& currentTimeUtc,
                                          bsls::Types::Uint64 secondsFromEpoch,
                                          int                 limit)
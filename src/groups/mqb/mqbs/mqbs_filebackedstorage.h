@@ -489,6 +489,17 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     mqbi::StorageResult::Enum remove(const bmqt::MessageGUID& msgGUID,
                                      int* msgSize = 0) BSLS_KEYWORD_OVERRIDE;
 
+    /// Garbage-collect from the storage the message having the specified
+    /// 'msgGUID', regardless of the Apps which have not confirmed it yet,
+    /// after informing the queue engine that the message is being removed.
+    /// Record the event in the storage.
+    /// Return one of the return codes from:
+    /// * e_SUCCESS          : success
+    /// * e_GUID_NOT_FOUND   : 'msgGUID' was not found
+    /// * e_WRITE_FAILURE    : failed to record this event in storage
+    mqbi::StorageResult::Enum
+    gcMessage(const bmqt::MessageGUID& msgGUID) BSLS_KEYWORD_OVERRIDE;
+
     /// Remove all messages from this storage for the App identified by the
     /// specified 'appKey' if 'appKey' is not null.  Otherwise, remove messages
     /// for all Apps.  Record the event in the storage.
@@ -503,6 +514,12 @@ class FileBackedStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     /// undefined unless this cluster node is the primary for this partition.
     void flushStorage() BSLS_KEYWORD_OVERRIDE;
 
+    /// Flush any buffered replication messages to the peers, unless the
+    /// replication group commit window of this partition is still open.
+    /// Behaviour is undefined unless this cluster node is the primary for
+    /// this partition.
+    void flushStorageIfNeeded() BSLS_KEYWORD_OVERRIDE;
+
     /// Attempt to garbage-collect messages for which TTL has expired.
     /// @param currentTimeUtc The current time.
     /// @param secondsFromEpoch The time in seconds from the epoch start.
@@ -481,6 +481,8 @@ class MockDataStore : public mqbs::DataStore {
 
     void flushStorage() BSLS_KEYWORD_OVERRIDE {}
 
+    void flushStorageIfNeeded() BSLS_KEYWORD_OVERRIDE {}
+
     bool isOpen() const BSLS_KEYWORD_OVERRIDE { return true; }
 
     const mqbs::DataStoreConfig& config() const BSLS_KEYWORD_OVERRIDE
@@ -64,6 +64,26 @@ struct FileSet BSLS_KEYWORD_FINAL {
         bsls::Types::Uint64  d_filePosition;
         bsls::Types::Uint64  d_outstandingBytes;
 
+        /// Position in the file up to which asynchronous writeback has been
+        /// initiated.  See `DataStoreConfig::writebackThreshold`.
+        bsls::Types::Uint64 d_writebackPosition;
+
+        /// Position in the file up to which pages have been released from
+        /// the mapping.  See `DataStoreConfig::residentWindowSize`.
+        bsls::Types::Uint64 d_releasePosition;
+
+        /// Position in the file up to which pages have been dropped from the
+        /// page cache.  See `DataStoreConfig::dropConsumedPages`.
+        bsls::Types::Uint64 d_dropPosition;
+
+        /// Beginning of the range of the file last read ahead.  See
+        /// `DataStoreConfig::readaheadSize`.
+        bsls::Types::Uint64 d_readaheadBegin;
+
+        /// End of the range of the file last read ahead.  See
+        /// `DataStoreConfig::readaheadSize`.
+        bsls::Types::Uint64 d_readaheadEnd;
+
         // TRAITS
         BSLMF_NESTED_TRAIT_DECLARATION(FileInfo, bslma::UsesBslmaAllocator)
 
@@ -138,6 +158,11 @@ inline FileSet::FileInfo::FileInfo(bslma::Allocator* allocator)
 , d_fileName(allocator)
 , d_filePosition(0)
 , d_outstandingBytes(0)
+, d_writebackPosition(0)
+, d_releasePosition(0)
+, d_dropPosition(0)
+, d_readaheadBegin(0)
+, d_readaheadEnd(0)
 {
 }
 
@@ -27,6 +27,7 @@
 #include <mqbnet_channel.h>
 #include <mqbs_datafileiterator.h>
 #include <mqbs_filebackedstorage.h>
+#include <mqbs_filestorecheckpoint.h>
 #include <mqbs_filestoreprintutil.h>
 #include <mqbs_filestoreprotocolutil.h>
 #include <mqbs_filestoreset.h>
@@ -40,6 +41,7 @@
 #include <mqbs_replicatedstorage.h>
 #include <mqbs_storageutil.h>
 #include <mqbstat_clusterstats.h>
+#include <mqbstat_queuestats.h>
 #include <mqbstat_statmonitorsnapshotrecorder.h>
 #include <mqbu_exit.h>
 
@@ -67,6 +69,7 @@
 #include <bdlf_placeholder.h>
 #include <bdlma_localsequentialallocator.h>
 #include <bdls_filesystemutil.h>
+#include <bdls_pathutil.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_datetime.h>
 #include <bdlt_epochutil.h>
@@ -82,6 +85,10 @@
 #include <bsl_utility.h>
 #include <bsla_annotations.h>
 #include <bslim_printer.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_threadgroup.h>
+#include <bsls_atomic.h>
+#include <bsls_memoryutil.h>
 #include <bsls_timeinterval.h>
 
 // SYS
@@ -106,6 +113,38 @@ const double k_PARTITION_AVAILABLESPACE_SECS = 20;
 
 const int k_NAGLE_PACKET_COUNT = 100;
 
+/// Weight of the latest sample in the moving average of the time between two
+/// records of an adaptive group commit window, as the inverse of a fraction.
+const int k_GROUP_COMMIT_ARRIVAL_EWMA_WEIGHT = 8;
+
+/// Maximum number of outstanding records visited by one invocation of
+/// `FileStore::scrubDispatched`.
+const int k_SCRUB_BATCH_SIZE = 1000;
+
+/// Minimum number of bytes of the data file lying before the oldest
+/// outstanding message for `FileStore::dropConsumedPagesIfNeeded` to drop
+/// them from the page cache.
+const bsls::Types::Uint64 k_DROP_CONSUMED_MIN_BYTES = 1024 * 1024;
+
+/// Maximum number of records visited by one invocation of
+/// `FileStore::dropConsumedPagesIfNeeded` when searching for the oldest
+/// outstanding message.
+const int k_DROP_CONSUMED_SCAN_SIZE = 1000;
+
+/// Maximum number of expired messages garbage-collected by one invocation of
+/// `FileStore::gcExpiredMessages`, so that a large number of messages
+/// expiring at once does not block the dispatcher thread of the partition.
+const int k_GC_EXPIRED_MESSAGES_BATCH_SIZE = 10000;
+
+/// Number of journal records between two progress reports while iterating
+/// the journal during recovery.
+const bsls::Types::Uint64 k_RECOVERY_PROGRESS_INTERVAL = 1000000;
+
+/// Minimum number of payload bytes of outstanding messages in a chunk of
+/// the journal verified by a recovery worker thread.  Chunks are closed at
+/// the first sync point following this many bytes.
+const bsls::Types::Uint64 k_RECOVERY_MIN_CHUNK_SIZE = 16 * 1024 * 1024;
+
 const int k_KEY_LEN = FileStoreProtocol::k_KEY_LENGTH;
 
 /// k_RESERVED1_SYNC_POINT_SIZE is the space in the end of the JOURNAL file
@@ -296,6 +335,196 @@ void printNextEventRecord(bsl::ostream&                       stream,
     allocator->deallocate(p);
 }
 
+/// Initiate the asynchronous writeback of the bytes of the file represented
+/// by the specified `fileInfo` between its writeback position and its
+/// current position if these are at least the specified `threshold` bytes.
+/// Return zero on success or if there is nothing to write back, and a
+/// non-zero value otherwise with the specified `errorDescription` containing
+/// a detailed error.
+int writebackFileIfNeeded(FileSet::FileInfo*  fileInfo,
+                          bsls::Types::Uint64 threshold,
+                          bsl::ostream&       errorDescription)
+{
+    if (!fileInfo->d_file.isValid() ||
+        fileInfo->d_filePosition <
+            fileInfo->d_writebackPosition + threshold) {
+        return 0;  // RETURN
+    }
+
+    const bsls::Types::Uint64 offset = fileInfo->d_writebackPosition;
+    const bsls::Types::Uint64 length = fileInfo->d_filePosition - offset;
+
+    // Advance the writeback position even on failure, so that a failing
+    // file does not attempt the same (growing) range on every call.
+    fileInfo->d_writebackPosition = fileInfo->d_filePosition;
+
+    return FileSystemUtil::writeback(fileInfo->d_file,
+                                     offset,
+                                     length,
+                                     errorDescription);
+}
+
+/// Release from the mapping of the file represented by the specified
+/// `fileInfo` the pages between its release position and the specified
+/// `window` bytes behind its current position if these are at least
+/// `window` bytes.  Return zero on success or if there is nothing to
+/// release, and a non-zero value otherwise with the specified
+/// `errorDescription` containing a detailed error.
+int releaseFileIfNeeded(FileSet::FileInfo*  fileInfo,
+                        bsls::Types::Uint64 window,
+                        bsl::ostream&       errorDescription)
+{
+    if (!fileInfo->d_file.isValid() ||
+        fileInfo->d_filePosition < fileInfo->d_releasePosition + 2 * window) {
+        return 0;  // RETURN
+    }
+
+    const bsls::Types::Uint64 offset = fileInfo->d_releasePosition;
+    const bsls::Types::Uint64 length = fileInfo->d_filePosition - window -
+                                       offset;
+
+    // Advance the release position even on failure, for the same reason as
+    // in 'writebackFileIfNeeded'.
+    fileInfo->d_releasePosition = offset + length;
+
+    return FileSystemUtil::release(fileInfo->d_file,
+                                   offset,
+                                   length,
+                                   errorDescription);
+}
+
+/// Read ahead asynchronously the specified `readahead` bytes of the file
+/// represented by the specified `fileInfo` starting at the specified
+/// `offset`, if these lie behind its current position and the reader at
+/// `offset` is not already within the first half of the last range read
+/// ahead.
+void readaheadFileIfNeeded(FileSet::FileInfo*  fileInfo,
+                           bsls::Types::Uint64 offset,
+                           bsls::Types::Uint64 readahead)
+{
+    if (fileInfo->d_filePosition <= offset + readahead) {
+        // Recently written, hence most likely still in the page cache.
+
+        return;  // RETURN
+    }
+
+    if (fileInfo->d_readaheadBegin <= offset &&
+        offset + readahead / 2 < fileInfo->d_readaheadEnd) {
+        return;  // RETURN
+    }
+
+    fileInfo->d_readaheadBegin = offset;
+    fileInfo->d_readaheadEnd   = offset + readahead;
+
+    FileSystemUtil::prefault(fileInfo->d_file, offset, readahead);
+}
+
+/// Close the valid files of the specified `fileSet` and delete them from
+/// disk.
+void closeAndDeleteFileSet(FileSet* fileSet)
+{
+    FileSet::FileInfo* fileInfos[] = {&fileSet->d_data,
+                                      &fileSet->d_journal,
+                                      &fileSet->d_qlist};
+
+    for (size_t i = 0; i < sizeof(fileInfos) / sizeof(fileInfos[0]); ++i) {
+        if (fileInfos[i]->d_file.isValid()) {
+            FileSystemUtil::close(&fileInfos[i]->d_file);  // ignore rc
+        }
+        if (!fileInfos[i]->d_fileName.empty()) {
+            bdls::FilesystemUtil::remove(fileInfos[i]->d_fileName);
+        }
+    }
+}
+
+/// Payload, in the DATA file, of an outstanding message recovered from the
+/// JOURNAL, to be verified against the CRC32-C of its MESSAGE record.
+struct RecoveredPayload {
+    // DATA
+
+    /// MESSAGE record of the message, in the mapped JOURNAL file.
+    const MessageRecord* d_record_p;
+
+    /// Offset of the MESSAGE record in the JOURNAL file.
+    bsls::Types::Uint64 d_journalOffset;
+
+    /// Offset of the application data in the DATA file.
+    bsls::Types::Uint64 d_appDataOffset;
+
+    /// Length, in bytes, of the application data.
+    unsigned int d_appDataLen;
+
+    /// CRC32-C of the application data, computed at recovery.
+    unsigned int d_checksum;
+};
+
+/// Compute the checksum of the specified `payloads` in the chunks delimited
+/// by the specified `chunkEnds`, reading them from the specified `dataFile`.
+/// Chunks are claimed one at a time by incrementing the specified
+/// `nextChunk` until none is left, so that this function can be invoked
+/// concurrently by several threads sharing `nextChunk`.
+void computeRecoveredPayloadsChecksums(
+    bsl::vector<RecoveredPayload>*  payloads,
+    const bsl::vector<bsl::size_t>* chunkEnds,
+    bsls::AtomicInt*                nextChunk,
+    const MappedFileDescriptor*     dataFile)
+{
+    const int numChunks = static_cast<int>(chunkEnds->size());
+
+    int chunk;
+    while ((chunk = nextChunk->add(1) - 1) < numChunks) {
+        const bsl::size_t end = (*chunkEnds)[chunk];
+        for (bsl::size_t i = (0 == chunk ? 0 : (*chunkEnds)[chunk - 1]);
+             i < end;
+             ++i) {
+            RecoveredPayload& payload = (*payloads)[i];
+            payload.d_checksum        = bmqp::Crc32c::calculate(
+                dataFile->block().base() + payload.d_appDataOffset,
+                payload.d_appDataLen);
+        }
+    }
+}
+
+/// Advance the specified `jit`, iterating the journal in reverse, to the
+/// next record to visit at recovery, and return the result of advancing
+/// `jit` (see `JournalFileIterator::advance`).  If the specified
+/// `checkpointRecords` is null, every record of the journal is visited.
+/// Otherwise, every record at or after the specified `tailOffset` is
+/// visited, and then only the records in `checkpointRecords` before the
+/// specified `nextRecord` index, which is updated to reflect the visited
+/// record.
+int nextRecoveredRecord(JournalFileIterator*                jit,
+                        bsl::size_t*                        nextRecord,
+                        const FileStoreCheckpoint::Records* checkpointRecords,
+                        bsls::Types::Uint64                 tailOffset)
+{
+    if (0 == checkpointRecords) {
+        return jit->nextRecord();  // RETURN
+    }
+
+    const bsls::Types::Uint64 recordSize = jit->header().recordWords() *
+                                           bmqp::Protocol::k_WORD_SIZE;
+    const bsls::Types::Uint64 position   = jit->recordOffset();
+
+    if (position >= tailOffset + recordSize) {
+        // The previous record was written after the checkpoint.
+
+        return jit->nextRecord();  // RETURN
+    }
+
+    if (0 == *nextRecord) {
+        jit->clear();
+        return 0;  // RETURN
+    }
+
+    --(*nextRecord);
+    const bsls::Types::Uint64 offset = (*checkpointRecords)[*nextRecord]
+                                           .d_offset;
+    BSLS_ASSERT_SAFE(offset < position);
+
+    return jit->advance((position - offset) / recordSize);
+}
+
 }  // close unnamed namespace
 
 // ---------------
@@ -964,7 +1193,7 @@ int FileStore::openInRecoveryMode(bsl::ostream&    errorDescription,
         &fileSetSp->d_journal.d_file,
         &fileSetSp->d_data.d_file,
         d_qListAware ? &fileSetSp->d_qlist.d_file : 0,
-        d_config.hasPrefaultPages());
+        FileStoreUtil::shouldPrefaultMappings(d_config));
 
     if (0 != rc) {
         BALL_LOG_ERROR << partitionDesc() << "Failed to open file set in write"
@@ -980,6 +1209,18 @@ int FileStore::openInRecoveryMode(bsl::ostream&    errorDescription,
     fileSetSp->d_data.d_filePosition    = dataFileOffset;
     fileSetSp->d_qlist.d_filePosition   = d_qListAware ? qlistFileOffset : 0;
 
+    // Recovered content is not subject to asynchronous writeback.
+
+    fileSetSp->d_journal.d_writebackPosition = journalFileOffset;
+    fileSetSp->d_data.d_writebackPosition    = dataFileOffset;
+    fileSetSp->d_qlist.d_writebackPosition   = d_qListAware ? qlistFileOffset
+                                                            : 0;
+
+    // The release positions are left at zero, so that the first release
+    // also drops the pages faulted in by recovery.
+
+    FileStoreUtil::adviseFileSet(fileSetSp.get(), d_config);
+
     // Check if we need to write a sync point in 1-node cluster.  It is
     // important to set the file positions (done above) before this.
 
@@ -1111,6 +1352,9 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
         rc_INVALID_PARTITION_ID     = -18
     };
 
+    const bsls::Types::Int64 firstPassStartTime =
+        bmqu::Time::highResolutionTimer();
+
     FileSet*                    activeFileSet = d_fileSets[0].get();
     const MappedFileDescriptor* dataFd        = dit->mappedFileDescriptor();
     const MappedFileDescriptor* qlistFd       = d_qListAware
@@ -1144,12 +1388,35 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
     StorageKeysOffsets  deletedAppKeysOffsets;
     bsls::Types::Uint64 firstSyncPtOffset = 0;
 
+    // If a valid checkpoint of the outstanding records of the journal is
+    // available, both passes iterate over the records written after the
+    // checkpoint (the tail of the journal), and then only over the records
+    // listed in the checkpoint.  The records skipped were either deleted, or
+    // deletion and confirm records themselves, and had already been applied
+    // when the checkpoint was written.
+
+    FileStoreCheckpoint                 checkpoint(d_allocator_p);
+    const FileStoreCheckpoint::Records* checkpointRecords = 0;
+    bsls::Types::Uint64                 tailOffset        = 0;
+
+    if (d_config.recoveryCheckpoint() &&
+        0 == loadCheckpoint(&checkpoint, *jit, *dataFd, qlistFd)) {
+        checkpointRecords = &checkpoint.records();
+        tailOffset        = checkpoint.journalFilePosition();
+    }
+
+    const bsl::size_t numCheckpointRecords = checkpoint.records().size();
+    bsl::size_t       nextCheckpointRecord = numCheckpointRecords;
+
     JournalFileIterator journalIt(*jit);
     BSLS_ASSERT_SAFE(journalIt.isReverseMode());
 
     // First pass.
     int rc = 0;
-    while ((rc = journalIt.nextRecord()) == 1) {
+    while ((rc = nextRecoveredRecord(&journalIt,
+                                     &nextCheckpointRecord,
+                                     checkpointRecords,
+                                     tailOffset)) == 1) {
         const RecordHeader& recHeader = journalIt.recordHeader();
         RecordType::Enum    rt        = recHeader.type();
         if (rt == RecordType::e_UNDEFINED) {
@@ -1472,9 +1739,15 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
         }
     }
 
+    const bsls::Types::Int64 secondPassStartTime =
+        bmqu::Time::highResolutionTimer();
+
     BALL_LOG_INFO << partitionDesc() << "Completed first pass over the journal"
                   << " with rc: " << rc
                   << ". Offset of 1st sync point: " << firstSyncPtOffset
+                  << ". Time taken: "
+                  << bmqu::PrintUtil::prettyTimeInterval(secondPassStartTime -
+                                                         firstPassStartTime)
                   << ".";
 
     typedef bsl::unordered_set<bmqt::MessageGUID,
@@ -1506,14 +1779,51 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
         d_highestSeqNums[primaryLeaseId] = currentSeqNum;
     }
 
+    // Payloads of the outstanding messages are verified once the second pass
+    // is complete, possibly by several worker threads.  The payloads are
+    // split into chunks whose boundaries are sync points in the journal,
+    // 'chunkEnds' being the index in 'payloads' of the end of each chunk.
+    // Only the configured percentage of the messages is verified, selected
+    // by sequence number.
+
+    bsl::vector<RecoveredPayload> payloads(d_allocator_p);
+    bsl::vector<bsl::size_t>      chunkEnds(d_allocator_p);
+    bsls::Types::Uint64           chunkSize   = 0;
+    bsls::Types::Uint64           numRecords  = 0;
+    bsls::Types::Uint64           numMessages = 0;
+
+    const bsls::Types::Uint64 verifyPercent = static_cast<bsls::Types::Uint64>(
+        bsl::max(d_config.recoveryVerifyPercent(), 0));
+
     // Second pass.
-    while (1 == (rc = jit->nextRecord())) {
+    nextCheckpointRecord = numCheckpointRecords;
+    while (1 == (rc = nextRecoveredRecord(jit,
+                                          &nextCheckpointRecord,
+                                          checkpointRecords,
+                                          tailOffset))) {
         const RecordHeader& recHeader = jit->recordHeader();
         RecordType::Enum    rt        = recHeader.type();
         BSLS_ASSERT_SAFE(RecordType::e_UNDEFINED != rt);
         BSLS_ASSERT_SAFE(0 != recHeader.primaryLeaseId());
         BSLS_ASSERT_SAFE(0 != recHeader.sequenceNumber());
 
+        if (0 == (++numRecords % k_RECOVERY_PROGRESS_INTERVAL)) {
+            // Journal is iterated backwards, from '*journalOffset'.
+
+            BALL_LOG_INFO << partitionDesc() << "Recovery: second pass over "
+                          << "the journal processed "
+                          << bmqu::PrintUtil::prettyNumber(
+                                 static_cast<bsls::Types::Int64>(numRecords))
+                          << " records ["
+                          << computePercentage(*journalOffset -
+                                                   jit->recordOffset(),
+                                               *journalOffset)
+                          << "%], recovered "
+                          << bmqu::PrintUtil::prettyNumber(
+                                 static_cast<bsls::Types::Int64>(numMessages))
+                          << " messages so far.";
+        }
+
         // Validate PSN in the RecordHeader. Note that leaseId in
         // the RecordHeader can be smaller than 'primaryLeaseId'.
 
@@ -1532,8 +1842,11 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
         if (recHeader.primaryLeaseId() == primaryLeaseId) {
             bool invalidSeqNum = false;
 
-            if (jit->recordOffset() >= firstSyncPtOffset) {
-                // Not a rolled-over record.
+            if (jit->recordOffset() >= firstSyncPtOffset &&
+                jit->recordOffset() >= tailOffset) {
+                // Not a rolled-over record, nor a record of the checkpoint
+                // (records between two records of the checkpoint are not
+                // visited).
 
                 if (recHeader.sequenceNumber() != (sequenceNum - 1)) {
                     invalidSeqNum = true;
@@ -1592,6 +1905,12 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
 
         if (RecordType::e_JOURNAL_OP == rt) {
             const JournalOpRecord& rec = jit->asJournalOpRecord();
+
+            if (chunkSize >= k_RECOVERY_MIN_CHUNK_SIZE) {
+                chunkEnds.push_back(payloads.size());
+                chunkSize = 0;
+            }
+
             // Perform basic sanity check for as many fields as possible.
 
             if (SyncPointType::e_UNDEFINED == rec.syncPointType()) {
@@ -2625,23 +2944,16 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
             unsigned int appDataLen = totalLen - headerSize - optionsSize -
                                       lastByte;
 
-            // Check CRC32C
-            unsigned int checksum = bmqp::Crc32c::calculate(
-                dataFd->block().base() + appDataOffset,
-                appDataLen);
-
-            if (rec.crc32c() != checksum) {
-                BMQTSK_ALARMLOG_ALARM("RECOVERY")
-                    << partitionDesc() << "Recovery: CRC mismatch for guid ["
-                    << rec.messageGUID() << "] for queueKey ["
-                    << rec.queueKey() << "] in journal file ["
-                    << activeFileSet->d_journal.d_fileName
-                    << "], offset: " << jit->recordOffset()
-                    << ", index: " << jit->recordIndex()
-                    << ". CRC32-C in JOURNAL record: " << rec.crc32c()
-                    << ". CRC32-C of payload in DATA file: " << checksum
-                    << ". Payload offset in DATA file: " << appDataOffset
-                    << BMQTSK_ALARMLOG_END;
+            // CRC32C is checked once the second pass is complete.
+            ++numMessages;
+            if (sequenceNum % 100 < verifyPercent) {
+                RecoveredPayload payload = {&rec,
+                                            jit->recordOffset(),
+                                            appDataOffset,
+                                            appDataLen,
+                                            0};
+                payloads.push_back(payload);
+                chunkSize += appDataLen;
             }
 
             DataStoreRecordKey key(sequenceNum, primaryLeaseId);
@@ -2665,8 +2977,96 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
         }
     }
 
+    if (checkpointRecords) {
+        // The last record of each file, and the record with the highest
+        // sequence number of a primary lease id, may not have been visited.
+
+        *journalOffset = bsl::max(*journalOffset,
+                                  checkpoint.journalFilePosition());
+        *dataOffset    = bsl::max(*dataOffset, checkpoint.dataFilePosition());
+        if (d_qListAware) {
+            *qlistOffset = bsl::max(*qlistOffset,
+                                    checkpoint.qlistFilePosition());
+        }
+
+        const FileStoreCheckpoint::SequenceNumbers& seqNums =
+            checkpoint.highestSequenceNums();
+        for (bsl::size_t i = 0; i < seqNums.size(); ++i) {
+            bsls::Types::Uint64& seqNum = d_highestSeqNums[seqNums[i].first];
+            seqNum = bsl::max(seqNum, seqNums[i].second);
+        }
+    }
+
+    const bsls::Types::Int64 verificationStartTime =
+        bmqu::Time::highResolutionTimer();
+
     BALL_LOG_INFO << partitionDesc() << "Completed second pass over the "
-                  << "journal with rc: " << rc;
+                  << "journal with rc: " << rc << ". Records processed: "
+                  << numRecords << ", messages recovered: " << numMessages
+                  << ". Time taken: "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         verificationStartTime - secondPassStartTime)
+                  << ".";
+
+    if (payloads.size() != (chunkEnds.empty() ? 0 : chunkEnds.back())) {
+        chunkEnds.push_back(payloads.size());
+    }
+
+    // Check CRC32C of the payloads.  Note that worker threads only read the
+    // mapped DATA file and each update the payloads of the chunks they
+    // claimed, so no synchronization other than joining them is needed.
+
+    const int numThreads = bsl::min(d_config.recoveryThreads(),
+                                    static_cast<int>(chunkEnds.size()));
+
+    bsls::AtomicInt nextChunk(0);
+    int             numThreadsCreated = 0;
+
+    if (1 < numThreads) {
+        bslmt::ThreadGroup threadGroup(d_allocator_p);
+        numThreadsCreated = threadGroup.addThreads(
+            bdlf::BindUtil::bind(&computeRecoveredPayloadsChecksums,
+                                 &payloads,
+                                 &chunkEnds,
+                                 &nextChunk,
+                                 dataFd),
+            numThreads);
+        threadGroup.joinAll();
+    }
+
+    // Verify remaining chunks, if any, in this thread.  This is the case if
+    // no worker thread was requested or could be created.
+
+    computeRecoveredPayloadsChecksums(&payloads,
+                                      &chunkEnds,
+                                      &nextChunk,
+                                      dataFd);
+
+    for (bsl::size_t i = 0; i < payloads.size(); ++i) {
+        const RecoveredPayload& payload = payloads[i];
+        const MessageRecord&    rec     = *payload.d_record_p;
+
+        if (rec.crc32c() != payload.d_checksum) {
+            BMQTSK_ALARMLOG_ALARM("RECOVERY")
+                << partitionDesc() << "Recovery: CRC mismatch for guid ["
+                << rec.messageGUID() << "] for queueKey [" << rec.queueKey()
+                << "] in journal file [" << activeFileSet->d_journal.d_fileName
+                << "], offset: " << payload.d_journalOffset
+                << ". CRC32-C in JOURNAL record: " << rec.crc32c()
+                << ". CRC32-C of payload in DATA file: " << payload.d_checksum
+                << ". Payload offset in DATA file: " << payload.d_appDataOffset
+                << BMQTSK_ALARMLOG_END;
+        }
+    }
+
+    BALL_LOG_INFO << partitionDesc() << "Verified payloads of "
+                  << payloads.size() << " recovered messages in "
+                  << chunkEnds.size() << " chunks using "
+                  << numThreadsCreated << " worker threads. Time taken: "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         bmqu::Time::highResolutionTimer() -
+                         verificationStartTime)
+                  << ".";
 
     BALL_LOG_INFO_BLOCK
     {
@@ -2686,6 +3086,279 @@ int FileStore::recoverMessages(QueueKeyInfoMap*     queueKeyInfoMap,
     return rc_SUCCESS;
 }
 
+int FileStore::loadCheckpoint(FileStoreCheckpoint*        checkpoint,
+                              const JournalFileIterator&  jit,
+                              const MappedFileDescriptor& dataFile,
+                              const MappedFileDescriptor* qlistFile)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(checkpoint);
+    BSLS_ASSERT_SAFE(0 < d_fileSets.size());
+
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS                  = 0,
+        rc_LOAD_FAILURE             = -1,
+        rc_PARTITION_ID_MISMATCH    = -2,
+        rc_JOURNAL_FILE_MISMATCH    = -3,
+        rc_INVALID_JOURNAL_POSITION = -4,
+        rc_LAST_RECORD_MISMATCH     = -5,
+        rc_INVALID_FILE_POSITION    = -6,
+        rc_INVALID_RECORD           = -7
+    };
+
+    bsl::string fileName(d_allocator_p);
+    FileStoreCheckpoint::createFileName(&fileName,
+                                        d_config.location(),
+                                        d_config.partitionId());
+
+    if (!bdls::FilesystemUtil::exists(fileName)) {
+        BALL_LOG_INFO << partitionDesc() << "No checkpoint [" << fileName
+                      << "] found, recovering from the entire journal.";
+        return rc_LOAD_FAILURE;  // RETURN
+    }
+
+    bmqu::MemOutStream errorDesc;
+    int                rc = checkpoint->load(errorDesc, fileName);
+    if (0 != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to load checkpoint ["
+                      << fileName << "], rc: " << rc
+                      << ", error: " << errorDesc.str()
+                      << ". Recovering from the entire journal.";
+        return rc * 10 + rc_LOAD_FAILURE;  // RETURN
+    }
+
+    BALL_LOG_INFO << partitionDesc() << "Loaded checkpoint [" << fileName
+                  << "]: " << *checkpoint;
+
+    // Any mismatch between the checkpoint and the journal is reported in
+    // 'errorDesc', and makes recovery fall back to the entire journal.
+
+    const MappedFileDescriptor& journalFile = *jit.mappedFileDescriptor();
+    const JournalFileHeader&    header      = jit.header();
+
+    const bsls::Types::Uint64 recordSize = header.recordWords() *
+                                           bmqp::Protocol::k_WORD_SIZE;
+    const bsls::Types::Uint64 position   = checkpoint->journalFilePosition();
+    const bsls::Types::Uint64 firstRecordPosition =
+        (FileStoreProtocolUtil::bmqHeader(journalFile).headerWords() +
+         header.headerWords()) *
+        bmqp::Protocol::k_WORD_SIZE;
+
+    bsl::string journalFileName(d_allocator_p);
+    bdls::PathUtil::getLeaf(&journalFileName,
+                            d_fileSets[0]->d_journal.d_fileName);
+
+    if (checkpoint->partitionId() != d_config.partitionId()) {
+        errorDesc << "partitionId mismatch: " << checkpoint->partitionId();
+        rc = rc_PARTITION_ID_MISMATCH;
+    }
+    else if (checkpoint->journalFileName() != journalFileName) {
+        errorDesc << "journal file mismatch: ["
+                  << checkpoint->journalFileName() << "], while the journal "
+                  << "to recover is [" << journalFileName << "]";
+        rc = rc_JOURNAL_FILE_MISMATCH;
+    }
+    else if (0 == jit.lastRecordPosition() ||
+             position < firstRecordPosition + recordSize ||
+             position > jit.lastRecordPosition() + recordSize ||
+             0 != (position - firstRecordPosition) % recordSize) {
+        errorDesc << "invalid journal position: " << position
+                  << ", last record position in the journal: "
+                  << jit.lastRecordPosition();
+        rc = rc_INVALID_JOURNAL_POSITION;
+    }
+    else if (checkpoint->dataFilePosition() > dataFile.fileSize() ||
+             (qlistFile &&
+              checkpoint->qlistFilePosition() > qlistFile->fileSize())) {
+        errorDesc << "invalid DATA or QLIST file position: "
+                  << checkpoint->dataFilePosition() << ", "
+                  << checkpoint->qlistFilePosition();
+        rc = rc_INVALID_FILE_POSITION;
+    }
+    else {
+        const OffsetPtr<const RecordHeader> lastRecHeader(
+            journalFile.block(),
+            position - recordSize);
+        if (lastRecHeader->primaryLeaseId() !=
+                checkpoint->lastPrimaryLeaseId() ||
+            lastRecHeader->sequenceNumber() != checkpoint->lastSequenceNum()) {
+            errorDesc << "PSN mismatch for the last record: "
+                      << printPSN(lastRecHeader->primaryLeaseId(),
+                                  lastRecHeader->sequenceNumber())
+                      << ", expected: "
+                      << printPSN(checkpoint->lastPrimaryLeaseId(),
+                                  checkpoint->lastSequenceNum());
+            rc = rc_LAST_RECORD_MISMATCH;
+        }
+    }
+
+    const FileStoreCheckpoint::Records& records = checkpoint->records();
+    for (bsl::size_t i = 0; rc_SUCCESS == rc && i < records.size(); ++i) {
+        const FileStoreCheckpoint::Record& record = records[i];
+
+        if (record.d_offset < firstRecordPosition ||
+            record.d_offset + recordSize > position ||
+            0 != (record.d_offset - firstRecordPosition) % recordSize ||
+            (0 < i && record.d_offset <= records[i - 1].d_offset)) {
+            errorDesc << "invalid offset of record #" << i << ": "
+                      << record.d_offset;
+            rc = rc_INVALID_RECORD;
+            break;  // BREAK
+        }
+
+        const OffsetPtr<const RecordHeader> recHeader(journalFile.block(),
+                                                      record.d_offset);
+        if (recHeader->type() == RecordType::e_UNDEFINED ||
+            recHeader->primaryLeaseId() != record.d_primaryLeaseId ||
+            recHeader->sequenceNumber() != record.d_sequenceNum) {
+            errorDesc << "mismatch for record #" << i << " at offset "
+                      << record.d_offset << ": type " << recHeader->type()
+                      << ", PSN "
+                      << printPSN(recHeader->primaryLeaseId(),
+                                  recHeader->sequenceNumber())
+                      << ", expected PSN "
+                      << printPSN(record.d_primaryLeaseId,
+                                  record.d_sequenceNum);
+            rc = rc_INVALID_RECORD;
+        }
+    }
+
+    if (rc_SUCCESS != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Ignoring checkpoint ["
+                      << fileName << "], rc: " << rc
+                      << ", reason: " << errorDesc.str()
+                      << ". Recovering from the entire journal.";
+        checkpoint->reset();
+        return rc;  // RETURN
+    }
+
+    BALL_LOG_INFO << partitionDesc() << "Using checkpoint [" << fileName
+                  << "]: recovering from " << records.size()
+                  << " checkpointed records and "
+                  << (jit.lastRecordPosition() + recordSize - position) /
+                         recordSize
+                  << " records written after the checkpoint.";
+
+    return rc_SUCCESS;
+}
+
+void FileStore::writeCheckpoint()
+{
+    // executed by the *DISPATCHER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < d_fileSets.size());
+
+    if (d_records.empty() && d_syncPoints.empty()) {
+        // Nothing is outstanding in the journal.  Note that an existing
+        // checkpoint of the same journal, if any, remains valid since the
+        // journal has only been appended to since it was written.
+
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 startTime = bmqu::Time::highResolutionTimer();
+
+    const FileSet*            activeFileSet = d_fileSets[0].get();
+    const FileSet::FileInfo&  journal       = activeFileSet->d_journal;
+    const bsls::Types::Uint64 recordSize =
+        FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
+
+    BSLS_ASSERT_SAFE(journal.d_filePosition >= recordSize);
+
+    bsl::string journalFileName(d_allocator_p);
+    bdls::PathUtil::getLeaf(&journalFileName, journal.d_fileName);
+
+    const OffsetPtr<const RecordHeader> lastRecHeader(
+        journal.d_file.block(),
+        journal.d_filePosition - recordSize);
+
+    FileStoreCheckpoint checkpoint(d_allocator_p);
+    checkpoint.setPartitionId(d_config.partitionId())
+        .setJournalFileName(journalFileName)
+        .setJournalFilePosition(journal.d_filePosition)
+        .setDataFilePosition(activeFileSet->d_data.d_filePosition)
+        .setQlistFilePosition(
+            d_qListAware ? activeFileSet->d_qlist.d_filePosition : 0)
+        .setLastRecord(lastRecHeader->primaryLeaseId(),
+                       lastRecHeader->sequenceNumber());
+
+    // Collect the offsets of the outstanding records and sync points, and
+    // load their PSN from the journal.
+
+    FileStoreCheckpoint::Records& records = checkpoint.records();
+    records.reserve(d_records.size() + d_syncPoints.size());
+
+    bsl::vector<bsls::Types::Uint64> offsets(d_allocator_p);
+    offsets.reserve(d_records.size() + d_syncPoints.size());
+    for (RecordConstIterator it = d_records.begin(); it != d_records.end();
+         ++it) {
+        offsets.push_back(it->second.d_recordOffset);
+    }
+    for (SyncPointOffsetConstIter it = d_syncPoints.begin();
+         it != d_syncPoints.end();
+         ++it) {
+        offsets.push_back(it->offset());
+    }
+    bsl::sort(offsets.begin(), offsets.end());
+
+    LeaseIdToSeqNumMap highestSeqNums(d_highestSeqNums, d_allocator_p);
+    if (0 < d_primaryLeaseId) {
+        bsls::Types::Uint64& seqNum = highestSeqNums[d_primaryLeaseId];
+        seqNum = bsl::max(seqNum, sequenceNumber());
+    }
+
+    for (bsl::size_t i = 0; i < offsets.size(); ++i) {
+        if (0 < i && offsets[i] == offsets[i - 1]) {
+            continue;  // CONTINUE
+        }
+
+        if (offsets[i] + recordSize > journal.d_filePosition) {
+            BALL_LOG_WARN << partitionDesc() << "Not writing checkpoint: "
+                          << "outstanding record at offset " << offsets[i]
+                          << " is beyond the journal position "
+                          << journal.d_filePosition << ".";
+            return;  // RETURN
+        }
+
+        const OffsetPtr<const RecordHeader> recHeader(journal.d_file.block(),
+                                                      offsets[i]);
+        const FileStoreCheckpoint::Record record = {
+            offsets[i],
+            recHeader->sequenceNumber(),
+            recHeader->primaryLeaseId()};
+        records.push_back(record);
+
+        bsls::Types::Uint64& seqNum = highestSeqNums[record.d_primaryLeaseId];
+        seqNum = bsl::max(seqNum, record.d_sequenceNum);
+    }
+
+    checkpoint.highestSequenceNums().assign(highestSeqNums.begin(),
+                                            highestSeqNums.end());
+
+    bsl::string fileName(d_allocator_p);
+    FileStoreCheckpoint::createFileName(&fileName,
+                                        d_config.location(),
+                                        d_config.partitionId());
+
+    bmqu::MemOutStream errorDesc;
+    const int          rc = checkpoint.save(errorDesc, fileName);
+    if (0 != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to write checkpoint ["
+                      << fileName << "], rc: " << rc
+                      << ", error: " << errorDesc.str();
+        return;  // RETURN
+    }
+
+    BALL_LOG_INFO << partitionDesc() << "Wrote checkpoint [" << fileName
+                  << "] of " << records.size()
+                  << " outstanding records. Time taken: "
+                  << bmqu::PrintUtil::prettyTimeInterval(
+                         bmqu::Time::highResolutionTimer() - startTime)
+                  << ".";
+}
+
 int FileStore::create(FileSetSp* fileSetSp)
 {
     // PRECONDITIONS
@@ -2701,16 +3374,62 @@ int FileStore::create(FileSetSp* fileSetSp)
                                    d_qListAware,
                                    d_allocator_p);
     if (0 == rc) {
-        FileSet* fs = fileSetSp->get();
-        fs->d_aliasedChunk_sp.reset(
-            fs,
-            bdlf::BindUtil::bind(&FileStore::gc, this, fs));
-        fs->d_aliasedChunk_wp = fs->d_aliasedChunk_sp;
+        initAliasedChunk(fileSetSp->get());
     }
 
     return rc;
 }
 
+int FileStore::takePrecreatedFileSet(FileSetSp* fileSetSp)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(fileSetSp);
+
+    enum {
+        rc_SUCCESS          = 0,
+        rc_NOT_AVAILABLE    = -1,
+        rc_ACTIVATE_FAILURE = -2
+    };
+
+    FileSetSp precreated;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_precreateMutex);  // LOCK
+        precreated.swap(d_precreatedFileSet);
+    }
+
+    if (!precreated) {
+        return rc_NOT_AVAILABLE;  // RETURN
+    }
+
+    bmqu::MemOutStream errorDesc;
+    const int          rc = FileStoreUtil::activatePrecreated(
+        errorDesc,
+        precreated.get(),
+        d_config.partitionId(),
+        d_config.location(),
+        d_qListAware);
+    if (0 != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to activate precreated "
+                      << "file set, rc: " << rc << ", reason: "
+                      << errorDesc.str() << ". Creating a new file set.";
+        closeAndDeleteFileSet(precreated.get());
+        return 10 * rc + rc_ACTIVATE_FAILURE;  // RETURN
+    }
+
+    initAliasedChunk(precreated.get());
+    *fileSetSp = precreated;
+
+    return rc_SUCCESS;
+}
+
+void FileStore::initAliasedChunk(FileSet* fileSet)
+{
+    fileSet->d_aliasedChunk_sp.reset(
+        fileSet,
+        bdlf::BindUtil::bind(&FileStore::gc, this, fileSet));
+    fileSet->d_aliasedChunk_wp = fileSet->d_aliasedChunk_sp;
+}
+
 int FileStore::rolloverImpl(bsls::Types::Uint64 timestamp)
 {
     // PRECONDITIONS
@@ -2736,27 +3455,45 @@ int FileStore::rolloverImpl(bsls::Types::Uint64 timestamp)
     mqbstat::StatMonitorSnapshotRecorder statRecorder(partitionDesc(),
                                                       d_allocator_p);
 
-    // Create new files, add header etc.
+    // Use the file set created in the background if available, or create
+    // new files, add header etc.
     FileSetSp newActiveFileSetSp;
-    int       rc = create(&newActiveFileSetSp);
-    if (0 != rc) {
-        // 'create' will log error
-        return rc;  // RETURN
+    int       rc = takePrecreatedFileSet(&newActiveFileSetSp);
+    if (0 == rc) {
+        BALL_LOG_INFO << partitionDesc() << "Rollover: using precreated "
+                      << "file set [" << newActiveFileSetSp->d_data.d_fileName
+                      << "], [" << newActiveFileSetSp->d_journal.d_fileName
+                      << "]";
+    }
+    else {
+        rc = create(&newActiveFileSetSp);
+        if (0 != rc) {
+            // 'create' will log error
+            return rc;  // RETURN
+        }
     }
 
     // Iterate over outstanding records in the active set, and copy them to the
     // rollover set.
 
     QueueKeyCounterMap queueKeyCounterMap;
+    DataCopyRun        dataCopyRun = {0, 0, 0, 0};
     for (RecordIterator recordIt = d_records.begin();
          recordIt != d_records.end();
          ++recordIt) {
         writeRolledOverRecord(&(recordIt->second),
                               &queueKeyCounterMap,
+                              &dataCopyRun,
                               activeFileSet,
                               newActiveFileSetSp.get());
     }
 
+    // Copy the last run of payloads.  All the payloads must be in the new
+    // DATA file before the first sync point of the new JOURNAL is written
+    // below.
+
+    copyDataRun(&dataCopyRun, activeFileSet, newActiveFileSetSp.get());
+
     // Print summary of rolled over queues.
     bmqu::MemOutStream outStream;
     outStream << partitionDesc() << "Queue rollover summary:"
@@ -2914,7 +3651,7 @@ int FileStore::rolloverImpl(bsls::Types::Uint64 timestamp)
         << " ("
         << ((newActiveFileSetSp->d_data.d_filePosition * 100) /
             activeFileSet->d_data.d_filePosition)
-        << "%)\n";
+        << "%), copied in " << dataCopyRun.d_numCopies << " ranges\n";
 
     out << "    JOURNAL file size (new/old): "
         << bmqu::PrintUtil::prettyBytes(
@@ -3027,6 +3764,13 @@ int FileStore::rolloverImpl(bsls::Types::Uint64 timestamp)
         bmqu::Time::nowMonotonicClock(),
         bdlf::BindUtil::bind(&FileStore::deleteArchiveFilesCb, this));
 
+    // The new active file set only contains outstanding records, which makes
+    // it a cheap point at which to checkpoint them.
+
+    if (d_config.recoveryCheckpoint()) {
+        writeCheckpoint();
+    }
+
     BALL_LOG_INFO_BLOCK
     {
         statRecorder.print(BALL_LOG_OUTPUT_STREAM, "ROLLOVER COMPLETE");
@@ -3632,6 +4376,51 @@ void FileStore::gcWorkerDispatched(const bsl::shared_ptr<FileSet>& fileSet)
                                                          archiveStartTime);
 }
 
+void FileStore::precreateWorkerDispatched()
+{
+    // executed by a *WORKER* thread
+
+    FileSetSp          fileSetSp;
+    bmqu::MemOutStream errorDesc;
+
+    bsls::Types::Int64 startTime = bmqu::Time::highResolutionTimer();
+    const int          rc        = FileStoreUtil::precreate(errorDesc,
+                                              &fileSetSp,
+                                              this,
+                                              d_config.partitionId(),
+                                              d_config,
+                                              partitionDesc(),
+                                              d_qListAware,
+                                              d_allocator_p);
+    bsls::Types::Int64 endTime = bmqu::Time::highResolutionTimer();
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_precreateMutex);  // LOCK
+    d_precreateInProgress = false;
+
+    if (0 != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to precreate file set, "
+                      << "rc: " << rc << ", reason: " << errorDesc.str()
+                      << ". The file set will be created at rollover.";
+        return;  // RETURN
+    }
+
+    if (!d_isOpen) {
+        // Closed in the meantime; 'close' has already discarded any
+        // precreated file set.
+
+        closeAndDeleteFileSet(fileSetSp.get());
+        return;  // RETURN
+    }
+
+    BALL_LOG_INFO << partitionDesc() << "Precreated file set ["
+                  << fileSetSp->d_data.d_fileName << "], ["
+                  << fileSetSp->d_journal.d_fileName
+                  << "] for the next rollover. Time taken: "
+                  << bmqu::PrintUtil::prettyTimeInterval(endTime - startTime);
+
+    d_precreatedFileSet = fileSetSp;
+}
+
 int FileStore::writeQueueOpRecord(DataStoreRecordHandle*  handle,
                                   const mqbu::StorageKey& queueKey,
                                   const mqbu::StorageKey& appKey,
@@ -3774,16 +4563,17 @@ void FileStore::writeQueueOpRecordImpl(DataStoreRecordHandle*  handle,
 
 void FileStore::writeRolledOverRecord(DataStoreRecord*    record,
                                       QueueKeyCounterMap* queueKeyCounterMap,
+                                      DataCopyRun*        dataCopyRun,
                                       FileSet*            oldFileSet,
                                       FileSet*            newFileSet)
 {
     // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dataCopyRun);
     BSLS_ASSERT_SAFE(0 != record->d_recordOffset);
     BSLS_ASSERT_SAFE(RecordType::e_UNDEFINED != record->d_recordType &&
                      RecordType::e_JOURNAL_OP != record->d_recordType);
 
     // Local refs for convenience
-    MappedFileDescriptor& rDataFile     = newFileSet->d_data.d_file;
     bsls::Types::Uint64&  rDataFilePos  = newFileSet->d_data.d_filePosition;
     MappedFileDescriptor& rJournal      = newFileSet->d_journal.d_file;
     bsls::Types::Uint64&  rJournalPos   = newFileSet->d_journal.d_filePosition;
@@ -3804,8 +4594,12 @@ void FileStore::writeRolledOverRecord(DataStoreRecord*    record,
         BSLS_ASSERT_SAFE(0 ==
                          newDataFileOffset % bmqp::Protocol::k_DWORD_SIZE);
 
-        // Copy payload (including DataHeader) to data file.  This should be
-        // done *before* copying message record to journal file.
+        // Append payload (including DataHeader) to the run of payloads to
+        // copy to data file.  Live payloads are mostly contiguous in the old
+        // data file, since they are written in the same order as their
+        // records, so that copying them by runs replaces a copy per message
+        // by a few large sequential copies.  The copy is deferred, but the
+        // payloads are in place before the rollover completes.
 
         bsls::Types::Uint64 messageOffset =
             static_cast<bsls::Types::Uint64>(fromRec->messageOffsetDwords()) *
@@ -3817,9 +4611,15 @@ void FileStore::writeRolledOverRecord(DataStoreRecord*    record,
         const unsigned int dataMsgSize = dataHeader->messageWords() *
                                          bmqp::Protocol::k_WORD_SIZE;
 
-        bsl::memcpy(rDataFile.block().base() + rDataFilePos,
-                    aDataFile.block().base() + messageOffset,
-                    dataMsgSize);
+        if (dataCopyRun->d_fromOffset + dataCopyRun->d_length !=
+            messageOffset) {
+            copyDataRun(dataCopyRun, oldFileSet, newFileSet);
+            dataCopyRun->d_fromOffset = messageOffset;
+            dataCopyRun->d_toOffset   = newDataFileOffset;
+        }
+        BSLS_ASSERT_SAFE(dataCopyRun->d_toOffset + dataCopyRun->d_length ==
+                         newDataFileOffset);
+        dataCopyRun->d_length += dataMsgSize;
 
         rDataFilePos += dataMsgSize;
 
@@ -3942,13 +4742,34 @@ void FileStore::writeRolledOverRecord(DataStoreRecord*    record,
         FileStoreProtocol::k_JOURNAL_RECORD_SIZE;
 }
 
-void FileStore::issueSyncPointCb()
+void FileStore::copyDataRun(DataCopyRun* dataCopyRun,
+                            FileSet*     oldFileSet,
+                            FileSet*     newFileSet)
 {
-    // executed by the *SCHEDULER* thread
-
-    // This routine is invoked *only* by the scheduled recurring event.
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(dataCopyRun);
 
-    if (!d_isOpen) {
+    if (0 == dataCopyRun->d_length) {
+        return;  // RETURN
+    }
+
+    FileSystemUtil::copy(&newFileSet->d_data.d_file,
+                         dataCopyRun->d_toOffset,
+                         oldFileSet->d_data.d_file,
+                         dataCopyRun->d_fromOffset,
+                         dataCopyRun->d_length);
+
+    dataCopyRun->d_length = 0;
+    ++dataCopyRun->d_numCopies;
+}
+
+void FileStore::issueSyncPointCb()
+{
+    // executed by the *SCHEDULER* thread
+
+    // This routine is invoked *only* by the scheduled recurring event.
+
+    if (!d_isOpen) {
         return;  // RETURN
     }
 
@@ -3957,6 +4778,257 @@ void FileStore::issueSyncPointCb()
                                  d_config.partitionId()));
 }
 
+void FileStore::scrubCb()
+{
+    // executed by the *SCHEDULER* thread
+
+    // This routine is invoked *only* by the scheduled recurring event.
+
+    if (!d_isOpen || d_scrubInProgress) {
+        return;  // RETURN
+    }
+
+    execute(bdlf::BindUtil::bind(&FileStore::scrubDispatched, this));
+}
+
+void FileStore::scrubDispatched()
+{
+    // executed by the *DISPATCHER* thread
+
+    if (!d_isOpen || d_scrubInProgress || d_records.empty()) {
+        return;  // RETURN
+    }
+
+    FileSet* activeFileSet = d_fileSets[0].get();
+    BSLS_ASSERT_SAFE(activeFileSet);
+
+    if (!activeFileSet->d_aliasedChunk_sp) {
+        return;  // RETURN
+    }
+
+    RecordIterator it = d_records.find(d_scrubCursor);
+    if (it == d_records.end()) {
+        // New pass, or the cursor is no longer outstanding.
+
+        it                    = d_records.begin();
+        d_numScrubbedMessages = 0;
+    }
+    else {
+        ++it;
+    }
+
+    // Limit the size of the batch so that, at one batch per interval, the
+    // scrubber reads no more than the configured rate.  A batch always holds
+    // at least one message, however large.
+
+    bsls::Types::Uint64 maxBatchBytes =
+        bsl::numeric_limits<bsls::Types::Uint64>::max();
+    if (0 < d_config.scrubMaxBytesPerSecond()) {
+        maxBatchBytes = static_cast<bsls::Types::Uint64>(
+                            d_config.scrubMaxBytesPerSecond()) *
+                        d_config.scrubIntervalMs() / 1000;
+    }
+
+    bsls::Types::Uint64 batchBytes = 0;
+
+    d_scrubbedPayloads.clear();
+    for (int i = 0; i < k_SCRUB_BATCH_SIZE && it != d_records.end();
+         ++i, ++it) {
+        const DataStoreRecord& record = it->second;
+
+        if (RecordType::e_MESSAGE == record.d_recordType) {
+            if (!d_scrubbedPayloads.empty() &&
+                batchBytes + record.d_dataOrQlistRecordPaddedLen >
+                    maxBatchBytes) {
+                break;  // BREAK
+            }
+
+            ScrubbedPayload payload = {record.d_recordOffset,
+                                       record.d_messageOffset,
+                                       record.d_dataOrQlistRecordPaddedLen,
+                                       record.d_appDataUnpaddedLen,
+                                       true,
+                                       true};
+            d_scrubbedPayloads.push_back(payload);
+            batchBytes += record.d_dataOrQlistRecordPaddedLen;
+        }
+
+        d_scrubCursor = it->first;
+    }
+
+    d_numScrubbedMessages += d_scrubbedPayloads.size();
+
+    if (it == d_records.end()) {
+        BALL_LOG_INFO << partitionDesc() << "Scrubbing: completed a pass over "
+                      << d_numScrubbedMessages << " outstanding messages.";
+
+        d_scrubCursor = DataStoreRecordKey();
+    }
+
+    if (d_scrubbedPayloads.empty()) {
+        return;  // RETURN
+    }
+
+    // The aliased chunk keeps the file set mapped until the worker is done,
+    // like a message being delivered would.
+
+    d_scrubInProgress = true;
+    const int rc      = d_miscWorkThreadPool_p->enqueueJob(
+        bdlf::BindUtil::bind(&FileStore::scrubWorkerDispatched,
+                             this,
+                             activeFileSet->d_aliasedChunk_sp));
+    if (rc != 0) {
+        d_scrubInProgress = false;
+    }
+}
+
+void FileStore::scrubWorkerDispatched(const FileSetSp& fileSet)
+{
+    // executed by a *WORKER* thread
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(d_scrubInProgress);
+
+    const MappedFileDescriptor& journal = fileSet->d_journal.d_file;
+    const MappedFileDescriptor& data    = fileSet->d_data.d_file;
+
+    // Check the residency of the whole batch before reading any of it, since
+    // consecutive messages often share pages.
+
+    for (bsl::size_t i = 0; i < d_scrubbedPayloads.size(); ++i) {
+        ScrubbedPayload& payload = d_scrubbedPayloads[i];
+
+        payload.d_isJournalResident = FileSystemUtil::hasResidentPages(
+            journal,
+            payload.d_journalOffset,
+            FileStoreProtocol::k_JOURNAL_RECORD_SIZE);
+        payload.d_isDataResident    = FileSystemUtil::hasResidentPages(
+            data,
+            payload.d_messageOffset,
+            payload.d_messageLen);
+    }
+
+    bsls::Types::Int64 numBytes  = 0;
+    bsls::Types::Int64 numErrors = 0;
+    bmqu::MemOutStream error(d_allocator_p);
+
+    for (bsl::size_t i = 0; i < d_scrubbedPayloads.size(); ++i) {
+        const ScrubbedPayload& payload = d_scrubbedPayloads[i];
+
+        error.reset();
+        if (!scrubPayload(error, *fileSet, payload)) {
+            ++numErrors;
+            BMQTSK_ALARMLOG_ALARM("STORAGE")
+                << partitionDesc() << "Scrubbing: " << error.str()
+                << " Journal file [" << fileSet->d_journal.d_fileName
+                << "], record offset: " << payload.d_journalOffset
+                << ". Data file [" << fileSet->d_data.d_fileName
+                << "], message offset: " << payload.d_messageOffset
+                << BMQTSK_ALARMLOG_END;
+        }
+
+        numBytes += payload.d_messageLen;
+    }
+
+    // Evict the pages which the scrubber faulted in itself, so that reading
+    // the whole partition does not push the pages of the messages being
+    // delivered out of the page cache.  This is only a hint, so failures are
+    // ignored.
+
+    for (bsl::size_t i = 0; i < d_scrubbedPayloads.size(); ++i) {
+        const ScrubbedPayload& payload = d_scrubbedPayloads[i];
+
+        error.reset();
+        if (!payload.d_isJournalResident) {
+            FileSystemUtil::evict(journal,
+                                  payload.d_journalOffset,
+                                  FileStoreProtocol::k_JOURNAL_RECORD_SIZE,
+                                  error);
+        }
+        if (!payload.d_isDataResident) {
+            FileSystemUtil::evict(data,
+                                  payload.d_messageOffset,
+                                  payload.d_messageLen,
+                                  error);
+        }
+    }
+
+    d_partitionStats_sp->onScrubbed(numBytes, numErrors);
+
+    d_scrubInProgress = false;
+}
+
+bool FileStore::scrubPayload(bsl::ostream&          error,
+                             const FileSet&         fileSet,
+                             const ScrubbedPayload& payload) const
+{
+    // executed by a *WORKER* thread
+
+    const MappedFileDescriptor& journal = fileSet.d_journal.d_file;
+    const MappedFileDescriptor& data    = fileSet.d_data.d_file;
+
+    if (payload.d_journalOffset + FileStoreProtocol::k_JOURNAL_RECORD_SIZE >
+            journal.fileSize() ||
+        payload.d_messageOffset + payload.d_messageLen > data.fileSize()) {
+        error << "Message is out of the bounds of the files.";
+        return false;  // RETURN
+    }
+
+    OffsetPtr<const MessageRecord> rec(journal.block(),
+                                       payload.d_journalOffset);
+    if (RecordType::e_MESSAGE != rec->header().type() ||
+        RecordHeader::k_MAGIC != rec->magic()) {
+        error << "Invalid MESSAGE record, type: " << rec->header().type()
+              << ", magic: " << rec->magic() << ".";
+        return false;  // RETURN
+    }
+
+    if (static_cast<bsls::Types::Uint64>(rec->messageOffsetDwords()) *
+            bmqp::Protocol::k_DWORD_SIZE !=
+        payload.d_messageOffset) {
+        error << "MESSAGE record for guid [" << rec->messageGUID()
+              << "] points to message offset "
+              << static_cast<bsls::Types::Uint64>(
+                     rec->messageOffsetDwords()) *
+                     bmqp::Protocol::k_DWORD_SIZE
+              << " in the DATA file.";
+        return false;  // RETURN
+    }
+
+    OffsetPtr<const DataHeader> dataHeader(data.block(),
+                                           payload.d_messageOffset);
+    const int headerSize  = dataHeader->headerWords() *
+                            bmqp::Protocol::k_WORD_SIZE;
+    const int optionsSize = dataHeader->optionsWords() *
+                            bmqp::Protocol::k_WORD_SIZE;
+    const int messageSize = dataHeader->messageWords() *
+                            bmqp::Protocol::k_WORD_SIZE;
+    if (headerSize < DataHeader::k_MIN_HEADER_SIZE ||
+        messageSize != static_cast<int>(payload.d_messageLen) ||
+        headerSize + optionsSize + static_cast<int>(payload.d_appDataLen) >
+            messageSize) {
+        error << "Invalid DataHeader for guid [" << rec->messageGUID()
+              << "], header size: " << headerSize
+              << ", options size: " << optionsSize
+              << ", message size: " << messageSize
+              << ", expected message size: " << payload.d_messageLen << ".";
+        return false;  // RETURN
+    }
+
+    const unsigned int crc = bmqp::Crc32c::calculate(
+        data.block().base() + payload.d_messageOffset + headerSize +
+            optionsSize,
+        payload.d_appDataLen);
+    if (crc != rec->crc32c()) {
+        error << "CRC mismatch for guid [" << rec->messageGUID()
+              << "]. CRC32-C in JOURNAL record: " << rec->crc32c()
+              << ". CRC32-C of payload in DATA file: " << crc << ".";
+        return false;  // RETURN
+    }
+
+    return true;
+}
+
 void FileStore::alarmHighwatermarkIfNeededCb()
 {
     // executed by the *SCHEDULER* thread
@@ -4228,6 +5300,20 @@ void FileStore::processReceiptEvent(unsigned int         primaryLeaseId,
         return;  // RETURN
     }
 
+    // Per-replica view of the replication: how long after the primary wrote
+    // the last acknowledged record this replica sent its Receipt, and how far
+    // behind the primary it was at that point.
+    const bsls::Types::Uint64 primarySequenceNumber =
+        FileStore::sequenceNumber();
+    d_partitionStats_sp->onReplicaReceipt(
+        bmqu::Time::highResolutionTimer() -
+            to->second.d_handle->second.d_arrivalTimepoint,
+        (primaryLeaseId == d_primaryLeaseId &&
+         sequenceNumber <= primarySequenceNumber)
+            ? static_cast<bsls::Types::Int64>(primarySequenceNumber -
+                                              sequenceNumber)
+            : 0);
+
     // everything in [from, to] is Receipt'ed
     bool                             isEndOfRange = false;
     mqbu::StorageKey                 lastKey;
@@ -4264,6 +5350,9 @@ void FileStore::processReceiptEvent(unsigned int         primaryLeaseId,
                 // else the queue and its storage are gone; ignore the receipt
             }
             if (haveQueue) {
+                lastQueue->stats()->onEvent<
+                    mqbstat::QueueStatsDomain::EventType::e_REPLICATION_TIME>(
+                    timeDelta);
                 lastQueue->onReceipt(from->second.d_guid, from->second.d_qH);
             }  // else the queue is gone
             from = d_unreceipted.erase(from);
@@ -5166,6 +6255,210 @@ void FileStore::replicateRecord(bmqp::StorageMessageType::Enum type,
     flushIfNeeded(false);
 }
 
+void FileStore::writebackIfNeeded()
+{
+    const bsls::Types::Uint64 threshold = d_config.writebackThreshold();
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 == threshold)) {
+        return;  // RETURN
+    }
+
+    if (!d_isOpen || d_fileSets.empty()) {
+        return;  // RETURN
+    }
+
+    FileSet* activeFileSet = d_fileSets[0].get();
+    BSLS_ASSERT_SAFE(activeFileSet);
+
+    FileSet::FileInfo* fileInfos[] = {&activeFileSet->d_data,
+                                      &activeFileSet->d_journal,
+                                      &activeFileSet->d_qlist};
+
+    for (size_t i = 0; i < sizeof(fileInfos) / sizeof(fileInfos[0]); ++i) {
+        bmqu::MemOutStream errorDesc;
+
+        const int rc = writebackFileIfNeeded(fileInfos[i],
+                                             threshold,
+                                             errorDesc);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != rc)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            BALL_LOG_WARN << partitionDesc()
+                          << "Failed to initiate writeback of file ["
+                          << fileInfos[i]->d_fileName << "], rc: " << rc
+                          << ", reason: " << errorDesc.str();
+        }
+    }
+}
+
+void FileStore::releaseColdPagesIfNeeded()
+{
+    const bsls::Types::Uint64 window = d_config.residentWindowSize();
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 == window)) {
+        return;  // RETURN
+    }
+
+    if (!d_isOpen || d_fileSets.empty()) {
+        return;  // RETURN
+    }
+
+    FileSet* activeFileSet = d_fileSets[0].get();
+    BSLS_ASSERT_SAFE(activeFileSet);
+
+    // The QLIST file is small and entirely read at recovery, so it is left
+    // mapped.
+
+    FileSet::FileInfo* fileInfos[] = {&activeFileSet->d_data,
+                                      &activeFileSet->d_journal};
+
+    for (size_t i = 0; i < sizeof(fileInfos) / sizeof(fileInfos[0]); ++i) {
+        bmqu::MemOutStream errorDesc;
+
+        const int rc = releaseFileIfNeeded(fileInfos[i], window, errorDesc);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != rc)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            BALL_LOG_WARN << partitionDesc()
+                          << "Failed to release cold pages of file ["
+                          << fileInfos[i]->d_fileName << "], rc: " << rc
+                          << ", reason: " << errorDesc.str();
+        }
+    }
+}
+
+void FileStore::dropConsumedPagesIfNeeded()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(!d_config.dropConsumedPages())) {
+        return;  // RETURN
+    }
+
+    if (!d_isOpen || d_fileSets.empty()) {
+        return;  // RETURN
+    }
+
+    FileSet* activeFileSet = d_fileSets[0].get();
+    BSLS_ASSERT_SAFE(activeFileSet);
+
+    FileSet::FileInfo& dataFile = activeFileSet->d_data;
+    if (!dataFile.d_file.isValid() ||
+        dataFile.d_filePosition <
+            dataFile.d_dropPosition + k_DROP_CONSUMED_MIN_BYTES) {
+        return;  // RETURN
+    }
+
+    // The records are in insertion order, so the first MESSAGE record is the
+    // oldest outstanding message, and all the messages before it in the DATA
+    // file were deleted.  The records preceding it, such as the QueueOp
+    // records, are skipped from the cursor onwards.
+
+    RecordIterator it = d_records.find(d_consumedCursor);
+    if (it == d_records.end()) {
+        it = d_records.begin();
+    }
+    else {
+        ++it;
+    }
+
+    bsls::Types::Uint64 consumedPosition = dataFile.d_filePosition;
+    for (int i = 0; it != d_records.end(); ++i, ++it) {
+        if (RecordType::e_MESSAGE == it->second.d_recordType) {
+            consumedPosition = it->second.d_messageOffset;
+            break;  // BREAK
+        }
+
+        if (i == k_DROP_CONSUMED_SCAN_SIZE) {
+            // Resume the search at the next invocation.
+
+            return;  // RETURN
+        }
+
+        d_consumedCursor = it->first;
+    }
+
+    if (consumedPosition <
+        dataFile.d_dropPosition + k_DROP_CONSUMED_MIN_BYTES) {
+        return;  // RETURN
+    }
+
+    // Only the entire pages of the range are dropped, so start the next range
+    // at the beginning of the page holding the end of this one.
+
+    const bsls::Types::Uint64 pageSize = static_cast<bsls::Types::Uint64>(
+        bsls::MemoryUtil::pageSize());
+    const bsls::Types::Uint64 offset = dataFile.d_dropPosition;
+
+    dataFile.d_dropPosition = (consumedPosition / pageSize) * pageSize;
+
+    bmqu::MemOutStream errorDesc;
+
+    const int rc = FileSystemUtil::drop(dataFile.d_file,
+                                        offset,
+                                        consumedPosition - offset,
+                                        errorDesc);
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != rc)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BALL_LOG_WARN << partitionDesc()
+                      << "Failed to drop consumed pages of file ["
+                      << dataFile.d_fileName << "], rc: " << rc
+                      << ", reason: " << errorDesc.str();
+    }
+}
+
+void FileStore::precreateFileSetIfNeeded()
+{
+    const int percent = d_config.precreatePercent();
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 >= percent)) {
+        return;  // RETURN
+    }
+
+    if (!d_isOpen || d_fileSets.empty()) {
+        return;  // RETURN
+    }
+
+    const FileSet* activeFileSet = d_fileSets[0].get();
+    BSLS_ASSERT_SAFE(activeFileSet);
+
+    const bsls::Types::Uint64 threshold = static_cast<bsls::Types::Uint64>(
+        percent);
+    const FileSet::FileInfo&  data      = activeFileSet->d_data;
+    const FileSet::FileInfo&  journal   = activeFileSet->d_journal;
+    if (data.d_filePosition * 100 < threshold * data.d_file.fileSize() &&
+        journal.d_filePosition * 100 < threshold * journal.d_file.fileSize()) {
+        return;  // RETURN
+    }
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_precreateMutex);  // LOCK
+        if (d_precreateInProgress || d_precreatedFileSet) {
+            return;  // RETURN
+        }
+        d_precreateInProgress = true;
+    }
+
+    const int rc = d_miscWorkThreadPool_p->enqueueJob(
+        bdlf::BindUtil::bind(&FileStore::precreateWorkerDispatched, this));
+    if (0 != rc) {
+        BALL_LOG_WARN << partitionDesc() << "Failed to enqueue the creation "
+                      << "of the next file set, rc: " << rc;
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_precreateMutex);  // LOCK
+        d_precreateInProgress = false;
+    }
+}
+
+void FileStore::discardPrecreatedFileSet()
+{
+    FileSetSp precreated;
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_precreateMutex);  // LOCK
+        precreated.swap(d_precreatedFileSet);
+    }
+
+    if (precreated) {
+        BALL_LOG_INFO << partitionDesc() << "Deleting precreated file set ["
+                      << precreated->d_data.d_fileName << "], ["
+                      << precreated->d_journal.d_fileName << "]";
+        closeAndDeleteFileSet(precreated.get());
+    }
+}
+
 void FileStore::deleteArchiveFilesCb()
 {
     // executed by the scheduler's *DISPATCHER* thread
@@ -5250,6 +6543,16 @@ void FileStore::aliasMessage(bsl::shared_ptr<bdlbb::Blob>* appData,
     FileSet* activeFileSet = d_fileSets[0].get();
     BSLS_ASSERT_SAFE(activeFileSet);
 
+    // Read ahead of a consumer lagging behind, before faulting in the page of
+    // this message.
+
+    const bsls::Types::Uint64 readahead = d_config.readaheadSize();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 != readahead)) {
+        readaheadFileIfNeeded(&activeFileSet->d_data,
+                              record.d_messageOffset,
+                              readahead);
+    }
+
     OffsetPtr<const DataHeader> dataHeader(
         activeFileSet->d_data.d_file.block(),
         record.d_messageOffset);
@@ -5291,14 +6594,155 @@ void FileStore::aliasMessage(bsl::shared_ptr<bdlbb::Blob>* appData,
 
 void FileStore::flushIfNeeded(bool immediateFlush)
 {
-    if (immediateFlush ||
-        d_storageEventBuilder.messageCount() >= k_NAGLE_PACKET_COUNT) {
+    if (d_config.groupCommitAdaptive() &&
+        0 != d_config.groupCommitMaxDelayUs()) {
+        updateGroupCommitArrivalRate();
+    }
+
+    if (immediateFlush) {
+        // Should notify weak consistency queues after replicated batch
+        flushStorage();
+        notifyQueuesOnReplicatedBatch();
+        return;  // RETURN
+    }
+
+    if (d_storageEventBuilder.messageCount() == 0) {
+        return;  // RETURN
+    }
+
+    if (d_storageEventBuilder.messageCount() == 1 &&
+        0 != d_config.groupCommitMaxDelayUs()) {
+        // First record of a new group commit window
+        d_groupCommitStartTime = bmqu::Time::highResolutionTimer();
+    }
+
+    if (isGroupCommitWindowClosed()) {
         // Should notify weak consistency queues after replicated batch
         flushStorage();
         notifyQueuesOnReplicatedBatch();
     }
 }
 
+bool FileStore::isGroupCommitWindowClosed() const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 < d_storageEventBuilder.messageCount());
+
+    const int maxRecords = 0 < d_config.groupCommitMaxRecords()
+                               ? d_config.groupCommitMaxRecords()
+                               : k_NAGLE_PACKET_COUNT;
+    if (d_storageEventBuilder.messageCount() >= maxRecords) {
+        return true;  // RETURN
+    }
+
+    if (0 < d_config.groupCommitMaxBytes() &&
+        d_storageEventBuilder.eventSize() >= d_config.groupCommitMaxBytes()) {
+        return true;  // RETURN
+    }
+
+    const bsls::Types::Int64 maxDelayNs =
+        static_cast<bsls::Types::Int64>(d_config.groupCommitMaxDelayUs()) *
+        bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MICROSECOND;
+
+    if (0 == maxDelayNs) {
+        return false;  // RETURN
+    }
+
+    return bmqu::Time::highResolutionTimer() - d_groupCommitStartTime >=
+           maxDelayNs;
+}
+
+bool FileStore::isGroupCommitWindowExpectedToGrow() const
+{
+    const bsls::Types::Int64 maxDelayNs =
+        static_cast<bsls::Types::Int64>(d_config.groupCommitMaxDelayUs()) *
+        bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MICROSECOND;
+    const bsls::Types::Int64 remainingNs =
+        maxDelayNs -
+        (bmqu::Time::highResolutionTimer() - d_groupCommitStartTime);
+
+    return d_groupCommitInterArrivalNs < remainingNs;
+}
+
+void FileStore::updateGroupCommitArrivalRate()
+{
+    const bsls::Types::Int64 now = bmqu::Time::highResolutionTimer();
+
+    if (0 != d_groupCommitLastArrivalTime) {
+        // Cap the samples so that an idle period only weighs like a low rate,
+        // and that the average quickly recovers once records flow again.
+
+        const bsls::Types::Int64 maxSampleNs =
+            2 *
+            static_cast<bsls::Types::Int64>(d_config.groupCommitMaxDelayUs()) *
+            bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MICROSECOND;
+        const bsls::Types::Int64 sampleNs =
+            bsl::min(now - d_groupCommitLastArrivalTime, maxSampleNs);
+
+        d_groupCommitInterArrivalNs += (sampleNs -
+                                        d_groupCommitInterArrivalNs) /
+                                       k_GROUP_COMMIT_ARRIVAL_EWMA_WEIGHT;
+    }
+
+    d_groupCommitLastArrivalTime = now;
+}
+
+void FileStore::scheduleGroupCommitTimer()
+{
+    // executed by the *DISPATCHER* thread
+
+    if (d_groupCommitTimerScheduled) {
+        return;  // RETURN
+    }
+
+    const bsls::Types::Int64 maxDelayNs =
+        static_cast<bsls::Types::Int64>(d_config.groupCommitMaxDelayUs()) *
+        bdlt::TimeUnitRatio::k_NANOSECONDS_PER_MICROSECOND;
+    const bsls::Types::Int64 remainingNs = bsl::max(
+        maxDelayNs -
+            (bmqu::Time::highResolutionTimer() - d_groupCommitStartTime),
+        static_cast<bsls::Types::Int64>(0));
+
+    d_config.scheduler()->scheduleEvent(
+        &d_groupCommitEventHandle,
+        bmqu::Time::nowMonotonicClock() + bsls::TimeInterval(0, remainingNs),
+        bdlf::BindUtil::bind(&FileStore::groupCommitTimeoutCb, this));
+    d_groupCommitTimerScheduled = true;
+}
+
+void FileStore::groupCommitTimeoutCb()
+{
+    // executed by the *SCHEDULER* thread
+
+    if (!d_isOpen) {
+        return;  // RETURN
+    }
+
+    execute(bdlf::BindUtil::bind(&FileStore::groupCommitTimeoutDispatched,
+                                 this));
+}
+
+void FileStore::groupCommitTimeoutDispatched()
+{
+    // executed by the *DISPATCHER* thread
+
+    d_groupCommitTimerScheduled = false;
+
+    if (!d_isOpen || 0 == d_storageEventBuilder.messageCount()) {
+        // Closed, or the window was already flushed.
+        return;  // RETURN
+    }
+
+    if (isGroupCommitWindowClosed()) {
+        flushIfNeeded(true);
+    }
+    else {
+        // The window was flushed and a new one opened since the timer was
+        // scheduled.
+        scheduleGroupCommitTimer();
+    }
+}
+
 // CREATORS
 FileStore::FileStore(
     const DataStoreConfig&                          config,
@@ -5335,8 +6779,22 @@ FileStore::FileStore(
 , d_fileSets(allocator)
 , d_cluster_p(cluster)
 , d_miscWorkThreadPool_p(miscWorkThreadPool)
+, d_precreateMutex()
+, d_precreatedFileSet()
+, d_precreateInProgress(false)
 , d_syncPointEventHandle()
 , d_partitionHighwatermarkEventHandle()
+, d_groupCommitEventHandle()
+, d_groupCommitTimerScheduled(false)
+, d_groupCommitStartTime(0)
+, d_groupCommitLastArrivalTime(0)
+, d_groupCommitInterArrivalNs(0)
+, d_scrubEventHandle()
+, d_scrubCursor()
+, d_numScrubbedMessages(0)
+, d_scrubbedPayloads(allocator)
+, d_scrubInProgress(false)
+, d_consumedCursor()
 , d_isPrimary(false)
 , d_primaryNode_p(0)
 , d_primaryLeaseId(0)
@@ -5417,6 +6875,12 @@ int FileStore::open(QueueKeyInfoMap* queueKeyInfoMap)
         return rc_JOURNAL_FILE_TOO_SMALL;  // RETURN
     }
 
+    // Files precreated for a rollover which did not happen are not part of
+    // any file set.
+
+    FileStoreUtil::deletePrecreatedFiles(d_config.partitionId(),
+                                         d_config.location());
+
     bmqu::MemOutStream errorDescription;
     int rc = openInRecoveryMode(errorDescription, queueKeyInfoMap);
     if (rc == 0) {
@@ -5456,6 +6920,18 @@ int FileStore::open(QueueKeyInfoMap* queueKeyInfoMap)
                                            fs->d_journal.d_filePosition,
                                            sequenceNumber());
 
+    // Scrub the outstanding messages in the background, on replicas as well
+    // as on the primary.
+
+    if (0 < d_config.scrubIntervalMs() && !d_scrubEventHandle) {
+        d_scrubCursor         = DataStoreRecordKey();
+        d_numScrubbedMessages = 0;
+        d_config.scheduler()->scheduleRecurringEvent(
+            &d_scrubEventHandle,
+            bsls::TimeInterval().addMilliseconds(d_config.scrubIntervalMs()),
+            bdlf::BindUtil::bind(&FileStore::scrubCb, this));
+    }
+
     return rc_SUCCESS;
 }
 
@@ -5474,13 +6950,32 @@ int FileStore::close(bool flush, bool archive)
         return rc_SUCCESS;  // RETURN
     }
 
-    d_isOpen             = false;
-    d_isStopping         = false;
-    d_flushWhenClosing   = flush;
-    d_lastSyncPtReceived = false;
+    d_isOpen                    = false;
+    d_isStopping                = false;
+    d_flushWhenClosing          = flush;
+    d_lastSyncPtReceived        = false;
+    d_groupCommitTimerScheduled = false;
 
     BALL_LOG_INFO << partitionDesc() << "Closing partition. ";
 
+    discardPrecreatedFileSet();
+
+    // Checkpoint the outstanding records before they are cleared, unless the
+    // file set is archived, in which case the checkpoint is obsolete.
+
+    if (d_config.recoveryCheckpoint()) {
+        if (archive) {
+            bsl::string fileName(d_allocator_p);
+            FileStoreCheckpoint::createFileName(&fileName,
+                                                d_config.location(),
+                                                d_config.partitionId());
+            bdls::FilesystemUtil::remove(fileName);
+        }
+        else {
+            writeCheckpoint();
+        }
+    }
+
     // Clear 'd_records' so that gc logic is invoked on all mapped data files.
     d_unreceipted.clear();
     d_records.clear();
@@ -6517,6 +8012,11 @@ void FileStore::processStorageEvent(const bsl::shared_ptr<bdlbb::Blob>& blob,
         }
     } while (1 == iter.next());
 
+    writebackIfNeeded();
+    releaseColdPagesIfNeeded();
+    dropConsumedPagesIfNeeded();
+    precreateFileSetIfNeeded();
+
     sendReceipt(source, nodeContext);
 }
 
@@ -7165,6 +8665,11 @@ void FileStore::clearPrimary()
 
 void FileStore::flushStorage()
 {
+    writebackIfNeeded();
+    releaseColdPagesIfNeeded();
+    dropConsumedPagesIfNeeded();
+    precreateFileSetIfNeeded();
+
     if (d_storageEventBuilder.messageCount() == 0) {
         return;
     }
@@ -7176,6 +8681,34 @@ void FileStore::flushStorage()
     d_storageEventBuilder.reset();
 }
 
+void FileStore::flushStorageIfNeeded()
+{
+    // executed by the *DISPATCHER* thread
+
+    if (0 == d_config.groupCommitMaxDelayUs() ||
+        0 == d_storageEventBuilder.messageCount() ||
+        isGroupCommitWindowClosed()) {
+        flushStorage();
+        return;  // RETURN
+    }
+
+    if (d_config.groupCommitAdaptive() &&
+        !isGroupCommitWindowExpectedToGrow()) {
+        // At the current arrival rate, holding the window would only delay
+        // its records without coalescing any other one.
+
+        flushStorage();
+        return;  // RETURN
+    }
+
+    // The group commit window is still open: let more records, possibly
+    // from other queues of this partition, join it.  The timer guarantees
+    // the window is flushed once its maximum delay expires, even if no
+    // other record is written.
+
+    scheduleGroupCommitTimer();
+}
+
 void FileStore::notifyQueuesOnReplicatedBatch()
 {
     if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
@@ -7183,8 +8716,7 @@ void FileStore::notifyQueuesOnReplicatedBatch()
         // Empty 'd_storageEventBuilder' means it has been flushed and it is a
         // good time to flush weak consistency queues.
 
-        for (bsl::unordered_set<mqbu::StorageKey>::iterator it =
-                 d_replicationNotifications.begin();
+        for (QueueKeys::iterator it = d_replicationNotifications.begin();
              it != d_replicationNotifications.end();
              it++) {
             // TODO: possible to store ReplicatedStorage directly and have one
@@ -7203,19 +8735,19 @@ void FileStore::notifyQueuesOnReplicatedBatch()
     }
 }
 
-void FileStore::gcExpiredMessages()
+bool FileStore::gcExpiredMessages()
 {
     if (!d_isOpen) {
-        return;  // RETURN
+        return false;  // RETURN
     }
 
     if (!d_isPrimary) {
-        return;  // RETURN
+        return false;  // RETURN
     }
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_isStopping)) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        return;  // RETURN
+        return false;  // RETURN
     }
 
     BSLS_ASSERT_SAFE(0 < d_fileSets.size());
@@ -7223,11 +8755,14 @@ void FileStore::gcExpiredMessages()
     BSLS_ASSERT_SAFE(activeFileSet);
 
     if (!activeFileSet->d_journalFileAvailable) {
-        return;  // RETURN
+        return false;  // RETURN
     }
 
     // Go over each file-backed storage registered with this partition and
-    // indicate it to GC any applicable messages.
+    // indicate it to GC any applicable messages, up to the batch size.  The
+    // TTL is the same for all the messages of a queue, which are kept in
+    // arrival order, so a storage stops at its first unexpired message, and
+    // the cost of a storage having nothing to expire is constant.
 
     const bdlt::Datetime      currentTimeUtc = bdlt::CurrentTime::utc();
     const bsls::Types::Uint64 currentSecondsFromEpoch =
@@ -7235,13 +8770,17 @@ void FileStore::gcExpiredMessages()
             bdlt::EpochUtil::convertToTimeT64(currentTimeUtc));
 
     bool needToFlush = false;
-    for (StorageMapIter it = d_storages.begin(); it != d_storages.end();
+    int  budget      = k_GC_EXPIRED_MESSAGES_BATCH_SIZE;
+    for (StorageMapIter it = d_storages.begin();
+         it != d_storages.end() && budget > 0;
          ++it) {
         ReplicatedStorage* rs        = it->second;
         const int          numMsgsGc = rs->gcExpiredMessages(currentTimeUtc,
-                                                    currentSecondsFromEpoch);
+                                                    currentSecondsFromEpoch,
+                                                    budget);
         if (numMsgsGc > 0) {
             needToFlush = true;
+            budget -= numMsgsGc;
         }
     }
 
@@ -7253,6 +8792,8 @@ void FileStore::gcExpiredMessages()
 
         flushStorage();
     }
+
+    return budget <= 0;
 }
 
 void FileStore::gcHistory()
@@ -7320,6 +8861,8 @@ void FileStore::cancelTimersAndWait()
     d_config.scheduler()->cancelEventAndWait(&d_syncPointEventHandle);
     d_config.scheduler()->cancelEventAndWait(
         &d_partitionHighwatermarkEventHandle);
+    d_config.scheduler()->cancelEventAndWait(&d_groupCommitEventHandle);
+    d_config.scheduler()->cancelEventAndWait(&d_scrubEventHandle);
 }
 
 void FileStore::processShutdownEvent()
@@ -7412,7 +8955,12 @@ void FileStore::scheduledCleanupStorages()
         return;  // RETURN
     }
 
-    gcExpiredMessages();
+    if (gcExpiredMessages()) {
+        // More messages may have expired: continue after the events already
+        // enqueued to this partition rather than waiting for the next period.
+        execute(bdlf::BindUtil::bind(&FileStore::scheduledCleanupStorages,
+                                     this));
+    }
     gcHistory();
 }
 
@@ -7464,6 +9012,9 @@ void FileStore::setReplicationFactor(int value)
                 // else the queue and its storage are gone; ignore the receipt
             }
             if (haveQueue) {
+                lastQueue->stats()->onEvent<
+                    mqbstat::QueueStatsDomain::EventType::e_REPLICATION_TIME>(
+                    timeDelta);
                 lastQueue->onReceipt(it->second.d_guid, it->second.d_qH);
             }  // else the queue is gone
             it = d_unreceipted.erase(it);
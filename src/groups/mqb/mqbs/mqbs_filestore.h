@@ -31,6 +31,17 @@
 // index 0 is the current one. When rollover occurs, the outstanding messages
 // are moved from the active file set to a new rollover file set, which is
 // then inserted to the front of the list.
+//
+// Since rollover copies only the outstanding messages, the active data file
+// never contains a cold region of already confirmed data: its size is bounded
+// by the live backlog of the partition, plus whatever was written since the
+// last rollover.  A record in the journal is an offset into the data file of
+// the same file set, and iterators read message payloads straight from the
+// mapped data file, so payloads cannot be moved to remote storage without
+// changing the journal format.  Rolled-over file sets are no longer needed by
+// the partition and are moved to the 'archiveLocation' (at most
+// 'maxArchivedFileSets' of them are kept), from where they can be shipped to
+// cheaper storage by external tooling.
 
 // MQB
 
@@ -70,12 +81,14 @@
 #include <bsl_ostream.h>
 #include <bsl_string.h>
 #include <bsl_unordered_map.h>
+#include <bsl_unordered_set.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
 #include <bslh_hash.h>
 #include <bslma_allocator.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_mutex.h>
 #include <bsls_assert.h>
 #include <bsls_atomic.h>
 #include <bsls_cpp11.h>
@@ -103,6 +116,7 @@ namespace mqbs {
 // FORWARD DECLARATIONS
 class DataFileIterator;
 class FileStore;
+class FileStoreCheckpoint;
 class FileStoreSet;
 class JournalFileIterator;
 class QlistFileIterator;
@@ -182,8 +196,55 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
                                                 QueueKeyCounterList;
     typedef QueueKeyCounterList::const_iterator QueueKeyCounterListCIter;
 
+    /// Range of contiguous message payloads of the old data file which are
+    /// copied at once to the new data file during rollover.
+    struct DataCopyRun {
+        /// Offset of the range in the old data file.
+        bsls::Types::Uint64 d_fromOffset;
+
+        /// Offset of the range in the new data file.
+        bsls::Types::Uint64 d_toOffset;
+
+        /// Length of the range, zero if there is nothing to copy.
+        bsls::Types::Uint64 d_length;
+
+        /// Number of ranges copied so far.
+        bsls::Types::Uint64 d_numCopies;
+    };
+
+    /// Location of an outstanding message verified by the background
+    /// scrubber, as recorded in `d_records`.  The records themselves are only
+    /// read by the worker thread, so that the partition thread does not fault
+    /// in their pages.
+    struct ScrubbedPayload {
+        /// Offset of the MESSAGE record in the JOURNAL file.
+        bsls::Types::Uint64 d_journalOffset;
+
+        /// Offset of the DataHeader of the message in the DATA file.
+        bsls::Types::Uint64 d_messageOffset;
+
+        /// Length, in bytes, of the message in the DATA file, including its
+        /// headers and padding.
+        unsigned int d_messageLen;
+
+        /// Length, in bytes, of the application data.
+        unsigned int d_appDataLen;
+
+        /// Whether any page of the MESSAGE record was resident before being
+        /// read by the worker thread.
+        bool d_isJournalResident;
+
+        /// Whether any page of the message was resident before being read by
+        /// the worker thread.
+        bool d_isDataResident;
+    };
+
+    typedef bsl::vector<ScrubbedPayload> ScrubbedPayloads;
+
     typedef bdlmt::EventScheduler::RecurringEventHandle RecurringEventHandle;
 
+    typedef bdlmt::EventScheduler::EventHandle EventHandle;
+
     typedef DataStoreConfig::QueueKeyInfoMapConstIter QueueKeyInfoMapConstIter;
     typedef DataStoreConfig::QueueKeyInfoMapInsertRc  QueueKeyInfoMapInsertRc;
 
@@ -193,6 +254,10 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     typedef StorageCollectionUtil::StorageMapIter      StorageMapIter;
     typedef StorageCollectionUtil::StorageMapConstIter StorageMapConstIter;
 
+    typedef bsl::unordered_set<mqbu::StorageKey,
+                               bslh::Hash<mqbu::StorageKeyHashAlgo> >
+        QueueKeys;
+
     /// This context we keep for un-receipted messages.
     struct ReceiptContext {
         const mqbu::StorageKey  d_queueKey;
@@ -304,7 +369,7 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// The container that holds keys to storages where we put messages since
     /// the last storage event builder flush.  Used to notify these queues on
     /// replication complete, so they change from processing PUTs to PUSHes.
-    bsl::unordered_set<mqbu::StorageKey> d_replicationNotifications;
+    QueueKeys d_replicationNotifications;
 
     int d_replicationFactor;
 
@@ -330,10 +395,71 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     // work that can be offloaded to
     // non-partition-dispatcher threads.
 
+    /// Mutex protecting `d_precreatedFileSet` and `d_precreateInProgress`,
+    /// which are accessed from the partition-dispatcher thread and from a
+    /// thread of `d_miscWorkThreadPool_p`.
+    bslmt::Mutex d_precreateMutex;
+
+    /// File set created in the background ahead of the next rollover, if
+    /// any.  See `DataStoreConfig::precreatePercent`.
+    FileSetSp d_precreatedFileSet;
+
+    /// Whether a job creating the next file set in the background has been
+    /// enqueued and has not completed yet.
+    bool d_precreateInProgress;
+
     RecurringEventHandle d_syncPointEventHandle;
 
     RecurringEventHandle d_partitionHighwatermarkEventHandle;
 
+    /// Handle to the timer closing the current replication group commit
+    /// window.
+    EventHandle d_groupCommitEventHandle;
+
+    /// Whether the timer closing the current replication group commit window
+    /// is scheduled.
+    bool d_groupCommitTimerScheduled;
+
+    /// Time, as returned by `bmqu::Time::highResolutionTimer`, at which the
+    /// first record of the current replication group commit window was
+    /// packed into `d_storageEventBuilder`.
+    bsls::Types::Int64 d_groupCommitStartTime;
+
+    /// Time, as returned by `bmqu::Time::highResolutionTimer`, at which the
+    /// last record was packed into `d_storageEventBuilder`, or 0 if none
+    /// was.  Only maintained with an adaptive group commit window.
+    bsls::Types::Int64 d_groupCommitLastArrivalTime;
+
+    /// Moving average, in nanoseconds, of the time between two records
+    /// packed into `d_storageEventBuilder`.  Only maintained with an
+    /// adaptive group commit window.
+    bsls::Types::Int64 d_groupCommitInterArrivalNs;
+
+    /// Handle to the recurring event scrubbing a batch of outstanding
+    /// messages.
+    RecurringEventHandle d_scrubEventHandle;
+
+    /// Key of the last record of the previous scrubbed batch, from which the
+    /// next batch resumes.  A new pass over `d_records` is started if this
+    /// record is no longer outstanding.
+    DataStoreRecordKey d_scrubCursor;
+
+    /// Number of messages scrubbed in the current pass over `d_records`.
+    bsls::Types::Uint64 d_numScrubbedMessages;
+
+    /// Batch of payloads being scrubbed.  Only modified by the partition
+    /// thread while `d_scrubInProgress` is false, and only read by the
+    /// worker thread of `d_miscWorkThreadPool_p` while it is true.
+    ScrubbedPayloads d_scrubbedPayloads;
+
+    /// Whether a batch of payloads is being scrubbed by a worker thread.
+    bsls::AtomicBool d_scrubInProgress;
+
+    /// Key of the last record known to precede the oldest outstanding
+    /// message in `d_records`, from which the next search for that message
+    /// starts.  See `DataStoreConfig::dropConsumedPages`.
+    DataStoreRecordKey d_consumedCursor;
+
     bool d_isPrimary;
 
     mqbnet::ClusterNode* d_primaryNode_p;
@@ -402,6 +528,17 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// written to the newly created files.
     int create(FileSetSp* fileSetSp);
 
+    /// Load into the specified `fileSetSp` the file set created in the
+    /// background ahead of rollover, after renaming its files to the names
+    /// of an active file set.  Return zero on success, and a non-zero value
+    /// if no such file set is available or it could not be renamed, in
+    /// which case the caller should `create` the file set instead.
+    int takePrecreatedFileSet(FileSetSp* fileSetSp);
+
+    /// Set up the aliased chunk of the specified newly created `fileSet`,
+    /// used to count the references to its mappings.
+    void initAliasedChunk(FileSet* fileSet);
+
     /// Truncate the files contained in the specified `fileSet` to their
     /// current sizes.  Note that files are not closed.
     void truncate(FileSet* fileSet);
@@ -443,6 +580,14 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// *worker* thread pool.
     void gcWorkerDispatched(const bsl::shared_ptr<FileSet>& fileSet);
 
+    /// Create the file set to use at the next rollover and make it
+    /// available to `takePrecreatedFileSet`, or delete it if this instance
+    /// has been closed in the meantime.
+    ///
+    /// THREAD: This method is invoked in a thread from the miscellaneous
+    /// *worker* thread pool.
+    void precreateWorkerDispatched();
+
     /// Open this instance in non-recovery mode.  Return zero on success and
     /// a non-zero value otherwise.  Note that this routine can be used in
     /// recovery mode when there are no files to recover messages from.
@@ -473,6 +618,10 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// end of the journal, data and qlist files respectively.  Also, populate
     /// the map of primaryLeaseId to highest sequence number.
     ///
+    /// If checkpoints are enabled in the configuration of this instance and
+    /// a valid checkpoint of the journal exists, both passes only visit the
+    /// records written after the checkpoint and the records listed in it.
+    ///
     /// Return zero on success, non zero value otherwise.  The behavior is
     /// undefined unless the journal iterator `jit` is in reverse mode.
     ///
@@ -486,6 +635,23 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
                         DataFileIterator*    dit,
                         bool                 withCSL);
 
+    /// Load into the specified `checkpoint` the checkpoint of the partition
+    /// of this instance, and validate it against the journal iterated by
+    /// the specified `jit`, the specified `dataFile` and the optionally
+    /// specified `qlistFile`.  Return zero if the checkpoint describes these
+    /// files, non-zero value otherwise, in which case `checkpoint` is left
+    /// in the empty state and the whole journal must be recovered.
+    int loadCheckpoint(FileStoreCheckpoint*        checkpoint,
+                       const JournalFileIterator&  jit,
+                       const MappedFileDescriptor& dataFile,
+                       const MappedFileDescriptor* qlistFile);
+
+    /// Write the checkpoint of the outstanding records of the active file
+    /// set, to be used by the next recovery of this instance.  Note that
+    /// failure to write the checkpoint is logged, and is otherwise
+    /// non-fatal.
+    void writeCheckpoint();
+
     /// Rollover the outstanding messages belonging to the storages mapped
     /// to this file store, from active file set into the rollover file set,
     /// and make rolled over file set the new active file set.  Return zero
@@ -530,17 +696,61 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// Rollover over the specified `record` from `oldFileSet` to the
     /// `newFileSet`, and if it is a message record, update the counter of
     /// the corresponding queue by one in the specified
-    /// `queueKeyCounterMap`.
+    /// `queueKeyCounterMap`, and append its payload to the specified
+    /// `dataCopyRun`, copying the run first if the payload is not
+    /// contiguous to it.  Note that the payload is not copied by this
+    /// method: the caller must call `copyDataRun` once all the records have
+    /// been rolled over.
     void writeRolledOverRecord(DataStoreRecord*    record,
                                QueueKeyCounterMap* queueKeyCounterMap,
+                               DataCopyRun*        dataCopyRun,
                                FileSet*            oldFileSet,
                                FileSet*            newFileSet);
 
+    /// Copy the payloads of the specified `dataCopyRun` from the data file
+    /// of the specified `oldFileSet` to the data file of the specified
+    /// `newFileSet`, and reset the run to be empty.
+    void copyDataRun(DataCopyRun* dataCopyRun,
+                     FileSet*     oldFileSet,
+                     FileSet*     newFileSet);
+
     /// Issue a sync point.
     ///
     /// THREAD: This method is called from the scheduler thread.
     void issueSyncPointCb();
 
+    /// Callback invoked to dispatch the scrubbing of the next batch of
+    /// outstanding messages.
+    ///
+    /// THREAD: This method is called from the scheduler thread.
+    void scrubCb();
+
+    /// Collect the next batch of outstanding messages into
+    /// `d_scrubbedPayloads`, within the number of bytes allowed per interval
+    /// by the configured scrubbing rate, and enqueue their verification in a
+    /// worker thread, unless the previous batch is still being verified.
+    ///
+    /// THREAD: This method is called from the partition thread.
+    void scrubDispatched();
+
+    /// Verify the consistency of the records and the CRC32-C of the
+    /// payloads in `d_scrubbedPayloads`, reading them from the journal and
+    /// data files of the specified `fileSet`, alarm on any corruption and
+    /// report to the partition stats.  The pages which were not resident
+    /// before being read are evicted from the page cache afterwards.
+    ///
+    /// THREAD: This method is called from a worker thread.
+    void scrubWorkerDispatched(const FileSetSp& fileSet);
+
+    /// Return `true` if the message at the specified `payload` in the
+    /// specified `fileSet` is consistent, and `false` otherwise with a
+    /// description of the corruption written to the specified `error`.
+    ///
+    /// THREAD: This method is called from a worker thread.
+    bool scrubPayload(bsl::ostream&          error,
+                      const FileSet&         fileSet,
+                      const ScrubbedPayload& payload) const;
+
     /// Callback invoked to dispatch a function to alarm if any of the
     /// partition's files have reached the high watermark (soft limit) for
     /// outstanding bytes.
@@ -663,9 +873,75 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
         bsls::Types::Uint64            recordOffset);
 
     /// Flush the storage if the specified `immediateFlush` is `true` or the
-    /// `d_storageEventBuilder` is over the `k_NAGLE_PACKET_COUNT` limit.
+    /// replication group commit window is closed (see
+    /// `isGroupCommitWindowClosed`).
     void flushIfNeeded(bool immediateFlush);
 
+    /// Return `true` if the replication group commit window is closed, that
+    /// is if the `d_storageEventBuilder` reached the configured maximum
+    /// number of records or bytes, or if its oldest record reached the
+    /// configured maximum delay, and `false` otherwise.  The behavior is
+    /// undefined unless `d_storageEventBuilder` is not empty.
+    bool isGroupCommitWindowClosed() const;
+
+    /// Return `true` if, according to the measured arrival rate of records,
+    /// another record is expected to be packed into `d_storageEventBuilder`
+    /// before the replication group commit window reaches the configured
+    /// maximum delay, and `false` otherwise.
+    bool isGroupCommitWindowExpectedToGrow() const;
+
+    /// Update the measured arrival rate of records with a record packed
+    /// into `d_storageEventBuilder` now.
+    void updateGroupCommitArrivalRate();
+
+    /// Schedule the timer closing the current replication group commit
+    /// window, if not already scheduled.
+    void scheduleGroupCommitTimer();
+
+    /// Callback invoked by the scheduler when the replication group commit
+    /// window may have expired.
+    ///
+    /// THREAD: This method is called from the scheduler's dispatcher
+    ///         thread.
+    void groupCommitTimeoutCb();
+
+    /// Flush the replication group commit window if it is closed, or
+    /// reschedule the timer closing it otherwise.
+    ///
+    /// THREAD: This method is called from the Queue's dispatcher thread.
+    void groupCommitTimeoutDispatched();
+
+    /// Initiate the asynchronous writeback of the bytes appended to each
+    /// file of the active file set since the last writeback, for each file
+    /// where these bytes exceed the configured writeback threshold.  This
+    /// method has no effect if the writeback threshold is zero.
+    void writebackIfNeeded();
+
+    /// Release from the mappings of the data and journal files of the active
+    /// file set the pages lying more than the configured resident window
+    /// behind their current position, for each file where at least one
+    /// window of such pages has accumulated since the last release.  This
+    /// method has no effect if the resident window size is zero.
+    void releaseColdPagesIfNeeded();
+
+    /// Drop from the page cache the pages of the data file of the active
+    /// file set lying before the oldest outstanding message, if at least
+    /// `k_DROP_CONSUMED_MIN_BYTES` of such pages have accumulated since the
+    /// last drop.  This method has no effect unless `dropConsumedPages` is
+    /// set in the configuration.
+    void dropConsumedPagesIfNeeded();
+
+    /// Enqueue the creation in the background of the file set to use at the
+    /// next rollover if the data or journal file of the active file set has
+    /// reached the configured usage, and no such file set is available or
+    /// being created.  This method has no effect if the configured usage is
+    /// zero.
+    void precreateFileSetIfNeeded();
+
+    /// Close and delete the file set created in the background ahead of
+    /// rollover, if any.
+    void discardPrecreatedFileSet();
+
     // PRIVATE ACCESSORS
 
     /// Return a brief description of the partition for logging purposes.
@@ -682,9 +958,12 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
                       bsl::shared_ptr<bdlbb::Blob>* options,
                       const DataStoreRecord&        record) const;
 
-    /// Attempt to garbage-collect messages for which TTL has expired.
-    /// Note that this routine is no-op unless at the primary node.
-    void gcExpiredMessages();
+    /// Attempt to garbage-collect messages for which TTL has expired, up to
+    /// a batch size.  Return `true` if the batch size has been reached, i.e.
+    /// more messages may be due for garbage collection, and `false`
+    /// otherwise.  Note that this routine is no-op unless at the primary
+    /// node.
+    bool gcExpiredMessages();
 
     /// Delete an history of guids or messages maintained by this data
     /// store.  Note that this routine is invoked at primary as well as
@@ -784,7 +1063,12 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// Write the specified `appData` and `options` belonging to specified
     /// `queueKey` and having specified `guid` and `attributes` to the data
     /// store, and update the specified `handle` with an identifier which
-    /// can be used to retrieve the message.
+    /// can be used to retrieve the message.  Note that each message is an
+    /// independent record: there is no commit record spanning several
+    /// messages, and a replica may recover any prefix of them.  Durability
+    /// costs are nevertheless amortized across messages: records written in
+    /// a row are replicated in the same storage event, and a replica sends
+    /// one (cumulative) Receipt per storage event it processes.
     int
     writeMessageRecord(mqbi::StorageMessageAttributes*     attributes,
                        DataStoreRecordHandle*              handle,
@@ -874,7 +1158,11 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// Process Receipt for the specified `primaryLeaseId` and
     /// `sequenceNum`.  The behavior is undefined unless the event belongs
     /// to this partition and unless the `primaryLeaseId` and `sequenceNum`
-    /// match a record of the `StorageMessageType::e_DATA` type.
+    /// match a record of the `StorageMessageType::e_DATA` type.  Note that
+    /// Receipts are cumulative: a Receipt from the specified `source`
+    /// acknowledges every unreceipted record up to and including the one
+    /// it names.  Replication does not wait on Receipts, so the number of
+    /// records in flight to a replica is not bounded by the round trip.
     void
     processReceiptEvent(unsigned int         primaryLeaseId,
                         bsls::Types::Uint64  sequenceNum,
@@ -889,6 +1177,11 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// Set the specified `primaryNode` with the specified `primaryLeaseId`
     /// as the active primary for this data store partition.  Note that
     /// `primaryNode` could refer to the node which owns this data store.
+    /// Also note that a replica already applies every replicated record to
+    /// the queue storages of this partition (and their virtual storages) as
+    /// the record arrives, so promoting self to primary only switches the
+    /// role of those storages and starts the primary-only timers; no
+    /// storage state is rebuilt.
     void setActivePrimary(mqbnet::ClusterNode* primaryNode,
                           unsigned int primaryLeaseId) BSLS_KEYWORD_OVERRIDE;
 
@@ -899,6 +1192,14 @@ class FileStore BSLS_KEYWORD_FINAL : public DataStore {
     /// undefined unless this cluster node is the primary for this partition.
     void flushStorage() BSLS_KEYWORD_OVERRIDE;
 
+    /// Flush any buffered replication messages to the peers, unless the
+    /// replication group commit window is still open, in which case they
+    /// are flushed no later than when the window closes.  This method is
+    /// equivalent to `flushStorage` if the group commit window is disabled.
+    /// Behaviour is undefined unless this cluster node is the primary for
+    /// this partition.
+    void flushStorageIfNeeded() BSLS_KEYWORD_OVERRIDE;
+
     /// Flush weak consistency queues that have replicated messages since the
     /// last call.  This method has no effect if `d_storageEventBuilder` is not
     /// empty, and must only be called after `flushStorage`.  Behaviour is
@@ -25,9 +25,11 @@
 #include <mqbmock_queue.h>
 #include <mqbnet_mockcluster.h>
 #include <mqbs_datastore.h>
+#include <mqbs_filestorecheckpoint.h>
 #include <mqbs_filestoreprotocol.h>
 #include <mqbs_filestoreset.h>
 #include <mqbs_filestoretestutil.h>
+#include <mqbs_filestoreutil.h>
 #include <mqbstat_clusterstats.h>
 #include <mqbu_messageguidutil.h>
 #include <mqbu_storagekey.h>
@@ -45,6 +47,11 @@
 // TEST DRIVER
 #include <bmqtst_testhelper.h>
 
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
+
 // BDE
 #include <bdlb_random.h>
 #include <bdlbb_blob.h>
@@ -57,6 +64,7 @@
 #include <bdls_filesystemutil.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_epochutil.h>
+#include <bsl_algorithm.h>
 #include <bsl_iostream.h>
 #include <bsl_map.h>
 #include <bsl_memory.h>
@@ -68,6 +76,7 @@
 #include <bslmf_nestedtraitdeclaration.h>
 #include <bsls_platform.h>
 #include <bsls_systemclocktype.h>
+#include <bsls_timeutil.h>
 #include <bsls_types.h>
 
 // CONVENIENCE
@@ -115,9 +124,10 @@ class StoragePoster {
     {
     }
 
-    /// Post a dummy message to the underlying storage. Return the result
-    /// of the put operation.
-    mqbi::StorageResult::Enum postMessage()
+    /// Post a dummy message having a payload of the optionally specified
+    /// `payloadSize` bytes to the underlying storage.  Return the result of
+    /// the put operation.
+    mqbi::StorageResult::Enum postMessage(bsl::size_t payloadSize = 10)
     {
         bmqt::MessageGUID guid;
         mqbu::MessageGUIDUtil::generateGUID(&guid);
@@ -126,7 +136,9 @@ class StoragePoster {
         appData_sp.createInplace(bmqtst::TestHelperUtil::allocator(),
                                  &d_bufferFactory,
                                  bmqtst::TestHelperUtil::allocator());
-        bsl::string payload(10, 'x', bmqtst::TestHelperUtil::allocator());
+        bsl::string payload(payloadSize,
+                            'x',
+                            bmqtst::TestHelperUtil::allocator());
         bdlbb::BlobUtil::append(appData_sp.get(),
                                 payload.c_str(),
                                 payload.length());
@@ -190,7 +202,20 @@ class Tester {
 
   public:
     // CREATORS
-    explicit Tester(bsl::string_view location)
+
+    /// Create a `Tester` with a file store using the specified `location`,
+    /// the optionally specified `recoveryThreads` to recover messages, the
+    /// optionally specified `recoveryCheckpoint` flag to checkpoint the
+    /// index of outstanding records, the optionally specified
+    /// `precreatePercent` usage at which the next file set is created in the
+    /// background, and the optionally specified `preallocate` and
+    /// `prefaultPages` flags of the partition files.
+    explicit Tester(bsl::string_view location,
+                    int              recoveryThreads    = 0,
+                    bool             recoveryCheckpoint = false,
+                    int              precreatePercent   = 0,
+                    bool             preallocate        = false,
+                    bool             prefaultPages      = false)
     : d_allocator_p(bmqtst::TestHelperUtil::allocator())
     , d_scheduler(bsls::SystemClockType::e_MONOTONIC, d_allocator_p)
     , d_bufferFactory(1024, d_allocator_p)
@@ -235,8 +260,8 @@ class Tester {
         d_partitionCfg.archiveLocation()     = d_clusterArchiveLocation;
         d_partitionCfg.numPartitions()       = 1;
         d_partitionCfg.maxArchivedFileSets() = 1;
-        d_partitionCfg.preallocate()         = false;
-        d_partitionCfg.prefaultPages()       = false;
+        d_partitionCfg.preallocate()         = preallocate;
+        d_partitionCfg.prefaultPages()       = prefaultPages;
 
         d_clusterCfg.name().assign("mock-cluster");
         d_clusterCfg.partitionConfig() = d_partitionCfg;
@@ -270,6 +295,9 @@ class Tester {
             .setMaxDataFileSize(d_partitionCfg.maxDataFileSize())
             .setMaxJournalFileSize(d_partitionCfg.maxJournalFileSize())
             .setMaxQlistFileSize(d_partitionCfg.maxQlistFileSize())
+            .setRecoveryThreads(recoveryThreads)
+            .setRecoveryCheckpoint(recoveryCheckpoint)
+            .setPrecreatePercent(precreatePercent)
             .setRecoveredQueuesCb(bdlf::BindUtil::bind(
                 &recoveredQueuesCb,
                 bdlf::PlaceHolders::_1,    // partitionId
@@ -1274,6 +1302,599 @@ static void test4_recoverMessagesAcrossLeaseIds()
     fs.close();
 }
 
+static void test5_recoverMessagesWithWorkerThreads()
+// ------------------------------------------------------------------------
+// RECOVER MESSAGES WITH WORKER THREADS
+//
+// Concerns:
+//   When 'recoveryThreads' is configured, the payloads of the outstanding
+//   messages are verified by worker threads, in chunks of the journal
+//   delimited by sync points.  Verify that all outstanding messages are
+//   recovered when the journal is split into several such chunks.
+//
+// Testing:
+//   recoverMessages (with worker threads)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    Tester           tester("./test-cluster123-5", 4);  // recoveryThreads
+    mqbs::FileStore& fs = tester.fileStore();
+
+    tester.dispatcher().setEnqueueOnly(true);
+
+    int rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    if (rc) {
+        cout << "Failed to open partition, rc: " << rc << endl;
+        return;  // RETURN
+    }
+
+    fs.setActivePrimary(tester.node(), 1);  // primaryLeaseId
+
+    bmqt::Uri        queueUri("bmq://si.amw.bmq.stats/testQueue",
+                       bmqtst::TestHelperUtil::allocator());
+    mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                              "ABCDE");
+
+    mqbmock::Cluster mockCluster(bmqtst::TestHelperUtil::allocator());
+    mqbmock::Domain  mockDomain(&mockCluster,
+                               bmqtst::TestHelperUtil::allocator());
+    mqbconfm::Domain domainCfg(bmqtst::TestHelperUtil::allocator());
+    domainCfg.messageTtl() = bsl::numeric_limits<bsls::Types::Int64>::max();
+    domainCfg.storage().config().makeFileBacked();
+    bmqu::MemOutStream errDesc(bmqtst::TestHelperUtil::allocator());
+    mockDomain.configure(errDesc, domainCfg);
+
+    bsl::shared_ptr<mqbs::ReplicatedStorage> storage_sp;
+    fs.createStorage(&storage_sp, queueUri, queueKey, &mockDomain);
+
+    mqbconfm::Limits limits;
+    limits.messages() = bsl::numeric_limits<bsls::Types::Int64>::max();
+    limits.bytes()    = bsl::numeric_limits<bsls::Types::Int64>::max();
+    limits.messagesWatermarkRatio() = 0.8;
+    limits.bytesWatermarkRatio()    = 0.8;
+    storage_sp->configure(domainCfg.storage().config(),
+                          limits,
+                          domainCfg.messageTtl(),
+                          0);  // maxDeliveryAttempts
+
+    fs.registerStorage(storage_sp.get());
+
+    mqbmock::Queue mockQueue(&mockDomain, bmqtst::TestHelperUtil::allocator());
+    storage_sp->setQueue(&mockQueue);
+
+    mqbs::DataStoreRecordHandle queueHandle;
+    bsls::Types::Uint64         timestamp = bdlt::EpochUtil::convertToTimeT64(
+        bdlt::CurrentTime::utc());
+    rc = fs.writeQueueCreationRecord(&queueHandle,
+                                     queueUri,
+                                     queueKey,
+                                     AppInfos(),
+                                     timestamp,
+                                     true);  // isNewQueue
+    BMQTST_ASSERT_EQ(0, rc);
+
+    // Write enough payload bytes, with sync points in between, for the
+    // journal to be split into several chunks at recovery.
+    StoragePoster     poster(storage_sp, bmqtst::TestHelperUtil::allocator());
+    const size_t      k_NUM_MSGS        = 48;
+    const size_t      k_MSGS_PER_SYNCPT = 4;
+    const bsl::size_t k_PAYLOAD_SIZE    = 1024 * 1024;
+    for (size_t i = 0; i < k_NUM_MSGS; ++i) {
+        BMQTST_ASSERT_EQ(poster.postMessage(k_PAYLOAD_SIZE),
+                         mqbi::StorageResult::e_SUCCESS);
+        if (0 == ((i + 1) % k_MSGS_PER_SYNCPT)) {
+            BMQTST_ASSERT_EQ(0, fs.issueSyncPoint());
+        }
+    }
+
+    const bsls::Types::Uint64 numRecords = fs.numRecords();
+    BMQTST_ASSERT_D("messages should exist before reopen",
+                    numRecords >= k_NUM_MSGS);
+
+    tester.miscWorkThreadPool().drain();
+    tester.scheduler().cancelAllEventsAndWait();
+    tester.dispatcher().processQueue();
+    fs.unregisterStorage(storage_sp.get());
+    fs.close();
+    BMQTST_ASSERT_EQ(false, fs.isOpen());
+
+    rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    BMQTST_ASSERT_EQ(true, fs.isOpen());
+    BMQTST_ASSERT_EQ(fs.numRecords(), numRecords);
+
+    fs.close();
+}
+
+static void test6_recoverMessagesWithCheckpoint()
+// ------------------------------------------------------------------------
+// RECOVER MESSAGES WITH CHECKPOINT
+//
+// Concerns:
+//   When 'recoveryCheckpoint' is configured, a checkpoint of the index of
+//   outstanding records is written at rollover and clean close, and
+//   recovery only replays the part of the journal written after it.
+//   Verify that:
+//   1. A checkpoint file is written when the partition is closed.
+//   2. All outstanding messages are recovered from a checkpoint which is
+//      older than the journal, i.e. with a tail to replay.
+//   3. Recovery falls back to a full replay of the journal when the
+//      checkpoint is corrupted.
+//
+// Testing:
+//   recoverMessages (with checkpoint)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    Tester           tester("./test-cluster123-6",
+                            0,      // recoveryThreads
+                            true);  // recoveryCheckpoint
+    mqbs::FileStore& fs = tester.fileStore();
+
+    tester.dispatcher().setEnqueueOnly(true);
+
+    bsl::string checkpointFile(bmqtst::TestHelperUtil::allocator());
+    mqbs::FileStoreCheckpoint::createFileName(&checkpointFile,
+                                              "./test-cluster123-6",
+                                              0);  // partitionId
+    const bsl::string savedCheckpointFile(checkpointFile + ".saved",
+                                          bmqtst::TestHelperUtil::allocator());
+
+    int rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    if (rc) {
+        cout << "Failed to open partition, rc: " << rc << endl;
+        return;  // RETURN
+    }
+
+    fs.setActivePrimary(tester.node(), 1);  // primaryLeaseId
+
+    bmqt::Uri        queueUri("bmq://si.amw.bmq.stats/testQueue",
+                       bmqtst::TestHelperUtil::allocator());
+    mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                              "ABCDE");
+
+    mqbmock::Cluster mockCluster(bmqtst::TestHelperUtil::allocator());
+    mqbmock::Domain  mockDomain(&mockCluster,
+                               bmqtst::TestHelperUtil::allocator());
+    mqbconfm::Domain domainCfg(bmqtst::TestHelperUtil::allocator());
+    domainCfg.messageTtl() = bsl::numeric_limits<bsls::Types::Int64>::max();
+    domainCfg.storage().config().makeFileBacked();
+    bmqu::MemOutStream errDesc(bmqtst::TestHelperUtil::allocator());
+    mockDomain.configure(errDesc, domainCfg);
+
+    bsl::shared_ptr<mqbs::ReplicatedStorage> storage_sp;
+    fs.createStorage(&storage_sp, queueUri, queueKey, &mockDomain);
+
+    mqbconfm::Limits limits;
+    limits.messages() = bsl::numeric_limits<bsls::Types::Int64>::max();
+    limits.bytes()    = bsl::numeric_limits<bsls::Types::Int64>::max();
+    limits.messagesWatermarkRatio() = 0.8;
+    limits.bytesWatermarkRatio()    = 0.8;
+    storage_sp->configure(domainCfg.storage().config(),
+                          limits,
+                          domainCfg.messageTtl(),
+                          0);  // maxDeliveryAttempts
+
+    fs.registerStorage(storage_sp.get());
+
+    mqbmock::Queue mockQueue(&mockDomain, bmqtst::TestHelperUtil::allocator());
+    storage_sp->setQueue(&mockQueue);
+
+    mqbs::DataStoreRecordHandle queueHandle;
+    bsls::Types::Uint64         timestamp = bdlt::EpochUtil::convertToTimeT64(
+        bdlt::CurrentTime::utc());
+    rc = fs.writeQueueCreationRecord(&queueHandle,
+                                     queueUri,
+                                     queueKey,
+                                     AppInfos(),
+                                     timestamp,
+                                     true);  // isNewQueue
+    BMQTST_ASSERT_EQ(0, rc);
+
+    StoragePoster poster(storage_sp, bmqtst::TestHelperUtil::allocator());
+    const size_t  k_NUM_MSGS = 10;
+    for (size_t i = 0; i < k_NUM_MSGS; ++i) {
+        BMQTST_ASSERT_EQ(poster.postMessage(), mqbi::StorageResult::e_SUCCESS);
+    }
+
+    // Rollover writes a checkpoint of the new journal, which is set aside.
+    BMQTST_ASSERT_EQ(0, fs.rollover());
+    BMQTST_ASSERT(bdls::FilesystemUtil::exists(checkpointFile));
+    BMQTST_ASSERT_EQ(
+        0,
+        bdls::FilesystemUtil::move(checkpointFile, savedCheckpointFile));
+
+    // Messages written after the rollover form the tail of the checkpoint.
+    for (size_t i = 0; i < k_NUM_MSGS; ++i) {
+        BMQTST_ASSERT_EQ(poster.postMessage(), mqbi::StorageResult::e_SUCCESS);
+    }
+
+    const bsls::Types::Uint64 numRecords = fs.numRecords();
+    BMQTST_ASSERT_D("messages should exist before reopen",
+                    numRecords >= 2 * k_NUM_MSGS);
+
+    tester.miscWorkThreadPool().drain();
+    tester.scheduler().cancelAllEventsAndWait();
+    tester.dispatcher().processQueue();
+    fs.unregisterStorage(storage_sp.get());
+    fs.close();
+    BMQTST_ASSERT_EQ(false, fs.isOpen());
+
+    // 1. Clean close writes a checkpoint.
+    BMQTST_ASSERT(bdls::FilesystemUtil::exists(checkpointFile));
+
+    // 2. Recover from the older checkpoint, replaying the tail.
+    BMQTST_ASSERT_EQ(
+        0,
+        bdls::FilesystemUtil::move(savedCheckpointFile, checkpointFile));
+
+    rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    BMQTST_ASSERT_EQ(true, fs.isOpen());
+    BMQTST_ASSERT_EQ(fs.numRecords(), numRecords);
+
+    fs.close();
+    BMQTST_ASSERT(bdls::FilesystemUtil::exists(checkpointFile));
+
+    // 3. Corrupt the checkpoint: recovery falls back to a full replay.
+    {
+        bdls::FilesystemUtil::FileDescriptor fd = bdls::FilesystemUtil::open(
+            checkpointFile,
+            bdls::FilesystemUtil::e_OPEN,
+            bdls::FilesystemUtil::e_READ_WRITE);
+        BMQTST_ASSERT(bdls::FilesystemUtil::k_INVALID_FD != fd);
+        const char k_GARBAGE[] = "garbage";
+        BMQTST_ASSERT_EQ(static_cast<int>(sizeof(k_GARBAGE)),
+                         bdls::FilesystemUtil::write(fd,
+                                                     k_GARBAGE,
+                                                     sizeof(k_GARBAGE)));
+        bdls::FilesystemUtil::close(fd);
+    }
+
+    rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    BMQTST_ASSERT_EQ(true, fs.isOpen());
+    BMQTST_ASSERT_EQ(fs.numRecords(), numRecords);
+
+    fs.close();
+}
+
+static void test7_rolloverWithPrecreatedFileSet()
+// ------------------------------------------------------------------------
+// ROLLOVER WITH PRECREATED FILE SET
+//
+// Concerns:
+//   When 'precreatePercent' is configured, the next file set is created in
+//   the background once the active files reach that usage, and rollover
+//   uses it.  Verify that:
+//   1. The precreated files are created after a flush, and are not found
+//      as a file set.
+//   2. Rollover renames the precreated files into the new active file set.
+//   3. Messages are recovered from the new active file set.
+//   4. Precreated files are deleted when the partition is closed.
+//
+// Testing:
+//   rollover (with precreated file set)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const char       k_LOCATION[] = "./test-cluster123-7";
+    Tester           tester(k_LOCATION,
+                            0,      // recoveryThreads
+                            false,  // recoveryCheckpoint
+                            1);     // precreatePercent
+    mqbs::FileStore& fs = tester.fileStore();
+
+    tester.dispatcher().setEnqueueOnly(true);
+
+    bsl::string precreatedPattern(k_LOCATION,
+                                  bmqtst::TestHelperUtil::allocator());
+    precreatedPattern.append("/next_bmq_0.*");
+
+    int rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    if (rc) {
+        cout << "Failed to open partition, rc: " << rc << endl;
+        return;  // RETURN
+    }
+
+    fs.setActivePrimary(tester.node(), 1);  // primaryLeaseId
+
+    bmqt::Uri        queueUri("bmq://si.amw.bmq.stats/testQueue",
+                       bmqtst::TestHelperUtil::allocator());
+    mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                              "ABCDE");
+
+    mqbmock::Cluster mockCluster(bmqtst::TestHelperUtil::allocator());
+    mqbmock::Domain  mockDomain(&mockCluster,
+                               bmqtst::TestHelperUtil::allocator());
+    mqbconfm::Domain domainCfg(bmqtst::TestHelperUtil::allocator());
+    domainCfg.messageTtl() = bsl::numeric_limits<bsls::Types::Int64>::max();
+    domainCfg.storage().config().makeFileBacked();
+    bmqu::MemOutStream errDesc(bmqtst::TestHelperUtil::allocator());
+    mockDomain.configure(errDesc, domainCfg);
+
+    bsl::shared_ptr<mqbs::ReplicatedStorage> storage_sp;
+    fs.createStorage(&storage_sp, queueUri, queueKey, &mockDomain);
+
+    mqbconfm::Limits limits;
+    limits.messages() = bsl::numeric_limits<bsls::Types::Int64>::max();
+    limits.bytes()    = bsl::numeric_limits<bsls::Types::Int64>::max();
+    limits.messagesWatermarkRatio() = 0.8;
+    limits.bytesWatermarkRatio()    = 0.8;
+    storage_sp->configure(domainCfg.storage().config(),
+                          limits,
+                          domainCfg.messageTtl(),
+                          0);  // maxDeliveryAttempts
+
+    fs.registerStorage(storage_sp.get());
+
+    mqbmock::Queue mockQueue(&mockDomain, bmqtst::TestHelperUtil::allocator());
+    storage_sp->setQueue(&mockQueue);
+
+    mqbs::DataStoreRecordHandle queueHandle;
+    bsls::Types::Uint64         timestamp = bdlt::EpochUtil::convertToTimeT64(
+        bdlt::CurrentTime::utc());
+    rc = fs.writeQueueCreationRecord(&queueHandle,
+                                     queueUri,
+                                     queueKey,
+                                     AppInfos(),
+                                     timestamp,
+                                     true);  // isNewQueue
+    BMQTST_ASSERT_EQ(0, rc);
+
+    // 1% of the 1MB journal is reached after a couple hundred messages.
+    StoragePoster poster(storage_sp, bmqtst::TestHelperUtil::allocator());
+    const size_t  k_NUM_MSGS = 500;
+    for (size_t i = 0; i < k_NUM_MSGS; ++i) {
+        BMQTST_ASSERT_EQ(poster.postMessage(), mqbi::StorageResult::e_SUCCESS);
+    }
+
+    // 1. Precreated files
+    fs.flushStorage();
+    tester.miscWorkThreadPool().drain();
+
+    bsl::vector<bsl::string> files(bmqtst::TestHelperUtil::allocator());
+    bdls::FilesystemUtil::findMatchingPaths(&files, precreatedPattern.c_str());
+    BMQTST_ASSERT_EQ(files.size(), 3U);
+
+    bsl::vector<mqbs::FileStoreSet> fileSets(
+        bmqtst::TestHelperUtil::allocator());
+    rc = mqbs::FileStoreUtil::findFileSets(&fileSets,
+                                           k_LOCATION,
+                                           0,       // partitionId
+                                           false,   // withSize
+                                           true);   // needQList
+    BMQTST_ASSERT_EQ(0, rc);
+    BMQTST_ASSERT_EQ(fileSets.size(), 1U);
+
+    // 2. Rollover
+    BMQTST_ASSERT_EQ(0, fs.rollover());
+    files.clear();
+    bdls::FilesystemUtil::findMatchingPaths(&files, precreatedPattern.c_str());
+    BMQTST_ASSERT(files.empty());
+
+    const bsls::Types::Uint64 numRecords = fs.numRecords();
+    BMQTST_ASSERT_D("messages should exist before reopen",
+                    numRecords >= k_NUM_MSGS);
+
+    // A new file set is precreated for the next rollover.
+    fs.flushStorage();
+    tester.miscWorkThreadPool().drain();
+
+    tester.scheduler().cancelAllEventsAndWait();
+    tester.dispatcher().processQueue();
+    fs.unregisterStorage(storage_sp.get());
+    fs.close();
+    BMQTST_ASSERT_EQ(false, fs.isOpen());
+
+    // 4. No precreated files are left after close.
+    files.clear();
+    bdls::FilesystemUtil::findMatchingPaths(&files, precreatedPattern.c_str());
+    BMQTST_ASSERT(files.empty());
+
+    // 3. Recovery
+    rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    BMQTST_ASSERT_EQ(true, fs.isOpen());
+    BMQTST_ASSERT_EQ(fs.numRecords(), numRecords);
+
+    fs.close();
+}
+
+// ============================================================================
+//                              PERFORMANCE TESTS
+// ----------------------------------------------------------------------------
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+/// Open the partition of the specified `tester` as primary, write a queue
+/// creation record to it and return the key of that queue.
+static mqbu::StorageKey openBenchmarkPartition(Tester* tester)
+{
+    mqbs::FileStore& fs = tester->fileStore();
+
+    int rc = fs.open(0);
+    BMQTST_ASSERT_EQ(0, rc);
+    fs.setActivePrimary(tester->node(), 1);
+
+    const mqbu::StorageKey queueKey(mqbu::StorageKey::BinaryRepresentation(),
+                                    "abcde");
+    mqbs::DataStoreRecordHandle queueHandle;
+    rc = fs.writeQueueCreationRecord(
+        &queueHandle,
+        bmqt::Uri("bmq://bmq.test.mmap.priority/q1",
+                  bmqtst::TestHelperUtil::allocator()),
+        queueKey,
+        AppInfos(),
+        bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+        true);  // isNewQueue
+    BMQTST_ASSERT_EQ(0, rc);
+
+    return queueKey;
+}
+
+/// Write to the specified `fs` a message record for the specified
+/// `queueKey` with the specified `appData`, and return the result of
+/// `writeMessageRecord`.
+static int writeBenchmarkMessage(mqbs::FileStore*                    fs,
+                                 const mqbu::StorageKey&             queueKey,
+                                 const bsl::shared_ptr<bdlbb::Blob>& appData)
+{
+    bmqt::MessageGUID guid;
+    mqbu::MessageGUIDUtil::generateGUID(&guid);
+
+    mqbi::StorageMessageAttributes attributes(
+        bdlt::EpochUtil::convertToTimeT64(bdlt::CurrentTime::utc()),
+        1,  // refCount
+        appData->length(),
+        bmqp::MessagePropertiesInfo(),
+        bmqt::CompressionAlgorithmType::e_NONE,
+        0);  // crc32c
+
+    mqbs::DataStoreRecordHandle handle;
+    return fs->writeMessageRecord(&attributes,
+                                  &handle,
+                                  guid,
+                                  appData,
+                                  bsl::shared_ptr<bdlbb::Blob>(),
+                                  queueKey);
+}
+
+static void testN1_writeMessageRecord_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// WRITE MESSAGE RECORD BENCHMARK
+//
+// Concerns:
+//   Measure the cost of 'FileStore::writeMessageRecord' on a primary for a
+//   payload of 'state.range(0)' bytes, i.e. the write of the data file
+//   record and of the journal record of each PUT, with the 'preallocate'
+//   and 'prefaultPages' partition settings given by 'state.range(1)' and
+//   'state.range(2)'.  Besides the mean, report the median, the 99th
+//   percentile and the maximum write latency.  The number of iterations is
+//   fixed so that a single file set holds all the records.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: WRITE MESSAGE RECORD");
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    Tester tester("./test-cluster123-N1",
+                  0,      // recoveryThreads
+                  false,  // recoveryCheckpoint
+                  0,      // precreatePercent
+                  state.range(1) != 0,
+                  state.range(2) != 0);
+
+    mqbs::FileStore&       fs       = tester.fileStore();
+    const mqbu::StorageKey queueKey = openBenchmarkPartition(&tester);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        4096,
+        bmqtst::TestHelperUtil::allocator());
+    const int         payloadSize = static_cast<int>(state.range(0));
+    const bsl::string payload(payloadSize,
+                              'x',
+                              bmqtst::TestHelperUtil::allocator());
+
+    bsl::shared_ptr<bdlbb::Blob> appData_sp;
+    appData_sp.createInplace(bmqtst::TestHelperUtil::allocator(),
+                             &bufferFactory,
+                             bmqtst::TestHelperUtil::allocator());
+    bdlbb::BlobUtil::append(appData_sp.get(), payload.data(), payloadSize);
+
+    bsl::vector<bsls::Types::Int64> latencies(
+        bmqtst::TestHelperUtil::allocator());
+    latencies.reserve(state.max_iterations);
+
+    // <time>
+    for (auto _ : state) {
+        const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+        writeBenchmarkMessage(&fs, queueKey, appData_sp);
+        latencies.push_back(bsls::TimeUtil::getTimer() - begin);
+    }
+    // </time>
+
+    state.SetBytesProcessed(state.iterations() * payloadSize);
+
+    bsl::sort(latencies.begin(), latencies.end());
+    state.counters["p50_ns"] = static_cast<double>(
+        latencies[latencies.size() / 2]);
+    state.counters["p99_ns"] = static_cast<double>(
+        latencies[latencies.size() * 99 / 100]);
+    state.counters["max_ns"] = static_cast<double>(latencies.back());
+
+    fs.close();
+}
+
+static void testN2_recovery_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// RECOVERY BENCHMARK
+//
+// Concerns:
+//   Measure the time 'FileStore::open' takes to recover a partition
+//   holding 'state.range(0)' outstanding 1 KiB messages, i.e. the restart
+//   cost of a broker for the files resulting from a given load.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: RECOVERY");
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    Tester                 tester("./test-cluster123-N2");
+    mqbs::FileStore&       fs       = tester.fileStore();
+    const mqbu::StorageKey queueKey = openBenchmarkPartition(&tester);
+
+    bdlbb::PooledBlobBufferFactory bufferFactory(
+        4096,
+        bmqtst::TestHelperUtil::allocator());
+    const bsl::string payload(1024, 'x', bmqtst::TestHelperUtil::allocator());
+
+    bsl::shared_ptr<bdlbb::Blob> appData_sp;
+    appData_sp.createInplace(bmqtst::TestHelperUtil::allocator(),
+                             &bufferFactory,
+                             bmqtst::TestHelperUtil::allocator());
+    bdlbb::BlobUtil::append(appData_sp.get(),
+                            payload.data(),
+                            static_cast<int>(payload.length()));
+
+    for (int i = 0; i < state.range(0); ++i) {
+        BMQTST_ASSERT_EQ(0, writeBenchmarkMessage(&fs, queueKey, appData_sp));
+    }
+    fs.close();
+
+    // <time>
+    for (auto _ : state) {
+        BMQTST_ASSERT_EQ(0, fs.open(0));
+
+        state.PauseTiming();
+        fs.close();
+        state.ResumeTiming();
+    }
+    // </time>
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+#else
+static void testN1_writeMessageRecord()
+{
+    bmqtst::TestHelper::printTestName(
+        "GOOGLE BENCHMARK: WRITE MESSAGE RECORD");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+
+static void testN2_recovery()
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK: RECOVERY");
+    PV("GoogleBenchmark is not supported on this platform, skipping...")
+}
+#endif  // BMQTST_BENCHMARK_ENABLED
+
 }  // close unnamed namespace
 
 // ============================================================================
@@ -1288,16 +1909,41 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 7: test7_rolloverWithPrecreatedFileSet(); break;
+    case 6: test6_recoverMessagesWithCheckpoint(); break;
+    case 5: test5_recoverMessagesWithWorkerThreads(); break;
     case 4: test4_recoverMessagesAcrossLeaseIds(); break;
     case 3: test3_partitionFullAlarm(); break;
     case 2: test2_printTest(); break;
     case 1: test1_breathingTest(); break;
+    case -1:
+        // Keep the number of iterations below the capacity of the 1 MB
+        // journal configured by the 'Tester'.
+        BMQTST_BENCHMARK_WITH_ARGS(
+            testN1_writeMessageRecord,
+            ArgsProduct({{64, 1024, 4096}, {0, 1}, {0, 1}})
+                ->ArgNames({"payload", "preallocate", "prefault"})
+                ->Iterations(10000));
+        break;
+    case -2:
+        BMQTST_BENCHMARK_WITH_ARGS(testN2_recovery,
+                                   RangeMultiplier(10)
+                                       ->Range(100, 10000)
+                                       ->Unit(benchmark::kMillisecond));
+        break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
     } break;
     }
 
+#ifdef BMQTST_BENCHMARK_ENABLED
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
     bmqu::Time::shutdown();
 
     TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_ALLOC);
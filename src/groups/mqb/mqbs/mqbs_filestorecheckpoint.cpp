@@ -0,0 +1,482 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbs_filestorecheckpoint.h>
+
+#include <mqbscm_version.h>
+// MQB
+#include <mqbs_filestoreprotocol.h>
+#include <mqbs_filesystemutil.h>
+#include <mqbs_mappedfiledescriptor.h>
+
+// BMQ
+#include <bmqp_crc32c.h>
+#include <bmqu_memoutstream.h>
+
+// BDE
+#include <bdlb_bigendian.h>
+#include <bdls_filesystemutil.h>
+#include <bsl_cstring.h>
+#include <bslim_printer.h>
+#include <bslma_default.h>
+#include <bsls_assert.h>
+
+// SYS
+#include <unistd.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+namespace {
+
+// CONSTANTS
+const unsigned int k_MAGIC = 0x424D5143;  // "BMQC"
+
+const unsigned int k_VERSION = 1;
+
+/// Maximum number of bytes written to, or checksummed from, the checkpoint
+/// file in a single call.
+const unsigned int k_MAX_CHUNK_SIZE = 1 << 30;
+
+const char k_TEMP_FILE_SUFFIX[] = ".tmp";
+
+/// Header of a checkpoint file.  The header is followed by the name of the
+/// journal file (padded to a multiple of 8 bytes), the records and the
+/// highest sequence numbers of the checkpoint, all of which are protected by
+/// `d_crc32c`.
+struct CheckpointHeader {
+    bdlb::BigEndianUint32 d_magic;
+    bdlb::BigEndianUint32 d_version;
+    bdlb::BigEndianInt32  d_partitionId;
+    bdlb::BigEndianUint32 d_journalFileNameLength;
+    bdlb::BigEndianUint64 d_journalFilePosition;
+    bdlb::BigEndianUint64 d_dataFilePosition;
+    bdlb::BigEndianUint64 d_qlistFilePosition;
+    bdlb::BigEndianUint64 d_lastSequenceNum;
+    bdlb::BigEndianUint32 d_lastPrimaryLeaseId;
+    bdlb::BigEndianUint32 d_numHighestSequenceNums;
+    bdlb::BigEndianUint64 d_numRecords;
+    bdlb::BigEndianUint32 d_reserved;
+    bdlb::BigEndianUint32 d_crc32c;
+};
+
+/// Outstanding record in a checkpoint file.
+struct CheckpointRecord {
+    bdlb::BigEndianUint64 d_offset;
+    bdlb::BigEndianUint64 d_sequenceNum;
+    bdlb::BigEndianUint32 d_primaryLeaseId;
+    bdlb::BigEndianUint32 d_reserved;
+};
+
+/// Highest sequence number of a primary lease id in a checkpoint file.
+struct CheckpointSequenceNumber {
+    bdlb::BigEndianUint32 d_primaryLeaseId;
+    bdlb::BigEndianUint32 d_reserved;
+    bdlb::BigEndianUint64 d_sequenceNum;
+};
+
+/// Return the specified `length` rounded up to a multiple of 8.
+bsls::Types::Uint64 paddedLength(bsls::Types::Uint64 length)
+{
+    return (length + 7) & ~static_cast<bsls::Types::Uint64>(7);
+}
+
+/// Return the size of the next chunk of the specified `length` bytes.
+unsigned int chunkSize(bsls::Types::Uint64 length)
+{
+    return length < k_MAX_CHUNK_SIZE ? static_cast<unsigned int>(length)
+                                     : k_MAX_CHUNK_SIZE;
+}
+
+/// Return the CRC32-C of the specified `length` bytes starting at the
+/// specified `data`.
+unsigned int checksum(const char* data, bsls::Types::Uint64 length)
+{
+    unsigned int crc = bmqp::Crc32c::k_NULL_CRC32C;
+    while (0 < length) {
+        const unsigned int size = chunkSize(length);
+
+        crc = bmqp::Crc32c::calculate(data, size, crc);
+        data += size;
+        length -= size;
+    }
+
+    return crc;
+}
+
+/// Write the specified `length` bytes starting at the specified `data` to
+/// the specified `fd`.  Return zero on success, non-zero value otherwise.
+int writeFully(bdls::FilesystemUtil::FileDescriptor fd,
+               const char*                          data,
+               bsls::Types::Uint64                  length)
+{
+    while (0 < length) {
+        const int written = bdls::FilesystemUtil::write(
+            fd,
+            data,
+            static_cast<int>(chunkSize(length)));
+        if (written <= 0) {
+            return -1;  // RETURN
+        }
+
+        data += written;
+        length -= written;
+    }
+
+    return 0;
+}
+
+}  // close unnamed namespace
+
+// -------------------------
+// class FileStoreCheckpoint
+// -------------------------
+
+// CONSTANTS
+const char* FileStoreCheckpoint::k_FILE_EXTENSION(".checkpoint");
+
+// CLASS METHODS
+void FileStoreCheckpoint::createFileName(bsl::string*             fileName,
+                                         const bslstl::StringRef& location,
+                                         int                      partitionId)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(fileName);
+    BSLS_ASSERT_SAFE(!location.isEmpty());
+
+    // Name to create: '/location/bmq_<partitionId>.checkpoint'.  Note that
+    // this name doesn't match the pattern of the files of a file set.
+
+    fileName->assign(location.data(), location.length());
+    if ('/' != *(fileName->rbegin())) {
+        fileName->append(1, '/');
+    }
+
+    bmqu::MemOutStream osstr(fileName->get_allocator().mechanism());
+    osstr << partitionId;
+
+    fileName->append(FileStoreProtocol::k_COMMON_FILE_PREFIX);
+    fileName->append(osstr.str().data(), osstr.str().length());
+    fileName->append(k_FILE_EXTENSION);
+}
+
+// CREATORS
+FileStoreCheckpoint::FileStoreCheckpoint(bslma::Allocator* allocator)
+: d_allocator_p(bslma::Default::allocator(allocator))
+, d_partitionId(-1)
+, d_journalFileName(allocator)
+, d_journalFilePosition(0)
+, d_dataFilePosition(0)
+, d_qlistFilePosition(0)
+, d_lastPrimaryLeaseId(0)
+, d_lastSequenceNum(0)
+, d_records(allocator)
+, d_highestSequenceNums(allocator)
+{
+    // NOTHING
+}
+
+// MANIPULATORS
+void FileStoreCheckpoint::reset()
+{
+    d_partitionId = -1;
+    d_journalFileName.clear();
+    d_journalFilePosition = 0;
+    d_dataFilePosition    = 0;
+    d_qlistFilePosition   = 0;
+    d_lastPrimaryLeaseId  = 0;
+    d_lastSequenceNum     = 0;
+    d_records.clear();
+    d_highestSequenceNums.clear();
+}
+
+int FileStoreCheckpoint::load(bsl::ostream&      errorDescription,
+                              const bsl::string& fileName)
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS          = 0,
+        rc_FILE_NOT_FOUND   = -1,
+        rc_OPEN_FAILURE     = -2,
+        rc_INVALID_HEADER   = -3,
+        rc_INVALID_VERSION  = -4,
+        rc_INVALID_SIZE     = -5,
+        rc_CHECKSUM_FAILURE = -6
+    };
+
+    reset();
+
+    const bsls::Types::Int64 fileSize = bdls::FilesystemUtil::getFileSize(
+        fileName);
+    if (0 > fileSize) {
+        errorDescription << "Checkpoint file [" << fileName
+                         << "] not found.";
+        return rc_FILE_NOT_FOUND;  // RETURN
+    }
+
+    if (static_cast<bsls::Types::Uint64>(fileSize) <
+        sizeof(CheckpointHeader)) {
+        errorDescription << "Checkpoint file [" << fileName
+                         << "] is too small to contain a header: " << fileSize
+                         << " bytes.";
+        return rc_INVALID_HEADER;  // RETURN
+    }
+
+    MappedFileDescriptor mfd;
+
+    int rc = FileSystemUtil::open(&mfd,
+                                  fileName.c_str(),
+                                  fileSize,
+                                  true,  // read only
+                                  errorDescription);
+    if (0 != rc) {
+        return rc * 10 + rc_OPEN_FAILURE;  // RETURN
+    }
+
+    const char*             base   = mfd.mapping();
+    const CheckpointHeader& header =
+        *reinterpret_cast<const CheckpointHeader*>(base);
+
+    rc = rc_SUCCESS;
+    if (k_MAGIC != header.d_magic) {
+        errorDescription << "Checkpoint file [" << fileName
+                         << "] has invalid magic: " << header.d_magic << ".";
+        rc = rc_INVALID_HEADER;
+    }
+    else if (k_VERSION != header.d_version) {
+        errorDescription << "Checkpoint file [" << fileName
+                         << "] has unsupported version: " << header.d_version
+                         << ".";
+        rc = rc_INVALID_VERSION;
+    }
+
+    const bsls::Types::Uint64 size       = fileSize;
+    const bsls::Types::Uint64 numRecords = header.d_numRecords;
+    const bsls::Types::Uint64 numSeqNums = header.d_numHighestSequenceNums;
+    const bsls::Types::Uint64 nameLength = paddedLength(
+        header.d_journalFileNameLength);
+
+    const bsls::Types::Uint64 recordsSize  = numRecords *
+                                            sizeof(CheckpointRecord);
+    const bsls::Types::Uint64 seqNumsSize  = numSeqNums *
+                                            sizeof(CheckpointSequenceNumber);
+    const bsls::Types::Uint64 expectedSize = sizeof(CheckpointHeader) +
+                                             nameLength + recordsSize +
+                                             seqNumsSize;
+
+    if (rc_SUCCESS == rc &&
+        (numRecords > size / sizeof(CheckpointRecord) || nameLength > size ||
+         expectedSize != size)) {
+        errorDescription << "Checkpoint file [" << fileName << "] has size "
+                         << fileSize << " bytes, which doesn't match the "
+                         << "size declared by its header: " << expectedSize
+                         << " bytes.";
+        rc = rc_INVALID_SIZE;
+    }
+
+    if (rc_SUCCESS == rc) {
+        const unsigned int crc = checksum(base + sizeof(CheckpointHeader),
+                                          size - sizeof(CheckpointHeader));
+        if (crc != header.d_crc32c) {
+            errorDescription << "Checkpoint file [" << fileName
+                             << "] has invalid CRC32-C: " << header.d_crc32c
+                             << ", expected: " << crc << ".";
+            rc = rc_CHECKSUM_FAILURE;
+        }
+    }
+
+    if (rc_SUCCESS != rc) {
+        FileSystemUtil::close(&mfd);
+        return rc;  // RETURN
+    }
+
+    d_partitionId         = header.d_partitionId;
+    d_journalFilePosition = header.d_journalFilePosition;
+    d_dataFilePosition    = header.d_dataFilePosition;
+    d_qlistFilePosition   = header.d_qlistFilePosition;
+    d_lastPrimaryLeaseId  = header.d_lastPrimaryLeaseId;
+    d_lastSequenceNum     = header.d_lastSequenceNum;
+
+    const char* position = base + sizeof(CheckpointHeader);
+    d_journalFileName.assign(position, header.d_journalFileNameLength);
+    position += nameLength;
+
+    const CheckpointRecord* records =
+        reinterpret_cast<const CheckpointRecord*>(position);
+    d_records.resize(numRecords);
+    for (bsls::Types::Uint64 i = 0; i < numRecords; ++i) {
+        Record& record          = d_records[i];
+        record.d_offset         = records[i].d_offset;
+        record.d_sequenceNum    = records[i].d_sequenceNum;
+        record.d_primaryLeaseId = records[i].d_primaryLeaseId;
+    }
+    position += recordsSize;
+
+    const CheckpointSequenceNumber* seqNums =
+        reinterpret_cast<const CheckpointSequenceNumber*>(position);
+    d_highestSequenceNums.reserve(numSeqNums);
+    for (bsls::Types::Uint64 i = 0; i < numSeqNums; ++i) {
+        d_highestSequenceNums.push_back(
+            bsl::make_pair(static_cast<unsigned int>(
+                               seqNums[i].d_primaryLeaseId),
+                           static_cast<bsls::Types::Uint64>(
+                               seqNums[i].d_sequenceNum)));
+    }
+
+    FileSystemUtil::close(&mfd);
+    return rc_SUCCESS;
+}
+
+// ACCESSORS
+int FileStoreCheckpoint::save(bsl::ostream&      errorDescription,
+                              const bsl::string& fileName) const
+{
+    enum RcEnum {
+        // Value for the various RC error categories
+        rc_SUCCESS       = 0,
+        rc_OPEN_FAILURE  = -1,
+        rc_WRITE_FAILURE = -2,
+        rc_SYNC_FAILURE  = -3,
+        rc_MOVE_FAILURE  = -4
+    };
+
+    const bsls::Types::Uint64 nameLength = paddedLength(
+        d_journalFileName.length());
+    const bsls::Types::Uint64 size = sizeof(CheckpointHeader) + nameLength +
+                                     d_records.size() *
+                                         sizeof(CheckpointRecord) +
+                                     d_highestSequenceNums.size() *
+                                         sizeof(CheckpointSequenceNumber);
+
+    bsl::vector<char> buffer(size, '\0', d_allocator_p);
+    char*             position = buffer.data() + sizeof(CheckpointHeader);
+
+    bsl::memcpy(position,
+                d_journalFileName.data(),
+                d_journalFileName.length());
+    position += nameLength;
+
+    CheckpointRecord* records = reinterpret_cast<CheckpointRecord*>(position);
+    for (bsl::size_t i = 0; i < d_records.size(); ++i) {
+        BSLS_ASSERT_SAFE(0 == i ||
+                         d_records[i - 1].d_offset < d_records[i].d_offset);
+
+        records[i].d_offset         = d_records[i].d_offset;
+        records[i].d_sequenceNum    = d_records[i].d_sequenceNum;
+        records[i].d_primaryLeaseId = d_records[i].d_primaryLeaseId;
+    }
+    position += d_records.size() * sizeof(CheckpointRecord);
+
+    CheckpointSequenceNumber* seqNums =
+        reinterpret_cast<CheckpointSequenceNumber*>(position);
+    for (bsl::size_t i = 0; i < d_highestSequenceNums.size(); ++i) {
+        seqNums[i].d_primaryLeaseId = d_highestSequenceNums[i].first;
+        seqNums[i].d_sequenceNum    = d_highestSequenceNums[i].second;
+    }
+
+    CheckpointHeader& header = *reinterpret_cast<CheckpointHeader*>(
+        buffer.data());
+    header.d_magic                  = k_MAGIC;
+    header.d_version                = k_VERSION;
+    header.d_partitionId            = d_partitionId;
+    header.d_journalFileNameLength  = static_cast<unsigned int>(
+        d_journalFileName.length());
+    header.d_journalFilePosition    = d_journalFilePosition;
+    header.d_dataFilePosition       = d_dataFilePosition;
+    header.d_qlistFilePosition      = d_qlistFilePosition;
+    header.d_lastSequenceNum        = d_lastSequenceNum;
+    header.d_lastPrimaryLeaseId     = d_lastPrimaryLeaseId;
+    header.d_numHighestSequenceNums = static_cast<unsigned int>(
+        d_highestSequenceNums.size());
+    header.d_numRecords             = d_records.size();
+    header.d_crc32c = checksum(buffer.data() + sizeof(CheckpointHeader),
+                               size - sizeof(CheckpointHeader));
+
+    // Write the checkpoint to a temporary file which is then renamed, so
+    // that an existing checkpoint is either left intact or atomically
+    // replaced.
+
+    bsl::string tempFileName(fileName, d_allocator_p);
+    tempFileName.append(k_TEMP_FILE_SUFFIX);
+
+    bdls::FilesystemUtil::FileDescriptor fd = bdls::FilesystemUtil::open(
+        tempFileName,
+        bdls::FilesystemUtil::e_OPEN_OR_CREATE,
+        bdls::FilesystemUtil::e_WRITE_ONLY,
+        bdls::FilesystemUtil::e_TRUNCATE);
+    if (bdls::FilesystemUtil::k_INVALID_FD == fd) {
+        errorDescription << "Failed to open checkpoint file [" << tempFileName
+                         << "].";
+        return rc_OPEN_FAILURE;  // RETURN
+    }
+
+    int rc = writeFully(fd, buffer.data(), size);
+    if (0 != rc) {
+        errorDescription << "Failed to write " << size
+                         << " bytes to checkpoint file [" << tempFileName
+                         << "].";
+        bdls::FilesystemUtil::close(fd);
+        bdls::FilesystemUtil::remove(tempFileName);
+        return rc_WRITE_FAILURE;  // RETURN
+    }
+
+    rc = ::fsync(fd);
+    bdls::FilesystemUtil::close(fd);
+    if (0 != rc) {
+        errorDescription << "Failed to sync checkpoint file [" << tempFileName
+                         << "].";
+        bdls::FilesystemUtil::remove(tempFileName);
+        return rc_SYNC_FAILURE;  // RETURN
+    }
+
+    rc = bdls::FilesystemUtil::move(tempFileName, fileName);
+    if (0 != rc) {
+        errorDescription << "Failed to rename checkpoint file ["
+                         << tempFileName << "] to [" << fileName
+                         << "], rc: " << rc << ".";
+        bdls::FilesystemUtil::remove(tempFileName);
+        return rc_MOVE_FAILURE;  // RETURN
+    }
+
+    return rc_SUCCESS;
+}
+
+bsl::ostream& FileStoreCheckpoint::print(bsl::ostream& stream,
+                                         int           level,
+                                         int           spacesPerLevel) const
+{
+    if (stream.bad()) {
+        return stream;  // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+    printer.start();
+    printer.printAttribute("partitionId", d_partitionId);
+    printer.printAttribute("journalFileName", d_journalFileName);
+    printer.printAttribute("journalFilePosition", d_journalFilePosition);
+    printer.printAttribute("dataFilePosition", d_dataFilePosition);
+    printer.printAttribute("qlistFilePosition", d_qlistFilePosition);
+    printer.printAttribute("lastPrimaryLeaseId", d_lastPrimaryLeaseId);
+    printer.printAttribute("lastSequenceNum", d_lastSequenceNum);
+    printer.printAttribute("numRecords", d_records.size());
+    printer.printAttribute("numHighestSequenceNums",
+                           d_highestSequenceNums.size());
+    printer.end();
+
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,338 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MQBS_FILESTORECHECKPOINT
+#define INCLUDED_MQBS_FILESTORECHECKPOINT
+
+//@PURPOSE: Provide a checkpoint of the outstanding records of a FileStore.
+//
+//@CLASSES:
+//  mqbs::FileStoreCheckpoint: checkpoint of the records of a journal
+//
+//@SEE ALSO: mqbs::FileStore
+//
+//@DESCRIPTION: 'mqbs::FileStoreCheckpoint' provides a mechanism to save to,
+// and load from, a file the index of the outstanding records of the journal
+// of a partition at a given point in time.  The index lists the offset and
+// the PSN (primary lease id and sequence number) of every outstanding record
+// and sync point of the journal, in increasing order of offset, along with
+// the positions of the journal, data and qlist files, and the PSN of the last
+// record written to the journal, at the time of the checkpoint.
+//
+// A checkpoint lets 'mqbs::FileStore' skip, at recovery, the records of the
+// journal that were no longer outstanding when the checkpoint was taken: only
+// the part of the journal written after the checkpoint (the "tail") is
+// iterated record by record, while the part before it is only visited at the
+// offsets listed in the checkpoint.
+//
+// The file is written to a temporary file which is then renamed, so that
+// readers never observe a partially written checkpoint, and its content is
+// protected by a CRC32-C.  Note that a checkpoint is only an optimization:
+// 'mqbs::FileStore' validates it against the journal it describes and falls
+// back to a full recovery whenever it does not match.
+
+// BDE
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace mqbs {
+
+// =========================
+// class FileStoreCheckpoint
+// =========================
+
+/// This component provides a checkpoint of the outstanding records of the
+/// journal of a partition.
+class FileStoreCheckpoint {
+  public:
+    // TYPES
+
+    /// Outstanding record of the journal listed in a checkpoint.
+    struct Record {
+        /// Offset of the record in the journal.
+        bsls::Types::Uint64 d_offset;
+
+        /// Sequence number in the PSN of the record.
+        bsls::Types::Uint64 d_sequenceNum;
+
+        /// Primary lease id in the PSN of the record.
+        unsigned int d_primaryLeaseId;
+    };
+
+    typedef bsl::vector<Record> Records;
+
+    /// Pair of primary lease id and highest sequence number.
+    typedef bsl::pair<unsigned int, bsls::Types::Uint64> SequenceNumber;
+
+    typedef bsl::vector<SequenceNumber> SequenceNumbers;
+
+    // CONSTANTS
+
+    /// Extension of the checkpoint file of a partition.
+    static const char* k_FILE_EXTENSION;
+
+  private:
+    // DATA
+    bslma::Allocator* d_allocator_p;
+
+    int d_partitionId;
+
+    /// Name, without its directory, of the journal file described by this
+    /// checkpoint.
+    bsl::string d_journalFileName;
+
+    bsls::Types::Uint64 d_journalFilePosition;
+
+    bsls::Types::Uint64 d_dataFilePosition;
+
+    bsls::Types::Uint64 d_qlistFilePosition;
+
+    /// PSN of the record ending at `d_journalFilePosition`.
+    unsigned int d_lastPrimaryLeaseId;
+
+    bsls::Types::Uint64 d_lastSequenceNum;
+
+    /// Outstanding records, in increasing order of offset.
+    Records d_records;
+
+    /// Highest sequence number written to the journal for each primary lease
+    /// id.
+    SequenceNumbers d_highestSequenceNums;
+
+  private:
+    // NOT IMPLEMENTED
+    FileStoreCheckpoint(const FileStoreCheckpoint&);             // = delete
+    FileStoreCheckpoint& operator=(const FileStoreCheckpoint&);  // = delete
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FileStoreCheckpoint,
+                                   bslma::UsesBslmaAllocator)
+
+    // CLASS METHODS
+
+    /// Load into the specified `fileName` the name of the checkpoint file of
+    /// the partition with the specified `partitionId` in the specified
+    /// `location`.
+    static void createFileName(bsl::string*             fileName,
+                               const bslstl::StringRef& location,
+                               int                      partitionId);
+
+    // CREATORS
+
+    /// Create an empty checkpoint using the optionally specified `allocator`.
+    explicit FileStoreCheckpoint(bslma::Allocator* allocator = 0);
+
+    // MANIPULATORS
+
+    /// Reset this object to the empty checkpoint.
+    void reset();
+
+    FileStoreCheckpoint& setPartitionId(int value);
+    FileStoreCheckpoint& setJournalFileName(const bslstl::StringRef& value);
+    FileStoreCheckpoint& setJournalFilePosition(bsls::Types::Uint64 value);
+    FileStoreCheckpoint& setDataFilePosition(bsls::Types::Uint64 value);
+    FileStoreCheckpoint& setQlistFilePosition(bsls::Types::Uint64 value);
+
+    /// Set the PSN of the last record written to the journal to the
+    /// specified `primaryLeaseId` and `sequenceNum`, and return a reference
+    /// offering modifiable access to this object.
+    FileStoreCheckpoint& setLastRecord(unsigned int        primaryLeaseId,
+                                       bsls::Types::Uint64 sequenceNum);
+
+    /// Return a reference offering modifiable access to the outstanding
+    /// records of this checkpoint.  The behavior of `save` is undefined
+    /// unless the records are in increasing order of offset.
+    Records& records();
+
+    SequenceNumbers& highestSequenceNums();
+
+    /// Load into this object the checkpoint stored in the file with the
+    /// specified `fileName`.  Return zero on success, or a non-zero value
+    /// with a description of the error in the specified `errorDescription`
+    /// otherwise, in which case this object is left in the empty state.
+    int load(bsl::ostream& errorDescription, const bsl::string& fileName);
+
+    // ACCESSORS
+
+    /// Save this checkpoint to the file with the specified `fileName`,
+    /// replacing any existing file.  Return zero on success, or a non-zero
+    /// value with a description of the error in the specified
+    /// `errorDescription` otherwise.  Note that the file is replaced
+    /// atomically: if this method fails, any existing file is left intact.
+    int save(bsl::ostream&      errorDescription,
+             const bsl::string& fileName) const;
+
+    int                    partitionId() const;
+    const bsl::string&     journalFileName() const;
+    bsls::Types::Uint64    journalFilePosition() const;
+    bsls::Types::Uint64    dataFilePosition() const;
+    bsls::Types::Uint64    qlistFilePosition() const;
+    unsigned int           lastPrimaryLeaseId() const;
+    bsls::Types::Uint64    lastSequenceNum() const;
+    const Records&         records() const;
+    const SequenceNumbers& highestSequenceNums() const;
+
+    /// Format this object to the specified output `stream` at the (absolute
+    /// value of) the optionally specified indentation `level` and return a
+    /// reference to `stream`.  If `level` is specified, optionally specify
+    /// `spacesPerLevel`, the number of spaces per indentation level for this
+    /// and all of its nested objects.  If `level` is negative, suppress
+    /// indentation of the first line.  If `spacesPerLevel` is negative,
+    /// format the entire output on one line, suppressing all but the
+    /// initial indentation (as governed by `level`).  If `stream` is not
+    /// valid on entry, this operation has no effect.  Note that the records
+    /// of this checkpoint are not printed, only their number is.
+    bsl::ostream&
+    print(bsl::ostream& stream, int level = 0, int spacesPerLevel = 4) const;
+};
+
+// FREE OPERATORS
+
+/// Format the specified `rhs` to the specified output `stream` and return a
+/// reference to the modifiable `stream`.
+bsl::ostream& operator<<(bsl::ostream&              stream,
+                         const FileStoreCheckpoint& rhs);
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// -------------------------
+// class FileStoreCheckpoint
+// -------------------------
+
+// MANIPULATORS
+inline FileStoreCheckpoint& FileStoreCheckpoint::setPartitionId(int value)
+{
+    d_partitionId = value;
+    return *this;
+}
+
+inline FileStoreCheckpoint&
+FileStoreCheckpoint::setJournalFileName(const bslstl::StringRef& value)
+{
+    d_journalFileName.assign(value.data(), value.length());
+    return *this;
+}
+
+inline FileStoreCheckpoint&
+FileStoreCheckpoint::setJournalFilePosition(bsls::Types::Uint64 value)
+{
+    d_journalFilePosition = value;
+    return *this;
+}
+
+inline FileStoreCheckpoint&
+FileStoreCheckpoint::setDataFilePosition(bsls::Types::Uint64 value)
+{
+    d_dataFilePosition = value;
+    return *this;
+}
+
+inline FileStoreCheckpoint&
+FileStoreCheckpoint::setQlistFilePosition(bsls::Types::Uint64 value)
+{
+    d_qlistFilePosition = value;
+    return *this;
+}
+
+inline FileStoreCheckpoint&
+FileStoreCheckpoint::setLastRecord(unsigned int        primaryLeaseId,
+                                   bsls::Types::Uint64 sequenceNum)
+{
+    d_lastPrimaryLeaseId = primaryLeaseId;
+    d_lastSequenceNum    = sequenceNum;
+    return *this;
+}
+
+inline FileStoreCheckpoint::Records& FileStoreCheckpoint::records()
+{
+    return d_records;
+}
+
+inline FileStoreCheckpoint::SequenceNumbers&
+FileStoreCheckpoint::highestSequenceNums()
+{
+    return d_highestSequenceNums;
+}
+
+// ACCESSORS
+inline int FileStoreCheckpoint::partitionId() const
+{
+    return d_partitionId;
+}
+
+inline const bsl::string& FileStoreCheckpoint::journalFileName() const
+{
+    return d_journalFileName;
+}
+
+inline bsls::Types::Uint64 FileStoreCheckpoint::journalFilePosition() const
+{
+    return d_journalFilePosition;
+}
+
+inline bsls::Types::Uint64 FileStoreCheckpoint::dataFilePosition() const
+{
+    return d_dataFilePosition;
+}
+
+inline bsls::Types::Uint64 FileStoreCheckpoint::qlistFilePosition() const
+{
+    return d_qlistFilePosition;
+}
+
+inline unsigned int FileStoreCheckpoint::lastPrimaryLeaseId() const
+{
+    return d_lastPrimaryLeaseId;
+}
+
+inline bsls::Types::Uint64 FileStoreCheckpoint::lastSequenceNum() const
+{
+    return d_lastSequenceNum;
+}
+
+inline const FileStoreCheckpoint::Records&
+FileStoreCheckpoint::records() const
+{
+    return d_records;
+}
+
+inline const FileStoreCheckpoint::SequenceNumbers&
+FileStoreCheckpoint::highestSequenceNums() const
+{
+    return d_highestSequenceNums;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline bsl::ostream& mqbs::operator<<(bsl::ostream&                    stream,
+                                      const mqbs::FileStoreCheckpoint& rhs)
+{
+    return rhs.print(stream, 0, -1);
+}
+
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,318 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbs_filestorecheckpoint.h>
+
+// BMQ
+#include <bmqu_memoutstream.h>
+
+// BDE
+#include <bdls_filesystemutil.h>
+#include <bsl_fstream.h>
+#include <bsl_iterator.h>
+#include <bsl_string.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Populate the specified `checkpoint` with the specified `numRecords`
+/// records and some arbitrary values.
+void populate(mqbs::FileStoreCheckpoint* checkpoint, bsl::size_t numRecords)
+{
+    checkpoint->setPartitionId(3)
+        .setJournalFileName("bmq_3.20260101_000000.bmq_journal")
+        .setJournalFilePosition(64 + 60 * (numRecords + 2))
+        .setDataFilePosition(4096)
+        .setQlistFilePosition(512)
+        .setLastRecord(2, numRecords + 10);
+
+    for (bsl::size_t i = 0; i < numRecords; ++i) {
+        mqbs::FileStoreCheckpoint::Record record = {64 + 60 * i, i + 1, 2};
+        checkpoint->records().push_back(record);
+    }
+
+    checkpoint->highestSequenceNums().push_back(bsl::make_pair(1U, 42ULL));
+}
+
+/// Load into the specified `content` the content of the file with the
+/// specified `fileName`.
+void readFile(bsl::string* content, const bsl::string& fileName)
+{
+    bsl::ifstream file(fileName.c_str(), bsl::ios::binary);
+    content->assign(bsl::istreambuf_iterator<char>(file),
+                    bsl::istreambuf_iterator<char>());
+}
+
+/// Replace the content of the file with the specified `fileName` with the
+/// specified `content`.
+void writeFile(const bsl::string& fileName, const bsl::string& content)
+{
+    bsl::ofstream file(fileName.c_str(),
+                       bsl::ios::binary | bsl::ios::trunc);
+    file.write(content.data(), content.length());
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Testing:
+//   Basic functionality
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    mqbs::FileStoreCheckpoint obj(bmqtst::TestHelperUtil::allocator());
+
+    BMQTST_ASSERT_EQ(obj.partitionId(), -1);
+    BMQTST_ASSERT(obj.journalFileName().empty());
+    BMQTST_ASSERT_EQ(obj.journalFilePosition(), 0U);
+    BMQTST_ASSERT_EQ(obj.dataFilePosition(), 0U);
+    BMQTST_ASSERT_EQ(obj.qlistFilePosition(), 0U);
+    BMQTST_ASSERT_EQ(obj.lastPrimaryLeaseId(), 0U);
+    BMQTST_ASSERT_EQ(obj.lastSequenceNum(), 0U);
+    BMQTST_ASSERT(obj.records().empty());
+    BMQTST_ASSERT(obj.highestSequenceNums().empty());
+
+    bsl::string fileName(bmqtst::TestHelperUtil::allocator());
+    mqbs::FileStoreCheckpoint::createFileName(&fileName, "/tmp/storage", 4);
+    BMQTST_ASSERT_EQ(fileName, "/tmp/storage/bmq_4.checkpoint");
+
+    mqbs::FileStoreCheckpoint::createFileName(&fileName, "/tmp/storage/", 0);
+    BMQTST_ASSERT_EQ(fileName, "/tmp/storage/bmq_0.checkpoint");
+}
+
+static void test2_saveAndLoad()
+// ------------------------------------------------------------------------
+// SAVE AND LOAD
+//
+// Concerns:
+//   A checkpoint saved to a file is loaded back with the same values, and
+//   saving a checkpoint replaces the existing file.
+//
+// Testing:
+//   save
+//   load
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("SAVE AND LOAD");
+
+    // Recursive removal of the test directory uses the default allocator.
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const bsl::string location("./test-checkpoint-2",
+                               bmqtst::TestHelperUtil::allocator());
+    bdls::FilesystemUtil::remove(location, true);
+    bdls::FilesystemUtil::createDirectories(location, true);
+
+    bsl::string fileName(bmqtst::TestHelperUtil::allocator());
+    mqbs::FileStoreCheckpoint::createFileName(&fileName, location, 3);
+
+    bsl::string tempFileName(fileName, bmqtst::TestHelperUtil::allocator());
+    tempFileName.append(".tmp");
+
+    bmqu::MemOutStream errorDesc(bmqtst::TestHelperUtil::allocator());
+
+    const bsl::size_t k_NUM_RECORDS[] = {0, 1, 1000};
+
+    for (bsl::size_t i = 0; i < sizeof(k_NUM_RECORDS) / sizeof(*k_NUM_RECORDS);
+         ++i) {
+        mqbs::FileStoreCheckpoint obj(bmqtst::TestHelperUtil::allocator());
+        populate(&obj, k_NUM_RECORDS[i]);
+
+        BMQTST_ASSERT_EQ_D(i, 0, obj.save(errorDesc, fileName));
+        BMQTST_ASSERT_D(i, bdls::FilesystemUtil::exists(fileName));
+        BMQTST_ASSERT_D(i, !bdls::FilesystemUtil::exists(tempFileName));
+
+        mqbs::FileStoreCheckpoint loaded(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ_D(i, 0, loaded.load(errorDesc, fileName));
+
+        BMQTST_ASSERT_EQ_D(i, loaded.partitionId(), obj.partitionId());
+        BMQTST_ASSERT_EQ_D(i, loaded.journalFileName(), obj.journalFileName());
+        BMQTST_ASSERT_EQ_D(i,
+                           loaded.journalFilePosition(),
+                           obj.journalFilePosition());
+        BMQTST_ASSERT_EQ_D(i,
+                           loaded.dataFilePosition(),
+                           obj.dataFilePosition());
+        BMQTST_ASSERT_EQ_D(i,
+                           loaded.qlistFilePosition(),
+                           obj.qlistFilePosition());
+        BMQTST_ASSERT_EQ_D(i,
+                           loaded.lastPrimaryLeaseId(),
+                           obj.lastPrimaryLeaseId());
+        BMQTST_ASSERT_EQ_D(i, loaded.lastSequenceNum(), obj.lastSequenceNum());
+        BMQTST_ASSERT_EQ_D(i, loaded.records().size(), obj.records().size());
+        BMQTST_ASSERT_D(i,
+                        loaded.highestSequenceNums() ==
+                            obj.highestSequenceNums());
+
+        for (bsl::size_t j = 0; j < obj.records().size(); ++j) {
+            const mqbs::FileStoreCheckpoint::Record& expected =
+                obj.records()[j];
+            const mqbs::FileStoreCheckpoint::Record& actual =
+                loaded.records()[j];
+
+            BMQTST_ASSERT_EQ_D(j, actual.d_offset, expected.d_offset);
+            BMQTST_ASSERT_EQ_D(j,
+                               actual.d_sequenceNum,
+                               expected.d_sequenceNum);
+            BMQTST_ASSERT_EQ_D(j,
+                               actual.d_primaryLeaseId,
+                               expected.d_primaryLeaseId);
+        }
+    }
+
+    bdls::FilesystemUtil::remove(location, true);
+}
+
+static void test3_loadInvalidFile()
+// ------------------------------------------------------------------------
+// LOAD INVALID FILE
+//
+// Concerns:
+//   Loading a missing, truncated or corrupted checkpoint file fails and
+//   leaves the checkpoint in the empty state.
+//
+// Testing:
+//   load
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("LOAD INVALID FILE");
+
+    // Recursive removal of the test directory uses the default allocator.
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+
+    const bsl::string location("./test-checkpoint-3",
+                               bmqtst::TestHelperUtil::allocator());
+    bdls::FilesystemUtil::remove(location, true);
+    bdls::FilesystemUtil::createDirectories(location, true);
+
+    bsl::string fileName(bmqtst::TestHelperUtil::allocator());
+    mqbs::FileStoreCheckpoint::createFileName(&fileName, location, 3);
+
+    bmqu::MemOutStream        errorDesc(bmqtst::TestHelperUtil::allocator());
+    mqbs::FileStoreCheckpoint obj(bmqtst::TestHelperUtil::allocator());
+
+    // Missing file
+    BMQTST_ASSERT_NE(0, obj.load(errorDesc, fileName));
+
+    populate(&obj, 10);
+    BMQTST_ASSERT_EQ(0, obj.save(errorDesc, fileName));
+
+    bsl::string content(bmqtst::TestHelperUtil::allocator());
+    readFile(&content, fileName);
+    BMQTST_ASSERT(!content.empty());
+
+    {
+        PV("Corrupted record");
+
+        bsl::string corrupted(content, bmqtst::TestHelperUtil::allocator());
+        corrupted[corrupted.length() - 20] ^= 0x1;
+        writeFile(fileName, corrupted);
+
+        mqbs::FileStoreCheckpoint loaded(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_NE(0, loaded.load(errorDesc, fileName));
+        BMQTST_ASSERT(loaded.records().empty());
+        BMQTST_ASSERT(loaded.journalFileName().empty());
+    }
+
+    {
+        PV("Truncated file");
+
+        writeFile(fileName,
+                  bsl::string(content,
+                              0,
+                              content.length() - 8,
+                              bmqtst::TestHelperUtil::allocator()));
+
+        mqbs::FileStoreCheckpoint loaded(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_NE(0, loaded.load(errorDesc, fileName));
+        BMQTST_ASSERT(loaded.records().empty());
+    }
+
+    {
+        PV("File smaller than the header");
+
+        writeFile(fileName,
+                  bsl::string(content,
+                              0,
+                              8,
+                              bmqtst::TestHelperUtil::allocator()));
+
+        mqbs::FileStoreCheckpoint loaded(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_NE(0, loaded.load(errorDesc, fileName));
+    }
+
+    {
+        PV("Invalid magic");
+
+        bsl::string corrupted(content, bmqtst::TestHelperUtil::allocator());
+        corrupted[0] ^= 0x1;
+        writeFile(fileName, corrupted);
+
+        mqbs::FileStoreCheckpoint loaded(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_NE(0, loaded.load(errorDesc, fileName));
+    }
+
+    {
+        PV("Valid file");
+
+        writeFile(fileName, content);
+
+        mqbs::FileStoreCheckpoint loaded(bmqtst::TestHelperUtil::allocator());
+        BMQTST_ASSERT_EQ(0, loaded.load(errorDesc, fileName));
+        BMQTST_ASSERT_EQ(loaded.records().size(), 10U);
+    }
+
+    bdls::FilesystemUtil::remove(location, true);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_loadInvalidFile(); break;
+    case 2: test2_saveAndLoad(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_ALLOC);
+}
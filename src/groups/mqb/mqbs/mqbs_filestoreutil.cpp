@@ -64,6 +64,11 @@ namespace mqbs {
 
 namespace {
 
+/// Prefix of the base name of the files of a file set created ahead of
+/// rollover, so that they are not found by `FileStoreUtil::findFileSets`
+/// (and hence by recovery) until they become the active file set.
+const char k_PRECREATED_FILE_PREFIX[] = "next_";
+
 /// Append the specified `value` to `result` in YYYYMMDD_HHMMSS format.
 void appendFormattedDatetime(bsl::string* result, const bdlt::Datetime& value)
 {
@@ -105,6 +110,56 @@ void createFileName(bsl::string*             filename,
     filename->append(extension);
 }
 
+/// Populate the specified `dataFileName`, `journalFileName` and, if
+/// specified, `qlistFileName` with names of files located at the specified
+/// `basePath` for the specified `partitionId` which do not clash with any
+/// existing file.  If the specified `precreated` flag is true, prefix the
+/// base names with `k_PRECREATED_FILE_PREFIX`.
+void createFileSetNames(bsl::string*             dataFileName,
+                        bsl::string*             journalFileName,
+                        bsl::string*             qlistFileName,
+                        const bslstl::StringRef& basePath,
+                        int                      partitionId,
+                        bool                     precreated)
+{
+    bdlt::Datetime now       = bdlt::CurrentTime::utc();
+    int            increment = 0;
+
+    bsl::string* names[] = {dataFileName, journalFileName, qlistFileName};
+
+    do {
+        // Increment 'now' by 1 second everytime there is a clash of at least
+        // 1 file name.
+
+        now.addSeconds(increment++);
+        FileStoreUtil::createDataFileName(dataFileName,
+                                          basePath,
+                                          partitionId,
+                                          now);
+        FileStoreUtil::createJournalFileName(journalFileName,
+                                             basePath,
+                                             partitionId,
+                                             now);
+        if (qlistFileName) {
+            FileStoreUtil::createQlistFileName(qlistFileName,
+                                               basePath,
+                                               partitionId,
+                                               now);
+        }
+
+        if (precreated) {
+            for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); ++i) {
+                if (names[i]) {
+                    names[i]->insert(names[i]->rfind('/') + 1,
+                                     k_PRECREATED_FILE_PREFIX);
+                }
+            }
+        }
+    } while (bdls::FilesystemUtil::exists(*dataFileName) ||
+             bdls::FilesystemUtil::exists(*journalFileName) ||
+             (qlistFileName && bdls::FilesystemUtil::exists(*qlistFileName)));
+}
+
 int openFileSet(bsl::ostream&         errorDescription,
                 const FileStoreSet&   fileSet,
                 bool                  readOnly,
@@ -494,14 +549,15 @@ int FileStoreUtil::createFilePattern(bsl::string*             pattern,
     return rc_SUCCESS;
 }
 
-int FileStoreUtil::create(bsl::ostream&            errorDescription,
-                          FileSetSp*               fileSetSp,
-                          FileStore*               fileStore,
-                          int                      partitionId,
-                          const DataStoreConfig&   dataStoreConfig,
-                          const bslstl::StringRef& partitionDesc,
-                          bool                     needQList,
-                          bslma::Allocator*        allocator)
+int FileStoreUtil::createImpl(bsl::ostream&            errorDescription,
+                              FileSetSp*               fileSetSp,
+                              FileStore*               fileStore,
+                              int                      partitionId,
+                              const DataStoreConfig&   dataStoreConfig,
+                              const bslstl::StringRef& partitionDesc,
+                              bool                     needQList,
+                              bool                     precreated,
+                              bslma::Allocator*        allocator)
 {
     // PRECONDITIONS
     BSLS_ASSERT_SAFE(fileSetSp);
@@ -510,34 +566,12 @@ int FileStoreUtil::create(bsl::ostream&            errorDescription,
     FileSetSp result;
     result.createInplace(allocator, fileStore, allocator);
 
-    bdlt::Datetime now       = bdlt::CurrentTime::utc();
-    int            increment = 0;
-
-    do {
-        // Increment 'now' by 1 second everytime there is a clash of at least
-        // 1 file name.
-
-        now.addSeconds(increment++);
-        createDataFileName(&result->d_data.d_fileName,
-                           dataStoreConfig.location(),
-                           partitionId,
-                           now);
-
-        createJournalFileName(&result->d_journal.d_fileName,
-                              dataStoreConfig.location(),
-                              partitionId,
-                              now);
-
-        if (needQList) {
-            createQlistFileName(&result->d_qlist.d_fileName,
-                                dataStoreConfig.location(),
-                                partitionId,
-                                now);
-        }
-    } while (bdls::FilesystemUtil::exists(result->d_data.d_fileName) ||
-             bdls::FilesystemUtil::exists(result->d_journal.d_fileName) ||
-             (needQList &&
-              bdls::FilesystemUtil::exists(result->d_qlist.d_fileName)));
+    createFileSetNames(&result->d_data.d_fileName,
+                       &result->d_journal.d_fileName,
+                       needQList ? &result->d_qlist.d_fileName : 0,
+                       dataStoreConfig.location(),
+                       partitionId,
+                       precreated);
 
     BSLS_ASSERT_SAFE(!bdls::FilesystemUtil::exists(result->d_data.d_fileName));
     BSLS_ASSERT_SAFE(
@@ -566,7 +600,7 @@ int FileStoreUtil::create(bsl::ostream&            errorDescription,
                                   &result->d_journal.d_file,
                                   &result->d_data.d_file,
                                   needQList ? &result->d_qlist.d_file : 0,
-                                  dataStoreConfig.hasPrefaultPages());
+                                  shouldPrefaultMappings(dataStoreConfig));
 
     if (0 != rc) {
         errorDescription << partitionDesc << " Failed to open file set in "
@@ -651,11 +685,144 @@ int FileStoreUtil::create(bsl::ostream&            errorDescription,
         result->d_qlist.d_outstandingBytes += qlistFilePos;
     }
 
+    adviseFileSet(result.get(), dataStoreConfig);
+
     *fileSetSp = result;
 
     return 0;
 }
 
+int FileStoreUtil::create(bsl::ostream&            errorDescription,
+                          FileSetSp*               fileSetSp,
+                          FileStore*               fileStore,
+                          int                      partitionId,
+                          const DataStoreConfig&   dataStoreConfig,
+                          const bslstl::StringRef& partitionDesc,
+                          bool                     needQList,
+                          bslma::Allocator*        allocator)
+{
+    return createImpl(errorDescription,
+                      fileSetSp,
+                      fileStore,
+                      partitionId,
+                      dataStoreConfig,
+                      partitionDesc,
+                      needQList,
+                      false,  // precreated
+                      allocator);
+}
+
+int FileStoreUtil::precreate(bsl::ostream&            errorDescription,
+                             FileSetSp*               fileSetSp,
+                             FileStore*               fileStore,
+                             int                      partitionId,
+                             const DataStoreConfig&   dataStoreConfig,
+                             const bslstl::StringRef& partitionDesc,
+                             bool                     needQList,
+                             bslma::Allocator*        allocator)
+{
+    return createImpl(errorDescription,
+                      fileSetSp,
+                      fileStore,
+                      partitionId,
+                      dataStoreConfig,
+                      partitionDesc,
+                      needQList,
+                      true,  // precreated
+                      allocator);
+}
+
+int FileStoreUtil::activatePrecreated(
+    bsl::ostream&            errorDescription,
+    FileSet*                 fileSet,
+    int                      partitionId,
+    const bslstl::StringRef& location,
+    bool                     needQList)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(fileSet);
+
+    enum {
+        rc_SUCCESS              = 0,
+        rc_DATA_MOVE_FAILURE    = -1,
+        rc_QLIST_MOVE_FAILURE   = -2,
+        rc_JOURNAL_MOVE_FAILURE = -3
+    };
+
+    bsl::string dataFileName;
+    bsl::string journalFileName;
+    bsl::string qlistFileName;
+    createFileSetNames(&dataFileName,
+                       &journalFileName,
+                       needQList ? &qlistFileName : 0,
+                       location,
+                       partitionId,
+                       false);  // precreated
+
+    // Rename the JOURNAL file last: a file set missing any of its files is
+    // ignored by recovery, so that a failure, or a crash, in the middle of
+    // the renames does not expose the (empty) precreated file set.
+
+    FileSet::FileInfo* fileInfos[] = {&fileSet->d_data,
+                                      &fileSet->d_qlist,
+                                      &fileSet->d_journal};
+    const bsl::string* newNames[]  = {&dataFileName,
+                                      &qlistFileName,
+                                      &journalFileName};
+    const int          rcs[]       = {rc_DATA_MOVE_FAILURE,
+                                      rc_QLIST_MOVE_FAILURE,
+                                      rc_JOURNAL_MOVE_FAILURE};
+
+    for (size_t i = 0; i < sizeof(fileInfos) / sizeof(fileInfos[0]); ++i) {
+        if (newNames[i]->empty()) {
+            continue;  // CONTINUE
+        }
+
+        const int rc = bdls::FilesystemUtil::move(
+            fileInfos[i]->d_fileName.c_str(),
+            newNames[i]->c_str());
+        if (0 != rc) {
+            errorDescription << "Failed to rename file ["
+                             << fileInfos[i]->d_fileName << "] to ["
+                             << *newNames[i] << "], rc: " << rc;
+            return 10 * rc + rcs[i];  // RETURN
+        }
+
+        fileInfos[i]->d_fileName = *newNames[i];
+    }
+
+    return rc_SUCCESS;
+}
+
+void FileStoreUtil::deletePrecreatedFiles(int                      partitionId,
+                                          const bslstl::StringRef& location)
+{
+    bsl::string pattern;
+    if (0 != createFilePattern(&pattern, location, partitionId)) {
+        return;  // RETURN
+    }
+
+    // Insert the precreated file prefix before the base name of the pattern.
+
+    pattern.insert(pattern.rfind('/') + 1, k_PRECREATED_FILE_PREFIX);
+
+    bsl::vector<bsl::string> files;
+    bdls::FilesystemUtil::findMatchingPaths(&files, pattern.c_str());
+
+    for (size_t i = 0; i < files.size(); ++i) {
+        const int rc = bdls::FilesystemUtil::remove(files[i]);
+        if (0 != rc) {
+            BALL_LOG_WARN << "Partition [" << partitionId << "]: Failed to "
+                          << "delete precreated file [" << files[i]
+                          << "], rc: " << rc;
+        }
+        else {
+            BALL_LOG_INFO << "Partition [" << partitionId << "]: Deleted "
+                          << "precreated file [" << files[i] << "]";
+        }
+    }
+}
+
 int FileStoreUtil::extractTimestamp(bsl::string*       timestamp,
                                     const bsl::string& filename)
 {
@@ -1061,6 +1228,49 @@ int FileStoreUtil::openFileSetWriteMode(bsl::ostream&         errorDescription,
     return rc_SUCCESS;
 }
 
+bool FileStoreUtil::shouldPrefaultMappings(const DataStoreConfig& config)
+{
+    return config.hasPrefaultPages() && 0 == config.residentWindowSize();
+}
+
+void FileStoreUtil::adviseFileSet(FileSet*               fileSet,
+                                  const DataStoreConfig& config)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(fileSet);
+
+    const bsls::Types::Uint64 window = config.residentWindowSize();
+    const bool prefaultWindow = config.hasPrefaultPages() && 0 != window;
+
+    FileSet::FileInfo* fileInfos[] = {&fileSet->d_data,
+                                      &fileSet->d_journal,
+                                      &fileSet->d_qlist};
+
+    for (size_t i = 0; i < sizeof(fileInfos) / sizeof(fileInfos[0]); ++i) {
+        FileSet::FileInfo& fileInfo = *fileInfos[i];
+        if (!fileInfo.d_file.isValid()) {
+            continue;  // CONTINUE
+        }
+
+        if (config.hasHugePages()) {
+            FileSystemUtil::enableHugePages(fileInfo.d_file.mapping(),
+                                            fileInfo.d_file.mappingSize());
+        }
+
+        if (prefaultWindow) {
+            const bsls::Types::Uint64 position = fileInfo.d_filePosition;
+            const bsls::Types::Uint64 end      = bsl::min(
+                position + window,
+                fileInfo.d_file.mappingSize());
+            if (position < end) {
+                FileSystemUtil::prefault(fileInfo.d_file,
+                                         position,
+                                         end - position);
+            }
+        }
+    }
+}
+
 int FileStoreUtil::validateFileSet(const MappedFileDescriptor& journalFd,
                                    const MappedFileDescriptor& dataFd,
                                    const MappedFileDescriptor& qlistFd)
@@ -1192,7 +1402,7 @@ int FileStoreUtil::openRecoveryFileSet(bsl::ostream&         errorDescription,
                                       journalFd,
                                       dataFd,
                                       qlistFd,
-                                      config.hasPrefaultPages());
+                                      shouldPrefaultMappings(config));
         }
 
         if (rc != 0) {
@@ -96,6 +96,18 @@ struct FileStoreUtil {
                                const bsl::vector<bsl::string>& files,
                                bool                            withSize);
 
+    /// Implement `create` and, if the specified `precreated` flag is true,
+    /// `precreate`, with the other arguments as documented there.
+    static int createImpl(bsl::ostream&            errorDescription,
+                          FileSetSp*               fileSetSp,
+                          FileStore*               fileStore,
+                          int                      partitionId,
+                          const DataStoreConfig&   dataStoreConfig,
+                          const bslstl::StringRef& partitionDesc,
+                          bool                     needQList,
+                          bool                     precreated,
+                          bslma::Allocator*        allocator);
+
   public:
     // CLASS METHODS
 
@@ -169,6 +181,45 @@ struct FileStoreUtil {
                       bool                     needQList,
                       bslma::Allocator*        allocator);
 
+    /// Create, open and populate the specified `fileSetSp` like `create`,
+    /// with the same arguments, except that the base names of the files are
+    /// prefixed so that the file set is not found by `findFileSets`, nor
+    /// hence by recovery.  The file set is meant to be created ahead of a
+    /// rollover, off the partition thread, and to become the active file
+    /// set of the partition at rollover after a call to
+    /// `activatePrecreated`.
+    static int precreate(bsl::ostream&            errorDescription,
+                         FileSetSp*               fileSetSp,
+                         FileStore*               fileStore,
+                         int                      partitionId,
+                         const DataStoreConfig&   dataStoreConfig,
+                         const bslstl::StringRef& partitionDesc,
+                         bool                     needQList,
+                         bslma::Allocator*        allocator);
+
+    /// Rename the files of the specified `fileSet`, previously created by
+    /// `precreate` for the specified `partitionId` at the specified
+    /// `location`, to the names `create` would have given them now, and
+    /// update the file names of `fileSet` accordingly.  The QLIST file is
+    /// renamed only if the specified `needQList` is true.  Return zero on
+    /// success, non-zero value otherwise along with populating the
+    /// specified `errorDescription` with a brief reason for logging
+    /// purposes, in which case the file names of `fileSet` still name the
+    /// files on disk.  Note that the JOURNAL file is renamed last, so that
+    /// an interrupted activation leaves an incomplete file set which is
+    /// ignored by recovery.
+    static int activatePrecreated(bsl::ostream&            errorDescription,
+                                  FileSet*                 fileSet,
+                                  int                      partitionId,
+                                  const bslstl::StringRef& location,
+                                  bool                     needQList);
+
+    /// Delete the files created by `precreate` for the specified
+    /// `partitionId` at the specified `location`, e.g. left over by a
+    /// previous instance of the broker.
+    static void deletePrecreatedFiles(int                      partitionId,
+                                      const bslstl::StringRef& location);
+
     /// Populate the specified `timestamp` with the `YYYYMMDD_HHMMSS`
     /// pattern extracted from the specified BlazingMQ `filename`.  Return
     /// zero on success, non-zero value otherwise.
@@ -268,6 +319,21 @@ struct FileStoreUtil {
                                     MappedFileDescriptor* qlistFd   = 0,
                                     bool prefaultPages              = false);
 
+    /// Return `true` if the whole mappings of the files of a partition
+    /// configured with the specified `config` should be prefaulted when they
+    /// are opened, and `false` otherwise.  Note that when a resident window
+    /// is configured, only the window ahead of the write position of the
+    /// files is prefaulted, by `adviseFileSet`.
+    static bool shouldPrefaultMappings(const DataStoreConfig& config);
+
+    /// Apply to the mappings of the valid files of the specified `fileSet`
+    /// the memory advice of the specified `config`: back them by huge pages
+    /// if configured, and prefault the resident window ahead of the current
+    /// position of each file if both a resident window and prefaulting are
+    /// configured.  The behavior is undefined unless the files of `fileSet`
+    /// were opened in write mode and their positions are set.
+    static void adviseFileSet(FileSet* fileSet, const DataStoreConfig& config);
+
     /// Validate the journal, qlist and data files represented by the
     /// specified `journalFd`, `qlistFd` and `dataFd` respectively.
     /// **Skip** validation of any file descriptor which is **invalid**.
@@ -150,9 +150,11 @@
 #include <bdlb_string.h>
 #include <bdls_filesystemutil.h>
 #include <bdls_pathutil.h>
+#include <bsl_algorithm.h>
 #include <bsl_ostream.h>
 #include <bsla_annotations.h>
 #include <bsls_assert.h>
+#include <bsls_memoryutil.h>
 #include <bsls_platform.h>
 
 // SYS
@@ -665,6 +667,324 @@ int FileSystemUtil::flush(void*               mapping,
     return rc_SUCCESS;
 }
 
+int FileSystemUtil::writeback(const MappedFileDescriptor& mfd,
+                              bsls::Types::Uint64         offset,
+                              bsls::Types::Uint64         length,
+                              bsl::ostream&               errorDescription)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(mfd.isValid());
+    BSLS_ASSERT_SAFE(offset + length <= mfd.mappingSize());
+
+    enum { rc_SUCCESS = 0, rc_SYSCALL_FAILURE = -1 };
+
+    if (0 == length) {
+        return rc_SUCCESS;  // RETURN
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    // 'SYNC_FILE_RANGE_WRITE' alone starts writeback of the dirty pages in
+    // the range which are not already under writeback, and returns without
+    // waiting for any of them.
+
+    int rc = ::sync_file_range(mfd.fd(),
+                               static_cast<off_t>(offset),
+                               static_cast<off_t>(length),
+                               SYNC_FILE_RANGE_WRITE);
+    if (0 != rc) {
+        errorDescription << "Failed to sync_file_range file with fd ["
+                         << mfd.fd() << "], offset: " << offset
+                         << ", length: " << length << ", rc: " << rc
+                         << ", errno: " << errno << " ["
+                         << bsl::strerror(errno) << "]";
+        return rc_SYSCALL_FAILURE;  // RETURN
+    }
+#else
+    // 'msync' requires a page-aligned address.
+
+    const bsls::Types::Uint64 pageSize = static_cast<bsls::Types::Uint64>(
+        bsls::MemoryUtil::pageSize());
+    const bsls::Types::Uint64 alignedOffset = (offset / pageSize) * pageSize;
+
+    int rc = ::msync(mfd.mapping() + alignedOffset,
+                     length + (offset - alignedOffset),
+                     MS_ASYNC);
+    if (0 != rc) {
+        errorDescription << "Failed to msync memory segment ["
+                         << static_cast<void*>(mfd.mapping() + alignedOffset)
+                         << "] of size [" << length + (offset - alignedOffset)
+                         << "] bytes, rc: " << rc << ", errno: " << errno
+                         << " [" << bsl::strerror(errno) << "]";
+        return rc_SYSCALL_FAILURE;  // RETURN
+    }
+#endif
+
+    return rc_SUCCESS;
+}
+
+int FileSystemUtil::release(
+    BSLA_MAYBE_UNUSED const MappedFileDescriptor& mfd,
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64         offset,
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64         length,
+    BSLA_MAYBE_UNUSED bsl::ostream&               errorDescription)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(mfd.isValid());
+    BSLS_ASSERT_SAFE(offset + length <= mfd.mappingSize());
+
+    enum { rc_SUCCESS = 0, rc_SYSCALL_FAILURE = -1 };
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    // Only release the pages entirely contained within the range, since the
+    // first and the last ones may hold bytes outside of it which are still
+    // being accessed.  'MADV_DONTNEED' on a shared file mapping only unmaps
+    // the pages from the process: their content stays in the page cache.
+
+    const bsls::Types::Uint64 pageSize = static_cast<bsls::Types::Uint64>(
+        bsls::MemoryUtil::pageSize());
+    const bsls::Types::Uint64 begin = ((offset + pageSize - 1) / pageSize) *
+                                      pageSize;
+    const bsls::Types::Uint64 end = ((offset + length) / pageSize) * pageSize;
+    if (end <= begin) {
+        return rc_SUCCESS;  // RETURN
+    }
+
+    int rc = ::madvise(mfd.mapping() + begin, end - begin, MADV_DONTNEED);
+    if (0 != rc) {
+        errorDescription << "Failed to madvise memory segment ["
+                         << static_cast<void*>(mfd.mapping() + begin)
+                         << "] of size [" << end - begin
+                         << "] bytes, rc: " << rc << ", errno: " << errno
+                         << " [" << bsl::strerror(errno) << "]";
+        return rc_SYSCALL_FAILURE;  // RETURN
+    }
+#endif
+
+    return rc_SUCCESS;
+}
+
+int FileSystemUtil::drop(
+    BSLA_MAYBE_UNUSED const MappedFileDescriptor& mfd,
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64         offset,
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64         length,
+    BSLA_MAYBE_UNUSED bsl::ostream&               errorDescription)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(mfd.isValid());
+    BSLS_ASSERT_SAFE(offset + length <= mfd.mappingSize());
+
+    enum { rc_SUCCESS = 0, rc_RELEASE_FAILURE = -1, rc_FADVISE_FAILURE = -2 };
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    // 'POSIX_FADV_DONTNEED' does not drop the pages which are mapped, so they
+    // are first released from the mapping.  Both round the range inwards to
+    // entire pages.
+
+    int rc = release(mfd, offset, length, errorDescription);
+    if (0 != rc) {
+        return rc_RELEASE_FAILURE;  // RETURN
+    }
+
+    const bsls::Types::Uint64 pageSize = static_cast<bsls::Types::Uint64>(
+        bsls::MemoryUtil::pageSize());
+    const bsls::Types::Uint64 begin = ((offset + pageSize - 1) / pageSize) *
+                                      pageSize;
+    const bsls::Types::Uint64 end = ((offset + length) / pageSize) * pageSize;
+    if (end <= begin) {
+        return rc_SUCCESS;  // RETURN
+    }
+
+    // 'posix_fadvise' returns the error number instead of setting 'errno'.
+
+    rc = ::posix_fadvise(mfd.fd(),
+                         static_cast<off_t>(begin),
+                         static_cast<off_t>(end - begin),
+                         POSIX_FADV_DONTNEED);
+    if (0 != rc) {
+        errorDescription << "Failed to posix_fadvise file with fd ["
+                         << mfd.fd() << "], offset: " << begin
+                         << ", length: " << end - begin << ", rc: " << rc
+                         << " [" << bsl::strerror(rc) << "]";
+        return rc_FADVISE_FAILURE;  // RETURN
+    }
+#endif
+
+    return rc_SUCCESS;
+}
+
+void FileSystemUtil::prefault(const MappedFileDescriptor& mfd,
+                              bsls::Types::Uint64         offset,
+                              bsls::Types::Uint64         length)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(mfd.isValid());
+    BSLS_ASSERT_SAFE(offset + length <= mfd.mappingSize());
+
+    if (0 == length) {
+        return;  // RETURN
+    }
+
+    // 'madvise' requires a page-aligned address.
+
+    const bsls::Types::Uint64 pageSize = static_cast<bsls::Types::Uint64>(
+        bsls::MemoryUtil::pageSize());
+    const bsls::Types::Uint64 alignedOffset = (offset / pageSize) * pageSize;
+
+    madvise(mfd.mapping() + alignedOffset,
+            length + (offset - alignedOffset),
+            MADV_WILLNEED);
+}
+
+bool FileSystemUtil::hasResidentPages(const MappedFileDescriptor& mfd,
+                                      bsls::Types::Uint64         offset,
+                                      bsls::Types::Uint64         length)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(mfd.isValid());
+    BSLS_ASSERT_SAFE(offset + length <= mfd.mappingSize());
+
+    if (0 == length) {
+        return false;  // RETURN
+    }
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    // 'mincore' requires a page-aligned address.  Query the pages by groups
+    // of 'k_NUM_PAGES', so that no memory needs to be allocated.
+
+    enum { k_NUM_PAGES = 64 };
+
+    const bsls::Types::Uint64 pageSize = static_cast<bsls::Types::Uint64>(
+        bsls::MemoryUtil::pageSize());
+    const bsls::Types::Uint64 end   = offset + length;
+    bsls::Types::Uint64       begin = (offset / pageSize) * pageSize;
+    unsigned char             residency[k_NUM_PAGES];
+
+    while (begin < end) {
+        const bsls::Types::Uint64 size = bsl::min(end - begin,
+                                                  k_NUM_PAGES * pageSize);
+        if (0 != ::mincore(mfd.mapping() + begin, size, residency)) {
+            // Err on the side of considering the pages resident, so that the
+            // caller does not evict them.
+
+            return true;  // RETURN
+        }
+
+        const bsls::Types::Uint64 numPages = (size + pageSize - 1) / pageSize;
+        for (bsls::Types::Uint64 i = 0; i < numPages; ++i) {
+            if (residency[i] & 1) {
+                return true;  // RETURN
+            }
+        }
+
+        begin += size;
+    }
+
+    return false;
+#else
+    return true;
+#endif
+}
+
+int FileSystemUtil::evict(
+    BSLA_MAYBE_UNUSED const MappedFileDescriptor& mfd,
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64         offset,
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64         length,
+    BSLA_MAYBE_UNUSED bsl::ostream&               errorDescription)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(mfd.isValid());
+    BSLS_ASSERT_SAFE(offset + length <= mfd.mappingSize());
+
+    enum { rc_SUCCESS = 0, rc_MADVISE_FAILURE = -1, rc_FADVISE_FAILURE = -2 };
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+    // The pages must first be unmapped from the process, since
+    // 'POSIX_FADV_DONTNEED' does not drop the pages which are mapped.  Unlike
+    // 'release', the first and the last pages are included, since the caller
+    // only evicts the pages it faulted in itself.
+
+    const bsls::Types::Uint64 pageSize = static_cast<bsls::Types::Uint64>(
+        bsls::MemoryUtil::pageSize());
+    const bsls::Types::Uint64 begin = (offset / pageSize) * pageSize;
+    const bsls::Types::Uint64 end   = bsl::min(
+        ((offset + length + pageSize - 1) / pageSize) * pageSize,
+        mfd.mappingSize());
+    if (end <= begin) {
+        return rc_SUCCESS;  // RETURN
+    }
+
+    int rc = ::madvise(mfd.mapping() + begin, end - begin, MADV_DONTNEED);
+    if (0 != rc) {
+        errorDescription << "Failed to madvise memory segment ["
+                         << static_cast<void*>(mfd.mapping() + begin)
+                         << "] of size [" << end - begin
+                         << "] bytes, rc: " << rc << ", errno: " << errno
+                         << " [" << bsl::strerror(errno) << "]";
+        return rc_MADVISE_FAILURE;  // RETURN
+    }
+
+    // 'posix_fadvise' returns the error number instead of setting 'errno'.
+
+    rc = ::posix_fadvise(mfd.fd(),
+                         static_cast<off_t>(begin),
+                         static_cast<off_t>(end - begin),
+                         POSIX_FADV_DONTNEED);
+    if (0 != rc) {
+        errorDescription << "Failed to posix_fadvise file with fd ["
+                         << mfd.fd() << "], offset: " << begin
+                         << ", length: " << end - begin << ", rc: " << rc
+                         << " [" << bsl::strerror(rc) << "]";
+        return rc_FADVISE_FAILURE;  // RETURN
+    }
+#endif
+
+    return rc_SUCCESS;
+}
+
+void FileSystemUtil::copy(MappedFileDescriptor*       to,
+                          bsls::Types::Uint64         toOffset,
+                          const MappedFileDescriptor& from,
+                          bsls::Types::Uint64         fromOffset,
+                          bsls::Types::Uint64         length)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(to && to->isValid());
+    BSLS_ASSERT_SAFE(from.isValid());
+    BSLS_ASSERT_SAFE(toOffset + length <= to->mappingSize());
+    BSLS_ASSERT_SAFE(fromOffset + length <= from.mappingSize());
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(__GLIBC__) &&                  \
+    (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 27))
+    // Both files are mapped shared, so that the bytes written to the page
+    // cache by 'copy_file_range' are visible through the mapping of 'to'.
+    // Stop at the first failure (e.g. a file system not supporting it) and
+    // copy what remains through the mappings.
+
+    loff_t fromPos = static_cast<loff_t>(fromOffset);
+    loff_t toPos   = static_cast<loff_t>(toOffset);
+    while (0 < length) {
+        const ssize_t rc = ::copy_file_range(from.fd(),
+                                             &fromPos,
+                                             to->fd(),
+                                             &toPos,
+                                             length,
+                                             0);
+        if (0 >= rc) {
+            break;  // BREAK
+        }
+        length -= static_cast<bsls::Types::Uint64>(rc);
+    }
+    fromOffset = static_cast<bsls::Types::Uint64>(fromPos);
+    toOffset   = static_cast<bsls::Types::Uint64>(toPos);
+#endif
+
+    if (0 < length) {
+        bsl::memcpy(to->mapping() + toOffset,
+                    from.mapping() + fromOffset,
+                    length);
+    }
+}
+
 void FileSystemUtil::disableDump(BSLA_MAYBE_UNUSED void* mapping,
                                  BSLA_MAYBE_UNUSED bsls::Types::Uint64 size)
 {
@@ -682,5 +1002,17 @@ void FileSystemUtil::disableDump(BSLA_MAYBE_UNUSED void* mapping,
 #endif
 }
 
+void FileSystemUtil::enableHugePages(
+    BSLA_MAYBE_UNUSED void*               mapping,
+    BSLA_MAYBE_UNUSED bsls::Types::Uint64 size)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(mapping);
+
+#if defined(BSLS_PLATFORM_OS_LINUX) && defined(MADV_HUGEPAGE)
+    madvise(mapping, size, MADV_HUGEPAGE);
+#endif
+}
+
 }  // close package namespace
 }  // close enterprise namespace
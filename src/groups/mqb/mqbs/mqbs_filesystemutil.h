@@ -151,10 +151,109 @@ struct FileSystemUtil {
                      bsls::Types::Uint64 size,
                      bsl::ostream&       errorDescription);
 
+    /// Initiate the asynchronous writeback to disk of the specified
+    /// `length` bytes starting at the specified `offset` in the file
+    /// represented by the specified `mfd`, without waiting for the writeback
+    /// to complete.  Return zero on success, a non-zero value otherwise with
+    /// the specified `errorDescription` containing a detailed error.  Note
+    /// that on Linux this method uses `sync_file_range`, which does not
+    /// wait for pages already under writeback, and `msync(MS_ASYNC)` on
+    /// other platforms.  Note also that this method provides no durability
+    /// guarantee; it only prevents dirty pages from accumulating in the page
+    /// cache until the OS throttles the writing thread.
+    static int writeback(const MappedFileDescriptor& mfd,
+                         bsls::Types::Uint64         offset,
+                         bsls::Types::Uint64         length,
+                         bsl::ostream&               errorDescription);
+
+    /// Drop from the mapping of the file represented by the specified `mfd`
+    /// the pages entirely contained within the specified `length` bytes
+    /// starting at the specified `offset`, so that they no longer count
+    /// towards the resident memory of the process.  Return zero on success,
+    /// a non-zero value otherwise with the specified `errorDescription`
+    /// containing a detailed error.  The content of the file is unaffected:
+    /// dirty pages remain in the page cache until written back, and a later
+    /// access to the range faults the pages back in.  Note that this method
+    /// only has effect on Linux, where it uses `madvise(MADV_DONTNEED)`.
+    static int release(const MappedFileDescriptor& mfd,
+                       bsls::Types::Uint64         offset,
+                       bsls::Types::Uint64         length,
+                       bsl::ostream&               errorDescription);
+
+    /// Drop from the mapping of the file represented by the specified `mfd`,
+    /// and from the page cache, the pages entirely contained within the
+    /// specified `length` bytes starting at the specified `offset`, so that
+    /// the memory they use is left to other files.  Return zero on success,
+    /// a non-zero value otherwise with the specified `errorDescription`
+    /// containing a detailed error.  The content of the file is unaffected:
+    /// dirty pages remain in the page cache until written back, and a later
+    /// access to the range reads the pages back.  Note that this method only
+    /// has effect on Linux, where it uses `release` followed by
+    /// `posix_fadvise(POSIX_FADV_DONTNEED)`.
+    static int drop(const MappedFileDescriptor& mfd,
+                    bsls::Types::Uint64         offset,
+                    bsls::Types::Uint64         length,
+                    bsl::ostream&               errorDescription);
+
+    /// Indicate to the OS that the pages spanning the specified `length`
+    /// bytes starting at the specified `offset` in the mapping of the file
+    /// represented by the specified `mfd` will be accessed soon, so that
+    /// they are read ahead asynchronously.
+    static void prefault(const MappedFileDescriptor& mfd,
+                         bsls::Types::Uint64         offset,
+                         bsls::Types::Uint64         length);
+
+    /// Return `true` if any of the pages spanning the specified `length`
+    /// bytes starting at the specified `offset` in the mapping of the file
+    /// represented by the specified `mfd` is resident in memory, and `false`
+    /// otherwise.  Note that this method uses `mincore` on Linux, and always
+    /// returns `true` on other platforms.
+    static bool hasResidentPages(const MappedFileDescriptor& mfd,
+                                 bsls::Types::Uint64         offset,
+                                 bsls::Types::Uint64         length);
+
+    /// Drop from the mapping of the file represented by the specified `mfd`,
+    /// and from the page cache, the pages spanning the specified `length`
+    /// bytes starting at the specified `offset`, so that reading them once
+    /// does not evict pages more likely to be accessed again.  Return zero
+    /// on success, a non-zero value otherwise with the specified
+    /// `errorDescription` containing a detailed error.  The content of the
+    /// file is unaffected: only clean pages are dropped from the page cache,
+    /// and a later access to the range reads them back.  Note that this
+    /// method only has effect on Linux, where it uses
+    /// `madvise(MADV_DONTNEED)` followed by
+    /// `posix_fadvise(POSIX_FADV_DONTNEED)`.
+    static int evict(const MappedFileDescriptor& mfd,
+                     bsls::Types::Uint64         offset,
+                     bsls::Types::Uint64         length,
+                     bsl::ostream&               errorDescription);
+
+    /// Copy the specified `length` bytes starting at the specified
+    /// `fromOffset` in the file represented by the specified `from` to the
+    /// specified `toOffset` in the file represented by the specified `to`.
+    /// The behavior is undefined unless both ranges are within the mapping
+    /// of their file.  Note that on Linux this method uses
+    /// `copy_file_range`, which copies within the kernel without faulting
+    /// the pages of either mapping in, and may share the extents on file
+    /// systems supporting it; the bytes which it does not copy, and all of
+    /// them on other platforms, are copied through the mappings.
+    static void copy(MappedFileDescriptor*       to,
+                     bsls::Types::Uint64         toOffset,
+                     const MappedFileDescriptor& from,
+                     bsls::Types::Uint64         fromOffset,
+                     bsls::Types::Uint64         length);
+
     /// Indicate to the OS not to dump the specified `mapping` of the
     /// specified `size` to file.  Note that this method only has effect if
     /// on Linux and the `MADV_DONTDUMP` flag is defined.
     static void disableDump(void* mapping, bsls::Types::Uint64 size);
+
+    /// Indicate to the OS that the specified `mapping` of the specified
+    /// `size` should be backed by transparent huge pages.  Note that this
+    /// method only has effect on Linux if the `MADV_HUGEPAGE` flag is
+    /// defined, and for file-backed mappings only on kernels and file
+    /// systems supporting huge pages in the page cache.
+    static void enableHugePages(void* mapping, bsls::Types::Uint64 size);
 };
 
 }  // close package namespace
@@ -0,0 +1,546 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbs_filesystemutil.h>
+
+// MQB
+#include <mqbs_mappedfiledescriptor.h>
+
+// BMQ
+#include <bmqu_memoutstream.h>
+#include <bmqu_printutil.h>
+#include <bmqu_tempdirectory.h>
+
+// BDE
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsla_annotations.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// BENCHMARKING LIBRARY
+#ifdef BMQTST_BENCHMARK_ENABLED
+#include <benchmark/benchmark.h>
+#endif
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Create, in the specified `directory`, a file with the specified
+/// `fileName` of the specified `fileSize` bytes, and load its mapping into
+/// the specified `mfd`.
+static void openFile(mqbs::MappedFileDescriptor* mfd,
+                     const bmqu::TempDirectory&  directory,
+                     const char*                 fileName,
+                     bsls::Types::Uint64         fileSize)
+{
+    bsl::string path(directory.path(), bmqtst::TestHelperUtil::allocator());
+    path.append("/").append(fileName);
+
+    bmqu::MemOutStream errorDesc(bmqtst::TestHelperUtil::allocator());
+
+    int rc = mqbs::FileSystemUtil::open(mfd,
+                                        path.c_str(),
+                                        fileSize,
+                                        false,  // readOnly
+                                        errorDesc);
+    BSLS_ASSERT_OPT(rc == 0);
+
+    rc = mqbs::FileSystemUtil::grow(mfd,
+                                    false,  // reserveOnDisk
+                                    errorDesc);
+    BSLS_ASSERT_OPT(rc == 0);
+}
+
+/// Append records of the specified `recordSize` bytes to a file of the
+/// specified `fileSize` bytes, in batches of the specified `batchSize`
+/// records, until the file is full.  After each batch, initiate writeback of
+/// the bytes appended since the last writeback if they are at least the
+/// specified `writebackThreshold` bytes, the same way `mqbs::FileStore` does
+/// at the end of each batch of replicated records.  A `writebackThreshold`
+/// of 0 leaves the writeback to the OS.  Load the elapsed time into the
+/// specified `totalTime`, and the time of the slowest batch into the
+/// specified `maxBatchTime`, both in nanoseconds.
+static void writeFile(bsls::Types::Int64* totalTime,
+                      bsls::Types::Int64* maxBatchTime,
+                      bsls::Types::Uint64 fileSize,
+                      int                 recordSize,
+                      int                 batchSize,
+                      bsls::Types::Uint64 writebackThreshold)
+{
+    bmqu::TempDirectory        tempDir(bmqtst::TestHelperUtil::allocator());
+    mqbs::MappedFileDescriptor mfd;
+    openFile(&mfd, tempDir, "data", fileSize);
+
+    bsl::string record(recordSize, 'x', bmqtst::TestHelperUtil::allocator());
+    bmqu::MemOutStream  errorDesc(bmqtst::TestHelperUtil::allocator());
+    bsls::Types::Uint64 position          = 0;
+    bsls::Types::Uint64 writebackPosition = 0;
+
+    *maxBatchTime = 0;
+
+    const bsls::Types::Int64 begin = bsls::TimeUtil::getTimer();
+    while (position + batchSize * recordSize <= fileSize) {
+        const bsls::Types::Int64 batchBegin = bsls::TimeUtil::getTimer();
+
+        for (int i = 0; i < batchSize; ++i) {
+            bsl::memcpy(mfd.mapping() + position, record.data(), recordSize);
+            position += recordSize;
+        }
+
+        if (writebackThreshold != 0 &&
+            position >= writebackPosition + writebackThreshold) {
+            BSLS_ASSERT_OPT(0 == mqbs::FileSystemUtil::writeback(
+                                     mfd,
+                                     writebackPosition,
+                                     position - writebackPosition,
+                                     errorDesc));
+            writebackPosition = position;
+        }
+
+        *maxBatchTime = bsl::max(*maxBatchTime,
+                                 bsls::TimeUtil::getTimer() - batchBegin);
+    }
+    *totalTime = bsls::TimeUtil::getTimer() - begin;
+
+    mqbs::FileSystemUtil::close(&mfd);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Testing:
+//   Basic functionality of opening, growing, writing to and closing a
+//   mapped file.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    const bsls::Types::Uint64 k_FILE_SIZE = 64 * 1024;
+
+    bmqu::TempDirectory        tempDir(bmqtst::TestHelperUtil::allocator());
+    mqbs::MappedFileDescriptor mfd;
+    openFile(&mfd, tempDir, "file", k_FILE_SIZE);
+
+    BMQTST_ASSERT(mfd.isValid());
+    BMQTST_ASSERT_EQ(mfd.fileSize(), k_FILE_SIZE);
+    BMQTST_ASSERT_GE(mfd.mappingSize(), k_FILE_SIZE);
+
+    bsl::memset(mfd.mapping(), 'a', k_FILE_SIZE);
+
+    bmqu::MemOutStream errorDesc(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(
+        mqbs::FileSystemUtil::flush(mfd.mapping(), k_FILE_SIZE, errorDesc),
+        0);
+
+    BMQTST_ASSERT_EQ(mqbs::FileSystemUtil::close(&mfd), 0);
+    BMQTST_ASSERT(!mfd.isValid());
+}
+
+static void test2_writeback()
+// ------------------------------------------------------------------------
+// WRITEBACK
+//
+// Concerns:
+//   1. 'writeback' succeeds for an empty range.
+//   2. 'writeback' succeeds for ranges that are not page aligned.
+//   3. 'writeback' succeeds for the entire file.
+//   4. The content written through the mapping is unaffected.
+//
+// Testing:
+//   writeback
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("WRITEBACK");
+
+    const bsls::Types::Uint64 k_FILE_SIZE = 64 * 1024;
+
+    bmqu::TempDirectory        tempDir(bmqtst::TestHelperUtil::allocator());
+    mqbs::MappedFileDescriptor mfd;
+    openFile(&mfd, tempDir, "file", k_FILE_SIZE);
+
+    bmqu::MemOutStream errorDesc(bmqtst::TestHelperUtil::allocator());
+
+    // 1. Empty range
+    BMQTST_ASSERT_EQ(mqbs::FileSystemUtil::writeback(mfd, 0, 0, errorDesc), 0);
+    BMQTST_ASSERT_EQ(
+        mqbs::FileSystemUtil::writeback(mfd, k_FILE_SIZE, 0, errorDesc),
+        0);
+
+    // 2. Unaligned ranges
+    bsl::memset(mfd.mapping(), 'a', 1000);
+    BMQTST_ASSERT_EQ(mqbs::FileSystemUtil::writeback(mfd, 0, 1000, errorDesc),
+                     0);
+
+    bsl::memset(mfd.mapping() + 1000, 'b', 10000);
+    BMQTST_ASSERT_EQ(
+        mqbs::FileSystemUtil::writeback(mfd, 1000, 10000, errorDesc),
+        0);
+
+    // 3. Entire file
+    bsl::memset(mfd.mapping() + 11000, 'c', k_FILE_SIZE - 11000);
+    BMQTST_ASSERT_EQ(
+        mqbs::FileSystemUtil::writeback(mfd, 0, k_FILE_SIZE, errorDesc),
+        0);
+    PVV(errorDesc.str());
+    BMQTST_ASSERT(errorDesc.isEmpty());
+
+    // 4. Content
+    BMQTST_ASSERT_EQ(mfd.mapping()[0], 'a');
+    BMQTST_ASSERT_EQ(mfd.mapping()[999], 'a');
+    BMQTST_ASSERT_EQ(mfd.mapping()[1000], 'b');
+    BMQTST_ASSERT_EQ(mfd.mapping()[10999], 'b');
+    BMQTST_ASSERT_EQ(mfd.mapping()[11000], 'c');
+    BMQTST_ASSERT_EQ(mfd.mapping()[k_FILE_SIZE - 1], 'c');
+
+    BMQTST_ASSERT_EQ(mqbs::FileSystemUtil::close(&mfd), 0);
+}
+
+static void test3_release()
+// ------------------------------------------------------------------------
+// RELEASE
+//
+// Concerns:
+//   1. 'release' succeeds for an empty range, and for a range which does
+//      not contain any entire page.
+//   2. 'release' succeeds for ranges that are not page aligned.
+//   3. The content written through the mapping is unaffected by 'release',
+//      including in the released pages, and by 'prefault'.
+//
+// Testing:
+//   release
+//   prefault
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("RELEASE");
+
+    const bsls::Types::Uint64 k_FILE_SIZE = 64 * 1024;
+
+    bmqu::TempDirectory        tempDir(bmqtst::TestHelperUtil::allocator());
+    mqbs::MappedFileDescriptor mfd;
+    openFile(&mfd, tempDir, "file", k_FILE_SIZE);
+
+    bmqu::MemOutStream errorDesc(bmqtst::TestHelperUtil::allocator());
+
+    for (bsls::Types::Uint64 i = 0; i < k_FILE_SIZE; ++i) {
+        mfd.mapping()[i] = static_cast<char>('a' + i % 26);
+    }
+
+    // 1. Empty range, and range within a single page
+    BMQTST_ASSERT_EQ(mqbs::FileSystemUtil::release(mfd, 0, 0, errorDesc), 0);
+    BMQTST_ASSERT_EQ(mqbs::FileSystemUtil::release(mfd, 1, 100, errorDesc),
+                     0);
+
+    // 2. Unaligned ranges
+    BMQTST_ASSERT_EQ(
+        mqbs::FileSystemUtil::release(mfd, 1000, 10000, errorDesc),
+        0);
+    BMQTST_ASSERT_EQ(
+        mqbs::FileSystemUtil::release(mfd,
+                                      11000,
+                                      k_FILE_SIZE - 11000,
+                                      errorDesc),
+        0);
+    PVV(errorDesc.str());
+    BMQTST_ASSERT(errorDesc.isEmpty());
+
+    mqbs::FileSystemUtil::prefault(mfd, 1000, k_FILE_SIZE - 1000);
+
+    // 3. Content
+    for (bsls::Types::Uint64 i = 0; i < k_FILE_SIZE; ++i) {
+        BMQTST_ASSERT_EQ_D(i,
+                           mfd.mapping()[i],
+                           static_cast<char>('a' + i % 26));
+    }
+
+    BMQTST_ASSERT_EQ(mqbs::FileSystemUtil::close(&mfd), 0);
+}
+
+static void test4_copy()
+// ------------------------------------------------------------------------
+// COPY
+//
+// Concerns:
+//   1. 'copy' of an empty range leaves the target file unchanged.
+//   2. The bytes copied from the source file are visible through the
+//      mapping of the target file, for ranges that are not page aligned.
+//   3. The bytes of the target file outside of the range are unchanged.
+//
+// Testing:
+//   copy
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("COPY");
+
+    const bsls::Types::Uint64 k_FILE_SIZE   = 64 * 1024;
+    const bsls::Types::Uint64 k_FROM_OFFSET = 1000;
+    const bsls::Types::Uint64 k_TO_OFFSET   = 3000;
+    const bsls::Types::Uint64 k_LENGTH      = 40000;
+
+    bmqu::TempDirectory        tempDir(bmqtst::TestHelperUtil::allocator());
+    mqbs::MappedFileDescriptor from;
+    mqbs::MappedFileDescriptor to;
+    openFile(&from, tempDir, "from", k_FILE_SIZE);
+    openFile(&to, tempDir, "to", k_FILE_SIZE);
+
+    for (bsls::Types::Uint64 i = 0; i < k_FILE_SIZE; ++i) {
+        from.mapping()[i] = static_cast<char>('a' + i % 26);
+        to.mapping()[i]   = 'x';
+    }
+
+    // 1. Empty range
+    mqbs::FileSystemUtil::copy(&to, k_TO_OFFSET, from, k_FROM_OFFSET, 0);
+    for (bsls::Types::Uint64 i = 0; i < k_FILE_SIZE; ++i) {
+        BMQTST_ASSERT_EQ_D(i, to.mapping()[i], 'x');
+    }
+
+    // 2. Unaligned range
+    mqbs::FileSystemUtil::copy(&to,
+                               k_TO_OFFSET,
+                               from,
+                               k_FROM_OFFSET,
+                               k_LENGTH);
+    for (bsls::Types::Uint64 i = 0; i < k_LENGTH; ++i) {
+        BMQTST_ASSERT_EQ_D(i,
+                           to.mapping()[k_TO_OFFSET + i],
+                           from.mapping()[k_FROM_OFFSET + i]);
+    }
+
+    // 3. Outside of the range
+    for (bsls::Types::Uint64 i = 0; i < k_TO_OFFSET; ++i) {
+        BMQTST_ASSERT_EQ_D(i, to.mapping()[i], 'x');
+    }
+    for (bsls::Types::Uint64 i = k_TO_OFFSET + k_LENGTH; i < k_FILE_SIZE;
+         ++i) {
+        BMQTST_ASSERT_EQ_D(i, to.mapping()[i], 'x');
+    }
+
+    BMQTST_ASSERT_EQ(mqbs::FileSystemUtil::close(&to), 0);
+    BMQTST_ASSERT_EQ(mqbs::FileSystemUtil::close(&from), 0);
+}
+
+static void test5_evict()
+// ------------------------------------------------------------------------
+// EVICT
+//
+// Concerns:
+//   1. The pages written through the mapping are resident, and an empty
+//      range has no resident pages.
+//   2. 'evict' and 'drop' succeed for an empty range, and for ranges that
+//      are not page aligned, up to the end of the mapping.
+//   3. The content written through the mapping is unaffected by 'evict'
+//      and 'drop', once written back to the file.
+//
+// Testing:
+//   hasResidentPages
+//   evict
+//   drop
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("EVICT");
+
+    const bsls::Types::Uint64 k_FILE_SIZE = 64 * 1024;
+
+    bmqu::TempDirectory        tempDir(bmqtst::TestHelperUtil::allocator());
+    mqbs::MappedFileDescriptor mfd;
+    openFile(&mfd, tempDir, "file", k_FILE_SIZE);
+
+    bmqu::MemOutStream errorDesc(bmqtst::TestHelperUtil::allocator());
+
+    for (bsls::Types::Uint64 i = 0; i < k_FILE_SIZE; ++i) {
+        mfd.mapping()[i] = static_cast<char>('a' + i % 26);
+    }
+
+    // 1. Residency
+    BMQTST_ASSERT(mqbs::FileSystemUtil::hasResidentPages(mfd, 0, k_FILE_SIZE));
+    BMQTST_ASSERT(mqbs::FileSystemUtil::hasResidentPages(mfd, 1000, 10));
+    BMQTST_ASSERT(!mqbs::FileSystemUtil::hasResidentPages(mfd, 1000, 0));
+
+    BMQTST_ASSERT_EQ(
+        mqbs::FileSystemUtil::flush(mfd.mapping(), k_FILE_SIZE, errorDesc),
+        0);
+
+    // 2. Empty and unaligned ranges
+    BMQTST_ASSERT_EQ(mqbs::FileSystemUtil::evict(mfd, 0, 0, errorDesc), 0);
+    BMQTST_ASSERT_EQ(mqbs::FileSystemUtil::evict(mfd, 1, 100, errorDesc), 0);
+    BMQTST_ASSERT_EQ(
+        mqbs::FileSystemUtil::evict(mfd, 1000, k_FILE_SIZE - 1000, errorDesc),
+        0);
+    BMQTST_ASSERT_EQ(mqbs::FileSystemUtil::drop(mfd, 0, 0, errorDesc), 0);
+    BMQTST_ASSERT_EQ(mqbs::FileSystemUtil::drop(mfd, 1, 100, errorDesc), 0);
+    BMQTST_ASSERT_EQ(
+        mqbs::FileSystemUtil::drop(mfd, 1000, k_FILE_SIZE - 1000, errorDesc),
+        0);
+    PVV(errorDesc.str());
+    BMQTST_ASSERT(errorDesc.isEmpty());
+
+    // 3. Content
+    for (bsls::Types::Uint64 i = 0; i < k_FILE_SIZE; ++i) {
+        BMQTST_ASSERT_EQ_D(i,
+                           mfd.mapping()[i],
+                           static_cast<char>('a' + i % 26));
+    }
+
+    BMQTST_ASSERT_EQ(mqbs::FileSystemUtil::close(&mfd), 0);
+}
+
+// ============================================================================
+//                              PERFORMANCE TESTS
+// ----------------------------------------------------------------------------
+
+BSLA_MAYBE_UNUSED
+static void testN1_writebackPerformance()
+// ------------------------------------------------------------------------
+// WRITEBACK PERFORMANCE
+//
+// Concerns:
+//   Compare the throughput and the worst batch latency of appending records
+//   to a memory-mapped file when writeback is left to the OS, and when
+//   writeback is initiated asynchronously every so many bytes.
+//
+// Plan:
+//   - Append 1KB records in batches of 64 to a 1GB file located in the
+//     temporary directory, with several writeback thresholds.  Point
+//     'TMPDIR' to the storage under test to benchmark it.
+//
+// Testing:
+//   Performance of 'writeback'.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("WRITEBACK PERFORMANCE");
+
+    const bsls::Types::Uint64 k_FILE_SIZE   = 1024 * 1024 * 1024;
+    const int                 k_RECORD_SIZE = 1024;
+    const int                 k_BATCH_SIZE  = 64;
+
+    const bsls::Types::Uint64 k_THRESHOLDS[] = {0,
+                                                256 * 1024,
+                                                1024 * 1024,
+                                                4 * 1024 * 1024,
+                                                16 * 1024 * 1024};
+
+    for (size_t i = 0; i < sizeof(k_THRESHOLDS) / sizeof(k_THRESHOLDS[0]);
+         ++i) {
+        bsls::Types::Int64 totalTime    = 0;
+        bsls::Types::Int64 maxBatchTime = 0;
+        writeFile(&totalTime,
+                  &maxBatchTime,
+                  k_FILE_SIZE,
+                  k_RECORD_SIZE,
+                  k_BATCH_SIZE,
+                  k_THRESHOLDS[i]);
+
+        cout << "Writeback threshold "
+             << bmqu::PrintUtil::prettyBytes(
+                    static_cast<bsls::Types::Int64>(k_THRESHOLDS[i]))
+             << ": wrote "
+             << bmqu::PrintUtil::prettyBytes(
+                    static_cast<bsls::Types::Int64>(k_FILE_SIZE))
+             << " in " << bmqu::PrintUtil::prettyTimeInterval(totalTime)
+             << ", slowest batch: "
+             << bmqu::PrintUtil::prettyTimeInterval(maxBatchTime) << endl;
+    }
+}
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+static void
+testN1_writebackPerformance_GoogleBenchmark(benchmark::State& state)
+// ------------------------------------------------------------------------
+// GOOGLE BENCHMARK WRITEBACK PERFORMANCE
+//
+// Concerns:
+//   Same as 'testN1_writebackPerformance', with the writeback threshold,
+//   in KB, as the benchmark argument.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("GOOGLE BENCHMARK WRITEBACK "
+                                      "PERFORMANCE");
+
+    const bsls::Types::Uint64 k_FILE_SIZE   = 256 * 1024 * 1024;
+    const int                 k_RECORD_SIZE = 1024;
+    const int                 k_BATCH_SIZE  = 64;
+
+    bsls::Types::Int64 maxBatchTime = 0;
+    for (auto _ : state) {
+        bsls::Types::Int64 totalTime = 0;
+        writeFile(&totalTime,
+                  &maxBatchTime,
+                  k_FILE_SIZE,
+                  k_RECORD_SIZE,
+                  k_BATCH_SIZE,
+                  static_cast<bsls::Types::Uint64>(state.range(0)) * 1024);
+    }
+    state.counters["maxBatchNs"] = static_cast<double>(maxBatchTime);
+}
+#endif  // BMQTST_BENCHMARK_ENABLED
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 5: test5_evict(); break;
+    case 4: test4_copy(); break;
+    case 3: test3_release(); break;
+    case 2: test2_writeback(); break;
+    case 1: test1_breathingTest(); break;
+    case -1:
+        BMQTST_BENCHMARK_WITH_ARGS(testN1_writebackPerformance,
+                                   Arg(0)
+                                       ->Arg(256)
+                                       ->Arg(1024)
+                                       ->Arg(4096)
+                                       ->Arg(16384)
+                                       ->Unit(benchmark::kMillisecond));
+        break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+#ifdef BMQTST_BENCHMARK_ENABLED
+    if (_testCase < 0) {
+        benchmark::Initialize(&argc, argv);
+        benchmark::RunSpecifiedBenchmarks();
+    }
+#endif
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
@@ -337,8 +337,10 @@ InMemoryStorage::releaseRef(const bmqt::MessageGUID& guid, bool asPrimary)
             // any virtual storage apart from the one associated with the
             // specified 'appKey' (because updated outstanding refCount is
             // zero).  So we just delete the guid from the underlying (this)
-            // storage.
+            // storage.  Release the payload right away, as only the GUID is
+            // needed while the item is kept as history for deduplication.
 
+            it->second.reset();
             d_items.erase(it);
 
             d_virtualStorageCatalog.stats()
@@ -365,6 +367,8 @@ InMemoryStorage::remove(const bmqt::MessageGUID& msgGUID, int* msgSize)
 
     int msgLen = it->second.appData()->length();
 
+    // Only the GUID is needed in the history
+    it->second.reset();
     d_items.erase(it);
 
     // Update resource usage
@@ -387,6 +391,41 @@ InMemoryStorage::remove(const bmqt::MessageGUID& msgGUID, int* msgSize)
     return mqbi::StorageResult::e_SUCCESS;
 }
 
+mqbi::StorageResult::Enum
+InMemoryStorage::gcMessage(const bmqt::MessageGUID& msgGUID)
+{
+    // executed by the *QUEUE DISPATCHER* thread
+
+    ItemsMapIter it = d_items.find(msgGUID);
+    if (it == d_items.end()) {
+        return mqbi::StorageResult::e_GUID_NOT_FOUND;  // RETURN
+    }
+
+    int msgLen = it->second.appData()->length();
+    d_capacityMeter.remove(1, msgLen);
+    if (queue()) {
+        queue()->queueEngine()->beforeMessageRemoved(msgGUID);
+    }
+    d_virtualStorageCatalog.stats()
+        ->onEvent<mqbstat::QueueStatsDomain::EventType::e_DEL_MESSAGE>(msgLen);
+
+    // Remove message from all virtual storages, updating the counters of the
+    // Apps which have not confirmed it, and from the physical (this) storage.
+    d_virtualStorageCatalog.gc(msgGUID);
+    it->second.reset();
+    d_items.erase(it);
+
+    d_virtualStorageCatalog.stats()
+        ->onEvent<mqbstat::QueueStatsDomain::EventType::e_UPDATE_HISTORY>(
+            d_items.historySize());
+
+    if (d_items.empty()) {
+        d_isEmpty.storeRelaxed(1);
+    }
+
+    return mqbi::StorageResult::e_SUCCESS;
+}
+
 mqbi::StorageResult::Enum
 InMemoryStorage::removeAll(const mqbu::StorageKey& appKey)
 {
@@ -440,6 +479,11 @@ void InMemoryStorage::flushStorage()
     // NOTHING
 }
 
+void InMemoryStorage::flushStorageIfNeeded()
+{
+    // NOTHING
+}
+
 int InMemoryStorage::gcExpiredMessages(const bdlt::Datetime& currentTimeUtc,
                                        bsls::Types::Uint64   secondsFromEpoch,
                                        int                   limit)
@@ -476,6 +520,7 @@ int InMemoryStorage::gcExpiredMessages(const bdlt::Datetime& currentTimeUtc,
         // Remove message from all virtual storages and the physical (this)
         // storage.
         d_virtualStorageCatalog.remove(cit->first);
+        cit->second.reset();
         d_items.erase(cit, now);
         ++numMsgsDeleted;
     }
@@ -27,6 +27,18 @@
 // memory.  'mqbs::InMemoryStorageIterator' provides an iterator implementation
 // of 'mqbi::StorageIterator' protocol and can be used to iterate over messages
 // stored in the in-memory storage.
+//
+/// Memory
+///------
+// The storage does not copy message payloads: the data and options blobs of
+// a message are shared with the event they arrived in, and are therefore
+// carved out of the broker's blob buffer pool.  Per-message metadata lives in
+// the node of the ordered hash map, which allocates its nodes from an
+// internal fixed-size pool, so steady-state posting and GC of messages does
+// not go through the general-purpose allocator.  When an allocator store is
+// supplied at construction, this metadata is accounted for under the
+// "Handles" (and "VirtualHandles" for per-app state) counting allocators and
+// reported in the broker's allocator statistics.
 
 // MQB
 
@@ -370,6 +382,17 @@ class InMemoryStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     mqbi::StorageResult::Enum remove(const bmqt::MessageGUID& msgGUID,
                                      int* msgSize = 0) BSLS_KEYWORD_OVERRIDE;
 
+    /// Garbage-collect from the storage the message having the specified
+    /// 'msgGUID', regardless of the Apps which have not confirmed it yet,
+    /// after informing the queue engine that the message is being removed.
+    /// Record the event in the storage.
+    /// Return one of the return codes from:
+    /// * e_SUCCESS          : success
+    /// * e_GUID_NOT_FOUND   : 'msgGUID' was not found
+    /// * e_WRITE_FAILURE    : failed to record this event in storage
+    mqbi::StorageResult::Enum
+    gcMessage(const bmqt::MessageGUID& msgGUID) BSLS_KEYWORD_OVERRIDE;
+
     /// Remove all messages from this storage for the App identified by the
     /// specified 'appKey' if 'appKey' is not null.  Otherwise, remove messages
     /// for all Apps.  Record the event in the storage.
@@ -384,6 +407,12 @@ class InMemoryStorage BSLS_KEYWORD_FINAL : public ReplicatedStorage {
     /// undefined unless this cluster node is the primary for this partition.
     void flushStorage() BSLS_KEYWORD_OVERRIDE;
 
+    /// Flush any buffered replication messages to the peers, unless the
+    /// replication group commit window of this partition is still open.
+    /// Behaviour is undefined unless this cluster node is the primary for
+    /// this partition.
+    void flushStorageIfNeeded() BSLS_KEYWORD_OVERRIDE;
+
     /// Return the resource capacity meter associated to this storage.
     mqbu::CapacityMeter* capacityMeter() BSLS_KEYWORD_OVERRIDE;
 
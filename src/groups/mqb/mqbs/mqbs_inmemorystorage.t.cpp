@@ -179,7 +179,9 @@ struct Tester {
 
   public:
     // CREATORS
-    explicit Tester(int partitionId, bslma::Allocator* allocator = 0)
+    explicit Tester(int               partitionId,
+                    bslma::Allocator* allocator           = 0,
+                    int               deduplicationTimeMs = 0)
     : d_allocator_p(bslma::Default::allocator(allocator))
     , d_mockCluster(d_allocator_p)
     , d_mockDomain(&d_mockCluster, d_allocator_p)
@@ -192,7 +194,7 @@ struct Tester {
         d_mockQueue._setQueueEngine(&d_mockQueueEngine);
 
         mqbconfm::Domain domainCfg;
-        domainCfg.deduplicationTimeMs() = 0;  // No history
+        domainCfg.deduplicationTimeMs() = deduplicationTimeMs;
         domainCfg.messageTtl()          = k_INT64_MAX;
 
         d_replicatedStorage_mp.load(new (*d_allocator_p) mqbs::InMemoryStorage(
@@ -685,6 +687,55 @@ BMQTST_TEST_F(Test, removeMessage)
     }
 }
 
+BMQTST_TEST(removeMessage_releasesPayload)
+// ------------------------------------------------------------------------
+// REMOVE MESSAGE RELEASES PAYLOAD
+//
+// Concerns:
+//   A removed message kept in the history for deduplication does not hold
+//   on to its payload, and is still detected as a duplicate.
+//
+// Testing:
+//   remove(...)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("REMOVE MESSAGE RELEASES PAYLOAD");
+
+    Tester tester(k_PARTITION_ID,
+                  bmqtst::TestHelperUtil::allocator(),
+                  60 * 1000);  // deduplicationTimeMs
+    tester.configure();
+
+    mqbs::ReplicatedStorage& storage = tester.storage();
+
+    bsl::vector<bmqt::MessageGUID> guids(bmqtst::TestHelperUtil::allocator());
+    BSLS_ASSERT_OPT(tester.addMessages(&guids, 1) ==
+                    mqbi::StorageResult::e_SUCCESS);
+
+    bsl::shared_ptr<bdlbb::Blob>   appData;
+    bsl::shared_ptr<bdlbb::Blob>   options;
+    mqbi::StorageMessageAttributes attributes;
+    BMQTST_ASSERT_EQ(storage.get(&appData, &options, &attributes, guids[0]),
+                     mqbi::StorageResult::e_SUCCESS);
+    options.reset();  // 'addMessages' uses the same blob for both
+    BMQTST_ASSERT_GT(appData.use_count(), 1);
+
+    int removedMsgSize = -1;
+    BMQTST_ASSERT_EQ(storage.remove(guids[0], &removedMsgSize),
+                     mqbi::StorageResult::e_SUCCESS);
+    BMQTST_ASSERT(!storage.hasMessage(guids[0]));
+
+    // The storage no longer references the payload
+    BMQTST_ASSERT_EQ(appData.use_count(), 1);
+
+    // But the GUID is still in the history
+    BMQTST_ASSERT_EQ(tester.addMessages(&guids,
+                                        1,
+                                        0,      // dataOffset
+                                        true),  // useSameGuids
+                     mqbi::StorageResult::e_DUPLICATE);
+}
+
 BMQTST_TEST_F(Test, addVirtualStorage)
 // ------------------------------------------------------------------------
 // ADD VIRTUAL STORAGE
@@ -1433,6 +1484,59 @@ BMQTST_TEST(garbageCollect)
     BMQTST_ASSERT_EQ(storage.numBytes(mqbu::StorageKey::k_NULL_KEY), 0);
 }
 
+BMQTST_TEST(gcMessage)
+// ------------------------------------------------------------------------
+// GC MESSAGE
+//
+// Concerns:
+//   A message can be garbage-collected while some Apps have not confirmed
+//   it, and the counters of these Apps are updated.
+//
+// Testing:
+//   gcMessage(...)
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("GC MESSAGE");
+
+    bmqu::MemOutStream errDescription(bmqtst::TestHelperUtil::allocator());
+
+    Tester tester(k_PARTITION_ID, bmqtst::TestHelperUtil::allocator());
+    tester.configure();
+
+    mqbs::ReplicatedStorage& storage = tester.storage();
+
+    BSLS_ASSERT_OPT(
+        storage.addVirtualStorage(errDescription, k_APP_ID1, k_APP_KEY1) == 0);
+    BSLS_ASSERT_OPT(
+        storage.addVirtualStorage(errDescription, k_APP_ID2, k_APP_KEY2) == 0);
+
+    const int k_MSG_COUNT = 3;
+
+    bsl::vector<bmqt::MessageGUID> guids(bmqtst::TestHelperUtil::allocator());
+    BMQTST_ASSERT_EQ(tester.addMessages(&guids,
+                                        k_MSG_COUNT,
+                                        0,      // dataOffset
+                                        false,  // useSameGuids
+                                        2),     // refCount
+                     mqbi::StorageResult::e_SUCCESS);
+
+    // Only the first App confirms the first message
+    BMQTST_ASSERT_EQ(storage.confirm(guids[0], k_APP_KEY1, 0),
+                     mqbi::StorageResult::e_NON_ZERO_REFERENCES);
+
+    BMQTST_ASSERT_EQ(storage.gcMessage(guids[0]),
+                     mqbi::StorageResult::e_SUCCESS);
+    BMQTST_ASSERT(!storage.hasMessage(guids[0]));
+    BMQTST_ASSERT_EQ(storage.numMessages(k_NULL_KEY), k_MSG_COUNT - 1);
+    BMQTST_ASSERT_EQ(storage.numMessages(k_APP_KEY1), k_MSG_COUNT - 1);
+    BMQTST_ASSERT_EQ(storage.numMessages(k_APP_KEY2), k_MSG_COUNT - 1);
+    BMQTST_ASSERT_EQ(storage.capacityMeter()->messages(), k_MSG_COUNT - 1);
+
+    // Unknown GUID
+    BMQTST_ASSERT_EQ(storage.gcMessage(guids[0]),
+                     mqbi::StorageResult::e_GUID_NOT_FOUND);
+}
+
 BMQTST_TEST_F(Test, addQueueOpRecordHandle)
 {
     // CONSTANTS
@@ -43,7 +43,7 @@
 // BMQ
 #include <bmqt_messageguid.h>
 
-#include <bmqc_orderedhashmap.h>
+#include <bmqc_flatorderedhashmap.h>
 
 // BDE
 #include <bdlbb_blob.h>
@@ -72,10 +72,12 @@ class VirtualStorage {
   public:
     /// msgGUID -> MessageContext
     /// Must be a container in which iteration order is same as insertion
-    /// order.
-    typedef bmqc::OrderedHashMap<bmqt::MessageGUID,
-                                 bsl::shared_ptr<mqbi::DataStreamMessage>,
-                                 bslh::Hash<bmqt::MessageGUIDHashAlgo> >
+    /// order.  The stream is shared by all Apps, each App locating its state
+    /// in the `DataStreamMessage` by its ordinal, so that a message is
+    /// tracked by one entry regardless of the number of Apps.
+    typedef bmqc::FlatOrderedHashMap<bmqt::MessageGUID,
+                                     bsl::shared_ptr<mqbi::DataStreamMessage>,
+                                     bslh::Hash<bmqt::MessageGUIDHashAlgo> >
         DataStream;
 
     typedef DataStream::iterator DataStreamIterator;
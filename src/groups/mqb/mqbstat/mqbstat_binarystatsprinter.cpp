@@ -0,0 +1,260 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbstat_binarystatsprinter.h>
+
+#include <mqbscm_version.h>
+
+// BMQ
+#include <bmqst_statvalue.h>
+#include <bmqstm_values.h>
+
+// BDE
+#include <bsls_assert.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+
+namespace BloombergLP {
+namespace mqbstat {
+
+namespace {
+
+const int k_NUM_FIELDS = bmqstm::StatValueFields::NUM_ENUMERATORS;
+
+/// Append to the specified `out` the LEB128 encoding of the specified
+/// `value`.
+void appendUnsigned(bsl::string* out, bsls::Types::Uint64 value)
+{
+    while (value >= 0x80) {
+        out->push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out->push_back(static_cast<char>(value));
+}
+
+/// Append to the specified `out` the zigzag LEB128 encoding of the
+/// specified `value`, interpreted as a two's complement signed integer.
+void appendSigned(bsl::string* out, bsls::Types::Uint64 value)
+{
+    appendUnsigned(out, (value << 1) ^ (0 - (value >> 63)));
+}
+
+/// Append to the specified `out` the length-prefixed specified `value`.
+void appendString(bsl::string* out, const bsl::string& value)
+{
+    appendUnsigned(out, value.length());
+    out->append(value);
+}
+
+/// Write to the specified `stream` the base64 encoding of the specified
+/// `data`, without line breaks.
+void printBase64(bsl::ostream& stream, const bsl::string& data)
+{
+    static const char k_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                     "abcdefghijklmnopqrstuvwxyz"
+                                     "0123456789+/";
+
+    const unsigned char* in  = reinterpret_cast<const unsigned char*>(
+        data.data());
+    const size_t         len = data.length();
+
+    char   quad[4];
+    size_t i = 0;
+    for (; i + 3 <= len; i += 3) {
+        const unsigned int chunk = (in[i] << 16) | (in[i + 1] << 8) |
+                                   in[i + 2];
+        quad[0] = k_ALPHABET[(chunk >> 18) & 0x3F];
+        quad[1] = k_ALPHABET[(chunk >> 12) & 0x3F];
+        quad[2] = k_ALPHABET[(chunk >> 6) & 0x3F];
+        quad[3] = k_ALPHABET[chunk & 0x3F];
+        stream.write(quad, 4);
+    }
+
+    if (i < len) {
+        const bool         two   = (i + 1 < len);
+        const unsigned int chunk = (in[i] << 16) | (two ? in[i + 1] << 8 : 0);
+        quad[0] = k_ALPHABET[(chunk >> 18) & 0x3F];
+        quad[1] = k_ALPHABET[(chunk >> 12) & 0x3F];
+        quad[2] = two ? k_ALPHABET[(chunk >> 6) & 0x3F] : '=';
+        quad[3] = '=';
+        stream.write(quad, 4);
+    }
+}
+
+}  // close unnamed namespace
+
+// ------------------------
+// class BinaryStatsPrinter
+// ------------------------
+
+// PRIVATE MANIPULATORS
+void BinaryStatsPrinter::encodeContext(bsl::string*              out,
+                                       StateMap*                 newState,
+                                       const bmqst::StatContext& context,
+                                       bool                      isKeyframe)
+{
+    const int numValues = context.numValues();
+
+    // A context is described the first time it is encoded after a keyframe,
+    // and all its fields are then encoded relative to zero.
+    StateMap::const_iterator prevIt = isKeyframe
+                                          ? d_state.end()
+                                          : d_state.find(context.uniqueId());
+    const bool describe = (prevIt == d_state.end() ||
+                           prevIt->second.size() !=
+                               static_cast<size_t>(numValues * k_NUM_FIELDS));
+
+    unsigned int ctxFlags = 0;
+    if (describe) {
+        ctxFlags |= e_DESCRIBED;
+    }
+    if (context.hasName()) {
+        ctxFlags |= e_NAMED;
+    }
+    if (context.isDeleted()) {
+        ctxFlags |= e_DELETED;
+    }
+
+    appendUnsigned(out, context.uniqueId());
+    appendUnsigned(out, ctxFlags);
+    if (describe) {
+        if (context.hasName()) {
+            appendString(out, context.name());
+        }
+        else {
+            appendSigned(out, context.id());
+        }
+    }
+
+    appendUnsigned(out, numValues);
+    if (describe) {
+        for (int i = 0; i < numValues; ++i) {
+            appendString(out, context.valueName(i));
+        }
+    }
+
+    // Deleted contexts are encoded one last time and then forgotten.
+    FieldValues  deletedValues(d_allocator_p);
+    FieldValues& current = context.isDeleted()
+                               ? deletedValues
+                               : (*newState)[context.uniqueId()];
+    current.assign(numValues * k_NUM_FIELDS, 0);
+
+    bmqstm::StatValueUpdate         update(d_allocator_p);
+    bsl::vector<bsls::Types::Int64> deltas(d_allocator_p);
+    for (int i = 0; i < numValues; ++i) {
+        update.reset();
+        deltas.clear();
+        bmqst::StatValueUtil::loadFullUpdate(
+            &update,
+            context.value(bmqst::StatContext::e_TOTAL_VALUE, i));
+
+        unsigned int fieldMask  = 0;
+        size_t       fieldIndex = 0;
+        for (int f = 0; f < k_NUM_FIELDS; ++f) {
+            if (!(update.fieldMask() & (1u << f))) {
+                continue;  // CONTINUE
+            }
+
+            BSLS_ASSERT_SAFE(fieldIndex < update.fields().size());
+            const bsls::Types::Int64 value = update.fields()[fieldIndex++];
+            const bsls::Types::Int64 prev =
+                describe ? 0 : prevIt->second[i * k_NUM_FIELDS + f];
+            current[i * k_NUM_FIELDS + f] = value;
+
+            if (describe || value != prev) {
+                fieldMask |= (1u << f);
+
+                // Go through unsigned arithmetic: extreme values (e.g. the
+                // initial min of a value) would overflow a signed
+                // difference.
+                deltas.push_back(static_cast<bsls::Types::Int64>(
+                    static_cast<bsls::Types::Uint64>(value) -
+                    static_cast<bsls::Types::Uint64>(prev)));
+            }
+        }
+
+        appendUnsigned(out, fieldMask);
+        for (size_t d = 0; d < deltas.size(); ++d) {
+            appendSigned(out, static_cast<bsls::Types::Uint64>(deltas[d]));
+        }
+    }
+
+    appendUnsigned(out, context.numSubcontexts());
+    for (bmqst::StatContextIterator it = context.subcontextIterator(); it;
+         ++it) {
+        encodeContext(out, newState, *it, isKeyframe);
+    }
+}
+
+// CREATORS
+BinaryStatsPrinter::BinaryStatsPrinter(const StatContextsMap& statContextsMap,
+                                       bslma::Allocator*      allocator)
+: d_contexts(allocator)
+, d_state(allocator)
+, d_recordsSinceKeyframe(0)
+, d_buffer(allocator)
+, d_allocator_p(allocator)
+{
+    for (StatContextsMap::const_iterator it = statContextsMap.begin();
+         it != statContextsMap.end();
+         ++it) {
+        BSLS_ASSERT_SAFE(it->second);
+        d_contexts.insert(bsl::make_pair(it->first, it->second));
+    }
+}
+
+// MANIPULATORS
+void BinaryStatsPrinter::printStats(bsl::ostream& stream, int statId)
+{
+    encodeStats(&d_buffer,
+                statId,
+                bsls::SystemTime::nowRealtimeClock().totalMilliseconds());
+    printBase64(stream, d_buffer);
+}
+
+void BinaryStatsPrinter::encodeStats(bsl::string*       record,
+                                     int                statId,
+                                     bsls::Types::Int64 timestampMs)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(record);
+
+    const bool isKeyframe = (d_recordsSinceKeyframe == 0);
+    d_recordsSinceKeyframe = (d_recordsSinceKeyframe + 1) %
+                             k_KEYFRAME_INTERVAL;
+
+    record->clear();
+    appendUnsigned(record, k_VERSION);
+    appendUnsigned(record, isKeyframe ? e_KEYFRAME : 0);
+    appendUnsigned(record, statId);
+    appendUnsigned(record, timestampMs);
+
+    StateMap newState(d_allocator_p);
+    appendUnsigned(record, d_contexts.size());
+    for (bsl::map<bsl::string, const bmqst::StatContext*>::const_iterator it =
+             d_contexts.begin();
+         it != d_contexts.end();
+         ++it) {
+        encodeContext(record, &newState, *it->second, isKeyframe);
+    }
+
+    // Contexts not encoded in this record (deleted, or cleaned up) are
+    // dropped from the baseline.
+    d_state.swap(newState);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
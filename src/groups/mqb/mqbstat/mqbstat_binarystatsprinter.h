@@ -0,0 +1,194 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MQBSTAT_BINARYSTATSPRINTER
+#define INCLUDED_MQBSTAT_BINARYSTATSPRINTER
+
+//@PURPOSE: Provide a mechanism to print statistics as compact binary records
+//
+//@CLASSES:
+//  mqbstat::BinaryStatsPrinter: statistics printer to delta-encoded records
+//
+//@DESCRIPTION: 'mqbstat::BinaryStatsPrinter' handles the printing of the
+// statistics as compact, delta-encoded binary records, intended to be stored
+// in the stats log alongside (or instead of) the table and JSON outputs and
+// decoded offline (see 'blazingmq.util.statslog').  It is responsible solely
+// for printing, so any statistics updates (e.g. making a new snapshot of the
+// used StatContexts) must be done before calling to this component.
+//
+// Each call to 'printStats' walks all the registered stat contexts, loads the
+// latest snapshot of each of their (total) values into a
+// 'bmqstm::StatValueUpdate', and encodes, for every field of that update, the
+// difference with the value of the same field in the previous record.  Fields
+// that did not change are omitted.  Every 'k_KEYFRAME_INTERVAL' records, a
+// keyframe is emitted where all values are encoded relative to zero and all
+// contexts are fully described again, so that a reader can start decoding
+// from any keyframe (e.g. at the beginning of a rotated file).
+//
+// The resulting record is written to the stream base64-encoded, so that it
+// can go through the line-oriented 'mqbstat::StatsFileLogger' (which provides
+// rotation and cleanup) unchanged: one line per record.
+//
+/// Record Format
+///-------------
+// All integers are LEB128 varints; signed integers are zigzag-encoded first.
+//..
+//  record     := version:uvarint flags:uvarint statId:uvarint
+//                timestampMs:uvarint numContexts:uvarint context*
+//  context    := uniqueId:uvarint ctxFlags:uvarint
+//                [name:string | id:svarint]     if ctxFlags & e_DESCRIBED
+//                numValues:uvarint
+//                [valueName:string{numValues}]  if ctxFlags & e_DESCRIBED
+//                value{numValues} numSubcontexts:uvarint context*
+//  value      := fieldMask:uvarint fieldDelta:svarint{popcount(fieldMask)}
+//  string     := length:uvarint byte{length}
+//..
+// where 'flags' has 'e_KEYFRAME' set for keyframes, 'ctxFlags' is a
+// combination of 'e_DESCRIBED', 'e_NAMED' and 'e_DELETED', and the bits of
+// 'fieldMask' are the 'bmqstm::StatValueFields' values.
+
+#include <bmqst_statcontext.h>
+
+// BDE
+#include <bsl_map.h>
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_vector.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+namespace BloombergLP {
+
+namespace mqbstat {
+
+// ========================
+// class BinaryStatsPrinter
+// ========================
+
+class BinaryStatsPrinter {
+  public:
+    // PUBLIC TYPES
+    typedef bsl::unordered_map<bsl::string, bmqst::StatContext*>
+        StatContextsMap;
+
+    /// Flags of a record.
+    enum RecordFlags { e_KEYFRAME = 1 << 0 };
+
+    /// Flags of a context within a record.
+    enum ContextFlags {
+        /// The context name (or id) and its value names follow.
+        e_DESCRIBED = 1 << 0,
+
+        /// The context is identified by a name rather than an id.
+        e_NAMED = 1 << 1,
+
+        /// The context was deleted since the previous snapshot.
+        e_DELETED = 1 << 2
+    };
+
+    // PUBLIC CONSTANTS
+
+    /// Version of the record format.
+    static const int k_VERSION = 1;
+
+    /// Number of records between two consecutive keyframes.
+    static const int k_KEYFRAME_INTERVAL = 10;
+
+  private:
+    // PRIVATE TYPES
+
+    /// Last encoded value of each field of each value of a context,
+    /// `bmqstm::StatValueFields::NUM_ENUMERATORS` entries per value.
+    typedef bsl::vector<bsls::Types::Int64> FieldValues;
+
+    /// Map of context unique id to the last encoded field values.
+    typedef bsl::unordered_map<int, FieldValues> StateMap;
+
+    // DATA
+
+    /// Registered top-level contexts, ordered by name so that records are
+    /// deterministic.
+    bsl::map<bsl::string, const bmqst::StatContext*> d_contexts;
+
+    /// Field values of every context encoded in the previous record.
+    StateMap d_state;
+
+    /// Number of records encoded since the last keyframe.
+    int d_recordsSinceKeyframe;
+
+    /// Scratch buffer holding the record being encoded.
+    bsl::string d_buffer;
+
+    bslma::Allocator* d_allocator_p;
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Append to the specified `out` the encoding of the specified
+    /// `context` and, recursively, of its subcontexts, using the field
+    /// values recorded in `d_state` as a baseline and recording the new
+    /// ones in the specified `newState`.  Encode all the context
+    /// descriptions and all the fields if the specified `isKeyframe` is
+    /// true.
+    void encodeContext(bsl::string*              out,
+                       StateMap*                 newState,
+                       const bmqst::StatContext& context,
+                       bool                      isKeyframe);
+
+  private:
+    // NOT IMPLEMENTED
+    BinaryStatsPrinter(const BinaryStatsPrinter& other) BSLS_KEYWORD_DELETED;
+    BinaryStatsPrinter&
+    operator=(const BinaryStatsPrinter& other) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BinaryStatsPrinter,
+                                   bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create a new `BinaryStatsPrinter` object, using the specified
+    /// `statContextsMap` and the optionally specified `allocator`.
+    explicit BinaryStatsPrinter(const StatContextsMap& statContextsMap,
+                                bslma::Allocator*      allocator = 0);
+
+    // MANIPULATORS
+
+    /// Print the base64-encoded binary record of the stats to the
+    /// specified `stream`, using the specified `statId` to identify the
+    /// snapshot.
+    ///
+    /// THREAD: This method is called in the `snapshot` thread.
+    void printStats(bsl::ostream& stream, int statId);
+
+    /// Load into the specified `record` the raw binary encoding of the
+    /// stats, using the specified `statId` and `timestampMs` (milliseconds
+    /// since epoch) to identify the snapshot.
+    ///
+    /// THREAD: This method is called in the `snapshot` thread.
+    void encodeStats(bsl::string*       record,
+                     int                statId,
+                     bsls::Types::Int64 timestampMs);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
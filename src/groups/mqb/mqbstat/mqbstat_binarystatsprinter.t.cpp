@@ -0,0 +1,300 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbstat_binarystatsprinter.h>
+
+#include <bmqst_statcontext.h>
+#include <bmqstm_values.h>
+#include <bmqu_memoutstream.h>
+
+// BDE
+#include <bsl_map.h>
+#include <bsl_string.h>
+#include <bsls_types.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Minimal reader of the primitives of a binary stats record.
+struct RecordReader {
+    const bsl::string& d_data;
+    size_t             d_pos;
+
+    explicit RecordReader(const bsl::string& data)
+    : d_data(data)
+    , d_pos(0)
+    {
+    }
+
+    bsls::Types::Uint64 readUnsigned()
+    {
+        bsls::Types::Uint64 result = 0;
+        int                 shift  = 0;
+        while (true) {
+            BSLS_ASSERT_OPT(d_pos < d_data.length());
+            const unsigned char byte = static_cast<unsigned char>(
+                d_data[d_pos++]);
+            result |= static_cast<bsls::Types::Uint64>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return result;  // RETURN
+            }
+            shift += 7;
+        }
+    }
+
+    bsls::Types::Int64 readSigned()
+    {
+        const bsls::Types::Uint64 value = readUnsigned();
+        return static_cast<bsls::Types::Int64>((value >> 1) ^
+                                               (0 - (value & 1)));
+    }
+
+    bsl::string readString()
+    {
+        const size_t length = readUnsigned();
+        bsl::string  result(bmqtst::TestHelperUtil::allocator());
+        result.assign(d_data, d_pos, length);
+        d_pos += length;
+        return result;
+    }
+
+    bool atEnd() const { return d_pos == d_data.length(); }
+};
+
+/// Decoded value of a single-context record.
+struct DecodedRecord {
+    int                               d_flags;
+    int                               d_statId;
+    bsls::Types::Int64                d_timestampMs;
+    int                               d_ctxFlags;
+    bsl::string                       d_name;
+    bsl::string                       d_valueName;
+    bsl::map<int, bsls::Types::Int64> d_deltas;
+
+    DecodedRecord()
+    : d_flags(0)
+    , d_statId(0)
+    , d_timestampMs(0)
+    , d_ctxFlags(0)
+    , d_name(bmqtst::TestHelperUtil::allocator())
+    , d_valueName(bmqtst::TestHelperUtil::allocator())
+    , d_deltas(bmqtst::TestHelperUtil::allocator())
+    {
+    }
+};
+
+/// Decode the specified `record`, which must contain exactly one context
+/// having one value and no subcontexts, into the specified `result`.
+void decodeRecord(DecodedRecord* result, const bsl::string& record)
+{
+    RecordReader reader(record);
+
+    BMQTST_ASSERT_EQ(reader.readUnsigned(),
+                     static_cast<bsls::Types::Uint64>(
+                         mqbstat::BinaryStatsPrinter::k_VERSION));
+    result->d_flags       = static_cast<int>(reader.readUnsigned());
+    result->d_statId      = static_cast<int>(reader.readUnsigned());
+    result->d_timestampMs = reader.readUnsigned();
+    BMQTST_ASSERT_EQ(reader.readUnsigned(), 1u);  // numContexts
+
+    reader.readUnsigned();  // uniqueId
+    result->d_ctxFlags = static_cast<int>(reader.readUnsigned());
+    const bool described = result->d_ctxFlags &
+                           mqbstat::BinaryStatsPrinter::e_DESCRIBED;
+    if (described) {
+        result->d_name = reader.readString();
+    }
+    BMQTST_ASSERT_EQ(reader.readUnsigned(), 1u);  // numValues
+    if (described) {
+        result->d_valueName = reader.readString();
+    }
+
+    const bsls::Types::Uint64 fieldMask = reader.readUnsigned();
+    for (int f = 0; f < bmqstm::StatValueFields::NUM_ENUMERATORS; ++f) {
+        if (fieldMask & (1u << f)) {
+            result->d_deltas[f] = reader.readSigned();
+        }
+    }
+
+    BMQTST_ASSERT_EQ(reader.readUnsigned(), 0u);  // numSubcontexts
+    BMQTST_ASSERT(reader.atEnd());
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   The first record is a keyframe fully describing the contexts, and
+//   subsequent records only carry the deltas of the changed fields.
+//
+// Plan:
+//   1. Encode a record of a context with one continuous value and decode
+//      it.
+//   2. Update the value, encode and decode again.
+//
+// Testing:
+//   encodeStats
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    typedef bmqstm::StatValueFields Fields;
+
+    bmqst::StatContext context(
+        bmqst::StatContextConfiguration("ctx").value("value", 2),
+        bmqtst::TestHelperUtil::allocator());
+
+    mqbstat::BinaryStatsPrinter::StatContextsMap contexts(
+        bmqtst::TestHelperUtil::allocator());
+    contexts["ctx"] = &context;
+
+    mqbstat::BinaryStatsPrinter obj(contexts,
+                                    bmqtst::TestHelperUtil::allocator());
+
+    bsl::string record(bmqtst::TestHelperUtil::allocator());
+
+    // 1. Keyframe
+    context.adjustValue(0, 100);
+    context.snapshot();
+    obj.encodeStats(&record, 1, 1000);
+
+    DecodedRecord first;
+    decodeRecord(&first, record);
+    BMQTST_ASSERT_EQ(first.d_flags, mqbstat::BinaryStatsPrinter::e_KEYFRAME);
+    BMQTST_ASSERT_EQ(first.d_statId, 1);
+    BMQTST_ASSERT_EQ(first.d_timestampMs, 1000);
+    BMQTST_ASSERT_EQ(first.d_ctxFlags,
+                     mqbstat::BinaryStatsPrinter::e_DESCRIBED |
+                         mqbstat::BinaryStatsPrinter::e_NAMED);
+    BMQTST_ASSERT_EQ(first.d_name, "ctx");
+    BMQTST_ASSERT_EQ(first.d_valueName, "value");
+    BMQTST_ASSERT_EQ(first.d_deltas[Fields::E_VALUE], 100);
+    BMQTST_ASSERT_EQ(first.d_deltas[Fields::E_INCREMENTS], 1);
+
+    const size_t keyframeSize = record.length();
+
+    // 2. Delta
+    context.adjustValue(0, 50);
+    context.snapshot();
+    obj.encodeStats(&record, 2, 2000);
+
+    DecodedRecord second;
+    decodeRecord(&second, record);
+    BMQTST_ASSERT_EQ(second.d_flags, 0);
+    BMQTST_ASSERT_EQ(second.d_statId, 2);
+    BMQTST_ASSERT_EQ(second.d_ctxFlags, mqbstat::BinaryStatsPrinter::e_NAMED);
+    BMQTST_ASSERT_EQ(second.d_deltas[Fields::E_VALUE], 50);
+    BMQTST_ASSERT_EQ(second.d_deltas[Fields::E_INCREMENTS], 1);
+    BMQTST_ASSERT_EQ(second.d_deltas.count(Fields::E_DECREMENTS), 0u);
+    BMQTST_ASSERT_LT(record.length(), keyframeSize);
+}
+
+static void test2_keyframeInterval()
+// ------------------------------------------------------------------------
+// KEYFRAME INTERVAL
+//
+// Concerns:
+//   A keyframe is emitted every 'k_KEYFRAME_INTERVAL' records, and
+//   'printStats' emits a base64 encoded record.
+//
+// Testing:
+//   encodeStats
+//   printStats
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("KEYFRAME INTERVAL");
+
+    bmqst::StatContext context(
+        bmqst::StatContextConfiguration("ctx").value("value", 2),
+        bmqtst::TestHelperUtil::allocator());
+
+    mqbstat::BinaryStatsPrinter::StatContextsMap contexts(
+        bmqtst::TestHelperUtil::allocator());
+    contexts["ctx"] = &context;
+
+    mqbstat::BinaryStatsPrinter obj(contexts,
+                                    bmqtst::TestHelperUtil::allocator());
+
+    bsl::string record(bmqtst::TestHelperUtil::allocator());
+    for (int i = 0; i <= mqbstat::BinaryStatsPrinter::k_KEYFRAME_INTERVAL;
+         ++i) {
+        context.adjustValue(0, 1);
+        context.snapshot();
+        obj.encodeStats(&record, i, 0);
+
+        DecodedRecord decoded;
+        decodeRecord(&decoded, record);
+
+        const bool isKeyframe =
+            (i % mqbstat::BinaryStatsPrinter::k_KEYFRAME_INTERVAL) == 0;
+        BMQTST_ASSERT_EQ_D(i,
+                           decoded.d_flags,
+                           isKeyframe ? mqbstat::BinaryStatsPrinter::e_KEYFRAME
+                                      : 0);
+        BMQTST_ASSERT_EQ_D(
+            i,
+            decoded.d_deltas[bmqstm::StatValueFields::E_VALUE],
+            isKeyframe ? i + 1 : 1);
+    }
+
+    bmqu::MemOutStream os(bmqtst::TestHelperUtil::allocator());
+    context.snapshot();
+    obj.printStats(os, 0);
+
+    const bsl::string& line = os.str();
+    BMQTST_ASSERT(!line.empty());
+    BMQTST_ASSERT_EQ(line.length() % 4, 0u);
+    BMQTST_ASSERT_EQ(line.find_first_not_of("ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                            "abcdefghijklmnopqrstuvwxyz"
+                                            "0123456789+/="),
+                     bsl::string::npos);
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 2: test2_keyframeInterval(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_DEF_GBL_ALLOC);
+}
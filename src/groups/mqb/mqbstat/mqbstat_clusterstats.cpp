@@ -27,6 +27,7 @@
 // BDE
 #include <bdld_datummapbuilder.h>
 #include <bdld_manageddatum.h>
+#include <bdlt_timeunitratio.h>
 #include <bdlma_localsequentialallocator.h>
 #include <bsl_limits.h>
 #include <bsl_ostream.h>
@@ -34,6 +35,7 @@
 #include <bslmf_assert.h>
 #include <bslmf_movableref.h>
 #include <bsls_assert.h>
+#include <bsls_timeutil.h>
 
 namespace BloombergLP {
 namespace mqbstat {
@@ -210,6 +212,30 @@ bsls::Types::Int64 ClusterStats::getValue(const bmqst::StatContext& context,
         return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
                                                                        : value;
     }
+    case Stat::e_PARTITION_REPLICA_RECEIPT_TIME_NS_AVG: {
+        const bsls::Types::Int64 value =
+            STAT_RANGE(averagePerEvent, e_PARTITION_REPLICA_RECEIPT_TIME_NS);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0
+                                                                       : value;
+    }
+    case Stat::e_PARTITION_REPLICA_RECEIPT_TIME_NS_MAX: {
+        const bsls::Types::Int64 value =
+            STAT_RANGE(rangeMax, e_PARTITION_REPLICA_RECEIPT_TIME_NS);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
+    case Stat::e_PARTITION_REPLICA_LAG_MAX: {
+        const bsls::Types::Int64 value = STAT_RANGE(rangeMax,
+                                                    e_PARTITION_REPLICA_LAG);
+        return value == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0
+                                                                       : value;
+    }
+    case Stat::e_PARTITION_SCRUB_BYTES: {
+        return STAT_RANGE(valueDifference, e_PARTITION_SCRUB_BYTES);
+    }
+    case Stat::e_PARTITION_SCRUB_ERRORS: {
+        return STAT_RANGE(valueDifference, e_PARTITION_SCRUB_ERRORS);
+    }
 
     default: {
         BSLS_ASSERT_SAFE(false && "Attempting to access an unknown stat");
@@ -348,10 +374,56 @@ void ClusterStats::setPartitionCfgBytes(bsls::Types::Int64 dataBytes,
 PartitionStats::PartitionStats(
     const bsl::shared_ptr<bmqst::StatContext>& statContext)
 : d_statContext_sp(statContext)
+, d_outstandingDataBytes(0)
+, d_dataWriteRate(0)
+, d_lastDataOffset(0)
+, d_lastReportTime(0)
 {
     // NOTHING
 }
 
+void PartitionStats::setPartitionBytes(
+    bsls::Types::Uint64 outstandingDataBytes,
+    bsls::Types::Uint64 outstandingJournalBytes,
+    bsls::Types::Uint64 offsetDataBytes,
+    bsls::Types::Uint64 offsetJournalBytes,
+    bsls::Types::Uint64 sequenceNumber)
+{
+    d_statContext_sp->reportValue(
+        ClusterStats::ClusterStatsIndex::e_PARTITION_DATA_BYTES,
+        static_cast<bsls::Types::Int64>(outstandingDataBytes));
+    d_statContext_sp->reportValue(
+        ClusterStats::ClusterStatsIndex::e_PARTITION_JOURNAL_BYTES,
+        static_cast<bsls::Types::Int64>(outstandingJournalBytes));
+    d_statContext_sp->setValue(
+        ClusterStats::ClusterStatsIndex::e_PARTITION_DATA_OFFSET_BYTES,
+        static_cast<bsls::Types::Int64>(offsetDataBytes));
+    d_statContext_sp->setValue(
+        ClusterStats::ClusterStatsIndex::e_PARTITION_JOURNAL_OFFSET_BYTES,
+        static_cast<bsls::Types::Int64>(offsetJournalBytes));
+    d_statContext_sp->setValue(
+        ClusterStats::ClusterStatsIndex::e_PARTITION_SEQUENCE_NUMBER,
+        static_cast<bsls::Types::Int64>(sequenceNumber));
+
+    // Update the load of the partition.  The data file offset goes back on
+    // rollover, in which case the previous rate is kept until the next
+    // report.
+    const bsls::Types::Int64 now = bsls::TimeUtil::getTimer();
+    if (d_lastReportTime != 0 && now > d_lastReportTime &&
+        offsetDataBytes >= d_lastDataOffset) {
+        const double elapsedSec = static_cast<double>(now -
+                                                      d_lastReportTime) /
+                                  bdlt::TimeUnitRatio::k_NS_PER_S;
+        d_dataWriteRate.storeRelaxed(static_cast<bsls::Types::Int64>(
+            static_cast<double>(offsetDataBytes - d_lastDataOffset) /
+            elapsedSec));
+    }
+    d_lastDataOffset = offsetDataBytes;
+    d_lastReportTime = now;
+    d_outstandingDataBytes.storeRelaxed(
+        static_cast<bsls::Types::Int64>(outstandingDataBytes));
+}
+
 // -------------------------
 // struct ClusterStats::Role
 // -------------------------
@@ -411,6 +483,13 @@ const char* ClusterStats::Stat::toString(Stat::Enum value)
                      "partition_replication_time_avg_ns")
         MQBSTAT_CASE(e_PARTITION_REPLICATION_TIME_NS_MAX,
                      "partition_replication_time_max_ns")
+        MQBSTAT_CASE(e_PARTITION_REPLICA_RECEIPT_TIME_NS_AVG,
+                     "partition_replica_receipt_time_avg_ns")
+        MQBSTAT_CASE(e_PARTITION_REPLICA_RECEIPT_TIME_NS_MAX,
+                     "partition_replica_receipt_time_max_ns")
+        MQBSTAT_CASE(e_PARTITION_REPLICA_LAG_MAX, "partition_replica_lag_max")
+        MQBSTAT_CASE(e_PARTITION_SCRUB_BYTES, "partition_scrub_bytes")
+        MQBSTAT_CASE(e_PARTITION_SCRUB_ERRORS, "partition_scrub_errors")
     default:
         BSLS_ASSERT(false && "invalid enumerator");
         BSLS_ASSERT_INVOKE_NORETURN("");
@@ -463,7 +542,12 @@ ClusterStatsUtil::initializeStatContextCluster(int               historySize,
         .value("partition.data_offset_bytes")
         .value("partition.journal_offset_bytes")
         .value("partition.sequence_number")
-        .value("partition.replication_time_ns", bmqst::StatValue::e_DISCRETE);
+        .value("partition.replication_time_ns", bmqst::StatValue::e_DISCRETE)
+        .value("partition.replica_receipt_time_ns",
+               bmqst::StatValue::e_DISCRETE)
+        .value("partition.replica_lag", bmqst::StatValue::e_DISCRETE)
+        .value("partition.scrub_bytes")
+        .value("partition.scrub_errors");
 
     // NOTE: For the clusters, the stat context will have two levels of
     //       children, first level is per cluster, and second level is per
@@ -44,6 +44,7 @@
 #include <bslma_managedptr.h>
 #include <bslma_usesbslmaallocator.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_atomic.h>
 #include <bsls_cpp11.h>
 #include <bsls_types.h>
 
@@ -128,7 +129,24 @@ class ClusterStats {
             /// Maximum observed time in nanoseconds it took to store a message
             /// record at primary and replicate it to a majority of nodes in
             /// the cluster.
-            e_PARTITION_REPLICATION_TIME_NS_MAX
+            e_PARTITION_REPLICATION_TIME_NS_MAX,
+            /// Average observed time in nanoseconds between the write of a
+            /// message record at primary and the receipt of it by any single
+            /// replica.
+            e_PARTITION_REPLICA_RECEIPT_TIME_NS_AVG,
+            /// Maximum observed time in nanoseconds between the write of a
+            /// message record at primary and the receipt of it by any single
+            /// replica.
+            e_PARTITION_REPLICA_RECEIPT_TIME_NS_MAX,
+            /// Maximum observed number of records by which a replica's
+            /// receipt was behind the primary's sequence number.
+            e_PARTITION_REPLICA_LAG_MAX,
+            /// Amount of bytes of outstanding messages verified by the
+            /// background scrubber.
+            e_PARTITION_SCRUB_BYTES,
+            /// Number of outstanding messages found corrupted by the
+            /// background scrubber.
+            e_PARTITION_SCRUB_ERRORS
         };
 
         // CLASS METHODS
@@ -231,7 +249,19 @@ class ClusterStats {
             e_PARTITION_SEQUENCE_NUMBER,
             /// Value: Time in nanoseconds it took for replication of a new
             /// entry in journal file.
-            e_PARTITION_REPLICATION_TIME_NS
+            e_PARTITION_REPLICATION_TIME_NS,
+            /// Value: Time in nanoseconds between the write of a message
+            ///        record at primary and its receipt by one replica.
+            e_PARTITION_REPLICA_RECEIPT_TIME_NS,
+            /// Value: Number of records by which a replica's receipt was
+            ///        behind the primary's sequence number.
+            e_PARTITION_REPLICA_LAG,
+            /// Value: Bytes of outstanding messages verified by the background
+            ///        scrubber.
+            e_PARTITION_SCRUB_BYTES,
+            /// Value: Outstanding messages found corrupted by the background
+            ///        scrubber.
+            e_PARTITION_SCRUB_ERRORS
         };
     };
 
@@ -360,6 +390,20 @@ class PartitionStats {
     /// StatContext for the partition
     bsl::shared_ptr<bmqst::StatContext> d_statContext_sp;
 
+    /// Outstanding bytes of the data file, as last reported.
+    bsls::AtomicInt64 d_outstandingDataBytes;
+
+    /// Rate, in bytes per second, at which the data file was written
+    /// between the last two reports.
+    bsls::AtomicInt64 d_dataWriteRate;
+
+    /// Offset of the data file at the last report.
+    bsls::Types::Uint64 d_lastDataOffset;
+
+    /// Time, as returned by `bsls::TimeUtil::getTimer`, of the last report,
+    /// or 0 if none was made yet.
+    bsls::Types::Int64 d_lastReportTime;
+
   private:
     // NOT IMPLEMENTED
     PartitionStats(const PartitionStats&) BSLS_CPP11_DELETED;
@@ -382,13 +426,26 @@ class PartitionStats {
     /// in journal file to the specified `value`.
     void setReplicationTime(bsls::Types::Int64 value);
 
+    /// Report a receipt from one replica, received the specified
+    /// `receiptTime` nanoseconds after the primary wrote the last record it
+    /// acknowledges, while the replica was the specified `sequenceLag`
+    /// records behind the primary.
+    void onReplicaReceipt(bsls::Types::Int64 receiptTime,
+                          bsls::Types::Int64 sequenceLag);
+
+    /// Report that the background scrubber verified the specified
+    /// `numBytes` of outstanding messages, of which the specified
+    /// `numErrors` messages were found corrupted.
+    void onScrubbed(bsls::Types::Int64 numBytes, bsls::Types::Int64 numErrors);
+
     /// Set the primary status of the partition to the specified `value`.
     void setNodeRole(PrimaryStatus::Enum value);
 
     /// Set the partition outstanding bytes of the partition data and journal
     /// files to the corresponding specified `outstandingDataBytes`,
     /// `outstandingJournalBytes`, `offsetDataBytes`, `offsetJournalBytes` and
-    /// `sequenceNumber` values.
+    /// `sequenceNumber` values.  This also updates the load of the partition
+    /// returned by `outstandingDataBytes` and `dataWriteRate`.
     void setPartitionBytes(bsls::Types::Uint64 outstandingDataBytes,
                            bsls::Types::Uint64 outstandingJournalBytes,
                            bsls::Types::Uint64 offsetDataBytes,
@@ -397,6 +454,20 @@ class PartitionStats {
 
     /// Return a pointer to the statcontext.
     bmqst::StatContext* statContext();
+
+    // ACCESSORS
+
+    /// Return the outstanding bytes of the data file of the partition, as
+    /// last reported.
+    ///
+    /// THREAD: This method can be invoked from any thread.
+    bsls::Types::Int64 outstandingDataBytes() const;
+
+    /// Return the rate, in bytes per second, at which the data file of the
+    /// partition was written between the last two reports, or 0 if unknown.
+    ///
+    /// THREAD: This method can be invoked from any thread.
+    bsls::Types::Int64 dataWriteRate() const;
 };
 
 // =======================
@@ -486,6 +557,28 @@ inline void PartitionStats::setReplicationTime(bsls::Types::Int64 value)
         value);
 }
 
+inline void PartitionStats::onReplicaReceipt(bsls::Types::Int64 receiptTime,
+                                             bsls::Types::Int64 sequenceLag)
+{
+    d_statContext_sp->reportValue(
+        ClusterStats::ClusterStatsIndex::e_PARTITION_REPLICA_RECEIPT_TIME_NS,
+        receiptTime);
+    d_statContext_sp->reportValue(
+        ClusterStats::ClusterStatsIndex::e_PARTITION_REPLICA_LAG,
+        sequenceLag);
+}
+
+inline void PartitionStats::onScrubbed(bsls::Types::Int64 numBytes,
+                                       bsls::Types::Int64 numErrors)
+{
+    d_statContext_sp->adjustValue(
+        ClusterStats::ClusterStatsIndex::e_PARTITION_SCRUB_BYTES,
+        numBytes);
+    d_statContext_sp->adjustValue(
+        ClusterStats::ClusterStatsIndex::e_PARTITION_SCRUB_ERRORS,
+        numErrors);
+}
+
 inline void PartitionStats::setNodeRole(PrimaryStatus::Enum value)
 {
     d_statContext_sp->setValue(
@@ -493,33 +586,19 @@ inline void PartitionStats::setNodeRole(PrimaryStatus::Enum value)
         value);
 }
 
-inline void
-PartitionStats::setPartitionBytes(bsls::Types::Uint64 outstandingDataBytes,
-                                  bsls::Types::Uint64 outstandingJournalBytes,
-                                  bsls::Types::Uint64 offsetDataBytes,
-                                  bsls::Types::Uint64 offsetJournalBytes,
-                                  bsls::Types::Uint64 sequenceNumber)
+inline bmqst::StatContext* PartitionStats::statContext()
 {
-    d_statContext_sp->reportValue(
-        ClusterStats::ClusterStatsIndex::e_PARTITION_DATA_BYTES,
-        static_cast<bsls::Types::Int64>(outstandingDataBytes));
-    d_statContext_sp->reportValue(
-        ClusterStats::ClusterStatsIndex::e_PARTITION_JOURNAL_BYTES,
-        static_cast<bsls::Types::Int64>(outstandingJournalBytes));
-    d_statContext_sp->setValue(
-        ClusterStats::ClusterStatsIndex::e_PARTITION_DATA_OFFSET_BYTES,
-        static_cast<bsls::Types::Int64>(offsetDataBytes));
-    d_statContext_sp->setValue(
-        ClusterStats::ClusterStatsIndex::e_PARTITION_JOURNAL_OFFSET_BYTES,
-        static_cast<bsls::Types::Int64>(offsetJournalBytes));
-    d_statContext_sp->setValue(
-        ClusterStats::ClusterStatsIndex::e_PARTITION_SEQUENCE_NUMBER,
-        static_cast<bsls::Types::Int64>(sequenceNumber));
+    return d_statContext_sp.get();
 }
 
-inline bmqst::StatContext* PartitionStats::statContext()
+inline bsls::Types::Int64 PartitionStats::outstandingDataBytes() const
 {
-    return d_statContext_sp.get();
+    return d_outstandingDataBytes.loadRelaxed();
+}
+
+inline bsls::Types::Int64 PartitionStats::dataWriteRate() const
+{
+    return d_dataWriteRate.loadRelaxed();
 }
 
 }  // close package namespace
@@ -161,6 +161,35 @@ bsls::Types::Int64 DispatcherStats::getValue(const bmqst::StatContext& context,
     }
     case Stat::e_QUEUE_TIME_ABS_MAX: {
         return STAT_SINGLE_ABS(absoluteMax, DispatcherStatsIndex::e_STAT_TIME);
+    }
+    case Stat::e_QUEUE_TIME_P50: {
+        const bsls::Types::Int64 p =
+            STAT_RANGE(rangeP50, DispatcherStatsIndex::e_STAT_TIME);
+        return p == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : p;
+    }
+    case Stat::e_QUEUE_TIME_P99: {
+        const bsls::Types::Int64 p =
+            STAT_RANGE(rangeP99, DispatcherStatsIndex::e_STAT_TIME);
+        return p == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : p;
+    }
+    case Stat::e_QUEUE_TIME_P999: {
+        const bsls::Types::Int64 p =
+            STAT_RANGE(rangeP999, DispatcherStatsIndex::e_STAT_TIME);
+        return p == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : p;
+    }
+    case Stat::e_STEAL_COUNT: {
+        return STAT_RANGE(eventsDifference,
+                          DispatcherStatsIndex::e_STAT_STEAL);
+    }
+    case Stat::e_STEAL_BACKLOG_AVG: {
+        const bsls::Types::Int64 avg =
+            STAT_RANGE(averagePerEvent, DispatcherStatsIndex::e_STAT_STEAL);
+        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+    }
+    case Stat::e_STEAL_BACKLOG_MAX: {
+        const bsls::Types::Int64 max =
+            STAT_RANGE(rangeMax, DispatcherStatsIndex::e_STAT_STEAL);
+        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
     }
         CASE_PROCESSING(UNDEFINED)
         CASE_PROCESSING(DISPATCHER)
@@ -220,7 +249,9 @@ DispatcherStatsUtil::initializeStatContext(int               historySize,
         .value("processing_time_replication_receipt",
                bmqst::StatValue::e_DISCRETE)
         .value("queued_count")
-        .value("queued_time", bmqst::StatValue::e_DISCRETE);
+        .value("queued_time", bmqst::StatValue::e_DISCRETE)
+        .valueHistogram()
+        .value("stolen_backlog", bmqst::StatValue::e_DISCRETE);
 
     return bsl::shared_ptr<bmqst::StatContext>(
         new (*allocator) bmqst::StatContext(config, allocator),
@@ -62,6 +62,9 @@ class DispatcherStats {
             e_QUEUE_TIME_AVG     = 6,
             e_QUEUE_TIME_MAX     = 7,
             e_QUEUE_TIME_ABS_MAX = 8,
+            e_QUEUE_TIME_P50     = 9,
+            e_QUEUE_TIME_P99     = 10,
+            e_QUEUE_TIME_P999    = 11,
             e_PROCESSING_TIME_UNDEFINED_MAX,
             e_PROCESSING_TIME_UNDEFINED_AVG,
             e_PROCESSING_TIME_UNDEFINED_SUM,
@@ -114,6 +117,9 @@ class DispatcherStats {
             e_PROCESSING_TIME_REPLICATION_RECEIPT_AVG,
             e_PROCESSING_TIME_REPLICATION_RECEIPT_SUM,
             e_PROCESSED_COUNT_REPLICATION_RECEIPT,
+            e_STEAL_COUNT,
+            e_STEAL_BACKLOG_AVG,
+            e_STEAL_BACKLOG_MAX,
         };
     };
 
@@ -140,6 +146,7 @@ class DispatcherStats {
             /// Other queue metrics
             e_STAT_QUEUE = 13,  // Queue/Dequeue
             e_STAT_TIME  = 14,  // Event queued time
+            e_STAT_STEAL = 15,  // Backlog of the peer a client was stolen from
         };
     };
 
@@ -170,6 +177,13 @@ class DispatcherStats {
                           int                 eventType,
                           bsls::Types::Int64  processedTime);
 
+    /// Update the `stolen_backlog` field of the specified
+    /// `queueStatContext`, corresponding to the processor which took over a
+    /// client from a peer processor having the specified `victimBacklog`
+    /// number of pending events.
+    static void onSteal(bmqst::StatContext* queueStatContext,
+                        bsls::Types::Int64  victimBacklog);
+
   private:
     // NOT IMPLEMENTED
     DispatcherStats(const DispatcherStats&) BSLS_CPP11_DELETED;
@@ -250,6 +264,15 @@ inline void DispatcherStats::onProcess(bmqst::StatContext* queueStatContext,
     queueStatContext->reportValue(eventType, processedTime);
 }
 
+inline void DispatcherStats::onSteal(bmqst::StatContext* queueStatContext,
+                                     bsls::Types::Int64  victimBacklog)
+{
+    BSLS_ASSERT_SAFE(queueStatContext && "Stat context is not initialized");
+
+    queueStatContext->reportValue(DispatcherStatsIndex::e_STAT_STEAL,
+                                  victimBacklog);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -190,16 +190,31 @@ class DomainQueuesVisitor {
         metric(ctx, Stat::e_ACK_ABS);
         metric(ctx, Stat::e_ACK_TIME_AVG);
         metric(ctx, Stat::e_ACK_TIME_MAX);
+        metric(ctx, Stat::e_ACK_TIME_P50);
+        metric(ctx, Stat::e_ACK_TIME_P99);
+        metric(ctx, Stat::e_ACK_TIME_P999);
         metric(ctx, Stat::e_NACK_DELTA);
         metric(ctx, Stat::e_NACK_ABS);
         metric(ctx, Stat::e_CONFIRM_DELTA);
         metric(ctx, Stat::e_CONFIRM_ABS);
         metric(ctx, Stat::e_CONFIRM_TIME_AVG);
         metric(ctx, Stat::e_CONFIRM_TIME_MAX);
+        metric(ctx, Stat::e_CONFIRM_TIME_P50);
+        metric(ctx, Stat::e_CONFIRM_TIME_P99);
+        metric(ctx, Stat::e_CONFIRM_TIME_P999);
         metric(ctx, Stat::e_REJECT_ABS);
         metric(ctx, Stat::e_REJECT_DELTA);
         metric(ctx, Stat::e_QUEUE_TIME_AVG);
         metric(ctx, Stat::e_QUEUE_TIME_MAX);
+        metric(ctx, Stat::e_QUEUE_TIME_P50);
+        metric(ctx, Stat::e_QUEUE_TIME_P99);
+        metric(ctx, Stat::e_QUEUE_TIME_P999);
+        metric(ctx, Stat::e_DISPATCH_TIME_AVG);
+        metric(ctx, Stat::e_DISPATCH_TIME_MAX);
+        metric(ctx, Stat::e_DISPATCH_TIME_P99);
+        metric(ctx, Stat::e_REPLICATION_TIME_AVG);
+        metric(ctx, Stat::e_REPLICATION_TIME_MAX);
+        metric(ctx, Stat::e_REPLICATION_TIME_P99);
         metric(ctx, Stat::e_GC_MSGS_DELTA);
         metric(ctx, Stat::e_GC_MSGS_ABS);
         metric(ctx, Stat::e_ROLE);
@@ -208,6 +223,8 @@ class DomainQueuesVisitor {
         metric(ctx, Stat::e_NO_SC_MSGS_DELTA);
         metric(ctx, Stat::e_NO_SC_MSGS_ABS);
         metric(ctx, Stat::e_HISTORY_ABS);
+        metric(ctx, Stat::e_CPU_TIME_DELTA);
+        metric(ctx, Stat::e_CPU_TIME_ABS);
         d_os << "}" << bsl::endl;
     }
 };
@@ -338,6 +355,11 @@ class ClustersVisitor {
             metric(ctx, Stat::e_PARTITION_SEQUENCE_NUMBER);
             metric(ctx, Stat::e_PARTITION_REPLICATION_TIME_NS_AVG);
             metric(ctx, Stat::e_PARTITION_REPLICATION_TIME_NS_MAX);
+            metric(ctx, Stat::e_PARTITION_REPLICA_RECEIPT_TIME_NS_AVG);
+            metric(ctx, Stat::e_PARTITION_REPLICA_RECEIPT_TIME_NS_MAX);
+            metric(ctx, Stat::e_PARTITION_REPLICA_LAG_MAX);
+            metric(ctx, Stat::e_PARTITION_SCRUB_BYTES);
+            metric(ctx, Stat::e_PARTITION_SCRUB_ERRORS);
         }
         d_os << "}" << bsl::endl;
     }
@@ -97,6 +97,9 @@ struct ConversionUtils {
         populateMetric(&values, ctx, Stat::e_ACK_ABS);
         populateMetric(&values, ctx, Stat::e_ACK_TIME_AVG);
         populateMetric(&values, ctx, Stat::e_ACK_TIME_MAX);
+        populateMetric(&values, ctx, Stat::e_ACK_TIME_P50);
+        populateMetric(&values, ctx, Stat::e_ACK_TIME_P99);
+        populateMetric(&values, ctx, Stat::e_ACK_TIME_P999);
 
         populateMetric(&values, ctx, Stat::e_NACK_DELTA);
         populateMetric(&values, ctx, Stat::e_NACK_ABS);
@@ -105,12 +108,26 @@ struct ConversionUtils {
         populateMetric(&values, ctx, Stat::e_CONFIRM_ABS);
         populateMetric(&values, ctx, Stat::e_CONFIRM_TIME_AVG);
         populateMetric(&values, ctx, Stat::e_CONFIRM_TIME_MAX);
+        populateMetric(&values, ctx, Stat::e_CONFIRM_TIME_P50);
+        populateMetric(&values, ctx, Stat::e_CONFIRM_TIME_P99);
+        populateMetric(&values, ctx, Stat::e_CONFIRM_TIME_P999);
 
         populateMetric(&values, ctx, Stat::e_REJECT_ABS);
         populateMetric(&values, ctx, Stat::e_REJECT_DELTA);
 
         populateMetric(&values, ctx, Stat::e_QUEUE_TIME_AVG);
         populateMetric(&values, ctx, Stat::e_QUEUE_TIME_MAX);
+        populateMetric(&values, ctx, Stat::e_QUEUE_TIME_P50);
+        populateMetric(&values, ctx, Stat::e_QUEUE_TIME_P99);
+        populateMetric(&values, ctx, Stat::e_QUEUE_TIME_P999);
+
+        populateMetric(&values, ctx, Stat::e_DISPATCH_TIME_AVG);
+        populateMetric(&values, ctx, Stat::e_DISPATCH_TIME_MAX);
+        populateMetric(&values, ctx, Stat::e_DISPATCH_TIME_P99);
+
+        populateMetric(&values, ctx, Stat::e_REPLICATION_TIME_AVG);
+        populateMetric(&values, ctx, Stat::e_REPLICATION_TIME_MAX);
+        populateMetric(&values, ctx, Stat::e_REPLICATION_TIME_P99);
 
         populateMetric(&values, ctx, Stat::e_GC_MSGS_DELTA);
         populateMetric(&values, ctx, Stat::e_GC_MSGS_ABS);
@@ -124,6 +141,9 @@ struct ConversionUtils {
         populateMetric(&values, ctx, Stat::e_NO_SC_MSGS_ABS);
 
         populateMetric(&values, ctx, Stat::e_HISTORY_ABS);
+
+        populateMetric(&values, ctx, Stat::e_CPU_TIME_DELTA);
+        populateMetric(&values, ctx, Stat::e_CPU_TIME_ABS);
     }
 
     inline static void populateOneDomainStats(bdljsn::JsonObject* domainObject,
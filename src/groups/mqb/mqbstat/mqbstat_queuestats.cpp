@@ -41,12 +41,14 @@
 #include <bdld_datummapbuilder.h>
 #include <bdld_manageddatum.h>
 #include <bdlma_localsequentialallocator.h>
+#include <bsl_algorithm.h>
 #include <bsl_limits.h>
 #include <bsl_ostream.h>
 #include <bsl_utility.h>
 #include <bsl_vector.h>
 #include <bslmf_movableref.h>
 #include <bsls_assert.h>
+#include <bsls_timeutil.h>
 
 namespace BloombergLP {
 namespace mqbstat {
@@ -74,6 +76,10 @@ const bsls::Types::Int64 k_NS_PER_MESSAGE =
 /// compute utilization.
 const bsls::Types::Int64 k_UNDEFINED_UTILIZATION_VALUE = 0;
 
+/// Number of per-appId events between two checks of the time of the last
+/// ranking of the appIds.
+const int k_RANKING_CHECK_PERIOD = 64;
+
 // ------------------
 // struct ClientStats
 // ------------------
@@ -96,7 +102,12 @@ struct ClientStats {
         /// Value:      Accumulated bytes of all messages ever pushed to
         ///             the client
         /// Increments: Number of messages ever pushed to the client
-        e_STAT_PUSH
+        e_STAT_PUSH,
+
+        /// Value:      Accumulated thread CPU time spent by the dispatcher
+        ///             processing events of the client session (in
+        ///             nanoseconds)
+        e_STAT_CPU_TIME
     };
 };
 
@@ -142,16 +153,31 @@ const char* QueueStatsDomain::Stat::toString(Stat::Enum value)
         MQBSTAT_CASE(e_ACK_ABS, "queue_ack_msgs_abs")
         MQBSTAT_CASE(e_ACK_TIME_AVG, "queue_ack_time_avg")
         MQBSTAT_CASE(e_ACK_TIME_MAX, "queue_ack_time_max")
+        MQBSTAT_CASE(e_ACK_TIME_P50, "queue_ack_time_p50")
+        MQBSTAT_CASE(e_ACK_TIME_P99, "queue_ack_time_p99")
+        MQBSTAT_CASE(e_ACK_TIME_P999, "queue_ack_time_p999")
         MQBSTAT_CASE(e_NACK_DELTA, "queue_nack_msgs")
         MQBSTAT_CASE(e_NACK_ABS, "queue_nack_msgs_abs")
         MQBSTAT_CASE(e_CONFIRM_DELTA, "queue_confirm_msgs")
         MQBSTAT_CASE(e_CONFIRM_ABS, "queue_confirm_msgs_abs")
         MQBSTAT_CASE(e_CONFIRM_TIME_AVG, "queue_confirm_time_avg")
         MQBSTAT_CASE(e_CONFIRM_TIME_MAX, "queue_confirm_time_max")
+        MQBSTAT_CASE(e_CONFIRM_TIME_P50, "queue_confirm_time_p50")
+        MQBSTAT_CASE(e_CONFIRM_TIME_P99, "queue_confirm_time_p99")
+        MQBSTAT_CASE(e_CONFIRM_TIME_P999, "queue_confirm_time_p999")
         MQBSTAT_CASE(e_REJECT_ABS, "queue_reject_msgs_abs")
         MQBSTAT_CASE(e_REJECT_DELTA, "queue_reject_msgs")
         MQBSTAT_CASE(e_QUEUE_TIME_AVG, "queue_queue_time_avg")
         MQBSTAT_CASE(e_QUEUE_TIME_MAX, "queue_queue_time_max")
+        MQBSTAT_CASE(e_QUEUE_TIME_P50, "queue_queue_time_p50")
+        MQBSTAT_CASE(e_QUEUE_TIME_P99, "queue_queue_time_p99")
+        MQBSTAT_CASE(e_QUEUE_TIME_P999, "queue_queue_time_p999")
+        MQBSTAT_CASE(e_DISPATCH_TIME_AVG, "queue_dispatch_time_avg")
+        MQBSTAT_CASE(e_DISPATCH_TIME_MAX, "queue_dispatch_time_max")
+        MQBSTAT_CASE(e_DISPATCH_TIME_P99, "queue_dispatch_time_p99")
+        MQBSTAT_CASE(e_REPLICATION_TIME_AVG, "queue_replication_time_avg")
+        MQBSTAT_CASE(e_REPLICATION_TIME_MAX, "queue_replication_time_max")
+        MQBSTAT_CASE(e_REPLICATION_TIME_P99, "queue_replication_time_p99")
         MQBSTAT_CASE(e_GC_MSGS_DELTA, "queue_gc_msgs")
         MQBSTAT_CASE(e_GC_MSGS_ABS, "queue_gc_msgs_abs")
         MQBSTAT_CASE(e_ROLE, "queue_role")
@@ -160,6 +186,8 @@ const char* QueueStatsDomain::Stat::toString(Stat::Enum value)
         MQBSTAT_CASE(e_NO_SC_MSGS_DELTA, "queue_nack_noquorum_msgs")
         MQBSTAT_CASE(e_NO_SC_MSGS_ABS, "queue_nack_noquorum_msgs_abs")
         MQBSTAT_CASE(e_HISTORY_ABS, "queue_history_abs")
+        MQBSTAT_CASE(e_CPU_TIME_DELTA, "queue_cpu_time")
+        MQBSTAT_CASE(e_CPU_TIME_ABS, "queue_cpu_time_abs")
     default:
         BSLS_ASSERT(false && "invalid enumerator");
         BSLS_ASSERT_INVOKE_NORETURN("");
@@ -171,19 +199,33 @@ const char* QueueStatsDomain::Stat::toString(Stat::Enum value)
 // class QueueStatsDomain
 // ----------------------
 
-inline bmqst::StatContext*
-QueueStatsDomain::findAppIdContext(const bsl::string& appId) const
+const char QueueStatsDomain::k_OTHER_APP_IDS[] = "__other__";
+
+const bsls::Types::Int64 QueueStatsDomain::k_RANKING_INTERVAL =
+    10 * bdlt::TimeUnitRatio::k_NANOSECONDS_PER_SECOND;
+
+QueueStatsDomain::AppIdStats::AppIdStats()
+: d_context_p(0)
+, d_holderIt()
+, d_numMessages(0)
+, d_numBytes(0)
+, d_numDelivered(0)
+{
+    // NOTHING
+}
+
+inline QueueStatsDomain::AppIdStats*
+QueueStatsDomain::findAppIdStats(const bsl::string& appId)
 {
     BSLS_ASSERT_SAFE(d_statContext_mp && "initialize was not called");
     if (d_subContextsLookup.empty()) {
         return 0;  // RETURN
     }
 
-    bsl::unordered_map<bsl::string, bmqst::StatContext*>::const_iterator it =
-        d_subContextsLookup.find(appId);
+    AppIdStatsMap::iterator it = d_subContextsLookup.find(appId);
 
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(it ==
-                                              d_subContextsLookup.cend())) {
+                                              d_subContextsLookup.end())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
         BALL_LOG_SET_CATEGORY(k_LOG_CATEGORY);
@@ -193,7 +235,59 @@ QueueStatsDomain::findAppIdContext(const bsl::string& appId) const
         return 0;  // RETURN
     }
 
-    return it->second;
+    return &it->second;
+}
+
+inline bmqst::StatContext*
+QueueStatsDomain::appIdContext(const AppIdStats& stats) const
+{
+    BSLS_ASSERT_SAFE(stats.d_context_p || d_otherSubContext_mp);
+
+    return stats.d_context_p ? stats.d_context_p : d_otherSubContext_mp.get();
+}
+
+void QueueStatsDomain::setAppIdBacklog(AppIdStats*        stats,
+                                       bsls::Types::Int64 numMessages,
+                                       bsls::Types::Int64 numBytes)
+{
+    if (stats->d_context_p) {
+        stats->d_context_p->setValue(DomainQueueStats::e_STAT_BYTES,
+                                     numBytes);
+        stats->d_context_p->setValue(DomainQueueStats::e_STAT_MESSAGES,
+                                     numMessages);
+    }
+    else {
+        // The aggregated backlog is the sum of the backlogs.
+        d_otherSubContext_mp->adjustValue(DomainQueueStats::e_STAT_BYTES,
+                                          numBytes - stats->d_numBytes);
+        d_otherSubContext_mp->adjustValue(DomainQueueStats::e_STAT_MESSAGES,
+                                          numMessages - stats->d_numMessages);
+    }
+
+    stats->d_numMessages = numMessages;
+    stats->d_numBytes    = numBytes;
+}
+
+void QueueStatsDomain::rankAppIdsIfDue()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+            d_maxAppIdContexts == 0 ||
+            d_subContextsLookup.size() <=
+                static_cast<size_t>(d_maxAppIdContexts))) {
+        // Every appId has its own subcontext.
+        return;  // RETURN
+    }
+
+    if (++d_numEventsSinceRanking < k_RANKING_CHECK_PERIOD) {
+        return;  // RETURN
+    }
+    d_numEventsSinceRanking = 0;
+
+    if (bsls::TimeUtil::getTimer() - d_lastRankingTime < k_RANKING_INTERVAL) {
+        return;  // RETURN
+    }
+
+    rankAppIds();
 }
 
 bsls::Types::Int64
@@ -286,6 +380,21 @@ QueueStatsDomain::getValue(const bmqst::StatContext& context,
             STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_ACK_TIME);
         return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
     }
+    case QueueStatsDomain::Stat::e_ACK_TIME_P50: {
+        const bsls::Types::Int64 p =
+            STAT_RANGE(rangeP50, DomainQueueStats::e_STAT_ACK_TIME);
+        return p == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : p;
+    }
+    case QueueStatsDomain::Stat::e_ACK_TIME_P99: {
+        const bsls::Types::Int64 p =
+            STAT_RANGE(rangeP99, DomainQueueStats::e_STAT_ACK_TIME);
+        return p == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : p;
+    }
+    case QueueStatsDomain::Stat::e_ACK_TIME_P999: {
+        const bsls::Types::Int64 p =
+            STAT_RANGE(rangeP999, DomainQueueStats::e_STAT_ACK_TIME);
+        return p == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : p;
+    }
     case QueueStatsDomain::Stat::e_NACK_ABS: {
         return STAT_SINGLE(value, DomainQueueStats::e_STAT_NACK);
     }
@@ -305,6 +414,21 @@ QueueStatsDomain::getValue(const bmqst::StatContext& context,
             STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_CONFIRM_TIME);
         return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
     }
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P50: {
+        const bsls::Types::Int64 p =
+            STAT_RANGE(rangeP50, DomainQueueStats::e_STAT_CONFIRM_TIME);
+        return p == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : p;
+    }
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P99: {
+        const bsls::Types::Int64 p =
+            STAT_RANGE(rangeP99, DomainQueueStats::e_STAT_CONFIRM_TIME);
+        return p == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : p;
+    }
+    case QueueStatsDomain::Stat::e_CONFIRM_TIME_P999: {
+        const bsls::Types::Int64 p =
+            STAT_RANGE(rangeP999, DomainQueueStats::e_STAT_CONFIRM_TIME);
+        return p == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : p;
+    }
     case QueueStatsDomain::Stat::e_QUEUE_TIME_AVG: {
         const bsls::Types::Int64 avg =
             STAT_RANGE(averagePerEvent, DomainQueueStats::e_STAT_QUEUE_TIME);
@@ -315,6 +439,51 @@ QueueStatsDomain::getValue(const bmqst::StatContext& context,
             STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_QUEUE_TIME);
         return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
     }
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P50: {
+        const bsls::Types::Int64 p =
+            STAT_RANGE(rangeP50, DomainQueueStats::e_STAT_QUEUE_TIME);
+        return p == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : p;
+    }
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P99: {
+        const bsls::Types::Int64 p =
+            STAT_RANGE(rangeP99, DomainQueueStats::e_STAT_QUEUE_TIME);
+        return p == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : p;
+    }
+    case QueueStatsDomain::Stat::e_QUEUE_TIME_P999: {
+        const bsls::Types::Int64 p =
+            STAT_RANGE(rangeP999, DomainQueueStats::e_STAT_QUEUE_TIME);
+        return p == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : p;
+    }
+    case QueueStatsDomain::Stat::e_DISPATCH_TIME_AVG: {
+        const bsls::Types::Int64 avg =
+            STAT_RANGE(averagePerEvent, DomainQueueStats::e_STAT_DISPATCH_TIME);
+        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+    }
+    case QueueStatsDomain::Stat::e_DISPATCH_TIME_MAX: {
+        const bsls::Types::Int64 max =
+            STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_DISPATCH_TIME);
+        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
+    }
+    case QueueStatsDomain::Stat::e_DISPATCH_TIME_P99: {
+        const bsls::Types::Int64 p =
+            STAT_RANGE(rangeP99, DomainQueueStats::e_STAT_DISPATCH_TIME);
+        return p == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : p;
+    }
+    case QueueStatsDomain::Stat::e_REPLICATION_TIME_AVG: {
+        const bsls::Types::Int64 avg =
+            STAT_RANGE(averagePerEvent, DomainQueueStats::e_STAT_REPLICATION_TIME);
+        return avg == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : avg;
+    }
+    case QueueStatsDomain::Stat::e_REPLICATION_TIME_MAX: {
+        const bsls::Types::Int64 max =
+            STAT_RANGE(rangeMax, DomainQueueStats::e_STAT_REPLICATION_TIME);
+        return max == bsl::numeric_limits<bsls::Types::Int64>::min() ? 0 : max;
+    }
+    case QueueStatsDomain::Stat::e_REPLICATION_TIME_P99: {
+        const bsls::Types::Int64 p =
+            STAT_RANGE(rangeP99, DomainQueueStats::e_STAT_REPLICATION_TIME);
+        return p == bsl::numeric_limits<bsls::Types::Int64>::max() ? 0 : p;
+    }
     case QueueStatsDomain::Stat::e_GC_MSGS_ABS: {
         return STAT_SINGLE(value, DomainQueueStats::e_STAT_GC_MSGS);
     }
@@ -370,6 +539,12 @@ QueueStatsDomain::getValue(const bmqst::StatContext& context,
     case QueueStatsDomain::Stat::e_HISTORY_ABS: {
         return STAT_SINGLE(value, DomainQueueStats::e_STAT_HISTORY);
     }
+    case QueueStatsDomain::Stat::e_CPU_TIME_DELTA: {
+        return STAT_RANGE(valueDifference, DomainQueueStats::e_STAT_CPU_TIME);
+    }
+    case QueueStatsDomain::Stat::e_CPU_TIME_ABS: {
+        return STAT_SINGLE(value, DomainQueueStats::e_STAT_CPU_TIME);
+    }
     default: {
         BSLS_ASSERT_SAFE(false && "Attempting to access an unknown stat");
     }
@@ -386,6 +561,10 @@ QueueStatsDomain::QueueStatsDomain(bslma::Allocator* allocator)
 , d_statContext_mp(0)
 , d_subContextsHolder(d_allocator_p)
 , d_subContextsLookup(d_allocator_p)
+, d_otherSubContext_mp(0)
+, d_maxAppIdContexts(0)
+, d_numEventsSinceRanking(0)
+, d_lastRankingTime(0)
 {
     // NOTHING
 }
@@ -440,18 +619,8 @@ void QueueStatsDomain::initialize(const bmqt::Uri& uri, mqbi::Domain* domain)
     bsl::shared_ptr<const mqbconfm::Domain> domainCfg = domain->config();
     if (domainCfg->mode().isFanoutValue() &&
         domainCfg->mode().fanout().publishAppIdMetrics()) {
-        const bsl::vector<bsl::string>& appIDs =
-            domainCfg->mode().fanout().appIDs();
-        for (bsl::vector<bsl::string>::const_iterator cit = appIDs.begin();
-             cit != appIDs.end();
-             ++cit) {
-            StatSubContextMp subContext = d_statContext_mp->addSubcontext(
-                bmqst::StatContextConfiguration(*cit, &localAllocator));
-
-            d_subContextsLookup.insert(bsl::make_pair(*cit, subContext.get()));
-            d_subContextsHolder.emplace_back(
-                bslmf::MovableRefUtil::move(subContext));
-        }
+        updateDomainAppIds(domainCfg->mode().fanout().appIDs(),
+                           domainCfg->mode().fanout().maxAppIdMetrics());
     }
 }
 
@@ -481,15 +650,16 @@ void QueueStatsDomain::setOutstandingData(bsls::Types::Int64 numMessages,
 {
     BSLS_ASSERT_SAFE(d_statContext_mp && "initialize was not called");
 
-    bmqst::StatContext* appIdContext = findAppIdContext(appId);
-    if (0 == appIdContext) {
+    AppIdStats* appIdStats = findAppIdStats(appId);
+    if (0 == appIdStats) {
         // No subcontext for appId is a normal scenario when metrics for this
         // appId are disabled by configuration.
         return;  // RETURN
     }
 
-    appIdContext->setValue(DomainQueueStats::e_STAT_BYTES, numBytes);
-    appIdContext->setValue(DomainQueueStats::e_STAT_MESSAGES, numMessages);
+    setAppIdBacklog(appIdStats, numMessages, numBytes);
+
+    rankAppIdsIfDue();
 }
 
 void QueueStatsDomain::onEvent(EventType::Enum    type,
@@ -498,13 +668,15 @@ void QueueStatsDomain::onEvent(EventType::Enum    type,
 {
     BSLS_ASSERT_SAFE(d_statContext_mp && "initialize was not called");
 
-    bmqst::StatContext* appIdContext = findAppIdContext(appId);
-    if (0 == appIdContext) {
+    AppIdStats* appIdStats = findAppIdStats(appId);
+    if (0 == appIdStats) {
         // No subcontext for appId is a normal scenario when metrics for this
         // appId are disabled by configuration.
         return;  // RETURN
     }
 
+    bmqst::StatContext* appIdContext = this->appIdContext(*appIdStats);
+
     switch (type) {
     case EventType::e_CONFIRM_TIME: {
         appIdContext->reportValue(DomainQueueStats::e_STAT_CONFIRM_TIME,
@@ -512,26 +684,32 @@ void QueueStatsDomain::onEvent(EventType::Enum    type,
     } break;
     case EventType::e_QUEUE_TIME: {
         appIdContext->reportValue(DomainQueueStats::e_STAT_QUEUE_TIME, value);
+        ++appIdStats->d_numDelivered;
     } break;
     case EventType::e_ADD_MESSAGE: {
         appIdContext->adjustValue(DomainQueueStats::e_STAT_BYTES, value);
         appIdContext->adjustValue(DomainQueueStats::e_STAT_MESSAGES, 1);
+        appIdStats->d_numBytes += value;
+        ++appIdStats->d_numMessages;
     } break;
     case EventType::e_DEL_MESSAGE: {
         appIdContext->adjustValue(DomainQueueStats::e_STAT_BYTES, -value);
         appIdContext->adjustValue(DomainQueueStats::e_STAT_MESSAGES, -1);
+        appIdStats->d_numBytes -= value;
+        --appIdStats->d_numMessages;
     } break;
     case EventType::e_PURGE: {
         // NOTE: Setting the value like that will cause weird results if using
         //       the stat to get rates
-        appIdContext->setValue(DomainQueueStats::e_STAT_BYTES, 0);
-        appIdContext->setValue(DomainQueueStats::e_STAT_MESSAGES, 0);
+        setAppIdBacklog(appIdStats, 0, 0);
     } break;
 
     // Some of these event types make no sense per appId and should be reported
     // per entire queue instead
     case EventType::e_ACK: BSLA_FALLTHROUGH;
     case EventType::e_ACK_TIME: BSLA_FALLTHROUGH;
+    case EventType::e_DISPATCH_TIME: BSLA_FALLTHROUGH;
+    case EventType::e_REPLICATION_TIME: BSLA_FALLTHROUGH;
     case EventType::e_NACK: BSLA_FALLTHROUGH;
     case EventType::e_CONFIRM: BSLA_FALLTHROUGH;
     case EventType::e_REJECT: BSLA_FALLTHROUGH;
@@ -542,7 +720,8 @@ void QueueStatsDomain::onEvent(EventType::Enum    type,
     case EventType::e_CFG_MSGS: BSLA_FALLTHROUGH;
     case EventType::e_CFG_BYTES: BSLA_FALLTHROUGH;
     case EventType::e_NO_SC_MESSAGE: BSLA_FALLTHROUGH;
-    case EventType::e_UPDATE_HISTORY: {
+    case EventType::e_UPDATE_HISTORY: BSLA_FALLTHROUGH;
+    case EventType::e_CPU_TIME: {
         BSLS_ASSERT_SAFE(false && "Unexpected event type for appId metric");
     } break;
 
@@ -550,14 +729,22 @@ void QueueStatsDomain::onEvent(EventType::Enum    type,
         BSLS_ASSERT_SAFE(false && "Unknown event type");
     } break;
     };
+
+    rankAppIdsIfDue();
 }
 
 void QueueStatsDomain::updateDomainAppIds(
-    const bsl::vector<bsl::string>& appIds)
+    const bsl::vector<bsl::string>& appIds,
+    int                             maxAppIdContexts)
 {
+    BSLS_ASSERT_SAFE(maxAppIdContexts >= 0);
+
+    d_maxAppIdContexts = maxAppIdContexts;
+
     if (appIds.empty()) {
         d_subContextsLookup.clear();
         d_subContextsHolder.clear();
+        d_otherSubContext_mp.reset();
         return;  // RETURN
     }
 
@@ -566,43 +753,135 @@ void QueueStatsDomain::updateDomainAppIds(
                                                     d_allocator_p);
 
     // 1. Remove subcontexts for unneeded appIds
-    bsl::list<StatSubContextMp>::iterator it = d_subContextsHolder.begin();
-    while (it != d_subContextsHolder.end()) {
-        const bsl::string& ctxAppId = it->get()->name();
+    AppIdStatsMap::iterator it = d_subContextsLookup.begin();
+    while (it != d_subContextsLookup.end()) {
         bsl::unordered_set<bsl::string>::const_iterator sIt =
-            remainingAppIds.find(ctxAppId);
+            remainingAppIds.find(it->first);
         if (sIt == remainingAppIds.end()) {
-            // Subcontext for this appId is no longer needed, remove it from
-            // the holder and lookup table
-            d_subContextsLookup.erase(ctxAppId);
-            it = d_subContextsHolder.erase(it);
+            // This appId is no longer needed, remove it from the lookup
+            // table, and its subcontext (if any) from the holder
+            if (it->second.d_context_p) {
+                d_subContextsHolder.erase(it->second.d_holderIt);
+            }
+            else {
+                setAppIdBacklog(&it->second, 0, 0);
+            }
+            it = d_subContextsLookup.erase(it);
         }
         else {
-            // This appId is needed, but the stat context is already built for
-            // it
+            // This appId is needed, and its state is already built
             remainingAppIds.erase(sIt);
             ++it;
         }
     }
 
-    if (remainingAppIds.empty()) {
-        return;  // RETURN
-    }
-
     // 2. Add the remaining appIds
-    bdlma::LocalSequentialAllocator<2048> localAllocator(d_allocator_p);
-
     for (bsl::unordered_set<bsl::string>::const_iterator sIt =
              remainingAppIds.begin();
          sIt != remainingAppIds.end();
          sIt++) {
-        StatSubContextMp subContext = d_statContext_mp->addSubcontext(
-            bmqst::StatContextConfiguration(*sIt, &localAllocator));
+        d_subContextsLookup.insert(bsl::make_pair(*sIt, AppIdStats()));
+    }
 
-        d_subContextsLookup.insert(bsl::make_pair(*sIt, subContext.get()));
-        d_subContextsHolder.emplace_back(
-            bslmf::MovableRefUtil::move(subContext));
+    // 3. Decide which appIds get a subcontext
+    rankAppIds();
+}
+
+void QueueStatsDomain::rankAppIds()
+{
+    BSLS_ASSERT_SAFE(d_statContext_mp && "initialize was not called");
+
+    typedef bsl::vector<AppIdStatsMap::value_type*> Ranking;
+
+    d_numEventsSinceRanking = 0;
+    d_lastRankingTime       = bsls::TimeUtil::getTimer();
+
+    Ranking ranking(d_allocator_p);
+    ranking.reserve(d_subContextsLookup.size());
+    for (AppIdStatsMap::iterator it = d_subContextsLookup.begin();
+         it != d_subContextsLookup.end();
+         ++it) {
+        ranking.push_back(&*it);
+    }
+
+    size_t numContexts = ranking.size();
+    if (d_maxAppIdContexts > 0 &&
+        static_cast<size_t>(d_maxAppIdContexts) < numContexts) {
+        numContexts = d_maxAppIdContexts;
+
+        struct Ranker {
+            static bool isHigher(const AppIdStatsMap::value_type* lhs,
+                                 const AppIdStatsMap::value_type* rhs)
+            {
+                if (lhs->second.d_numMessages != rhs->second.d_numMessages) {
+                    return lhs->second.d_numMessages >
+                           rhs->second.d_numMessages;  // RETURN
+                }
+                if (lhs->second.d_numDelivered !=
+                    rhs->second.d_numDelivered) {
+                    return lhs->second.d_numDelivered >
+                           rhs->second.d_numDelivered;  // RETURN
+                }
+                return lhs->first < rhs->first;
+            }
+        };
+
+        bsl::nth_element(ranking.begin(),
+                         ranking.begin() + numContexts,
+                         ranking.end(),
+                         &Ranker::isHigher);
+    }
+
+    // Release the subcontexts of the appIds which lost their rank before
+    // creating the new ones, so that there is never more than the maximum.
+    bdlma::LocalSequentialAllocator<2048> localAllocator(d_allocator_p);
+    bsls::Types::Int64                    otherNumMessages = 0;
+    bsls::Types::Int64                    otherNumBytes    = 0;
+
+    for (size_t i = numContexts; i < ranking.size(); ++i) {
+        AppIdStats& stats = ranking[i]->second;
+        if (stats.d_context_p) {
+            d_subContextsHolder.erase(stats.d_holderIt);
+            stats.d_context_p = 0;
+        }
+        stats.d_numDelivered = 0;
+        otherNumMessages += stats.d_numMessages;
+        otherNumBytes += stats.d_numBytes;
     }
+
+    for (size_t i = 0; i < numContexts; ++i) {
+        AppIdStats& stats = ranking[i]->second;
+        if (!stats.d_context_p) {
+            StatSubContextMp subContext = d_statContext_mp->addSubcontext(
+                bmqst::StatContextConfiguration(ranking[i]->first,
+                                                &localAllocator));
+            d_subContextsHolder.emplace_back(
+                bslmf::MovableRefUtil::move(subContext));
+
+            stats.d_holderIt  = --d_subContextsHolder.end();
+            stats.d_context_p = stats.d_holderIt->get();
+            stats.d_context_p->setValue(DomainQueueStats::e_STAT_BYTES,
+                                        stats.d_numBytes);
+            stats.d_context_p->setValue(DomainQueueStats::e_STAT_MESSAGES,
+                                        stats.d_numMessages);
+        }
+        stats.d_numDelivered = 0;
+    }
+
+    if (numContexts == ranking.size()) {
+        d_otherSubContext_mp.reset();
+        return;  // RETURN
+    }
+
+    if (!d_otherSubContext_mp) {
+        d_otherSubContext_mp = d_statContext_mp->addSubcontext(
+            bmqst::StatContextConfiguration(k_OTHER_APP_IDS,
+                                            &localAllocator));
+    }
+    d_otherSubContext_mp->setValue(DomainQueueStats::e_STAT_BYTES,
+                                   otherNumBytes);
+    d_otherSubContext_mp->setValue(DomainQueueStats::e_STAT_MESSAGES,
+                                   otherNumMessages);
 }
 
 // -----------------------------
@@ -715,6 +994,15 @@ QueueStatsClient::getValue(const bmqst::StatContext& context,
 #undef STAT_SINGLE
 }
 
+void QueueStatsClient::onCpuTime(bmqst::StatContext* clientStatContext,
+                                 bsls::Types::Int64  cpuTimeNs)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(clientStatContext);
+
+    clientStatContext->adjustValue(ClientStats::e_STAT_CPU_TIME, cpuTimeNs);
+}
+
 QueueStatsClient::QueueStatsClient()
 : d_statContext_mp(0)
 {
@@ -782,21 +1070,33 @@ QueueStatsUtil::initializeStatContextDomains(int               historySize,
         .value("messages")
         .value("bytes")
         .value("ack")
+        .valueSharded()
         .value("ack_time", bmqst::StatValue::e_DISCRETE)
+        .valueHistogram()
         .value("nack")
         .value("confirm")
+        .valueSharded()
         .value("confirm_time", bmqst::StatValue::e_DISCRETE)
+        .valueHistogram()
         .value("reject")
         .value("queue_time", bmqst::StatValue::e_DISCRETE)
+        .valueHistogram()
+        .value("dispatch_time", bmqst::StatValue::e_DISCRETE)
+        .valueHistogram()
+        .value("replication_time", bmqst::StatValue::e_DISCRETE)
+        .valueHistogram()
         .value("gc")
         .value("push")
+        .valueSharded()
         .value("put")
+        .valueSharded()
         .value("role")
         .value("cfg_msgs")
         .value("cfg_bytes")
         .value("content_msgs")
         .value("content_bytes")
-        .value("history_size");
+        .value("history_size")
+        .value("cpu_time");
     // NOTE: If the stats are using too much memory, we could reconsider
     //       nb_producer, nb_consumer, messages and bytes to be using atomic
     //       int and not stat value.
@@ -819,9 +1119,14 @@ QueueStatsUtil::initializeStatContextClients(int               historySize,
         .statValueAllocator(allocator)
         .storeExpiredSubcontextValues(true)
         .value("ack")
+        .valueSharded()
         .value("confirm")
+        .valueSharded()
         .value("push")
-        .value("put");
+        .valueSharded()
+        .value("put")
+        .valueSharded()
+        .value("cpu_time");
     // NOTE: If the stats are using too much memory, we could reconsider
     //       in_event and out_event to be using atomic int and not stat value.
 
@@ -922,6 +1227,16 @@ void QueueStatsUtil::initializeTableAndTipDomains(
                      bmqst::StatUtil::rangeMax,
                      start,
                      end);
+    schema.addColumn("ack_time_p50",
+                     DomainQueueStats::e_STAT_ACK_TIME,
+                     bmqst::StatUtil::rangeP50,
+                     start,
+                     end);
+    schema.addColumn("ack_time_p99",
+                     DomainQueueStats::e_STAT_ACK_TIME,
+                     bmqst::StatUtil::rangeP99,
+                     start,
+                     end);
     schema.addColumn("nack_delta",
                      DomainQueueStats::e_STAT_NACK,
                      bmqst::StatUtil::valueDifference,
@@ -950,6 +1265,16 @@ void QueueStatsUtil::initializeTableAndTipDomains(
                      bmqst::StatUtil::rangeMax,
                      start,
                      end);
+    schema.addColumn("confirm_time_p50",
+                     DomainQueueStats::e_STAT_CONFIRM_TIME,
+                     bmqst::StatUtil::rangeP50,
+                     start,
+                     end);
+    schema.addColumn("confirm_time_p99",
+                     DomainQueueStats::e_STAT_CONFIRM_TIME,
+                     bmqst::StatUtil::rangeP99,
+                     start,
+                     end);
     schema.addColumn("reject_delta",
                      DomainQueueStats::e_STAT_REJECT,
                      bmqst::StatUtil::valueDifference,
@@ -969,6 +1294,46 @@ void QueueStatsUtil::initializeTableAndTipDomains(
                      bmqst::StatUtil::rangeMax,
                      start,
                      end);
+    schema.addColumn("queue_time_p50",
+                     DomainQueueStats::e_STAT_QUEUE_TIME,
+                     bmqst::StatUtil::rangeP50,
+                     start,
+                     end);
+    schema.addColumn("queue_time_p99",
+                     DomainQueueStats::e_STAT_QUEUE_TIME,
+                     bmqst::StatUtil::rangeP99,
+                     start,
+                     end);
+    schema.addColumn("dispatch_time_avg",
+                     DomainQueueStats::e_STAT_DISPATCH_TIME,
+                     bmqst::StatUtil::averagePerEvent,
+                     start,
+                     end);
+    schema.addColumn("dispatch_time_max",
+                     DomainQueueStats::e_STAT_DISPATCH_TIME,
+                     bmqst::StatUtil::rangeMax,
+                     start,
+                     end);
+    schema.addColumn("dispatch_time_p99",
+                     DomainQueueStats::e_STAT_DISPATCH_TIME,
+                     bmqst::StatUtil::rangeP99,
+                     start,
+                     end);
+    schema.addColumn("replication_time_avg",
+                     DomainQueueStats::e_STAT_REPLICATION_TIME,
+                     bmqst::StatUtil::averagePerEvent,
+                     start,
+                     end);
+    schema.addColumn("replication_time_max",
+                     DomainQueueStats::e_STAT_REPLICATION_TIME,
+                     bmqst::StatUtil::rangeMax,
+                     start,
+                     end);
+    schema.addColumn("replication_time_p99",
+                     DomainQueueStats::e_STAT_REPLICATION_TIME,
+                     bmqst::StatUtil::rangeP99,
+                     start,
+                     end);
     schema.addColumn("gc_msgs_delta",
                      DomainQueueStats::e_STAT_GC_MSGS,
                      bmqst::StatUtil::valueDifference,
@@ -987,6 +1352,15 @@ void QueueStatsUtil::initializeTableAndTipDomains(
                      DomainQueueStats::e_STAT_NO_SC_MSGS,
                      bmqst::StatUtil::value,
                      start);
+    schema.addColumn("cpu_time_delta",
+                     DomainQueueStats::e_STAT_CPU_TIME,
+                     bmqst::StatUtil::valueDifference,
+                     start,
+                     end);
+    schema.addColumn("cpu_time_abs",
+                     DomainQueueStats::e_STAT_CPU_TIME,
+                     bmqst::StatUtil::value,
+                     start);
 
     // Configure records
     bmqst::TableRecords& records = table->records();
@@ -1031,6 +1405,42 @@ void QueueStatsUtil::initializeTableAndTipDomains(
         .zeroString("")
         .extremeValueString("")
         .printAsNsTimeInterval();
+    tip->addColumn("queue_time_p50", "p50")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("queue_time_p99", "p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+
+    tip->setColumnGroup("Dispatch Time");
+    tip->addColumn("dispatch_time_avg", "avg")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("dispatch_time_max", "max")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("dispatch_time_p99", "p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+
+    tip->setColumnGroup("Replication Time");
+    tip->addColumn("replication_time_avg", "avg")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("replication_time_max", "max")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("replication_time_p99", "p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
 
     tip->setColumnGroup("Ack");
     tip->addColumn("ack_delta", "delta").zeroString("");
@@ -1043,6 +1453,14 @@ void QueueStatsUtil::initializeTableAndTipDomains(
         .zeroString("")
         .extremeValueString("")
         .printAsNsTimeInterval();
+    tip->addColumn("ack_time_p50", "time p50")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("ack_time_p99", "time p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
     tip->setColumnGroup("Nack");
     tip->addColumn("nack_delta", "delta").zeroString("");
     tip->addColumn("nack_abs", "abs").zeroString("");
@@ -1058,6 +1476,14 @@ void QueueStatsUtil::initializeTableAndTipDomains(
         .zeroString("")
         .extremeValueString("")
         .printAsNsTimeInterval();
+    tip->addColumn("confirm_time_p50", "time p50")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("confirm_time_p99", "time p99")
+        .zeroString("")
+        .extremeValueString("")
+        .printAsNsTimeInterval();
     tip->setColumnGroup("Reject");
     tip->addColumn("reject_delta", "delta").zeroString("");
     tip->addColumn("reject_abs", "abs").zeroString("");
@@ -1068,6 +1494,14 @@ void QueueStatsUtil::initializeTableAndTipDomains(
 
     tip->setColumnGroup("History");
     tip->addColumn("history_size", "# GUIDs").zeroString("");
+
+    tip->setColumnGroup("CPU Time");
+    tip->addColumn("cpu_time_delta", "delta")
+        .zeroString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("cpu_time_abs", "abs")
+        .zeroString("")
+        .printAsNsTimeInterval();
 }
 
 void QueueStatsUtil::initializeTableAndTipClients(
@@ -1143,6 +1577,16 @@ void QueueStatsUtil::initializeTableAndTipClients(
                      bmqst::StatUtil::increments,
                      start);
 
+    schema.addColumn("cpu_time_delta",
+                     ClientStats::e_STAT_CPU_TIME,
+                     bmqst::StatUtil::valueDifference,
+                     start,
+                     end);
+    schema.addColumn("cpu_time_abs",
+                     ClientStats::e_STAT_CPU_TIME,
+                     bmqst::StatUtil::value,
+                     start);
+
     // Configure records
     bmqst::TableRecords& records = table->records();
     records.setContext(statContext);
@@ -1176,6 +1620,14 @@ void QueueStatsUtil::initializeTableAndTipClients(
     tip->setColumnGroup("Ack");
     tip->addColumn("ack_delta", "events (d)").zeroString("");
     tip->addColumn("ack_abs", "events").zeroString("");
+
+    tip->setColumnGroup("CPU Time");
+    tip->addColumn("cpu_time_delta", "time (d)")
+        .zeroString("")
+        .printAsNsTimeInterval();
+    tip->addColumn("cpu_time_abs", "time")
+        .zeroString("")
+        .printAsNsTimeInterval();
 }
 
 }  // close package namespace
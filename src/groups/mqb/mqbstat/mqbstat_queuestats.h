@@ -95,12 +95,15 @@ class QueueStatsDomain {
             e_CONFIRM_TIME,
             e_REJECT,
             e_QUEUE_TIME,
+            e_DISPATCH_TIME,
+            e_REPLICATION_TIME,
             e_PURGE,
             e_CHANGE_ROLE,
             e_CFG_MSGS,
             e_CFG_BYTES,
             e_NO_SC_MESSAGE,
-            e_UPDATE_HISTORY
+            e_UPDATE_HISTORY,
+            e_CPU_TIME
         };
     };
 
@@ -129,16 +132,31 @@ class QueueStatsDomain {
             e_ACK_ABS,
             e_ACK_TIME_AVG,
             e_ACK_TIME_MAX,
+            e_ACK_TIME_P50,
+            e_ACK_TIME_P99,
+            e_ACK_TIME_P999,
             e_NACK_DELTA,
             e_NACK_ABS,
             e_CONFIRM_DELTA,
             e_CONFIRM_ABS,
             e_CONFIRM_TIME_AVG,
             e_CONFIRM_TIME_MAX,
+            e_CONFIRM_TIME_P50,
+            e_CONFIRM_TIME_P99,
+            e_CONFIRM_TIME_P999,
             e_REJECT_ABS,
             e_REJECT_DELTA,
             e_QUEUE_TIME_AVG,
             e_QUEUE_TIME_MAX,
+            e_QUEUE_TIME_P50,
+            e_QUEUE_TIME_P99,
+            e_QUEUE_TIME_P999,
+            e_DISPATCH_TIME_AVG,
+            e_DISPATCH_TIME_MAX,
+            e_DISPATCH_TIME_P99,
+            e_REPLICATION_TIME_AVG,
+            e_REPLICATION_TIME_MAX,
+            e_REPLICATION_TIME_P99,
             e_GC_MSGS_DELTA,
             e_GC_MSGS_ABS,
             e_ROLE,
@@ -146,7 +164,9 @@ class QueueStatsDomain {
             e_CFG_BYTES,
             e_NO_SC_MSGS_DELTA,
             e_NO_SC_MSGS_ABS,
-            e_HISTORY_ABS
+            e_HISTORY_ABS,
+            e_CPU_TIME_DELTA,
+            e_CPU_TIME_ABS
         };
 
         /// Return the non-modifiable string description corresponding to
@@ -191,6 +211,31 @@ class QueueStatsDomain {
     // PRIVATE TYPE
     typedef bslma::ManagedPtr<bmqst::StatContext> StatSubContextMp;
 
+    /// Compact per-appId state, kept for every configured appId whether or
+    /// not it has its own subcontext.
+    struct AppIdStats {
+        /// Subcontext of the appId, or 0 if the metrics of the appId are
+        /// aggregated in `d_otherSubContext_mp`.
+        bmqst::StatContext* d_context_p;
+
+        /// Position of the subcontext in `d_subContextsHolder`.  Only valid
+        /// if `d_context_p` is not 0.
+        bsl::list<StatSubContextMp>::iterator d_holderIt;
+
+        /// Number of outstanding messages of the appId.
+        bsls::Types::Int64 d_numMessages;
+
+        /// Number of outstanding bytes of the appId.
+        bsls::Types::Int64 d_numBytes;
+
+        /// Number of messages delivered to the appId since the last ranking.
+        bsls::Types::Int64 d_numDelivered;
+
+        AppIdStats();
+    };
+
+    typedef bsl::unordered_map<bsl::string, AppIdStats> AppIdStatsMap;
+
     // PRIVATE DATA
     /// Allocator to use
     bslma::Allocator* d_allocator_p;
@@ -212,9 +257,22 @@ class QueueStatsDomain {
     ///       is stopped.
     bsl::list<StatSubContextMp> d_subContextsHolder;
 
-    /// Lookup table for per-appId subcontexts.  Managed pointers to these
-    /// subcontexts must be held in `d_subContextsHolder`.
-    bsl::unordered_map<bsl::string, bmqst::StatContext*> d_subContextsLookup;
+    /// Lookup table for per-appId state and subcontexts.  Managed pointers
+    /// to these subcontexts must be held in `d_subContextsHolder`.
+    AppIdStatsMap d_subContextsLookup;
+
+    /// Subcontext aggregating the metrics of the appIds without their own
+    /// subcontext, if any.
+    StatSubContextMp d_otherSubContext_mp;
+
+    /// Maximum number of per-appId subcontexts, or 0 if unlimited.
+    int d_maxAppIdContexts;
+
+    /// Number of per-appId events since the ranking time was last checked.
+    int d_numEventsSinceRanking;
+
+    /// Time, as per `bsls::TimeUtil::getTimer`, of the last ranking.
+    bsls::Types::Int64 d_lastRankingTime;
 
   private:
     // NOT IMPLEMENTED
@@ -223,12 +281,39 @@ class QueueStatsDomain {
     /// Copy constructor and assignment operator are not implemented.
     QueueStatsDomain& operator=(const QueueStatsDomain&) BSLS_KEYWORD_DELETED;
 
-    // ACCESSORS
-    /// Look for the specified `appId` among the stored appId subcontexts and
-    /// return the pointer to it, or return 0 if a context is not found.
-    bmqst::StatContext* findAppIdContext(const bsl::string& appId) const;
+    // PRIVATE MANIPULATORS
+
+    /// Look for the specified `appId` among the configured appIds and return
+    /// the pointer to its state, or return 0 if it is not found.
+    AppIdStats* findAppIdStats(const bsl::string& appId);
+
+    /// Set the outstanding data of the appId having the specified `stats` to
+    /// the specified `numMessages` and `numBytes`.
+    void setAppIdBacklog(AppIdStats*        stats,
+                         bsls::Types::Int64 numMessages,
+                         bsls::Types::Int64 numBytes);
+
+    /// Rank the appIds if the number of subcontexts is limited and the last
+    /// ranking is old enough.
+    void rankAppIdsIfDue();
+
+    // PRIVATE ACCESSORS
+
+    /// Return the subcontext to report the metrics of the appId having the
+    /// specified `stats` to.
+    bmqst::StatContext* appIdContext(const AppIdStats& stats) const;
 
   public:
+    // PUBLIC CONSTANTS
+
+    /// Name of the subcontext aggregating the metrics of the appIds which
+    /// do not have their own subcontext.
+    static const char k_OTHER_APP_IDS[];
+
+    /// Minimum interval, in nanoseconds, between two automatic rankings of
+    /// the appIds.
+    static const bsls::Types::Int64 k_RANKING_INTERVAL;
+
     // CLASS METHODS
 
     /// Get the value of the specified `stat` reported to the queue
@@ -283,8 +368,19 @@ class QueueStatsDomain {
                  const bsl::string& appId);
 
     /// Update subcontexts in case of domain reconfigure with the given list of
-    /// AppIds.
-    void updateDomainAppIds(const bsl::vector<bsl::string>& appIds);
+    /// AppIds.  If the optionally specified `maxAppIdContexts` is not 0,
+    /// only create subcontexts for at most `maxAppIdContexts` appIds (see
+    /// `rankAppIds`).
+    void updateDomainAppIds(const bsl::vector<bsl::string>& appIds,
+                            int maxAppIdContexts = 0);
+
+    /// Give their own subcontext to the appIds with the largest backlog,
+    /// ties being broken by the number of messages delivered since the last
+    /// ranking, up to the maximum number of subcontexts, and aggregate the
+    /// metrics of the other appIds in a single subcontext named
+    /// `k_OTHER_APP_IDS`.  This is done automatically about every
+    /// `k_RANKING_INTERVAL` while per-appId events are reported.
+    void rankAppIds();
 
     /// Return a pointer to the statcontext.
     bmqst::StatContext* statContext();
@@ -367,6 +463,14 @@ class QueueStatsClient {
                                        int                       snapshotId,
                                        const Stat::Enum&         stat);
 
+    /// Report the specified `cpuTimeNs` nanoseconds of thread CPU time
+    /// spent by the dispatcher processing events of the client session
+    /// having the specified `clientStatContext`, which must have been
+    /// created as a subcontext of the context returned by
+    /// `QueueStatsUtil::initializeStatContextClients`.
+    static void onCpuTime(bmqst::StatContext* clientStatContext,
+                          bsls::Types::Int64  cpuTimeNs);
+
     // CREATORS
 
     /// Create a new object in an uninitialized state.
@@ -476,6 +580,17 @@ struct DomainQueueStats {
         ///             nanoseconds).
         e_STAT_QUEUE_TIME,
 
+        /// Value:      The time between a PUT being enqueued to the queue's
+        ///             dispatcher and the queue processing it (in
+        ///             nanoseconds).
+        e_STAT_DISPATCH_TIME,
+
+        /// Value:      The time between the queue processing a PUT and the
+        ///             storage receipt for it, i.e. the message being
+        ///             written and replicated to enough nodes (in
+        ///             nanoseconds).
+        e_STAT_REPLICATION_TIME,
+
         /// Value:      Accumulated bytes of all messages ever pushed from
         ///             the queue
         /// Increment:  Number of messages ever pushed from the queue
@@ -506,7 +621,11 @@ struct DomainQueueStats {
 
         /// Value:      Current number of GUIDs stored in queue's history
         ///             (does not include messages in the queue)
-        e_STAT_HISTORY
+        e_STAT_HISTORY,
+
+        /// Value:      Accumulated thread CPU time spent by the dispatcher
+        ///             processing events of the queue (in nanoseconds)
+        e_STAT_CPU_TIME
     };
 };
 
@@ -585,6 +704,26 @@ QueueStatsDomain::onEvent<QueueStatsDomain::EventType::e_QUEUE_TIME>(
     d_statContext_mp->reportValue(DomainQueueStats::e_STAT_QUEUE_TIME, value);
 }
 
+template <>
+inline void
+QueueStatsDomain::onEvent<QueueStatsDomain::EventType::e_DISPATCH_TIME>(
+    bsls::Types::Int64 value)
+{
+    BSLS_ASSERT_SAFE(d_statContext_mp && "initialize was not called");
+    d_statContext_mp->reportValue(DomainQueueStats::e_STAT_DISPATCH_TIME,
+                                  value);
+}
+
+template <>
+inline void
+QueueStatsDomain::onEvent<QueueStatsDomain::EventType::e_REPLICATION_TIME>(
+    bsls::Types::Int64 value)
+{
+    BSLS_ASSERT_SAFE(d_statContext_mp && "initialize was not called");
+    d_statContext_mp->reportValue(DomainQueueStats::e_STAT_REPLICATION_TIME,
+                                  value);
+}
+
 template <>
 inline void QueueStatsDomain::onEvent<QueueStatsDomain::EventType::e_PUSH>(
     bsls::Types::Int64 value)
@@ -701,6 +840,15 @@ QueueStatsDomain::onEvent<QueueStatsDomain::EventType::e_UPDATE_HISTORY>(
     d_statContext_mp->setValue(DomainQueueStats::e_STAT_HISTORY, value);
 }
 
+template <>
+inline void
+QueueStatsDomain::onEvent<QueueStatsDomain::EventType::e_CPU_TIME>(
+    bsls::Types::Int64 value)
+{
+    BSLS_ASSERT_SAFE(d_statContext_mp && "initialize was not called");
+    d_statContext_mp->adjustValue(DomainQueueStats::e_STAT_CPU_TIME, value);
+}
+
 // -----------------------------
 // struct QueueStatsDomain::Role
 // -----------------------------
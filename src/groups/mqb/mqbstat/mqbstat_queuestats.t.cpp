@@ -324,6 +324,9 @@ static void test3_queueStatsDomain()
 
     // 1 GUID in history
     queueStatsDomain.onEvent<QueueStatsDomain::EventType::e_UPDATE_HISTORY>(1);
+
+    // 500ns of dispatcher CPU time
+    queueStatsDomain.onEvent<QueueStatsDomain::EventType::e_CPU_TIME>(500);
     domain->snapshot();
 
     // The following stats are not range based, and therefore always return the
@@ -339,6 +342,7 @@ static void test3_queueStatsDomain()
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_PUT_MESSAGES_ABS, 0, 3);
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_PUT_BYTES_ABS, 0, 33);
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_HISTORY_ABS, 0, 1);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_CPU_TIME_ABS, 0, 500);
 
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_ACK_DELTA, 1, 2);
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_CONFIRM_DELTA, 1, 1);
@@ -377,6 +381,18 @@ static void test3_queueStatsDomain()
     // 3 GUIDs in history (first 5, then gc results in 3)
     queueStatsDomain.onEvent<QueueStatsDomain::EventType::e_UPDATE_HISTORY>(5);
     queueStatsDomain.onEvent<QueueStatsDomain::EventType::e_UPDATE_HISTORY>(3);
+
+    // 2 PUTs : dispatched after 100ns and 300ns, 1 of them receipted after 1us
+    queueStatsDomain.onEvent<QueueStatsDomain::EventType::e_DISPATCH_TIME>(
+        100);
+    queueStatsDomain.onEvent<QueueStatsDomain::EventType::e_DISPATCH_TIME>(
+        300);
+    queueStatsDomain
+        .onEvent<QueueStatsDomain::EventType::e_REPLICATION_TIME>(1000);
+
+    // 800ns of dispatcher CPU time, over two batches of events
+    queueStatsDomain.onEvent<QueueStatsDomain::EventType::e_CPU_TIME>(700);
+    queueStatsDomain.onEvent<QueueStatsDomain::EventType::e_CPU_TIME>(100);
     domain->snapshot();
 
     // The following stats are not range based, and therefore always return the
@@ -392,6 +408,7 @@ static void test3_queueStatsDomain()
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_PUT_MESSAGES_ABS, 0, 5);
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_PUT_BYTES_ABS, 0, 55);
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_HISTORY_ABS, 0, 3);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_CPU_TIME_ABS, 0, 1300);
 
     // Compare now and previous snapshot
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_ACK_DELTA, 1, 4);
@@ -400,11 +417,18 @@ static void test3_queueStatsDomain()
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_PUSH_BYTES_DELTA, 1, 11);
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_PUT_MESSAGES_DELTA, 1, 2);
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_PUT_BYTES_DELTA, 1, 22);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_DISPATCH_TIME_AVG, 1, 200);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_DISPATCH_TIME_MAX, 1, 300);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_REPLICATION_TIME_AVG, 1, 1000);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_REPLICATION_TIME_MAX, 1, 1000);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_REPLICATION_TIME_P99, 1, 1000);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_CPU_TIME_DELTA, 1, 800);
 
     // Compare now and two-snapshots ago; since two-snapshots ago was the start
     // time, the delta and abs stat should be the same
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_ACK_DELTA, 2, 6);
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_CONFIRM_DELTA, 2, 4);
+    BMQTST_ASSERT_EQ_DOMAINSTAT(e_CPU_TIME_DELTA, 2, 1300);
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_PUSH_MESSAGES_DELTA, 2, 2);
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_PUSH_BYTES_DELTA, 2, 20);
     BMQTST_ASSERT_EQ_DOMAINSTAT(e_PUT_MESSAGES_DELTA, 2, 5);
@@ -679,6 +703,168 @@ static void test5_appIdMetrics()
                 *bazSc,
                 -1,
                 mqbstat::QueueStatsDomain::Stat::e_CONFIRM_TIME_MAX));
+
+        // Percentiles are approximated by the middle of their histogram
+        // bucket ([768, 896) for 800), within the observed min and max.
+        BMQTST_ASSERT_EQ(
+            832,
+            mqbstat::QueueStatsDomain::getValue(
+                *barSc,
+                -1,
+                mqbstat::QueueStatsDomain::Stat::e_CONFIRM_TIME_P50));
+        BMQTST_ASSERT_EQ(
+            900,
+            mqbstat::QueueStatsDomain::getValue(
+                *barSc,
+                -1,
+                mqbstat::QueueStatsDomain::Stat::e_CONFIRM_TIME_P99));
+        BMQTST_ASSERT_EQ(
+            500,
+            mqbstat::QueueStatsDomain::getValue(
+                *bazSc,
+                -1,
+                mqbstat::QueueStatsDomain::Stat::e_CONFIRM_TIME_P50));
+    }
+}
+
+static void test6_appIdMetricsTopK()
+// ------------------------------------------------------------------------
+// APP ID METRICS TOP K
+//
+// Concerns:
+//   - Ensure that, when the number of per-appId subcontexts is limited,
+//     only the appIds with the largest backlog have their own subcontext
+//   - Ensure that the metrics of the other appIds are aggregated
+//
+// Plan:
+//   - Configure the component with three appIds and at most two
+//     subcontexts
+//   - Report backlogs, rank the appIds and check the subcontexts
+//   - Report events for an aggregated appId and check the values
+//
+// Testing:
+//   QueueStatsDomain::updateDomainAppIds
+//   QueueStatsDomain::rankAppIds
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("AppIdMetricsTopK");
+
+    mqbmock::Cluster mockCluster(bmqtst::TestHelperUtil::allocator());
+    mqbmock::Domain  mockDomain(&mockCluster,
+                               bmqtst::TestHelperUtil::allocator());
+
+    mqbstat::QueueStatsDomain stats(bmqtst::TestHelperUtil::allocator());
+    stats.initialize(bmqt::Uri("bmq://mock-domain/abc",
+                               bmqtst::TestHelperUtil::allocator()),
+                     &mockDomain);
+
+    typedef mqbstat::QueueStatsDomain::Stat Stat;
+
+    const char* k_APPID_A = "a";
+    const char* k_APPID_B = "b";
+    const char* k_APPID_C = "c";
+    const char* k_OTHER   = mqbstat::QueueStatsDomain::k_OTHER_APP_IDS;
+
+    bsl::vector<bsl::string> appIds(bmqtst::TestHelperUtil::allocator());
+    appIds.push_back(k_APPID_A);
+    appIds.push_back(k_APPID_B);
+    appIds.push_back(k_APPID_C);
+
+    bmqst::StatContext* sc = stats.statContext();
+
+    PV("Equal backlogs are ranked by name");
+    {
+        stats.updateDomainAppIds(appIds, 2);
+
+        sc->snapshot();
+        BMQTST_ASSERT_EQ(3, sc->numSubcontexts());
+        BMQTST_ASSERT(sc->getSubcontext(k_APPID_A));
+        BMQTST_ASSERT(sc->getSubcontext(k_APPID_B));
+        BMQTST_ASSERT(!sc->getSubcontext(k_APPID_C));
+        BMQTST_ASSERT(sc->getSubcontext(k_OTHER));
+    }
+
+    PV("The largest backlogs get their own subcontext");
+    {
+        stats.setOutstandingData(10, 100, k_APPID_C);
+        stats.setOutstandingData(5, 50, k_APPID_B);
+        stats.setOutstandingData(1, 10, k_APPID_A);
+        stats.rankAppIds();
+
+        sc->snapshot();
+        sc->cleanup();
+        BMQTST_ASSERT_EQ(3, sc->numSubcontexts());
+        BMQTST_ASSERT(!sc->getSubcontext(k_APPID_A));
+
+        const bmqst::StatContext* cSc     = sc->getSubcontext(k_APPID_C);
+        const bmqst::StatContext* otherSc = sc->getSubcontext(k_OTHER);
+        BMQTST_ASSERT(cSc);
+        BMQTST_ASSERT(sc->getSubcontext(k_APPID_B));
+        BMQTST_ASSERT(otherSc);
+
+        BMQTST_ASSERT_EQ(10,
+                         mqbstat::QueueStatsDomain::getValue(
+                             *cSc,
+                             0,
+                             Stat::e_MESSAGES_CURRENT));
+        BMQTST_ASSERT_EQ(1,
+                         mqbstat::QueueStatsDomain::getValue(
+                             *otherSc,
+                             0,
+                             Stat::e_MESSAGES_CURRENT));
+        BMQTST_ASSERT_EQ(10,
+                         mqbstat::QueueStatsDomain::getValue(
+                             *otherSc,
+                             0,
+                             Stat::e_BYTES_CURRENT));
+    }
+
+    PV("Aggregated appIds report to the other subcontext");
+    {
+        stats.onEvent(mqbstat::QueueStatsDomain::EventType::e_ADD_MESSAGE,
+                      20,
+                      k_APPID_A);
+        stats.onEvent(mqbstat::QueueStatsDomain::EventType::e_CONFIRM_TIME,
+                      700,
+                      k_APPID_A);
+
+        sc->snapshot();
+
+        const bmqst::StatContext* otherSc = sc->getSubcontext(k_OTHER);
+        BMQTST_ASSERT(otherSc);
+
+        BMQTST_ASSERT_EQ(2,
+                         mqbstat::QueueStatsDomain::getValue(
+                             *otherSc,
+                             0,
+                             Stat::e_MESSAGES_CURRENT));
+        BMQTST_ASSERT_EQ(30,
+                         mqbstat::QueueStatsDomain::getValue(
+                             *otherSc,
+                             0,
+                             Stat::e_BYTES_CURRENT));
+        BMQTST_ASSERT_EQ(700,
+                         mqbstat::QueueStatsDomain::getValue(
+                             *otherSc,
+                             -1,
+                             Stat::e_CONFIRM_TIME_MAX));
+    }
+
+    PV("Unlimited subcontexts");
+    {
+        stats.updateDomainAppIds(appIds);
+
+        sc->snapshot();
+        sc->cleanup();
+        BMQTST_ASSERT_EQ(3, sc->numSubcontexts());
+        BMQTST_ASSERT(sc->getSubcontext(k_APPID_A));
+        BMQTST_ASSERT(!sc->getSubcontext(k_OTHER));
+
+        BMQTST_ASSERT_EQ(2,
+                         mqbstat::QueueStatsDomain::getValue(
+                             *sc->getSubcontext(k_APPID_A),
+                             0,
+                             Stat::e_MESSAGES_CURRENT));
     }
 }
 
@@ -700,6 +886,7 @@ int main(int argc, char* argv[])
                 bmqtst::TestHelperUtil::allocator());
         switch (_testCase) {
         case 0:
+        case 6: test6_appIdMetricsTopK(); break;
         case 5: test5_appIdMetrics(); break;
         case 4: test4_queueStatsDomainContent(); break;
         case 3: test3_queueStatsDomain(); break;
@@ -25,6 +25,7 @@
 #include <mqbplug_plugintype.h>
 #include <mqbplug_statconsumer.h>
 #include <mqbscm_versiontag.h>
+#include <mqbstat_binarystatsprinter.h>
 #include <mqbstat_brokerstats.h>
 #include <mqbstat_clusterstats.h>
 #include <mqbstat_dispatcherstats.h>
@@ -37,6 +38,7 @@
 #include <mqbstat_tableprinter.h>
 
 #include <bmqio_statchannelfactory.h>
+#include <bmqma_countingallocator.h>
 #include <bmqst_statcontext.h>
 #include <bmqst_statvalue.h>
 #include <bmqtsk_alarmlog.h>
@@ -62,7 +64,9 @@
 #include <bsl_algorithm.h>
 #include <bsl_ctime.h>
 #include <bsl_exception.h>
+#include <bsl_functional.h>
 #include <bsl_iostream.h>
+#include <bsl_limits.h>
 #include <bsl_utility.h>
 #include <bslma_allocator.h>
 #include <bslmt_semaphore.h>
@@ -87,6 +91,15 @@ const bsls::Types::Int64 k_NS_PER_MESSAGE = 15 *
 
 const char k_PUBLISHINTERVAL_SUFFIX[] = ".PUBLISHINTERVAL";
 
+const char k_STACKSAMPLINGPERIOD_TUNABLE[] = "ALLOCATORS.STACKSAMPLINGPERIOD";
+
+const int k_MAX_PRINTED_STACK_SAMPLES = 10;
+// Maximum number of sampled allocation stacks printed by 'STAT SHOW'.
+
+const size_t k_MAX_PRINTED_CPU_QUEUES = 10;
+// Maximum number of queues printed by 'STAT SHOW' in the top queues by
+// dispatcher CPU time.
+
 typedef bsl::unordered_set<mqbplug::PluginFactory*> PluginFactories;
 
 /// Post on the optionally specified `semaphore`.
@@ -97,6 +110,48 @@ void optionalSemaphorePost(bslmt::Semaphore* semaphore)
     }
 }
 
+/// Print to the specified `os` at most the specified `maxQueues` queues of
+/// the specified `domainQueuesContext` on which the dispatcher spent the
+/// most CPU time over the stats history, using the specified `allocator`.
+void printTopQueuesByCpuTime(bsl::ostream&             os,
+                             const bmqst::StatContext& domainQueuesContext,
+                             size_t                    maxQueues,
+                             bslma::Allocator*         allocator)
+{
+    typedef bsl::pair<bsls::Types::Int64, bsl::string> Entry;
+
+    bsl::vector<Entry> entries(allocator);
+    for (bmqst::StatContextIterator domainIt =
+             domainQueuesContext.subcontextIterator();
+         domainIt;
+         ++domainIt) {
+        for (bmqst::StatContextIterator queueIt =
+                 domainIt->subcontextIterator();
+             queueIt;
+             ++queueIt) {
+            const bsls::Types::Int64 cpuTime = QueueStatsDomain::getValue(
+                *queueIt,
+                -1,
+                QueueStatsDomain::Stat::e_CPU_TIME_DELTA);
+            if (cpuTime > 0) {
+                entries.push_back(bsl::make_pair(cpuTime, queueIt->name()));
+            }
+        }
+    }
+
+    const size_t numPrinted = bsl::min(entries.size(), maxQueues);
+    bsl::partial_sort(entries.begin(),
+                      entries.begin() + numPrinted,
+                      entries.end(),
+                      bsl::greater<Entry>());
+
+    os << "\n:::::::::: :::::::::: TOP QUEUES BY CPU TIME >>\n";
+    for (size_t i = 0; i < numPrinted; ++i) {
+        os << bmqu::PrintUtil::prettyTimeInterval(entries[i].first) << "\t"
+           << entries[i].second << "\n";
+    }
+}
+
 }  // close unnamed namespace
 
 // -------------------------------------
@@ -208,9 +263,12 @@ void StatController::initializeStats()
 
     // --------
     // Channels
+    // A broker may hold thousands of channels, each updating its bytes
+    // counters from IO threads on every read and write: shard them.
     StatContextSp channels(
         bmqio::StatChannelFactoryUtil::createStatContext("channels",
                                                          historySize,
+                                                         true,
                                                          d_allocator_p),
         d_allocator_p);
     d_statContextsMap.insert(
@@ -325,6 +383,23 @@ void StatController::captureStatsAndSemaphorePost(
     case mqbcmd::EncodingFormat::TEXT: {
         bmqu::MemOutStream os(d_allocator_p);
         d_tablePrinter_mp->printStats(os, -1);
+
+        const bmqma::CountingAllocator* countingAllocator =
+            dynamic_cast<bmqma::CountingAllocator*>(
+                d_allocators.baseAllocator());
+        if (countingAllocator && countingAllocator->stackSamplingPeriod()) {
+            os << "\n:::::::::: :::::::::: SAMPLED ALLOCATIONS >>\n";
+            countingAllocator->printStackSamples(os,
+                                                 k_MAX_PRINTED_STACK_SAMPLES);
+        }
+
+        if (mqbcfg::BrokerConfig::get().dispatcherCpuAccounting()) {
+            printTopQueuesByCpuTime(
+                os,
+                *d_statContextsMap["domainQueues"].d_statContext_sp,
+                k_MAX_PRINTED_CPU_QUEUES,
+                d_allocator_p);
+        }
         result_p->makeStats() = os.str();
     } break;  // BREAK
     case mqbcmd::EncodingFormat::JSON_COMPACT: BSLA_FALLTHROUGH;
@@ -370,6 +445,46 @@ void StatController::setTunable(mqbcmd::StatResult*       result,
     const int                  snapshotInterval = statsCfg.snapshotInterval();
     const int maxPublishInterval = d_statConsumerMaxPublishInterval;
 
+    // Handle 'ALLOCATORS.STACKSAMPLINGPERIOD' tunable.
+    if (bdlb::StringRefUtil::areEqualCaseless(tunable.name(),
+                                              k_STACKSAMPLINGPERIOD_TUNABLE)) {
+        bmqma::CountingAllocator* countingAllocator =
+            dynamic_cast<bmqma::CountingAllocator*>(
+                d_allocators.baseAllocator());
+        if (!countingAllocator) {
+            result->makeError();
+            result->error().message() = "Allocation stack sampling requires "
+                                        "allocator stats to be enabled";
+            return;  // RETURN
+        }
+
+        if (!tunable.value().isTheIntegerValue() ||
+            tunable.value().theInteger() < 0 ||
+            tunable.value().theInteger() > bsl::numeric_limits<int>::max()) {
+            bmqu::MemOutStream output;
+            output << "ALLOCATORS.STACKSAMPLINGPERIOD must be a non-negative "
+                   << "integer, but instead the following was specified: "
+                   << tunable.value();
+            result->makeError();
+            result->error().message() = output.str();
+            return;  // RETURN
+        }
+
+        const int oldValue = countingAllocator->stackSamplingPeriod();
+        const int newValue = static_cast<int>(tunable.value().theInteger());
+
+        BALL_LOG_INFO << "Set allocation stack sampling period to "
+                      << newValue << " (was " << oldValue << ")";
+        countingAllocator->setStackSamplingPeriod(newValue);
+
+        mqbcmd::TunableConfirmation& tunableConfirmation =
+            result->makeTunableConfirmation();
+        tunableConfirmation.name() = "allocators.stackSamplingPeriod";
+        tunableConfirmation.oldValue().makeTheInteger(oldValue);
+        tunableConfirmation.newValue().makeTheInteger(newValue);
+        return;  // RETURN
+    }
+
     // Handle '<STATCONSUMER>.PUBLISHINTERVAL' tunable.
     size_t suffixPos = tunable.name().size() -
                        (sizeof(k_PUBLISHINTERVAL_SUFFIX) - 1);
@@ -495,6 +610,25 @@ void StatController::getTunable(mqbcmd::StatResult* result,
     bdlb::ScopeExitAny semaphorePost(
         bdlf::BindUtil::bind(&optionalSemaphorePost, semaphore));
 
+    if (bdlb::StringRefUtil::areEqualCaseless(tunable,
+                                              k_STACKSAMPLINGPERIOD_TUNABLE)) {
+        const bmqma::CountingAllocator* countingAllocator =
+            dynamic_cast<bmqma::CountingAllocator*>(
+                d_allocators.baseAllocator());
+        if (!countingAllocator) {
+            result->makeError();
+            result->error().message() = "Allocation stack sampling requires "
+                                        "allocator stats to be enabled";
+            return;  // RETURN
+        }
+
+        mqbcmd::Tunable& tunableObj = result->makeTunable();
+        tunableObj.name()           = "allocators.stackSamplingPeriod";
+        tunableObj.value().makeTheInteger(
+            countingAllocator->stackSamplingPeriod());
+        return;  // RETURN
+    }
+
     size_t suffixPos = tunable.size() - (sizeof(k_PUBLISHINTERVAL_SUFFIX) - 1);
     if (tunable.size() > sizeof(k_PUBLISHINTERVAL_SUFFIX) &&
         bdlb::StringRefUtil::areEqualCaseless(
@@ -582,6 +716,20 @@ void StatController::listTunables(mqbcmd::StatResult* result,
                "or as -1 to reset the publish interval to default value.";
         tunable.description() = description.str();
     }
+
+    const bmqma::CountingAllocator* countingAllocator =
+        dynamic_cast<bmqma::CountingAllocator*>(d_allocators.baseAllocator());
+    if (countingAllocator) {
+        mqbcmd::Tunable& tunable = tunables.tunables().emplace_back();
+        tunable.name()           = k_STACKSAMPLINGPERIOD_TUNABLE;
+        tunable.value().makeTheInteger(
+            countingAllocator->stackSamplingPeriod());
+        tunable.description() =
+            "non-negative integer N: capture the call stack of one out of "
+            "every N allocations, shown by 'STAT SHOW'. It can be specified "
+            "as 0 to disable the sampling. Changing it discards the stacks "
+            "sampled so far.";
+    }
 }
 
 bool StatController::snapshot()
@@ -637,15 +785,35 @@ void StatController::snapshotAndNotify()
         return;  // RETURN
     }
 
-    // StatConsumers will report all stats
+    // StatConsumers will report all stats.  They are invoked synchronously
+    // on this thread, so a consumer slower than the snapshot interval delays
+    // the next snapshots: report it, so that it can be fixed (e.g. by moving
+    // its publication to a thread of its own).
+    const bsls::Types::Int64 maxConsumerTimeNs =
+        mqbcfg::BrokerConfig::get().stats().snapshotInterval() *
+        bdlt::TimeUnitRatio::k_NS_PER_S / 2;
+
     bsl::vector<StatConsumerMp>::iterator it = d_statConsumers.begin();
     for (; it != d_statConsumers.end(); ++it) {
+        const bsls::Types::Int64 start = bmqu::Time::highResolutionTimer();
         try {
             (*it)->onSnapshot();
         }
         catch (const bsl::exception& e) {
             BALL_LOG_ERROR << "#PLUGIN_ERROR " << e.what();
         }
+
+        const bsls::Types::Int64 elapsed = bmqu::Time::highResolutionTimer() -
+                                           start;
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(elapsed >
+                                                  maxConsumerTimeNs)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            BALL_LOGTHROTTLE_WARN(k_MAX_INSTANT_MESSAGES, k_NS_PER_MESSAGE)
+                << "[THROTTLED] StatConsumer '" << (*it)->name()
+                << "' took " << bmqu::PrintUtil::prettyTimeInterval(elapsed)
+                << " to process a snapshot, more than half of the snapshot "
+                << "interval";
+        }
     }
 
     const bool willPrint = d_snapshotTracker.willPrintOnNextSnapshot();
@@ -669,6 +837,14 @@ void StatController::snapshotAndNotify()
                                      bdlf::PlaceHolders::_1,
                                      statId));
         }
+
+        if (d_binaryStatsFileLogger_mp) {
+            d_binaryStatsFileLogger_mp->logStats(
+                bdlf::BindUtil::bind(&BinaryStatsPrinter::printStats,
+                                     d_binaryStatsPrinter_mp.get(),
+                                     bdlf::PlaceHolders::_1,
+                                     statId));
+        }
     }
 
     // Cleanup is required if either:
@@ -758,8 +934,10 @@ StatController::StatController(const CommandProcessorFn& commandProcessor,
 , d_tablePrinter_mp(0)
 , d_tableStatsFileLogger_mp(0)
 , d_jsonStatsFileLogger_mp(0)
+, d_binaryStatsFileLogger_mp(0)
 , d_jsonPrinter_mp(0)
 , d_flatJsonPrinter_mp(0)
+, d_binaryStatsPrinter_mp(0)
 , d_statConsumers(allocator)
 , d_statConsumerMaxPublishInterval(0)
 , d_eventScheduler_p(eventScheduler)
@@ -950,6 +1128,19 @@ int StatController::start(bsl::ostream& errorDescription)
                     d_eventScheduler_p);
             d_jsonStatsFileLogger_mp->start();
         }
+
+        if (encoding & mqbcfg::StatsPrinterEncodingFormat::e_BINARY) {
+            d_binaryStatsPrinter_mp =
+                bslma::ManagedPtrUtil::allocateManaged<BinaryStatsPrinter>(
+                    d_allocator_p,
+                    ctxPtrMap);
+            d_binaryStatsFileLogger_mp =
+                bslma::ManagedPtrUtil::allocateManaged<StatsFileLogger>(
+                    d_allocator_p,
+                    file + ".bin",
+                    d_eventScheduler_p);
+            d_binaryStatsFileLogger_mp->start();
+        }
     }
 
     // Create the json printer
@@ -1023,8 +1214,17 @@ void StatController::stop()
                                      bdlf::PlaceHolders::_1,
                                      lastStatId));
         }
+
+        if (d_binaryStatsFileLogger_mp) {
+            d_binaryStatsFileLogger_mp->logStats(
+                bdlf::BindUtil::bind(&BinaryStatsPrinter::printStats,
+                                     d_binaryStatsPrinter_mp.get(),
+                                     bdlf::PlaceHolders::_1,
+                                     lastStatId));
+        }
     }
 
+    STOP_OBJ(d_binaryStatsFileLogger_mp, "BinaryStatsFileLogger");
     STOP_OBJ(d_jsonStatsFileLogger_mp, "JsonStatsFileLogger");
     STOP_OBJ(d_tableStatsFileLogger_mp, "TableStatsFileLogger");
     STOP_OBJ(d_systemStatMonitor_mp, "SystemStatMonitor");
@@ -1033,10 +1233,12 @@ void StatController::stop()
     for (it = d_statConsumers.begin(); it != d_statConsumers.end(); ++it) {
         DESTROY_OBJ((*it), it->name());
     }
+    DESTROY_OBJ(d_binaryStatsFileLogger_mp, "BinaryStatsFileLogger");
     DESTROY_OBJ(d_jsonStatsFileLogger_mp, "JsonStatsFileLogger");
     DESTROY_OBJ(d_tableStatsFileLogger_mp, "TableStatsFileLogger");
     DESTROY_OBJ(d_tablePrinter_mp, "TablePrinter");
     DESTROY_OBJ(d_flatJsonPrinter_mp, "FlatJsonPrinter");
+    DESTROY_OBJ(d_binaryStatsPrinter_mp, "BinaryStatsPrinter");
     DESTROY_OBJ(d_jsonPrinter_mp, "JsonPrinter");
     DESTROY_OBJ(d_systemStatMonitor_mp, "SystemStatMonitor");
     DESTROY_OBJ(d_scheduler_mp, "Scheduler");
@@ -80,6 +80,7 @@ class BasicTableInfoProvider;
 namespace mqbstat {
 
 // FORWARD DECLARATION
+class BinaryStatsPrinter;
 class FlatJsonPrinter;
 class JsonPrinter;
 class StatMonitor;
@@ -118,6 +119,7 @@ class StatController {
     typedef bslma::ManagedPtr<TablePrinter>               TablePrinterMp;
     typedef bslma::ManagedPtr<StatsFileLogger>            StatsFileLoggerMp;
     typedef bslma::ManagedPtr<FlatJsonPrinter>            FlatJsonPrinterMp;
+    typedef bslma::ManagedPtr<BinaryStatsPrinter>         BinaryStatsPrinterMp;
     typedef bslma::ManagedPtr<JsonPrinter>                JsonPrinterMp;
     typedef bslma::ManagedPtr<mqbplug::StatConsumer>      StatConsumerMp;
 
@@ -233,12 +235,20 @@ class StatController {
     /// Null if JSON stats logging is disabled.
     StatsFileLoggerMp d_jsonStatsFileLogger_mp;
 
+    /// File logger for periodic binary stats output.
+    /// Null if BINARY stats logging is disabled.
+    StatsFileLoggerMp d_binaryStatsFileLogger_mp;
+
     /// JsonPrinter used for admin commands processing
     JsonPrinterMp d_jsonPrinter_mp;
 
     /// FlatJsonPrinter for periodic flat JSON stats file output
     FlatJsonPrinterMp d_flatJsonPrinter_mp;
 
+    /// BinaryStatsPrinter for periodic binary stats file output.  Null if
+    /// BINARY stats logging is disabled.
+    BinaryStatsPrinterMp d_binaryStatsPrinter_mp;
+
     /// Registered stat consumers
     bsl::vector<StatConsumerMp> d_statConsumers;
 
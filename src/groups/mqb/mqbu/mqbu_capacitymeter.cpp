@@ -44,38 +44,56 @@ const bsls::Types::Int64 k_ZERO = 0;
 
 }  // close unnamed namespace
 
+// -----------------------------------
+// struct CapacityMeter::StateSnapshot
+// -----------------------------------
+
+CapacityMeter::StateSnapshot::StateSnapshot(
+    const ResourceUsageMonitor& monitor,
+    bsls::Types::Int64          nbMessagesReserved,
+    bsls::Types::Int64          nbBytesReserved)
+: d_monitor(monitor)
+, d_nbMessagesReserved(nbMessagesReserved)
+, d_nbBytesReserved(nbBytesReserved)
+{
+    // NOTHING
+}
+
 // -------------------
 // class CapacityMeter
 // -------------------
 
 void CapacityMeter::logOnMonitorStateTransition(
-    ResourceUsageMonitorStateTransition::Enum stateTransition) const
+    ResourceUsageMonitorStateTransition::Enum stateTransition,
+    const StateSnapshot&                      snapshot) const
 {
     const size_t k_INITIAL_BUFFER_SIZE = 256;
 
+    const ResourceUsageMonitor& monitor = snapshot.d_monitor;
+
     bmqu::MemOutStream categoryStream(k_INITIAL_BUFFER_SIZE, d_allocator_p);
     bmqu::MemOutStream stream(k_INITIAL_BUFFER_SIZE, d_allocator_p);
 
-    categoryStream << "CAPACITY_" << d_monitor.state();
+    categoryStream << "CAPACITY_" << monitor.state();
     stream << "for '" << name() << "':";
 
-    stream << " [Messages (" << d_monitor.messageState()
-           << "): " << bmqu::PrintUtil::prettyNumber(d_monitor.messages())
+    stream << " [Messages (" << monitor.messageState()
+           << "): " << bmqu::PrintUtil::prettyNumber(monitor.messages())
            << " (limit: "
-           << bmqu::PrintUtil::prettyNumber(d_monitor.messageCapacity());
+           << bmqu::PrintUtil::prettyNumber(monitor.messageCapacity());
 
-    if (d_nbMessagesReserved > 0) {
+    if (snapshot.d_nbMessagesReserved > 0) {
         stream << ", reserved: "
-               << bmqu::PrintUtil::prettyNumber(d_nbMessagesReserved);
+               << bmqu::PrintUtil::prettyNumber(snapshot.d_nbMessagesReserved);
     }
 
-    stream << "), Bytes (" << d_monitor.byteState()
-           << "): " << bmqu::PrintUtil::prettyBytes(d_monitor.bytes())
+    stream << "), Bytes (" << monitor.byteState()
+           << "): " << bmqu::PrintUtil::prettyBytes(monitor.bytes())
            << " (limit: "
-           << bmqu::PrintUtil::prettyBytes(d_monitor.byteCapacity());
-    if (d_nbBytesReserved > 0) {
+           << bmqu::PrintUtil::prettyBytes(monitor.byteCapacity());
+    if (snapshot.d_nbBytesReserved > 0) {
         stream << ", reserved: "
-               << bmqu::PrintUtil::prettyBytes(d_nbBytesReserved);
+               << bmqu::PrintUtil::prettyBytes(snapshot.d_nbBytesReserved);
     }
     stream << ")]";
 
@@ -267,6 +285,9 @@ void CapacityMeter::commit(bsls::Types::Int64 messages,
                      d_monitor.messageCapacity());
     BSLS_ASSERT_SAFE(d_monitor.bytes() + bytes <= d_monitor.byteCapacity());
 
+    ResourceUsageMonitorStateTransition::Enum monitorStateTransition =
+        ResourceUsageMonitorStateTransition::e_NO_CHANGE;
+    bdlb::NullableValue<StateSnapshot> snapshot;
     {
         bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
 
@@ -275,16 +296,22 @@ void CapacityMeter::commit(bsls::Types::Int64 messages,
         d_nbBytesReserved -= bytes;
 
         // Update monitor
-        ResourceUsageMonitorStateTransition::Enum monitorStateTransition =
-            d_monitor.update(bytes, messages);
+        monitorStateTransition = d_monitor.update(bytes, messages);
         if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
                 monitorStateTransition !=
                 ResourceUsageMonitorStateTransition::e_NO_CHANGE)) {
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-            logOnMonitorStateTransition(monitorStateTransition);
+            snapshot.makeValue(StateSnapshot(d_monitor,
+                                             d_nbMessagesReserved,
+                                             d_nbBytesReserved));
         }
     }  // close lock guard scope
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!snapshot.isNull())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        logOnMonitorStateTransition(monitorStateTransition, snapshot.value());
+    }
+
     if (d_parent_p) {
         d_parent_p->commit(messages, bytes);
     }
@@ -298,43 +325,56 @@ CapacityMeter::commitUnreserved(bsls::Types::Int64 messages,
         return e_SUCCESS;  // RETURN
     }
 
-    bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
+    ResourceUsageMonitorStateTransition::Enum monitorStateTransition =
+        ResourceUsageMonitorStateTransition::e_NO_CHANGE;
+    bdlb::NullableValue<StateSnapshot> snapshot;
+    {
+        bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
 
-    // NOTE: The 'messages' and 'bytes' parameters are not considered in the
-    //       'hasCapacity' check because we want to allow to exceed the
-    //       capacity for either messages or bytes *exactly* once, which also
-    //       means that we want to log on 'STATE_FULL' exactly once.
-    bool hasMessagesCapacity = d_monitor.messages() + d_nbMessagesReserved <=
-                               d_monitor.messageCapacity();
-    bool hasBytesCapacity = d_monitor.bytes() + d_nbBytesReserved <=
-                            d_monitor.byteCapacity();
-
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!hasMessagesCapacity ||
-                                              !hasBytesCapacity)) {
-        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        // Self doesn't have enough capacity
-        return !hasMessagesCapacity ? e_LIMIT_MESSAGES
-                                    : e_LIMIT_BYTES;  // RETURN
-    }
+        // NOTE: The 'messages' and 'bytes' parameters are not considered in
+        //       the 'hasCapacity' check because we want to allow to exceed
+        //       the capacity for either messages or bytes *exactly* once,
+        //       which also means that we want to log on 'STATE_FULL' exactly
+        //       once.
+        bool hasMessagesCapacity =
+            d_monitor.messages() + d_nbMessagesReserved <=
+            d_monitor.messageCapacity();
+        bool hasBytesCapacity =
+            d_monitor.bytes() + d_nbBytesReserved <= d_monitor.byteCapacity();
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!hasMessagesCapacity ||
+                                                  !hasBytesCapacity)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            // Self doesn't have enough capacity
+            return !hasMessagesCapacity ? e_LIMIT_MESSAGES
+                                        : e_LIMIT_BYTES;  // RETURN
+        }
 
-    // Self has enough capacity, if it has a parent, try to acquire resources
-    // on the parent.
-    if (d_parent_p) {
-        CommitResult res = d_parent_p->commitUnreserved(messages, bytes);
-        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(res != e_SUCCESS)) {
+        // Self has enough capacity, if it has a parent, try to acquire
+        // resources on the parent.
+        if (d_parent_p) {
+            CommitResult res = d_parent_p->commitUnreserved(messages, bytes);
+            if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(res != e_SUCCESS)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+                return res;  // RETURN
+            }
+        }
+
+        // Update monitor
+        monitorStateTransition = d_monitor.update(bytes, messages);
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                monitorStateTransition !=
+                ResourceUsageMonitorStateTransition::e_NO_CHANGE)) {
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-            return res;  // RETURN
+            snapshot.makeValue(StateSnapshot(d_monitor,
+                                             d_nbMessagesReserved,
+                                             d_nbBytesReserved));
         }
-    }
+    }  // close lock guard scope
 
-    // Update monitor
-    ResourceUsageMonitorStateTransition::Enum monitorStateTransition =
-        d_monitor.update(bytes, messages);
-    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
-            monitorStateTransition !=
-            ResourceUsageMonitorStateTransition::e_NO_CHANGE)) {
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!snapshot.isNull())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-        logOnMonitorStateTransition(monitorStateTransition);
+        logOnMonitorStateTransition(monitorStateTransition, snapshot.value());
     }
 
     return e_SUCCESS;
@@ -370,21 +410,29 @@ void CapacityMeter::remove(bsls::Types::Int64 messages,
         d_parent_p->remove(messages, bytes);
     }
 
+    ResourceUsageMonitorStateTransition::Enum monitorStateTransition =
+        ResourceUsageMonitorStateTransition::e_NO_CHANGE;
+    bdlb::NullableValue<StateSnapshot> snapshot;
     {
         bsls::SpinLockGuard guard(&d_lock);  // d_lock LOCK
 
         // Update monitor
-        ResourceUsageMonitorStateTransition::Enum monitorStateTransition =
-            d_monitor.update(-1 * bytes, -1 * messages);
+        monitorStateTransition = d_monitor.update(-1 * bytes, -1 * messages);
 
         bool isLowWatermarkTransition =
             monitorStateTransition ==
             ResourceUsageMonitorStateTransition::e_LOW_WATERMARK;
 
         if (!silentMode && isLowWatermarkTransition) {
-            logOnMonitorStateTransition(monitorStateTransition);
+            snapshot.makeValue(StateSnapshot(d_monitor,
+                                             d_nbMessagesReserved,
+                                             d_nbBytesReserved));
         }
     }  // close lock guard scope
+
+    if (!snapshot.isNull()) {
+        logOnMonitorStateTransition(monitorStateTransition, snapshot.value());
+    }
 }
 
 void CapacityMeter::clear()
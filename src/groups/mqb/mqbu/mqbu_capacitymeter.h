@@ -153,6 +153,7 @@
 
 // BDE
 #include <ball_log.h>
+#include <bdlb_nullablevalue.h>
 #include <bsl_functional.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
@@ -196,6 +197,23 @@ class CapacityMeter {
         LogEnhancedStorageInfoCb;
 
   private:
+    // PRIVATE TYPES
+
+    /// State of this meter, captured while holding `d_lock` upon a monitor
+    /// state transition, so that the transition can be logged once the lock
+    /// is released.
+    struct StateSnapshot {
+        // DATA
+        ResourceUsageMonitor d_monitor;
+        bsls::Types::Int64   d_nbMessagesReserved;
+        bsls::Types::Int64   d_nbBytesReserved;
+
+        // CREATORS
+        StateSnapshot(const ResourceUsageMonitor& monitor,
+                      bsls::Types::Int64          nbMessagesReserved,
+                      bsls::Types::Int64          nbBytesReserved);
+    };
+
     // DATA
     /// Allocator to use
     bslma::Allocator* d_allocator_p;
@@ -234,9 +252,13 @@ class CapacityMeter {
 
     /// Function invoked to print, if necessary, the specified
     /// `stateTransition` resulting from updating the value of the
-    /// `d_monitor` after committing to it.
+    /// `d_monitor` after committing to it, using the specified `snapshot`
+    /// of the state of this meter right after the update.  Note that this
+    /// method must be called *without* holding `d_lock`, so that other
+    /// threads don't spin while the alarm is formatted and logged.
     void logOnMonitorStateTransition(
-        ResourceUsageMonitorStateTransition::Enum stateTransition) const;
+        ResourceUsageMonitorStateTransition::Enum stateTransition,
+        const StateSnapshot&                      snapshot) const;
 
   private:
     // NOT IMPLEMENTED
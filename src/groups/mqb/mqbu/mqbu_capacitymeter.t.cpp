@@ -41,6 +41,15 @@ inline bsl::ostream& logEnhancedStorageInfoCb(bsl::ostream& stream)
     return stream;
 }
 
+/// Write the number of messages of the specified `capacityMeter` to the
+/// specified `stream`.
+inline bsl::ostream& logMeterMessagesCb(bsl::ostream&              stream,
+                                        const mqbu::CapacityMeter* meter)
+{
+    stream << " Meter messages: " << meter->messages();
+    return stream;
+}
+
 // ============================================================================
 //                                    TESTS
 // ----------------------------------------------------------------------------
@@ -326,6 +335,60 @@ static void test3_enhancedLog()
         bmqtst::TestHelperUtil::allocator()));
 }
 
+static void test4_logOutsideLock()
+// ------------------------------------------------------------------------
+// LOG OUTSIDE LOCK
+//
+// Concerns:
+//   State transitions are logged after the meter's lock is released, so
+//   that the enhanced storage info callback can query the meter.
+//
+// Plan:
+//   1. Pass a LogEnhancedStorageInfoCb callback reading the meter's
+//      messages during initialization
+//   2. Set resources to the high watermark with 'commitUnreserved' and
+//      ensure the alarm, containing the up to date number of messages, was
+//      logged.
+//
+// Testing:
+//   logging
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("LOG OUTSIDE LOCK");
+
+    bmqtst::TestHelperUtil::ignoreCheckDefAlloc() = true;
+    // Logging infrastructure allocates using the default allocator, and
+    // that logging is beyond the control of this function.
+
+    const bsls::Types::Int64 k_MSGS_LIMIT     = 10;
+    const double             k_MSGS_THRESHOLD = 0.5;
+    const bsls::Types::Int64 k_BYTES_LIMIT    = 1024;
+
+    bmqtst::ScopedLogObserver observer(ball::Severity::e_WARN,
+                                       bmqtst::TestHelperUtil::allocator());
+    mqbu::CapacityMeter       capacityMeter(
+        "dummy",
+        bdlf::BindUtil::bindS(bmqtst::TestHelperUtil::allocator(),
+                              &logMeterMessagesCb,
+                              bdlf::PlaceHolders::_1,  // stream
+                              &capacityMeter),
+        bmqtst::TestHelperUtil::allocator());
+    capacityMeter.setLimits(k_MSGS_LIMIT, k_BYTES_LIMIT);
+    capacityMeter.setWatermarkThresholds(k_MSGS_THRESHOLD, 1.0);
+
+    for (int i = 0; i < k_MSGS_LIMIT * k_MSGS_THRESHOLD; ++i) {
+        BMQTST_ASSERT_EQ_D(i,
+                           capacityMeter.commitUnreserved(1, 1),
+                           mqbu::CapacityMeter::e_SUCCESS);
+    }
+
+    BMQTST_ASSERT_EQ(observer.records().size(), 1U);
+    BMQTST_ASSERT(bmqtst::ScopedLogObserverUtil::recordMessageMatch(
+        observer.records()[0],
+        "ALARM \\[CAPACITY_STATE_HIGH_WATERMARK\\].*Meter messages: 5",
+        bmqtst::TestHelperUtil::allocator()));
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -339,6 +402,7 @@ int main(int argc, char* argv[])
     case 2: test2_logStateChange(); break;
     case 1: test1_breathingTest(); break;
     case 3: test3_enhancedLog(); break;
+    case 4: test4_logOutsideLock(); break;
     default: {
         cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
         bmqtst::TestHelperUtil::testStatus() = -1;
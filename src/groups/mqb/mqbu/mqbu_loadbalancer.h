@@ -20,12 +20,29 @@
 //
 //@CLASSES:
 //  mqbu::LoadBalancer: Load-balance objects across processors
+//  mqbu::LoadBalancerMigration: A client migration proposed by a rebalance
 //
 //@DESCRIPTION: 'mqbu::LoadBalancer' provides a simple templated mechanism to
 // load-balance objects (aka 'clients') of parameterized type across a set of
 // processors by associating them with a processorId (an integer in the range
 // '[0 .. processorsCount() - 1]'.
 //
+/// Load-aware rebalancing
+///----------------------
+// New clients are always assigned to the processor having the lowest number
+// of clients.  Because clients may generate very different amounts of
+// traffic, each client can additionally be given a 'load' (e.g., its event
+// rate over the last period) using 'setClientLoad'.  The 'rebalance' method
+// then migrates clients from the most loaded processor to the least loaded
+// one, one at a time, as long as the difference between the two exceeds the
+// specified hysteresis (expressed as a percentage of the load of the most
+// loaded processor) and migrating a client strictly reduces that difference.
+// The hysteresis prevents clients from bouncing between processors when
+// loads are roughly balanced.  Each migration is reported to the caller as a
+// 'LoadBalancerMigration', and the caller is responsible for handing the
+// client over to its new processor in a way which preserves the ordering of
+// the events of that client (e.g., by draining its old processor first).
+//
 /// Thread Safety
 ///-------------
 // The 'mqbu::LoadBalancer' object is fully thread-safe, meaning that two
@@ -58,6 +75,20 @@
 //  loadBalancer.removeClient(&myClient);
 //..
 //
+// Periodically, the owner of the load balancer may report the load of each
+// client and rebalance them.
+//..
+//  loadBalancer.setClientLoad(&myClient, eventsSinceLastPeriod);
+//
+//  bsl::vector<mqbu::LoadBalancerMigration<MyClient> > migrations;
+//  loadBalancer.rebalance(&migrations, 20, 1);  // 20% hysteresis
+//  for (size_t i = 0; i < migrations.size(); ++i) {
+//      handOver(migrations[i].d_client_p,
+//               migrations[i].d_fromProcessorId,
+//               migrations[i].d_toProcessorId);
+//  }
+//..
+//
 
 // MQB
 
@@ -72,10 +103,30 @@
 #include <bslmt_mutex.h>
 #include <bslmt_mutexassert.h>
 #include <bsls_assert.h>
+#include <bsls_types.h>
 
 namespace BloombergLP {
 namespace mqbu {
 
+// ============================
+// struct LoadBalancerMigration
+// ============================
+
+/// A migration of a client of type `TYPE` from one processor to another, as
+/// decided by `LoadBalancer::rebalance`.
+template <class TYPE>
+struct LoadBalancerMigration {
+    // PUBLIC DATA
+    const TYPE* d_client_p;
+    // The migrated client
+
+    int d_fromProcessorId;
+    // Processor the client was associated with
+
+    int d_toProcessorId;
+    // Processor the client is now associated with
+};
+
 // ==================
 // class LoadBalancer
 // ==================
@@ -86,17 +137,29 @@ class LoadBalancer {
   private:
     // PRIVATE TYPES
 
-    /// ClientMap[client] = processorId
-    typedef bsl::unordered_map<const TYPE*, int> ClientMap;
+    /// Information kept about a registered client.
+    struct ClientInfo {
+        int d_processorId;
+        // Processor the client is associated with
+
+        bsls::Types::Int64 d_load;
+        // Last reported load of the client
+    };
+
+    /// ClientMap[client] = clientInfo
+    typedef bsl::unordered_map<const TYPE*, ClientInfo> ClientMap;
 
   private:
     // DATA
     bsl::vector<int> d_counters;
     // Client counters per processor
 
+    bsl::vector<bsls::Types::Int64> d_loads;
+    // Sum of the loads of the clients per processor
+
     ClientMap d_clients;
     // Map between the registered clients and the
-    // corresponding processorId
+    // corresponding processorId and load
 
     mutable bslmt::Mutex d_mutex;
     // Lock to protect this object in multi-threaded
@@ -109,6 +172,12 @@ class LoadBalancer {
     /// clients associated with it.
     int findSmallestCounterLocked() const;
 
+    /// Return the client associated with the specified `fromProcessorId`
+    /// whose load is the closest to half of the specified `imbalance`
+    /// without reaching `imbalance`, or 0 if there is no such client.
+    const TYPE* findClientToMigrateLocked(int                fromProcessorId,
+                                          bsls::Types::Int64 imbalance) const;
+
   private:
     // NOT IMPLEMENTED
 
@@ -149,6 +218,25 @@ class LoadBalancer {
     /// processor.
     void removeClient(const TYPE* client);
 
+    /// Set the load of the specified `client` to the specified `load`.  This
+    /// method has no effect if `client` is not associated with any processor.
+    /// The behavior is undefined unless `0 <= load`.
+    void setClientLoad(const TYPE* client, bsls::Types::Int64 load);
+
+    /// Migrate up to the specified `maxMigrations` clients from the most
+    /// loaded processor to the least loaded one, as long as their load
+    /// difference is greater than the specified `hysteresisPercent` of the
+    /// load of the most loaded processor, and load the performed migrations
+    /// into the specified `migrations`.  Return the number of migrations
+    /// performed.  The behavior is undefined unless
+    /// `0 <= hysteresisPercent <= 100` and `0 <= maxMigrations`.  Note that
+    /// `migrations` is cleared first, and that the association of each
+    /// migrated client is updated by this method: it is the responsibility
+    /// of the caller to hand over each client to its new processor.
+    int rebalance(bsl::vector<LoadBalancerMigration<TYPE> >* migrations,
+                  int                                       hysteresisPercent,
+                  int                                       maxMigrations);
+
     // ACCESSORS
 
     /// Return the number of processors configured for this object.
@@ -161,6 +249,11 @@ class LoadBalancer {
     /// `processorId`.  The behavior is undefined unless '0 <= processorId <
     /// processorsCount()'.
     int clientsCountForProcessor(int processorId) const;
+
+    /// Return the sum of the loads of the clients associated to the
+    /// specified `processorId`.  The behavior is undefined unless
+    /// '0 <= processorId < processorsCount()'.
+    bsls::Types::Int64 loadForProcessor(int processorId) const;
 };
 
 // ============================================================================
@@ -182,10 +275,46 @@ int LoadBalancer<TYPE>::findSmallestCounterLocked() const
                                           d_counters.end()));
 }
 
+template <class TYPE>
+const TYPE* LoadBalancer<TYPE>::findClientToMigrateLocked(
+    int                fromProcessorId,
+    bsls::Types::Int64 imbalance) const
+{
+    // PRECONDITIONS
+    BSLMT_MUTEXASSERT_IS_LOCKED_SAFE(&d_mutex);  // d_mutex was LOCKED
+
+    // Moving a client having a load 'L' from the most loaded processor to the
+    // least loaded one changes their difference from 'imbalance' to
+    // '|imbalance - 2 * L|', so the best candidate is the one whose load is
+    // the closest to 'imbalance / 2', and only clients having a non-zero load
+    // strictly lower than 'imbalance' improve the balance.
+    const TYPE*        result   = 0;
+    bsls::Types::Int64 bestDiff = imbalance;
+    for (typename ClientMap::const_iterator it = d_clients.begin();
+         it != d_clients.end();
+         ++it) {
+        const ClientInfo& info = it->second;
+        if (info.d_processorId != fromProcessorId || info.d_load == 0 ||
+            info.d_load >= imbalance) {
+            continue;  // CONTINUE
+        }
+
+        const bsls::Types::Int64 diff    = imbalance - 2 * info.d_load;
+        const bsls::Types::Int64 absDiff = diff < 0 ? -diff : diff;
+        if (absDiff < bestDiff) {
+            bestDiff = absDiff;
+            result   = it->first;
+        }
+    }
+
+    return result;
+}
+
 template <class TYPE>
 LoadBalancer<TYPE>::LoadBalancer(int               numProcessors,
                                  bslma::Allocator* allocator)
 : d_counters(numProcessors, 0, allocator)
+, d_loads(numProcessors, 0, allocator)
 , d_clients(allocator)
 , d_mutex()
 {
@@ -201,7 +330,7 @@ int LoadBalancer<TYPE>::getProcessorForClient(const TYPE* client)
     typename ClientMap::const_iterator it = d_clients.find(client);
     if (it != d_clients.end()) {
         // Client already has a processor associated with it
-        return it->second;  // RETURN
+        return it->second.d_processorId;  // RETURN
     }
 
     // This is brand new client
@@ -209,8 +338,10 @@ int LoadBalancer<TYPE>::getProcessorForClient(const TYPE* client)
 
     // Add the client to the map and bump the counter for the selected
     // processor indicating that it now have one more client to serve
+    const ClientInfo info = {processorId, 0};
+
     d_counters[processorId] += 1;
-    d_clients[client] = processorId;
+    d_clients[client] = info;
 
     return processorId;
 }
@@ -227,8 +358,10 @@ void LoadBalancer<TYPE>::setProcessorForClient(const TYPE* client,
 
     // Add the client to the map and bump the counter for the selected
     // processor indicating that it now have one more client to serve
+    const ClientInfo info = {processorId, 0};
+
     d_counters[processorId] += 1;
-    d_clients[client] = processorId;
+    d_clients[client] = info;
 }
 
 template <class TYPE>
@@ -242,12 +375,87 @@ void LoadBalancer<TYPE>::removeClient(const TYPE* client)
         return;  // RETURN
     }
 
-    // Remove the client from the map and decrement the counter for the
-    // associated processor.
-    d_counters[it->second] -= 1;
+    // Remove the client from the map and decrement the counter and the load
+    // for the associated processor.
+    d_counters[it->second.d_processorId] -= 1;
+    d_loads[it->second.d_processorId] -= it->second.d_load;
     d_clients.erase(it);
 }
 
+template <class TYPE>
+void LoadBalancer<TYPE>::setClientLoad(const TYPE*        client,
+                                       bsls::Types::Int64 load)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= load);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // d_mutex LOCKED
+
+    typename ClientMap::iterator it = d_clients.find(client);
+    if (it == d_clients.end()) {
+        // Client was not found
+        return;  // RETURN
+    }
+
+    d_loads[it->second.d_processorId] += load - it->second.d_load;
+    it->second.d_load = load;
+}
+
+template <class TYPE>
+int LoadBalancer<TYPE>::rebalance(
+    bsl::vector<LoadBalancerMigration<TYPE> >* migrations,
+    int                                       hysteresisPercent,
+    int                                       maxMigrations)
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(migrations);
+    BSLS_ASSERT_SAFE(0 <= hysteresisPercent && hysteresisPercent <= 100);
+    BSLS_ASSERT_SAFE(0 <= maxMigrations);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // d_mutex LOCKED
+
+    migrations->clear();
+
+    while (static_cast<int>(migrations->size()) < maxMigrations) {
+        const int hottest = bsl::distance(
+            d_loads.begin(),
+            bsl::max_element(d_loads.begin(), d_loads.end()));
+        const int coldest = bsl::distance(
+            d_loads.begin(),
+            bsl::min_element(d_loads.begin(), d_loads.end()));
+
+        const bsls::Types::Int64 imbalance = d_loads[hottest] -
+                                             d_loads[coldest];
+        if (imbalance == 0 ||
+            imbalance * 100 <= d_loads[hottest] * hysteresisPercent) {
+            // Loads are balanced within the hysteresis
+            break;  // BREAK
+        }
+
+        const TYPE* client = findClientToMigrateLocked(hottest, imbalance);
+        if (!client) {
+            // No client on the hottest processor can be migrated without
+            // making the imbalance worse.
+            break;  // BREAK
+        }
+
+        ClientInfo& info = d_clients[client];
+
+        d_counters[hottest] -= 1;
+        d_loads[hottest] -= info.d_load;
+        d_counters[coldest] += 1;
+        d_loads[coldest] += info.d_load;
+        info.d_processorId = coldest;
+
+        const LoadBalancerMigration<TYPE> migration = {client,
+                                                       hottest,
+                                                       coldest};
+        migrations->push_back(migration);
+    }
+
+    return static_cast<int>(migrations->size());
+}
+
 template <class TYPE>
 int LoadBalancer<TYPE>::processorsCount() const
 {
@@ -272,6 +480,17 @@ int LoadBalancer<TYPE>::clientsCountForProcessor(int processorId) const
     return d_counters[processorId];
 }
 
+template <class TYPE>
+bsls::Types::Int64 LoadBalancer<TYPE>::loadForProcessor(int processorId) const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);  // d_mutex LOCKED
+
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(processorId >= 0 && processorId < processorsCount());
+
+    return d_loads[processorId];
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
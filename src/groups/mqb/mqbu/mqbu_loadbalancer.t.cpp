@@ -16,6 +16,7 @@
 #include <mqbu_loadbalancer.h>
 
 #include <bsl_limits.h>
+#include <bsl_vector.h>
 
 // TEST DRIVER
 #include <bmqtst_testhelper.h>
@@ -236,6 +237,78 @@ static void test4_forceAssociate()
         obj.setProcessorForClient(reinterpret_cast<MyDummyType*>(4), -1));
 }
 
+static void test5_rebalance()
+{
+    bmqtst::TestHelper::printTestName("REBALANCE");
+
+    typedef mqbu::LoadBalancerMigration<MyDummyType> Migration;
+
+    const int                       k_NUM_PROCESSORS = 2;
+    mqbu::LoadBalancer<MyDummyType> obj(k_NUM_PROCESSORS,
+                                        bmqtst::TestHelperUtil::allocator());
+    bsl::vector<Migration> migrations(bmqtst::TestHelperUtil::allocator());
+
+    MyDummyType* client0 = reinterpret_cast<MyDummyType*>(0);
+    MyDummyType* client1 = reinterpret_cast<MyDummyType*>(1);
+    MyDummyType* client2 = reinterpret_cast<MyDummyType*>(2);
+    MyDummyType* client3 = reinterpret_cast<MyDummyType*>(3);
+
+    PV(":: Colocate the hot clients on processor '0'");
+    obj.setProcessorForClient(client0, 0);
+    obj.setProcessorForClient(client1, 0);
+    obj.setProcessorForClient(client2, 1);
+    obj.setProcessorForClient(client3, 1);
+
+    obj.setClientLoad(client0, 100);
+    obj.setClientLoad(client1, 90);
+    obj.setClientLoad(client2, 10);
+    obj.setClientLoad(client3, 5);
+    BMQTST_ASSERT_EQ(obj.loadForProcessor(0), 190);
+    BMQTST_ASSERT_EQ(obj.loadForProcessor(1), 15);
+
+    PV(":: No migration is performed if not allowed");
+    BMQTST_ASSERT_EQ(obj.rebalance(&migrations, 10, 0), 0);
+    BMQTST_ASSERT(migrations.empty());
+    BMQTST_ASSERT_EQ(obj.loadForProcessor(0), 190);
+
+    PV(":: Rebalance migrates the client making loads the closest");
+    // Imbalance is 175: moving 'client1' (90) leads to a difference of 5,
+    // moving 'client0' (100) leads to a difference of 25.
+    BMQTST_ASSERT_EQ(obj.rebalance(&migrations, 10, 4), 1);
+    BMQTST_ASSERT_EQ(migrations.size(), 1U);
+    BMQTST_ASSERT_EQ(migrations[0].d_client_p, client1);
+    BMQTST_ASSERT_EQ(migrations[0].d_fromProcessorId, 0);
+    BMQTST_ASSERT_EQ(migrations[0].d_toProcessorId, 1);
+    BMQTST_ASSERT_EQ(obj.getProcessorForClient(client1), 1);
+    BMQTST_ASSERT_EQ(obj.loadForProcessor(0), 100);
+    BMQTST_ASSERT_EQ(obj.loadForProcessor(1), 105);
+    BMQTST_ASSERT_EQ(obj.clientsCountForProcessor(0), 1);
+    BMQTST_ASSERT_EQ(obj.clientsCountForProcessor(1), 3);
+
+    PV(":: Loads within the hysteresis are not rebalanced");
+    BMQTST_ASSERT_EQ(obj.rebalance(&migrations, 10, 4), 0);
+    BMQTST_ASSERT(migrations.empty());
+
+    PV(":: Loads outside the hysteresis are rebalanced");
+    obj.setClientLoad(client2, 60);
+    BMQTST_ASSERT_EQ(obj.loadForProcessor(1), 155);
+    BMQTST_ASSERT_EQ(obj.rebalance(&migrations, 10, 4), 1);
+    BMQTST_ASSERT_EQ(migrations[0].d_client_p, client3);
+    BMQTST_ASSERT_EQ(migrations[0].d_fromProcessorId, 1);
+    BMQTST_ASSERT_EQ(migrations[0].d_toProcessorId, 0);
+    BMQTST_ASSERT_EQ(obj.loadForProcessor(0), 105);
+    BMQTST_ASSERT_EQ(obj.loadForProcessor(1), 150);
+
+    PV(":: Removing a client releases its load");
+    obj.removeClient(client2);
+    BMQTST_ASSERT_EQ(obj.loadForProcessor(1), 90);
+
+    PV(":: Setting the load of a non existing client has no effect");
+    obj.setClientLoad(client2, 1000);
+    BMQTST_ASSERT_EQ(obj.loadForProcessor(0), 105);
+    BMQTST_ASSERT_EQ(obj.loadForProcessor(1), 90);
+}
+
 // ============================================================================
 //                                 MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -246,6 +319,7 @@ int main(int argc, char* argv[])
 
     switch (_testCase) {
     case 0:
+    case 5: test5_rebalance(); break;
     case 4: test4_forceAssociate(); break;
     case 3: test3_loadBalancing(); break;
     case 2: test2_singleProcessorLoadBalancer(); break;
@@ -38,6 +38,7 @@
 #include <bslmf_isbitwiseequalitycomparable.h>
 #include <bslmf_istriviallycopyable.h>
 #include <bslmf_nestedtraitdeclaration.h>
+#include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -238,9 +239,10 @@ struct StorageKeyLess {
 // class StorageKeyHashAlgo
 // ========================
 
-/// This class provides a hashing algorithm for `mqbu::StorageKey`.  At the
-/// time of writing, this algorithm was found to be approximately X than the
-/// default hashing algorithm which comes with `bslh` package.
+/// This class provides a hashing algorithm for `mqbu::StorageKey`.  The
+/// bytes of the key are mixed with a single multiplication, which is much
+/// cheaper than the default hashing algorithm which comes with `bslh`
+/// package, and never maps two distinct keys to the same hash.
 /// Performance-critical applications may want to use this hashing algorithm
 /// instead of the default one.
 class StorageKeyHashAlgo {
@@ -258,6 +260,9 @@ class StorageKeyHashAlgo {
     StorageKeyHashAlgo();
 
     // MANIPULATORS
+
+    /// Compute the hash of the specified `data` of the specified `numBytes`.
+    /// The behavior is undefined unless `numBytes` is at most 8.
     void operator()(const void* data, size_t numBytes);
 
     /// Compute and return the hash for the StorageKey.
@@ -404,20 +409,20 @@ inline StorageKeyHashAlgo::StorageKeyHashAlgo()
 }
 
 // MANIPULATORS
-inline void StorageKeyHashAlgo::operator()(const void*              data,
-                                           BSLA_MAYBE_UNUSED size_t numBytes)
+inline void StorageKeyHashAlgo::operator()(const void* data, size_t numBytes)
 {
-    // 10K Keys
-    // --------
-    // o With 'bmqc::OrderedHashMap': Average of 17M insertions per second
-    //                                (compared to average of 12M insertions
-    //                                per second using the default hash)
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(numBytes <= sizeof(bsls::Types::Uint64));
+
+    // The key is a small binary value, so load all its bytes at once and
+    // multiply them by an odd constant (a bijection), which spreads every
+    // byte of the key over the high bits of the hash (as opposed to only
+    // summing the first four bytes of the key).
 
-    d_result = 5381ULL;
+    bsls::Types::Uint64 value = 0;
+    bsl::memcpy(&value, data, numBytes);
 
-    const unsigned char* start = reinterpret_cast<const unsigned char*>(data);
-    d_result += (start[0]) + (start[1] << 8) + (start[2] << 16) +
-                (start[3] << 24);
+    d_result = value * 0x9E3779B97F4A7C15ULL;
 }
 
 inline StorageKeyHashAlgo::result_type StorageKeyHashAlgo::computeHash()
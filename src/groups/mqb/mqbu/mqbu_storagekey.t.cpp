@@ -499,6 +499,19 @@ void test5_customHashUniqueness()
     size_t                               maxCollisionsHash = 0;
     size_t                               maxCollisions     = 0;
 
+    // Keys differing only by their last byte have different hashes
+    {
+        const char k_BYTES1[] = {1, 2, 3, 4, 5};
+        const char k_BYTES2[] = {1, 2, 3, 4, 6};
+
+        const mqbu::StorageKey key1(mqbu::StorageKey::BinaryRepresentation(),
+                                    k_BYTES1);
+        const mqbu::StorageKey key2(mqbu::StorageKey::BinaryRepresentation(),
+                                    k_BYTES2);
+
+        BMQTST_ASSERT_NE(hasher(key1), hasher(key2));
+    }
+
     // Generate hashes and keep track of recurring hashes
     for (CITER citer = keySet.cbegin(); citer != keySet.cend(); ++citer) {
         const mqbu::StorageKey& currKey = *citer;
@@ -513,12 +526,9 @@ void test5_customHashUniqueness()
         }
     }
 
-    // Update this comment
-
-    // Above value is just chosen after looking at the number of collisions
-    // by running this test case manually.  In most runs, number of
-    // collisions was in the range of [1, 2].
-    const size_t k_MAX_EXPECTED_COLLISIONS = 3;
+    // The custom hash is a bijection of the bytes of the key, so distinct
+    // keys never collide.
+    const size_t k_MAX_EXPECTED_COLLISIONS = 2;
 
     BMQTST_ASSERT_LT(maxCollisions, k_MAX_EXPECTED_COLLISIONS);
 
@@ -0,0 +1,123 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbu_stringinterner.h>
+
+#include <mqbscm_version.h>
+
+// BDE
+#include <bsl_utility.h>
+#include <bslma_default.h>
+#include <bslma_destructorproctor.h>
+#include <bslmt_readlockguard.h>
+#include <bslmt_writelockguard.h>
+
+namespace BloombergLP {
+namespace mqbu {
+
+// --------------------
+// class StringInterner
+// --------------------
+
+// PUBLIC CONSTANTS
+const int StringInterner::k_MAX_NUM_STRINGS = k_CHUNK_SIZE * k_MAX_NUM_CHUNKS;
+
+// CREATORS
+StringInterner::StringInterner(bslma::Allocator* basicAllocator)
+: d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_lock()
+, d_index(d_allocator_p)
+, d_numStrings(0)
+{
+    for (int i = 0; i < k_MAX_NUM_CHUNKS; ++i) {
+        d_chunks[i] = 0;
+    }
+}
+
+StringInterner::~StringInterner()
+{
+    const int numStrings = d_numStrings.loadRelaxed();
+
+    for (int i = 0; i < numStrings; ++i) {
+        bsl::string* chunk = d_chunks[i >> k_CHUNK_SIZE_LOG2].loadRelaxed();
+        chunk[i & (k_CHUNK_SIZE - 1)].~basic_string();
+    }
+
+    for (int i = 0; i < k_MAX_NUM_CHUNKS; ++i) {
+        bsl::string* chunk = d_chunks[i].loadRelaxed();
+        if (chunk == 0) {
+            break;  // BREAK
+        }
+        d_allocator_p->deallocate(chunk);
+    }
+}
+
+// MANIPULATORS
+int StringInterner::intern(const bslstl::StringRef& value)
+{
+    const int id = find(value);
+    if (id != k_INVALID_ID) {
+        // Fast path: already interned
+        return id;  // RETURN
+    }
+
+    bslmt::WriteLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);  // LOCK
+
+    // Check again, 'value' may have been interned while the lock was
+    // released.
+    IndexMap::const_iterator it = d_index.find(value);
+    if (it != d_index.end()) {
+        return it->second;  // RETURN
+    }
+
+    const int newId = d_numStrings.loadRelaxed();
+    if (newId == k_MAX_NUM_STRINGS) {
+        return k_INVALID_ID;  // RETURN
+    }
+
+    const int    chunkIndex = newId >> k_CHUNK_SIZE_LOG2;
+    bsl::string* chunk      = d_chunks[chunkIndex].loadRelaxed();
+    if (chunk == 0) {
+        chunk = static_cast<bsl::string*>(
+            d_allocator_p->allocate(k_CHUNK_SIZE * sizeof(bsl::string)));
+        d_chunks[chunkIndex].storeRelease(chunk);
+    }
+
+    // The string is constructed in place, and never moved afterwards, so
+    // that the index can refer to it (including to its short string
+    // buffer).
+    bsl::string* str = new (chunk + (newId & (k_CHUNK_SIZE - 1)))
+        bsl::string(value.data(), value.length(), d_allocator_p);
+
+    bslma::DestructorProctor<bsl::string> proctor(str);
+    d_index.insert(bsl::make_pair(bslstl::StringRef(*str), newId));
+    proctor.release();
+
+    d_numStrings.storeRelease(newId + 1);
+
+    return newId;
+}
+
+// ACCESSORS
+int StringInterner::find(const bslstl::StringRef& value) const
+{
+    bslmt::ReadLockGuard<bslmt::ReaderWriterMutex> guard(&d_lock);  // LOCK
+
+    IndexMap::const_iterator it = d_index.find(value);
+    return it == d_index.end() ? k_INVALID_ID : it->second;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
@@ -0,0 +1,191 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MQBU_STRINGINTERNER
+#define INCLUDED_MQBU_STRINGINTERNER
+
+//@PURPOSE: Provide a thread-safe table of interned strings.
+//
+//@CLASSES:
+//  mqbu::StringInterner: thread-safe table assigning stable ids to strings
+//
+//@DESCRIPTION: 'mqbu::StringInterner' is a mechanism storing a single copy of
+// each distinct string it is given (e.g., a queue URI or an appId), and
+// assigning to it a small, dense, and stable integer id.  Once a string has
+// been interned, components can store and compare its id instead of a copy of
+// the string, and key their hot-path lookup tables by that id (e.g., using a
+// vector indexed by id, or a hash map with a trivial hash), so that the string
+// is hashed only once, upon interning, rather than upon every lookup.
+//
+// Ids are assigned sequentially starting at 0, and are never reused: interned
+// strings remain in the table until it is destroyed.  The string of a given
+// id is returned by reference, and the reference remains valid for the
+// lifetime of the interner.
+//
+/// Thread Safety
+///-------------
+// This component is fully thread-safe.  'intern' and 'find' synchronize on a
+// reader-writer lock, which is only acquired for writing when a new string is
+// added.  'string' does not acquire any lock.
+//
+/// Usage
+///-----
+//..
+//  mqbu::StringInterner interner(allocator);
+//
+//  const int id = interner.intern("bmq://bmq.test.mem.priority/q1");
+//  BSLS_ASSERT(id == interner.intern("bmq://bmq.test.mem.priority/q1"));
+//  BSLS_ASSERT(interner.string(id) == "bmq://bmq.test.mem.priority/q1");
+//..
+
+// BDE
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmt_readerwritermutex.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_keyword.h>
+#include <bslstl_stringref.h>
+
+namespace BloombergLP {
+namespace mqbu {
+
+// ====================
+// class StringInterner
+// ====================
+
+/// Thread-safe table of interned strings.
+class StringInterner {
+  public:
+    // PUBLIC CONSTANTS
+
+    /// Id returned when a string is not interned, or cannot be.
+    static const int k_INVALID_ID = -1;
+
+    /// Maximum number of strings that can be interned.
+    static const int k_MAX_NUM_STRINGS;
+
+  private:
+    // PRIVATE CONSTANTS
+    enum {
+        /// Log2 of the number of strings per chunk.
+        k_CHUNK_SIZE_LOG2 = 10,
+
+        /// Number of strings per chunk.
+        k_CHUNK_SIZE = 1 << k_CHUNK_SIZE_LOG2,
+
+        /// Maximum number of chunks.
+        k_MAX_NUM_CHUNKS = 1024
+    };
+
+    // PRIVATE TYPES
+
+    /// Map from an interned string, referring to the copy stored in the
+    /// chunks, to its id.
+    typedef bsl::unordered_map<bslstl::StringRef, int> IndexMap;
+
+  private:
+    // DATA
+
+    /// Allocator to use.
+    bslma::Allocator* d_allocator_p;
+
+    /// Lock protecting `d_index` and the addition of strings.
+    mutable bslmt::ReaderWriterMutex d_lock;
+
+    /// Index of the interned strings.
+    IndexMap d_index;
+
+    /// Storage of the interned strings: the string of id `i` is at index
+    /// `i % k_CHUNK_SIZE` of chunk `i / k_CHUNK_SIZE`.  Chunks are never
+    /// moved nor freed before destruction, so that interned strings are
+    /// stable, and can be read without acquiring `d_lock`.
+    bsls::AtomicPointer<bsl::string> d_chunks[k_MAX_NUM_CHUNKS];
+
+    /// Number of interned strings.
+    bsls::AtomicInt d_numStrings;
+
+  private:
+    // NOT IMPLEMENTED
+    StringInterner(const StringInterner&) BSLS_KEYWORD_DELETED;
+    StringInterner& operator=(const StringInterner&) BSLS_KEYWORD_DELETED;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(StringInterner, bslma::UsesBslmaAllocator)
+
+    // CREATORS
+
+    /// Create an empty interner using the optionally specified
+    /// `basicAllocator` to supply memory.
+    explicit StringInterner(bslma::Allocator* basicAllocator = 0);
+
+    /// Destroy this object, and all the interned strings.
+    ~StringInterner();
+
+    // MANIPULATORS
+
+    /// Return the id of the specified `value`, interning it if it was not
+    /// already interned.  Return `k_INVALID_ID` if `value` is not interned
+    /// and `k_MAX_NUM_STRINGS` strings are already interned.
+    int intern(const bslstl::StringRef& value);
+
+    // ACCESSORS
+
+    /// Return the id of the specified `value` if it is interned, and
+    /// `k_INVALID_ID` otherwise.
+    int find(const bslstl::StringRef& value) const;
+
+    /// Return a reference, valid for the lifetime of this object, to the
+    /// interned string having the specified `id`.  The behavior is
+    /// undefined unless `id` was returned by `intern` or `find` and is not
+    /// `k_INVALID_ID`.
+    const bsl::string& string(int id) const;
+
+    /// Return the number of interned strings.
+    int numStrings() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+// --------------------
+// class StringInterner
+// --------------------
+
+// ACCESSORS
+inline const bsl::string& StringInterner::string(int id) const
+{
+    // PRECONDITIONS
+    BSLS_ASSERT_SAFE(0 <= id && id < d_numStrings.loadAcquire());
+
+    const bsl::string* chunk =
+        d_chunks[id >> k_CHUNK_SIZE_LOG2].loadAcquire();
+    return chunk[id & (k_CHUNK_SIZE - 1)];
+}
+
+inline int StringInterner::numStrings() const
+{
+    return d_numStrings.loadAcquire();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
@@ -0,0 +1,233 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mqbu_stringinterner.h>
+
+// BMQ
+#include <bmqu_memoutstream.h>
+
+// BDE
+#include <bdlf_bind.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+// TEST DRIVER
+#include <bmqtst_testhelper.h>
+
+// CONVENIENCE
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                            TEST HELPERS UTILITY
+// ----------------------------------------------------------------------------
+namespace {
+
+/// Return the uri of the queue of the specified `index`.
+bsl::string queueUri(int index)
+{
+    bmqu::MemOutStream os(bmqtst::TestHelperUtil::allocator());
+    os << "bmq://bmq.test.mem.priority/queue" << index;
+    return bsl::string(os.str(), bmqtst::TestHelperUtil::allocator());
+}
+
+/// Wait on the specified `barrier`, then intern the uris of the specified
+/// `numStrings` queues in the specified `interner` and load their ids into
+/// the specified `ids`.
+void threadFunction(bsl::vector<int>*     ids,
+                    mqbu::StringInterner* interner,
+                    bslmt::Barrier*       barrier,
+                    int                   numStrings)
+{
+    ids->reserve(numStrings);
+    barrier->wait();
+
+    for (int i = 0; i < numStrings; ++i) {
+        ids->push_back(interner->intern(queueUri(i)));
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                    TESTS
+// ----------------------------------------------------------------------------
+
+static void test1_breathingTest()
+// ------------------------------------------------------------------------
+// BREATHING TEST
+//
+// Concerns:
+//   Exercise basic functionality before beginning testing in earnest.
+//   Probe that functionality to discover basic errors.
+//
+// Testing:
+//   Basic functionality.
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("BREATHING TEST");
+
+    mqbu::StringInterner obj(bmqtst::TestHelperUtil::allocator());
+
+    BMQTST_ASSERT_EQ(obj.numStrings(), 0);
+    BMQTST_ASSERT_EQ(obj.find("foo"), mqbu::StringInterner::k_INVALID_ID);
+
+    const bsl::string bar("bar", bmqtst::TestHelperUtil::allocator());
+
+    const int fooId = obj.intern("foo");
+    const int barId = obj.intern(bar);
+
+    BMQTST_ASSERT_EQ(fooId, 0);
+    BMQTST_ASSERT_EQ(barId, 1);
+    BMQTST_ASSERT_EQ(obj.numStrings(), 2);
+
+    BMQTST_ASSERT_EQ(obj.intern("foo"), fooId);
+    BMQTST_ASSERT_EQ(obj.find("foo"), fooId);
+    BMQTST_ASSERT_EQ(obj.find("bar"), barId);
+    BMQTST_ASSERT_EQ(obj.find("baz"), mqbu::StringInterner::k_INVALID_ID);
+    BMQTST_ASSERT_EQ(obj.numStrings(), 2);
+
+    BMQTST_ASSERT_EQ(obj.string(fooId), "foo");
+    BMQTST_ASSERT_EQ(obj.string(barId), "bar");
+
+    // The empty string is a valid string
+    const int emptyId = obj.intern("");
+    BMQTST_ASSERT_EQ(emptyId, 2);
+    BMQTST_ASSERT_EQ(obj.string(emptyId), "");
+}
+
+static void test2_stability()
+// ------------------------------------------------------------------------
+// STABILITY
+//
+// Concerns:
+//   1. Ids are dense and assigned in interning order.
+//   2. The references returned by 'string' remain valid, and keep their
+//      value, while more strings, spanning several chunks, are interned.
+//
+// Testing:
+//   intern
+//   find
+//   string
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelper::printTestName("STABILITY");
+
+    const int k_NUM_STRINGS = 5000;
+
+    mqbu::StringInterner obj(bmqtst::TestHelperUtil::allocator());
+
+    const int          firstId      = obj.intern(queueUri(0));
+    const bsl::string& first        = obj.string(firstId);
+    const bsl::string* firstAddress = &first;
+
+    for (int i = 1; i < k_NUM_STRINGS; ++i) {
+        BMQTST_ASSERT_EQ_D(i, obj.intern(queueUri(i)), i);
+    }
+
+    BMQTST_ASSERT_EQ(obj.numStrings(), k_NUM_STRINGS);
+    BMQTST_ASSERT_EQ(&obj.string(firstId), firstAddress);
+    BMQTST_ASSERT_EQ(first, queueUri(0));
+
+    for (int i = 0; i < k_NUM_STRINGS; ++i) {
+        const bsl::string uri = queueUri(i);
+        BMQTST_ASSERT_EQ_D(i, obj.find(uri), i);
+        BMQTST_ASSERT_EQ_D(i, obj.string(i), uri);
+    }
+}
+
+static void test3_multithread()
+// ------------------------------------------------------------------------
+// MULTITHREAD
+//
+// Concerns:
+//   Concurrently interning the same strings from multiple threads yields
+//   the same id for a given string in every thread, and interns each
+//   string exactly once.
+//
+// Testing:
+//   intern
+// ------------------------------------------------------------------------
+{
+    bmqtst::TestHelperUtil::ignoreCheckGblAlloc() = true;
+    // Can't ensure no global memory is allocated because
+    // 'bslmt::ThreadUtil::create()' uses the global allocator to allocate
+    // memory.
+
+    bmqtst::TestHelper::printTestName("MULTITHREAD");
+
+    const int k_NUM_THREADS = 8;
+    const int k_NUM_STRINGS = 10000;
+
+    mqbu::StringInterner obj(bmqtst::TestHelperUtil::allocator());
+
+    bslmt::ThreadGroup threadGroup(bmqtst::TestHelperUtil::allocator());
+
+    // Barrier to get each thread to start at the same time; `+1` for this
+    // (main) thread.
+    bslmt::Barrier barrier(k_NUM_THREADS + 1);
+
+    bsl::vector<bsl::vector<int> > threadsData(
+        bmqtst::TestHelperUtil::allocator());
+    threadsData.resize(k_NUM_THREADS);
+
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        int rc = threadGroup.addThread(bdlf::BindUtil::bind(&threadFunction,
+                                                            &threadsData[i],
+                                                            &obj,
+                                                            &barrier,
+                                                            k_NUM_STRINGS));
+        BMQTST_ASSERT_EQ_D(i, rc, 0);
+    }
+
+    barrier.wait();
+    threadGroup.joinAll();
+
+    BMQTST_ASSERT_EQ(obj.numStrings(), k_NUM_STRINGS);
+
+    for (int i = 0; i < k_NUM_STRINGS; ++i) {
+        const int id = threadsData[0][i];
+        for (int tIt = 1; tIt < k_NUM_THREADS; ++tIt) {
+            BMQTST_ASSERT_EQ_D(i << ", thread " << tIt,
+                               threadsData[tIt][i],
+                               id);
+        }
+        BMQTST_ASSERT_EQ_D(i, obj.string(id), queueUri(i));
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    TEST_PROLOG(bmqtst::TestHelper::e_DEFAULT);
+
+    switch (_testCase) {
+    case 0:
+    case 3: test3_multithread(); break;
+    case 2: test2_stability(); break;
+    case 1: test1_breathingTest(); break;
+    default: {
+        cerr << "WARNING: CASE '" << _testCase << "' NOT FOUND." << endl;
+        bmqtst::TestHelperUtil::testStatus() = -1;
+    } break;
+    }
+
+    TEST_EPILOG(bmqtst::TestHelper::e_CHECK_GBL_ALLOC);
+}
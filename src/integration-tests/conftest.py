@@ -14,6 +14,7 @@
 # limitations under the License.
 
 import contextlib
+import json
 import logging
 
 import pytest
@@ -141,6 +142,44 @@ def pytest_addoption(parser):
         help=help_,
     )
 
+    help_ = "run the performance tests (marked 'perf'), skipped otherwise"
+    parser.addoption(
+        "--bmq-perf",
+        dest="bmq_perf",
+        action="store_true",
+        default=False,
+        help=help_,
+    )
+
+    help_ = "write the metrics recorded by the performance tests to FILE"
+    parser.addoption(
+        "--bmq-perf-results",
+        dest="bmq_perf_results",
+        action="store",
+        metavar="FILE",
+        help=help_,
+    )
+
+    help_ = "compare the performance metrics to the ones stored in FILE"
+    parser.addoption(
+        "--bmq-perf-baseline",
+        dest="bmq_perf_baseline",
+        action="store",
+        metavar="FILE",
+        help=help_,
+    )
+
+    help_ = "tolerate a relative regression of RATIO against the baseline"
+    parser.addoption(
+        "--bmq-perf-tolerance",
+        dest="bmq_perf_tolerance",
+        type=float,
+        action="store",
+        default=0.25,
+        metavar="RATIO",
+        help=help_,
+    )
+
 
 def pytest_configure(config):
     level_spec = config.getoption(PYTEST_LOG_SPEC_VAR) or config.getini(
@@ -156,6 +195,11 @@ def pytest_configure(config):
 
 
 def pytest_collection_modifyitems(config, items):
+    if not config.getoption("bmq_perf"):
+        for item in items:
+            if item.get_closest_marker("perf") is not None:
+                item.add_marker(pytest.mark.skip(reason="requires --bmq-perf"))
+
     active_wave = config.getoption("bmq_wave")
     if active_wave is None:
         return
@@ -220,3 +264,71 @@ def sc_domain_urls(request):
 )
 def domain_urls(request):
     return request.param
+
+
+class PerfResults:
+    """
+    Metrics recorded by the performance tests, keyed by test name and metric
+    name, optionally checked against a baseline of previously recorded
+    metrics.
+    """
+
+    def __init__(self, baseline, tolerance):
+        self.metrics = {}
+        self._baseline = baseline
+        self._tolerance = tolerance
+
+    def record(self, test, metric, value, higher_is_better):
+        """
+        Record the specified 'value' of the specified 'metric' for the
+        specified 'test', and assert that it did not regress by more than the
+        tolerance against the baseline, if any.  The specified
+        'higher_is_better' tells in which direction the metric regresses.
+        """
+
+        key = f"{test}::{metric}"
+        self.metrics[key] = value
+        logging.getLogger("test").info("perf %s = %s", key, value)
+
+        if key not in self._baseline:
+            return
+
+        baseline = self._baseline[key]
+        if higher_is_better:
+            limit = baseline * (1 - self._tolerance)
+            assert value >= limit, f"{key} regressed: {value} < {limit}"
+        else:
+            limit = baseline * (1 + self._tolerance)
+            assert value <= limit, f"{key} regressed: {value} > {limit}"
+
+
+@pytest.fixture(scope="session")
+def perf_results(request):
+    config = request.config
+
+    baseline = {}
+    baseline_path = config.getoption("bmq_perf_baseline")
+    if baseline_path:
+        with open(baseline_path, encoding="ascii") as baseline_file:
+            baseline = json.load(baseline_file)
+
+    results = PerfResults(baseline, config.getoption("bmq_perf_tolerance"))
+    yield results
+
+    results_path = config.getoption("bmq_perf_results")
+    if results_path and results.metrics:
+        with open(results_path, "w", encoding="ascii") as results_file:
+            json.dump(results.metrics, results_file, indent=4, sort_keys=True)
+
+
+@pytest.fixture
+def perf(request, perf_results):
+    """
+    Return a function recording a metric of the current test, see
+    'PerfResults.record'.
+    """
+
+    def record(metric, value, higher_is_better=False):
+        perf_results.record(request.node.name, metric, value, higher_is_better)
+
+    return record
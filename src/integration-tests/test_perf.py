@@ -0,0 +1,143 @@
+# Copyright 2026 Bloomberg Finance L.P.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+This test suite runs standardized workloads and records their performance
+metrics: throughput, ACK latency, failover time and restart-to-ready duration.
+The tests are skipped unless '--bmq-perf' is specified.  Use
+'--bmq-perf-results' to save the metrics to a JSON file, and
+'--bmq-perf-baseline' to fail the tests whose metrics regressed by more than
+'--bmq-perf-tolerance' compared to a previously saved file.
+
+Note that clients are driven through the command line of bmqtool, so the
+metrics include this overhead.  They are meant to be compared between runs on
+the same host, not interpreted in absolute terms.
+"""
+
+import time
+
+import pytest
+
+import blazingmq.dev.it.testconstants as tc
+from blazingmq.dev.it.fixtures import (
+    Cluster,
+)
+from blazingmq.dev.it.util import wait_until
+
+pytestmark = pytest.mark.perf
+
+NUM_BATCHES = 20
+BATCH_SIZE = 50
+NUM_LATENCY_SAMPLES = 100
+
+
+def _open_producer_and_consumer(cluster: Cluster, uri):
+    proxies = cluster.proxy_cycle()
+    producer = next(proxies).create_client("producer")
+    producer.open(uri, flags=["write", "ack"], succeed=True)
+    consumer = next(proxies).create_client("consumer")
+    consumer.open(uri, flags=["read"], succeed=True)
+    return producer, consumer
+
+
+def test_perf_throughput(cluster: Cluster, domain_urls: tc.DomainUrls, perf):
+    """
+    Post batches of messages and measure the rate at which they are delivered
+    to a consumer.
+    """
+
+    uri = domain_urls.uri_priority
+    producer, consumer = _open_producer_and_consumer(cluster, uri)
+
+    num_messages = NUM_BATCHES * BATCH_SIZE
+    start = time.monotonic()
+    for batch in range(NUM_BATCHES):
+        payload = [f"msg{batch}-{i}" for i in range(BATCH_SIZE)]
+        producer.post(uri, payload=payload, succeed=True)
+
+    assert wait_until(
+        lambda: len(consumer.list(uri, block=True)) == num_messages,
+        timeout=60,
+        interval=0.1,
+        quiet=True,
+    )
+    elapsed = time.monotonic() - start
+
+    perf("messages_per_second", num_messages / elapsed, higher_is_better=True)
+
+
+def test_perf_ack_latency(cluster: Cluster, domain_urls: tc.DomainUrls, perf):
+    """
+    Post messages one at a time and measure the 99th percentile of the time
+    until their ACK is received.
+    """
+
+    uri = domain_urls.uri_priority
+    producer, _ = _open_producer_and_consumer(cluster, uri)
+
+    latencies = []
+    for i in range(NUM_LATENCY_SAMPLES):
+        start = time.monotonic()
+        producer.post(uri, payload=[f"msg{i}"], wait_ack=True, succeed=True)
+        latencies.append(time.monotonic() - start)
+
+    latencies.sort()
+    perf("p99_ack_latency_seconds", latencies[len(latencies) * 99 // 100])
+
+
+def test_perf_failover(multi_node: Cluster, domain_urls: tc.DomainUrls, perf):
+    """
+    Kill the leader and measure the time until a new leader is elected and a
+    PUT is acknowledged again.
+    """
+
+    uri = domain_urls.uri_priority
+    producer, _ = _open_producer_and_consumer(multi_node, uri)
+    producer.post(uri, payload=["before"], wait_ack=True, succeed=True)
+
+    leader = multi_node.last_known_leader
+    leader.check_exit_code = False
+
+    start = time.monotonic()
+    leader.kill()
+    leader.wait()
+    multi_node.wait_leader()
+    producer.post(uri, payload=["after"], wait_ack=True, succeed=True)
+    elapsed = time.monotonic() - start
+
+    perf("failover_seconds", elapsed)
+
+
+def test_perf_restart(cluster: Cluster, domain_urls: tc.DomainUrls, perf):
+    """
+    Restart the whole cluster with messages in storage and measure the time
+    until all the nodes are ready and a PUT is acknowledged again.
+    """
+
+    uri = domain_urls.uri_priority
+    producer, _ = _open_producer_and_consumer(cluster, uri)
+    for batch in range(NUM_BATCHES):
+        payload = [f"msg{batch}-{i}" for i in range(BATCH_SIZE)]
+        producer.post(uri, payload=payload, succeed=True)
+    producer.post(uri, payload=["last"], wait_ack=True, succeed=True)
+
+    start = time.monotonic()
+    cluster.restart_nodes(wait_leader=True, wait_ready=True)
+    if cluster.is_single_node:
+        producer.wait_state_restored()
+    producer.post(uri, payload=["after"], wait_ack=True, succeed=True)
+    elapsed = time.monotonic() - start
+
+    perf("restart_to_ready_seconds", elapsed)
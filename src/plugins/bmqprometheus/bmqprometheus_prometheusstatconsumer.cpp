@@ -185,6 +185,9 @@ PrometheusStatConsumer::PrometheusStatConsumer(
 , d_actionCounter(0)
 , d_isStarted(false)
 , d_prometheusRegistry_p(std::make_shared< ::prometheus::Registry>())
+, d_families()
+, d_series()
+, d_generation(0)
 {
     // Initialize stat contexts
     d_systemStatContext_p       = getStatContext("system");
@@ -288,6 +291,8 @@ void PrometheusStatConsumer::captureQueueStats()
 
     typedef mqbstat::QueueStatsDomain::Stat Stat;  // Shortcut
 
+    ++d_generation;
+
     for (bmqst::StatContextIterator domainIt =
              domainsStatContext.subcontextIterator();
          domainIt;
@@ -296,25 +301,36 @@ void PrometheusStatConsumer::captureQueueStats()
                  domainIt->subcontextIterator();
              queueIt;
              ++queueIt) {
-            bslma::ManagedPtr<bdld::ManagedDatum> mdSp = queueIt->datum();
-            bdld::DatumMapRef                     map = mdSp->datum().theMap();
-
-            const auto role = mqbstat::QueueStatsDomain::getValue(
-                *queueIt,
-                d_snapshotId,
-                mqbstat::QueueStatsDomain::Stat::e_ROLE);
-
-            Tagger tagger;
-            tagger.setCluster(map.find("cluster")->theString())
-                .setDomain(map.find("domain")->theString())
-                .setTier(map.find("tier")->theString())
-                .setQueue(map.find("queue")->theString())
-                .setRole(mqbstat::QueueStatsDomain::Role::toAscii(
-                    static_cast<mqbstat::QueueStatsDomain::Role::Enum>(role)))
-                .setInstance(mqbcfg::BrokerConfig::get().brokerInstanceName())
-                .setDataType("host-data");
+            const int role = static_cast<int>(
+                mqbstat::QueueStatsDomain::getValue(
+                    *queueIt,
+                    d_snapshotId,
+                    mqbstat::QueueStatsDomain::Stat::e_ROLE));
+
+            // Only build the labels of the queue the first time it is
+            // published, or if its role changed.
+            Series* seriesPtr = findSeries(queueIt->uniqueId(), role);
+            if (!seriesPtr) {
+                bslma::ManagedPtr<bdld::ManagedDatum> mdSp = queueIt->datum();
+                bdld::DatumMapRef map = mdSp->datum().theMap();
 
-            const auto labels = tagger.getLabels();
+                Tagger tagger;
+                tagger.setCluster(map.find("cluster")->theString())
+                    .setDomain(map.find("domain")->theString())
+                    .setTier(map.find("tier")->theString())
+                    .setQueue(map.find("queue")->theString())
+                    .setRole(mqbstat::QueueStatsDomain::Role::toAscii(
+                        static_cast<mqbstat::QueueStatsDomain::Role::Enum>(
+                            role)))
+                    .setInstance(
+                        mqbcfg::BrokerConfig::get().brokerInstanceName())
+                    .setDataType("host-data");
+
+                seriesPtr = &resetSeries(queueIt->uniqueId(),
+                                         role,
+                                         tagger.getLabels());
+            }
+            Series& series = *seriesPtr;
 
             // Heartbeat metric
             {
@@ -323,10 +339,7 @@ void PrometheusStatConsumer::captureQueueStats()
                 // a time series containing all the tags that can be leveraged
                 // in Grafana.
 
-                auto& heartbeatGauge = ::prometheus::BuildGauge()
-                                           .Name("queue_heartbeat")
-                                           .Register(*d_prometheusRegistry_p);
-                heartbeatGauge.Add(labels).Set(0);
+                updateSeriesMetric(&series, "queue_heartbeat", 0);
             }
 
             // Queue metrics
@@ -346,20 +359,33 @@ void PrometheusStatConsumer::captureQueueStats()
                     {"queue_ack_msgs", Stat::e_ACK_ABS},
                     {"queue_ack_time_avg", Stat::e_ACK_TIME_AVG},
                     {"queue_ack_time_max", Stat::e_ACK_TIME_MAX},
+                    {"queue_ack_time_p50", Stat::e_ACK_TIME_P50},
+                    {"queue_ack_time_p99", Stat::e_ACK_TIME_P99},
+                    {"queue_ack_time_p999", Stat::e_ACK_TIME_P999},
                     {"queue_nack_msgs_delta", Stat::e_NACK_DELTA},
                     {"queue_nack_msgs", Stat::e_NACK_ABS},
                     {"queue_confirm_msgs", Stat::e_CONFIRM_DELTA},
                     {"queue_confirm_msgs", Stat::e_CONFIRM_ABS},
                     {"queue_confirm_time_avg", Stat::e_CONFIRM_TIME_AVG},
-                    {"queue_confirm_time_max", Stat::e_CONFIRM_TIME_MAX}};
+                    {"queue_confirm_time_max", Stat::e_CONFIRM_TIME_MAX},
+                    {"queue_confirm_time_p50", Stat::e_CONFIRM_TIME_P50},
+                    {"queue_confirm_time_p99", Stat::e_CONFIRM_TIME_P99},
+                    {"queue_confirm_time_p999", Stat::e_CONFIRM_TIME_P999},
+                    {"queue_cpu_time", Stat::e_CPU_TIME_DELTA}};
 
                 for (DatapointDefCIter dpIt = bdlb::ArrayUtil::begin(defs);
                      dpIt != bdlb::ArrayUtil::end(defs);
                      ++dpIt) {
-                    // If there are subcontexts, skip 'confirm_time_max'
-                    // metric, it will be processed later.
-                    if (static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
-                            dpIt->d_stat) == Stat::e_CONFIRM_TIME_MAX &&
+                    // If there are subcontexts, skip 'confirm_time_*'
+                    // max and percentile metrics, they will be processed
+                    // later.
+                    const mqbstat::QueueStatsDomain::Stat::Enum stat =
+                        static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
+                            dpIt->d_stat);
+                    if ((stat == Stat::e_CONFIRM_TIME_MAX ||
+                         stat == Stat::e_CONFIRM_TIME_P50 ||
+                         stat == Stat::e_CONFIRM_TIME_P99 ||
+                         stat == Stat::e_CONFIRM_TIME_P999) &&
                         queueIt->numSubcontexts() > 0) {
                         continue;
                     }
@@ -370,7 +396,7 @@ void PrometheusStatConsumer::captureQueueStats()
                             d_snapshotId,
                             static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
                                 dpIt->d_stat));
-                    updateMetric(dpIt->d_name, labels, value);
+                    updateSeriesMetric(&series, dpIt->d_name, value);
                 }
             }
 
@@ -390,6 +416,18 @@ void PrometheusStatConsumer::captureQueueStats()
                      Stat::e_BYTES_UTILIZATION_MAX},
                     {"queue_queue_time_avg", Stat::e_QUEUE_TIME_AVG},
                     {"queue_queue_time_max", Stat::e_QUEUE_TIME_MAX},
+                    {"queue_queue_time_p50", Stat::e_QUEUE_TIME_P50},
+                    {"queue_queue_time_p99", Stat::e_QUEUE_TIME_P99},
+                    {"queue_queue_time_p999", Stat::e_QUEUE_TIME_P999},
+                    {"queue_dispatch_time_avg", Stat::e_DISPATCH_TIME_AVG},
+                    {"queue_dispatch_time_max", Stat::e_DISPATCH_TIME_MAX},
+                    {"queue_dispatch_time_p99", Stat::e_DISPATCH_TIME_P99},
+                    {"queue_replication_time_avg",
+                     Stat::e_REPLICATION_TIME_AVG},
+                    {"queue_replication_time_max",
+                     Stat::e_REPLICATION_TIME_MAX},
+                    {"queue_replication_time_p99",
+                     Stat::e_REPLICATION_TIME_P99},
                     {"queue_reject_msgs_delta", Stat::e_REJECT_DELTA},
                     {"queue_reject_msgs", Stat::e_REJECT_ABS},
                     {"queue_nack_noquorum_msgs_delta",
@@ -400,10 +438,15 @@ void PrometheusStatConsumer::captureQueueStats()
                 for (DatapointDefCIter dpIt = bdlb::ArrayUtil::begin(defs);
                      dpIt != bdlb::ArrayUtil::end(defs);
                      ++dpIt) {
-                    // If there are subcontexts, skip 'cqueue_time_max' metric,
-                    // it will be processed later.
-                    if (static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
-                            dpIt->d_stat) == Stat::e_QUEUE_TIME_MAX &&
+                    // If there are subcontexts, skip 'queue_time_*' max and
+                    // percentile metrics, they will be processed later.
+                    const mqbstat::QueueStatsDomain::Stat::Enum stat =
+                        static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
+                            dpIt->d_stat);
+                    if ((stat == Stat::e_QUEUE_TIME_MAX ||
+                         stat == Stat::e_QUEUE_TIME_P50 ||
+                         stat == Stat::e_QUEUE_TIME_P99 ||
+                         stat == Stat::e_QUEUE_TIME_P999) &&
                         queueIt->numSubcontexts() > 0) {
                         continue;
                     }
@@ -414,7 +457,7 @@ void PrometheusStatConsumer::captureQueueStats()
                             d_snapshotId,
                             static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
                                 dpIt->d_stat));
-                    updateMetric(dpIt->d_name, labels, value);
+                    updateSeriesMetric(&series, dpIt->d_name, value);
                 }
             }
 
@@ -423,11 +466,17 @@ void PrometheusStatConsumer::captureQueueStats()
             // These per-appId metrics exist for both primary and replica
             static const DatapointDef defsCommon[] = {
                 {"queue_confirm_time_max", Stat::e_CONFIRM_TIME_MAX},
+                {"queue_confirm_time_p50", Stat::e_CONFIRM_TIME_P50},
+                {"queue_confirm_time_p99", Stat::e_CONFIRM_TIME_P99},
+                {"queue_confirm_time_p999", Stat::e_CONFIRM_TIME_P999},
             };
 
             // These per-appId metrics exist only for primary
             static const DatapointDef defsPrimary[] = {
                 {"queue_queue_time_max", Stat::e_QUEUE_TIME_MAX},
+                {"queue_queue_time_p50", Stat::e_QUEUE_TIME_P50},
+                {"queue_queue_time_p99", Stat::e_QUEUE_TIME_P99},
+                {"queue_queue_time_p999", Stat::e_QUEUE_TIME_P999},
                 {"queue_content_msgs_max", Stat::e_MESSAGES_MAX},
                 {"queue_content_bytes_max", Stat::e_BYTES_MAX},
             };
@@ -435,8 +484,16 @@ void PrometheusStatConsumer::captureQueueStats()
                      queueIt->subcontextIterator();
                  appIdIt;
                  ++appIdIt) {
-                tagger.setAppId(appIdIt->name());
-                const auto labels = tagger.getLabels();
+                Series* appIdSeriesPtr = findSeries(appIdIt->uniqueId(),
+                                                    role);
+                if (!appIdSeriesPtr) {
+                    ::prometheus::Labels labels = series.d_labels;
+                    labels["AppId"]             = appIdIt->name();
+                    appIdSeriesPtr = &resetSeries(appIdIt->uniqueId(),
+                                                  role,
+                                                  labels);
+                }
+                Series& appIdSeries = *appIdSeriesPtr;
 
                 for (DatapointDefCIter dpIt =
                          bdlb::ArrayUtil::begin(defsCommon);
@@ -448,7 +505,7 @@ void PrometheusStatConsumer::captureQueueStats()
                             d_snapshotId,
                             static_cast<mqbstat::QueueStatsDomain::Stat::Enum>(
                                 dpIt->d_stat));
-                    updateMetric(dpIt->d_name, labels, value);
+                    updateSeriesMetric(&appIdSeries, dpIt->d_name, value);
                 }
 
                 if (role == mqbstat::QueueStatsDomain::Role::e_PRIMARY) {
@@ -463,12 +520,16 @@ void PrometheusStatConsumer::captureQueueStats()
                                 static_cast<
                                     mqbstat::QueueStatsDomain::Stat::Enum>(
                                     dpIt->d_stat));
-                        updateMetric(dpIt->d_name, labels, value);
+                        updateSeriesMetric(&appIdSeries,
+                                           dpIt->d_name,
+                                           value);
                     }
                 }
             }
         }
     }
+
+    pruneSeries();
 }
 
 void PrometheusStatConsumer::captureSystemStats()
@@ -753,6 +814,11 @@ void PrometheusStatConsumer::captureClusterPartitionsStats()
                                                      "replication_time_ns_avg";
             const bsl::string replication_time_max = prefix +
                                                      "replication_time_ns_max";
+            const bsl::string replica_receipt_time_avg =
+                prefix + "replica_receipt_time_ns_avg";
+            const bsl::string replica_receipt_time_max =
+                prefix + "replica_receipt_time_ns_max";
+            const bsl::string replica_lag_max = prefix + "replica_lag_max";
 
             const DatapointDef defs[] = {
                 {rollover_time.c_str(), Stat::e_PARTITION_ROLLOVER_TIME},
@@ -771,7 +837,12 @@ void PrometheusStatConsumer::captureClusterPartitionsStats()
                 {replication_time_avg.c_str(),
                  Stat::e_PARTITION_REPLICATION_TIME_NS_AVG},
                 {replication_time_max.c_str(),
-                 Stat::e_PARTITION_REPLICATION_TIME_NS_MAX}};
+                 Stat::e_PARTITION_REPLICATION_TIME_NS_MAX},
+                {replica_receipt_time_avg.c_str(),
+                 Stat::e_PARTITION_REPLICA_RECEIPT_TIME_NS_AVG},
+                {replica_receipt_time_max.c_str(),
+                 Stat::e_PARTITION_REPLICA_RECEIPT_TIME_NS_MAX},
+                {replica_lag_max.c_str(), Stat::e_PARTITION_REPLICA_LAG_MAX}};
 
             Tagger tagger;
             tagger.setCluster(clusterIt->name())
@@ -879,6 +950,9 @@ void PrometheusStatConsumer::captureDispatcherStats()
                 {"dispatcher_queue_time_avg", Stat::e_QUEUE_TIME_AVG},
                 {"dispatcher_queue_time_max", Stat::e_QUEUE_TIME_MAX},
                 {"dispatcher_queue_time_abs_max", Stat::e_QUEUE_TIME_ABS_MAX},
+                {"dispatcher_queue_time_p50", Stat::e_QUEUE_TIME_P50},
+                {"dispatcher_queue_time_p99", Stat::e_QUEUE_TIME_P99},
+                {"dispatcher_queue_time_p999", Stat::e_QUEUE_TIME_P999},
                 {"dispatcher_processing_time_undefined_max",
                  Stat::e_PROCESSING_TIME_UNDEFINED_MAX},
                 {"dispatcher_processing_time_undefined_avg",
@@ -983,6 +1057,9 @@ void PrometheusStatConsumer::captureDispatcherStats()
                  Stat::e_PROCESSING_TIME_REPLICATION_RECEIPT_SUM},
                 {"dispatcher_processed_count_replication_receipt",
                  Stat::e_PROCESSED_COUNT_REPLICATION_RECEIPT},
+                {"dispatcher_steal_count", Stat::e_STEAL_COUNT},
+                {"dispatcher_steal_backlog_avg", Stat::e_STEAL_BACKLOG_AVG},
+                {"dispatcher_steal_backlog_max", Stat::e_STEAL_BACKLOG_MAX},
             };
 
             for (DatapointDefCIter dpIt = bdlb::ArrayUtil::begin(defs);
@@ -1003,9 +1080,100 @@ void PrometheusStatConsumer::updateMetric(const char*                 name,
                                           const ::prometheus::Labels& labels,
                                           const bsls::Types::Int64    value)
 {
-    auto& gauge = ::prometheus::BuildGauge().Name(name).Register(
-        *d_prometheusRegistry_p);
-    gauge.Add(labels).Set(static_cast<double>(value));
+    getFamily(name).Add(labels).Set(static_cast<double>(value));
+}
+
+PrometheusStatConsumer::GaugeFamily&
+PrometheusStatConsumer::getFamily(const char* name)
+{
+    FamilyMap::iterator it = d_families.find(name);
+    if (it == d_families.end()) {
+        GaugeFamily& family = ::prometheus::BuildGauge().Name(name).Register(
+            *d_prometheusRegistry_p);
+        it = d_families.emplace(name, &family).first;
+    }
+
+    return *it->second;
+}
+
+PrometheusStatConsumer::Series*
+PrometheusStatConsumer::findSeries(int id, int role)
+{
+    SeriesMap::iterator it = d_series.find(id);
+    if (it == d_series.end() || it->second.d_role != role) {
+        return 0;  // RETURN
+    }
+
+    it->second.d_generation = d_generation;
+    return &it->second;
+}
+
+PrometheusStatConsumer::Series&
+PrometheusStatConsumer::resetSeries(int                         id,
+                                    int                         role,
+                                    const ::prometheus::Labels& labels)
+{
+    Series& series = d_series[id];
+
+    removeGauges(&series);
+    series.d_labels     = labels;
+    series.d_role       = role;
+    series.d_generation = d_generation;
+
+    return series;
+}
+
+void PrometheusStatConsumer::updateSeriesMetric(
+    Series*                  series,
+    const char*              name,
+    const bsls::Types::Int64 value)
+{
+    auto it = series->d_gauges.find(name);
+    if (it == series->d_gauges.end()) {
+        GaugeFamily&      family = getFamily(name);
+        const SeriesGauge gauge  = {&family, &family.Add(series->d_labels), 0};
+        it = series->d_gauges.emplace(name, gauge).first;
+    }
+
+    it->second.d_generation = d_generation;
+    it->second.d_gauge_p->Set(static_cast<double>(value));
+}
+
+void PrometheusStatConsumer::removeGauges(Series* series)
+{
+    for (auto it = series->d_gauges.begin(); it != series->d_gauges.end();
+         ++it) {
+        it->second.d_family_p->Remove(it->second.d_gauge_p);
+    }
+    series->d_gauges.clear();
+}
+
+void PrometheusStatConsumer::pruneSeries()
+{
+    for (SeriesMap::iterator it = d_series.begin(); it != d_series.end();) {
+        Series& series = it->second;
+        if (series.d_generation != d_generation) {
+            // The stat context of this series is gone.
+            removeGauges(&series);
+            it = d_series.erase(it);
+            continue;  // CONTINUE
+        }
+
+        // Remove the metrics of this series which are not reported anymore
+        // (e.g. primary-only metrics after a role change, or queue level
+        // metrics reported per appId).
+        for (auto gIt = series.d_gauges.begin();
+             gIt != series.d_gauges.end();) {
+            if (gIt->second.d_generation != d_generation) {
+                gIt->second.d_family_p->Remove(gIt->second.d_gauge_p);
+                gIt = series.d_gauges.erase(gIt);
+            }
+            else {
+                ++gIt;
+            }
+        }
+        ++it;
+    }
 }
 
 void PrometheusStatConsumer::setPublishInterval(
@@ -1147,6 +1315,11 @@ class PrometheusPushStatExporter : public PrometheusStatExporter {
         while (!d_threadStop) {
             bslmt::LockGuard<bslmt::Mutex> lock(&d_prometheusThreadMutex);
             d_prometheusThreadCondition.wait(&d_prometheusThreadMutex);
+
+            // The full set of series is pushed every time: 'Push' replaces
+            // all the metrics of the grouping key on the gateway, and even
+            // 'PushAdd' replaces all the series of each pushed metric, so
+            // pushing only the series which changed would drop the others.
             auto newReturnCode = d_prometheusGateway_p->Push();
             if (newReturnCode != 200 && newReturnCode != returnCode) {
                 BALL_LOG_WARN << "Push to Prometheus failed with code: "
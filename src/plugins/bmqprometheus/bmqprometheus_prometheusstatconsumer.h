@@ -24,6 +24,13 @@
 //
 //@DESCRIPTION: 'bmqprometheus::PrometheusStatConsumer' handles the publishing
 // of statistics to Prometheus.
+//
+// The gauges of the queue (and appId) time series are kept across publishes,
+// keyed by the unique id of their stat context, so that publishing only
+// updates their values in place: the labels of a queue are only built (and
+// its gauges only registered) the first time it is published, or when its
+// role changes.  Time series which were not published during a publish
+// interval (e.g. those of deleted queues) are removed from the registry.
 
 // MQB
 #include <mqbcfg_brokerconfig.h>
@@ -51,6 +58,8 @@
 
 // PROMETHEUS
 #include <bsl_ostream.h>
+#include <prometheus/family.h>
+#include <prometheus/gauge.h>
 #include <prometheus/labels.h>
 #include <prometheus/registry.h>
 
@@ -104,6 +113,30 @@ class PrometheusStatConsumer : public mqbplug::StatConsumer {
 
     using DatapointDefCIter = const DatapointDef*;
 
+    using GaugeFamily = ::prometheus::Family< ::prometheus::Gauge>;
+
+    /// Map of the gauge families registered so far, by metric name.
+    using FamilyMap = bsl::unordered_map<bsl::string, GaugeFamily*>;
+
+    /// A gauge of a `Series`, and the generation it was last published at.
+    struct SeriesGauge {
+        GaugeFamily*         d_family_p;
+        ::prometheus::Gauge* d_gauge_p;
+        bsls::Types::Int64   d_generation;
+    };
+
+    /// The gauges of a stat context, keyed by the (static) name of their
+    /// metric.
+    struct Series {
+        ::prometheus::Labels                         d_labels;
+        int                                          d_role;
+        bsls::Types::Int64                           d_generation;
+        bsl::unordered_map<const char*, SeriesGauge> d_gauges;
+    };
+
+    /// Map of the published series, by unique id of their stat context.
+    using SeriesMap = bsl::unordered_map<int, Series>;
+
     const bmqst::StatContext* d_systemStatContext_p;
     // The system stat context
 
@@ -161,6 +194,17 @@ class PrometheusStatConsumer : public mqbplug::StatConsumer {
     std::shared_ptr< ::prometheus::Registry> d_prometheusRegistry_p;
     // Container for storing statistics in Prometheus format
 
+    FamilyMap d_families;
+    // Gauge families registered in 'd_prometheusRegistry_p', so that
+    // publishing doesn't look them up in the registry
+
+    SeriesMap d_series;
+    // Queue and appId time series kept across publishes
+
+    bsls::Types::Int64 d_generation;
+    // Number of times queue stats were captured, used to detect the series
+    // which were not published during the last capture
+
   private:
     // PRIVATE ACCESSORS
 
@@ -214,6 +258,35 @@ class PrometheusStatConsumer : public mqbplug::StatConsumer {
                       const ::prometheus::Labels& labels,
                       const bsls::Types::Int64    value);
 
+    /// Return the gauge family of the metric having the specified 'name',
+    /// registering it if needed.
+    GaugeFamily& getFamily(const char* name);
+
+    /// Return the series of the stat context having the specified 'id' if
+    /// it exists and was published with the specified 'role', marking it
+    /// as published at the current generation, and return 0 otherwise.
+    Series* findSeries(int id, int role);
+
+    /// Return the series of the stat context having the specified 'id',
+    /// (re)initialized with the specified 'role' and 'labels' and marked as
+    /// published at the current generation, removing the gauges it
+    /// previously had.
+    Series&
+    resetSeries(int id, int role, const ::prometheus::Labels& labels);
+
+    /// Set the metric having the specified (static) 'name' of the specified
+    /// 'series' to the specified 'value', registering its gauge if needed.
+    void updateSeriesMetric(Series*                  series,
+                            const char*              name,
+                            const bsls::Types::Int64 value);
+
+    /// Remove from the registry the gauges of the specified 'series'.
+    void removeGauges(Series* series);
+
+    /// Remove from the registry the gauges of the series which were not
+    /// published at the current generation.
+    void pruneSeries();
+
     /// Stop plugin
     void stopImpl();
 
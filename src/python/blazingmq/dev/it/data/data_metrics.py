@@ -85,6 +85,9 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_ack_msgs_abs": 0,
                 "queue_ack_time_avg": 0,
                 "queue_ack_time_max": 0,
+                "queue_ack_time_p50": 0,
+                "queue_ack_time_p99": 0,
+                "queue_ack_time_p999": 0,
                 "queue_bytes_current": 0,
                 "queue_bytes_utilization_max": 0,
                 "queue_cfg_bytes": 0,
@@ -93,9 +96,17 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_confirm_msgs_abs": 0,
                 "queue_confirm_time_avg": 0,
                 "queue_confirm_time_max": 0,
+                "queue_confirm_time_p50": 0,
+                "queue_confirm_time_p99": 0,
+                "queue_confirm_time_p999": 0,
                 "queue_consumers_count": 0,
                 "queue_content_bytes": 0,
                 "queue_content_msgs": 0,
+                "queue_cpu_time": 0,
+                "queue_cpu_time_abs": 0,
+                "queue_dispatch_time_avg": 0,
+                "queue_dispatch_time_max": 0,
+                "queue_dispatch_time_p99": 0,
                 "queue_gc_msgs": 0,
                 "queue_gc_msgs_abs": 0,
                 "queue_history_abs": 0,
@@ -116,8 +127,14 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_put_msgs_abs": 0,
                 "queue_queue_time_avg": 0,
                 "queue_queue_time_max": 0,
+                "queue_queue_time_p50": 0,
+                "queue_queue_time_p99": 0,
+                "queue_queue_time_p999": 0,
                 "queue_reject_msgs": 0,
                 "queue_reject_msgs_abs": 0,
+                "queue_replication_time_avg": 0,
+                "queue_replication_time_max": 0,
+                "queue_replication_time_p99": 0,
                 "queue_role": 0,
             }
         },
@@ -127,6 +144,9 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_ack_msgs_abs": 0,
                 "queue_ack_time_avg": 0,
                 "queue_ack_time_max": 0,
+                "queue_ack_time_p50": 0,
+                "queue_ack_time_p99": 0,
+                "queue_ack_time_p999": 0,
                 "queue_bytes_current": 0,
                 "queue_bytes_utilization_max": 0,
                 "queue_cfg_bytes": 0,
@@ -135,9 +155,17 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_confirm_msgs_abs": 0,
                 "queue_confirm_time_avg": 0,
                 "queue_confirm_time_max": 0,
+                "queue_confirm_time_p50": 0,
+                "queue_confirm_time_p99": 0,
+                "queue_confirm_time_p999": 0,
                 "queue_consumers_count": 0,
                 "queue_content_bytes": 0,
                 "queue_content_msgs": 0,
+                "queue_cpu_time": 0,
+                "queue_cpu_time_abs": 0,
+                "queue_dispatch_time_avg": 0,
+                "queue_dispatch_time_max": 0,
+                "queue_dispatch_time_p99": 0,
                 "queue_gc_msgs": 0,
                 "queue_gc_msgs_abs": 0,
                 "queue_history_abs": 0,
@@ -158,8 +186,14 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_put_msgs_abs": 0,
                 "queue_queue_time_avg": 0,
                 "queue_queue_time_max": 0,
+                "queue_queue_time_p50": 0,
+                "queue_queue_time_p99": 0,
+                "queue_queue_time_p999": 0,
                 "queue_reject_msgs": 0,
                 "queue_reject_msgs_abs": 0,
+                "queue_replication_time_avg": 0,
+                "queue_replication_time_max": 0,
+                "queue_replication_time_p99": 0,
                 "queue_role": 0,
             }
         },
@@ -169,6 +203,9 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_ack_msgs_abs": 0,
                 "queue_ack_time_avg": 0,
                 "queue_ack_time_max": 0,
+                "queue_ack_time_p50": 0,
+                "queue_ack_time_p99": 0,
+                "queue_ack_time_p999": 0,
                 "queue_bytes_current": 0,
                 "queue_bytes_utilization_max": 0,
                 "queue_cfg_bytes": 0,
@@ -177,9 +214,17 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_confirm_msgs_abs": 0,
                 "queue_confirm_time_avg": 0,
                 "queue_confirm_time_max": 0,
+                "queue_confirm_time_p50": 0,
+                "queue_confirm_time_p99": 0,
+                "queue_confirm_time_p999": 0,
                 "queue_consumers_count": 0,
                 "queue_content_bytes": 0,
                 "queue_content_msgs": 0,
+                "queue_cpu_time": 0,
+                "queue_cpu_time_abs": 0,
+                "queue_dispatch_time_avg": 0,
+                "queue_dispatch_time_max": 0,
+                "queue_dispatch_time_p99": 0,
                 "queue_gc_msgs": 0,
                 "queue_gc_msgs_abs": 0,
                 "queue_history_abs": 0,
@@ -200,8 +245,14 @@ TEST_QUEUE_STATS_EMPTY = {
                 "queue_put_msgs_abs": 0,
                 "queue_queue_time_avg": 0,
                 "queue_queue_time_max": 0,
+                "queue_queue_time_p50": 0,
+                "queue_queue_time_p99": 0,
+                "queue_queue_time_p999": 0,
                 "queue_reject_msgs": 0,
                 "queue_reject_msgs_abs": 0,
+                "queue_replication_time_avg": 0,
+                "queue_replication_time_max": 0,
+                "queue_replication_time_p99": 0,
                 "queue_role": 0,
             }
         },
@@ -211,6 +262,9 @@ TEST_QUEUE_STATS_EMPTY = {
         "queue_ack_msgs_abs": 0,
         "queue_ack_time_avg": 0,
         "queue_ack_time_max": 0,
+        "queue_ack_time_p50": 0,
+        "queue_ack_time_p99": 0,
+        "queue_ack_time_p999": 0,
         "queue_bytes_current": 0,
         "queue_bytes_utilization_max": 0,
         "queue_cfg_bytes": 0,
@@ -219,9 +273,17 @@ TEST_QUEUE_STATS_EMPTY = {
         "queue_confirm_msgs_abs": 0,
         "queue_confirm_time_avg": 0,
         "queue_confirm_time_max": 0,
+        "queue_confirm_time_p50": 0,
+        "queue_confirm_time_p99": 0,
+        "queue_confirm_time_p999": 0,
         "queue_consumers_count": 0,
         "queue_content_bytes": 0,
         "queue_content_msgs": 0,
+        "queue_cpu_time": 0,
+        "queue_cpu_time_abs": 0,
+        "queue_dispatch_time_avg": 0,
+        "queue_dispatch_time_max": 0,
+        "queue_dispatch_time_p99": 0,
         "queue_gc_msgs": 0,
         "queue_gc_msgs_abs": 0,
         "queue_history_abs": 0,
@@ -242,8 +304,14 @@ TEST_QUEUE_STATS_EMPTY = {
         "queue_put_msgs_abs": 0,
         "queue_queue_time_avg": 0,
         "queue_queue_time_max": 0,
+        "queue_queue_time_p50": 0,
+        "queue_queue_time_p99": 0,
+        "queue_queue_time_p999": 0,
         "queue_reject_msgs": 0,
         "queue_reject_msgs_abs": 0,
+        "queue_replication_time_avg": 0,
+        "queue_replication_time_max": 0,
+        "queue_replication_time_p99": 0,
         "queue_role": 0,
     },
 }
@@ -257,6 +325,8 @@ TEST_QUEUE_STATS_AFTER_POST = _deep_merge(
                     "queue_bytes_current": 96,
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
+                    "queue_cpu_time": 0,
+                    "queue_cpu_time_abs": 0,
                     "queue_msgs_current": 32,
                 }
             },
@@ -265,6 +335,8 @@ TEST_QUEUE_STATS_AFTER_POST = _deep_merge(
                     "queue_bytes_current": 96,
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
+                    "queue_cpu_time": 0,
+                    "queue_cpu_time_abs": 0,
                     "queue_msgs_current": 32,
                 }
             },
@@ -273,6 +345,8 @@ TEST_QUEUE_STATS_AFTER_POST = _deep_merge(
                     "queue_bytes_current": 96,
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
+                    "queue_cpu_time": 0,
+                    "queue_cpu_time_abs": 0,
                     "queue_msgs_current": 32,
                 }
             },
@@ -282,17 +356,28 @@ TEST_QUEUE_STATS_AFTER_POST = _deep_merge(
             "queue_ack_msgs_abs": 32,
             "queue_ack_time_avg": GreaterThan(0),
             "queue_ack_time_max": GreaterThan(0),
+            "queue_ack_time_p50": GreaterThan(0),
+            "queue_ack_time_p99": GreaterThan(0),
+            "queue_ack_time_p999": GreaterThan(0),
             "queue_bytes_current": 96,
             "queue_cfg_bytes": 1048576,
             "queue_cfg_msgs": 1000,
             "queue_content_bytes": 96,
             "queue_content_msgs": 32,
+            "queue_cpu_time": 0,
+            "queue_cpu_time_abs": 0,
+            "queue_dispatch_time_avg": GreaterThan(0),
+            "queue_dispatch_time_max": GreaterThan(0),
+            "queue_dispatch_time_p99": GreaterThan(0),
             "queue_msgs_current": 32,
             "queue_msgs_utilization_max": 3,
             "queue_put_bytes": GreaterThan(0),
             "queue_put_bytes_abs": 96,
             "queue_put_msgs": GreaterThan(0),
             "queue_put_msgs_abs": 32,
+            "queue_replication_time_avg": GreaterThan(0),
+            "queue_replication_time_max": GreaterThan(0),
+            "queue_replication_time_p99": GreaterThan(0),
             "queue_role": 1,
         },
     },
@@ -307,11 +392,19 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_SINGLE_NODE = _deep_merge(
                     "queue_bytes_current": 30,
                     "queue_confirm_time_avg": GreaterThan(0),
                     "queue_confirm_time_max": GreaterThan(0),
+                    "queue_confirm_time_p50": GreaterThan(0),
+                    "queue_confirm_time_p99": GreaterThan(0),
+                    "queue_confirm_time_p999": GreaterThan(0),
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
+                    "queue_cpu_time": 0,
+                    "queue_cpu_time_abs": 0,
                     "queue_msgs_current": 10,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "baz": {
@@ -319,11 +412,19 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_SINGLE_NODE = _deep_merge(
                     "queue_bytes_current": 63,
                     "queue_confirm_time_avg": GreaterThan(0),
                     "queue_confirm_time_max": GreaterThan(0),
+                    "queue_confirm_time_p50": GreaterThan(0),
+                    "queue_confirm_time_p99": GreaterThan(0),
+                    "queue_confirm_time_p999": GreaterThan(0),
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
+                    "queue_cpu_time": 0,
+                    "queue_cpu_time_abs": 0,
                     "queue_msgs_current": 21,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "foo": {
@@ -331,11 +432,19 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_SINGLE_NODE = _deep_merge(
                     "queue_bytes_current": 0,
                     "queue_confirm_time_avg": GreaterThan(0),
                     "queue_confirm_time_max": GreaterThan(0),
+                    "queue_confirm_time_p50": GreaterThan(0),
+                    "queue_confirm_time_p99": GreaterThan(0),
+                    "queue_confirm_time_p999": GreaterThan(0),
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
+                    "queue_cpu_time": 0,
+                    "queue_cpu_time_abs": 0,
                     "queue_msgs_current": 0,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
         },
@@ -344,6 +453,9 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_SINGLE_NODE = _deep_merge(
             "queue_ack_msgs_abs": 32,
             "queue_ack_time_avg": GreaterThan(0),
             "queue_ack_time_max": GreaterThan(0),
+            "queue_ack_time_p50": GreaterThan(0),
+            "queue_ack_time_p99": GreaterThan(0),
+            "queue_ack_time_p999": GreaterThan(0),
             "queue_bytes_current": 63,
             "queue_cfg_bytes": 1048576,
             "queue_cfg_msgs": 1000,
@@ -351,9 +463,17 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_SINGLE_NODE = _deep_merge(
             "queue_confirm_msgs_abs": 65,
             "queue_confirm_time_avg": GreaterThan(0),
             "queue_confirm_time_max": GreaterThan(0),
+            "queue_confirm_time_p50": GreaterThan(0),
+            "queue_confirm_time_p99": GreaterThan(0),
+            "queue_confirm_time_p999": GreaterThan(0),
             "queue_consumers_count": 3,
             "queue_content_bytes": 96,
             "queue_content_msgs": 32,
+            "queue_cpu_time": 0,
+            "queue_cpu_time_abs": 0,
+            "queue_dispatch_time_avg": GreaterThan(0),
+            "queue_dispatch_time_max": GreaterThan(0),
+            "queue_dispatch_time_p99": GreaterThan(0),
             "queue_history_abs": 11,
             "queue_msgs_current": 21,
             "queue_msgs_utilization_max": 3,
@@ -367,6 +487,12 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_SINGLE_NODE = _deep_merge(
             "queue_put_msgs_abs": 32,
             "queue_queue_time_avg": GreaterThan(0),
             "queue_queue_time_max": GreaterThan(0),
+            "queue_queue_time_p50": GreaterThan(0),
+            "queue_queue_time_p99": GreaterThan(0),
+            "queue_queue_time_p999": GreaterThan(0),
+            "queue_replication_time_avg": GreaterThan(0),
+            "queue_replication_time_max": GreaterThan(0),
+            "queue_replication_time_p99": GreaterThan(0),
             "queue_role": 1,
         },
     },
@@ -381,9 +507,14 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_MULTI_NODE = _deep_merge(
                     "queue_bytes_current": 30,
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
+                    "queue_cpu_time": 0,
+                    "queue_cpu_time_abs": 0,
                     "queue_msgs_current": 10,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "baz": {
@@ -391,9 +522,14 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_MULTI_NODE = _deep_merge(
                     "queue_bytes_current": 63,
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
+                    "queue_cpu_time": 0,
+                    "queue_cpu_time_abs": 0,
                     "queue_msgs_current": 21,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "foo": {
@@ -401,9 +537,14 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_MULTI_NODE = _deep_merge(
                     "queue_bytes_current": 0,
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
+                    "queue_cpu_time": 0,
+                    "queue_cpu_time_abs": 0,
                     "queue_msgs_current": 0,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
         },
@@ -414,6 +555,11 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_MULTI_NODE = _deep_merge(
             "queue_consumers_count": 3,
             "queue_content_bytes": 96,
             "queue_content_msgs": 32,
+            "queue_cpu_time": 0,
+            "queue_cpu_time_abs": 0,
+            "queue_dispatch_time_avg": GreaterThan(0),
+            "queue_dispatch_time_max": GreaterThan(0),
+            "queue_dispatch_time_p99": GreaterThan(0),
             "queue_history_abs": 11,
             "queue_msgs_current": 21,
             "queue_msgs_utilization_max": 3,
@@ -423,6 +569,12 @@ TEST_QUEUE_STATS_AFTER_CONFIRM_MULTI_NODE = _deep_merge(
             "queue_push_msgs_abs": AnyValue(),
             "queue_queue_time_avg": GreaterThan(0),
             "queue_queue_time_max": GreaterThan(0),
+            "queue_queue_time_p50": GreaterThan(0),
+            "queue_queue_time_p99": GreaterThan(0),
+            "queue_queue_time_p999": GreaterThan(0),
+            "queue_replication_time_avg": GreaterThan(0),
+            "queue_replication_time_max": GreaterThan(0),
+            "queue_replication_time_p99": GreaterThan(0),
             "queue_role": 1,
         },
     },
@@ -437,11 +589,19 @@ TEST_QUEUE_STATS_AFTER_PURGE_SINGLE_NODE = _deep_merge(
                     "queue_bytes_current": 30,
                     "queue_confirm_time_avg": GreaterThan(0),
                     "queue_confirm_time_max": GreaterThan(0),
+                    "queue_confirm_time_p50": GreaterThan(0),
+                    "queue_confirm_time_p99": GreaterThan(0),
+                    "queue_confirm_time_p999": GreaterThan(0),
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
+                    "queue_cpu_time": 0,
+                    "queue_cpu_time_abs": 0,
                     "queue_msgs_current": 10,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "baz": {
@@ -449,11 +609,19 @@ TEST_QUEUE_STATS_AFTER_PURGE_SINGLE_NODE = _deep_merge(
                     "queue_bytes_current": 0,
                     "queue_confirm_time_avg": GreaterThan(0),
                     "queue_confirm_time_max": GreaterThan(0),
+                    "queue_confirm_time_p50": GreaterThan(0),
+                    "queue_confirm_time_p99": GreaterThan(0),
+                    "queue_confirm_time_p999": GreaterThan(0),
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
+                    "queue_cpu_time": 0,
+                    "queue_cpu_time_abs": 0,
                     "queue_msgs_current": 0,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "foo": {
@@ -461,11 +629,19 @@ TEST_QUEUE_STATS_AFTER_PURGE_SINGLE_NODE = _deep_merge(
                     "queue_bytes_current": 0,
                     "queue_confirm_time_avg": GreaterThan(0),
                     "queue_confirm_time_max": GreaterThan(0),
+                    "queue_confirm_time_p50": GreaterThan(0),
+                    "queue_confirm_time_p99": GreaterThan(0),
+                    "queue_confirm_time_p999": GreaterThan(0),
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
+                    "queue_cpu_time": 0,
+                    "queue_cpu_time_abs": 0,
                     "queue_msgs_current": 0,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
         },
@@ -474,6 +650,9 @@ TEST_QUEUE_STATS_AFTER_PURGE_SINGLE_NODE = _deep_merge(
             "queue_ack_msgs_abs": 32,
             "queue_ack_time_avg": GreaterThan(0),
             "queue_ack_time_max": GreaterThan(0),
+            "queue_ack_time_p50": GreaterThan(0),
+            "queue_ack_time_p99": GreaterThan(0),
+            "queue_ack_time_p999": GreaterThan(0),
             "queue_bytes_current": 30,
             "queue_cfg_bytes": 1048576,
             "queue_cfg_msgs": 1000,
@@ -481,9 +660,17 @@ TEST_QUEUE_STATS_AFTER_PURGE_SINGLE_NODE = _deep_merge(
             "queue_confirm_msgs_abs": 65,
             "queue_confirm_time_avg": GreaterThan(0),
             "queue_confirm_time_max": GreaterThan(0),
+            "queue_confirm_time_p50": GreaterThan(0),
+            "queue_confirm_time_p99": GreaterThan(0),
+            "queue_confirm_time_p999": GreaterThan(0),
             "queue_consumers_count": 3,
             "queue_content_bytes": 96,
             "queue_content_msgs": 32,
+            "queue_cpu_time": 0,
+            "queue_cpu_time_abs": 0,
+            "queue_dispatch_time_avg": GreaterThan(0),
+            "queue_dispatch_time_max": GreaterThan(0),
+            "queue_dispatch_time_p99": GreaterThan(0),
             "queue_history_abs": 22,
             "queue_msgs_current": 10,
             "queue_msgs_utilization_max": 3,
@@ -497,6 +684,12 @@ TEST_QUEUE_STATS_AFTER_PURGE_SINGLE_NODE = _deep_merge(
             "queue_put_msgs_abs": 32,
             "queue_queue_time_avg": GreaterThan(0),
             "queue_queue_time_max": GreaterThan(0),
+            "queue_queue_time_p50": GreaterThan(0),
+            "queue_queue_time_p99": GreaterThan(0),
+            "queue_queue_time_p999": GreaterThan(0),
+            "queue_replication_time_avg": GreaterThan(0),
+            "queue_replication_time_max": GreaterThan(0),
+            "queue_replication_time_p99": GreaterThan(0),
             "queue_role": 1,
         },
     },
@@ -511,9 +704,14 @@ TEST_QUEUE_STATS_AFTER_PURGE_MULTI_NODE = _deep_merge(
                     "queue_bytes_current": 30,
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
+                    "queue_cpu_time": 0,
+                    "queue_cpu_time_abs": 0,
                     "queue_msgs_current": 10,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "baz": {
@@ -521,9 +719,14 @@ TEST_QUEUE_STATS_AFTER_PURGE_MULTI_NODE = _deep_merge(
                     "queue_bytes_current": 0,
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
+                    "queue_cpu_time": 0,
+                    "queue_cpu_time_abs": 0,
                     "queue_msgs_current": 0,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
             "foo": {
@@ -531,9 +734,14 @@ TEST_QUEUE_STATS_AFTER_PURGE_MULTI_NODE = _deep_merge(
                     "queue_bytes_current": 0,
                     "queue_content_bytes": 96,
                     "queue_content_msgs": 32,
+                    "queue_cpu_time": 0,
+                    "queue_cpu_time_abs": 0,
                     "queue_msgs_current": 0,
                     "queue_queue_time_avg": GreaterThan(0),
                     "queue_queue_time_max": GreaterThan(0),
+                    "queue_queue_time_p50": GreaterThan(0),
+                    "queue_queue_time_p99": GreaterThan(0),
+                    "queue_queue_time_p999": GreaterThan(0),
                 }
             },
         },
@@ -544,6 +752,11 @@ TEST_QUEUE_STATS_AFTER_PURGE_MULTI_NODE = _deep_merge(
             "queue_consumers_count": 3,
             "queue_content_bytes": 96,
             "queue_content_msgs": 32,
+            "queue_cpu_time": 0,
+            "queue_cpu_time_abs": 0,
+            "queue_dispatch_time_avg": GreaterThan(0),
+            "queue_dispatch_time_max": GreaterThan(0),
+            "queue_dispatch_time_p99": GreaterThan(0),
             "queue_history_abs": 22,
             "queue_msgs_current": 10,
             "queue_msgs_utilization_max": 3,
@@ -553,6 +766,12 @@ TEST_QUEUE_STATS_AFTER_PURGE_MULTI_NODE = _deep_merge(
             "queue_push_msgs_abs": 31,
             "queue_queue_time_avg": GreaterThan(0),
             "queue_queue_time_max": GreaterThan(0),
+            "queue_queue_time_p50": GreaterThan(0),
+            "queue_queue_time_p99": GreaterThan(0),
+            "queue_queue_time_p999": GreaterThan(0),
+            "queue_replication_time_avg": GreaterThan(0),
+            "queue_replication_time_max": GreaterThan(0),
+            "queue_replication_time_p99": GreaterThan(0),
             "queue_role": 1,
         },
     },
@@ -533,8 +533,10 @@ class MasterAssignmentAlgorithm(Enum):
 
     a partition:
     - E_LEADER_IS_MASTER_ALL: the leader is master for all partitions
-    - E_LEAST_ASSIGNED:       the active node with the least number of
-    partitions assigned is used
+    - E_LEAST_ASSIGNED:       the active node with the least load of
+    partitions assigned is used, each partition
+    weighing by its outstanding bytes and write
+    rate
     """
 
     E_LEADER_IS_MASTER_ALL = "E_LEADER_IS_MASTER_ALL"
@@ -896,15 +898,23 @@ class ResolvedDomain:
 
 class StatsPrinterEncodingFormat(Enum):
     """Bitmask of stats output encoding formats:
-    - NONE:           no stats output (0)
-    - TABLE:          human-readable table format (1)
-    - JSON:           machine-readable JSON format (2)
-    - TABLE_AND_JSON: both formats (TABLE | JSON = 3)"""
+    - NONE:             no stats output (0)
+    - TABLE:            human-readable table format (1)
+    - JSON:             machine-readable JSON format (2)
+    - TABLE_AND_JSON:   both formats (TABLE | JSON = 3)
+    - BINARY:           compact delta-encoded binary format (4)
+    - TABLE_AND_BINARY: TABLE | BINARY = 5
+    - JSON_AND_BINARY:  JSON | BINARY = 6
+    - ALL:              TABLE | JSON | BINARY = 7"""
 
     NONE = "NONE"
     TABLE = "TABLE"
     JSON = "JSON"
     TABLE_AND_JSON = "TABLE_AND_JSON"
+    BINARY = "BINARY"
+    TABLE_AND_BINARY = "TABLE_AND_BINARY"
+    JSON_AND_BINARY = "JSON_AND_BINARY"
+    ALL = "ALL"
 
 
 @dataclass
@@ -970,6 +980,12 @@ class StorageSyncConfig:
     partitionSyncEventSize.........:
     maximum size, in bytes, of bmqp::EventType::PARTITION_SYNC before
     we send it to the peer
+    partitionSyncMaxBytesPerSecond.:
+    maximum rate, in bytes per second, at which
+    bmqp::EventType::PARTITION_SYNC events are written to a peer while
+    serving a partition sync.  Other events to that peer are not
+    rate-limited.  A value of 0 means that partition sync is not
+    rate-limited
     """
 
     startup_recovery_max_duration_ms: int = field(
@@ -1053,6 +1069,15 @@ class StorageSyncConfig:
             "required": True,
         },
     )
+    partition_sync_max_bytes_per_second: int = field(
+        default=0,
+        metadata={
+            "name": "partitionSyncMaxBytesPerSecond",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -1118,11 +1143,19 @@ class TcpInterfaceListener:
     name.................:
     A name to associate this listener to.
     address..............:
-    The IPv4 address this listener will accept connections on.
+    The IPv4 address this listener will accept connections on, or
+    'unix:<path>' to accept connections from clients on this host on a
+    local (Unix domain) socket at 'path', in which case 'port' only
+    identifies the listener and 'acceptShards' must be 1.
     port.................:
     The port this listener will accept connections on.
     tls..................:
     Use TLS on this interface.
+    acceptShards.........:
+    Number of listening sockets opened on this port with SO_REUSEPORT, so
+    that the kernel spreads incoming connections (and their accept and
+    negotiation) across IO threads.  Typically set to 'ioThreads'.  1 (the
+    default) opens a single listening socket.
     """
 
     name: Optional[str] = field(
@@ -1157,6 +1190,15 @@ class TcpInterfaceListener:
             "required": True,
         },
     )
+    accept_shards: int = field(
+        default=1,
+        metadata={
+            "name": "acceptShards",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -1305,6 +1347,33 @@ class DispatcherProcessorConfig:
             "required": True,
         },
     )
+    work_stealing: bool = field(
+        default=False,
+        metadata={
+            "name": "workStealing",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    max_batch_size: int = field(
+        default=1,
+        metadata={
+            "name": "maxBatchSize",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    first_cpu: int = field(
+        default=-1,
+        metadata={
+            "name": "firstCpu",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -1429,6 +1498,88 @@ class PartitionConfig:
     storage files to disk at shutdown
     syncConfig...........: configuration for storage synchronization and
     recovery
+    writebackThreshold...: number of bytes appended to a partition's file
+    after which the broker asynchronously initiates
+    writeback of these bytes to disk, instead of
+    leaving dirty pages to accumulate until the
+    kernel throttles the partition thread.  Zero
+    disables the asynchronous writeback
+    groupCommitMaxBytes..: maximum size, in bytes, of the replication
+    group commit window of a partition.  Zero means
+    the window is only bounded by the maximum size
+    of a replication event
+    groupCommitMaxRecords: maximum number of records in the replication
+    group commit window of a partition.  Zero means
+    the broker's built-in limit
+    groupCommitMaxDelayUs: maximum time, in microseconds, records of a
+    partition are held in the replication group
+    commit window before being sent to the
+    replicas.  Zero disables the group commit
+    window: records are sent at the end of each
+    batch of events processed by the partition
+    recoveryThreads......: number of worker threads used to verify
+    the payloads of a partition's outstanding
+    messages at recovery.  Zero or one means
+    payloads are verified by the partition thread
+    recoveryCheckpoint...: flag to indicate whether the index of a
+    partition's outstanding records should be
+    checkpointed at rollover and clean shutdown,
+    so that recovery only replays the part of the
+    journal written after the checkpoint
+    hugePages............: flag to indicate whether the mappings of a
+    partition's files should be backed by
+    transparent huge pages, where supported by the
+    OS and the file system
+    residentWindowSize...: number of bytes behind the write position of a
+    partition's data and journal files whose pages
+    are kept mapped.  Pages further behind are
+    dropped from the mapping (they remain in the
+    page cache and are faulted back on access), and
+    only this many bytes ahead of the write
+    position are prefaulted when prefaultPages is
+    set.  Zero keeps the whole files mapped
+    precreatePercent.....: usage, in percent of the capacity of the
+    active data or journal file of a partition, at
+    which the next file set is created and
+    prefaulted in the background, so that rollover
+    does not have to create it.  Zero disables the
+    background creation
+    partitionsPerProcessor: number of consecutive partitions assigned
+    to the same queue dispatcher processor.
+    Partition i is served by processor
+    (i / partitionsPerProcessor) % numProcessors,
+    so that one (the default) assigns partitions
+    to processors in a round-robin fashion
+    groupCommitAdaptive..: flag to indicate whether the replication group
+    commit window of a partition is flushed as
+    soon as no other record is expected to join it
+    within groupCommitMaxDelayUs, according to the
+    measured arrival rate of records, instead of
+    always being held for up to
+    groupCommitMaxDelayUs
+    recoveryVerifyPercent: percentage of the messages of a partition whose
+    payload CRC32-C is verified at recovery
+    scrubIntervalMs......: interval, in milliseconds, at which a batch of
+    the outstanding messages of a partition have
+    their payload CRC32-C verified by a worker
+    thread, so that the whole partition is
+    continuously scrubbed without blocking the
+    partition thread.  Zero disables the scrubbing
+    scrubMaxBytesPerSecond: maximum rate, in bytes per second, at which
+    the outstanding messages of a partition are
+    read by the scrubber, so that it does not
+    compete with the broker for disk bandwidth.
+    Zero does not limit the rate
+    readaheadSize........: number of bytes of a partition's data file read
+    ahead asynchronously when a message further
+    than this behind the write position is
+    delivered, so that a slow consumer does not
+    fault in each page of the messages it reaches.
+    Zero disables the readahead
+    dropConsumedPages....: whether the pages of a partition's data file
+    which only hold messages that were deleted are
+    dropped from the page cache, so that it is left
+    to the messages still outstanding
     """
 
     num_partitions: Optional[int] = field(
@@ -1537,6 +1688,150 @@ class PartitionConfig:
             "required": True,
         },
     )
+    writeback_threshold: int = field(
+        default=0,
+        metadata={
+            "name": "writebackThreshold",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    group_commit_max_bytes: int = field(
+        default=0,
+        metadata={
+            "name": "groupCommitMaxBytes",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    group_commit_max_records: int = field(
+        default=0,
+        metadata={
+            "name": "groupCommitMaxRecords",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    group_commit_max_delay_us: int = field(
+        default=0,
+        metadata={
+            "name": "groupCommitMaxDelayUs",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    recovery_threads: int = field(
+        default=0,
+        metadata={
+            "name": "recoveryThreads",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    recovery_checkpoint: bool = field(
+        default=False,
+        metadata={
+            "name": "recoveryCheckpoint",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    huge_pages: bool = field(
+        default=False,
+        metadata={
+            "name": "hugePages",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    resident_window_size: int = field(
+        default=0,
+        metadata={
+            "name": "residentWindowSize",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    precreate_percent: int = field(
+        default=0,
+        metadata={
+            "name": "precreatePercent",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    partitions_per_processor: int = field(
+        default=1,
+        metadata={
+            "name": "partitionsPerProcessor",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    group_commit_adaptive: bool = field(
+        default=False,
+        metadata={
+            "name": "groupCommitAdaptive",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    recovery_verify_percent: int = field(
+        default=100,
+        metadata={
+            "name": "recoveryVerifyPercent",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    scrub_interval_ms: int = field(
+        default=0,
+        metadata={
+            "name": "scrubIntervalMs",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    scrub_max_bytes_per_second: int = field(
+        default=0,
+        metadata={
+            "name": "scrubMaxBytesPerSecond",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    readahead_size: int = field(
+        default=0,
+        metadata={
+            "name": "readaheadSize",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    drop_consumed_pages: bool = field(
+        default=False,
+        metadata={
+            "name": "dropConsumedPages",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -1669,6 +1964,12 @@ class TcpInterfaceConfig:
     listeners:
     A list of listener interfaces to receive TCP connections from. When non-empty
     this option overrides the listener specified by port.
+    eventCaptureFile.....:
+    If non-empty, path of a file to which every event received on the
+    channels of this interface is appended, with its timestamp and
+    channel id, so that the traffic can be replayed later (e.g., with
+    'bmqtool --mode=replay').  Capturing has a significant cost and is
+    meant for troubleshooting only.
     """
 
     name: Optional[str] = field(
@@ -1757,6 +2058,15 @@ class TcpInterfaceConfig:
             "namespace": "http://bloomberg.com/schemas/mqbcfg",
         },
     )
+    event_capture_file: str = field(
+        default="",
+        metadata={
+            "name": "eventCaptureFile",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -2061,6 +2371,11 @@ class AuthenticatorConfig:
     provided by the credential provider to authenticate with other brokers.
     If not specified, the broker will attempt to directly negotiate sessions
     with other brokers without explicitly authenticating.
+    cacheTimeoutMs.......:
+    How long (in milliseconds) a successful authentication result is
+    reused for an identical credential, without calling the
+    authenticator plugin again.  This is capped by the lifetime of the
+    result, if any.  0 (the default) disables the cache.
     """
 
     authenticators: List[AuthenticatorPluginConfig] = field(
@@ -2104,6 +2419,15 @@ class AuthenticatorConfig:
             "namespace": "http://bloomberg.com/schemas/mqbcfg",
         },
     )
+    cache_timeout_ms: int = field(
+        default=0,
+        metadata={
+            "name": "cacheTimeoutMs",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -2212,6 +2536,8 @@ class ClusterProxyDefinition:
     clusterMonitorConfig..: configuration for cluster state monitor
     messageThrottleConfig.: configuration for message throttling intervals and
     thresholds.
+    numUpstreamConnections: number of parallel connections to establish to
+    each node of the cluster, the queues being distributed across them.
     """
 
     name: Optional[str] = field(
@@ -2257,6 +2583,15 @@ class ClusterProxyDefinition:
             "required": True,
         },
     )
+    num_upstream_connections: int = field(
+        default=1,
+        metadata={
+            "name": "numUpstreamConnections",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -2490,6 +2825,33 @@ class AppConfig:
             "namespace": "http://bloomberg.com/schemas/mqbcfg",
         },
     )
+    advertise_compression_algorithms: bool = field(
+        default=False,
+        metadata={
+            "name": "advertiseCompressionAlgorithms",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    advertise_trace_context: bool = field(
+        default=False,
+        metadata={
+            "name": "advertiseTraceContext",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
+    dispatcher_cpu_accounting: bool = field(
+        default=False,
+        metadata={
+            "name": "dispatcherCpuAccounting",
+            "type": "Element",
+            "namespace": "http://bloomberg.com/schemas/mqbcfg",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -104,7 +104,9 @@ class MsgGroupIdConfig:
     internal and our intentions is _not_ to give customers full control
     over those numbers. Their role is to protect BlazingMQ from abuse
     i.e. cases of infinite Group Ids being stored. Another assumption is
-    that 'maxGroups &gt;&gt; number of consumers'. rebalance..: groups
+    that 'maxGroups &gt;&gt; number of consumers'. Note that the broker
+    does not currently route messages by Group Id: this configuration is
+    accepted but has no effect. rebalance..: groups
     will be dynamically rebalanced in way such that all consumers have
     equal share of Group Ids assigned to them maxGroups..: Maximum
     number of groups. If the number of groups gets larger than this, the
@@ -170,6 +172,9 @@ class QueueModeFanout:
     appIDs.............: List of appIDs authorized to consume from the
     queue.
     publishAppIdMetrics: Whether to publish appId metrics.
+    maxAppIdMetrics....: maximum number of appIds, those with the largest
+    backlog, for which metrics are published individually, the metrics of
+    the other appIds being aggregated.  0 (the default) means unlimited
     """
 
     app_ids: List[str] = field(
@@ -190,6 +195,15 @@ class QueueModeFanout:
             "required": True,
         },
     )
+    max_app_id_metrics: int = field(
+        default=0,
+        metadata={
+            "name": "maxAppIdMetrics",
+            "type": "Element",
+            "namespace": "urn:x-bloomberg-com:mqbconfm",
+            "required": True,
+        },
+    )
 
 
 @dataclass
@@ -408,6 +422,22 @@ class Domain:
     PUTs.
     consistency.........: optional consistency mode.
     subscriptions.......: optional application subscriptions
+    maxPutRate..........: maximum number of PUT messages per second each
+    producer may post to a queue of this domain, PUT
+    messages in excess being rejected.  0 (the
+    default) means unlimited
+    deliveryDelay.......: (seconds) minimum time after its arrival before
+    which a message is delivered to consumers.  0
+    (the default) means immediate delivery
+    compactionKey.......: name of the message property identifying the
+    entity a message is an update of.  When not empty, a message
+    superseded by a newer message having the same value of this property
+    is removed from the queue, so that consumers only receive the latest
+    value per entity.  Empty (the default) disables compaction
+    priorityProperty....: name of the integer message property selecting
+    the priority level, from 0 (the default) to 3, of a message.  When not
+    empty, messages of higher levels are delivered first to consumers
+    lagging behind.  Empty (the default) disables priorities
     """
 
     name: Optional[str] = field(
@@ -521,6 +551,42 @@ class Domain:
             "min_occurs": 1,
         },
     )
+    max_put_rate: int = field(
+        default=0,
+        metadata={
+            "name": "maxPutRate",
+            "type": "Element",
+            "namespace": "urn:x-bloomberg-com:mqbconfm",
+            "required": True,
+        },
+    )
+    delivery_delay: int = field(
+        default=0,
+        metadata={
+            "name": "deliveryDelay",
+            "type": "Element",
+            "namespace": "urn:x-bloomberg-com:mqbconfm",
+            "required": True,
+        },
+    )
+    compaction_key: str = field(
+        default="",
+        metadata={
+            "name": "compactionKey",
+            "type": "Element",
+            "namespace": "urn:x-bloomberg-com:mqbconfm",
+            "required": True,
+        },
+    )
+    priority_property: str = field(
+        default="",
+        metadata={
+            "name": "priorityProperty",
+            "type": "Element",
+            "namespace": "urn:x-bloomberg-com:mqbconfm",
+            "required": True,
+        },
+    )
 
 
 @dataclass
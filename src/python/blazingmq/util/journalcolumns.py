@@ -0,0 +1,207 @@
+# Copyright 2026 Bloomberg Finance L.P.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Provide a decoder and a converter for the bmqstoragetool columnar output.
+
+'bmqstoragetool --print-mode=columnar' writes the metadata of the records it
+finds as batches of fixed-width columns.  See 'm_bmqstoragetool_printer.h' for
+the format.
+
+Synopsis:
+
+    # Convert to CSV on stdout
+    $ python -m blazingmq.util.journalcolumns records.cols
+
+    # Convert to Parquet or to an Arrow IPC file (requires 'pyarrow')
+    $ python -m blazingmq.util.journalcolumns records.cols \\
+          --format parquet -o records.parquet
+
+The module contains the following public classes:
+
+Column: the description of one column
+Batch: the decoded values of one batch
+"""
+
+import argparse
+import csv
+import struct
+import sys
+from dataclasses import dataclass
+from typing import BinaryIO, Dict, Iterator, List, Optional, Tuple, Union
+
+MAGIC = b"BMQCOLS1"
+
+# Columns holding raw bytes (keys and GUIDs), converted to hex strings.
+BYTES_COLUMNS = frozenset(("queueKey", "appKey", "guid"))
+
+RECORD_TYPES = {
+    1: "MESSAGE",
+    2: "CONFIRM",
+    3: "DELETION",
+    4: "QUEUE_OP",
+    5: "JOURNAL_OP",
+}
+
+CONFIRM_STATES = {0: "OUTSTANDING", 1: "PARTIALLY_CONFIRMED", 2: "CONFIRMED"}
+
+Value = Union[int, Optional[str]]
+
+
+@dataclass
+class Column:
+    """The name and the width in bytes of one column."""
+
+    name: str
+    width: int
+
+
+@dataclass
+class Batch:
+    """The values of the rows of one batch, per column name."""
+
+    num_rows: int
+    columns: Dict[str, List[Value]]
+
+
+def _read_exactly(file: BinaryIO, size: int) -> bytes:
+    data = file.read(size)
+    if len(data) != size:
+        raise ValueError("truncated columnar stream")
+    return data
+
+
+def _decode_values(column: Column, data: bytes) -> List[Value]:
+    values: List[Value] = []
+    for pos in range(0, len(data), column.width):
+        raw = data[pos : pos + column.width]
+        if column.name in BYTES_COLUMNS:
+            values.append(raw.hex().upper() if any(raw) else None)
+        else:
+            values.append(int.from_bytes(raw, "big"))
+    return values
+
+
+def read_header(file: BinaryIO) -> List[Column]:
+    """Read the header of the columnar stream from the specified file."""
+    if _read_exactly(file, len(MAGIC)) != MAGIC:
+        raise ValueError("not a bmqstoragetool columnar stream")
+    columns = []
+    for _ in range(_read_exactly(file, 1)[0]):
+        name = _read_exactly(file, _read_exactly(file, 1)[0]).decode("ascii")
+        columns.append(Column(name=name, width=_read_exactly(file, 1)[0]))
+    return columns
+
+
+def decode(file: BinaryIO) -> Tuple[List[Column], Iterator[Batch]]:
+    """Decode the columnar stream of the specified binary file.
+
+    Return the columns of the stream and an iterator over its batches.
+    """
+    columns = read_header(file)
+
+    def batches() -> Iterator[Batch]:
+        while True:
+            prefix = file.read(4)
+            if not prefix:
+                return
+            if len(prefix) != 4:
+                raise ValueError("truncated columnar stream")
+            (num_rows,) = struct.unpack(">I", prefix)
+            yield Batch(
+                num_rows=num_rows,
+                columns={
+                    column.name: _decode_values(
+                        column, _read_exactly(file, num_rows * column.width)
+                    )
+                    for column in columns
+                },
+            )
+
+    return columns, batches()
+
+
+def _write_csv(out, columns: List[Column], batches: Iterator[Batch]) -> None:
+    writer = csv.writer(out)
+    names = [column.name for column in columns]
+    writer.writerow(names)
+    enums = {"recordType": RECORD_TYPES, "confirmState": CONFIRM_STATES}
+    for batch in batches:
+        values = [batch.columns[name] for name in names]
+        for name, column in zip(names, values):
+            if name in enums:
+                column[:] = [enums[name].get(v, v) for v in column]
+        for row in zip(*values):
+            writer.writerow(["" if cell is None else cell for cell in row])
+
+
+def _write_arrow(path: str, fmt: str, columns, batches) -> None:
+    try:
+        import pyarrow as pa  # pylint: disable=import-outside-toplevel
+    except ImportError as error:
+        raise SystemExit(f"--format {fmt} requires pyarrow") from error
+
+    fields = []
+    for column in columns:
+        if column.name in BYTES_COLUMNS:
+            fields.append(pa.field(column.name, pa.string()))
+        else:
+            fields.append(pa.field(column.name, pa.uint64()))
+    schema = pa.schema(fields)
+
+    if fmt == "parquet":
+        import pyarrow.parquet as pq  # pylint: disable=import-outside-toplevel
+
+        writer = pq.ParquetWriter(path, schema)
+    else:
+        writer = pa.ipc.new_file(path, schema)
+
+    try:
+        for batch in batches:
+            writer.write_table(pa.Table.from_pydict(batch.columns, schema=schema))
+    finally:
+        writer.close()
+
+
+def main(argv: Optional[List[str]] = None) -> int:
+    parser = argparse.ArgumentParser(
+        description="Convert the bmqstoragetool columnar output."
+    )
+    parser.add_argument("file", help="output of --print-mode=columnar")
+    parser.add_argument(
+        "--format", choices=("csv", "arrow", "parquet"), default="csv"
+    )
+    parser.add_argument(
+        "-o", "--output", help="output file (required unless --format csv)"
+    )
+    args = parser.parse_args(argv)
+
+    with open(args.file, "rb") as file:
+        columns, batches = decode(file)
+        if args.format == "csv":
+            if args.output:
+                with open(args.output, "w", newline="", encoding="ascii") as out:
+                    _write_csv(out, columns, batches)
+            else:
+                _write_csv(sys.stdout, columns, batches)
+        else:
+            if not args.output:
+                parser.error(f"--format {args.format} requires --output")
+            _write_arrow(args.output, args.format, columns, batches)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
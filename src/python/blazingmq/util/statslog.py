@@ -0,0 +1,293 @@
+# Copyright 2026 Bloomberg Finance L.P.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Provide a decoder and a query tool for the broker binary stats log.
+
+The broker writes the binary stats log (the '.bin' companion of the stats
+printer file, enabled with the 'BINARY' bit of 'stats/printer/encoding') using
+'mqbstat::BinaryStatsPrinter': one base64-encoded, delta-encoded record per
+line.  See 'mqbstat_binarystatsprinter.h' for the record format.
+
+Synopsis:
+
+    # Convert a log to one JSON object per (record, context) on stdout
+    $ python -m blazingmq.util.statslog stats.log.bin
+
+    # Only queues of domain 'my.domain', only the 'in_bytes' value
+    $ python -m blazingmq.util.statslog stats.log.bin \\
+          --context '^domainQueues/my.domain/' --value in_bytes
+
+    # CSV output, one row per (record, context, value)
+    $ python -m blazingmq.util.statslog stats.log.bin --format csv
+
+The module contains the following public classes:
+
+Snapshot: the decoded absolute stats of one record
+Decoder: stateful decoder of the lines of a binary stats log
+"""
+
+import argparse
+import base64
+import csv
+import json
+import re
+import sys
+from dataclasses import dataclass, field
+from typing import Dict, Iterable, Iterator, List, Optional, TextIO, Tuple
+
+VERSION = 1
+
+RECORD_KEYFRAME = 1 << 0
+
+CONTEXT_DESCRIBED = 1 << 0
+CONTEXT_NAMED = 1 << 1
+CONTEXT_DELETED = 1 << 2
+
+# In the order of 'bmqstm::StatValueFields'.
+FIELDS = (
+    "absoluteMin",
+    "absoluteMax",
+    "min",
+    "max",
+    "events",
+    "sum",
+    "value",
+    "increments",
+    "decrements",
+)
+
+_MASK64 = (1 << 64) - 1
+
+
+def _to_int64(value: int) -> int:
+    value &= _MASK64
+    return value - (1 << 64) if value >> 63 else value
+
+
+class _Reader:
+    def __init__(self, data: bytes):
+        self._data = data
+        self._pos = 0
+
+    def unsigned(self) -> int:
+        result = 0
+        shift = 0
+        while True:
+            byte = self._data[self._pos]
+            self._pos += 1
+            result |= (byte & 0x7F) << shift
+            if not byte & 0x80:
+                return result
+            shift += 7
+
+    def signed(self) -> int:
+        value = self.unsigned()
+        return (value >> 1) ^ -(value & 1)
+
+    def string(self) -> str:
+        length = self.unsigned()
+        value = self._data[self._pos : self._pos + length]
+        self._pos += length
+        return value.decode("utf-8", errors="replace")
+
+
+@dataclass
+class _Context:
+    name: str
+    value_names: List[str]
+    fields: List[List[int]]
+
+
+@dataclass
+class Snapshot:
+    """The absolute stats of one record of the log."""
+
+    stat_id: int
+    timestamp_ms: int
+    keyframe: bool
+    # context path -> value name -> field name -> value
+    contexts: Dict[str, Dict[str, Dict[str, int]]] = field(default_factory=dict)
+    # paths of the contexts deleted in this record
+    deleted: List[str] = field(default_factory=list)
+
+
+class Decoder:
+    """Stateful decoder of the lines of a binary stats log.
+
+    Records preceding the first keyframe cannot be decoded (their baseline is
+    unknown) and are skipped.
+    """
+
+    def __init__(self) -> None:
+        self._contexts: Dict[int, _Context] = {}
+        self._synced = False
+
+    def decode_line(self, line: str) -> Optional[Snapshot]:
+        """Decode the specified line, returning None if it is skipped."""
+        line = line.strip()
+        if not line:
+            return None
+        return self.decode_record(base64.b64decode(line))
+
+    def decode_record(self, data: bytes) -> Optional[Snapshot]:
+        """Decode the specified raw record, returning None if it is skipped."""
+        reader = _Reader(data)
+        version = reader.unsigned()
+        if version != VERSION:
+            raise ValueError(f"unsupported stats log version {version}")
+        flags = reader.unsigned()
+        keyframe = bool(flags & RECORD_KEYFRAME)
+        snapshot = Snapshot(
+            stat_id=reader.unsigned(),
+            timestamp_ms=reader.unsigned(),
+            keyframe=keyframe,
+        )
+
+        if keyframe:
+            self._contexts = {}
+            self._synced = True
+        if not self._synced:
+            return None
+
+        seen: Dict[int, _Context] = {}
+        for _ in range(reader.unsigned()):
+            self._decode_context(reader, "", snapshot, seen)
+        self._contexts = seen
+        return snapshot
+
+    def _decode_context(
+        self,
+        reader: _Reader,
+        parent: str,
+        snapshot: Snapshot,
+        seen: Dict[int, _Context],
+    ) -> None:
+        unique_id = reader.unsigned()
+        ctx_flags = reader.unsigned()
+
+        ctx = self._contexts.get(unique_id)
+        if ctx_flags & CONTEXT_DESCRIBED:
+            if ctx_flags & CONTEXT_NAMED:
+                name = reader.string()
+            else:
+                name = str(reader.signed())
+            ctx = _Context(name=name, value_names=[], fields=[])
+        elif ctx is None:
+            raise ValueError(f"undescribed context {unique_id}")
+
+        num_values = reader.unsigned()
+        if ctx_flags & CONTEXT_DESCRIBED:
+            ctx.value_names = [reader.string() for _ in range(num_values)]
+            ctx.fields = [[0] * len(FIELDS) for _ in range(num_values)]
+
+        path = f"{parent}/{ctx.name}" if parent else ctx.name
+        values: Dict[str, Dict[str, int]] = {}
+        for index in range(num_values):
+            mask = reader.unsigned()
+            fields = ctx.fields[index]
+            for bit in range(len(FIELDS)):
+                if mask & (1 << bit):
+                    fields[bit] = _to_int64(fields[bit] + reader.signed())
+            values[ctx.value_names[index]] = dict(zip(FIELDS, fields))
+        snapshot.contexts[path] = values
+
+        if ctx_flags & CONTEXT_DELETED:
+            snapshot.deleted.append(path)
+        else:
+            seen[unique_id] = ctx
+
+        for _ in range(reader.unsigned()):
+            self._decode_context(reader, path, snapshot, seen)
+
+
+def decode(lines: Iterable[str]) -> Iterator[Snapshot]:
+    """Decode the specified lines of a binary stats log."""
+    decoder = Decoder()
+    for line in lines:
+        snapshot = decoder.decode_line(line)
+        if snapshot is not None:
+            yield snapshot
+
+
+def _select(
+    snapshot: Snapshot, context: Optional[re.Pattern], value: Optional[str]
+) -> Iterator[Tuple[str, Dict[str, Dict[str, int]]]]:
+    for path, values in snapshot.contexts.items():
+        if context is not None and not context.search(path):
+            continue
+        if value is not None:
+            values = {value: values[value]} if value in values else {}
+            if not values:
+                continue
+        yield path, values
+
+
+def _write_jsonl(out: TextIO, snapshots: Iterable[Snapshot], context, value):
+    for snapshot in snapshots:
+        for path, values in _select(snapshot, context, value):
+            row = {
+                "statId": snapshot.stat_id,
+                "timestampMs": snapshot.timestamp_ms,
+                "context": path,
+                "deleted": path in snapshot.deleted,
+                "values": values,
+            }
+            out.write(json.dumps(row) + "\n")
+
+
+def _write_csv(out: TextIO, snapshots: Iterable[Snapshot], context, value):
+    writer = csv.writer(out)
+    writer.writerow(["statId", "timestampMs", "context", "value", *FIELDS])
+    for snapshot in snapshots:
+        for path, values in _select(snapshot, context, value):
+            for name, fields in values.items():
+                writer.writerow(
+                    [
+                        snapshot.stat_id,
+                        snapshot.timestamp_ms,
+                        path,
+                        name,
+                        *(fields[f] for f in FIELDS),
+                    ]
+                )
+
+
+def main(argv: Optional[List[str]] = None) -> int:
+    parser = argparse.ArgumentParser(
+        description="Convert and query a broker binary stats log."
+    )
+    parser.add_argument("files", nargs="+", help="binary stats log files")
+    parser.add_argument(
+        "--context", help="only output contexts whose path matches REGEX"
+    )
+    parser.add_argument("--value", help="only output the value named VALUE")
+    parser.add_argument("--format", choices=("jsonl", "csv"), default="jsonl")
+    args = parser.parse_args(argv)
+
+    context = re.compile(args.context) if args.context else None
+    write = _write_csv if args.format == "csv" else _write_jsonl
+
+    def lines() -> Iterator[str]:
+        for path in args.files:
+            with open(path, encoding="ascii") as file:
+                yield from file
+
+    write(sys.stdout, decode(lines()), context, args.value)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,67 @@
+# Copyright 2026 Bloomberg Finance L.P.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Test suite for blazingmq.util.journalcolumns."""
+
+import io
+import struct
+
+import pytest
+
+from blazingmq.util import journalcolumns
+
+COLUMNS = (("recordType", 1), ("recordOffset", 8), ("guid", 16))
+
+
+def _header() -> bytes:
+    data = journalcolumns.MAGIC + bytes([len(COLUMNS)])
+    for name, width in COLUMNS:
+        data += bytes([len(name)]) + name.encode() + bytes([width])
+    return data
+
+
+def _batch(rows) -> bytes:
+    data = struct.pack(">I", len(rows))
+    data += bytes(row[0] for row in rows)
+    data += b"".join(struct.pack(">Q", row[1]) for row in rows)
+    data += b"".join(row[2] for row in rows)
+    return data
+
+
+def test_decode_batches():
+    guid = bytes(range(1, 17))
+    stream = io.BytesIO(
+        _header()
+        + _batch([(1, 100, guid), (2, 160, guid)])
+        + _batch([(5, 220, bytes(16))])
+    )
+
+    columns, batches = journalcolumns.decode(stream)
+    batches = list(batches)
+
+    assert [c.name for c in columns] == [name for name, _ in COLUMNS]
+    assert [b.num_rows for b in batches] == [2, 1]
+    assert batches[0].columns["recordType"] == [1, 2]
+    assert batches[0].columns["recordOffset"] == [100, 160]
+    assert batches[0].columns["guid"] == [guid.hex().upper()] * 2
+    assert batches[1].columns["guid"] == [None]
+
+
+def test_decode_truncated():
+    stream = io.BytesIO(_header() + _batch([(1, 100, bytes(16))])[:-1])
+
+    _, batches = journalcolumns.decode(stream)
+    with pytest.raises(ValueError):
+        list(batches)
@@ -0,0 +1,91 @@
+# Copyright 2026 Bloomberg Finance L.P.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Test suite for blazingmq.util.statslog."""
+
+import base64
+
+from blazingmq.util import statslog
+
+VALUE = statslog.FIELDS.index("value")
+INCREMENTS = statslog.FIELDS.index("increments")
+
+
+def _unsigned(value: int) -> bytes:
+    out = bytearray()
+    while value >= 0x80:
+        out.append((value & 0x7F) | 0x80)
+        value >>= 7
+    out.append(value)
+    return bytes(out)
+
+
+def _signed(value: int) -> bytes:
+    return _unsigned(((value << 1) ^ (value >> 63)) & ((1 << 64) - 1))
+
+
+def _string(value: str) -> bytes:
+    return _unsigned(len(value)) + value.encode()
+
+
+def _record(flags, stat_id, ctx_flags, deltas, names=True) -> str:
+    data = (
+        _unsigned(statslog.VERSION)
+        + _unsigned(flags)
+        + _unsigned(stat_id)
+        + _unsigned(1000 * stat_id)
+        + _unsigned(1)  # numContexts
+        + _unsigned(7)  # uniqueId
+        + _unsigned(ctx_flags)
+    )
+    if names:
+        data += _string("ctx")
+    data += _unsigned(1)  # numValues
+    if names:
+        data += _string("in")
+    mask = 0
+    payload = b""
+    for bit, delta in sorted(deltas.items()):
+        mask |= 1 << bit
+        payload += _signed(delta)
+    data += _unsigned(mask) + payload + _unsigned(0)  # numSubcontexts
+    return base64.b64encode(data).decode()
+
+
+def test_decode_deltas():
+    described = statslog.CONTEXT_DESCRIBED | statslog.CONTEXT_NAMED
+    lines = [
+        # Not preceded by a keyframe: skipped
+        _record(0, 1, statslog.CONTEXT_NAMED, {VALUE: 3}, names=False),
+        _record(statslog.RECORD_KEYFRAME, 2, described, {VALUE: 10}),
+        _record(0, 3, statslog.CONTEXT_NAMED, {VALUE: -4}, names=False),
+        _record(
+            0,
+            4,
+            statslog.CONTEXT_NAMED | statslog.CONTEXT_DELETED,
+            {INCREMENTS: 2},
+            names=False,
+        ),
+    ]
+
+    snapshots = list(statslog.decode(lines))
+
+    assert [s.stat_id for s in snapshots] == [2, 3, 4]
+    assert snapshots[0].keyframe
+    assert snapshots[0].contexts["ctx"]["in"]["value"] == 10
+    assert snapshots[1].contexts["ctx"]["in"]["value"] == 6
+    assert snapshots[2].contexts["ctx"]["in"]["value"] == 6
+    assert snapshots[2].contexts["ctx"]["in"]["increments"] == 2
+    assert snapshots[2].deleted == ["ctx"]
@@ -0,0 +1,150 @@
+// Copyright 2026 Bloomberg Finance L.P.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This fuzzer guards the protocol iterators against algorithmic complexity
+// regressions rather than memory errors: it iterates a PUT event (including
+// the options of every message) and a recovery event over the input, and
+// aborts when the time spent exceeds a linear budget in the input size, so
+// that libFuzzer saves the offending input as a crash artifact.  The budget
+// is `k_FIXED_BUDGET_NS + size * nsPerByte`, where `nsPerByte` defaults to
+// `k_DEFAULT_NS_PER_BYTE` and can be overridden through the
+// `BMQFUZZ_NS_PER_BYTE` environment variable (a value of 0 disables the
+// check).
+
+#include <bmqp_optionsview.h>
+#include <bmqp_protocol.h>
+#include <bmqp_putmessageiterator.h>
+#include <bmqp_recoverymessageiterator.h>
+#include <bmqu_blob.h>
+
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bslma_default.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+using namespace BloombergLP;
+
+namespace {
+
+/// Time allowed for any input regardless of its size, absorbing the cost
+/// of allocations and of the sanitizer instrumentation.
+const bsls::Types::Int64 k_FIXED_BUDGET_NS = 10 * 1000 * 1000;  // 10ms
+
+/// Default time allowed per byte of input.
+const bsls::Types::Int64 k_DEFAULT_NS_PER_BYTE = 10 * 1000;  // 10us
+
+/// Return the per-byte budget configured in the environment, or
+/// `k_DEFAULT_NS_PER_BYTE` if none is set.
+bsls::Types::Int64 loadNsPerByte()
+{
+    const char* value = bsl::getenv("BMQFUZZ_NS_PER_BYTE");
+    return value ? bsl::strtoll(value, 0, 10) : k_DEFAULT_NS_PER_BYTE;
+}
+
+void iteratePut(const bdlbb::Blob&        blob,
+                const bmqp::EventHeader&  eventHeader,
+                bool                      decompressFlag,
+                bdlbb::BlobBufferFactory* bufferFactory,
+                bslma::Allocator*         alloc)
+{
+    bmqp::PutMessageIterator iter(bufferFactory, alloc);
+    if (iter.reset(&blob, eventHeader, decompressFlag) != 0) {
+        return;  // RETURN
+    }
+
+    bmqp::OptionsView optionsView(alloc);
+    while (iter.next() == 1) {
+        iter.header();
+        iter.applicationDataSize();
+
+        if (iter.hasOptions() && iter.loadOptionsView(&optionsView) == 0 &&
+            optionsView.isValid()) {
+            for (bmqp::OptionsView::const_iterator it = optionsView.begin();
+                 it != optionsView.end();
+                 ++it) {
+                optionsView.find(*it);
+            }
+        }
+
+        if (decompressFlag && iter.hasMessageProperties()) {
+            bdlbb::Blob propsBlob(bufferFactory, alloc);
+            iter.loadMessageProperties(&propsBlob);
+        }
+    }
+}
+
+void iterateRecovery(const bdlbb::Blob&       blob,
+                     const bmqp::EventHeader& eventHeader)
+{
+    bmqp::RecoveryMessageIterator iter;
+    if (iter.reset(&blob, eventHeader) != 0) {
+        return;  // RETURN
+    }
+
+    while (iter.next() == 1) {
+        iter.header();
+
+        bmqu::BlobPosition position;
+        iter.loadChunkPosition(&position);
+    }
+}
+
+}  // close unnamed namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    if (size < sizeof(bmqp::EventHeader) + 1) {
+        return 0;
+    }
+
+    bool decompressFlag = (data[0] & 1);
+    data++;
+    size--;
+
+    bslma::Allocator*              alloc = bslma::Default::defaultAllocator();
+    bdlbb::PooledBlobBufferFactory bufferFactory(1024, alloc);
+
+    bdlbb::Blob blob(&bufferFactory, alloc);
+    bdlbb::BlobUtil::append(&blob,
+                            reinterpret_cast<const char*>(data),
+                            static_cast<int>(size));
+
+    bmqp::EventHeader eventHeader;
+    bsl::memcpy(&eventHeader, data, sizeof(bmqp::EventHeader));
+
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+
+    iteratePut(blob, eventHeader, decompressFlag, &bufferFactory, alloc);
+    iterateRecovery(blob, eventHeader);
+
+    const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+    static const bsls::Types::Int64 perByte = loadNsPerByte();
+
+    if (perByte > 0 &&
+        elapsed > k_FIXED_BUDGET_NS +
+                      static_cast<bsls::Types::Int64>(size) * perByte) {
+        bsl::cerr << "Iterating " << size << " bytes took " << elapsed
+                  << "ns, exceeding the budget of " << perByte
+                  << "ns per byte" << bsl::endl;
+        bsl::abort();
+    }
+
+    return 0;
+}